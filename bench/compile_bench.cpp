@@ -0,0 +1,185 @@
+/*
+*  bench/compile_bench.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Harness for compiler throughput benchmarks.
+* Runs compiler with -S -ftime-report on each given file repeatedly,
+* and prints median time of each phase, lines per second
+* and peak resident set size of compiler process.
+*
+*   compile_bench [-n runs] [-c compiler] [flags...] file.x...
+*
+* arguments starting with - other than -n, -c are passed to compiler.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+//time report of one compilation
+struct run_result
+{
+  std::map<std::string, double> times;
+  int lines = 0;
+  long max_rss = 0;   //in kilobytes
+};
+
+static const std::vector<std::string> phases = {"lexer", "parser", "analyzer",
+                          "optimizer", "x86_gen", "peephole", "asm-write", "total"};
+
+/*
+parse lines "  name : value" of -ftime-report output,
+text before ':' may have color escape codes, which are ignored
+*/
+static void parse_report(std::string output, run_result& res)
+{
+  std::istringstream inp(output);
+  std::string line;
+  while(std::getline(inp, line)){
+    size_t colon = line.find(" : ");
+    if(colon == std::string::npos) continue;
+    size_t begin = line.find_first_not_of(' ');
+    std::string name = line.substr(begin, colon - begin);
+    std::string value = line.substr(colon + 3);
+    if(name == "lines")
+      res.lines = std::atoi(value.c_str());
+    else if(name != "tokens")
+      res.times[name] = std::atof(value.c_str());
+  }
+}
+
+//run compiler once, its stdout is collected through pipe
+static bool run_compiler(std::vector<std::string>& argv, run_result& res)
+{
+  int fd[2];
+  pid_t pid;
+  int status;
+  struct rusage usage;
+  std::vector<char*> args;
+  std::string output;
+  char buf[4096];
+  ssize_t n;
+
+  if(pipe(fd) != 0) return false;
+  pid = fork();
+  if(pid < 0) return false;
+  if(pid == 0){
+    close(fd[0]);
+    dup2(fd[1], STDOUT_FILENO);
+    close(fd[1]);
+    for(auto& a : argv)
+      args.push_back(const_cast<char*>(a.c_str()));
+    args.push_back(nullptr);
+    execv(args[0], args.data());
+    perror(args[0]);
+    _exit(127);
+  }
+  close(fd[1]);
+  while((n = read(fd[0], buf, sizeof(buf))) > 0)
+    output.append(buf, n);
+  close(fd[0]);
+
+  if(wait4(pid, &status, 0, &usage) < 0) return false;
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) return false;
+  //compiler exits with 0 even on errors, but then prints no report
+  if(output.find("time report:") == std::string::npos){
+    std::cerr<<output;
+    return false;
+  }
+  res.max_rss = usage.ru_maxrss;
+  parse_report(output, res);
+  return true;
+}
+
+static double median(std::vector<double> v)
+{
+  if(v.empty()) return 0.0;
+  std::sort(v.begin(), v.end());
+  size_t m = v.size() / 2;
+  if(v.size() % 2 == 0)
+    return (v[m - 1] + v[m]) / 2.0;
+  return v[m];
+}
+
+static bool bench_file(std::string compiler, std::vector<std::string>& flags,
+                        std::string file, int runs)
+{
+  std::vector<std::string> argv = {compiler, "-S", "-ftime-report"};
+  std::map<std::string, std::vector<double>> samples;
+  long max_rss = 0;
+  int lines = 0;
+
+  argv.insert(argv.end(), flags.begin(), flags.end());
+  argv.push_back(file);
+
+  for(int i = 0; i < runs; i++){
+    run_result res;
+    if(!run_compiler(argv, res)){
+      std::cerr<<"compile_bench: failed to compile "<<file<<std::endl;
+      return false;
+    }
+    for(auto& t : res.times)
+      samples[t.first].push_back(t.second);
+    max_rss = std::max(max_rss, res.max_rss);
+    lines = res.lines;
+  }
+
+  double total = median(samples["total"]);
+  std::cout<<file;
+  for(auto& f : flags)
+    std::cout<<" "<<f;
+  std::cout<<" ("<<lines<<" lines, "<<runs<<" runs)"<<std::endl;
+  std::cout<<std::fixed;
+  for(auto& p : phases){
+    std::cout.precision(6);
+    std::cout<<"  "<<p<<" : "<<median(samples[p])<<" s"<<std::endl;
+  }
+  std::cout.precision(0);
+  if(total > 0.0)
+    std::cout<<"  throughput : "<<lines / total<<" lines/s"<<std::endl;
+  std::cout<<"  peak rss : "<<max_rss<<" KB"<<std::endl;
+  std::cout.unsetf(std::ios_base::floatfield);
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  std::string compiler = "build/xlang";
+  std::vector<std::string> flags;
+  std::vector<std::string> files;
+  int runs = 5;
+
+  for(int i = 1; i < argc; i++){
+    std::string arg = argv[i];
+    if(arg == "-n" && i + 1 < argc){
+      runs = std::atoi(argv[++i]);
+    }else if(arg == "-c" && i + 1 < argc){
+      compiler = argv[++i];
+    }else if(arg[0] == '-'){
+      flags.push_back(arg);
+    }else{
+      files.push_back(arg);
+    }
+  }
+  if(files.empty() || runs < 1){
+    std::cerr<<"usage: compile_bench [-n runs] [-c compiler] [flags...] file.x..."<<std::endl;
+    return 1;
+  }
+
+  for(auto& f : files){
+    if(!bench_file(compiler, flags, f, runs))
+      return 1;
+  }
+  return 0;
+}
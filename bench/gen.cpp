@@ -0,0 +1,206 @@
+/*
+*  bench/gen.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Generator of synthetic xlang programs for compiler benchmarks.
+* Size of generated program is controlled by name=value arguments,
+*
+*   functions=N   number of functions called from main
+*   statements=M  number of statements in each function
+*   depth=D       depth of expression trees
+*   width=W       number of operands at each level of expression tree
+*   records=R     number of record types, each with a global variable
+*   globals=G     number of global int variables assigned in main
+*   nesting=N     depth of nested if statements at end of each function
+*   strings=S     number of string literals printed by main
+*   floats=F      number of float literal assignments in main
+*   array=A       size of global int array initializer
+*   seed=X        seed of random numbers, same seed gives same program
+*
+* generated program is written to standard output.
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdlib>
+
+struct gen_options
+{
+  int functions = 10;
+  int statements = 20;
+  int depth = 3;
+  int width = 2;
+  int records = 4;
+  int globals = 0;
+  int nesting = 0;
+  int strings = 10;
+  int floats = 10;
+  int array = 100;
+  unsigned seed = 1;
+};
+
+static std::mt19937 rng;
+
+static int random_int(int lo, int hi)
+{
+  std::uniform_int_distribution<int> dist(lo, hi);
+  return dist(rng);
+}
+
+static const std::vector<std::string> variables = {"a", "b", "c", "d", "p", "q"};
+static const std::vector<std::string> operators = {"+", "-", "*", "&", "|", "^"};
+
+//operand is variable or positive literal, negative literals are not parsed
+static std::string gen_operand(bool literal)
+{
+  if(literal && random_int(0, 3) == 0)
+    return std::to_string(random_int(1, 99));
+  return variables[random_int(0, variables.size() - 1)];
+}
+
+/*
+expression tree of given depth, each level joins width operands,
+first operand is always a variable so that no operator has
+only literal operands, which are not folded for bitwise operators
+*/
+static std::string gen_expression(int depth, int width, bool top)
+{
+  std::string exp;
+  if(depth <= 0)
+    return gen_operand(false);
+  for(int i = 0; i < width; i++){
+    if(i > 0)
+      exp += " " + operators[random_int(0, operators.size() - 1)] + " ";
+    if(depth == 1)
+      exp += gen_operand(i > 0);
+    else
+      exp += gen_expression(depth - 1, width, false);
+  }
+  if(top) return exp;
+  return "(" + exp + ")";
+}
+
+static std::string gen_assignment(gen_options& opt, std::string indent)
+{
+  std::string var = variables[random_int(0, 3)];
+  return indent + var + " = " + gen_expression(opt.depth, opt.width, true) + ";\n";
+}
+
+static void gen_statement(gen_options& opt, int n)
+{
+  //every 5th statement is if/else, every 7th is a for loop
+  if(n % 5 == 4){
+    std::cout<<"  if("<<variables[random_int(0, 3)]<<" < "<<gen_operand(true)<<"){\n";
+    std::cout<<gen_assignment(opt, "    ");
+    std::cout<<"  }else{\n";
+    std::cout<<gen_assignment(opt, "    ");
+    std::cout<<"  }\n";
+  }else if(n % 7 == 6){
+    std::cout<<"  for(i = 0; i < "<<random_int(2, 50)<<"; i++){\n";
+    std::cout<<gen_assignment(opt, "    ");
+    std::cout<<"  }\n";
+  }else{
+    std::cout<<gen_assignment(opt, "  ");
+  }
+}
+
+static void gen_program(gen_options& opt)
+{
+  std::cout<<"extern void printf(char*, int);\n\n";
+
+  for(int r = 0; r < opt.records; r++){
+    std::cout<<"record rec"<<r<<"{\n";
+    //member names must be unique across all records
+    std::cout<<"  int x"<<r<<";\n  char ch"<<r<<";\n  float f"<<r<<";\n  double d"<<r<<";\n";
+    std::cout<<"}\n\n";
+    std::cout<<"rec"<<r<<" rv"<<r<<";\n\n";
+  }
+
+  if(opt.array > 0){
+    std::cout<<"int garray["<<opt.array<<"] = {";
+    for(int i = 0; i < opt.array; i++){
+      if(i > 0) std::cout<<",";
+      if(i % 16 == 15) std::cout<<"\n  ";
+      std::cout<<random_int(0, 9999);
+    }
+    std::cout<<"};\n\n";
+  }
+  std::cout<<"float gfloat;\n\n";
+  for(int g = 0; g < opt.globals; g++)
+    std::cout<<"int gvar"<<g<<";\n";
+  if(opt.globals > 0)
+    std::cout<<"\n";
+
+  for(int f = 0; f < opt.functions; f++){
+    std::cout<<"int func"<<f<<"(int p, int q)\n{\n";
+    std::cout<<"  int a, b, c, d, i;\n";
+    std::cout<<"  a = p;\n  b = q;\n  c = "<<random_int(1, 99)<<";\n  d = "
+             <<random_int(1, 99)<<";\n";
+    for(int s = 0; s < opt.statements; s++)
+      gen_statement(opt, s);
+    for(int n = 0; n < opt.nesting; n++){
+      std::cout<<std::string(n * 2 + 2, ' ')<<"if("<<variables[random_int(0, 3)]
+               <<" < "<<gen_operand(true)<<"){\n";
+      std::cout<<gen_assignment(opt, std::string(n * 2 + 4, ' '));
+    }
+    for(int n = opt.nesting - 1; n >= 0; n--)
+      std::cout<<std::string(n * 2 + 2, ' ')<<"}\n";
+    std::cout<<"  return a + b + c + d;\n}\n\n";
+  }
+
+  std::cout<<"global int main()\n{\n  int x;\n  x = 1;\n";
+  for(int f = 0; f < opt.functions; f++)
+    std::cout<<"  x = func"<<f<<"(x, "<<random_int(1, 99)<<");\n";
+  for(int r = 0; r < opt.records; r++)
+    std::cout<<"  rv"<<r<<".x"<<r<<" = x;\n";
+  for(int g = 0; g < opt.globals; g++)
+    std::cout<<"  gvar"<<g<<" = x + "<<g<<";\n";
+  for(int i = 0; i < opt.floats; i++)
+    std::cout<<"  gfloat = gfloat * "<<random_int(1, 9)<<"."<<random_int(0, 999)
+             <<" + "<<i<<".5;\n";
+  for(int i = 0; i < opt.strings; i++)
+    std::cout<<"  printf(\"string "<<i<<" value = %d\\n\", x);\n";
+  std::cout<<"  return 0;\n}\n";
+}
+
+static bool get_option(std::string arg, std::string name, int* value)
+{
+  if(arg.compare(0, name.size() + 1, name + "=") != 0) return false;
+  *value = std::atoi(arg.substr(name.size() + 1).c_str());
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  gen_options opt;
+  int seed = 1;
+
+  for(int i = 1; i < argc; i++){
+    std::string arg = argv[i];
+    if(get_option(arg, "functions", &opt.functions)) continue;
+    if(get_option(arg, "statements", &opt.statements)) continue;
+    if(get_option(arg, "depth", &opt.depth)) continue;
+    if(get_option(arg, "width", &opt.width)) continue;
+    if(get_option(arg, "records", &opt.records)) continue;
+    if(get_option(arg, "globals", &opt.globals)) continue;
+    if(get_option(arg, "nesting", &opt.nesting)) continue;
+    if(get_option(arg, "strings", &opt.strings)) continue;
+    if(get_option(arg, "floats", &opt.floats)) continue;
+    if(get_option(arg, "array", &opt.array)) continue;
+    if(get_option(arg, "seed", &seed)){
+      opt.seed = seed;
+      continue;
+    }
+    std::cerr<<"gen: unknown option "<<arg<<std::endl;
+    return 1;
+  }
+  if(opt.width < 1) opt.width = 1;
+
+  rng.seed(opt.seed);
+  gen_program(opt);
+  return 0;
+}
@@ -0,0 +1,59 @@
+extern void printf(char*, int);
+
+int sieve[1000000];
+int values[4096];
+
+//count primes below 1000000 with sieve of eratosthenes
+int count_primes()
+{
+  int i, j, v, count;
+  for(i = 0; i < 1000000; i++){
+    sieve[i] = 1;
+  }
+  count = 0;
+  for(i = 2; i < 1000000; i++){
+    v = sieve[i];
+    if(v == 1){
+      count++;
+      for(j = i + i; j < 1000000; j = j + i){
+        sieve[j] = 0;
+      }
+    }
+  }
+  return count;
+}
+
+//repeated prefix sums over array
+int prefix_sums()
+{
+  int i, k, r, v1, v2, sum;
+  for(i = 0; i < 4096; i++){
+    values[i] = i & 255;
+  }
+  sum = 0;
+  for(r = 0; r < 200; r++){
+    for(i = 1; i < 4096; i++){
+      k = i - 1;
+      v1 = values[i];
+      v2 = values[k];
+      values[i] = v1 + v2;
+    }
+    v1 = values[4095];
+    sum = sum + v1;
+    for(i = 0; i < 4096; i++){
+      v1 = values[i];
+      values[i] = v1 & 1023;
+    }
+  }
+  return sum;
+}
+
+global int main()
+{
+  int primes, sum;
+  primes = count_primes();
+  sum = prefix_sums();
+  printf("primes = %d\n", primes);
+  printf("sum = %d\n", sum);
+  return 0;
+}
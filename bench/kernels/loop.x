@@ -0,0 +1,46 @@
+extern void printf(char*, int);
+
+/*
+collatz sequence lengths of numbers below limit,
+nested loops with division, multiply and branches
+*/
+int collatz_steps(int n)
+{
+  int steps, r;
+  steps = 0;
+  while(n != 1){
+    r = n % 2;
+    if(r == 0){
+      n = n / 2;
+    }else{
+      n = 3 * n + 1;
+    }
+    steps++;
+  }
+  return steps;
+}
+
+global int main()
+{
+  int i, j, t, steps, max_steps, sum;
+  max_steps = 0;
+  sum = 0;
+  for(i = 1; i < 100000; i++){
+    steps = collatz_steps(i);
+    sum = sum + steps;
+    if(steps > max_steps){
+      max_steps = steps;
+    }
+  }
+  for(i = 0; i < 3000; i++){
+    for(j = 0; j < 1000; j++){
+      t = i ^ j;
+      sum = sum + t * 3;
+      t = j & 7;
+      sum = sum - t;
+    }
+  }
+  printf("max steps = %d\n", max_steps);
+  printf("sum = %d\n", sum);
+  return 0;
+}
@@ -0,0 +1,161 @@
+/*
+*  bench/micro_bench.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Micro benchmarks of compiler data structures,
+* symbol table insert/search, keyword lookup done by lexer
+* and register allocator.
+* Linked with object files of compiler in src/ directory.
+*
+*   micro_bench [iterations]
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+#include "../src/symtab.hpp"
+#include "../src/lex.hpp"
+#include "../src/regs.hpp"
+
+typedef std::chrono::steady_clock bench_clock;
+
+static double elapsed(bench_clock::time_point start)
+{
+  return std::chrono::duration<double>(bench_clock::now() - start).count();
+}
+
+static void print_result(std::string name, double seconds, long operations)
+{
+  std::cout<<"  "<<name<<" : "<<seconds * 1e9 / operations<<" ns/op ("
+           <<operations<<" ops, "<<seconds<<" s)"<<std::endl;
+}
+
+//symbols are inserted in symbol table of each function,
+//so insert/search are measured over function sized tables
+static void bench_symtab(int iterations)
+{
+  const int symbols = 64;
+  std::vector<std::string> names;
+  struct xlang::st_node* symtab = nullptr;
+  bench_clock::time_point start;
+  double insert_time = 0.0, search_time = 0.0;
+  long found = 0;
+
+  for(int i = 0; i < symbols; i++)
+    names.push_back("symbol_" + std::to_string(i));
+
+  for(int it = 0; it < iterations; it++){
+    symtab = xlang::symtable::get_node_mem();
+    start = bench_clock::now();
+    //parser sets symbol name through last_symbol after insertion
+    for(auto& n : names){
+      xlang::symtable::insert_symbol(&symtab, n);
+      xlang::last_symbol->symbol = n;
+    }
+    insert_time += elapsed(start);
+
+    start = bench_clock::now();
+    for(int r = 0; r < 4; r++){
+      for(auto& n : names){
+        if(xlang::symtable::search_symbol_node(symtab, n) != nullptr)
+          found++;
+      }
+    }
+    search_time += elapsed(start);
+    xlang::symtable::delete_node(&symtab);
+  }
+
+  if(found != 4L * symbols * iterations)
+    std::cerr<<"micro_bench: symbol table search failed"<<std::endl;
+  print_result("symtab insert", insert_time, (long)symbols * iterations);
+  print_result("symtab search", search_time, 4L * symbols * iterations);
+}
+
+//every identifier is looked up in keyword table by lexer
+static void bench_keywords(int iterations)
+{
+  const std::vector<std::string> words = {"int", "char", "double", "float",
+      "record", "if", "else", "for", "while", "do", "return", "break",
+      "continue", "goto", "global", "extern", "sizeof", "asm",
+      "alpha", "beta", "counter", "index", "value", "result"};
+  char filename[] = "/tmp/xlang_bench_XXXXXX";
+  int fd = mkstemp(filename);
+  long tokens = 0;
+  bench_clock::time_point start;
+  double lex_time = 0.0;
+
+  if(fd < 0){
+    std::cerr<<"micro_bench: cannot create temporary file"<<std::endl;
+    return;
+  }
+  close(fd);
+  std::ofstream out(filename);
+  for(int i = 0; i < 20000; i++){
+    out<<words[i % words.size()];
+    out<<((i % 8 == 7) ? "\n" : " ");
+  }
+  out.close();
+
+  for(int it = 0; it < iterations / 100 + 1; it++){
+    xlang::lexer* lx = new xlang::lexer(filename);
+    start = bench_clock::now();
+    while(lx->get_next_token().token != END_OF_FILE)
+      tokens++;
+    lex_time += elapsed(start);
+    delete lx;
+  }
+  std::remove(filename);
+  print_result("lexer keyword/identifier token", lex_time, tokens);
+}
+
+//registers are allocated and freed for each expression operand
+static void bench_regs(int iterations)
+{
+  xlang::regs reg;
+  bench_clock::time_point start;
+  long operations = 0;
+
+  start = bench_clock::now();
+  for(int it = 0; it < iterations * 64; it++){
+    regs_t r1 = reg.allocate_register(4);
+    regs_t r2 = reg.allocate_register(4);
+    regs_t r3 = reg.allocate_register(1);
+    reg.free_register(r3);
+    reg.free_register(r2);
+    reg.free_register(r1);
+    operations += 3;
+  }
+  print_result("integer register allocate/free", elapsed(start), operations);
+
+  operations = 0;
+  start = bench_clock::now();
+  for(int it = 0; it < iterations * 64; it++){
+    fregs_t f1 = reg.allocate_float_register();
+    fregs_t f2 = reg.allocate_xmm_register();
+    reg.free_float_register(f2);
+    reg.free_float_register(f1);
+    operations += 2;
+  }
+  print_result("float register allocate/free", elapsed(start), operations);
+}
+
+int main(int argc, char** argv)
+{
+  int iterations = 10000;
+  if(argc > 1)
+    iterations = std::atoi(argv[1]);
+  if(iterations < 1) iterations = 1;
+
+  std::cout<<"micro benchmarks ("<<iterations<<" iterations)"<<std::endl;
+  bench_symtab(iterations);
+  bench_keywords(iterations);
+  bench_regs(iterations);
+  return 0;
+}
@@ -0,0 +1,29294 @@
+extern void printf(char*, int);
+
+record rec0{
+  int x0;
+  char ch0;
+  float f0;
+  double d0;
+}
+
+rec0 rv0;
+
+record rec1{
+  int x1;
+  char ch1;
+  float f1;
+  double d1;
+}
+
+rec1 rv1;
+
+record rec2{
+  int x2;
+  char ch2;
+  float f2;
+  double d2;
+}
+
+rec2 rv2;
+
+record rec3{
+  int x3;
+  char ch3;
+  float f3;
+  double d3;
+}
+
+rec3 rv3;
+
+record rec4{
+  int x4;
+  char ch4;
+  float f4;
+  double d4;
+}
+
+rec4 rv4;
+
+record rec5{
+  int x5;
+  char ch5;
+  float f5;
+  double d5;
+}
+
+rec5 rv5;
+
+record rec6{
+  int x6;
+  char ch6;
+  float f6;
+  double d6;
+}
+
+rec6 rv6;
+
+record rec7{
+  int x7;
+  char ch7;
+  float f7;
+  double d7;
+}
+
+rec7 rv7;
+
+record rec8{
+  int x8;
+  char ch8;
+  float f8;
+  double d8;
+}
+
+rec8 rv8;
+
+record rec9{
+  int x9;
+  char ch9;
+  float f9;
+  double d9;
+}
+
+rec9 rv9;
+
+record rec10{
+  int x10;
+  char ch10;
+  float f10;
+  double d10;
+}
+
+rec10 rv10;
+
+record rec11{
+  int x11;
+  char ch11;
+  float f11;
+  double d11;
+}
+
+rec11 rv11;
+
+record rec12{
+  int x12;
+  char ch12;
+  float f12;
+  double d12;
+}
+
+rec12 rv12;
+
+record rec13{
+  int x13;
+  char ch13;
+  float f13;
+  double d13;
+}
+
+rec13 rv13;
+
+record rec14{
+  int x14;
+  char ch14;
+  float f14;
+  double d14;
+}
+
+rec14 rv14;
+
+record rec15{
+  int x15;
+  char ch15;
+  float f15;
+  double d15;
+}
+
+rec15 rv15;
+
+record rec16{
+  int x16;
+  char ch16;
+  float f16;
+  double d16;
+}
+
+rec16 rv16;
+
+record rec17{
+  int x17;
+  char ch17;
+  float f17;
+  double d17;
+}
+
+rec17 rv17;
+
+record rec18{
+  int x18;
+  char ch18;
+  float f18;
+  double d18;
+}
+
+rec18 rv18;
+
+record rec19{
+  int x19;
+  char ch19;
+  float f19;
+  double d19;
+}
+
+rec19 rv19;
+
+record rec20{
+  int x20;
+  char ch20;
+  float f20;
+  double d20;
+}
+
+rec20 rv20;
+
+record rec21{
+  int x21;
+  char ch21;
+  float f21;
+  double d21;
+}
+
+rec21 rv21;
+
+record rec22{
+  int x22;
+  char ch22;
+  float f22;
+  double d22;
+}
+
+rec22 rv22;
+
+record rec23{
+  int x23;
+  char ch23;
+  float f23;
+  double d23;
+}
+
+rec23 rv23;
+
+record rec24{
+  int x24;
+  char ch24;
+  float f24;
+  double d24;
+}
+
+rec24 rv24;
+
+record rec25{
+  int x25;
+  char ch25;
+  float f25;
+  double d25;
+}
+
+rec25 rv25;
+
+record rec26{
+  int x26;
+  char ch26;
+  float f26;
+  double d26;
+}
+
+rec26 rv26;
+
+record rec27{
+  int x27;
+  char ch27;
+  float f27;
+  double d27;
+}
+
+rec27 rv27;
+
+record rec28{
+  int x28;
+  char ch28;
+  float f28;
+  double d28;
+}
+
+rec28 rv28;
+
+record rec29{
+  int x29;
+  char ch29;
+  float f29;
+  double d29;
+}
+
+rec29 rv29;
+
+record rec30{
+  int x30;
+  char ch30;
+  float f30;
+  double d30;
+}
+
+rec30 rv30;
+
+record rec31{
+  int x31;
+  char ch31;
+  float f31;
+  double d31;
+}
+
+rec31 rv31;
+
+int garray[5000] = {4170,9971,7203,9325,1,1281,3023,9990,1467,2360,923,3965,1862,3879,3455,
+  6697,3967,9355,5388,8463,4191,3132,6852,5245,2044,4434,8781,2295,273,5344,6704,
+  9139,4173,4572,5586,4306,1403,9391,1981,7783,8007,7159,9682,8027,3134,928,6923,
+  5181,8763,8650,8946,8291,850,8296,390,2730,1698,592,8781,6705,983,5930,4211,
+  6716,9578,4117,5331,1975,6918,2896,3155,1421,6865,7833,8346,4125,182,341,7501,
+  6240,9888,6606,7481,2984,2804,4461,7892,2221,1032,733,4478,4692,9085,961,2936,
+  9033,2877,1194,1300,5247,193,836,6788,9168,2116,9104,2655,2989,4915,5843,533,
+  5659,5741,6139,1467,9565,5893,2609,6997,2310,1023,5334,4140,9499,6944,4930,4141,
+  5406,499,7654,5358,453,6637,1399,5148,7924,9445,298,5865,8831,9034,5407,1374,
+  4479,1392,8921,8073,3775,3976,5384,1653,6522,9275,3612,3477,5710,7508,6378,7259,
+  1263,8833,6902,6236,6477,7509,3539,3488,7632,2699,3565,8958,7527,4280,8813,9648,
+  116,6634,4981,6216,737,1147,7869,9494,640,4499,3553,5783,9418,4081,3798,2370,
+  7629,9033,7715,5736,3013,28,7727,6171,1529,3266,5786,5270,90,8859,7090,3572,
+  4706,9085,7645,6233,4673,158,2690,9294,8316,6908,5513,9973,700,1723,4724,1371,
+  7427,9325,1919,6968,4643,660,2303,7554,5082,7538,2085,9230,493,7115,5188,1242,
+  1722,198,3963,262,1073,283,5098,2462,1021,8600,2887,5388,2317,5528,9676,8420,
+  2783,1241,2336,2791,915,5857,5700,9695,4179,5610,3678,186,8129,8006,2897,2329,
+  7173,8071,6129,3878,4269,8635,7518,7471,4278,5562,4283,1364,3619,599,1533,1213,
+  9371,445,9164,1074,7819,2257,6163,7129,359,5597,6543,125,1297,719,2943,9672,
+  3608,5681,2746,2032,739,2523,1521,7438,1616,1954,9387,5813,3711,9700,500,8468,
+  7409,2398,2986,4937,2043,6199,9817,8289,8930,1567,7593,185,6511,700,396,4863,
+  8138,6063,7625,5688,4552,3173,5318,9886,1093,5797,1460,3801,5087,5509,2156,7453,
+  9164,6692,4621,2649,1322,663,7642,3700,2127,6297,742,2101,954,7527,1622,665,
+  3564,2603,953,8047,1432,1934,9310,6394,5765,5246,8396,9248,6232,2632,3245,659,
+  7280,7350,5227,7721,7368,9078,1654,9319,6870,139,4268,2343,7285,6167,7563,9490,
+  3976,9501,9252,5566,2035,9156,80,6415,9263,3900,2945,4859,1669,6043,241,5495,
+  4520,9261,8083,9187,3683,3948,6092,9632,348,1739,3545,1263,785,1350,6931,5056,
+  127,215,4595,9479,9613,8271,3341,150,4720,1761,1053,3320,5030,1309,8856,8094,
+  5343,3447,2814,9401,3545,5820,8962,8788,2414,8447,238,9053,9657,4598,4299,5463,
+  3462,7986,5770,2857,1265,4902,9500,5991,3136,155,9528,5934,2183,4336,2487,8073,
+  8638,3152,2352,8928,8151,5778,5438,1840,1912,7879,5888,6120,481,539,158,4201,
+  497,6790,3994,9186,5769,4,8675,9767,7861,3765,2547,9737,822,6047,1577,8288,
+  2094,5747,4173,6280,3476,2855,6998,5868,6975,7500,747,8583,364,7550,7893,6980,
+  9005,8644,46,3226,2642,6707,4673,4508,3598,3821,2402,4108,231,4014,5316,3173,
+  1301,6219,5614,4302,1678,9738,4210,6778,6846,1985,2739,4267,99,3433,2198,7976,
+  319,8799,9348,9038,7820,6627,5175,2702,164,2523,2988,8548,5407,5277,8598,8021,
+  1851,5724,835,7331,442,5190,4438,7708,193,5688,670,4657,8117,3426,6362,682,
+  7728,3779,7056,796,2382,9828,444,1816,2812,8118,8650,8749,731,6884,6603,5694,
+  1873,1609,5222,4668,9038,3451,4751,2250,8470,5925,8387,3122,1392,9163,5403,9096,
+  4670,2571,2186,1108,4408,1929,4802,4995,3332,7285,89,2081,5054,2480,6731,8516,
+  554,4158,1575,6166,6051,2336,3192,1019,8905,5158,7903,4771,2174,1526,2002,6218,
+  6804,5440,1562,6541,5103,1445,9880,7515,1446,2220,483,5193,8990,7852,7153,223,
+  3103,3243,3929,8729,807,8447,3521,5384,10,8666,6246,9498,2002,8264,6251,8541,
+  3214,987,473,6513,7233,7035,7592,6102,4063,7996,7043,345,5853,7702,9695,7317,
+  3038,2596,3137,2570,2264,6323,6723,3452,7789,7965,5126,4461,6152,7827,456,9904,
+  4460,3002,9680,1430,3595,9013,5540,5415,4113,9747,9660,6366,2030,9939,9928,5460,
+  6591,5264,8090,1354,4581,3557,8873,262,5339,1603,5772,7456,9174,303,3141,3665,
+  7261,8623,8052,6926,4800,6909,4875,1886,8414,4419,5555,5815,2698,9897,4867,2039,
+  2758,2477,2253,2621,6467,7501,9211,4569,2004,569,8798,5085,4658,2119,7249,7986,
+  3028,2973,4890,276,2036,5934,886,8438,1656,3810,5029,7498,7875,5111,9036,5409,
+  2195,9594,7381,8039,2578,323,5642,7093,1324,4650,3720,9475,828,2214,5057,2670,
+  6944,814,4569,4286,3612,1090,8160,6337,458,8029,3878,6968,4585,7662,7357,3424,
+  9096,8458,2774,4287,8177,8240,6563,6264,112,1434,7353,783,6034,183,6800,667,
+  5839,4585,5735,1133,3610,277,9586,7548,9869,3948,3871,7469,8361,4524,9821,4500,
+  5853,4780,6709,4740,862,8031,9914,4023,7795,9046,9943,370,6536,7738,374,1256,
+  7190,6185,6881,103,6088,5386,1062,30,2806,9511,7762,9054,8901,7959,5105,9152,
+  7157,1455,777,1577,6153,1876,8378,6224,6960,9058,5550,9899,8611,7111,7453,7318,
+  2645,9092,9997,4008,5737,2498,6390,1734,4896,1194,8893,8126,8745,1467,8477,2642,
+  6477,8190,5855,3105,2815,9824,9916,2666,7996,5336,5016,3144,7723,9107,1242,3665,
+  9210,4335,448,5122,2286,9388,8424,309,3055,7168,4843,8910,6500,272,1439,5220,
+  3057,3259,8869,8594,8868,5585,5152,6902,2670,4528,8803,6283,4979,2900,3334,93,
+  8946,5767,2044,3114,8196,5172,8388,9164,5227,4264,1619,2473,9489,3712,594,9318,
+  8864,9368,5743,8443,3788,9202,6409,2279,1278,874,4067,2273,3564,3143,1511,1747,
+  8564,6070,1020,4135,9531,8163,1668,1851,4394,7018,1604,2403,8792,5742,4784,3489,
+  3991,569,2754,2288,516,6641,1387,4972,7786,5190,1780,1747,5834,5707,9281,9967,
+  1076,8168,4526,5943,1559,9759,3042,9015,7641,5956,6269,324,7110,935,1934,653,
+  684,4517,8796,3754,3198,9753,6044,1679,9552,9727,4157,7674,1958,8242,1660,6326,
+  6248,6687,562,4768,3285,131,9804,3530,7715,4920,2093,7300,5852,4686,4397,4574,
+  6135,1376,3199,108,1118,7582,3130,3199,9939,9843,1657,2202,4629,3387,6355,5238,
+  370,7548,2532,4638,8702,1248,1396,3125,180,5045,6897,6738,8710,7701,3555,1303,
+  3967,229,8629,5190,9322,8099,4507,126,9749,6724,6979,6868,7536,4492,5777,9147,
+  1346,6443,8076,52,1046,4844,3355,8593,5643,8303,6225,6491,4581,6736,8128,5784,
+  2482,2741,4227,5605,8056,6717,5481,3524,2475,8558,107,1950,2469,7473,2498,2896,
+  6157,7737,2619,4277,5242,8076,3802,3535,360,2136,8436,7672,4499,3086,9764,7332,
+  574,7444,1630,2213,1825,2141,5412,1989,2726,1425,4932,3770,7339,266,1847,1109,
+  9206,6745,6600,7997,6900,805,1680,2317,6857,2076,6018,9173,6549,7113,5176,5538,
+  694,3045,4738,8348,4847,4353,6178,9234,1007,7060,282,4780,679,1262,3758,9760,
+  7728,1598,4071,2026,9349,4311,5326,4042,4464,1467,3288,7293,3440,1887,474,6438,
+  4486,7543,9032,2107,8814,6009,8129,7489,9602,6382,3065,5971,9282,2954,449,7316,
+  3601,9453,760,4255,9254,7821,3380,561,7909,8352,7491,1922,4658,3950,823,3000,
+  1999,801,761,9046,8924,3701,7209,5306,4476,4941,5764,1321,2014,2064,7205,761,
+  8473,5079,5685,2615,6064,3570,9002,1080,8933,7875,6003,1065,7840,9857,7883,1771,
+  9807,5724,6865,448,9199,7871,693,1896,5314,5279,5840,7400,3866,1499,2612,5510,
+  4493,2166,5475,7591,8459,7229,8157,1765,2612,8619,9820,197,9280,8602,3356,5589,
+  7045,4032,6491,7587,2087,7169,7444,9873,9777,2780,4156,37,915,9339,2612,8578,
+  2288,7288,8314,5166,5268,7069,326,7805,7608,3748,4233,7703,1770,7506,7012,6132,
+  5975,4018,2755,6973,618,31,7048,7748,3581,8964,7232,2393,5269,1207,949,2202,
+  3564,3020,9099,8830,1786,5431,1924,2867,2013,1383,1221,2901,6296,6138,9499,3241,
+  400,4573,4642,4441,697,8281,5938,4263,5985,3456,3504,6749,2619,2214,3133,4672,
+  9049,3147,4049,6268,7063,8773,5505,4476,4501,7844,4629,4569,1032,6562,9500,1318,
+  1254,4329,1312,9093,1604,6054,8700,7667,9871,5047,9388,4980,3820,8428,4822,678,
+  6698,5732,8127,9427,9180,5178,876,1944,1285,8479,7354,2516,9628,7007,5671,5402,
+  9472,9488,8569,6243,7034,8379,1801,79,6193,9893,5580,777,625,3221,4391,9461,
+  8599,89,106,8227,851,8612,4287,4398,5874,2557,8595,8026,6145,4778,5324,1343,
+  8364,9278,7440,8959,3278,4915,2446,8567,6545,4185,6087,6834,680,3979,3865,5057,
+  5363,1895,8929,9649,9393,2942,2181,1034,5618,1443,1341,140,7088,7159,1532,5644,
+  25,7945,140,5070,2176,7918,9048,6957,632,7778,2922,4064,1450,6477,6515,1797,
+  1437,3218,3109,1726,9547,4086,9175,2414,8485,4069,5252,9752,967,3203,1463,9824,
+  4151,6363,5248,3750,2820,8574,2622,6195,4569,2520,3960,7928,7299,4329,60,3575,
+  6137,3302,311,6973,627,2686,2576,8082,5918,2952,882,5441,8610,4879,724,8553,
+  3287,8883,8105,1843,9331,5853,2469,8982,5545,4461,5604,9218,4772,2789,4498,6088,
+  9358,6824,3900,2282,468,137,2557,4167,4325,9384,2941,3430,5415,7797,7606,1747,
+  9067,3419,7716,1445,5648,7167,1714,6993,4256,6884,7491,2533,329,6923,4820,2272,
+  5217,4246,5375,3719,1631,3553,6380,576,2361,6316,1568,7073,3886,6135,5026,6483,
+  1656,1699,5569,1494,8104,5141,1363,8753,7753,1839,9822,4628,9425,4289,3392,4972,
+  6930,1615,6621,3424,8279,2618,8464,8445,5550,8003,6732,4266,4985,6070,79,1454,
+  7120,5096,5084,2969,1905,8596,8610,6715,8137,6334,7212,1247,603,4705,106,9865,
+  9827,9482,6083,6450,11,1517,4710,6391,5389,5656,5613,4686,9221,4280,6509,5992,
+  635,8499,3050,7511,4917,5793,4115,9247,3178,647,4882,9913,627,529,1132,1994,
+  9488,4227,7518,1075,1014,6236,5849,479,9075,2846,6432,610,6645,7035,2250,6684,
+  814,3785,909,1881,38,7470,9574,3403,647,7953,7649,4879,5457,5256,4998,284,
+  875,6442,130,3506,648,2292,93,4338,9721,3824,1488,4697,5996,9794,4118,3643,
+  7378,7744,6365,5527,9209,8891,6741,3549,2284,2455,4361,9110,5110,435,9717,9507,
+  25,5564,648,3763,8465,9950,9454,583,7660,5167,6511,310,8150,5711,22,1804,
+  2528,6309,3302,9809,1006,8749,6451,4518,8253,7084,3552,7774,2164,4948,4754,5285,
+  2235,1507,3673,3693,7389,1422,4607,7268,712,4770,3351,4488,6100,8859,7024,5276,
+  8698,4090,55,2688,2987,720,7491,4181,8633,257,8966,2911,3991,5035,4382,9659,
+  3870,1093,2250,6730,1476,4999,25,7770,7662,1436,9795,832,8260,3992,1857,7969,
+  7625,1916,1892,7677,3402,2902,6085,2168,6897,167,3880,3986,2693,3810,9442,6593,
+  3044,709,5845,1526,4245,165,3425,1137,4170,6517,7608,4026,8625,3210,5157,5579,
+  2913,9934,2150,8344,9581,6996,9978,9182,5497,397,7473,703,7360,4740,2999,3491,
+  8587,9372,3421,4895,7933,5396,4739,8952,2568,4466,956,8770,1057,2535,2629,2738,
+  3964,3283,7404,5475,3179,2201,4955,6714,8554,1427,9914,941,475,8701,1000,2368,
+  2257,3860,3583,5715,1419,5258,7848,760,3724,8741,618,9511,7240,8125,3497,2838,
+  4888,5278,7070,3394,5428,5546,2497,9744,7528,3117,4272,6687,9410,3259,9675,7744,
+  321,3258,4785,8898,813,7517,4218,7626,1505,4694,5569,2107,6644,414,9493,3218,
+  3369,371,5084,6938,8751,6703,2511,4304,6481,7677,1647,5360,3526,398,7912,1347,
+  427,1934,6337,3356,7641,523,8158,6051,4534,5120,7116,6174,1615,4323,6173,8477,
+  8713,4540,8820,154,4296,8730,2737,6562,8482,8230,2529,9517,846,509,4427,2350,
+  5150,633,644,4216,4565,8638,2893,816,5103,4731,4059,1255,9645,7728,5267,8414,
+  1739,432,3663,4864,3549,2394,4022,9524,9584,9438,9770,6139,9420,9734,7056,3448,
+  286,8978,4085,4345,9311,2358,8270,9408,6597,6842,2595,649,5050,8704,6775,7013,
+  6096,6049,4967,7323,120,2534,4708,6004,2660,8146,6941,541,5424,1305,7869,8424,
+  5754,6183,6993,5312,8368,2482,5294,2950,9514,8726,3125,4216,7505,644,5183,8969,
+  792,2033,3003,8262,6248,8817,6473,4867,718,5984,3967,5272,578,6248,5115,8550,
+  1844,2821,7440,8837,4154,5676,3161,1151,6444,2270,6484,5959,7249,2394,8954,1314,
+  3809,1618,4716,8448,8472,6021,8642,9635,2179,3456,6254,5956,4114,5989,5914,6157,
+  5483,591,2978,7503,7929,9482,5147,5346,2638,1925,6453,7529,6609,73,4344,3282,
+  4341,9176,1792,5883,6504,8551,9132,6046,514,8225,7341,8794,3281,3209,9076,1229,
+  844,7213,555,4403,5259,1267,9375,5898,9699,360,2343,2001,8509,7883,6569,120,
+  6454,3033,8553,213,9310,9974,4380,5820,527,2933,5474,9289,2021,5071,8533,4546,
+  7213,5878,9310,2641,4852,3052,9233,3716,8887,2444,898,5845,9667,6958,1339,719,
+  4263,9710,8588,7530,4542,8061,1289,7516,3087,800,4708,4816,6931,4456,6392,6724,
+  2955,4487,3483,7043,1310,6816,5148,6971,6077,6186,2057,1509,9925,7608,1421,7810,
+  7187,9041,6473,2337,7988,1766,6137,3910,7261,3205,5363,8154,6475,6135,3226,7600,
+  4764,4276,262,994,4255,1150,9578,3734,8407,1938,9329,8207,3091,5996,6776,6888,
+  6090,4911,2044,881,1657,2350,2996,4616,5373,1985,3400,254,4842,7293,8683,7249,
+  8009,3303,5466,8434,1816,4284,7008,8646,7832,6570,4402,5810,8256,2007,3912,5295,
+  9285,8944,508,3049,4902,8709,8731,9087,8537,3298,7963,6830,5047,8992,8207,756,
+  4862,8785,8477,1908,7508,8497,4276,6671,1253,3443,4746,1513,791,6353,8881,8477,
+  529,8218,8390,6282,3665,9563,9223,5899,8107,1978,8793,4293,1501,3367,8587,9919,
+  7991,3802,6115,9927,8469,5188,8101,1722,1127,745,4110,3703,8837,1234,9566,6345,
+  4741,4139,2679,9909,8372,9299,9475,1492,1923,3948,1051,4615,962,5609,4368,7803,
+  1099,4871,5712,4199,3254,2619,1041,9108,6366,222,6770,8211,5899,1884,4030,6857,
+  9672,3552,2014,9742,5049,1227,2764,1875,8282,8894,2435,5834,475,3092,1411,7,
+  821,2275,3355,1454,4214,2034,7053,8963,1293,8730,7809,7002,2615,4704,1224,8271,
+  9800,4958,4992,3634,2242,2756,2823,9247,9819,3869,7823,4928,66,2544,92,8849,
+  5145,3832,3978,2975,1996,7175,4500,1908,1160,1181,1773,8369,6697,7441,6894,5905,
+  2425,2428,3421,6232,8095,6383,8065,3275,5509,674,2907,8805,9813,4599,4230,7638,
+  7000,2538,8679,5913,9722,4287,1994,3821,1102,1267,4871,2442,5620,793,5,3028,
+  5651,7417,1337,6150,2898,6724,9808,83,8874,6783,9430,5031,581,2309,5999,1748,
+  706,1849,3549,8442,7224,9825,765,9137,4298,3473,3791,7802,4159,5464,6191,8164,
+  6428,4837,3609,5899,8883,7872,2641,1002,641,5370,1421,3659,2758,6043,5720,9588,
+  2494,3928,1837,3929,9490,7906,9523,6450,1071,3938,6298,6889,2675,4040,756,1361,
+  3140,4506,6596,3344,869,2179,5674,9257,5152,6896,2837,5988,4184,7466,5025,5419,
+  5527,7005,3958,9305,7078,8626,8713,1674,6866,2631,9392,716,81,9786,3637,2363,
+  6575,6605,4532,896,7690,2107,9753,5028,3388,1049,9085,3888,5893,5379,4890,3392,
+  233,5559,3321,5367,6334,3906,6734,6962,6282,6784,4634,6873,1562,5614,479,3580,
+  5012,6131,6617,9357,7113,5968,6875,9795,5736,4410,6242,7396,2093,376,1563,7647,
+  277,5182,1757,53,9748,2772,2652,5348,1099,7679,7112,530,5352,5490,7841,8009,
+  4196,6495,7730,9314,1047,747,7600,2768,5059,9192,3136,7650,9128,5997,4249,8329,
+  7621,8960,6283,9727,7392,9985,8230,1396,2837,705,9739,734,4319,147,1166,9718,
+  2198,947,2164,8417,3845,6851,9319,4875,2896,3466,2851,3536,4923,2538,666,9110,
+  5969,7256,7964,259,41,4615,345,2813,6833,289,6976,8846,8569,7710,4205,3297,
+  1780,7965,8380,3246,278,3078,1002,9281,8525,9769,7028,5235,4814,9519,3942,8879,
+  8867,5180,4472,3727,3322,7103,5764,4556,2335,6052,7397,9904,5436,7739,7314,3342,
+  6022,889,9948,1849,2216,5268,7747,4171,9016,8006,2153,9332,5957,1778,3613,8600,
+  9153,9573,8102,9594,9341,378,5000,575,2930,57,9057,3126,3676,556,4074,2938,
+  1442,3560,8856,9536,6653,4769,1836,2782,5840,5030,4519,6433,9372,1112,4218,7580,
+  4385,8519,8013,8442,157,8905,8148,3818,9466,4438,3993,1015,9083,2258,953,9713,
+  5457,2846,4493,9073,6075,8905,5429,9225,6920,1561,7674,8797,3720,6319,3586,2106,
+  5601,3451,9784,1599,4689,4443,1334,837,9684,1653,1886,1971,5926,6910,7696,5738,
+  4192,8733,8602,2446,4922,6296,4815,344,2016,5161,6428,8632,1250,9841,7847,98,
+  3212,2528,2685,2238,1649,475,8918,101,9676,4901,856,454,2564,2783,3607,6399,
+  6435,2946,2779,2696,3340,5905,4938,3805,2696,7025,4859,4961,5431,6332,50,3533,
+  3426,2870,2891,1332,1611,9370,2010,8048,6651,9380,8615,1853,8336,9331,3562,9357,
+  5051,2835,4027,2746,8544,5514,9659,1852,7308,4421,6146,1853,3960,9473,2696,4938,
+  5588,9639,7224,6449,9771,4843,6909,9676,3093,1431,1737,6323,1242,6618,9206,4338,
+  9163,593,9253,4927,627,4651,1146,8067,134,2566,9377,3914,9899,2401,9819,6864,
+  5849,9898,917,1774,3185,8214,1461,2309,6207,579,9498,1388,6609,9351,5002,8885,
+  3448,2892,5038,9477,6321,8499,3965,4346,9246,4680,8455,6298,5308,1580,8405,147,
+  976,2655,7418,154,1914,6744,4020,5514,2055,3216,3182,7802,685,1457,3531,2448,
+  9658,2923,40,1959,7017,879,3390,8699,3301,881,6440,6837,8840,1204,1410,106,
+  8938,5572,7272,9071,4399,8604,9324,3384,8148,271,3672,8008,930,8059,4141,8684,
+  7651,6696,1982,8077,6263,8974,3345,4538,8531,5578,8855,5061,1814,6919,4778,6829,
+  2088,5203,529,8284,5563,5057,1641,8248,1646,2818,3785,1784,9419,9698,4057,7419,
+  4201,2597,8285,5812,756,9552,3140,807,336,835,4821,6191,3988,2244,6801,7651,
+  1748,5681,4720,6661,8904,1078,8114,842,6727,6251,5128,4097,9599,872,5163,3710,
+  6427,6721,5520,1895,1111,8957,8501,9498,2644,9615,9527,7300,1523,4062,6770,7437,
+  3360,2879,6300,3144,2333,6058,61,5948,7533,8786,9233,2546,9718,7661,5975,9410,
+  6902,10,8744,4760,7437,6570,1660,8433,7419,1837,4060,8561,7288,3643,8680,8922,
+  5410,277,7981,853,4667,9814,9489,6095,6889,4176,7287,1692,4149,6499,1922,369,
+  6678,3116,4778,3234,8751,6074,8395,6508,5823,8460,734,9275,6515,6604,6400,5781,
+  7176,3987,3841,9666,6188,1540,3754,8950,8195,3110,3498,5484,4477,6820,5523,2364,
+  3419,1677,7696,5084,5713,7918,2662,6924,9464,1189,79,9007,6206,4797,2855,9466,
+  381,5534,6512,848,8335,2024,6522,8542,8961,7059,3001,8949,923,3291,5411,5280,
+  8375,6503,6374,5942,1395,2314,3236,4268,7848,2481,9969,8456,9934,9866,9324,665,
+  9475,7139,4463,3301,3936,6254,4877,2581,560,6510,2320,3711,8521,2948,6184,9117,
+  6477,9424,5411,6135,5792,2144,2722,9394,4933,7504,107,7510,4628,2117,5324,8301,
+  8258,2400,953,6316,3851,7107,2716,7423,2401,3902,9699,7598,4239,9029,3124,5874,
+  3637,904,6296,1289,5581,1052,1722,1727,6904,1264,8436,7783,1652,394,6224,2415,
+  9547,8790,1514,9735,6665,6054,3583,9762,8559,434,2070,9485,8140,3112,9225,7989,
+  3670,8106,5153,8599,451,4585,118,9306,8923,2578,4369,9344,9471,6191,5352,9854,
+  5530,326,5226,7251,3698,5655,5335,4924,8543,2592,8812,3268,9634,2494,6053,2192,
+  7471,7996,7831,5023,2502,831,8534,7769,9458,5336,5412,7393,9285,5153,5191,3999,
+  2401,9862,3859,282,3110,9327,4874,9308,8702,3909,2904,2144,7393,6192,9959,1779,
+  5136,8032,9536,2539,1981,2908,4169,9159,3744,9029,9618,5353,9026,8628,6030,3525,
+  4310,9978,6302,4336,4798,2948,4107,415,2239,9897,7230,4648,5962,7345,6086,6408,
+  3845,7230,2349,511,3875,9200,9709,9268,4835,5519,4119,9639,5623,2809,8438,6021,
+  2171,3964,4956,6280,2974,3006,7290,8193,8062,697,4810,418,3398,493,5168,1504,
+  736,3953,3564,9553,7120,1107,1887,6475,5158,5276,1089,3532,1642,1981,2507,2205,
+  4757,438,4731,7131,1689,6538,111,4437,3345,7189,6609,1099,1562,9387,6796,8476,
+  1062,6590,9113,3788,7533,4165,9287,4821,9782,9352,6455,8635,3259,4779,1988,5545,
+  9728,8754,4775,9492,5721,6391,7048,7485,7242,3516,399,9180,2274,8367,307,5520,
+  1070,8676,8255,8498,180,8084,5730,1306,9565,5360,7947,9007,767,7708,9670,4207,
+  7127,9778,6525,2507,3320,3336,9535,9542,1636,8087,6321,9003,8329,115,3590,3797,
+  3770,2355,9102,2959,2998,7379,8015,7240,7568,4617,6286,3652,2796,5846,8781,5337,
+  2429,5505,4932,6154,1211,3956,1908,7717,3654,2512,5355,6557,3795,9603,2117,35,
+  8731,7233,9023,1089,8173,5437,6459,6269,4056,2429,2450,9138,6823,6223,7069,2316,
+  686,7701,4793,1055,5651,5552,7813,949,9486,5809,2386,2529,9584,6494,3750,7158,
+  2537,5241,2376,6575,4532,8132,1159,8075,4320,6196,559,4511,5610,4079,6675,8747,
+  1169,7029,234,1849,5305,5657,3771,9088,2834,1506,3919,8455,3935,8202,5288,4993,
+  1132,375,1559,1475,1486,9226,3659,441,4036,3724,1097,6190,3148,1969,3170,9810,
+  35,1559,4033,5396,4234,6180,8320,2309,1012,4663,776,4910,2088,7668,8392,6342,
+  5514,4675,8487,6669,8540,4533,1142,5257,3731,6585,2713,1811,4899,7880,3097,6028,
+  8943,9803,5268,2223,9811,4662,8052,8956,8467,6014,7930,7259,9113,4136,5804,6843,
+  6907,9460,6691,2001,9207,8073,3837,9695,1936,145,771,2152,7565,1173,5640,7674,
+  9650,812,6411,9984,4384,3896,5728,9052,6228,1885,4933,4408,9985,8448,9345,5952,
+  5090,4621,7147,5126,2695,5738,5515,4403,6368,1935,5397,1139,5728,1512,8217,524,
+  9088,5586,5801,8477,4817,3591,7512,753,2188,4257,3307,6020,3179,4254,6328,8107,
+  161,9418,9976,8699,5508,7039,1722,4702,1651,6826,2285,134,1564,9824,8750,1720,
+  5183,9062,3223,8071,2479,8001,5210,2689,6531,2191,8912,4288,7677,8493,3689,4503,
+  3500,9354,4275,3526,162,6193,2208,9806,5114,6434,7883,454,1850,4635,5458,3347,
+  7981,5321,3261,2847,1766,1222,5439,6682,7175,6813,2521,8671,7053,1323,2952,7986,
+  3117,8267,6501,6465,4150,2049,8235,2614,3396,4184,253,5417,5814,4774,6605,4674,
+  6414,8398,46,8701,5990,8167,4336,8778,443,5710,6952,9640,5266,6065,3534,6039,
+  6384,3192,8256,6812,8962,519,6451,1345,9387,1302,8214,6552,1539,1753,1119,3411,
+  5312,443,7698,2337,7703,9642,1636,5091,8410,1510,6279,5230,8540,9435,8552,8656,
+  9613,3920,1541,2838,469,7617,5203,2404,6946,2542,262,840,4138,8641,638,4478,
+  8282,5617,5206,7367,9343,7964,1236,4475,6767,1841,2521,8287,4510,309,7407,9467,
+  3801,5769,6605,8753,5916,6085,2899,2516,6143,2961,5244,5329,731,9620,8866,1844,
+  8606,5098,8252,3437,1567,7697,9841,8028,6963,4245,5606,2041,1829,670,9380,1986,
+  7216,2724,2096,5987,1133,8730,3584,1282,2711,9581,9081,6831,4979,7419,9700,9828,
+  9811,4161,3198,5315,349,6792,34,5128,3861,2991,3171,1053,3398,2849,2329,7688,
+  4635,6407,7332,8013,3605,5171,9032,2321,6009,6279,1100,3040,1703,295,568,9033,
+  1839,4203,4450,4261,1794,7412,7922,9484,1284,725,4189,1727,6722,3223,7951,2484,
+  9225,4954,6337,8244,7890,8539,3082,5958,974,2401,8800,1864,9085,7433,5913,2372,
+  8665,5394,6568,7492,8822,2282,2395,1745,9293,397,5727,1475,1196,8514,6212,1046,
+  3416,2236,8891,327,9255,6763,9279,2317,2178,4135,6829,1393,7228,3772,3055,4244,
+  3967,4729,2622,4228,4494,1027,5402,7725,849,1372,563,4242,4897,2719,5291,3010,
+  2301,6724,3565,5177,6587,1900,376,4691,6409,3395,9729,7044,3312,2260,3821,8449,
+  9831,5262,279,5006,6700,2536,6263,1861,463,4718,6277,9818,6554,1329,2559,2834,
+  6538,8006,3555,6647,9450,2787,2757,3146,9019,4199,5833,6027,6966,7193,9987,8573,
+  9694,6811,796,2369,2701,9257,157,7811,8027,3073,9323,3049,5392,8811,6851,1260,
+  1886,6334,9481,2777,9892,8272,2410,3645,9336,7333,9918,1924,778,4814,5228,8035,
+  9925,3969,8134,1615,5332,6489,4362,7533,1109,2801,9221,4513,5204,9004,2005,8719,
+  2670,7071,2549,5909,9374,8173,2401,9076,2308,25,9614,3972,2824,5614,2258,7339,
+  8787,874,4023,3997,2031,2796,4064,4235,1129,4979,6699,6600,7470,4962,1240,6204,
+  1814,5824,9594,4283,2935,49,3652,1945,1269,3202,6287,1469,1179,5986,248,6114,
+  4304,5000,912,3208,6041,6532,5404,1902,7211,58,9679,7349,9594,4435,196,6978,
+  5787,1850,9697,626,5500,3781,4553,6959,3279,1028,6763,1958,9084,4539,3571,6211,
+  9897,7501,2935,1097,2389,6246,4075,3873,1991,6700,8480,2035,4006,5279,5730,1721,
+  9728,186,1815,4869,7240,1841,7180,6383,4370,5365,1538,7749,2273,3929,3266,9894,
+  9656,5152,9510,4788,203,7494,6910,5726,5779,3624,3668,4892,5403,1891,9619,3935,
+  6454,299,3506,4625,6131,2744,8153,5267,788,292,6284,5550,6454,2929,2494,5774,
+  1468,7327,8516,4403,6650,6631,749,2389,3392,9985,8529,2428,3518,9408,2161,2172,
+  3742,4975,2354,8211,5138,7165,5527,7055,8361,4404,2789,7541,4309,9199,9724,4413,
+  5051,5279,7456,660,538,3907,1116,4672,8072,8951,7911,1105,4445,7311,9567,5454,
+  9321,6065,4354,297,942,1467,9014,2839,3121,48,2070,6691,2938,8702,6783,5469,
+  7583,5431,3893,6157,2091,3021,4294,3667,3634,5749,9321,8092,3264,2015,2427,3275,
+  6413,7429,3102,3409,2677,476,6789,1563,7239,1938,25,4951,4076,6351,2737,8802,
+  4824,9025,399,3071,4768,7533,7353,2824,5851,3685,532,2927,893,4136,7072,2147,
+  8385,3189,522,1219,4185,9630,1410,5039,4721,9231,3322,7461,8187,4577,8060,7546,
+  5791,6280,7421,3037,8927,5216,8363,7123,5264,3053,5186,125,7150,2682,4334,7967,
+  5279,9299,4563,6253,8587,1328,8417,7575,4183,5269,4175,7538,24,8586,202,9475,
+  1744,6545,7877,8542,504,7425,9439,7271,5336,8587,1335,9230,670,9020,4079,3957,
+  9626,840,2782,8295,6999,5389,6324,5420,8920,8251,702,319,5588,8779,6752,346,
+  9710,6931,6875,5874,536,6417,9973,3740,8880,2754,3672,5094,4244,8858,1937,5652,
+  2183,6631,5380,4413,5649,9721,5734,7425,5436,3549,6678,6535,3816,5426,9769,8840,
+  2497,2750,8111,1080,3305,1912,2145,3870,9712,8540,2522,2708,9754,6263,4794,6235,
+  266,4080,4233,503,7414,7448,1758,2957,3419,3984,8437,3772,6656,6636,5177,863,
+  6071,5498,7758,154,9565,9830,9060,5984,1622,3841,9741,1467,8509,6968,6667,9058,
+  6936,3181,9966,7664,1856,2874,602,9572,6375,7023,9471,6250,8829,9307,2540,2690,
+  9526,9236,188,6780,8136,7713,1809,5716,1008,8339,1825,6982,6047,1466,8575,6124,
+  1727,2793,8306,9158,3336,1982,6082,2857,8608,476,2295,4475,8146,5575,7127,5735,
+  3727,9053,9207,3474,7360,4475,3242,8512,489,5768,5236,6539,8473,2783,8931,4874,
+  5694,6209,6572,1333,6548,329,1724,1134,9019,4774,8747,240,7334,6262,7221,975,
+  2770,2509,4076,4264,2008,1158,7845,2705,9133,210,7949,9850,1820,6115,1868,3783,
+  6285,265,136,3898,932,4525,6203,9310,4278,2785,1826,6147,6367,6651,2895,1859,
+  8627,5057,6066,7865,4613,965,5734,6060,8080,260,9572,70,2596,595,4013,4814,
+  8851,9257,2686,4055,6727,750,3775,8613,1322,5192,777,3189,7038,9630,5022,9382,
+  8376,2600,6529,2013,431,5889,1571,8425,9235,3367,6352,5864,5812,1622,2094,1945,
+  266,7613,9368,1500,4589,2659,9086,6894,33,150,5875,321,7415,2875,4110,3366,
+  4804,3622,7292,8071,1084,359,7303,3583,4596,6382,8791,1430,6742,8577,575,6455,
+  1561,1152,6212,2080,5727,7454,1808,4034,1151,4844,8645,8874,2809,1374,9588,9643,
+  8101,426,360,994,4004,2232,31,8065,1796,4558,4621,6532,1277,1743,202,1667,
+  451,5208,9016,7402,7801,4624,9791,8696,7417,6604,4155,2490,7393,2349,3782,3740,
+  5037,7566,443,9379,3092,8619,9781,2616,2141,4122,155,6115,6000,5468,2517,3892,
+  7401,1014,2449,7122,4260,881,4589,8660,8426,8634,9065,7084,6369,4864,1398,6991,
+  5487,3949,7962,7974,1009,7864,439,1555,1665,3178,5265,3439,4584,3641,903,5666,
+  1999,416,8212,6599,2281,2016,5932,4164,866,4508,9274,3487,7014,3832,4125,1803,
+  8316,681,5119,5512,9650,5958,6309,1454,1338,2309,3914,2863,9461,8307,9988,1534,
+  1504,5521,2904,5681,952,3434,6465,3506,5465};
+
+float gfloat;
+
+int func0(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 95;
+  d = 89;
+  c = ((p & c) * (d * b)) + ((d * c) * (a + d));
+  a = ((p ^ c) - (b * d)) | ((d + b) * (p ^ c));
+  c = ((q ^ b) ^ (p + d)) + ((d - 55) - (c & b));
+  a = ((q + p) - (q * d)) ^ ((d + a) | (a * c));
+  if(d < 53){
+    c = ((p & 12) ^ (c - a)) & ((c | c) ^ (q + 28));
+  }else{
+    a = ((a + q) - (q & c)) & ((q | c) ^ (p + d));
+  }
+  b = ((b ^ c) + (d + c)) - ((c & p) + (c + 32));
+  for(i = 0; i < 26; i++){
+    d = ((q - p) ^ (b ^ 50)) + ((a + 46) & (p ^ b));
+  }
+  b = ((c * p) & (q - p)) + ((a + 74) ^ (b * p));
+  a = ((b ^ d) + (d + p)) & ((c + 28) - (c - p));
+  if(a < d){
+    b = ((p ^ c) * (a & b)) + ((a * 71) | (c | b));
+  }else{
+    c = ((c & p) + (b | 62)) ^ ((d & q) ^ (c & 86));
+  }
+  c = ((c + c) ^ (c & b)) | ((d & p) - (p & a));
+  d = ((c + b) * (b - c)) & ((q & b) | (a + 27));
+  c = ((q * 54) * (p | a)) * ((d - c) - (q ^ b));
+  for(i = 0; i < 9; i++){
+    c = ((q | d) * (d & 25)) - ((d & c) & (d & p));
+  }
+  if(a < q){
+    c = ((c + q) & (c | d)) * ((d + p) + (a * b));
+  }else{
+    d = ((a ^ p) - (d ^ a)) ^ ((b * c) ^ (d - 3));
+  }
+  b = ((q + c) - (b * 60)) ^ ((c - b) | (q ^ 35));
+  d = ((q ^ d) & (b | 81)) * ((c ^ d) | (d | q));
+  b = ((q & 52) - (d | 74)) & ((d * a) - (b * c));
+  a = ((b + c) | (b - c)) * ((q | d) + (c | 50));
+  if(d < 25){
+    d = ((q * 92) - (c ^ 70)) - ((b * p) | (b - d));
+  }else{
+    d = ((b & a) + (a * q)) ^ ((b | p) | (p ^ c));
+  }
+  for(i = 0; i < 3; i++){
+    b = ((b - c) ^ (p | b)) * ((q - d) + (a - b));
+  }
+  b = ((p & d) & (q - c)) & ((a & q) | (p & c));
+  d = ((a * b) + (p | d)) + ((b | 69) - (c - 39));
+  d = ((b | b) + (c - 74)) ^ ((q | a) - (p - b));
+  if(a < a){
+    a = ((q | b) ^ (a ^ q)) | ((q + b) & (q & 37));
+  }else{
+    a = ((c & q) & (a & c)) | ((c - a) - (q ^ 11));
+  }
+  b = ((q & 29) + (a & p)) - ((b + 97) * (a ^ d));
+  d = ((b ^ b) ^ (b * 35)) ^ ((d ^ d) - (a - 77));
+  for(i = 0; i < 30; i++){
+    a = ((b - c) - (c - c)) * ((d - c) ^ (a + 75));
+  }
+  b = ((p - d) * (b ^ p)) * ((a - c) + (d & d));
+  if(c < q){
+    b = ((d + d) | (a ^ a)) ^ ((d ^ 16) - (p | q));
+  }else{
+    d = ((a - c) | (p ^ c)) & ((p & b) - (a + b));
+  }
+  b = ((b * d) ^ (d ^ 46)) | ((b * d) - (q & b));
+  b = ((a & d) - (c - b)) ^ ((q * a) * (d + 25));
+  a = ((c | b) ^ (p + a)) - ((q - a) | (d ^ p));
+  a = ((d + d) + (d ^ d)) - ((b + 42) | (b + 98));
+  if(c < q){
+    d = ((c & q) & (a ^ p)) & ((p - a) | (c - b));
+  }else{
+    a = ((p - q) - (d - 1)) ^ ((c + 74) & (q | a));
+  }
+  d = ((a - q) * (b & q)) * ((p ^ a) + (a & c));
+  b = ((a | a) * (q & p)) + ((q + a) - (d + a));
+  a = ((b - p) | (p - a)) | ((b ^ c) | (a & 29));
+  b = ((d - a) & (a ^ d)) | ((d & a) ^ (b ^ p));
+  if(d < b){
+    a = ((a - c) - (b * d)) & ((a - b) | (a + d));
+  }else{
+    b = ((p * 99) * (q - c)) ^ ((c - d) ^ (c | p));
+  }
+  d = ((q - c) & (b * b)) | ((b + b) | (q + c));
+  for(i = 0; i < 29; i++){
+    d = ((d | b) ^ (c | p)) + ((a - b) | (p | p));
+  }
+  d = ((a + d) + (a | a)) | ((p - d) - (p | b));
+  b = ((q ^ 27) ^ (c ^ b)) & ((q ^ q) * (b * b));
+  if(d < d){
+    b = ((p ^ c) - (q - p)) + ((p & 67) * (c ^ 83));
+  }else{
+    b = ((q ^ a) ^ (a ^ b)) & ((d * c) & (d * c));
+  }
+  b = ((c ^ c) & (d ^ b)) - ((p ^ p) * (d - q));
+  c = ((q - 81) * (a ^ 16)) & ((c | c) * (q ^ q));
+  b = ((b | c) | (d ^ 89)) + ((c ^ p) & (b * p));
+  for(i = 0; i < 20; i++){
+    c = ((b - b) - (d + c)) + ((q + a) & (c - 23));
+  }
+  if(a < c){
+    c = ((p - b) + (q + 39)) + ((c - p) | (p + a));
+  }else{
+    d = ((c & c) * (a ^ a)) - ((a & 98) ^ (b & c));
+  }
+  return a + b + c + d;
+}
+
+int func1(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 65;
+  d = 78;
+  a = ((c | q) & (d | d)) + ((c ^ b) + (a ^ b));
+  d = ((b | a) | (a ^ a)) * ((a ^ q) | (q - d));
+  d = ((q - a) ^ (q - d)) * ((c & d) + (c + c));
+  a = ((p & 24) ^ (p ^ d)) + ((p ^ p) | (b ^ 23));
+  if(b < c){
+    c = ((d | c) | (b + p)) ^ ((b & d) ^ (c & d));
+  }else{
+    a = ((b * 18) + (q * a)) * ((d - d) + (p * a));
+  }
+  c = ((d + c) & (c | b)) + ((d - p) + (p - 8));
+  for(i = 0; i < 48; i++){
+    d = ((p | a) | (p + c)) ^ ((p * q) & (b + p));
+  }
+  b = ((q + b) - (d + c)) ^ ((p - c) ^ (b ^ q));
+  a = ((b - q) * (c * p)) + ((d + a) ^ (p * 81));
+  if(c < a){
+    d = ((b * d) & (b ^ d)) & ((a | c) + (b - 48));
+  }else{
+    d = ((d - 3) & (a * 51)) - ((b * 95) | (c - 64));
+  }
+  a = ((d * p) ^ (b * b)) + ((d - p) | (a ^ p));
+  d = ((d | p) - (c & p)) * ((q ^ c) & (q - c));
+  b = ((q | q) | (q & d)) ^ ((c - c) + (a ^ 56));
+  for(i = 0; i < 43; i++){
+    a = ((p | a) | (a * d)) ^ ((a + a) | (q | b));
+  }
+  if(d < c){
+    b = ((c | p) & (a | 78)) & ((d - p) * (q - b));
+  }else{
+    b = ((b - c) | (b & 23)) - ((b ^ b) ^ (p + b));
+  }
+  a = ((p & b) - (a & d)) | ((p & a) * (a - b));
+  a = ((a & p) | (c | a)) * ((c - 20) & (d ^ c));
+  a = ((c + p) ^ (b - p)) ^ ((q * 40) & (c | 38));
+  b = ((c + d) + (d * d)) ^ ((b & q) | (b ^ d));
+  if(a < 57){
+    d = ((q ^ 54) & (q & q)) | ((a & d) * (q ^ b));
+  }else{
+    a = ((q | 53) | (b + 81)) - ((c | q) & (p * 67));
+  }
+  for(i = 0; i < 5; i++){
+    a = ((p | a) - (b + a)) + ((a & 81) * (q | p));
+  }
+  c = ((q & d) | (b * a)) ^ ((a - 45) ^ (b | b));
+  c = ((p + d) + (a * p)) + ((a - p) ^ (p ^ a));
+  b = ((d & d) ^ (b + 81)) * ((b * b) | (p | b));
+  if(c < a){
+    b = ((a ^ 81) + (c * p)) | ((c ^ b) * (b * 69));
+  }else{
+    b = ((d * d) & (c | a)) - ((q - c) * (c - q));
+  }
+  d = ((p - c) | (b & d)) * ((p & 28) ^ (b + p));
+  d = ((b + b) * (a + a)) - ((c & 20) & (p & a));
+  for(i = 0; i < 34; i++){
+    d = ((a ^ p) - (c & p)) * ((q ^ 26) | (b | 56));
+  }
+  b = ((d ^ 26) + (b * 71)) & ((b - b) * (d ^ 6));
+  if(a < q){
+    d = ((d - q) + (b + a)) * ((a & 24) & (p ^ 91));
+  }else{
+    c = ((b * q) & (c - d)) * ((c - p) & (c | a));
+  }
+  c = ((c | 58) - (c & 27)) | ((a ^ a) + (c & b));
+  c = ((a & a) + (d ^ p)) + ((c ^ b) & (p | b));
+  a = ((a - 34) ^ (c | 38)) | ((p | p) * (p ^ q));
+  a = ((d + c) - (a - d)) ^ ((q | 12) + (a | q));
+  if(d < b){
+    b = ((p + q) & (q * b)) - ((q - 10) - (a - 91));
+  }else{
+    c = ((p | p) + (a ^ p)) & ((a ^ c) & (p * 67));
+  }
+  d = ((a | c) + (d | c)) + ((c + p) | (c + b));
+  c = ((d | d) & (a | a)) - ((b ^ 37) & (a ^ 2));
+  a = ((c ^ 17) & (a - p)) ^ ((a & q) - (p * 23));
+  c = ((p & d) ^ (p + c)) ^ ((p * d) | (a - p));
+  if(d < 1){
+    d = ((a | d) & (c - q)) + ((d + b) & (d + a));
+  }else{
+    b = ((d - b) * (p & c)) * ((a | 61) ^ (c ^ 80));
+  }
+  b = ((a * q) * (b * 5)) - ((b - a) - (c - q));
+  for(i = 0; i < 45; i++){
+    a = ((p + 71) ^ (p + 72)) * ((d | 11) ^ (a ^ q));
+  }
+  a = ((c | 3) ^ (q | a)) + ((c | d) & (d - p));
+  c = ((b * 66) - (p ^ 65)) + ((b ^ q) | (p & a));
+  if(c < 77){
+    d = ((c | b) + (b + b)) | ((a - 11) | (c | p));
+  }else{
+    b = ((p + 6) | (c + 11)) & ((b | 46) - (p - c));
+  }
+  c = ((a - p) ^ (d & p)) * ((d & 5) ^ (c - 27));
+  a = ((p * d) ^ (c * 61)) | ((p ^ p) | (a + c));
+  a = ((c * q) & (b & 3)) | ((b ^ b) - (b | 4));
+  for(i = 0; i < 49; i++){
+    b = ((d & d) - (c + c)) | ((b & b) & (a - b));
+  }
+  if(c < 36){
+    b = ((a - d) + (q * p)) + ((q ^ p) ^ (c ^ a));
+  }else{
+    d = ((a * d) - (q * 72)) - ((a - 92) ^ (d | 9));
+  }
+  return a + b + c + d;
+}
+
+int func2(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 75;
+  d = 12;
+  c = ((b & q) | (q * q)) - ((c + b) & (b & q));
+  c = ((d & a) - (c * b)) | ((c * 67) | (b | 61));
+  c = ((d - c) + (q + b)) | ((a + c) * (c ^ c));
+  b = ((a * q) ^ (a & 19)) - ((a | p) + (p & b));
+  if(d < p){
+    a = ((p ^ b) & (b * 4)) * ((d - c) & (d - 55));
+  }else{
+    a = ((b + p) + (p ^ b)) & ((b & a) ^ (p ^ b));
+  }
+  c = ((q * d) & (d ^ 78)) ^ ((c + c) * (p + c));
+  for(i = 0; i < 38; i++){
+    b = ((c ^ 88) & (q + c)) | ((a & 25) | (q & 69));
+  }
+  c = ((d + a) & (p * p)) * ((d | c) | (q - d));
+  d = ((b - c) & (p * d)) | ((a | q) + (c | c));
+  if(c < 65){
+    c = ((q * p) ^ (p | c)) * ((d | q) & (b | 66));
+  }else{
+    a = ((c - 28) * (b + p)) * ((p * d) - (a ^ d));
+  }
+  c = ((q - 5) - (c + 74)) + ((a * d) * (c & a));
+  c = ((d ^ 85) - (p ^ 88)) + ((a + c) ^ (b & d));
+  a = ((p + a) * (p & d)) & ((q + 71) | (q | 79));
+  for(i = 0; i < 34; i++){
+    d = ((c | c) & (d | b)) | ((p ^ q) + (d ^ d));
+  }
+  if(d < 22){
+    b = ((p - 58) & (p & c)) * ((q * b) * (b * a));
+  }else{
+    c = ((c | 50) & (b & p)) ^ ((d ^ 56) | (d & a));
+  }
+  b = ((a * b) | (d ^ 96)) * ((p * c) & (d - 75));
+  a = ((a ^ c) ^ (a & a)) ^ ((c + p) - (p + p));
+  d = ((d | 72) ^ (c & d)) - ((p | p) + (p * 20));
+  b = ((c | 36) + (q - 90)) | ((q ^ c) + (d | a));
+  if(c < 89){
+    a = ((b + p) & (p + c)) | ((a ^ a) * (a * q));
+  }else{
+    b = ((b - p) * (b | d)) ^ ((p & c) - (a - q));
+  }
+  for(i = 0; i < 45; i++){
+    a = ((b | a) * (a + q)) ^ ((a + d) ^ (q | b));
+  }
+  d = ((a - b) | (d * d)) - ((d & 85) ^ (p * c));
+  d = ((q | p) * (p & b)) & ((d | c) & (d | d));
+  a = ((q + b) + (d - a)) + ((b * d) + (d + p));
+  if(c < p){
+    b = ((b & q) & (a | b)) | ((b ^ b) + (p - 68));
+  }else{
+    a = ((q | a) ^ (a + 76)) * ((a | q) & (b - d));
+  }
+  d = ((a ^ b) + (a ^ q)) & ((q * a) | (a ^ b));
+  b = ((c * q) + (c + a)) ^ ((b - q) - (q ^ a));
+  for(i = 0; i < 38; i++){
+    d = ((a - p) - (b * 23)) + ((q - d) * (c | a));
+  }
+  c = ((d ^ q) | (d - p)) ^ ((q ^ p) | (q - c));
+  if(b < d){
+    b = ((b * p) - (a * a)) | ((b ^ p) ^ (c + b));
+  }else{
+    b = ((a + a) ^ (b - p)) - ((d ^ a) * (p ^ b));
+  }
+  b = ((d & p) & (b | c)) | ((p + 15) ^ (c | 98));
+  b = ((b + a) * (q & c)) & ((a & 45) ^ (p - p));
+  d = ((d + d) ^ (c & d)) - ((b & b) | (b * b));
+  a = ((b * 5) * (q & d)) & ((a | 90) & (p * p));
+  if(a < c){
+    b = ((d + a) ^ (c - 66)) & ((b & p) ^ (p - c));
+  }else{
+    c = ((c * 36) * (q & d)) * ((q ^ a) & (c & a));
+  }
+  b = ((q - 48) * (c - d)) + ((d - d) ^ (d | q));
+  a = ((c | c) * (b - 53)) + ((b - 94) & (p + c));
+  c = ((q & d) + (q & 23)) ^ ((a * a) | (p & a));
+  d = ((q * q) ^ (b - 9)) | ((d | q) + (d + a));
+  if(b < 93){
+    a = ((c & c) * (q & 41)) ^ ((c & q) * (a - 37));
+  }else{
+    d = ((a & 56) + (a | b)) ^ ((p ^ 43) * (b & c));
+  }
+  a = ((c - c) ^ (p & p)) | ((b - p) & (p ^ b));
+  for(i = 0; i < 24; i++){
+    a = ((a * 13) * (a & b)) | ((c - b) ^ (d ^ q));
+  }
+  d = ((q + c) - (c ^ a)) - ((q | q) - (d & a));
+  a = ((q ^ c) | (c | p)) - ((d ^ p) & (a | b));
+  if(b < a){
+    d = ((b | p) | (p - 23)) - ((c * p) * (q + c));
+  }else{
+    b = ((b ^ c) * (d | 57)) - ((d - c) & (c | p));
+  }
+  b = ((c + 52) & (q | d)) - ((p | 61) | (a & d));
+  b = ((d - d) | (b - b)) & ((b + c) * (p * a));
+  a = ((a | 93) + (q + b)) + ((b ^ a) | (c * p));
+  for(i = 0; i < 15; i++){
+    c = ((c * b) + (d * 58)) + ((a | 94) - (p + 80));
+  }
+  if(b < c){
+    b = ((d * b) | (a * a)) | ((c - a) + (a * p));
+  }else{
+    a = ((b + c) & (q ^ a)) | ((d & q) & (b - a));
+  }
+  return a + b + c + d;
+}
+
+int func3(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 35;
+  d = 46;
+  d = ((d * q) ^ (q ^ c)) + ((c - 6) + (p - 47));
+  d = ((d + b) * (b + c)) & ((a ^ d) ^ (a ^ 77));
+  d = ((d & 58) | (c | a)) * ((q * 59) - (c & 85));
+  d = ((b ^ 38) | (d | d)) * ((q ^ 4) | (p * d));
+  if(a < a){
+    c = ((d & p) & (c + 28)) * ((a ^ 74) | (b + d));
+  }else{
+    a = ((b ^ c) & (p ^ d)) - ((d * d) - (c * 23));
+  }
+  d = ((a | p) + (c | b)) & ((c | 78) | (b | b));
+  for(i = 0; i < 4; i++){
+    a = ((p - 63) * (b * a)) ^ ((q * c) * (a | p));
+  }
+  a = ((d + a) & (b - 18)) + ((a ^ d) & (c + 93));
+  a = ((q | c) ^ (a - 50)) | ((p * a) | (c ^ 7));
+  if(b < d){
+    a = ((c * b) + (a & a)) & ((b - b) + (d & c));
+  }else{
+    c = ((q ^ q) + (d & c)) ^ ((d ^ p) - (b * 48));
+  }
+  d = ((d | b) & (q - d)) | ((c + b) | (c | a));
+  c = ((b + p) + (p & c)) + ((b & 82) + (d | p));
+  b = ((c & b) | (a & a)) + ((b | q) ^ (b - q));
+  for(i = 0; i < 34; i++){
+    b = ((p - b) | (b - 48)) * ((p ^ d) - (d & 93));
+  }
+  if(a < a){
+    d = ((b | q) ^ (d + c)) ^ ((c & d) & (q * 19));
+  }else{
+    d = ((d & 77) ^ (a & 10)) * ((d ^ 36) + (b - 76));
+  }
+  d = ((p ^ p) - (q & q)) ^ ((b * a) ^ (p | b));
+  d = ((a & q) + (a | 52)) ^ ((b - c) - (a & b));
+  d = ((b | b) ^ (c & a)) - ((a + b) - (a ^ q));
+  c = ((a + 19) * (p - q)) - ((b + a) ^ (b * p));
+  if(c < d){
+    d = ((q | q) * (c + b)) ^ ((p | 81) ^ (q + p));
+  }else{
+    b = ((b + q) * (c ^ a)) - ((a * 69) - (q - q));
+  }
+  for(i = 0; i < 18; i++){
+    b = ((a - d) * (d | q)) * ((a + 19) - (q & d));
+  }
+  c = ((c ^ d) | (q + b)) + ((d ^ p) | (a * q));
+  a = ((b + c) ^ (c + 28)) * ((b * a) * (q ^ q));
+  b = ((a + q) * (d ^ q)) - ((c | q) ^ (q - b));
+  if(b < q){
+    c = ((d + 74) ^ (c * b)) + ((a & p) ^ (c - p));
+  }else{
+    b = ((d * b) ^ (p * p)) * ((d ^ 80) & (b + 51));
+  }
+  b = ((q * 50) ^ (p + p)) + ((q * 43) + (c - a));
+  d = ((p - q) ^ (b * q)) | ((c ^ p) + (q ^ a));
+  for(i = 0; i < 46; i++){
+    d = ((d ^ 12) + (d | p)) & ((b - 92) | (c | d));
+  }
+  d = ((d * q) ^ (a & q)) & ((p ^ a) | (a ^ 20));
+  if(d < d){
+    d = ((q + a) + (c - 44)) | ((b ^ c) - (q + 56));
+  }else{
+    c = ((a & p) ^ (d & q)) * ((c ^ q) ^ (c * d));
+  }
+  a = ((p * b) | (c * p)) | ((d * 60) ^ (q & c));
+  c = ((a * 40) ^ (a & d)) * ((q - p) & (p * q));
+  b = ((d * 52) + (c ^ b)) ^ ((d | b) | (p & b));
+  d = ((b - d) * (d & 87)) ^ ((b * 69) ^ (q + c));
+  if(d < 70){
+    b = ((b * c) * (c - p)) ^ ((p | a) - (p & p));
+  }else{
+    a = ((d + 5) ^ (d ^ d)) * ((d - a) ^ (q | c));
+  }
+  c = ((q | 6) & (c - a)) - ((a | d) - (d & b));
+  c = ((d - 8) - (c * p)) & ((q * q) | (p + a));
+  d = ((c + p) - (b | 25)) | ((a - q) + (b | p));
+  a = ((q ^ p) * (a + d)) & ((a - d) & (p - 70));
+  if(c < b){
+    c = ((q | a) ^ (d - 33)) & ((p - d) | (a - d));
+  }else{
+    b = ((p | 23) - (c & q)) ^ ((q * q) & (d - 41));
+  }
+  b = ((q + p) - (c ^ 72)) ^ ((a | c) + (c + 84));
+  for(i = 0; i < 10; i++){
+    b = ((p - a) | (p & p)) ^ ((d * d) - (p & b));
+  }
+  b = ((d & 56) - (a | a)) & ((c * a) + (p * a));
+  c = ((q ^ 48) - (q * 66)) - ((c * 44) * (d & q));
+  if(a < d){
+    b = ((q | 30) - (c - b)) & ((p | a) + (a | b));
+  }else{
+    c = ((a ^ c) | (c & 82)) & ((b | q) * (a | 13));
+  }
+  b = ((q - d) | (d | p)) | ((q - 81) - (a + 20));
+  d = ((c ^ q) + (q + p)) ^ ((p - a) * (d ^ a));
+  c = ((d * c) - (d | c)) - ((q ^ 73) & (a & c));
+  for(i = 0; i < 21; i++){
+    c = ((c - 99) - (d | 85)) - ((b + b) + (d | p));
+  }
+  if(a < p){
+    c = ((q ^ q) & (d | d)) * ((q + q) + (p ^ d));
+  }else{
+    b = ((b ^ 86) | (q & 2)) * ((a + q) ^ (d - d));
+  }
+  return a + b + c + d;
+}
+
+int func4(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 49;
+  d = 73;
+  c = ((b & q) + (q & c)) - ((p | a) & (q + a));
+  d = ((q & c) + (b + d)) ^ ((p & q) + (b | c));
+  b = ((b ^ 25) - (p * p)) + ((b ^ a) & (d | 50));
+  c = ((d + p) - (p + b)) + ((b + b) * (q - q));
+  if(d < b){
+    d = ((b - p) - (a + q)) - ((d & a) & (p + 47));
+  }else{
+    c = ((d ^ b) & (p + 62)) & ((d - b) ^ (c * d));
+  }
+  d = ((a | q) ^ (d + 16)) - ((p & 55) - (a | 96));
+  for(i = 0; i < 2; i++){
+    a = ((q | a) ^ (c ^ p)) ^ ((c & c) ^ (a - q));
+  }
+  d = ((q & p) + (c ^ b)) - ((d ^ c) & (a ^ p));
+  a = ((a | 2) | (d - q)) ^ ((p + p) - (a ^ 4));
+  if(d < p){
+    c = ((b | a) + (q & a)) ^ ((q | q) & (b - q));
+  }else{
+    c = ((d - 80) - (a * a)) - ((b + c) + (d | p));
+  }
+  c = ((p ^ q) + (b ^ d)) & ((p & b) ^ (q - p));
+  d = ((c + d) - (d + a)) - ((q - b) | (d & 56));
+  a = ((c | d) | (c | q)) & ((p * c) & (q & 64));
+  for(i = 0; i < 44; i++){
+    b = ((a + p) | (p | 10)) + ((d | 53) - (b + 63));
+  }
+  if(c < a){
+    d = ((b + d) + (q * 2)) | ((a & p) & (d | 38));
+  }else{
+    b = ((p ^ d) ^ (a * p)) | ((p * c) - (q & 5));
+  }
+  c = ((q - c) & (d & 77)) & ((b + d) - (c & 94));
+  d = ((c - 51) | (b * b)) + ((c ^ c) | (a - p));
+  d = ((q & q) | (d - 16)) - ((q | p) * (a | p));
+  a = ((d * 49) ^ (p | b)) & ((a + a) | (b * c));
+  if(a < p){
+    b = ((d + b) * (b & b)) | ((c * p) * (b * q));
+  }else{
+    a = ((a - c) - (a & q)) ^ ((d - 47) + (q * q));
+  }
+  for(i = 0; i < 31; i++){
+    c = ((c | a) | (d * c)) ^ ((q ^ q) - (p - d));
+  }
+  d = ((c & b) | (a | b)) - ((q * q) + (a + d));
+  a = ((d - p) ^ (b * 21)) | ((d | a) & (d & q));
+  a = ((a - c) & (d & c)) | ((q * q) & (c * c));
+  if(a < 12){
+    d = ((c - a) * (d | p)) + ((p & 70) * (c & 40));
+  }else{
+    a = ((c + d) + (a & d)) + ((a * d) * (c & c));
+  }
+  b = ((p ^ p) + (a | 52)) + ((a & p) ^ (p & b));
+  c = ((p | 34) * (d & d)) & ((c ^ 43) * (d ^ b));
+  for(i = 0; i < 30; i++){
+    c = ((q * a) ^ (b & 23)) ^ ((c + 71) ^ (a + d));
+  }
+  b = ((a | c) + (p * d)) + ((p - p) | (b & q));
+  if(d < 6){
+    d = ((p ^ p) - (c + p)) ^ ((d ^ p) ^ (c & c));
+  }else{
+    d = ((p - b) - (b ^ d)) ^ ((b - p) + (a & p));
+  }
+  b = ((c - 39) + (d * c)) ^ ((a + c) | (a ^ b));
+  a = ((p ^ 74) | (q + d)) + ((q & 30) - (b + 55));
+  c = ((d + 89) ^ (b + d)) & ((a + a) + (c | c));
+  d = ((p * 92) + (d ^ 43)) | ((b - 2) + (p + d));
+  if(d < 9){
+    c = ((c * a) & (d & 78)) - ((b * a) & (p * d));
+  }else{
+    a = ((q & a) * (p * p)) - ((a - d) + (c + p));
+  }
+  d = ((b ^ c) | (d - d)) & ((d & b) - (p | p));
+  c = ((c * c) & (d ^ a)) ^ ((d * q) * (c | 77));
+  a = ((d * 9) - (d + b)) | ((c * p) & (p * 70));
+  d = ((a + c) - (q & d)) - ((b & c) & (p - b));
+  if(b < a){
+    d = ((c ^ d) - (a - c)) - ((a | q) & (q | 67));
+  }else{
+    c = ((d ^ d) & (p * a)) ^ ((b & 89) * (d & b));
+  }
+  c = ((a ^ d) + (c - d)) * ((b + 96) | (q + d));
+  for(i = 0; i < 34; i++){
+    d = ((q - 94) & (q * d)) * ((a & d) * (a & d));
+  }
+  d = ((d + q) & (c * c)) - ((c ^ 28) - (d * c));
+  a = ((p & a) | (p + p)) & ((p - b) * (b & b));
+  if(d < 68){
+    a = ((a - c) | (p - a)) & ((c + c) ^ (q ^ c));
+  }else{
+    c = ((q ^ c) * (d + c)) ^ ((a ^ 51) | (d * p));
+  }
+  a = ((d & b) ^ (a ^ 78)) - ((c ^ 99) * (q - b));
+  b = ((p | a) & (q - q)) - ((c ^ d) * (a - 72));
+  a = ((q - a) ^ (d ^ 55)) * ((a - d) * (c & a));
+  for(i = 0; i < 18; i++){
+    b = ((b & b) * (p + a)) ^ ((d * 75) + (c - 74));
+  }
+  if(d < p){
+    a = ((q ^ p) + (d ^ 40)) | ((q | p) | (d - c));
+  }else{
+    b = ((d - 21) & (p * c)) & ((a & 88) - (a - c));
+  }
+  return a + b + c + d;
+}
+
+int func5(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 38;
+  d = 55;
+  a = ((q & q) * (p + c)) | ((b | b) | (b - d));
+  c = ((d + 85) - (a & d)) & ((c + c) ^ (d * a));
+  d = ((p + b) - (d & d)) * ((p ^ 6) - (q ^ b));
+  b = ((a * 56) | (b | 20)) & ((p ^ d) | (p - c));
+  if(a < d){
+    c = ((q - p) + (q * d)) ^ ((d + 3) ^ (c * p));
+  }else{
+    c = ((p * 21) & (p & 18)) + ((p | a) - (a * p));
+  }
+  b = ((q ^ d) | (d - 51)) * ((q * d) - (a ^ q));
+  for(i = 0; i < 41; i++){
+    b = ((b - q) + (b ^ d)) * ((d + a) - (c ^ 73));
+  }
+  b = ((p | 78) | (p ^ 46)) | ((c | a) - (c - q));
+  d = ((q ^ 55) | (b + q)) & ((b & d) - (q + q));
+  if(a < a){
+    a = ((b * 19) - (b ^ p)) & ((b & d) & (p * 21));
+  }else{
+    a = ((b ^ 60) - (d & c)) & ((p - d) & (c * d));
+  }
+  d = ((q ^ c) * (c ^ 53)) ^ ((q * 52) - (q ^ a));
+  d = ((c * d) | (p * a)) & ((d & b) | (b + p));
+  b = ((q & 67) ^ (c - 82)) + ((a - q) * (p | 18));
+  for(i = 0; i < 46; i++){
+    c = ((a + c) * (d & a)) | ((q + 62) | (d ^ b));
+  }
+  if(c < 11){
+    c = ((d - d) - (a ^ c)) | ((q ^ c) & (d & d));
+  }else{
+    a = ((q ^ d) | (c + a)) & ((c + 88) & (d + c));
+  }
+  d = ((c + p) + (d + q)) * ((p & b) + (b & d));
+  b = ((b | a) ^ (q + 66)) & ((b | q) ^ (q + q));
+  b = ((c | a) ^ (c * b)) ^ ((b & 12) | (c | q));
+  a = ((a - 6) ^ (p & d)) - ((c & c) * (b * d));
+  if(a < 43){
+    c = ((q + c) * (a ^ p)) * ((q * p) ^ (a + c));
+  }else{
+    c = ((a * p) * (p + a)) & ((a ^ c) + (a & p));
+  }
+  for(i = 0; i < 23; i++){
+    c = ((p ^ q) - (q * 27)) | ((q | b) * (d * p));
+  }
+  a = ((d ^ b) * (c ^ p)) | ((d - p) - (c ^ b));
+  b = ((q - c) ^ (d & b)) - ((c & q) | (a - 99));
+  b = ((a ^ d) | (d ^ a)) ^ ((q + 56) & (a * p));
+  if(a < 32){
+    a = ((a & b) ^ (q ^ b)) ^ ((p | c) + (p & 58));
+  }else{
+    c = ((q ^ 12) | (c + 94)) | ((p + c) + (b + q));
+  }
+  c = ((q & d) ^ (b - a)) ^ ((p * 59) & (d & a));
+  c = ((p | 82) & (d & d)) - ((c * d) * (a * a));
+  for(i = 0; i < 25; i++){
+    d = ((c | c) * (d - 91)) + ((p + q) - (b + 79));
+  }
+  d = ((p | 5) + (c ^ 87)) * ((b | 16) | (c + d));
+  if(d < 41){
+    c = ((c - c) + (a & a)) + ((p * 65) + (c - q));
+  }else{
+    d = ((p & 56) - (b - p)) | ((b + c) & (q | d));
+  }
+  a = ((a | d) | (d - p)) & ((q + c) | (b - p));
+  b = ((p * p) & (p + d)) * ((p ^ 4) & (q & c));
+  d = ((d ^ 89) * (p + b)) ^ ((d * a) | (a * a));
+  a = ((a ^ d) + (d | b)) ^ ((a * d) - (d - c));
+  if(a < d){
+    a = ((c - d) | (d - a)) + ((d - q) * (p ^ d));
+  }else{
+    b = ((b * 29) - (d + d)) * ((p - d) * (p + d));
+  }
+  d = ((a - q) ^ (q + c)) | ((d * q) - (c & d));
+  c = ((q ^ q) * (p - d)) * ((b | 72) | (b - c));
+  b = ((q + 1) ^ (b & p)) & ((p * c) & (d | p));
+  d = ((d - d) * (d * a)) | ((q ^ c) & (d - 90));
+  if(b < 51){
+    a = ((a + b) * (c + d)) - ((d & b) ^ (c + 50));
+  }else{
+    c = ((c + c) ^ (d & a)) * ((p & 17) | (p ^ d));
+  }
+  d = ((c ^ b) | (a & b)) & ((a & 15) & (q ^ b));
+  for(i = 0; i < 44; i++){
+    b = ((p | b) ^ (p ^ q)) * ((d - 72) + (p - a));
+  }
+  c = ((p ^ b) & (c & c)) & ((q & d) & (c ^ c));
+  c = ((a - b) ^ (b & c)) | ((a | d) - (b | a));
+  if(b < b){
+    b = ((p + p) - (p & c)) * ((d + b) | (p ^ 17));
+  }else{
+    a = ((q | a) ^ (p + d)) & ((p - d) - (a * p));
+  }
+  a = ((b & 65) | (d | 91)) - ((b * a) | (p * q));
+  a = ((d ^ d) + (q ^ 57)) | ((b + q) & (c * a));
+  c = ((c | p) * (a ^ 37)) | ((b | p) + (a + 17));
+  for(i = 0; i < 5; i++){
+    a = ((q - q) | (d - p)) ^ ((c + d) - (q + d));
+  }
+  if(d < a){
+    a = ((b & p) & (a | q)) & ((c + d) ^ (p ^ q));
+  }else{
+    d = ((p * a) & (q & 28)) ^ ((d ^ b) | (p | c));
+  }
+  return a + b + c + d;
+}
+
+int func6(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 84;
+  d = 40;
+  d = ((a - c) - (p ^ p)) ^ ((c * d) + (a * 25));
+  a = ((d | a) * (q | b)) | ((b + b) | (a & a));
+  a = ((b ^ d) ^ (a * p)) + ((d * p) * (p + a));
+  b = ((q + a) & (a & 71)) * ((c | 34) - (d & q));
+  if(c < a){
+    c = ((d + a) | (c | c)) + ((q & q) | (c - 66));
+  }else{
+    b = ((b | 37) * (d & p)) + ((b | p) | (p - a));
+  }
+  a = ((a & 17) * (b * p)) & ((a ^ 71) ^ (a * q));
+  for(i = 0; i < 23; i++){
+    a = ((p ^ a) & (p | a)) * ((a * b) & (d + 67));
+  }
+  c = ((q * b) * (c | 65)) + ((d + c) + (p ^ 66));
+  a = ((p + q) * (q + q)) + ((b * q) & (d + b));
+  if(b < 89){
+    b = ((q ^ c) ^ (q - q)) | ((c & 74) & (c | 44));
+  }else{
+    a = ((c & b) - (c | 57)) | ((c + c) + (a & 59));
+  }
+  c = ((b - q) ^ (a & d)) & ((a - 18) | (d | c));
+  a = ((a * 26) + (p ^ a)) - ((d * b) | (b & b));
+  b = ((p - d) & (d | 32)) + ((a * 46) - (d - p));
+  for(i = 0; i < 9; i++){
+    c = ((c + p) + (q - q)) | ((d | a) - (a - d));
+  }
+  if(d < b){
+    a = ((d - 6) & (c * 24)) ^ ((d | c) ^ (p | q));
+  }else{
+    a = ((c & 95) * (d | b)) + ((b ^ c) ^ (c * p));
+  }
+  b = ((c - p) + (q + a)) ^ ((c - a) + (c - a));
+  c = ((p ^ b) - (q | b)) * ((b + a) + (b + q));
+  a = ((b * p) | (d * a)) | ((p | 69) - (d + 22));
+  d = ((b & d) + (d | 91)) + ((d & q) ^ (q ^ c));
+  if(d < d){
+    c = ((a + c) - (p - b)) ^ ((q & p) ^ (b * q));
+  }else{
+    d = ((q + d) | (d ^ 7)) & ((a + p) | (b ^ d));
+  }
+  for(i = 0; i < 20; i++){
+    b = ((b | a) ^ (a - 16)) & ((d * 5) & (c - a));
+  }
+  d = ((a + q) + (c * a)) + ((a ^ d) + (b | a));
+  d = ((p | q) + (c + c)) - ((d - b) * (q & d));
+  b = ((p ^ 16) + (c & q)) & ((a * d) * (q ^ a));
+  if(b < d){
+    c = ((q ^ d) & (p * c)) | ((q | a) ^ (a ^ 31));
+  }else{
+    a = ((q - c) * (p & q)) & ((d | q) * (p * d));
+  }
+  b = ((c | q) ^ (a + c)) - ((q * d) + (b | b));
+  b = ((p | q) + (q + q)) | ((q & d) & (c * p));
+  for(i = 0; i < 3; i++){
+    d = ((p + a) - (a | d)) - ((q & 30) * (p & c));
+  }
+  d = ((c + p) + (q + q)) & ((a & c) * (c ^ p));
+  if(b < d){
+    b = ((p + 37) * (b + a)) & ((b ^ a) ^ (p & b));
+  }else{
+    a = ((p - p) + (a * c)) + ((q | a) & (a + 42));
+  }
+  d = ((c * 8) & (b ^ a)) * ((p + a) & (p ^ 87));
+  a = ((d * c) - (d + a)) | ((q * q) ^ (a * b));
+  b = ((a | q) | (p * 48)) & ((c & d) ^ (a + b));
+  a = ((d * 76) & (b | q)) & ((c - c) - (a * 4));
+  if(d < b){
+    d = ((a ^ c) + (b | c)) ^ ((b ^ c) | (b ^ b));
+  }else{
+    b = ((c | d) | (q | b)) - ((d + q) * (d & 22));
+  }
+  d = ((d * 25) * (a * 61)) + ((q ^ 12) & (b | d));
+  a = ((p | 25) ^ (b - c)) + ((a * a) ^ (b * a));
+  b = ((a - 90) * (d & a)) & ((a ^ a) - (p * d));
+  c = ((p - 40) + (d ^ b)) - ((p - a) * (b + q));
+  if(a < p){
+    b = ((a * 55) ^ (c + c)) * ((q - q) - (a | p));
+  }else{
+    d = ((p * 78) ^ (c | c)) ^ ((b + c) + (q - q));
+  }
+  c = ((c * a) - (b ^ c)) & ((d ^ p) & (b ^ b));
+  for(i = 0; i < 6; i++){
+    d = ((c + 12) | (p & c)) - ((b & 8) - (a - q));
+  }
+  c = ((a ^ 68) * (d & a)) * ((b & d) & (a * 12));
+  b = ((b + 66) | (a - p)) + ((c - d) | (a - 46));
+  if(b < c){
+    b = ((q | q) | (a | 94)) & ((b | d) | (a | d));
+  }else{
+    c = ((d | c) ^ (a - a)) & ((p | c) ^ (q * p));
+  }
+  d = ((b + p) & (p - b)) ^ ((c - c) & (b & b));
+  c = ((d ^ c) | (a & a)) * ((d | d) + (a - b));
+  d = ((p ^ 34) - (q ^ 22)) ^ ((d + c) + (q + d));
+  for(i = 0; i < 37; i++){
+    d = ((b | q) & (d * d)) + ((d + c) | (c & a));
+  }
+  if(d < 3){
+    d = ((p | 18) | (a ^ 89)) ^ ((q ^ p) ^ (p ^ 38));
+  }else{
+    d = ((d | 35) & (c | d)) + ((p - a) | (d - 93));
+  }
+  return a + b + c + d;
+}
+
+int func7(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 8;
+  d = 38;
+  c = ((p ^ p) | (a * 40)) & ((d + 71) - (b & b));
+  c = ((d ^ b) + (q ^ a)) + ((q * 84) ^ (a ^ 35));
+  c = ((q * c) ^ (p ^ 44)) - ((p - 10) - (d - 46));
+  d = ((q + 89) | (d + p)) + ((q - 50) | (b * b));
+  if(a < d){
+    d = ((q ^ 76) ^ (a | b)) * ((d & d) & (q - c));
+  }else{
+    c = ((p ^ c) | (a ^ q)) + ((q | q) - (c * 38));
+  }
+  d = ((a * 93) - (q ^ a)) & ((b ^ c) & (d & p));
+  for(i = 0; i < 49; i++){
+    c = ((c ^ c) & (d | a)) + ((a - b) | (d ^ d));
+  }
+  b = ((a & p) | (p | p)) | ((a & 8) - (q + c));
+  a = ((b * d) * (d + d)) ^ ((q | a) * (p ^ 88));
+  if(a < 36){
+    b = ((a * 32) * (q ^ q)) ^ ((a * b) - (c - b));
+  }else{
+    c = ((d ^ p) & (b - 38)) | ((d ^ b) * (p ^ c));
+  }
+  a = ((q ^ p) * (d & 58)) - ((c - c) & (d + 61));
+  c = ((p & q) - (d & 73)) + ((a - 62) ^ (p * p));
+  b = ((d - d) * (p ^ c)) + ((c - a) * (a * 8));
+  for(i = 0; i < 8; i++){
+    b = ((c - a) | (c & 97)) - ((b | q) * (b * a));
+  }
+  if(c < 78){
+    c = ((b ^ b) + (q * 89)) | ((a | a) - (q + 40));
+  }else{
+    b = ((b - d) & (a * p)) | ((a ^ d) - (c & a));
+  }
+  a = ((p - d) * (p + d)) | ((c + p) | (a + b));
+  c = ((p | a) | (a & q)) | ((d & p) - (c | a));
+  d = ((a ^ c) - (d ^ 78)) * ((p + b) * (c & d));
+  c = ((q - 75) & (p ^ c)) ^ ((q - b) & (d - 83));
+  if(c < 39){
+    c = ((p + a) | (c * a)) - ((d - 6) & (p ^ p));
+  }else{
+    d = ((b * a) & (a ^ d)) & ((d ^ 88) * (c ^ c));
+  }
+  for(i = 0; i < 38; i++){
+    a = ((c ^ 65) - (b & 26)) & ((q * c) | (a ^ q));
+  }
+  d = ((q ^ a) ^ (a | b)) ^ ((q & c) - (q + 95));
+  d = ((d ^ a) + (q & d)) & ((p & 2) & (p * d));
+  a = ((c * d) * (c * b)) | ((q * 10) * (b | a));
+  if(c < b){
+    a = ((p - 8) + (c + p)) | ((b ^ 35) | (p & 36));
+  }else{
+    d = ((c - b) + (c & 46)) - ((d + b) ^ (q - p));
+  }
+  b = ((q * b) | (b * d)) + ((d * c) ^ (a + p));
+  a = ((a - b) ^ (a | a)) - ((c & b) * (b & b));
+  for(i = 0; i < 26; i++){
+    a = ((a - 64) ^ (c - 95)) & ((q ^ 84) & (c + 11));
+  }
+  a = ((p | d) ^ (a ^ 10)) * ((c - 89) & (c + 83));
+  if(d < q){
+    c = ((b | d) & (d ^ p)) - ((d + d) & (a + a));
+  }else{
+    b = ((a ^ c) - (c * q)) | ((b | b) & (a * b));
+  }
+  a = ((q ^ b) & (b ^ d)) * ((a & q) - (d ^ c));
+  d = ((d | q) & (q | c)) * ((c | d) & (p - d));
+  d = ((p ^ p) * (b ^ q)) - ((c + d) * (c | 37));
+  b = ((c + d) & (q * q)) + ((c + a) ^ (b | c));
+  if(b < c){
+    a = ((c | a) & (b + 45)) - ((a + p) + (b + p));
+  }else{
+    b = ((c | p) & (b | q)) * ((p - 65) | (b + p));
+  }
+  c = ((b & a) ^ (q & a)) - ((p - d) * (b - q));
+  a = ((c * a) | (b & 39)) ^ ((p | q) - (b | a));
+  a = ((b + c) & (b - q)) + ((d ^ q) ^ (c ^ p));
+  c = ((a | a) & (d & d)) ^ ((p - b) & (d ^ a));
+  if(a < c){
+    a = ((b | p) * (d | p)) + ((d & b) & (a * d));
+  }else{
+    c = ((d * b) | (d & 1)) | ((q * q) * (a & a));
+  }
+  d = ((b | c) + (d - d)) + ((c ^ b) - (d | 88));
+  for(i = 0; i < 10; i++){
+    b = ((c & q) & (c + c)) + ((b + c) - (q ^ d));
+  }
+  c = ((p * b) * (a & p)) | ((a * q) + (q * p));
+  b = ((a * c) ^ (d - b)) - ((a ^ 50) - (b | d));
+  if(b < c){
+    a = ((b ^ p) * (c & d)) & ((c - 48) - (c - p));
+  }else{
+    c = ((c | c) & (c - p)) - ((b | q) | (p & 89));
+  }
+  b = ((d & d) ^ (q - c)) & ((q * d) ^ (c + q));
+  c = ((q * 49) - (b & 54)) * ((d - b) | (b ^ q));
+  a = ((q * 74) + (b - p)) - ((d + d) & (a * q));
+  for(i = 0; i < 29; i++){
+    d = ((q ^ d) * (d ^ 81)) - ((b - q) | (c & 41));
+  }
+  if(c < 8){
+    b = ((c + b) - (q ^ c)) - ((d ^ b) * (p - q));
+  }else{
+    a = ((b * b) & (d ^ 60)) * ((a - 21) + (p - 30));
+  }
+  return a + b + c + d;
+}
+
+int func8(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 37;
+  d = 61;
+  a = ((a | q) * (q | b)) * ((p - p) & (p - b));
+  a = ((a * p) | (b - p)) | ((a & b) | (c ^ q));
+  a = ((a - c) ^ (p - d)) | ((q * b) ^ (d ^ p));
+  b = ((c - 63) * (c & b)) * ((q & a) * (c ^ d));
+  if(a < q){
+    d = ((b - d) * (a - d)) ^ ((q - 14) & (c * 80));
+  }else{
+    a = ((c + 29) - (q | d)) * ((p - q) + (b + 21));
+  }
+  d = ((d + c) * (p ^ q)) | ((b ^ b) ^ (d + a));
+  for(i = 0; i < 4; i++){
+    b = ((b ^ 40) + (a * d)) - ((c + a) - (q * 83));
+  }
+  c = ((c & a) * (b - c)) + ((q | b) & (q - b));
+  c = ((b + a) ^ (b & 59)) * ((p & p) & (c ^ q));
+  if(a < d){
+    c = ((c - c) + (p - 61)) | ((q ^ p) & (b * a));
+  }else{
+    c = ((d + d) ^ (b | b)) * ((b + a) | (d - p));
+  }
+  d = ((q + q) + (q | a)) * ((b + 88) ^ (q ^ b));
+  c = ((p | p) * (q - 22)) + ((a & 92) & (q ^ a));
+  d = ((b ^ a) + (a & c)) + ((a ^ a) + (p * d));
+  for(i = 0; i < 3; i++){
+    d = ((b - 81) & (c ^ b)) ^ ((a * b) | (c + 68));
+  }
+  if(c < d){
+    a = ((c & b) + (a * b)) - ((d - b) ^ (d | c));
+  }else{
+    a = ((d ^ p) - (a | 92)) + ((b | d) | (a | b));
+  }
+  c = ((a & b) * (a | a)) ^ ((d - q) ^ (b + 45));
+  b = ((q & 52) * (c - a)) * ((p * p) ^ (d - a));
+  d = ((c + q) - (q - a)) * ((d - p) * (a | a));
+  d = ((d * 89) + (a ^ p)) * ((d | 54) + (p * p));
+  if(b < 54){
+    b = ((q - q) | (d ^ p)) | ((b & q) & (c + 25));
+  }else{
+    c = ((a ^ c) | (p - a)) & ((c + 84) + (c - q));
+  }
+  for(i = 0; i < 30; i++){
+    a = ((b & 98) | (c + 22)) + ((q + d) + (c + b));
+  }
+  d = ((a * p) & (a & q)) - ((c | b) ^ (q + a));
+  a = ((b | 88) + (p * b)) + ((p - q) & (p ^ q));
+  d = ((b - a) ^ (c & b)) & ((a * b) + (q | d));
+  if(c < p){
+    a = ((c - d) * (b * b)) ^ ((p | b) - (b | b));
+  }else{
+    d = ((q * a) | (p & a)) & ((p & d) | (p & q));
+  }
+  d = ((b + d) | (b | q)) - ((c - p) + (b * a));
+  c = ((b ^ b) * (d * a)) & ((q | p) - (p - d));
+  for(i = 0; i < 45; i++){
+    a = ((c * q) + (a - b)) ^ ((p - 83) | (b & q));
+  }
+  a = ((p & c) + (d & p)) * ((b * q) - (c * b));
+  if(a < p){
+    d = ((d - c) | (p + 6)) ^ ((q * 33) ^ (d & 45));
+  }else{
+    d = ((p ^ q) * (c | 75)) & ((b ^ 80) & (p - c));
+  }
+  b = ((p - 30) & (d * 4)) & ((q * c) ^ (p + 85));
+  a = ((b + p) | (b + d)) ^ ((c | p) ^ (q + p));
+  d = ((d + q) + (b - 48)) + ((a & q) * (a & a));
+  d = ((c ^ q) + (c & q)) * ((a + p) ^ (b - d));
+  if(d < b){
+    a = ((d * a) + (q | 81)) + ((d ^ b) + (q - 57));
+  }else{
+    d = ((d ^ q) & (d & 67)) - ((b + 83) - (c ^ 63));
+  }
+  c = ((d & c) - (a & b)) & ((q * b) + (c - c));
+  a = ((b | b) ^ (d * q)) + ((c + a) - (b | d));
+  a = ((p & b) ^ (b ^ 38)) * ((p & p) | (b * 1));
+  b = ((q & q) + (d - q)) ^ ((c & 40) | (p + p));
+  if(b < b){
+    d = ((q - 9) & (p * p)) & ((p | d) * (q | a));
+  }else{
+    a = ((p & a) | (p - 81)) + ((d ^ c) * (p + 90));
+  }
+  a = ((a | q) - (a & b)) & ((a - 43) - (c & 23));
+  for(i = 0; i < 28; i++){
+    c = ((p | q) + (q | c)) ^ ((p | p) ^ (a | b));
+  }
+  a = ((q & b) + (p ^ a)) | ((c & p) | (a | d));
+  b = ((c | a) | (c ^ c)) | ((b ^ b) | (p & d));
+  if(a < q){
+    d = ((q ^ b) | (b ^ p)) & ((q - c) * (p * d));
+  }else{
+    d = ((p * p) * (d - d)) * ((b & a) ^ (p + 22));
+  }
+  a = ((a * c) & (b * c)) | ((a + d) * (d & b));
+  c = ((q | 7) * (p * 71)) + ((b & 73) - (d * q));
+  a = ((p & 94) & (a - a)) ^ ((p ^ p) ^ (a | 42));
+  for(i = 0; i < 25; i++){
+    a = ((a | 94) & (a * p)) & ((b & a) * (b | q));
+  }
+  if(d < b){
+    c = ((d ^ p) ^ (p | p)) & ((a * b) + (p ^ 3));
+  }else{
+    d = ((b & a) * (c * 9)) + ((a | b) & (p ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func9(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 7;
+  d = 99;
+  c = ((p - p) - (b ^ q)) ^ ((a & a) * (a - 10));
+  d = ((q + a) + (c - 75)) - ((c | 5) & (c - b));
+  a = ((p - a) - (a * 3)) + ((c & p) | (p & d));
+  c = ((c * q) * (b & d)) & ((p & 67) | (p | 75));
+  if(c < p){
+    d = ((b ^ q) * (a & q)) + ((q + 95) ^ (b ^ b));
+  }else{
+    d = ((a ^ q) ^ (p ^ b)) ^ ((b + a) + (a - 61));
+  }
+  b = ((c + c) & (q ^ 95)) & ((b & 42) + (a - b));
+  for(i = 0; i < 7; i++){
+    a = ((c - 78) * (q + a)) - ((p & p) + (c | p));
+  }
+  c = ((a ^ p) - (b & 21)) | ((b - d) ^ (b ^ a));
+  b = ((p ^ 23) | (d - 95)) * ((a * a) + (a + q));
+  if(b < p){
+    b = ((p | c) * (d ^ q)) + ((c - c) | (p & c));
+  }else{
+    d = ((p ^ c) & (q + 90)) ^ ((c | p) + (q & 22));
+  }
+  a = ((c | p) | (q - p)) + ((c ^ a) - (d - a));
+  c = ((d | c) - (b & 87)) + ((p ^ d) * (c | 58));
+  d = ((p + q) - (c | c)) * ((d ^ 16) | (b ^ p));
+  for(i = 0; i < 27; i++){
+    c = ((a * d) | (q - 7)) & ((q & q) ^ (b + c));
+  }
+  if(b < c){
+    d = ((a * d) - (a + d)) & ((p ^ c) & (d + p));
+  }else{
+    a = ((c * 57) ^ (q & q)) + ((a - b) - (b ^ a));
+  }
+  c = ((a + a) | (c ^ 62)) ^ ((b & p) | (c - a));
+  a = ((b * 11) | (a - p)) | ((q * q) ^ (p ^ q));
+  b = ((q | q) ^ (q | a)) | ((d ^ p) - (q | 13));
+  b = ((q - p) * (p - q)) & ((d + c) - (a + a));
+  if(d < p){
+    c = ((q * 10) + (a & d)) * ((p & q) ^ (a & 58));
+  }else{
+    c = ((a - 72) & (c - c)) * ((p | 59) + (p * c));
+  }
+  for(i = 0; i < 28; i++){
+    b = ((a ^ b) * (p * 11)) - ((b & c) * (p * a));
+  }
+  c = ((d & 26) - (c ^ p)) & ((p & d) & (d | p));
+  d = ((p | q) | (d - d)) - ((p & q) & (a & 9));
+  b = ((a ^ p) * (b + p)) + ((p | p) + (a | 49));
+  if(c < 33){
+    a = ((b - 1) * (a | p)) - ((q * q) * (d * a));
+  }else{
+    a = ((q * q) & (a + 15)) | ((p + b) + (d + a));
+  }
+  b = ((q * a) - (d + q)) ^ ((a - p) | (p * 71));
+  a = ((p - p) + (d | q)) | ((a ^ 7) ^ (c | a));
+  for(i = 0; i < 43; i++){
+    b = ((p ^ c) + (p ^ 56)) ^ ((a + q) - (d * q));
+  }
+  c = ((b & 75) & (q | 98)) * ((b ^ p) & (p + q));
+  if(d < d){
+    b = ((c & d) & (d * p)) - ((p & 18) ^ (c | 4));
+  }else{
+    d = ((d ^ 21) | (b | b)) + ((d ^ c) * (b + b));
+  }
+  a = ((p * b) & (a - b)) - ((a | a) - (d ^ q));
+  c = ((a + 66) | (a * q)) * ((p | c) | (d | 45));
+  b = ((c * a) ^ (q * a)) - ((b + 13) + (c + p));
+  d = ((d ^ d) + (a | b)) ^ ((a + 18) - (d & c));
+  if(d < q){
+    b = ((a & b) & (q * d)) & ((q - 1) ^ (a - 73));
+  }else{
+    b = ((b | b) | (d & a)) & ((a * a) ^ (b & b));
+  }
+  b = ((p | 30) | (a ^ 92)) * ((d ^ b) - (d ^ q));
+  d = ((a * p) * (p & b)) & ((p + 92) - (p + 6));
+  c = ((a | a) ^ (d + q)) - ((q - 12) & (q & p));
+  b = ((a + 37) ^ (d * p)) - ((p + p) + (b + c));
+  if(a < p){
+    a = ((c - a) - (b + d)) + ((p * b) ^ (a ^ c));
+  }else{
+    b = ((q | b) * (c & q)) ^ ((p + c) + (q | c));
+  }
+  d = ((c + p) * (a * a)) - ((b ^ 48) + (b | b));
+  for(i = 0; i < 8; i++){
+    a = ((p + d) + (q * q)) ^ ((d ^ 11) * (c & p));
+  }
+  b = ((q ^ d) * (c ^ p)) * ((a & q) & (b ^ p));
+  d = ((d - a) + (p - c)) + ((a - c) * (d * a));
+  if(d < p){
+    d = ((b - a) & (a | 93)) - ((a | q) ^ (c & q));
+  }else{
+    a = ((d - c) | (c - d)) & ((b + c) ^ (p | 51));
+  }
+  a = ((a - a) & (c - b)) + ((c + c) | (a - c));
+  b = ((p | c) ^ (b - 25)) - ((q & c) | (q | b));
+  d = ((c + c) - (b & 18)) + ((b + 44) | (c * a));
+  for(i = 0; i < 36; i++){
+    c = ((a + q) ^ (d & a)) * ((d & d) + (b | b));
+  }
+  if(b < b){
+    c = ((b | d) + (a & 37)) - ((d * 8) | (a + c));
+  }else{
+    c = ((p | p) | (d * c)) - ((a ^ d) ^ (c & 87));
+  }
+  return a + b + c + d;
+}
+
+int func10(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 11;
+  d = 17;
+  b = ((b + 29) * (b | 75)) - ((c ^ c) | (d & p));
+  a = ((c + 98) * (b - 61)) + ((c ^ b) & (b - q));
+  a = ((d * 58) | (q + b)) ^ ((a * d) & (c ^ q));
+  c = ((p & q) | (q - c)) - ((a - 92) - (c ^ c));
+  if(b < 5){
+    a = ((d - p) + (b & 64)) - ((a | q) * (d ^ 58));
+  }else{
+    a = ((a * 5) ^ (q | c)) | ((p & 46) & (q ^ 83));
+  }
+  a = ((b ^ d) & (b & q)) * ((b ^ a) | (p + d));
+  for(i = 0; i < 18; i++){
+    b = ((d & a) * (b + p)) | ((c + q) ^ (c - a));
+  }
+  c = ((a + a) | (a ^ q)) & ((d - a) ^ (p & 59));
+  c = ((d & d) ^ (c & 26)) * ((p ^ q) * (c & d));
+  if(c < q){
+    d = ((p ^ a) + (a | b)) * ((c * b) & (b + c));
+  }else{
+    d = ((c * 41) + (q ^ c)) | ((b ^ b) * (b | p));
+  }
+  b = ((a ^ a) * (d | p)) * ((b * q) ^ (d | b));
+  b = ((p - 54) & (b + 13)) - ((p + c) * (b * q));
+  a = ((b - p) + (c | b)) + ((q - c) + (q + b));
+  for(i = 0; i < 50; i++){
+    b = ((c | p) & (b & p)) * ((a - 20) + (d & q));
+  }
+  if(d < a){
+    b = ((a & 2) + (d & 77)) + ((q + a) - (p ^ d));
+  }else{
+    b = ((p + 89) - (d ^ b)) & ((d * d) + (d & b));
+  }
+  d = ((c + d) | (a ^ 96)) * ((c ^ p) - (c | q));
+  c = ((a & 41) ^ (q + 94)) * ((q | b) * (q * d));
+  c = ((c + a) & (c + 22)) * ((a * a) * (d * d));
+  d = ((c | b) * (b & q)) | ((q - 53) * (c * b));
+  if(b < p){
+    d = ((d ^ 21) + (q | q)) & ((q - q) ^ (p ^ 53));
+  }else{
+    c = ((a ^ b) - (c | 59)) & ((d ^ c) ^ (a | c));
+  }
+  for(i = 0; i < 32; i++){
+    c = ((p + a) + (p ^ b)) | ((d * q) ^ (b ^ a));
+  }
+  d = ((q ^ d) & (c + d)) + ((c & 4) - (p + 35));
+  b = ((b - b) | (q + b)) & ((q + 68) & (b ^ 60));
+  c = ((a + 13) ^ (q ^ 55)) | ((b * d) - (a | d));
+  if(b < c){
+    b = ((b + p) & (b ^ 33)) & ((p | q) - (b ^ d));
+  }else{
+    d = ((a | 38) ^ (d - 74)) & ((d & d) - (q * b));
+  }
+  a = ((d & a) * (a - p)) | ((c + d) & (d & p));
+  a = ((p ^ 92) | (q + d)) + ((q | q) - (b ^ c));
+  for(i = 0; i < 23; i++){
+    b = ((a * p) * (d ^ b)) - ((b - c) & (p * 24));
+  }
+  a = ((d * a) - (p - a)) * ((q * c) + (p | q));
+  if(d < b){
+    b = ((a | b) | (d ^ a)) & ((q ^ p) & (q + d));
+  }else{
+    a = ((c - a) + (d & c)) + ((d - 19) * (b * 61));
+  }
+  a = ((d & q) & (c ^ c)) | ((b | q) & (p & c));
+  a = ((d - b) + (c & p)) + ((b * 8) + (b | b));
+  a = ((d - a) ^ (p | d)) ^ ((d & b) | (b * d));
+  d = ((b & 18) | (d + a)) ^ ((a + b) * (p - p));
+  if(d < 57){
+    c = ((p * q) - (q * 30)) * ((d + p) | (a | q));
+  }else{
+    a = ((p + c) | (p ^ 67)) * ((p - 4) | (q ^ a));
+  }
+  b = ((q & c) - (p + d)) | ((a + p) & (a + b));
+  c = ((d * c) - (a * b)) | ((q + c) | (c - a));
+  d = ((a & c) - (b + 61)) + ((p - p) * (a | a));
+  b = ((b * 11) * (c - c)) | ((b + 12) & (p * c));
+  if(a < q){
+    d = ((p & b) & (b + d)) | ((c & b) | (d | a));
+  }else{
+    a = ((q ^ d) - (a + q)) & ((a - a) | (p & 8));
+  }
+  d = ((b - b) & (c | d)) * ((q | 73) | (q & d));
+  for(i = 0; i < 44; i++){
+    c = ((c - p) & (p * 91)) ^ ((p - 53) ^ (b - b));
+  }
+  d = ((a * p) * (b ^ b)) | ((d + b) & (c + b));
+  c = ((a ^ b) ^ (p | q)) + ((c - c) - (q & c));
+  if(a < a){
+    c = ((a & c) * (p - c)) + ((c ^ c) | (c ^ 95));
+  }else{
+    b = ((b + a) * (q & q)) + ((b | c) ^ (d | b));
+  }
+  c = ((q - p) * (a | d)) + ((d * a) * (a ^ p));
+  d = ((a ^ c) & (d + b)) + ((b * p) | (p * p));
+  d = ((c | q) & (q - 40)) | ((p + b) ^ (c ^ p));
+  for(i = 0; i < 11; i++){
+    b = ((p + d) + (a - b)) & ((p + q) | (q + c));
+  }
+  if(a < c){
+    c = ((p + 45) + (d & a)) & ((d | d) ^ (c + 2));
+  }else{
+    d = ((d ^ b) * (a | d)) & ((b & d) & (p ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func11(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 84;
+  d = 23;
+  c = ((p + q) * (c - d)) & ((p - q) * (d + 3));
+  b = ((a - c) | (b ^ 67)) - ((c + a) - (c + q));
+  a = ((p * c) ^ (b | d)) - ((b & 39) - (c ^ b));
+  c = ((b * c) | (b * q)) * ((c & d) + (p & c));
+  if(a < q){
+    b = ((c | p) ^ (q & p)) + ((q | c) * (b | d));
+  }else{
+    b = ((a * p) - (b - 87)) * ((p ^ b) ^ (b ^ a));
+  }
+  a = ((c | d) ^ (q + a)) | ((q & a) - (b - a));
+  for(i = 0; i < 21; i++){
+    d = ((q ^ b) * (b ^ 51)) & ((a ^ d) + (d * d));
+  }
+  a = ((c - d) + (c | b)) | ((p - q) & (a | p));
+  a = ((c - c) - (q - p)) & ((d * 2) & (d | 10));
+  if(a < p){
+    d = ((d * c) - (c + q)) - ((p + 64) | (a - c));
+  }else{
+    c = ((p ^ b) - (d * c)) & ((d - p) & (b * p));
+  }
+  a = ((b | 63) ^ (d & a)) + ((a * c) | (d | 43));
+  c = ((d + p) ^ (q ^ 39)) | ((q & 83) ^ (q & 71));
+  c = ((p - d) ^ (a - 9)) + ((p & p) ^ (d * c));
+  for(i = 0; i < 38; i++){
+    b = ((b * q) * (c | 49)) - ((d ^ 69) * (p & a));
+  }
+  if(c < a){
+    d = ((c * 73) - (b | a)) + ((q * c) + (a + a));
+  }else{
+    d = ((p ^ d) | (a * 77)) + ((q | 38) - (p | 26));
+  }
+  d = ((q * 35) | (d * q)) ^ ((b & b) + (c | 4));
+  c = ((d + d) ^ (p ^ 25)) * ((b ^ q) - (b - b));
+  c = ((a & p) * (a * 98)) * ((d ^ c) + (c * a));
+  a = ((c & 20) + (q & p)) & ((d - b) + (a | p));
+  if(b < 50){
+    c = ((c | a) + (c | 54)) & ((a ^ q) - (q & a));
+  }else{
+    b = ((p | q) + (c ^ 43)) & ((d * b) + (q * 71));
+  }
+  for(i = 0; i < 34; i++){
+    d = ((b * b) - (c | d)) ^ ((p & c) & (p * 18));
+  }
+  b = ((c & q) & (d & d)) & ((a + c) + (d | c));
+  c = ((p | q) | (d ^ c)) - ((a - c) - (q | p));
+  a = ((d ^ q) * (d * p)) + ((c + a) + (d & 37));
+  if(a < 57){
+    b = ((p | b) | (b - c)) * ((q & 37) + (b & 69));
+  }else{
+    a = ((c ^ 18) - (d * d)) - ((b & p) * (a | c));
+  }
+  d = ((c | 68) & (p - a)) * ((q * b) * (c | q));
+  c = ((p + 67) - (p - p)) * ((a + 55) ^ (b * c));
+  for(i = 0; i < 43; i++){
+    d = ((d * d) ^ (a & q)) - ((d & b) * (c * d));
+  }
+  b = ((c ^ b) & (d | a)) | ((c ^ d) + (d ^ p));
+  if(a < c){
+    c = ((p ^ a) | (q - c)) + ((d * q) ^ (c & a));
+  }else{
+    b = ((a & c) | (b | a)) + ((b - c) | (q - b));
+  }
+  d = ((c & a) + (d ^ 41)) | ((d * 53) ^ (p - q));
+  d = ((b | a) ^ (d ^ c)) | ((d - d) + (q ^ 82));
+  a = ((a & 91) + (b * d)) + ((a + d) + (q & d));
+  a = ((p ^ d) ^ (q + 58)) * ((q ^ q) - (q * d));
+  if(d < p){
+    a = ((q + b) - (q & c)) ^ ((a * c) * (c ^ d));
+  }else{
+    b = ((b | 93) + (q * c)) * ((d | 88) - (c & c));
+  }
+  d = ((d & c) * (a - b)) ^ ((a & c) | (c + a));
+  d = ((p * c) * (d | b)) * ((q & q) - (b & p));
+  a = ((q * p) + (d + d)) & ((a - p) + (q + a));
+  a = ((c - q) | (b ^ p)) ^ ((q & a) ^ (p ^ c));
+  if(b < c){
+    d = ((q * 94) & (b & q)) + ((b - d) ^ (q - 82));
+  }else{
+    c = ((p ^ d) | (q - 7)) + ((p ^ a) - (p & a));
+  }
+  d = ((q & b) & (q * p)) ^ ((p | a) & (p + a));
+  for(i = 0; i < 39; i++){
+    a = ((p * p) + (c & c)) & ((p ^ q) ^ (b - c));
+  }
+  a = ((p & b) - (a * 28)) - ((p + a) + (c ^ 34));
+  b = ((b * 76) * (q | 60)) * ((b ^ d) & (c ^ c));
+  if(b < 38){
+    b = ((p | p) + (b + q)) | ((c | a) ^ (d + q));
+  }else{
+    c = ((a - p) & (q * q)) ^ ((q + d) + (b * q));
+  }
+  c = ((d ^ d) | (q * d)) & ((b | c) * (d & c));
+  b = ((q & q) * (q & a)) | ((b | a) | (c * c));
+  d = ((d + p) - (d ^ d)) * ((p ^ 71) | (p ^ 4));
+  for(i = 0; i < 41; i++){
+    d = ((c ^ b) + (p * q)) + ((p & 8) & (d ^ d));
+  }
+  if(d < p){
+    b = ((b - 84) ^ (q * 24)) | ((a & q) ^ (a & q));
+  }else{
+    c = ((d | c) * (b ^ d)) - ((c ^ 54) & (d | a));
+  }
+  return a + b + c + d;
+}
+
+int func12(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 83;
+  d = 61;
+  c = ((d ^ a) & (q - 35)) ^ ((a - q) & (c & b));
+  c = ((q & q) | (q & 84)) * ((a - c) & (a + p));
+  d = ((q * a) + (b | p)) + ((q | d) ^ (p * 63));
+  c = ((b - d) - (a ^ a)) ^ ((a - d) & (c * b));
+  if(a < c){
+    c = ((d - 4) * (q | c)) - ((c | q) + (q | c));
+  }else{
+    a = ((a & 27) | (q & d)) * ((b - p) ^ (a | d));
+  }
+  b = ((q & p) ^ (b - p)) - ((b * 27) + (a | p));
+  for(i = 0; i < 42; i++){
+    b = ((b | p) * (b & 34)) & ((d ^ c) | (c + p));
+  }
+  c = ((p - p) & (p | c)) | ((d + 66) - (b | b));
+  d = ((c ^ 32) * (b * c)) | ((b * a) * (q + c));
+  if(d < 48){
+    c = ((p * b) - (p - d)) + ((a ^ b) | (q | q));
+  }else{
+    c = ((p + 33) - (c ^ d)) * ((b + 44) + (p ^ p));
+  }
+  b = ((b ^ p) ^ (a & 94)) & ((d & 47) ^ (p ^ q));
+  b = ((p - d) ^ (c + a)) | ((q * 13) * (q | p));
+  b = ((p & p) + (p - p)) + ((q & d) & (b & 39));
+  for(i = 0; i < 4; i++){
+    c = ((p * b) & (d & c)) - ((p | c) + (d ^ q));
+  }
+  if(a < p){
+    c = ((a & 52) * (b | q)) - ((p | a) + (d ^ p));
+  }else{
+    c = ((a & d) & (d & d)) ^ ((p | d) + (c | p));
+  }
+  d = ((p & a) & (b * c)) + ((c + c) - (c ^ p));
+  b = ((c ^ p) * (d + b)) - ((a ^ p) | (q ^ d));
+  a = ((c | p) ^ (d * b)) - ((d - 93) | (a | 78));
+  c = ((d ^ 40) * (d + q)) | ((q - q) - (a - 63));
+  if(b < p){
+    c = ((q - d) & (p ^ a)) * ((b | 14) | (q + 92));
+  }else{
+    d = ((c - c) & (a + q)) + ((c | c) * (c + d));
+  }
+  for(i = 0; i < 50; i++){
+    c = ((c * p) + (a - b)) * ((p + a) | (p | a));
+  }
+  c = ((a - b) + (d - a)) | ((p * b) - (c + a));
+  b = ((a + c) + (c & p)) & ((p - 92) ^ (p + b));
+  c = ((d & a) - (a | q)) | ((c + d) * (b - 20));
+  if(a < p){
+    d = ((a ^ a) | (c ^ b)) ^ ((d - 84) - (q + b));
+  }else{
+    c = ((c * 91) * (q * 45)) + ((b | a) - (q * d));
+  }
+  c = ((c | d) | (d * b)) - ((p | 16) - (a - 52));
+  a = ((d ^ 73) - (b ^ d)) & ((b ^ d) | (d - 58));
+  for(i = 0; i < 47; i++){
+    d = ((d - 41) ^ (p + d)) ^ ((b ^ 19) + (c & 66));
+  }
+  b = ((d ^ d) ^ (b - 91)) & ((b ^ a) & (b | b));
+  if(d < q){
+    d = ((q | p) & (d + d)) & ((a * 40) * (a * q));
+  }else{
+    a = ((d | b) + (b ^ c)) - ((q & p) | (q + b));
+  }
+  d = ((c | 50) & (a | b)) + ((a & b) * (p & a));
+  d = ((a - d) + (q | d)) | ((q - c) - (c * p));
+  d = ((d | 2) - (c & b)) - ((c + p) | (p | 46));
+  a = ((p - b) + (c + q)) & ((p & b) & (d & q));
+  if(b < 85){
+    d = ((d - c) | (p * d)) * ((c & q) ^ (a + 61));
+  }else{
+    c = ((d - 69) ^ (p & 50)) & ((d ^ b) | (b * 22));
+  }
+  a = ((d | d) & (a * 28)) - ((a ^ q) | (q + d));
+  b = ((a & 70) & (c ^ 1)) & ((c - 28) ^ (p * p));
+  d = ((d - a) + (c ^ a)) & ((p | q) * (a + b));
+  c = ((d & b) & (q - q)) * ((q ^ p) | (q & d));
+  if(c < 19){
+    c = ((a - q) * (q | 1)) & ((a - c) + (b ^ c));
+  }else{
+    a = ((p - a) ^ (q | 60)) & ((c - 34) + (c | b));
+  }
+  d = ((b + q) * (c * 15)) - ((c * a) | (p ^ c));
+  for(i = 0; i < 19; i++){
+    a = ((b - d) & (c * 3)) & ((b & c) | (a & b));
+  }
+  b = ((p + 32) ^ (b | c)) ^ ((c + c) * (p ^ q));
+  b = ((c * b) ^ (q | a)) | ((p ^ d) ^ (b + p));
+  if(a < q){
+    c = ((a * q) | (a + a)) & ((d * q) ^ (a * q));
+  }else{
+    b = ((q - 85) & (b * d)) * ((c - p) & (q - c));
+  }
+  a = ((c - b) | (b & b)) ^ ((p | c) | (a ^ 48));
+  c = ((p | a) | (a * a)) | ((c - 4) * (p * c));
+  b = ((c & b) | (c - p)) - ((p | q) * (d | d));
+  for(i = 0; i < 27; i++){
+    a = ((p & d) * (b + b)) + ((q | d) ^ (a + c));
+  }
+  if(d < b){
+    a = ((a | p) ^ (d + d)) & ((d ^ b) * (q - b));
+  }else{
+    c = ((q * q) & (c | b)) + ((b ^ b) ^ (p | d));
+  }
+  return a + b + c + d;
+}
+
+int func13(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 93;
+  b = ((a * d) * (d * 93)) * ((d - b) ^ (d + b));
+  c = ((d - 36) + (a - 56)) * ((q + c) ^ (b ^ 59));
+  b = ((p - 57) * (a - 6)) | ((d * b) - (p ^ p));
+  c = ((b * d) - (d * c)) * ((d - d) * (q & p));
+  if(d < p){
+    a = ((p * 50) - (p - p)) | ((c | p) | (p | b));
+  }else{
+    d = ((d | a) | (b & 27)) - ((q & 48) * (q & p));
+  }
+  c = ((d ^ c) + (q * c)) * ((b & d) * (d ^ 53));
+  for(i = 0; i < 6; i++){
+    b = ((a & d) | (p * d)) & ((p * q) + (d | q));
+  }
+  c = ((p * d) & (a + 33)) | ((p + p) | (p * c));
+  a = ((c - 67) & (q | 30)) + ((c * 57) * (d - 50));
+  if(d < a){
+    a = ((q & q) ^ (p + p)) | ((d - p) - (d & 37));
+  }else{
+    c = ((d | q) | (c - a)) - ((b * b) & (c & q));
+  }
+  d = ((q + c) - (d & c)) | ((q & 78) | (a ^ 65));
+  a = ((q & p) + (q ^ 11)) + ((a * c) + (p ^ 3));
+  a = ((q | 28) - (q | 87)) ^ ((a ^ p) ^ (c ^ c));
+  for(i = 0; i < 42; i++){
+    b = ((a * a) & (a & q)) + ((b ^ d) | (b + c));
+  }
+  if(c < b){
+    c = ((q | b) - (d | 76)) * ((d & 5) ^ (c ^ d));
+  }else{
+    c = ((b + 45) - (d | a)) * ((a & p) & (q + d));
+  }
+  a = ((p & 64) - (b + c)) * ((c + a) | (p * q));
+  c = ((q | c) & (d - 12)) & ((a ^ q) - (d & a));
+  a = ((q | c) + (a & a)) ^ ((p + p) - (a - q));
+  c = ((d ^ p) * (c + p)) & ((p ^ d) & (a | b));
+  if(d < p){
+    d = ((q * 44) + (b & q)) + ((b * p) * (d * c));
+  }else{
+    c = ((d - c) - (b & c)) ^ ((a - 39) & (b ^ a));
+  }
+  for(i = 0; i < 34; i++){
+    b = ((c - b) + (d | 50)) ^ ((c | 13) ^ (a * 50));
+  }
+  c = ((d - c) ^ (q + 78)) * ((q - q) * (q & 42));
+  d = ((d + d) | (b - p)) * ((b | p) & (a + c));
+  d = ((q | c) - (p | b)) & ((a | p) & (a - d));
+  if(c < d){
+    d = ((c | q) | (c | q)) | ((b * q) & (c - 38));
+  }else{
+    c = ((c & c) * (b - a)) + ((d * 32) + (p | a));
+  }
+  d = ((c ^ 74) + (q + a)) & ((c & d) | (b - a));
+  c = ((c + 19) + (a * b)) * ((p + b) - (a * a));
+  for(i = 0; i < 27; i++){
+    a = ((p + a) | (c + d)) * ((p ^ p) & (b ^ d));
+  }
+  b = ((d ^ a) ^ (a - 75)) + ((q | d) * (b ^ c));
+  if(d < a){
+    c = ((c + c) + (d | d)) & ((d & 89) ^ (d ^ d));
+  }else{
+    c = ((c + p) | (c - c)) - ((a * p) | (b & d));
+  }
+  d = ((b ^ q) + (d | b)) + ((d * 37) ^ (b - 96));
+  a = ((c & d) + (c | c)) & ((a & 3) * (a ^ a));
+  c = ((d & q) | (b + p)) - ((p & q) | (p ^ p));
+  a = ((c | p) ^ (a + q)) * ((c ^ q) * (q ^ 30));
+  if(a < 26){
+    b = ((d ^ q) * (a & 43)) & ((p - q) | (c | q));
+  }else{
+    c = ((c | p) ^ (q ^ q)) * ((d & c) - (q - 64));
+  }
+  a = ((p ^ 83) * (p & a)) ^ ((b ^ d) * (b | d));
+  d = ((b & q) | (a | q)) & ((q + c) ^ (d * b));
+  b = ((a | 15) * (d + a)) + ((c | b) + (a ^ 64));
+  d = ((c | q) | (b | d)) & ((b * b) ^ (p ^ d));
+  if(b < a){
+    b = ((a | q) & (q * 26)) ^ ((d * b) - (b | c));
+  }else{
+    d = ((a + p) & (c + b)) - ((a ^ 34) | (d ^ 62));
+  }
+  c = ((a ^ c) & (a & c)) & ((d | c) ^ (p + 98));
+  for(i = 0; i < 45; i++){
+    d = ((a * a) + (a + a)) - ((a & 18) * (b * d));
+  }
+  b = ((a & q) + (b + p)) | ((b - p) - (d & c));
+  a = ((b & p) & (a & 58)) + ((d * b) - (a ^ b));
+  if(d < q){
+    c = ((q + p) + (p ^ 84)) | ((c | c) * (a - 33));
+  }else{
+    d = ((a | d) * (q + 90)) + ((b + p) + (p & a));
+  }
+  a = ((b * p) | (a | d)) & ((p * 55) * (b | 45));
+  a = ((q * c) - (a * 43)) & ((d ^ a) * (q + p));
+  b = ((d ^ a) * (b | d)) - ((a * a) + (d | 16));
+  for(i = 0; i < 21; i++){
+    a = ((p & d) - (d & a)) | ((q ^ d) | (b * 42));
+  }
+  if(b < a){
+    a = ((c * q) ^ (a * c)) * ((q - d) * (p + 34));
+  }else{
+    d = ((q | 76) & (b ^ b)) + ((b + 34) - (c * p));
+  }
+  return a + b + c + d;
+}
+
+int func14(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 35;
+  d = 30;
+  c = ((b + c) ^ (a - a)) * ((q | a) * (p * q));
+  a = ((a & a) - (q ^ 58)) + ((c - a) - (a * p));
+  d = ((d | c) ^ (c | d)) * ((a + 56) * (q + q));
+  b = ((a * d) * (p | 9)) * ((d + d) * (c | p));
+  if(a < d){
+    a = ((c + b) - (b ^ a)) & ((q | d) & (b | p));
+  }else{
+    a = ((a ^ p) + (a * a)) ^ ((a ^ 35) + (b ^ q));
+  }
+  b = ((q + a) ^ (d * b)) & ((c & q) * (b | c));
+  for(i = 0; i < 40; i++){
+    c = ((p ^ a) - (p * d)) & ((q - q) & (d ^ d));
+  }
+  b = ((a & 63) + (q | d)) + ((q * p) * (q * 79));
+  d = ((d - p) ^ (q | b)) - ((b | c) | (q | 89));
+  if(d < c){
+    a = ((d - 58) | (q ^ 60)) + ((p ^ p) * (q * a));
+  }else{
+    a = ((c ^ b) & (b ^ a)) + ((d & c) * (q - 47));
+  }
+  a = ((d ^ c) - (q * a)) + ((d * a) & (b | c));
+  b = ((a | q) - (a * c)) ^ ((p ^ b) | (d + q));
+  b = ((p * q) + (c + q)) | ((b & a) * (q + a));
+  for(i = 0; i < 6; i++){
+    d = ((b ^ q) ^ (a ^ d)) | ((c - 53) | (d | q));
+  }
+  if(d < d){
+    d = ((a + c) & (p | 4)) * ((p + q) | (q ^ 65));
+  }else{
+    c = ((b ^ p) & (q | c)) ^ ((a - 25) & (q | d));
+  }
+  c = ((c * q) + (p - b)) & ((q | 47) - (p & a));
+  c = ((q | a) + (q + q)) - ((d - b) | (q ^ 74));
+  b = ((d & a) + (b | 65)) - ((p | q) ^ (b - a));
+  d = ((q ^ b) + (a ^ q)) | ((p & 91) | (c | b));
+  if(a < q){
+    d = ((p - p) | (a * b)) | ((p | b) & (c - d));
+  }else{
+    b = ((a + 72) ^ (d - 28)) * ((p & a) & (d - a));
+  }
+  for(i = 0; i < 44; i++){
+    d = ((d * a) ^ (a & 58)) ^ ((q * 84) + (b | d));
+  }
+  b = ((c * d) * (d + a)) - ((p * b) ^ (d ^ q));
+  d = ((c | a) ^ (a + a)) | ((b ^ 14) & (a & q));
+  a = ((q + p) * (c * c)) ^ ((a ^ 12) * (c + 95));
+  if(a < c){
+    d = ((q + b) - (a | 52)) + ((a ^ a) ^ (q + q));
+  }else{
+    a = ((p ^ b) ^ (p ^ b)) * ((p ^ d) | (q * b));
+  }
+  a = ((a | d) - (c + 41)) - ((p - q) & (p | a));
+  b = ((p ^ b) ^ (q & q)) + ((a & 44) * (c - 72));
+  for(i = 0; i < 44; i++){
+    a = ((b ^ 32) & (a + a)) ^ ((c ^ 57) - (b - 39));
+  }
+  c = ((a | 60) | (c ^ b)) & ((q | a) * (p ^ q));
+  if(c < a){
+    a = ((b & 57) & (c + a)) * ((b + c) & (c ^ q));
+  }else{
+    d = ((c + p) ^ (q | q)) & ((c - 49) * (b | d));
+  }
+  c = ((c ^ p) * (q ^ p)) | ((p | p) * (c - 46));
+  b = ((p ^ p) | (q & q)) - ((d | 59) * (a ^ q));
+  b = ((c | 51) ^ (p - q)) * ((c ^ 86) + (a ^ c));
+  d = ((p | 46) + (a * q)) | ((p & d) * (q | c));
+  if(a < 89){
+    a = ((q * a) ^ (c ^ d)) + ((a + a) & (p & a));
+  }else{
+    c = ((c * 30) | (p + b)) ^ ((b ^ q) - (c + 51));
+  }
+  b = ((d ^ 65) * (p | 37)) | ((b | 11) + (q - p));
+  c = ((p ^ c) * (b ^ q)) & ((p - 90) & (d & a));
+  a = ((c + q) ^ (p - b)) - ((q | 7) - (q & p));
+  d = ((p + 1) | (p * c)) + ((d ^ q) * (p ^ 3));
+  if(c < c){
+    a = ((q - q) & (a * a)) | ((p | p) ^ (a * c));
+  }else{
+    c = ((p - 18) ^ (a | c)) & ((b * a) - (d ^ p));
+  }
+  c = ((p + 66) - (a | c)) | ((d + b) ^ (c ^ 17));
+  for(i = 0; i < 39; i++){
+    c = ((a * q) + (p + d)) - ((a ^ a) + (b | p));
+  }
+  d = ((q | 50) * (a - 11)) ^ ((a - d) + (d - 70));
+  a = ((c | 12) ^ (b + 70)) + ((a | p) * (p + q));
+  if(d < c){
+    d = ((q + 35) * (b - a)) * ((c & d) & (b - q));
+  }else{
+    c = ((p - a) & (d + a)) - ((a ^ p) - (b & b));
+  }
+  d = ((p + b) - (d | 79)) | ((p & b) * (c | 99));
+  d = ((q ^ a) * (b | p)) ^ ((a + c) * (c & 30));
+  b = ((c | a) & (p + p)) * ((a - b) - (a ^ p));
+  for(i = 0; i < 48; i++){
+    c = ((d & q) - (d & 10)) * ((b - c) ^ (a | a));
+  }
+  if(c < d){
+    d = ((c + q) ^ (c - a)) & ((b ^ b) ^ (q - c));
+  }else{
+    c = ((p & q) | (d | a)) & ((c | d) ^ (q - c));
+  }
+  return a + b + c + d;
+}
+
+int func15(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 84;
+  d = 14;
+  d = ((q ^ c) * (a * c)) | ((c | c) ^ (d & q));
+  a = ((q | d) & (a + b)) * ((c | 52) + (p * d));
+  d = ((d ^ d) & (c ^ a)) + ((b * 60) & (d | a));
+  d = ((q + d) - (q - b)) - ((c * d) | (d & a));
+  if(b < q){
+    d = ((a + c) & (p + p)) | ((b & 75) - (a ^ d));
+  }else{
+    c = ((q ^ 65) & (b - 72)) & ((d + a) + (q + b));
+  }
+  d = ((q | 65) * (b | 92)) - ((d * d) * (d - a));
+  for(i = 0; i < 46; i++){
+    a = ((p | 76) ^ (p - d)) | ((c & 2) - (p & 36));
+  }
+  d = ((b ^ c) * (c - b)) & ((c | 23) + (a ^ b));
+  c = ((q ^ a) * (c ^ d)) & ((q + 54) + (a - a));
+  if(c < a){
+    d = ((c | q) + (q | d)) + ((a + b) ^ (p + a));
+  }else{
+    c = ((d ^ c) & (q ^ a)) * ((p ^ b) + (b + p));
+  }
+  c = ((q | c) + (b + c)) + ((p | b) + (d | c));
+  c = ((p ^ q) ^ (b & c)) * ((q - p) | (d | d));
+  a = ((a | b) | (b - 61)) * ((q | b) ^ (c | b));
+  for(i = 0; i < 46; i++){
+    a = ((q | p) * (c - q)) ^ ((p & d) | (a & d));
+  }
+  if(b < a){
+    c = ((p - b) * (d | q)) | ((b - 26) * (d | d));
+  }else{
+    d = ((b | q) - (d ^ d)) * ((a | b) ^ (c | q));
+  }
+  a = ((q ^ c) & (q - 13)) * ((p ^ b) + (p & 87));
+  c = ((p ^ b) | (d & p)) * ((a | b) | (a * b));
+  b = ((b ^ p) * (d | a)) & ((b * d) | (b + 58));
+  d = ((a | a) | (d + c)) & ((b * q) - (a + q));
+  if(d < q){
+    b = ((b | b) ^ (p ^ d)) + ((a ^ c) & (a ^ q));
+  }else{
+    b = ((b - d) + (b * 68)) | ((p + 51) + (p & 5));
+  }
+  for(i = 0; i < 39; i++){
+    d = ((q * c) & (d | c)) & ((p & b) ^ (q ^ p));
+  }
+  d = ((d | p) | (b - 44)) * ((p ^ 14) * (b * b));
+  c = ((q * d) | (d ^ a)) - ((a | b) - (p * b));
+  c = ((q + p) * (b | p)) | ((p + b) * (d & d));
+  if(c < b){
+    d = ((c | a) & (p - a)) * ((p | a) + (b - a));
+  }else{
+    c = ((p + 35) & (a + a)) - ((q ^ p) ^ (d ^ 45));
+  }
+  a = ((a + d) * (p + b)) - ((a | c) & (c | b));
+  d = ((p & 12) ^ (c ^ b)) ^ ((p + d) ^ (q ^ d));
+  for(i = 0; i < 7; i++){
+    c = ((c * d) * (p + 93)) ^ ((p | a) | (d | a));
+  }
+  b = ((d + 48) ^ (c * p)) * ((a | c) * (p - c));
+  if(a < q){
+    d = ((b - 5) - (c - a)) * ((d & 67) + (p ^ p));
+  }else{
+    d = ((c + 9) - (d & 36)) & ((a | 81) - (q | b));
+  }
+  d = ((b + p) * (p + p)) - ((p * c) | (a | q));
+  d = ((c & 21) * (a | b)) & ((a + q) * (d | 47));
+  b = ((d + c) ^ (d ^ 55)) & ((c + a) - (b + a));
+  a = ((c + p) | (a | 56)) | ((c & b) - (b * p));
+  if(d < a){
+    b = ((p ^ b) | (q & b)) - ((q - 59) ^ (c & p));
+  }else{
+    a = ((d | a) + (p & 18)) & ((d | c) * (b - 48));
+  }
+  c = ((d - a) - (p & q)) * ((d + b) - (b - a));
+  b = ((d + d) & (p & c)) ^ ((d + a) + (b ^ a));
+  d = ((q - 40) & (b ^ b)) * ((d + p) & (d + c));
+  d = ((a - q) | (q & p)) & ((b + c) * (c | a));
+  if(b < q){
+    d = ((b ^ q) ^ (q ^ q)) * ((p | q) & (b - a));
+  }else{
+    d = ((q - q) | (c * b)) + ((b * 15) ^ (p - a));
+  }
+  a = ((p - b) + (c & p)) * ((a + d) | (p * c));
+  for(i = 0; i < 36; i++){
+    a = ((b - 62) & (d ^ a)) ^ ((p & p) ^ (a ^ 88));
+  }
+  c = ((p ^ d) | (c & p)) | ((q & p) + (c ^ 68));
+  d = ((d | q) * (p - a)) * ((a - b) - (d & c));
+  if(a < p){
+    b = ((c + d) - (a | q)) ^ ((d ^ 7) + (b & d));
+  }else{
+    a = ((a - p) * (a * 41)) | ((a * a) * (q * d));
+  }
+  c = ((c + 48) & (a ^ b)) - ((a | c) + (c + 2));
+  a = ((c & c) * (b * b)) - ((p | 52) + (b - b));
+  b = ((b & a) & (a - q)) + ((a - 18) * (q & d));
+  for(i = 0; i < 23; i++){
+    d = ((c ^ d) * (p * d)) | ((a ^ d) * (p ^ q));
+  }
+  if(c < b){
+    b = ((b + d) ^ (b + 72)) * ((c * b) * (a + d));
+  }else{
+    b = ((q + a) - (p + 53)) | ((b - 41) | (d - b));
+  }
+  return a + b + c + d;
+}
+
+int func16(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 31;
+  d = 54;
+  c = ((c | 41) | (q - c)) | ((c + 22) | (d * b));
+  a = ((a ^ c) * (b * p)) | ((p - a) - (b * q));
+  d = ((b + c) * (p & c)) ^ ((b ^ d) * (q - 94));
+  d = ((c | 49) | (c & 92)) & ((c | a) - (a + c));
+  if(d < d){
+    c = ((b & 98) & (a * q)) - ((c * c) + (b ^ 29));
+  }else{
+    d = ((d | d) + (c | 34)) + ((d ^ b) & (c ^ b));
+  }
+  c = ((a + d) & (d + q)) * ((c & 31) - (a ^ c));
+  for(i = 0; i < 37; i++){
+    c = ((d + d) * (p ^ p)) | ((c - 17) ^ (q & a));
+  }
+  c = ((b | a) ^ (c * b)) + ((b | q) - (a | 41));
+  a = ((q | q) * (d & 89)) ^ ((c * a) + (p - 43));
+  if(a < q){
+    b = ((p + c) - (a | 44)) + ((p | d) * (c | p));
+  }else{
+    a = ((a ^ 1) - (b * q)) ^ ((a * 86) & (b + q));
+  }
+  c = ((c ^ q) ^ (d - b)) | ((q + c) - (a - b));
+  c = ((c * 35) * (c | c)) + ((b * d) ^ (c | d));
+  b = ((a - p) & (c - 48)) * ((p + 49) + (d | c));
+  for(i = 0; i < 25; i++){
+    b = ((a ^ a) + (b * 11)) + ((c & 30) & (d + q));
+  }
+  if(c < q){
+    a = ((a | a) + (c + p)) & ((a | d) + (p * b));
+  }else{
+    d = ((b + b) | (c | 50)) * ((q ^ q) | (p | 44));
+  }
+  d = ((b | a) ^ (d & c)) & ((d - c) + (c - p));
+  c = ((c * 7) * (d & 46)) | ((c & p) & (d & d));
+  a = ((p + b) * (a & b)) | ((b | 41) & (b ^ a));
+  c = ((p + 46) ^ (q - c)) + ((c + a) + (b * q));
+  if(b < 94){
+    d = ((q | q) & (d | d)) + ((p * b) + (a * 21));
+  }else{
+    a = ((c + p) & (q & p)) | ((p - d) ^ (p & c));
+  }
+  for(i = 0; i < 38; i++){
+    d = ((p ^ d) & (a | b)) - ((p + a) - (q | a));
+  }
+  a = ((a * a) ^ (d * b)) - ((d ^ p) * (a * b));
+  c = ((q * q) ^ (d | d)) | ((p & 64) * (d | b));
+  c = ((a + 68) + (d & 5)) ^ ((b + a) - (b * 86));
+  if(d < 29){
+    d = ((p - 13) - (c | d)) + ((a - 89) - (q | b));
+  }else{
+    b = ((d + b) * (b * c)) | ((a ^ c) | (p | 56));
+  }
+  d = ((c | q) | (b & p)) + ((c + q) * (q & d));
+  d = ((a + c) * (d - c)) & ((b ^ 55) & (q * a));
+  for(i = 0; i < 45; i++){
+    b = ((b & c) + (p | q)) & ((b + d) * (c - p));
+  }
+  d = ((b | d) - (p - b)) + ((c + q) ^ (q + p));
+  if(d < a){
+    d = ((c ^ 25) & (d & a)) + ((c ^ 25) * (q | 50));
+  }else{
+    b = ((p ^ c) + (q + q)) - ((d ^ d) - (b - 39));
+  }
+  d = ((p ^ p) & (b ^ b)) & ((a * a) & (d * 82));
+  b = ((a + c) & (q & q)) | ((p - 17) * (b + 51));
+  d = ((d - d) & (d + q)) + ((d * 92) & (d * d));
+  a = ((c | a) + (q | 14)) + ((q - 94) & (p & p));
+  if(d < q){
+    c = ((d ^ c) & (b | d)) + ((a + 46) + (c | p));
+  }else{
+    a = ((q + p) * (p & b)) ^ ((c | p) | (c & q));
+  }
+  c = ((c * 94) - (d ^ a)) + ((q * p) & (c ^ p));
+  c = ((p - b) * (q & q)) + ((d | 1) - (c | d));
+  d = ((c - a) * (c - a)) | ((a - 86) + (d * q));
+  a = ((d * 38) | (d & p)) & ((d | d) - (q * a));
+  if(d < d){
+    c = ((q ^ b) ^ (b | q)) * ((d | p) ^ (d ^ a));
+  }else{
+    d = ((b & 44) - (b ^ a)) | ((a & 89) ^ (c - b));
+  }
+  c = ((b + q) - (p | d)) + ((b + 84) ^ (p | b));
+  for(i = 0; i < 42; i++){
+    a = ((p + b) & (a * b)) + ((q & p) * (d | q));
+  }
+  c = ((p - c) - (d & q)) | ((d ^ a) ^ (p ^ a));
+  b = ((d + a) | (c * 81)) + ((d & 64) | (a & p));
+  if(a < b){
+    b = ((b ^ 33) + (c + p)) & ((a ^ d) - (p & p));
+  }else{
+    a = ((d | q) & (c + c)) * ((b | p) - (d + c));
+  }
+  a = ((b * p) * (q + 56)) * ((q ^ b) * (c | 77));
+  c = ((a ^ 33) & (a & p)) ^ ((b | q) + (c & c));
+  b = ((c * b) & (p - 65)) * ((q ^ p) | (q * q));
+  for(i = 0; i < 44; i++){
+    a = ((p * p) + (b ^ a)) ^ ((q + q) ^ (p - 49));
+  }
+  if(c < 2){
+    b = ((c + p) ^ (p - q)) + ((a - a) * (b & c));
+  }else{
+    a = ((q | p) - (c * b)) | ((q ^ a) * (q ^ 35));
+  }
+  return a + b + c + d;
+}
+
+int func17(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 90;
+  d = 77;
+  b = ((b & q) - (b & b)) * ((c + 40) + (a ^ 35));
+  b = ((b * d) + (a * d)) | ((b * 4) & (p * p));
+  b = ((d ^ c) - (d + 92)) & ((a + q) * (d & 28));
+  a = ((p ^ c) & (p & q)) & ((b & q) & (q - d));
+  if(a < c){
+    b = ((q | p) + (q * b)) * ((a ^ q) | (p + 15));
+  }else{
+    c = ((q & c) ^ (a & a)) - ((q * d) * (d | d));
+  }
+  a = ((b ^ q) - (c * q)) * ((b & p) & (c * 63));
+  for(i = 0; i < 30; i++){
+    a = ((q | p) & (c * b)) & ((q ^ b) * (q & q));
+  }
+  a = ((p | c) - (a | q)) | ((a | b) ^ (q * 15));
+  b = ((p & 74) - (b & p)) + ((c ^ 83) + (a & 81));
+  if(b < d){
+    a = ((d & d) & (a & q)) * ((q | b) & (c ^ 84));
+  }else{
+    b = ((d + q) & (q ^ q)) | ((d + c) ^ (d + 15));
+  }
+  b = ((a | b) * (b ^ p)) & ((q & p) ^ (q & b));
+  b = ((d | q) - (q * p)) & ((q & a) ^ (d | b));
+  d = ((c - b) & (p + 76)) ^ ((b | 13) ^ (a | 83));
+  for(i = 0; i < 28; i++){
+    c = ((b + p) - (c * a)) * ((b + 55) ^ (a & q));
+  }
+  if(a < d){
+    b = ((b ^ a) ^ (b - a)) - ((p | q) & (a ^ p));
+  }else{
+    b = ((q ^ 56) & (p - a)) | ((q + q) + (a | 63));
+  }
+  a = ((c * c) + (b | 54)) - ((p * p) ^ (q - c));
+  a = ((p ^ b) & (q - q)) ^ ((c - p) * (q - q));
+  b = ((b & q) - (c + 43)) * ((c * q) + (p & 40));
+  d = ((c | 21) - (d & d)) + ((q + b) & (c ^ 12));
+  if(c < d){
+    a = ((b ^ p) ^ (a | p)) + ((d - 42) * (a + d));
+  }else{
+    a = ((b - 7) + (p ^ q)) * ((d | a) | (q & q));
+  }
+  for(i = 0; i < 36; i++){
+    a = ((b & 87) * (b + a)) - ((a | b) - (c - d));
+  }
+  c = ((c - q) | (b + 72)) | ((q & 86) - (a & 37));
+  a = ((d + c) | (a & d)) + ((d | 81) & (a * 80));
+  b = ((d + a) * (c ^ a)) ^ ((c & p) + (b + a));
+  if(d < a){
+    b = ((c ^ c) & (p + b)) ^ ((p * 66) + (c * p));
+  }else{
+    b = ((b | 56) + (c ^ a)) - ((q ^ d) & (c & b));
+  }
+  b = ((c | d) * (d + a)) | ((b + c) - (b & q));
+  a = ((d & q) | (b ^ c)) - ((d & 67) ^ (d * p));
+  for(i = 0; i < 45; i++){
+    b = ((d | 39) - (d ^ b)) & ((q + b) & (a + 22));
+  }
+  b = ((c + p) & (q + c)) & ((q ^ 29) + (p & c));
+  if(c < b){
+    b = ((b ^ 10) * (q & 66)) * ((a ^ c) & (b & c));
+  }else{
+    b = ((b - d) | (q | p)) - ((q * b) & (b + d));
+  }
+  a = ((p & p) + (b ^ q)) * ((b & d) + (q | c));
+  b = ((p ^ q) & (b * q)) ^ ((c * 67) & (a | 77));
+  b = ((p | 49) * (d & 37)) + ((c * 25) * (d - 35));
+  a = ((b & p) | (a + b)) + ((p - 33) * (b | b));
+  if(a < 35){
+    a = ((a & b) + (c * 24)) - ((c * a) | (d + d));
+  }else{
+    d = ((b * 16) | (b + p)) - ((a & d) | (p * 93));
+  }
+  c = ((b * a) - (b | 14)) ^ ((c & b) & (q + q));
+  d = ((q ^ c) ^ (c ^ p)) + ((a * 8) * (c ^ a));
+  a = ((q * d) | (a + 78)) - ((q + c) | (c ^ d));
+  d = ((d + 23) & (q * b)) * ((p & d) | (q ^ c));
+  if(a < p){
+    d = ((p + p) * (c - c)) - ((p - 39) + (a - d));
+  }else{
+    b = ((d & d) + (c ^ p)) | ((p ^ p) + (a & a));
+  }
+  d = ((b * p) + (d + b)) * ((c - p) & (b * p));
+  for(i = 0; i < 15; i++){
+    b = ((c | b) & (d - 49)) | ((q * b) | (c + 37));
+  }
+  d = ((p + p) | (a * p)) * ((q ^ 8) | (a & b));
+  a = ((p | d) | (c + p)) - ((p ^ c) - (b | c));
+  if(b < c){
+    d = ((q * 52) & (p - q)) * ((q | a) + (c * p));
+  }else{
+    c = ((c ^ p) | (b & 49)) + ((p | p) ^ (d ^ 42));
+  }
+  b = ((a & 27) * (p & 27)) | ((b + c) ^ (p + d));
+  a = ((b * d) * (c - a)) | ((d + 56) + (a * a));
+  d = ((q & a) | (b & 84)) & ((b ^ 1) ^ (d * q));
+  for(i = 0; i < 30; i++){
+    d = ((p + a) - (d & a)) * ((d - q) * (c | 93));
+  }
+  if(c < c){
+    b = ((c * 6) ^ (c * q)) ^ ((q ^ 24) | (c - c));
+  }else{
+    b = ((c ^ b) | (d | b)) & ((b + q) + (a * d));
+  }
+  return a + b + c + d;
+}
+
+int func18(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 49;
+  d = 33;
+  c = ((d - p) | (c ^ p)) * ((d - q) + (q & p));
+  c = ((d ^ b) * (b * 31)) | ((c - c) & (q + 17));
+  d = ((p & b) - (d | p)) + ((b - c) - (d + c));
+  d = ((q ^ a) | (d ^ p)) + ((b | 68) & (a | c));
+  if(c < d){
+    c = ((q * a) * (b ^ c)) - ((c - q) ^ (a * d));
+  }else{
+    d = ((a ^ p) ^ (c & 68)) & ((a * 78) * (c - b));
+  }
+  c = ((p - c) ^ (c - p)) | ((b ^ d) - (q * b));
+  for(i = 0; i < 36; i++){
+    c = ((a * c) & (q | 40)) - ((p & a) - (p ^ 36));
+  }
+  c = ((p ^ a) | (q ^ b)) & ((a - d) * (a & a));
+  c = ((a * p) & (d * a)) * ((q + 64) - (c | p));
+  if(b < c){
+    a = ((p & c) + (c + b)) + ((a * b) ^ (a | d));
+  }else{
+    a = ((p * c) + (b + d)) & ((d + 78) - (q + a));
+  }
+  c = ((p | a) | (p - 27)) * ((b & d) * (d & q));
+  b = ((a | q) * (a & p)) + ((a * b) * (d * b));
+  d = ((a & 13) - (p - d)) * ((c ^ d) ^ (q - q));
+  for(i = 0; i < 38; i++){
+    d = ((c | 82) + (p | d)) ^ ((d - p) - (b & b));
+  }
+  if(b < c){
+    b = ((b | 85) | (b & d)) - ((p * 32) ^ (a & p));
+  }else{
+    b = ((q ^ b) ^ (d ^ a)) + ((q ^ p) - (a ^ p));
+  }
+  c = ((c & a) ^ (q * 88)) & ((b + a) + (p ^ c));
+  a = ((b - p) & (q * d)) | ((a - 91) | (c | p));
+  d = ((p & 2) ^ (c ^ a)) + ((p - b) & (p - p));
+  c = ((d & 34) & (a ^ 22)) - ((q | d) - (c + b));
+  if(b < a){
+    d = ((q * p) ^ (q & d)) | ((d - p) | (d + q));
+  }else{
+    d = ((a ^ 67) & (c & c)) ^ ((p + p) & (c ^ a));
+  }
+  for(i = 0; i < 29; i++){
+    b = ((p ^ b) - (b ^ d)) & ((p + a) + (q + 4));
+  }
+  a = ((q & p) + (d + p)) * ((q - d) * (d | p));
+  d = ((p + d) - (b ^ q)) - ((q + q) + (c & c));
+  a = ((a & d) | (a & p)) ^ ((a + d) & (c + c));
+  if(d < 39){
+    d = ((a - b) - (a + q)) | ((b * q) | (b * b));
+  }else{
+    b = ((q & c) & (d | b)) | ((q ^ 34) - (b | c));
+  }
+  b = ((a * q) + (a & 94)) * ((q & a) - (a * q));
+  c = ((d & c) ^ (q | a)) & ((q ^ d) * (d | p));
+  for(i = 0; i < 47; i++){
+    d = ((c - c) * (c * 27)) + ((q & c) - (b + c));
+  }
+  c = ((q & b) & (d - 84)) * ((c & 50) * (a - c));
+  if(a < p){
+    a = ((q & c) | (a | p)) & ((a - c) ^ (b + q));
+  }else{
+    c = ((b * 47) * (q - b)) & ((q + c) * (d & q));
+  }
+  c = ((p & b) + (q ^ c)) ^ ((b | p) + (p - q));
+  b = ((a - 53) | (d - c)) + ((d | b) + (c + d));
+  d = ((b | a) * (a | p)) * ((d ^ d) - (d * b));
+  d = ((b * a) * (q & d)) | ((p - q) & (c | q));
+  if(d < b){
+    d = ((d & b) + (c + p)) & ((b ^ 32) ^ (q | p));
+  }else{
+    c = ((c * a) + (c & 40)) | ((p ^ b) + (q & 42));
+  }
+  d = ((p + 96) - (b | c)) & ((p * a) + (d & 51));
+  d = ((a + d) ^ (q - 7)) + ((q ^ 33) | (a ^ q));
+  c = ((d + p) * (q & p)) * ((p & 11) ^ (q ^ q));
+  b = ((c * d) + (a + p)) & ((b ^ d) | (d ^ 55));
+  if(a < d){
+    b = ((q | b) | (q - 82)) - ((p & a) * (a | d));
+  }else{
+    c = ((q ^ 45) + (q | p)) ^ ((b * 67) - (c * q));
+  }
+  b = ((b * 42) + (d * 6)) + ((q + q) & (d * c));
+  for(i = 0; i < 45; i++){
+    d = ((d & b) - (q + 48)) - ((c - b) - (b - 71));
+  }
+  d = ((q * p) - (c | 88)) & ((b & b) | (p * 69));
+  b = ((c ^ q) | (p | p)) - ((b & q) | (c | c));
+  if(d < p){
+    c = ((p + c) - (c ^ a)) - ((a | q) + (c + a));
+  }else{
+    b = ((c * 60) ^ (a | c)) * ((q ^ q) & (q & a));
+  }
+  c = ((c * p) | (a + c)) * ((p - d) * (p + 73));
+  d = ((b + c) & (c | p)) - ((a & 10) & (c & p));
+  d = ((b | 14) & (a & q)) - ((c & q) - (a - d));
+  for(i = 0; i < 20; i++){
+    c = ((b * 47) - (b * p)) + ((b - d) ^ (c - 25));
+  }
+  if(a < a){
+    c = ((d & q) + (a & b)) + ((c | b) + (b | 45));
+  }else{
+    c = ((d ^ q) | (a | q)) * ((c & p) + (q | 2));
+  }
+  return a + b + c + d;
+}
+
+int func19(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 90;
+  d = 46;
+  c = ((d * 47) * (b - d)) | ((p - b) - (q & 93));
+  a = ((b | c) & (q + d)) + ((a + 31) + (d | a));
+  b = ((q + b) - (d * d)) * ((b ^ 80) & (a + p));
+  c = ((a + d) + (b ^ 60)) & ((p & q) ^ (b ^ d));
+  if(b < p){
+    d = ((p ^ p) * (d | 66)) ^ ((c | a) - (q | p));
+  }else{
+    a = ((q + q) | (p & 82)) | ((a * q) * (q * b));
+  }
+  b = ((a - b) ^ (c ^ b)) + ((a ^ d) + (a ^ a));
+  for(i = 0; i < 37; i++){
+    b = ((d * a) | (c & p)) ^ ((d - b) - (b - 29));
+  }
+  d = ((q | c) + (q * a)) | ((b + c) + (p + d));
+  c = ((p & 70) - (d | d)) + ((b + d) & (q - c));
+  if(a < 3){
+    b = ((d & p) ^ (b ^ d)) - ((p - a) ^ (q | q));
+  }else{
+    d = ((c - a) ^ (c - q)) + ((a + 49) & (b * d));
+  }
+  d = ((b * d) * (q & d)) & ((a | q) | (d | 43));
+  b = ((q & c) & (a + a)) + ((a | b) + (b | c));
+  c = ((a & 16) + (p ^ p)) & ((c - b) + (d | b));
+  for(i = 0; i < 8; i++){
+    d = ((c - p) ^ (a - 41)) | ((a & c) - (d - 68));
+  }
+  if(b < a){
+    a = ((d ^ q) & (c + q)) ^ ((b * q) * (c | b));
+  }else{
+    c = ((a * c) - (c | 18)) & ((q + p) + (d + 75));
+  }
+  a = ((d | 58) | (c ^ c)) - ((q * c) ^ (q & p));
+  a = ((c & 66) & (c ^ p)) + ((d ^ 35) * (p & q));
+  a = ((q - 82) + (d | q)) ^ ((b | p) * (d | c));
+  d = ((q & d) & (q ^ a)) | ((q + d) ^ (b ^ b));
+  if(a < d){
+    c = ((c & d) | (p & a)) * ((b * q) * (d * q));
+  }else{
+    c = ((q ^ p) | (a * p)) - ((q & c) & (d * d));
+  }
+  for(i = 0; i < 31; i++){
+    c = ((q + p) - (a + 15)) * ((a - 3) ^ (b * 9));
+  }
+  a = ((a | p) & (d & 42)) - ((p | d) * (d + 5));
+  d = ((c + c) & (q + 17)) - ((d & b) | (d + c));
+  d = ((q | q) + (c ^ d)) ^ ((b ^ p) & (q | b));
+  if(a < b){
+    c = ((a ^ a) * (b + q)) & ((d + 83) - (q & c));
+  }else{
+    b = ((c + a) | (p + d)) ^ ((b ^ a) * (q ^ p));
+  }
+  a = ((c ^ 34) + (a + q)) - ((c * d) + (b ^ b));
+  d = ((c * c) + (p & p)) & ((p - b) | (p * b));
+  for(i = 0; i < 42; i++){
+    c = ((q ^ d) - (a ^ p)) - ((a - q) ^ (p - 80));
+  }
+  c = ((p + q) & (b * q)) * ((b | q) - (c ^ b));
+  if(c < c){
+    b = ((q - 95) | (q | 73)) & ((d | a) & (a | 7));
+  }else{
+    c = ((d + a) * (c ^ 6)) ^ ((b & d) - (b | q));
+  }
+  b = ((p ^ q) - (a ^ p)) + ((c * 26) | (d ^ 88));
+  a = ((c ^ p) - (p | b)) + ((p & 84) | (a - q));
+  d = ((c ^ c) * (p ^ b)) * ((d ^ a) + (b - b));
+  d = ((b & d) | (q | 36)) * ((p | 38) | (b + a));
+  if(d < 31){
+    d = ((c & d) - (q | c)) * ((d ^ 54) ^ (a ^ b));
+  }else{
+    d = ((b & 86) | (c | c)) * ((p ^ a) ^ (d & a));
+  }
+  c = ((a - d) | (d - a)) | ((d ^ 72) - (c + 73));
+  c = ((c ^ q) | (b | 6)) * ((b | p) + (q ^ a));
+  c = ((c - d) & (a & 16)) * ((d * 48) + (a | c));
+  c = ((d | 71) ^ (c * a)) & ((b | c) & (a + 43));
+  if(b < d){
+    b = ((q | 62) - (q + 68)) | ((p | q) - (c - a));
+  }else{
+    d = ((q | d) - (a - d)) ^ ((q + p) & (c & d));
+  }
+  a = ((c & 21) ^ (d & q)) ^ ((p ^ 85) ^ (c + q));
+  for(i = 0; i < 9; i++){
+    a = ((a & d) * (b ^ p)) + ((b & d) & (a * c));
+  }
+  b = ((c - a) - (b * 58)) * ((d - d) | (a - 25));
+  a = ((b & d) ^ (p | 97)) ^ ((a & d) & (b - 42));
+  if(a < 22){
+    d = ((q - c) + (c ^ q)) & ((p ^ q) + (c - d));
+  }else{
+    a = ((d - b) - (b | b)) - ((p & c) | (q - 59));
+  }
+  c = ((c | b) | (p ^ a)) - ((q & 45) - (c * c));
+  a = ((q - 24) - (c + c)) + ((b - 7) & (b - 19));
+  a = ((p + 67) ^ (b * d)) & ((p + b) | (q * q));
+  for(i = 0; i < 19; i++){
+    c = ((d ^ 56) ^ (q + 37)) - ((a + b) & (d & a));
+  }
+  if(a < 79){
+    b = ((q - q) - (a - 30)) - ((q * d) ^ (d + a));
+  }else{
+    d = ((d + a) ^ (a & 45)) | ((b - 29) ^ (b & 96));
+  }
+  return a + b + c + d;
+}
+
+int func20(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 81;
+  d = 94;
+  b = ((q ^ a) + (b ^ 9)) - ((q - b) ^ (q - p));
+  d = ((c + d) + (d + 36)) * ((p & a) * (q ^ 29));
+  a = ((p * d) * (p + c)) & ((b | 49) ^ (a ^ 54));
+  b = ((q | q) * (d * p)) ^ ((c ^ a) + (a | b));
+  if(c < q){
+    a = ((d | a) + (q ^ c)) + ((p | q) - (b | p));
+  }else{
+    c = ((p * 64) - (c & a)) | ((c + p) | (a | 3));
+  }
+  a = ((q + 18) + (c - a)) ^ ((b & 74) & (q * b));
+  for(i = 0; i < 6; i++){
+    c = ((b - p) - (c * 65)) | ((q - p) - (p * q));
+  }
+  d = ((q * c) & (d - 87)) + ((p * q) + (c ^ p));
+  d = ((p | 24) & (p & 3)) ^ ((a | p) + (d | 71));
+  if(d < d){
+    a = ((p * 64) - (a + 82)) ^ ((d ^ 95) & (d - a));
+  }else{
+    b = ((p | p) | (a - q)) - ((q - d) & (p + d));
+  }
+  d = ((p ^ b) & (c | c)) | ((b | 48) & (a * b));
+  d = ((b + a) & (a ^ p)) | ((b | d) & (p + 68));
+  c = ((d + a) * (p & b)) + ((c * b) | (q * 30));
+  for(i = 0; i < 25; i++){
+    a = ((b ^ q) | (a & p)) | ((b ^ p) & (q & 33));
+  }
+  if(d < q){
+    b = ((d | d) * (q | c)) - ((d & 27) ^ (p + d));
+  }else{
+    a = ((a | b) * (q ^ d)) & ((c * q) ^ (p * 73));
+  }
+  b = ((a & b) | (p | q)) & ((a - 67) + (a * 47));
+  d = ((d - p) ^ (q & p)) - ((c ^ d) - (c ^ p));
+  d = ((d + d) - (c & a)) - ((b | c) - (b | c));
+  b = ((p | 21) | (d * 78)) | ((d ^ a) + (q & c));
+  if(d < c){
+    c = ((c & p) ^ (d + b)) & ((q ^ 34) - (c | 34));
+  }else{
+    a = ((p & p) | (q ^ 71)) | ((c | c) + (b + p));
+  }
+  for(i = 0; i < 47; i++){
+    d = ((a & p) ^ (a ^ q)) * ((c | p) - (c - c));
+  }
+  d = ((a & a) | (p & q)) & ((q | q) + (q + 42));
+  c = ((d * c) | (p & 33)) * ((p ^ 6) - (d * c));
+  d = ((c ^ p) + (b ^ d)) - ((c & p) ^ (b ^ b));
+  if(c < c){
+    b = ((p & p) + (c & q)) * ((c + 16) & (a + b));
+  }else{
+    c = ((a * c) ^ (d | a)) | ((d & p) + (q ^ 77));
+  }
+  a = ((p - c) * (b ^ b)) & ((b * 44) + (a | q));
+  a = ((q + q) - (d | q)) & ((d + d) * (q - 84));
+  for(i = 0; i < 13; i++){
+    b = ((a | b) ^ (q - d)) + ((c + q) & (d + a));
+  }
+  d = ((a - b) + (q * d)) ^ ((b * a) ^ (a | q));
+  if(c < p){
+    a = ((q & 60) & (p ^ q)) | ((d | d) - (d + b));
+  }else{
+    c = ((p + c) | (p * c)) | ((q | b) - (p - q));
+  }
+  c = ((p | p) & (b * a)) | ((a * c) ^ (q ^ 18));
+  b = ((p & c) + (c & 30)) * ((a + q) ^ (a | a));
+  d = ((p | 93) ^ (a - b)) - ((p | q) & (p ^ 91));
+  c = ((q - p) * (q ^ 41)) - ((q - q) ^ (q - 65));
+  if(b < 36){
+    a = ((b - c) & (d + 99)) + ((p * q) ^ (a ^ q));
+  }else{
+    a = ((c * q) ^ (p & a)) * ((b + b) | (q & p));
+  }
+  d = ((p + p) + (b + 44)) & ((b | 46) ^ (a * a));
+  a = ((d - 69) - (a ^ p)) * ((a | b) & (q - p));
+  b = ((b * b) ^ (a * d)) + ((d * c) ^ (b - p));
+  c = ((a | d) & (d * 34)) * ((p | 47) ^ (c + a));
+  if(a < p){
+    a = ((p * c) & (b * p)) | ((b - 1) ^ (c - a));
+  }else{
+    d = ((p * b) + (d - p)) | ((q | q) * (a | b));
+  }
+  d = ((p - d) - (a * a)) * ((c ^ q) * (q - b));
+  for(i = 0; i < 4; i++){
+    c = ((d & d) - (c + a)) * ((d - a) * (c ^ 10));
+  }
+  b = ((q | b) * (c & 1)) * ((a + b) * (c & 91));
+  a = ((p * a) + (b * 49)) + ((d + p) * (p & 68));
+  if(a < b){
+    c = ((a ^ p) & (d ^ p)) + ((q - b) - (b ^ q));
+  }else{
+    a = ((d * b) - (p * 2)) * ((p & 89) - (d - p));
+  }
+  d = ((q & 17) + (d ^ p)) & ((a & a) * (c ^ d));
+  b = ((b & 15) | (d * b)) ^ ((c | a) & (p | q));
+  a = ((c + 3) - (a * d)) & ((c & 98) & (d * c));
+  for(i = 0; i < 46; i++){
+    a = ((d & p) * (d & p)) ^ ((d - b) + (d * d));
+  }
+  if(a < q){
+    b = ((b * q) & (b * a)) & ((q ^ 97) ^ (c + 83));
+  }else{
+    c = ((d - c) & (q * p)) ^ ((b + q) - (b * q));
+  }
+  return a + b + c + d;
+}
+
+int func21(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 2;
+  d = 50;
+  c = ((b - c) * (c | q)) | ((c ^ b) - (p - a));
+  c = ((b * p) - (a - 55)) - ((b | d) ^ (a ^ p));
+  b = ((d | c) * (a - a)) ^ ((a ^ b) ^ (d ^ p));
+  b = ((c + d) ^ (c ^ b)) ^ ((b ^ 12) | (b & 27));
+  if(c < c){
+    d = ((q ^ b) | (d | 64)) & ((p | c) | (q & c));
+  }else{
+    c = ((b * 79) + (b & a)) | ((a * q) ^ (b * a));
+  }
+  c = ((p * d) & (b * c)) - ((b * a) + (p - a));
+  for(i = 0; i < 34; i++){
+    b = ((b ^ a) ^ (d & c)) ^ ((p & 8) ^ (a * 10));
+  }
+  c = ((c & a) - (q + d)) * ((b & q) ^ (b | p));
+  a = ((c + q) | (q - 48)) * ((d ^ b) ^ (q - p));
+  if(b < b){
+    c = ((q * q) & (p ^ a)) & ((p | p) + (c & b));
+  }else{
+    c = ((q * d) | (p - c)) & ((p * b) * (c + 43));
+  }
+  b = ((a | q) ^ (c - 45)) + ((b - a) + (c * a));
+  a = ((q + b) & (p ^ q)) | ((b & 47) & (p & q));
+  d = ((b * 82) + (b & a)) + ((b ^ 96) * (d | q));
+  for(i = 0; i < 4; i++){
+    c = ((q & d) + (d - b)) - ((b ^ c) * (p & 89));
+  }
+  if(d < q){
+    b = ((p ^ c) + (p | 28)) | ((a - b) & (q ^ b));
+  }else{
+    a = ((b * d) + (p * b)) * ((c ^ 28) - (b - a));
+  }
+  a = ((a & a) + (b | p)) & ((c | 13) * (c - d));
+  a = ((a & c) | (p - 17)) ^ ((b - b) + (q & a));
+  a = ((d & p) ^ (p & b)) + ((d * b) * (a & a));
+  a = ((p + a) & (p * p)) | ((q * b) | (a + p));
+  if(c < 40){
+    b = ((b | c) - (d | b)) + ((p & q) + (b - q));
+  }else{
+    c = ((c | q) & (q | c)) | ((b & d) | (c & 68));
+  }
+  for(i = 0; i < 35; i++){
+    a = ((c ^ a) & (p * d)) + ((c | d) ^ (c & q));
+  }
+  c = ((a + 80) & (c ^ 87)) - ((d | c) * (p * q));
+  c = ((p - 74) ^ (c - b)) * ((p * c) - (d ^ 7));
+  a = ((c + p) * (d & 94)) & ((d & 33) & (d & c));
+  if(d < b){
+    d = ((a - p) ^ (q + d)) & ((d ^ a) + (q - d));
+  }else{
+    c = ((q + b) + (d ^ b)) | ((p ^ b) ^ (a & c));
+  }
+  c = ((c + d) * (d & a)) & ((q | 88) + (d | p));
+  b = ((q | b) | (c * q)) ^ ((a | c) ^ (p - d));
+  for(i = 0; i < 8; i++){
+    a = ((d ^ p) ^ (p + p)) * ((b | a) & (a + p));
+  }
+  d = ((c | b) | (c + b)) + ((a * c) | (c & c));
+  if(d < b){
+    a = ((c + c) - (b + a)) & ((b & a) | (b * 44));
+  }else{
+    d = ((p & p) * (p ^ c)) - ((p * b) + (a + 98));
+  }
+  a = ((a + c) | (q & c)) + ((b | p) ^ (c + 94));
+  c = ((c - 51) * (c + 23)) | ((d & a) + (a + 13));
+  b = ((a & d) + (d + a)) + ((b + a) * (q ^ p));
+  d = ((d & d) - (a + c)) | ((a | b) + (q + a));
+  if(d < p){
+    d = ((b | 10) & (c + a)) & ((q & a) & (b | p));
+  }else{
+    d = ((q | a) ^ (p - a)) | ((a + 60) & (b + d));
+  }
+  a = ((q | 24) & (a & 24)) - ((q & 78) + (q + a));
+  a = ((d + p) | (p * 84)) | ((d | d) * (d + 82));
+  b = ((d * d) | (d + p)) - ((c ^ p) ^ (c ^ p));
+  b = ((a - b) & (q ^ p)) | ((a + b) + (b * d));
+  if(c < 6){
+    d = ((q + d) - (b - d)) & ((p - d) + (b - 89));
+  }else{
+    d = ((q | 7) ^ (p ^ 88)) * ((d ^ b) - (p ^ q));
+  }
+  b = ((b * q) + (c + 81)) ^ ((p | b) ^ (q & p));
+  for(i = 0; i < 3; i++){
+    c = ((d ^ 88) ^ (d ^ q)) + ((p & a) | (c + b));
+  }
+  a = ((q & b) | (a ^ d)) - ((d * 71) | (a | p));
+  a = ((d * q) - (a | 16)) - ((c - 38) * (b ^ 38));
+  if(c < q){
+    b = ((p ^ p) & (q ^ 78)) - ((q + p) - (q | c));
+  }else{
+    c = ((p | 32) | (q ^ b)) + ((c | q) | (a | 1));
+  }
+  a = ((b ^ p) - (p + q)) & ((b ^ 46) + (b ^ 2));
+  a = ((a * b) | (q & d)) | ((q | q) | (a | d));
+  c = ((a ^ d) - (d | a)) + ((a * p) + (a + q));
+  for(i = 0; i < 33; i++){
+    a = ((b & q) | (b + a)) - ((p & a) - (d - a));
+  }
+  if(d < 81){
+    c = ((b - b) & (a - 10)) * ((a * 1) - (a - 82));
+  }else{
+    d = ((b & p) * (p | q)) - ((b ^ d) ^ (p - 86));
+  }
+  return a + b + c + d;
+}
+
+int func22(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 79;
+  d = 79;
+  d = ((a + p) & (c | q)) + ((d | d) ^ (d & 92));
+  a = ((a | p) * (b * a)) + ((p - b) ^ (b | 36));
+  a = ((p - a) + (p * a)) + ((d | p) + (b | 47));
+  c = ((b * 30) | (p + p)) * ((d * 55) | (c | b));
+  if(c < b){
+    c = ((a + b) ^ (b ^ 7)) ^ ((b - a) * (d + p));
+  }else{
+    d = ((b ^ a) - (c + 79)) ^ ((c * q) * (a - p));
+  }
+  c = ((d - q) ^ (a - 39)) + ((a + p) - (q - c));
+  for(i = 0; i < 22; i++){
+    c = ((c + q) + (c - d)) - ((p & q) | (c + q));
+  }
+  d = ((b | c) | (d ^ 11)) + ((p & 40) * (d * q));
+  a = ((a ^ a) + (q + p)) ^ ((p * 6) & (p + a));
+  if(a < q){
+    b = ((a ^ p) + (b | b)) ^ ((c + 45) ^ (q ^ c));
+  }else{
+    b = ((q | q) + (a * b)) | ((a ^ d) * (d * c));
+  }
+  b = ((q & p) & (d ^ d)) | ((b - 81) ^ (a ^ c));
+  c = ((a | q) | (d ^ p)) | ((b * 39) - (a * d));
+  d = ((c & d) & (a | b)) ^ ((b * 63) * (q ^ p));
+  for(i = 0; i < 26; i++){
+    a = ((q ^ p) - (q - c)) + ((p ^ c) & (b & a));
+  }
+  if(b < c){
+    c = ((b ^ d) * (a + 56)) | ((c * c) ^ (q + a));
+  }else{
+    c = ((b * 47) + (a - b)) | ((c - p) * (p * a));
+  }
+  a = ((a | c) & (d ^ p)) | ((b ^ c) | (b | c));
+  b = ((q * c) - (q ^ a)) ^ ((c | c) + (c - b));
+  a = ((c | a) & (q + 74)) - ((c | 41) ^ (c | 38));
+  a = ((q - 99) | (a + d)) & ((q | c) - (q & 96));
+  if(c < d){
+    a = ((c - c) * (c + a)) & ((c - 14) | (b | 27));
+  }else{
+    d = ((d & c) & (d - 64)) + ((q | p) + (c | 88));
+  }
+  for(i = 0; i < 10; i++){
+    c = ((b + q) ^ (d ^ c)) + ((q - 33) * (q * q));
+  }
+  d = ((c & a) * (c * 66)) * ((a + d) + (b - c));
+  d = ((q | b) * (p - 25)) - ((q & b) | (d | 12));
+  a = ((q - 3) & (q - 80)) - ((q - a) ^ (q * d));
+  if(b < 88){
+    a = ((b * p) + (a | q)) ^ ((a | c) + (d & d));
+  }else{
+    a = ((c & a) * (a + a)) * ((p * q) - (c * a));
+  }
+  c = ((p & q) ^ (d | q)) * ((q ^ 42) * (q * a));
+  d = ((p - b) ^ (d - d)) ^ ((a * 54) ^ (b * 7));
+  for(i = 0; i < 9; i++){
+    a = ((b | 28) ^ (p & d)) * ((d - d) ^ (c * c));
+  }
+  a = ((d - q) & (b * b)) + ((a & d) + (q & q));
+  if(b < p){
+    b = ((b + d) - (b & q)) * ((q + b) - (b * 93));
+  }else{
+    c = ((p ^ 33) & (q - a)) - ((q * p) * (p * 70));
+  }
+  a = ((d ^ a) ^ (d - b)) + ((a * b) + (c & 4));
+  c = ((d - 37) & (c & a)) + ((c & q) - (q - p));
+  c = ((c | 31) - (c | q)) + ((q - 3) & (p + 12));
+  d = ((d + q) | (c - 95)) + ((d * b) * (q ^ 91));
+  if(b < b){
+    b = ((p | a) - (p & 22)) * ((d & p) - (a * q));
+  }else{
+    c = ((a - d) * (b * 30)) & ((p + c) & (q & q));
+  }
+  b = ((c + p) ^ (q ^ 53)) & ((a * a) | (a + p));
+  c = ((p | p) * (p * 58)) - ((b | p) ^ (a * c));
+  c = ((c - q) ^ (p * b)) - ((p ^ p) | (c * d));
+  d = ((c ^ a) | (p & c)) ^ ((b | 90) | (p & 9));
+  if(d < 95){
+    a = ((b - a) + (c & a)) - ((d * d) | (p * 67));
+  }else{
+    a = ((a * 1) + (d & a)) & ((b + q) | (p + 41));
+  }
+  d = ((q & c) ^ (a - c)) * ((q - p) - (q - 23));
+  for(i = 0; i < 19; i++){
+    b = ((b - 56) - (b & p)) & ((a - 17) * (c * d));
+  }
+  d = ((a - d) & (c | a)) & ((b ^ a) ^ (d + 51));
+  b = ((a & d) ^ (b * c)) * ((p & 11) + (d * b));
+  if(b < q){
+    a = ((p | q) * (p * 48)) & ((p - c) ^ (c | q));
+  }else{
+    b = ((a - a) + (q - c)) | ((d + b) ^ (q * p));
+  }
+  d = ((c + q) + (a * q)) & ((p & 28) - (d - d));
+  b = ((b ^ 78) ^ (q + b)) ^ ((b - q) ^ (p * c));
+  b = ((c ^ a) - (d ^ 70)) + ((c | p) - (q & 79));
+  for(i = 0; i < 23; i++){
+    a = ((c + d) ^ (c + b)) & ((c + 11) - (c | a));
+  }
+  if(c < c){
+    d = ((b + 62) * (c | q)) + ((c | q) | (p ^ 15));
+  }else{
+    d = ((b + c) ^ (q ^ 63)) | ((p + b) * (p | p));
+  }
+  return a + b + c + d;
+}
+
+int func23(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 19;
+  d = 8;
+  a = ((b ^ c) * (q * c)) * ((p | b) + (d + a));
+  d = ((a ^ p) | (b * a)) | ((b * c) ^ (p | b));
+  c = ((b * q) ^ (c ^ a)) * ((p * 35) - (b - d));
+  d = ((d & c) | (p + 98)) | ((c & a) | (q | c));
+  if(c < b){
+    c = ((b ^ b) - (c ^ c)) & ((b - b) - (c + d));
+  }else{
+    b = ((q + 24) - (q * p)) ^ ((q * d) & (b | 26));
+  }
+  a = ((q * q) & (b + a)) | ((p - q) - (q * 45));
+  for(i = 0; i < 14; i++){
+    b = ((a ^ 93) * (a + b)) | ((q - 60) - (b | p));
+  }
+  c = ((d * 80) - (a ^ p)) | ((q - q) ^ (p ^ q));
+  d = ((c | b) | (c * p)) ^ ((d & a) | (a & 16));
+  if(a < a){
+    b = ((b * d) * (b - 50)) + ((q | p) & (c * a));
+  }else{
+    d = ((q + 78) * (a ^ d)) * ((c & q) | (d * 72));
+  }
+  c = ((b | b) & (d - 77)) & ((a ^ q) * (p & c));
+  d = ((b | q) - (p & p)) & ((b ^ p) + (q * q));
+  c = ((b - 79) ^ (p & d)) - ((q * 62) * (p & c));
+  for(i = 0; i < 4; i++){
+    b = ((p & 74) - (b | a)) - ((c & 73) * (q | d));
+  }
+  if(b < d){
+    a = ((q | 88) * (d | q)) ^ ((d - c) ^ (p | 23));
+  }else{
+    b = ((d | 33) ^ (b + c)) | ((c | c) + (p - p));
+  }
+  b = ((p - b) - (d * q)) & ((d * p) | (c | c));
+  b = ((p - p) ^ (b - a)) - ((b + d) + (q * b));
+  b = ((a - q) - (c * a)) | ((p - c) ^ (a ^ 14));
+  a = ((b + p) * (b + p)) | ((d * 42) * (a & d));
+  if(a < 89){
+    d = ((p * a) & (b ^ p)) + ((a & q) + (b * 76));
+  }else{
+    c = ((d ^ c) ^ (p + c)) & ((b * c) & (a - b));
+  }
+  for(i = 0; i < 32; i++){
+    d = ((b - p) | (p | p)) + ((q - 83) | (a - d));
+  }
+  a = ((q * 58) & (a | p)) + ((a * 1) * (c | c));
+  a = ((a | b) * (q ^ p)) * ((p * p) | (p ^ 79));
+  d = ((d * 84) & (b ^ c)) ^ ((a * 87) + (d * 23));
+  if(d < 32){
+    b = ((a * p) ^ (b ^ d)) ^ ((d ^ b) | (q | b));
+  }else{
+    c = ((q ^ q) - (p & p)) | ((c & d) | (p ^ p));
+  }
+  a = ((d ^ q) & (d - b)) + ((b - c) + (a + a));
+  d = ((q ^ d) & (q | c)) ^ ((d + c) & (b * 72));
+  for(i = 0; i < 8; i++){
+    d = ((q * c) & (c ^ c)) & ((b | c) | (a * 93));
+  }
+  b = ((d | 25) - (p & p)) & ((b - q) + (d ^ b));
+  if(d < d){
+    d = ((c ^ q) - (q & b)) - ((b & c) | (d & d));
+  }else{
+    b = ((c | p) * (a & b)) & ((a * b) - (q | q));
+  }
+  c = ((a - b) | (c + q)) | ((d + 49) - (b - c));
+  a = ((a | q) ^ (a * d)) & ((q | b) - (q | p));
+  c = ((q | d) ^ (c + c)) ^ ((a | b) | (q + q));
+  a = ((a + p) * (b - 81)) & ((a & 5) ^ (b & q));
+  if(a < a){
+    b = ((q - 10) ^ (b & p)) - ((d + 17) - (b * 69));
+  }else{
+    b = ((q | 62) + (p ^ 63)) ^ ((p ^ d) & (a * p));
+  }
+  a = ((d + a) - (q + p)) * ((c ^ p) & (c - 48));
+  a = ((p - q) + (c - 18)) * ((b | q) ^ (d - a));
+  c = ((q + a) & (c + d)) & ((p | q) + (d | a));
+  c = ((c ^ q) * (a & 53)) & ((a | d) * (b ^ a));
+  if(d < 58){
+    c = ((p + 79) - (d * a)) * ((q * b) ^ (b | p));
+  }else{
+    a = ((q * p) - (c - b)) & ((d & a) * (d | p));
+  }
+  b = ((c | p) + (a & p)) + ((c + p) + (d * c));
+  for(i = 0; i < 7; i++){
+    b = ((p - p) * (q * 6)) - ((p + b) - (b * 1));
+  }
+  a = ((c * 54) * (b + d)) + ((b * b) ^ (b - q));
+  c = ((d - d) & (a + a)) & ((d & a) ^ (p & 37));
+  if(b < b){
+    d = ((a * d) & (q & b)) & ((p - p) + (b - q));
+  }else{
+    d = ((c - b) * (b + a)) & ((d + d) + (a + c));
+  }
+  a = ((a ^ b) | (q ^ q)) * ((b & a) + (b - a));
+  c = ((c | q) & (p + b)) * ((q | a) - (c | d));
+  d = ((b - b) & (c - q)) & ((b * b) + (p ^ a));
+  for(i = 0; i < 15; i++){
+    c = ((c & 64) | (b - q)) + ((d | p) & (q & 70));
+  }
+  if(a < p){
+    c = ((p + a) | (b - b)) + ((c * b) & (c | q));
+  }else{
+    c = ((c - 36) * (d - 41)) ^ ((q * a) - (b + d));
+  }
+  return a + b + c + d;
+}
+
+int func24(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 95;
+  d = 43;
+  c = ((q & p) - (a + d)) - ((c - 62) * (p & 38));
+  b = ((q - q) & (q & q)) ^ ((b | 1) - (q & a));
+  b = ((b & d) | (p & 27)) | ((q * a) + (c ^ a));
+  a = ((c ^ q) - (d * d)) & ((a + 8) - (q | 1));
+  if(a < 26){
+    d = ((d | q) ^ (c - c)) + ((a & q) * (b * a));
+  }else{
+    d = ((a - b) - (d & 12)) & ((a ^ 83) * (a ^ 14));
+  }
+  a = ((c - q) & (c | d)) & ((p + 99) * (p & c));
+  for(i = 0; i < 11; i++){
+    a = ((a | q) ^ (b | c)) * ((p * d) * (d - 85));
+  }
+  c = ((q ^ 31) * (p & d)) - ((c - b) + (p * 85));
+  c = ((b + d) + (b + a)) + ((p ^ p) * (d & c));
+  if(a < d){
+    b = ((d ^ c) - (b * a)) + ((q * q) ^ (a ^ a));
+  }else{
+    b = ((p + b) + (a ^ a)) + ((q & 70) ^ (d * c));
+  }
+  d = ((d | q) - (d & 66)) | ((a | 81) * (q | a));
+  a = ((q * 85) * (a & 79)) + ((c & p) | (b ^ q));
+  c = ((p * 74) & (d | p)) ^ ((d + 62) | (d & 79));
+  for(i = 0; i < 28; i++){
+    b = ((a - p) - (q * b)) + ((a - p) & (a + a));
+  }
+  if(a < b){
+    d = ((b & 24) * (d ^ 87)) | ((b * p) & (b * 76));
+  }else{
+    b = ((q & 31) & (c & p)) ^ ((p | d) ^ (p - d));
+  }
+  b = ((q & p) + (a | b)) & ((q | q) - (q | p));
+  a = ((p + c) + (c * p)) ^ ((b + 95) * (a | 77));
+  b = ((c + 38) | (q + b)) + ((c & b) ^ (c & b));
+  c = ((c | 5) ^ (q * d)) * ((a * q) * (a * c));
+  if(a < 70){
+    a = ((a * q) - (p - d)) + ((a + 93) + (p & 18));
+  }else{
+    c = ((b & q) ^ (p * q)) | ((a & p) - (d - q));
+  }
+  for(i = 0; i < 10; i++){
+    d = ((a - c) - (a + c)) | ((q + q) - (d + p));
+  }
+  d = ((q - 43) - (q + p)) * ((d * p) & (d + 33));
+  c = ((b & 33) | (d - p)) * ((b + b) + (a + 87));
+  b = ((q & a) | (p + d)) | ((d * q) & (c + d));
+  if(c < b){
+    d = ((d + p) ^ (p + 96)) & ((a - q) ^ (a + c));
+  }else{
+    b = ((p + 8) * (b & q)) | ((q + a) | (d | 85));
+  }
+  b = ((c ^ 41) - (c + c)) - ((q & c) ^ (d + b));
+  d = ((b + c) & (p ^ b)) * ((q + 61) - (b & 11));
+  for(i = 0; i < 44; i++){
+    b = ((q + 10) & (p | b)) + ((p * 48) * (q + b));
+  }
+  d = ((b + 43) - (p - b)) + ((d ^ 25) | (q | a));
+  if(b < a){
+    d = ((b ^ 6) + (q * q)) * ((b * 63) * (b ^ p));
+  }else{
+    d = ((b ^ p) - (c ^ b)) | ((p ^ c) ^ (b - c));
+  }
+  c = ((b & c) | (b | d)) ^ ((q * a) ^ (c * a));
+  b = ((a | p) | (a + c)) + ((c - d) * (q + a));
+  c = ((a - d) ^ (d + q)) & ((d * p) - (b | 6));
+  c = ((a + d) & (b + c)) * ((q | 69) ^ (p | c));
+  if(b < q){
+    b = ((a ^ c) * (p - 52)) | ((c * 69) & (q + q));
+  }else{
+    d = ((c & c) - (d * p)) - ((d * 4) + (c & c));
+  }
+  c = ((q | 43) & (b ^ 42)) ^ ((d - q) | (p + p));
+  c = ((p * b) ^ (q + c)) - ((c + 75) + (a & 25));
+  b = ((b & c) * (d ^ c)) + ((d * a) - (d - b));
+  d = ((q + q) & (p + d)) | ((a + a) | (d ^ 24));
+  if(a < p){
+    c = ((q | d) * (b * q)) * ((p - c) & (a * c));
+  }else{
+    b = ((c ^ q) * (d | c)) & ((a + b) * (b * 49));
+  }
+  b = ((b | b) - (q + p)) ^ ((q + 89) - (d * d));
+  for(i = 0; i < 16; i++){
+    d = ((q | q) + (a ^ p)) & ((q ^ b) & (c - q));
+  }
+  a = ((q & 77) ^ (b ^ p)) | ((q + d) & (b ^ b));
+  c = ((c * c) & (b & a)) ^ ((p - q) ^ (a + p));
+  if(a < q){
+    b = ((c & 47) | (c ^ c)) | ((c ^ c) & (q * d));
+  }else{
+    b = ((p * c) & (b & c)) | ((c * c) ^ (a * q));
+  }
+  b = ((q + 20) * (a + a)) + ((q - p) | (a * 62));
+  a = ((d ^ c) ^ (b ^ p)) * ((d | q) * (q * b));
+  b = ((b | 21) & (p + 21)) ^ ((d & d) - (a + d));
+  for(i = 0; i < 35; i++){
+    b = ((d * q) | (q ^ 43)) * ((p ^ a) & (q | q));
+  }
+  if(c < q){
+    a = ((b - a) ^ (d | d)) & ((c ^ 49) | (p ^ p));
+  }else{
+    a = ((p - d) ^ (a + b)) ^ ((b & c) | (p - d));
+  }
+  return a + b + c + d;
+}
+
+int func25(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 85;
+  d = 6;
+  a = ((a ^ p) | (b + p)) & ((a & q) - (c & c));
+  b = ((d ^ q) - (q | 21)) + ((a - c) - (d & 96));
+  b = ((c * b) + (c ^ 42)) - ((a * a) | (c | c));
+  a = ((p | q) - (d & 85)) | ((c & c) ^ (c * p));
+  if(d < q){
+    d = ((d ^ 28) + (a ^ 18)) ^ ((b | b) - (a * 71));
+  }else{
+    a = ((q & a) ^ (q & d)) & ((q | c) - (a * 28));
+  }
+  c = ((d - b) | (d + b)) + ((b * b) & (b & 34));
+  for(i = 0; i < 14; i++){
+    c = ((a ^ 70) - (c + 40)) & ((a + c) ^ (b * b));
+  }
+  c = ((b ^ b) | (a ^ d)) & ((b | c) | (d ^ d));
+  c = ((c * a) + (d & p)) * ((b | d) & (q | a));
+  if(d < q){
+    a = ((c ^ 26) + (d ^ p)) ^ ((p * 68) ^ (b + a));
+  }else{
+    c = ((b ^ 66) ^ (d - a)) & ((d - q) & (a * c));
+  }
+  b = ((p | p) - (b * c)) | ((d - d) ^ (q & a));
+  d = ((q * a) + (c & p)) + ((b * b) ^ (p | p));
+  d = ((a & 63) + (d | a)) * ((c + b) ^ (b - q));
+  for(i = 0; i < 24; i++){
+    b = ((a & 74) ^ (q & q)) - ((q & c) + (a + p));
+  }
+  if(a < b){
+    c = ((a * a) - (p + c)) * ((q ^ d) ^ (q - a));
+  }else{
+    c = ((b | c) & (d & b)) + ((a ^ 22) * (d & b));
+  }
+  b = ((p ^ b) * (d * a)) - ((c * p) | (q + b));
+  a = ((q - 52) - (d * d)) | ((a - q) + (c | d));
+  d = ((q ^ d) - (c | b)) * ((q ^ d) - (q - q));
+  d = ((d | p) ^ (d - 50)) & ((b - p) ^ (d * c));
+  if(a < c){
+    a = ((a + a) ^ (c ^ p)) & ((p * p) * (c + a));
+  }else{
+    b = ((p + p) | (a * 89)) * ((q ^ b) & (c + 30));
+  }
+  for(i = 0; i < 4; i++){
+    d = ((d | 17) * (c & c)) & ((p * d) * (p - b));
+  }
+  b = ((c * c) | (a ^ 24)) & ((d - a) - (d * c));
+  d = ((q - d) & (p ^ a)) ^ ((q + c) | (c ^ 32));
+  d = ((b | 60) | (a * c)) & ((a - b) * (b + q));
+  if(d < d){
+    a = ((p + 32) - (q * d)) ^ ((b ^ b) & (d & a));
+  }else{
+    c = ((b ^ p) | (c - c)) ^ ((p & 44) + (b ^ p));
+  }
+  b = ((c & 94) * (c & p)) | ((p - a) | (p + a));
+  a = ((q + p) | (b & b)) * ((a ^ d) & (c * c));
+  for(i = 0; i < 30; i++){
+    b = ((p ^ 96) & (c + q)) * ((p - d) ^ (c - p));
+  }
+  d = ((b + q) & (a + 99)) | ((p | c) | (c & b));
+  if(b < 94){
+    a = ((d & 26) - (d + 40)) ^ ((a | b) - (b | 95));
+  }else{
+    c = ((p | d) + (p | 19)) | ((p * d) ^ (q - d));
+  }
+  c = ((q + b) | (b + c)) + ((a * q) - (b + p));
+  d = ((q | p) | (d - d)) - ((d * d) + (b - b));
+  d = ((a | d) | (p | p)) + ((d ^ b) + (c | c));
+  b = ((d | q) | (c - 21)) + ((d | q) ^ (q | p));
+  if(a < a){
+    b = ((p & 3) | (b * 69)) & ((a * c) - (a | 21));
+  }else{
+    d = ((p ^ q) - (c | p)) + ((a - q) + (a & p));
+  }
+  c = ((q * q) & (b - a)) & ((p - a) * (c & 62));
+  c = ((q + d) + (a | q)) * ((a & a) + (d ^ b));
+  a = ((a * b) | (a + 29)) & ((p & 79) * (a + d));
+  a = ((p * 97) + (b * b)) ^ ((q ^ d) | (b & b));
+  if(d < q){
+    c = ((q - p) | (d ^ p)) - ((b & 77) ^ (q + a));
+  }else{
+    a = ((c & 79) | (d | p)) | ((b | a) - (p + a));
+  }
+  a = ((d - p) ^ (q ^ 48)) * ((a ^ a) + (c * b));
+  for(i = 0; i < 17; i++){
+    a = ((p + p) & (a + d)) - ((a | 83) * (q ^ a));
+  }
+  d = ((q - 75) ^ (c & 53)) * ((b * d) - (a | b));
+  a = ((a - 44) * (d | 58)) * ((q & c) | (p | q));
+  if(a < d){
+    b = ((q & p) | (c ^ p)) * ((a & d) - (d * a));
+  }else{
+    a = ((a - c) ^ (b ^ 90)) ^ ((p - c) ^ (b - c));
+  }
+  d = ((c | d) | (b & q)) & ((d - p) - (a | 39));
+  b = ((q | c) + (q | q)) ^ ((p + 7) ^ (c ^ 31));
+  c = ((a | q) & (d & a)) - ((d | q) * (a & 25));
+  for(i = 0; i < 31; i++){
+    a = ((d ^ 77) | (p + 38)) ^ ((c - b) + (q ^ 13));
+  }
+  if(d < 97){
+    d = ((d + c) ^ (d + d)) | ((c ^ d) + (c - a));
+  }else{
+    b = ((p + a) | (a | d)) | ((b - p) & (b & a));
+  }
+  return a + b + c + d;
+}
+
+int func26(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 9;
+  d = 60;
+  b = ((q | q) - (b | 10)) + ((c | 33) & (d + q));
+  a = ((b * b) - (p & c)) - ((q + a) & (q * b));
+  a = ((d ^ p) | (q - 65)) + ((p * d) - (a - d));
+  d = ((q | d) + (q & c)) ^ ((c + d) * (c + b));
+  if(b < c){
+    b = ((q & q) + (b ^ b)) + ((d | a) - (b + p));
+  }else{
+    c = ((p & c) - (d ^ c)) + ((p | a) + (d - q));
+  }
+  a = ((q * q) * (q | q)) & ((c + 71) | (a ^ 3));
+  for(i = 0; i < 21; i++){
+    b = ((c & q) - (b * c)) | ((b | 87) - (p & p));
+  }
+  c = ((a & q) & (q & 28)) | ((c ^ q) + (d + c));
+  d = ((d - q) & (c * b)) - ((a | d) - (a + 49));
+  if(b < a){
+    c = ((q - 75) | (a * b)) & ((q - d) - (q + p));
+  }else{
+    d = ((d * q) + (a - 74)) ^ ((q - b) - (d + a));
+  }
+  c = ((q & q) - (c * c)) * ((a - p) & (c + c));
+  d = ((b & q) ^ (p ^ 4)) ^ ((a | b) | (p ^ d));
+  b = ((q + c) - (d ^ 65)) ^ ((a | b) & (p | q));
+  for(i = 0; i < 4; i++){
+    a = ((q & 1) + (p | q)) * ((c + a) - (q ^ d));
+  }
+  if(c < a){
+    a = ((a * p) & (b + p)) + ((q ^ c) * (p + b));
+  }else{
+    b = ((d * p) ^ (b * p)) & ((c * c) - (b * 87));
+  }
+  c = ((d & d) + (q ^ a)) * ((p ^ 2) + (q + 78));
+  d = ((c + 63) - (p ^ c)) - ((d & q) & (c ^ p));
+  b = ((d - c) + (p + d)) ^ ((p & p) | (p | d));
+  c = ((q ^ a) + (b | 12)) ^ ((a ^ 78) & (p | a));
+  if(a < 5){
+    a = ((d - d) - (b ^ q)) + ((q - q) - (p + c));
+  }else{
+    b = ((b & 49) & (d & 63)) & ((b | a) & (d * 77));
+  }
+  for(i = 0; i < 32; i++){
+    c = ((p * q) ^ (a * 4)) + ((d - q) * (q | c));
+  }
+  d = ((q ^ b) | (c * 59)) & ((q ^ q) + (p | 43));
+  c = ((b - q) | (d ^ p)) - ((a + a) & (d | 26));
+  c = ((p | b) | (q & b)) - ((a - q) * (c - d));
+  if(d < q){
+    b = ((a * b) ^ (b + c)) | ((b - 15) - (c & b));
+  }else{
+    c = ((q * 30) ^ (c - a)) & ((c - a) & (q + a));
+  }
+  d = ((p | 94) | (c | 37)) * ((a - q) - (a & a));
+  c = ((p * b) + (b * 81)) * ((a * a) * (p | p));
+  for(i = 0; i < 24; i++){
+    c = ((p * q) - (q * 43)) * ((d + b) * (c * 80));
+  }
+  b = ((q + 59) ^ (b * a)) * ((c - 21) * (d - c));
+  if(d < p){
+    d = ((c * p) ^ (d & q)) & ((p * p) & (p ^ p));
+  }else{
+    b = ((c | d) * (p * b)) | ((b | p) - (p & p));
+  }
+  b = ((b & a) * (p | b)) - ((a & a) | (p * b));
+  d = ((p | 33) & (a - p)) * ((c | b) & (c - b));
+  a = ((c | d) & (a * c)) & ((b * p) | (p ^ a));
+  d = ((p ^ d) + (d & p)) & ((q ^ c) + (q + 26));
+  if(d < d){
+    c = ((b + p) & (c + d)) ^ ((c + q) & (q * 71));
+  }else{
+    b = ((a | p) & (p & d)) & ((d & c) - (c & p));
+  }
+  a = ((b - b) - (c ^ p)) * ((q | 97) + (p * c));
+  b = ((q ^ 5) - (c | b)) + ((d * q) + (p ^ q));
+  c = ((a | c) * (c | d)) * ((c - q) & (q - d));
+  b = ((d - d) & (p | 63)) ^ ((a & c) ^ (q | d));
+  if(d < a){
+    a = ((d - 47) | (d + b)) | ((a * a) + (q | b));
+  }else{
+    b = ((d & p) | (a ^ c)) * ((q & c) | (q - b));
+  }
+  c = ((b - a) & (p & b)) * ((a + p) * (b & c));
+  for(i = 0; i < 25; i++){
+    b = ((a & q) + (c & p)) * ((p | d) + (p & 15));
+  }
+  d = ((b & d) | (a * 51)) * ((c | c) - (d - c));
+  a = ((p - c) & (d + q)) * ((a | a) | (p | d));
+  if(b < b){
+    a = ((a ^ 40) & (d & p)) + ((c + 21) | (q ^ a));
+  }else{
+    d = ((c ^ c) ^ (a * 48)) * ((a ^ c) + (p + 35));
+  }
+  c = ((p + d) & (q - 16)) | ((b + a) & (c + p));
+  a = ((b + p) + (c | 16)) & ((a + p) + (c ^ 99));
+  a = ((d * d) ^ (a & d)) - ((d - 74) & (d * a));
+  for(i = 0; i < 33; i++){
+    a = ((p & 57) & (a | d)) & ((c & q) & (a * q));
+  }
+  if(d < p){
+    c = ((d ^ 4) * (q & c)) & ((c + 60) + (b - b));
+  }else{
+    b = ((p | b) & (q - 47)) | ((p & q) - (a * c));
+  }
+  return a + b + c + d;
+}
+
+int func27(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 91;
+  d = 92;
+  b = ((c - c) + (a & d)) - ((c | q) + (p ^ c));
+  a = ((p ^ a) + (a - a)) - ((a - 15) & (c + c));
+  d = ((q ^ d) + (p & b)) ^ ((q | p) - (q | p));
+  a = ((q - 34) ^ (c & p)) | ((a ^ 58) & (b * p));
+  if(b < 26){
+    a = ((d - a) | (c * d)) + ((c & a) ^ (a | q));
+  }else{
+    c = ((p + 27) ^ (d * a)) + ((p & c) ^ (p | q));
+  }
+  c = ((p + 21) * (c | a)) - ((d - b) ^ (p + a));
+  for(i = 0; i < 12; i++){
+    c = ((q * q) ^ (b - a)) | ((p * p) & (p * c));
+  }
+  d = ((p & q) & (d * 98)) - ((p ^ b) * (q * 49));
+  c = ((a - 66) | (p & q)) | ((d + d) * (c | a));
+  if(b < 73){
+    d = ((p - d) - (q & b)) & ((p & 75) * (a * a));
+  }else{
+    d = ((d ^ c) ^ (p - 40)) | ((q - 29) | (b + d));
+  }
+  a = ((d ^ d) + (c | q)) + ((q ^ c) * (p - q));
+  a = ((b * q) | (c | 2)) - ((d - 7) | (a - p));
+  c = ((p & q) | (c * 92)) + ((b & 37) + (c + a));
+  for(i = 0; i < 40; i++){
+    b = ((b | q) | (a + a)) + ((q + b) & (d + a));
+  }
+  if(d < q){
+    d = ((b & 27) + (b ^ d)) & ((b ^ q) ^ (p + a));
+  }else{
+    b = ((a + 37) ^ (b * a)) * ((a * b) + (c - d));
+  }
+  a = ((p & b) ^ (d + p)) + ((b ^ q) & (a | d));
+  d = ((b + c) - (q * b)) * ((q * a) | (c & c));
+  b = ((c & b) | (c | d)) - ((d * 40) * (q - q));
+  c = ((c * b) ^ (b - 27)) ^ ((p & a) & (q + 56));
+  if(a < p){
+    c = ((q ^ q) * (q & p)) - ((c + 84) ^ (a * b));
+  }else{
+    d = ((c - d) + (q * q)) - ((p * q) - (p - p));
+  }
+  for(i = 0; i < 12; i++){
+    a = ((a - q) * (c + 76)) ^ ((a + 58) | (c - 45));
+  }
+  a = ((d - p) ^ (c - a)) & ((b + q) ^ (d ^ c));
+  a = ((d * 34) * (q * 67)) & ((d ^ p) * (p | a));
+  d = ((p * d) ^ (q + a)) & ((p * c) & (a + c));
+  if(d < a){
+    d = ((q * q) + (d ^ b)) + ((b * b) * (c & 3));
+  }else{
+    b = ((p * q) * (c & 49)) + ((c & 83) & (c & a));
+  }
+  a = ((q - 17) - (p | q)) ^ ((b | c) | (a - 7));
+  c = ((q | p) ^ (d | b)) - ((c ^ c) * (d ^ d));
+  for(i = 0; i < 47; i++){
+    d = ((q + d) + (p & p)) & ((p + c) * (a ^ b));
+  }
+  c = ((p & 71) - (d + c)) - ((d ^ 64) * (p | p));
+  if(c < b){
+    a = ((q + 45) | (d & 9)) | ((p ^ b) * (p - p));
+  }else{
+    a = ((q | d) ^ (b ^ p)) * ((a | q) - (b & b));
+  }
+  d = ((d | q) ^ (p * 41)) * ((d - p) - (c + c));
+  a = ((b + q) & (q - a)) ^ ((d | q) + (a | d));
+  c = ((p | p) | (a + 43)) ^ ((q * a) + (p | c));
+  c = ((d * a) * (d * b)) * ((d | p) + (p + a));
+  if(c < 34){
+    d = ((d & b) ^ (q & d)) + ((c ^ b) & (b & 90));
+  }else{
+    a = ((a | c) * (a * b)) | ((b + d) + (d - a));
+  }
+  a = ((q + d) & (d - q)) & ((a & 62) * (p * b));
+  a = ((q | q) - (d - d)) & ((b | a) * (p ^ p));
+  a = ((b ^ q) * (p - 71)) - ((b * p) * (a - b));
+  a = ((d * a) ^ (a & 80)) | ((c - 3) & (c + 6));
+  if(c < 82){
+    d = ((b ^ 80) * (c + c)) + ((c | q) + (a ^ c));
+  }else{
+    d = ((q ^ d) * (a + c)) | ((d + 42) | (p ^ q));
+  }
+  b = ((d + d) + (c * 32)) - ((c * c) & (q | b));
+  for(i = 0; i < 23; i++){
+    b = ((q | 99) + (a | b)) - ((c & c) ^ (c | p));
+  }
+  c = ((p | c) * (c * d)) - ((b | q) & (q | c));
+  a = ((d * c) & (d ^ d)) * ((b - p) | (c & a));
+  if(a < q){
+    d = ((c - d) & (q + q)) & ((p + b) | (q & a));
+  }else{
+    b = ((q ^ 9) ^ (a & q)) | ((p - a) - (d - b));
+  }
+  a = ((q - 43) & (c - 62)) * ((d * a) & (c ^ 16));
+  a = ((c - d) | (d - c)) * ((c & 64) | (b * 48));
+  a = ((b + p) | (q | a)) ^ ((a | b) ^ (d | q));
+  for(i = 0; i < 46; i++){
+    d = ((d + q) - (d & b)) * ((q | c) * (b & a));
+  }
+  if(b < b){
+    c = ((c & p) & (c & 95)) ^ ((a - d) | (p + 8));
+  }else{
+    a = ((b - c) & (c & d)) & ((p + p) * (a ^ q));
+  }
+  return a + b + c + d;
+}
+
+int func28(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 70;
+  d = 89;
+  a = ((q ^ 58) | (d + 51)) ^ ((q + d) ^ (p & d));
+  b = ((d | d) | (q & p)) ^ ((q + a) + (a & 6));
+  d = ((c ^ d) - (p * 39)) ^ ((d & p) * (d ^ a));
+  d = ((q + 72) ^ (b ^ p)) * ((c + b) ^ (c & c));
+  if(a < p){
+    c = ((a * q) | (b - 71)) ^ ((c + c) + (c - b));
+  }else{
+    a = ((c + p) ^ (p & 26)) - ((a * 88) - (c + c));
+  }
+  c = ((d * q) | (p * a)) | ((d * c) - (d - b));
+  for(i = 0; i < 7; i++){
+    d = ((p ^ d) - (p & q)) * ((q - p) * (d + q));
+  }
+  d = ((d ^ b) | (b - 63)) | ((q & q) - (c - d));
+  b = ((q ^ 8) * (c - c)) ^ ((p & c) | (c - q));
+  if(c < 20){
+    c = ((d + b) - (q - a)) | ((p * 24) & (d - b));
+  }else{
+    d = ((b | a) * (b + b)) & ((p + d) + (q & p));
+  }
+  c = ((q - a) ^ (c ^ p)) & ((c * q) - (b & c));
+  a = ((d * q) & (d ^ a)) & ((a | 70) - (d | 36));
+  b = ((c ^ 26) | (c | q)) | ((q * 17) | (d + p));
+  for(i = 0; i < 49; i++){
+    b = ((b * c) | (d - p)) | ((b & a) ^ (b & q));
+  }
+  if(a < p){
+    b = ((b + d) & (c ^ q)) + ((p ^ a) * (b * b));
+  }else{
+    d = ((c ^ q) ^ (p - d)) ^ ((b - q) & (c ^ d));
+  }
+  d = ((a - p) + (q | a)) | ((c + 44) - (d * 76));
+  d = ((p * b) - (d - 68)) - ((a | b) + (a ^ d));
+  c = ((c | d) + (a - 33)) & ((d ^ 52) * (d | b));
+  b = ((p ^ 77) ^ (c | b)) - ((c ^ 5) + (b * c));
+  if(a < p){
+    b = ((q + c) - (c - 91)) * ((c * p) ^ (b | b));
+  }else{
+    c = ((a - d) & (p & 43)) - ((b | d) + (d & a));
+  }
+  for(i = 0; i < 36; i++){
+    d = ((c | b) ^ (b & 91)) + ((d + q) - (a & p));
+  }
+  c = ((d ^ b) ^ (d * a)) + ((p - c) + (c ^ b));
+  a = ((q | a) | (a & 54)) & ((a * c) + (c - d));
+  b = ((a & a) | (p + p)) + ((c * 97) + (p + q));
+  if(c < a){
+    d = ((d - a) & (a - 69)) & ((c | b) * (c & a));
+  }else{
+    a = ((c - 52) + (p + d)) ^ ((b ^ 30) & (b + c));
+  }
+  a = ((d + a) ^ (p | c)) * ((p & 88) ^ (a | b));
+  d = ((d - p) + (a & 40)) - ((p * p) ^ (c ^ q));
+  for(i = 0; i < 34; i++){
+    c = ((p & d) * (d + a)) - ((a ^ 33) - (c + 62));
+  }
+  b = ((a - 57) | (a ^ q)) ^ ((q * p) + (d | c));
+  if(c < 2){
+    b = ((b * a) - (q - q)) - ((b & c) * (b | b));
+  }else{
+    d = ((a * c) - (q - 72)) - ((p - b) | (q - c));
+  }
+  d = ((p ^ p) * (q + d)) + ((q | q) + (d + p));
+  b = ((d - 27) ^ (a + a)) * ((d | b) + (b + b));
+  a = ((a * 28) * (d ^ q)) * ((c - c) + (d - 34));
+  b = ((c + a) + (d | q)) * ((d - c) & (b & a));
+  if(a < 60){
+    d = ((b * c) | (d - b)) - ((q + a) - (q ^ q));
+  }else{
+    d = ((a + 96) & (b * q)) + ((d + p) - (a * 37));
+  }
+  c = ((b & b) * (p ^ c)) & ((c & c) ^ (p & c));
+  c = ((p ^ 5) | (d + b)) - ((c | d) - (q ^ c));
+  b = ((b + d) + (a | a)) * ((a * c) * (p ^ 98));
+  b = ((b ^ d) ^ (p * p)) + ((c ^ c) & (c ^ 74));
+  if(c < 85){
+    a = ((b - b) + (b | p)) | ((d & 29) ^ (q + 55));
+  }else{
+    b = ((p | c) * (b ^ b)) * ((a + 2) - (b + a));
+  }
+  c = ((b ^ d) | (d - 11)) & ((p | a) | (b - b));
+  for(i = 0; i < 26; i++){
+    a = ((a - b) | (p + d)) - ((q * b) | (b + a));
+  }
+  b = ((d & a) + (c * c)) ^ ((a - p) | (p | a));
+  d = ((d & q) | (b & b)) & ((d + q) - (c * p));
+  if(d < c){
+    c = ((c ^ 4) ^ (q | c)) | ((p * d) & (b - q));
+  }else{
+    c = ((d * c) ^ (p - p)) | ((q - d) | (d ^ 31));
+  }
+  d = ((b & 84) + (d - a)) * ((c + q) & (b - 86));
+  a = ((b * p) ^ (c - d)) * ((b ^ d) & (a + p));
+  b = ((a - q) - (q * q)) & ((d ^ d) - (c * 69));
+  for(i = 0; i < 48; i++){
+    a = ((c * 33) & (q | c)) ^ ((p | b) ^ (b | q));
+  }
+  if(b < c){
+    a = ((c ^ p) | (b - d)) + ((c - 39) * (q + b));
+  }else{
+    b = ((q ^ 78) & (c | a)) * ((q | c) & (q ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func29(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 38;
+  d = 21;
+  a = ((a | d) | (q - q)) * ((c * 29) ^ (q + p));
+  b = ((a ^ q) * (p + c)) * ((d * b) ^ (a | 37));
+  d = ((p ^ a) | (p - 50)) ^ ((q ^ q) ^ (p * q));
+  a = ((p - b) - (p * q)) - ((p | d) + (b + c));
+  if(c < q){
+    c = ((b ^ b) ^ (c - 49)) & ((q * c) + (p * 4));
+  }else{
+    d = ((c | 8) & (p + 25)) * ((d & d) ^ (c - b));
+  }
+  a = ((c ^ 78) | (p & p)) + ((p * p) - (d & c));
+  for(i = 0; i < 22; i++){
+    d = ((p ^ d) & (c * a)) + ((q * d) + (b & p));
+  }
+  d = ((p & 3) - (p & a)) | ((d | p) * (p & a));
+  c = ((p ^ 19) & (q - p)) + ((a + p) * (q & b));
+  if(d < q){
+    d = ((b * b) + (b & q)) - ((a | b) & (c | 33));
+  }else{
+    a = ((p - a) * (d | p)) & ((c * a) - (c * q));
+  }
+  b = ((c - 87) + (p - p)) * ((q + q) * (q ^ d));
+  c = ((c + 97) + (a * b)) - ((c * p) ^ (b * a));
+  a = ((p * q) + (c & a)) - ((q * q) + (a - 1));
+  for(i = 0; i < 27; i++){
+    d = ((b + b) - (d - 53)) ^ ((b - b) ^ (b + d));
+  }
+  if(a < 99){
+    d = ((b | a) ^ (b + a)) ^ ((c & c) ^ (c * p));
+  }else{
+    c = ((p ^ d) + (q ^ q)) + ((p | q) ^ (q & q));
+  }
+  c = ((a * d) & (q + a)) - ((c | a) * (a | 56));
+  d = ((b - q) ^ (c | 61)) & ((b * a) * (b - b));
+  b = ((p + q) ^ (q ^ 23)) + ((c + a) + (a - a));
+  b = ((q - b) - (b ^ c)) * ((a + a) + (a * q));
+  if(a < 14){
+    a = ((b | c) * (a - q)) + ((p + a) + (c - q));
+  }else{
+    c = ((q + q) * (p & c)) & ((a * d) ^ (b | q));
+  }
+  for(i = 0; i < 47; i++){
+    b = ((c + d) + (c + p)) * ((a * 45) & (a ^ 21));
+  }
+  d = ((q & 60) | (q + 70)) - ((c & 70) - (p | 23));
+  c = ((d - a) * (d | 29)) | ((a | a) & (b | p));
+  a = ((a ^ 6) ^ (a & 50)) | ((b + q) + (q & 97));
+  if(b < b){
+    b = ((c | a) | (b + 55)) ^ ((p | q) + (q - 53));
+  }else{
+    b = ((d * 2) + (b * 68)) ^ ((b * b) + (p | a));
+  }
+  a = ((p * d) * (b * 61)) ^ ((d * 68) * (b * 25));
+  a = ((a * p) & (d * b)) ^ ((c & c) - (a & c));
+  for(i = 0; i < 34; i++){
+    b = ((b * p) + (a ^ p)) + ((d * d) - (a * p));
+  }
+  b = ((b & d) - (q ^ p)) | ((a | a) + (p * 32));
+  if(b < p){
+    d = ((q | 45) + (d - a)) * ((d + 59) & (q | p));
+  }else{
+    a = ((q & a) + (q & c)) - ((a + q) - (c + a));
+  }
+  d = ((c | p) - (c ^ a)) + ((c + b) & (a ^ p));
+  d = ((a ^ b) * (a | p)) & ((p + p) ^ (d - 37));
+  d = ((q & a) - (p * b)) ^ ((a - c) ^ (d ^ 43));
+  a = ((b | q) & (p * b)) - ((b - q) ^ (a + q));
+  if(d < p){
+    b = ((c ^ b) - (a | c)) | ((q ^ 86) * (p + 22));
+  }else{
+    a = ((c | 29) & (q - q)) | ((p + 6) ^ (b | c));
+  }
+  d = ((b * b) - (p | 53)) * ((c - 93) | (a & b));
+  a = ((d - d) - (d * 34)) * ((q - 81) * (b ^ d));
+  d = ((b & c) * (d & q)) & ((b + 62) & (q & d));
+  a = ((p & a) | (a ^ d)) * ((a & p) ^ (d - d));
+  if(b < q){
+    c = ((c + c) + (q + 84)) ^ ((a & c) + (d - p));
+  }else{
+    c = ((a ^ d) * (c ^ b)) | ((d & b) | (c * p));
+  }
+  b = ((a ^ b) * (b & d)) * ((b & q) * (a & q));
+  for(i = 0; i < 6; i++){
+    d = ((d + 73) - (d & a)) & ((q + p) ^ (a * q));
+  }
+  c = ((a - 84) + (a ^ q)) + ((q ^ c) | (p + a));
+  b = ((a ^ q) & (c | q)) ^ ((p - p) + (b - 68));
+  if(b < a){
+    a = ((c & 58) - (b | 5)) * ((p * 61) + (c & 27));
+  }else{
+    b = ((p & 57) - (c & a)) & ((p | p) | (d & 33));
+  }
+  d = ((c & p) ^ (q - q)) * ((d | p) & (b ^ b));
+  d = ((q ^ a) ^ (a & 4)) & ((b | c) ^ (a & d));
+  d = ((q - 98) & (q ^ b)) * ((b & 27) + (p ^ c));
+  for(i = 0; i < 50; i++){
+    b = ((c & 8) * (a * a)) & ((q * 1) + (a | d));
+  }
+  if(c < 22){
+    d = ((d | a) * (c - p)) - ((b ^ d) + (c & d));
+  }else{
+    d = ((c + d) ^ (q & p)) + ((b ^ d) - (q | c));
+  }
+  return a + b + c + d;
+}
+
+int func30(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 25;
+  d = 59;
+  a = ((d | d) * (q & p)) | ((p * d) & (q & p));
+  a = ((a & d) & (c ^ d)) & ((c | a) * (p + 35));
+  a = ((d - c) | (p ^ a)) + ((a & p) * (b + 96));
+  b = ((b - a) ^ (q | a)) + ((a * c) & (b - 69));
+  if(a < p){
+    d = ((a - c) - (q + q)) ^ ((p | p) + (q & q));
+  }else{
+    c = ((a & c) | (c & q)) | ((q | q) * (q + q));
+  }
+  b = ((d + c) + (c * c)) * ((q - b) ^ (a ^ p));
+  for(i = 0; i < 18; i++){
+    a = ((b - 7) * (d - a)) + ((d & d) * (c - 38));
+  }
+  d = ((p * a) * (c - c)) | ((a - b) | (a + 25));
+  a = ((p ^ 38) ^ (q * c)) & ((a ^ q) & (b & q));
+  if(c < 19){
+    d = ((a | a) ^ (a + b)) ^ ((p ^ p) & (q & 76));
+  }else{
+    a = ((q - 23) - (d & c)) + ((a * c) | (c | d));
+  }
+  c = ((c - q) ^ (q | c)) - ((p & d) * (d | 12));
+  c = ((b & q) ^ (b ^ p)) | ((p | 39) ^ (c | q));
+  a = ((d + c) & (a & 50)) + ((a ^ 20) - (d | d));
+  for(i = 0; i < 50; i++){
+    d = ((p - p) - (d * p)) + ((q & q) + (d ^ a));
+  }
+  if(b < d){
+    d = ((c & q) * (q + b)) * ((c + 40) - (d | p));
+  }else{
+    b = ((d + q) & (d ^ c)) ^ ((d * p) ^ (d - q));
+  }
+  a = ((c - a) * (p | 79)) * ((q - c) * (p ^ q));
+  a = ((p + c) & (c - 99)) ^ ((a ^ q) + (a - c));
+  d = ((b - 74) - (a | b)) & ((c & q) - (b | b));
+  c = ((c & a) * (q | a)) ^ ((p * 22) - (p * p));
+  if(a < a){
+    a = ((a - d) + (d * p)) * ((d ^ c) * (b * d));
+  }else{
+    d = ((q ^ a) - (q * b)) - ((a & q) & (c * c));
+  }
+  for(i = 0; i < 44; i++){
+    c = ((a ^ p) * (b | q)) ^ ((p ^ c) * (p & p));
+  }
+  a = ((p & b) + (d | q)) - ((b * q) | (p * d));
+  a = ((c - 87) + (c + b)) ^ ((a * b) + (a + a));
+  c = ((c & b) * (b - q)) ^ ((p ^ 37) * (b - 78));
+  if(d < a){
+    c = ((b + 20) | (a ^ b)) | ((p * a) + (q | 9));
+  }else{
+    b = ((c ^ b) - (d | 35)) - ((b | c) & (p - 15));
+  }
+  c = ((q & c) + (q - p)) * ((b - q) | (b ^ a));
+  d = ((q ^ 58) * (q | 20)) + ((q * d) | (a + q));
+  for(i = 0; i < 2; i++){
+    d = ((c * b) | (d - p)) | ((b & a) | (a ^ c));
+  }
+  c = ((b * q) & (b * d)) ^ ((d & 16) - (a + q));
+  if(a < 55){
+    c = ((b & d) - (d + 53)) * ((d & d) - (d * p));
+  }else{
+    a = ((a - 2) - (q - d)) | ((a | a) + (b | q));
+  }
+  c = ((a + d) & (q + d)) - ((q * 58) ^ (p & b));
+  a = ((c - p) - (a ^ d)) | ((p - d) & (b ^ d));
+  b = ((q & 55) ^ (d * 23)) | ((q ^ p) & (a | p));
+  d = ((d ^ p) ^ (q & d)) ^ ((a - 91) + (q | a));
+  if(b < c){
+    b = ((c | b) + (c + q)) | ((a - p) ^ (p - d));
+  }else{
+    c = ((a | c) + (p & d)) + ((a ^ d) + (b ^ 57));
+  }
+  a = ((q - 80) | (b * d)) * ((d | d) & (b & b));
+  a = ((p - b) * (d | 31)) | ((c ^ b) | (q * b));
+  b = ((d + d) + (c * d)) | ((d & d) ^ (a - b));
+  d = ((a | a) * (q * 18)) ^ ((p - 80) | (d | q));
+  if(c < b){
+    a = ((a + b) - (b + 90)) | ((d | a) + (d * a));
+  }else{
+    b = ((d ^ 82) + (c & d)) * ((a - a) - (c & 96));
+  }
+  c = ((d - a) - (q * c)) & ((d | 47) ^ (q - q));
+  for(i = 0; i < 19; i++){
+    d = ((q - b) | (q * q)) ^ ((c & d) & (d * b));
+  }
+  d = ((a & q) + (b * 39)) | ((c * 11) | (d | 1));
+  b = ((a & b) ^ (a * 33)) * ((c + q) | (q & 76));
+  if(c < 59){
+    a = ((b + d) ^ (c * 48)) | ((c + 86) | (c * a));
+  }else{
+    c = ((a * 79) + (a * b)) - ((c - 51) | (p + p));
+  }
+  a = ((b | c) - (p & d)) * ((q ^ b) + (c ^ q));
+  c = ((p * a) & (a & a)) + ((p + c) - (q | d));
+  d = ((c & c) + (c * q)) | ((q + 3) + (a + 60));
+  for(i = 0; i < 17; i++){
+    b = ((d + a) | (q - a)) ^ ((a & d) & (p - c));
+  }
+  if(c < p){
+    c = ((a ^ 82) * (c | 72)) + ((b & 30) * (b + p));
+  }else{
+    c = ((d | p) | (b | c)) & ((p + b) + (b ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func31(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 79;
+  d = 63;
+  c = ((d + 92) + (a | q)) & ((d | c) * (b - d));
+  c = ((p - d) - (q + p)) * ((d & d) ^ (a - c));
+  b = ((q & p) * (a - b)) + ((a ^ d) ^ (b + p));
+  b = ((b & b) - (q * q)) * ((p * d) * (q | q));
+  if(c < p){
+    a = ((d & d) + (d + b)) & ((c & d) ^ (c & d));
+  }else{
+    b = ((c ^ b) & (d ^ c)) | ((p | d) | (q ^ a));
+  }
+  a = ((p | c) + (d & p)) & ((q + 41) & (a + a));
+  for(i = 0; i < 14; i++){
+    a = ((d ^ p) * (b - c)) | ((b & c) * (b & b));
+  }
+  c = ((q & c) ^ (b - d)) | ((c + 45) & (q | d));
+  b = ((a & c) + (a ^ c)) * ((d * b) + (b & p));
+  if(b < p){
+    b = ((b + b) & (b * d)) ^ ((d + q) & (c * c));
+  }else{
+    d = ((d - b) - (c - a)) & ((c - 11) * (d ^ 78));
+  }
+  a = ((d ^ 77) * (d * 36)) * ((c | q) ^ (d & d));
+  c = ((b | 85) * (p + c)) - ((c | 12) + (c | p));
+  a = ((d * c) - (a ^ p)) * ((p ^ c) + (a - q));
+  for(i = 0; i < 39; i++){
+    b = ((d + a) - (p + d)) - ((p & q) & (p ^ b));
+  }
+  if(c < q){
+    a = ((b - 70) ^ (q & b)) - ((d - p) & (d + d));
+  }else{
+    a = ((q - q) * (a + 29)) | ((q - q) - (b | a));
+  }
+  a = ((b + 93) | (b | q)) & ((q + a) | (p + q));
+  d = ((a | d) * (d & 83)) ^ ((p * a) | (q | a));
+  d = ((q | p) - (a * 49)) | ((b & 44) & (b - 42));
+  d = ((d + 58) | (a * b)) ^ ((d & a) ^ (d | q));
+  if(b < c){
+    c = ((q + p) + (d ^ d)) - ((a - p) + (a ^ q));
+  }else{
+    c = ((c - q) | (q + 6)) * ((p ^ 29) & (d & 52));
+  }
+  for(i = 0; i < 35; i++){
+    d = ((q & 46) - (p & a)) * ((q * 20) * (a | p));
+  }
+  c = ((a * q) ^ (d - p)) * ((p * b) * (a + p));
+  c = ((p ^ p) ^ (a + 38)) | ((d | c) & (p - a));
+  b = ((c + c) * (c ^ q)) - ((c - d) & (p & b));
+  if(b < 35){
+    d = ((q & q) - (q - 11)) ^ ((d ^ q) * (a & 42));
+  }else{
+    d = ((d & d) + (c & 71)) & ((c + d) | (q & 78));
+  }
+  b = ((d - b) - (p * p)) & ((d * a) * (c - q));
+  a = ((p + 64) * (q | b)) ^ ((q & 74) ^ (q | a));
+  for(i = 0; i < 37; i++){
+    d = ((p & a) & (a ^ q)) - ((a ^ 71) ^ (c ^ b));
+  }
+  b = ((d | q) - (b ^ c)) & ((a + 11) - (q - d));
+  if(d < b){
+    c = ((q | 56) ^ (b | c)) & ((p - 10) ^ (b ^ p));
+  }else{
+    c = ((q + 61) + (d - q)) | ((q + d) ^ (c ^ p));
+  }
+  c = ((c & b) * (p - p)) ^ ((p + 80) | (p & c));
+  a = ((q + d) & (d ^ q)) & ((a * 74) & (p ^ 13));
+  d = ((q ^ d) - (d & d)) | ((d * 9) ^ (a - a));
+  c = ((b ^ 7) | (q - p)) | ((d | 94) - (b & d));
+  if(c < 5){
+    b = ((q * c) + (b + a)) | ((b - a) + (p - a));
+  }else{
+    a = ((a - b) ^ (p ^ q)) | ((d * b) - (a - p));
+  }
+  d = ((b * a) ^ (p ^ b)) + ((d | b) * (q * c));
+  c = ((d + p) | (q ^ a)) - ((p * q) + (c ^ c));
+  b = ((a ^ b) | (d * q)) - ((b * a) - (p & 54));
+  a = ((q ^ p) ^ (d ^ b)) & ((p | 58) * (q & q));
+  if(a < q){
+    a = ((q - a) & (q + 99)) - ((b * b) | (p ^ c));
+  }else{
+    b = ((b | b) ^ (q | b)) | ((c * 36) & (p ^ 25));
+  }
+  a = ((q * p) | (q + a)) - ((b * 6) - (d + 83));
+  for(i = 0; i < 25; i++){
+    b = ((c ^ p) + (q * p)) | ((d * b) + (p - p));
+  }
+  d = ((d & c) & (q - q)) - ((p - d) & (d & b));
+  d = ((q & q) - (a | d)) & ((p & b) * (c - c));
+  if(c < p){
+    d = ((c | 63) - (c + b)) + ((p * b) & (c + c));
+  }else{
+    c = ((a * b) & (a ^ b)) | ((p - b) * (q * d));
+  }
+  b = ((b * d) & (d & d)) | ((p & b) | (d & b));
+  c = ((q & a) & (q ^ a)) * ((q * c) & (q + c));
+  a = ((p | q) + (q - a)) & ((d & q) + (d - 99));
+  for(i = 0; i < 36; i++){
+    a = ((p ^ c) | (c & p)) + ((a ^ a) | (b & c));
+  }
+  if(a < b){
+    b = ((q ^ a) ^ (b & p)) + ((p + b) * (q ^ 7));
+  }else{
+    d = ((p - a) & (c | 88)) - ((b & p) ^ (b | a));
+  }
+  return a + b + c + d;
+}
+
+int func32(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 76;
+  d = 49;
+  b = ((d - d) * (d & c)) | ((d * a) | (p - a));
+  d = ((q - 22) - (c ^ a)) | ((p * 90) | (d - p));
+  b = ((p - q) & (p & c)) * ((q + b) ^ (b * 40));
+  a = ((b & 53) & (c & c)) - ((d - b) * (b * c));
+  if(d < c){
+    c = ((c + c) + (b + q)) ^ ((p * q) * (q | d));
+  }else{
+    b = ((b * 36) - (p & 57)) - ((c | b) * (d + b));
+  }
+  d = ((d & d) - (a * p)) ^ ((b ^ b) + (q + a));
+  for(i = 0; i < 34; i++){
+    b = ((c | 9) ^ (d | 22)) + ((c & c) - (d + a));
+  }
+  a = ((d + q) + (c & b)) & ((q - q) ^ (b ^ q));
+  d = ((a | c) + (p ^ a)) & ((p ^ a) + (a - b));
+  if(d < a){
+    b = ((p ^ q) - (p + a)) & ((d & q) ^ (b + 68));
+  }else{
+    b = ((d & d) - (b * p)) ^ ((c + p) | (p + d));
+  }
+  d = ((b + 4) + (d * q)) + ((q & a) + (q & 49));
+  c = ((p ^ p) & (p * a)) * ((p ^ b) & (b - 12));
+  a = ((a & p) * (p | q)) - ((c - p) + (b & b));
+  for(i = 0; i < 42; i++){
+    d = ((p ^ 6) + (d - p)) - ((b - d) | (b | b));
+  }
+  if(b < p){
+    d = ((b * 48) * (c ^ p)) - ((a + 86) + (d * d));
+  }else{
+    b = ((c * p) & (b ^ p)) * ((d + 1) + (a | c));
+  }
+  d = ((d ^ a) * (p * 39)) - ((p - b) ^ (b * 84));
+  a = ((d | d) - (c ^ d)) & ((q + d) & (c ^ a));
+  b = ((a + 37) + (a | a)) * ((a ^ 18) ^ (d & 13));
+  c = ((a + q) + (a + 36)) - ((c - 53) * (c - d));
+  if(c < c){
+    c = ((c * 5) * (a + p)) ^ ((d + a) + (b * c));
+  }else{
+    a = ((p + p) ^ (c + 7)) | ((q + a) & (c ^ d));
+  }
+  for(i = 0; i < 46; i++){
+    b = ((b - a) + (b - q)) & ((p ^ 4) - (p - b));
+  }
+  d = ((d & 88) - (q & a)) ^ ((d | 55) - (b - b));
+  c = ((a ^ b) | (b + p)) & ((p * 19) ^ (d | a));
+  c = ((q + c) & (p & 9)) | ((c + p) | (p & c));
+  if(b < q){
+    b = ((q - 12) | (d ^ c)) | ((c - 64) & (p + a));
+  }else{
+    c = ((p - 28) - (q - 91)) - ((d ^ 9) * (d | b));
+  }
+  a = ((d | b) * (p - q)) + ((p & p) | (d + q));
+  c = ((p ^ p) - (a ^ 45)) ^ ((c ^ d) * (p ^ 28));
+  for(i = 0; i < 2; i++){
+    b = ((b + c) | (q + d)) & ((d * d) & (a ^ q));
+  }
+  d = ((b * c) + (d - b)) - ((d ^ c) - (d * p));
+  if(b < a){
+    c = ((c & 55) ^ (c & 93)) * ((c | d) - (b | q));
+  }else{
+    b = ((d ^ c) - (c - b)) + ((d | d) + (q - d));
+  }
+  d = ((c & q) + (c ^ c)) * ((b * b) * (q ^ 19));
+  a = ((d ^ c) | (p ^ 91)) & ((d | 26) * (d & d));
+  b = ((p & a) & (d ^ a)) | ((b * d) + (d & d));
+  b = ((p | a) + (p & c)) - ((c - a) + (c * b));
+  if(c < p){
+    b = ((p ^ b) & (a - 42)) * ((d ^ d) | (p - c));
+  }else{
+    b = ((b + a) & (p & 61)) ^ ((a * 69) + (d - c));
+  }
+  b = ((d - p) - (a ^ q)) & ((d - p) ^ (q * p));
+  b = ((a & q) * (q | 16)) ^ ((c - b) * (a - c));
+  b = ((d * p) - (b & q)) * ((a * 72) - (c * 46));
+  b = ((d & q) - (b + d)) | ((b * p) | (c | p));
+  if(b < 11){
+    a = ((d * d) * (d * d)) ^ ((d & b) * (d & 62));
+  }else{
+    a = ((q - 93) ^ (a * c)) | ((c + 34) ^ (c ^ q));
+  }
+  d = ((c - c) * (q * c)) ^ ((a & c) * (d - q));
+  for(i = 0; i < 18; i++){
+    c = ((c * 59) & (c ^ d)) & ((a + d) * (b * d));
+  }
+  a = ((b + q) ^ (d * p)) * ((a & 94) & (a * a));
+  a = ((d * 14) ^ (d ^ 27)) | ((d | p) ^ (d | b));
+  if(a < c){
+    a = ((d | 21) + (q + 58)) | ((a + b) ^ (p + a));
+  }else{
+    a = ((a & q) * (b | 66)) | ((q * c) & (a | c));
+  }
+  d = ((c ^ p) + (b * p)) - ((q + q) + (p * p));
+  b = ((a & 92) ^ (p + a)) | ((c * q) | (b | c));
+  d = ((d ^ q) + (b ^ 47)) + ((d + 70) & (a ^ d));
+  for(i = 0; i < 42; i++){
+    d = ((a - 44) - (p & a)) - ((p + b) & (q | b));
+  }
+  if(b < d){
+    a = ((p | c) & (a ^ d)) - ((c & p) * (q - c));
+  }else{
+    d = ((q & b) & (p - d)) | ((p + 49) * (c | q));
+  }
+  return a + b + c + d;
+}
+
+int func33(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 24;
+  d = 81;
+  d = ((a * p) - (q * a)) & ((q + d) ^ (c * 83));
+  c = ((b + b) - (b * a)) + ((c ^ d) & (p + d));
+  d = ((q - 32) + (b & 50)) * ((d & 48) - (p & q));
+  c = ((b + 72) + (p - b)) ^ ((p - 12) * (p & b));
+  if(b < 64){
+    b = ((d ^ c) | (b * d)) + ((c & a) + (c & a));
+  }else{
+    d = ((b | p) + (b | q)) + ((p + 45) & (c & a));
+  }
+  a = ((a - 11) + (d * p)) & ((c | 96) + (a - p));
+  for(i = 0; i < 34; i++){
+    a = ((b ^ b) * (b & b)) & ((d * d) | (c ^ c));
+  }
+  c = ((c | c) & (p | b)) + ((q | 42) * (c + b));
+  b = ((d * 33) | (d * c)) + ((c - p) ^ (b ^ a));
+  if(b < 3){
+    a = ((p | b) ^ (b ^ d)) * ((b - 91) & (b ^ c));
+  }else{
+    a = ((q ^ d) + (p | d)) - ((d | p) * (d + q));
+  }
+  d = ((q | b) & (b + d)) ^ ((a | q) & (c - c));
+  a = ((a + 70) - (q & b)) ^ ((a ^ p) * (d ^ d));
+  a = ((c - 86) - (c - q)) | ((q * c) | (a + q));
+  for(i = 0; i < 27; i++){
+    d = ((a & q) * (b | d)) - ((q - b) * (c & q));
+  }
+  if(a < q){
+    d = ((d & 97) - (a + q)) | ((d | c) * (c | p));
+  }else{
+    c = ((c * c) - (c | 30)) - ((c | 37) ^ (a + 95));
+  }
+  d = ((d & 86) | (q - c)) ^ ((p | 92) ^ (d & d));
+  c = ((q * q) + (d & d)) & ((q & p) * (d + q));
+  a = ((q + b) & (p - q)) + ((a | b) ^ (b + c));
+  b = ((q | c) - (c - p)) ^ ((b | d) | (p * a));
+  if(d < q){
+    a = ((a & b) & (d & 56)) | ((p ^ c) | (a | d));
+  }else{
+    d = ((c ^ p) | (d | c)) | ((q | p) * (c & q));
+  }
+  for(i = 0; i < 18; i++){
+    a = ((d - 24) * (p | 49)) * ((b * p) ^ (b + b));
+  }
+  b = ((p * c) ^ (b | p)) - ((p & c) * (q | a));
+  d = ((a * 36) ^ (q + 65)) & ((b & a) ^ (c ^ 61));
+  d = ((p * b) - (q | a)) | ((q ^ q) ^ (p - p));
+  if(a < 84){
+    c = ((q * 62) | (d | d)) * ((c ^ a) | (p - p));
+  }else{
+    a = ((a + c) ^ (q | b)) & ((c | 79) * (c - a));
+  }
+  b = ((d * 65) ^ (a ^ a)) * ((d & b) + (b + d));
+  a = ((b ^ 31) - (a - c)) * ((d ^ p) - (c & q));
+  for(i = 0; i < 41; i++){
+    b = ((b - p) + (b | 36)) - ((b | 97) + (a - p));
+  }
+  d = ((c & p) * (c ^ 57)) ^ ((q & b) - (a * 36));
+  if(d < p){
+    b = ((q - c) - (b * p)) * ((c + 65) | (c * c));
+  }else{
+    b = ((d - b) | (a & b)) | ((d + b) ^ (b ^ b));
+  }
+  b = ((q + a) - (q ^ 88)) - ((q | p) ^ (p | 48));
+  c = ((c & c) + (q & b)) * ((p ^ 1) & (b & d));
+  b = ((p * p) ^ (b & b)) + ((c - 18) * (c ^ b));
+  a = ((c & d) * (d + a)) ^ ((b * 20) & (b & 35));
+  if(d < 89){
+    a = ((q + p) * (b & p)) + ((d | q) + (q * b));
+  }else{
+    a = ((d & c) & (d * 87)) - ((c ^ d) + (d * 82));
+  }
+  a = ((b | 73) + (d - c)) ^ ((a + 55) ^ (q | 34));
+  b = ((p | q) ^ (b - d)) - ((p | b) - (b - b));
+  a = ((d + c) ^ (b - q)) ^ ((c & 37) | (p & p));
+  c = ((q | a) - (d * q)) + ((c & d) & (p ^ p));
+  if(d < b){
+    a = ((c - b) + (c * b)) - ((p * 67) + (c & q));
+  }else{
+    a = ((c - p) * (q | 29)) * ((c | 29) ^ (q + b));
+  }
+  d = ((p + q) & (q | q)) - ((p * q) - (c - b));
+  for(i = 0; i < 39; i++){
+    b = ((p ^ 55) ^ (c - 57)) | ((b + q) - (q | d));
+  }
+  c = ((c & c) * (d ^ 39)) + ((b - c) & (b + c));
+  c = ((a + p) + (d ^ 97)) ^ ((b ^ d) ^ (c | q));
+  if(b < b){
+    a = ((q * p) ^ (b - a)) + ((b + q) - (q ^ 58));
+  }else{
+    d = ((d ^ b) & (d * 25)) + ((p | p) & (p * a));
+  }
+  d = ((q * d) + (a + c)) | ((q - a) ^ (a + 61));
+  a = ((b ^ p) & (a | d)) | ((c - d) + (a + 84));
+  d = ((d - 66) & (q & d)) - ((q - a) - (b | c));
+  for(i = 0; i < 20; i++){
+    d = ((q - b) + (d ^ 76)) - ((a & a) ^ (p - c));
+  }
+  if(d < c){
+    d = ((c | c) - (p + 13)) & ((a & d) & (d ^ 46));
+  }else{
+    b = ((b * 54) | (q - b)) + ((c + c) ^ (d | c));
+  }
+  return a + b + c + d;
+}
+
+int func34(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 11;
+  d = 92;
+  b = ((c + 61) * (a ^ 52)) - ((p ^ a) & (a * b));
+  d = ((q - b) | (a * 99)) & ((p ^ q) | (q & 47));
+  b = ((p | a) & (p & a)) & ((q + 1) ^ (c & a));
+  b = ((c | q) & (b * c)) - ((c + d) | (a & c));
+  if(b < c){
+    c = ((b ^ c) - (d | a)) & ((a & a) - (q * b));
+  }else{
+    c = ((d - b) | (d ^ q)) + ((c - b) | (p * 92));
+  }
+  b = ((a * 12) & (d - q)) + ((a & q) | (a | q));
+  for(i = 0; i < 37; i++){
+    b = ((b & c) + (d | b)) | ((q | d) | (q & b));
+  }
+  c = ((a * 84) - (p ^ b)) ^ ((q + 28) | (b & q));
+  b = ((a + p) * (b ^ 66)) & ((c + p) | (p - d));
+  if(a < 51){
+    c = ((c & 19) & (q + d)) & ((b - c) + (q | a));
+  }else{
+    d = ((a - 35) - (b + c)) | ((d * a) | (a * d));
+  }
+  c = ((q & p) + (d | q)) - ((a ^ a) | (c ^ c));
+  d = ((a ^ q) ^ (q * q)) * ((c & q) & (p + 47));
+  c = ((d & d) & (d * 15)) + ((d & 43) & (q * 56));
+  for(i = 0; i < 49; i++){
+    d = ((p & 20) * (p + a)) + ((p | 99) ^ (b & 74));
+  }
+  if(a < c){
+    c = ((d | a) & (b | 55)) | ((a - p) ^ (c + 28));
+  }else{
+    a = ((d | d) ^ (q | b)) - ((c - b) ^ (b * q));
+  }
+  a = ((b * a) * (p * 82)) - ((b | c) - (c - d));
+  a = ((c | c) ^ (c | 75)) & ((b - p) - (d - p));
+  c = ((p | a) | (c + d)) * ((q - b) & (b + 14));
+  c = ((d * q) & (q * 50)) - ((p - p) - (c | 24));
+  if(a < b){
+    d = ((q | d) - (d - q)) * ((p + 25) & (a | q));
+  }else{
+    d = ((p * b) & (c & a)) * ((c | p) + (d + p));
+  }
+  for(i = 0; i < 46; i++){
+    a = ((b * q) - (d & 18)) + ((d ^ 20) & (b ^ 17));
+  }
+  c = ((q | b) & (a & p)) * ((c | a) ^ (q + p));
+  a = ((p * 64) | (p ^ c)) - ((a - p) ^ (q & c));
+  b = ((d & 75) * (a + c)) + ((p & b) & (q + a));
+  if(c < 54){
+    b = ((c & d) * (p ^ q)) & ((q + 65) + (a & b));
+  }else{
+    a = ((b ^ p) | (c - a)) ^ ((p + q) - (d - c));
+  }
+  d = ((b * 72) - (a & b)) ^ ((c - 67) * (b * p));
+  c = ((p * q) - (b - p)) & ((d | p) - (d + p));
+  for(i = 0; i < 17; i++){
+    c = ((b + p) ^ (q - d)) * ((a ^ p) - (b - p));
+  }
+  d = ((c + b) ^ (c | 27)) * ((c & 78) * (c * d));
+  if(b < 16){
+    c = ((b | c) ^ (d & p)) | ((d * a) & (p + q));
+  }else{
+    d = ((c & b) | (q & a)) * ((q * 78) & (c + p));
+  }
+  b = ((c + b) - (q * d)) - ((a * 94) & (q - 2));
+  c = ((d * c) + (p + a)) ^ ((c | p) + (d - 72));
+  c = ((c | d) * (q - 16)) | ((c + c) | (q + p));
+  c = ((c & d) - (b ^ c)) * ((d - 23) + (q * b));
+  if(c < 11){
+    a = ((p + c) * (q ^ d)) | ((a * 50) | (d | a));
+  }else{
+    b = ((b ^ b) ^ (a * q)) & ((d * c) - (a - d));
+  }
+  b = ((a & q) ^ (c & 82)) - ((b * d) * (d & c));
+  c = ((c + a) - (a ^ 90)) & ((b + 61) * (c * d));
+  b = ((c - 46) - (a + a)) | ((a & p) + (b + b));
+  a = ((p ^ 19) - (a | p)) ^ ((q ^ 80) * (a ^ q));
+  if(a < q){
+    b = ((d & b) | (p + c)) - ((d | a) | (q ^ 75));
+  }else{
+    d = ((c | 81) & (d & 91)) | ((c + p) * (p & 71));
+  }
+  b = ((c * p) ^ (p - 21)) * ((a | d) * (b * p));
+  for(i = 0; i < 5; i++){
+    d = ((p - d) | (c * p)) & ((a + c) ^ (a * 25));
+  }
+  a = ((q & a) + (a | c)) | ((q * a) | (c | q));
+  c = ((a ^ 9) + (c + a)) & ((c + d) + (a - d));
+  if(c < d){
+    c = ((b ^ c) - (d & 26)) * ((p | c) & (c & q));
+  }else{
+    c = ((c * p) - (b ^ p)) - ((a | c) * (p * 54));
+  }
+  a = ((b | q) ^ (a * a)) - ((p - d) * (c | b));
+  d = ((q & 21) * (q & 23)) + ((q * p) | (p | 61));
+  a = ((b | c) & (q + b)) & ((b - c) - (a * a));
+  for(i = 0; i < 7; i++){
+    a = ((b | d) * (b - q)) ^ ((a ^ a) ^ (q * d));
+  }
+  if(c < 9){
+    d = ((b + b) * (a & 66)) ^ ((d + q) * (c | b));
+  }else{
+    b = ((q ^ c) | (c ^ b)) & ((c & c) ^ (a & d));
+  }
+  return a + b + c + d;
+}
+
+int func35(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 64;
+  d = 47;
+  c = ((d * c) - (b ^ 10)) + ((a & c) ^ (d & q));
+  b = ((p | b) ^ (c - 37)) * ((p | b) | (c ^ d));
+  a = ((p * q) | (p - c)) & ((a + p) & (c & 17));
+  d = ((b | a) ^ (a - a)) & ((q - c) - (c - a));
+  if(d < p){
+    d = ((c & 78) + (p | 81)) + ((q + q) ^ (a * a));
+  }else{
+    b = ((a * 23) ^ (b ^ c)) * ((d + d) + (b + d));
+  }
+  b = ((q - c) * (b + q)) & ((p & p) | (a ^ d));
+  for(i = 0; i < 49; i++){
+    a = ((d | c) ^ (b - b)) ^ ((p | 79) + (p | c));
+  }
+  d = ((b | d) & (d | c)) & ((c - c) & (a * d));
+  a = ((b | a) | (d | d)) + ((q ^ p) * (b | p));
+  if(c < p){
+    c = ((a ^ a) * (q + p)) | ((b ^ q) ^ (p & c));
+  }else{
+    c = ((b - b) & (p | q)) + ((p ^ a) + (c + b));
+  }
+  a = ((q - a) ^ (q * c)) * ((d & 96) - (q * 47));
+  a = ((a + b) | (b - c)) * ((d ^ 21) ^ (a | a));
+  b = ((d - q) | (b * b)) * ((b * c) | (c * d));
+  for(i = 0; i < 37; i++){
+    c = ((q + 88) | (d | d)) | ((p ^ b) ^ (q ^ 89));
+  }
+  if(d < c){
+    d = ((c * q) * (d - q)) + ((c | b) ^ (c ^ b));
+  }else{
+    d = ((d & q) + (d - p)) + ((a * 73) * (a + 9));
+  }
+  d = ((d & c) ^ (p & a)) ^ ((d & a) | (d & p));
+  d = ((a ^ b) | (b & p)) | ((c - a) ^ (q + 78));
+  b = ((c ^ b) & (q & a)) - ((q + b) | (a + p));
+  b = ((c ^ b) + (d | 45)) ^ ((b ^ b) ^ (p * a));
+  if(c < a){
+    c = ((b & a) * (c | c)) & ((d | b) | (b + a));
+  }else{
+    d = ((p * b) - (a & 2)) ^ ((b - 38) & (d * c));
+  }
+  for(i = 0; i < 33; i++){
+    d = ((a + a) + (p - q)) + ((p & b) * (d * a));
+  }
+  c = ((d ^ 27) | (p ^ a)) ^ ((d & q) ^ (p * 89));
+  b = ((p - a) | (p + 89)) & ((p * d) | (c | a));
+  d = ((c + c) * (b | 6)) | ((a + d) ^ (q - d));
+  if(a < c){
+    d = ((q & p) ^ (b & d)) + ((d ^ c) & (d - 63));
+  }else{
+    c = ((b + b) * (d - 17)) | ((a | c) - (c & d));
+  }
+  d = ((p + a) & (c | p)) - ((q | p) + (b * d));
+  c = ((d ^ a) | (a + 41)) & ((p + a) ^ (b - b));
+  for(i = 0; i < 23; i++){
+    a = ((p + a) | (a | p)) * ((q | d) & (c - c));
+  }
+  a = ((b ^ 85) * (d ^ b)) + ((b * c) + (c + 39));
+  if(c < 73){
+    c = ((d * b) + (q & a)) * ((q ^ 72) * (b - a));
+  }else{
+    d = ((d ^ c) | (p - 99)) * ((b * p) + (p + 69));
+  }
+  c = ((q & p) | (d * d)) - ((c + a) | (b * p));
+  c = ((d - c) ^ (b * q)) + ((q | p) * (a * 81));
+  d = ((a ^ q) - (c | b)) + ((q & d) * (c - d));
+  a = ((c + q) ^ (b | b)) & ((b * p) * (c * a));
+  if(a < 11){
+    c = ((a | 16) * (q - p)) ^ ((c ^ b) | (p & b));
+  }else{
+    b = ((d & 3) & (c | 59)) + ((b ^ q) * (d + p));
+  }
+  d = ((q * b) & (a - a)) - ((p | a) | (p + c));
+  c = ((p + c) - (c ^ d)) & ((q - q) | (d - p));
+  a = ((q * c) + (a * p)) - ((q + c) - (b ^ 98));
+  d = ((d | b) | (a & 45)) & ((p | 61) + (b - 87));
+  if(a < 89){
+    d = ((d + c) + (c | a)) & ((b + 71) + (a | 66));
+  }else{
+    c = ((a & 99) | (q - d)) * ((c + b) - (c & b));
+  }
+  b = ((a | q) + (q * 97)) - ((q + 42) ^ (p & c));
+  for(i = 0; i < 45; i++){
+    d = ((p * 81) & (b & b)) + ((c & p) ^ (q - d));
+  }
+  a = ((a ^ a) ^ (p + q)) ^ ((b - c) & (c | b));
+  d = ((b - p) | (q + q)) | ((p + 33) ^ (q + c));
+  if(b < d){
+    d = ((p - c) + (q ^ p)) * ((p ^ b) ^ (p - d));
+  }else{
+    c = ((q + b) * (b | b)) - ((p & 49) - (p ^ a));
+  }
+  b = ((d + 69) ^ (c ^ q)) | ((d & p) * (q + d));
+  c = ((a - d) * (a + c)) | ((a - a) - (c ^ b));
+  a = ((q + q) - (p - d)) + ((d & p) * (c + d));
+  for(i = 0; i < 36; i++){
+    a = ((c - b) + (q + q)) | ((a + b) & (q + a));
+  }
+  if(c < 94){
+    d = ((c + a) ^ (b + 56)) * ((b ^ p) & (p * b));
+  }else{
+    c = ((d + 14) & (b ^ b)) - ((a & q) - (p & b));
+  }
+  return a + b + c + d;
+}
+
+int func36(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 52;
+  d = ((a - 50) ^ (c + c)) - ((a * 65) + (p + 44));
+  d = ((b ^ 80) & (q * c)) & ((c + q) ^ (b - d));
+  a = ((b * 90) - (p * 14)) & ((b & a) & (c | p));
+  c = ((c - 40) & (a + 88)) ^ ((d + c) - (p & a));
+  if(a < 37){
+    c = ((a + d) * (d & 76)) | ((d ^ q) ^ (q | 94));
+  }else{
+    c = ((d | p) - (c * c)) & ((b + q) | (b & q));
+  }
+  d = ((p ^ a) | (p - p)) | ((c & c) | (b | b));
+  for(i = 0; i < 7; i++){
+    d = ((p - d) - (d ^ d)) - ((a ^ 38) - (q & 83));
+  }
+  a = ((a - q) & (c ^ b)) * ((c + q) * (c * a));
+  d = ((d & a) - (p | c)) ^ ((c & a) & (d | q));
+  if(c < a){
+    a = ((q & c) - (d + c)) & ((d + 87) ^ (d + 69));
+  }else{
+    c = ((a ^ a) - (c * p)) + ((q | a) & (p + d));
+  }
+  a = ((p * a) * (d + 6)) | ((c & 13) & (b | 36));
+  d = ((q ^ q) & (q - a)) | ((c * b) | (b - 37));
+  c = ((d & q) | (d ^ p)) * ((b & 92) - (p - 53));
+  for(i = 0; i < 44; i++){
+    d = ((q ^ 74) + (d & d)) & ((d & d) & (d & 16));
+  }
+  if(b < q){
+    c = ((a - 79) * (a | b)) - ((b ^ c) * (q + d));
+  }else{
+    a = ((q & d) ^ (a * 21)) | ((b - q) ^ (c + a));
+  }
+  a = ((q - q) & (c - p)) + ((b | c) - (p + 36));
+  b = ((b - 46) | (p ^ a)) + ((q | d) - (b | q));
+  d = ((a ^ a) * (q * 75)) * ((c & a) ^ (p + q));
+  d = ((q ^ q) | (c & 48)) & ((c * a) + (q ^ b));
+  if(d < 47){
+    c = ((q | d) ^ (d * a)) + ((b - 62) * (b | b));
+  }else{
+    a = ((a | b) | (q * 27)) * ((b + q) & (a + p));
+  }
+  for(i = 0; i < 14; i++){
+    d = ((b ^ 46) | (p ^ c)) * ((a * b) ^ (a | d));
+  }
+  b = ((c - c) + (q | 77)) - ((b - a) + (q - d));
+  c = ((b | q) + (p * a)) - ((c & b) & (p & d));
+  b = ((q - 79) & (b * 11)) ^ ((p + 90) | (q + 52));
+  if(b < 9){
+    b = ((q & p) & (q - q)) | ((p + a) ^ (b | p));
+  }else{
+    c = ((q ^ a) | (q + p)) | ((c | p) & (d ^ a));
+  }
+  a = ((a ^ a) | (c + b)) & ((q - 23) - (c | 46));
+  d = ((p * d) ^ (p | d)) + ((b * b) ^ (d + a));
+  for(i = 0; i < 44; i++){
+    c = ((p + b) | (p + c)) - ((d - c) & (b + c));
+  }
+  d = ((c & c) | (c ^ d)) & ((b | a) & (d + b));
+  if(d < c){
+    b = ((q - 49) ^ (q * c)) ^ ((a | b) * (b ^ a));
+  }else{
+    c = ((q - q) ^ (b & c)) + ((d ^ 79) + (q & 98));
+  }
+  b = ((c + 41) - (d ^ a)) * ((a + d) - (a & p));
+  c = ((p & c) | (p - d)) ^ ((d * c) * (d ^ b));
+  a = ((q ^ a) | (q ^ b)) & ((p * c) | (d & b));
+  b = ((d | c) & (a - 67)) * ((b + d) & (b ^ c));
+  if(a < 7){
+    b = ((p & b) - (a * c)) + ((d ^ d) + (a & p));
+  }else{
+    b = ((c + 32) * (p | 5)) - ((p | 23) + (q & q));
+  }
+  c = ((c + a) * (b & b)) * ((a * 42) + (a - 3));
+  a = ((d * p) - (d + d)) * ((c | d) * (p - a));
+  c = ((c * p) | (p ^ 20)) - ((d * 3) + (c + q));
+  b = ((q - b) & (p & 89)) - ((p - c) + (a & b));
+  if(c < p){
+    c = ((d + p) * (a ^ q)) + ((b ^ d) | (d * b));
+  }else{
+    c = ((d & p) | (p * 8)) | ((a ^ c) + (a & q));
+  }
+  b = ((d + p) * (a * d)) - ((b - q) - (b ^ 97));
+  for(i = 0; i < 25; i++){
+    b = ((c ^ c) ^ (p + p)) * ((d * p) ^ (b - a));
+  }
+  b = ((d ^ 45) + (b - c)) - ((c ^ 57) | (p ^ q));
+  b = ((q ^ a) + (d * p)) ^ ((d ^ b) & (p | b));
+  if(d < b){
+    a = ((d ^ 10) | (q + c)) & ((d ^ 15) - (b | 20));
+  }else{
+    c = ((p | 60) ^ (p * a)) ^ ((b * q) * (c | a));
+  }
+  a = ((p ^ 75) & (c & c)) - ((b ^ c) - (p | 51));
+  a = ((q ^ d) + (c ^ p)) - ((a ^ p) + (q + b));
+  d = ((d + b) ^ (d | d)) - ((d | d) | (d * c));
+  for(i = 0; i < 14; i++){
+    d = ((d ^ c) & (q - c)) ^ ((p ^ 66) + (a ^ 88));
+  }
+  if(c < c){
+    b = ((p | 95) + (a & b)) | ((c + 37) ^ (c * 27));
+  }else{
+    b = ((b - b) & (c - a)) ^ ((a - b) | (p - d));
+  }
+  return a + b + c + d;
+}
+
+int func37(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 8;
+  d = 68;
+  d = ((q - q) ^ (a * d)) | ((c ^ p) + (b ^ d));
+  b = ((c ^ 37) - (c | b)) & ((p ^ 93) + (d + 78));
+  b = ((q * b) ^ (c - d)) - ((c | q) & (c ^ c));
+  b = ((c & 6) + (q & q)) & ((a * p) ^ (p & a));
+  if(b < 25){
+    a = ((a + d) - (a ^ p)) & ((a & q) ^ (d - q));
+  }else{
+    c = ((d - d) & (p ^ 89)) * ((b + a) - (q | 1));
+  }
+  d = ((a - p) * (b * b)) * ((p & c) & (p + a));
+  for(i = 0; i < 38; i++){
+    a = ((q | c) - (q | q)) - ((c * a) & (p & a));
+  }
+  b = ((p + p) & (c | d)) - ((a + q) - (q & q));
+  d = ((a * p) + (b + p)) - ((b | d) | (a * q));
+  if(c < a){
+    a = ((a ^ 52) + (p * 90)) ^ ((b ^ c) | (a & d));
+  }else{
+    a = ((c + q) | (b * 79)) * ((b + d) | (a & q));
+  }
+  c = ((c ^ b) ^ (a + q)) - ((p - c) - (q & p));
+  c = ((a + 83) & (p & d)) - ((p * 88) | (d * b));
+  d = ((b * q) | (c - 91)) | ((p | p) ^ (d & q));
+  for(i = 0; i < 6; i++){
+    d = ((p & d) + (c & q)) | ((a | 22) * (q * q));
+  }
+  if(d < d){
+    b = ((b | a) + (p * a)) & ((d + 56) * (c * d));
+  }else{
+    c = ((c & d) + (q & 4)) & ((a ^ q) & (b & c));
+  }
+  b = ((q & c) * (q | q)) & ((q + q) | (p & a));
+  a = ((d * b) & (a & d)) ^ ((c - b) & (d * c));
+  d = ((b | q) - (d + d)) * ((q ^ a) - (c - p));
+  b = ((q & 58) ^ (d | p)) + ((b & 69) + (d * d));
+  if(a < d){
+    d = ((d & b) + (p * 6)) & ((d - 20) & (q * c));
+  }else{
+    b = ((a * b) ^ (q | p)) | ((b ^ q) & (b - q));
+  }
+  for(i = 0; i < 5; i++){
+    a = ((a + a) | (d - b)) * ((q + 64) ^ (p * d));
+  }
+  c = ((q * 27) + (q ^ 26)) | ((d * a) & (b - 80));
+  c = ((a * b) * (a | a)) * ((b | p) & (d ^ d));
+  a = ((b | q) ^ (q | 34)) * ((b + b) ^ (b * c));
+  if(b < c){
+    c = ((d - d) ^ (a & 37)) * ((a ^ b) ^ (p & b));
+  }else{
+    d = ((b | b) | (c | b)) & ((p ^ a) * (c & a));
+  }
+  d = ((c ^ p) | (c + q)) - ((b | q) * (a & p));
+  a = ((q + 24) & (c ^ p)) - ((d + p) + (d * c));
+  for(i = 0; i < 39; i++){
+    a = ((c ^ q) & (b | a)) + ((a & p) | (b - 44));
+  }
+  b = ((a ^ 3) & (c & c)) - ((b & 15) | (q & 41));
+  if(d < q){
+    d = ((b | 9) ^ (d * a)) - ((a & q) | (p - q));
+  }else{
+    a = ((d - c) + (a | 54)) * ((q ^ p) ^ (c * d));
+  }
+  d = ((d ^ 20) * (d + 87)) - ((b * 41) + (q * a));
+  c = ((a - 58) * (q + c)) + ((c + d) & (c + 49));
+  a = ((c - p) ^ (q ^ 30)) ^ ((c * c) + (c | 47));
+  b = ((q | d) & (b * a)) & ((d ^ 15) & (c * a));
+  if(b < a){
+    d = ((c ^ d) & (q * q)) * ((d ^ c) & (c | p));
+  }else{
+    c = ((p ^ c) | (q ^ 51)) ^ ((d - 50) - (c + p));
+  }
+  b = ((a * d) - (b ^ d)) + ((a | c) & (a & b));
+  a = ((d | 25) * (d ^ 25)) * ((a ^ p) - (b + a));
+  c = ((b + b) - (d - c)) ^ ((q | b) | (b * p));
+  a = ((p - 95) - (b | p)) - ((b * a) - (d * 98));
+  if(b < c){
+    d = ((c * 21) & (p * a)) * ((p ^ b) + (b & 2));
+  }else{
+    d = ((d ^ 80) ^ (q - 33)) * ((d | b) * (a - q));
+  }
+  d = ((c * p) * (b - p)) ^ ((p - 54) - (d | d));
+  for(i = 0; i < 22; i++){
+    b = ((q * d) + (p + d)) * ((d - b) + (c - a));
+  }
+  d = ((c & p) & (c + 55)) | ((d + p) & (p & 7));
+  c = ((b + 79) + (q * b)) | ((b ^ d) + (a - c));
+  if(c < a){
+    d = ((a + d) ^ (c - a)) + ((b & 23) | (q | a));
+  }else{
+    b = ((a * 40) * (b ^ b)) * ((p & q) & (q | q));
+  }
+  d = ((b + p) * (a * 32)) * ((d ^ a) ^ (d * 28));
+  c = ((d | b) - (c & q)) - ((c & c) ^ (c & d));
+  b = ((d * 10) + (p * b)) + ((b | q) & (d & d));
+  for(i = 0; i < 36; i++){
+    d = ((c | a) & (c + 66)) ^ ((q + c) + (c * 73));
+  }
+  if(b < 62){
+    b = ((c + a) ^ (q - c)) ^ ((c - a) ^ (a ^ 51));
+  }else{
+    c = ((a + 43) * (p * b)) & ((b - b) & (q + c));
+  }
+  return a + b + c + d;
+}
+
+int func38(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 31;
+  d = 58;
+  a = ((p * c) + (b + d)) & ((c ^ q) + (q + 67));
+  a = ((q * 93) * (d | b)) * ((q - d) - (q + 94));
+  b = ((a - c) | (a | b)) + ((p - p) * (c | p));
+  a = ((b & d) ^ (c ^ c)) | ((b | b) & (d + p));
+  if(d < c){
+    c = ((b - a) - (a + q)) + ((a | b) ^ (p | d));
+  }else{
+    c = ((q & p) & (d - b)) * ((b | p) | (b & b));
+  }
+  d = ((a ^ b) + (d * b)) + ((c * 86) ^ (b ^ c));
+  for(i = 0; i < 44; i++){
+    c = ((a & a) - (p * 17)) * ((q + 20) | (d ^ b));
+  }
+  d = ((d ^ 98) & (c ^ c)) - ((d + a) & (q ^ p));
+  d = ((p | 23) + (c - d)) | ((a & a) * (b & 1));
+  if(a < a){
+    a = ((a & 90) ^ (p - 50)) ^ ((q & a) ^ (p - 14));
+  }else{
+    d = ((c & 36) + (b * b)) | ((c - p) * (p + d));
+  }
+  b = ((d | 18) - (q - b)) ^ ((b ^ a) & (q ^ 72));
+  a = ((p - 93) * (c | d)) * ((c ^ 51) - (c & a));
+  d = ((c + p) | (q - q)) | ((c * q) - (q ^ q));
+  for(i = 0; i < 44; i++){
+    d = ((d * a) * (q * 37)) * ((c + 63) + (a & 9));
+  }
+  if(c < c){
+    a = ((q + 94) | (p | c)) + ((c | 93) & (q & a));
+  }else{
+    c = ((q | 37) | (q ^ b)) & ((d + b) + (q | p));
+  }
+  d = ((q * b) | (c ^ 63)) | ((c ^ 72) ^ (a & 88));
+  a = ((a ^ b) | (p ^ d)) + ((a * p) ^ (q + q));
+  c = ((b | p) - (a * b)) + ((q ^ p) * (a - a));
+  b = ((b ^ 44) - (c | q)) + ((c ^ 97) + (c & a));
+  if(c < b){
+    b = ((c & d) * (a | b)) - ((p * 1) * (q & c));
+  }else{
+    b = ((b - c) - (b * a)) | ((a + d) ^ (d + a));
+  }
+  for(i = 0; i < 49; i++){
+    c = ((c + a) - (p | 45)) | ((c * d) + (d + b));
+  }
+  c = ((a ^ 52) + (c + b)) ^ ((d & d) & (c * b));
+  a = ((b * q) * (q | a)) * ((b | q) + (a & b));
+  a = ((d | a) * (c ^ q)) - ((b | 60) + (a ^ 92));
+  if(a < q){
+    a = ((b + p) & (c | q)) * ((b - b) - (b * b));
+  }else{
+    b = ((p ^ q) | (a & 47)) + ((b | d) & (c ^ p));
+  }
+  c = ((q | q) | (d + c)) ^ ((p + c) * (q * b));
+  c = ((c + p) | (a ^ d)) + ((p ^ a) | (d * 25));
+  for(i = 0; i < 45; i++){
+    c = ((c + d) ^ (a * p)) | ((c - d) + (b + q));
+  }
+  a = ((p | c) | (a - q)) * ((d + 59) ^ (p + 7));
+  if(c < c){
+    d = ((q ^ 93) + (a * c)) * ((b ^ 34) - (q - p));
+  }else{
+    c = ((d & 58) & (a | p)) * ((b ^ c) & (d & p));
+  }
+  c = ((d & d) ^ (a * d)) - ((q - c) - (b ^ p));
+  c = ((d ^ b) | (c * a)) & ((a * d) | (b - b));
+  c = ((q | c) - (q & d)) & ((q | 9) | (p ^ 70));
+  a = ((p & c) * (b + d)) | ((b & c) & (d + c));
+  if(a < d){
+    c = ((d - p) | (b * p)) - ((q & a) + (b & p));
+  }else{
+    b = ((p ^ p) - (d & 65)) ^ ((q - 21) - (p + 46));
+  }
+  c = ((b ^ d) & (p - q)) * ((q | q) + (p ^ 20));
+  b = ((b - 10) * (b | b)) - ((d + q) - (p | p));
+  c = ((a & c) | (q | c)) ^ ((a * 10) | (q & b));
+  a = ((c ^ 17) + (q & a)) + ((d + d) - (p + a));
+  if(b < p){
+    c = ((c | d) * (a + c)) - ((c - 37) & (b | p));
+  }else{
+    d = ((a + b) & (b - q)) + ((a | a) - (q ^ 62));
+  }
+  b = ((c - 88) ^ (d & 6)) - ((c & 31) + (q - c));
+  for(i = 0; i < 34; i++){
+    a = ((a & q) | (a ^ b)) ^ ((a & 65) ^ (a - c));
+  }
+  c = ((p | c) & (q & b)) * ((q & 78) * (d - p));
+  d = ((d * c) * (q - d)) ^ ((a - a) ^ (q * q));
+  if(d < a){
+    d = ((c | b) | (q + p)) - ((a & 10) + (b & d));
+  }else{
+    a = ((p | p) ^ (p ^ d)) & ((d * c) | (a * a));
+  }
+  c = ((q - p) + (p | d)) & ((d - b) ^ (c ^ c));
+  b = ((p & c) | (b | d)) ^ ((c | q) & (p - 83));
+  a = ((c - p) & (p & 28)) + ((d | c) | (q * d));
+  for(i = 0; i < 25; i++){
+    a = ((c + c) ^ (q ^ p)) * ((c + q) & (p & a));
+  }
+  if(a < 15){
+    a = ((p | p) * (a * q)) ^ ((q - q) + (c | d));
+  }else{
+    b = ((d + 17) + (d + d)) | ((c * 1) | (b + q));
+  }
+  return a + b + c + d;
+}
+
+int func39(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 70;
+  d = 94;
+  a = ((d | a) - (q ^ a)) & ((d & c) + (d | a));
+  a = ((p & c) | (d & 2)) - ((a * 23) + (p ^ 53));
+  b = ((p * d) ^ (q | d)) - ((p - 39) ^ (q ^ b));
+  a = ((b * 61) * (q | 79)) | ((c * p) & (b & a));
+  if(d < 62){
+    b = ((c - 62) * (p - a)) - ((d & d) - (q & p));
+  }else{
+    d = ((b * q) * (p - a)) | ((d | q) ^ (a | c));
+  }
+  c = ((c * a) ^ (q - a)) & ((q & d) | (p + 8));
+  for(i = 0; i < 18; i++){
+    c = ((a + p) & (b ^ 47)) | ((c & 61) ^ (q ^ 98));
+  }
+  d = ((d | q) - (b * b)) * ((c & a) * (a - b));
+  b = ((c * 82) ^ (a ^ d)) ^ ((q | 37) ^ (c + 13));
+  if(b < b){
+    b = ((b & c) + (p ^ a)) ^ ((c ^ d) | (q - p));
+  }else{
+    c = ((p + p) & (p - c)) & ((q + p) * (p - d));
+  }
+  b = ((b - c) ^ (p - d)) + ((a * a) - (q + 90));
+  b = ((c * d) ^ (q ^ p)) | ((p | p) + (c & q));
+  d = ((c + p) ^ (c * q)) ^ ((b & b) ^ (b + 21));
+  for(i = 0; i < 18; i++){
+    a = ((b - d) * (d - c)) ^ ((b + c) & (d & b));
+  }
+  if(c < d){
+    c = ((b | 90) * (c & 62)) | ((q | d) - (a * 19));
+  }else{
+    d = ((p + p) | (p & p)) - ((c + d) + (d * a));
+  }
+  b = ((q - p) + (b & 23)) - ((b + a) | (p - p));
+  b = ((c * a) & (c | 97)) & ((c + 85) * (a * q));
+  b = ((c - 96) + (c | q)) + ((q ^ 70) * (q & b));
+  d = ((a * a) - (a * 9)) | ((b * c) - (p + p));
+  if(a < c){
+    c = ((b * b) ^ (a & p)) * ((d + d) | (a * b));
+  }else{
+    b = ((c - b) | (p - b)) - ((d * p) | (a + q));
+  }
+  for(i = 0; i < 13; i++){
+    c = ((b | 60) - (d + q)) - ((c * b) ^ (d + a));
+  }
+  b = ((a ^ a) - (a + d)) | ((a - 85) * (b + q));
+  c = ((c * 47) ^ (b | 55)) + ((d + d) - (c | c));
+  d = ((q - a) | (b * a)) ^ ((c + c) * (d & c));
+  if(c < a){
+    b = ((p & p) | (a + 71)) * ((b | a) & (c - c));
+  }else{
+    b = ((p - d) | (q & c)) | ((b & 42) ^ (c * p));
+  }
+  d = ((p * d) | (d & p)) ^ ((d & 34) ^ (a | c));
+  a = ((p | c) ^ (a - b)) & ((q * b) + (b * 23));
+  for(i = 0; i < 23; i++){
+    a = ((a & a) * (c & q)) - ((p & 21) & (a + p));
+  }
+  a = ((q - b) ^ (c & 54)) | ((c * 94) + (b & 89));
+  if(b < c){
+    a = ((q - p) ^ (d & 82)) - ((p + q) ^ (a - q));
+  }else{
+    d = ((b + a) * (c | q)) + ((q & q) & (p ^ q));
+  }
+  b = ((a * c) ^ (b & 85)) + ((q | c) | (a ^ p));
+  d = ((b ^ c) | (p | b)) - ((q - a) | (c * q));
+  a = ((d ^ b) + (q ^ p)) | ((d + q) - (c + 35));
+  d = ((a & c) + (d - q)) * ((q | b) - (a * a));
+  if(d < a){
+    c = ((b + p) * (d - b)) + ((b ^ 35) - (b ^ q));
+  }else{
+    c = ((a + 18) * (p * a)) * ((p & a) - (a * a));
+  }
+  d = ((a | c) + (b ^ c)) & ((a + b) & (a | a));
+  d = ((q ^ c) & (a + b)) * ((c & c) | (c * q));
+  a = ((q * b) + (d - c)) & ((c * c) * (b | a));
+  a = ((p + d) + (b | 65)) ^ ((d ^ q) * (a & d));
+  if(d < d){
+    c = ((a + 53) | (b * 2)) ^ ((q + q) | (q - p));
+  }else{
+    b = ((d & d) * (d & c)) - ((p * b) | (c - a));
+  }
+  d = ((a + a) ^ (b ^ c)) * ((c - a) | (b * p));
+  for(i = 0; i < 45; i++){
+    b = ((q | 20) & (b & q)) * ((d & b) - (a * d));
+  }
+  b = ((d * d) * (c | 87)) - ((d ^ p) | (d - 83));
+  a = ((a - 5) + (d | d)) ^ ((d | q) - (c + c));
+  if(b < c){
+    d = ((b | p) * (b | b)) & ((q * b) * (d * q));
+  }else{
+    b = ((p ^ p) * (d ^ a)) - ((q * a) ^ (b * p));
+  }
+  d = ((p & b) + (q - p)) ^ ((q + q) & (d * a));
+  b = ((c & p) * (c * 72)) * ((a | c) | (c - a));
+  d = ((a & d) | (b + p)) | ((b - q) & (q - a));
+  for(i = 0; i < 38; i++){
+    d = ((d ^ q) + (d | q)) + ((p & d) & (d & p));
+  }
+  if(c < 99){
+    c = ((q - d) * (q + a)) & ((b * a) - (d | d));
+  }else{
+    d = ((q | p) - (c | q)) * ((a | d) + (a + 83));
+  }
+  return a + b + c + d;
+}
+
+int func40(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 45;
+  d = 11;
+  b = ((d - a) | (c ^ q)) & ((b + 89) + (d ^ p));
+  d = ((b + b) * (a & 33)) + ((q - d) - (p | 47));
+  a = ((q & d) + (c & 21)) * ((d - p) - (b & d));
+  b = ((b * 36) + (d + a)) * ((c ^ 57) * (q & b));
+  if(d < d){
+    c = ((d | 73) | (p * p)) - ((b ^ q) | (b - p));
+  }else{
+    c = ((a + c) ^ (p - d)) - ((q - 59) | (p - q));
+  }
+  a = ((q | d) - (c ^ b)) * ((p - 24) ^ (a - c));
+  for(i = 0; i < 8; i++){
+    a = ((q + a) + (c - b)) | ((d * 85) * (d | q));
+  }
+  c = ((q * c) + (p + a)) & ((b + c) - (p + c));
+  d = ((d - 99) * (d | 80)) ^ ((b ^ a) + (c & 8));
+  if(b < b){
+    c = ((a - 24) + (a | q)) | ((p & 47) + (b + q));
+  }else{
+    b = ((q | a) ^ (b - p)) & ((b ^ b) | (b + 18));
+  }
+  c = ((d | d) * (p & 55)) - ((q | p) | (b + 32));
+  c = ((d ^ c) | (b - c)) - ((b | a) * (c * b));
+  d = ((a - 21) ^ (q ^ c)) - ((q | c) & (p | a));
+  for(i = 0; i < 11; i++){
+    d = ((q + a) | (c + 95)) | ((d * 88) + (q & a));
+  }
+  if(a < d){
+    d = ((c | q) | (q | 94)) * ((q ^ b) - (b | p));
+  }else{
+    b = ((p * b) & (b + 25)) & ((a + a) ^ (a & p));
+  }
+  a = ((q + 17) & (b | a)) + ((d ^ 12) + (a & a));
+  b = ((c & c) - (b | b)) ^ ((p | d) - (a + a));
+  b = ((q ^ 90) | (q + 96)) ^ ((q + p) - (c * d));
+  a = ((q ^ a) | (b | 96)) & ((c ^ 38) - (a | a));
+  if(c < p){
+    c = ((c * c) - (q * q)) | ((q + c) * (c & 82));
+  }else{
+    b = ((q + b) + (q - b)) * ((p ^ d) * (p + c));
+  }
+  for(i = 0; i < 21; i++){
+    d = ((a - p) ^ (b * d)) - ((b + 41) & (a + a));
+  }
+  c = ((b | a) + (d - 57)) * ((d - p) - (a * q));
+  a = ((p ^ q) & (q ^ d)) - ((d * b) + (q + d));
+  b = ((q ^ 78) | (a | d)) & ((a * c) * (p - 26));
+  if(b < b){
+    d = ((q | 45) ^ (q + q)) + ((p * c) ^ (a | c));
+  }else{
+    d = ((b - q) + (p | q)) ^ ((p ^ c) + (d ^ q));
+  }
+  d = ((a ^ a) * (p - a)) | ((c | 60) + (c - a));
+  d = ((a * 50) ^ (p - q)) ^ ((p - d) ^ (c | a));
+  for(i = 0; i < 2; i++){
+    a = ((c - p) - (q * b)) - ((a * b) * (c | c));
+  }
+  b = ((a & p) * (a + d)) - ((b - q) + (d * q));
+  if(d < q){
+    d = ((b ^ q) & (p ^ 49)) & ((a ^ q) * (b - q));
+  }else{
+    c = ((b + a) - (p & 13)) ^ ((c + d) * (b | d));
+  }
+  c = ((d + p) - (a - d)) | ((b + 16) * (c | b));
+  c = ((q & d) + (p - d)) ^ ((a - 1) ^ (d ^ 16));
+  d = ((p ^ b) * (d ^ 15)) | ((q ^ d) - (c ^ 81));
+  c = ((d * q) | (b ^ 20)) | ((q ^ p) | (d | b));
+  if(a < d){
+    c = ((a & q) * (c & c)) & ((b - c) | (d & a));
+  }else{
+    a = ((d | 35) & (b * d)) - ((p * a) - (d & b));
+  }
+  c = ((b & 4) * (c & 11)) + ((p ^ b) - (q + c));
+  c = ((b ^ a) - (q - b)) * ((c ^ p) | (p * a));
+  c = ((b * b) & (q ^ 44)) | ((b ^ c) ^ (b - d));
+  a = ((d ^ q) & (b + b)) | ((q | d) | (d + d));
+  if(b < d){
+    d = ((b & 90) - (p & c)) - ((p | c) | (a - a));
+  }else{
+    a = ((q ^ b) | (q ^ p)) - ((d | p) ^ (d | d));
+  }
+  d = ((c ^ b) - (b | c)) * ((q | p) + (p & b));
+  for(i = 0; i < 41; i++){
+    a = ((b * q) * (q & p)) ^ ((b | q) * (a & c));
+  }
+  d = ((c - q) * (d ^ q)) ^ ((q ^ q) + (a | q));
+  a = ((b - 28) - (p * q)) ^ ((a + a) | (b & b));
+  if(c < p){
+    c = ((p * q) & (p * p)) * ((p & a) | (b & 48));
+  }else{
+    b = ((d ^ q) + (b * p)) ^ ((a & a) | (q - a));
+  }
+  b = ((d | 41) ^ (c ^ a)) | ((d + 91) & (c * b));
+  c = ((p - q) | (c - c)) - ((a - q) + (b * 42));
+  a = ((c - b) | (a | 87)) | ((b ^ a) - (q & 72));
+  for(i = 0; i < 21; i++){
+    d = ((d + p) & (b | d)) | ((c ^ c) | (a ^ 50));
+  }
+  if(c < 29){
+    d = ((p * a) * (p + 19)) | ((a + q) + (c + p));
+  }else{
+    d = ((d - 1) | (d ^ c)) & ((a & b) - (c | b));
+  }
+  return a + b + c + d;
+}
+
+int func41(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 95;
+  d = 30;
+  b = ((d & a) & (b | 79)) - ((a ^ 41) ^ (p - c));
+  b = ((c ^ 30) + (a * q)) & ((p ^ q) - (c | p));
+  b = ((a + q) + (b * b)) * ((d ^ 47) & (d + 93));
+  c = ((c ^ c) | (q - b)) | ((b ^ a) + (q | q));
+  if(a < a){
+    d = ((q ^ b) | (a * 39)) * ((d + d) ^ (a + 52));
+  }else{
+    a = ((b ^ b) ^ (d - q)) ^ ((a * 57) * (p & d));
+  }
+  d = ((a ^ 63) + (p | b)) * ((a * 47) & (b + 23));
+  for(i = 0; i < 14; i++){
+    a = ((p + b) + (b * 2)) & ((c ^ 81) & (b ^ 21));
+  }
+  c = ((d - 47) - (p * 43)) + ((q ^ q) + (q + a));
+  d = ((b - c) ^ (p & b)) | ((c + p) & (c ^ c));
+  if(b < q){
+    b = ((a * d) ^ (c & d)) + ((q + p) ^ (d ^ d));
+  }else{
+    d = ((b - 3) | (q ^ d)) & ((d - q) + (a - d));
+  }
+  d = ((d * q) | (c + 46)) & ((p | b) + (a * 13));
+  c = ((b ^ a) * (c * p)) * ((d + b) | (d * c));
+  c = ((d * 62) & (d * q)) & ((p | a) & (c * p));
+  for(i = 0; i < 13; i++){
+    d = ((q & a) & (p * p)) + ((b | 5) | (p | b));
+  }
+  if(a < 2){
+    d = ((d * 13) ^ (a | q)) * ((a | a) & (d + 83));
+  }else{
+    d = ((d * p) & (p * 80)) + ((p ^ 62) - (b | a));
+  }
+  d = ((c * a) & (c + b)) * ((c + 5) ^ (d + a));
+  b = ((p * q) * (c * p)) + ((d | q) & (p - a));
+  d = ((d - p) & (a + 96)) * ((p | a) - (q * a));
+  c = ((b | p) * (d + a)) * ((q ^ d) - (d + c));
+  if(c < p){
+    a = ((p + q) - (q - 3)) * ((b ^ b) | (c * q));
+  }else{
+    c = ((d | p) * (b - a)) ^ ((c * p) + (a ^ b));
+  }
+  for(i = 0; i < 46; i++){
+    a = ((c | c) ^ (b * a)) - ((a ^ 99) * (d * q));
+  }
+  d = ((a | q) + (d + p)) & ((p ^ p) | (c | 12));
+  b = ((b + 76) - (d - p)) | ((b - b) - (b * c));
+  b = ((a - d) & (p - p)) & ((a | a) - (b ^ c));
+  if(c < b){
+    a = ((c & d) & (q & d)) - ((d | c) ^ (c * 13));
+  }else{
+    d = ((d & b) & (b & c)) ^ ((c & c) & (c | c));
+  }
+  c = ((a + p) | (q * q)) * ((q & d) * (d & a));
+  b = ((d | a) + (c | q)) ^ ((d ^ c) * (b & c));
+  for(i = 0; i < 29; i++){
+    c = ((d & q) & (c & c)) * ((a ^ d) * (a + p));
+  }
+  c = ((d | q) * (a | c)) & ((q & c) + (q * b));
+  if(a < c){
+    b = ((d * d) & (a ^ c)) * ((c ^ p) - (a | 32));
+  }else{
+    b = ((c - q) & (b * p)) ^ ((d - q) | (c * d));
+  }
+  c = ((q & a) | (q * q)) ^ ((c * 41) ^ (q ^ b));
+  a = ((p - q) + (b & q)) | ((b * 32) & (p ^ 97));
+  c = ((c * a) & (d - d)) - ((c * d) & (q & b));
+  b = ((a + p) ^ (b * c)) - ((a ^ d) * (b & 39));
+  if(b < a){
+    b = ((d - b) ^ (a ^ b)) + ((b | a) & (a | p));
+  }else{
+    d = ((p + c) + (q | 57)) - ((d ^ d) & (a ^ 46));
+  }
+  d = ((p * p) | (b - d)) + ((p - d) ^ (p | d));
+  c = ((p | p) * (q & q)) * ((b + q) ^ (p | p));
+  b = ((c | c) * (d & c)) + ((p - q) + (d * 2));
+  a = ((p | p) | (c | p)) | ((c | 24) & (c - c));
+  if(a < d){
+    a = ((q - d) | (b * a)) + ((b ^ p) & (d & q));
+  }else{
+    c = ((a ^ q) | (q + 50)) | ((p | b) & (d * p));
+  }
+  b = ((q | 85) * (b - d)) ^ ((b ^ a) & (b + 73));
+  for(i = 0; i < 38; i++){
+    b = ((b | p) * (c * b)) - ((a * d) * (p & 23));
+  }
+  b = ((c + 63) * (d + a)) & ((c + b) * (p * 50));
+  c = ((a + d) - (a - b)) & ((b * b) ^ (d * b));
+  if(b < q){
+    a = ((d & a) & (p - p)) | ((a | b) + (q & 99));
+  }else{
+    d = ((c * 3) | (b - c)) - ((a - 67) & (d + q));
+  }
+  b = ((c | 51) & (a + p)) - ((b + p) ^ (d - 31));
+  c = ((c - 99) - (c - b)) & ((b | p) - (d * 2));
+  a = ((b ^ a) - (b + p)) ^ ((p | p) | (q + p));
+  for(i = 0; i < 7; i++){
+    b = ((q * d) ^ (p + 48)) ^ ((d | q) - (d | 85));
+  }
+  if(c < c){
+    d = ((q & b) ^ (a + c)) * ((d ^ c) | (b * c));
+  }else{
+    c = ((q + 86) & (p - 1)) & ((d * a) & (b * q));
+  }
+  return a + b + c + d;
+}
+
+int func42(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 77;
+  d = 72;
+  a = ((d | 15) - (b - c)) - ((d & p) + (c & 51));
+  c = ((b * 99) * (d & p)) ^ ((q * q) ^ (d ^ p));
+  c = ((b - c) & (b ^ 4)) + ((p + d) ^ (b * b));
+  b = ((a * a) + (b - 7)) - ((b ^ 28) * (p + p));
+  if(a < 98){
+    c = ((d | 21) - (c & 63)) - ((d | 95) * (d * q));
+  }else{
+    d = ((q & d) - (p * a)) - ((q * p) - (b * p));
+  }
+  d = ((p - c) * (c + b)) | ((p + 83) | (a * p));
+  for(i = 0; i < 42; i++){
+    d = ((c + b) | (c | d)) ^ ((p + 25) & (p * 81));
+  }
+  d = ((a + d) | (b ^ a)) | ((p ^ b) ^ (p - q));
+  b = ((b ^ b) | (b + c)) + ((b - 49) * (p * 8));
+  if(d < q){
+    a = ((a * d) & (q - a)) - ((d ^ q) * (a + d));
+  }else{
+    d = ((q + c) * (d + p)) | ((c - 60) + (b ^ b));
+  }
+  c = ((c ^ q) | (q + c)) & ((q + c) | (q & b));
+  c = ((p + c) ^ (p | 58)) - ((q - 86) - (p ^ b));
+  c = ((q | 82) - (q ^ a)) + ((c - q) + (a ^ b));
+  for(i = 0; i < 27; i++){
+    c = ((b - a) + (a * 76)) - ((d & a) - (a & 75));
+  }
+  if(a < d){
+    b = ((q ^ p) & (p - d)) + ((p * q) ^ (q - q));
+  }else{
+    c = ((b * q) ^ (b & b)) * ((c + d) & (b & d));
+  }
+  b = ((d & a) ^ (b | d)) + ((d & 45) & (d ^ c));
+  b = ((c & c) - (p & p)) ^ ((q & a) | (b - 91));
+  a = ((d & a) | (d | 85)) ^ ((q & p) & (q ^ a));
+  a = ((a & c) & (c ^ 80)) + ((d ^ b) ^ (p ^ d));
+  if(d < 63){
+    a = ((a + 29) * (q ^ 61)) ^ ((q ^ 25) + (p * d));
+  }else{
+    c = ((a | 12) ^ (a * 39)) - ((c ^ c) * (d + q));
+  }
+  for(i = 0; i < 44; i++){
+    a = ((q - a) * (a + a)) & ((p & 75) & (c ^ a));
+  }
+  d = ((b + d) - (q - 91)) + ((p & c) & (q ^ p));
+  d = ((a ^ a) * (q + 45)) * ((q ^ 9) | (d * d));
+  b = ((c ^ q) & (b ^ 91)) * ((a & b) * (p ^ c));
+  if(d < c){
+    b = ((p * a) * (q ^ d)) * ((p + 89) ^ (d | 32));
+  }else{
+    d = ((c & d) - (a & 12)) & ((d ^ c) ^ (b - d));
+  }
+  a = ((a + q) * (c + a)) + ((c + c) + (p - 22));
+  d = ((d | p) & (d & q)) & ((c + 2) ^ (p ^ d));
+  for(i = 0; i < 32; i++){
+    c = ((q | c) + (q | 1)) + ((p ^ 42) | (b - b));
+  }
+  c = ((p * p) | (b + 75)) - ((d * 15) - (b + 63));
+  if(d < q){
+    d = ((c & p) ^ (p | q)) | ((c + b) | (d - c));
+  }else{
+    a = ((q * d) + (d - d)) ^ ((q + 20) + (p | c));
+  }
+  d = ((a ^ 19) * (b & a)) | ((a * p) | (d & a));
+  b = ((a | c) - (p - a)) & ((p + q) - (q - q));
+  d = ((b ^ d) | (q & p)) & ((b - c) & (c + c));
+  a = ((c | 21) - (d & 9)) - ((b ^ b) + (c * c));
+  if(b < 60){
+    a = ((b ^ 96) & (q - c)) ^ ((a & a) + (d ^ a));
+  }else{
+    a = ((a - p) ^ (c + 86)) | ((b * p) | (d * 99));
+  }
+  c = ((c + b) ^ (p ^ c)) - ((a * b) ^ (c * c));
+  c = ((c & d) * (b + a)) ^ ((p - p) - (c * a));
+  c = ((d - p) * (p * b)) + ((q | p) | (a + 42));
+  c = ((q - q) - (a * c)) & ((d ^ d) * (a * 33));
+  if(c < b){
+    c = ((b & q) * (b * b)) & ((c + c) & (a + 87));
+  }else{
+    a = ((c ^ b) - (b + 99)) * ((a + c) - (q | b));
+  }
+  b = ((d | 95) * (d | c)) - ((q * 72) * (p - q));
+  for(i = 0; i < 17; i++){
+    d = ((q & b) * (c | q)) & ((c ^ b) - (c & d));
+  }
+  d = ((p & c) + (q | c)) & ((a | 16) | (d | 79));
+  b = ((d - a) ^ (p + a)) & ((q + c) * (c * p));
+  if(a < c){
+    a = ((c + b) - (d + b)) & ((c - 43) * (d ^ c));
+  }else{
+    a = ((p * p) & (q ^ c)) + ((q ^ p) * (d ^ a));
+  }
+  b = ((c - 87) ^ (a | a)) & ((p * b) - (a ^ a));
+  c = ((d + p) | (c | q)) ^ ((a * 3) & (d - d));
+  a = ((q & a) + (a ^ d)) | ((p | a) - (b & q));
+  for(i = 0; i < 19; i++){
+    b = ((a * 74) | (q ^ a)) - ((b + b) + (d - q));
+  }
+  if(d < b){
+    b = ((p - 98) - (b ^ 73)) ^ ((d ^ b) ^ (p * d));
+  }else{
+    d = ((q & a) | (p & d)) & ((b + a) | (a + c));
+  }
+  return a + b + c + d;
+}
+
+int func43(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 12;
+  c = ((c & a) | (c + p)) - ((b & a) ^ (a + a));
+  c = ((d & c) + (d & b)) | ((c & 80) + (c | b));
+  b = ((a ^ 42) & (a - 58)) - ((c * a) + (d ^ p));
+  a = ((c & b) & (p & p)) - ((d * 81) ^ (p | p));
+  if(b < a){
+    d = ((q | d) + (p - 63)) * ((d ^ p) + (d + a));
+  }else{
+    c = ((p & c) * (c * b)) | ((q * 95) * (d + p));
+  }
+  c = ((b + d) | (d + q)) & ((d ^ c) + (c | a));
+  for(i = 0; i < 22; i++){
+    b = ((d + c) * (c * p)) + ((q | 61) ^ (b * d));
+  }
+  c = ((q - q) + (b + 27)) | ((q * a) | (p & q));
+  c = ((q - 29) * (p * 48)) & ((b - a) ^ (a * p));
+  if(a < p){
+    d = ((c * b) * (q * p)) | ((c & d) | (d * a));
+  }else{
+    a = ((b * 91) + (q + c)) - ((q ^ q) + (q - 87));
+  }
+  b = ((b & b) ^ (c + 16)) & ((d & 22) + (q | 54));
+  a = ((q + c) ^ (q ^ 29)) - ((p * b) * (q - 32));
+  a = ((d | 57) & (q & c)) - ((d & q) - (a & b));
+  for(i = 0; i < 20; i++){
+    b = ((c + q) * (a ^ p)) ^ ((q | 11) * (b - b));
+  }
+  if(c < a){
+    d = ((b | p) & (a * a)) - ((q + p) ^ (q ^ a));
+  }else{
+    b = ((c & q) - (d * 24)) - ((p | 64) + (b ^ 12));
+  }
+  d = ((b - d) ^ (p * b)) & ((q | p) + (d & q));
+  a = ((b * 43) * (p & 49)) ^ ((q - p) & (p & 9));
+  b = ((p + p) + (a - 18)) & ((a * 19) - (c ^ b));
+  d = ((q ^ p) - (q + 93)) | ((a & p) * (p ^ 91));
+  if(a < c){
+    b = ((d | p) * (p + a)) + ((a & p) | (d * a));
+  }else{
+    d = ((c * p) ^ (p & c)) & ((b + q) ^ (d * d));
+  }
+  for(i = 0; i < 2; i++){
+    a = ((c + b) * (c ^ p)) & ((a * 76) - (c | a));
+  }
+  d = ((d ^ d) ^ (c & p)) & ((b - c) - (c & a));
+  c = ((b * b) - (a + b)) ^ ((c | a) - (q & q));
+  c = ((p ^ c) - (p - b)) + ((b | 75) * (a * 19));
+  if(b < c){
+    a = ((q + 12) + (b - d)) & ((p - 29) - (a & c));
+  }else{
+    d = ((d * d) - (d + c)) | ((b | a) | (c - q));
+  }
+  c = ((b ^ 88) - (b | 52)) - ((c * 43) & (a & a));
+  b = ((b | 9) & (d - 53)) - ((q | b) ^ (a | 8));
+  for(i = 0; i < 42; i++){
+    c = ((p | p) & (d + d)) ^ ((a ^ p) + (c ^ b));
+  }
+  b = ((b - c) & (a + q)) * ((a ^ 21) & (a + p));
+  if(b < p){
+    b = ((q | 6) & (d + 10)) + ((q | b) | (c + c));
+  }else{
+    a = ((c | b) | (d + 5)) | ((q - 8) + (d - a));
+  }
+  b = ((p & c) - (a | a)) & ((a ^ c) & (d & b));
+  d = ((a ^ 4) * (d + 15)) + ((q - p) | (a ^ 6));
+  d = ((c & b) * (a | a)) & ((d ^ 9) ^ (b * a));
+  a = ((a & a) - (q * p)) ^ ((a - c) - (d | q));
+  if(b < a){
+    c = ((b | a) | (b * c)) & ((d | c) ^ (c + 97));
+  }else{
+    d = ((b * q) | (q * 5)) + ((d & q) | (b & q));
+  }
+  b = ((p * d) | (c & q)) + ((b + d) - (d * c));
+  c = ((c | p) ^ (b - 72)) | ((p + a) | (a + d));
+  c = ((p + c) * (b + d)) - ((c * c) & (p * c));
+  c = ((p & d) & (d - c)) ^ ((a - a) + (q + 33));
+  if(c < q){
+    c = ((b | a) - (a + 35)) | ((a - p) * (a + d));
+  }else{
+    c = ((q & 40) * (c + 6)) & ((p - q) & (p + a));
+  }
+  c = ((q - 64) | (p ^ 69)) + ((d ^ d) * (c & p));
+  for(i = 0; i < 25; i++){
+    d = ((a + b) + (b * 95)) | ((d - c) & (a + 27));
+  }
+  c = ((p ^ 94) & (b - d)) + ((b & 43) * (c | d));
+  b = ((c - 99) & (p & q)) | ((a & 82) * (a ^ a));
+  if(a < q){
+    c = ((c & a) * (q + d)) + ((p * q) + (b ^ b));
+  }else{
+    a = ((p * q) | (a & a)) & ((b - d) + (q - b));
+  }
+  b = ((a + p) & (d ^ p)) + ((c ^ d) ^ (p & p));
+  d = ((q - c) - (b + p)) ^ ((p + b) | (d * a));
+  b = ((c | c) + (d + a)) & ((q | p) & (q + a));
+  for(i = 0; i < 4; i++){
+    b = ((p * 87) + (p & d)) & ((a + q) - (b ^ d));
+  }
+  if(d < q){
+    d = ((c | b) ^ (d ^ p)) & ((d & d) & (c * c));
+  }else{
+    a = ((c * 87) & (d & a)) * ((q & 97) - (q & p));
+  }
+  return a + b + c + d;
+}
+
+int func44(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 37;
+  d = 62;
+  d = ((a | b) ^ (p & 28)) - ((a + a) * (p * 62));
+  b = ((q - 66) * (b + a)) | ((p ^ a) * (b ^ 12));
+  d = ((p + q) & (b - q)) ^ ((a ^ 77) + (b - 85));
+  d = ((a + 94) * (a ^ 46)) & ((b + q) * (b * 3));
+  if(d < d){
+    d = ((b & p) * (a | d)) + ((p * 8) - (p ^ b));
+  }else{
+    b = ((b - b) * (a + 51)) - ((q & 5) - (d - c));
+  }
+  d = ((p - b) | (c | d)) | ((c - q) & (q ^ b));
+  for(i = 0; i < 24; i++){
+    d = ((d * p) ^ (a ^ q)) - ((d ^ 14) + (p ^ q));
+  }
+  a = ((p ^ c) | (d ^ b)) | ((p ^ 19) ^ (q & c));
+  d = ((a + 27) + (p ^ q)) | ((c | b) - (a - q));
+  if(c < c){
+    b = ((q + a) - (q + q)) & ((p | a) + (b | b));
+  }else{
+    a = ((d | c) - (q * b)) & ((d * c) * (c ^ q));
+  }
+  b = ((a + 18) - (q - q)) - ((c & b) & (b + d));
+  c = ((p + a) ^ (a | 20)) & ((b - b) * (a + c));
+  d = ((b & b) ^ (d - 53)) * ((b | p) + (c & b));
+  for(i = 0; i < 9; i++){
+    a = ((a | p) ^ (b - b)) - ((b + 42) - (c + c));
+  }
+  if(a < 3){
+    a = ((p + a) * (d - p)) - ((c * a) ^ (a + d));
+  }else{
+    a = ((q ^ q) * (d | q)) | ((a | 24) | (a + p));
+  }
+  c = ((d + b) * (a * a)) * ((p ^ a) ^ (p * 93));
+  d = ((d ^ c) & (a - a)) - ((d - a) ^ (p * p));
+  c = ((d & 17) * (c - 24)) & ((b - p) - (b & 44));
+  b = ((d & 18) - (p * c)) | ((q | p) - (a & 21));
+  if(c < 21){
+    a = ((d * d) - (a ^ d)) - ((q ^ d) - (c * 84));
+  }else{
+    a = ((p - d) - (q | b)) ^ ((c + p) ^ (a & a));
+  }
+  for(i = 0; i < 17; i++){
+    b = ((b - 67) | (a ^ b)) - ((c * d) & (q * 95));
+  }
+  d = ((d | c) * (c ^ d)) * ((c ^ c) ^ (d + c));
+  c = ((p ^ a) & (c & p)) + ((d | 96) | (c * b));
+  a = ((c ^ d) ^ (d + 8)) & ((p + q) - (q & c));
+  if(d < a){
+    c = ((d & 21) & (b * a)) ^ ((c * p) * (p & b));
+  }else{
+    a = ((a ^ 85) ^ (b | b)) & ((d - q) + (q & b));
+  }
+  d = ((b - 26) * (q - a)) + ((d ^ 77) & (a + 71));
+  a = ((c | q) ^ (q & p)) * ((c + a) + (q + 82));
+  for(i = 0; i < 21; i++){
+    b = ((d | q) * (d - 51)) - ((d + p) & (p & b));
+  }
+  c = ((b ^ a) ^ (b + 24)) ^ ((c ^ b) | (d * p));
+  if(b < 72){
+    b = ((q + q) + (c * c)) & ((d + d) & (b + p));
+  }else{
+    b = ((a * b) * (c ^ d)) | ((b | d) + (b & d));
+  }
+  b = ((d ^ a) & (b + 80)) & ((b * a) + (q + d));
+  d = ((b ^ p) - (q + c)) | ((a * c) * (b - q));
+  b = ((c ^ b) | (p * d)) + ((a + d) + (q & q));
+  d = ((d - a) - (d ^ d)) | ((q ^ p) * (d | c));
+  if(c < 63){
+    a = ((p - q) * (a | a)) & ((d + q) + (p & 20));
+  }else{
+    d = ((c & c) - (p - a)) & ((d * a) + (p * 43));
+  }
+  d = ((b ^ d) + (q | d)) * ((c ^ 10) ^ (d ^ 84));
+  a = ((q & q) | (q ^ a)) + ((q ^ 84) ^ (q - q));
+  a = ((q | a) - (d ^ 65)) ^ ((a - a) * (c * p));
+  d = ((b * a) - (d | c)) - ((p - d) - (c & c));
+  if(a < b){
+    d = ((a ^ p) & (b - d)) & ((q & d) - (a ^ 43));
+  }else{
+    a = ((p - d) * (a - c)) - ((b & a) & (p | b));
+  }
+  d = ((b & 80) - (q * q)) & ((a ^ a) ^ (q + a));
+  for(i = 0; i < 41; i++){
+    a = ((c & p) ^ (a & a)) & ((q ^ p) | (b | q));
+  }
+  a = ((q - 25) - (d - 61)) * ((d * a) & (p - 40));
+  b = ((b - 73) | (b & p)) & ((a + a) & (b - a));
+  if(c < b){
+    d = ((q ^ p) | (b | p)) - ((q * 88) + (p & c));
+  }else{
+    a = ((d & a) | (p | q)) + ((q & 64) | (b + c));
+  }
+  a = ((d | p) * (b | 67)) * ((d + 58) - (p * 48));
+  b = ((q | a) * (p | b)) ^ ((b | q) | (d & b));
+  c = ((p + q) * (c + b)) & ((d ^ 25) - (q & c));
+  for(i = 0; i < 31; i++){
+    b = ((b | p) | (c * p)) - ((d * 66) ^ (d * q));
+  }
+  if(a < 65){
+    a = ((c * b) + (q + p)) + ((p ^ b) + (d * b));
+  }else{
+    a = ((c + p) * (a + b)) & ((d | p) - (q | d));
+  }
+  return a + b + c + d;
+}
+
+int func45(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 28;
+  d = 10;
+  c = ((a - 11) | (p | d)) & ((q - 93) & (d * c));
+  a = ((b - 89) & (d & p)) | ((p & p) - (c - 37));
+  a = ((b & b) * (q ^ a)) | ((a | q) * (p + c));
+  b = ((c | a) - (a | 14)) ^ ((a + q) | (b * b));
+  if(b < b){
+    d = ((b & d) ^ (a | a)) ^ ((c - d) ^ (b | c));
+  }else{
+    a = ((c + a) + (c ^ b)) | ((c ^ d) ^ (q | 69));
+  }
+  b = ((q + a) * (a ^ b)) | ((b & c) | (b + d));
+  for(i = 0; i < 26; i++){
+    d = ((d + q) | (d ^ 14)) & ((a | q) * (q | a));
+  }
+  a = ((d ^ c) - (p & 1)) + ((d * b) * (d ^ b));
+  c = ((d - 99) + (d & 24)) ^ ((d + 62) & (b | p));
+  if(b < b){
+    d = ((a ^ 97) + (b + d)) + ((p - 4) + (p ^ 64));
+  }else{
+    a = ((d & q) * (p ^ d)) | ((a * c) ^ (c ^ 41));
+  }
+  a = ((p + q) + (a & 23)) ^ ((c + c) ^ (q & 67));
+  c = ((b & 82) & (d & b)) & ((d & c) & (b * q));
+  d = ((p - c) | (a * 61)) + ((q - 97) & (c * 31));
+  for(i = 0; i < 16; i++){
+    c = ((b ^ p) ^ (d * b)) & ((c | p) ^ (b & p));
+  }
+  if(d < b){
+    d = ((b ^ p) ^ (c - c)) - ((b * b) | (d | a));
+  }else{
+    a = ((q & b) - (q * q)) * ((b | c) + (d & d));
+  }
+  c = ((c + d) | (d ^ b)) ^ ((b * a) * (a * 49));
+  a = ((a | 15) - (p & a)) * ((c + b) | (p - a));
+  a = ((d & 49) + (c | 83)) - ((b ^ 30) ^ (d ^ 79));
+  d = ((d & b) ^ (b ^ b)) + ((d & a) - (q * d));
+  if(b < a){
+    d = ((c | p) - (a * d)) ^ ((a | c) & (b & q));
+  }else{
+    a = ((q | 95) | (p & c)) - ((a + b) | (b ^ q));
+  }
+  for(i = 0; i < 46; i++){
+    a = ((p ^ b) - (q + c)) - ((d | q) ^ (b | p));
+  }
+  a = ((c | d) | (d & 68)) | ((q ^ a) & (c + b));
+  a = ((q | b) - (d ^ d)) * ((p + 82) ^ (c ^ a));
+  b = ((b * a) | (b & q)) & ((a & 73) - (b & 81));
+  if(b < q){
+    c = ((d + q) * (q | 93)) & ((c & 53) ^ (q * 75));
+  }else{
+    a = ((p + a) & (d ^ 49)) - ((p ^ b) ^ (a & p));
+  }
+  d = ((d * d) & (p * c)) ^ ((q - a) | (c | p));
+  a = ((a + a) * (a ^ p)) | ((d + b) - (b + b));
+  for(i = 0; i < 34; i++){
+    b = ((c + 64) * (a & d)) - ((d ^ 37) + (a * p));
+  }
+  b = ((d & c) + (b & c)) + ((b + 17) & (a * a));
+  if(a < 83){
+    d = ((a - d) & (a + d)) | ((b & 87) & (p + 97));
+  }else{
+    c = ((b - 20) ^ (p | p)) ^ ((b * q) - (c | 28));
+  }
+  b = ((c | d) - (b + c)) - ((b | c) * (a * c));
+  a = ((q ^ a) | (a & p)) + ((c - q) & (d | p));
+  c = ((b & d) & (b | 15)) & ((b * p) * (a | b));
+  b = ((b * q) + (p & d)) & ((p * 19) * (d ^ 30));
+  if(a < c){
+    c = ((d + 17) & (b & d)) - ((p * 23) ^ (c - q));
+  }else{
+    c = ((d * d) | (q + b)) | ((q | 38) | (d ^ b));
+  }
+  a = ((p & q) * (c * b)) ^ ((d - d) * (b & p));
+  d = ((p + d) * (b ^ 22)) - ((c & 61) | (b | 65));
+  b = ((d - a) - (p | d)) & ((d | c) + (b * a));
+  b = ((d & p) | (p - 98)) - ((b & d) & (c | b));
+  if(c < a){
+    a = ((b * 71) - (d * 96)) | ((p - 59) & (a & 17));
+  }else{
+    c = ((q | 45) ^ (p - c)) & ((p + d) & (c * 76));
+  }
+  b = ((c * c) & (d + p)) + ((p | 91) | (b * b));
+  for(i = 0; i < 19; i++){
+    b = ((p | q) & (d + b)) + ((c * d) - (c - 50));
+  }
+  d = ((q | d) & (p - d)) & ((q | q) | (d | 52));
+  a = ((c ^ 75) - (d + 91)) * ((q * 76) & (a ^ q));
+  if(d < p){
+    d = ((c * c) | (q | p)) | ((b * p) & (b | a));
+  }else{
+    b = ((d - 64) & (d ^ q)) - ((c + b) - (a - a));
+  }
+  c = ((q - q) * (a | 91)) - ((b - 7) & (d & p));
+  d = ((p * c) ^ (p - c)) ^ ((d - p) * (d - 56));
+  a = ((a & p) & (d - 58)) ^ ((q * 3) + (b - p));
+  for(i = 0; i < 49; i++){
+    c = ((a & p) | (p & 45)) + ((b * d) - (b * a));
+  }
+  if(a < a){
+    b = ((d - b) - (c | d)) * ((b | d) - (b ^ q));
+  }else{
+    d = ((a | 66) - (d | b)) ^ ((c + 78) ^ (p + d));
+  }
+  return a + b + c + d;
+}
+
+int func46(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 64;
+  d = 93;
+  d = ((q & d) ^ (p + c)) + ((b & p) - (a | d));
+  a = ((d + d) + (p * 79)) + ((b ^ q) * (p ^ 71));
+  d = ((a & q) | (a - c)) ^ ((a | p) & (c - p));
+  a = ((a + b) - (a | d)) - ((q ^ 13) | (a - 93));
+  if(c < a){
+    b = ((c ^ a) | (c | c)) & ((d - 89) & (b & d));
+  }else{
+    c = ((b | b) | (a ^ a)) + ((c | c) - (q + 55));
+  }
+  c = ((d - c) | (c * 39)) * ((d ^ b) ^ (c + c));
+  for(i = 0; i < 23; i++){
+    a = ((p + 18) + (b + p)) - ((d ^ d) ^ (c | 6));
+  }
+  d = ((c * 68) - (d * c)) + ((q + 74) ^ (q + p));
+  a = ((a - 53) - (p - q)) | ((q - d) & (a * 82));
+  if(a < 93){
+    b = ((b | c) - (b - p)) & ((b + 64) - (c * c));
+  }else{
+    d = ((b ^ 78) & (p | p)) - ((p * a) ^ (d + a));
+  }
+  d = ((b * d) | (b - 27)) & ((a - q) + (c * d));
+  d = ((q - 73) - (b & c)) & ((a ^ b) - (a + 67));
+  c = ((p & b) + (d & 33)) + ((d & p) & (d ^ b));
+  for(i = 0; i < 24; i++){
+    d = ((c + q) & (q ^ b)) * ((b + q) - (a + a));
+  }
+  if(c < 39){
+    b = ((p & 85) ^ (c & b)) - ((q & 38) & (q & b));
+  }else{
+    d = ((c & q) - (q + b)) ^ ((q - 1) | (c | d));
+  }
+  c = ((c & d) ^ (a + 95)) + ((a ^ 78) * (c * d));
+  b = ((d + q) * (b | 90)) & ((b & 33) - (q * b));
+  b = ((b | d) + (c | b)) * ((d ^ a) + (a + q));
+  b = ((p & 96) + (b | a)) + ((d + 92) + (q * p));
+  if(d < 76){
+    c = ((c * a) ^ (q | q)) + ((d + a) | (b & c));
+  }else{
+    a = ((b ^ 24) + (b - 59)) | ((a + b) + (p | d));
+  }
+  for(i = 0; i < 14; i++){
+    c = ((a | q) + (b * 23)) + ((b | a) - (p ^ p));
+  }
+  d = ((b * 59) - (p * 91)) | ((c + a) & (d + q));
+  b = ((b & b) - (p - a)) * ((c & d) & (q + 76));
+  b = ((p | c) - (a | 45)) * ((b ^ 69) & (a + d));
+  if(d < 71){
+    d = ((b * p) | (q | 27)) | ((b - d) + (a ^ d));
+  }else{
+    b = ((d & q) * (q ^ 60)) + ((b & 65) + (p | 32));
+  }
+  d = ((a ^ p) * (b - d)) * ((b + c) + (d | 25));
+  a = ((a | q) ^ (d + a)) & ((q * 29) ^ (b - q));
+  for(i = 0; i < 36; i++){
+    d = ((b + c) * (d - d)) & ((b + 15) * (b + a));
+  }
+  a = ((d + 91) * (c - 89)) ^ ((c & q) ^ (b & p));
+  if(b < q){
+    d = ((b - d) & (b & q)) * ((q * a) - (b + 6));
+  }else{
+    a = ((b * b) ^ (p & a)) | ((b & p) | (c + p));
+  }
+  c = ((q & p) | (d * b)) | ((c - b) | (a + p));
+  c = ((p | p) + (p - p)) + ((a - p) + (p & q));
+  c = ((p | p) & (a * d)) + ((p | 66) + (d + q));
+  c = ((q + q) & (q + a)) & ((d | 49) & (p + c));
+  if(b < 11){
+    b = ((d - 88) | (d + c)) ^ ((p ^ b) & (p & c));
+  }else{
+    a = ((b | b) | (p ^ b)) * ((a * p) - (c - 96));
+  }
+  a = ((d ^ c) - (p & 74)) & ((a + 76) ^ (a - 3));
+  d = ((c ^ q) | (p + p)) & ((a | d) & (c * 4));
+  b = ((c * 64) ^ (a | d)) ^ ((a | a) & (p | b));
+  b = ((b ^ 3) & (d + a)) & ((b ^ b) - (d - b));
+  if(a < 9){
+    b = ((b * b) ^ (c & b)) * ((d + p) - (d | c));
+  }else{
+    c = ((d + b) & (p * d)) - ((b & b) ^ (b & 90));
+  }
+  c = ((p & p) & (q & 43)) | ((p & 99) | (p + b));
+  for(i = 0; i < 12; i++){
+    a = ((p | 41) ^ (b + d)) * ((a + b) + (d & p));
+  }
+  c = ((b & c) * (d - p)) * ((b ^ 55) + (d + q));
+  d = ((c * 21) * (a + p)) - ((d + 23) + (d & c));
+  if(a < b){
+    c = ((c * a) - (q - 95)) | ((c ^ d) - (b - b));
+  }else{
+    c = ((a & d) ^ (d + q)) + ((b * b) * (q - b));
+  }
+  d = ((q & a) + (p - c)) ^ ((c - d) & (b + a));
+  c = ((a & 11) - (q * d)) - ((a - d) | (c * c));
+  a = ((q & c) * (c * b)) + ((b + c) & (p | q));
+  for(i = 0; i < 18; i++){
+    d = ((p & 53) * (a * d)) | ((p * q) * (q | d));
+  }
+  if(b < d){
+    c = ((c + q) * (a * q)) + ((q + 30) & (q + p));
+  }else{
+    a = ((b ^ q) ^ (d ^ p)) * ((c & q) ^ (a * c));
+  }
+  return a + b + c + d;
+}
+
+int func47(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 38;
+  d = 70;
+  a = ((a & d) + (p - 63)) + ((d - a) * (d + 99));
+  c = ((b - a) & (b & 46)) * ((d - c) - (c * b));
+  a = ((b - a) ^ (q | d)) ^ ((a + 69) ^ (d & b));
+  b = ((b ^ 54) - (a ^ c)) * ((b | c) ^ (p | c));
+  if(d < c){
+    d = ((c & 4) + (q - p)) | ((c & 23) & (a | q));
+  }else{
+    d = ((q * c) * (c - 12)) & ((b - b) ^ (p * a));
+  }
+  a = ((p * 42) & (q | 93)) & ((c ^ a) | (d * p));
+  for(i = 0; i < 49; i++){
+    b = ((a - 87) ^ (d + q)) ^ ((b & 88) | (c - 46));
+  }
+  d = ((d | q) & (a & p)) * ((b ^ c) + (p - b));
+  c = ((a + p) + (p ^ p)) ^ ((p & p) + (d + q));
+  if(c < 55){
+    b = ((q + q) & (p + d)) + ((a & a) ^ (b - b));
+  }else{
+    a = ((a & 57) - (c | b)) * ((p * q) & (d - a));
+  }
+  a = ((c | b) + (p | 16)) ^ ((b & a) * (b - q));
+  b = ((a + c) & (d + q)) + ((q + 34) | (p & 11));
+  b = ((a ^ c) * (q | q)) & ((a ^ p) - (p * 53));
+  for(i = 0; i < 44; i++){
+    d = ((a * 17) - (b ^ a)) + ((c - q) * (p - d));
+  }
+  if(b < c){
+    c = ((b + c) + (a ^ a)) | ((d ^ a) | (p - 78));
+  }else{
+    a = ((d - c) * (p + d)) ^ ((q | d) + (q - p));
+  }
+  b = ((b ^ 79) * (q * 54)) * ((d * b) & (b ^ p));
+  b = ((p ^ p) * (d | p)) + ((p + c) | (c + c));
+  d = ((b + c) * (p | p)) ^ ((q + c) & (c & 90));
+  a = ((b - d) ^ (c | b)) & ((p & 17) * (c * p));
+  if(c < 43){
+    d = ((a * d) + (q | q)) - ((d ^ b) ^ (b & 34));
+  }else{
+    d = ((b * b) - (c - 5)) & ((d & 26) - (d | q));
+  }
+  for(i = 0; i < 3; i++){
+    d = ((b | p) & (p ^ 12)) - ((q | d) - (q * d));
+  }
+  c = ((p & a) + (p - c)) & ((c | 51) & (a * c));
+  a = ((b & p) | (d ^ c)) & ((b | b) & (b * c));
+  d = ((p & q) * (q ^ a)) | ((b | p) + (d | b));
+  if(d < b){
+    b = ((c + d) ^ (b - p)) | ((c ^ p) + (p ^ 49));
+  }else{
+    b = ((a | b) | (p * q)) & ((c - 68) - (d + 35));
+  }
+  c = ((q * b) ^ (c + 70)) ^ ((c + 41) - (q ^ a));
+  d = ((d | 89) + (q | q)) + ((q - b) + (b * b));
+  for(i = 0; i < 9; i++){
+    b = ((p * a) * (b | a)) ^ ((p & q) - (p ^ q));
+  }
+  b = ((b ^ 58) ^ (d - 40)) * ((q ^ 72) | (p * 75));
+  if(c < d){
+    c = ((q * 64) * (a | a)) + ((q ^ b) & (b ^ c));
+  }else{
+    b = ((c + c) | (d & a)) + ((c + p) | (c ^ b));
+  }
+  c = ((a + 70) | (b & c)) ^ ((a - b) - (p * 16));
+  c = ((p * q) * (d - a)) + ((c - q) * (q - p));
+  d = ((d * p) ^ (c - p)) * ((c * 6) | (a & d));
+  c = ((c - q) + (d & q)) | ((d - 38) & (d & q));
+  if(b < d){
+    d = ((b - a) ^ (b * 17)) | ((p & c) ^ (b ^ 87));
+  }else{
+    b = ((c ^ c) ^ (c - c)) + ((d | 39) * (b & p));
+  }
+  c = ((b - 94) ^ (b * 2)) & ((a - d) - (p | 74));
+  a = ((q * d) & (d & 74)) - ((p * p) | (c | 61));
+  c = ((p * 61) & (p & 41)) ^ ((b - q) ^ (p & c));
+  c = ((a - b) * (a & a)) ^ ((b * p) | (a & 1));
+  if(a < 11){
+    b = ((q + q) + (d - 84)) & ((q * 69) - (d ^ c));
+  }else{
+    a = ((d ^ d) * (p & 25)) - ((b & 53) * (a & p));
+  }
+  b = ((a & 24) & (a + q)) - ((b & p) | (p * q));
+  for(i = 0; i < 23; i++){
+    d = ((b + q) ^ (a & p)) | ((q & q) | (d & 49));
+  }
+  d = ((p & 28) ^ (d - 81)) - ((c + d) & (c * p));
+  b = ((p ^ d) ^ (d ^ 54)) * ((q | d) | (d + q));
+  if(b < c){
+    c = ((b - c) + (q ^ 81)) * ((a + 67) & (p - 60));
+  }else{
+    a = ((b - 7) * (q | p)) - ((b - a) + (b - p));
+  }
+  c = ((d + a) + (p + a)) * ((a | c) ^ (d - 77));
+  a = ((a & q) * (c ^ b)) - ((p ^ 24) & (b - p));
+  d = ((b ^ b) - (q & d)) | ((q + 98) * (q & a));
+  for(i = 0; i < 46; i++){
+    a = ((q ^ c) * (b * a)) - ((p * 83) & (p | b));
+  }
+  if(d < p){
+    c = ((c + q) * (q & p)) | ((b * b) + (d - 8));
+  }else{
+    b = ((q ^ 84) & (d + p)) * ((a & 13) - (c & d));
+  }
+  return a + b + c + d;
+}
+
+int func48(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 7;
+  d = 22;
+  b = ((d | q) | (b ^ b)) | ((c | q) + (b & 79));
+  a = ((b & a) ^ (c - a)) - ((a ^ d) - (a ^ b));
+  c = ((c | 91) + (a ^ q)) | ((a | c) ^ (p & d));
+  d = ((d * c) ^ (c ^ c)) - ((d & b) | (b + 51));
+  if(c < b){
+    a = ((c | a) - (q ^ 8)) | ((q * b) ^ (q | a));
+  }else{
+    c = ((d - p) | (c & c)) + ((p ^ 80) - (a + b));
+  }
+  b = ((p - b) - (d - q)) & ((b | q) + (q ^ b));
+  for(i = 0; i < 47; i++){
+    d = ((a - q) * (c & 68)) | ((q ^ a) * (p | a));
+  }
+  b = ((q + c) & (c | a)) ^ ((b - p) & (q & b));
+  d = ((a & d) ^ (d ^ b)) * ((a & 2) & (q * 82));
+  if(d < a){
+    b = ((c - a) * (d & 21)) & ((q - 36) & (p ^ p));
+  }else{
+    d = ((b - c) ^ (q ^ c)) + ((q ^ 63) * (p + 11));
+  }
+  b = ((a * a) * (a - c)) ^ ((b * 80) & (d + 24));
+  d = ((b & d) - (c ^ 99)) ^ ((q & 13) & (d ^ b));
+  b = ((q ^ b) - (a | c)) | ((d * c) * (d * d));
+  for(i = 0; i < 30; i++){
+    d = ((c ^ 72) - (c ^ d)) - ((q ^ q) + (c * c));
+  }
+  if(c < c){
+    c = ((q - 56) | (c - 72)) ^ ((p - q) & (q - q));
+  }else{
+    b = ((b + b) + (d + d)) * ((q - a) & (a | 2));
+  }
+  a = ((d + 13) ^ (p - 73)) + ((p - q) ^ (q + q));
+  d = ((a & b) | (d | p)) - ((q | d) ^ (q * p));
+  c = ((d - q) * (c + 92)) | ((a & d) + (p * d));
+  c = ((q + 32) + (q + q)) - ((p ^ 48) + (b ^ d));
+  if(a < b){
+    b = ((a * 40) - (a + d)) - ((d + a) * (b + b));
+  }else{
+    c = ((d & d) & (c - q)) ^ ((c | 73) & (c + d));
+  }
+  for(i = 0; i < 5; i++){
+    d = ((p + b) * (d | b)) ^ ((q ^ d) & (p | a));
+  }
+  d = ((q * b) | (p * 14)) & ((a ^ 22) + (d ^ 84));
+  b = ((a & p) - (a - p)) * ((d * 5) * (q & q));
+  a = ((d & b) + (d + p)) & ((a ^ a) - (q | p));
+  if(c < 25){
+    c = ((c | a) & (b + q)) + ((d & 9) | (b * p));
+  }else{
+    d = ((b + d) ^ (q + p)) | ((b | q) | (q | c));
+  }
+  d = ((a - a) * (c ^ d)) & ((a + p) | (c & a));
+  a = ((b + 61) & (q - 81)) - ((c * d) * (c & p));
+  for(i = 0; i < 6; i++){
+    d = ((a + a) * (p - 85)) ^ ((c + d) ^ (p - a));
+  }
+  d = ((a * b) | (d - d)) + ((c * a) + (a & d));
+  if(d < q){
+    b = ((q | d) * (p | 8)) | ((d * a) & (a - q));
+  }else{
+    b = ((p * 3) * (q - b)) | ((p - d) - (c & 1));
+  }
+  d = ((c + d) - (d | c)) ^ ((b ^ d) + (p + q));
+  a = ((q ^ a) ^ (q + p)) * ((p - c) & (q ^ c));
+  b = ((q - 16) | (a - 40)) ^ ((c | b) | (p | q));
+  c = ((d - p) & (b - a)) ^ ((d | a) ^ (c * c));
+  if(a < q){
+    a = ((p ^ a) + (p | 16)) | ((d ^ c) | (q - a));
+  }else{
+    d = ((a | 39) ^ (b - a)) ^ ((a | 93) * (c * q));
+  }
+  b = ((p * 85) + (a - p)) - ((c - d) - (a & 18));
+  b = ((b ^ a) & (a + 14)) | ((b | 28) & (c - q));
+  d = ((a - 11) - (p + 55)) | ((d & p) + (p & p));
+  c = ((d & d) - (a ^ b)) * ((d * a) + (c * 97));
+  if(c < 79){
+    b = ((a | b) - (a * q)) - ((a & 48) | (d | p));
+  }else{
+    b = ((q | d) | (q * 46)) | ((a + q) | (a & b));
+  }
+  b = ((p - 80) + (c ^ p)) | ((b & a) * (p | a));
+  for(i = 0; i < 8; i++){
+    c = ((b ^ q) & (q ^ 23)) + ((q * d) & (c ^ 32));
+  }
+  d = ((q ^ q) + (c & p)) | ((p - q) | (b | q));
+  a = ((q | c) ^ (b * d)) - ((p - q) * (c + d));
+  if(c < b){
+    a = ((a | b) * (p ^ q)) - ((c * 15) ^ (a * p));
+  }else{
+    c = ((a * a) + (p * 51)) - ((c + b) & (a + a));
+  }
+  a = ((b ^ b) ^ (b + 1)) - ((a ^ p) & (d | 56));
+  a = ((b | 96) * (p * d)) | ((b & d) & (a * 21));
+  d = ((p & a) * (c | 37)) & ((q * c) ^ (q * d));
+  for(i = 0; i < 7; i++){
+    c = ((d + b) * (p * c)) + ((q | 11) ^ (c | p));
+  }
+  if(b < p){
+    b = ((b ^ a) ^ (p | d)) ^ ((q | b) * (c ^ 88));
+  }else{
+    d = ((q * q) ^ (c ^ q)) * ((a ^ 54) * (a * 27));
+  }
+  return a + b + c + d;
+}
+
+int func49(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 27;
+  d = 54;
+  d = ((q * q) - (b * q)) * ((c + q) ^ (q - 54));
+  a = ((q | c) * (a + a)) * ((p * p) ^ (d & 7));
+  a = ((q * 17) + (q ^ a)) * ((a | a) ^ (d & b));
+  d = ((d + b) * (b | q)) | ((d | c) * (d * 44));
+  if(d < c){
+    b = ((p - d) & (c | c)) ^ ((q ^ p) & (b | a));
+  }else{
+    a = ((q - q) - (b * d)) ^ ((c ^ p) & (b | p));
+  }
+  d = ((q ^ 50) | (a + p)) & ((b ^ b) ^ (p - 3));
+  for(i = 0; i < 11; i++){
+    c = ((c - 90) + (a | 90)) + ((b & p) & (d ^ 74));
+  }
+  c = ((a ^ 17) | (d + b)) | ((a * d) ^ (a * 8));
+  a = ((a + 47) & (c & c)) ^ ((d - p) ^ (p | d));
+  if(a < c){
+    c = ((a & q) - (a + p)) | ((d * q) | (a | a));
+  }else{
+    a = ((q - 52) - (q + a)) ^ ((p + 77) * (b | c));
+  }
+  a = ((c + 66) * (q * p)) | ((c ^ 99) - (d + b));
+  b = ((c - d) - (p & 12)) - ((a & d) * (b | p));
+  d = ((b + c) - (c - a)) & ((d * 53) * (c + c));
+  for(i = 0; i < 12; i++){
+    d = ((p ^ p) ^ (d ^ 44)) | ((p ^ q) & (a + b));
+  }
+  if(b < p){
+    b = ((a * b) ^ (p - 58)) + ((q | 53) ^ (a + q));
+  }else{
+    d = ((q & 93) & (q ^ 67)) + ((p & p) ^ (b - c));
+  }
+  d = ((q * p) ^ (p - c)) - ((b ^ b) & (c | b));
+  c = ((a ^ c) - (c + 63)) - ((p - a) * (q | 95));
+  d = ((p - b) - (q + p)) - ((p | 37) & (p + a));
+  d = ((p & c) ^ (c | 97)) - ((b - 99) ^ (c & a));
+  if(a < 89){
+    b = ((c * 42) - (b * d)) ^ ((c + c) ^ (b | 61));
+  }else{
+    a = ((a | 24) & (d - b)) | ((c + d) + (q & 99));
+  }
+  for(i = 0; i < 23; i++){
+    d = ((q ^ c) ^ (q - p)) - ((q - b) | (p | p));
+  }
+  d = ((c | 99) - (d + 13)) * ((q | a) ^ (d + 6));
+  b = ((p | 40) - (p | a)) | ((b + a) + (b & b));
+  d = ((c - a) ^ (q | c)) * ((q + p) * (b + q));
+  if(d < 5){
+    b = ((b + a) * (d & p)) ^ ((p * p) + (d + a));
+  }else{
+    d = ((b + c) & (a - 42)) + ((p * 35) | (p + c));
+  }
+  b = ((a | b) - (c & c)) & ((d * c) ^ (c & q));
+  a = ((b * 66) * (q * q)) * ((a * a) ^ (b + 30));
+  for(i = 0; i < 11; i++){
+    c = ((c & c) & (c - d)) | ((c ^ d) ^ (a & p));
+  }
+  a = ((a + a) ^ (c - 27)) + ((p ^ 18) - (d + a));
+  if(a < 10){
+    a = ((q * q) + (d ^ q)) + ((d + p) - (a - a));
+  }else{
+    c = ((q + p) ^ (a | a)) - ((d - 70) + (q * 24));
+  }
+  d = ((d ^ b) ^ (b ^ p)) & ((q ^ q) - (b | d));
+  d = ((q & q) + (b * p)) | ((q * c) & (c & c));
+  c = ((a + a) & (d - b)) & ((p - c) - (p ^ 34));
+  a = ((b & b) | (q + a)) | ((q & a) + (b | 59));
+  if(d < p){
+    c = ((c - a) * (d ^ d)) ^ ((d - b) & (b * b));
+  }else{
+    b = ((a | d) ^ (q & d)) + ((c + p) | (q | d));
+  }
+  b = ((q - b) | (p ^ c)) ^ ((c & p) | (c ^ d));
+  d = ((d - q) | (b ^ p)) ^ ((b & c) ^ (b | q));
+  d = ((q * d) + (b & p)) * ((b ^ p) - (d | c));
+  a = ((d | d) + (a & d)) | ((q * 31) | (a | p));
+  if(a < c){
+    d = ((d * a) * (b & c)) ^ ((b + b) & (c ^ b));
+  }else{
+    c = ((a - p) & (q ^ b)) + ((c - d) - (b | q));
+  }
+  d = ((q - b) | (b * p)) - ((p & 44) + (c & d));
+  for(i = 0; i < 42; i++){
+    b = ((q & a) ^ (q & q)) * ((a - b) * (c ^ b));
+  }
+  a = ((c ^ a) & (c - c)) * ((p & c) - (c * a));
+  b = ((p & d) | (a - 84)) | ((a ^ b) * (a & a));
+  if(c < b){
+    a = ((c - q) & (a ^ a)) | ((c & a) | (b & 99));
+  }else{
+    b = ((c - c) ^ (a * p)) + ((c & b) - (a - 9));
+  }
+  c = ((d & q) + (a + d)) | ((q & c) * (p + p));
+  c = ((c + 73) & (a ^ b)) - ((q & 83) & (a & p));
+  a = ((b - c) - (a - a)) ^ ((q - c) | (b * 26));
+  for(i = 0; i < 30; i++){
+    d = ((c & q) & (b + q)) & ((p - 62) | (p | a));
+  }
+  if(d < q){
+    a = ((b ^ d) - (q | c)) + ((b * 75) - (p | d));
+  }else{
+    c = ((b - d) + (a & c)) + ((a ^ a) + (p & 25));
+  }
+  return a + b + c + d;
+}
+
+int func50(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 56;
+  d = 49;
+  b = ((q | 70) * (c - c)) + ((p * 25) | (b - q));
+  d = ((a - q) - (d & b)) | ((b ^ d) + (b & b));
+  b = ((q * 27) + (q | c)) | ((p & a) + (b - p));
+  d = ((a - p) * (c * a)) | ((d * c) | (c * 8));
+  if(d < a){
+    d = ((q | a) * (q - 20)) - ((a & b) & (b & d));
+  }else{
+    a = ((c & q) & (a - c)) * ((p * c) * (c - d));
+  }
+  d = ((q - 3) & (p ^ p)) | ((q + p) | (p * 23));
+  for(i = 0; i < 37; i++){
+    a = ((a & d) + (b | d)) | ((a + 46) & (a & p));
+  }
+  b = ((p * a) - (d - a)) | ((q | 54) + (d & b));
+  b = ((q * a) * (d + q)) + ((b - a) | (a | b));
+  if(c < d){
+    c = ((d * q) - (p - a)) | ((q + a) | (p | b));
+  }else{
+    d = ((q + 23) - (b | p)) - ((d | d) & (p - d));
+  }
+  c = ((a - q) | (q | d)) ^ ((b ^ 33) ^ (q ^ c));
+  a = ((c ^ d) + (a + q)) * ((d * b) - (q - 54));
+  d = ((q * 9) & (p * p)) & ((a - d) * (p ^ 84));
+  for(i = 0; i < 9; i++){
+    c = ((p + a) * (q * q)) * ((p | 81) * (p - 64));
+  }
+  if(b < c){
+    b = ((a * a) & (d & b)) ^ ((a + d) | (a & d));
+  }else{
+    d = ((a - b) - (q - 78)) + ((c & 42) | (b & a));
+  }
+  c = ((b * a) ^ (c | q)) * ((b - q) | (q * q));
+  c = ((a | c) - (q ^ a)) - ((a ^ d) & (a | 29));
+  c = ((a | q) + (p * p)) - ((a ^ q) | (a & b));
+  d = ((q * a) - (c ^ q)) | ((b ^ d) ^ (d * 67));
+  if(b < 9){
+    a = ((q | b) + (d + d)) * ((c - d) | (q ^ d));
+  }else{
+    a = ((b + d) | (a ^ 58)) | ((q + b) | (q ^ c));
+  }
+  for(i = 0; i < 22; i++){
+    d = ((p | b) ^ (q + 65)) + ((b - b) | (q ^ 53));
+  }
+  b = ((b - 88) + (p * 41)) + ((b - b) - (d & 54));
+  d = ((c | c) + (b + a)) & ((p | b) * (q & q));
+  b = ((p | a) + (p - b)) * ((q * c) * (b - c));
+  if(a < c){
+    a = ((q | b) + (d - q)) ^ ((q | d) * (p | q));
+  }else{
+    b = ((c + 15) + (q * q)) & ((b * b) - (q + b));
+  }
+  a = ((d | b) * (q & 40)) * ((d - a) + (d | b));
+  b = ((c + 33) & (b & p)) + ((a & q) * (p & 60));
+  for(i = 0; i < 16; i++){
+    c = ((q * 8) * (c ^ 52)) * ((a * p) ^ (d & b));
+  }
+  c = ((c * b) & (p & b)) + ((a | c) * (a | q));
+  if(b < b){
+    d = ((b - a) | (q ^ b)) - ((p + q) & (c | d));
+  }else{
+    b = ((p & d) - (d * b)) ^ ((d * 10) - (b + a));
+  }
+  b = ((p * 2) & (c + q)) + ((c + 2) ^ (q | 23));
+  b = ((d + a) & (c - 9)) | ((d | b) * (p | b));
+  d = ((d - q) | (b | b)) ^ ((b - 83) + (b + p));
+  d = ((p & b) - (d & 34)) - ((d | b) + (d - c));
+  if(b < b){
+    d = ((a | q) & (a | 45)) - ((p - 43) ^ (q | p));
+  }else{
+    c = ((a + p) * (a + a)) & ((b * p) + (q - 16));
+  }
+  a = ((a & 57) - (q ^ b)) - ((c & 50) * (a | b));
+  b = ((q | p) * (p + p)) ^ ((p * 79) & (a ^ 98));
+  b = ((c + c) * (d * q)) & ((c * d) ^ (c ^ b));
+  b = ((d & q) ^ (b + 25)) * ((q | 13) + (p & a));
+  if(c < b){
+    c = ((b + q) ^ (q * b)) * ((b ^ 62) - (d & d));
+  }else{
+    b = ((p * d) ^ (d ^ a)) ^ ((a & 71) * (p - a));
+  }
+  c = ((a + a) & (d * a)) & ((a & 25) - (p * c));
+  for(i = 0; i < 2; i++){
+    b = ((c | a) + (q ^ c)) - ((q | b) - (b ^ 84));
+  }
+  d = ((q & q) & (b & 7)) - ((d - 22) & (p + a));
+  d = ((b & p) & (d * q)) & ((p * c) | (p * b));
+  if(a < q){
+    d = ((p | q) - (a * a)) | ((c - d) + (a | c));
+  }else{
+    b = ((d - d) & (q & p)) * ((c * b) * (c & 92));
+  }
+  c = ((p + 77) * (b | 3)) - ((q - d) * (d * a));
+  c = ((q - 53) | (d & b)) ^ ((d ^ p) + (p ^ c));
+  a = ((b + q) | (p * p)) * ((p | 18) ^ (p ^ b));
+  for(i = 0; i < 16; i++){
+    c = ((c | q) + (p ^ a)) - ((p | b) & (c - a));
+  }
+  if(a < c){
+    c = ((c ^ p) | (q & b)) - ((q | b) | (b | a));
+  }else{
+    c = ((p * a) | (c * a)) - ((p ^ 34) - (c | 35));
+  }
+  return a + b + c + d;
+}
+
+int func51(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 16;
+  d = 72;
+  d = ((q + c) * (q * a)) ^ ((q - q) ^ (d ^ d));
+  b = ((b - b) | (b - b)) * ((a - c) & (c - 76));
+  b = ((d | 82) & (c & q)) * ((c * b) & (d + 46));
+  b = ((d | c) | (c ^ c)) ^ ((b * a) | (p + p));
+  if(a < b){
+    a = ((d - d) - (q + q)) ^ ((q | a) - (c - d));
+  }else{
+    b = ((q - d) | (b + q)) * ((d | b) * (a + q));
+  }
+  a = ((q * d) * (q + a)) * ((p * d) | (a - p));
+  for(i = 0; i < 8; i++){
+    d = ((p * d) + (p ^ 39)) & ((a * p) - (p * c));
+  }
+  d = ((q ^ 81) & (c + c)) * ((p - 59) ^ (q | a));
+  a = ((c + 94) - (a * d)) * ((q ^ a) & (q & b));
+  if(c < 13){
+    d = ((d - c) | (d ^ 66)) ^ ((a * a) & (p - 98));
+  }else{
+    a = ((c ^ b) ^ (q & d)) - ((q + d) - (d - 3));
+  }
+  a = ((b & p) - (b + 75)) * ((p - c) + (b & q));
+  c = ((a & a) & (c - q)) & ((q + a) - (c - 98));
+  a = ((p - q) & (a | 93)) & ((d - 42) + (b + d));
+  for(i = 0; i < 10; i++){
+    a = ((p ^ p) + (d | a)) & ((c ^ 25) ^ (a ^ c));
+  }
+  if(a < d){
+    d = ((a + q) ^ (b + b)) & ((c ^ 90) | (d + q));
+  }else{
+    b = ((b | a) - (c * b)) - ((q ^ 44) - (c & d));
+  }
+  c = ((d + p) - (b ^ p)) + ((a & 44) - (d | d));
+  b = ((b ^ b) & (b * 59)) * ((p - p) + (p & q));
+  c = ((b - 1) + (b | c)) * ((b * 68) * (q + q));
+  d = ((p | q) * (b - c)) * ((p * 13) + (b & b));
+  if(c < p){
+    b = ((c * c) + (a | a)) - ((b * p) ^ (b * b));
+  }else{
+    c = ((a | c) ^ (b ^ 95)) | ((a ^ d) & (d ^ b));
+  }
+  for(i = 0; i < 34; i++){
+    b = ((q - d) + (q - b)) | ((c - 85) ^ (c + 98));
+  }
+  c = ((q * b) | (d + 56)) * ((a * 27) & (p - d));
+  b = ((a & 62) ^ (q & a)) + ((c - d) + (p | c));
+  a = ((q | 62) + (b + q)) & ((c & d) * (p & d));
+  if(c < 81){
+    c = ((c | 8) | (b | q)) & ((d | 84) - (p * b));
+  }else{
+    b = ((c & a) + (p & q)) - ((d + q) * (a - b));
+  }
+  b = ((b | q) & (c | c)) + ((d * 43) * (a - q));
+  d = ((q & c) - (d & p)) + ((b + p) | (c - b));
+  for(i = 0; i < 10; i++){
+    d = ((q - a) ^ (a - b)) + ((a - 78) ^ (d - c));
+  }
+  a = ((d * 91) - (q | 31)) & ((d + 89) - (d | 65));
+  if(d < 58){
+    c = ((a | 90) ^ (a + 73)) + ((d & 4) - (p * d));
+  }else{
+    d = ((a * 3) * (q * q)) + ((b + a) ^ (d + c));
+  }
+  b = ((b * b) ^ (d ^ b)) * ((a & 82) * (q | a));
+  d = ((c ^ d) ^ (d | 19)) + ((p + d) * (q ^ d));
+  d = ((q - q) * (p | b)) - ((q & a) & (c - q));
+  a = ((q | d) | (c * a)) + ((p | 87) ^ (b - 71));
+  if(c < p){
+    b = ((b ^ p) | (q | q)) - ((q ^ 27) & (p ^ q));
+  }else{
+    c = ((p - q) * (q + c)) ^ ((q * c) ^ (q * p));
+  }
+  b = ((c | p) - (b ^ q)) - ((q * a) - (p | a));
+  b = ((b & 32) & (q + c)) - ((q * p) + (b ^ b));
+  c = ((d | 95) & (q - b)) * ((b + a) ^ (q | a));
+  a = ((p | d) + (c - b)) - ((d - p) | (d - 54));
+  if(b < a){
+    a = ((d & 15) * (d | b)) + ((b ^ d) & (d * q));
+  }else{
+    d = ((p | a) - (q & d)) ^ ((d * p) * (b & q));
+  }
+  a = ((p * q) | (d + 80)) - ((q ^ 16) ^ (d - 18));
+  for(i = 0; i < 12; i++){
+    d = ((q + q) + (a * c)) + ((c * d) + (p - c));
+  }
+  c = ((b ^ 67) * (d * 20)) ^ ((q ^ a) * (q - q));
+  b = ((a | a) - (d - a)) + ((d * p) & (q | d));
+  if(a < p){
+    b = ((b & d) ^ (p | a)) + ((q ^ 59) * (a - b));
+  }else{
+    c = ((c - c) ^ (d - c)) & ((q - c) + (q - 44));
+  }
+  d = ((d | q) & (d + 73)) | ((d * 29) ^ (c | b));
+  b = ((c | 44) + (q ^ b)) * ((p * a) - (a * c));
+  b = ((c ^ 95) ^ (a - 57)) & ((p + 77) - (a & q));
+  for(i = 0; i < 25; i++){
+    c = ((a * q) - (d | p)) & ((p ^ q) & (b & 57));
+  }
+  if(b < a){
+    a = ((b * p) - (a + d)) * ((c * 40) ^ (c | p));
+  }else{
+    b = ((b ^ 80) - (q & p)) & ((b * 28) + (a + 86));
+  }
+  return a + b + c + d;
+}
+
+int func52(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 8;
+  d = 57;
+  b = ((a | b) ^ (q * d)) & ((q & 54) - (b + 41));
+  a = ((q * c) * (d + 91)) & ((q & a) - (c + d));
+  a = ((d | 31) - (q ^ 25)) - ((q ^ p) | (d - d));
+  b = ((q ^ b) ^ (p - c)) ^ ((d | b) - (q ^ 63));
+  if(a < d){
+    d = ((a | q) & (d - 84)) - ((q - p) & (d ^ a));
+  }else{
+    c = ((q & b) + (b | p)) & ((q | b) & (a ^ p));
+  }
+  a = ((c & c) + (d & d)) ^ ((q ^ q) & (b & b));
+  for(i = 0; i < 49; i++){
+    a = ((p ^ q) | (b * c)) + ((a + a) | (d * b));
+  }
+  a = ((b | d) | (q | b)) + ((b * q) | (b * 58));
+  b = ((c | c) - (d & d)) & ((a + 42) * (a & 23));
+  if(a < p){
+    b = ((d ^ a) - (d ^ b)) ^ ((q - q) | (q - p));
+  }else{
+    b = ((a + b) * (b | 48)) - ((p | a) ^ (a - 79));
+  }
+  b = ((d * d) - (d + p)) ^ ((a - 85) ^ (c & d));
+  c = ((d + d) ^ (q & a)) ^ ((a ^ c) * (b * c));
+  d = ((p * q) & (q + p)) - ((p * b) * (p | q));
+  for(i = 0; i < 22; i++){
+    d = ((p | p) ^ (p + b)) - ((q | 25) - (d ^ d));
+  }
+  if(b < 88){
+    c = ((q ^ a) | (b | b)) * ((q + p) ^ (a - b));
+  }else{
+    b = ((a | q) ^ (d & a)) | ((b & p) * (c - a));
+  }
+  c = ((q & q) - (c * 70)) ^ ((c + 31) & (a ^ c));
+  b = ((c | p) | (c + a)) * ((a + c) | (p ^ a));
+  d = ((a ^ c) & (q * 30)) - ((b & c) & (c * p));
+  b = ((c - 11) + (b * p)) | ((d | 22) - (a ^ p));
+  if(d < d){
+    a = ((q * p) + (p & d)) ^ ((q & a) & (d + a));
+  }else{
+    a = ((c & 19) * (p & 48)) | ((d | q) + (c - c));
+  }
+  for(i = 0; i < 3; i++){
+    b = ((c - d) ^ (c - b)) - ((d + q) + (c ^ a));
+  }
+  d = ((q + d) & (b - b)) * ((c & 18) * (a ^ q));
+  b = ((b + 15) & (a * b)) ^ ((q - a) | (b * a));
+  b = ((b ^ a) * (b - q)) & ((a + p) & (d | p));
+  if(a < p){
+    c = ((p - b) - (p ^ b)) + ((q | d) ^ (c | a));
+  }else{
+    c = ((b & c) | (b * d)) & ((q - b) * (q * c));
+  }
+  c = ((p | q) ^ (p | 26)) - ((a + a) + (p + p));
+  c = ((q + b) + (p + a)) - ((p | 2) | (p & 91));
+  for(i = 0; i < 14; i++){
+    a = ((b + a) - (b & a)) - ((b & 12) * (a ^ c));
+  }
+  d = ((c - d) ^ (b & q)) | ((q * a) ^ (q | d));
+  if(d < q){
+    a = ((p - c) - (d | p)) | ((c ^ a) - (b ^ 4));
+  }else{
+    d = ((b ^ q) & (c & d)) - ((q ^ d) + (b & 1));
+  }
+  d = ((d ^ 23) + (a * b)) * ((c - b) & (c ^ q));
+  c = ((p ^ a) ^ (b + b)) & ((a | 18) - (a | b));
+  a = ((a + 83) ^ (b | c)) * ((d - q) - (p + 82));
+  a = ((q | 54) + (a - c)) * ((d + 79) | (b ^ q));
+  if(a < c){
+    a = ((p & 91) - (p * c)) + ((d * b) ^ (q - d));
+  }else{
+    c = ((d ^ 15) & (a - q)) - ((q - q) * (q ^ a));
+  }
+  c = ((c ^ p) ^ (p | q)) + ((a + c) | (a ^ d));
+  a = ((d - 89) | (q - p)) | ((a - 48) | (a * c));
+  a = ((c & 73) & (b ^ p)) | ((a * a) * (d + q));
+  a = ((a ^ 70) * (a - c)) + ((d * d) + (a | a));
+  if(b < d){
+    a = ((q | b) * (b | p)) | ((q ^ 41) & (a & b));
+  }else{
+    c = ((c | 81) & (b | a)) - ((b * a) | (c ^ 57));
+  }
+  a = ((a + b) & (a & 90)) - ((c * 16) * (c + q));
+  for(i = 0; i < 34; i++){
+    b = ((a * b) ^ (q ^ b)) + ((b - 39) - (q & d));
+  }
+  b = ((q + 2) - (q | p)) + ((b - 69) & (a + 32));
+  b = ((p ^ b) & (q + c)) | ((a & 35) - (b ^ 79));
+  if(b < 94){
+    d = ((a * 18) - (a ^ c)) & ((q | q) ^ (b - p));
+  }else{
+    c = ((q ^ q) | (d ^ p)) & ((c * a) ^ (a | d));
+  }
+  b = ((q | q) - (d + p)) + ((b & q) * (q + a));
+  d = ((p ^ 52) - (q | 7)) ^ ((b | q) - (p + q));
+  a = ((p - c) & (q ^ 74)) + ((q & q) + (q * c));
+  for(i = 0; i < 20; i++){
+    a = ((c + p) ^ (b & q)) ^ ((a & a) ^ (p | 19));
+  }
+  if(c < q){
+    a = ((a + d) * (a ^ 44)) - ((b + c) | (p & 10));
+  }else{
+    c = ((c - a) | (b ^ 24)) + ((c ^ p) & (c + c));
+  }
+  return a + b + c + d;
+}
+
+int func53(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 47;
+  d = 9;
+  c = ((b ^ 12) | (p ^ 94)) - ((q + b) | (d ^ p));
+  c = ((p + a) ^ (q ^ a)) | ((p ^ c) - (c & 83));
+  b = ((b + a) * (a & 62)) | ((d & q) | (p * b));
+  a = ((p - 29) ^ (q + q)) - ((p & a) & (q - d));
+  if(b < p){
+    a = ((c + 22) * (q + 64)) | ((p & 20) - (a & c));
+  }else{
+    b = ((a | q) ^ (d ^ 81)) * ((a * b) & (b & a));
+  }
+  a = ((c | d) * (p + d)) | ((a + d) ^ (a ^ a));
+  for(i = 0; i < 16; i++){
+    c = ((q + q) + (d * 46)) * ((p + c) * (b - c));
+  }
+  b = ((d - 33) + (b + 11)) ^ ((b ^ 6) & (c * 98));
+  a = ((q & d) * (c ^ d)) + ((c * q) | (d ^ 54));
+  if(c < d){
+    d = ((p + q) - (a - b)) & ((d + q) * (a & p));
+  }else{
+    d = ((b & c) & (a + 14)) & ((b - a) ^ (b & p));
+  }
+  b = ((q ^ c) - (d * d)) + ((p - c) - (a | d));
+  a = ((c ^ d) ^ (b ^ 87)) | ((a | c) ^ (p & p));
+  a = ((a - 42) ^ (p + 57)) ^ ((p & a) + (p | c));
+  for(i = 0; i < 38; i++){
+    a = ((c & q) & (a * p)) + ((c + 73) * (b | 42));
+  }
+  if(d < p){
+    b = ((c & p) ^ (q | 97)) - ((a | d) ^ (p | a));
+  }else{
+    c = ((b + b) - (q - b)) ^ ((p | b) * (a * d));
+  }
+  b = ((c + 37) - (a ^ p)) | ((c | a) ^ (d - d));
+  b = ((a * q) * (d ^ b)) | ((c - d) ^ (c * a));
+  a = ((d - 62) * (q & b)) + ((d | a) ^ (q & q));
+  c = ((c | c) - (c + c)) + ((q - 73) - (q ^ d));
+  if(d < a){
+    c = ((p + b) - (q * a)) + ((d * a) & (c & p));
+  }else{
+    a = ((c | 16) ^ (c * b)) | ((d | a) + (q - c));
+  }
+  for(i = 0; i < 28; i++){
+    b = ((c & q) & (b & b)) | ((a * q) & (d * p));
+  }
+  c = ((b ^ b) - (c ^ b)) + ((q & a) ^ (p - q));
+  c = ((c | q) & (a * b)) | ((d & d) + (p & 8));
+  b = ((p & c) ^ (d ^ 37)) | ((p | 9) + (p - d));
+  if(a < a){
+    c = ((d ^ d) ^ (q * c)) & ((d * p) + (c + 95));
+  }else{
+    c = ((a - q) | (q ^ c)) | ((p + c) & (a + 62));
+  }
+  c = ((b | a) * (d | c)) ^ ((c - c) - (b + p));
+  c = ((a ^ a) ^ (b & 75)) + ((d ^ 9) ^ (b - 7));
+  for(i = 0; i < 17; i++){
+    b = ((b ^ q) - (q - d)) ^ ((b * a) * (d - d));
+  }
+  c = ((q * p) | (c - q)) ^ ((b - d) - (p | c));
+  if(d < b){
+    b = ((q + b) - (a - 29)) ^ ((b | d) - (b - b));
+  }else{
+    b = ((b * a) * (b * c)) & ((q * p) & (p - p));
+  }
+  b = ((c & b) | (c ^ b)) + ((b | 34) & (b * c));
+  c = ((c + q) * (c - b)) ^ ((q + p) & (d ^ p));
+  b = ((c & p) * (b & q)) * ((p | q) + (p | q));
+  c = ((a + b) * (a ^ c)) - ((p - b) ^ (c & c));
+  if(c < 65){
+    c = ((q ^ 11) - (d + c)) + ((b & 15) ^ (p - q));
+  }else{
+    c = ((p + c) * (d - p)) ^ ((c ^ b) ^ (c | c));
+  }
+  b = ((a | p) | (d + b)) ^ ((p & c) | (c ^ a));
+  a = ((d & p) + (d | c)) | ((q ^ c) - (b ^ c));
+  a = ((q - 37) | (d * 63)) & ((b ^ d) * (d & p));
+  d = ((p + 8) ^ (d + 69)) * ((c + p) | (c * q));
+  if(b < a){
+    b = ((a | b) - (c * a)) ^ ((p * p) - (p - a));
+  }else{
+    b = ((q ^ c) ^ (q + p)) + ((c | a) * (c * d));
+  }
+  d = ((c * a) | (a & c)) + ((b + p) ^ (d + b));
+  for(i = 0; i < 48; i++){
+    c = ((c | c) + (d & q)) ^ ((b | b) ^ (d - 49));
+  }
+  b = ((b | b) + (c + a)) | ((q - 38) & (a | q));
+  b = ((q - a) - (d + q)) ^ ((d * a) + (q * p));
+  if(d < 33){
+    d = ((d + p) & (b - c)) - ((p * q) ^ (q - c));
+  }else{
+    a = ((c | a) ^ (d ^ c)) ^ ((c | p) & (d * c));
+  }
+  b = ((a - d) & (b | b)) - ((q ^ d) + (q - q));
+  a = ((d + d) | (b | a)) & ((q ^ d) | (a + b));
+  c = ((d * p) * (a - q)) & ((b + a) | (q * p));
+  for(i = 0; i < 16; i++){
+    d = ((q - c) | (q & d)) - ((d - 30) - (p + a));
+  }
+  if(a < b){
+    a = ((p ^ 2) & (c - q)) & ((b ^ p) - (c * p));
+  }else{
+    d = ((d & a) + (p + 82)) * ((p & p) - (b - 64));
+  }
+  return a + b + c + d;
+}
+
+int func54(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 89;
+  a = ((a | p) ^ (a + 37)) ^ ((a ^ 21) * (c ^ q));
+  b = ((d - p) - (b * 89)) - ((c ^ 57) | (q - p));
+  b = ((a + a) ^ (q * 13)) + ((a | 8) | (c - q));
+  b = ((a + c) + (p * 29)) & ((a & 25) - (c + a));
+  if(c < b){
+    d = ((p - 14) - (a & p)) | ((p & p) - (q | p));
+  }else{
+    d = ((b | 11) * (b ^ a)) + ((b * d) ^ (q & d));
+  }
+  b = ((b | 69) & (p - b)) & ((b ^ 83) * (a * 40));
+  for(i = 0; i < 32; i++){
+    c = ((p & 2) | (p ^ p)) - ((c - p) & (c * c));
+  }
+  d = ((q * c) - (b ^ q)) * ((a | c) ^ (q | q));
+  d = ((p + c) ^ (d - q)) | ((q & p) + (q - c));
+  if(b < q){
+    c = ((p * q) - (q & p)) - ((d - 98) - (q | 76));
+  }else{
+    c = ((d + q) * (p + d)) + ((a | d) - (p | b));
+  }
+  a = ((q * d) - (d - 56)) * ((p ^ q) ^ (c - q));
+  d = ((a * a) * (a + q)) | ((d - d) + (p & 2));
+  b = ((b & q) - (p | q)) | ((d | q) ^ (q + b));
+  for(i = 0; i < 47; i++){
+    c = ((p & c) - (a + p)) - ((p + p) & (d ^ b));
+  }
+  if(c < 1){
+    b = ((q & c) | (a + d)) - ((p & b) ^ (q | q));
+  }else{
+    a = ((a ^ c) + (c | p)) | ((d - 35) + (d - c));
+  }
+  d = ((q ^ a) * (d | d)) + ((b | q) * (q ^ 56));
+  a = ((a | b) - (c | b)) ^ ((p | 85) + (p & b));
+  b = ((d + c) | (c - d)) | ((p - 70) * (b ^ a));
+  b = ((d & b) ^ (q * p)) | ((d + b) & (a * d));
+  if(b < c){
+    a = ((q - d) & (d & c)) - ((c - c) ^ (c | 31));
+  }else{
+    c = ((b | c) + (p + a)) | ((q ^ 80) - (b + 91));
+  }
+  for(i = 0; i < 40; i++){
+    d = ((p | 95) ^ (b & b)) | ((a & q) ^ (d + b));
+  }
+  d = ((q * q) + (q ^ 51)) + ((a - q) & (d * 96));
+  a = ((a - a) + (c - p)) | ((a & 54) + (a - 68));
+  b = ((q + q) | (b + p)) | ((q ^ d) ^ (c | 32));
+  if(b < 84){
+    c = ((q | d) - (c - q)) * ((a & q) - (c ^ q));
+  }else{
+    b = ((a + b) & (q * p)) * ((a ^ q) + (c ^ 56));
+  }
+  c = ((c * p) + (p + q)) ^ ((a * 3) * (b - b));
+  d = ((a & d) - (b & b)) - ((a + a) & (a & 15));
+  for(i = 0; i < 32; i++){
+    a = ((q + d) - (p ^ b)) & ((d - c) | (p + 16));
+  }
+  a = ((q | 6) * (c | q)) - ((q | 43) ^ (q & a));
+  if(d < d){
+    a = ((a - 94) & (a & d)) | ((a - c) & (b | 32));
+  }else{
+    b = ((c * 67) * (a | c)) * ((c + b) - (p ^ 65));
+  }
+  b = ((p ^ c) | (c * p)) - ((a ^ a) ^ (q ^ a));
+  d = ((p + p) ^ (c | 62)) * ((a & a) | (a & d));
+  a = ((b & d) + (b & d)) + ((p + d) - (b & c));
+  a = ((c ^ b) * (p * q)) - ((p + b) | (p | b));
+  if(a < p){
+    b = ((c - q) ^ (c & b)) - ((c + q) + (d + 90));
+  }else{
+    d = ((b - 21) + (b & 72)) ^ ((c ^ d) + (c - q));
+  }
+  c = ((c * c) + (q * 7)) - ((d & q) ^ (q + q));
+  b = ((b | q) ^ (c - d)) - ((a * c) - (q + d));
+  b = ((b | c) | (b - c)) & ((q + b) + (b * p));
+  d = ((d * a) * (a & c)) ^ ((a & 45) | (c | c));
+  if(d < q){
+    a = ((b + d) | (d + p)) - ((d ^ p) | (b + b));
+  }else{
+    a = ((q * d) | (d - 77)) - ((q & q) | (b | a));
+  }
+  c = ((p - 24) - (c * c)) + ((p & p) * (p & 14));
+  for(i = 0; i < 33; i++){
+    b = ((a * c) - (q + 48)) - ((q + p) & (c + c));
+  }
+  d = ((c ^ b) & (c ^ 82)) | ((b & d) - (p & a));
+  d = ((q | c) - (p + a)) + ((d - p) * (d * a));
+  if(b < c){
+    b = ((b * p) ^ (d - p)) * ((p ^ 52) | (d * b));
+  }else{
+    d = ((c & c) ^ (d - c)) - ((p & p) | (q ^ c));
+  }
+  a = ((a & p) - (b & d)) | ((b ^ 2) ^ (d * 93));
+  b = ((p | d) ^ (c * p)) * ((d & a) - (c * q));
+  c = ((q & 26) + (d * q)) * ((b * b) ^ (c + d));
+  for(i = 0; i < 2; i++){
+    d = ((a | d) ^ (q + c)) * ((c + a) * (q - b));
+  }
+  if(b < b){
+    a = ((d * q) ^ (p & p)) ^ ((c * c) ^ (b ^ a));
+  }else{
+    d = ((a & p) - (a | b)) ^ ((p - 56) + (b - a));
+  }
+  return a + b + c + d;
+}
+
+int func55(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 92;
+  d = 50;
+  a = ((d - c) | (a - 55)) | ((p ^ a) ^ (b | q));
+  d = ((b | b) + (a | d)) ^ ((c | c) | (a ^ 26));
+  d = ((q * a) & (q & c)) | ((b * p) + (d & a));
+  d = ((q * q) ^ (c - c)) + ((a & a) ^ (b & 95));
+  if(d < p){
+    b = ((c & a) ^ (q * d)) - ((a ^ b) | (d * d));
+  }else{
+    a = ((a ^ p) * (q & 92)) & ((q ^ c) * (c & b));
+  }
+  c = ((q - p) ^ (q & p)) ^ ((c - q) | (b & a));
+  for(i = 0; i < 32; i++){
+    d = ((q + a) * (p & c)) | ((a | d) + (d | q));
+  }
+  b = ((d ^ p) | (q + b)) | ((p | 25) + (c & a));
+  d = ((q * q) & (q & d)) | ((a ^ p) & (p & 18));
+  if(b < p){
+    d = ((b | p) * (c * a)) - ((q ^ c) - (a | q));
+  }else{
+    a = ((b - p) | (q & a)) | ((a ^ b) - (b * 7));
+  }
+  b = ((b ^ 85) - (b & a)) - ((p - b) - (c + q));
+  a = ((c & b) * (b * a)) - ((b ^ 95) | (d & c));
+  d = ((q | a) | (q - p)) - ((c & q) | (a - a));
+  for(i = 0; i < 21; i++){
+    b = ((q - b) ^ (p | 41)) & ((b ^ a) & (q & 34));
+  }
+  if(d < 96){
+    a = ((q & a) * (q * b)) | ((q & 48) + (c | d));
+  }else{
+    d = ((b - c) | (b + 12)) ^ ((d * b) | (q & 57));
+  }
+  b = ((a - 91) & (b + 1)) + ((b + q) ^ (p + 94));
+  c = ((d | b) * (q ^ 2)) - ((d * 36) + (b + d));
+  c = ((d & d) * (a - c)) & ((c | a) & (p & c));
+  c = ((b ^ p) * (p ^ b)) ^ ((q - d) & (q - d));
+  if(b < c){
+    d = ((c ^ a) * (a * d)) * ((b | c) & (d ^ 72));
+  }else{
+    d = ((p & a) - (d & d)) + ((d ^ 14) | (q | d));
+  }
+  for(i = 0; i < 32; i++){
+    c = ((b * p) - (c & 98)) ^ ((c + 39) & (d + q));
+  }
+  d = ((p - b) & (c + 19)) - ((q + q) * (d & q));
+  b = ((b ^ c) * (c & 59)) | ((a & c) * (d - 78));
+  c = ((d * 96) ^ (p & 58)) * ((c ^ 35) - (q * c));
+  if(c < 84){
+    b = ((c * d) * (c ^ b)) & ((q + b) | (p + a));
+  }else{
+    d = ((c & q) + (b & 27)) ^ ((c + d) ^ (a & p));
+  }
+  a = ((a + 38) ^ (c - 3)) * ((q - a) * (p * 71));
+  b = ((b + p) - (b - b)) & ((p & b) ^ (b * q));
+  for(i = 0; i < 2; i++){
+    b = ((d & b) * (p + p)) * ((p & d) - (q ^ d));
+  }
+  b = ((p | 11) ^ (b ^ c)) | ((q & c) - (q - 89));
+  if(d < 52){
+    d = ((d * c) | (p ^ b)) | ((a ^ 47) & (b + c));
+  }else{
+    a = ((d | p) & (d * d)) * ((p & b) + (c | c));
+  }
+  d = ((c * 98) + (b ^ c)) ^ ((d ^ b) + (p - 89));
+  d = ((a | a) | (d - d)) ^ ((c & c) + (q + 83));
+  a = ((d & 73) * (b | 14)) ^ ((b ^ b) * (p | p));
+  a = ((q - 36) * (a + a)) - ((c ^ 39) & (a + 84));
+  if(d < d){
+    b = ((b | 80) + (p - p)) + ((c - a) & (b + c));
+  }else{
+    d = ((d + b) + (p | a)) & ((b ^ a) * (c + d));
+  }
+  a = ((c - 76) & (c + a)) - ((q | 86) + (c - q));
+  b = ((a & b) - (a ^ d)) * ((b * 29) * (d - q));
+  c = ((b * p) - (p + a)) - ((a ^ 38) | (q ^ b));
+  c = ((b * 71) + (q | q)) - ((p & b) * (q | d));
+  if(c < d){
+    c = ((a - a) * (q - p)) ^ ((a & b) & (b + p));
+  }else{
+    c = ((p * 60) & (a | 13)) + ((c * q) * (p | c));
+  }
+  b = ((c - a) + (p ^ a)) & ((d ^ b) & (d | 70));
+  for(i = 0; i < 46; i++){
+    a = ((c & a) - (p - 95)) + ((q & a) & (q - c));
+  }
+  d = ((d | 26) | (b + c)) - ((d & 76) & (c | 89));
+  b = ((b ^ 78) | (p ^ d)) - ((b & 57) + (p ^ 71));
+  if(a < 23){
+    a = ((d + d) * (a & b)) ^ ((c + p) + (d & a));
+  }else{
+    b = ((c + 74) * (c ^ c)) & ((p ^ 76) & (d - b));
+  }
+  c = ((q - p) * (p - 20)) + ((a & p) & (p * c));
+  d = ((a | 22) ^ (b | 84)) | ((d + 62) ^ (a | d));
+  b = ((b * b) & (c * a)) * ((p & b) | (c + b));
+  for(i = 0; i < 44; i++){
+    c = ((q | a) & (q ^ 65)) * ((d + p) ^ (c - 49));
+  }
+  if(b < a){
+    a = ((a - q) ^ (b + q)) * ((a - d) ^ (c * d));
+  }else{
+    b = ((p - b) + (p | p)) | ((b | 11) | (a ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func56(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 72;
+  d = 47;
+  c = ((q + b) - (q - p)) * ((b - q) - (c - q));
+  b = ((d - a) & (b * 84)) + ((q + a) | (c & p));
+  a = ((c - 6) | (c ^ p)) & ((c * p) * (p * c));
+  b = ((b - 59) - (a - 68)) | ((p - c) + (q ^ d));
+  if(c < 75){
+    b = ((d & q) | (c ^ 24)) * ((b + a) + (b + d));
+  }else{
+    d = ((p & c) - (p ^ 25)) - ((a & p) ^ (d | 57));
+  }
+  d = ((p & c) & (q * d)) | ((c ^ b) ^ (d * d));
+  for(i = 0; i < 40; i++){
+    a = ((c * p) * (c & 92)) * ((p - 17) - (c & b));
+  }
+  c = ((p * q) + (c + p)) | ((b * 26) * (a ^ b));
+  a = ((b - d) + (c | d)) * ((a + a) - (b & 34));
+  if(b < a){
+    a = ((b ^ q) ^ (a * 72)) * ((c | q) * (b + 93));
+  }else{
+    c = ((p ^ c) - (a | q)) ^ ((p + b) * (a & p));
+  }
+  c = ((p | 74) + (d + c)) & ((b * p) + (q | 60));
+  b = ((d & 16) & (q + a)) * ((c - d) + (c | b));
+  b = ((b & c) ^ (b ^ 66)) ^ ((q - b) & (c | c));
+  for(i = 0; i < 14; i++){
+    a = ((b ^ c) | (c * q)) + ((a ^ a) - (c | b));
+  }
+  if(a < p){
+    b = ((c + 45) * (q * a)) - ((a + q) & (c | q));
+  }else{
+    c = ((c + a) ^ (p | p)) + ((c & 29) * (a - d));
+  }
+  a = ((c * q) + (p - 34)) | ((d + b) * (p - p));
+  a = ((a + d) | (a + 8)) * ((d - p) * (d | q));
+  b = ((b * 23) ^ (d ^ q)) - ((d ^ a) ^ (c ^ b));
+  a = ((d & p) + (a * 15)) + ((a & p) & (b - 44));
+  if(c < c){
+    a = ((b | q) + (q | q)) ^ ((b + c) - (q - b));
+  }else{
+    a = ((b * 15) + (a + a)) + ((a ^ c) | (q | 86));
+  }
+  for(i = 0; i < 34; i++){
+    a = ((c ^ q) * (c | 17)) & ((q + q) - (q | d));
+  }
+  c = ((d - d) & (a + q)) | ((d + b) + (a & c));
+  d = ((a + d) & (d ^ d)) & ((a * c) * (d * b));
+  c = ((c + 60) - (c + d)) | ((d ^ a) | (c * d));
+  if(b < d){
+    b = ((c * d) | (c - q)) - ((q | 48) + (p - b));
+  }else{
+    c = ((q * a) + (q * 69)) * ((q - 86) ^ (p | p));
+  }
+  d = ((d | c) ^ (c + d)) - ((a * 2) & (a * 73));
+  a = ((c | 4) | (a ^ a)) - ((c - p) * (p ^ 97));
+  for(i = 0; i < 29; i++){
+    c = ((a ^ b) + (d + q)) ^ ((d + d) ^ (q ^ 15));
+  }
+  b = ((b ^ 68) + (c * 4)) | ((q & q) | (q ^ c));
+  if(c < p){
+    d = ((a | d) ^ (q - a)) | ((q * a) + (a | d));
+  }else{
+    d = ((q * q) - (a + 64)) - ((b & q) - (p & q));
+  }
+  a = ((c ^ q) & (q | q)) - ((q * 91) | (c - 49));
+  b = ((c * 67) ^ (b - q)) + ((a ^ d) ^ (a ^ 24));
+  d = ((a ^ a) ^ (c - d)) & ((c + p) | (b | p));
+  d = ((a ^ d) & (p | c)) - ((d + p) * (a & 55));
+  if(a < c){
+    b = ((c & 50) ^ (a & q)) * ((p + d) - (c | c));
+  }else{
+    c = ((d & q) - (a + 42)) + ((q & c) - (p * 78));
+  }
+  d = ((d | a) - (c - a)) + ((q - b) + (b & 32));
+  b = ((q & 47) & (b ^ p)) * ((c - c) & (b & 76));
+  d = ((a | c) + (p - a)) * ((d ^ c) & (b + c));
+  d = ((d & 99) + (d ^ 77)) ^ ((c & p) + (a - d));
+  if(b < c){
+    b = ((b * b) | (q + 78)) ^ ((a & q) & (p - a));
+  }else{
+    c = ((b * b) ^ (b ^ a)) | ((a + 14) * (a & c));
+  }
+  b = ((c * 22) ^ (b | d)) + ((b + 39) & (a ^ b));
+  for(i = 0; i < 23; i++){
+    b = ((a * 91) | (p + q)) + ((p | 80) & (b + c));
+  }
+  c = ((a + a) - (a ^ p)) & ((c & 94) + (q - a));
+  d = ((p - 3) & (d & 18)) & ((a - p) ^ (p & a));
+  if(a < 57){
+    b = ((d + p) & (p * d)) * ((c + p) + (d & c));
+  }else{
+    a = ((a | p) ^ (q & 91)) ^ ((d + q) ^ (p | 60));
+  }
+  c = ((q * 39) + (d & a)) * ((q - d) * (b + 14));
+  d = ((q * a) * (a + p)) & ((d & p) + (d | a));
+  b = ((b & d) & (a - 1)) + ((p & d) & (c | p));
+  for(i = 0; i < 33; i++){
+    a = ((q & q) ^ (p | d)) & ((a + 2) | (c | p));
+  }
+  if(a < 72){
+    a = ((p - q) | (d + a)) ^ ((d | d) * (a + d));
+  }else{
+    d = ((q | d) * (q & a)) * ((a ^ 16) + (a - a));
+  }
+  return a + b + c + d;
+}
+
+int func57(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 52;
+  d = 49;
+  c = ((c * b) & (c + a)) - ((q | b) & (b & a));
+  a = ((a - 9) | (b ^ b)) * ((d | a) & (q & a));
+  c = ((a & c) | (a * p)) & ((d - a) * (a + 5));
+  d = ((q & d) & (a + 69)) - ((q + p) | (q ^ d));
+  if(c < p){
+    b = ((d + 33) & (d & b)) - ((a ^ b) | (b | b));
+  }else{
+    c = ((d - q) & (p + a)) + ((c ^ d) ^ (p + c));
+  }
+  b = ((b & b) * (b + b)) - ((p | a) - (q - 29));
+  for(i = 0; i < 26; i++){
+    d = ((c & b) + (a | d)) & ((d * a) - (c ^ a));
+  }
+  a = ((b * c) | (b * d)) + ((d + a) - (d * p));
+  b = ((p * 20) + (a * 56)) & ((q | p) + (b | 73));
+  if(a < 57){
+    a = ((d * p) | (c ^ p)) * ((p ^ b) ^ (p - 55));
+  }else{
+    c = ((b + 7) ^ (b - q)) * ((d + a) ^ (a - 8));
+  }
+  a = ((b + q) ^ (d + d)) + ((p - c) ^ (a | d));
+  a = ((d + d) | (a - b)) + ((c & c) * (a + b));
+  a = ((c - d) + (a * q)) & ((c | d) & (c | b));
+  for(i = 0; i < 12; i++){
+    a = ((d + q) + (d * 3)) ^ ((q - d) * (q & 8));
+  }
+  if(c < 17){
+    d = ((b + b) ^ (p - d)) + ((b - q) * (a ^ b));
+  }else{
+    a = ((d + a) | (b + 24)) * ((a - d) ^ (q + 8));
+  }
+  c = ((c ^ p) + (q ^ b)) * ((q + a) & (d + b));
+  c = ((c + b) & (b & 42)) ^ ((c - b) & (d * b));
+  a = ((c - p) | (a | c)) | ((a & d) - (p * 40));
+  a = ((d - b) - (a ^ b)) & ((c + q) + (b * a));
+  if(a < c){
+    b = ((d - b) ^ (p - 5)) & ((c * b) | (d * p));
+  }else{
+    d = ((d - p) | (p + c)) + ((d | b) * (b - q));
+  }
+  for(i = 0; i < 41; i++){
+    c = ((a & p) - (p - c)) ^ ((q | q) - (p - d));
+  }
+  a = ((a + a) * (d ^ c)) - ((b | b) & (q + c));
+  c = ((d | p) ^ (a + c)) - ((p - p) - (p & b));
+  c = ((d - a) & (p ^ b)) ^ ((c * a) + (p - p));
+  if(a < 67){
+    c = ((a | p) | (q * 10)) * ((c - 23) | (b & d));
+  }else{
+    d = ((c + 63) | (q ^ 35)) - ((p - c) & (a * b));
+  }
+  a = ((p + 60) - (c | b)) & ((b | 88) * (q & c));
+  b = ((c | b) * (d * d)) - ((q - 36) + (b * b));
+  for(i = 0; i < 21; i++){
+    b = ((b & a) & (q + b)) * ((d + d) ^ (c + d));
+  }
+  c = ((d + b) * (p + b)) | ((q - 15) - (q + b));
+  if(d < c){
+    d = ((c * 53) * (p ^ 99)) | ((p & 82) & (d | 37));
+  }else{
+    b = ((c * d) | (c | p)) | ((c ^ c) - (b | p));
+  }
+  c = ((b | a) & (d * a)) * ((p * c) | (c ^ 56));
+  a = ((d ^ c) * (c - 75)) & ((d ^ b) - (d + 4));
+  c = ((b | q) * (d - b)) ^ ((a + p) * (b | d));
+  a = ((a ^ 13) | (p ^ 85)) ^ ((b * a) ^ (b + 49));
+  if(a < 78){
+    d = ((q * b) - (c * q)) ^ ((p | q) + (a | p));
+  }else{
+    b = ((b ^ b) | (q & c)) * ((d | q) * (c ^ d));
+  }
+  c = ((p & 70) + (a - b)) ^ ((d * c) & (p & 27));
+  b = ((d ^ c) - (q ^ p)) ^ ((c & b) - (d | q));
+  c = ((q | d) * (d | 17)) ^ ((b | 34) & (q | b));
+  d = ((a * b) | (d - q)) ^ ((p | b) ^ (c | p));
+  if(a < b){
+    d = ((b & b) ^ (b | b)) ^ ((q + q) * (c ^ a));
+  }else{
+    a = ((q + 11) ^ (c + 18)) - ((c + p) * (b * c));
+  }
+  b = ((q ^ 71) & (a | c)) | ((a & b) | (a - b));
+  for(i = 0; i < 16; i++){
+    b = ((d ^ a) & (q * d)) + ((a ^ q) | (a | c));
+  }
+  b = ((q * a) - (p + 77)) & ((c * d) & (d & a));
+  b = ((b * d) ^ (q - a)) ^ ((q * p) - (p - a));
+  if(c < p){
+    a = ((q * q) - (q - a)) * ((c - d) + (b * 58));
+  }else{
+    d = ((p + d) + (p | 89)) + ((d & b) ^ (b & c));
+  }
+  d = ((q & a) + (b + a)) & ((b * q) & (c & a));
+  b = ((d - q) | (p + 85)) ^ ((d * 33) - (d + p));
+  a = ((q + p) & (b - 59)) | ((d * q) ^ (a ^ b));
+  for(i = 0; i < 8; i++){
+    a = ((p - a) | (p - a)) | ((b ^ 78) * (p & d));
+  }
+  if(b < q){
+    b = ((q | c) & (d | a)) - ((a & 15) * (b + q));
+  }else{
+    b = ((c | 11) & (d ^ d)) ^ ((a | 83) ^ (b & p));
+  }
+  return a + b + c + d;
+}
+
+int func58(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 93;
+  d = 76;
+  c = ((p | c) ^ (d + q)) + ((q ^ d) + (c & b));
+  b = ((c - d) * (p | 5)) * ((q & 1) & (a | c));
+  a = ((a - c) - (q - c)) | ((d | b) & (q & d));
+  c = ((c - 77) - (d & b)) & ((p | d) + (a + 9));
+  if(b < q){
+    a = ((d * q) - (p + c)) + ((p ^ d) + (b - b));
+  }else{
+    d = ((q * q) | (d - d)) + ((d + p) * (b ^ 52));
+  }
+  a = ((b | 73) ^ (p | p)) * ((b * c) | (c * a));
+  for(i = 0; i < 13; i++){
+    c = ((q & 60) * (b * q)) * ((d * 52) - (b * q));
+  }
+  b = ((p - a) * (p - 23)) * ((d & a) ^ (c & a));
+  c = ((q + d) | (q * 17)) + ((p * 85) - (q | d));
+  if(c < b){
+    d = ((c - 86) - (c - p)) + ((b & d) + (a & d));
+  }else{
+    c = ((q - 69) * (q * a)) - ((p + a) ^ (c - 43));
+  }
+  a = ((b - q) - (q - 29)) - ((p * 17) ^ (p * b));
+  d = ((d - 25) | (c & q)) - ((d - c) ^ (c * 58));
+  c = ((q + a) & (b ^ c)) | ((d - d) * (b * a));
+  for(i = 0; i < 24; i++){
+    a = ((b | p) + (a ^ 1)) & ((b + 33) - (c + d));
+  }
+  if(a < p){
+    d = ((b * 59) + (a ^ 61)) * ((p ^ c) - (d * d));
+  }else{
+    b = ((b - q) | (d - p)) - ((c | b) - (p * p));
+  }
+  c = ((p ^ 50) & (d + a)) * ((c | c) * (b - q));
+  b = ((d ^ a) | (c - d)) & ((b | q) ^ (c + b));
+  d = ((p + c) + (c & c)) - ((q & 82) & (a + d));
+  a = ((b & d) - (c - c)) & ((p - q) ^ (a - b));
+  if(b < d){
+    b = ((q * 83) | (a * 33)) ^ ((q & q) ^ (q & 14));
+  }else{
+    d = ((b - b) ^ (q * a)) * ((d + d) ^ (p & q));
+  }
+  for(i = 0; i < 21; i++){
+    a = ((q ^ 21) | (a - 83)) - ((q | a) | (p * 57));
+  }
+  c = ((d & 77) | (d * 84)) | ((p & 37) - (q + b));
+  a = ((a * q) - (p * d)) & ((b + p) ^ (p | b));
+  b = ((b * 94) & (a ^ a)) & ((a | q) - (d * p));
+  if(b < b){
+    b = ((q & a) | (c | d)) - ((q + p) | (p ^ a));
+  }else{
+    c = ((c + q) * (q & c)) ^ ((q | d) ^ (c | d));
+  }
+  d = ((c + d) + (d ^ p)) + ((q - 49) + (b - c));
+  d = ((a ^ b) * (q - a)) ^ ((a * d) | (p * b));
+  for(i = 0; i < 16; i++){
+    a = ((d - a) * (a - b)) * ((q ^ q) - (p ^ a));
+  }
+  b = ((d ^ 53) * (q * q)) + ((b + q) & (p - 89));
+  if(a < 57){
+    c = ((d - p) * (c | 56)) + ((b - p) + (p + q));
+  }else{
+    c = ((p - 93) + (p - 85)) & ((p | 5) - (c - p));
+  }
+  d = ((a - 13) | (a ^ q)) | ((q | p) - (c - b));
+  d = ((c ^ a) | (p & p)) | ((d & 2) & (a | p));
+  d = ((p | c) + (b & q)) * ((q * a) + (d - 34));
+  b = ((c ^ 75) | (b + 68)) + ((q * 53) * (q | p));
+  if(c < 14){
+    b = ((b ^ a) - (a - q)) & ((q ^ c) - (q & b));
+  }else{
+    b = ((a & 22) ^ (b ^ 78)) & ((d - 40) & (p ^ 33));
+  }
+  b = ((b | 2) & (a + a)) * ((p * b) - (a - p));
+  b = ((d & b) & (a | q)) ^ ((a * b) & (q | 65));
+  c = ((d | p) + (a - 95)) ^ ((p * q) ^ (d | c));
+  d = ((a & c) - (p - a)) | ((d + 41) ^ (q + 2));
+  if(a < d){
+    c = ((b | d) & (a * d)) * ((c - b) * (q & a));
+  }else{
+    d = ((a - a) + (q - 41)) + ((c * q) + (a - d));
+  }
+  b = ((d & c) & (a * d)) - ((p & a) * (c * 21));
+  for(i = 0; i < 49; i++){
+    c = ((b - 63) & (d + a)) ^ ((q * a) ^ (a - d));
+  }
+  c = ((a & d) + (p + c)) | ((p ^ b) + (p ^ q));
+  b = ((a * d) ^ (b * 56)) + ((d - b) + (a * 98));
+  if(a < a){
+    a = ((b + a) ^ (c * c)) | ((d - c) ^ (b ^ p));
+  }else{
+    d = ((q | 64) * (q ^ q)) ^ ((p & b) - (a - b));
+  }
+  c = ((c | c) + (c | c)) ^ ((a ^ d) * (d - 53));
+  d = ((a * q) | (p - 14)) & ((a & 44) * (d ^ 55));
+  d = ((a + b) & (b * c)) - ((d ^ a) - (a * q));
+  for(i = 0; i < 46; i++){
+    c = ((a * 97) | (c & b)) & ((q * d) + (q & b));
+  }
+  if(b < d){
+    a = ((c * 40) ^ (q + d)) ^ ((p ^ 12) + (d + 24));
+  }else{
+    c = ((a - a) - (a & c)) + ((c * q) & (c + q));
+  }
+  return a + b + c + d;
+}
+
+int func59(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 66;
+  d = 40;
+  d = ((c ^ d) & (q - c)) & ((q - p) | (p - c));
+  a = ((d & c) * (d ^ q)) - ((a ^ 28) | (q - a));
+  c = ((c & b) | (q ^ 96)) * ((p * c) & (p | 33));
+  b = ((b * a) | (p * 60)) | ((a - 47) * (q ^ b));
+  if(b < p){
+    d = ((c + 69) & (c - p)) ^ ((c - d) - (p & a));
+  }else{
+    b = ((c | q) * (a + 66)) & ((d + c) * (b ^ d));
+  }
+  c = ((a ^ c) | (p ^ q)) | ((b * p) - (d ^ p));
+  for(i = 0; i < 26; i++){
+    c = ((q ^ p) & (a - b)) - ((d - q) + (a + 31));
+  }
+  b = ((a ^ 76) | (d - d)) | ((q & c) * (d + c));
+  a = ((b ^ a) | (q | 5)) * ((p * d) | (a ^ d));
+  if(c < 82){
+    a = ((c + q) | (c + q)) & ((p | b) ^ (a + a));
+  }else{
+    b = ((a * c) - (d - d)) - ((b * c) * (b * c));
+  }
+  a = ((p & a) + (b ^ p)) & ((p | c) ^ (b & p));
+  d = ((c ^ b) + (p - q)) + ((d | q) & (b ^ p));
+  d = ((b & c) & (d + b)) | ((d - q) ^ (a | b));
+  for(i = 0; i < 30; i++){
+    b = ((b | 73) - (a + d)) * ((q * b) * (c + p));
+  }
+  if(a < q){
+    d = ((b + b) * (a * d)) | ((d ^ c) * (p * 74));
+  }else{
+    b = ((c - 84) & (b + 49)) + ((p & 86) ^ (p + p));
+  }
+  b = ((d ^ p) - (a * c)) * ((d + a) + (d & d));
+  a = ((b - q) ^ (b & c)) & ((c * a) * (c ^ 70));
+  a = ((a + c) & (b | a)) - ((b | q) - (p ^ 52));
+  d = ((c - b) ^ (a - p)) | ((d & a) - (b & q));
+  if(c < 50){
+    a = ((b - 81) & (b + p)) * ((p & a) + (d | q));
+  }else{
+    c = ((a - 68) ^ (b ^ 9)) & ((a & d) * (a - p));
+  }
+  for(i = 0; i < 34; i++){
+    c = ((b + 33) + (p & 35)) + ((a ^ q) - (q | q));
+  }
+  d = ((d + d) + (p ^ b)) + ((q - a) + (b & d));
+  a = ((a | b) & (d * b)) * ((a | c) ^ (d + p));
+  c = ((b + b) | (b * 77)) | ((d - q) & (b + c));
+  if(a < 64){
+    d = ((p | a) + (p ^ d)) - ((c * 45) | (b & d));
+  }else{
+    b = ((q - p) + (b ^ d)) - ((p & p) | (a * d));
+  }
+  c = ((a | 93) | (a & p)) & ((p - q) + (b * q));
+  b = ((d ^ 2) - (c + 66)) | ((d & 67) + (p ^ 43));
+  for(i = 0; i < 14; i++){
+    c = ((d * p) & (d - q)) & ((b * 93) * (p & p));
+  }
+  c = ((d ^ b) + (d * q)) & ((p - d) & (q + b));
+  if(d < d){
+    c = ((c ^ c) | (b - p)) ^ ((p & d) * (c * d));
+  }else{
+    d = ((p * p) + (q + b)) ^ ((d | b) * (c ^ d));
+  }
+  a = ((a + b) | (d - p)) & ((a * b) ^ (a | a));
+  c = ((a & 90) * (q - q)) - ((a & 7) & (d - d));
+  c = ((a * 6) + (b * d)) - ((q & d) * (q ^ p));
+  d = ((q | b) & (a ^ c)) * ((a & b) * (c ^ q));
+  if(d < p){
+    b = ((d | b) + (p + c)) * ((c * q) | (c & b));
+  }else{
+    d = ((p - 52) & (q * c)) - ((c * a) ^ (c * d));
+  }
+  b = ((d | d) * (b ^ p)) & ((c | d) | (p | 79));
+  d = ((q ^ d) * (p | p)) + ((a + 91) - (c * 42));
+  d = ((c + p) * (c ^ q)) & ((q * q) + (p - 99));
+  a = ((d | b) - (c | 71)) * ((a | c) | (d ^ d));
+  if(a < c){
+    b = ((b & d) * (c ^ 36)) ^ ((c + 91) | (a ^ b));
+  }else{
+    c = ((b | 25) - (q | 44)) & ((b | p) * (a * q));
+  }
+  c = ((b - 95) - (c & p)) * ((a + 94) & (c * c));
+  for(i = 0; i < 16; i++){
+    a = ((b | p) | (p - c)) + ((b & 47) & (p - d));
+  }
+  b = ((q - c) + (a - p)) | ((d - c) & (d - 78));
+  b = ((b + c) * (q + q)) ^ ((b ^ 6) & (q | d));
+  if(c < 62){
+    d = ((q - c) * (a + q)) | ((p + 66) | (d | d));
+  }else{
+    c = ((b | 3) ^ (b ^ b)) & ((d | b) ^ (c | c));
+  }
+  a = ((p | 98) & (q - q)) * ((b | c) | (c | q));
+  a = ((q ^ c) * (d ^ p)) - ((b & b) | (q * 71));
+  c = ((q * 85) * (c ^ q)) * ((c & 86) - (q ^ a));
+  for(i = 0; i < 8; i++){
+    d = ((a | a) - (d | c)) ^ ((p & q) ^ (q * 69));
+  }
+  if(c < b){
+    b = ((p + p) - (a + a)) + ((b - 70) ^ (q ^ q));
+  }else{
+    b = ((b * 64) | (b | b)) - ((p ^ c) ^ (b - c));
+  }
+  return a + b + c + d;
+}
+
+int func60(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 46;
+  d = 18;
+  c = ((d - p) * (d | b)) | ((p + q) ^ (a & b));
+  d = ((c & q) * (d * p)) + ((d | 60) ^ (q * c));
+  d = ((p - q) + (d + a)) * ((b | a) * (d | b));
+  a = ((d & 85) * (p ^ q)) | ((b + d) * (p & 42));
+  if(c < 3){
+    c = ((p - c) & (p + c)) * ((q & 93) ^ (b + 24));
+  }else{
+    c = ((d * 85) - (a & a)) - ((c * d) | (c & b));
+  }
+  a = ((b - c) | (c * 89)) - ((c * c) | (b - q));
+  for(i = 0; i < 12; i++){
+    d = ((b + c) + (q * 12)) * ((q + p) & (a + c));
+  }
+  b = ((p * q) & (c * d)) * ((p & q) - (p - c));
+  b = ((p + 79) * (d & p)) & ((c - b) * (b & b));
+  if(d < 52){
+    b = ((b * b) + (d * c)) * ((q * q) - (q ^ q));
+  }else{
+    d = ((d & d) + (p ^ b)) + ((a | 74) | (d | 98));
+  }
+  d = ((p + a) - (b ^ d)) | ((q ^ q) & (q ^ c));
+  b = ((c - d) + (q & 64)) - ((c & q) ^ (a - a));
+  b = ((p & d) * (c - 58)) & ((d - a) & (b ^ a));
+  for(i = 0; i < 19; i++){
+    d = ((q - 29) ^ (p * p)) ^ ((q ^ b) & (b ^ b));
+  }
+  if(c < c){
+    a = ((p & 88) - (b ^ p)) | ((c ^ c) + (q & p));
+  }else{
+    a = ((p ^ c) & (d & b)) | ((a + p) * (q ^ b));
+  }
+  b = ((d & 53) * (q + d)) - ((p & a) - (p - 98));
+  b = ((d | b) - (a | q)) - ((d * p) & (b & 26));
+  b = ((q * q) ^ (q + d)) ^ ((c + 21) + (c + 32));
+  d = ((d - c) - (a + d)) | ((d - 71) - (q | b));
+  if(b < b){
+    d = ((q & c) * (a | d)) - ((q | a) ^ (d + q));
+  }else{
+    d = ((a + q) * (c | a)) | ((d | p) - (b | q));
+  }
+  for(i = 0; i < 4; i++){
+    b = ((c ^ b) - (p - q)) * ((c - d) ^ (a ^ b));
+  }
+  a = ((q * c) ^ (c ^ q)) | ((d + a) * (a | d));
+  a = ((c & p) * (d * d)) & ((p - b) - (a - d));
+  c = ((d | c) ^ (d | p)) - ((q - d) * (a * b));
+  if(a < p){
+    c = ((q * b) & (b & 11)) * ((b ^ a) - (c + a));
+  }else{
+    b = ((d + q) - (p ^ 87)) * ((p ^ q) + (d * b));
+  }
+  c = ((d - b) & (d & b)) ^ ((a - 79) | (q - d));
+  c = ((q + b) ^ (b - d)) | ((p + d) & (a & p));
+  for(i = 0; i < 24; i++){
+    c = ((c + a) ^ (q + b)) ^ ((b + a) - (c & b));
+  }
+  c = ((c - d) - (q ^ 55)) - ((a | p) + (c & 53));
+  if(b < q){
+    b = ((a & 17) | (d + 7)) & ((c & b) + (q & 25));
+  }else{
+    c = ((q & a) - (a - d)) * ((a & d) ^ (p & q));
+  }
+  b = ((c ^ c) | (p * 18)) - ((q ^ a) | (c + a));
+  c = ((a & b) & (a | 5)) ^ ((p | c) * (q * d));
+  a = ((c * c) + (d - q)) & ((q ^ a) - (q + 53));
+  a = ((q | 76) | (a - d)) - ((d | d) * (b | b));
+  if(d < a){
+    d = ((a ^ a) + (q * d)) + ((a & a) * (a + 88));
+  }else{
+    a = ((a * q) - (p + c)) | ((p + c) | (p | 35));
+  }
+  a = ((a | p) | (a | b)) + ((p - 9) - (c + a));
+  a = ((c & d) + (d | c)) ^ ((d - d) ^ (d - a));
+  b = ((q + q) - (c + a)) ^ ((q ^ 66) * (b + 86));
+  b = ((q - p) ^ (d - a)) ^ ((q * c) * (c ^ b));
+  if(a < p){
+    c = ((p * 39) ^ (a * 10)) + ((a * 54) & (q + 67));
+  }else{
+    b = ((c & d) ^ (d & a)) ^ ((p | p) ^ (b ^ b));
+  }
+  d = ((d ^ a) | (a - b)) + ((p | a) & (q - 89));
+  for(i = 0; i < 47; i++){
+    a = ((d - q) ^ (d & a)) * ((c ^ 12) & (b * a));
+  }
+  a = ((a - a) - (p - 21)) - ((d - 32) + (c | 32));
+  d = ((c & a) ^ (d - a)) ^ ((b + q) - (b * a));
+  if(d < a){
+    c = ((p - c) * (b & a)) + ((p ^ 9) * (p + b));
+  }else{
+    c = ((a ^ p) & (a ^ q)) ^ ((d & a) * (c - b));
+  }
+  c = ((p | d) - (q | 37)) | ((d - 55) - (p & c));
+  d = ((d ^ p) | (q ^ a)) & ((p + b) + (c & p));
+  b = ((p * 79) & (q - b)) | ((c ^ p) ^ (b + 7));
+  for(i = 0; i < 37; i++){
+    d = ((a * a) * (b * d)) * ((q * a) & (a ^ q));
+  }
+  if(c < d){
+    a = ((c | c) + (a * d)) ^ ((b & d) & (d - d));
+  }else{
+    c = ((d | 38) & (a + d)) ^ ((c * a) | (p ^ 72));
+  }
+  return a + b + c + d;
+}
+
+int func61(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 56;
+  d = 5;
+  a = ((c * p) | (p ^ q)) - ((d ^ d) & (b + 9));
+  c = ((d + p) - (b & p)) - ((c - c) & (c * a));
+  a = ((c | 22) * (d | a)) | ((q | 43) + (b ^ q));
+  a = ((d + d) - (d & b)) & ((c - b) - (q * p));
+  if(c < b){
+    c = ((a * a) - (d | 23)) * ((d | c) | (a * b));
+  }else{
+    b = ((a & d) ^ (d ^ d)) ^ ((b * a) | (c & q));
+  }
+  a = ((p & c) + (p | q)) ^ ((b & c) ^ (a ^ 76));
+  for(i = 0; i < 37; i++){
+    d = ((q & 60) | (q | a)) | ((q + 6) & (d ^ q));
+  }
+  b = ((d | b) * (c + a)) & ((c - d) | (p & d));
+  a = ((b + b) & (a - b)) & ((p & d) ^ (c + b));
+  if(d < a){
+    d = ((c * a) * (a ^ d)) | ((b - p) - (p + p));
+  }else{
+    c = ((c ^ p) ^ (q & c)) * ((d * b) * (q * c));
+  }
+  b = ((p ^ q) ^ (b + p)) * ((d + q) | (p & c));
+  a = ((p & q) + (b + 46)) * ((b | 64) * (d + 38));
+  d = ((a | b) + (p & p)) - ((d + c) & (q & d));
+  for(i = 0; i < 6; i++){
+    d = ((a | p) * (p - c)) & ((a + a) * (b * q));
+  }
+  if(c < c){
+    c = ((q + b) ^ (c ^ p)) * ((b | d) ^ (a ^ p));
+  }else{
+    a = ((c - q) & (c & a)) + ((p * a) ^ (a & 56));
+  }
+  c = ((b & 58) ^ (c - c)) + ((c + q) | (q | b));
+  a = ((d & p) - (b * p)) + ((q | a) | (q | p));
+  c = ((q ^ b) + (b - p)) + ((a | 15) - (q | b));
+  d = ((q + a) | (d + b)) | ((a - q) | (d * c));
+  if(c < b){
+    d = ((b - p) - (b * d)) * ((a & d) ^ (q | b));
+  }else{
+    b = ((p * a) + (q & c)) + ((a * p) - (d - 91));
+  }
+  for(i = 0; i < 10; i++){
+    c = ((p ^ d) * (c & 43)) ^ ((b & q) ^ (a - p));
+  }
+  b = ((q ^ 46) ^ (d ^ p)) ^ ((d - q) - (p - p));
+  c = ((a | 42) - (b ^ a)) * ((p & d) | (q | b));
+  b = ((c - 59) & (c | 63)) + ((a + b) * (p * p));
+  if(c < p){
+    b = ((b - 21) - (q * c)) ^ ((c ^ b) & (a ^ 63));
+  }else{
+    d = ((d & b) ^ (q - p)) ^ ((p & d) & (b - 1));
+  }
+  b = ((q + p) * (b - a)) ^ ((b * b) ^ (a - 98));
+  b = ((d | d) ^ (d & d)) ^ ((p - d) * (q ^ 42));
+  for(i = 0; i < 39; i++){
+    c = ((c ^ 27) - (a ^ 10)) + ((c + a) & (c | a));
+  }
+  c = ((q & b) ^ (b * 64)) + ((p + 72) - (a * 52));
+  if(d < q){
+    a = ((d - a) | (b ^ q)) + ((p + 6) & (c | q));
+  }else{
+    a = ((q * 79) * (q * 50)) | ((p | p) ^ (b * 61));
+  }
+  a = ((b | 14) ^ (c + 71)) & ((q ^ b) + (p & p));
+  a = ((p * d) * (q + d)) & ((b + a) - (p * a));
+  a = ((d ^ 89) & (a + q)) ^ ((p | d) | (q + p));
+  c = ((d * p) & (b | 48)) + ((d + a) * (q | q));
+  if(b < c){
+    d = ((c & p) * (p | c)) | ((a ^ a) & (b | a));
+  }else{
+    a = ((q & b) & (b + a)) | ((b - 61) | (a * a));
+  }
+  c = ((b + 44) ^ (b - b)) * ((q & c) | (q * p));
+  b = ((a * 33) * (q | p)) & ((b - 81) - (c + 95));
+  c = ((a ^ 56) - (q + 27)) - ((a ^ d) ^ (a - q));
+  a = ((a + 48) ^ (a ^ d)) * ((a | c) - (c & d));
+  if(c < c){
+    a = ((a | q) - (p + a)) + ((q & d) ^ (q & 55));
+  }else{
+    c = ((b - a) & (b + d)) | ((d ^ 29) + (a + d));
+  }
+  c = ((b * 54) & (a | c)) * ((a | q) & (a & c));
+  for(i = 0; i < 33; i++){
+    a = ((c - p) ^ (c & 97)) - ((a | 78) + (b | a));
+  }
+  a = ((p + d) + (c | c)) - ((p + 72) ^ (b + q));
+  a = ((a + 22) ^ (d ^ d)) + ((q + 21) - (p - 90));
+  if(b < c){
+    a = ((c * q) ^ (a - p)) ^ ((a + p) | (d + q));
+  }else{
+    c = ((c ^ c) ^ (p - 77)) + ((p | p) | (c + a));
+  }
+  b = ((c ^ 3) - (c | q)) * ((b - a) - (b ^ 28));
+  b = ((b + c) & (d ^ c)) ^ ((p ^ 92) - (a - b));
+  b = ((b * 13) & (b & q)) | ((p * b) ^ (a - d));
+  for(i = 0; i < 35; i++){
+    c = ((d - 64) | (a + d)) ^ ((a | b) & (d & b));
+  }
+  if(a < c){
+    b = ((q & 25) * (c - 66)) | ((q - 24) - (c + a));
+  }else{
+    c = ((p + 94) + (p | 20)) ^ ((p ^ p) + (p + b));
+  }
+  return a + b + c + d;
+}
+
+int func62(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 12;
+  d = 88;
+  a = ((b & d) * (a | c)) * ((d ^ a) * (a + b));
+  c = ((d + c) | (d - d)) * ((a * b) - (q ^ a));
+  a = ((c | p) - (q - a)) ^ ((b & a) & (p | 5));
+  b = ((d & c) * (q * c)) & ((q + p) ^ (p & b));
+  if(a < p){
+    c = ((p * a) & (q & 43)) + ((q - 83) - (a - a));
+  }else{
+    d = ((p * a) * (b + d)) + ((a ^ q) * (a - q));
+  }
+  c = ((c - c) - (q * q)) - ((a * a) * (q & q));
+  for(i = 0; i < 16; i++){
+    b = ((b * c) ^ (q * q)) - ((b + 57) * (b * a));
+  }
+  a = ((c & b) + (a + b)) ^ ((q ^ q) - (d | 63));
+  c = ((d + p) * (q + 55)) ^ ((q + 4) | (p ^ b));
+  if(c < q){
+    a = ((c + b) | (c & b)) | ((p - p) - (q | c));
+  }else{
+    c = ((b ^ 58) | (b + d)) ^ ((p + c) & (a ^ a));
+  }
+  d = ((q + a) - (a + d)) ^ ((q ^ 2) ^ (a + a));
+  c = ((b + b) + (b & b)) - ((q ^ p) | (q - d));
+  c = ((p * c) - (q ^ b)) ^ ((a | 31) * (d & c));
+  for(i = 0; i < 17; i++){
+    b = ((c ^ a) - (d - a)) & ((d & c) - (p - 25));
+  }
+  if(d < p){
+    c = ((c ^ 78) - (a - a)) + ((c * b) ^ (p & q));
+  }else{
+    c = ((q ^ q) | (b - a)) - ((c * b) ^ (a | 28));
+  }
+  a = ((p * 9) + (d | q)) + ((b | c) | (a * b));
+  c = ((a * q) + (q + 97)) | ((c * d) + (q + b));
+  b = ((c + 32) * (p - b)) * ((c ^ q) + (q | 90));
+  b = ((q & 25) * (b * c)) * ((d & p) & (b & c));
+  if(d < q){
+    c = ((q & c) - (a & p)) * ((p & p) & (a & b));
+  }else{
+    a = ((p * 20) & (p & p)) ^ ((d + a) - (d ^ b));
+  }
+  for(i = 0; i < 13; i++){
+    d = ((p & a) - (a * p)) & ((d ^ q) ^ (q - q));
+  }
+  c = ((d + d) + (b & 22)) | ((p * 2) - (p | b));
+  a = ((d - c) & (c + q)) + ((q * q) - (p * a));
+  d = ((a - 67) + (a + 54)) | ((d - p) & (a & q));
+  if(c < d){
+    c = ((p ^ c) + (d | 54)) ^ ((b & c) - (d | b));
+  }else{
+    b = ((p * b) * (c ^ b)) - ((q | 69) ^ (q + 83));
+  }
+  a = ((p - a) & (p & d)) ^ ((c + b) * (p - b));
+  d = ((d & 26) & (a * q)) - ((p * d) | (d ^ 34));
+  for(i = 0; i < 25; i++){
+    a = ((p & a) * (c + b)) - ((b | c) * (q + d));
+  }
+  a = ((q & q) + (a & p)) * ((b + p) * (d | p));
+  if(d < q){
+    c = ((b ^ 66) & (p ^ d)) - ((p & q) & (b + q));
+  }else{
+    c = ((p ^ q) * (d - a)) * ((a * 33) | (p * q));
+  }
+  d = ((q + 7) - (b - c)) + ((p - c) - (b | a));
+  c = ((d + b) & (a ^ a)) - ((b & b) | (b + c));
+  b = ((d ^ d) + (d ^ 23)) - ((c * d) | (d | a));
+  d = ((q * b) | (b * 88)) + ((b ^ d) * (p ^ q));
+  if(a < p){
+    a = ((c | d) | (b & a)) & ((b + a) - (p + p));
+  }else{
+    a = ((q | 50) * (b - a)) & ((p * d) + (q + c));
+  }
+  c = ((c - c) & (c | 38)) * ((a ^ p) * (p | q));
+  c = ((c & c) & (c * p)) ^ ((p | d) - (c + d));
+  d = ((a - p) & (a + p)) - ((c * a) - (b - q));
+  c = ((a | b) * (p * b)) + ((d | 5) * (p & a));
+  if(a < a){
+    c = ((p + 10) * (p * b)) * ((q + p) | (b | b));
+  }else{
+    a = ((d + b) | (p & 53)) - ((p & 53) ^ (a * b));
+  }
+  d = ((c - b) ^ (p * q)) * ((a ^ c) ^ (a - p));
+  for(i = 0; i < 30; i++){
+    b = ((d + b) + (b - d)) * ((c * q) ^ (a ^ p));
+  }
+  b = ((d + 11) ^ (a ^ d)) * ((q & p) - (d - a));
+  a = ((b * p) | (a + 39)) - ((d * d) ^ (p & 49));
+  if(d < c){
+    d = ((p + b) + (c * a)) - ((c | b) & (d + d));
+  }else{
+    a = ((q | a) & (d - 14)) ^ ((p + c) | (c - c));
+  }
+  c = ((b | d) * (b ^ q)) & ((a * 80) | (b * b));
+  c = ((b ^ p) * (b | 65)) & ((a * d) & (p * 45));
+  c = ((d + c) | (a + a)) & ((p - 14) | (p + b));
+  for(i = 0; i < 8; i++){
+    d = ((c & d) & (a ^ p)) + ((d ^ d) ^ (c * c));
+  }
+  if(c < d){
+    c = ((d | d) & (c + p)) ^ ((d + b) | (q - c));
+  }else{
+    d = ((d - d) & (p * d)) - ((a + 47) | (q + 64));
+  }
+  return a + b + c + d;
+}
+
+int func63(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 25;
+  a = ((b | a) - (a * p)) - ((a + p) | (p & a));
+  c = ((p + p) - (b - a)) | ((b - 40) * (a ^ p));
+  b = ((d & 97) & (b & d)) * ((q + d) & (c | a));
+  b = ((d & q) | (q + a)) & ((b - p) | (b + a));
+  if(c < a){
+    c = ((q ^ b) | (b | d)) - ((d + c) + (q + a));
+  }else{
+    c = ((p * q) ^ (d ^ q)) * ((a + p) * (c + 69));
+  }
+  b = ((b & p) * (q * c)) | ((p ^ p) | (d + d));
+  for(i = 0; i < 18; i++){
+    b = ((a | p) | (c - b)) - ((b + 83) - (c - a));
+  }
+  a = ((d + 3) & (a - p)) | ((b | 72) | (a + d));
+  c = ((p + c) + (q - 43)) + ((b | d) | (a & q));
+  if(c < 19){
+    d = ((p ^ d) ^ (c & 62)) | ((b & d) * (d + d));
+  }else{
+    b = ((c + q) - (p & c)) & ((p * q) & (a * a));
+  }
+  c = ((a | d) ^ (p ^ b)) * ((q + d) * (d & 97));
+  a = ((c ^ q) ^ (q ^ b)) * ((q - 91) & (a | d));
+  c = ((c & 30) | (b + 36)) ^ ((q * p) + (a * q));
+  for(i = 0; i < 30; i++){
+    a = ((a * 34) + (q ^ a)) ^ ((d | q) * (c & p));
+  }
+  if(c < 84){
+    c = ((b ^ a) * (b * 38)) + ((p - b) - (p + c));
+  }else{
+    d = ((b * b) ^ (d * q)) ^ ((a ^ c) ^ (a | a));
+  }
+  d = ((q ^ 40) ^ (d * q)) - ((c - p) + (a & d));
+  b = ((a - b) ^ (q + b)) - ((b ^ 68) + (a | a));
+  d = ((a - p) + (b + a)) - ((c * b) + (q & p));
+  d = ((c * 75) | (b * p)) * ((p ^ q) | (p & p));
+  if(d < a){
+    d = ((p + c) ^ (b + c)) + ((a ^ a) ^ (a - 30));
+  }else{
+    d = ((b + p) ^ (c - b)) ^ ((d + a) - (c | d));
+  }
+  for(i = 0; i < 25; i++){
+    c = ((c * 9) | (c + 64)) - ((a - q) ^ (p - a));
+  }
+  c = ((p & b) + (b * 57)) & ((b & c) ^ (d - 1));
+  c = ((a ^ p) - (a & 90)) ^ ((p - c) * (d ^ d));
+  a = ((d | q) + (p | 15)) * ((p & p) * (c * a));
+  if(c < p){
+    d = ((q | p) * (p - d)) ^ ((d * 11) ^ (b * q));
+  }else{
+    c = ((b + 52) + (b - 8)) & ((a - c) & (c & 55));
+  }
+  b = ((a + d) * (b * a)) + ((b * 2) - (c & d));
+  a = ((d + a) & (q | d)) ^ ((b | 89) ^ (q + a));
+  for(i = 0; i < 12; i++){
+    c = ((b + b) | (q ^ p)) | ((p * b) - (d * a));
+  }
+  d = ((a | a) & (c * 78)) ^ ((a * a) - (b ^ c));
+  if(c < d){
+    d = ((b ^ a) & (b + c)) & ((p ^ d) ^ (q + p));
+  }else{
+    b = ((q - 70) ^ (c & q)) + ((p + q) - (a ^ q));
+  }
+  c = ((d | a) + (q & q)) - ((d * 17) | (a & b));
+  d = ((b * a) | (p + d)) + ((q - d) + (b * 44));
+  c = ((q | c) | (b + 41)) ^ ((d & 7) - (p * b));
+  a = ((a - 41) - (c * b)) - ((q | b) & (a * b));
+  if(d < 86){
+    c = ((d * b) * (c | q)) + ((p | p) + (a ^ 89));
+  }else{
+    d = ((b ^ c) ^ (d | d)) + ((a ^ q) ^ (a & 69));
+  }
+  a = ((b | b) - (p - d)) * ((p + d) * (d - 49));
+  b = ((d - b) - (c + a)) - ((p & d) & (b - d));
+  d = ((q * 36) + (a + 89)) ^ ((d + 69) + (q + c));
+  d = ((c & 53) ^ (q | c)) & ((p | d) - (a * 42));
+  if(b < b){
+    a = ((b + p) ^ (p & b)) * ((d + c) - (c | p));
+  }else{
+    b = ((q + q) | (b | d)) - ((b & b) & (d - p));
+  }
+  c = ((c | p) | (p | p)) & ((d | a) | (q - p));
+  for(i = 0; i < 22; i++){
+    d = ((c | 11) * (a | 18)) * ((c - 65) + (q & q));
+  }
+  d = ((p & q) ^ (p | d)) & ((d | c) | (q ^ 63));
+  a = ((c - c) ^ (d | c)) ^ ((a & b) - (c | c));
+  if(c < p){
+    c = ((p - p) ^ (d | b)) - ((d | 29) ^ (c * q));
+  }else{
+    c = ((c - 51) * (d + q)) | ((b ^ 61) * (b | p));
+  }
+  b = ((b - p) * (c ^ c)) ^ ((q | 27) & (a & c));
+  d = ((q & q) ^ (a ^ q)) ^ ((c | a) * (a | p));
+  d = ((b + b) | (b ^ b)) ^ ((c + d) | (a | a));
+  for(i = 0; i < 35; i++){
+    d = ((a | 43) * (a + a)) | ((p ^ 23) * (b * 74));
+  }
+  if(c < c){
+    c = ((p | 18) ^ (a & p)) & ((p & c) & (p & 49));
+  }else{
+    b = ((p ^ c) & (d ^ p)) | ((a - d) | (c ^ q));
+  }
+  return a + b + c + d;
+}
+
+int func64(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 6;
+  d = 5;
+  d = ((b * d) - (d ^ 6)) + ((q - a) ^ (d | c));
+  b = ((c * b) ^ (a ^ 35)) & ((a | c) & (q * d));
+  a = ((c * 70) & (p + b)) - ((d | a) * (q | a));
+  c = ((b * q) ^ (b ^ q)) * ((q | 36) * (q ^ d));
+  if(a < 31){
+    d = ((d * 78) ^ (a & 65)) + ((a + 45) | (c ^ q));
+  }else{
+    a = ((c | d) + (p - a)) - ((q + b) - (a | q));
+  }
+  d = ((c - p) * (b + b)) * ((p * a) ^ (q + c));
+  for(i = 0; i < 35; i++){
+    b = ((b | 55) - (p + d)) - ((q - d) * (b * b));
+  }
+  a = ((b + c) - (p * d)) + ((q + b) + (b + 6));
+  c = ((c & a) + (p * d)) & ((p + 55) + (d | d));
+  if(c < 65){
+    d = ((c ^ 5) & (a & q)) * ((c & 74) * (p | p));
+  }else{
+    a = ((p * b) ^ (d ^ 60)) + ((d & p) & (q & a));
+  }
+  d = ((c ^ a) + (q | q)) + ((c - 58) * (d | b));
+  c = ((b | 25) - (p & a)) + ((p + d) & (q & d));
+  b = ((q - 36) ^ (p | d)) * ((d * a) | (c & 47));
+  for(i = 0; i < 6; i++){
+    c = ((q | d) ^ (d + c)) + ((c | a) + (c - q));
+  }
+  if(c < 41){
+    d = ((q * 7) - (p * 31)) + ((p ^ q) + (q ^ a));
+  }else{
+    b = ((q * d) | (d ^ a)) - ((b ^ c) ^ (c & 29));
+  }
+  c = ((a * q) - (p + a)) + ((c ^ a) & (a + a));
+  d = ((b ^ d) * (b & d)) ^ ((p + c) - (d - p));
+  a = ((a + d) - (q ^ b)) + ((b | q) | (c - p));
+  d = ((q - p) & (p + p)) + ((c * b) ^ (q + q));
+  if(a < p){
+    c = ((b | b) & (a & p)) - ((a * 13) * (d * q));
+  }else{
+    c = ((q & c) + (b & b)) - ((p & p) + (d - q));
+  }
+  for(i = 0; i < 48; i++){
+    d = ((b & 46) * (b * b)) * ((b | 51) & (p | q));
+  }
+  b = ((a ^ c) & (d & 73)) + ((b * d) - (a & 59));
+  b = ((q - c) | (c | a)) + ((d - p) + (p * c));
+  c = ((d | a) + (b | d)) - ((a * 36) | (d * 63));
+  if(b < c){
+    d = ((q + 17) + (p - 56)) + ((a * c) | (a ^ 38));
+  }else{
+    b = ((c ^ b) - (c ^ 79)) ^ ((p * 4) + (p * b));
+  }
+  c = ((a * 80) ^ (b ^ a)) | ((q & 39) & (d | a));
+  b = ((d + q) ^ (c + 65)) | ((d ^ 73) + (d & 28));
+  for(i = 0; i < 40; i++){
+    d = ((d | b) * (c | d)) + ((b ^ 70) * (a - 92));
+  }
+  b = ((d ^ c) ^ (b ^ b)) - ((b ^ c) ^ (a ^ 57));
+  if(d < 35){
+    d = ((q | a) - (b ^ d)) - ((d - d) | (d | d));
+  }else{
+    a = ((c & c) & (p & a)) ^ ((q * d) ^ (d ^ a));
+  }
+  b = ((p & p) - (a ^ 65)) ^ ((p & a) & (b | q));
+  c = ((c & a) | (b ^ 87)) | ((c + 61) * (c - b));
+  b = ((q * a) * (q - d)) * ((a | d) - (d * q));
+  d = ((a | q) ^ (a - a)) + ((d - 2) ^ (a | 46));
+  if(b < a){
+    a = ((p | c) + (b - 92)) & ((a + b) * (b - 25));
+  }else{
+    b = ((b + b) ^ (p + a)) - ((a | q) * (d | d));
+  }
+  a = ((d * 82) ^ (a * 35)) * ((b * a) ^ (b * a));
+  c = ((d | a) - (p + a)) | ((p * 98) ^ (q | q));
+  c = ((c & p) + (c + q)) * ((c & 74) + (b ^ 13));
+  c = ((b & 11) + (c & b)) & ((c | a) | (d | q));
+  if(a < d){
+    a = ((q & c) | (a ^ q)) * ((p + q) ^ (c | q));
+  }else{
+    d = ((p - b) - (p & 56)) - ((d & d) & (c - a));
+  }
+  b = ((a ^ 74) | (a | 83)) ^ ((d + 2) * (p ^ 24));
+  for(i = 0; i < 18; i++){
+    d = ((c - q) & (d + d)) * ((a & q) + (a * p));
+  }
+  c = ((q & c) & (b - d)) & ((b - q) * (q & b));
+  d = ((q & b) - (a * 15)) ^ ((b & d) | (b * c));
+  if(a < d){
+    d = ((b * q) ^ (d * 31)) - ((d ^ 15) + (b - d));
+  }else{
+    d = ((p ^ b) - (a | 97)) - ((b | 22) + (d + c));
+  }
+  d = ((d ^ p) | (b | c)) - ((b * d) + (q ^ c));
+  d = ((d - q) * (b + q)) ^ ((q * 48) ^ (p - q));
+  c = ((b - q) + (c & b)) ^ ((q * c) * (p ^ b));
+  for(i = 0; i < 47; i++){
+    d = ((q ^ b) & (p | b)) ^ ((d + p) * (a * 76));
+  }
+  if(a < 91){
+    a = ((p | b) * (c + 31)) + ((q & 2) + (d & 55));
+  }else{
+    b = ((p & 54) * (c | c)) + ((p * a) * (q & 14));
+  }
+  return a + b + c + d;
+}
+
+int func65(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 98;
+  a = ((d | 47) | (d + p)) & ((c - c) * (d & a));
+  d = ((d & b) - (d + c)) - ((a - p) ^ (p - 19));
+  b = ((c & b) ^ (p | a)) & ((a | 52) & (q | p));
+  d = ((c * p) & (b | b)) * ((b - d) | (d & q));
+  if(c < 42){
+    c = ((d + p) | (q * 44)) - ((q + 80) & (c + q));
+  }else{
+    c = ((p & d) & (q | q)) & ((p | d) ^ (q * q));
+  }
+  c = ((d * q) & (d ^ a)) - ((c | q) + (c - 47));
+  for(i = 0; i < 39; i++){
+    a = ((p | 65) & (q - d)) - ((b ^ d) & (q + a));
+  }
+  d = ((c + q) ^ (p + b)) ^ ((a + p) + (b & q));
+  c = ((d | p) | (a | 77)) ^ ((b + p) - (b + p));
+  if(b < b){
+    a = ((c & b) & (a ^ b)) & ((a * d) - (q & a));
+  }else{
+    d = ((p & c) & (p * b)) + ((c - p) ^ (a * b));
+  }
+  a = ((c * a) ^ (b * 91)) - ((b * q) - (p * d));
+  a = ((c + p) ^ (c & b)) & ((d + p) + (p - p));
+  b = ((c * 54) + (p & p)) & ((q - b) + (a & 63));
+  for(i = 0; i < 7; i++){
+    a = ((p | p) & (c ^ a)) ^ ((d & q) + (p & p));
+  }
+  if(c < a){
+    b = ((b * 84) + (a & 41)) ^ ((d ^ 81) * (a * 37));
+  }else{
+    a = ((a | 90) * (c & 3)) * ((q & b) + (d + d));
+  }
+  a = ((q | 82) | (a & 33)) | ((p & p) ^ (d + a));
+  c = ((p | b) & (q | 89)) & ((c | 41) - (c - q));
+  c = ((b & b) | (c & d)) ^ ((d ^ p) ^ (q & p));
+  d = ((a - b) & (q - p)) * ((c * d) + (p & a));
+  if(b < p){
+    d = ((a - q) - (c ^ d)) - ((c + d) * (q & 8));
+  }else{
+    a = ((c & a) ^ (c ^ 41)) | ((c | q) | (c * 48));
+  }
+  for(i = 0; i < 36; i++){
+    d = ((c + p) * (q & p)) | ((a + 39) + (q ^ b));
+  }
+  d = ((q & 26) - (a ^ p)) * ((a + b) ^ (b & q));
+  b = ((a ^ c) - (a * a)) & ((a - a) & (b | 57));
+  d = ((d - d) * (a - 52)) + ((a & 1) * (p - c));
+  if(b < d){
+    d = ((q | b) + (a | b)) * ((q ^ p) & (q ^ q));
+  }else{
+    b = ((q | 42) | (d + q)) & ((p | c) & (b & p));
+  }
+  b = ((p & b) * (q + q)) * ((d ^ q) + (q + 48));
+  d = ((b + c) - (q | c)) ^ ((b + b) - (q & p));
+  for(i = 0; i < 42; i++){
+    d = ((a & b) & (p ^ p)) * ((b & c) + (a | 11));
+  }
+  d = ((a * c) & (p & d)) | ((a - d) & (q & c));
+  if(c < q){
+    c = ((q ^ 42) - (c | 24)) | ((c * d) ^ (b | 32));
+  }else{
+    c = ((d & q) ^ (c | b)) * ((c | c) & (b + p));
+  }
+  d = ((c - d) ^ (a * b)) - ((a | p) ^ (p | q));
+  b = ((b | b) ^ (q * d)) + ((c + c) & (a & 78));
+  a = ((p * q) | (d - d)) | ((b - c) & (p | c));
+  a = ((d | a) ^ (q ^ 63)) * ((q + b) * (q ^ b));
+  if(d < b){
+    b = ((b + 23) + (p ^ d)) * ((b ^ a) | (b & c));
+  }else{
+    c = ((b - a) ^ (d | 77)) & ((d ^ q) | (b * c));
+  }
+  c = ((p + b) ^ (d * d)) & ((p - 86) ^ (q * d));
+  c = ((a & b) | (d ^ q)) | ((p - 52) + (b & 19));
+  c = ((p & c) ^ (d + 16)) * ((p * 89) & (c | 65));
+  c = ((q * p) & (a | b)) * ((a + b) * (q * 93));
+  if(d < c){
+    b = ((q * q) | (c + q)) & ((c | c) * (d & d));
+  }else{
+    d = ((c | a) & (d + p)) - ((p ^ p) ^ (b | d));
+  }
+  c = ((c + q) - (q * d)) - ((a ^ q) | (q + b));
+  for(i = 0; i < 39; i++){
+    d = ((b - 94) * (b - c)) - ((a ^ 64) | (q + d));
+  }
+  a = ((c - p) & (q + b)) + ((b * d) & (d ^ d));
+  c = ((p ^ p) | (q - 25)) + ((q * 31) ^ (a + c));
+  if(a < c){
+    c = ((c & 26) - (d - q)) + ((p ^ a) ^ (c & p));
+  }else{
+    a = ((c - b) - (a + 22)) | ((p + b) + (q ^ p));
+  }
+  b = ((p - 71) + (b + d)) | ((d + q) | (a - q));
+  c = ((p - a) & (p & b)) | ((d + p) + (p | b));
+  c = ((c & q) & (c & q)) - ((p * 65) + (q & b));
+  for(i = 0; i < 18; i++){
+    a = ((p ^ 76) | (c & 34)) - ((a ^ d) * (d & d));
+  }
+  if(c < b){
+    d = ((p & d) ^ (q - a)) * ((a & q) + (a | a));
+  }else{
+    a = ((p | a) + (p & b)) | ((b - p) | (q | q));
+  }
+  return a + b + c + d;
+}
+
+int func66(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 95;
+  d = 94;
+  a = ((d | 88) + (c ^ c)) ^ ((c * d) - (c * 88));
+  c = ((p - b) - (p + 9)) & ((d & 23) ^ (b & a));
+  a = ((p & c) & (q | d)) + ((b + 56) * (q & b));
+  b = ((c | 14) ^ (a - p)) - ((q & d) + (d * c));
+  if(d < 36){
+    a = ((q * 64) * (a & p)) & ((a ^ b) * (d - c));
+  }else{
+    a = ((a | 60) + (b - a)) | ((p + c) | (p - c));
+  }
+  a = ((p * a) - (q | q)) * ((b - a) & (p ^ d));
+  for(i = 0; i < 24; i++){
+    a = ((b | q) | (p - 41)) ^ ((q ^ d) | (q - b));
+  }
+  a = ((d + a) * (p - c)) ^ ((a & q) | (q ^ 97));
+  d = ((c - 12) + (p & 61)) - ((q * 61) + (d + c));
+  if(a < b){
+    b = ((d * d) + (c ^ 30)) ^ ((q - c) + (p * p));
+  }else{
+    a = ((p | d) & (a * a)) & ((a | q) ^ (p + 54));
+  }
+  a = ((q ^ c) | (p * b)) ^ ((b * p) * (q & p));
+  d = ((b | 67) * (a - 98)) ^ ((d * p) ^ (p * a));
+  b = ((q & q) + (a & c)) ^ ((d * q) + (q & d));
+  for(i = 0; i < 25; i++){
+    c = ((d & 38) - (a - d)) ^ ((a ^ d) - (b * d));
+  }
+  if(d < 52){
+    a = ((p * p) | (q * b)) ^ ((b + 55) | (a * b));
+  }else{
+    a = ((b - a) * (q & c)) + ((a - b) - (q * a));
+  }
+  d = ((c & d) & (q | 24)) | ((d - 63) - (b + p));
+  c = ((a + d) | (d - c)) + ((a - a) * (p ^ 84));
+  a = ((b & p) | (b | 27)) & ((b - 59) - (d ^ a));
+  c = ((c * 26) | (b * b)) ^ ((p - d) - (b ^ 7));
+  if(b < d){
+    c = ((d ^ q) * (p + p)) | ((p & d) + (b - a));
+  }else{
+    d = ((p ^ a) * (a ^ c)) & ((c + p) - (a | d));
+  }
+  for(i = 0; i < 46; i++){
+    a = ((q | 51) ^ (d - 47)) + ((p & d) | (q + 59));
+  }
+  b = ((d & a) | (p - a)) - ((a & 27) & (b & b));
+  a = ((b + a) | (a + 50)) + ((d & c) - (q + 21));
+  b = ((q ^ b) ^ (q | c)) & ((d + c) ^ (b | 80));
+  if(d < d){
+    d = ((q * c) + (a * c)) ^ ((p | b) * (d & 42));
+  }else{
+    c = ((q * p) & (p + 15)) * ((p * d) ^ (b ^ p));
+  }
+  d = ((q & 27) ^ (a * b)) + ((p & a) + (d ^ 18));
+  c = ((c & d) & (c * a)) ^ ((q & a) + (p & 79));
+  for(i = 0; i < 28; i++){
+    b = ((q | d) - (d ^ a)) + ((d & p) * (c & p));
+  }
+  c = ((p & b) ^ (p & a)) + ((d - q) & (c * p));
+  if(c < a){
+    c = ((a * q) ^ (q & d)) + ((q + c) ^ (b - b));
+  }else{
+    d = ((a * a) | (d * p)) - ((c - 14) | (p ^ 9));
+  }
+  b = ((c | d) + (a ^ p)) * ((d + d) - (q * c));
+  b = ((q - a) - (p * 1)) & ((d | p) + (p - 81));
+  d = ((b & a) - (q + a)) - ((q + 21) * (d | q));
+  b = ((b - q) | (b + 36)) | ((b - p) | (q & q));
+  if(b < 55){
+    c = ((d & c) * (d | d)) ^ ((q & a) - (c - p));
+  }else{
+    b = ((b | d) ^ (q ^ b)) - ((d - d) ^ (b * 69));
+  }
+  d = ((b - a) - (q + p)) & ((c ^ 80) + (d | 46));
+  b = ((b * d) + (b * a)) * ((d - c) ^ (c & b));
+  d = ((c + c) | (b & q)) - ((a * 4) & (a | 67));
+  d = ((d & p) + (p & c)) * ((q + a) + (p + d));
+  if(a < b){
+    c = ((a + q) | (q & q)) + ((d + a) | (p + d));
+  }else{
+    a = ((d & c) ^ (b * d)) * ((a ^ d) | (d ^ 17));
+  }
+  c = ((b & a) ^ (q ^ c)) ^ ((q ^ q) * (d & p));
+  for(i = 0; i < 20; i++){
+    b = ((p * 43) * (a - c)) * ((p ^ a) & (c | 11));
+  }
+  c = ((p ^ 29) ^ (c + c)) | ((b | b) * (q - b));
+  a = ((c * q) | (a + d)) | ((p - a) & (d * p));
+  if(a < 11){
+    c = ((c - d) * (a + c)) ^ ((q * 32) | (q ^ 5));
+  }else{
+    a = ((d | a) ^ (c - 97)) - ((b + 96) * (p - p));
+  }
+  a = ((d * a) * (b * 6)) + ((q ^ 2) - (p & 7));
+  d = ((p + a) | (p - b)) ^ ((a + d) * (q - q));
+  d = ((d + d) - (q + a)) ^ ((q ^ p) + (a - a));
+  for(i = 0; i < 23; i++){
+    b = ((q | q) * (c * p)) + ((a ^ d) - (d * 74));
+  }
+  if(a < p){
+    a = ((p - q) | (a * p)) - ((d - b) + (a - 68));
+  }else{
+    c = ((c ^ 72) + (q * d)) | ((c & q) | (b & q));
+  }
+  return a + b + c + d;
+}
+
+int func67(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 14;
+  d = 56;
+  c = ((b | d) ^ (d + c)) - ((c | p) & (b & p));
+  c = ((q & q) & (a - p)) & ((q - q) + (a | d));
+  d = ((b + d) | (p & d)) | ((c + a) ^ (p | a));
+  c = ((c | a) & (d + 95)) & ((c - d) & (a ^ 5));
+  if(c < c){
+    d = ((b - d) ^ (p & 10)) * ((c & b) & (a | b));
+  }else{
+    b = ((a | q) ^ (b | c)) * ((c & c) * (a | d));
+  }
+  d = ((a ^ 8) ^ (p | c)) + ((p + c) ^ (d | p));
+  for(i = 0; i < 7; i++){
+    a = ((c * 54) | (p + b)) + ((a ^ c) - (d | 33));
+  }
+  c = ((d + 63) - (d | 83)) ^ ((q - c) ^ (c ^ c));
+  d = ((d | a) | (a - 16)) ^ ((d | c) * (q * d));
+  if(a < q){
+    d = ((d & a) & (b * d)) ^ ((p - b) - (d | q));
+  }else{
+    b = ((c - q) * (q | d)) - ((b ^ b) + (p ^ 53));
+  }
+  d = ((d ^ b) * (p | q)) | ((b & 33) - (d & a));
+  a = ((c * a) * (d | 7)) | ((a * q) ^ (d + c));
+  d = ((q ^ p) - (c | d)) | ((c + c) ^ (p ^ 51));
+  for(i = 0; i < 5; i++){
+    a = ((d - c) * (p ^ 48)) * ((a - 62) & (c - p));
+  }
+  if(b < p){
+    c = ((a & p) & (q & d)) ^ ((c & d) * (d * 10));
+  }else{
+    a = ((c - a) | (d | q)) + ((b + c) * (q ^ 43));
+  }
+  a = ((q ^ 93) + (c ^ p)) * ((d + 67) | (a - q));
+  a = ((p + 11) & (c + p)) & ((d & 8) | (c + a));
+  a = ((c * q) & (d * c)) & ((c - c) ^ (q ^ b));
+  c = ((p - a) ^ (c & q)) * ((q ^ p) * (p | a));
+  if(c < q){
+    a = ((c ^ c) - (b - q)) - ((c ^ d) & (d - q));
+  }else{
+    b = ((q + p) * (q ^ b)) ^ ((b & c) ^ (b & a));
+  }
+  for(i = 0; i < 14; i++){
+    c = ((c + q) & (b | d)) & ((a & c) & (a & c));
+  }
+  b = ((a + 99) ^ (q & 41)) & ((c & q) * (q | c));
+  c = ((a * 66) ^ (p * b)) + ((p & p) ^ (q + a));
+  d = ((b * a) & (a + d)) | ((a + q) ^ (d * 53));
+  if(c < p){
+    b = ((p | q) - (b & d)) & ((c - d) | (b ^ b));
+  }else{
+    c = ((q * a) | (q - b)) | ((d - 51) * (q | d));
+  }
+  c = ((b ^ 40) * (d & b)) + ((b - 47) + (a | b));
+  b = ((d + d) + (p & c)) * ((a - c) | (b & a));
+  for(i = 0; i < 15; i++){
+    d = ((a ^ 42) * (q * c)) & ((q * a) - (q + 2));
+  }
+  d = ((q | p) + (d + 15)) - ((d - b) - (b + 88));
+  if(a < q){
+    c = ((a * c) | (p ^ 28)) + ((a - a) | (a | p));
+  }else{
+    d = ((b * c) * (q ^ a)) & ((c & a) | (q | c));
+  }
+  c = ((q | b) - (p ^ q)) ^ ((d * d) * (d - q));
+  b = ((q - a) & (p | c)) ^ ((p | p) ^ (d + 99));
+  a = ((a + q) + (d + a)) + ((b - 38) * (p * a));
+  a = ((a ^ 99) ^ (c | p)) * ((p & 42) - (b & a));
+  if(c < c){
+    b = ((q & 65) * (d & q)) ^ ((a | 42) ^ (p + p));
+  }else{
+    d = ((d | q) + (d * p)) | ((q * 12) | (a - 46));
+  }
+  d = ((d - p) | (q + q)) ^ ((c | 48) ^ (d * p));
+  b = ((c - b) * (q + d)) * ((q & 49) ^ (a & 7));
+  b = ((a + q) + (d * 19)) * ((a & c) & (a & c));
+  c = ((b * a) ^ (b + d)) & ((p - 35) + (d + b));
+  if(a < c){
+    c = ((c - a) + (c & 15)) | ((b | d) | (p * 81));
+  }else{
+    d = ((p | 70) * (b & b)) | ((q * 60) | (b - a));
+  }
+  a = ((q ^ a) + (q + 65)) - ((c | p) & (c * p));
+  for(i = 0; i < 4; i++){
+    b = ((p + p) | (c | 62)) ^ ((p & q) & (a + d));
+  }
+  c = ((d | 78) * (c - a)) + ((b & a) + (c * d));
+  d = ((b + 96) * (d ^ 87)) * ((b & p) * (p & d));
+  if(d < a){
+    d = ((a - a) + (a ^ c)) - ((q + 6) * (a * p));
+  }else{
+    b = ((b | b) ^ (a + q)) - ((p - 35) + (p - d));
+  }
+  a = ((b ^ 97) * (q - q)) ^ ((c * q) + (p & 89));
+  d = ((p & 96) & (p ^ 69)) | ((a * p) * (d * q));
+  d = ((b | a) | (b - c)) - ((b * c) * (p + 69));
+  for(i = 0; i < 21; i++){
+    c = ((q | p) & (a & q)) & ((p & 95) | (p & c));
+  }
+  if(c < p){
+    b = ((p & p) - (p & b)) + ((d * q) | (p & a));
+  }else{
+    b = ((d - b) + (d - b)) ^ ((a ^ q) - (p | c));
+  }
+  return a + b + c + d;
+}
+
+int func68(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 63;
+  d = 8;
+  a = ((q | d) & (a - a)) & ((c ^ c) & (a + 72));
+  a = ((d - q) | (p - q)) | ((p - b) ^ (b + b));
+  a = ((d + 85) - (p * c)) & ((d - p) * (q | 8));
+  b = ((d | 21) - (q ^ 30)) * ((p & b) + (p - 26));
+  if(c < 79){
+    c = ((q ^ 92) ^ (d ^ d)) - ((c + 82) - (d + d));
+  }else{
+    d = ((d * c) | (a ^ q)) + ((d - p) ^ (b * d));
+  }
+  a = ((d - 73) * (d * q)) - ((b + q) * (b * a));
+  for(i = 0; i < 24; i++){
+    d = ((c ^ 89) - (a + b)) + ((q + q) + (c & 36));
+  }
+  a = ((c - a) | (b | d)) * ((a | d) - (c * b));
+  c = ((d & p) + (b & 37)) - ((d + a) | (q - 50));
+  if(b < 6){
+    c = ((a - a) - (p + 32)) + ((c - p) & (a ^ p));
+  }else{
+    a = ((a * q) ^ (d ^ d)) + ((b ^ p) | (d ^ b));
+  }
+  b = ((b * b) + (b ^ b)) + ((d | c) & (p - b));
+  d = ((d - b) & (p | d)) * ((b | a) + (c - a));
+  c = ((d | c) | (d * b)) | ((q ^ 79) - (a ^ p));
+  for(i = 0; i < 7; i++){
+    c = ((c * d) & (q | 32)) & ((p + q) + (c & p));
+  }
+  if(b < 6){
+    b = ((p ^ c) ^ (q | c)) + ((a & d) | (q + d));
+  }else{
+    d = ((d & q) + (a ^ d)) & ((a + c) & (q - p));
+  }
+  d = ((c | b) & (a + b)) | ((b + d) ^ (b + b));
+  c = ((c ^ a) ^ (c | b)) * ((d ^ a) + (q * 97));
+  b = ((a * 72) ^ (p & b)) + ((b | p) * (q - 74));
+  c = ((p - a) - (d | b)) - ((a | c) ^ (q - p));
+  if(d < d){
+    c = ((q & 51) | (a | p)) + ((a * b) * (c & d));
+  }else{
+    b = ((p | 12) - (c + p)) & ((p + 23) ^ (p | 79));
+  }
+  for(i = 0; i < 7; i++){
+    a = ((d - q) | (b * 15)) + ((c | 62) ^ (d + c));
+  }
+  c = ((a & p) + (b - a)) & ((p | d) * (c + 82));
+  b = ((c * b) & (q + b)) | ((a & b) + (q - d));
+  b = ((q ^ 18) - (p - 4)) * ((b + p) ^ (p - b));
+  if(c < q){
+    c = ((d * 33) - (d ^ d)) * ((a & 73) & (p + d));
+  }else{
+    b = ((b | a) ^ (a ^ a)) ^ ((q * d) ^ (p & 86));
+  }
+  b = ((p ^ 66) & (d + d)) * ((c & 78) + (q | p));
+  d = ((c & c) & (d ^ d)) ^ ((c ^ 89) | (c - 55));
+  for(i = 0; i < 39; i++){
+    b = ((c | 93) & (a | q)) ^ ((c * c) | (d | 39));
+  }
+  d = ((b & 37) ^ (d * d)) * ((q & b) - (b - q));
+  if(c < b){
+    d = ((a | q) ^ (c | b)) ^ ((p - c) | (d + 65));
+  }else{
+    a = ((d & a) - (b ^ b)) ^ ((q + 54) | (b * a));
+  }
+  b = ((c + d) + (p - c)) + ((c - p) | (p | 10));
+  a = ((p & c) & (q + p)) | ((b + q) & (d ^ q));
+  b = ((p & p) | (p | d)) | ((p * q) + (q | c));
+  c = ((p ^ c) & (a & a)) + ((c - a) - (b | q));
+  if(a < q){
+    b = ((c * 71) - (d + 43)) & ((p | 68) - (p & p));
+  }else{
+    b = ((a * c) * (a - c)) | ((c & p) | (d & a));
+  }
+  b = ((a & b) | (b ^ 79)) | ((b | 65) | (d & c));
+  d = ((d & 35) + (b - b)) | ((b ^ p) + (d + p));
+  d = ((q + b) + (c * b)) | ((p | 39) ^ (b - b));
+  d = ((p | a) - (d | q)) + ((a & c) ^ (b ^ d));
+  if(b < 17){
+    d = ((p + p) * (c - q)) | ((p & d) * (b + p));
+  }else{
+    c = ((q * a) ^ (b & d)) ^ ((a ^ q) ^ (q - b));
+  }
+  a = ((b - q) | (d * d)) * ((c ^ b) * (q & a));
+  for(i = 0; i < 25; i++){
+    b = ((a | a) * (q * d)) + ((a + a) * (a ^ a));
+  }
+  a = ((c - p) - (a ^ 67)) ^ ((b & a) - (b * 52));
+  d = ((d - 7) + (p + b)) - ((a * d) * (p ^ 99));
+  if(d < p){
+    b = ((c + 59) + (d + q)) | ((d & 50) * (p & q));
+  }else{
+    d = ((p & 67) - (c | d)) | ((c * d) ^ (p | b));
+  }
+  a = ((p - q) - (b - d)) ^ ((b & q) & (c * c));
+  d = ((q ^ c) | (b * q)) | ((c | p) + (p | b));
+  d = ((d | 69) + (q * d)) ^ ((b ^ 47) & (p | 42));
+  for(i = 0; i < 33; i++){
+    c = ((b * c) ^ (p - a)) - ((p - a) | (b - q));
+  }
+  if(c < 58){
+    c = ((b - 33) - (c + p)) | ((a - p) - (c ^ d));
+  }else{
+    a = ((c + p) * (q | q)) + ((d ^ 68) - (a & 68));
+  }
+  return a + b + c + d;
+}
+
+int func69(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 40;
+  d = 65;
+  a = ((p * 2) & (d * 98)) | ((q + d) ^ (a * 57));
+  b = ((b & q) ^ (q - c)) | ((c | 8) + (q ^ c));
+  b = ((a + a) + (q & 78)) & ((d - 72) - (b + 29));
+  a = ((b * d) | (d * p)) ^ ((p + b) + (q | q));
+  if(c < d){
+    b = ((c & a) & (c - b)) * ((q & 9) + (q ^ c));
+  }else{
+    b = ((a * d) - (d * p)) * ((a - c) | (b | p));
+  }
+  c = ((a + 24) - (b * 20)) & ((d ^ p) + (b * a));
+  for(i = 0; i < 19; i++){
+    a = ((c ^ 77) + (a | a)) & ((p - c) * (a | q));
+  }
+  b = ((a ^ 62) + (q | 96)) | ((p & a) - (a * d));
+  c = ((c * b) + (q - b)) & ((p + p) - (b - p));
+  if(c < 20){
+    a = ((d - c) ^ (p + p)) & ((d - q) + (a & 51));
+  }else{
+    c = ((d + b) - (a | q)) ^ ((d + p) ^ (d * p));
+  }
+  d = ((b ^ 75) | (b * d)) & ((a ^ d) | (a ^ p));
+  b = ((b + p) + (p ^ a)) & ((q - p) + (q * 21));
+  a = ((a - d) & (c ^ q)) + ((c | b) * (b ^ c));
+  for(i = 0; i < 7; i++){
+    c = ((c + b) & (d ^ d)) ^ ((d - 9) & (a - 59));
+  }
+  if(d < p){
+    b = ((d - a) ^ (c - 11)) ^ ((q + d) ^ (p | p));
+  }else{
+    d = ((b ^ p) ^ (c * c)) - ((a + q) ^ (b & b));
+  }
+  a = ((b + d) | (a & 68)) ^ ((b ^ b) - (d * d));
+  a = ((a ^ a) | (c & 32)) ^ ((p * a) - (b | 1));
+  c = ((q * b) + (q - 92)) | ((p + 54) | (c + d));
+  b = ((c | b) | (q & d)) ^ ((a + 55) ^ (p - q));
+  if(b < 47){
+    b = ((b & a) ^ (a * b)) + ((d + q) * (a + b));
+  }else{
+    b = ((c & a) ^ (c + 68)) ^ ((p & 49) * (c - 96));
+  }
+  for(i = 0; i < 27; i++){
+    c = ((p | c) * (a ^ p)) * ((c | 9) + (c * b));
+  }
+  c = ((c - 35) ^ (c + q)) | ((q * p) * (b - a));
+  a = ((q & 82) ^ (a ^ c)) * ((c ^ d) * (q * d));
+  b = ((q + 97) * (a + d)) | ((p ^ 14) | (d | d));
+  if(d < q){
+    c = ((d | a) | (p ^ p)) + ((c - c) + (b & c));
+  }else{
+    b = ((b & 33) * (c * d)) | ((a * c) & (q + q));
+  }
+  c = ((a - p) + (c ^ b)) + ((c & d) * (c - b));
+  c = ((b ^ c) - (q & p)) + ((d - q) * (a - 84));
+  for(i = 0; i < 45; i++){
+    a = ((d + d) * (c | p)) * ((d - p) ^ (c - p));
+  }
+  b = ((c ^ p) + (q - p)) & ((a + a) + (p & c));
+  if(b < c){
+    d = ((p & a) | (a & 76)) | ((q + d) * (c - a));
+  }else{
+    c = ((c - c) ^ (c + a)) * ((b + p) + (a - a));
+  }
+  d = ((b * b) * (d ^ c)) + ((a & b) & (a * 63));
+  c = ((d ^ a) | (d - d)) * ((d * b) & (q ^ q));
+  c = ((a & d) ^ (a * d)) & ((q ^ 37) * (q & a));
+  a = ((d + b) ^ (q - 15)) & ((q & 5) | (p & 98));
+  if(c < b){
+    d = ((d + 9) & (p * 84)) ^ ((q * p) | (q ^ 2));
+  }else{
+    b = ((b * q) & (b - b)) ^ ((p ^ q) & (c ^ c));
+  }
+  d = ((p + a) | (b - p)) & ((c | d) & (p | a));
+  c = ((d | b) & (q + q)) - ((q ^ d) & (a - a));
+  b = ((q * d) * (b & p)) - ((p * d) ^ (c * a));
+  d = ((d * d) * (c - q)) * ((a * p) & (d * 30));
+  if(c < d){
+    b = ((b - a) ^ (b * q)) | ((a + c) & (q & p));
+  }else{
+    d = ((c ^ b) & (q | 17)) - ((b + a) ^ (a & p));
+  }
+  b = ((a ^ p) + (b ^ q)) | ((c * a) * (c | p));
+  for(i = 0; i < 23; i++){
+    d = ((c * c) * (p + p)) - ((p | 47) + (c & 89));
+  }
+  c = ((p + a) & (b | a)) ^ ((q + c) - (a ^ c));
+  a = ((q + q) & (b & a)) | ((b | p) & (p | p));
+  if(d < c){
+    c = ((p | b) + (b | c)) & ((d | 49) ^ (q & q));
+  }else{
+    c = ((p & a) ^ (c * d)) ^ ((b * d) + (q ^ 4));
+  }
+  d = ((b ^ c) - (d & q)) | ((p + q) | (b * 22));
+  d = ((c - p) * (b ^ b)) - ((a * a) + (c | 32));
+  d = ((b & 56) - (q * 61)) * ((a + p) | (p & p));
+  for(i = 0; i < 3; i++){
+    a = ((q | a) & (d - q)) * ((q + p) & (b & d));
+  }
+  if(c < b){
+    c = ((c - c) ^ (c * p)) & ((c ^ a) * (b - d));
+  }else{
+    b = ((c ^ c) - (d | 54)) - ((a + d) - (b ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func70(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 88;
+  d = 60;
+  a = ((d & a) + (a & a)) + ((a | 12) | (b - q));
+  c = ((q * d) + (p * b)) | ((c + b) + (c ^ b));
+  d = ((c * p) | (b | q)) + ((b * 69) & (c ^ 90));
+  c = ((a ^ b) + (d ^ q)) * ((b + q) ^ (b & p));
+  if(b < b){
+    a = ((c | a) + (d ^ c)) | ((b ^ 73) - (c * 54));
+  }else{
+    c = ((d & a) & (d + 86)) + ((d * 8) & (b - p));
+  }
+  a = ((q + d) + (q ^ q)) * ((p & b) ^ (q | p));
+  for(i = 0; i < 11; i++){
+    c = ((a & c) - (p | c)) - ((a - a) | (q - 96));
+  }
+  d = ((q ^ 68) & (q * a)) & ((p + 79) - (b * a));
+  c = ((a & c) * (d & a)) + ((d + p) + (q - b));
+  if(d < b){
+    b = ((q * p) * (a & a)) * ((b * c) ^ (p | p));
+  }else{
+    b = ((b - d) - (p & 38)) | ((b ^ 64) + (b & p));
+  }
+  d = ((a & a) * (b & p)) - ((p + a) * (q + a));
+  c = ((c - b) ^ (c - b)) - ((q * c) - (b & 41));
+  c = ((d ^ d) | (q ^ p)) - ((c * d) ^ (q + d));
+  for(i = 0; i < 38; i++){
+    b = ((a - p) - (c * a)) + ((q + p) ^ (b | c));
+  }
+  if(b < a){
+    c = ((b * q) ^ (d & c)) | ((a & c) ^ (c & c));
+  }else{
+    b = ((d ^ b) ^ (b | a)) * ((b - 99) + (p & q));
+  }
+  d = ((d + c) ^ (p + c)) & ((b | a) + (q & d));
+  c = ((c * d) + (c - d)) | ((b & c) * (a ^ b));
+  b = ((q & b) ^ (b * a)) | ((d - p) * (d + 70));
+  d = ((p - b) & (p & 34)) + ((p ^ a) & (a & q));
+  if(d < 19){
+    c = ((d + c) - (b - p)) + ((q & 78) | (d & p));
+  }else{
+    b = ((d ^ 28) & (a & 40)) + ((a ^ d) & (q - a));
+  }
+  for(i = 0; i < 28; i++){
+    c = ((a | c) ^ (d * 23)) * ((a + a) + (b * 12));
+  }
+  b = ((q + 30) ^ (a | 93)) ^ ((d | q) | (q ^ d));
+  a = ((d * d) ^ (p - 27)) ^ ((a * p) - (d ^ q));
+  d = ((p | b) ^ (d * 21)) + ((c - 24) - (c ^ c));
+  if(b < 29){
+    b = ((d & a) * (b - p)) | ((d - 1) * (q + q));
+  }else{
+    c = ((c * d) * (c * b)) ^ ((p - q) + (b | c));
+  }
+  d = ((p * d) + (d + b)) * ((c & 65) | (d & a));
+  a = ((c + 76) & (d + 15)) & ((a * a) + (b ^ d));
+  for(i = 0; i < 25; i++){
+    c = ((a | p) | (a & q)) & ((a - 37) | (a ^ d));
+  }
+  a = ((c ^ p) ^ (b | b)) & ((d * 22) & (a + a));
+  if(c < q){
+    c = ((d & 30) * (a | q)) + ((d + q) - (q - c));
+  }else{
+    c = ((b * d) + (d - d)) ^ ((q | 65) ^ (c - d));
+  }
+  a = ((a * 58) + (a - 28)) - ((b | c) | (a ^ q));
+  a = ((a - d) * (q ^ c)) - ((c & p) + (b + a));
+  a = ((a & b) & (a | q)) + ((b - 18) ^ (p & c));
+  a = ((b * 71) | (d + q)) * ((q * 60) * (d | c));
+  if(a < d){
+    a = ((b - p) * (a * q)) ^ ((c - q) ^ (c & b));
+  }else{
+    a = ((b * q) * (c ^ b)) | ((p + q) & (p | a));
+  }
+  a = ((d | d) ^ (b ^ b)) | ((q ^ a) ^ (q * a));
+  c = ((b & 95) ^ (d | p)) ^ ((c | b) - (p + 43));
+  b = ((a - a) & (a ^ b)) & ((c ^ p) & (q - q));
+  c = ((a ^ p) - (a + q)) * ((q | p) * (d * p));
+  if(c < p){
+    a = ((c + 45) * (c & 70)) - ((a - q) - (c | b));
+  }else{
+    c = ((c ^ p) ^ (d & 42)) ^ ((p & a) | (a * 25));
+  }
+  a = ((p * p) & (p - b)) * ((d & 71) * (a - b));
+  for(i = 0; i < 36; i++){
+    d = ((a + 31) | (b + q)) - ((b | 44) ^ (q - b));
+  }
+  b = ((q ^ 42) + (b ^ b)) - ((d * d) & (p | b));
+  a = ((p * 48) * (b | 24)) - ((d ^ d) & (a - d));
+  if(d < b){
+    b = ((b * 18) & (c - q)) - ((c + 59) * (q | a));
+  }else{
+    c = ((a + p) - (a * q)) - ((d * p) + (a + a));
+  }
+  a = ((d * 77) ^ (c * q)) & ((q + 99) - (b & 74));
+  b = ((d * d) + (c | p)) - ((d + c) - (b - q));
+  c = ((q ^ c) * (d * 76)) * ((p + d) * (b + p));
+  for(i = 0; i < 7; i++){
+    a = ((b + q) ^ (c + b)) - ((d - a) ^ (c - c));
+  }
+  if(b < b){
+    a = ((a - 65) & (q + c)) ^ ((c ^ c) - (q * b));
+  }else{
+    c = ((b | d) * (q | 32)) - ((p & q) - (q ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func71(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 80;
+  d = 32;
+  a = ((b & a) | (b + 98)) ^ ((d | b) | (q | p));
+  d = ((c ^ a) * (d ^ c)) ^ ((q * 72) - (q ^ a));
+  c = ((b | c) & (p - q)) * ((q * 68) | (a | c));
+  a = ((q - c) - (p + d)) + ((d - p) & (q | q));
+  if(c < a){
+    c = ((b * b) * (p + b)) & ((p | 85) - (a * a));
+  }else{
+    d = ((p & q) | (d | c)) ^ ((q - q) | (a + 38));
+  }
+  a = ((a | 99) ^ (p | 61)) | ((a ^ d) + (a ^ 22));
+  for(i = 0; i < 2; i++){
+    c = ((p - b) ^ (a + a)) | ((b + b) | (d | c));
+  }
+  a = ((d * d) & (p - q)) & ((q + a) + (b * b));
+  c = ((b * p) & (b ^ d)) ^ ((c & b) + (c ^ d));
+  if(d < a){
+    c = ((c + d) ^ (d & q)) | ((c * q) | (c * 11));
+  }else{
+    d = ((a | c) & (q | c)) ^ ((d & c) & (a ^ 5));
+  }
+  a = ((d & b) - (c ^ q)) + ((a + d) ^ (q | b));
+  c = ((p & b) | (q - q)) - ((d | a) | (p | d));
+  c = ((q ^ d) ^ (b | q)) & ((p * a) | (c & b));
+  for(i = 0; i < 2; i++){
+    c = ((p - 11) * (c | 75)) & ((q & c) ^ (p ^ 93));
+  }
+  if(d < 90){
+    d = ((d & a) + (b + a)) * ((b + a) ^ (c | b));
+  }else{
+    a = ((c & p) * (b & b)) ^ ((p | p) + (p + c));
+  }
+  c = ((a | a) + (c - b)) + ((a * 27) * (q * a));
+  c = ((p + c) ^ (q & c)) | ((p & q) + (b | a));
+  d = ((b | c) - (p + d)) + ((a ^ 92) & (a ^ d));
+  d = ((c - q) ^ (q ^ 83)) * ((p ^ 45) & (d & c));
+  if(d < q){
+    a = ((c ^ p) * (a ^ 9)) ^ ((d & 33) - (c - d));
+  }else{
+    c = ((a + q) + (q + a)) - ((c + d) ^ (d | c));
+  }
+  for(i = 0; i < 41; i++){
+    c = ((d | q) & (p ^ 86)) | ((p + 47) ^ (p + a));
+  }
+  a = ((a | b) + (a - 44)) & ((b ^ q) * (a - c));
+  c = ((b | c) & (a + 74)) - ((c - b) & (d - b));
+  d = ((a + p) + (a & 57)) | ((c | q) ^ (q | d));
+  if(b < 85){
+    d = ((a * d) & (q + 23)) + ((p ^ 77) + (a ^ 78));
+  }else{
+    d = ((p + a) ^ (c + b)) * ((b & p) ^ (q & a));
+  }
+  a = ((b - q) + (q - 4)) & ((a * a) | (q | p));
+  c = ((p & p) + (q & 4)) & ((d | a) | (q | a));
+  for(i = 0; i < 2; i++){
+    a = ((c | 12) - (c | c)) | ((q | 49) & (p & c));
+  }
+  c = ((d ^ a) | (b * b)) | ((a ^ d) * (q + b));
+  if(d < 7){
+    d = ((b * q) & (q * a)) * ((p - c) * (q * 8));
+  }else{
+    c = ((q & 31) * (p + 72)) ^ ((c & 26) * (d + c));
+  }
+  c = ((b + 24) & (d | q)) ^ ((d | 97) + (c ^ c));
+  a = ((a | b) + (c * a)) * ((d & 42) ^ (p - a));
+  c = ((q ^ b) ^ (q * 30)) + ((q & d) - (d * q));
+  c = ((a & c) * (p & c)) - ((a + d) * (q ^ c));
+  if(c < c){
+    b = ((p & a) ^ (b & c)) | ((p * 7) + (c - b));
+  }else{
+    c = ((p & c) + (a * d)) - ((b ^ b) | (p & 76));
+  }
+  b = ((q - 58) + (q - p)) ^ ((q | c) ^ (p + d));
+  c = ((c * 12) + (c & p)) ^ ((c ^ d) & (p | c));
+  a = ((a - b) | (b - p)) - ((q + 76) & (q | a));
+  a = ((p & 70) * (c * b)) - ((a + 89) * (b ^ 1));
+  if(d < 73){
+    c = ((a | p) | (q + 9)) & ((p * 69) ^ (q | d));
+  }else{
+    c = ((a ^ p) - (c - q)) * ((b - a) ^ (d + p));
+  }
+  b = ((c | q) + (d - c)) - ((c & c) + (p + b));
+  for(i = 0; i < 15; i++){
+    c = ((d | 4) | (a * b)) | ((b ^ 95) ^ (q ^ q));
+  }
+  a = ((d * b) * (a - 50)) | ((d ^ 53) & (q + c));
+  a = ((a ^ 53) | (c - 30)) ^ ((q - b) & (b | b));
+  if(b < a){
+    c = ((a - a) - (a * a)) - ((c & q) + (b + c));
+  }else{
+    c = ((b & p) ^ (d - a)) & ((d * c) - (p ^ 56));
+  }
+  c = ((c ^ c) - (d + p)) - ((c | d) ^ (d * a));
+  c = ((b & p) ^ (c + d)) * ((c & 77) | (q + a));
+  b = ((q * p) | (a + q)) ^ ((d ^ q) ^ (a | c));
+  for(i = 0; i < 4; i++){
+    c = ((p + p) + (b - a)) | ((p ^ d) - (b + b));
+  }
+  if(b < c){
+    d = ((b * 59) | (a ^ b)) & ((b * b) | (b * d));
+  }else{
+    a = ((a | p) ^ (d + b)) - ((b - d) + (p - b));
+  }
+  return a + b + c + d;
+}
+
+int func72(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 77;
+  d = ((p | 2) & (a | 36)) * ((d - c) | (d | 16));
+  c = ((a - 9) | (p ^ 42)) & ((p - d) * (d ^ q));
+  c = ((d * d) ^ (p - 48)) ^ ((q | b) + (d + p));
+  c = ((d + q) * (b & 30)) + ((a & b) * (q + d));
+  if(d < d){
+    b = ((q | c) + (b + d)) * ((a - 4) - (a * b));
+  }else{
+    d = ((d ^ d) + (a ^ d)) ^ ((q * p) + (p * 98));
+  }
+  c = ((a * p) ^ (b | 51)) | ((a ^ a) ^ (b ^ a));
+  for(i = 0; i < 14; i++){
+    b = ((a - q) * (a | d)) ^ ((p | 5) ^ (c | c));
+  }
+  b = ((p - b) & (a ^ p)) * ((a - d) & (b + b));
+  b = ((p | 16) + (a + c)) & ((d ^ q) & (d & 16));
+  if(a < p){
+    a = ((b & q) ^ (q | d)) ^ ((b - a) * (d ^ q));
+  }else{
+    a = ((b * q) - (b * d)) | ((a + a) ^ (q * b));
+  }
+  c = ((q & 87) + (d * d)) | ((q * d) * (d - p));
+  d = ((q - a) * (p & d)) - ((b ^ b) & (d * b));
+  c = ((p | c) - (p | b)) - ((c ^ 26) - (b - p));
+  for(i = 0; i < 6; i++){
+    d = ((d * 72) * (a + p)) - ((c * a) | (c + p));
+  }
+  if(b < c){
+    c = ((b | d) | (b | 18)) * ((c - p) & (d | 62));
+  }else{
+    c = ((b | c) | (p + q)) ^ ((b * 87) * (q | a));
+  }
+  d = ((q * b) & (a & c)) * ((a + c) + (c | 45));
+  c = ((a * a) | (q * d)) * ((d | p) * (b & 20));
+  c = ((p | p) - (c - q)) ^ ((b ^ b) * (a & a));
+  b = ((q ^ 53) ^ (d - q)) | ((c - q) - (a & c));
+  if(b < 44){
+    d = ((d & b) + (b & d)) | ((b + a) & (a & c));
+  }else{
+    b = ((q - 1) | (b | b)) & ((c | d) - (a ^ d));
+  }
+  for(i = 0; i < 44; i++){
+    d = ((d & 31) | (q + d)) * ((q + d) & (c | 29));
+  }
+  c = ((p - 37) & (q ^ 22)) * ((d | q) + (q - p));
+  c = ((p ^ 22) & (p * 27)) * ((q - a) & (p | 67));
+  a = ((q & b) | (b - c)) & ((b ^ q) ^ (p & a));
+  if(a < d){
+    b = ((b ^ p) | (p + b)) * ((c ^ d) & (p & b));
+  }else{
+    d = ((q & 22) ^ (c + q)) | ((a & b) ^ (p * c));
+  }
+  c = ((a & c) - (q & d)) - ((p + 47) - (a ^ c));
+  b = ((c * q) ^ (a & q)) | ((p | p) + (p + d));
+  for(i = 0; i < 24; i++){
+    b = ((q | d) | (a + d)) - ((p * 37) * (d | c));
+  }
+  b = ((b ^ q) + (d | b)) | ((q | 43) & (p ^ p));
+  if(d < p){
+    d = ((p | 17) | (b * c)) | ((d ^ p) + (p * 54));
+  }else{
+    d = ((p & c) ^ (b & p)) | ((q | b) & (q * 58));
+  }
+  a = ((q - d) - (a + 25)) - ((a + 81) | (q - q));
+  d = ((c ^ c) + (q ^ q)) * ((d & 90) & (q + q));
+  d = ((d & d) | (q & b)) | ((a ^ a) & (b ^ 25));
+  d = ((d | p) * (p | d)) ^ ((a | q) * (q + 6));
+  if(c < 44){
+    b = ((a + 44) - (c * b)) & ((b | p) | (c | p));
+  }else{
+    c = ((p | c) ^ (q + p)) & ((b + b) * (p - 6));
+  }
+  c = ((p ^ d) ^ (q + b)) | ((q * 9) | (p | d));
+  a = ((q & d) | (c ^ b)) - ((d * d) ^ (c | d));
+  c = ((q * a) - (b * p)) ^ ((d | q) | (d | 27));
+  a = ((p * a) * (c * 53)) - ((q | d) & (b ^ p));
+  if(d < d){
+    b = ((p + a) - (p ^ a)) * ((a & p) & (c | d));
+  }else{
+    d = ((p | p) + (p + d)) + ((a | b) * (c - a));
+  }
+  d = ((b ^ p) * (d - d)) ^ ((a | 63) - (c + 30));
+  for(i = 0; i < 16; i++){
+    d = ((p * 61) ^ (b & q)) ^ ((q & c) | (q & a));
+  }
+  b = ((p + b) & (p ^ p)) & ((q - d) | (d * p));
+  a = ((a + b) - (d & b)) + ((q | 73) ^ (c | p));
+  if(d < b){
+    b = ((b ^ 34) + (c * b)) + ((b ^ d) - (c + c));
+  }else{
+    b = ((b - 38) & (a ^ 5)) ^ ((b ^ b) - (c + 10));
+  }
+  c = ((p ^ b) + (p - c)) ^ ((a - q) + (d | c));
+  d = ((p * 42) - (p & 45)) ^ ((q & q) * (c ^ q));
+  d = ((p + 63) - (c ^ a)) * ((p | 60) + (q * a));
+  for(i = 0; i < 41; i++){
+    a = ((b - p) ^ (d + b)) & ((p - c) - (a * a));
+  }
+  if(d < q){
+    c = ((p & b) | (d & q)) + ((a + q) ^ (d | d));
+  }else{
+    d = ((q ^ d) ^ (b ^ b)) + ((q | 75) * (d & 20));
+  }
+  return a + b + c + d;
+}
+
+int func73(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 77;
+  d = 20;
+  b = ((c ^ a) | (p - d)) ^ ((b + 74) + (d ^ a));
+  d = ((a & q) - (b | 50)) * ((c | 94) - (q * 16));
+  b = ((c + 98) - (b - c)) + ((b ^ d) * (p * a));
+  d = ((a | q) | (b & 45)) ^ ((b | q) & (b * d));
+  if(b < a){
+    d = ((p + c) | (q - p)) + ((c ^ p) ^ (p - 43));
+  }else{
+    a = ((b & a) * (p | d)) + ((c ^ b) ^ (p + d));
+  }
+  c = ((q ^ q) + (q - 92)) * ((b + 10) - (a ^ 66));
+  for(i = 0; i < 20; i++){
+    a = ((d - 38) - (b - 76)) + ((q | c) ^ (a ^ 74));
+  }
+  a = ((b + q) - (b + c)) - ((q | d) * (b ^ b));
+  d = ((c + p) * (d | 35)) * ((p * a) ^ (q ^ c));
+  if(d < 86){
+    d = ((c ^ b) ^ (a * a)) + ((a | c) * (p | 85));
+  }else{
+    d = ((p & 39) * (b | b)) | ((b & 57) | (b * p));
+  }
+  d = ((p | 81) ^ (q - q)) * ((d & 59) ^ (c * p));
+  d = ((q - c) * (p * d)) ^ ((a + q) * (b ^ a));
+  b = ((c - d) - (p & d)) | ((q ^ b) | (a - p));
+  for(i = 0; i < 14; i++){
+    b = ((c & p) | (a ^ a)) - ((c - 58) | (c * b));
+  }
+  if(a < 82){
+    d = ((p | c) & (a | p)) ^ ((a & a) ^ (c - 84));
+  }else{
+    a = ((c + p) * (q ^ c)) & ((a + 13) & (b | 13));
+  }
+  c = ((p ^ 4) ^ (b - p)) + ((b | q) & (q | d));
+  b = ((c * a) & (c & 93)) | ((d & c) ^ (c & 60));
+  c = ((c ^ c) & (p - c)) ^ ((b + 62) + (a ^ p));
+  b = ((p | p) - (c & p)) ^ ((d * 74) ^ (c & 89));
+  if(d < c){
+    d = ((q & b) ^ (d * c)) | ((c * a) | (a ^ c));
+  }else{
+    c = ((q + 53) + (c | a)) ^ ((c | d) * (a * c));
+  }
+  for(i = 0; i < 26; i++){
+    c = ((b * a) + (d & a)) - ((q + a) | (c ^ a));
+  }
+  a = ((p & c) * (c - c)) + ((a ^ d) - (p * q));
+  c = ((a + p) | (c * d)) + ((a * 64) - (d & q));
+  a = ((q ^ 26) * (a + b)) + ((a ^ 56) ^ (p - q));
+  if(a < q){
+    d = ((q ^ d) * (q + p)) + ((a | c) ^ (b + d));
+  }else{
+    b = ((c + a) ^ (c & a)) & ((d + a) * (a * 80));
+  }
+  a = ((d - 49) ^ (d + p)) ^ ((c + p) & (a - p));
+  c = ((c + b) & (a + a)) & ((b | a) * (q | b));
+  for(i = 0; i < 48; i++){
+    b = ((a | p) ^ (p - c)) | ((p & 59) ^ (a & p));
+  }
+  b = ((d & 99) & (b + a)) ^ ((c + a) + (b ^ p));
+  if(b < 65){
+    b = ((a + 46) | (b ^ d)) + ((p & p) * (q | c));
+  }else{
+    c = ((c & a) & (c - p)) + ((c - q) | (a * q));
+  }
+  d = ((q ^ d) & (c - 16)) - ((q + a) ^ (d ^ b));
+  a = ((p & p) | (p - a)) * ((p ^ 70) - (a * 11));
+  c = ((c * b) - (d ^ 39)) | ((c + 84) - (b & a));
+  c = ((c ^ 29) | (q ^ 9)) ^ ((p ^ d) * (p + 83));
+  if(b < a){
+    b = ((c | d) | (c * 71)) * ((c ^ 99) ^ (b + c));
+  }else{
+    d = ((p + a) | (p + 50)) + ((d - 88) ^ (c | 84));
+  }
+  c = ((q | 61) ^ (c * d)) + ((a - q) & (p + b));
+  a = ((d * 42) * (c & 46)) | ((c & q) + (d * d));
+  c = ((q - 31) ^ (c ^ 69)) & ((c - a) - (c & 39));
+  c = ((b | q) | (a & 17)) & ((d & p) ^ (p - q));
+  if(c < 12){
+    c = ((d & b) * (p & b)) | ((b | 15) & (b + d));
+  }else{
+    b = ((q | p) + (c | b)) + ((q | a) & (q | q));
+  }
+  d = ((p + c) * (b ^ q)) ^ ((b - p) & (q & c));
+  for(i = 0; i < 3; i++){
+    a = ((b + 9) & (a | 8)) ^ ((c - c) * (b ^ b));
+  }
+  d = ((q ^ 69) + (b & c)) * ((p - 5) * (c | d));
+  c = ((a - b) + (b & 18)) | ((q ^ p) * (q & c));
+  if(a < p){
+    a = ((a ^ b) * (q * p)) ^ ((a + 85) * (b | 18));
+  }else{
+    c = ((q | 16) | (c + q)) ^ ((b & a) & (d & q));
+  }
+  a = ((a ^ 31) * (a ^ 5)) & ((b * 10) * (a & c));
+  c = ((b + c) ^ (d - d)) * ((d & d) * (b & d));
+  b = ((q | 41) & (a - d)) & ((a - b) - (q * 58));
+  for(i = 0; i < 6; i++){
+    b = ((d | b) & (q * a)) - ((b | q) ^ (c + b));
+  }
+  if(c < d){
+    b = ((d - q) * (c - p)) & ((d ^ 22) & (d + 76));
+  }else{
+    a = ((c + b) & (a ^ d)) * ((b ^ c) & (p - b));
+  }
+  return a + b + c + d;
+}
+
+int func74(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 18;
+  d = 37;
+  d = ((a | c) + (d - d)) * ((a * p) - (q * b));
+  b = ((p + a) | (c | 68)) + ((p * b) * (p * c));
+  d = ((c + 38) - (c ^ d)) - ((a | b) | (c - c));
+  a = ((a + d) & (a | p)) - ((q * 36) * (c + d));
+  if(c < a){
+    a = ((p - 61) | (a - b)) * ((c - 95) - (b & a));
+  }else{
+    d = ((q & b) - (b - b)) - ((a + d) * (q - 31));
+  }
+  d = ((d & b) ^ (d * 2)) | ((q | b) ^ (c * 79));
+  for(i = 0; i < 17; i++){
+    a = ((a ^ q) * (d & q)) * ((d | a) ^ (c - 32));
+  }
+  c = ((c ^ c) & (d & p)) + ((d + b) + (p - p));
+  a = ((a | d) ^ (d - b)) * ((p | c) & (c | 3));
+  if(c < q){
+    c = ((b | p) ^ (p & c)) & ((b & p) ^ (p - p));
+  }else{
+    b = ((p * c) * (c ^ a)) + ((b & a) & (p | p));
+  }
+  a = ((a ^ 11) ^ (p | q)) & ((d + 53) | (d ^ d));
+  b = ((q + p) - (c * c)) * ((q - 10) - (d + b));
+  c = ((a & a) | (b + 85)) & ((p - c) * (p ^ a));
+  for(i = 0; i < 24; i++){
+    d = ((q ^ 42) - (d ^ d)) & ((b - b) & (d + q));
+  }
+  if(c < p){
+    c = ((c + q) | (b ^ p)) | ((a + p) ^ (a - d));
+  }else{
+    c = ((d - d) * (d * d)) ^ ((b * q) * (d + q));
+  }
+  c = ((a & 88) | (q * p)) ^ ((a | p) | (p | q));
+  d = ((p - c) * (a - p)) ^ ((p - d) - (a & 99));
+  a = ((c ^ 7) ^ (d & d)) * ((b | c) & (q + b));
+  b = ((p ^ c) + (d ^ a)) * ((b - 88) ^ (c - d));
+  if(c < b){
+    a = ((d + 24) - (p | c)) * ((c ^ b) & (b ^ 64));
+  }else{
+    c = ((b | 28) ^ (q & b)) * ((a & a) ^ (c & 62));
+  }
+  for(i = 0; i < 17; i++){
+    a = ((a + 36) - (d * a)) ^ ((d * d) ^ (q | c));
+  }
+  d = ((b | b) * (a & q)) & ((b - d) + (b * 90));
+  d = ((a & 82) ^ (c & a)) ^ ((p + p) & (q - p));
+  a = ((p & q) & (a ^ a)) | ((p - 5) + (b - p));
+  if(a < 37){
+    b = ((c | d) & (p - b)) + ((a & 60) - (b - a));
+  }else{
+    b = ((q & p) + (c * a)) - ((c + 22) & (a + a));
+  }
+  b = ((q - b) & (q + c)) + ((b | a) & (a * c));
+  b = ((c * q) & (p - c)) - ((q | 23) ^ (q & b));
+  for(i = 0; i < 28; i++){
+    a = ((p & 89) - (c - c)) & ((a * b) * (b & p));
+  }
+  a = ((c - a) + (d & q)) - ((p * 25) - (p * c));
+  if(b < 68){
+    b = ((b * p) | (q * a)) + ((b - 67) & (p * c));
+  }else{
+    a = ((a - b) + (d & 54)) * ((q & a) + (a + 96));
+  }
+  b = ((q + 41) + (a + p)) * ((p * a) * (c - a));
+  a = ((b - b) & (c - a)) - ((d ^ d) * (p * d));
+  b = ((b + c) * (a & 89)) & ((p ^ d) | (d ^ a));
+  b = ((d & p) | (p + d)) & ((c + a) + (d & 47));
+  if(c < b){
+    b = ((d | c) | (d | p)) ^ ((d & d) - (p ^ a));
+  }else{
+    b = ((q * d) | (d - q)) ^ ((c + 29) | (a ^ q));
+  }
+  a = ((b ^ 7) + (a | 11)) + ((b * q) - (q + c));
+  a = ((p + b) ^ (b | 49)) | ((q ^ p) | (a + d));
+  b = ((p - 13) ^ (p & q)) * ((q * c) | (d & d));
+  a = ((q ^ 66) - (p * p)) + ((c + c) ^ (d & 9));
+  if(b < a){
+    b = ((p | d) * (c - p)) - ((c & d) | (q & p));
+  }else{
+    a = ((c ^ c) - (q ^ 24)) ^ ((q - p) - (b * a));
+  }
+  a = ((q * c) - (p + d)) | ((d - c) - (c ^ d));
+  for(i = 0; i < 6; i++){
+    a = ((d & d) * (p | d)) | ((c * b) & (b * b));
+  }
+  a = ((p | a) * (d * d)) & ((b * a) * (c - b));
+  b = ((b * b) & (b + q)) - ((p | q) & (q & 55));
+  if(b < 9){
+    b = ((c + b) - (p ^ c)) | ((d | a) + (a + p));
+  }else{
+    d = ((p + 78) * (a + d)) - ((a & q) | (c | a));
+  }
+  a = ((p & p) | (a ^ p)) + ((d * q) ^ (p * 75));
+  a = ((q * 27) * (b * b)) * ((q + b) * (d | 60));
+  a = ((q ^ 28) & (a * p)) & ((q | c) ^ (a * 19));
+  for(i = 0; i < 7; i++){
+    a = ((b ^ c) & (q * 95)) | ((p ^ c) & (p & p));
+  }
+  if(a < a){
+    b = ((p | c) - (p | 89)) + ((p ^ d) - (b * b));
+  }else{
+    c = ((d * a) + (a + 88)) * ((a ^ 88) - (q - p));
+  }
+  return a + b + c + d;
+}
+
+int func75(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 31;
+  d = 1;
+  c = ((q + d) + (c & a)) ^ ((b & p) | (c * d));
+  b = ((b ^ b) - (p + a)) - ((q | 31) ^ (c + 69));
+  b = ((a & a) - (p | 16)) | ((d ^ q) + (c ^ q));
+  a = ((q + p) + (c & p)) ^ ((c | a) - (a & b));
+  if(b < p){
+    d = ((p + a) * (b & 75)) * ((a | 82) | (c & 31));
+  }else{
+    b = ((q * p) + (c - b)) * ((p | b) | (a | c));
+  }
+  b = ((b * b) | (q & a)) ^ ((b + p) * (b + 22));
+  for(i = 0; i < 10; i++){
+    c = ((d * a) * (a + 49)) & ((d * a) ^ (p ^ a));
+  }
+  d = ((a ^ p) * (p - a)) & ((c ^ 37) - (p ^ c));
+  a = ((b ^ c) ^ (q * d)) & ((q + 17) | (a ^ d));
+  if(c < d){
+    d = ((q | 70) ^ (c & d)) | ((a * a) & (q & 87));
+  }else{
+    c = ((d | b) & (q | d)) * ((d + 65) ^ (b | b));
+  }
+  b = ((b + c) ^ (q - 12)) * ((c - a) - (b ^ p));
+  d = ((p | a) ^ (b ^ p)) + ((q | 54) * (q + d));
+  a = ((b ^ q) ^ (c & b)) - ((c ^ 74) + (c | 13));
+  for(i = 0; i < 38; i++){
+    c = ((d | p) * (p * c)) ^ ((a - d) & (p | p));
+  }
+  if(b < b){
+    b = ((p - q) + (q * c)) + ((q & 72) | (q | 21));
+  }else{
+    c = ((d - d) ^ (b ^ c)) | ((p | b) & (b + 46));
+  }
+  c = ((c & q) + (a & 23)) * ((c - q) & (d * b));
+  d = ((c * q) * (b ^ 80)) + ((q * a) - (a | b));
+  c = ((q - c) * (c - p)) * ((d + d) + (p + a));
+  a = ((c & a) * (b & c)) + ((d + 88) * (a - b));
+  if(d < 9){
+    c = ((c * q) - (p - p)) * ((a ^ c) + (d + q));
+  }else{
+    b = ((d | c) | (d ^ c)) - ((b + c) + (b ^ b));
+  }
+  for(i = 0; i < 23; i++){
+    b = ((d | d) + (p - a)) | ((d - c) | (q * a));
+  }
+  b = ((b - p) + (p & b)) ^ ((b | d) + (d & a));
+  c = ((d - 80) + (q + q)) * ((p * c) ^ (c + 59));
+  c = ((p + 31) ^ (c ^ a)) | ((b * b) & (c + b));
+  if(a < b){
+    d = ((a & q) | (a * c)) - ((q + d) - (b + q));
+  }else{
+    c = ((a & c) | (c * d)) - ((q | 57) + (p * 60));
+  }
+  d = ((a * 68) & (q - 78)) ^ ((d - p) - (b * 3));
+  d = ((a * c) + (q * c)) ^ ((q | 99) ^ (p + b));
+  for(i = 0; i < 46; i++){
+    d = ((b ^ p) | (b * q)) & ((b * 28) & (b + d));
+  }
+  b = ((d + c) ^ (c * 39)) ^ ((c * a) - (a - d));
+  if(c < 43){
+    b = ((d * c) - (a + a)) | ((d - q) ^ (q & q));
+  }else{
+    a = ((b | d) | (p ^ p)) ^ ((d - 52) | (p - d));
+  }
+  d = ((c - b) | (d ^ 39)) + ((b ^ 31) ^ (b & a));
+  c = ((a & a) + (p | q)) * ((c | d) - (a & p));
+  b = ((q * d) - (c ^ q)) * ((a * c) | (p & d));
+  a = ((c + q) - (p * c)) ^ ((a * d) + (q - d));
+  if(b < b){
+    b = ((b & p) + (p + p)) ^ ((c | a) | (p + c));
+  }else{
+    a = ((a + q) * (q * d)) | ((b + c) & (d | b));
+  }
+  c = ((d - q) * (a ^ p)) | ((d * b) | (c | 44));
+  b = ((d | p) - (q & 53)) & ((c - a) * (a + c));
+  b = ((p * 6) ^ (b + 5)) ^ ((d + a) & (d & p));
+  d = ((d + 96) | (a | p)) - ((c * 86) - (q ^ q));
+  if(d < p){
+    b = ((b & p) | (b * p)) & ((c ^ p) ^ (q & q));
+  }else{
+    a = ((c | c) * (d & d)) ^ ((a - d) & (q ^ d));
+  }
+  d = ((p + a) ^ (a - p)) * ((p & c) ^ (q + p));
+  for(i = 0; i < 20; i++){
+    d = ((d ^ a) ^ (q ^ q)) & ((b | p) - (b - b));
+  }
+  c = ((b & d) - (b | q)) ^ ((a | 55) * (b * c));
+  c = ((q & c) & (p ^ a)) - ((d ^ c) & (c - q));
+  if(c < b){
+    d = ((p + a) ^ (a + 14)) + ((d - b) - (b & d));
+  }else{
+    a = ((b * c) & (c & c)) * ((c ^ a) + (a & b));
+  }
+  c = ((p - c) * (d ^ 20)) - ((d + 49) - (c * c));
+  a = ((q - d) ^ (d - 68)) ^ ((q + 23) - (b + 69));
+  b = ((q & c) | (b * 11)) ^ ((c * p) + (c + d));
+  for(i = 0; i < 7; i++){
+    d = ((c ^ q) & (a & a)) - ((d & 67) - (c - a));
+  }
+  if(b < p){
+    a = ((b - a) * (a ^ b)) * ((b + q) + (d * q));
+  }else{
+    d = ((b ^ d) & (p * a)) ^ ((q ^ p) & (d | q));
+  }
+  return a + b + c + d;
+}
+
+int func76(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 28;
+  c = ((c ^ p) * (d - c)) | ((d ^ a) - (a ^ a));
+  c = ((p ^ d) ^ (p | d)) - ((a + q) ^ (d | b));
+  c = ((a + 12) & (a * p)) & ((q - 3) | (b ^ 11));
+  a = ((c & b) - (b * p)) * ((d | 60) * (p ^ q));
+  if(a < q){
+    a = ((c + d) ^ (d - a)) * ((q - q) - (a - 3));
+  }else{
+    b = ((a & b) - (d - p)) + ((p ^ 46) & (d & c));
+  }
+  b = ((q + p) - (d | 59)) ^ ((q - p) + (c * a));
+  for(i = 0; i < 30; i++){
+    c = ((c + d) * (c ^ q)) ^ ((a - p) - (c & c));
+  }
+  b = ((b * p) * (c | d)) - ((b ^ p) & (d + 69));
+  c = ((b + 76) + (b & a)) - ((b + p) - (p * c));
+  if(d < p){
+    b = ((a - a) ^ (p - p)) * ((q | 44) & (c ^ q));
+  }else{
+    c = ((d ^ d) | (b & c)) | ((c & a) & (b - p));
+  }
+  a = ((c ^ c) - (q + c)) * ((b | 93) + (d + b));
+  b = ((c * d) + (b ^ p)) & ((d + d) * (q & a));
+  d = ((q + c) ^ (c * 26)) ^ ((p ^ b) & (d * p));
+  for(i = 0; i < 8; i++){
+    a = ((q - 75) + (b + a)) + ((d * b) ^ (q - 43));
+  }
+  if(b < a){
+    d = ((q - 47) & (p * p)) | ((p + a) | (c ^ p));
+  }else{
+    c = ((c | p) - (d + 13)) + ((b * q) ^ (c - q));
+  }
+  d = ((q - a) + (a - 67)) | ((c | d) - (b & b));
+  b = ((a + 73) | (a * q)) | ((d - q) | (b + 25));
+  a = ((d + 43) * (a * p)) ^ ((c & p) - (c ^ q));
+  c = ((d & 70) + (b ^ q)) + ((c & d) * (b - p));
+  if(b < 72){
+    b = ((b & 50) * (q - 50)) - ((b * b) * (b + 45));
+  }else{
+    d = ((p - c) ^ (a & q)) & ((c + b) * (a + a));
+  }
+  for(i = 0; i < 8; i++){
+    b = ((a & p) & (q * b)) | ((p * a) ^ (q + c));
+  }
+  b = ((b | c) + (c - 64)) ^ ((p | 95) | (a * c));
+  c = ((a | 25) ^ (d * d)) * ((c ^ p) & (p * a));
+  c = ((b + 52) & (c + q)) - ((d & 61) * (a | 83));
+  if(d < 8){
+    d = ((a * d) ^ (q + a)) - ((c - p) | (a + c));
+  }else{
+    c = ((d ^ p) * (b - 64)) - ((p & q) * (a * 8));
+  }
+  d = ((a + c) + (b * c)) & ((a - c) | (p * p));
+  c = ((p | c) - (p * q)) & ((b & q) & (q ^ d));
+  for(i = 0; i < 6; i++){
+    d = ((a * c) - (d | d)) ^ ((c - a) + (q | 1));
+  }
+  a = ((d * a) | (c * a)) * ((d + d) ^ (b * d));
+  if(a < 32){
+    d = ((q - c) + (c | 23)) ^ ((a - q) ^ (a | d));
+  }else{
+    c = ((q - a) * (c ^ q)) - ((q * d) - (d | c));
+  }
+  d = ((b ^ 21) + (b + 20)) + ((p * a) + (d ^ 61));
+  b = ((c & c) & (q + p)) + ((p & q) ^ (d & 9));
+  d = ((c * c) & (d + p)) & ((c & p) ^ (a * 24));
+  c = ((c - p) ^ (d ^ a)) + ((q + c) - (p ^ b));
+  if(d < 25){
+    d = ((p & q) * (b - c)) * ((a - c) ^ (c - p));
+  }else{
+    d = ((d + 49) + (b | a)) & ((q * d) - (a * a));
+  }
+  b = ((d & d) + (b - b)) + ((q * 97) & (b & 19));
+  b = ((q + 23) ^ (a | d)) & ((q ^ p) * (p * p));
+  b = ((a - d) * (q - c)) ^ ((c * a) + (c * 89));
+  c = ((b + c) ^ (d * a)) | ((p | q) + (b | d));
+  if(d < b){
+    d = ((c * 24) | (p + d)) * ((b + q) ^ (b * q));
+  }else{
+    a = ((c * 69) + (p | q)) + ((d & d) | (a - d));
+  }
+  a = ((c ^ q) * (c ^ q)) | ((q ^ 75) + (d & d));
+  for(i = 0; i < 12; i++){
+    d = ((p & d) - (c ^ 26)) ^ ((d * b) - (q | 73));
+  }
+  c = ((c - p) | (a & 74)) * ((c - b) ^ (p ^ c));
+  d = ((d + d) + (c * q)) | ((p * b) + (a + b));
+  if(b < a){
+    b = ((q | q) | (a & p)) * ((a | a) * (d ^ a));
+  }else{
+    d = ((p | b) & (b - b)) - ((p * q) ^ (d + d));
+  }
+  b = ((q + 3) & (q - b)) ^ ((p * p) - (p + 46));
+  b = ((a & a) * (c & p)) + ((b - q) & (a * b));
+  a = ((c | 1) & (d * d)) * ((a * 59) + (d & d));
+  for(i = 0; i < 40; i++){
+    b = ((p - 39) & (c + q)) - ((c + 85) - (a & 98));
+  }
+  if(c < a){
+    b = ((b * q) ^ (p - a)) ^ ((q & c) | (a ^ q));
+  }else{
+    b = ((q & b) & (a & a)) & ((q + d) & (c ^ d));
+  }
+  return a + b + c + d;
+}
+
+int func77(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 51;
+  d = 96;
+  b = ((b ^ q) + (a * b)) + ((b * 66) | (p ^ 81));
+  a = ((a ^ b) - (c * a)) ^ ((b + q) * (c ^ b));
+  d = ((c & b) * (q * p)) - ((q | p) & (c - p));
+  b = ((a & d) | (b * 17)) * ((c & a) * (q * 28));
+  if(b < a){
+    c = ((q & p) * (d + d)) | ((d * c) * (q * 14));
+  }else{
+    b = ((a * q) ^ (d & 49)) + ((q * b) ^ (c * b));
+  }
+  c = ((d | 97) | (d - d)) & ((c - a) - (q & a));
+  for(i = 0; i < 12; i++){
+    d = ((p ^ b) ^ (d - q)) + ((d + q) ^ (p | 40));
+  }
+  d = ((c - c) | (p + q)) & ((c | 27) | (q ^ b));
+  d = ((d + b) - (a * a)) * ((q & 12) & (d ^ a));
+  if(c < a){
+    b = ((q | q) & (q - 82)) + ((a ^ b) & (c * b));
+  }else{
+    b = ((p - q) * (a * p)) | ((d - p) * (a ^ a));
+  }
+  d = ((b | 5) & (p ^ a)) ^ ((c ^ a) - (a * 44));
+  d = ((b | b) - (p & 36)) - ((b ^ p) + (p & 48));
+  c = ((q - p) - (p + p)) + ((c | 13) & (c - q));
+  for(i = 0; i < 25; i++){
+    c = ((q - 29) ^ (d + 85)) ^ ((b | c) - (c - a));
+  }
+  if(b < 29){
+    a = ((p + d) ^ (p - 74)) + ((c * 33) | (d * 74));
+  }else{
+    d = ((d & q) & (c + 52)) + ((q | p) + (a ^ d));
+  }
+  a = ((p | 76) * (p * q)) | ((p | d) * (a & 75));
+  c = ((p ^ 32) + (c + p)) ^ ((d + c) & (c - d));
+  a = ((p + q) + (c | q)) * ((p | d) & (q + c));
+  b = ((p + p) | (q | 59)) - ((a & b) + (b & b));
+  if(b < b){
+    b = ((d - b) + (b & 19)) * ((q * 9) ^ (d & 37));
+  }else{
+    b = ((p | a) * (p ^ 99)) ^ ((b & p) ^ (c + p));
+  }
+  for(i = 0; i < 45; i++){
+    c = ((b + q) | (d | c)) * ((b & a) & (b ^ 79));
+  }
+  b = ((b | q) * (c * c)) & ((a & d) + (c * p));
+  b = ((q * p) | (q | 99)) - ((b & d) - (c * a));
+  d = ((p - q) * (c ^ 74)) + ((a ^ 62) | (c & d));
+  if(b < c){
+    b = ((d * c) | (d - b)) ^ ((a & q) - (a & c));
+  }else{
+    d = ((p ^ q) | (c - d)) ^ ((p ^ 75) * (b * 43));
+  }
+  d = ((q + p) + (a & q)) - ((a | p) ^ (q + b));
+  c = ((q * c) + (c - 73)) * ((b ^ d) - (b ^ 64));
+  for(i = 0; i < 3; i++){
+    c = ((a * b) & (p | c)) & ((a + c) - (p | a));
+  }
+  d = ((c | p) | (p - a)) | ((d + a) & (q + 27));
+  if(b < q){
+    b = ((q & 84) * (q * 76)) | ((c & 34) | (d ^ c));
+  }else{
+    d = ((p + a) - (d - d)) - ((a + q) | (d & q));
+  }
+  d = ((a * d) & (p + c)) + ((p ^ c) ^ (c ^ 4));
+  b = ((d * 52) * (b + q)) - ((p | d) + (c | q));
+  b = ((d + p) | (b + a)) & ((b * b) | (b | p));
+  b = ((a - d) & (b * 64)) + ((d ^ d) | (d ^ d));
+  if(d < 98){
+    a = ((q + a) * (a ^ a)) - ((b | 13) | (a * d));
+  }else{
+    d = ((d ^ 38) - (a | b)) & ((a & a) ^ (c + 37));
+  }
+  c = ((b * b) + (q - d)) ^ ((q * c) - (b * a));
+  a = ((a ^ q) ^ (a & 67)) | ((q ^ c) * (p & b));
+  c = ((a * q) ^ (p & p)) | ((b & 18) - (b + a));
+  a = ((d * p) + (q + p)) + ((b + c) ^ (a * 33));
+  if(d < a){
+    c = ((a & c) & (c - 39)) + ((p & a) | (d ^ d));
+  }else{
+    b = ((d - b) - (c + 4)) | ((b * d) * (c & b));
+  }
+  a = ((d ^ b) * (p - c)) + ((d + 97) ^ (d * c));
+  for(i = 0; i < 11; i++){
+    c = ((b & q) - (q * q)) * ((a * 96) - (d | 83));
+  }
+  c = ((p | p) * (d | p)) - ((c + c) & (c ^ c));
+  a = ((c - 87) - (a & 99)) + ((b & 52) | (c * b));
+  if(c < q){
+    d = ((p * d) + (b - 7)) ^ ((p + d) * (d ^ q));
+  }else{
+    b = ((d | a) + (p & q)) + ((d - q) - (q - 10));
+  }
+  d = ((d * 3) - (p ^ 3)) - ((b ^ p) - (q * b));
+  b = ((a | a) + (d & b)) ^ ((d ^ q) * (p ^ 33));
+  c = ((a | d) * (a - p)) | ((p | c) * (p - b));
+  for(i = 0; i < 12; i++){
+    d = ((p | p) * (c ^ q)) - ((p - c) | (q + c));
+  }
+  if(b < b){
+    b = ((b + 83) - (c * b)) | ((d ^ p) + (a | d));
+  }else{
+    c = ((q + q) - (p & b)) * ((d + b) & (q * p));
+  }
+  return a + b + c + d;
+}
+
+int func78(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 59;
+  b = ((q | c) ^ (p * 19)) + ((a | d) & (p * d));
+  b = ((c * c) - (q + b)) & ((d + b) | (q + q));
+  c = ((a ^ p) & (c ^ c)) & ((b - q) * (d - q));
+  b = ((b + 68) + (q ^ a)) | ((a & p) | (c + b));
+  if(a < p){
+    b = ((q & b) | (d + 97)) & ((b | b) ^ (q + p));
+  }else{
+    d = ((p + p) | (b | 52)) & ((p + q) ^ (p | p));
+  }
+  a = ((c + c) - (d - 10)) - ((a ^ p) & (a ^ 14));
+  for(i = 0; i < 24; i++){
+    d = ((q + 94) ^ (a ^ p)) | ((b * p) ^ (q * 9));
+  }
+  d = ((c | d) ^ (q * 70)) * ((q | p) ^ (q - b));
+  d = ((q | a) ^ (d ^ b)) | ((b - 66) - (a * p));
+  if(c < 99){
+    c = ((d ^ q) - (a - b)) & ((b - q) + (c * c));
+  }else{
+    a = ((c * d) & (c * 62)) | ((p - 5) & (b ^ c));
+  }
+  c = ((b | 23) - (p - q)) ^ ((d - b) * (b & 22));
+  c = ((q & b) ^ (p | d)) | ((p | c) ^ (q | 4));
+  d = ((b & a) * (q + 44)) - ((q | q) + (q & p));
+  for(i = 0; i < 32; i++){
+    a = ((a & 65) * (d * c)) - ((c | b) & (d + 60));
+  }
+  if(b < d){
+    a = ((b * q) + (p & b)) & ((q ^ 76) | (q + c));
+  }else{
+    c = ((b & p) * (a * q)) | ((a & c) - (c & d));
+  }
+  b = ((d ^ p) ^ (q ^ 51)) ^ ((a ^ a) + (c - b));
+  d = ((d ^ b) * (c * c)) * ((q | d) + (c - b));
+  a = ((d & 95) & (q ^ c)) * ((b + a) * (a & 75));
+  b = ((p ^ c) - (p | q)) + ((a - q) * (b | a));
+  if(b < a){
+    d = ((b ^ 38) & (q ^ c)) ^ ((q * d) ^ (b & d));
+  }else{
+    a = ((p * p) & (a + b)) & ((d | q) | (d ^ 95));
+  }
+  for(i = 0; i < 40; i++){
+    a = ((c - a) * (d * q)) - ((b - p) ^ (q | b));
+  }
+  b = ((d + 47) ^ (a + 12)) & ((c - d) ^ (a + q));
+  d = ((a * b) ^ (d - a)) + ((c - d) * (p + q));
+  c = ((d | 28) | (b & p)) | ((p - 36) | (q + b));
+  if(b < d){
+    d = ((a + a) | (q + q)) ^ ((q * p) | (a - q));
+  }else{
+    a = ((d - a) ^ (q ^ 96)) ^ ((c | p) * (d - 27));
+  }
+  c = ((d * 11) | (q * b)) + ((q * c) ^ (d + 19));
+  c = ((d & b) * (q ^ b)) - ((b * q) + (q & c));
+  for(i = 0; i < 13; i++){
+    a = ((q ^ 24) - (p & 46)) ^ ((d & d) | (q | q));
+  }
+  b = ((b * 32) * (q & q)) - ((c | q) & (d - 63));
+  if(b < q){
+    c = ((d ^ b) * (d - p)) & ((p | p) | (d + d));
+  }else{
+    b = ((d * 8) | (p - c)) | ((b | b) - (q ^ a));
+  }
+  d = ((d + p) - (p + a)) + ((c - b) - (p & 67));
+  c = ((d * c) + (q | d)) ^ ((q & p) & (a | 74));
+  a = ((c - q) ^ (p ^ 13)) - ((q | c) ^ (p & p));
+  d = ((p ^ b) + (p & 95)) | ((b * a) + (b + c));
+  if(b < p){
+    b = ((d - d) - (b + b)) - ((a ^ a) ^ (c - a));
+  }else{
+    d = ((c & 24) & (a | c)) + ((d ^ 64) * (c * 36));
+  }
+  d = ((b & b) - (d - 68)) | ((b - 6) - (d * 83));
+  c = ((a | q) ^ (p - d)) + ((q * c) - (p * 32));
+  b = ((p | 89) - (q ^ c)) & ((b | a) | (a - c));
+  b = ((q * d) & (d | b)) - ((q - 77) ^ (p + p));
+  if(b < 8){
+    b = ((b * c) & (b + d)) * ((p & d) & (p + b));
+  }else{
+    b = ((p + 95) ^ (a * c)) & ((c ^ b) | (a * c));
+  }
+  c = ((b | p) & (p + d)) & ((p + d) - (d - d));
+  for(i = 0; i < 33; i++){
+    a = ((q + a) * (p ^ 79)) ^ ((a + a) & (d - d));
+  }
+  d = ((q ^ p) ^ (p & 22)) | ((a & b) - (d - 83));
+  a = ((c ^ 22) ^ (a * 24)) * ((q * a) - (p + p));
+  if(a < b){
+    a = ((b - a) & (c * b)) & ((a | q) | (p | d));
+  }else{
+    b = ((b ^ 12) + (d ^ 41)) & ((p * c) * (p | b));
+  }
+  b = ((q * b) & (a - p)) & ((b & c) ^ (d ^ d));
+  d = ((b + 81) + (a + 3)) | ((c + p) | (p + b));
+  c = ((b - a) - (a * a)) ^ ((c & 62) & (p + c));
+  for(i = 0; i < 25; i++){
+    a = ((b | b) * (c - c)) * ((d & d) * (d & c));
+  }
+  if(a < a){
+    b = ((q - 50) * (p - d)) | ((d | d) - (d ^ c));
+  }else{
+    c = ((p + 9) - (q ^ d)) & ((a + a) - (p & a));
+  }
+  return a + b + c + d;
+}
+
+int func79(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 56;
+  d = 78;
+  a = ((b * q) ^ (c - 35)) * ((c | 33) - (c - 94));
+  c = ((b ^ c) - (p ^ 6)) + ((b & q) | (a * b));
+  d = ((p * a) - (c - q)) & ((c * 67) * (c - 71));
+  c = ((c * a) & (d & d)) + ((d & 36) | (c | 63));
+  if(c < b){
+    a = ((d * 75) - (b - p)) | ((d & d) * (a * d));
+  }else{
+    b = ((c * 77) ^ (p + p)) ^ ((q | d) | (c & c));
+  }
+  d = ((q + 35) ^ (d * p)) + ((b | q) + (a ^ a));
+  for(i = 0; i < 45; i++){
+    a = ((c | p) - (b + 99)) - ((p & d) ^ (d ^ p));
+  }
+  b = ((c - b) - (q & c)) + ((a | d) * (c | p));
+  d = ((b * p) | (p * p)) ^ ((b & 51) * (q | d));
+  if(a < d){
+    d = ((d * q) * (p & c)) | ((p - p) + (c ^ 19));
+  }else{
+    d = ((p ^ p) & (c + 68)) ^ ((q | 78) * (c | d));
+  }
+  d = ((d * b) | (d + 43)) ^ ((p ^ c) ^ (c + b));
+  a = ((q + q) * (b & q)) - ((a * q) | (q ^ b));
+  a = ((d * q) - (a - 43)) | ((d & b) & (p * c));
+  for(i = 0; i < 2; i++){
+    c = ((d - p) & (a | 30)) - ((q - p) & (b + p));
+  }
+  if(b < p){
+    d = ((d & q) ^ (a | c)) | ((a & p) & (c & a));
+  }else{
+    d = ((p & a) ^ (p ^ 77)) ^ ((a | b) & (q & q));
+  }
+  a = ((b - b) - (p ^ p)) - ((c & p) - (d | 63));
+  b = ((d | q) * (b * 67)) * ((b + a) + (d - 66));
+  b = ((p + p) & (a + b)) ^ ((p - 55) ^ (a & b));
+  c = ((b | p) + (p ^ c)) | ((q + c) | (q & a));
+  if(c < q){
+    a = ((b * c) ^ (c + 87)) - ((q + q) & (c * q));
+  }else{
+    b = ((c & q) ^ (p | d)) * ((q & 97) | (a | 76));
+  }
+  for(i = 0; i < 49; i++){
+    a = ((a + b) * (q * q)) * ((c & p) - (p - b));
+  }
+  c = ((a ^ c) * (a ^ q)) + ((d & q) | (c ^ a));
+  c = ((a & a) & (a | d)) & ((q & c) | (d - c));
+  a = ((a * 88) | (b * a)) ^ ((b | a) + (p | 52));
+  if(c < q){
+    b = ((a + b) & (p + 27)) + ((d * p) & (q * a));
+  }else{
+    c = ((p + c) ^ (q | 94)) + ((b * c) ^ (a * d));
+  }
+  a = ((q * d) + (q + b)) ^ ((q + a) * (b & q));
+  c = ((a - a) - (b - d)) | ((a & p) - (a | c));
+  for(i = 0; i < 21; i++){
+    c = ((d + b) * (q * 61)) ^ ((c - c) + (a * 56));
+  }
+  b = ((p | a) - (d ^ 27)) * ((p * 18) & (d - p));
+  if(d < 6){
+    b = ((a | c) | (d + 74)) & ((d | d) - (q ^ 44));
+  }else{
+    c = ((q - b) ^ (a & p)) & ((a ^ d) + (d & 25));
+  }
+  d = ((p - q) + (a ^ p)) ^ ((c + b) | (d - q));
+  a = ((d | 6) | (d - d)) * ((q - 33) | (p & a));
+  b = ((p - q) & (q | q)) & ((b | b) | (d + q));
+  d = ((q | p) + (q - 63)) & ((b & d) - (a + d));
+  if(b < b){
+    d = ((c & 18) - (c ^ b)) | ((q ^ p) ^ (b | 5));
+  }else{
+    c = ((a + 13) + (a - b)) - ((d * b) + (p ^ 76));
+  }
+  d = ((c - q) | (c ^ p)) * ((a ^ q) * (a | b));
+  b = ((d | a) + (b * p)) | ((a - p) & (a * 70));
+  a = ((d | q) & (d - a)) * ((q & 94) ^ (a * c));
+  a = ((q ^ p) * (a + p)) - ((b + 57) - (p & 80));
+  if(c < p){
+    b = ((p & 44) & (a | 64)) * ((b - a) * (p + 64));
+  }else{
+    b = ((d - q) ^ (a + q)) ^ ((a | a) - (q | d));
+  }
+  d = ((q - d) * (p ^ b)) * ((b * p) ^ (a + a));
+  for(i = 0; i < 15; i++){
+    d = ((q * b) + (c | 37)) | ((q + b) & (d | 38));
+  }
+  c = ((q * q) ^ (d + d)) * ((c - 47) & (p - b));
+  b = ((a * 17) * (b ^ c)) - ((c & p) - (q + c));
+  if(a < 85){
+    a = ((d - 11) | (c * 29)) + ((q + d) + (q & a));
+  }else{
+    d = ((b & p) ^ (b ^ 80)) + ((d ^ 76) & (p * 45));
+  }
+  b = ((q + 39) + (c - p)) - ((a ^ a) + (q + d));
+  a = ((q * 30) & (q & c)) - ((p & b) ^ (p - a));
+  d = ((q | q) & (q * d)) - ((a * 31) | (p ^ d));
+  for(i = 0; i < 45; i++){
+    d = ((a + 85) - (a + d)) * ((b - 72) | (p + 85));
+  }
+  if(a < q){
+    a = ((b * b) | (b - a)) & ((d - a) | (q | 75));
+  }else{
+    b = ((d - d) & (p | c)) * ((d ^ a) & (c & 11));
+  }
+  return a + b + c + d;
+}
+
+int func80(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 63;
+  d = 89;
+  a = ((c * b) ^ (b - q)) | ((c | d) | (a * q));
+  d = ((a | q) ^ (a * 18)) + ((q & 65) ^ (a | q));
+  d = ((b ^ b) - (b ^ p)) | ((a - q) * (q - d));
+  c = ((c ^ c) * (p * a)) & ((c + d) & (p & 58));
+  if(b < p){
+    b = ((c ^ b) | (a + 96)) | ((a | q) & (q ^ q));
+  }else{
+    a = ((q ^ b) | (p * p)) & ((a & c) + (a * q));
+  }
+  c = ((d & p) ^ (b - 62)) & ((q ^ b) & (c + p));
+  for(i = 0; i < 10; i++){
+    d = ((d ^ 89) * (b * d)) * ((q + a) & (c | a));
+  }
+  a = ((a - a) - (b + 28)) * ((c + b) + (p - d));
+  b = ((a + p) ^ (p + d)) + ((a | p) - (p ^ p));
+  if(b < a){
+    d = ((q + 24) ^ (a ^ 82)) + ((c & a) | (d * p));
+  }else{
+    b = ((b & 67) ^ (p ^ b)) ^ ((d * b) | (b + d));
+  }
+  d = ((a & p) + (q - q)) ^ ((c * b) ^ (b | q));
+  a = ((b & d) * (p * a)) * ((a | 67) + (q ^ p));
+  a = ((b - a) | (b | q)) + ((q ^ 39) * (c | d));
+  for(i = 0; i < 41; i++){
+    a = ((b | 54) | (a - a)) - ((c | c) ^ (p * c));
+  }
+  if(c < a){
+    c = ((c * a) - (c * d)) ^ ((b + p) - (b ^ a));
+  }else{
+    a = ((p * q) + (p ^ 78)) & ((b * d) + (c | 22));
+  }
+  d = ((q ^ 16) | (p + q)) & ((p | 59) & (a - d));
+  a = ((p ^ q) * (c & a)) * ((d | b) * (q | d));
+  d = ((d + b) & (b - c)) & ((d | 24) - (q ^ 98));
+  a = ((q ^ a) | (b ^ a)) + ((q & q) - (c - 58));
+  if(d < p){
+    d = ((d - q) & (a | q)) & ((q | 99) * (c | b));
+  }else{
+    d = ((b & 3) | (q ^ q)) | ((q + d) | (p * a));
+  }
+  for(i = 0; i < 38; i++){
+    a = ((d + a) | (a ^ b)) * ((p + b) - (q - d));
+  }
+  b = ((c * 6) & (b ^ a)) * ((p + 72) | (b & c));
+  d = ((a - 45) & (c | d)) ^ ((c * b) - (a | 13));
+  b = ((d + 43) & (p - b)) + ((d | a) ^ (c & b));
+  if(b < d){
+    c = ((p + c) | (q + q)) + ((b ^ 86) ^ (q * b));
+  }else{
+    d = ((p + q) & (q * 62)) & ((c * p) ^ (b * c));
+  }
+  b = ((c | b) | (p - c)) & ((a - c) ^ (c - a));
+  a = ((b & c) ^ (d * a)) & ((a ^ 26) | (a * a));
+  for(i = 0; i < 40; i++){
+    c = ((a * d) + (q - q)) - ((c * d) - (d ^ c));
+  }
+  c = ((d ^ 30) & (d ^ b)) + ((p + 37) ^ (a | b));
+  if(b < q){
+    c = ((b & d) * (c | b)) & ((q - b) | (p + a));
+  }else{
+    b = ((b * 53) & (b + d)) ^ ((d ^ b) & (d | 38));
+  }
+  a = ((d + p) - (q * b)) + ((c * p) - (b ^ c));
+  c = ((b - q) | (b + d)) ^ ((d - 58) | (q | b));
+  b = ((d | a) | (a ^ a)) * ((p | 85) - (d | c));
+  a = ((c | 68) & (a | b)) + ((d - q) | (d & 56));
+  if(a < b){
+    b = ((d + 50) | (d & 44)) & ((b ^ b) * (a ^ 80));
+  }else{
+    b = ((d | 67) - (b | c)) ^ ((a - b) * (a * a));
+  }
+  d = ((p - 63) - (p + 60)) & ((a * d) + (b - a));
+  a = ((c + p) - (c - 57)) * ((q - 46) + (p | 94));
+  b = ((a * p) | (p | 44)) | ((b + 44) - (q * d));
+  c = ((q ^ d) | (c - p)) ^ ((p - 31) - (p - 78));
+  if(c < 37){
+    d = ((p & q) ^ (a + a)) + ((a | 82) | (b + b));
+  }else{
+    a = ((c * 85) ^ (q * q)) | ((b ^ 33) ^ (q ^ c));
+  }
+  b = ((p ^ a) | (d & 4)) ^ ((c ^ a) - (p * b));
+  for(i = 0; i < 26; i++){
+    b = ((a | c) | (a - d)) ^ ((d - 57) | (p ^ 86));
+  }
+  c = ((b + q) | (q | d)) ^ ((b & d) | (q | q));
+  c = ((c & 82) - (c | b)) ^ ((a | q) * (c & p));
+  if(a < 18){
+    b = ((q - p) ^ (p - a)) + ((c + 73) & (c & d));
+  }else{
+    c = ((b - 13) * (c - c)) * ((b | d) | (q ^ q));
+  }
+  d = ((d | c) | (d - d)) - ((p - 49) | (a | a));
+  d = ((c * b) + (p * p)) + ((b ^ b) * (d & p));
+  a = ((d + c) - (q * 7)) & ((q + a) ^ (a * 14));
+  for(i = 0; i < 49; i++){
+    d = ((p * q) + (q - b)) * ((a ^ c) & (d & p));
+  }
+  if(b < 16){
+    c = ((p * 12) | (q + p)) + ((p + q) & (p * d));
+  }else{
+    b = ((c * d) | (b * 34)) - ((d & 58) - (b & c));
+  }
+  return a + b + c + d;
+}
+
+int func81(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 39;
+  d = 18;
+  a = ((d ^ 39) & (p + 72)) | ((c | 71) * (p + 5));
+  a = ((d | q) + (p * 59)) + ((b + 13) + (d - p));
+  b = ((q + p) ^ (a + 10)) ^ ((b + p) | (p | 33));
+  a = ((c - a) + (p + c)) - ((p * 90) + (c | d));
+  if(a < d){
+    a = ((d * p) * (a + c)) | ((d - 19) & (p * c));
+  }else{
+    b = ((q - 41) | (b & c)) & ((p & 32) * (c ^ b));
+  }
+  c = ((p - q) * (a + q)) * ((a - d) | (q * q));
+  for(i = 0; i < 25; i++){
+    a = ((p + d) * (d - c)) * ((b * 28) ^ (b - b));
+  }
+  a = ((b | a) - (c - a)) * ((p ^ 79) * (a | a));
+  a = ((c & p) * (c - d)) + ((p ^ c) ^ (p - 88));
+  if(a < 79){
+    a = ((q - p) * (c ^ a)) & ((b + 97) - (p ^ q));
+  }else{
+    b = ((d | a) * (c ^ 23)) - ((b & d) & (p ^ a));
+  }
+  a = ((p * 3) * (a * d)) + ((b - 35) + (q - d));
+  d = ((b + 61) + (b ^ b)) - ((d + 38) * (b & p));
+  a = ((q ^ c) & (a & q)) | ((p ^ b) * (p - p));
+  for(i = 0; i < 49; i++){
+    a = ((d | q) & (b - b)) + ((p ^ a) - (b & d));
+  }
+  if(c < d){
+    c = ((c | q) + (p ^ 84)) & ((p * 35) * (p * a));
+  }else{
+    c = ((b + p) & (c - a)) & ((c | 73) + (b ^ c));
+  }
+  a = ((q - 48) - (p ^ c)) + ((d ^ 39) | (a - d));
+  a = ((p - d) + (a | b)) & ((c ^ a) ^ (c - c));
+  b = ((a - q) * (q - c)) * ((q | b) & (q ^ b));
+  c = ((d + q) | (b - 19)) ^ ((p ^ p) & (p & d));
+  if(c < b){
+    b = ((p | c) - (p & d)) * ((q - 45) ^ (a + a));
+  }else{
+    b = ((p & 29) + (p ^ 77)) * ((d + a) + (c | q));
+  }
+  for(i = 0; i < 34; i++){
+    c = ((q - a) + (b * 75)) & ((c ^ a) - (a * a));
+  }
+  d = ((p + 76) ^ (a - 18)) | ((d ^ a) ^ (q & q));
+  a = ((p - q) * (b + 25)) ^ ((p & a) + (a ^ p));
+  c = ((d * a) & (b ^ 35)) | ((a & d) * (a & d));
+  if(d < b){
+    c = ((d * c) * (c ^ b)) ^ ((q + q) & (p & a));
+  }else{
+    a = ((b ^ p) ^ (d ^ q)) * ((c - a) | (q + 6));
+  }
+  b = ((d - 17) & (d * b)) - ((p | b) * (p * a));
+  c = ((c & d) | (a * b)) + ((d & q) - (p | 81));
+  for(i = 0; i < 34; i++){
+    b = ((c - 43) + (a * p)) - ((q + c) & (p * d));
+  }
+  a = ((a * p) & (a | c)) & ((c | q) - (b * q));
+  if(b < d){
+    a = ((c | d) * (c * c)) ^ ((q - b) | (b & b));
+  }else{
+    c = ((c * c) - (b ^ p)) & ((q * p) ^ (d * q));
+  }
+  b = ((a * c) * (b + c)) + ((p * 13) ^ (c & d));
+  c = ((b & c) | (d - d)) | ((q & b) + (c - p));
+  a = ((c * p) + (d * c)) * ((q * 61) - (p | a));
+  d = ((b | 58) + (a - a)) - ((c ^ a) | (c + a));
+  if(a < c){
+    b = ((q ^ 60) * (q - c)) | ((c & b) | (d & 19));
+  }else{
+    a = ((a & 43) * (b - 86)) + ((p & d) * (b | c));
+  }
+  c = ((a + 49) + (d | p)) & ((a + p) * (p | 66));
+  b = ((q ^ 15) & (p * q)) + ((a ^ q) | (p * a));
+  b = ((b | c) | (c | 19)) * ((a & 66) + (a - 79));
+  a = ((b & b) + (a ^ c)) + ((p & 28) & (c - a));
+  if(c < p){
+    b = ((q + d) * (b * p)) - ((c & c) ^ (p * d));
+  }else{
+    d = ((c & 92) ^ (c & d)) - ((c | a) - (c - b));
+  }
+  d = ((p & b) & (d * 86)) | ((d & b) - (c * b));
+  for(i = 0; i < 7; i++){
+    b = ((q & c) + (b | 95)) ^ ((a ^ a) - (q ^ c));
+  }
+  d = ((q - 53) * (c * b)) & ((d & d) ^ (b - 80));
+  b = ((q + 93) - (q & 45)) - ((p + 32) & (c ^ 93));
+  if(b < 89){
+    a = ((a - d) & (q + a)) | ((d - 52) * (p + q));
+  }else{
+    a = ((q | b) * (d & d)) | ((q + d) - (q & 49));
+  }
+  b = ((q + c) * (a + a)) + ((a ^ a) * (b | p));
+  c = ((d ^ d) - (p & c)) - ((d - q) ^ (d + b));
+  b = ((c * b) & (p * c)) & ((a + c) * (q - c));
+  for(i = 0; i < 20; i++){
+    a = ((a * p) * (a ^ c)) & ((c - d) * (a * 64));
+  }
+  if(a < a){
+    b = ((d & b) & (q + p)) ^ ((b + d) & (b - d));
+  }else{
+    c = ((p + 28) - (a * 41)) + ((c ^ b) * (d * 60));
+  }
+  return a + b + c + d;
+}
+
+int func82(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 28;
+  d = 96;
+  a = ((p + p) & (b | d)) | ((p * a) ^ (d ^ b));
+  c = ((p | a) + (p + a)) | ((d * a) ^ (b + d));
+  a = ((q | q) & (p * 46)) - ((c | a) & (d * c));
+  b = ((p + a) * (c & b)) ^ ((q * 96) + (d | a));
+  if(c < 47){
+    a = ((b | p) & (a | q)) | ((d - b) & (p ^ c));
+  }else{
+    b = ((p + c) & (d | a)) - ((d - c) - (d - q));
+  }
+  c = ((q + a) | (c | 80)) * ((a - d) - (q - 97));
+  for(i = 0; i < 38; i++){
+    a = ((d * b) - (q | q)) * ((c * d) | (c + 73));
+  }
+  b = ((a - a) | (d - 63)) * ((d | b) ^ (d | p));
+  b = ((p - c) + (b ^ b)) + ((p | d) & (b & q));
+  if(a < 12){
+    c = ((c | d) ^ (a | q)) | ((b + 67) | (c - 35));
+  }else{
+    d = ((a | d) + (b | 86)) - ((b & p) | (b ^ d));
+  }
+  d = ((a * 39) - (a * q)) - ((d * d) * (q & b));
+  a = ((c + q) ^ (q - a)) + ((p ^ p) | (q * a));
+  c = ((a - q) ^ (p | a)) * ((q | 18) + (c & d));
+  for(i = 0; i < 21; i++){
+    d = ((b | b) & (a ^ b)) + ((d * q) - (p - c));
+  }
+  if(c < 68){
+    a = ((q ^ a) ^ (p * b)) - ((c + p) & (a + c));
+  }else{
+    c = ((q - 43) * (q + p)) - ((p ^ p) * (c * a));
+  }
+  a = ((d + 25) - (c ^ 63)) + ((d ^ p) & (q * 9));
+  b = ((a ^ b) * (b & q)) - ((a + c) & (a | 61));
+  d = ((c + p) * (c ^ d)) - ((d ^ 97) - (c & 16));
+  a = ((p & q) + (a - b)) + ((q ^ 16) & (b | b));
+  if(d < 59){
+    c = ((a ^ d) * (a ^ d)) * ((p & a) + (a * b));
+  }else{
+    c = ((b ^ 70) ^ (p | a)) ^ ((q | p) | (b + q));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((d & 75) | (b + d)) ^ ((q | 67) ^ (p & d));
+  }
+  d = ((q - b) & (d + p)) + ((b * q) ^ (a | 65));
+  a = ((p - a) & (b - p)) ^ ((q + p) ^ (d & c));
+  c = ((d * c) & (b * 99)) & ((d | a) | (q + 2));
+  if(c < 36){
+    c = ((d ^ b) | (p + 79)) - ((c * c) + (c - q));
+  }else{
+    a = ((b ^ a) + (p & b)) ^ ((a ^ 29) | (q | q));
+  }
+  a = ((p ^ a) | (p | c)) & ((a + 21) - (d & c));
+  b = ((d - 83) - (a | d)) ^ ((b - q) ^ (p ^ 41));
+  for(i = 0; i < 32; i++){
+    c = ((q ^ a) * (d | c)) & ((q & q) + (d & b));
+  }
+  b = ((b & c) | (c ^ p)) + ((p & 76) * (c * 55));
+  if(b < d){
+    d = ((a ^ b) * (d * p)) * ((q + d) - (b * c));
+  }else{
+    c = ((a * q) + (q * 8)) - ((d + 44) ^ (c - 41));
+  }
+  a = ((c * c) & (c & 18)) & ((p * b) ^ (p - 78));
+  d = ((q | 35) ^ (b - 56)) * ((b ^ q) ^ (b & a));
+  c = ((d ^ c) ^ (p - c)) * ((b - c) + (p - a));
+  a = ((b | p) - (d * a)) + ((b | p) ^ (q | p));
+  if(a < p){
+    a = ((c - a) ^ (c | q)) + ((q * 19) ^ (p + b));
+  }else{
+    c = ((d & 27) + (b * 17)) & ((b + b) | (d | 56));
+  }
+  b = ((c | c) + (q | p)) + ((c ^ a) * (q + a));
+  b = ((d - d) | (b | c)) - ((c | 12) * (a | p));
+  d = ((a & a) - (q - a)) & ((c - a) * (q & a));
+  b = ((c - c) - (p ^ b)) * ((q - p) ^ (a + q));
+  if(b < q){
+    a = ((q + q) & (b + c)) * ((q | b) - (p + p));
+  }else{
+    c = ((a * p) - (a & p)) & ((p & 41) & (d - p));
+  }
+  c = ((p + p) - (b ^ c)) - ((c + 30) ^ (q + d));
+  for(i = 0; i < 3; i++){
+    c = ((p & a) + (q * 7)) | ((c + 71) & (p | q));
+  }
+  d = ((q ^ q) + (p & 69)) - ((p | a) - (a + q));
+  a = ((b - c) * (d ^ 26)) | ((c & 98) ^ (c | a));
+  if(a < a){
+    d = ((p ^ q) ^ (b - 62)) * ((a - b) * (b - b));
+  }else{
+    c = ((q & 54) - (c * a)) * ((q & c) * (a & 87));
+  }
+  b = ((b + a) + (c * 36)) - ((p & q) * (p + a));
+  d = ((p ^ d) + (p - 15)) & ((c & c) & (c | a));
+  c = ((c - q) + (p & b)) ^ ((c | c) ^ (q ^ q));
+  for(i = 0; i < 20; i++){
+    b = ((b + d) * (c | c)) - ((c * 84) | (c | d));
+  }
+  if(a < p){
+    d = ((q - c) & (b - b)) - ((a * c) + (a - 34));
+  }else{
+    b = ((a * d) & (a ^ 63)) + ((a + q) ^ (d + p));
+  }
+  return a + b + c + d;
+}
+
+int func83(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 18;
+  b = ((a ^ a) + (p & b)) - ((q | c) * (q ^ p));
+  c = ((a | p) + (b - b)) + ((a - q) ^ (d + 7));
+  d = ((p ^ b) + (q - b)) | ((c & q) - (b & 29));
+  d = ((c ^ 51) & (a | 27)) - ((p + p) ^ (d & a));
+  if(d < 1){
+    b = ((d * d) - (c * p)) * ((b * b) - (q + 91));
+  }else{
+    b = ((c ^ 82) | (b ^ 76)) ^ ((p * d) + (p | a));
+  }
+  c = ((d | d) + (a - c)) & ((d + q) - (d ^ q));
+  for(i = 0; i < 42; i++){
+    c = ((c | p) + (c & c)) * ((d - d) - (p + c));
+  }
+  a = ((d ^ q) + (c * q)) - ((d & q) | (c + c));
+  a = ((b * a) ^ (b & q)) + ((q * 76) * (q + 33));
+  if(a < a){
+    a = ((a | c) + (d - b)) - ((d & p) & (b * q));
+  }else{
+    d = ((a * b) - (a ^ c)) * ((c + q) - (p ^ b));
+  }
+  d = ((d - c) - (c | a)) ^ ((d | b) + (p | 22));
+  c = ((q * b) ^ (c | d)) - ((q ^ 99) - (a | d));
+  c = ((c ^ a) - (q + d)) | ((c ^ p) + (d & q));
+  for(i = 0; i < 17; i++){
+    c = ((c * d) ^ (a & c)) ^ ((d - 13) & (a * c));
+  }
+  if(b < b){
+    d = ((a | a) - (q - b)) | ((c + d) * (d * p));
+  }else{
+    d = ((c + a) & (a & b)) * ((b | q) + (p * c));
+  }
+  d = ((b | c) & (c ^ a)) + ((d ^ b) & (d * d));
+  a = ((c | c) & (d + q)) * ((a * d) * (a + p));
+  d = ((c * 63) + (q & 79)) & ((q - q) ^ (d & 64));
+  b = ((p & b) - (a | a)) + ((p ^ p) * (p + 19));
+  if(d < b){
+    a = ((p & c) ^ (b + 26)) ^ ((a | 50) & (q | 17));
+  }else{
+    c = ((b | p) | (p + d)) ^ ((p * a) & (c & d));
+  }
+  for(i = 0; i < 31; i++){
+    b = ((c & c) & (p - c)) - ((a - b) - (p * 1));
+  }
+  b = ((c * p) | (p ^ b)) - ((c ^ q) + (c - a));
+  d = ((d & c) + (a & b)) + ((b | 90) + (p - c));
+  a = ((p ^ q) & (c & 57)) | ((c ^ a) | (c & p));
+  if(d < d){
+    c = ((a | c) * (q * d)) - ((b * p) + (c | b));
+  }else{
+    c = ((b * a) + (q & c)) | ((d & p) | (p & a));
+  }
+  a = ((d * q) * (b - c)) ^ ((b + p) ^ (d ^ d));
+  c = ((b ^ b) + (a & b)) ^ ((d & 32) - (q - 50));
+  for(i = 0; i < 7; i++){
+    b = ((c * 64) * (p * 48)) ^ ((b * d) | (d + p));
+  }
+  b = ((b - b) * (c | p)) & ((q ^ d) ^ (p * p));
+  if(d < d){
+    a = ((q | c) | (c ^ q)) ^ ((b * a) | (p | d));
+  }else{
+    b = ((p * b) | (q * b)) & ((a & c) ^ (a | p));
+  }
+  b = ((b | 71) + (d ^ c)) - ((b + a) + (b & a));
+  b = ((q ^ 54) & (p + p)) * ((q ^ 38) - (b + q));
+  c = ((p * q) + (d * p)) * ((p * a) ^ (c & b));
+  a = ((q ^ p) ^ (c & 41)) | ((q & q) ^ (a - q));
+  if(c < q){
+    d = ((b ^ 46) + (a & a)) & ((a - c) | (a | p));
+  }else{
+    c = ((q * b) + (b | c)) ^ ((b & b) - (p | d));
+  }
+  c = ((d | b) + (a | c)) | ((a ^ 24) - (p * q));
+  b = ((c + q) + (q & q)) & ((a | b) * (b + a));
+  b = ((c * a) - (p ^ d)) & ((q | c) | (a * b));
+  d = ((p - a) & (d & 94)) + ((q | 34) * (c ^ b));
+  if(b < p){
+    b = ((q - c) ^ (p - a)) & ((d | 59) & (c + p));
+  }else{
+    c = ((q & d) | (p - d)) * ((c ^ d) + (p + c));
+  }
+  c = ((a + b) - (d + 43)) - ((b * c) - (c | c));
+  for(i = 0; i < 17; i++){
+    c = ((p ^ a) ^ (d - 42)) + ((d - q) + (d | 86));
+  }
+  c = ((p ^ c) + (p + d)) & ((d | c) | (b - p));
+  d = ((d + b) * (d - q)) ^ ((a - c) - (p * q));
+  if(d < a){
+    c = ((c & b) - (d + d)) * ((p + p) * (p | p));
+  }else{
+    b = ((d - a) ^ (q * 26)) - ((b * 78) - (p - q));
+  }
+  a = ((a + 74) - (c - a)) ^ ((a ^ 52) ^ (c & 58));
+  b = ((q ^ 79) * (q ^ p)) & ((d - p) + (q + 42));
+  a = ((q * p) - (q * c)) + ((b & c) | (p + q));
+  for(i = 0; i < 10; i++){
+    c = ((b - a) * (a - p)) + ((p * c) * (c ^ b));
+  }
+  if(c < b){
+    c = ((b - p) * (a & 94)) ^ ((d + a) - (d - 78));
+  }else{
+    b = ((a ^ a) + (d - d)) | ((a & c) & (c ^ q));
+  }
+  return a + b + c + d;
+}
+
+int func84(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 60;
+  d = 43;
+  a = ((q * c) & (a & p)) * ((q & q) & (q ^ d));
+  d = ((p | c) & (c ^ a)) + ((c - b) - (p & 96));
+  a = ((a | q) & (q & d)) + ((d * c) - (d * p));
+  b = ((p + a) * (c | 1)) ^ ((q & c) + (q | p));
+  if(c < 4){
+    a = ((c ^ d) * (p * a)) + ((b - p) - (q & 73));
+  }else{
+    c = ((b * 35) + (b | c)) | ((d - d) & (q - c));
+  }
+  c = ((q ^ 14) & (p | c)) * ((d * q) | (d & 71));
+  for(i = 0; i < 38; i++){
+    d = ((d ^ b) & (b - b)) * ((b + d) | (c | b));
+  }
+  c = ((d | q) - (b | p)) * ((p ^ 91) + (d - c));
+  c = ((p ^ b) - (d + c)) ^ ((q ^ 32) | (d * c));
+  if(b < b){
+    d = ((p ^ 22) + (a | p)) - ((q & d) ^ (b - a));
+  }else{
+    b = ((d + d) | (c + p)) + ((p & q) | (c | b));
+  }
+  a = ((b * a) * (a & 82)) ^ ((d - b) + (a & 77));
+  c = ((a & a) * (a + 23)) - ((c * 80) - (q ^ b));
+  b = ((b + 93) & (d ^ p)) | ((a & p) - (q * a));
+  for(i = 0; i < 43; i++){
+    d = ((c & d) ^ (c - a)) ^ ((a & a) - (c | p));
+  }
+  if(d < a){
+    c = ((q & a) + (c | d)) + ((d | q) & (c ^ b));
+  }else{
+    b = ((d | p) & (b + q)) ^ ((q | 30) ^ (p - q));
+  }
+  d = ((b & p) & (q & d)) - ((b + c) & (q ^ a));
+  c = ((p + p) ^ (p ^ 64)) & ((d | 31) * (d & a));
+  b = ((q * 49) & (c * 66)) * ((d & c) & (q | d));
+  a = ((a & 65) - (a | p)) - ((d ^ d) - (q & p));
+  if(c < p){
+    c = ((a * 81) - (c + d)) ^ ((a ^ 62) | (d - 24));
+  }else{
+    d = ((c * a) * (d ^ d)) | ((a ^ d) * (c ^ p));
+  }
+  for(i = 0; i < 18; i++){
+    c = ((d * p) & (p & p)) & ((c & a) & (a - d));
+  }
+  c = ((d & 59) ^ (b ^ d)) + ((q ^ 29) - (c - q));
+  c = ((c & a) * (p ^ 61)) | ((p | d) * (q | q));
+  c = ((d - d) & (b | 64)) | ((b + q) ^ (p * b));
+  if(c < c){
+    d = ((a | c) + (d * q)) | ((b ^ p) - (b * a));
+  }else{
+    c = ((q * 22) ^ (p - b)) ^ ((p & p) & (d ^ q));
+  }
+  d = ((c + q) * (c | 28)) + ((q & p) ^ (q * q));
+  d = ((d - 70) * (p ^ 54)) & ((p ^ b) * (c - d));
+  for(i = 0; i < 20; i++){
+    a = ((p ^ d) + (b & p)) & ((b ^ b) ^ (b * b));
+  }
+  a = ((q * 15) - (c ^ 22)) * ((d - a) ^ (p * 55));
+  if(d < 62){
+    c = ((c * b) | (b ^ q)) - ((c | p) - (b ^ b));
+  }else{
+    c = ((a * 58) - (q | b)) - ((d * 22) + (c & p));
+  }
+  a = ((d * c) - (q & 11)) ^ ((b & 13) + (d ^ b));
+  a = ((a ^ q) * (b & p)) * ((d * 20) * (p & a));
+  a = ((p & b) * (c + a)) - ((p & 73) + (d + 57));
+  b = ((c + q) & (b ^ a)) ^ ((c + d) & (q * q));
+  if(a < p){
+    d = ((q ^ 82) * (b - a)) | ((d - a) ^ (b + d));
+  }else{
+    a = ((d ^ c) ^ (b + q)) + ((c ^ 28) - (a ^ p));
+  }
+  a = ((c | 51) | (c | 87)) | ((d & p) + (d + 79));
+  a = ((d * q) - (q + 47)) ^ ((a & c) | (q ^ 48));
+  c = ((b ^ c) * (p * b)) + ((q - 17) & (b & p));
+  b = ((b ^ d) & (c + b)) ^ ((c ^ 7) + (b ^ 13));
+  if(a < q){
+    d = ((a | 61) & (b | a)) | ((b - b) & (a | d));
+  }else{
+    d = ((b + q) + (a - 39)) & ((q - c) + (c | q));
+  }
+  b = ((d - q) | (q & 64)) * ((p - 14) & (a - 75));
+  for(i = 0; i < 17; i++){
+    c = ((b & 14) * (p | 9)) * ((p ^ a) * (d & b));
+  }
+  a = ((a & 4) + (q + 41)) | ((a & d) + (b + q));
+  a = ((p + d) - (b ^ q)) & ((p - c) & (p + d));
+  if(b < b){
+    a = ((c & 87) ^ (c | a)) & ((q - c) * (d * q));
+  }else{
+    c = ((p + c) ^ (c * p)) & ((p | d) | (b ^ p));
+  }
+  a = ((q ^ d) & (c + c)) * ((q & b) | (c | 12));
+  b = ((b ^ 60) ^ (c & c)) - ((a - 1) * (q | 61));
+  d = ((q ^ q) * (q & a)) * ((c * 95) - (q | p));
+  for(i = 0; i < 49; i++){
+    c = ((q - d) - (c * p)) | ((a * d) + (a | q));
+  }
+  if(c < 74){
+    b = ((d & p) * (p | c)) | ((d + b) & (a * a));
+  }else{
+    c = ((q ^ a) | (p | p)) ^ ((a | q) | (d & 70));
+  }
+  return a + b + c + d;
+}
+
+int func85(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 87;
+  d = 17;
+  a = ((c * c) ^ (b | c)) - ((b ^ 19) * (q * q));
+  b = ((c + d) & (b | 43)) - ((a ^ b) & (b | a));
+  a = ((b | b) & (p - b)) ^ ((d - q) * (d ^ 17));
+  d = ((c * q) | (d + 50)) | ((a * b) * (a * p));
+  if(d < 3){
+    a = ((q ^ 13) ^ (p - 62)) & ((a | q) - (d * p));
+  }else{
+    b = ((p ^ c) * (a & 22)) | ((c + 70) | (a * d));
+  }
+  c = ((d & 90) | (a | 20)) & ((a + p) * (p & p));
+  for(i = 0; i < 47; i++){
+    c = ((p | c) & (d & 6)) & ((q + p) * (c ^ c));
+  }
+  d = ((a - p) & (b | d)) * ((c | 44) - (p ^ 14));
+  a = ((a ^ 52) + (d | b)) + ((c & 45) * (c - a));
+  if(d < c){
+    b = ((q * c) ^ (c - p)) * ((a | 80) * (b | 31));
+  }else{
+    a = ((c | c) ^ (p - b)) * ((a ^ 92) | (c ^ a));
+  }
+  c = ((p - a) - (p * p)) * ((d & d) - (q * q));
+  b = ((a - p) * (c | p)) * ((b + p) + (a ^ c));
+  b = ((a - q) & (p | 19)) + ((b * d) + (p | q));
+  for(i = 0; i < 18; i++){
+    c = ((b & 7) + (c | a)) - ((a * a) + (q | 8));
+  }
+  if(c < 86){
+    d = ((b ^ a) & (d & c)) * ((p * c) | (q + a));
+  }else{
+    d = ((q ^ q) - (b * a)) * ((d & c) ^ (d + d));
+  }
+  b = ((d - c) & (a | d)) * ((b ^ p) & (b + b));
+  b = ((a & d) & (p | c)) + ((c * 96) * (d ^ 35));
+  c = ((q - a) - (d - 60)) ^ ((a * 68) | (q - b));
+  d = ((b - b) ^ (q - c)) + ((b * c) | (c - b));
+  if(b < b){
+    c = ((a | b) ^ (b * c)) + ((d * 3) | (q | p));
+  }else{
+    d = ((q & d) * (p ^ 93)) * ((q * b) - (d + b));
+  }
+  for(i = 0; i < 24; i++){
+    d = ((b | a) - (p - a)) * ((q - 71) ^ (q - p));
+  }
+  d = ((a & 92) & (c & 16)) & ((b + q) & (q + q));
+  d = ((b ^ b) ^ (b & c)) * ((c - a) & (b ^ p));
+  a = ((q - d) | (p + 48)) & ((b - 15) ^ (d - a));
+  if(c < p){
+    b = ((b ^ p) & (p + q)) + ((a - a) + (c | a));
+  }else{
+    b = ((c * q) ^ (d - a)) & ((c & 19) | (d * p));
+  }
+  c = ((c + q) | (a ^ b)) + ((q - c) - (b | 75));
+  a = ((b * q) - (a + 65)) | ((p - d) - (c - 63));
+  for(i = 0; i < 27; i++){
+    a = ((d + 56) + (a + b)) ^ ((d - p) - (c + a));
+  }
+  d = ((a - b) - (a + q)) * ((d + 78) ^ (d - b));
+  if(b < p){
+    d = ((a - d) ^ (d & 67)) * ((p + b) - (p * d));
+  }else{
+    d = ((d * d) | (b ^ a)) * ((c ^ 21) - (a ^ b));
+  }
+  b = ((b ^ c) - (d | a)) ^ ((c - a) & (p | p));
+  c = ((b | b) * (p | b)) - ((a + c) ^ (q ^ 35));
+  c = ((c + a) - (a & d)) & ((q + 21) & (b & 91));
+  d = ((a + c) | (d * 14)) | ((a ^ p) | (c & 30));
+  if(a < 4){
+    a = ((q * b) * (b & d)) | ((q & 42) * (d ^ q));
+  }else{
+    c = ((q ^ c) - (a & 17)) * ((a & a) ^ (q - q));
+  }
+  c = ((c + d) + (d + p)) - ((a | p) + (d + c));
+  d = ((a + 9) ^ (q ^ p)) ^ ((q | b) | (d ^ p));
+  b = ((b + a) * (q & c)) + ((c - 87) ^ (q | 13));
+  b = ((q - q) + (a & 6)) - ((q & 83) - (b & p));
+  if(d < p){
+    d = ((b & 78) * (d - 1)) + ((a ^ p) + (c * p));
+  }else{
+    d = ((c - q) * (d * 37)) ^ ((p - 38) + (q + d));
+  }
+  d = ((d & q) ^ (b & b)) + ((c ^ c) & (b - b));
+  for(i = 0; i < 6; i++){
+    b = ((p * 90) + (q - a)) + ((p + 80) ^ (b - q));
+  }
+  a = ((a | 85) ^ (b & d)) | ((d ^ a) | (q + d));
+  b = ((q - a) & (q | 27)) | ((d | b) - (c ^ 27));
+  if(c < 87){
+    a = ((d + 72) ^ (b | q)) | ((q - 68) & (p * a));
+  }else{
+    b = ((c - p) + (c & b)) ^ ((d * 42) ^ (c | p));
+  }
+  d = ((p & q) * (p & a)) * ((b & c) & (a ^ p));
+  d = ((a * b) ^ (c ^ d)) ^ ((d | q) & (c | q));
+  d = ((d | b) * (q + p)) ^ ((d + d) | (q & d));
+  for(i = 0; i < 5; i++){
+    d = ((d + 1) * (p & p)) - ((b ^ q) * (c - a));
+  }
+  if(b < p){
+    d = ((b + 91) ^ (p * a)) * ((d + d) | (d + q));
+  }else{
+    b = ((a + d) | (p ^ 4)) + ((a & c) * (q + p));
+  }
+  return a + b + c + d;
+}
+
+int func86(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 24;
+  d = 28;
+  d = ((b - a) + (d | c)) - ((q ^ d) - (a ^ a));
+  c = ((b * d) & (b + 67)) & ((d & a) * (b | p));
+  d = ((a - 53) ^ (p * a)) * ((q ^ 24) * (p - 21));
+  d = ((b & 63) & (p - b)) | ((a - 54) * (p | d));
+  if(d < q){
+    d = ((q | b) ^ (p * b)) * ((a | 92) & (p ^ p));
+  }else{
+    a = ((a * c) & (c ^ d)) & ((p ^ p) ^ (c | c));
+  }
+  a = ((c ^ a) - (c & q)) ^ ((q - p) | (d + p));
+  for(i = 0; i < 5; i++){
+    b = ((c & c) | (q & p)) & ((p - b) | (p & p));
+  }
+  c = ((d * q) * (c * p)) * ((c * 69) - (d + c));
+  d = ((b | c) * (q | d)) * ((c | q) + (q & 26));
+  if(d < c){
+    d = ((d & p) + (c * 79)) ^ ((p - a) * (c | c));
+  }else{
+    d = ((q * d) ^ (d * b)) * ((d + 37) & (a + q));
+  }
+  c = ((q & p) * (p ^ a)) + ((a - b) + (p & b));
+  c = ((p * d) + (a | a)) | ((d - c) & (p & a));
+  b = ((a & a) + (d | d)) - ((b * 9) * (b & c));
+  for(i = 0; i < 39; i++){
+    c = ((b * q) + (q * 28)) + ((d | b) | (p & b));
+  }
+  if(a < 46){
+    c = ((d & q) * (b + p)) & ((p - d) + (a | c));
+  }else{
+    d = ((d | 16) * (c * c)) | ((d ^ b) - (p & q));
+  }
+  c = ((c ^ p) & (c * 73)) | ((a | 84) | (q * b));
+  c = ((q + c) + (b | p)) * ((q ^ a) | (d ^ a));
+  a = ((b + 96) * (c * p)) * ((d | q) | (a - q));
+  a = ((c * q) & (c * q)) + ((q ^ a) & (d ^ b));
+  if(b < p){
+    b = ((a * d) - (p + 73)) | ((d * q) & (d * 50));
+  }else{
+    a = ((a * b) & (p + p)) | ((p * b) | (a + c));
+  }
+  for(i = 0; i < 5; i++){
+    d = ((b * p) ^ (q | 60)) - ((d & b) & (d | c));
+  }
+  a = ((p | d) - (a & b)) * ((b - 39) | (a - a));
+  c = ((p | b) * (q ^ 58)) + ((q | a) + (b + d));
+  d = ((c * a) * (b & d)) & ((d & q) - (b | a));
+  if(c < a){
+    b = ((c | 12) & (p + a)) - ((a + q) + (b ^ b));
+  }else{
+    b = ((p - a) & (d & c)) | ((c - c) ^ (a | b));
+  }
+  d = ((p - c) | (p * d)) & ((c + d) * (a & c));
+  d = ((d | q) - (b * a)) | ((q - 71) - (c * a));
+  for(i = 0; i < 43; i++){
+    d = ((p ^ a) + (p * b)) * ((d + p) ^ (p - 67));
+  }
+  a = ((q - d) * (p ^ c)) + ((d + 27) | (q * d));
+  if(b < c){
+    d = ((a * b) ^ (q - q)) & ((p - q) + (a * p));
+  }else{
+    c = ((q & d) + (p * p)) | ((q * 82) - (a - d));
+  }
+  a = ((b + d) * (d | c)) + ((d + d) + (p - c));
+  c = ((p - a) - (b ^ 23)) & ((d ^ d) * (b + 53));
+  c = ((c - b) * (c - q)) & ((q - d) * (q + 54));
+  b = ((q * 96) * (b - c)) ^ ((d - p) + (a & c));
+  if(d < p){
+    d = ((d - d) + (d + c)) | ((c ^ p) | (p + a));
+  }else{
+    b = ((q * c) - (q + 82)) * ((p + p) & (a - a));
+  }
+  a = ((d * p) + (c | 14)) & ((a - 97) | (p | a));
+  a = ((d & p) & (a + d)) ^ ((p + p) ^ (b | p));
+  c = ((p * 72) - (p * c)) - ((d + b) + (b | a));
+  b = ((q * p) ^ (b ^ a)) - ((a * d) | (c ^ d));
+  if(a < 36){
+    b = ((q & d) ^ (q + 91)) - ((d + 95) | (p + 70));
+  }else{
+    b = ((a ^ b) ^ (p | a)) + ((b + c) | (q ^ a));
+  }
+  b = ((b & d) - (q ^ c)) + ((p * b) + (b ^ q));
+  for(i = 0; i < 10; i++){
+    d = ((q + p) + (p + p)) | ((a & d) & (a | q));
+  }
+  d = ((c - b) & (p - q)) & ((a | d) + (d & d));
+  b = ((b * c) - (b ^ q)) & ((b * d) + (q - 3));
+  if(c < p){
+    a = ((b - 5) & (c * b)) + ((d ^ c) * (p & 76));
+  }else{
+    b = ((q + q) * (b & p)) + ((a * d) - (c | 60));
+  }
+  a = ((p * p) + (c | d)) + ((b - b) | (a & 44));
+  a = ((a - d) ^ (d - 70)) + ((b + q) & (a | q));
+  b = ((a & 32) - (d & b)) ^ ((p ^ a) ^ (d ^ 46));
+  for(i = 0; i < 23; i++){
+    b = ((d ^ q) & (d & 55)) + ((d + p) - (d & p));
+  }
+  if(a < 9){
+    b = ((b & 74) | (c + a)) + ((b | a) + (d - 98));
+  }else{
+    c = ((p - 56) + (d | a)) & ((b & q) * (p + 77));
+  }
+  return a + b + c + d;
+}
+
+int func87(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 83;
+  d = 56;
+  c = ((q - p) ^ (d & 62)) - ((q ^ d) & (a - b));
+  b = ((a | 61) & (c ^ b)) * ((q + 49) * (d - c));
+  a = ((a - c) | (q * a)) ^ ((p - p) * (q & c));
+  b = ((q | b) & (q + 18)) * ((c & q) & (p * p));
+  if(a < c){
+    d = ((q | p) ^ (d ^ p)) ^ ((a ^ 35) | (p + d));
+  }else{
+    b = ((a & b) | (p - 66)) & ((d * 6) | (a - a));
+  }
+  d = ((a * a) * (p | q)) * ((a * q) & (a * b));
+  for(i = 0; i < 49; i++){
+    a = ((a ^ d) - (a & 33)) & ((q ^ 14) | (a ^ 94));
+  }
+  a = ((p | 8) ^ (c & a)) + ((a * c) * (q * p));
+  b = ((b & 99) ^ (a * q)) & ((p * p) - (a - b));
+  if(b < 6){
+    b = ((a ^ a) & (b - 22)) - ((d | b) & (q ^ 96));
+  }else{
+    a = ((c & 3) - (q * b)) * ((c - 37) - (p & p));
+  }
+  a = ((p - 90) ^ (c + 6)) & ((a * d) * (p & 55));
+  d = ((b & b) ^ (c * 35)) | ((b | c) - (b | c));
+  b = ((p + 29) - (q + a)) & ((a ^ 12) - (d + q));
+  for(i = 0; i < 47; i++){
+    c = ((c ^ a) ^ (d & 49)) - ((d & d) ^ (a ^ 8));
+  }
+  if(b < b){
+    b = ((a + q) + (b & q)) * ((c & a) * (d - p));
+  }else{
+    c = ((q * d) + (q ^ 86)) + ((b | a) * (a - p));
+  }
+  d = ((c - 47) ^ (b & a)) * ((b - b) | (b & b));
+  b = ((q & 92) ^ (p | p)) & ((b | 35) * (c + p));
+  b = ((b | p) ^ (d | b)) ^ ((p ^ p) & (p | 95));
+  a = ((b | p) | (p | p)) * ((a | b) ^ (b + a));
+  if(b < d){
+    c = ((b & q) ^ (q + q)) | ((p * p) | (q & q));
+  }else{
+    d = ((a + 66) + (a * c)) | ((c * 69) | (q - 57));
+  }
+  for(i = 0; i < 19; i++){
+    b = ((a * b) * (c & a)) ^ ((q * 88) & (q - q));
+  }
+  b = ((q * b) + (p + d)) + ((a + 95) * (q * a));
+  b = ((b & a) & (d & 82)) & ((b & a) & (d * 86));
+  d = ((d ^ b) | (d - 53)) ^ ((c & 17) + (a + d));
+  if(a < d){
+    a = ((c & a) | (p * q)) + ((q ^ q) ^ (c - c));
+  }else{
+    b = ((d * q) & (b | b)) ^ ((d - c) & (p - d));
+  }
+  b = ((q + d) | (a - c)) ^ ((q & p) | (c ^ q));
+  a = ((a * a) - (p ^ a)) + ((q ^ c) | (a * a));
+  for(i = 0; i < 21; i++){
+    c = ((q | d) + (a - d)) ^ ((c * q) ^ (b * a));
+  }
+  c = ((d | p) ^ (d | d)) * ((d * 68) - (d | b));
+  if(a < c){
+    c = ((d - p) & (q | 23)) * ((a ^ d) & (q | b));
+  }else{
+    a = ((d | 8) | (q & c)) ^ ((b | d) + (b & a));
+  }
+  c = ((b + 62) + (p ^ 25)) + ((a ^ 98) | (a | b));
+  d = ((p * b) | (a * b)) - ((a & c) - (c - c));
+  c = ((q | a) & (b | c)) | ((d & a) & (c * c));
+  d = ((c + a) & (q ^ d)) * ((p & p) ^ (c ^ d));
+  if(b < a){
+    d = ((q - d) - (d - 80)) * ((d & q) | (p ^ a));
+  }else{
+    c = ((b - d) | (q - p)) + ((c - p) | (d ^ 78));
+  }
+  a = ((p + b) | (d - p)) * ((c + 10) * (p - c));
+  c = ((q & b) + (c * c)) + ((d + 80) & (d | 82));
+  a = ((b - p) & (b | p)) * ((p ^ c) - (d * 50));
+  a = ((d | q) & (c + d)) ^ ((a & 70) & (c ^ b));
+  if(d < d){
+    c = ((d - 52) * (c ^ c)) - ((p * q) * (a ^ a));
+  }else{
+    c = ((c & 1) + (q - b)) | ((d & d) * (q ^ 3));
+  }
+  c = ((b - 57) & (d ^ p)) ^ ((b - p) - (c + q));
+  for(i = 0; i < 23; i++){
+    a = ((d - 41) - (q * c)) + ((b | q) + (b - 82));
+  }
+  c = ((a * d) - (q * a)) * ((a ^ b) + (p - 64));
+  c = ((b * q) + (p + d)) * ((q * d) + (p & q));
+  if(a < 36){
+    c = ((a - 65) ^ (b | p)) & ((b * 31) | (d - d));
+  }else{
+    c = ((b & b) * (b & a)) + ((c ^ 83) - (a ^ q));
+  }
+  b = ((c & p) & (q ^ q)) * ((p & q) | (a - d));
+  c = ((d - 46) | (b + b)) + ((q + q) - (d - d));
+  c = ((q - 76) + (p ^ b)) + ((p * c) ^ (q + c));
+  for(i = 0; i < 19; i++){
+    b = ((q ^ 99) - (q ^ 38)) | ((b ^ b) ^ (a ^ p));
+  }
+  if(d < a){
+    c = ((q * 93) * (q & 85)) + ((q & 57) - (c & c));
+  }else{
+    c = ((d & p) - (a * q)) ^ ((b * q) & (p - b));
+  }
+  return a + b + c + d;
+}
+
+int func88(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 83;
+  d = ((a | d) + (c | c)) & ((b & q) - (d * a));
+  a = ((d ^ 66) ^ (d | a)) | ((c - a) & (a - p));
+  d = ((d - d) | (d & b)) - ((p - p) - (c * 68));
+  a = ((d | d) & (a + b)) & ((q * b) + (d + c));
+  if(d < d){
+    d = ((d + q) & (b | a)) - ((q + 2) & (p * b));
+  }else{
+    d = ((c ^ a) & (a & a)) & ((b ^ p) ^ (q & 85));
+  }
+  b = ((b + b) - (a ^ d)) | ((p ^ q) | (b ^ a));
+  for(i = 0; i < 7; i++){
+    b = ((q & 6) * (c & 84)) & ((c + b) + (p - b));
+  }
+  d = ((b + b) * (c * d)) + ((a | q) ^ (p ^ c));
+  c = ((d + a) * (d * d)) * ((b ^ 88) ^ (p + 96));
+  if(c < b){
+    b = ((c | p) - (a - 6)) * ((p | q) * (q | c));
+  }else{
+    d = ((d & d) * (a | p)) + ((d & d) + (c * c));
+  }
+  d = ((d + 51) | (b | d)) - ((b ^ p) - (d + b));
+  a = ((a ^ q) & (d & 63)) ^ ((q + 63) * (p | 29));
+  c = ((q * 21) * (c ^ b)) | ((b | a) + (c & a));
+  for(i = 0; i < 15; i++){
+    c = ((q * p) - (d & p)) ^ ((c + c) ^ (d + q));
+  }
+  if(d < d){
+    d = ((a ^ c) - (a * b)) ^ ((q & q) * (d | c));
+  }else{
+    b = ((c * d) - (q & q)) - ((c - 41) + (c ^ p));
+  }
+  d = ((b - b) ^ (a + c)) * ((q & 90) & (a & p));
+  d = ((b - 70) | (a | p)) | ((q | 13) ^ (q - 85));
+  a = ((a & p) * (a - q)) | ((b - b) ^ (d ^ q));
+  a = ((a ^ p) * (a + a)) + ((d ^ 76) * (c * b));
+  if(d < c){
+    d = ((a * q) | (p + 63)) + ((b & 60) & (a ^ q));
+  }else{
+    a = ((q ^ 25) + (b & c)) + ((q - q) | (b - 85));
+  }
+  for(i = 0; i < 9; i++){
+    b = ((p + d) + (d - p)) | ((c | 68) | (c + 14));
+  }
+  b = ((c * d) ^ (b | p)) * ((a - b) + (q ^ c));
+  b = ((c & c) ^ (p ^ a)) + ((p ^ 72) - (q - 76));
+  a = ((q | q) + (d & c)) + ((c * b) * (q + q));
+  if(b < b){
+    d = ((q - p) | (d & c)) * ((b * 99) & (p * c));
+  }else{
+    a = ((q ^ 7) * (p - 64)) - ((c - q) + (c - 8));
+  }
+  d = ((b * b) * (b | 34)) & ((p & q) * (q - c));
+  a = ((a & 29) ^ (b * 67)) | ((q + d) - (b & d));
+  for(i = 0; i < 47; i++){
+    d = ((p | b) - (p & c)) + ((p | a) + (a | b));
+  }
+  d = ((p | b) & (p | b)) | ((a * c) * (d + c));
+  if(c < p){
+    b = ((q + q) * (q + b)) & ((b + c) - (b & b));
+  }else{
+    a = ((p & q) | (a | c)) | ((c & 27) * (p * q));
+  }
+  b = ((d ^ q) & (d * p)) | ((d ^ d) & (p ^ 69));
+  b = ((b & 25) * (q ^ c)) * ((a ^ b) * (d * a));
+  a = ((c & b) * (b ^ q)) | ((q - b) + (a ^ b));
+  b = ((c & q) - (q ^ p)) * ((c ^ p) | (b & 65));
+  if(a < 28){
+    a = ((p + d) | (c * a)) ^ ((d | 4) * (p - q));
+  }else{
+    c = ((c + 69) | (b & 78)) | ((d ^ b) & (b ^ c));
+  }
+  b = ((d * c) - (a & d)) ^ ((q - d) + (c * p));
+  d = ((p & q) + (q ^ 8)) & ((d + a) ^ (q - c));
+  d = ((b & b) - (a * q)) - ((q * c) * (b - p));
+  c = ((a | d) | (q ^ b)) & ((b ^ a) & (a * c));
+  if(d < c){
+    c = ((a | a) + (p ^ c)) + ((d ^ 74) ^ (a - c));
+  }else{
+    d = ((q & 36) - (d ^ 2)) & ((d + p) | (c + b));
+  }
+  a = ((c & p) ^ (b & q)) * ((c * c) | (p * c));
+  for(i = 0; i < 37; i++){
+    c = ((a + c) | (q + 6)) * ((p & p) + (c + 18));
+  }
+  d = ((b | q) + (q | b)) - ((b ^ b) + (a | q));
+  d = ((d * 32) | (a & p)) + ((p | 19) * (c * c));
+  if(d < p){
+    c = ((q ^ 37) & (a * b)) & ((p - p) | (c - c));
+  }else{
+    d = ((q & d) * (q ^ q)) | ((q - a) ^ (p * q));
+  }
+  b = ((b * 69) & (p & 55)) & ((b & a) & (b - b));
+  b = ((c - q) ^ (q | a)) * ((d | p) ^ (c ^ b));
+  a = ((p + q) ^ (b | 88)) - ((b + 54) | (c - a));
+  for(i = 0; i < 3; i++){
+    a = ((b * p) | (d + b)) ^ ((p | p) & (p | 34));
+  }
+  if(d < d){
+    b = ((a & a) ^ (q ^ c)) - ((a - p) - (a + q));
+  }else{
+    b = ((c + a) | (a - 8)) & ((a ^ b) + (d ^ q));
+  }
+  return a + b + c + d;
+}
+
+int func89(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 36;
+  d = 11;
+  d = ((p - 22) * (q ^ 37)) ^ ((d * p) & (a - a));
+  b = ((a - 59) - (b * c)) + ((a * b) * (p - d));
+  a = ((q - p) + (c - a)) & ((a ^ c) + (d ^ c));
+  a = ((c & c) + (d + q)) | ((d + b) & (d | a));
+  if(c < a){
+    c = ((p * a) | (q ^ b)) & ((p - 73) + (c - 31));
+  }else{
+    d = ((b | 17) - (p ^ 43)) ^ ((b | q) ^ (b * p));
+  }
+  d = ((c + 2) * (q & b)) ^ ((c * p) - (q | 13));
+  for(i = 0; i < 28; i++){
+    d = ((d + 25) ^ (q & 14)) + ((c * b) ^ (a + 6));
+  }
+  d = ((d & 55) ^ (d * b)) * ((d & 1) & (b - c));
+  c = ((b + a) * (q + 65)) * ((d | b) - (d + p));
+  if(c < d){
+    c = ((c & c) | (c * b)) | ((b + 38) | (b + p));
+  }else{
+    a = ((q + d) & (c & 85)) | ((c ^ 19) & (q + 78));
+  }
+  b = ((d + q) - (a - 33)) + ((c + q) & (d + c));
+  a = ((b * 60) + (a ^ a)) ^ ((c + d) ^ (p - 78));
+  a = ((q * q) * (a | d)) | ((d | p) ^ (b ^ a));
+  for(i = 0; i < 46; i++){
+    d = ((b | d) | (c - p)) * ((q * 45) & (q & d));
+  }
+  if(d < c){
+    b = ((d ^ a) - (d - b)) & ((d + 68) | (q - q));
+  }else{
+    a = ((p + 6) | (c ^ b)) + ((b & q) + (c * c));
+  }
+  d = ((c | 27) * (p + d)) * ((d - a) | (q & q));
+  b = ((b ^ 61) - (d | q)) - ((d | b) & (p - q));
+  c = ((c * 97) ^ (b ^ p)) & ((p ^ 42) - (d + c));
+  b = ((a & q) + (d | 37)) * ((b | 39) ^ (q - p));
+  if(d < c){
+    d = ((q ^ q) + (p + c)) & ((c - d) | (c * c));
+  }else{
+    b = ((c & a) | (b * q)) | ((b & d) & (b * c));
+  }
+  for(i = 0; i < 47; i++){
+    c = ((q ^ 26) * (p ^ a)) | ((a ^ a) ^ (p | q));
+  }
+  a = ((q ^ 72) ^ (b & 9)) | ((b * a) & (d ^ 58));
+  d = ((b * b) & (q - q)) | ((p - c) ^ (q ^ 99));
+  d = ((d & q) + (c ^ q)) ^ ((p * q) & (a * c));
+  if(b < 31){
+    c = ((d ^ 38) * (p | c)) * ((p ^ d) + (c + a));
+  }else{
+    d = ((q & 47) ^ (b ^ 10)) & ((d * c) | (c ^ d));
+  }
+  c = ((q & p) * (a + 11)) ^ ((a ^ c) | (d * p));
+  b = ((q - p) + (d - 88)) ^ ((q * 28) | (c + 74));
+  for(i = 0; i < 46; i++){
+    d = ((q ^ d) * (q * q)) - ((q ^ b) - (q ^ a));
+  }
+  a = ((b - 63) | (b - q)) + ((c ^ a) * (q - 18));
+  if(d < b){
+    a = ((q * 49) & (d & 68)) & ((c & d) - (c & c));
+  }else{
+    c = ((b * 55) - (b ^ 60)) & ((c - 39) ^ (d & p));
+  }
+  a = ((p + b) * (b | b)) * ((p - d) ^ (p * 92));
+  a = ((d | d) * (c + 11)) * ((a * d) - (b + a));
+  c = ((q | 24) & (p + 30)) - ((d + 45) - (p & p));
+  d = ((q - d) + (p | q)) + ((q | d) * (p * c));
+  if(b < q){
+    b = ((p & 89) - (b + q)) & ((c | 65) | (b & a));
+  }else{
+    a = ((d + 71) | (p | a)) - ((q + d) - (b - d));
+  }
+  a = ((d & q) & (q & 33)) * ((q - a) - (q ^ d));
+  a = ((d - d) * (a - b)) ^ ((c | b) & (c & d));
+  d = ((a & 71) ^ (d & c)) * ((q | 48) + (d * q));
+  a = ((c * c) & (d * a)) + ((c + p) ^ (q | 7));
+  if(d < c){
+    b = ((d ^ b) ^ (a ^ c)) - ((b | a) + (a - q));
+  }else{
+    c = ((a & b) + (a + q)) | ((c & b) - (b | 82));
+  }
+  c = ((a * a) + (c | c)) + ((b ^ b) * (b * 84));
+  for(i = 0; i < 18; i++){
+    d = ((b & c) * (d + b)) - ((p - p) + (p | 21));
+  }
+  b = ((d + 62) | (p | 45)) * ((d ^ 49) + (d + q));
+  b = ((q | a) + (a | c)) - ((b & q) ^ (c + b));
+  if(c < 58){
+    a = ((c ^ a) + (a * a)) - ((q + c) - (p + a));
+  }else{
+    d = ((c & c) + (b - b)) & ((q - 9) & (c + p));
+  }
+  a = ((a | c) - (b - b)) * ((c | q) - (p * 72));
+  b = ((b | 37) * (p - d)) - ((d * a) ^ (d | 80));
+  d = ((a - b) * (q + d)) + ((c + 14) - (q * c));
+  for(i = 0; i < 2; i++){
+    b = ((c - c) ^ (d ^ a)) * ((p - a) ^ (q & p));
+  }
+  if(c < 77){
+    b = ((b ^ q) | (b - 53)) + ((p ^ b) | (c * q));
+  }else{
+    c = ((p ^ 5) | (b ^ p)) + ((q - q) * (q & c));
+  }
+  return a + b + c + d;
+}
+
+int func90(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 96;
+  d = 80;
+  d = ((b ^ 72) | (b | 53)) + ((c * 96) & (a & a));
+  a = ((b | c) & (p | d)) | ((p - 4) & (a | 54));
+  c = ((a | 26) ^ (c & d)) + ((d * c) * (p ^ d));
+  b = ((c * 18) - (c - 16)) - ((d & c) - (d | q));
+  if(d < 91){
+    d = ((q * b) * (d * 40)) & ((p + a) & (a | b));
+  }else{
+    c = ((q ^ p) + (p - c)) - ((a & 47) * (a & q));
+  }
+  b = ((d ^ q) | (c | q)) | ((d * c) & (p | c));
+  for(i = 0; i < 33; i++){
+    a = ((b * c) | (a - 13)) - ((q * 57) ^ (b ^ 50));
+  }
+  d = ((q | 85) * (a ^ b)) & ((c * a) | (a - 19));
+  c = ((a | b) | (b * 30)) & ((d - b) - (c & 21));
+  if(c < 68){
+    b = ((a ^ p) & (p * 75)) - ((q - 5) ^ (d ^ 80));
+  }else{
+    a = ((q ^ c) ^ (q ^ 96)) - ((a | c) - (p & q));
+  }
+  d = ((d ^ d) * (a & 30)) - ((p * q) | (b | a));
+  c = ((c * b) - (d ^ 6)) | ((a ^ d) + (d ^ 39));
+  a = ((b ^ d) * (d ^ b)) - ((d | q) - (b * d));
+  for(i = 0; i < 17; i++){
+    c = ((c | q) | (p + b)) * ((c ^ p) & (q | q));
+  }
+  if(c < p){
+    d = ((a | c) | (b & c)) * ((b - 9) * (a & 73));
+  }else{
+    d = ((b & p) ^ (a - a)) - ((d * a) - (q ^ b));
+  }
+  b = ((b * p) | (q + 87)) - ((q * 41) * (b * p));
+  d = ((p | p) * (p - c)) - ((a - a) + (d | q));
+  d = ((a + b) ^ (b + d)) - ((q + c) | (p + 15));
+  a = ((a * q) | (a & c)) ^ ((a | 14) ^ (d - c));
+  if(b < d){
+    d = ((c & p) | (c * a)) ^ ((b * d) - (d + d));
+  }else{
+    a = ((b ^ b) - (b | c)) ^ ((a * 84) - (p & b));
+  }
+  for(i = 0; i < 33; i++){
+    c = ((d - 35) | (c + q)) ^ ((c | q) ^ (q + 60));
+  }
+  a = ((b ^ 32) ^ (q + d)) ^ ((q - 38) * (b * b));
+  c = ((q | 79) - (a | b)) ^ ((a * 72) + (c * a));
+  c = ((d * p) & (d & a)) + ((p | c) | (a * d));
+  if(a < a){
+    a = ((q + a) + (c - p)) * ((a ^ 10) * (c + 3));
+  }else{
+    b = ((q * p) + (q ^ b)) | ((q * a) ^ (p - 19));
+  }
+  b = ((d ^ 94) - (p + 99)) | ((d - q) & (b | a));
+  a = ((b + 25) - (p + a)) | ((q - q) & (q ^ c));
+  for(i = 0; i < 13; i++){
+    b = ((a | 89) - (p - 5)) + ((q - b) - (p * d));
+  }
+  c = ((b + p) | (p | 13)) ^ ((c ^ a) | (p & 15));
+  if(b < a){
+    a = ((q - 92) - (d ^ c)) ^ ((d | q) | (a & d));
+  }else{
+    b = ((c ^ p) * (a | d)) - ((d & a) * (b + p));
+  }
+  b = ((q & q) + (b + 19)) | ((p | a) ^ (c + 9));
+  d = ((d ^ q) - (q * 3)) - ((q + 70) & (b - p));
+  c = ((c * a) ^ (b + d)) * ((c | p) - (c - b));
+  c = ((d * b) * (q + q)) | ((d - q) + (b & 4));
+  if(b < 60){
+    b = ((b & c) & (a * 56)) + ((b - d) + (p & a));
+  }else{
+    d = ((b ^ a) * (a & p)) * ((c | 17) & (d & q));
+  }
+  d = ((d + p) ^ (b - 49)) * ((b | d) ^ (p * p));
+  a = ((b * a) ^ (p + c)) | ((p | q) * (q ^ q));
+  a = ((a & p) + (p - q)) - ((p - 29) | (b + a));
+  b = ((q + b) | (c ^ 91)) - ((c & p) | (d * b));
+  if(a < a){
+    c = ((q & b) + (p * b)) ^ ((c | b) + (d ^ q));
+  }else{
+    a = ((a ^ q) - (b + 10)) - ((d * 61) * (p & 80));
+  }
+  a = ((d | d) ^ (q * 52)) + ((q - a) + (q ^ a));
+  for(i = 0; i < 46; i++){
+    c = ((a + c) & (c + d)) ^ ((q - a) ^ (b & 27));
+  }
+  d = ((c + c) * (d + c)) ^ ((q | q) ^ (d * b));
+  a = ((p + q) - (b - 80)) + ((q + q) & (b | q));
+  if(b < q){
+    c = ((a + d) + (c ^ 13)) + ((b | 59) * (d - p));
+  }else{
+    a = ((c + 41) * (b & p)) | ((q + q) | (p + p));
+  }
+  a = ((d & c) * (a & d)) | ((q + 87) ^ (d - 99));
+  b = ((q & a) + (p ^ p)) | ((q * 35) & (c & b));
+  d = ((b ^ a) + (d & p)) + ((c | c) * (p ^ p));
+  for(i = 0; i < 50; i++){
+    b = ((d * b) ^ (p + d)) | ((p + b) + (d + b));
+  }
+  if(a < b){
+    a = ((a & 71) + (d | 79)) | ((c * q) + (a | 25));
+  }else{
+    c = ((p & a) + (p * p)) - ((c * d) ^ (c * p));
+  }
+  return a + b + c + d;
+}
+
+int func91(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 92;
+  d = 53;
+  b = ((a ^ c) | (a + c)) - ((d & b) * (p | q));
+  b = ((q | p) & (c * 76)) * ((c * d) | (b ^ 75));
+  b = ((p + c) * (b | p)) | ((b | c) * (c ^ c));
+  b = ((q * d) - (b | 78)) | ((q ^ b) | (c ^ q));
+  if(c < 34){
+    a = ((d ^ c) * (c & b)) + ((c & p) + (a ^ p));
+  }else{
+    b = ((a - q) + (a | d)) ^ ((c | q) + (q & 3));
+  }
+  a = ((p | d) & (p * c)) - ((p | a) + (b - 43));
+  for(i = 0; i < 47; i++){
+    a = ((p + b) | (c ^ c)) * ((p | 18) & (a * c));
+  }
+  d = ((b - 95) | (a & a)) + ((p * q) & (p ^ q));
+  a = ((d ^ b) | (p + q)) ^ ((q ^ p) ^ (q + 27));
+  if(c < 23){
+    a = ((q + c) ^ (c | a)) * ((p ^ a) ^ (b * a));
+  }else{
+    a = ((b + d) * (a + q)) & ((q - 59) - (c - a));
+  }
+  d = ((c ^ d) | (c - c)) ^ ((c * 51) * (d - a));
+  b = ((d - b) ^ (d + 28)) + ((d ^ 76) | (q & p));
+  d = ((p | b) ^ (d ^ 29)) * ((b + a) * (c * c));
+  for(i = 0; i < 15; i++){
+    c = ((c + d) + (q & p)) ^ ((p - c) & (b - b));
+  }
+  if(b < p){
+    a = ((a ^ b) * (d ^ b)) | ((c - a) ^ (q & c));
+  }else{
+    c = ((c & p) - (d * b)) * ((b * 38) | (a | c));
+  }
+  c = ((a + p) ^ (a * 96)) - ((b ^ b) ^ (p ^ 84));
+  b = ((b ^ c) - (p + a)) | ((b ^ p) + (p + 88));
+  c = ((b | q) ^ (d + c)) | ((d * 70) - (b & 24));
+  d = ((a & d) | (q & 52)) * ((b * 84) * (a & a));
+  if(c < a){
+    c = ((q | 1) & (a + 77)) - ((q | c) & (q ^ d));
+  }else{
+    c = ((c & b) * (c ^ q)) | ((a | c) ^ (a * b));
+  }
+  for(i = 0; i < 43; i++){
+    b = ((a | 82) ^ (a * q)) * ((a ^ d) - (b & b));
+  }
+  d = ((c + b) & (p | d)) ^ ((q & b) & (q ^ 58));
+  c = ((b | d) | (q * 50)) | ((d + c) + (p ^ 13));
+  b = ((d ^ a) | (a & d)) - ((d ^ c) * (b - a));
+  if(b < c){
+    a = ((d | q) + (d * 67)) & ((b | d) ^ (q ^ c));
+  }else{
+    a = ((q + p) + (d & 94)) * ((c + q) | (q ^ b));
+  }
+  a = ((a & a) | (p & 68)) - ((p & c) + (p & p));
+  b = ((q * 27) * (b ^ a)) * ((a - 50) ^ (c ^ 63));
+  for(i = 0; i < 21; i++){
+    a = ((a * q) & (q | c)) | ((q + 32) - (d & 46));
+  }
+  b = ((p - p) - (d + b)) * ((p | a) - (q | p));
+  if(a < b){
+    d = ((a * a) - (a ^ c)) ^ ((d - b) + (d + 15));
+  }else{
+    d = ((q * 4) + (c ^ b)) * ((d ^ 67) - (d * 3));
+  }
+  a = ((d ^ a) + (p | b)) * ((c - b) + (d - q));
+  a = ((d | b) ^ (q ^ 68)) ^ ((p - q) | (q ^ 18));
+  b = ((q + p) & (p + p)) * ((c | 16) * (p | c));
+  b = ((b + 32) ^ (d & d)) * ((b + c) | (b * d));
+  if(c < b){
+    a = ((a ^ 83) | (b - p)) ^ ((q | 69) & (q * d));
+  }else{
+    a = ((q * b) | (c ^ b)) * ((d + q) * (p ^ p));
+  }
+  c = ((b + 25) + (b | q)) * ((q | d) & (a & 52));
+  c = ((c - d) & (p - 96)) & ((a | b) * (b & 71));
+  c = ((d | d) * (q | c)) & ((a | b) & (a * c));
+  d = ((q - 89) * (q & a)) - ((b | p) ^ (p - 53));
+  if(b < b){
+    c = ((p * 50) * (c - p)) - ((c | d) + (p - d));
+  }else{
+    c = ((c + p) ^ (q - d)) + ((a * b) * (d + q));
+  }
+  a = ((a - p) * (a & b)) * ((a | b) * (p & p));
+  for(i = 0; i < 23; i++){
+    b = ((d * 18) * (c * q)) ^ ((a ^ d) & (c ^ p));
+  }
+  b = ((b + d) * (c * 64)) ^ ((q * q) | (c ^ a));
+  a = ((p * d) + (b ^ b)) + ((q | d) - (b - a));
+  if(a < b){
+    d = ((d & d) - (b - c)) ^ ((a ^ 1) + (d | d));
+  }else{
+    c = ((p - c) & (c + d)) | ((b + p) + (p - 94));
+  }
+  d = ((b ^ 73) * (a ^ b)) ^ ((p - c) - (p - b));
+  b = ((p | 70) ^ (q | d)) | ((a & c) - (p + d));
+  b = ((a * p) ^ (q + 40)) * ((p - 52) + (q | c));
+  for(i = 0; i < 12; i++){
+    d = ((d - d) | (c ^ c)) | ((b + b) - (a & p));
+  }
+  if(a < 80){
+    c = ((q ^ 6) - (c ^ c)) + ((c * p) & (a + b));
+  }else{
+    a = ((d ^ 98) + (a | p)) ^ ((p & 87) * (p * 89));
+  }
+  return a + b + c + d;
+}
+
+int func92(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 80;
+  d = 67;
+  b = ((a * a) & (a - b)) - ((b + b) * (a ^ c));
+  d = ((b | b) | (a & d)) * ((p + 47) ^ (p & p));
+  c = ((c | a) & (b | 93)) ^ ((b * b) ^ (c - 93));
+  c = ((c - 55) | (q + p)) - ((a + p) * (a + d));
+  if(d < c){
+    a = ((b - d) - (q | c)) & ((c ^ c) - (q * 56));
+  }else{
+    d = ((b - p) ^ (d + a)) + ((c | q) | (c * c));
+  }
+  c = ((d ^ b) * (p + 79)) & ((c | d) - (b ^ d));
+  for(i = 0; i < 19; i++){
+    b = ((q * q) + (c - 69)) * ((b | p) & (a & q));
+  }
+  b = ((c * p) * (c ^ d)) - ((q & a) - (d | b));
+  a = ((q - 54) + (p * b)) * ((a - 71) & (p & 57));
+  if(d < b){
+    b = ((a | c) - (c + b)) + ((q * d) + (d + p));
+  }else{
+    c = ((a ^ p) - (d * a)) ^ ((q * b) - (b - b));
+  }
+  b = ((d * d) - (q | p)) ^ ((c * b) ^ (d * q));
+  a = ((a | a) * (p | 57)) + ((a - b) + (a - 41));
+  b = ((d ^ c) - (p + b)) + ((d | c) & (d | 6));
+  for(i = 0; i < 13; i++){
+    d = ((q - 96) | (d + c)) * ((p | p) & (a * d));
+  }
+  if(d < d){
+    c = ((p | c) - (b | a)) ^ ((d - a) | (c * 79));
+  }else{
+    d = ((p & d) + (c * a)) - ((q | c) ^ (p * a));
+  }
+  c = ((b | 88) * (d | q)) + ((a | q) & (d - 9));
+  a = ((q * b) * (d | b)) + ((p & b) & (c & p));
+  a = ((b + 22) - (p * b)) + ((c + 68) | (p - d));
+  a = ((d * 98) - (q ^ q)) - ((b - q) ^ (p - 92));
+  if(a < p){
+    c = ((a + p) - (a * 62)) | ((c & b) ^ (q ^ 10));
+  }else{
+    b = ((p | q) * (q + d)) * ((a - b) - (b - p));
+  }
+  for(i = 0; i < 12; i++){
+    a = ((q + 2) & (c & b)) - ((c & 22) - (p ^ q));
+  }
+  d = ((a - a) * (q & d)) | ((b * 73) & (c & p));
+  b = ((p + q) ^ (p & q)) * ((c + b) | (a + q));
+  a = ((q | c) * (b & d)) - ((d + p) + (c + 89));
+  if(a < d){
+    c = ((d - 99) * (d ^ c)) ^ ((c & p) ^ (d | c));
+  }else{
+    a = ((b * q) | (p * 91)) | ((d - d) + (q & 77));
+  }
+  a = ((d + d) + (a ^ 43)) | ((d - b) & (d * d));
+  a = ((p | c) * (q - q)) - ((b ^ b) - (c ^ d));
+  for(i = 0; i < 7; i++){
+    a = ((q ^ 24) | (q - a)) * ((b * p) & (p & b));
+  }
+  c = ((c | p) & (d * d)) ^ ((b + 95) + (d * a));
+  if(a < 44){
+    b = ((q & c) - (d | 33)) ^ ((q & p) - (c * c));
+  }else{
+    b = ((c & d) - (a * d)) * ((q + a) | (p + q));
+  }
+  a = ((b ^ 82) | (d ^ a)) | ((a - p) & (c * c));
+  b = ((q - c) & (q & 32)) & ((c - p) | (d * a));
+  c = ((a & b) + (b * a)) * ((c * 60) | (a * b));
+  b = ((q | 36) | (p + a)) - ((p - 68) & (b - q));
+  if(b < b){
+    d = ((p * c) + (q | 42)) ^ ((q * a) + (q & 11));
+  }else{
+    b = ((d ^ a) - (b + d)) - ((c | b) ^ (d | p));
+  }
+  b = ((q | c) & (d - q)) ^ ((p ^ d) * (a - c));
+  d = ((q & c) + (b | 83)) ^ ((c - 64) - (b * q));
+  b = ((d ^ d) + (d ^ q)) - ((b * c) - (q - b));
+  a = ((q - a) * (c & p)) * ((a - 78) * (q | c));
+  if(a < q){
+    c = ((b & p) | (a + p)) + ((a | d) - (p | q));
+  }else{
+    d = ((a * d) - (c - q)) - ((p ^ p) - (p * d));
+  }
+  d = ((b + c) * (c * c)) + ((q + q) | (q + 25));
+  for(i = 0; i < 20; i++){
+    b = ((c & q) ^ (c | d)) & ((q & 57) | (a ^ q));
+  }
+  d = ((b * a) * (c + q)) & ((d + b) - (p + 50));
+  c = ((d & p) + (p & b)) & ((c & c) - (p & d));
+  if(a < a){
+    b = ((d * c) * (b + b)) * ((d * a) + (c ^ c));
+  }else{
+    b = ((q ^ q) ^ (d | 62)) - ((p & a) | (c | b));
+  }
+  a = ((b - p) * (a - c)) & ((a | p) | (b - p));
+  c = ((d * 52) & (p | 31)) - ((d + a) - (b ^ p));
+  b = ((p + 26) ^ (c + d)) & ((d + q) ^ (d ^ b));
+  for(i = 0; i < 41; i++){
+    c = ((d | p) | (q & 3)) | ((b - p) + (p | 34));
+  }
+  if(b < b){
+    b = ((q & b) - (d | d)) | ((b | d) + (d & b));
+  }else{
+    b = ((c ^ d) | (c - d)) & ((b + 64) - (d - 16));
+  }
+  return a + b + c + d;
+}
+
+int func93(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 48;
+  d = ((p - c) ^ (q ^ q)) + ((p & p) ^ (a & a));
+  b = ((a | p) * (p & p)) - ((d * 39) - (c & 56));
+  b = ((c & 70) - (a - q)) | ((b & p) - (a & p));
+  b = ((a + 59) - (a + q)) * ((p & 68) ^ (b & 69));
+  if(b < b){
+    d = ((q * b) & (c & c)) & ((q | 39) ^ (d + 66));
+  }else{
+    c = ((b | b) * (b * p)) - ((q & b) | (c | 89));
+  }
+  b = ((b | q) + (q & d)) - ((p & 92) ^ (d & q));
+  for(i = 0; i < 16; i++){
+    a = ((b - 17) | (a & b)) | ((c ^ c) ^ (c ^ d));
+  }
+  a = ((p & d) - (c - 30)) - ((c - p) + (d - q));
+  c = ((q & d) ^ (c | b)) ^ ((c ^ q) - (a * c));
+  if(b < 35){
+    a = ((p | q) + (b ^ c)) + ((a ^ 22) | (d + a));
+  }else{
+    d = ((c ^ a) + (q ^ q)) - ((c - 36) & (c + 84));
+  }
+  d = ((d | p) | (d * d)) + ((b | a) | (q & c));
+  d = ((p | c) | (a - c)) + ((q | a) - (c - c));
+  b = ((d ^ b) & (d ^ p)) + ((q * b) | (d * 28));
+  for(i = 0; i < 6; i++){
+    d = ((a + 9) ^ (a | q)) - ((p ^ c) * (d & 15));
+  }
+  if(a < a){
+    a = ((b ^ p) & (a + d)) | ((c - d) | (q ^ b));
+  }else{
+    a = ((a | q) - (b - 15)) & ((b * b) | (b + b));
+  }
+  a = ((q ^ c) | (b ^ p)) | ((d * 31) - (p * a));
+  c = ((p & p) | (p * c)) + ((d & 49) & (d - q));
+  c = ((b | q) + (q & c)) + ((p + c) * (p + a));
+  d = ((p + d) * (b & b)) - ((q | 71) | (q * p));
+  if(a < q){
+    d = ((c & 33) & (q | c)) | ((b + d) ^ (c & a));
+  }else{
+    c = ((c - q) | (q + p)) | ((b ^ c) ^ (b * 52));
+  }
+  for(i = 0; i < 11; i++){
+    b = ((c * a) * (d & 43)) & ((b + c) ^ (a ^ 55));
+  }
+  c = ((q - p) | (a + q)) * ((p & q) & (a - d));
+  d = ((a ^ q) & (c - a)) & ((q ^ q) | (b - b));
+  c = ((p * c) - (b * q)) + ((q + d) - (c | q));
+  if(b < a){
+    b = ((q & 19) & (b + d)) | ((q * b) * (c + c));
+  }else{
+    a = ((q - d) ^ (p * c)) & ((p - 58) | (p - c));
+  }
+  c = ((c | p) + (b & d)) ^ ((d | d) - (p & a));
+  c = ((p ^ b) & (p | b)) ^ ((q ^ b) | (a | p));
+  for(i = 0; i < 11; i++){
+    b = ((a & 22) - (c * b)) | ((a ^ a) * (p & p));
+  }
+  c = ((a + a) + (b & q)) ^ ((b * a) | (d | p));
+  if(a < 52){
+    b = ((b * q) - (c - d)) | ((d - a) ^ (q | b));
+  }else{
+    a = ((p & a) * (c * d)) + ((b ^ b) & (d * c));
+  }
+  c = ((p & 31) * (b + p)) * ((q - p) ^ (d ^ c));
+  c = ((p - 66) | (p ^ p)) | ((p + d) | (c | 42));
+  c = ((q | a) - (c + a)) & ((d - p) & (a ^ p));
+  c = ((q | a) - (d ^ 3)) + ((d + 60) - (c - p));
+  if(c < d){
+    d = ((q * p) | (p * 77)) * ((c | c) ^ (a - b));
+  }else{
+    a = ((c | p) + (b - a)) * ((c ^ q) & (a | 94));
+  }
+  b = ((q + b) | (d + q)) - ((a ^ a) | (a - 55));
+  a = ((a & a) ^ (q * p)) & ((b + q) - (p * 49));
+  d = ((d + d) | (a + c)) * ((b ^ a) * (b | b));
+  b = ((b ^ c) | (b & p)) + ((b * q) ^ (p - b));
+  if(a < p){
+    a = ((b + 51) + (c - d)) & ((p ^ q) ^ (a | b));
+  }else{
+    a = ((q ^ d) ^ (c & 89)) - ((p + c) | (b ^ d));
+  }
+  b = ((p & 70) & (a - a)) - ((b & 57) + (c * q));
+  for(i = 0; i < 17; i++){
+    c = ((c & 78) | (p - q)) - ((d - b) + (p + 32));
+  }
+  c = ((a + 56) & (b | 19)) & ((q * 91) + (b + d));
+  c = ((q ^ 85) - (c ^ 35)) & ((b * p) ^ (q & 47));
+  if(a < d){
+    c = ((q + c) | (c ^ c)) * ((a ^ q) & (d | q));
+  }else{
+    b = ((b | b) ^ (a & 60)) - ((d | a) & (c * c));
+  }
+  d = ((d | p) - (p * q)) ^ ((p | d) | (b - b));
+  c = ((c & b) & (c + 34)) ^ ((a - a) + (a - c));
+  c = ((b + 75) & (q - 12)) | ((q - q) ^ (a | 37));
+  for(i = 0; i < 30; i++){
+    a = ((c - d) & (c & q)) - ((d - b) * (d - a));
+  }
+  if(c < 27){
+    d = ((p ^ a) + (b | c)) & ((b - b) & (c | 79));
+  }else{
+    b = ((p - p) + (q * 9)) & ((d & b) & (b | a));
+  }
+  return a + b + c + d;
+}
+
+int func94(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 31;
+  d = 84;
+  b = ((a * b) - (q ^ p)) ^ ((d * 64) ^ (b + 27));
+  b = ((a & p) + (b & a)) * ((d & b) - (c * d));
+  a = ((d ^ a) - (q ^ b)) & ((c ^ a) + (p + b));
+  d = ((p | a) - (p * b)) & ((c & p) & (d - 38));
+  if(a < p){
+    b = ((c + d) & (d & d)) ^ ((c * b) & (q | 47));
+  }else{
+    d = ((d | c) + (a * b)) + ((d - 3) - (p - p));
+  }
+  d = ((q | d) & (a & c)) - ((b | a) + (d | q));
+  for(i = 0; i < 18; i++){
+    b = ((a + 8) ^ (d - c)) ^ ((q ^ 40) * (b + c));
+  }
+  d = ((p + p) & (d & p)) + ((q ^ q) & (q + a));
+  c = ((p + d) + (a * q)) * ((b - p) | (q ^ q));
+  if(a < c){
+    b = ((p | 29) ^ (b & c)) | ((c & d) | (a * b));
+  }else{
+    b = ((q * d) | (d - d)) * ((p | p) - (a & b));
+  }
+  c = ((p ^ a) & (d ^ b)) ^ ((q - q) - (a ^ b));
+  c = ((a + p) & (d * 46)) & ((p | 99) | (a * 19));
+  b = ((p + 87) | (c & a)) * ((d ^ 8) | (q + 14));
+  for(i = 0; i < 5; i++){
+    c = ((p * a) ^ (q | 2)) ^ ((c - p) ^ (b * c));
+  }
+  if(d < p){
+    d = ((c * a) * (a & c)) - ((a + a) & (c * 41));
+  }else{
+    c = ((a & a) - (b * 76)) * ((p * 56) - (b | 33));
+  }
+  b = ((b + a) + (q & c)) ^ ((c & 96) ^ (p - a));
+  d = ((q | p) ^ (p ^ b)) & ((p ^ b) - (a - 70));
+  a = ((c & d) | (c ^ c)) - ((p ^ a) + (a - 49));
+  c = ((p ^ q) & (c & 2)) + ((p ^ d) - (d * b));
+  if(c < c){
+    b = ((b | d) ^ (q - d)) - ((c & a) - (a & 24));
+  }else{
+    a = ((q - b) - (d ^ d)) & ((a & p) - (q | 36));
+  }
+  for(i = 0; i < 31; i++){
+    c = ((p * 24) ^ (c + q)) & ((b | 73) * (c & 81));
+  }
+  a = ((b * c) & (q + 28)) + ((d & p) - (c - b));
+  d = ((p * 93) - (p & q)) + ((c - d) - (d + q));
+  b = ((b - 41) - (a + b)) ^ ((p - q) | (d ^ c));
+  if(a < a){
+    d = ((b ^ 32) | (p + p)) & ((b * b) * (q ^ d));
+  }else{
+    d = ((b & a) - (p - c)) - ((c | c) - (d - 75));
+  }
+  b = ((a - p) * (b * a)) - ((d - 78) - (b ^ a));
+  a = ((p - d) * (a * d)) * ((q - q) + (c ^ 6));
+  for(i = 0; i < 12; i++){
+    d = ((b & p) & (c ^ a)) ^ ((a | q) & (p + d));
+  }
+  d = ((a - d) * (p - 96)) - ((q + 49) | (q - p));
+  if(d < 5){
+    d = ((a & q) - (c - 2)) * ((d ^ 10) + (b + c));
+  }else{
+    c = ((q & 39) * (q - b)) & ((c * q) - (c + b));
+  }
+  c = ((a & 21) - (q - c)) ^ ((a ^ a) | (c - p));
+  b = ((d & p) & (q & c)) * ((a & b) & (a - a));
+  b = ((d - c) + (b & 62)) | ((d - 19) & (p | 2));
+  c = ((c + b) * (a + p)) * ((p ^ a) ^ (a * b));
+  if(d < p){
+    a = ((d + d) ^ (q - d)) * ((c + c) & (p - q));
+  }else{
+    d = ((c & d) - (c ^ 97)) * ((b * q) ^ (a | b));
+  }
+  d = ((q | p) & (p * c)) * ((q ^ a) | (q ^ q));
+  b = ((d * q) & (q ^ c)) | ((a ^ a) + (b | d));
+  c = ((p - b) - (q + 85)) + ((d | b) & (c | d));
+  c = ((c + c) * (a & 98)) - ((a + 2) ^ (b - c));
+  if(b < q){
+    a = ((c ^ b) & (a ^ b)) * ((p - a) | (p ^ d));
+  }else{
+    c = ((b & d) + (c * c)) + ((p ^ p) - (c ^ d));
+  }
+  a = ((p & d) ^ (d ^ p)) & ((b ^ q) ^ (q - c));
+  for(i = 0; i < 36; i++){
+    d = ((a - a) * (b * 91)) + ((c | d) + (d - a));
+  }
+  a = ((p - 90) + (b | q)) - ((p ^ 85) | (p - a));
+  c = ((d | p) | (b * a)) ^ ((q - a) + (d ^ q));
+  if(d < p){
+    a = ((d | 19) & (q ^ q)) - ((d * a) + (p & q));
+  }else{
+    d = ((p - 51) * (c * q)) + ((q - b) + (a * a));
+  }
+  d = ((c & d) - (a & p)) - ((p | d) * (d | 64));
+  d = ((a * c) * (p * b)) * ((d ^ d) + (b & d));
+  c = ((p * a) * (q | c)) * ((p + d) * (q + p));
+  for(i = 0; i < 32; i++){
+    b = ((a & 22) - (c ^ a)) & ((a ^ p) | (d * p));
+  }
+  if(b < a){
+    c = ((p & c) ^ (c - b)) | ((p & 45) - (a - p));
+  }else{
+    d = ((b + p) & (p & 62)) & ((p | a) ^ (b + c));
+  }
+  return a + b + c + d;
+}
+
+int func95(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 73;
+  d = 80;
+  d = ((d | d) + (a & 99)) * ((d & b) - (q & d));
+  d = ((q ^ a) + (a ^ p)) - ((b | 90) - (d ^ 80));
+  b = ((q + p) * (b & 68)) - ((p - p) * (a | 69));
+  a = ((q - d) & (p - p)) & ((c & b) & (d - a));
+  if(b < a){
+    d = ((p - a) ^ (b ^ 64)) + ((p & q) | (q + 3));
+  }else{
+    c = ((c + c) ^ (a + d)) | ((b | d) | (a & q));
+  }
+  b = ((a ^ q) - (p ^ 78)) * ((c | q) + (a | q));
+  for(i = 0; i < 21; i++){
+    a = ((p * a) + (a | q)) * ((c + b) - (q + c));
+  }
+  a = ((c ^ d) & (a + c)) * ((p * b) + (c | d));
+  c = ((q * a) & (p - a)) + ((b - d) * (a ^ a));
+  if(d < d){
+    a = ((c + d) | (b * d)) | ((b + p) + (d ^ c));
+  }else{
+    c = ((d | a) + (p + q)) ^ ((c * p) & (p | a));
+  }
+  b = ((q * a) - (p * c)) * ((d - 88) & (d ^ 10));
+  c = ((c | c) ^ (b * p)) + ((q & q) & (q + 53));
+  b = ((d | 70) ^ (c + q)) * ((a & d) ^ (a + c));
+  for(i = 0; i < 13; i++){
+    a = ((b | q) ^ (c & a)) & ((c + d) | (d | 32));
+  }
+  if(d < c){
+    d = ((q - a) + (c | b)) * ((c * p) - (b | c));
+  }else{
+    c = ((a + b) + (p & a)) + ((q * 5) ^ (a ^ d));
+  }
+  b = ((d - d) - (p - d)) & ((d * 45) & (b ^ c));
+  a = ((b + p) ^ (d + p)) * ((c & q) ^ (c - a));
+  b = ((c & a) & (p & d)) ^ ((b - p) & (p * 18));
+  c = ((a ^ p) - (a - c)) & ((a | a) & (b ^ b));
+  if(c < p){
+    a = ((b & q) ^ (c & q)) | ((p & d) * (p + b));
+  }else{
+    d = ((a ^ a) * (a + c)) & ((c * d) * (a + p));
+  }
+  for(i = 0; i < 34; i++){
+    b = ((d & q) - (c & d)) ^ ((c - 87) ^ (c - 63));
+  }
+  c = ((c & b) | (d - c)) * ((b + d) + (q ^ c));
+  d = ((q * b) - (a & c)) - ((q * b) & (p | p));
+  d = ((d + 55) + (a | 39)) & ((d * q) - (d & b));
+  if(b < a){
+    b = ((p + a) | (c + b)) & ((p ^ a) - (d | b));
+  }else{
+    a = ((b & 56) ^ (a + c)) | ((c * 72) & (p ^ d));
+  }
+  a = ((d | b) | (a ^ p)) + ((p & 32) - (b | q));
+  c = ((a | 16) ^ (a ^ a)) + ((a & q) | (b * p));
+  for(i = 0; i < 14; i++){
+    c = ((p + d) - (a * p)) - ((c * 93) + (c | c));
+  }
+  c = ((q & b) ^ (c ^ 6)) & ((c | d) * (c + c));
+  if(a < 48){
+    a = ((a | p) * (p * c)) & ((p ^ 74) + (b & a));
+  }else{
+    a = ((c ^ c) + (b + b)) ^ ((b + 84) - (q + p));
+  }
+  a = ((p * 91) - (d * 74)) * ((d + c) | (a | q));
+  a = ((b ^ c) & (b + d)) * ((a * 24) * (b + 91));
+  a = ((d | 50) * (d - d)) * ((b - d) & (p | b));
+  c = ((b + d) ^ (p + 94)) & ((a * 40) + (q + a));
+  if(b < 3){
+    b = ((a & b) ^ (d ^ d)) + ((p ^ 80) + (p + 62));
+  }else{
+    b = ((d * q) + (c | 4)) * ((q - b) - (b + d));
+  }
+  d = ((b & b) & (q ^ b)) + ((p - b) + (b ^ 46));
+  d = ((b | d) * (p ^ d)) ^ ((a + 35) & (a | d));
+  c = ((d | 42) | (q - p)) - ((p ^ 4) * (q ^ c));
+  b = ((b ^ d) - (c & 66)) - ((a - 21) & (d | 29));
+  if(d < a){
+    c = ((p | 57) - (q * a)) ^ ((p & q) * (q + 44));
+  }else{
+    a = ((q & p) + (q - 19)) & ((b | p) - (a & q));
+  }
+  d = ((p ^ p) + (b & q)) & ((q | c) & (d | 99));
+  for(i = 0; i < 46; i++){
+    a = ((q ^ a) & (p | d)) & ((q * d) + (a ^ 89));
+  }
+  d = ((a & d) ^ (b | p)) - ((q ^ 73) & (p & d));
+  d = ((b * p) ^ (q ^ 64)) - ((c | q) ^ (q - c));
+  if(d < 39){
+    a = ((q * q) + (a | b)) + ((a | d) & (a & 95));
+  }else{
+    b = ((q ^ c) + (a ^ p)) & ((b + q) - (c & p));
+  }
+  c = ((p ^ q) & (p | b)) + ((b ^ d) + (p - b));
+  b = ((b * c) - (c - c)) | ((p * 6) ^ (b | d));
+  d = ((b ^ a) - (d & b)) * ((c | d) | (d + d));
+  for(i = 0; i < 33; i++){
+    d = ((c * q) | (c ^ a)) * ((b & a) & (p - d));
+  }
+  if(c < b){
+    a = ((b ^ 30) & (p + 47)) | ((c ^ b) ^ (q | 48));
+  }else{
+    a = ((b | c) - (p & a)) * ((a + 96) * (c - q));
+  }
+  return a + b + c + d;
+}
+
+int func96(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 26;
+  d = 74;
+  d = ((c - a) - (a * q)) & ((b & 92) ^ (q ^ 99));
+  d = ((b * 49) & (q * p)) ^ ((b + d) ^ (p - a));
+  b = ((b + b) | (d ^ 36)) + ((c & d) | (c + p));
+  d = ((a - 52) - (q + b)) ^ ((c & d) - (c * c));
+  if(a < a){
+    c = ((p & a) - (a + a)) - ((d * d) - (c - d));
+  }else{
+    b = ((c + p) | (q & 18)) - ((c ^ p) * (d - a));
+  }
+  c = ((d | a) - (p | b)) | ((p | p) ^ (a & c));
+  for(i = 0; i < 6; i++){
+    b = ((p * d) & (a + p)) ^ ((a & c) | (c + q));
+  }
+  b = ((b | p) - (b ^ 26)) & ((d - d) | (c + 4));
+  d = ((p | b) + (a & c)) | ((a & 26) | (c + 91));
+  if(c < d){
+    b = ((q + 87) * (p | d)) ^ ((p + 90) ^ (q - d));
+  }else{
+    a = ((c & 31) ^ (b & a)) - ((b * c) ^ (d - 53));
+  }
+  d = ((d & d) ^ (c + p)) ^ ((c & 79) * (d - 37));
+  c = ((d - c) + (d + 23)) * ((d + b) + (a | 25));
+  b = ((q | 57) | (a + 48)) | ((c | p) + (c - a));
+  for(i = 0; i < 10; i++){
+    d = ((b * p) * (a + 8)) & ((b - 21) | (d * d));
+  }
+  if(a < 39){
+    c = ((a | 99) * (q + a)) & ((p * p) & (p | a));
+  }else{
+    d = ((c * d) + (c - b)) * ((q - p) - (p | 33));
+  }
+  b = ((b - q) ^ (a + 74)) & ((d + b) | (p + q));
+  a = ((c | a) - (c - c)) | ((b + q) | (p - a));
+  d = ((p + p) | (d - c)) & ((b | 64) * (q * a));
+  a = ((a + 80) + (a | 94)) - ((b - 99) | (b + 53));
+  if(c < 46){
+    a = ((a & b) & (c ^ a)) * ((b & q) - (p & b));
+  }else{
+    a = ((b | c) ^ (c & c)) + ((d & c) + (c * d));
+  }
+  for(i = 0; i < 46; i++){
+    d = ((q * 32) * (p ^ 2)) + ((c ^ 68) & (d & d));
+  }
+  d = ((p & q) * (b & a)) * ((a + a) + (c * b));
+  d = ((c + b) ^ (a + d)) & ((a * a) ^ (d | 54));
+  d = ((a | d) ^ (b - 82)) * ((a ^ c) - (c | b));
+  if(d < 82){
+    d = ((d ^ q) - (c & b)) & ((b * c) - (p - 50));
+  }else{
+    a = ((a - q) - (b | a)) & ((c * 54) * (q - 21));
+  }
+  a = ((c + p) * (a | q)) + ((c + p) * (a + 8));
+  d = ((c - d) + (p | a)) ^ ((d | b) ^ (c - a));
+  for(i = 0; i < 9; i++){
+    b = ((q ^ q) - (a * 18)) - ((q | b) * (p - c));
+  }
+  c = ((c * d) ^ (d | p)) * ((d - 90) - (d * q));
+  if(d < 39){
+    d = ((d + c) - (q | 48)) | ((c & b) + (p | d));
+  }else{
+    a = ((c ^ a) + (c & 45)) ^ ((c & a) | (a + a));
+  }
+  c = ((q - b) * (b & a)) * ((a + c) + (a - c));
+  c = ((b + a) * (b & d)) - ((d & a) * (q ^ q));
+  c = ((c & q) - (d * c)) ^ ((p + q) ^ (c & 94));
+  d = ((b + a) * (a | q)) & ((d - q) + (b + p));
+  if(b < p){
+    a = ((p + p) + (b & c)) + ((d | c) | (p | q));
+  }else{
+    a = ((c & q) & (a - d)) | ((c | d) - (p + 75));
+  }
+  a = ((b - 38) - (a - 82)) - ((b * a) | (q | q));
+  a = ((b ^ b) * (d + d)) + ((a * 75) + (c ^ a));
+  c = ((b & c) & (d ^ 61)) * ((a - d) | (b & a));
+  a = ((c ^ c) | (b & c)) * ((a + c) * (c - p));
+  if(c < 85){
+    c = ((b - c) | (d + q)) * ((a & c) ^ (c | p));
+  }else{
+    b = ((p | 67) ^ (b & a)) * ((b | 67) & (p * q));
+  }
+  d = ((d ^ c) ^ (d * b)) * ((c * q) & (d ^ a));
+  for(i = 0; i < 39; i++){
+    b = ((c - 39) & (b * a)) & ((a & 95) - (c + c));
+  }
+  a = ((c + b) + (c + b)) * ((q - q) | (b ^ a));
+  b = ((a * 48) + (b ^ q)) + ((p ^ q) * (p ^ b));
+  if(b < 41){
+    a = ((d - b) & (b * d)) & ((a ^ 48) + (p - 77));
+  }else{
+    d = ((q - a) | (q | 73)) ^ ((q & p) * (a & d));
+  }
+  b = ((c - 43) ^ (q * d)) & ((d - 55) * (b - 15));
+  d = ((a ^ a) ^ (p | c)) | ((d | q) - (b + b));
+  a = ((q * b) | (a & 66)) * ((q * p) ^ (a | 8));
+  for(i = 0; i < 7; i++){
+    a = ((b * b) & (d ^ q)) - ((p - a) & (d & 92));
+  }
+  if(d < 26){
+    d = ((d & b) + (b + q)) + ((a * a) ^ (b - b));
+  }else{
+    d = ((b | b) - (b + c)) - ((d | c) + (p + a));
+  }
+  return a + b + c + d;
+}
+
+int func97(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 63;
+  d = 58;
+  d = ((a * q) ^ (b ^ 4)) - ((p + b) + (q & p));
+  c = ((b * 65) & (p & a)) & ((c + a) - (a + 89));
+  b = ((p + 81) - (q ^ 57)) - ((d | a) - (b | 25));
+  d = ((p - 40) + (c | 8)) ^ ((b * a) ^ (d - d));
+  if(a < a){
+    b = ((p ^ q) + (d - q)) * ((a - q) & (d | 70));
+  }else{
+    b = ((d & q) ^ (c * 26)) + ((a - 5) + (a - p));
+  }
+  a = ((d ^ c) & (a ^ b)) ^ ((b + b) - (a * d));
+  for(i = 0; i < 21; i++){
+    b = ((q | 44) - (d + q)) + ((c & d) & (d & c));
+  }
+  b = ((c | d) * (q & d)) | ((d + 60) + (a + 1));
+  c = ((q - a) - (c | 99)) + ((q ^ 94) * (p * p));
+  if(d < p){
+    b = ((q & b) - (p - c)) + ((c - 10) | (c + b));
+  }else{
+    c = ((a | c) ^ (q - q)) * ((c * a) & (c ^ 62));
+  }
+  b = ((p & c) * (p ^ a)) * ((d - 45) * (q & q));
+  d = ((a ^ a) | (c ^ b)) * ((a + 3) + (d ^ q));
+  c = ((d | d) & (d ^ p)) * ((c * b) * (b - q));
+  for(i = 0; i < 7; i++){
+    c = ((q * 81) & (d + p)) | ((b ^ b) ^ (p - c));
+  }
+  if(a < 45){
+    b = ((q | q) * (a | 13)) * ((c + c) * (a + p));
+  }else{
+    c = ((p + 44) | (a + q)) ^ ((p & q) & (c | b));
+  }
+  a = ((c & c) * (d & c)) | ((c ^ c) - (q & d));
+  a = ((d * q) + (p * q)) & ((d & d) + (d + c));
+  c = ((a * 41) + (q | a)) ^ ((c | c) | (b + 56));
+  c = ((a + q) + (p & c)) & ((c & b) ^ (a * 95));
+  if(c < q){
+    c = ((b * a) + (p & c)) & ((d - p) + (a | c));
+  }else{
+    a = ((p * q) ^ (c ^ p)) + ((c * 34) ^ (b * p));
+  }
+  for(i = 0; i < 34; i++){
+    a = ((q * c) + (b - b)) + ((q + 29) - (b * b));
+  }
+  c = ((q & b) - (d + d)) * ((d & 20) | (q ^ b));
+  c = ((p ^ c) | (b & d)) + ((p ^ 69) ^ (p + p));
+  b = ((a & b) | (b | p)) & ((p ^ c) + (c | c));
+  if(b < 16){
+    a = ((q ^ a) | (p | 26)) - ((p * d) - (p | 32));
+  }else{
+    a = ((p - q) * (a * d)) ^ ((a | d) + (b * p));
+  }
+  a = ((p * q) ^ (q ^ 16)) & ((d ^ 95) + (q + 53));
+  a = ((c - q) ^ (b & b)) - ((c & q) ^ (c ^ p));
+  for(i = 0; i < 43; i++){
+    b = ((b - 92) - (p ^ c)) ^ ((d | b) ^ (c & c));
+  }
+  b = ((c & 61) - (b ^ d)) | ((b * b) & (a * a));
+  if(a < p){
+    c = ((p & 47) & (d | p)) + ((p & c) ^ (d | q));
+  }else{
+    b = ((p | p) - (a * b)) - ((d + 54) & (a & d));
+  }
+  b = ((p - p) & (p * d)) * ((c & p) ^ (q | p));
+  c = ((c ^ b) - (q & c)) - ((b * 87) * (p * c));
+  a = ((p ^ 32) - (p & b)) & ((b + d) ^ (q * q));
+  b = ((b ^ a) | (b - c)) & ((c + d) * (d - c));
+  if(d < p){
+    b = ((d - d) ^ (q & c)) ^ ((a + c) ^ (p * p));
+  }else{
+    a = ((a * 26) ^ (b | q)) & ((a * q) | (d ^ a));
+  }
+  d = ((c ^ 87) - (a ^ b)) ^ ((a + p) ^ (a | a));
+  c = ((d | p) ^ (d | a)) * ((d & 28) * (b & a));
+  d = ((c + a) ^ (d * d)) + ((b - q) - (b ^ 66));
+  b = ((p - c) | (b ^ q)) - ((q ^ 75) ^ (b - p));
+  if(a < d){
+    c = ((d * 66) & (b * q)) + ((q + c) * (q * p));
+  }else{
+    d = ((p + 26) ^ (p | c)) - ((a - c) * (b ^ a));
+  }
+  a = ((c - c) * (p - d)) ^ ((p & q) + (q ^ 64));
+  for(i = 0; i < 18; i++){
+    c = ((d + d) + (b + b)) & ((p + d) ^ (b | d));
+  }
+  c = ((q - d) - (b ^ p)) - ((q & c) * (p - d));
+  d = ((p - 90) & (p ^ q)) - ((a & b) | (a * p));
+  if(d < d){
+    a = ((a * b) + (p ^ c)) + ((c ^ a) ^ (a - b));
+  }else{
+    b = ((a | 31) + (a | b)) ^ ((a ^ b) | (c + d));
+  }
+  a = ((b ^ p) + (c * 50)) | ((q & 6) ^ (b * b));
+  b = ((p + 59) ^ (a - p)) + ((q | c) & (p + p));
+  c = ((b & c) ^ (d - c)) + ((b & d) & (q + 25));
+  for(i = 0; i < 20; i++){
+    b = ((b ^ 38) + (p | a)) & ((d ^ c) ^ (q * b));
+  }
+  if(d < q){
+    d = ((b + 23) - (a - c)) - ((d ^ p) + (b - b));
+  }else{
+    a = ((q & b) + (q - b)) & ((c & a) + (c & p));
+  }
+  return a + b + c + d;
+}
+
+int func98(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 89;
+  c = ((b + 95) + (c | d)) | ((b - b) + (b - 57));
+  d = ((b & a) & (q + 54)) ^ ((q * a) * (p + b));
+  d = ((q ^ p) | (q + 14)) | ((b * q) & (b + 16));
+  d = ((b + q) ^ (d ^ d)) | ((q & q) * (d ^ a));
+  if(d < a){
+    d = ((a | 82) & (b ^ 59)) - ((p ^ c) * (d - b));
+  }else{
+    b = ((a - c) + (q - p)) - ((q & c) + (d - 74));
+  }
+  a = ((a - q) - (b * 81)) + ((p - 75) & (p * a));
+  for(i = 0; i < 41; i++){
+    b = ((d | a) | (p * 23)) ^ ((d ^ d) ^ (p & 14));
+  }
+  a = ((p - q) | (p * q)) - ((p * p) - (a - c));
+  c = ((p & a) - (d - d)) ^ ((b ^ 77) | (p & b));
+  if(b < q){
+    c = ((p - 28) ^ (a ^ p)) - ((b | q) + (d - 34));
+  }else{
+    a = ((d * 21) * (a ^ 28)) + ((c | 93) | (d + d));
+  }
+  b = ((a | p) * (c + b)) * ((p | 39) ^ (c ^ q));
+  a = ((q - 80) - (b - p)) & ((p | b) | (a ^ d));
+  a = ((p - b) | (p + a)) | ((b + c) & (q - q));
+  for(i = 0; i < 37; i++){
+    a = ((p | d) & (q * c)) - ((a ^ c) - (c + q));
+  }
+  if(a < 64){
+    d = ((a * c) * (a + a)) * ((a & q) * (b - a));
+  }else{
+    a = ((b | b) ^ (c - p)) + ((d ^ d) ^ (q - d));
+  }
+  d = ((a | q) & (p ^ 92)) & ((d | c) ^ (b & q));
+  d = ((d + c) & (p * q)) - ((q | 58) | (c + c));
+  b = ((p - 71) ^ (d - a)) | ((c ^ 71) + (c ^ p));
+  c = ((c - b) ^ (c * a)) * ((p - d) * (p + p));
+  if(d < b){
+    a = ((a + p) | (q + b)) - ((q & q) | (a | b));
+  }else{
+    a = ((p + a) * (d ^ 82)) | ((p | q) * (b * a));
+  }
+  for(i = 0; i < 49; i++){
+    d = ((p - c) ^ (c ^ 95)) ^ ((a + 36) * (a | q));
+  }
+  c = ((c + a) | (a - d)) * ((a & a) & (b * a));
+  b = ((b - q) - (c & d)) + ((b * p) - (q ^ c));
+  b = ((d & 19) ^ (q * d)) | ((p + c) & (c - d));
+  if(d < 27){
+    a = ((p & c) & (q | p)) * ((b + 43) | (p ^ a));
+  }else{
+    c = ((q - c) - (c ^ d)) * ((d & d) - (p | 42));
+  }
+  d = ((b & d) + (p + 46)) * ((b * c) - (q | b));
+  d = ((b + c) & (c | p)) + ((d * b) - (d - 28));
+  for(i = 0; i < 14; i++){
+    d = ((q + a) + (b & d)) * ((d - a) | (a ^ c));
+  }
+  a = ((c ^ q) * (c * 21)) ^ ((q | p) | (a & p));
+  if(b < b){
+    d = ((b & 62) ^ (b | 51)) & ((p - p) | (p | c));
+  }else{
+    d = ((a ^ p) ^ (p ^ a)) & ((d & c) - (c * 44));
+  }
+  a = ((q * c) | (q ^ 50)) ^ ((q | 34) + (q & d));
+  c = ((q | 27) - (b & a)) ^ ((b * p) - (q + 58));
+  d = ((d * 3) ^ (b - d)) - ((a ^ 59) | (p + b));
+  b = ((d + d) + (b & a)) + ((d ^ q) - (p ^ c));
+  if(c < 79){
+    c = ((p + p) - (p - q)) - ((b & p) ^ (p | a));
+  }else{
+    b = ((a ^ p) ^ (a | 48)) - ((q ^ q) | (b & a));
+  }
+  b = ((p - 96) * (c ^ 33)) & ((q | p) * (p * q));
+  d = ((p ^ b) - (p - 62)) & ((d & p) - (b ^ b));
+  b = ((d ^ 77) * (p & d)) * ((a + a) + (a * 25));
+  b = ((p ^ p) * (d | d)) ^ ((b & a) & (q ^ b));
+  if(b < p){
+    a = ((a - 30) - (c ^ q)) ^ ((b * 55) + (d ^ b));
+  }else{
+    d = ((a - q) & (q | 73)) | ((d | p) * (q * a));
+  }
+  a = ((p + p) * (c | a)) + ((q * d) * (p | c));
+  for(i = 0; i < 16; i++){
+    b = ((b | c) ^ (a + a)) + ((a - p) + (a + 46));
+  }
+  d = ((a + p) + (b & p)) | ((q - q) + (d * d));
+  d = ((a & q) * (b - a)) & ((d + 29) & (a | q));
+  if(d < 1){
+    d = ((b | d) & (q ^ 18)) + ((q & 47) - (d * p));
+  }else{
+    d = ((p ^ c) * (b | p)) - ((p & b) * (c + b));
+  }
+  c = ((a | p) ^ (q - 44)) * ((q | q) | (c + b));
+  a = ((a | 94) & (b - a)) & ((d & a) | (b & d));
+  d = ((p - 89) + (b + q)) ^ ((b ^ d) ^ (c ^ 32));
+  for(i = 0; i < 20; i++){
+    c = ((c & d) + (b ^ q)) + ((p * 28) | (q & a));
+  }
+  if(d < 96){
+    c = ((c ^ c) * (a - d)) * ((b | d) + (q - c));
+  }else{
+    c = ((b & q) | (q - p)) * ((q - 6) + (c * a));
+  }
+  return a + b + c + d;
+}
+
+int func99(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 13;
+  d = 48;
+  c = ((p | c) * (a | 88)) & ((a | q) - (a ^ q));
+  d = ((q - q) + (a * 44)) | ((d ^ 23) & (b | 69));
+  d = ((c + 35) - (q + p)) - ((a - 98) | (d & q));
+  c = ((b * b) | (q * c)) & ((c | c) - (c | 21));
+  if(c < 58){
+    b = ((b | a) ^ (q - 60)) & ((p ^ c) & (q ^ 46));
+  }else{
+    d = ((q * a) + (c ^ d)) + ((d - 34) - (a + a));
+  }
+  d = ((q | b) & (c & 59)) | ((q - 55) ^ (q & d));
+  for(i = 0; i < 18; i++){
+    d = ((d ^ p) ^ (d ^ b)) ^ ((c * b) & (p + q));
+  }
+  b = ((b & c) * (c + 28)) + ((a ^ c) ^ (p & 90));
+  c = ((a & 99) & (q * b)) + ((a - 51) * (a ^ 83));
+  if(b < 25){
+    b = ((p & 15) ^ (d ^ q)) & ((d & q) & (q & p));
+  }else{
+    c = ((p + 63) ^ (c * 9)) + ((q * c) - (c + p));
+  }
+  c = ((q | 84) + (p ^ a)) ^ ((c - 98) * (p + 11));
+  c = ((d & b) | (b * 76)) ^ ((a ^ c) & (p ^ c));
+  c = ((c ^ q) + (c + 44)) - ((q ^ 10) - (b - a));
+  for(i = 0; i < 8; i++){
+    d = ((p * d) | (d ^ d)) ^ ((q | d) & (c * q));
+  }
+  if(a < a){
+    d = ((q * 77) & (q * q)) - ((b + 7) * (q & p));
+  }else{
+    a = ((p & d) & (a ^ b)) - ((p ^ a) * (c * 77));
+  }
+  a = ((p - q) | (c * q)) - ((p * 3) + (a | d));
+  c = ((b + p) & (c * c)) * ((d | p) * (c * a));
+  c = ((a + d) & (q * c)) + ((p & 9) ^ (c | a));
+  b = ((b ^ b) * (a + 31)) & ((q * c) + (d ^ 40));
+  if(d < b){
+    a = ((b | 4) | (q - 36)) * ((q & 45) * (d & a));
+  }else{
+    b = ((c * d) ^ (p * a)) & ((c * a) | (c | a));
+  }
+  for(i = 0; i < 7; i++){
+    c = ((p * a) * (q * 17)) & ((a ^ p) | (b * q));
+  }
+  a = ((d | p) & (a | a)) * ((c * 47) + (q - a));
+  c = ((a + a) & (q + 94)) & ((b ^ c) & (c - c));
+  d = ((b & q) * (d | p)) * ((q ^ q) ^ (c ^ a));
+  if(c < b){
+    c = ((q ^ d) + (q | b)) - ((c * d) ^ (p & b));
+  }else{
+    d = ((q & b) - (a + b)) ^ ((q & 26) & (q * p));
+  }
+  d = ((q & a) ^ (p + b)) - ((b ^ b) ^ (a - a));
+  d = ((d + q) - (d & d)) ^ ((d - d) * (q & 94));
+  for(i = 0; i < 24; i++){
+    a = ((a | d) & (q ^ a)) + ((q & b) + (d * 86));
+  }
+  d = ((c * q) + (a ^ q)) ^ ((p * 92) ^ (c + 44));
+  if(a < b){
+    b = ((c * q) | (p * q)) ^ ((d & q) - (c ^ a));
+  }else{
+    d = ((c | 90) - (d | b)) - ((d * p) ^ (b & d));
+  }
+  d = ((d * a) - (b & p)) | ((q * b) | (q ^ q));
+  a = ((p * c) - (a + p)) | ((b ^ c) | (a & d));
+  c = ((b | p) & (a ^ a)) ^ ((a * c) ^ (p | a));
+  c = ((d + c) - (b + 89)) * ((d + b) & (c * a));
+  if(d < p){
+    c = ((q & b) ^ (d & d)) & ((a | q) & (q ^ a));
+  }else{
+    a = ((a - d) - (p | d)) & ((d | d) | (d & 57));
+  }
+  d = ((b + d) & (c & 75)) * ((p & 49) + (c | q));
+  a = ((b ^ 93) - (b & d)) - ((p ^ 29) * (a - c));
+  b = ((p + 35) & (b * q)) - ((q * 19) & (p - 4));
+  a = ((c | 74) + (p & c)) - ((a | q) ^ (p | 81));
+  if(d < b){
+    a = ((p - 11) ^ (d * d)) | ((p + b) - (a - a));
+  }else{
+    c = ((q | 49) | (c | d)) ^ ((d ^ 61) | (d + a));
+  }
+  c = ((a & c) ^ (d | c)) * ((d * c) + (a ^ 29));
+  for(i = 0; i < 8; i++){
+    c = ((a * q) & (a + 18)) & ((b - 39) * (q * c));
+  }
+  d = ((d - b) + (p * a)) ^ ((p - a) - (a * 42));
+  d = ((d ^ a) - (d & q)) ^ ((d + c) ^ (a & c));
+  if(c < p){
+    b = ((c + 14) * (q - c)) & ((b - 66) + (b + 11));
+  }else{
+    c = ((d + a) + (d * q)) * ((a & d) ^ (q * b));
+  }
+  a = ((p + c) | (d - p)) | ((a - d) + (p ^ p));
+  d = ((c * d) & (a * p)) + ((d - q) | (a ^ c));
+  a = ((c * q) * (a - a)) & ((a + p) ^ (c + c));
+  for(i = 0; i < 17; i++){
+    d = ((a | b) & (p * 68)) - ((q + a) - (d ^ p));
+  }
+  if(d < d){
+    d = ((q * 7) ^ (p ^ 23)) - ((b - 49) + (c ^ q));
+  }else{
+    c = ((c ^ q) * (p - c)) & ((p & d) * (b + b));
+  }
+  return a + b + c + d;
+}
+
+int func100(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 27;
+  d = 55;
+  c = ((p & 92) | (q + c)) | ((p ^ a) | (b - q));
+  b = ((b + 15) + (b - c)) & ((d - a) + (c | d));
+  c = ((d ^ q) - (d * 45)) ^ ((p ^ c) + (p | d));
+  b = ((d * 48) + (a + 10)) * ((b + d) & (d | a));
+  if(c < d){
+    b = ((b * 3) - (a ^ 31)) | ((b ^ d) & (c & c));
+  }else{
+    d = ((b - b) - (b * 39)) + ((p * c) - (d + p));
+  }
+  d = ((q & p) + (d | a)) * ((b + 36) | (b - p));
+  for(i = 0; i < 25; i++){
+    d = ((d | p) | (a | b)) - ((p * c) * (p * 92));
+  }
+  d = ((a | 11) * (b + a)) - ((b | b) ^ (a * 90));
+  b = ((q & c) + (c ^ 1)) + ((a & q) * (c ^ p));
+  if(d < 57){
+    b = ((b & d) * (c * b)) + ((p ^ 57) + (q & 94));
+  }else{
+    b = ((b & c) - (c - 96)) + ((a | q) * (c ^ c));
+  }
+  b = ((b * 60) & (q + c)) & ((p ^ c) ^ (b - c));
+  a = ((p - d) * (d - p)) ^ ((b - d) & (b - 37));
+  b = ((c & c) + (a + 21)) + ((p ^ a) ^ (q - b));
+  for(i = 0; i < 34; i++){
+    c = ((c + p) + (c - 76)) + ((c & 14) ^ (q - 14));
+  }
+  if(b < d){
+    a = ((p ^ c) - (d + p)) | ((b | b) - (q | b));
+  }else{
+    b = ((a + 53) & (p ^ 74)) - ((b + c) * (d - p));
+  }
+  a = ((c & 32) & (d * p)) | ((p + a) - (q * a));
+  c = ((p * b) | (a | a)) ^ ((c & p) * (a - 90));
+  b = ((d & a) | (b * 53)) - ((q ^ b) ^ (a & 35));
+  d = ((p & q) | (p * b)) * ((b + a) | (d * 15));
+  if(c < q){
+    a = ((c ^ a) | (p | 71)) - ((q + 71) | (d ^ 92));
+  }else{
+    d = ((q ^ b) + (b | d)) * ((a - p) & (d & b));
+  }
+  for(i = 0; i < 10; i++){
+    b = ((c & b) | (p | b)) ^ ((q & q) + (b | q));
+  }
+  b = ((a | c) | (b | b)) + ((d & 49) * (q + p));
+  d = ((p * p) ^ (p ^ 85)) + ((c ^ a) ^ (b | 65));
+  a = ((p * p) ^ (d - q)) & ((c + c) - (b + 69));
+  if(b < q){
+    d = ((p ^ d) | (d * b)) * ((c - c) - (b | c));
+  }else{
+    d = ((p - 34) ^ (d - a)) & ((q & p) & (a * d));
+  }
+  a = ((a * q) * (p + p)) - ((p & p) + (p - b));
+  d = ((d - q) + (c & q)) | ((q ^ p) + (c * c));
+  for(i = 0; i < 37; i++){
+    b = ((b | q) + (a + 39)) | ((d & d) ^ (q ^ b));
+  }
+  d = ((b ^ a) - (d * 45)) ^ ((a * 62) - (p + c));
+  if(a < 46){
+    b = ((c + d) | (q & c)) * ((p * d) * (d - b));
+  }else{
+    c = ((c ^ q) | (q + d)) ^ ((d * 82) + (c - p));
+  }
+  c = ((b ^ 95) + (c & p)) ^ ((d | d) * (b ^ b));
+  a = ((c ^ a) ^ (d ^ c)) - ((p * c) - (a * q));
+  c = ((q ^ 52) ^ (q - d)) * ((p ^ a) * (p ^ a));
+  c = ((c & 84) ^ (p ^ a)) | ((a ^ q) & (d & d));
+  if(b < c){
+    b = ((q | 75) * (b ^ 9)) & ((c & a) - (p & d));
+  }else{
+    c = ((a - d) ^ (c | a)) & ((p ^ b) - (d ^ c));
+  }
+  b = ((c & q) | (p | 40)) ^ ((d * 62) | (b | a));
+  a = ((b | b) | (q + c)) & ((b + 1) - (c ^ c));
+  d = ((q + d) + (p * a)) * ((q & a) | (q * c));
+  c = ((d | 29) | (a | 85)) | ((p - p) * (q ^ d));
+  if(a < d){
+    b = ((p * 98) & (c | 3)) + ((b ^ 1) * (c - p));
+  }else{
+    d = ((d + q) * (q & a)) * ((q * 86) - (q - b));
+  }
+  c = ((p & b) | (a | d)) ^ ((p * a) - (c | d));
+  for(i = 0; i < 50; i++){
+    d = ((b - 64) - (p - c)) + ((p * p) * (c | 9));
+  }
+  c = ((p - p) & (d - d)) - ((q ^ d) & (b ^ c));
+  a = ((q - p) & (p & a)) - ((b ^ a) - (p & 71));
+  if(d < 7){
+    b = ((d * a) ^ (b * d)) ^ ((b + c) ^ (d + d));
+  }else{
+    d = ((q + p) | (c - 27)) | ((p + p) & (q * p));
+  }
+  a = ((q - q) * (a ^ c)) | ((q ^ p) | (b ^ q));
+  d = ((q & c) + (p * p)) + ((c | p) - (c * 60));
+  c = ((c * 26) * (d + b)) ^ ((d ^ c) * (a ^ c));
+  for(i = 0; i < 8; i++){
+    a = ((b & 5) - (b * p)) | ((p | a) + (c & c));
+  }
+  if(d < p){
+    d = ((a | p) * (d + p)) | ((p + b) * (b - 43));
+  }else{
+    c = ((c ^ a) + (q - q)) * ((a - a) + (a * b));
+  }
+  return a + b + c + d;
+}
+
+int func101(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 42;
+  d = 3;
+  c = ((c | c) - (p & 96)) + ((p ^ q) * (p | q));
+  b = ((a ^ 34) * (a + 51)) & ((c | 29) - (b | d));
+  a = ((c | 29) - (b & c)) - ((b + q) ^ (p * q));
+  c = ((d + b) | (c + q)) + ((q + d) & (q * p));
+  if(b < d){
+    c = ((b | a) - (b + 3)) ^ ((b | 49) | (d & c));
+  }else{
+    c = ((c - p) * (c & p)) * ((b * a) & (c & p));
+  }
+  a = ((b + c) & (d | 19)) | ((p ^ p) * (d ^ d));
+  for(i = 0; i < 17; i++){
+    c = ((b * p) * (c ^ a)) & ((c - b) + (d | c));
+  }
+  a = ((c & 86) - (q | c)) ^ ((c | 21) & (d & d));
+  a = ((q * 12) & (a & p)) & ((c ^ q) & (b ^ c));
+  if(b < a){
+    a = ((a ^ p) | (b + 64)) - ((d - 74) * (c & a));
+  }else{
+    b = ((q & 52) + (a & p)) & ((p + q) ^ (b ^ a));
+  }
+  b = ((q + p) + (c * q)) & ((b - b) - (p ^ c));
+  b = ((b + 16) & (q & 53)) * ((c - p) - (b + a));
+  a = ((d * 4) + (a * c)) * ((q * 18) - (b + q));
+  for(i = 0; i < 7; i++){
+    c = ((d ^ 29) + (a & a)) + ((a + 84) | (a ^ b));
+  }
+  if(d < p){
+    b = ((d | q) - (p * 77)) | ((a ^ 68) + (d & a));
+  }else{
+    b = ((c & 50) * (d & 44)) + ((p + p) ^ (a * c));
+  }
+  b = ((p ^ 56) + (a | c)) | ((q - 94) * (p & q));
+  a = ((p & p) + (p + 10)) * ((c & q) * (q * q));
+  c = ((d & d) - (a - p)) - ((c * d) & (a * d));
+  a = ((d & 56) * (d ^ 5)) * ((a * q) ^ (p & p));
+  if(c < d){
+    a = ((q + d) & (c ^ b)) & ((a ^ q) ^ (q | d));
+  }else{
+    a = ((a + p) ^ (b | b)) * ((d - c) | (b * 38));
+  }
+  for(i = 0; i < 29; i++){
+    a = ((p * a) + (d | c)) & ((a & b) - (b ^ p));
+  }
+  c = ((b & b) - (b * 53)) & ((a * q) ^ (a + p));
+  a = ((b * 92) + (q | q)) | ((a - p) & (c & b));
+  c = ((b | a) | (b ^ 89)) | ((d | c) | (q - c));
+  if(c < b){
+    a = ((d * d) ^ (q & q)) & ((p - 54) + (c & p));
+  }else{
+    a = ((q * b) + (p * q)) & ((c + d) ^ (d + 78));
+  }
+  c = ((c - p) ^ (b | q)) | ((p - c) & (c - c));
+  b = ((c - 68) & (a | b)) + ((p + c) & (q ^ d));
+  for(i = 0; i < 40; i++){
+    c = ((c * 45) * (c * q)) | ((d - d) & (q | p));
+  }
+  c = ((b & a) ^ (p + b)) | ((q * a) & (a + q));
+  if(b < q){
+    c = ((b + b) | (d - b)) | ((c * b) ^ (b * c));
+  }else{
+    a = ((c ^ 11) & (d * p)) & ((d - 94) * (a - a));
+  }
+  a = ((p * b) & (q ^ b)) * ((c - b) ^ (d * d));
+  a = ((p & 44) * (d ^ c)) + ((q + q) ^ (q ^ d));
+  c = ((c & c) | (b - q)) * ((c & d) * (b ^ d));
+  b = ((p ^ c) ^ (d * 64)) * ((p + p) + (b | q));
+  if(d < c){
+    b = ((q + 69) ^ (b ^ 39)) * ((p * a) | (q - c));
+  }else{
+    a = ((p | d) | (d | p)) & ((q - b) ^ (a - 58));
+  }
+  b = ((q + q) - (c | a)) ^ ((q ^ p) + (c & b));
+  b = ((b * c) ^ (p & b)) & ((c ^ a) | (c * d));
+  b = ((c ^ 95) - (p + 66)) * ((q - c) & (a + a));
+  d = ((d - 27) | (q * 6)) - ((b & 65) + (d & d));
+  if(b < 74){
+    d = ((a ^ b) + (p ^ 44)) - ((d * b) + (q & p));
+  }else{
+    b = ((c | q) - (c ^ p)) + ((a - d) ^ (a | 95));
+  }
+  d = ((c - 16) | (b ^ 72)) | ((a * d) + (b & q));
+  for(i = 0; i < 45; i++){
+    b = ((a * p) & (d | a)) - ((a * q) & (q - p));
+  }
+  a = ((a * q) | (p & b)) - ((q + d) + (d - a));
+  a = ((b | a) & (d + 35)) & ((a * p) + (q + b));
+  if(d < 40){
+    a = ((p + b) ^ (a * q)) + ((c & b) & (p - b));
+  }else{
+    d = ((a ^ p) * (b - q)) | ((q - p) - (p | q));
+  }
+  a = ((a ^ 62) * (c - b)) - ((q * a) | (d ^ 2));
+  a = ((d * d) ^ (p ^ p)) ^ ((p ^ b) - (c + p));
+  b = ((d + d) * (p ^ q)) * ((a | a) ^ (d ^ b));
+  for(i = 0; i < 17; i++){
+    a = ((c - c) * (a ^ p)) & ((p | 66) | (d ^ 20));
+  }
+  if(a < q){
+    a = ((p & 99) * (a ^ q)) - ((q * p) + (a + d));
+  }else{
+    c = ((p + d) ^ (d * 95)) | ((p & d) ^ (p * b));
+  }
+  return a + b + c + d;
+}
+
+int func102(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 60;
+  d = 26;
+  c = ((b | 78) - (d + d)) + ((c + b) ^ (c * 44));
+  a = ((c - p) * (p & c)) ^ ((b ^ p) | (d + a));
+  c = ((d - p) + (p & q)) + ((b | 44) ^ (q - q));
+  d = ((p | b) - (p | q)) ^ ((b - a) ^ (a & c));
+  if(c < b){
+    c = ((c & b) | (b + b)) ^ ((p | 10) ^ (q ^ 48));
+  }else{
+    c = ((a | 71) ^ (d & p)) * ((c & 55) ^ (a & d));
+  }
+  d = ((p - c) ^ (c & b)) + ((c ^ b) | (d ^ 62));
+  for(i = 0; i < 25; i++){
+    b = ((p * 84) * (p | d)) & ((a & p) ^ (p + 36));
+  }
+  b = ((q | q) | (a & 63)) * ((d - 46) + (c & 17));
+  b = ((q * p) & (d | p)) * ((p | a) + (p ^ d));
+  if(b < a){
+    c = ((d * p) ^ (c - d)) * ((p | d) & (c + c));
+  }else{
+    d = ((q | q) - (a & q)) | ((p | a) * (c ^ p));
+  }
+  d = ((b - p) | (q + d)) * ((c ^ q) * (a & d));
+  a = ((c & a) - (p & c)) ^ ((c - 37) + (b - d));
+  c = ((c - c) | (a & d)) & ((a - q) | (a - b));
+  for(i = 0; i < 23; i++){
+    c = ((q | c) - (q - b)) ^ ((c | 7) | (a & d));
+  }
+  if(a < q){
+    a = ((p ^ c) + (q | 17)) & ((c + b) ^ (b * b));
+  }else{
+    d = ((a * q) - (q ^ c)) & ((p ^ 71) - (q - a));
+  }
+  c = ((p + a) + (c - a)) * ((b & q) ^ (d * q));
+  b = ((d + p) * (q - c)) * ((d * a) * (c * p));
+  b = ((p * b) * (p & a)) - ((b * d) | (p * 74));
+  c = ((d * 55) | (c ^ 28)) | ((q | c) ^ (c * d));
+  if(c < b){
+    d = ((b - q) & (b + a)) ^ ((a & q) - (d * q));
+  }else{
+    c = ((c + b) | (p & d)) & ((p & c) - (p | c));
+  }
+  for(i = 0; i < 4; i++){
+    b = ((d | c) & (q - p)) + ((d + p) * (p | q));
+  }
+  a = ((b | 42) & (q * p)) & ((p * 5) ^ (c & q));
+  a = ((q + a) & (a ^ 88)) + ((b ^ 22) + (q | c));
+  d = ((p | 64) ^ (b - a)) - ((p & 16) * (b | c));
+  if(a < q){
+    a = ((p + d) * (b ^ d)) | ((c & a) ^ (p | d));
+  }else{
+    c = ((b & b) + (q | 39)) + ((p * c) + (p * b));
+  }
+  a = ((q + a) * (d | c)) & ((p & 11) - (p * d));
+  b = ((b * d) ^ (q & p)) - ((q * a) * (c * 89));
+  for(i = 0; i < 40; i++){
+    c = ((a - b) - (c + q)) | ((b | q) * (a * d));
+  }
+  b = ((q * d) + (c - c)) | ((d - c) - (b * b));
+  if(d < b){
+    a = ((d | c) - (a ^ b)) - ((c - d) + (c + a));
+  }else{
+    d = ((q ^ c) & (c | 45)) * ((a ^ d) * (c * b));
+  }
+  b = ((a ^ c) - (q + a)) + ((b ^ c) + (d + 28));
+  a = ((p | q) * (c + a)) + ((d ^ d) * (p * 96));
+  b = ((d ^ d) ^ (d ^ d)) & ((a * d) + (d | q));
+  a = ((p + p) | (p - a)) ^ ((c + a) | (q & 30));
+  if(c < b){
+    a = ((b - a) + (a | 42)) + ((c + d) & (q - p));
+  }else{
+    d = ((a | 32) - (a ^ b)) + ((b * c) | (c | p));
+  }
+  d = ((c ^ 16) ^ (a + q)) ^ ((b + c) * (d ^ 70));
+  b = ((p - 36) * (b & a)) & ((q & q) + (a + p));
+  c = ((d & 51) - (q ^ d)) + ((d | p) & (q & d));
+  c = ((a + a) + (d | b)) * ((p - c) | (c & c));
+  if(a < 64){
+    d = ((a - 45) & (d & a)) * ((q ^ 84) ^ (a + d));
+  }else{
+    c = ((q & a) | (q | q)) + ((d & 66) ^ (a - a));
+  }
+  b = ((p - 19) & (a & 24)) | ((b + d) * (d - b));
+  for(i = 0; i < 34; i++){
+    a = ((b | q) + (a & 10)) - ((c | a) & (p - d));
+  }
+  d = ((q + b) & (c + c)) - ((q & p) & (c ^ 99));
+  a = ((a | a) * (d | d)) - ((d & c) * (p * 76));
+  if(b < q){
+    a = ((q - b) + (b - 65)) & ((p + a) + (p * p));
+  }else{
+    c = ((d ^ d) + (d & c)) ^ ((q ^ 39) - (p * c));
+  }
+  c = ((c * q) - (d * 24)) - ((d & d) * (c ^ p));
+  a = ((q - a) * (a - c)) | ((q * d) - (c * p));
+  b = ((a * p) | (d & b)) + ((d & b) & (p * 65));
+  for(i = 0; i < 6; i++){
+    d = ((p - d) & (p ^ p)) * ((c + d) * (b + 71));
+  }
+  if(c < 67){
+    c = ((p - d) | (a - 55)) | ((c | p) ^ (q * p));
+  }else{
+    b = ((p ^ a) & (c ^ d)) - ((c - p) | (b & p));
+  }
+  return a + b + c + d;
+}
+
+int func103(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 94;
+  d = 57;
+  d = ((b & c) | (c - 25)) & ((p ^ p) + (d ^ q));
+  c = ((p ^ c) * (p | b)) & ((p ^ q) ^ (q + 89));
+  b = ((c ^ d) - (a * q)) * ((a | q) ^ (a & 71));
+  b = ((c ^ c) ^ (a ^ d)) ^ ((b ^ p) + (p | c));
+  if(b < d){
+    d = ((p & p) + (d | p)) - ((q - 67) + (p + a));
+  }else{
+    b = ((d | b) ^ (p * d)) - ((p + c) - (d * c));
+  }
+  a = ((a | a) | (d + b)) * ((d + 18) * (a + p));
+  for(i = 0; i < 49; i++){
+    a = ((c & b) & (d & 80)) * ((p & q) * (a ^ 67));
+  }
+  c = ((b ^ c) & (d * d)) ^ ((q & q) ^ (a | 75));
+  c = ((q & p) * (q | p)) + ((p ^ 28) ^ (c + 67));
+  if(c < b){
+    c = ((d + 70) + (d | p)) * ((b ^ 84) * (a * a));
+  }else{
+    d = ((d * q) + (b - p)) & ((q + a) + (d * c));
+  }
+  c = ((a - d) * (b & b)) * ((a ^ q) ^ (c & q));
+  c = ((b + 29) - (d + a)) - ((c * c) ^ (b ^ b));
+  b = ((a - a) - (b * c)) & ((b | a) & (b * q));
+  for(i = 0; i < 40; i++){
+    d = ((c & p) - (a - c)) * ((q | 97) ^ (a | 56));
+  }
+  if(c < d){
+    b = ((a + b) - (a * 32)) - ((p - p) - (b + d));
+  }else{
+    c = ((a ^ p) + (p + a)) & ((p & c) | (b ^ c));
+  }
+  c = ((c * 18) & (p & p)) & ((b ^ a) | (d + b));
+  b = ((a * d) - (p - q)) | ((b - p) & (q ^ 72));
+  d = ((d + p) * (a + a)) ^ ((c ^ c) | (p - p));
+  d = ((b & c) + (a - c)) * ((b - d) + (d ^ q));
+  if(b < b){
+    d = ((d + q) & (d ^ b)) * ((b & a) ^ (q + a));
+  }else{
+    d = ((q + p) * (p & 32)) ^ ((a & d) * (b + 41));
+  }
+  for(i = 0; i < 25; i++){
+    d = ((d - b) + (q * d)) + ((p + 88) | (c + q));
+  }
+  c = ((d + a) + (q ^ 13)) * ((a - a) ^ (a - p));
+  c = ((c + 48) - (p * b)) - ((b ^ a) ^ (d | b));
+  b = ((a * a) ^ (q | d)) - ((c & q) & (c - d));
+  if(a < d){
+    c = ((p * b) ^ (p * d)) | ((a & 49) * (c ^ c));
+  }else{
+    c = ((a & p) ^ (q + d)) & ((c * c) + (a + 71));
+  }
+  d = ((q | d) | (c + a)) | ((c + 32) - (b * 69));
+  d = ((d | d) & (d + p)) ^ ((b | q) - (a | 21));
+  for(i = 0; i < 28; i++){
+    d = ((a + b) * (d & 58)) - ((q - d) ^ (c - 38));
+  }
+  a = ((d + p) + (q & q)) - ((b | d) - (c ^ a));
+  if(d < q){
+    c = ((a * a) * (q | q)) - ((a ^ p) ^ (d & d));
+  }else{
+    a = ((c + 89) ^ (a - d)) + ((d - q) ^ (q ^ 12));
+  }
+  b = ((c | c) + (d ^ 41)) * ((d ^ 27) ^ (p & 92));
+  a = ((b - b) & (b | c)) ^ ((p | c) ^ (c | b));
+  c = ((c - c) * (p ^ c)) - ((q + d) - (b * q));
+  a = ((c | q) & (p + b)) * ((q ^ 40) * (c ^ c));
+  if(b < 33){
+    a = ((d + p) ^ (p | b)) + ((c ^ c) * (a * c));
+  }else{
+    d = ((p | b) & (c - d)) - ((c - p) - (q * d));
+  }
+  a = ((p | d) * (b - c)) + ((q | a) ^ (q * a));
+  d = ((b * b) ^ (b | c)) | ((b * d) | (p & c));
+  d = ((b * c) & (q - q)) ^ ((d & c) + (p | 21));
+  d = ((c * c) + (a & d)) ^ ((p & 88) * (q ^ c));
+  if(c < d){
+    d = ((p & 75) - (d & a)) * ((p + q) & (q & p));
+  }else{
+    c = ((c ^ a) + (c * d)) - ((a | b) + (b + p));
+  }
+  b = ((a * 18) & (c - 39)) * ((a - 46) ^ (b * q));
+  for(i = 0; i < 44; i++){
+    c = ((q - 8) - (c | c)) | ((b + p) & (d & d));
+  }
+  d = ((d * b) & (c | a)) ^ ((q * b) | (a * q));
+  b = ((b + d) - (q & 92)) - ((b * 62) | (p ^ 47));
+  if(a < d){
+    d = ((a | p) ^ (a ^ b)) ^ ((a - b) & (d & p));
+  }else{
+    a = ((c * b) * (q | q)) - ((q ^ c) & (q - d));
+  }
+  a = ((d + q) * (c + 5)) - ((q & p) | (p * p));
+  b = ((p ^ a) - (q | p)) & ((c & p) - (p | d));
+  a = ((p | p) * (b ^ b)) + ((a | p) - (c + a));
+  for(i = 0; i < 21; i++){
+    b = ((b ^ 65) | (a - 56)) | ((q ^ d) + (q + d));
+  }
+  if(b < q){
+    a = ((q ^ b) - (d * 90)) ^ ((p | a) & (a & b));
+  }else{
+    c = ((c * 6) + (p & a)) + ((d + d) | (q | c));
+  }
+  return a + b + c + d;
+}
+
+int func104(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 20;
+  d = 45;
+  a = ((a & 76) * (p * b)) + ((d | 21) & (p & q));
+  c = ((p - b) ^ (d ^ 14)) & ((b - 18) + (p & b));
+  d = ((d + 78) & (b - 29)) & ((q + q) - (a - a));
+  d = ((a ^ c) ^ (d * d)) + ((b | p) - (p * 36));
+  if(d < c){
+    c = ((b & a) & (q - 58)) + ((q - d) + (p - d));
+  }else{
+    d = ((a | c) - (c | 91)) - ((a * c) & (a * d));
+  }
+  a = ((p | 12) - (a + d)) | ((a - 80) * (a & d));
+  for(i = 0; i < 41; i++){
+    b = ((b & d) * (b | b)) ^ ((c * a) & (a - p));
+  }
+  d = ((a + 83) * (c * 56)) | ((b & c) & (p | q));
+  a = ((a ^ q) | (b ^ d)) + ((q | c) - (a | q));
+  if(c < c){
+    d = ((c & c) & (a - 55)) | ((a ^ b) - (c * p));
+  }else{
+    d = ((p - 33) * (q | 63)) & ((a ^ 36) + (a | q));
+  }
+  a = ((b ^ c) * (c & a)) | ((q - c) - (c ^ b));
+  c = ((p * b) + (p ^ c)) ^ ((a - 72) * (c & b));
+  c = ((q | d) ^ (d + a)) ^ ((q ^ 69) - (b * a));
+  for(i = 0; i < 43; i++){
+    a = ((c - 85) * (p & q)) * ((a - a) | (p ^ q));
+  }
+  if(c < b){
+    d = ((c - c) ^ (b ^ 86)) * ((b | c) + (p * 94));
+  }else{
+    a = ((d + d) & (c & q)) & ((b - b) & (a + d));
+  }
+  d = ((c - b) + (q & c)) * ((b - b) + (p ^ b));
+  c = ((c | 81) | (d | 29)) + ((c ^ a) ^ (q | q));
+  c = ((a & p) | (b + b)) & ((b | b) & (p ^ 81));
+  a = ((p ^ b) & (q * b)) + ((q | q) * (a ^ 36));
+  if(c < d){
+    b = ((q & p) & (q & a)) - ((p ^ d) * (p - 77));
+  }else{
+    b = ((a ^ 34) ^ (c - d)) & ((p * 83) ^ (b - a));
+  }
+  for(i = 0; i < 38; i++){
+    b = ((a + p) * (q - c)) | ((a | 89) ^ (q & b));
+  }
+  b = ((d * d) | (c * c)) * ((d * d) | (b * a));
+  a = ((b | p) + (c + d)) - ((b + p) - (d & 18));
+  b = ((a * a) + (a & q)) ^ ((p + 67) - (c - c));
+  if(d < 93){
+    c = ((b - b) - (q | 85)) & ((q | 65) * (q & a));
+  }else{
+    b = ((q & b) - (b + a)) * ((p & p) ^ (b * a));
+  }
+  b = ((a * 90) & (c + c)) - ((a - b) & (q ^ b));
+  d = ((q & 24) + (q ^ b)) - ((q * q) & (d - 84));
+  for(i = 0; i < 2; i++){
+    a = ((a + a) | (c * 24)) ^ ((a * b) + (q * q));
+  }
+  b = ((d ^ b) & (c + p)) | ((q | p) & (p * a));
+  if(b < p){
+    a = ((q | p) | (q + d)) & ((a * 3) ^ (p + 14));
+  }else{
+    c = ((c ^ q) - (a - c)) - ((q + q) * (p ^ a));
+  }
+  b = ((p & c) * (p * b)) | ((c + b) & (p + 47));
+  a = ((b * q) | (b * 33)) - ((c | c) ^ (q ^ q));
+  b = ((q & 80) | (a - 20)) ^ ((q | q) * (b * 90));
+  d = ((c * 97) * (p | q)) - ((a ^ a) | (q & b));
+  if(a < c){
+    a = ((b - p) & (q * 63)) - ((b - p) & (b - d));
+  }else{
+    d = ((d ^ 83) & (b - q)) + ((p - 79) - (q & p));
+  }
+  b = ((c ^ p) + (c - q)) * ((d + p) - (d + 17));
+  c = ((a * 73) + (a + p)) - ((q + d) - (a - 19));
+  b = ((c + b) + (b & d)) ^ ((q ^ a) + (p + 59));
+  d = ((p + 20) ^ (c & a)) + ((a * 73) | (d + 41));
+  if(b < p){
+    b = ((b | a) * (d | a)) * ((a | 84) ^ (d & 90));
+  }else{
+    b = ((a ^ b) + (a ^ 11)) ^ ((a - a) | (b | b));
+  }
+  a = ((p ^ 4) & (b & 53)) + ((b & c) * (a & b));
+  for(i = 0; i < 27; i++){
+    a = ((d + 36) | (p & d)) + ((c + 63) | (d ^ b));
+  }
+  a = ((b | 80) | (c * b)) ^ ((q - d) ^ (p - a));
+  a = ((c - b) ^ (b - b)) & ((b - a) + (a + b));
+  if(c < c){
+    c = ((p & b) + (d & d)) & ((q & c) - (p | c));
+  }else{
+    b = ((q | p) - (a * 12)) ^ ((b ^ 86) & (b & p));
+  }
+  d = ((d * q) - (c ^ q)) & ((b - a) - (a ^ 73));
+  a = ((b & 47) + (a - 61)) ^ ((q | a) + (d + b));
+  c = ((d * b) + (a + 71)) | ((d & c) | (b ^ d));
+  for(i = 0; i < 38; i++){
+    c = ((b & 66) - (a + c)) + ((a | 37) | (d - 55));
+  }
+  if(d < q){
+    a = ((p + c) | (d + a)) + ((q - p) | (b - c));
+  }else{
+    b = ((c ^ 7) & (a - b)) - ((d ^ a) ^ (a & a));
+  }
+  return a + b + c + d;
+}
+
+int func105(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 54;
+  d = 28;
+  b = ((q * q) ^ (q - c)) & ((q + c) & (b - q));
+  c = ((c | a) & (a | p)) ^ ((a - 52) & (p & 46));
+  a = ((d ^ d) & (a * d)) & ((c | a) & (a - c));
+  d = ((d + 50) & (c * q)) & ((q & a) - (q * a));
+  if(d < 32){
+    c = ((c & b) & (a + 78)) * ((b + q) | (d * d));
+  }else{
+    d = ((c | d) - (a * q)) + ((q - d) | (a - b));
+  }
+  a = ((d & q) ^ (c & 78)) * ((c ^ 28) | (q + 51));
+  for(i = 0; i < 45; i++){
+    b = ((q | a) | (a - 90)) | ((c & a) ^ (q ^ c));
+  }
+  a = ((q & d) & (q | b)) ^ ((p * c) | (d * a));
+  c = ((d | q) ^ (p | d)) - ((q | d) & (b - p));
+  if(b < b){
+    d = ((c ^ d) & (c & b)) * ((p & a) * (a | 70));
+  }else{
+    a = ((c | c) * (b & q)) * ((p + 73) + (q & q));
+  }
+  d = ((q - b) | (b * b)) | ((c | d) - (b ^ 50));
+  b = ((a ^ p) ^ (c ^ c)) + ((d * p) - (p + a));
+  d = ((b & 56) & (b ^ 19)) ^ ((d + 60) & (b & c));
+  for(i = 0; i < 5; i++){
+    a = ((c & 7) & (a + 50)) - ((b - p) - (d - q));
+  }
+  if(d < c){
+    b = ((c | c) * (q ^ 82)) | ((q - q) ^ (q * d));
+  }else{
+    b = ((b | 25) * (a & q)) & ((d & d) | (p ^ q));
+  }
+  b = ((b | d) * (p * d)) | ((p | q) - (q ^ b));
+  b = ((d ^ b) - (q | p)) ^ ((p * 75) & (b * a));
+  d = ((q * d) + (p + 31)) + ((a ^ 70) - (p & c));
+  d = ((c - q) ^ (q & q)) | ((b & b) ^ (b + 33));
+  if(c < b){
+    d = ((p + 4) + (d - 42)) + ((p ^ 52) & (b & d));
+  }else{
+    b = ((d + b) | (a ^ a)) ^ ((d * 17) - (c + a));
+  }
+  for(i = 0; i < 46; i++){
+    c = ((b | b) - (a - 59)) | ((d ^ a) - (a - b));
+  }
+  d = ((c - a) | (a * b)) ^ ((a ^ b) + (q * a));
+  c = ((a ^ c) | (c & a)) & ((a | p) * (b - 83));
+  c = ((c + b) - (q - 46)) - ((d * 9) + (b + c));
+  if(a < b){
+    c = ((a | d) | (b - d)) ^ ((c * b) | (p * d));
+  }else{
+    c = ((d ^ p) ^ (q | d)) ^ ((q | p) | (b - q));
+  }
+  c = ((p ^ a) + (c - q)) * ((b | p) | (a ^ b));
+  c = ((c * p) | (d | 23)) & ((p + p) + (p * c));
+  for(i = 0; i < 28; i++){
+    b = ((d * 30) ^ (d ^ 20)) * ((d ^ 72) | (q & b));
+  }
+  a = ((q | b) ^ (p * d)) * ((p | a) | (c - p));
+  if(d < p){
+    d = ((c ^ 94) ^ (q & c)) & ((b + 92) + (b & 35));
+  }else{
+    d = ((a ^ 17) * (q | b)) ^ ((b * b) * (p ^ q));
+  }
+  c = ((b * q) * (p * b)) + ((q & q) | (p * d));
+  d = ((c | b) | (d * 84)) & ((b + 98) | (c + 41));
+  c = ((b ^ c) + (q - b)) - ((a ^ q) | (q - 10));
+  a = ((p - d) ^ (q & 93)) * ((p ^ b) | (a | 88));
+  if(b < 96){
+    c = ((d & 14) - (d * c)) * ((b | c) | (c & b));
+  }else{
+    a = ((c * c) * (c & 39)) & ((d + 15) + (d ^ 69));
+  }
+  d = ((a - c) & (q ^ q)) - ((a & p) ^ (q * c));
+  b = ((b ^ 16) ^ (q + 82)) + ((d + c) - (p | 81));
+  b = ((d + q) - (c ^ 44)) + ((p - 91) - (d | 51));
+  a = ((a * c) - (b & a)) & ((p & a) + (c - q));
+  if(a < a){
+    c = ((q * q) - (a - p)) * ((p + q) + (b | b));
+  }else{
+    b = ((q + 55) - (b * 67)) | ((b | p) * (p | b));
+  }
+  b = ((q - q) ^ (p & 43)) ^ ((d | q) & (q & 64));
+  for(i = 0; i < 20; i++){
+    c = ((b + 92) | (b * c)) ^ ((d * 64) * (b & d));
+  }
+  c = ((q - d) & (a & 23)) * ((b * 97) ^ (d - p));
+  d = ((d ^ p) + (b * 15)) + ((p - b) ^ (d ^ b));
+  if(a < q){
+    b = ((q + b) & (b - 1)) - ((d | 7) * (c | d));
+  }else{
+    a = ((q + c) & (p - d)) | ((a ^ 20) ^ (c | q));
+  }
+  c = ((b ^ 76) | (a | c)) + ((p & q) & (c & b));
+  a = ((q * b) ^ (q + 91)) + ((d | d) * (p ^ c));
+  c = ((a & b) - (b + a)) + ((b | c) & (d * 5));
+  for(i = 0; i < 5; i++){
+    d = ((c * 13) + (p | 52)) + ((a | 72) ^ (b * c));
+  }
+  if(a < 94){
+    a = ((d & a) & (c + d)) + ((q - 11) * (q | d));
+  }else{
+    d = ((d - 93) ^ (d + 45)) & ((c - b) - (b ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func106(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 69;
+  d = 38;
+  c = ((b - c) & (a + p)) | ((a | a) | (b * p));
+  a = ((p ^ c) ^ (d | q)) | ((d + a) * (p | q));
+  a = ((p | c) ^ (p | 73)) * ((d - q) & (a ^ 98));
+  c = ((q * c) + (q ^ 70)) * ((q ^ a) & (d + p));
+  if(d < p){
+    c = ((b ^ c) | (c - q)) + ((a | q) ^ (p & 87));
+  }else{
+    c = ((c | d) & (d & p)) & ((b & 99) + (p * q));
+  }
+  d = ((d ^ 79) - (q ^ 60)) - ((q - q) | (a & 7));
+  for(i = 0; i < 44; i++){
+    b = ((p & 58) * (a * a)) & ((d & c) ^ (q * d));
+  }
+  b = ((c ^ b) | (q & q)) ^ ((a - a) - (c * 16));
+  a = ((c | d) ^ (a & 9)) * ((a ^ b) ^ (q ^ p));
+  if(c < p){
+    b = ((b | 6) ^ (d & 60)) - ((a + d) & (b + 72));
+  }else{
+    d = ((c - d) ^ (b ^ a)) ^ ((d | c) & (q ^ p));
+  }
+  b = ((c | q) & (q * 76)) | ((p * a) - (d | b));
+  c = ((p + a) & (d + 66)) & ((b | c) + (c + c));
+  b = ((c ^ d) ^ (d + 73)) - ((b - c) + (c * 90));
+  for(i = 0; i < 10; i++){
+    d = ((d ^ c) + (a | c)) - ((d | d) | (q | 53));
+  }
+  if(b < d){
+    c = ((q ^ a) | (d | p)) * ((d * 17) + (d & d));
+  }else{
+    b = ((b ^ 39) | (p + c)) | ((c | q) | (d ^ a));
+  }
+  b = ((c * p) | (p ^ b)) - ((a - 89) & (c | a));
+  b = ((a - d) * (c | b)) ^ ((q ^ p) & (q | p));
+  c = ((q | b) & (c & c)) * ((q * d) + (q | b));
+  c = ((c - c) ^ (a * a)) ^ ((q | 30) + (c ^ b));
+  if(c < q){
+    d = ((d * q) & (p - 80)) + ((p * c) | (c ^ 44));
+  }else{
+    d = ((c + q) ^ (b - a)) - ((c - a) | (a - b));
+  }
+  for(i = 0; i < 23; i++){
+    c = ((b & c) * (a * c)) & ((c - d) * (a - b));
+  }
+  b = ((p + b) - (d + 71)) + ((p & 50) | (p * b));
+  d = ((b * q) * (b - c)) | ((d + c) ^ (b ^ 71));
+  d = ((q + 23) | (c + a)) ^ ((q - c) + (p + p));
+  if(d < a){
+    c = ((p | p) + (a | q)) + ((p | a) + (a - c));
+  }else{
+    a = ((p | d) - (c - d)) ^ ((p & a) | (b & a));
+  }
+  b = ((c ^ 88) & (p | d)) | ((a + b) + (b - 45));
+  a = ((d | b) * (c & 17)) + ((b + p) * (p + p));
+  for(i = 0; i < 36; i++){
+    b = ((a & d) ^ (b - d)) * ((p ^ c) + (c & 21));
+  }
+  d = ((b | c) | (a + b)) + ((p - d) & (b * 31));
+  if(b < q){
+    b = ((d + a) * (c & p)) + ((b | c) | (d - d));
+  }else{
+    d = ((d - d) - (p + 25)) - ((d - b) ^ (p + 25));
+  }
+  d = ((a * q) * (p - c)) ^ ((d ^ 94) - (b | d));
+  d = ((q * a) * (b - a)) & ((d | c) | (q & c));
+  b = ((d + p) + (c | 62)) | ((q | b) ^ (p & d));
+  d = ((b - 58) - (d & a)) - ((a & 85) + (c | a));
+  if(a < p){
+    c = ((p + p) ^ (p | 34)) * ((q + 76) + (b | 1));
+  }else{
+    c = ((q ^ d) * (b * p)) & ((q ^ c) | (a + q));
+  }
+  b = ((c & a) | (c | c)) ^ ((a | 23) * (p - q));
+  c = ((c ^ q) ^ (b - 98)) - ((d + c) + (b + q));
+  a = ((d * b) ^ (d + q)) + ((q - 18) + (p & b));
+  b = ((b ^ b) - (b ^ d)) & ((q ^ d) ^ (q + p));
+  if(a < d){
+    b = ((b ^ c) - (a | a)) * ((b - q) - (d ^ q));
+  }else{
+    a = ((d & q) - (a * c)) - ((b ^ d) + (b + 15));
+  }
+  b = ((d ^ q) * (d ^ b)) + ((d + c) ^ (a + 77));
+  for(i = 0; i < 22; i++){
+    b = ((q * q) - (b * d)) + ((c - c) | (q | b));
+  }
+  c = ((b - d) ^ (c | a)) * ((p * a) ^ (c | 5));
+  b = ((c * c) * (c + d)) | ((a * p) + (p + b));
+  if(b < p){
+    c = ((d - a) | (q - a)) & ((a + 29) + (a + 21));
+  }else{
+    b = ((b + a) & (b & c)) ^ ((p ^ a) * (b ^ 31));
+  }
+  c = ((p ^ a) - (q * b)) | ((a ^ b) ^ (c | a));
+  d = ((b ^ q) - (c | b)) & ((a ^ c) ^ (d ^ 91));
+  c = ((d * q) | (d * d)) * ((d & 79) * (p - b));
+  for(i = 0; i < 5; i++){
+    b = ((c + 20) * (p & 9)) - ((q * p) + (d * d));
+  }
+  if(d < b){
+    a = ((b ^ d) ^ (p | 12)) - ((a ^ d) | (a - a));
+  }else{
+    d = ((a - a) - (c ^ q)) & ((q - b) ^ (a + c));
+  }
+  return a + b + c + d;
+}
+
+int func107(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 51;
+  d = 87;
+  a = ((c + d) & (b - b)) ^ ((b - b) & (c - p));
+  c = ((b ^ p) & (b & p)) + ((b & 23) * (c | d));
+  d = ((b | a) * (d + a)) & ((b & q) ^ (c | d));
+  c = ((q * b) * (q | 57)) | ((q + p) + (q + c));
+  if(b < p){
+    d = ((a * p) + (d + 34)) + ((q | b) + (q + 95));
+  }else{
+    c = ((p | d) & (d | 44)) - ((c & q) ^ (b * q));
+  }
+  d = ((q + d) - (d & 72)) * ((d - c) | (d * p));
+  for(i = 0; i < 12; i++){
+    d = ((b ^ a) & (a - q)) ^ ((q + a) + (c & d));
+  }
+  c = ((b ^ b) ^ (p | b)) | ((c & q) + (a | a));
+  b = ((d & d) ^ (c | p)) - ((c - 60) + (p - 58));
+  if(d < a){
+    d = ((d + p) | (c + 94)) | ((q + d) | (p ^ d));
+  }else{
+    d = ((p | p) * (q + d)) + ((d * p) * (d & b));
+  }
+  d = ((d & p) | (b ^ c)) & ((c & b) & (q & p));
+  a = ((c & c) | (c | p)) ^ ((p ^ 31) | (d - q));
+  a = ((c | d) * (c + b)) + ((a | c) + (d ^ d));
+  for(i = 0; i < 6; i++){
+    d = ((q + a) | (a & 65)) - ((d - 11) | (p * q));
+  }
+  if(d < 47){
+    a = ((d & p) + (d - d)) + ((a & b) * (q - c));
+  }else{
+    d = ((d | c) & (p & p)) - ((a & d) + (q - d));
+  }
+  b = ((c * p) - (a ^ d)) | ((a ^ p) ^ (a - b));
+  b = ((c + d) + (d ^ 81)) & ((b - 69) ^ (a + q));
+  b = ((q & 31) & (p & a)) * ((c * d) * (b & 83));
+  a = ((a | q) - (c + p)) | ((b - b) | (a + 95));
+  if(b < q){
+    c = ((c & 91) - (c ^ 99)) * ((q * q) - (a * d));
+  }else{
+    c = ((a | 16) - (a + a)) + ((b + 77) - (a + 72));
+  }
+  for(i = 0; i < 23; i++){
+    a = ((b ^ c) + (q * c)) ^ ((a + b) | (c + a));
+  }
+  a = ((d & d) & (b | c)) & ((c * b) ^ (b + c));
+  b = ((b & b) ^ (p ^ 47)) + ((p ^ 24) - (q & 20));
+  a = ((b | p) | (p ^ 29)) + ((b - c) - (d | d));
+  if(b < q){
+    b = ((c | c) - (c + p)) + ((b + q) & (q + c));
+  }else{
+    a = ((b ^ 62) | (p | b)) | ((b ^ 59) + (q * q));
+  }
+  c = ((p ^ d) + (p * p)) - ((p * q) + (c + a));
+  c = ((p * p) + (d | c)) + ((a & q) & (q + b));
+  for(i = 0; i < 9; i++){
+    a = ((c * q) ^ (c + p)) & ((a + q) & (b + 73));
+  }
+  b = ((c | q) - (b & 80)) * ((d + 63) | (b & q));
+  if(d < p){
+    d = ((b + 47) & (q & a)) & ((d | b) + (a & p));
+  }else{
+    c = ((c & 96) | (c ^ b)) | ((a | 64) + (q | q));
+  }
+  c = ((b + c) & (p * 4)) + ((d - 21) - (q - 91));
+  c = ((p ^ p) | (q + p)) | ((d & p) + (c | b));
+  b = ((p & d) | (p | 98)) + ((p + a) + (b - 76));
+  c = ((c ^ q) * (a & p)) - ((a - b) + (p ^ q));
+  if(d < 30){
+    a = ((a - 61) ^ (q * a)) * ((p & d) + (q * 68));
+  }else{
+    a = ((d ^ b) - (d & 95)) + ((c + c) ^ (q * q));
+  }
+  d = ((b * 13) ^ (c * 49)) + ((q * a) + (c ^ c));
+  c = ((p + c) | (b | p)) | ((d & d) | (c + a));
+  c = ((q ^ c) & (b - c)) & ((a | c) - (b + q));
+  d = ((c + b) | (p - a)) | ((d * c) ^ (a & p));
+  if(b < d){
+    d = ((d - 77) & (c - d)) - ((a + 2) - (d & c));
+  }else{
+    d = ((c | a) + (a | d)) ^ ((q + q) ^ (a | a));
+  }
+  d = ((p + a) | (a * p)) & ((c - 7) + (d ^ 43));
+  for(i = 0; i < 42; i++){
+    b = ((b + p) ^ (p | b)) * ((p | c) | (d * a));
+  }
+  b = ((p + 66) - (d + p)) & ((q + b) | (c | c));
+  b = ((a ^ q) & (a ^ c)) ^ ((b * b) & (c - d));
+  if(b < b){
+    c = ((c + 6) + (d | 8)) + ((b * p) * (p & 45));
+  }else{
+    b = ((a | p) & (d | c)) * ((a & 23) ^ (c | 71));
+  }
+  d = ((p & a) + (q + q)) * ((b * p) | (q & 74));
+  a = ((b + q) | (c * d)) ^ ((a | 70) * (q * 62));
+  a = ((d - 78) * (p - 96)) ^ ((a ^ q) & (c | 78));
+  for(i = 0; i < 41; i++){
+    c = ((b & 71) | (q + b)) ^ ((p & p) & (a ^ p));
+  }
+  if(b < d){
+    d = ((d - b) | (b + b)) ^ ((c ^ c) & (c * 93));
+  }else{
+    d = ((q - b) * (c ^ b)) * ((q | p) | (d ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func108(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 31;
+  d = 99;
+  c = ((d + a) & (d * c)) + ((p * b) * (b | d));
+  d = ((b - d) - (p - 49)) & ((d + a) | (p & 69));
+  d = ((a | 98) | (a + 43)) * ((d + c) & (d ^ a));
+  c = ((a + p) - (b | q)) + ((d & 44) ^ (p ^ a));
+  if(a < d){
+    d = ((p ^ p) ^ (p - c)) * ((q ^ p) | (d & p));
+  }else{
+    c = ((c | 73) | (a + b)) ^ ((b ^ p) - (b | d));
+  }
+  a = ((b + b) | (p - d)) ^ ((c + d) ^ (p * p));
+  for(i = 0; i < 9; i++){
+    c = ((c ^ 42) | (p & q)) & ((c | b) & (q - a));
+  }
+  c = ((d & a) - (p ^ a)) - ((c - a) ^ (a ^ 51));
+  c = ((q * c) ^ (c * 47)) * ((c | b) ^ (q - d));
+  if(d < b){
+    d = ((d - 33) - (d ^ b)) & ((d - 59) - (b - 30));
+  }else{
+    c = ((p * q) | (c & b)) & ((p - b) & (c + q));
+  }
+  d = ((d ^ a) & (b - c)) + ((b - d) & (d ^ d));
+  c = ((a - 42) & (b + a)) ^ ((p | d) + (c ^ b));
+  b = ((b + 72) & (a | c)) | ((q - b) - (p * 14));
+  for(i = 0; i < 30; i++){
+    c = ((q - d) - (d - 79)) + ((c | 12) + (c ^ a));
+  }
+  if(d < a){
+    c = ((c & c) - (b - 56)) - ((a - p) | (q - c));
+  }else{
+    a = ((c + p) | (q * c)) * ((q ^ p) * (c | b));
+  }
+  b = ((b | a) + (q | c)) - ((d - d) - (q | d));
+  b = ((q * 40) | (p * q)) + ((c ^ b) * (p * p));
+  a = ((d | a) + (b ^ b)) * ((b ^ d) ^ (d | c));
+  c = ((d - b) ^ (b - b)) ^ ((c + q) + (c ^ b));
+  if(d < b){
+    a = ((p ^ a) - (d | a)) & ((c & q) + (a & q));
+  }else{
+    b = ((a & a) + (c * 12)) | ((d * q) & (p & a));
+  }
+  for(i = 0; i < 17; i++){
+    b = ((c * a) ^ (d | c)) & ((p - 14) - (q + 27));
+  }
+  c = ((p + 81) * (d * 1)) + ((b | c) * (c + q));
+  d = ((b + c) - (a | b)) | ((b - d) * (a & d));
+  c = ((a & p) ^ (p * a)) ^ ((q ^ 12) & (p * a));
+  if(d < c){
+    c = ((p + 95) | (d | b)) - ((q * d) - (c ^ 71));
+  }else{
+    c = ((c - b) - (p & d)) - ((q * p) | (q & a));
+  }
+  a = ((d * 84) & (c | 89)) | ((b + b) ^ (b & 83));
+  c = ((c * c) & (a - c)) & ((d - a) * (c ^ 87));
+  for(i = 0; i < 31; i++){
+    d = ((c + c) ^ (p * q)) ^ ((q ^ 84) | (q - p));
+  }
+  a = ((b ^ q) & (a | d)) ^ ((q & p) | (a ^ d));
+  if(d < 66){
+    a = ((p - c) | (p + p)) * ((a ^ a) - (a & a));
+  }else{
+    b = ((p - 41) * (q & b)) * ((a ^ c) + (c & q));
+  }
+  b = ((b + d) & (a & c)) + ((c & q) ^ (d & q));
+  c = ((b + 7) & (a - c)) & ((q - q) ^ (q * q));
+  d = ((a - c) & (q - p)) - ((c ^ 59) & (b & p));
+  a = ((q - q) * (d & a)) + ((b - 9) | (d | c));
+  if(c < 56){
+    c = ((p & 24) & (c | c)) ^ ((d | q) * (d - p));
+  }else{
+    b = ((a ^ 11) - (a ^ a)) + ((p ^ c) & (a ^ c));
+  }
+  b = ((c ^ d) + (b & c)) + ((q + b) * (b | c));
+  a = ((p | a) + (q ^ c)) & ((b * c) ^ (p * 40));
+  b = ((a * q) + (q | 68)) ^ ((d ^ d) - (q + a));
+  c = ((p * 53) - (q ^ 98)) ^ ((b ^ q) ^ (b + a));
+  if(d < p){
+    b = ((d * b) - (d ^ q)) + ((p + 22) - (d - 30));
+  }else{
+    c = ((a ^ a) - (p * b)) * ((p ^ 59) + (a - b));
+  }
+  b = ((b & c) - (c ^ d)) ^ ((a - 88) | (c & c));
+  for(i = 0; i < 21; i++){
+    d = ((d + q) + (p ^ p)) & ((d & 85) & (c | b));
+  }
+  d = ((d | d) + (q + c)) | ((b | b) - (b - c));
+  d = ((p & c) + (q - 44)) + ((c - c) + (a & b));
+  if(c < c){
+    d = ((c & q) + (p + 73)) - ((b ^ b) & (b | 38));
+  }else{
+    d = ((a ^ b) - (a & 82)) * ((p | p) ^ (a * q));
+  }
+  b = ((b ^ 95) | (b | a)) | ((b ^ 32) | (d | p));
+  c = ((p ^ q) * (c | p)) + ((p + 73) - (p | b));
+  d = ((b & q) | (q ^ d)) - ((c + q) + (q - d));
+  for(i = 0; i < 29; i++){
+    a = ((d + 6) ^ (p - a)) ^ ((c + b) & (p * c));
+  }
+  if(b < d){
+    a = ((b + b) - (q * 80)) * ((q - c) ^ (q ^ c));
+  }else{
+    a = ((p ^ p) ^ (c - p)) & ((p * 31) - (b * d));
+  }
+  return a + b + c + d;
+}
+
+int func109(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 90;
+  d = 98;
+  c = ((c & a) * (c ^ c)) & ((b + b) + (a + 14));
+  d = ((d ^ p) & (q ^ c)) | ((b + c) ^ (d * c));
+  a = ((d - c) - (d | b)) & ((q + 6) | (b ^ 70));
+  c = ((b & c) - (q + b)) ^ ((b ^ b) | (p - q));
+  if(d < p){
+    c = ((b * q) ^ (c * a)) ^ ((b + b) - (b + 7));
+  }else{
+    c = ((q - d) ^ (a + c)) + ((p + d) + (d * q));
+  }
+  c = ((a + q) & (b & a)) & ((p + a) ^ (q * q));
+  for(i = 0; i < 35; i++){
+    d = ((q + p) + (a * p)) * ((q - a) & (q + d));
+  }
+  a = ((a & a) | (c & 59)) - ((a - d) * (d * a));
+  b = ((q + d) | (a ^ 86)) ^ ((a & p) & (p & p));
+  if(c < a){
+    b = ((a & d) & (q | 61)) - ((a ^ b) - (b | 98));
+  }else{
+    c = ((a - q) | (a & d)) - ((c | c) + (a | b));
+  }
+  d = ((c - p) + (c ^ 37)) ^ ((c - d) * (a + c));
+  a = ((b - 18) * (a - q)) + ((q * a) & (a * p));
+  c = ((b ^ p) - (d + b)) + ((c - q) & (q | 54));
+  for(i = 0; i < 21; i++){
+    a = ((q & d) ^ (q * d)) * ((q | b) + (p - b));
+  }
+  if(c < p){
+    c = ((d * d) ^ (c ^ q)) ^ ((q * a) - (b & a));
+  }else{
+    d = ((b & 4) + (c | d)) | ((c - b) + (d ^ c));
+  }
+  b = ((a * c) & (b - d)) * ((p ^ 70) ^ (q * q));
+  c = ((d * p) * (d | b)) | ((a | a) | (c * c));
+  c = ((b * d) & (a + p)) | ((c ^ d) ^ (b & 51));
+  d = ((c * a) * (c - b)) * ((a ^ a) ^ (c - q));
+  if(a < p){
+    b = ((p ^ q) ^ (d - a)) - ((b + c) - (p * d));
+  }else{
+    a = ((p & q) ^ (q + 96)) + ((p & q) + (p + 54));
+  }
+  for(i = 0; i < 25; i++){
+    c = ((b + p) ^ (b | 99)) | ((d - b) - (d | p));
+  }
+  c = ((p | c) - (d & a)) & ((q ^ c) | (c ^ c));
+  c = ((d * p) | (b | 1)) + ((p | p) + (a - 42));
+  d = ((p | d) ^ (c ^ d)) * ((p & a) | (q + p));
+  if(b < a){
+    a = ((b ^ 68) | (q ^ b)) & ((b * 90) - (q & d));
+  }else{
+    c = ((d * 10) & (p | c)) + ((b * a) + (p + a));
+  }
+  a = ((c - 30) - (a & d)) * ((q | p) & (d - p));
+  d = ((b + 3) & (c & 1)) - ((a | p) & (b * b));
+  for(i = 0; i < 16; i++){
+    a = ((c + b) & (p + p)) | ((q | 96) + (d * 98));
+  }
+  d = ((a + 50) & (a | a)) + ((b + c) & (q & b));
+  if(c < b){
+    c = ((d & p) - (b ^ b)) & ((a - 37) - (b + d));
+  }else{
+    c = ((p * c) & (d | 21)) - ((p | d) + (b | p));
+  }
+  b = ((p | p) - (q ^ d)) - ((d + p) - (a - 89));
+  d = ((c * c) ^ (q | c)) + ((b + d) + (a | 93));
+  a = ((p - c) * (p & p)) - ((b + c) - (q + 16));
+  c = ((a | d) ^ (a * 5)) ^ ((b - c) & (q * d));
+  if(a < a){
+    a = ((c ^ q) * (q & b)) & ((c - d) | (c | c));
+  }else{
+    b = ((p | 25) + (q * q)) * ((q & b) + (p | 77));
+  }
+  a = ((a ^ c) & (a ^ d)) & ((q & d) - (a * p));
+  a = ((c & c) - (a ^ p)) + ((d ^ p) & (p ^ 44));
+  a = ((q | 76) - (a | p)) + ((b - b) * (q * q));
+  c = ((d ^ 20) ^ (d - 95)) + ((c & b) * (c - b));
+  if(a < q){
+    a = ((a - 59) ^ (c * d)) + ((d - c) - (p ^ d));
+  }else{
+    b = ((q & a) & (a + a)) | ((a - c) - (c & 10));
+  }
+  c = ((p | q) + (p - 89)) * ((a - c) - (a & d));
+  for(i = 0; i < 34; i++){
+    a = ((d & 22) ^ (d ^ c)) + ((b + c) * (c + 36));
+  }
+  d = ((p | q) | (p ^ a)) * ((a + a) | (c - b));
+  d = ((b | d) * (p * p)) - ((p | d) ^ (d | b));
+  if(c < q){
+    d = ((d & c) + (p & c)) & ((p & q) | (b * a));
+  }else{
+    a = ((c ^ p) * (a * d)) & ((c | p) | (c ^ c));
+  }
+  a = ((b * p) - (b - 85)) + ((b + q) + (b & p));
+  d = ((a | 81) + (b - c)) * ((d ^ p) & (a | b));
+  c = ((b * 80) - (c ^ d)) & ((q | c) & (q & a));
+  for(i = 0; i < 6; i++){
+    d = ((p & d) & (a * c)) * ((a ^ d) * (b + q));
+  }
+  if(b < q){
+    c = ((p * c) * (c + b)) * ((c | c) + (q - 98));
+  }else{
+    a = ((a + p) + (a - 53)) * ((b ^ p) * (d ^ 84));
+  }
+  return a + b + c + d;
+}
+
+int func110(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 6;
+  d = ((p ^ q) ^ (a + p)) & ((c | c) & (q * c));
+  a = ((a | c) - (d * 59)) & ((d - q) + (d * d));
+  c = ((b * d) * (b * 57)) & ((p * 55) ^ (p - c));
+  d = ((c ^ p) ^ (c & c)) - ((d & 44) | (p ^ b));
+  if(c < a){
+    a = ((a & p) * (p - q)) | ((c - d) + (p - 55));
+  }else{
+    b = ((a * 79) * (a - b)) * ((b & b) + (q & 39));
+  }
+  c = ((d & 31) + (a + q)) - ((c ^ d) - (c | p));
+  for(i = 0; i < 29; i++){
+    b = ((p - 86) + (c - p)) + ((b & 23) & (q | d));
+  }
+  d = ((a ^ 7) - (a * 52)) | ((a & c) + (p ^ 10));
+  c = ((p ^ 70) - (q ^ 35)) - ((a + p) & (c + c));
+  if(b < d){
+    a = ((c | 23) | (b - c)) * ((d + b) - (d ^ d));
+  }else{
+    c = ((q | 85) ^ (b - d)) + ((c - d) - (a * c));
+  }
+  a = ((a ^ p) & (p * 59)) * ((b - 9) - (c - p));
+  d = ((c - d) * (p + q)) ^ ((q + b) | (q & 42));
+  c = ((d + b) + (q | 83)) | ((c + q) * (q | a));
+  for(i = 0; i < 28; i++){
+    c = ((p - b) + (c + d)) * ((b - q) | (b ^ d));
+  }
+  if(b < q){
+    a = ((d - b) - (d + p)) ^ ((a - a) ^ (b & b));
+  }else{
+    b = ((d ^ c) - (q + c)) & ((c & q) - (p | 40));
+  }
+  b = ((c + 12) & (b ^ 67)) & ((a + d) - (a ^ 16));
+  a = ((a - 95) + (c | 10)) - ((b * q) | (q & q));
+  d = ((a ^ 77) + (p * b)) & ((d - q) * (q | p));
+  d = ((b * 94) ^ (c - q)) * ((c - c) ^ (p ^ 7));
+  if(a < c){
+    d = ((p & q) - (b - 1)) * ((p | d) ^ (q + 45));
+  }else{
+    b = ((p | d) + (c - p)) & ((p ^ c) & (d - 33));
+  }
+  for(i = 0; i < 9; i++){
+    c = ((c - p) & (d * 28)) ^ ((p ^ a) ^ (b | d));
+  }
+  a = ((q + p) * (q + b)) + ((q | q) ^ (c & c));
+  d = ((p ^ q) * (b + d)) & ((a - a) | (a * d));
+  b = ((c | a) * (q | q)) * ((d + p) | (p + p));
+  if(d < 52){
+    b = ((q & a) - (p * 70)) - ((c * p) - (c * 58));
+  }else{
+    c = ((d - q) + (c + c)) * ((c | q) + (q * d));
+  }
+  b = ((c & a) - (q | 22)) & ((b | b) - (b - 29));
+  d = ((c - p) - (c * a)) | ((q - d) & (q & d));
+  for(i = 0; i < 7; i++){
+    b = ((p * 56) | (b & p)) * ((b - q) ^ (p * a));
+  }
+  a = ((q & p) - (c + 59)) & ((d + p) | (a ^ p));
+  if(a < q){
+    d = ((q ^ b) | (q ^ 31)) + ((q ^ c) & (a + d));
+  }else{
+    b = ((q * p) - (p - 18)) | ((c * p) | (d ^ b));
+  }
+  d = ((b ^ c) | (d - 96)) - ((c * 11) * (d - 4));
+  b = ((d + q) + (b - 19)) & ((a & 82) & (c & 43));
+  d = ((c - c) | (q + p)) - ((q + 33) | (d & c));
+  a = ((a * b) | (q | 61)) - ((a * 83) * (b * q));
+  if(b < q){
+    c = ((a & a) | (a | d)) - ((a + q) | (p | a));
+  }else{
+    a = ((q ^ c) ^ (d & b)) | ((p ^ 45) ^ (d + a));
+  }
+  b = ((a ^ b) | (a - d)) + ((d & p) - (a & q));
+  b = ((d ^ 21) | (p * b)) + ((d ^ p) | (b ^ p));
+  d = ((q + q) | (d & p)) ^ ((a | q) & (c & d));
+  c = ((d & b) ^ (p + d)) + ((q - c) + (b + 33));
+  if(d < 92){
+    a = ((d & 47) - (a * c)) | ((c | q) + (b - b));
+  }else{
+    b = ((d + b) | (p ^ 80)) * ((a ^ b) & (p - p));
+  }
+  b = ((q & d) & (p & c)) - ((p * d) * (d - 26));
+  for(i = 0; i < 39; i++){
+    c = ((c | c) - (p | q)) | ((q & p) & (b & 84));
+  }
+  d = ((q | b) & (b * 55)) ^ ((d & b) + (b + a));
+  c = ((d ^ c) - (p * c)) | ((a - 36) & (d | a));
+  if(a < b){
+    b = ((p | a) - (b & b)) + ((d | a) ^ (c - b));
+  }else{
+    c = ((q | p) * (q ^ 7)) & ((c ^ b) & (a + d));
+  }
+  c = ((p ^ b) - (b & b)) & ((c ^ d) | (a - 62));
+  d = ((q | q) & (b ^ c)) ^ ((d & b) | (p * p));
+  a = ((p | 95) | (a ^ b)) & ((a | d) | (p * 99));
+  for(i = 0; i < 14; i++){
+    b = ((q + 61) + (d * p)) - ((c | c) & (b | d));
+  }
+  if(b < c){
+    c = ((d ^ b) ^ (d * c)) + ((d * q) - (q + c));
+  }else{
+    a = ((p - 18) * (d & p)) * ((a & c) | (b * q));
+  }
+  return a + b + c + d;
+}
+
+int func111(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 71;
+  d = ((c | c) * (p & q)) * ((c * a) & (d - q));
+  d = ((b & d) ^ (a ^ p)) * ((q - c) * (p + 89));
+  a = ((c | 70) ^ (d * d)) - ((q & a) | (p | 76));
+  d = ((c | a) | (q * 57)) | ((a * q) & (d + d));
+  if(c < 79){
+    d = ((p | p) ^ (b + 19)) & ((p & 54) & (q * p));
+  }else{
+    a = ((c | p) & (c & 12)) - ((a + p) * (p & c));
+  }
+  b = ((a ^ a) ^ (q + a)) | ((p & c) | (c | p));
+  for(i = 0; i < 7; i++){
+    d = ((b + q) & (c ^ q)) + ((b | 51) - (a | p));
+  }
+  c = ((b - 29) ^ (p ^ 94)) + ((b ^ p) * (c ^ a));
+  a = ((c - a) + (p & q)) * ((p ^ b) ^ (b | 40));
+  if(b < c){
+    b = ((a * a) ^ (p + a)) * ((q | b) * (d ^ 3));
+  }else{
+    c = ((b + d) & (c & a)) - ((d + p) + (d - 61));
+  }
+  b = ((q + a) - (a | b)) * ((p - c) - (c * p));
+  a = ((d & c) + (b ^ q)) * ((p - b) & (c * p));
+  a = ((c ^ a) - (d & a)) & ((a | b) - (c & 35));
+  for(i = 0; i < 28; i++){
+    c = ((p & q) - (d - c)) | ((c * q) ^ (c * b));
+  }
+  if(a < q){
+    c = ((d + 66) * (d * b)) * ((b + d) | (p ^ c));
+  }else{
+    a = ((c + 70) ^ (p * 82)) + ((a ^ c) & (d ^ p));
+  }
+  c = ((a * 58) ^ (d + a)) + ((c & d) - (q + d));
+  b = ((b | d) & (p & d)) & ((p ^ a) * (b ^ c));
+  a = ((d - q) & (a - q)) | ((p - 15) ^ (b * d));
+  a = ((d + a) - (p & 15)) + ((a & 40) | (d - b));
+  if(c < q){
+    d = ((a - q) | (d & a)) | ((p & d) | (d | p));
+  }else{
+    a = ((d | 39) & (b | p)) - ((d & 19) * (a * p));
+  }
+  for(i = 0; i < 9; i++){
+    b = ((q & b) & (a + b)) * ((b - d) - (a & a));
+  }
+  c = ((q - c) * (p & q)) | ((a - d) | (b & 12));
+  d = ((p ^ q) - (d + 77)) + ((d - a) - (c + 14));
+  d = ((a | p) ^ (a - 48)) | ((c + a) * (b & p));
+  if(b < c){
+    c = ((p & 72) + (p - 4)) & ((p ^ c) ^ (c - 42));
+  }else{
+    c = ((p ^ b) * (a & d)) ^ ((c ^ 22) & (p | b));
+  }
+  b = ((q ^ a) + (q | p)) + ((b ^ c) ^ (b & 46));
+  b = ((d * 45) ^ (a ^ d)) + ((d * c) | (a * d));
+  for(i = 0; i < 50; i++){
+    a = ((a + q) ^ (p - p)) & ((a - d) | (a * p));
+  }
+  b = ((c + 16) | (p + q)) * ((a * a) - (a | d));
+  if(b < a){
+    d = ((p ^ 30) + (b | q)) * ((p | b) ^ (d - p));
+  }else{
+    c = ((c + q) + (c | q)) | ((a & p) * (a - c));
+  }
+  d = ((d ^ c) * (a * p)) | ((a * b) * (q ^ b));
+  a = ((q + q) | (q * q)) - ((q | a) + (d | b));
+  b = ((b & p) ^ (a & p)) * ((q ^ 36) + (p + c));
+  b = ((d - c) & (a - q)) - ((q * 25) | (q - 89));
+  if(a < 1){
+    c = ((c | b) | (b & 41)) & ((d | a) - (a + p));
+  }else{
+    a = ((d ^ q) * (d ^ d)) ^ ((d & b) + (q + c));
+  }
+  a = ((c & q) + (a & 81)) + ((a ^ d) & (b ^ d));
+  a = ((a ^ 92) ^ (c - a)) + ((b & a) & (d & q));
+  a = ((c - p) - (b & p)) - ((a | q) + (a * c));
+  d = ((q & d) - (c & d)) - ((q | a) | (p + p));
+  if(c < b){
+    b = ((a + c) - (a + d)) + ((d | a) ^ (b * q));
+  }else{
+    d = ((d & b) + (p + c)) - ((b * 64) - (d * q));
+  }
+  b = ((d * 15) | (b & a)) - ((b * 86) - (c * c));
+  for(i = 0; i < 43; i++){
+    b = ((c | p) ^ (c & 84)) * ((a + c) * (a * d));
+  }
+  d = ((d * 62) & (p + q)) | ((b + 31) - (d | a));
+  a = ((q | b) - (b & d)) - ((p + 1) & (c ^ 88));
+  if(b < 98){
+    a = ((b ^ d) ^ (b | c)) + ((p ^ q) | (a + a));
+  }else{
+    b = ((c * d) * (a + 61)) ^ ((p + d) ^ (a + c));
+  }
+  d = ((q & a) | (b & d)) * ((d - b) - (p - 32));
+  d = ((d + 55) + (a - q)) | ((q & a) ^ (p & p));
+  c = ((d - 61) | (d + 44)) | ((a | c) | (p + a));
+  for(i = 0; i < 23; i++){
+    d = ((d - a) ^ (p + p)) ^ ((b | b) + (q * b));
+  }
+  if(d < q){
+    a = ((a + 77) & (b * c)) + ((a & p) & (p & p));
+  }else{
+    c = ((q * d) | (q | c)) ^ ((b | q) - (c ^ 77));
+  }
+  return a + b + c + d;
+}
+
+int func112(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 21;
+  d = ((a | q) - (b + c)) + ((a - d) & (d + q));
+  c = ((a + b) ^ (b - b)) ^ ((q & d) * (c ^ a));
+  a = ((p * a) ^ (d ^ 35)) * ((b - b) | (d * c));
+  b = ((b ^ q) - (d + a)) - ((d ^ 4) + (q ^ c));
+  if(c < d){
+    b = ((p ^ d) | (b ^ a)) & ((c & p) & (d ^ p));
+  }else{
+    c = ((q * p) - (c | c)) | ((d - p) | (c & 39));
+  }
+  c = ((p - d) ^ (p & b)) & ((p & c) + (a & p));
+  for(i = 0; i < 37; i++){
+    a = ((c - p) * (d * b)) + ((p * q) & (c * 61));
+  }
+  b = ((a * b) | (p & 93)) + ((b - q) + (p - p));
+  d = ((a * c) | (c ^ 67)) - ((c + q) * (c - b));
+  if(b < c){
+    d = ((d ^ 28) * (b | 20)) - ((p | 65) - (a ^ 3));
+  }else{
+    a = ((q & p) & (d - b)) | ((q & c) | (a & 82));
+  }
+  c = ((p - b) ^ (p - q)) & ((a | b) - (a - a));
+  a = ((b & c) * (p + q)) - ((q - d) + (a | d));
+  d = ((d & b) + (q + q)) - ((q ^ p) * (p ^ d));
+  for(i = 0; i < 40; i++){
+    a = ((c ^ c) ^ (q ^ q)) * ((q - 20) | (a & c));
+  }
+  if(a < b){
+    a = ((c & c) + (c + 90)) - ((c & 64) ^ (q | 38));
+  }else{
+    a = ((d & b) * (d & 94)) + ((d | q) & (q - 20));
+  }
+  c = ((c | a) + (q | c)) - ((c + 16) | (q & a));
+  a = ((q & b) * (b | q)) & ((a ^ c) | (d ^ d));
+  d = ((a ^ a) | (c | c)) - ((b - q) | (p + a));
+  b = ((b + c) | (p - b)) - ((d | q) & (b & a));
+  if(c < 55){
+    b = ((d & a) - (c - q)) | ((b | 35) & (d * c));
+  }else{
+    d = ((a - p) | (q + q)) ^ ((p ^ d) | (b | d));
+  }
+  for(i = 0; i < 5; i++){
+    c = ((d * b) + (b ^ q)) ^ ((b | q) & (b - c));
+  }
+  d = ((p - 75) | (d | d)) - ((a ^ 37) ^ (p * p));
+  b = ((d + 83) & (c * b)) ^ ((d ^ b) - (q + d));
+  d = ((q - d) * (q | q)) ^ ((p + 56) + (c - p));
+  if(c < 17){
+    c = ((d - 50) - (q * p)) * ((d + d) * (c + 18));
+  }else{
+    c = ((c ^ c) ^ (a | p)) ^ ((q | d) + (a | d));
+  }
+  b = ((d - d) + (c ^ b)) ^ ((d + p) + (d * q));
+  b = ((b ^ d) & (a - c)) - ((d * 58) | (c ^ d));
+  for(i = 0; i < 41; i++){
+    c = ((b * d) & (a + b)) ^ ((a - a) * (c | 58));
+  }
+  b = ((a - c) ^ (a - d)) | ((q & b) * (p ^ b));
+  if(b < 69){
+    d = ((c + q) ^ (a + d)) | ((p ^ p) ^ (q ^ b));
+  }else{
+    c = ((a + c) + (c + 34)) & ((q + p) & (b + c));
+  }
+  b = ((d * a) * (q + a)) | ((b & c) | (p + d));
+  a = ((b - d) * (b & c)) - ((a - p) & (b + c));
+  d = ((b + 94) + (a | a)) + ((p - d) & (q * p));
+  c = ((p * q) + (d ^ a)) - ((d + q) & (d * 50));
+  if(a < 69){
+    d = ((b + 18) & (a * d)) - ((c | q) + (d + q));
+  }else{
+    a = ((q ^ b) & (c - q)) - ((d - 46) & (p - p));
+  }
+  c = ((d * 40) ^ (a & c)) & ((p - a) ^ (a - p));
+  c = ((c | b) * (c * 62)) * ((a - 45) & (q + a));
+  a = ((p - 94) + (p - p)) | ((a ^ p) ^ (d | 35));
+  b = ((c | c) ^ (a * d)) | ((d + 79) & (p * q));
+  if(b < b){
+    c = ((q - p) ^ (a * d)) ^ ((p | b) * (q * c));
+  }else{
+    b = ((a ^ 78) & (d | q)) - ((d * q) * (q + a));
+  }
+  a = ((q ^ 16) - (d - b)) & ((d * a) * (q | q));
+  for(i = 0; i < 37; i++){
+    a = ((d - a) | (q - 82)) ^ ((b ^ p) & (a | p));
+  }
+  c = ((b + c) * (p - 80)) | ((b - 51) + (p * 36));
+  a = ((q * 62) + (p | c)) + ((c & b) + (c & c));
+  if(c < b){
+    b = ((a * c) ^ (q & b)) & ((c - p) | (a * 3));
+  }else{
+    b = ((d ^ c) | (p & c)) + ((p ^ c) * (a - c));
+  }
+  a = ((d * d) & (a | b)) + ((a & a) ^ (d + p));
+  b = ((p | q) | (q + p)) + ((p ^ b) ^ (p * 93));
+  a = ((d ^ c) | (b * a)) & ((b + b) - (p & p));
+  for(i = 0; i < 38; i++){
+    b = ((p + 33) | (c - 53)) ^ ((q ^ 19) | (p | c));
+  }
+  if(c < q){
+    c = ((a | c) - (b - a)) ^ ((a ^ b) ^ (a ^ p));
+  }else{
+    c = ((b ^ a) + (a ^ 81)) ^ ((c & 61) * (q ^ 52));
+  }
+  return a + b + c + d;
+}
+
+int func113(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 54;
+  d = 1;
+  d = ((d + a) + (d ^ c)) ^ ((p | 69) ^ (q ^ 93));
+  b = ((a * c) + (p ^ c)) | ((q - a) & (a & c));
+  d = ((q + 97) * (q & 99)) - ((q ^ a) * (d - d));
+  d = ((p * d) + (q & c)) | ((p * p) ^ (c + p));
+  if(d < q){
+    c = ((b | p) - (b + a)) * ((c & c) * (p & d));
+  }else{
+    d = ((b - p) + (q * 84)) * ((q * 63) | (p | 85));
+  }
+  c = ((d - a) ^ (p - c)) + ((p ^ a) | (q ^ a));
+  for(i = 0; i < 7; i++){
+    a = ((d + a) | (q + d)) ^ ((d + q) ^ (c & 24));
+  }
+  a = ((a & q) + (q & a)) & ((p ^ p) - (d - a));
+  c = ((c * a) | (a & 95)) + ((d * q) + (d | b));
+  if(d < 62){
+    a = ((d + 18) ^ (c - p)) + ((b & d) - (d * p));
+  }else{
+    c = ((q & 1) - (a * a)) * ((b ^ 41) + (c * d));
+  }
+  c = ((p ^ p) | (d & p)) * ((p & q) + (p ^ p));
+  c = ((d * c) ^ (q - p)) - ((c ^ b) * (d | 58));
+  a = ((b + a) + (d ^ d)) + ((c * p) - (c | c));
+  for(i = 0; i < 12; i++){
+    d = ((a + a) | (p + p)) ^ ((p | 26) ^ (p + q));
+  }
+  if(b < 37){
+    c = ((d * d) | (a - p)) ^ ((b & q) + (q & 8));
+  }else{
+    a = ((p + 14) & (b * b)) - ((d * 12) ^ (c - q));
+  }
+  b = ((a ^ 78) & (q & b)) * ((c - d) ^ (c * c));
+  a = ((a + 26) + (q + 16)) * ((d * p) ^ (a * 21));
+  b = ((b & q) * (c + b)) & ((b - b) + (q * d));
+  d = ((p | b) ^ (b | d)) ^ ((c - 28) - (p + d));
+  if(d < 63){
+    c = ((a & d) ^ (p & c)) | ((c & p) * (d + d));
+  }else{
+    b = ((d - b) ^ (p * d)) & ((d - 19) - (c | b));
+  }
+  for(i = 0; i < 38; i++){
+    a = ((q - b) + (b & q)) * ((p | a) + (b ^ q));
+  }
+  a = ((b - d) - (d ^ q)) + ((a * a) & (p - c));
+  b = ((d * a) - (a ^ q)) | ((c ^ d) + (q & 58));
+  b = ((p | b) | (d & q)) & ((d & p) & (b * 13));
+  if(d < b){
+    b = ((q + p) - (q | c)) + ((p * c) | (c * 92));
+  }else{
+    b = ((q | p) ^ (p - p)) - ((b + p) | (q | d));
+  }
+  d = ((d & d) * (p + q)) & ((q * d) & (a & d));
+  c = ((c - d) & (d & c)) & ((c | a) ^ (d | 5));
+  for(i = 0; i < 46; i++){
+    a = ((p | a) & (a + c)) - ((c | 9) - (p * p));
+  }
+  c = ((b | 33) - (a * a)) - ((b & b) + (q + 63));
+  if(a < b){
+    a = ((c - 11) + (q - 34)) | ((p & a) + (a + c));
+  }else{
+    c = ((a & p) | (c - a)) | ((q - b) & (c ^ q));
+  }
+  d = ((d | q) | (a | a)) + ((a - 90) ^ (c * 72));
+  c = ((a - p) | (d ^ a)) & ((d - a) * (c * d));
+  a = ((a + b) ^ (p ^ q)) * ((d + a) - (c | c));
+  b = ((p & q) + (d | 70)) | ((b + q) ^ (b - d));
+  if(d < d){
+    b = ((c | 8) - (d + c)) ^ ((c | b) | (d * 49));
+  }else{
+    a = ((b & 76) | (b + q)) ^ ((b ^ c) * (c + a));
+  }
+  c = ((d | 25) - (c * c)) | ((b | 67) + (q | a));
+  c = ((c - c) * (c & p)) * ((a - a) ^ (b ^ c));
+  d = ((d & p) | (d | q)) ^ ((d - b) ^ (a - 2));
+  d = ((b - d) & (b | a)) + ((b - 46) - (d - p));
+  if(a < 8){
+    a = ((d & 46) * (b ^ c)) + ((b - a) * (c | 36));
+  }else{
+    c = ((q & d) + (q | p)) | ((c | p) + (p * c));
+  }
+  a = ((b - c) ^ (d ^ 54)) * ((p - d) & (q & a));
+  for(i = 0; i < 21; i++){
+    c = ((a + b) & (q & b)) + ((c ^ q) & (d + 49));
+  }
+  d = ((a ^ a) * (p + b)) - ((d ^ 64) * (c - c));
+  c = ((a * q) & (p + c)) & ((q - a) * (d ^ c));
+  if(a < q){
+    d = ((b - b) + (q ^ 93)) | ((p | d) - (b - 14));
+  }else{
+    a = ((a * d) * (d ^ c)) & ((p ^ 89) - (d & q));
+  }
+  c = ((p | p) | (q & b)) - ((d ^ 99) | (c * b));
+  b = ((c ^ p) * (a * a)) - ((b * b) & (a + a));
+  b = ((b ^ a) * (q ^ 26)) * ((a + 15) & (p - 55));
+  for(i = 0; i < 27; i++){
+    a = ((q | d) + (d ^ p)) * ((p | a) * (b * c));
+  }
+  if(b < q){
+    c = ((d & b) * (a | p)) - ((d | b) - (c | p));
+  }else{
+    d = ((c ^ d) & (p & a)) & ((q + q) ^ (q - p));
+  }
+  return a + b + c + d;
+}
+
+int func114(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 3;
+  d = 70;
+  b = ((q + d) + (d + 69)) | ((c + 31) + (b & q));
+  d = ((b | p) * (p + c)) + ((p - a) - (c * q));
+  b = ((b | a) ^ (d - d)) + ((b * c) & (a - q));
+  a = ((p * d) | (q | p)) & ((p & a) ^ (a & p));
+  if(b < q){
+    d = ((c + p) + (c - q)) - ((c | 36) * (a & p));
+  }else{
+    b = ((p ^ 87) ^ (d | b)) * ((q * d) & (c - 31));
+  }
+  a = ((p ^ p) + (q ^ p)) + ((a | b) & (q | b));
+  for(i = 0; i < 40; i++){
+    b = ((d & b) & (c + b)) | ((d - b) * (q & q));
+  }
+  b = ((p | 54) + (q | a)) ^ ((p - a) | (b * c));
+  a = ((d | 1) + (b & q)) + ((q & c) * (b & c));
+  if(d < q){
+    c = ((c | d) * (p ^ q)) - ((p * q) + (b * 10));
+  }else{
+    a = ((d - 39) - (p ^ 99)) - ((d * q) + (q | a));
+  }
+  c = ((p + c) | (c & 88)) - ((d & 11) * (a & 94));
+  a = ((q | q) & (q | a)) ^ ((c - d) + (q + c));
+  c = ((c + d) - (b ^ a)) - ((p + p) * (q + a));
+  for(i = 0; i < 12; i++){
+    a = ((a * 27) | (c & a)) - ((q + p) & (b * 28));
+  }
+  if(d < b){
+    a = ((b & d) ^ (c * a)) * ((b + b) | (d - p));
+  }else{
+    d = ((d | 65) | (q - b)) - ((c * d) ^ (p * c));
+  }
+  c = ((d | 26) + (d ^ d)) * ((p * c) + (q & p));
+  d = ((d - p) & (a | p)) | ((q + p) + (p ^ d));
+  b = ((c * p) + (b - p)) ^ ((d * 45) - (p ^ 62));
+  c = ((c - p) - (a ^ b)) - ((c + d) ^ (p + 95));
+  if(c < b){
+    b = ((c + 4) - (b & p)) + ((p & q) ^ (q | p));
+  }else{
+    a = ((q * 43) * (p ^ c)) | ((p ^ q) + (c & 14));
+  }
+  for(i = 0; i < 34; i++){
+    d = ((b & c) & (a ^ b)) & ((p | 77) - (a * a));
+  }
+  b = ((d & a) & (a - 29)) & ((p & d) * (p - a));
+  d = ((b + 47) & (d * 31)) * ((d & a) & (p ^ d));
+  b = ((a & a) & (b & q)) + ((b ^ c) * (b + q));
+  if(d < a){
+    c = ((c ^ 66) - (p ^ a)) - ((b | 31) * (c - c));
+  }else{
+    c = ((d + 22) & (c * q)) * ((b + q) | (b * 34));
+  }
+  c = ((a + d) ^ (c ^ q)) | ((d * a) * (b - 30));
+  d = ((d & d) * (d * b)) & ((b - q) - (p * 47));
+  for(i = 0; i < 32; i++){
+    d = ((p ^ p) * (a & 51)) ^ ((a * d) & (b * 15));
+  }
+  a = ((p * 83) + (q * c)) + ((d & b) | (q * q));
+  if(a < 87){
+    a = ((d * d) | (c | d)) - ((d & 8) | (b + 41));
+  }else{
+    a = ((b + d) ^ (b - b)) & ((p + p) ^ (q * p));
+  }
+  c = ((a + p) | (d * d)) - ((p + 98) ^ (b & c));
+  c = ((d - d) & (b * 65)) | ((c - q) | (q & 50));
+  b = ((a - d) | (c | 57)) - ((d & 59) & (a | q));
+  d = ((d * 38) * (a - 43)) - ((c & q) | (b + 13));
+  if(d < 8){
+    d = ((c * 59) - (d | 7)) * ((c ^ b) + (c | 89));
+  }else{
+    b = ((q * 99) ^ (d | c)) ^ ((q + q) & (a & q));
+  }
+  b = ((b + 24) - (c + a)) - ((p * q) * (q * d));
+  d = ((c + p) & (b | q)) * ((q & 71) ^ (a - p));
+  a = ((d + a) | (q * b)) + ((c * d) + (c | q));
+  d = ((b + a) - (p - 90)) - ((b ^ 38) + (b + b));
+  if(b < a){
+    b = ((d ^ a) ^ (q + b)) ^ ((p & p) + (c * a));
+  }else{
+    d = ((q * a) ^ (q + 47)) ^ ((q | 18) | (a - 39));
+  }
+  b = ((p * b) * (p | b)) + ((c ^ a) | (q * c));
+  for(i = 0; i < 4; i++){
+    b = ((d & 59) & (d - 34)) + ((a & q) ^ (q ^ a));
+  }
+  a = ((p * 79) & (b & b)) - ((q - c) * (b - d));
+  b = ((q | 62) | (c ^ b)) - ((b & q) | (p ^ a));
+  if(b < 75){
+    b = ((p | d) | (b | 7)) ^ ((p - c) - (q ^ 91));
+  }else{
+    c = ((p | b) & (c + p)) - ((q ^ d) + (c * q));
+  }
+  d = ((c * c) & (c * a)) | ((d - b) * (d - q));
+  c = ((q & c) * (b * 80)) & ((p | 4) * (b ^ b));
+  d = ((b & b) | (q - p)) - ((d * p) ^ (q * d));
+  for(i = 0; i < 7; i++){
+    c = ((d - a) + (d - 18)) * ((a | d) + (q & 63));
+  }
+  if(d < 54){
+    a = ((b + b) - (q & b)) & ((q + c) & (p * c));
+  }else{
+    a = ((d | d) - (a * b)) * ((d | c) + (b - c));
+  }
+  return a + b + c + d;
+}
+
+int func115(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 65;
+  d = 99;
+  a = ((q ^ b) + (a & q)) ^ ((c + d) & (q * p));
+  a = ((p & b) & (p - p)) & ((d + a) | (b | b));
+  b = ((b * q) ^ (a * a)) * ((b + a) ^ (b & 21));
+  d = ((a + a) ^ (d * q)) - ((a ^ p) * (q - c));
+  if(d < 44){
+    d = ((q + b) - (p ^ 93)) * ((p - q) - (q * p));
+  }else{
+    b = ((c & d) & (b * 55)) & ((q * d) & (p - q));
+  }
+  a = ((c ^ c) | (p - a)) + ((d & a) & (p ^ c));
+  for(i = 0; i < 26; i++){
+    d = ((p & a) - (q * a)) ^ ((b + 23) * (a - 97));
+  }
+  c = ((p & p) ^ (q ^ c)) ^ ((p * c) + (c + p));
+  c = ((d & c) * (p + c)) + ((b + 11) ^ (q | 20));
+  if(b < q){
+    a = ((b | 46) * (c * a)) ^ ((d & 47) ^ (a | a));
+  }else{
+    c = ((p & 24) - (b | d)) ^ ((c | 4) * (c ^ q));
+  }
+  b = ((p + q) + (d ^ q)) & ((b & 54) ^ (c | d));
+  b = ((p - d) * (c | d)) * ((p ^ b) & (c | 32));
+  a = ((b ^ a) | (a ^ 8)) ^ ((q + c) | (c - a));
+  for(i = 0; i < 39; i++){
+    d = ((a & 39) - (p & b)) | ((c ^ a) + (d + c));
+  }
+  if(b < 52){
+    d = ((d + p) | (c + d)) + ((q * 24) | (q ^ c));
+  }else{
+    d = ((d + b) ^ (b + a)) & ((p | b) | (p + b));
+  }
+  d = ((b + q) * (q ^ d)) + ((a ^ c) * (c + q));
+  d = ((d * 20) | (d & 74)) + ((p | c) | (a ^ 17));
+  d = ((d & q) | (d & b)) * ((p | 46) & (c - d));
+  a = ((d & d) ^ (d + 38)) - ((q | q) + (d | d));
+  if(b < q){
+    d = ((a - q) ^ (b * q)) & ((a ^ b) + (q & c));
+  }else{
+    a = ((c ^ a) ^ (p + d)) & ((b | q) + (q & 49));
+  }
+  for(i = 0; i < 6; i++){
+    b = ((c * q) | (p - 50)) | ((q * q) * (q ^ b));
+  }
+  c = ((b | q) * (a + 34)) + ((a * a) & (q * d));
+  c = ((c - c) | (a * d)) & ((q | b) + (b | 34));
+  a = ((a * b) - (p | 28)) ^ ((a & d) * (q & d));
+  if(b < d){
+    c = ((c & b) ^ (d | q)) + ((a ^ a) ^ (b ^ b));
+  }else{
+    d = ((p * p) ^ (p ^ a)) - ((q - 19) - (q * d));
+  }
+  a = ((b | d) & (p | b)) * ((c | p) - (c + a));
+  d = ((q * q) & (p ^ q)) | ((b | d) - (a | a));
+  for(i = 0; i < 9; i++){
+    a = ((a & c) ^ (q | p)) - ((a | p) - (p ^ 70));
+  }
+  c = ((a * b) ^ (p - c)) & ((q ^ q) | (a * p));
+  if(a < d){
+    d = ((b ^ d) * (d & a)) - ((a | q) + (p - c));
+  }else{
+    d = ((a + 46) * (q | d)) + ((b * b) | (b ^ p));
+  }
+  b = ((p * 87) ^ (c & b)) & ((b | a) - (q + q));
+  a = ((p + p) + (p + q)) - ((d ^ q) & (q - b));
+  a = ((p & b) + (d - b)) | ((b * 82) - (p | d));
+  a = ((d + a) + (q | 67)) & ((b | p) ^ (c + b));
+  if(d < a){
+    a = ((q | d) + (d | p)) - ((a - d) - (p | b));
+  }else{
+    b = ((b - p) & (b ^ d)) + ((p * 73) ^ (c ^ 8));
+  }
+  a = ((d - 9) ^ (q - 57)) | ((d - p) - (d * p));
+  d = ((d | 19) + (c ^ b)) | ((d - d) ^ (b + a));
+  a = ((p * p) | (p - 13)) * ((p + b) - (c & a));
+  d = ((c - q) - (b ^ 35)) * ((d - 46) & (a | p));
+  if(d < b){
+    c = ((b & a) & (a - p)) + ((b + q) ^ (b - c));
+  }else{
+    d = ((c - p) ^ (c + p)) & ((d | 78) | (d | 33));
+  }
+  d = ((q - 93) ^ (d ^ d)) * ((p ^ q) - (a + 12));
+  for(i = 0; i < 34; i++){
+    a = ((p - q) * (q & a)) * ((p ^ 87) - (a + a));
+  }
+  a = ((d * 21) | (b - p)) ^ ((p | a) - (c - 53));
+  b = ((d & 86) & (a + p)) ^ ((q + q) + (q - a));
+  if(d < p){
+    a = ((d * q) & (d + 83)) & ((b & d) ^ (d | 71));
+  }else{
+    a = ((b - 5) - (q + d)) & ((c & b) ^ (b ^ b));
+  }
+  b = ((d + p) ^ (b ^ b)) + ((a | p) ^ (q * 40));
+  c = ((p + 70) | (c & 62)) - ((c + q) & (c - 17));
+  c = ((p & a) ^ (d - 53)) ^ ((d | p) + (q | p));
+  for(i = 0; i < 4; i++){
+    c = ((q * 56) - (c ^ c)) ^ ((d - b) * (b | p));
+  }
+  if(c < b){
+    c = ((q * b) * (d * d)) * ((a * q) & (c + 62));
+  }else{
+    c = ((b * c) | (d + q)) | ((d - b) * (a | 42));
+  }
+  return a + b + c + d;
+}
+
+int func116(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 61;
+  d = 80;
+  b = ((c & q) - (a & b)) * ((b & p) & (a - a));
+  c = ((p & 71) - (a ^ 6)) & ((p | a) ^ (c & d));
+  c = ((b * d) - (d * b)) - ((a * 75) ^ (d * c));
+  c = ((q | b) | (c | p)) & ((p - d) - (q | 34));
+  if(d < q){
+    c = ((c ^ 60) - (c * q)) * ((c + p) ^ (q | 57));
+  }else{
+    a = ((q - b) * (p * d)) + ((b & c) ^ (p ^ p));
+  }
+  b = ((p - 1) & (d - c)) * ((c & a) ^ (c ^ 75));
+  for(i = 0; i < 37; i++){
+    d = ((d & c) - (a - 45)) - ((a | 17) | (a ^ c));
+  }
+  b = ((q | b) | (p & 30)) & ((d & c) + (b & c));
+  a = ((c & b) + (b ^ a)) | ((p ^ b) + (p & a));
+  if(d < q){
+    a = ((q | d) | (d * 35)) ^ ((p - b) + (a + 85));
+  }else{
+    b = ((d - a) ^ (d ^ a)) ^ ((q & a) | (b * a));
+  }
+  d = ((d ^ c) | (d + 70)) & ((a + d) & (b | 20));
+  d = ((a & d) - (p ^ p)) ^ ((p + q) * (b - 39));
+  c = ((a | q) * (c + a)) | ((a ^ d) ^ (d | c));
+  for(i = 0; i < 24; i++){
+    d = ((q * a) | (q + 88)) & ((c - b) * (q + p));
+  }
+  if(c < p){
+    c = ((a | a) + (d * 13)) * ((b + 44) - (c ^ 97));
+  }else{
+    b = ((b * b) ^ (c | 91)) & ((p - d) ^ (c | d));
+  }
+  b = ((b & 79) + (a + b)) ^ ((c + p) | (q + p));
+  a = ((a ^ 42) | (a * d)) & ((p + a) & (c & c));
+  b = ((p ^ a) & (b ^ a)) + ((b - d) + (a | q));
+  d = ((d ^ a) - (q & d)) + ((q * c) ^ (q - 46));
+  if(b < 27){
+    c = ((q ^ 94) + (d & 35)) - ((d * 91) * (b ^ c));
+  }else{
+    b = ((b - c) | (b & p)) ^ ((p + 97) | (a + d));
+  }
+  for(i = 0; i < 6; i++){
+    c = ((b ^ 73) * (d & d)) + ((q + b) * (q - a));
+  }
+  c = ((q - 22) | (p * p)) * ((q - c) * (b * d));
+  c = ((q + 21) * (c - 7)) * ((b ^ 90) + (d ^ c));
+  d = ((q | q) & (q + p)) ^ ((a ^ q) * (c | q));
+  if(a < q){
+    a = ((a | b) * (p - a)) * ((d + b) | (q & 21));
+  }else{
+    a = ((p & 7) - (c | q)) + ((q ^ p) | (a + 41));
+  }
+  a = ((q & q) | (d | 68)) + ((a * c) + (c | a));
+  b = ((d | c) ^ (d * 80)) & ((q ^ 80) - (p ^ 62));
+  for(i = 0; i < 9; i++){
+    a = ((q | q) - (p * a)) & ((d + d) | (c ^ d));
+  }
+  a = ((b & p) & (b & b)) + ((d & 29) & (b + c));
+  if(b < 92){
+    a = ((p + q) * (q ^ d)) ^ ((a + b) - (b ^ b));
+  }else{
+    a = ((b ^ b) - (b | p)) ^ ((c & p) + (p | c));
+  }
+  c = ((q + q) ^ (b + c)) * ((q - a) & (b * 88));
+  b = ((c - 66) | (d & p)) & ((a * 9) + (b + q));
+  d = ((a + q) & (d ^ 21)) * ((b + q) | (b & 26));
+  b = ((p | d) | (d + d)) - ((q & 40) ^ (d + a));
+  if(a < c){
+    d = ((b - q) + (c & 3)) - ((q - a) & (p | c));
+  }else{
+    a = ((a & b) - (a + 45)) - ((q ^ a) - (q & b));
+  }
+  a = ((c | 14) ^ (d + p)) + ((p + b) | (p & a));
+  b = ((d + p) & (b * q)) & ((b & d) * (b * p));
+  b = ((p | 4) - (a + p)) ^ ((q ^ c) & (b | p));
+  d = ((c | a) | (a + c)) + ((c + p) & (b - p));
+  if(a < 17){
+    b = ((b - c) - (q | a)) & ((c | q) | (q | 49));
+  }else{
+    d = ((b + p) * (b | q)) ^ ((d - b) ^ (q - p));
+  }
+  d = ((a + c) + (d & q)) + ((a + a) - (a + 98));
+  for(i = 0; i < 15; i++){
+    a = ((b | d) * (p - q)) + ((c + p) ^ (q & a));
+  }
+  b = ((b * c) | (q ^ b)) ^ ((a ^ d) & (b * p));
+  c = ((p | d) * (a * a)) | ((c + 5) & (p ^ q));
+  if(a < 79){
+    c = ((p * 99) | (b | c)) & ((a | d) - (p & p));
+  }else{
+    b = ((p - q) ^ (c * 31)) ^ ((a * d) * (d | a));
+  }
+  d = ((a ^ 39) * (c - b)) & ((p ^ p) + (q * p));
+  a = ((a - d) ^ (q & 97)) | ((d - p) & (b + 92));
+  d = ((b + p) & (p - d)) - ((d | b) - (a | 38));
+  for(i = 0; i < 21; i++){
+    c = ((d & b) * (q * c)) ^ ((b ^ 30) ^ (c + c));
+  }
+  if(a < a){
+    c = ((c * q) + (a | 22)) ^ ((c * 36) | (q | 40));
+  }else{
+    d = ((b & a) + (d | 7)) & ((b + 23) ^ (d & 54));
+  }
+  return a + b + c + d;
+}
+
+int func117(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 59;
+  d = 68;
+  a = ((p & 83) ^ (c - a)) - ((d | b) & (c + p));
+  b = ((c | c) - (d ^ q)) & ((p ^ c) + (c ^ b));
+  a = ((d * p) - (b - 4)) | ((b | a) ^ (a & q));
+  c = ((q + q) & (p + b)) & ((p | c) | (c - 36));
+  if(c < a){
+    b = ((a ^ 63) ^ (q - 29)) & ((d - p) | (d | b));
+  }else{
+    d = ((c * c) * (a * 33)) - ((b ^ 60) & (q * a));
+  }
+  b = ((a - c) + (a ^ d)) & ((d - c) - (a * b));
+  for(i = 0; i < 12; i++){
+    b = ((a + 7) - (q | q)) + ((p | 19) * (c ^ p));
+  }
+  c = ((d | p) | (d ^ 62)) & ((p ^ p) & (p - 61));
+  d = ((d | a) & (b | b)) + ((p ^ 99) & (p * a));
+  if(c < p){
+    d = ((d + c) | (c - a)) - ((d ^ c) | (p ^ d));
+  }else{
+    b = ((c & d) | (a ^ a)) * ((a + a) | (c - b));
+  }
+  b = ((p ^ 67) + (a - 67)) + ((b * a) + (a | 18));
+  a = ((d + q) - (c & c)) ^ ((a | p) + (q ^ q));
+  d = ((d | b) ^ (d & 13)) - ((p ^ d) | (p | b));
+  for(i = 0; i < 10; i++){
+    a = ((p & b) & (q | b)) & ((b - 17) ^ (d & b));
+  }
+  if(a < b){
+    c = ((c ^ 78) + (b + 21)) * ((a | c) + (c ^ c));
+  }else{
+    a = ((d - 37) | (p - p)) ^ ((c & 76) * (c + p));
+  }
+  c = ((a + b) - (p + d)) * ((a - p) + (p * d));
+  d = ((a * 42) * (q * q)) | ((d + 35) ^ (p - a));
+  b = ((b | p) & (q + b)) & ((c | d) | (a ^ q));
+  c = ((a + q) * (c + d)) - ((p ^ 27) - (a + 10));
+  if(a < c){
+    c = ((a - 4) | (c + a)) + ((p - p) & (a + p));
+  }else{
+    a = ((c | d) - (c + a)) + ((b | c) | (p - c));
+  }
+  for(i = 0; i < 44; i++){
+    c = ((b | d) - (c & b)) | ((c * c) + (q & q));
+  }
+  b = ((q | 97) - (a & b)) - ((d | b) - (a + 74));
+  d = ((a * q) + (b * 91)) * ((b | d) ^ (b ^ c));
+  b = ((d & b) - (p ^ 71)) * ((p * p) & (d ^ d));
+  if(a < c){
+    d = ((a | a) - (a - 85)) ^ ((b ^ d) | (d - d));
+  }else{
+    c = ((c ^ q) | (a | q)) + ((q & a) & (c | 3));
+  }
+  d = ((d * c) * (q | d)) - ((p * d) & (b + b));
+  c = ((b - d) + (d * d)) | ((a - b) ^ (d * 54));
+  for(i = 0; i < 16; i++){
+    d = ((b - c) | (b & c)) - ((q - a) + (p - q));
+  }
+  c = ((b * c) - (b + p)) ^ ((a | p) & (d * 43));
+  if(d < p){
+    d = ((d & q) - (p + a)) & ((a | a) & (c | 62));
+  }else{
+    c = ((d - d) | (q - d)) + ((a + p) * (q + c));
+  }
+  b = ((a | b) * (d + d)) * ((q | 42) | (p + a));
+  b = ((c ^ p) & (q * 97)) * ((b ^ p) * (a | 62));
+  d = ((a | c) & (c + a)) - ((a & b) - (p | d));
+  d = ((p * 84) | (c + 27)) ^ ((p * p) ^ (c - 32));
+  if(c < d){
+    a = ((p & b) - (p + q)) | ((b - a) - (d | q));
+  }else{
+    c = ((q & 6) + (d & 54)) | ((a - q) & (b * b));
+  }
+  d = ((p & a) | (p & a)) - ((d & a) * (p & q));
+  c = ((p * b) | (p + b)) ^ ((c & p) - (a ^ a));
+  b = ((d ^ c) & (c * 4)) + ((c + 44) ^ (b - b));
+  d = ((c + 98) - (a * 33)) & ((c ^ b) ^ (b - q));
+  if(b < 27){
+    d = ((p - d) - (b & c)) & ((p & b) * (d * a));
+  }else{
+    b = ((b ^ p) + (p ^ 29)) & ((c * 4) + (a - b));
+  }
+  b = ((q | d) - (a & d)) | ((a * q) | (b | a));
+  for(i = 0; i < 2; i++){
+    d = ((b - d) ^ (d + q)) & ((a & b) ^ (c & p));
+  }
+  c = ((a * 48) + (d + p)) * ((a * q) & (d + b));
+  c = ((p + p) * (c - d)) ^ ((d - p) | (a - 86));
+  if(d < q){
+    c = ((c ^ a) - (b - a)) - ((q ^ c) + (a + b));
+  }else{
+    d = ((d - a) - (q | q)) - ((b | c) + (a ^ 35));
+  }
+  a = ((d - d) & (b ^ 54)) | ((q ^ c) & (p & 2));
+  a = ((a - a) * (c * b)) ^ ((a - 69) - (q | b));
+  b = ((p - d) & (p + 89)) ^ ((p & p) * (d - 65));
+  for(i = 0; i < 27; i++){
+    b = ((q - 3) & (c - c)) | ((b - 90) ^ (d | 62));
+  }
+  if(d < 91){
+    d = ((c | c) & (p * 87)) - ((d & 96) + (a - q));
+  }else{
+    d = ((q * q) ^ (d * c)) | ((c | d) - (c * 95));
+  }
+  return a + b + c + d;
+}
+
+int func118(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 45;
+  d = 25;
+  d = ((q - 34) + (b | d)) & ((b & c) + (b - q));
+  c = ((c ^ p) + (b - p)) + ((q & q) & (d * b));
+  b = ((a ^ b) | (d | 25)) + ((a ^ b) + (p + c));
+  d = ((d & d) - (b - 78)) - ((q ^ p) + (b + q));
+  if(c < c){
+    c = ((p ^ 11) - (b - d)) * ((p - q) + (q ^ q));
+  }else{
+    d = ((p - 82) ^ (c + d)) | ((a & 23) ^ (a + a));
+  }
+  b = ((d - p) * (c | 61)) ^ ((c * q) * (q * q));
+  for(i = 0; i < 33; i++){
+    a = ((p - c) - (a * q)) + ((a - 9) * (q + c));
+  }
+  d = ((a * d) - (a * b)) & ((q - q) * (a & 32));
+  d = ((c ^ q) & (a - a)) & ((d - p) * (c + d));
+  if(c < d){
+    c = ((p - p) - (b + b)) * ((d * 35) + (q | q));
+  }else{
+    c = ((a - d) | (b | q)) ^ ((a | 75) + (c * d));
+  }
+  a = ((a + p) ^ (a + p)) ^ ((p | c) | (c ^ q));
+  c = ((c | q) | (q & p)) & ((q ^ 1) ^ (c ^ b));
+  b = ((c * q) & (p ^ b)) + ((q | a) + (b + d));
+  for(i = 0; i < 19; i++){
+    c = ((p ^ b) * (b & a)) & ((c * b) * (q * c));
+  }
+  if(c < d){
+    c = ((q ^ 23) | (d * a)) - ((c - 69) | (a - a));
+  }else{
+    b = ((a - d) & (q ^ a)) + ((a - c) & (a & p));
+  }
+  c = ((q & d) * (p ^ 69)) | ((p & p) ^ (p ^ 10));
+  a = ((d - c) + (q * a)) ^ ((d ^ p) | (d ^ p));
+  a = ((q * d) * (a * 73)) - ((c | p) - (q + c));
+  c = ((b + p) | (c * 27)) * ((c - a) | (q * 69));
+  if(d < d){
+    b = ((q - c) * (d | d)) + ((b | q) & (c | q));
+  }else{
+    b = ((c & q) * (q - a)) & ((b ^ c) & (q + b));
+  }
+  for(i = 0; i < 16; i++){
+    c = ((q ^ p) + (b & 65)) + ((a - q) | (b + 99));
+  }
+  c = ((p | c) + (d - p)) - ((b - d) * (b * p));
+  b = ((b ^ q) & (d | c)) * ((d | p) | (q - q));
+  c = ((p + d) + (b - c)) - ((b | a) ^ (b + b));
+  if(c < d){
+    d = ((q * p) | (d | a)) - ((q & b) * (a | 34));
+  }else{
+    d = ((d + 60) - (p ^ c)) + ((a | b) + (c & c));
+  }
+  a = ((d & d) & (b + q)) | ((p - d) - (d * q));
+  d = ((q & p) + (d + c)) - ((c * a) | (q & q));
+  for(i = 0; i < 38; i++){
+    a = ((q ^ c) - (c - c)) ^ ((p * b) | (c | a));
+  }
+  b = ((d + q) & (p & q)) - ((a & p) & (b ^ c));
+  if(c < a){
+    b = ((b ^ q) * (b + 46)) ^ ((d * a) - (p + 17));
+  }else{
+    a = ((p ^ q) + (p | c)) - ((b * d) | (b | b));
+  }
+  c = ((p ^ 88) | (p * 11)) ^ ((q | b) + (c | b));
+  a = ((b * d) ^ (q * d)) ^ ((p - 89) & (d - 69));
+  a = ((q - p) + (c - 31)) + ((d - 83) | (q + d));
+  b = ((q + 40) - (c ^ q)) | ((q ^ d) * (b & c));
+  if(a < c){
+    d = ((q * 14) - (a - d)) * ((q * 86) | (d ^ d));
+  }else{
+    a = ((b + 42) * (q + d)) - ((c - a) + (c & q));
+  }
+  b = ((a ^ 22) - (c + c)) ^ ((d | c) + (q + 51));
+  c = ((q * q) | (p | 27)) * ((q + q) ^ (a * q));
+  b = ((d - b) | (q & b)) * ((c | q) & (b * d));
+  a = ((a * 92) ^ (a & q)) & ((d + d) | (a - a));
+  if(c < b){
+    a = ((p ^ c) * (b + q)) | ((c ^ b) - (q - c));
+  }else{
+    b = ((d | b) & (b - q)) + ((b & q) ^ (b - 47));
+  }
+  c = ((a + b) & (a * 10)) - ((p * 82) + (c * a));
+  for(i = 0; i < 30; i++){
+    c = ((d & q) + (a & 75)) - ((c * d) & (a & d));
+  }
+  d = ((p & d) - (d & d)) - ((d - a) ^ (q * c));
+  d = ((p - d) + (p & q)) ^ ((b & a) ^ (p - c));
+  if(a < q){
+    b = ((b & q) + (c & q)) | ((q * 92) - (p - b));
+  }else{
+    c = ((p | q) * (a | b)) ^ ((d - d) + (p | a));
+  }
+  c = ((q * c) & (c * d)) & ((a + 21) & (b - c));
+  b = ((d - a) + (b | q)) | ((p + a) ^ (c - q));
+  c = ((c ^ d) * (d & a)) * ((c + a) & (p | a));
+  for(i = 0; i < 8; i++){
+    a = ((c * a) ^ (c ^ q)) + ((b | b) - (a ^ a));
+  }
+  if(c < 25){
+    d = ((b - b) & (d + d)) * ((c | p) | (a | p));
+  }else{
+    c = ((c ^ 19) & (q & d)) & ((d ^ a) - (a | b));
+  }
+  return a + b + c + d;
+}
+
+int func119(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 78;
+  d = 75;
+  d = ((c - q) & (c | 85)) * ((c - c) * (b ^ d));
+  a = ((a * b) & (c - d)) ^ ((d | a) ^ (p ^ 16));
+  d = ((a & 13) | (d ^ q)) | ((b * c) | (d + a));
+  b = ((b & a) + (c * b)) & ((a * 34) - (q * 40));
+  if(c < d){
+    b = ((q & 33) & (b + 9)) ^ ((a + 96) + (b + q));
+  }else{
+    b = ((a * c) * (c * q)) & ((q | d) * (p * a));
+  }
+  d = ((c - d) * (d - c)) & ((b & 49) ^ (q + c));
+  for(i = 0; i < 28; i++){
+    b = ((d * 47) - (d * c)) & ((a | p) | (q * 37));
+  }
+  b = ((a * 5) & (p & p)) - ((d * p) * (p - d));
+  a = ((p - a) ^ (p * d)) + ((d | 30) + (b ^ q));
+  if(d < b){
+    d = ((c + a) & (p ^ d)) * ((p - p) & (b & a));
+  }else{
+    a = ((p + b) | (q | 52)) | ((c - 57) - (p - d));
+  }
+  c = ((c * p) - (a ^ a)) | ((d ^ c) * (q * q));
+  a = ((b | c) + (d + q)) + ((d ^ p) - (q ^ a));
+  a = ((c & q) + (c - q)) ^ ((b - b) | (q + q));
+  for(i = 0; i < 10; i++){
+    a = ((a ^ 55) | (p - p)) - ((a + d) - (q & 75));
+  }
+  if(b < d){
+    c = ((c & p) | (p | a)) * ((b | b) | (c + 13));
+  }else{
+    d = ((b + d) | (p | 30)) & ((a & d) | (q & b));
+  }
+  d = ((b | a) & (p & p)) & ((q | a) | (a - q));
+  a = ((b * q) ^ (d + p)) + ((c ^ a) | (d ^ a));
+  a = ((a | a) - (c & 42)) + ((p ^ q) | (c ^ 26));
+  d = ((a ^ 38) ^ (b ^ q)) + ((c * c) + (b ^ b));
+  if(d < 96){
+    c = ((a & c) - (q | d)) & ((a * b) | (p * p));
+  }else{
+    d = ((c & c) | (c | d)) * ((d ^ 87) ^ (d - d));
+  }
+  for(i = 0; i < 36; i++){
+    a = ((a + a) * (c + q)) | ((d ^ q) - (d ^ p));
+  }
+  a = ((c | 81) & (b * 46)) - ((d & b) ^ (a | c));
+  a = ((b ^ a) - (c | 75)) + ((d & 16) - (b - a));
+  a = ((p | a) | (p + q)) * ((d ^ 43) | (p * c));
+  if(d < 25){
+    d = ((c | 15) ^ (c * d)) + ((q + p) - (c - q));
+  }else{
+    c = ((d & d) ^ (a & 33)) ^ ((c * c) + (b | p));
+  }
+  d = ((c & 11) | (c + 46)) ^ ((b ^ c) - (c | a));
+  c = ((a - a) + (c - q)) | ((c | 41) | (a * c));
+  for(i = 0; i < 11; i++){
+    d = ((b - 90) ^ (a & p)) ^ ((c + p) + (d - a));
+  }
+  c = ((b * p) * (b ^ p)) ^ ((q | c) * (c ^ b));
+  if(d < d){
+    c = ((p | c) - (d | q)) & ((b & q) - (a ^ q));
+  }else{
+    c = ((c * b) & (c ^ p)) & ((q + c) + (c & d));
+  }
+  d = ((a * c) - (d | b)) | ((p + q) * (c ^ a));
+  b = ((q + b) * (a ^ 27)) * ((b * 34) * (q + d));
+  c = ((p + c) * (q | q)) | ((d ^ q) - (p & b));
+  c = ((c + b) & (b & 83)) - ((p | b) ^ (q + 76));
+  if(c < a){
+    b = ((p - p) & (q | d)) * ((a + c) - (b | 93));
+  }else{
+    a = ((a ^ 33) | (a ^ 88)) & ((a - p) + (b & d));
+  }
+  d = ((d * p) * (d & 18)) & ((c + a) * (a + 9));
+  a = ((b & 74) - (q - c)) + ((a | b) * (b * 66));
+  c = ((b ^ d) | (c & b)) & ((d - 29) ^ (a | q));
+  d = ((q & c) - (a & b)) & ((a ^ c) | (p + p));
+  if(d < 23){
+    b = ((c ^ a) ^ (d & c)) & ((q + d) & (d | a));
+  }else{
+    b = ((c | b) ^ (b + d)) * ((c & c) + (p - a));
+  }
+  c = ((c & q) & (q * c)) + ((d & d) ^ (d ^ b));
+  for(i = 0; i < 17; i++){
+    c = ((b * b) * (c | q)) & ((a ^ p) - (q - q));
+  }
+  b = ((c ^ b) | (a + c)) * ((b & p) | (d - c));
+  a = ((d - d) + (b ^ p)) * ((a ^ c) | (c & 35));
+  if(d < a){
+    a = ((p * a) + (c * 44)) ^ ((c - c) ^ (p & 10));
+  }else{
+    b = ((a | a) ^ (b | d)) | ((b | 48) | (d & b));
+  }
+  b = ((c ^ 59) + (c - a)) + ((b ^ 68) | (d * 57));
+  b = ((p & 99) + (a ^ 62)) | ((d & d) ^ (p - a));
+  d = ((q - p) & (q | q)) | ((c | 95) - (b + 84));
+  for(i = 0; i < 14; i++){
+    a = ((d ^ c) & (c | 15)) ^ ((c + d) & (b + b));
+  }
+  if(d < 61){
+    b = ((b & d) * (b & 93)) ^ ((a * 70) & (c + c));
+  }else{
+    a = ((q - 30) * (c * b)) | ((a + 53) * (b | 41));
+  }
+  return a + b + c + d;
+}
+
+int func120(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 3;
+  d = 2;
+  c = ((a + c) - (q - c)) & ((d * c) ^ (q ^ 96));
+  b = ((c & c) | (d ^ 12)) ^ ((q + 25) - (a ^ d));
+  a = ((c + q) + (c + b)) ^ ((b * d) + (q & d));
+  b = ((q - d) ^ (a * b)) & ((a & 27) - (p & q));
+  if(a < a){
+    c = ((b & p) ^ (d * p)) | ((a | d) + (d & a));
+  }else{
+    d = ((b & 80) | (q + 51)) | ((p + a) | (d - b));
+  }
+  c = ((p ^ a) | (b & b)) & ((c & c) | (c ^ 36));
+  for(i = 0; i < 33; i++){
+    d = ((q + p) ^ (p * c)) + ((p & 41) & (d ^ d));
+  }
+  b = ((q - c) ^ (c * b)) * ((c * a) ^ (b | p));
+  d = ((b | a) - (q * 38)) * ((b + q) | (c + a));
+  if(a < b){
+    d = ((a - q) & (c & q)) | ((c | b) | (q - c));
+  }else{
+    a = ((d ^ p) ^ (c & p)) - ((a | d) * (q * q));
+  }
+  d = ((d + 27) - (b * a)) - ((b & a) & (d * 8));
+  d = ((a ^ p) * (q | q)) - ((a ^ a) - (q | c));
+  d = ((c + 66) & (c ^ c)) * ((d - 69) + (p + 56));
+  for(i = 0; i < 39; i++){
+    a = ((a | 91) + (p & p)) - ((b - a) - (q * c));
+  }
+  if(d < a){
+    b = ((c & b) * (p | c)) | ((c & b) ^ (a + d));
+  }else{
+    d = ((q * b) * (p + 8)) & ((c ^ c) - (b + a));
+  }
+  a = ((d | 77) * (q & 55)) + ((d ^ c) ^ (d + b));
+  d = ((b ^ d) ^ (c - b)) ^ ((a - p) | (q & a));
+  d = ((p | b) & (q * 27)) & ((b ^ 20) * (b - p));
+  b = ((c | p) - (p + p)) - ((d + p) + (q + d));
+  if(d < d){
+    c = ((b & b) + (d ^ 62)) - ((q - 39) + (a - 40));
+  }else{
+    d = ((c - 66) ^ (d ^ p)) - ((d - 10) | (q * 95));
+  }
+  for(i = 0; i < 10; i++){
+    d = ((c + q) | (a | 29)) | ((q | b) + (p ^ c));
+  }
+  c = ((c + b) - (d | 68)) | ((q | b) ^ (b ^ c));
+  d = ((b ^ c) ^ (d ^ q)) + ((d * 48) + (a & 15));
+  a = ((q | c) * (p - p)) + ((a * d) * (q ^ q));
+  if(d < a){
+    c = ((d + d) * (a * 29)) | ((q ^ b) - (q & c));
+  }else{
+    b = ((b + c) + (p ^ q)) ^ ((b | q) - (c * q));
+  }
+  c = ((p + a) | (a * a)) + ((q ^ b) & (a * 22));
+  a = ((b + 90) & (a - c)) * ((p + 93) | (d ^ 4));
+  for(i = 0; i < 19; i++){
+    d = ((b | c) * (d * 70)) & ((a + d) + (b ^ 33));
+  }
+  d = ((p - a) & (d | d)) + ((b | q) - (c | 4));
+  if(b < c){
+    d = ((q | q) * (a * b)) * ((a & 93) ^ (a + 26));
+  }else{
+    b = ((p | 74) - (b * c)) | ((b - p) | (q & 69));
+  }
+  c = ((c | a) & (d ^ p)) ^ ((c + a) + (d & a));
+  b = ((c * d) & (p * c)) - ((q - p) + (b + b));
+  d = ((a + 89) - (a & 96)) ^ ((d | q) - (a - a));
+  d = ((d ^ c) - (p ^ 63)) + ((a & a) + (c * d));
+  if(c < c){
+    d = ((b ^ b) | (p - q)) & ((b - c) & (p - a));
+  }else{
+    c = ((a - d) + (c - c)) + ((a & b) + (q & a));
+  }
+  c = ((q * 96) + (q * d)) * ((p - a) ^ (p | c));
+  a = ((b & d) * (b * a)) & ((c - c) & (b * d));
+  a = ((d * d) + (p - 9)) - ((q | a) * (q + b));
+  c = ((c - b) + (d * p)) ^ ((q | c) | (b ^ c));
+  if(b < d){
+    d = ((q | p) & (b | 91)) * ((a ^ a) * (p | p));
+  }else{
+    a = ((d & d) ^ (d * a)) - ((a + a) * (a - b));
+  }
+  b = ((b | b) + (p - b)) | ((d ^ c) + (c | a));
+  for(i = 0; i < 34; i++){
+    d = ((q + 50) + (d - q)) ^ ((a * q) + (q + 19));
+  }
+  d = ((b ^ 72) & (b * q)) + ((c + p) * (a - p));
+  c = ((d & 2) & (q ^ c)) * ((p + a) | (d - 4));
+  if(a < a){
+    b = ((c ^ 1) + (a ^ b)) | ((b + 11) & (c * a));
+  }else{
+    d = ((a - a) | (c | q)) * ((c & q) | (q * c));
+  }
+  b = ((b - a) * (p * c)) - ((d | d) ^ (p ^ b));
+  a = ((p * d) - (p & c)) ^ ((p * 62) * (c - d));
+  d = ((c & 25) ^ (q * 88)) & ((b - 59) | (q ^ d));
+  for(i = 0; i < 14; i++){
+    c = ((a - d) | (p | d)) ^ ((p + b) * (p - a));
+  }
+  if(b < d){
+    d = ((q | d) + (q + a)) | ((c * 32) + (d + b));
+  }else{
+    d = ((d * c) & (b & c)) ^ ((q * b) * (p * a));
+  }
+  return a + b + c + d;
+}
+
+int func121(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 93;
+  d = 61;
+  c = ((q ^ d) | (q * b)) + ((q * b) | (a & 66));
+  a = ((d + 21) * (a ^ d)) + ((d - b) - (a & 27));
+  b = ((c + a) ^ (q | c)) * ((a | c) * (a ^ d));
+  c = ((p ^ q) * (p & q)) - ((c & a) | (q * p));
+  if(c < c){
+    b = ((c & a) + (a & b)) | ((b + c) | (d * d));
+  }else{
+    c = ((a ^ p) ^ (p ^ 59)) - ((c - d) ^ (q * b));
+  }
+  d = ((q - q) & (d & p)) | ((c + p) | (b - c));
+  for(i = 0; i < 28; i++){
+    d = ((q ^ q) | (a + a)) * ((d - d) | (b + b));
+  }
+  a = ((p - p) & (c ^ c)) | ((p & 40) & (a ^ 35));
+  a = ((b - p) ^ (c * c)) + ((d * c) ^ (d | p));
+  if(d < d){
+    a = ((d ^ a) ^ (q & c)) - ((p | q) * (d + q));
+  }else{
+    b = ((a | c) & (d * 84)) * ((a * a) | (d * c));
+  }
+  a = ((p + c) * (c & q)) ^ ((p ^ b) * (c | c));
+  d = ((q & p) - (b & 81)) + ((q + 18) | (b * a));
+  c = ((d + 58) * (b - 49)) - ((d - d) + (p & 96));
+  for(i = 0; i < 4; i++){
+    a = ((b - c) ^ (d | a)) - ((p ^ p) & (q * 59));
+  }
+  if(b < a){
+    b = ((q * b) + (q & p)) ^ ((q & d) * (p ^ 25));
+  }else{
+    d = ((d + p) + (p - a)) - ((a ^ p) & (d * a));
+  }
+  b = ((d & c) * (b + d)) & ((p * c) * (q * c));
+  a = ((q - 61) + (q - 80)) & ((c | p) ^ (b & c));
+  b = ((c + q) ^ (c - a)) * ((c + 13) * (b * q));
+  b = ((b & q) | (a - d)) & ((b | 38) | (q * 71));
+  if(d < p){
+    b = ((q & b) + (a | c)) + ((q | c) + (q & c));
+  }else{
+    b = ((p - c) ^ (q & q)) + ((a * c) * (p ^ 64));
+  }
+  for(i = 0; i < 45; i++){
+    a = ((q - b) + (c + 97)) * ((p ^ 26) & (p | d));
+  }
+  c = ((q ^ 34) | (b + a)) + ((a - b) - (p * a));
+  c = ((b ^ p) | (c & d)) + ((d - d) ^ (a + d));
+  b = ((c & 43) ^ (d | p)) & ((b + c) ^ (c * 45));
+  if(c < b){
+    a = ((b - c) + (q ^ 59)) + ((q | d) - (q + p));
+  }else{
+    a = ((c | c) * (p & p)) | ((p - d) * (p - p));
+  }
+  a = ((q & a) * (a & c)) + ((q * d) - (c - b));
+  c = ((c - d) + (a - 38)) & ((p + d) * (d + 31));
+  for(i = 0; i < 22; i++){
+    a = ((a | p) & (c - q)) * ((a | q) + (p | d));
+  }
+  c = ((a * c) | (c - q)) | ((c + 74) ^ (c + a));
+  if(d < 40){
+    c = ((c - c) & (q + c)) + ((p + c) | (d & 18));
+  }else{
+    b = ((q - a) & (d * b)) - ((q | c) - (b | q));
+  }
+  a = ((a + c) + (c ^ d)) - ((b | 65) + (q - a));
+  c = ((c - q) + (q + c)) ^ ((b - q) + (b + c));
+  a = ((d + q) * (c & d)) - ((q + 75) ^ (c - 95));
+  b = ((a & p) * (q ^ b)) ^ ((d - p) + (b * d));
+  if(c < 17){
+    b = ((d - q) * (d & q)) & ((c ^ q) + (q | a));
+  }else{
+    b = ((q | d) - (d + d)) * ((b & b) - (q & a));
+  }
+  a = ((d - d) * (b ^ 60)) & ((b & a) * (p & a));
+  c = ((c * 25) & (d + 35)) + ((q & c) & (d + q));
+  c = ((p ^ b) & (d & b)) & ((d + q) - (b ^ p));
+  d = ((p ^ a) - (p - 72)) + ((p - 6) ^ (c * b));
+  if(d < b){
+    d = ((q - b) + (b - 58)) | ((a & p) + (b & c));
+  }else{
+    d = ((d & p) & (p ^ q)) | ((d | b) * (d - q));
+  }
+  d = ((d - p) & (a * c)) - ((d + p) | (d ^ q));
+  for(i = 0; i < 26; i++){
+    b = ((b + d) + (c & 48)) + ((d & a) * (c + q));
+  }
+  d = ((c - a) & (p * b)) - ((d + q) & (b - b));
+  d = ((d ^ 2) & (c - q)) & ((c - 7) + (c * 69));
+  if(c < c){
+    d = ((c ^ 2) * (q + 37)) * ((d - d) ^ (p * a));
+  }else{
+    d = ((c + p) ^ (b + c)) - ((a - 65) ^ (a * 76));
+  }
+  b = ((p | d) - (a + 29)) ^ ((a * 35) & (b + a));
+  a = ((q & d) * (b ^ 98)) ^ ((a - 9) * (a - b));
+  d = ((a - p) & (c ^ c)) * ((p * c) | (c + b));
+  for(i = 0; i < 38; i++){
+    c = ((p | q) & (c - q)) | ((b | q) - (c | c));
+  }
+  if(c < c){
+    d = ((q & a) + (c | b)) | ((d * p) ^ (p | b));
+  }else{
+    a = ((q * q) & (b & q)) & ((a | 17) - (p | p));
+  }
+  return a + b + c + d;
+}
+
+int func122(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 88;
+  d = 46;
+  a = ((d * d) & (q - a)) | ((c & q) * (b * a));
+  d = ((q & c) + (c | 33)) * ((q * q) + (c | 32));
+  c = ((c ^ c) | (a * 37)) + ((c * a) | (c + q));
+  b = ((p - b) * (b | d)) - ((p + 46) ^ (p | 42));
+  if(a < a){
+    d = ((b + d) * (p + c)) * ((d + b) ^ (a + b));
+  }else{
+    c = ((q & b) - (q * a)) * ((b & p) * (c & a));
+  }
+  d = ((b & b) ^ (c & d)) * ((p + b) * (q & p));
+  for(i = 0; i < 33; i++){
+    c = ((d + q) * (c & 62)) & ((q * b) * (p + q));
+  }
+  b = ((a * 63) + (b + q)) | ((a * q) | (a * c));
+  b = ((a + a) ^ (b * b)) * ((d ^ q) + (q - p));
+  if(d < c){
+    a = ((c ^ 65) ^ (b - b)) - ((b - c) & (b * c));
+  }else{
+    a = ((a ^ p) ^ (a - b)) - ((a * d) ^ (c - b));
+  }
+  a = ((q ^ c) + (c ^ p)) ^ ((c - 14) ^ (c * c));
+  c = ((d - a) + (c & a)) & ((b | p) & (p + d));
+  c = ((p - d) + (p - q)) + ((p + p) ^ (c * a));
+  for(i = 0; i < 45; i++){
+    c = ((d ^ p) | (b & p)) | ((c + p) - (q | c));
+  }
+  if(b < 44){
+    b = ((a | c) * (p * p)) - ((q ^ a) + (d | 58));
+  }else{
+    b = ((p - d) - (p & 54)) | ((a + d) | (d * c));
+  }
+  d = ((a | 83) * (a * d)) - ((a | d) * (q + 20));
+  a = ((p ^ p) + (a & p)) & ((d * q) - (b * a));
+  c = ((b | c) & (c - b)) * ((q & 1) + (b ^ 86));
+  d = ((b - d) & (q + d)) - ((a | d) & (q | a));
+  if(b < a){
+    d = ((a + d) | (p - 64)) | ((c ^ d) - (b - p));
+  }else{
+    c = ((q - q) + (p & d)) | ((q ^ q) & (a - a));
+  }
+  for(i = 0; i < 40; i++){
+    a = ((d - c) ^ (p ^ 7)) * ((d * a) * (b & p));
+  }
+  c = ((a * a) * (p ^ 8)) * ((b + 4) | (d * d));
+  c = ((a - q) + (d * 81)) * ((c ^ d) ^ (a | 66));
+  c = ((a + c) & (a & d)) ^ ((q & a) & (d ^ a));
+  if(c < 21){
+    b = ((d | c) * (p * b)) * ((d ^ 47) ^ (p ^ q));
+  }else{
+    b = ((c | c) & (a & c)) & ((b ^ a) - (a ^ c));
+  }
+  c = ((a ^ c) - (d ^ 23)) - ((p + 28) & (d - p));
+  c = ((c * p) + (b | c)) - ((p + p) | (d + 56));
+  for(i = 0; i < 44; i++){
+    b = ((b - c) ^ (b & c)) * ((b ^ a) | (q | c));
+  }
+  b = ((q ^ a) & (c - a)) + ((c - p) | (p * q));
+  if(c < c){
+    b = ((a ^ 2) + (c + 99)) + ((b - q) ^ (c ^ q));
+  }else{
+    c = ((b ^ 98) * (b + b)) * ((a + q) ^ (b & p));
+  }
+  b = ((c * p) + (b ^ b)) - ((a | q) ^ (b & b));
+  b = ((b ^ c) ^ (q ^ d)) - ((c + q) * (p + q));
+  b = ((q & d) + (d ^ p)) - ((p & p) ^ (q & a));
+  a = ((a ^ a) | (b | c)) | ((q & 21) + (a * 70));
+  if(a < b){
+    a = ((a - b) ^ (p | a)) | ((a - p) | (c ^ b));
+  }else{
+    a = ((b ^ a) + (q * c)) & ((p | q) | (a - c));
+  }
+  c = ((a ^ c) ^ (c + a)) + ((c & a) - (d + b));
+  c = ((p & q) | (p & c)) & ((p + p) + (d ^ b));
+  a = ((q | 22) * (a - 15)) | ((p * p) * (c + c));
+  c = ((d + a) | (c + q)) + ((b + q) | (p | q));
+  if(c < q){
+    b = ((b & p) & (p - a)) | ((p + p) | (b - 20));
+  }else{
+    c = ((p + c) ^ (p & b)) & ((d | 16) * (p & a));
+  }
+  a = ((d - p) - (a ^ b)) + ((p ^ a) | (p - p));
+  for(i = 0; i < 40; i++){
+    d = ((d ^ p) ^ (p & a)) | ((q ^ d) - (q - a));
+  }
+  b = ((d & c) - (a + c)) * ((q | q) & (a * 89));
+  a = ((q ^ q) - (q ^ a)) - ((a + q) * (b * 87));
+  if(a < b){
+    b = ((p - 18) * (p - p)) * ((b * 97) ^ (a + c));
+  }else{
+    a = ((d + b) | (q + 11)) + ((q & p) | (a ^ b));
+  }
+  c = ((b - d) + (c ^ d)) | ((q - q) + (b & d));
+  c = ((p & q) + (a - a)) | ((q * 62) ^ (c * p));
+  d = ((a & q) - (p + 44)) - ((a + 96) + (p | a));
+  for(i = 0; i < 11; i++){
+    b = ((q | 84) | (d | d)) * ((d - d) + (b - 5));
+  }
+  if(d < 6){
+    a = ((c ^ 78) * (b & 32)) ^ ((b * q) & (d & a));
+  }else{
+    b = ((p ^ d) * (d + d)) | ((c - c) | (b - a));
+  }
+  return a + b + c + d;
+}
+
+int func123(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 66;
+  b = ((d & b) ^ (q | a)) - ((d + 48) - (c - a));
+  c = ((q - 56) * (d ^ p)) & ((a + p) | (p & c));
+  a = ((a * q) | (q ^ p)) * ((q ^ 92) ^ (d * d));
+  b = ((a - c) ^ (c + p)) & ((q ^ c) - (d & b));
+  if(c < c){
+    b = ((p & q) - (b | a)) | ((q ^ d) | (d & 5));
+  }else{
+    b = ((b * c) | (c * c)) + ((c | 88) - (c & b));
+  }
+  c = ((q - a) ^ (a - a)) & ((p * b) + (q ^ q));
+  for(i = 0; i < 19; i++){
+    d = ((a ^ q) & (p - d)) + ((d + q) - (c & q));
+  }
+  b = ((d ^ 50) | (b & 10)) + ((a ^ c) + (b ^ a));
+  d = ((p + 53) | (d & a)) - ((q | 13) | (a ^ b));
+  if(b < 7){
+    d = ((q ^ b) * (d - b)) - ((q * d) ^ (a + a));
+  }else{
+    b = ((d ^ 94) & (q * p)) & ((b * c) + (q + 68));
+  }
+  b = ((c ^ c) * (q + a)) * ((a * a) + (b * a));
+  c = ((d | c) * (c | 19)) - ((q | 15) - (c ^ a));
+  a = ((a * 30) + (a | c)) + ((q | p) & (b * 65));
+  for(i = 0; i < 3; i++){
+    b = ((q | 18) ^ (p - 83)) * ((q + a) ^ (a ^ b));
+  }
+  if(a < q){
+    a = ((d & 5) & (c - c)) * ((d + b) | (a + q));
+  }else{
+    a = ((d + q) + (a & b)) + ((p | 87) * (d * a));
+  }
+  a = ((p + d) ^ (q - c)) | ((d * c) * (p | p));
+  c = ((d ^ q) & (b + d)) + ((b + b) + (q - p));
+  c = ((q - 55) | (c & p)) * ((q & 86) + (b + b));
+  d = ((a - c) ^ (p - 73)) & ((b ^ q) - (a - 23));
+  if(a < 35){
+    d = ((b ^ q) & (p & a)) | ((c * c) - (d & a));
+  }else{
+    a = ((d ^ 56) & (q * d)) & ((b | 49) | (a * 82));
+  }
+  for(i = 0; i < 43; i++){
+    b = ((c * p) | (b + 24)) ^ ((c | p) + (q | q));
+  }
+  a = ((c & a) | (p * 20)) & ((q + d) ^ (c + b));
+  c = ((q + c) - (d | p)) | ((d | c) & (d | p));
+  c = ((b & 94) - (b & c)) * ((p & b) | (b ^ b));
+  if(c < c){
+    a = ((a & 51) | (d | a)) - ((a & d) + (c | b));
+  }else{
+    c = ((d - b) & (a * b)) | ((d - 12) & (p - c));
+  }
+  d = ((d - d) - (b + c)) & ((b ^ q) + (b ^ 38));
+  b = ((p * d) | (c - 77)) | ((d | d) * (d | p));
+  for(i = 0; i < 32; i++){
+    a = ((a * a) | (a & c)) | ((c | a) - (d * q));
+  }
+  a = ((a & c) | (d | b)) * ((q - 9) - (c ^ a));
+  if(c < b){
+    d = ((d | a) - (d - p)) - ((p | c) * (d | 34));
+  }else{
+    c = ((c + c) | (p | p)) + ((c & d) - (d ^ 88));
+  }
+  d = ((d * a) & (q & b)) & ((c & a) & (c - p));
+  a = ((p * a) + (q * d)) + ((c | a) | (q & q));
+  b = ((a ^ c) * (d & p)) + ((b * p) | (q + c));
+  c = ((q + b) * (a ^ q)) + ((d | a) | (q - c));
+  if(b < p){
+    c = ((c & p) | (p ^ q)) | ((b | p) + (a + c));
+  }else{
+    a = ((d * q) + (d & 46)) ^ ((a & 7) & (q - q));
+  }
+  b = ((q | p) + (c | 30)) ^ ((c * 39) - (a * 69));
+  a = ((q - q) + (q ^ a)) - ((a ^ d) ^ (b - c));
+  c = ((b & 72) - (b + 17)) + ((a ^ a) | (c - q));
+  a = ((q * d) ^ (d * 39)) * ((d - b) | (b * p));
+  if(a < c){
+    b = ((a * a) | (d ^ q)) - ((d ^ a) | (b & b));
+  }else{
+    b = ((d - 29) ^ (p + d)) | ((p & 10) ^ (d | a));
+  }
+  d = ((p + 75) | (b + a)) & ((p | d) + (d & 46));
+  for(i = 0; i < 23; i++){
+    a = ((b & a) & (a & c)) - ((d ^ d) & (b - q));
+  }
+  c = ((a & p) ^ (b - b)) | ((c & p) * (a - 60));
+  c = ((q | b) - (p - q)) * ((c | 41) ^ (p | p));
+  if(a < c){
+    a = ((p & c) | (a ^ c)) * ((a | q) - (a & 33));
+  }else{
+    d = ((p * c) * (q | b)) * ((c ^ a) + (q * p));
+  }
+  c = ((d | 54) + (a ^ 80)) + ((d & c) & (p * a));
+  a = ((b * b) ^ (a - a)) * ((a - c) & (b & q));
+  d = ((p ^ 33) | (b & b)) + ((b | q) & (d & 53));
+  for(i = 0; i < 32; i++){
+    a = ((d + 68) | (b & d)) | ((c - 80) * (c ^ b));
+  }
+  if(d < q){
+    b = ((a + 14) | (q - 49)) & ((c + 54) & (b - c));
+  }else{
+    a = ((c & d) ^ (p & p)) ^ ((p & 53) + (d ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func124(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 23;
+  b = ((c & c) + (c & 99)) - ((d | b) - (b ^ 29));
+  a = ((p * b) * (q ^ 83)) - ((q * 7) | (d ^ 95));
+  a = ((q | c) & (a ^ 13)) + ((c | 81) | (d ^ d));
+  c = ((p + 4) ^ (c + p)) & ((d & a) * (c - d));
+  if(b < a){
+    b = ((a - c) | (c + b)) + ((c ^ 5) | (a * q));
+  }else{
+    b = ((a | b) & (q & 4)) | ((a & 68) - (q & 1));
+  }
+  a = ((c ^ 17) * (d + 7)) & ((a ^ d) | (q | p));
+  for(i = 0; i < 41; i++){
+    c = ((p ^ d) + (d & 60)) * ((b ^ p) + (q & b));
+  }
+  a = ((q ^ b) ^ (q & 5)) ^ ((a - p) - (b | c));
+  d = ((a + b) & (a * q)) - ((p + d) | (d * 23));
+  if(a < c){
+    d = ((q | p) + (p | b)) | ((p ^ p) & (d | d));
+  }else{
+    a = ((d + a) * (c + q)) ^ ((a ^ q) + (b & c));
+  }
+  a = ((c - 76) & (p - c)) ^ ((a ^ 37) ^ (q | d));
+  c = ((q & a) | (b & c)) ^ ((b | 48) + (p * a));
+  b = ((b + b) | (p + c)) ^ ((d * q) | (b & b));
+  for(i = 0; i < 20; i++){
+    b = ((p + 41) | (a & b)) - ((c * a) * (p - d));
+  }
+  if(b < c){
+    c = ((q & d) * (q & c)) + ((q + q) * (a * 92));
+  }else{
+    a = ((q + a) * (b + b)) | ((b + d) | (p | q));
+  }
+  c = ((q * a) | (a * b)) & ((a | p) ^ (d + b));
+  d = ((b - q) + (c & 77)) - ((c & a) ^ (q + 62));
+  c = ((c ^ 23) + (p * d)) & ((c - q) * (c & 93));
+  c = ((a + 10) & (p | a)) + ((b & 77) & (a ^ p));
+  if(c < b){
+    b = ((q + p) | (p ^ 30)) + ((q ^ p) | (c & 44));
+  }else{
+    b = ((b - b) * (q * p)) - ((c + p) & (d & a));
+  }
+  for(i = 0; i < 7; i++){
+    d = ((c & 39) & (q + b)) | ((d - 8) + (q + q));
+  }
+  d = ((c - b) ^ (a ^ a)) ^ ((q | p) * (a + 1));
+  a = ((a | d) & (q ^ d)) ^ ((d - 78) & (b * d));
+  d = ((q & a) + (a * q)) + ((a + d) * (q * 75));
+  if(c < 46){
+    c = ((b ^ b) * (b - d)) * ((p + b) - (b - c));
+  }else{
+    a = ((q + q) | (a + 98)) * ((a * a) + (b - d));
+  }
+  c = ((c & 88) + (d - q)) ^ ((d & 23) + (b & q));
+  d = ((q & 33) | (a ^ q)) ^ ((a - d) ^ (a * d));
+  for(i = 0; i < 38; i++){
+    c = ((q & c) ^ (a ^ a)) | ((a * b) - (a | a));
+  }
+  c = ((p | 28) + (b * d)) + ((q + b) - (c ^ b));
+  if(a < 18){
+    d = ((p | a) | (b ^ 81)) & ((d & q) + (p + b));
+  }else{
+    b = ((q + c) * (q | q)) & ((b | d) ^ (q & d));
+  }
+  a = ((d & d) & (c + a)) & ((c | d) * (a * q));
+  c = ((c ^ d) ^ (p + c)) - ((p & b) + (c | 20));
+  c = ((q + 26) & (q - 26)) ^ ((q - c) - (p * 64));
+  d = ((q | b) * (d * c)) * ((a + 22) ^ (q & c));
+  if(d < 56){
+    b = ((p * a) ^ (c + b)) - ((q + p) - (c ^ p));
+  }else{
+    b = ((q - 58) ^ (q * d)) ^ ((b - d) + (q + p));
+  }
+  a = ((p - a) & (d & b)) & ((c & d) - (d | 28));
+  d = ((b | p) ^ (d & q)) + ((a - c) - (p + 89));
+  c = ((d + a) - (a ^ d)) | ((q & q) & (b - 55));
+  d = ((a ^ b) + (c & a)) * ((b + a) & (c & 36));
+  if(a < d){
+    b = ((c - 60) & (d ^ a)) | ((a & b) - (d + a));
+  }else{
+    a = ((b - c) | (a | d)) ^ ((c + a) & (c + b));
+  }
+  a = ((q | b) + (a - p)) | ((c - 15) | (d * q));
+  for(i = 0; i < 16; i++){
+    a = ((c ^ 80) * (p | b)) | ((a & q) & (b * 18));
+  }
+  d = ((d | p) | (a & p)) * ((c | a) + (c & 15));
+  c = ((b - b) - (a ^ 55)) - ((a * 97) ^ (b + b));
+  if(d < d){
+    b = ((a ^ b) | (d ^ p)) * ((a + d) | (c & p));
+  }else{
+    b = ((q - b) * (b + 80)) * ((a + p) | (q ^ c));
+  }
+  b = ((p ^ c) ^ (d ^ q)) | ((b * b) + (a + b));
+  a = ((a & a) + (d ^ a)) & ((a | q) * (c - a));
+  d = ((a | q) | (p | b)) & ((q * d) + (a + a));
+  for(i = 0; i < 41; i++){
+    b = ((b - c) * (a ^ a)) & ((p & 35) & (d ^ d));
+  }
+  if(c < b){
+    c = ((q * a) & (a + c)) - ((p & b) + (b ^ b));
+  }else{
+    b = ((q | 2) ^ (q + a)) + ((a * b) | (c ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func125(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 14;
+  d = 30;
+  d = ((p & q) | (p * q)) ^ ((d - c) - (d ^ p));
+  b = ((b & a) ^ (b + d)) & ((p - c) * (d & b));
+  b = ((a + d) & (p ^ q)) * ((b & b) * (d * 72));
+  c = ((b ^ q) | (c + 68)) * ((a & a) * (q | c));
+  if(d < b){
+    a = ((p + q) + (p & c)) - ((p + c) ^ (a - p));
+  }else{
+    b = ((a + 72) ^ (p * 95)) | ((c & p) | (c * p));
+  }
+  d = ((a * 41) * (a | c)) | ((b + b) * (a - q));
+  for(i = 0; i < 21; i++){
+    d = ((q + q) ^ (d * 73)) - ((d + c) - (p ^ 87));
+  }
+  d = ((p + a) | (b + b)) ^ ((c + 43) + (a * 9));
+  c = ((b | b) & (a - p)) & ((a & p) + (p - c));
+  if(a < b){
+    c = ((q + b) & (b ^ d)) & ((p & b) - (c ^ 35));
+  }else{
+    b = ((d ^ d) + (d + b)) * ((a + b) ^ (a ^ 67));
+  }
+  c = ((b * p) ^ (q * 8)) | ((q - q) * (q - p));
+  c = ((a - 22) * (b + a)) ^ ((d - b) ^ (q ^ c));
+  a = ((b | b) + (d & a)) - ((q * p) - (q | 19));
+  for(i = 0; i < 29; i++){
+    b = ((q + p) + (p & q)) + ((a & 20) + (q - d));
+  }
+  if(d < p){
+    c = ((d * d) * (c & a)) + ((d + b) & (b - p));
+  }else{
+    b = ((b & a) + (c - c)) + ((d + 27) + (d | 47));
+  }
+  a = ((b * 83) - (d ^ 62)) & ((a & a) - (c + a));
+  c = ((a ^ 95) | (b - a)) - ((q - d) ^ (c - p));
+  a = ((q & p) | (q | c)) & ((c + b) | (c * a));
+  a = ((c + b) - (a + a)) ^ ((q ^ 44) | (d ^ 88));
+  if(d < d){
+    a = ((b * 97) & (d - d)) * ((b + q) ^ (q * a));
+  }else{
+    a = ((b * a) - (c ^ 32)) - ((c + p) | (d | b));
+  }
+  for(i = 0; i < 23; i++){
+    d = ((d | q) - (a + d)) ^ ((c ^ 40) ^ (c | 90));
+  }
+  a = ((d ^ q) * (q ^ p)) * ((d * 60) | (d & 93));
+  b = ((q * c) ^ (a | b)) + ((d - p) | (c + a));
+  d = ((p + p) - (b * a)) ^ ((p | b) | (d + a));
+  if(c < b){
+    a = ((c | a) + (c & a)) * ((d ^ 23) - (a - p));
+  }else{
+    a = ((c | p) + (d * a)) - ((p ^ q) & (d - p));
+  }
+  c = ((d & b) * (p - a)) + ((q | a) + (p | a));
+  a = ((b ^ q) ^ (q - b)) + ((p ^ 68) | (d ^ q));
+  for(i = 0; i < 36; i++){
+    c = ((q & b) ^ (q - 89)) + ((d ^ 19) - (a * b));
+  }
+  b = ((c - q) | (p + b)) - ((a ^ 79) | (d * a));
+  if(c < 83){
+    b = ((p * a) + (b ^ 56)) | ((q + d) - (d & p));
+  }else{
+    d = ((a - d) & (c + q)) - ((c & d) ^ (c * c));
+  }
+  b = ((d ^ b) ^ (b - a)) - ((b ^ p) * (a * 53));
+  c = ((c ^ c) * (c ^ 37)) ^ ((b + a) | (b | 73));
+  a = ((p - a) - (b + 3)) & ((q + p) + (c & b));
+  c = ((d ^ d) | (d * 40)) + ((a + p) + (q | a));
+  if(c < p){
+    d = ((p ^ 49) & (d ^ d)) | ((p + a) & (c & 23));
+  }else{
+    c = ((p - p) | (a & 95)) | ((b ^ c) - (q | c));
+  }
+  d = ((p - q) + (q + a)) ^ ((a ^ c) * (d * a));
+  a = ((b & 29) & (b & 23)) * ((p - 20) & (d ^ d));
+  d = ((a & p) * (c | 56)) + ((q | c) + (b ^ c));
+  c = ((d - b) * (d + b)) + ((d ^ p) + (d * 63));
+  if(d < c){
+    c = ((b & c) * (b - c)) - ((p | 21) + (a ^ 98));
+  }else{
+    c = ((q * c) & (d + q)) & ((b | q) - (d & d));
+  }
+  a = ((c & c) ^ (q | d)) * ((d + 82) & (q + q));
+  for(i = 0; i < 9; i++){
+    a = ((a * b) & (p + 94)) + ((d & a) - (a | d));
+  }
+  a = ((b - d) + (q | b)) - ((d - d) - (q | 97));
+  a = ((a + p) & (p + p)) * ((q | 33) | (p + 54));
+  if(b < d){
+    b = ((d * q) & (q & q)) & ((b | c) ^ (q | q));
+  }else{
+    b = ((d | d) ^ (b - q)) - ((p + q) & (a | 94));
+  }
+  a = ((c & c) ^ (p - 30)) * ((d | c) - (a * q));
+  d = ((a ^ c) | (q ^ c)) + ((a & 85) * (a + 23));
+  a = ((p & d) - (a * p)) | ((b + q) * (c & q));
+  for(i = 0; i < 16; i++){
+    a = ((p ^ p) - (d ^ 73)) & ((d * a) + (d - 2));
+  }
+  if(d < a){
+    b = ((a * q) - (a & q)) * ((c | 64) - (b | q));
+  }else{
+    c = ((b & p) - (p + d)) ^ ((b + 24) + (c + 48));
+  }
+  return a + b + c + d;
+}
+
+int func126(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 52;
+  d = 14;
+  b = ((q | 56) + (q ^ d)) * ((q + c) - (d * d));
+  b = ((p - a) ^ (b * p)) - ((c | 47) * (d & 85));
+  b = ((a * 44) ^ (a - 8)) & ((a * b) - (b | q));
+  b = ((b * q) * (a & 47)) * ((d * q) & (p + a));
+  if(c < c){
+    d = ((q | q) * (p | d)) | ((a + 14) ^ (q * a));
+  }else{
+    b = ((a + 30) * (c + q)) - ((a * c) - (b | 75));
+  }
+  b = ((d ^ 18) | (c & 37)) | ((a + a) - (d ^ 98));
+  for(i = 0; i < 4; i++){
+    d = ((d & b) | (c + 33)) & ((c - 97) ^ (a - b));
+  }
+  c = ((b & a) ^ (p & b)) - ((a | c) ^ (d & 48));
+  d = ((d | 47) ^ (p * a)) - ((q & c) + (q & b));
+  if(b < 89){
+    d = ((c * a) * (q - c)) * ((c + b) ^ (a | a));
+  }else{
+    c = ((a * q) ^ (q + 75)) - ((a + a) | (a - c));
+  }
+  b = ((q | d) ^ (b | a)) + ((b & 14) | (q ^ p));
+  c = ((q ^ 64) & (p * 15)) - ((q + 62) & (b ^ b));
+  c = ((d * p) ^ (q | q)) + ((p | q) - (a | d));
+  for(i = 0; i < 3; i++){
+    a = ((d + d) - (a ^ d)) & ((d | b) * (b ^ q));
+  }
+  if(b < d){
+    a = ((p & q) | (p + 93)) ^ ((p ^ c) ^ (p & 66));
+  }else{
+    c = ((d * p) * (c + q)) ^ ((c + q) ^ (q + a));
+  }
+  d = ((p - 58) & (a + a)) * ((p * q) & (a & d));
+  b = ((a - a) - (q & 74)) ^ ((q - d) - (a * 83));
+  b = ((b - 52) ^ (c + d)) + ((b + a) * (a * d));
+  d = ((a * q) + (c ^ q)) & ((b * a) - (q + b));
+  if(b < c){
+    a = ((d - q) * (a ^ b)) + ((a & q) | (c | b));
+  }else{
+    a = ((p * a) * (p ^ q)) | ((a + a) | (b - b));
+  }
+  for(i = 0; i < 34; i++){
+    c = ((p ^ b) - (c & q)) & ((b * q) - (c * q));
+  }
+  d = ((c * a) + (b ^ 33)) & ((p + q) * (q ^ 66));
+  d = ((b + a) | (q ^ a)) ^ ((a + b) * (p | b));
+  d = ((q ^ q) - (c & 2)) & ((p * 26) + (q | 20));
+  if(d < a){
+    b = ((p | q) ^ (b - 38)) * ((p & p) * (b ^ a));
+  }else{
+    b = ((a ^ 15) - (q | a)) + ((d & b) | (p & d));
+  }
+  a = ((a * q) & (p + q)) ^ ((b + c) | (q & q));
+  a = ((a * q) ^ (d * 57)) & ((q * q) & (a & d));
+  for(i = 0; i < 35; i++){
+    d = ((b - a) - (d & a)) ^ ((p | 3) & (d ^ q));
+  }
+  a = ((c - p) - (a * a)) | ((d - a) ^ (d | 2));
+  if(c < c){
+    c = ((q | b) | (p | 31)) - ((p - d) ^ (d * b));
+  }else{
+    b = ((b ^ 20) + (p | 99)) ^ ((c | b) ^ (a ^ 17));
+  }
+  d = ((p & b) & (a ^ b)) ^ ((q ^ 90) + (p - b));
+  b = ((b * 29) ^ (p ^ 63)) | ((b - q) * (q - 85));
+  b = ((a * a) + (p ^ 52)) | ((q | 70) + (a + d));
+  a = ((p | q) + (d + p)) + ((c - q) & (c | c));
+  if(a < q){
+    b = ((d - a) + (a - q)) + ((p * 7) + (p - b));
+  }else{
+    d = ((b * c) ^ (q * a)) + ((p ^ 20) * (p | c));
+  }
+  a = ((a * 19) & (b ^ b)) * ((b - 49) ^ (b - 32));
+  b = ((a ^ 59) + (b + q)) ^ ((b * 19) | (p * d));
+  c = ((d - 6) + (p ^ a)) & ((b | c) * (d + q));
+  c = ((q ^ d) ^ (c * b)) ^ ((p ^ a) * (q - d));
+  if(b < b){
+    a = ((p | b) + (b + 86)) - ((d | 33) * (b - a));
+  }else{
+    b = ((a ^ 27) + (b - p)) + ((a | d) * (q ^ d));
+  }
+  c = ((d * c) ^ (p * 97)) * ((c - d) & (q ^ p));
+  for(i = 0; i < 7; i++){
+    b = ((q + p) ^ (p * b)) - ((p | p) & (q & c));
+  }
+  c = ((a | q) - (d * p)) - ((q - c) * (a ^ a));
+  b = ((d | 86) * (c ^ 59)) | ((a & q) - (c & p));
+  if(b < 15){
+    d = ((p & 2) ^ (a & a)) + ((a & c) & (a & d));
+  }else{
+    a = ((p + 69) & (d | d)) ^ ((a * b) & (a | 65));
+  }
+  c = ((q - p) * (b ^ q)) ^ ((p * d) & (q & p));
+  c = ((c - a) | (q * 52)) & ((q & d) - (c | b));
+  d = ((p ^ a) ^ (a * a)) - ((p ^ p) + (a + c));
+  for(i = 0; i < 30; i++){
+    a = ((b - b) + (c | 77)) ^ ((q - p) + (q * c));
+  }
+  if(a < d){
+    b = ((a + 96) - (q ^ d)) | ((p | 52) * (d + p));
+  }else{
+    a = ((p | q) * (p + p)) | ((a * c) - (d & b));
+  }
+  return a + b + c + d;
+}
+
+int func127(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 36;
+  d = 96;
+  b = ((q + a) ^ (p * 4)) & ((c + d) * (p + 77));
+  c = ((q ^ 14) - (b & d)) + ((p - p) & (q - a));
+  d = ((d & 21) ^ (q + d)) + ((a & q) * (q - 57));
+  a = ((b * a) | (c + q)) - ((c | a) & (d ^ 81));
+  if(a < 78){
+    b = ((b + a) ^ (b * 89)) & ((d ^ a) | (q + p));
+  }else{
+    b = ((b | b) | (p * 53)) - ((a * p) * (d & b));
+  }
+  c = ((p | 38) + (a ^ c)) + ((c | c) & (q - 42));
+  for(i = 0; i < 29; i++){
+    d = ((b | q) | (q + 90)) | ((q ^ d) | (q - c));
+  }
+  d = ((c & 54) + (p * q)) | ((p ^ d) ^ (q + 99));
+  c = ((p ^ d) & (p | d)) + ((d * 72) | (q | b));
+  if(a < d){
+    c = ((p & a) - (b - c)) | ((d - c) | (b & p));
+  }else{
+    d = ((b - c) | (c + 53)) ^ ((c | d) + (d * p));
+  }
+  a = ((p & b) | (a & d)) | ((b - d) + (q - p));
+  a = ((a ^ a) & (p + q)) ^ ((b | c) & (p - p));
+  a = ((q ^ p) * (a + q)) | ((b ^ 56) - (b & a));
+  for(i = 0; i < 28; i++){
+    b = ((q * b) | (c ^ c)) - ((q | a) | (a & 77));
+  }
+  if(a < q){
+    d = ((q ^ q) & (a ^ c)) & ((d * q) + (q | p));
+  }else{
+    b = ((q - a) * (b + b)) ^ ((a * a) | (c | q));
+  }
+  b = ((b - a) * (b ^ p)) - ((q * b) | (a ^ a));
+  b = ((a & p) ^ (b & d)) * ((a - b) - (b ^ c));
+  a = ((c * a) * (q - a)) * ((d * q) - (d - b));
+  a = ((q - 74) | (q + b)) | ((c ^ p) + (q - q));
+  if(a < c){
+    b = ((q ^ a) * (b - 19)) & ((d | a) + (q * 31));
+  }else{
+    b = ((c & p) + (p - 93)) & ((q * b) * (q ^ b));
+  }
+  for(i = 0; i < 50; i++){
+    c = ((d + 51) - (a & p)) | ((a | c) * (a & 4));
+  }
+  c = ((p - b) + (q | b)) & ((q ^ 33) - (c | a));
+  a = ((b + p) * (q ^ q)) ^ ((d - p) - (a - a));
+  a = ((q ^ 84) - (p | d)) + ((q & c) - (p * c));
+  if(d < b){
+    a = ((a & 6) * (a | 41)) ^ ((a * q) + (c + b));
+  }else{
+    d = ((d + a) ^ (a + d)) * ((b & d) * (q + a));
+  }
+  b = ((a ^ q) ^ (c * d)) - ((p & p) * (a + a));
+  c = ((q + c) & (a | 21)) * ((b * b) + (q & c));
+  for(i = 0; i < 41; i++){
+    c = ((p * c) - (a ^ 25)) ^ ((c * a) | (b * c));
+  }
+  a = ((d ^ c) * (p * c)) | ((p & a) + (c - q));
+  if(c < b){
+    b = ((b & d) + (a & q)) * ((b * c) + (b * d));
+  }else{
+    a = ((b * 99) | (d + c)) & ((q - q) ^ (c + 42));
+  }
+  d = ((q - q) + (q | a)) + ((a & c) ^ (q ^ 98));
+  c = ((p - d) | (a * b)) - ((d ^ b) ^ (q ^ c));
+  a = ((a * q) * (p - 51)) + ((c + p) * (c - p));
+  d = ((q & a) + (d - b)) | ((d | 85) + (d & c));
+  if(d < c){
+    d = ((d & q) * (c & p)) - ((a + p) - (q - 18));
+  }else{
+    a = ((c + 18) * (c * b)) & ((a & 16) ^ (c & a));
+  }
+  a = ((c - 81) - (p | d)) ^ ((b + c) - (c - b));
+  d = ((d - b) - (b * a)) ^ ((q * 63) + (p ^ q));
+  d = ((q + c) & (c + a)) ^ ((c - 44) | (a + p));
+  a = ((p | d) - (q + c)) * ((q * a) & (q - p));
+  if(b < a){
+    c = ((c * 39) & (p & 99)) & ((q & 24) & (p + b));
+  }else{
+    d = ((d * q) - (b + a)) * ((q | q) ^ (p & a));
+  }
+  d = ((d - c) ^ (a * d)) & ((q ^ c) - (d ^ p));
+  for(i = 0; i < 3; i++){
+    b = ((q + p) ^ (a | d)) - ((d + 12) - (d - q));
+  }
+  b = ((p * 74) + (p - b)) * ((b - 5) | (a ^ 63));
+  d = ((q | 46) & (q | 79)) - ((a ^ 37) * (c + q));
+  if(a < d){
+    d = ((c | c) | (c ^ q)) + ((a - c) & (a - a));
+  }else{
+    a = ((d ^ d) - (a | c)) + ((d - c) ^ (a * d));
+  }
+  a = ((b ^ a) * (d + q)) - ((p | 97) & (q + c));
+  c = ((b + 59) - (d | c)) * ((a ^ d) & (b & a));
+  c = ((b + 57) | (a & c)) | ((c + a) ^ (p ^ q));
+  for(i = 0; i < 33; i++){
+    a = ((a * a) | (p * p)) + ((b * a) | (b & a));
+  }
+  if(a < q){
+    b = ((p ^ 52) - (a - 83)) ^ ((b * 78) | (a + a));
+  }else{
+    c = ((p - q) - (d | p)) ^ ((p - 44) ^ (b - q));
+  }
+  return a + b + c + d;
+}
+
+int func128(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 42;
+  d = 74;
+  d = ((p ^ a) | (p + q)) * ((a - a) + (a & a));
+  c = ((q * a) ^ (d ^ c)) | ((q - d) & (c ^ a));
+  b = ((b - c) - (b - q)) ^ ((c | c) | (c - q));
+  a = ((a * p) * (q + c)) * ((b - d) - (a + c));
+  if(a < 82){
+    b = ((p & d) | (b + 21)) * ((b & p) - (d - 75));
+  }else{
+    c = ((c + q) + (b + p)) - ((d - 51) ^ (c * c));
+  }
+  b = ((d & p) - (a * 1)) & ((q ^ 19) * (p - q));
+  for(i = 0; i < 10; i++){
+    a = ((a + d) | (a * a)) | ((q * q) * (q * p));
+  }
+  d = ((c ^ b) + (p * a)) - ((p * c) - (c & p));
+  c = ((p | 44) | (q + p)) - ((c * a) - (b - 31));
+  if(a < b){
+    c = ((a ^ d) ^ (p & a)) + ((c * p) * (d | a));
+  }else{
+    d = ((c & 8) - (q ^ c)) ^ ((a ^ q) + (a + a));
+  }
+  b = ((q & c) + (a ^ b)) ^ ((d + 22) | (d | b));
+  b = ((b + a) - (p * a)) * ((p ^ q) * (p | p));
+  c = ((b & 17) & (b * q)) * ((p * a) | (p - p));
+  for(i = 0; i < 6; i++){
+    c = ((a & 42) & (a & c)) & ((c - p) | (q ^ d));
+  }
+  if(d < a){
+    b = ((c - c) - (d * b)) - ((q * d) + (p & 10));
+  }else{
+    a = ((b - b) & (q * 31)) ^ ((d - c) ^ (q + c));
+  }
+  d = ((p ^ d) - (b + a)) | ((a - 74) + (p + c));
+  d = ((d + p) * (d + 81)) - ((a + 6) | (a + q));
+  b = ((q | q) * (q ^ 51)) & ((c | a) * (b + b));
+  a = ((d - b) | (p - 27)) + ((c & c) + (c + b));
+  if(b < 96){
+    b = ((d + b) - (d & c)) ^ ((c * q) & (q * c));
+  }else{
+    b = ((a & a) ^ (q * a)) - ((c + q) ^ (c * 13));
+  }
+  for(i = 0; i < 6; i++){
+    b = ((a + 88) | (d * d)) ^ ((d - a) + (q ^ q));
+  }
+  d = ((c ^ p) - (a + 9)) & ((a & c) & (d ^ b));
+  a = ((p & 92) * (b ^ 13)) * ((q + 48) - (a - a));
+  b = ((d ^ 99) & (d + 38)) * ((p ^ a) * (q | c));
+  if(b < p){
+    a = ((a & d) + (d * a)) - ((p ^ d) + (q | q));
+  }else{
+    c = ((a - c) * (b ^ a)) * ((b | q) | (c | 38));
+  }
+  c = ((a - c) + (b ^ 13)) ^ ((a - p) & (d & q));
+  c = ((p - b) + (p ^ a)) ^ ((q ^ 13) & (p | a));
+  for(i = 0; i < 28; i++){
+    b = ((q + 15) - (b | d)) - ((a ^ p) - (c - 27));
+  }
+  b = ((q & q) & (a + c)) * ((d - 76) | (p ^ p));
+  if(a < d){
+    c = ((p | d) | (a | 39)) | ((q | 21) + (p ^ c));
+  }else{
+    c = ((c & q) & (a - d)) & ((q + q) ^ (a - c));
+  }
+  c = ((q ^ b) | (p ^ b)) + ((q + 33) & (a ^ a));
+  c = ((q * c) * (b ^ 41)) - ((d - q) | (c * p));
+  b = ((a - c) ^ (q | a)) | ((a * 52) - (b - p));
+  c = ((b & 89) ^ (q * p)) & ((a | c) - (p - q));
+  if(b < b){
+    d = ((b ^ c) * (a + 65)) ^ ((c - a) | (p & b));
+  }else{
+    b = ((a & a) | (c - 60)) & ((c ^ p) & (p - a));
+  }
+  a = ((p * a) ^ (d & a)) * ((q + 87) | (d ^ 5));
+  b = ((p * d) | (q - 17)) - ((p & d) * (a * 90));
+  c = ((q + d) & (a + 92)) & ((p | b) - (b * q));
+  c = ((b - b) | (p & p)) * ((a ^ 90) + (c - b));
+  if(a < b){
+    c = ((c - b) - (p + p)) & ((d - 19) - (q | p));
+  }else{
+    d = ((q - d) | (c & p)) & ((p - a) * (d + a));
+  }
+  d = ((q + b) | (b - 42)) & ((a ^ b) - (a * 9));
+  for(i = 0; i < 41; i++){
+    a = ((d & b) & (a ^ b)) | ((a - a) - (b ^ q));
+  }
+  c = ((b | 67) + (d | d)) & ((d ^ c) | (c + c));
+  d = ((q ^ d) * (d * c)) & ((d ^ 25) + (q ^ c));
+  if(b < b){
+    a = ((p ^ q) * (c - 74)) ^ ((p ^ 82) + (q ^ 42));
+  }else{
+    d = ((a ^ a) ^ (q * b)) + ((d & 48) - (q - q));
+  }
+  b = ((b + q) | (b - p)) ^ ((b * c) ^ (d - 15));
+  b = ((p * p) * (a & d)) - ((p ^ q) ^ (q * 65));
+  d = ((q | p) ^ (q - 65)) * ((q & c) & (d + p));
+  for(i = 0; i < 26; i++){
+    c = ((a | d) + (a ^ q)) * ((p - d) | (d | p));
+  }
+  if(b < a){
+    b = ((p & 9) & (a & d)) | ((b | p) * (p * b));
+  }else{
+    c = ((p * q) ^ (d - 51)) & ((d * a) & (b ^ 28));
+  }
+  return a + b + c + d;
+}
+
+int func129(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 15;
+  d = 56;
+  b = ((d + c) & (q - c)) | ((q ^ c) & (p & c));
+  c = ((b & q) - (b & a)) - ((b | p) - (d & c));
+  d = ((a | 21) | (p - 45)) | ((b & p) | (c & a));
+  b = ((p | p) - (c | 22)) * ((b | d) - (q - c));
+  if(c < 79){
+    d = ((p + 39) * (c - a)) ^ ((p - d) & (b & d));
+  }else{
+    a = ((a + q) + (q ^ 76)) & ((a - b) ^ (q + q));
+  }
+  a = ((q - 28) - (a | c)) * ((a ^ 29) & (p - c));
+  for(i = 0; i < 9; i++){
+    d = ((c ^ b) ^ (b & 61)) | ((q ^ p) ^ (d * c));
+  }
+  b = ((q - q) - (b - a)) * ((c - d) & (c * c));
+  a = ((p & 86) | (p | b)) ^ ((d ^ d) + (p + 6));
+  if(c < 33){
+    d = ((q & a) | (q * b)) - ((q ^ q) & (d * d));
+  }else{
+    a = ((q * c) - (q * p)) ^ ((d * d) & (q | a));
+  }
+  a = ((p | 18) & (b + p)) - ((c * p) * (p - q));
+  a = ((p - 30) + (b + b)) | ((b & b) | (q ^ b));
+  d = ((q + a) & (d ^ c)) | ((q + d) ^ (q & d));
+  for(i = 0; i < 14; i++){
+    c = ((p - a) + (d ^ b)) & ((d ^ b) * (q & d));
+  }
+  if(d < q){
+    a = ((q + b) | (a * q)) ^ ((a + d) & (a - q));
+  }else{
+    b = ((q + 74) ^ (p * b)) * ((b + 42) - (p + c));
+  }
+  d = ((p & b) | (a + 71)) - ((q ^ 6) & (a | a));
+  a = ((q | p) * (a * q)) * ((d ^ b) & (c & 79));
+  c = ((p | p) & (c - a)) ^ ((p | a) * (b ^ b));
+  d = ((p | d) ^ (c - c)) * ((d - p) ^ (p | d));
+  if(b < d){
+    a = ((a ^ 42) ^ (b & 23)) * ((c | b) - (c & c));
+  }else{
+    c = ((b + b) & (c | p)) * ((d * 17) ^ (a - c));
+  }
+  for(i = 0; i < 46; i++){
+    d = ((a & c) | (d | a)) | ((d ^ a) - (c & c));
+  }
+  a = ((b + 38) & (b ^ 53)) + ((q & d) - (d + d));
+  c = ((a | d) - (b | b)) - ((c * a) ^ (p | p));
+  a = ((p * c) ^ (d | b)) ^ ((q | 31) - (a ^ 9));
+  if(b < p){
+    c = ((p - q) | (b | a)) + ((b * p) + (d + 3));
+  }else{
+    d = ((d & 83) + (q + 82)) - ((d & d) & (q & c));
+  }
+  a = ((c - 70) | (q * a)) ^ ((d & a) * (d ^ a));
+  a = ((q - a) - (d ^ c)) - ((q + a) & (c | q));
+  for(i = 0; i < 15; i++){
+    c = ((q + a) + (b - 54)) ^ ((p & p) & (a - a));
+  }
+  b = ((a * 10) & (d | q)) & ((c | 61) - (q & d));
+  if(b < c){
+    d = ((b & b) - (b & b)) & ((q & p) & (p + c));
+  }else{
+    c = ((a ^ d) ^ (a & 36)) - ((q - b) & (a | 82));
+  }
+  d = ((d ^ 46) ^ (a + a)) - ((b & q) * (b + c));
+  c = ((a + a) | (c + b)) - ((a + 34) + (q - 50));
+  c = ((c & d) + (a ^ c)) - ((d + 20) + (d | q));
+  c = ((d ^ q) + (p - d)) | ((b & a) * (c | p));
+  if(d < 19){
+    a = ((c * d) & (p + d)) + ((q | d) & (b & a));
+  }else{
+    c = ((d ^ 84) + (p & 4)) - ((b | 43) & (c * p));
+  }
+  a = ((c + q) | (q - q)) & ((a - d) & (c ^ a));
+  b = ((d | q) & (p & c)) * ((a & c) - (c - a));
+  d = ((c * b) ^ (b + c)) & ((d | b) - (a - a));
+  b = ((q * 9) & (a - 82)) & ((c ^ c) ^ (p * a));
+  if(b < a){
+    d = ((d * c) - (p | q)) ^ ((b + p) & (d ^ 25));
+  }else{
+    a = ((q + a) * (a | 21)) & ((b | 77) - (b ^ 15));
+  }
+  d = ((a + b) | (c & 68)) & ((q * c) ^ (c - a));
+  for(i = 0; i < 20; i++){
+    b = ((a + d) - (a | 43)) * ((c ^ 12) * (d * q));
+  }
+  a = ((d | p) + (a * c)) - ((c * c) & (d * 27));
+  c = ((q * c) & (a ^ 11)) - ((q ^ c) ^ (a * a));
+  if(d < b){
+    a = ((b | p) ^ (b + 53)) & ((b - p) & (p & a));
+  }else{
+    a = ((a + a) ^ (a | 66)) * ((d ^ q) - (q - c));
+  }
+  c = ((a * b) + (b | p)) & ((a - 2) + (d * d));
+  a = ((d * b) | (a - a)) | ((q - 19) & (q ^ p));
+  d = ((a + q) & (q + p)) * ((q | 10) * (d * 15));
+  for(i = 0; i < 24; i++){
+    a = ((a + 38) + (p + c)) * ((d ^ 49) * (a + d));
+  }
+  if(b < b){
+    d = ((d ^ b) & (q + c)) * ((q ^ b) ^ (p ^ a));
+  }else{
+    c = ((b * a) & (q | 38)) ^ ((q & 40) + (b + 42));
+  }
+  return a + b + c + d;
+}
+
+int func130(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 28;
+  d = 3;
+  a = ((a & 41) + (p | 57)) ^ ((b ^ c) * (d & a));
+  b = ((d - 16) + (a - 37)) - ((d ^ a) * (a + a));
+  d = ((a + d) * (a & b)) * ((d + p) & (d & 3));
+  d = ((c * 2) - (c * d)) ^ ((b & c) ^ (b & b));
+  if(d < b){
+    a = ((a & q) ^ (b * 26)) - ((q ^ a) * (c & d));
+  }else{
+    c = ((b - p) * (p - d)) + ((p & q) | (a & p));
+  }
+  a = ((a & q) + (c ^ a)) * ((a | a) + (a - d));
+  for(i = 0; i < 39; i++){
+    b = ((q - d) & (b | q)) + ((a * 87) ^ (d & 72));
+  }
+  a = ((a * q) - (q | q)) ^ ((b - 73) ^ (a - c));
+  c = ((p - a) & (b - b)) - ((p ^ b) ^ (b & 43));
+  if(b < a){
+    c = ((p | p) * (d | b)) | ((d + a) - (a | 98));
+  }else{
+    d = ((p * b) - (b ^ 73)) | ((p | p) * (c - q));
+  }
+  d = ((a * d) ^ (d * 17)) + ((d + d) | (q * p));
+  a = ((p | q) | (d ^ b)) - ((d | b) + (q * b));
+  a = ((c ^ b) | (c + 97)) & ((c & b) ^ (q & a));
+  for(i = 0; i < 15; i++){
+    a = ((d + 37) | (a + c)) ^ ((b - 1) + (c * a));
+  }
+  if(c < a){
+    a = ((q + 11) & (q ^ b)) * ((d - p) | (p * 39));
+  }else{
+    b = ((a + p) & (d & d)) * ((p + q) & (q + 92));
+  }
+  d = ((p & 39) & (b ^ a)) | ((a + 94) - (q & 2));
+  d = ((a ^ c) & (a - b)) ^ ((a | c) & (a ^ q));
+  d = ((d & d) * (a * q)) + ((b + 79) - (q * 96));
+  d = ((p ^ d) * (q * 54)) ^ ((d - q) * (d - 87));
+  if(d < 4){
+    b = ((b & 88) | (a * p)) * ((a - a) + (p - 47));
+  }else{
+    b = ((d + 59) - (d ^ 28)) ^ ((q ^ 62) * (b * a));
+  }
+  for(i = 0; i < 30; i++){
+    d = ((a & a) - (c * a)) & ((b ^ b) * (q * q));
+  }
+  c = ((q * q) * (b | c)) | ((c * c) | (c * p));
+  b = ((c | d) - (a - q)) * ((q - c) & (c + c));
+  c = ((c * q) - (c - 27)) ^ ((a - b) + (p * p));
+  if(d < 24){
+    a = ((a - d) | (c ^ a)) + ((b | a) + (d | q));
+  }else{
+    d = ((p * q) * (b ^ p)) - ((c | d) | (a * p));
+  }
+  b = ((d - q) ^ (b & p)) * ((q ^ 6) * (d ^ 57));
+  a = ((c - b) ^ (c ^ p)) ^ ((a ^ a) + (d | d));
+  for(i = 0; i < 23; i++){
+    c = ((d ^ 33) + (c - 53)) | ((p & 98) - (p + d));
+  }
+  d = ((c * d) & (q ^ 25)) & ((d & b) - (p | d));
+  if(a < q){
+    c = ((d * b) * (a - 50)) & ((c ^ a) & (c + b));
+  }else{
+    a = ((p * 13) ^ (q ^ a)) + ((q - a) & (p | p));
+  }
+  d = ((q + d) | (p | 62)) ^ ((d & p) - (d + c));
+  d = ((c - 41) ^ (a - c)) | ((a * c) & (d | b));
+  d = ((b - q) & (d + d)) * ((p - 41) & (p ^ b));
+  a = ((d | d) * (a | p)) + ((p & d) & (p | 16));
+  if(c < 38){
+    b = ((d * d) & (q * a)) | ((b * b) * (d & d));
+  }else{
+    b = ((c | p) + (b * 70)) ^ ((p ^ 18) * (q * 47));
+  }
+  c = ((d - a) - (b - d)) - ((c & d) + (a * p));
+  c = ((d ^ c) * (a ^ c)) * ((p | 62) - (d - b));
+  b = ((c * b) * (p * b)) - ((p + q) - (d | d));
+  c = ((a | q) & (p * q)) | ((b & q) ^ (b + a));
+  if(c < a){
+    d = ((b + c) * (p ^ 82)) - ((c & q) ^ (p | a));
+  }else{
+    d = ((b ^ a) * (d ^ a)) ^ ((b & b) | (b + p));
+  }
+  c = ((d * b) | (b + 45)) ^ ((b ^ q) & (d + b));
+  for(i = 0; i < 18; i++){
+    d = ((a - b) | (a + 92)) + ((d - 88) + (c * 88));
+  }
+  d = ((d | a) ^ (c ^ a)) | ((a | p) + (q * 22));
+  c = ((p - q) * (b & c)) | ((d + a) | (a + 10));
+  if(c < b){
+    c = ((d + p) | (c + b)) | ((p * a) * (c * b));
+  }else{
+    c = ((c - p) ^ (q ^ p)) | ((b + p) - (a ^ b));
+  }
+  b = ((a ^ 66) - (c | p)) | ((d ^ a) | (q ^ b));
+  d = ((b + a) * (p + a)) * ((q * q) | (c | c));
+  b = ((p ^ 83) + (q - b)) | ((d * p) | (d * d));
+  for(i = 0; i < 18; i++){
+    b = ((p ^ a) & (d * d)) + ((a * q) ^ (p & 12));
+  }
+  if(b < 68){
+    a = ((b - p) - (p ^ 3)) + ((a - 62) * (d * 6));
+  }else{
+    b = ((b | p) + (d ^ q)) | ((c + q) - (p - d));
+  }
+  return a + b + c + d;
+}
+
+int func131(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 65;
+  d = 50;
+  d = ((c + 21) | (p - c)) * ((c + a) - (d ^ d));
+  a = ((b ^ c) & (c + q)) & ((p & q) * (b + p));
+  b = ((d * a) ^ (d - c)) - ((b + 77) + (p | 84));
+  b = ((a ^ q) - (b | a)) ^ ((a + a) + (d + q));
+  if(a < d){
+    c = ((b ^ p) * (a * q)) - ((b - b) + (b | 99));
+  }else{
+    d = ((q + 17) - (q + a)) & ((a | 57) ^ (b & 48));
+  }
+  d = ((q + d) + (b - b)) ^ ((a - 2) & (c & c));
+  for(i = 0; i < 36; i++){
+    a = ((p & q) & (q - a)) - ((q - a) ^ (q - d));
+  }
+  a = ((p | c) | (c ^ p)) + ((a | b) | (a - b));
+  c = ((a + p) & (d & 81)) + ((p + q) & (c | 15));
+  if(b < 29){
+    a = ((a - 48) * (c | b)) + ((b * 48) ^ (c | b));
+  }else{
+    a = ((p | b) & (d ^ 57)) | ((c ^ q) ^ (a | 88));
+  }
+  b = ((a ^ c) & (d + 65)) | ((a | p) + (p * b));
+  a = ((p - d) | (q | p)) ^ ((q & b) & (b ^ b));
+  b = ((q ^ c) | (p + c)) * ((c * a) ^ (d | 80));
+  for(i = 0; i < 20; i++){
+    a = ((c ^ 39) ^ (a & 52)) | ((b ^ a) - (b - c));
+  }
+  if(a < a){
+    c = ((p * b) ^ (q + a)) * ((d & a) | (q ^ p));
+  }else{
+    b = ((d ^ 48) + (a & a)) - ((d - q) | (d ^ 3));
+  }
+  c = ((d + 86) - (a | q)) * ((q ^ b) & (b * b));
+  a = ((b | b) + (p & p)) | ((q | p) + (d + q));
+  d = ((d | b) ^ (b - p)) | ((p ^ a) | (d | 48));
+  a = ((b + c) + (d & 78)) ^ ((d & c) | (p & p));
+  if(d < d){
+    b = ((q | p) - (c - 34)) - ((c - c) ^ (a ^ p));
+  }else{
+    b = ((d * q) + (c * 96)) | ((d ^ d) * (d + 32));
+  }
+  for(i = 0; i < 28; i++){
+    b = ((d - 41) & (a ^ q)) | ((c * b) * (a ^ 49));
+  }
+  d = ((q ^ d) + (q + d)) * ((b ^ q) ^ (p | a));
+  d = ((b * a) ^ (p & q)) - ((q + b) ^ (b | d));
+  a = ((p * a) * (p ^ b)) + ((b - d) ^ (b & c));
+  if(b < b){
+    c = ((q ^ a) ^ (c | d)) * ((d - a) ^ (p + d));
+  }else{
+    b = ((b | 34) | (q ^ p)) * ((c + d) - (d | c));
+  }
+  a = ((c * p) - (c + q)) - ((d - 81) - (p ^ 17));
+  d = ((d ^ p) * (b | q)) & ((b * c) | (b | a));
+  for(i = 0; i < 5; i++){
+    a = ((d + p) * (a - a)) ^ ((p * d) | (q | a));
+  }
+  d = ((q * c) * (c + d)) + ((b & 15) | (d ^ b));
+  if(b < d){
+    c = ((a - 39) + (a - a)) + ((c + d) ^ (q | 44));
+  }else{
+    b = ((p | 8) ^ (p | a)) & ((d * 62) * (b - 64));
+  }
+  a = ((b + b) * (q * 84)) - ((a * q) ^ (c & a));
+  d = ((c | 22) ^ (b * 21)) * ((b | 69) ^ (p | 87));
+  a = ((b & 93) - (c ^ 81)) + ((b & c) | (p ^ 66));
+  d = ((q - 7) ^ (p * p)) & ((p * p) * (b + a));
+  if(b < 63){
+    a = ((c - a) - (b * 13)) - ((q | c) | (p & b));
+  }else{
+    d = ((b | c) * (q - 33)) - ((b * 75) * (d + 38));
+  }
+  a = ((c * q) ^ (c + c)) | ((b & a) | (q - a));
+  b = ((d ^ 89) ^ (p | b)) * ((a ^ c) + (c | p));
+  b = ((a - a) * (d | a)) ^ ((b & 16) + (b - p));
+  c = ((b + q) & (a - p)) | ((b - q) | (c - b));
+  if(b < p){
+    d = ((p * 74) | (q & 8)) * ((c | q) - (a + q));
+  }else{
+    b = ((b ^ d) * (c + d)) + ((p & p) ^ (b & b));
+  }
+  a = ((p - q) + (q - q)) + ((b | p) + (c * d));
+  for(i = 0; i < 36; i++){
+    c = ((p ^ d) + (p - q)) + ((d - q) | (b ^ b));
+  }
+  b = ((d | d) - (c * p)) * ((a + d) & (p - d));
+  a = ((a ^ b) ^ (d & p)) - ((q ^ 19) - (a & c));
+  if(c < a){
+    c = ((q | d) & (a | 58)) + ((d | d) ^ (d - a));
+  }else{
+    d = ((b | 13) * (a - 99)) * ((q ^ a) & (b ^ a));
+  }
+  a = ((p - b) + (q + c)) & ((q ^ a) ^ (p & p));
+  b = ((p ^ b) * (b + d)) ^ ((b + c) | (p | 59));
+  a = ((b ^ p) * (b ^ a)) & ((a * 98) + (a ^ q));
+  for(i = 0; i < 14; i++){
+    a = ((b + p) ^ (c + d)) & ((b | d) - (d | c));
+  }
+  if(b < q){
+    a = ((q * b) * (d - c)) & ((b & 20) & (b | d));
+  }else{
+    b = ((p | 24) * (a ^ q)) & ((c + a) * (p & c));
+  }
+  return a + b + c + d;
+}
+
+int func132(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 92;
+  d = 42;
+  b = ((d ^ q) ^ (a - 52)) ^ ((c - q) | (a & a));
+  d = ((d * d) * (q | p)) & ((a & 33) + (q ^ b));
+  a = ((d | b) + (a * c)) | ((b * p) * (q | a));
+  c = ((c + c) & (d - 87)) & ((d + c) | (q & c));
+  if(c < p){
+    a = ((d + q) ^ (b ^ a)) + ((q + b) & (b - b));
+  }else{
+    b = ((d + 16) | (q ^ b)) - ((a ^ a) - (a | p));
+  }
+  d = ((q + a) ^ (p * a)) - ((p ^ a) & (d & b));
+  for(i = 0; i < 45; i++){
+    c = ((q & p) & (b | a)) ^ ((d + c) - (d | a));
+  }
+  d = ((c | a) & (q + p)) ^ ((q - d) - (b ^ 37));
+  a = ((a - 39) - (d | 24)) - ((q * c) + (a ^ p));
+  if(c < q){
+    d = ((q - b) * (q & 71)) & ((b * c) * (q + 27));
+  }else{
+    a = ((a | p) ^ (c - c)) + ((q + c) * (q ^ a));
+  }
+  d = ((p - 80) * (b & 87)) | ((q - q) ^ (d ^ q));
+  b = ((p ^ b) * (p & 27)) * ((a & 17) - (c * a));
+  a = ((a * d) ^ (d | d)) | ((c | a) + (q | q));
+  for(i = 0; i < 18; i++){
+    d = ((q ^ 68) | (p | b)) | ((c + d) + (q | 60));
+  }
+  if(b < q){
+    c = ((q ^ d) ^ (d ^ b)) & ((q - p) | (b ^ q));
+  }else{
+    a = ((q ^ 12) + (p + b)) * ((a | b) | (q - c));
+  }
+  b = ((c ^ b) & (b ^ 32)) + ((d + p) + (q - 64));
+  a = ((q & q) - (a | 30)) * ((a ^ q) - (a + a));
+  b = ((p | a) & (c - q)) * ((b - 84) & (p + a));
+  d = ((b | q) - (d * 56)) & ((c + c) | (c | q));
+  if(a < c){
+    d = ((q | 49) + (b * a)) | ((b + p) * (c * p));
+  }else{
+    d = ((c + p) + (a ^ c)) | ((a ^ b) * (c + p));
+  }
+  for(i = 0; i < 25; i++){
+    c = ((a - a) + (b ^ b)) * ((q ^ 21) | (a | d));
+  }
+  c = ((p & q) * (d + q)) - ((c ^ b) + (a * p));
+  c = ((a + c) | (d - q)) ^ ((p | p) & (d | b));
+  d = ((d * q) ^ (c | 89)) * ((p & 61) + (d * a));
+  if(c < 70){
+    d = ((a - 52) + (b & a)) - ((a - c) + (c - b));
+  }else{
+    d = ((b | b) * (b ^ 72)) & ((q + b) - (q + a));
+  }
+  c = ((b + b) & (p - a)) ^ ((b | b) & (q - q));
+  b = ((q & c) & (b & q)) ^ ((c | d) + (c + a));
+  for(i = 0; i < 20; i++){
+    a = ((p & c) * (p | 79)) - ((p & 93) & (p & c));
+  }
+  d = ((p & 44) - (a - 74)) ^ ((a + p) | (c | a));
+  if(b < c){
+    d = ((c ^ b) + (d + p)) ^ ((a * p) & (c * b));
+  }else{
+    a = ((d * a) + (q & a)) + ((c * b) & (a - a));
+  }
+  d = ((a * c) ^ (p | d)) * ((c - 72) & (d + c));
+  d = ((b & d) ^ (b * a)) - ((c + q) - (d - p));
+  d = ((a & b) - (p | a)) | ((c - 94) | (b + p));
+  a = ((c & p) - (d * c)) + ((d | d) ^ (q - a));
+  if(c < 23){
+    a = ((c ^ 26) - (c * 56)) ^ ((c ^ d) + (c | 19));
+  }else{
+    d = ((b | 82) & (b | q)) + ((q | p) | (b + c));
+  }
+  a = ((b + 32) | (a | p)) ^ ((p * c) & (b * q));
+  c = ((d ^ d) | (b * q)) ^ ((d - 32) + (q ^ a));
+  d = ((q * 56) | (d - 97)) ^ ((b + 64) + (p * 61));
+  c = ((q & 97) & (b + a)) & ((q | 70) ^ (d | a));
+  if(b < a){
+    a = ((a & a) & (a + 24)) - ((c * b) ^ (p | 26));
+  }else{
+    d = ((d - b) & (q * c)) ^ ((q + a) + (q | d));
+  }
+  d = ((b | c) + (a * a)) ^ ((b & b) & (q * q));
+  for(i = 0; i < 49; i++){
+    c = ((p & d) & (q & b)) ^ ((d & 42) | (q - c));
+  }
+  a = ((b | c) * (d & a)) - ((c | a) * (d | q));
+  d = ((p | c) + (a & 58)) - ((c - c) | (d & q));
+  if(d < d){
+    a = ((p - d) & (p | b)) + ((d - 32) - (b - 50));
+  }else{
+    a = ((q ^ q) ^ (p & c)) * ((a ^ 25) ^ (p | d));
+  }
+  a = ((a * 37) ^ (d * p)) | ((c * b) - (q ^ 55));
+  c = ((p & b) - (b - c)) + ((c ^ b) | (d - c));
+  b = ((c | b) - (c * c)) + ((b - p) | (b | q));
+  for(i = 0; i < 19; i++){
+    a = ((d ^ 57) | (q + 71)) - ((p + 40) + (q - a));
+  }
+  if(a < c){
+    a = ((a * 10) - (c | a)) * ((q * d) + (p - 38));
+  }else{
+    d = ((q * d) | (c * a)) + ((q ^ a) - (a * p));
+  }
+  return a + b + c + d;
+}
+
+int func133(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 78;
+  d = 73;
+  c = ((p - d) * (q - a)) ^ ((a - p) + (b - 1));
+  a = ((p | q) + (p | 67)) ^ ((c - 33) | (p - 2));
+  a = ((a - 60) - (d | a)) + ((q * q) * (c & 72));
+  d = ((q & b) - (d & 64)) * ((b + 52) ^ (d ^ 18));
+  if(b < q){
+    c = ((d & a) - (b ^ b)) + ((a ^ c) ^ (a | 89));
+  }else{
+    a = ((q & a) | (q - p)) - ((a + 34) - (p & a));
+  }
+  c = ((c + b) & (p * d)) + ((p | a) ^ (d | 79));
+  for(i = 0; i < 25; i++){
+    d = ((q - 83) * (d * b)) & ((a & d) - (p | q));
+  }
+  c = ((b & c) ^ (c - 6)) * ((b | 26) | (a - a));
+  c = ((d - q) * (q | c)) + ((a | 41) + (d * a));
+  if(a < d){
+    a = ((b & 25) - (p + d)) | ((q - 93) - (q | d));
+  }else{
+    b = ((d - a) | (a + q)) * ((p * 32) & (q | d));
+  }
+  c = ((d - a) + (p * q)) + ((b ^ p) - (b * p));
+  c = ((p * q) - (q * b)) * ((c - c) ^ (p | a));
+  d = ((p ^ q) - (p + a)) & ((p - p) ^ (b ^ a));
+  for(i = 0; i < 27; i++){
+    d = ((q * 5) + (c ^ d)) | ((d + d) & (b & a));
+  }
+  if(d < 5){
+    d = ((d | 39) & (c + 9)) * ((a + a) + (b + b));
+  }else{
+    c = ((q & c) ^ (p + 30)) | ((q & p) * (q | b));
+  }
+  c = ((p * p) + (d ^ 74)) - ((d ^ d) | (p | q));
+  a = ((p * p) ^ (b & 2)) + ((a & d) + (q | 40));
+  b = ((b * c) + (d + c)) - ((d ^ b) ^ (a - d));
+  d = ((c | b) * (d + q)) | ((a | b) * (p + d));
+  if(b < 48){
+    c = ((b ^ q) + (b & q)) ^ ((b - a) * (c - d));
+  }else{
+    b = ((d + 34) & (d * 16)) ^ ((p * 87) | (d ^ a));
+  }
+  for(i = 0; i < 2; i++){
+    b = ((p * q) - (d * q)) - ((p * c) - (q ^ b));
+  }
+  a = ((b | 65) | (a | p)) ^ ((c * 90) | (c + p));
+  b = ((p ^ q) * (q | b)) - ((b * p) * (d - a));
+  b = ((a + q) - (d - 60)) | ((a + 80) | (d | q));
+  if(a < p){
+    b = ((a ^ a) | (c + p)) + ((c & b) ^ (b - p));
+  }else{
+    a = ((d + b) * (c - p)) * ((a - 99) ^ (q + q));
+  }
+  a = ((a - d) + (c - a)) | ((q | p) ^ (c + 63));
+  a = ((q | 44) & (c ^ b)) - ((p | a) + (q & c));
+  for(i = 0; i < 37; i++){
+    b = ((b - c) + (a ^ b)) ^ ((d - d) & (p & a));
+  }
+  c = ((d - 91) - (b | d)) | ((c & a) * (d | p));
+  if(d < b){
+    d = ((b + 59) - (c & 87)) * ((p - c) | (d & c));
+  }else{
+    d = ((b | a) | (d - 21)) + ((d - a) + (q - b));
+  }
+  c = ((b | c) & (a ^ b)) | ((c | a) + (b + b));
+  b = ((q ^ a) | (q & p)) - ((q + a) - (d - 36));
+  c = ((p * 45) | (d & 8)) ^ ((a + d) & (a & a));
+  c = ((c * b) + (b & c)) & ((q + b) + (q * d));
+  if(c < 25){
+    a = ((a + d) & (q + a)) | ((q * p) | (b * d));
+  }else{
+    b = ((a - b) & (c ^ d)) + ((b * q) - (b * c));
+  }
+  d = ((a + b) * (d ^ p)) + ((b * 5) * (q ^ 24));
+  c = ((q ^ 92) ^ (q * 20)) * ((b & b) | (p ^ c));
+  c = ((c ^ a) * (d | p)) - ((c + 59) & (p ^ d));
+  d = ((b & p) | (d ^ p)) ^ ((q + p) + (d - 39));
+  if(d < c){
+    d = ((d ^ 51) * (p ^ d)) * ((p + q) & (c & 49));
+  }else{
+    d = ((q - 30) - (c - a)) & ((q * c) - (c & 96));
+  }
+  d = ((p ^ a) | (b & a)) ^ ((q * 50) + (c ^ p));
+  for(i = 0; i < 39; i++){
+    d = ((d * c) + (c | a)) ^ ((p | 19) | (c + c));
+  }
+  d = ((c * 7) * (b * 34)) + ((a & q) * (d | q));
+  d = ((q * c) - (p - p)) & ((p & p) * (a | p));
+  if(d < d){
+    c = ((q | d) - (b | a)) * ((p & d) - (a * b));
+  }else{
+    c = ((c ^ b) & (c & a)) & ((q ^ c) * (b & b));
+  }
+  c = ((a | q) | (q - d)) | ((q - b) & (q ^ a));
+  d = ((p & 42) + (p ^ c)) - ((a | c) | (p + c));
+  d = ((q ^ 53) * (p + q)) ^ ((a + p) - (b - a));
+  for(i = 0; i < 10; i++){
+    c = ((q + c) ^ (d | b)) * ((a * q) | (a ^ b));
+  }
+  if(c < 98){
+    c = ((p * c) ^ (p ^ d)) - ((a * a) | (p ^ q));
+  }else{
+    c = ((c & d) + (a & a)) + ((d * q) ^ (p & a));
+  }
+  return a + b + c + d;
+}
+
+int func134(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 45;
+  d = 70;
+  b = ((c - 81) * (p ^ b)) * ((b & a) ^ (p ^ p));
+  c = ((q ^ c) | (c + d)) + ((d + 39) | (b | a));
+  b = ((c & p) + (b + p)) - ((a | c) ^ (p + d));
+  a = ((b | b) ^ (b + a)) - ((q - b) | (q * d));
+  if(b < 80){
+    b = ((b | q) & (d ^ a)) * ((a & 57) * (p & q));
+  }else{
+    a = ((b - p) | (b & d)) & ((b * c) - (b | 47));
+  }
+  d = ((c | a) - (b ^ 92)) * ((q * d) & (b - 32));
+  for(i = 0; i < 9; i++){
+    a = ((d ^ a) & (a | d)) ^ ((a * q) ^ (q + q));
+  }
+  c = ((q ^ 69) ^ (b - 87)) - ((b | d) & (c + b));
+  b = ((q + c) + (q ^ 59)) * ((c + d) - (q - a));
+  if(a < 90){
+    b = ((q | c) & (p | p)) + ((q + 86) & (a & b));
+  }else{
+    a = ((q ^ c) + (q & c)) & ((q & c) & (a & d));
+  }
+  a = ((b ^ 49) - (c - 70)) * ((d - p) - (q - p));
+  a = ((b ^ p) * (c & 20)) - ((c + a) ^ (d | 91));
+  c = ((b * c) + (p & b)) - ((a * b) * (b | b));
+  for(i = 0; i < 49; i++){
+    b = ((d | a) | (p - d)) | ((p ^ p) + (b - a));
+  }
+  if(a < a){
+    a = ((q | b) * (d ^ c)) - ((q + c) ^ (p ^ p));
+  }else{
+    c = ((c & 97) ^ (c - 18)) + ((p - 61) | (p - q));
+  }
+  d = ((b | d) | (q & 15)) | ((c + 72) * (d - a));
+  c = ((d + q) & (b | a)) ^ ((q ^ c) * (q * q));
+  b = ((b ^ b) | (b & 25)) ^ ((d - p) - (q & q));
+  d = ((q - d) | (a ^ q)) | ((b * q) & (a + d));
+  if(b < p){
+    b = ((b * c) & (b | 70)) ^ ((a & c) ^ (d | q));
+  }else{
+    a = ((c - 69) & (c | 4)) - ((c ^ a) + (q & b));
+  }
+  for(i = 0; i < 45; i++){
+    b = ((p ^ 21) - (b * 30)) - ((a * a) | (b + q));
+  }
+  c = ((c * a) & (b * 43)) + ((q ^ b) - (a | 39));
+  d = ((q + 78) & (b | 18)) - ((a - 3) * (b ^ p));
+  c = ((d | 9) & (q | p)) ^ ((a & q) ^ (d - 85));
+  if(d < p){
+    d = ((d ^ a) | (p & 15)) ^ ((b ^ b) | (q & 84));
+  }else{
+    d = ((p & a) | (q * p)) & ((q * b) ^ (d - c));
+  }
+  a = ((c ^ p) & (c & 51)) + ((c | q) ^ (p - d));
+  b = ((q + c) & (p | 3)) & ((b & 88) & (a & p));
+  for(i = 0; i < 48; i++){
+    a = ((b - b) | (p - 41)) - ((d | b) & (p - c));
+  }
+  d = ((a - p) - (a ^ 53)) + ((d * a) + (d | c));
+  if(a < 49){
+    a = ((a + d) | (q * b)) | ((c & d) ^ (p | 36));
+  }else{
+    c = ((c + p) | (c * 50)) & ((d * d) & (a + d));
+  }
+  b = ((d | a) - (q ^ 66)) * ((a * c) | (d - p));
+  c = ((d - 25) | (p ^ 47)) | ((c + 21) * (p + c));
+  a = ((a - c) | (b - p)) ^ ((b | 36) * (q * d));
+  b = ((c + 15) ^ (c - 27)) | ((c * 27) ^ (b + p));
+  if(c < q){
+    b = ((q & d) + (p ^ b)) - ((c ^ p) ^ (c * p));
+  }else{
+    c = ((d ^ c) * (a + 37)) * ((b * 96) + (q * q));
+  }
+  c = ((q ^ 33) * (c & a)) * ((p & p) - (q * 31));
+  d = ((a * d) & (q * b)) * ((c | p) | (c - q));
+  d = ((p & c) ^ (a & d)) * ((b ^ 64) ^ (q ^ d));
+  b = ((c & p) + (p + 36)) | ((p ^ d) | (d - p));
+  if(a < 32){
+    a = ((c | b) * (p + d)) ^ ((p | a) + (p | q));
+  }else{
+    c = ((c * q) + (c - q)) + ((a + a) | (a - q));
+  }
+  d = ((p ^ a) * (q - 96)) - ((a & b) - (p * c));
+  for(i = 0; i < 49; i++){
+    a = ((q | 35) + (d * d)) | ((p + a) * (b - p));
+  }
+  a = ((a + b) * (b - a)) - ((q | c) & (q & b));
+  c = ((b + b) * (c & p)) & ((q - b) + (q & p));
+  if(a < d){
+    b = ((b - d) - (a * 73)) ^ ((d ^ a) & (b - 84));
+  }else{
+    d = ((d - p) & (c | b)) - ((d + c) | (d * 5));
+  }
+  a = ((c ^ a) ^ (q * b)) | ((p * a) ^ (c * b));
+  d = ((q - 61) + (a & q)) - ((d + d) ^ (c & a));
+  d = ((a * c) ^ (a & q)) * ((q - 92) ^ (d & b));
+  for(i = 0; i < 9; i++){
+    a = ((b ^ 96) * (p | p)) | ((c + q) & (p | 94));
+  }
+  if(b < p){
+    c = ((d + 1) & (c & d)) & ((b ^ b) ^ (a * 36));
+  }else{
+    b = ((p | 61) * (b + q)) - ((q | q) ^ (p & 95));
+  }
+  return a + b + c + d;
+}
+
+int func135(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 82;
+  d = 50;
+  a = ((c | q) | (p + c)) | ((c * q) + (p & c));
+  a = ((q + d) ^ (p - 74)) & ((b + 78) * (a - a));
+  d = ((c ^ c) - (b & c)) & ((p * 34) & (p * 50));
+  b = ((p + 70) * (a & d)) & ((b + a) & (q ^ b));
+  if(b < 8){
+    a = ((a + d) + (d - a)) & ((d * p) ^ (c | 40));
+  }else{
+    b = ((q * q) & (c - c)) & ((q + q) - (b - d));
+  }
+  a = ((q * d) ^ (b - 39)) - ((q - c) ^ (d & b));
+  for(i = 0; i < 48; i++){
+    b = ((a + c) | (a | 76)) ^ ((a + c) * (d * c));
+  }
+  d = ((c & a) + (c ^ q)) * ((q - 69) ^ (a + 15));
+  d = ((d - q) + (q ^ d)) & ((d | b) * (d - d));
+  if(b < d){
+    c = ((d + q) + (q & q)) + ((a + d) ^ (q ^ q));
+  }else{
+    c = ((q | c) ^ (b & c)) - ((q & 54) & (c - c));
+  }
+  b = ((b ^ a) ^ (q ^ c)) - ((d & q) | (a ^ c));
+  a = ((p + b) ^ (b - b)) | ((c | 27) + (a & d));
+  a = ((p - b) + (a * b)) & ((b ^ 80) * (a - q));
+  for(i = 0; i < 15; i++){
+    b = ((q | b) + (c * q)) - ((d & b) & (b | b));
+  }
+  if(c < d){
+    b = ((d ^ 85) + (a - a)) + ((a + q) - (b - p));
+  }else{
+    b = ((q * d) + (q - b)) ^ ((a * 89) ^ (c | c));
+  }
+  a = ((c * 21) - (q | q)) ^ ((p * 24) * (c ^ b));
+  a = ((b * b) & (d + c)) | ((q & a) ^ (a ^ 89));
+  c = ((p - d) | (p | 65)) ^ ((d - 99) * (p * 93));
+  c = ((b + p) | (q | a)) - ((b + a) | (d & q));
+  if(b < q){
+    d = ((q & 95) ^ (c & d)) | ((a | 11) - (b + 31));
+  }else{
+    d = ((d + b) * (b - b)) & ((q * 1) * (d | q));
+  }
+  for(i = 0; i < 30; i++){
+    b = ((b * p) | (d ^ 31)) + ((c + q) | (q - a));
+  }
+  d = ((p | 33) & (p - a)) ^ ((a | q) ^ (q * c));
+  d = ((c | p) & (d - d)) | ((p & b) - (b - d));
+  c = ((c * p) * (p + 99)) & ((c + p) - (b - d));
+  if(b < b){
+    a = ((p * 70) & (b * d)) & ((c & a) * (c - 75));
+  }else{
+    c = ((a * q) + (d & q)) & ((a * d) | (d ^ d));
+  }
+  c = ((c ^ 52) ^ (a + p)) * ((b ^ 47) & (q - a));
+  c = ((c | 58) * (c * q)) * ((p - p) + (d * 75));
+  for(i = 0; i < 46; i++){
+    d = ((d | q) | (d | a)) - ((p | c) & (q & q));
+  }
+  b = ((a | d) ^ (c & d)) ^ ((a ^ q) + (b - a));
+  if(b < d){
+    d = ((c | d) & (c + p)) & ((a + q) & (c | p));
+  }else{
+    c = ((p ^ 87) & (d ^ 83)) | ((d ^ 74) * (a + 86));
+  }
+  d = ((q & c) & (p ^ a)) + ((d | d) & (c - 41));
+  b = ((q - c) + (b ^ p)) ^ ((c & 90) + (c + a));
+  c = ((b + p) ^ (d ^ p)) * ((c & q) * (d * 42));
+  b = ((q * d) + (d | q)) * ((q ^ q) + (p * p));
+  if(a < q){
+    c = ((p | 28) & (b * c)) & ((p * p) | (b - 2));
+  }else{
+    d = ((d + q) * (q & c)) ^ ((d * d) | (p & c));
+  }
+  a = ((q & 48) ^ (b & b)) + ((c | q) - (q & b));
+  c = ((p | a) & (a | 67)) | ((c - p) - (q + p));
+  c = ((b | a) - (p * c)) - ((p * a) - (a + b));
+  c = ((d | b) * (d | a)) | ((p ^ q) - (d ^ b));
+  if(a < p){
+    d = ((p & p) * (a | 83)) & ((b | 77) * (a * q));
+  }else{
+    d = ((q & p) + (b - b)) & ((p | p) * (p * a));
+  }
+  d = ((b & 25) | (a & p)) * ((c - 43) * (c & 24));
+  for(i = 0; i < 19; i++){
+    b = ((d + 94) * (c ^ d)) ^ ((d | 18) & (q | b));
+  }
+  a = ((q ^ 99) & (b - b)) & ((q | p) | (p ^ q));
+  a = ((q + q) - (b - d)) ^ ((q & p) * (d | 99));
+  if(b < c){
+    c = ((a - 42) - (d * c)) ^ ((p * a) + (a * 45));
+  }else{
+    d = ((a - q) - (q ^ 11)) & ((p + a) + (q + 96));
+  }
+  a = ((b + 2) & (b | a)) | ((q + q) | (p - p));
+  a = ((p + 28) | (b + 94)) + ((a ^ q) | (a + q));
+  d = ((b * 48) | (q & a)) * ((d ^ c) ^ (p & b));
+  for(i = 0; i < 9; i++){
+    c = ((d | q) & (p * a)) * ((b + 11) * (c ^ d));
+  }
+  if(a < d){
+    c = ((a & d) | (d & 92)) + ((d * p) & (d ^ 25));
+  }else{
+    c = ((d * a) ^ (c * a)) + ((b & 88) ^ (d | a));
+  }
+  return a + b + c + d;
+}
+
+int func136(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 15;
+  d = 90;
+  b = ((q | 87) * (b - 35)) + ((c - b) & (c * 10));
+  d = ((a * a) + (b ^ q)) + ((a + a) ^ (b | p));
+  a = ((d | 83) * (a | d)) - ((p ^ q) * (c + p));
+  b = ((a + a) + (c & 46)) + ((c & a) ^ (p ^ a));
+  if(b < 9){
+    a = ((b & q) + (c - q)) * ((b | a) * (c * q));
+  }else{
+    a = ((p ^ d) - (d - 22)) | ((a | 37) | (p & 10));
+  }
+  a = ((d - a) - (c * p)) + ((b & 73) | (c | p));
+  for(i = 0; i < 9; i++){
+    b = ((q | q) - (a | 61)) - ((d * b) * (q & p));
+  }
+  c = ((q & 58) + (b ^ b)) & ((c & 76) & (b * d));
+  d = ((d ^ b) ^ (d & c)) + ((q - c) + (a | 96));
+  if(a < c){
+    b = ((c & 98) * (p & q)) | ((q - 20) | (b | b));
+  }else{
+    b = ((q | d) * (d + 28)) | ((d & 21) + (b & b));
+  }
+  a = ((a ^ p) * (q | 83)) + ((c & p) ^ (c * a));
+  c = ((p & c) + (a + p)) | ((b ^ p) + (d * p));
+  b = ((b - p) + (a * b)) & ((b - d) | (q + 2));
+  for(i = 0; i < 42; i++){
+    b = ((q - c) + (p - 50)) + ((b - a) | (a | 21));
+  }
+  if(b < c){
+    c = ((p & d) ^ (p - 87)) | ((b ^ c) | (a & p));
+  }else{
+    b = ((b ^ d) - (c * d)) ^ ((c * 35) - (p & q));
+  }
+  c = ((a | c) | (c | p)) + ((c ^ c) + (q - b));
+  c = ((c ^ q) + (a + 72)) | ((b - 13) & (d + 89));
+  a = ((d ^ 41) * (d + q)) & ((c | c) | (b | a));
+  a = ((q + q) & (p - a)) & ((p - p) * (a + d));
+  if(a < 27){
+    d = ((c + c) * (q - 27)) | ((c & a) * (c + c));
+  }else{
+    b = ((p & 78) | (b - d)) | ((c * d) & (p + p));
+  }
+  for(i = 0; i < 40; i++){
+    b = ((p + p) & (b + c)) + ((b & c) * (a - d));
+  }
+  a = ((p + d) + (q ^ d)) & ((d & p) + (q - 58));
+  b = ((q | q) - (d - 13)) * ((q ^ d) & (q + 13));
+  b = ((p | c) - (d * q)) ^ ((c ^ q) - (c & b));
+  if(a < 6){
+    b = ((c * d) * (b - c)) + ((a & b) * (c + d));
+  }else{
+    c = ((d * a) - (b & c)) ^ ((a * a) & (p * a));
+  }
+  c = ((a * q) & (d & d)) | ((c & d) & (d | d));
+  c = ((b | p) - (q | 58)) | ((d - a) + (d * q));
+  for(i = 0; i < 36; i++){
+    c = ((c * 21) * (a | 88)) ^ ((c ^ 96) + (d * q));
+  }
+  b = ((q ^ 29) * (c * c)) + ((c * p) * (p ^ a));
+  if(d < b){
+    d = ((a * a) & (c & a)) * ((p | c) & (b * a));
+  }else{
+    a = ((a - q) | (a & 11)) + ((b - 47) * (b + 34));
+  }
+  c = ((a | a) | (p ^ q)) - ((q + c) | (a & q));
+  a = ((d * c) & (q ^ b)) - ((a + a) & (a ^ 95));
+  a = ((a & a) * (d - d)) + ((p * b) + (p | q));
+  c = ((q * p) + (q * d)) | ((p * 47) + (b & 44));
+  if(a < 63){
+    a = ((q * 69) ^ (d + q)) ^ ((b - b) | (q | 48));
+  }else{
+    d = ((d + q) & (c * p)) | ((a * d) & (a - d));
+  }
+  d = ((b * 68) + (q + q)) + ((q & c) | (b ^ 9));
+  d = ((c - c) & (a - c)) & ((p | 10) & (b & 11));
+  c = ((p | d) ^ (p & p)) * ((a | 56) ^ (q ^ q));
+  c = ((d | c) * (p * q)) ^ ((c & c) | (p + c));
+  if(c < 15){
+    a = ((q - q) * (a * c)) & ((c | d) - (p * q));
+  }else{
+    a = ((q * b) | (a ^ q)) ^ ((a & p) & (d ^ 78));
+  }
+  b = ((d | b) ^ (q ^ d)) & ((q | c) * (c - c));
+  for(i = 0; i < 7; i++){
+    c = ((q * q) + (p ^ p)) - ((c ^ d) | (q - c));
+  }
+  c = ((b * b) + (d ^ a)) * ((b + 23) & (b | a));
+  b = ((b - p) - (b + q)) - ((a | b) | (q & 70));
+  if(b < 72){
+    a = ((d + 74) & (q ^ p)) * ((a & b) ^ (a * c));
+  }else{
+    a = ((p + p) * (c * d)) | ((q + b) ^ (d + 3));
+  }
+  b = ((d | c) + (b * a)) + ((c & a) - (q & 23));
+  c = ((a + q) * (p + q)) ^ ((d & q) ^ (b * c));
+  c = ((c + p) + (c ^ d)) + ((p - c) ^ (d - p));
+  for(i = 0; i < 5; i++){
+    a = ((c & p) - (d - c)) + ((d | d) & (d - 13));
+  }
+  if(b < c){
+    a = ((p & d) & (b & 45)) & ((d | 6) - (d + 61));
+  }else{
+    b = ((a ^ q) + (q + a)) * ((a - a) | (d * d));
+  }
+  return a + b + c + d;
+}
+
+int func137(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 26;
+  d = 79;
+  a = ((p * q) ^ (q & 7)) ^ ((c & a) - (b & q));
+  c = ((p - c) & (p + c)) + ((d | 15) - (p * 99));
+  b = ((p ^ d) & (p + c)) * ((q & p) - (b - a));
+  a = ((p ^ 32) - (d | q)) * ((p & 15) & (c + a));
+  if(d < a){
+    d = ((q * b) * (p | 81)) | ((b | q) & (p - d));
+  }else{
+    b = ((d - c) & (q | 62)) ^ ((d ^ p) + (q ^ 59));
+  }
+  d = ((b - b) + (q ^ a)) * ((d * 7) | (d + b));
+  for(i = 0; i < 12; i++){
+    a = ((q ^ a) & (b & d)) & ((d - b) + (b | c));
+  }
+  b = ((a & 46) | (b - d)) * ((d + 74) ^ (a ^ 58));
+  c = ((q - q) | (q | p)) + ((d + p) | (c ^ 6));
+  if(c < 55){
+    c = ((q * 73) | (d + p)) - ((b | a) | (b | q));
+  }else{
+    b = ((d + p) * (d + 91)) | ((a & q) | (b | q));
+  }
+  d = ((c | 2) | (d * q)) & ((q + b) * (q + c));
+  b = ((a + 8) + (p ^ 6)) & ((a & q) + (d - q));
+  d = ((q & p) | (d - d)) * ((c & a) * (d ^ p));
+  for(i = 0; i < 41; i++){
+    c = ((p & c) + (c ^ d)) * ((c - c) | (b - 4));
+  }
+  if(a < p){
+    b = ((p * p) - (b ^ b)) & ((p ^ q) - (q + p));
+  }else{
+    b = ((p | d) & (a + q)) ^ ((q | 44) & (b - 56));
+  }
+  c = ((q & a) | (a + 25)) + ((p * a) * (c - p));
+  d = ((a | q) & (c | 76)) & ((q - a) + (b - d));
+  d = ((q ^ p) * (d | 32)) - ((p ^ b) - (c * 44));
+  c = ((c ^ d) & (d * 69)) ^ ((d - c) * (q ^ d));
+  if(c < p){
+    a = ((p + b) - (d ^ b)) - ((q * 65) ^ (q + q));
+  }else{
+    d = ((d & c) | (p | d)) | ((b & c) - (a & d));
+  }
+  for(i = 0; i < 5; i++){
+    a = ((a + c) | (p + 84)) - ((q & c) - (q & q));
+  }
+  b = ((p + q) | (c & 42)) * ((a - b) & (b & q));
+  b = ((d - q) - (q * a)) + ((b ^ 29) | (d | d));
+  a = ((d | b) - (d | b)) ^ ((a + q) & (d - 75));
+  if(b < d){
+    d = ((q & a) + (d | c)) | ((p - b) - (b | d));
+  }else{
+    c = ((b ^ p) | (p & 48)) - ((d + c) | (a + d));
+  }
+  b = ((a + a) * (d ^ a)) + ((q - b) + (b - q));
+  d = ((d * d) * (c | p)) | ((p - 68) ^ (p & q));
+  for(i = 0; i < 42; i++){
+    c = ((d | p) - (c + 35)) * ((q * q) ^ (c & p));
+  }
+  a = ((d ^ 46) * (q ^ d)) + ((a * p) + (b ^ a));
+  if(c < 91){
+    b = ((d | p) ^ (a | c)) * ((b + p) - (b * d));
+  }else{
+    d = ((b ^ d) + (b - q)) - ((a & d) + (b - q));
+  }
+  d = ((c + 25) - (b * d)) - ((b - b) ^ (p & d));
+  d = ((p - p) & (b + p)) - ((d * b) | (c + 22));
+  a = ((d - q) | (a | c)) & ((q * a) & (a ^ a));
+  d = ((a - d) | (d + d)) | ((a + 16) * (d & q));
+  if(d < p){
+    b = ((q - p) + (b & p)) & ((b ^ q) | (b - 37));
+  }else{
+    d = ((c - 89) | (b - a)) + ((a & p) * (c | q));
+  }
+  c = ((d & q) * (a - 13)) * ((a * c) & (d - p));
+  c = ((c * q) - (b & a)) ^ ((c | c) + (a - b));
+  d = ((d - 89) - (c * a)) & ((d * b) | (b & a));
+  b = ((a + c) - (a ^ p)) ^ ((p * 65) - (d & b));
+  if(a < c){
+    c = ((c | c) * (q - p)) + ((p + 14) & (d & d));
+  }else{
+    a = ((q & p) | (p + b)) - ((c - 40) - (c ^ p));
+  }
+  b = ((p | p) * (d & c)) | ((a ^ d) * (c * d));
+  for(i = 0; i < 6; i++){
+    c = ((b | 33) & (a ^ q)) & ((a | c) & (q - d));
+  }
+  c = ((q | 98) - (d | 86)) & ((d + a) | (a ^ a));
+  d = ((p * p) | (b | p)) & ((d * d) * (a + d));
+  if(b < p){
+    b = ((q | c) * (p | 12)) | ((c & c) | (p & p));
+  }else{
+    a = ((a * q) & (b * 56)) ^ ((d | d) * (p * p));
+  }
+  c = ((d + c) - (b ^ d)) | ((q & p) & (d ^ q));
+  a = ((q & a) ^ (b ^ b)) + ((a ^ 52) ^ (d | a));
+  d = ((q + 29) ^ (b + a)) | ((c | p) ^ (c + c));
+  for(i = 0; i < 40; i++){
+    c = ((q & q) | (a & q)) ^ ((b ^ p) | (d - 44));
+  }
+  if(b < q){
+    b = ((a | c) * (b * 88)) * ((p ^ a) * (p & 25));
+  }else{
+    d = ((c - p) ^ (d + b)) | ((b & 73) + (q - 38));
+  }
+  return a + b + c + d;
+}
+
+int func138(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 89;
+  d = 28;
+  a = ((d ^ c) & (d * 99)) * ((c - b) | (d + c));
+  c = ((q & 6) & (p | a)) + ((c + p) ^ (c & p));
+  b = ((d - p) - (a - 8)) & ((d | b) - (a + b));
+  b = ((p * p) + (b + q)) & ((a * 26) * (a + 86));
+  if(b < a){
+    a = ((a + p) | (b & c)) ^ ((p + q) & (p - p));
+  }else{
+    a = ((q - p) * (p + a)) * ((a - c) + (q - 80));
+  }
+  b = ((p - d) - (p | 31)) & ((c - p) ^ (a - d));
+  for(i = 0; i < 32; i++){
+    a = ((q + c) * (c ^ b)) & ((b * c) - (a * p));
+  }
+  d = ((b * a) + (a - a)) * ((d & a) ^ (q ^ c));
+  b = ((p ^ 74) ^ (b - b)) + ((q - p) & (d - b));
+  if(a < 36){
+    a = ((c * b) - (c - c)) + ((d * 13) + (a + c));
+  }else{
+    a = ((p * b) + (d & a)) + ((a ^ c) - (a ^ q));
+  }
+  d = ((d & 89) ^ (q ^ 97)) - ((c | d) + (c & d));
+  b = ((c + d) | (c | c)) ^ ((c - 74) ^ (a + c));
+  a = ((a + 70) + (p & d)) & ((p * 9) | (c | 6));
+  for(i = 0; i < 4; i++){
+    d = ((b * 69) & (b ^ 28)) + ((b | 11) - (q | q));
+  }
+  if(d < 54){
+    b = ((c * d) + (c - p)) ^ ((p - 68) + (d - 18));
+  }else{
+    a = ((q + a) * (c | p)) | ((d * a) * (c ^ d));
+  }
+  b = ((b | 87) + (c - p)) ^ ((a - b) + (a - d));
+  b = ((a | q) & (b - d)) ^ ((p & b) | (c * a));
+  d = ((c & 23) ^ (d ^ c)) + ((p ^ q) - (p | p));
+  c = ((p & p) + (p * 63)) * ((d ^ 18) * (q - c));
+  if(d < q){
+    b = ((p | 91) - (d ^ c)) ^ ((b * a) ^ (c + 27));
+  }else{
+    c = ((c + q) ^ (b - a)) | ((b & q) | (c + b));
+  }
+  for(i = 0; i < 47; i++){
+    a = ((a + 96) + (q & q)) + ((q ^ c) - (q ^ b));
+  }
+  a = ((c | d) ^ (d | c)) & ((b | b) | (c & 31));
+  b = ((b | p) * (d ^ c)) & ((p + b) & (p ^ q));
+  b = ((q ^ 48) ^ (b ^ b)) * ((c | p) * (c + b));
+  if(b < 89){
+    d = ((q & d) * (d ^ p)) * ((c ^ 90) - (c | 95));
+  }else{
+    a = ((a - 50) * (d ^ a)) & ((b | p) + (b | d));
+  }
+  b = ((p ^ b) + (c & 54)) + ((a + c) ^ (d | b));
+  b = ((b * 78) & (q - d)) & ((q - 82) + (c & d));
+  for(i = 0; i < 41; i++){
+    b = ((c * a) & (c - a)) | ((p | q) & (b | 62));
+  }
+  b = ((c ^ p) * (c & d)) | ((c ^ b) ^ (a * c));
+  if(c < c){
+    b = ((p ^ b) + (q * c)) * ((b + p) + (c ^ a));
+  }else{
+    d = ((a - p) & (c ^ 51)) * ((a * c) * (p * q));
+  }
+  c = ((b ^ c) | (d & 96)) - ((b * 5) & (q | b));
+  a = ((d ^ a) * (p & d)) ^ ((d * q) - (q * b));
+  c = ((d - b) + (p - b)) - ((a + q) * (p ^ 37));
+  d = ((a ^ c) & (q + a)) - ((b - a) - (q & b));
+  if(a < d){
+    b = ((d | d) | (d ^ c)) ^ ((a - p) | (a - c));
+  }else{
+    a = ((c | a) & (a ^ p)) ^ ((a | 3) | (b - 45));
+  }
+  a = ((p | a) * (p - c)) * ((a + b) * (b - a));
+  b = ((a - b) * (c | q)) - ((b - 4) | (a - a));
+  c = ((a - c) + (p & b)) * ((p * c) & (d | 58));
+  a = ((c & b) * (b ^ c)) - ((q - b) ^ (q - b));
+  if(a < a){
+    d = ((d & 57) ^ (b + 21)) & ((q - p) - (b ^ q));
+  }else{
+    b = ((d + 18) * (c ^ a)) * ((q & 51) | (b | c));
+  }
+  c = ((b ^ c) & (q - p)) ^ ((b & p) - (c | p));
+  for(i = 0; i < 38; i++){
+    a = ((d | 69) & (b | b)) | ((q | d) - (a + d));
+  }
+  b = ((d - p) & (b & 52)) + ((p + b) - (q | q));
+  a = ((c | c) | (c | b)) & ((q & c) - (c | 47));
+  if(b < d){
+    d = ((c & q) ^ (a * d)) + ((a & q) - (a - d));
+  }else{
+    d = ((q ^ 45) | (q & c)) - ((a | 5) + (a + p));
+  }
+  c = ((p ^ b) & (b | b)) ^ ((d - a) ^ (q & a));
+  d = ((b + a) - (d + q)) & ((q ^ 68) | (c * a));
+  d = ((b | d) & (d + c)) & ((d ^ b) ^ (d & d));
+  for(i = 0; i < 31; i++){
+    d = ((p & a) ^ (a ^ a)) * ((a + b) + (c | 31));
+  }
+  if(d < b){
+    d = ((b & c) | (c + q)) - ((a ^ b) & (c ^ p));
+  }else{
+    b = ((a - p) ^ (d + b)) ^ ((b * 64) * (a ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func139(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 21;
+  d = 64;
+  b = ((d & p) ^ (d & 84)) - ((d & 47) * (a * p));
+  c = ((d - b) * (b * c)) + ((p & a) ^ (b & a));
+  a = ((c + q) | (a * q)) * ((p + p) | (a + p));
+  c = ((q ^ a) + (c & 14)) + ((b & c) - (a * a));
+  if(b < 39){
+    b = ((p ^ 79) + (a - a)) + ((d ^ d) - (q - 31));
+  }else{
+    c = ((q | b) | (b * a)) ^ ((q & c) | (b - q));
+  }
+  a = ((b & p) ^ (a & 47)) * ((a - d) * (q & 4));
+  for(i = 0; i < 35; i++){
+    c = ((q - 47) - (b - d)) ^ ((c * c) ^ (d ^ d));
+  }
+  a = ((q - p) - (q * d)) | ((b ^ c) * (q & q));
+  b = ((b * 2) + (q | 8)) & ((b | c) + (c + p));
+  if(c < d){
+    b = ((a ^ q) & (b | 4)) | ((q - c) | (q | 33));
+  }else{
+    a = ((b | d) & (p | b)) | ((p * p) * (q ^ c));
+  }
+  a = ((d & a) + (b & 88)) ^ ((q ^ b) & (b | c));
+  d = ((d * 93) - (p - b)) | ((d & b) ^ (q | c));
+  d = ((p ^ 36) + (a + d)) * ((c * a) & (a * a));
+  for(i = 0; i < 41; i++){
+    b = ((b + a) | (b | 79)) & ((b - q) | (a + b));
+  }
+  if(b < d){
+    b = ((q - d) | (a & p)) - ((b * 44) ^ (c - p));
+  }else{
+    b = ((b - q) * (b | a)) & ((d | d) ^ (b & c));
+  }
+  d = ((c * 32) & (a ^ 78)) & ((q & 52) + (a | q));
+  c = ((a & 10) | (a * b)) & ((c & q) ^ (q * p));
+  c = ((p + c) * (a ^ c)) - ((b | q) ^ (q ^ c));
+  a = ((b & c) - (q - 99)) & ((c + q) - (q - a));
+  if(d < q){
+    c = ((b + 30) - (b * a)) & ((b + q) & (c - 37));
+  }else{
+    a = ((c | q) - (p & d)) - ((a * a) ^ (c * c));
+  }
+  for(i = 0; i < 37; i++){
+    b = ((c + d) * (a * a)) ^ ((a * a) * (q | 41));
+  }
+  a = ((q | a) - (b + p)) + ((q + b) - (p * d));
+  d = ((b + 86) + (p | p)) & ((d - c) * (p & a));
+  c = ((q | p) - (c | b)) | ((p * a) + (b * q));
+  if(c < q){
+    b = ((a - a) ^ (c & 28)) + ((c ^ 80) - (b + p));
+  }else{
+    a = ((q ^ d) + (q | q)) + ((c & b) & (b + d));
+  }
+  b = ((q & d) * (c + 79)) & ((d ^ q) * (a - q));
+  d = ((d * p) * (a * q)) + ((b | q) ^ (c & c));
+  for(i = 0; i < 39; i++){
+    a = ((a - q) + (q | p)) & ((c - a) | (q | q));
+  }
+  c = ((p ^ p) & (q & 97)) * ((b ^ 17) & (q + 46));
+  if(b < 25){
+    c = ((a - c) + (c | q)) ^ ((c + d) * (p & p));
+  }else{
+    a = ((c * 46) * (p | 53)) - ((d ^ 62) | (q * b));
+  }
+  a = ((b * q) | (d | p)) ^ ((a * b) ^ (q ^ d));
+  c = ((c * 33) + (q | 87)) - ((d * q) | (q * p));
+  a = ((b + p) & (p & d)) & ((p + b) & (q * 79));
+  a = ((q & p) + (b | 90)) * ((c + 71) + (p & q));
+  if(d < a){
+    d = ((p ^ 35) + (c * q)) ^ ((q - a) | (p - 7));
+  }else{
+    c = ((c | 28) - (q | p)) ^ ((q - 19) + (b * p));
+  }
+  a = ((d ^ b) * (d * b)) + ((d - a) - (c * d));
+  d = ((c ^ c) + (b ^ 75)) | ((c & a) & (q * 80));
+  a = ((d ^ p) + (b + a)) & ((b - q) & (q + p));
+  d = ((q - 52) - (p & q)) ^ ((q & c) & (b * q));
+  if(d < b){
+    a = ((b + 83) & (p & c)) * ((a + d) & (q | a));
+  }else{
+    c = ((a * b) + (d & a)) - ((d + q) | (b - b));
+  }
+  a = ((q & c) - (c | b)) * ((c | c) * (c ^ c));
+  for(i = 0; i < 45; i++){
+    c = ((a & d) - (a - 98)) * ((b + b) * (a ^ d));
+  }
+  a = ((a & d) ^ (d + d)) + ((a * q) ^ (d - p));
+  a = ((a + b) * (d - q)) * ((a ^ d) + (p - b));
+  if(c < c){
+    b = ((p ^ d) | (q + c)) | ((q ^ 4) - (c - a));
+  }else{
+    a = ((c & c) - (d * c)) & ((d ^ a) * (q | p));
+  }
+  d = ((p - c) - (q - c)) - ((b + a) - (a - 32));
+  c = ((d + b) + (b * b)) - ((q & p) - (c * 58));
+  b = ((q | 65) * (q & c)) ^ ((b - a) - (d + d));
+  for(i = 0; i < 47; i++){
+    a = ((b ^ 67) | (c | 28)) ^ ((b & 40) * (a | q));
+  }
+  if(b < c){
+    b = ((p * c) | (b ^ q)) | ((q ^ a) & (b - c));
+  }else{
+    b = ((b ^ d) - (q - p)) ^ ((d | q) | (q * a));
+  }
+  return a + b + c + d;
+}
+
+int func140(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 75;
+  d = 96;
+  b = ((q ^ a) & (d | a)) & ((d | p) - (q * q));
+  b = ((a & 63) ^ (p | b)) ^ ((p & d) + (q ^ p));
+  a = ((d ^ c) & (a | 56)) * ((d * 21) - (b - c));
+  a = ((c & p) - (a ^ b)) & ((p ^ 36) - (a | q));
+  if(c < a){
+    a = ((p * 42) & (b | c)) ^ ((d | a) ^ (a | p));
+  }else{
+    c = ((c & b) * (d - c)) - ((c + 14) | (d ^ q));
+  }
+  c = ((c ^ d) | (c & c)) | ((b & q) * (b - b));
+  for(i = 0; i < 34; i++){
+    c = ((q & p) + (q * 3)) + ((q | 26) ^ (p ^ a));
+  }
+  a = ((a | p) ^ (p + b)) | ((a * p) * (p + a));
+  c = ((q ^ 68) + (b | p)) & ((b - c) + (d + d));
+  if(b < p){
+    b = ((p * b) * (a + b)) ^ ((q - d) & (c + c));
+  }else{
+    b = ((a + p) | (b | 66)) * ((c ^ b) - (q & 67));
+  }
+  a = ((q & a) + (d + 15)) - ((a - q) | (b + b));
+  d = ((b - a) ^ (q | d)) | ((q + q) - (d & 79));
+  d = ((q * d) - (p ^ b)) * ((p & 97) * (d ^ p));
+  for(i = 0; i < 21; i++){
+    b = ((b ^ b) | (p - p)) + ((c ^ d) ^ (c * 88));
+  }
+  if(a < 20){
+    a = ((a ^ 88) - (b + 81)) ^ ((b & a) ^ (p * 30));
+  }else{
+    c = ((c * d) | (a - 85)) | ((c & b) + (b | b));
+  }
+  a = ((b | b) * (b ^ q)) | ((c * 22) | (d ^ q));
+  a = ((p ^ d) - (b * 33)) - ((b | c) - (d - q));
+  b = ((p + q) | (a ^ 94)) * ((c - a) ^ (p & 28));
+  b = ((c ^ b) + (a * b)) * ((p ^ b) * (b ^ q));
+  if(c < d){
+    b = ((c * 51) ^ (c & q)) + ((d ^ c) - (p * b));
+  }else{
+    c = ((a ^ b) | (q * p)) & ((b - d) - (c | q));
+  }
+  for(i = 0; i < 2; i++){
+    d = ((a ^ c) ^ (d - q)) + ((q ^ c) & (p * q));
+  }
+  c = ((b + 38) * (p | 16)) | ((q - 72) & (q ^ a));
+  d = ((c - p) + (q ^ d)) - ((d & d) + (p & p));
+  b = ((c ^ c) * (q - d)) | ((d ^ 30) | (q * 41));
+  if(d < c){
+    d = ((q ^ q) ^ (c - p)) + ((p + a) - (b * q));
+  }else{
+    c = ((c & b) + (p * d)) | ((a - p) | (a ^ a));
+  }
+  a = ((a * 42) & (q & c)) + ((d | b) & (p + a));
+  d = ((d ^ q) | (q * b)) + ((p + d) & (a & q));
+  for(i = 0; i < 30; i++){
+    d = ((a | q) ^ (p - p)) & ((c & c) - (q - b));
+  }
+  b = ((a & p) - (p + b)) - ((q & d) - (b ^ c));
+  if(a < q){
+    c = ((b - p) * (p ^ p)) + ((c & a) ^ (d ^ d));
+  }else{
+    d = ((c & b) - (a - 1)) ^ ((p + c) ^ (a ^ p));
+  }
+  a = ((q * 14) ^ (a + 84)) - ((q + 87) + (q + 53));
+  d = ((b + b) + (d * q)) * ((a ^ a) | (q & c));
+  d = ((p - p) + (c ^ p)) + ((d * d) + (c + d));
+  a = ((q ^ b) | (d | a)) - ((d & p) - (c * q));
+  if(c < c){
+    b = ((q | b) & (c + a)) + ((p + b) + (q ^ q));
+  }else{
+    a = ((d | b) ^ (b + 63)) * ((b & d) * (d * 4));
+  }
+  a = ((q | 91) | (a ^ b)) ^ ((a * b) * (a & a));
+  d = ((d - 37) & (q ^ b)) & ((p - q) * (p * q));
+  a = ((a | 35) * (q + a)) & ((c * q) & (p + q));
+  c = ((d * b) * (c | d)) * ((q | 23) + (p * c));
+  if(d < 36){
+    d = ((a + 43) * (a & p)) ^ ((d ^ d) ^ (c * a));
+  }else{
+    b = ((b ^ c) | (q - 54)) | ((q * a) ^ (d & 78));
+  }
+  c = ((c - d) + (b + b)) * ((q - d) & (q * 83));
+  for(i = 0; i < 29; i++){
+    a = ((p | d) | (p & b)) * ((a * q) + (d | c));
+  }
+  a = ((b * c) + (q - c)) - ((p + b) - (p * 82));
+  b = ((a * p) - (a * 58)) | ((b * 86) + (a ^ 93));
+  if(c < b){
+    a = ((a | d) - (b * 25)) - ((a ^ d) ^ (b & b));
+  }else{
+    c = ((a & 97) ^ (q | a)) - ((a * c) | (c + a));
+  }
+  c = ((a - 88) & (a ^ q)) | ((q - c) ^ (b ^ d));
+  c = ((p - 75) ^ (d - p)) ^ ((a + c) + (a * p));
+  a = ((a | 93) * (c | q)) & ((p | d) * (a - b));
+  for(i = 0; i < 35; i++){
+    d = ((b - d) & (d ^ d)) - ((c | 55) & (p ^ 21));
+  }
+  if(c < d){
+    a = ((a | q) ^ (p | b)) - ((p + 17) | (p & q));
+  }else{
+    d = ((p ^ 20) | (q | q)) | ((d - b) - (p | p));
+  }
+  return a + b + c + d;
+}
+
+int func141(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 33;
+  d = 58;
+  d = ((b - a) & (a & q)) | ((b - a) + (d & 79));
+  d = ((p + 95) + (p - b)) + ((b & 23) & (q + b));
+  b = ((d & q) - (p | d)) - ((b * 51) * (q ^ a));
+  b = ((q - d) - (c - b)) - ((q & d) * (a | 94));
+  if(c < a){
+    d = ((b ^ b) - (q + a)) - ((d + c) ^ (a - q));
+  }else{
+    b = ((q * q) & (a * p)) | ((d | d) + (a ^ d));
+  }
+  b = ((b & b) & (b ^ b)) - ((q & 21) - (c | q));
+  for(i = 0; i < 6; i++){
+    a = ((q | b) | (b - q)) * ((c + d) + (d - a));
+  }
+  c = ((a ^ d) * (d & a)) - ((p - d) ^ (d * a));
+  b = ((a ^ 51) ^ (a + 3)) & ((d & q) - (b + c));
+  if(b < a){
+    b = ((q & c) - (a ^ 51)) - ((q - 36) ^ (c ^ b));
+  }else{
+    b = ((p + c) | (p & 89)) ^ ((q + c) & (q ^ 79));
+  }
+  b = ((c * 1) * (p | q)) - ((b | b) * (p ^ 99));
+  b = ((q - 15) & (a + q)) ^ ((b - 44) & (d - c));
+  a = ((c | c) & (c ^ a)) + ((a & p) | (q | a));
+  for(i = 0; i < 7; i++){
+    a = ((p & 97) ^ (q - d)) ^ ((b | 10) | (a - 30));
+  }
+  if(b < d){
+    a = ((a + p) + (a + q)) * ((p - q) - (p | c));
+  }else{
+    c = ((a & 97) ^ (b ^ b)) & ((b | a) ^ (b - 83));
+  }
+  d = ((p | c) - (b | p)) - ((d * p) - (p + 6));
+  b = ((p | b) + (c * c)) ^ ((b * a) & (b | q));
+  a = ((b - d) - (b | c)) & ((b & p) | (p ^ d));
+  c = ((p ^ a) & (p & a)) & ((b * q) & (b | c));
+  if(d < p){
+    a = ((d + p) | (p + p)) ^ ((d | c) * (c * a));
+  }else{
+    d = ((q ^ d) | (a | 95)) ^ ((a | 16) ^ (b & a));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((p | b) | (c - a)) | ((q - 43) | (c & 6));
+  }
+  a = ((d * 98) * (d | b)) & ((q * 43) ^ (p | p));
+  a = ((b | b) & (b * a)) + ((c & c) - (b | q));
+  c = ((b & 30) + (p * c)) | ((p ^ d) & (q ^ d));
+  if(c < 23){
+    d = ((c + d) ^ (d & p)) ^ ((q - 99) & (b ^ d));
+  }else{
+    c = ((b * q) * (p * c)) * ((a - p) + (b * a));
+  }
+  d = ((q * q) ^ (a - a)) | ((b * 52) ^ (p * 46));
+  c = ((c ^ d) - (d & a)) | ((q + q) | (p + d));
+  for(i = 0; i < 28; i++){
+    d = ((q - c) & (b + q)) * ((p - p) * (p * p));
+  }
+  c = ((c & a) + (a & b)) & ((a - p) + (p ^ a));
+  if(b < c){
+    a = ((c + a) | (a | a)) | ((d * c) ^ (a + q));
+  }else{
+    b = ((q * p) * (a * 27)) - ((a - 87) & (b & 14));
+  }
+  b = ((a & c) - (d & c)) ^ ((q | p) | (q * 16));
+  a = ((q * 56) - (q | c)) + ((a & a) ^ (c * q));
+  c = ((p & b) + (c * b)) & ((d + 69) - (d | 14));
+  c = ((q * b) | (q - c)) | ((d * c) ^ (q + d));
+  if(c < q){
+    c = ((p - d) - (b - 25)) - ((b ^ c) ^ (q - q));
+  }else{
+    c = ((p - b) + (a * c)) + ((a ^ 49) | (p * c));
+  }
+  b = ((p ^ 41) + (c & p)) - ((a - 16) * (a - c));
+  a = ((a ^ p) & (d * d)) ^ ((c | b) + (a - d));
+  a = ((b & 30) | (c + b)) & ((b + p) & (q + p));
+  d = ((c * 59) - (b - c)) | ((d & c) & (c | 9));
+  if(c < d){
+    c = ((c * q) + (b + a)) ^ ((c & a) & (c | 72));
+  }else{
+    c = ((q - p) * (b | 4)) ^ ((a | c) | (q & b));
+  }
+  b = ((b + p) + (q * d)) | ((b ^ q) | (d & p));
+  for(i = 0; i < 8; i++){
+    b = ((q - b) - (a + 56)) + ((d | a) + (b * 91));
+  }
+  d = ((p & 69) | (q & 82)) & ((a + 40) + (p | b));
+  c = ((b & b) + (a ^ c)) * ((b | 60) ^ (b + c));
+  if(b < q){
+    a = ((c * q) + (a + b)) & ((q | b) | (c - c));
+  }else{
+    b = ((d ^ d) | (d ^ 59)) * ((b + c) | (d | q));
+  }
+  c = ((b ^ c) ^ (p * b)) ^ ((q ^ p) - (d * p));
+  d = ((p & a) | (q & c)) * ((p + p) ^ (b + d));
+  c = ((c & p) + (c | q)) - ((b - c) * (q * d));
+  for(i = 0; i < 5; i++){
+    c = ((d ^ 96) - (b | 28)) | ((d * c) * (a | c));
+  }
+  if(b < 15){
+    d = ((a + q) | (c * q)) | ((p ^ q) + (q | a));
+  }else{
+    d = ((a + 30) * (q & b)) | ((q & 54) | (p * a));
+  }
+  return a + b + c + d;
+}
+
+int func142(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 62;
+  d = 48;
+  d = ((q - p) * (c - d)) + ((p * q) & (q & a));
+  a = ((q ^ 90) & (a & p)) | ((p ^ d) * (p - a));
+  d = ((b ^ d) * (p ^ q)) - ((d - q) | (a & b));
+  a = ((d * q) | (c * b)) + ((c | a) + (a - q));
+  if(d < q){
+    a = ((c * 45) + (a * d)) - ((b & c) - (b & p));
+  }else{
+    b = ((a * 57) & (q | d)) ^ ((b - p) ^ (p + p));
+  }
+  c = ((c * 31) & (c & p)) + ((d * a) ^ (a + c));
+  for(i = 0; i < 47; i++){
+    a = ((a | b) | (d + 17)) | ((p & d) ^ (p | b));
+  }
+  d = ((a + p) + (c + p)) ^ ((b * p) - (a ^ b));
+  c = ((c & 78) | (d + a)) - ((q - 90) | (c - 22));
+  if(d < c){
+    c = ((b & 36) - (p * c)) - ((b * c) | (p - q));
+  }else{
+    a = ((q - c) - (q ^ a)) | ((q - 37) ^ (p - c));
+  }
+  d = ((p + c) | (b - a)) | ((p + c) & (a & a));
+  d = ((c ^ b) ^ (c & d)) + ((q - a) | (b & 93));
+  c = ((c + 35) ^ (q & 62)) - ((c & c) * (a & d));
+  for(i = 0; i < 12; i++){
+    d = ((b ^ c) * (p | 38)) & ((p - p) + (b | a));
+  }
+  if(a < b){
+    a = ((b | c) | (a * c)) & ((c ^ p) | (d + c));
+  }else{
+    a = ((b ^ d) ^ (d - q)) ^ ((p * a) * (d | b));
+  }
+  c = ((a * q) & (q - p)) ^ ((p & 66) ^ (c + p));
+  a = ((c ^ p) & (c ^ a)) | ((b * b) ^ (b | 12));
+  a = ((b - p) ^ (d + b)) + ((p ^ 85) + (b * p));
+  d = ((c + 75) * (a & q)) & ((b & p) | (p ^ 6));
+  if(a < p){
+    a = ((p - q) | (b - d)) - ((c ^ c) * (c - a));
+  }else{
+    b = ((a | p) & (b - 89)) - ((b | c) ^ (c + d));
+  }
+  for(i = 0; i < 22; i++){
+    d = ((p - q) | (a - 7)) * ((d & c) & (c & b));
+  }
+  a = ((a * 66) + (b + c)) & ((d ^ 51) & (c + 43));
+  b = ((c + d) + (q & 87)) & ((q & c) - (b + c));
+  d = ((a & a) ^ (q * c)) - ((p | 98) * (c - a));
+  if(c < 50){
+    d = ((b * p) * (d - b)) ^ ((c | 50) | (p ^ b));
+  }else{
+    d = ((c ^ a) - (c * q)) + ((c ^ 25) + (a & c));
+  }
+  b = ((a - 75) ^ (d | q)) & ((b * b) & (c ^ c));
+  c = ((d & d) | (a ^ q)) | ((a & 86) | (b * c));
+  for(i = 0; i < 2; i++){
+    c = ((c * 17) - (c & p)) * ((q - p) - (p ^ b));
+  }
+  d = ((a | p) | (p - b)) - ((c + d) | (p * d));
+  if(c < p){
+    c = ((p & d) * (c - q)) ^ ((d - p) - (q ^ c));
+  }else{
+    d = ((a - p) | (b * 31)) - ((b ^ p) ^ (q | b));
+  }
+  b = ((b | 13) * (q | b)) + ((b | 50) ^ (d | a));
+  d = ((d & 95) ^ (p + b)) + ((c ^ 23) - (p | 60));
+  d = ((d & c) - (a + d)) & ((c ^ b) - (q & 35));
+  d = ((p & 63) * (c + b)) + ((q - a) ^ (q ^ a));
+  if(c < b){
+    b = ((b * 30) ^ (c * 46)) - ((q * a) * (q | 80));
+  }else{
+    a = ((a & b) & (c ^ q)) + ((a ^ 69) + (b * 17));
+  }
+  a = ((a + d) - (b * p)) + ((q * c) - (q - q));
+  b = ((q * 61) * (b | q)) - ((b & 94) & (q + 23));
+  d = ((p * 59) - (c | d)) | ((b ^ d) ^ (d * 9));
+  c = ((d & p) - (p + a)) - ((c | a) * (q | c));
+  if(d < c){
+    d = ((c * c) | (b ^ a)) + ((c * b) & (c & q));
+  }else{
+    c = ((q & d) + (q + b)) + ((a | 54) | (a & a));
+  }
+  d = ((b | p) & (d ^ b)) * ((c - q) ^ (c ^ 4));
+  for(i = 0; i < 42; i++){
+    a = ((b ^ q) | (a + p)) | ((d * q) + (d + c));
+  }
+  b = ((c + b) | (q | c)) - ((b * p) & (b + p));
+  d = ((c & 47) ^ (d | p)) ^ ((b - p) | (a | 10));
+  if(a < d){
+    c = ((a - 23) ^ (a - d)) - ((d * a) & (a & d));
+  }else{
+    a = ((d + q) * (c ^ p)) - ((b & 13) | (b - a));
+  }
+  d = ((q ^ 36) - (d * a)) + ((q ^ 62) * (b + 96));
+  d = ((d - 19) + (p & d)) & ((c * 75) | (b | p));
+  a = ((a - 17) - (c + 72)) | ((a + c) - (c + 86));
+  for(i = 0; i < 13; i++){
+    a = ((a + 27) * (b - c)) + ((q & p) * (q - c));
+  }
+  if(d < c){
+    c = ((c * c) + (q ^ c)) | ((c + 25) * (c ^ d));
+  }else{
+    a = ((p | p) | (a - a)) ^ ((c + 74) ^ (a - p));
+  }
+  return a + b + c + d;
+}
+
+int func143(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 15;
+  a = ((q ^ q) & (c ^ a)) ^ ((c ^ c) ^ (d | c));
+  b = ((d & 85) - (c * d)) - ((a + a) | (q - d));
+  a = ((p | 26) - (c | p)) | ((a & p) - (p - p));
+  c = ((q - q) * (b | a)) + ((b | c) & (p ^ q));
+  if(d < a){
+    b = ((q & 76) - (c ^ q)) & ((d + q) & (p & b));
+  }else{
+    b = ((a - 37) - (c * a)) & ((b - d) * (q - q));
+  }
+  d = ((q ^ a) - (b + d)) + ((p + c) - (p ^ a));
+  for(i = 0; i < 14; i++){
+    d = ((q ^ c) & (q - c)) & ((q & c) * (b - q));
+  }
+  a = ((d - 16) - (b | d)) + ((q * p) ^ (a - p));
+  b = ((b | p) + (b | p)) + ((q & 60) ^ (q * a));
+  if(a < d){
+    a = ((p & a) + (q + 44)) + ((d | d) - (b * c));
+  }else{
+    d = ((c - a) & (b + 58)) + ((a + 77) + (d ^ 46));
+  }
+  b = ((p ^ 77) ^ (c & d)) | ((c & a) | (q & 89));
+  a = ((q | c) | (b * c)) | ((c ^ q) - (q ^ 87));
+  d = ((c & d) * (d ^ c)) | ((q - p) + (c & a));
+  for(i = 0; i < 7; i++){
+    c = ((b | b) + (c * d)) | ((b * 44) - (a - c));
+  }
+  if(b < p){
+    d = ((p + q) & (c | c)) & ((a | b) & (d ^ 39));
+  }else{
+    b = ((b ^ c) + (b * c)) ^ ((c + c) & (b - c));
+  }
+  b = ((p | a) + (d - p)) - ((d & 99) - (c ^ 55));
+  a = ((b - c) & (p | p)) + ((q & b) ^ (a & a));
+  b = ((p + 16) ^ (a & d)) | ((p + b) * (d + 92));
+  c = ((d ^ 21) ^ (a * d)) ^ ((p + 69) - (c ^ 98));
+  if(b < c){
+    c = ((a & p) & (p * d)) ^ ((p ^ 5) | (a - d));
+  }else{
+    d = ((p ^ p) * (b | 4)) | ((b & 55) | (p ^ q));
+  }
+  for(i = 0; i < 11; i++){
+    b = ((d * 63) | (p * b)) * ((p + 59) ^ (a - b));
+  }
+  b = ((a + a) | (a - c)) * ((b - 27) - (d | b));
+  c = ((d & c) - (p + b)) + ((b + 4) - (c * 11));
+  a = ((a & c) ^ (q * q)) - ((p | 9) ^ (d * b));
+  if(c < d){
+    c = ((d ^ c) | (a & c)) - ((d | p) + (c ^ 25));
+  }else{
+    a = ((b ^ c) & (b & a)) & ((q * c) * (c * 74));
+  }
+  c = ((q | 26) - (p + 77)) ^ ((d & q) ^ (a & p));
+  b = ((p & d) ^ (b - p)) + ((p + p) - (p + q));
+  for(i = 0; i < 42; i++){
+    c = ((a - q) * (p | a)) ^ ((q * d) + (b | b));
+  }
+  c = ((c + a) & (b - 40)) + ((d ^ 28) ^ (b * p));
+  if(c < c){
+    c = ((p | p) + (a - 70)) & ((c & a) ^ (c - q));
+  }else{
+    a = ((b & 24) + (d | 63)) & ((c - c) + (q * c));
+  }
+  d = ((c + c) - (a * p)) * ((b ^ 24) ^ (q + 65));
+  b = ((c & c) * (b - a)) | ((d * b) & (c & c));
+  a = ((q ^ p) | (p | c)) | ((q ^ p) * (q ^ 71));
+  a = ((c ^ 70) - (b * q)) ^ ((c + 70) * (q - 29));
+  if(d < a){
+    c = ((a * q) + (a | a)) ^ ((a & p) + (d | b));
+  }else{
+    c = ((q + q) & (c & d)) & ((d | b) * (b - p));
+  }
+  a = ((d - p) - (a - p)) - ((q - 72) | (q - q));
+  c = ((p & 24) & (b | a)) * ((d & q) ^ (q + 9));
+  d = ((a | d) ^ (b - a)) - ((d ^ 81) * (p + 55));
+  b = ((q ^ q) - (q * b)) & ((c - a) + (b + q));
+  if(a < q){
+    b = ((a ^ p) + (c * a)) | ((p + d) ^ (a + q));
+  }else{
+    b = ((q ^ q) ^ (c - 51)) | ((p * 79) & (q & b));
+  }
+  a = ((b & 99) - (a & q)) * ((p | p) + (c ^ q));
+  for(i = 0; i < 5; i++){
+    a = ((b | 67) + (a | p)) - ((d & 53) | (c - 3));
+  }
+  d = ((c * q) ^ (q * a)) + ((c * b) & (q - q));
+  c = ((a + 44) | (a ^ b)) + ((a - b) + (p + q));
+  if(c < 6){
+    d = ((b | p) + (q ^ 85)) & ((c & q) - (b | d));
+  }else{
+    b = ((a | d) | (b | b)) | ((d | q) & (c * c));
+  }
+  a = ((q - b) ^ (b | 34)) | ((b * d) & (a | a));
+  c = ((a ^ c) & (d | 45)) | ((p ^ b) - (b + 10));
+  d = ((p * a) - (d * p)) ^ ((d ^ a) - (p ^ d));
+  for(i = 0; i < 34; i++){
+    c = ((d ^ 4) ^ (c ^ q)) - ((b & c) + (d - c));
+  }
+  if(b < b){
+    d = ((q * p) | (d & p)) & ((b + 70) - (b & c));
+  }else{
+    b = ((b & q) | (b ^ 71)) * ((c - d) & (a * q));
+  }
+  return a + b + c + d;
+}
+
+int func144(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 4;
+  d = 15;
+  d = ((d & a) & (q | b)) + ((c & b) & (d | c));
+  d = ((c * c) * (b | a)) ^ ((d + q) + (p & p));
+  c = ((c - 16) * (q + c)) ^ ((b - 51) - (p - b));
+  a = ((a * q) ^ (b & b)) * ((c + b) * (q + d));
+  if(b < p){
+    b = ((q * q) | (q & 24)) * ((a - p) | (q + 23));
+  }else{
+    d = ((c + d) & (p - 48)) + ((d & b) & (c & a));
+  }
+  b = ((a ^ q) & (q & c)) - ((c + b) + (d - 40));
+  for(i = 0; i < 18; i++){
+    b = ((q * p) ^ (q & d)) | ((p + d) ^ (a ^ 25));
+  }
+  c = ((d + p) | (b + 39)) & ((b + q) - (q * p));
+  c = ((d - d) * (a ^ 38)) * ((p + d) * (b + b));
+  if(b < c){
+    d = ((p | d) | (q ^ 43)) ^ ((c + d) - (p - p));
+  }else{
+    b = ((q + p) ^ (p - c)) * ((d * 21) & (c & d));
+  }
+  a = ((p & q) * (d - a)) ^ ((q | d) ^ (q + c));
+  a = ((d + p) * (q + p)) + ((q | c) - (d & b));
+  c = ((p ^ 61) - (a & p)) + ((p - d) * (p - a));
+  for(i = 0; i < 16; i++){
+    b = ((d * 79) * (a | 6)) | ((d + d) - (a ^ c));
+  }
+  if(d < q){
+    a = ((q + q) * (c ^ b)) * ((c + 80) + (c - p));
+  }else{
+    b = ((c | 14) * (a + 36)) - ((c & q) | (q - d));
+  }
+  c = ((p ^ b) * (p - q)) + ((d | 82) + (p & b));
+  b = ((d * 33) - (a - 85)) - ((q - p) + (q - p));
+  c = ((b | b) + (p ^ q)) | ((d | d) ^ (d ^ 11));
+  c = ((q - d) * (b & c)) & ((p - d) + (a * c));
+  if(b < 55){
+    d = ((c + c) & (a | c)) ^ ((a + q) ^ (d - q));
+  }else{
+    a = ((c & c) & (p | p)) ^ ((q - c) | (d - 39));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((p + c) - (p + 12)) - ((b - 65) + (p * 71));
+  }
+  d = ((a ^ p) - (c & p)) | ((c ^ c) + (a - d));
+  c = ((c ^ a) - (q | q)) & ((c - b) & (b + c));
+  c = ((c | c) & (b - b)) & ((a & p) ^ (c * q));
+  if(d < c){
+    b = ((b | p) + (q ^ 22)) & ((d ^ 18) ^ (d | d));
+  }else{
+    b = ((q | b) | (p ^ a)) | ((a | b) & (d & a));
+  }
+  d = ((q + 43) ^ (d - b)) ^ ((c - q) + (p - 88));
+  d = ((c + 43) ^ (q - 86)) - ((p + a) * (d * 12));
+  for(i = 0; i < 40; i++){
+    a = ((d & 54) & (p & 71)) & ((p * b) | (c ^ p));
+  }
+  c = ((q & 35) * (q ^ d)) - ((b * c) - (q | 12));
+  if(d < q){
+    b = ((q + a) & (p & d)) * ((a | 13) | (p - d));
+  }else{
+    b = ((d | p) + (c * a)) ^ ((d * d) ^ (q - c));
+  }
+  b = ((c * 65) & (a ^ a)) & ((a - d) & (b ^ c));
+  c = ((p & b) - (c + d)) ^ ((q ^ p) ^ (p * p));
+  a = ((c + a) ^ (c * b)) - ((b - 14) | (b | q));
+  d = ((q + c) | (a | p)) | ((c * c) + (a - p));
+  if(b < p){
+    b = ((b & b) * (c * q)) + ((q * 32) ^ (b & p));
+  }else{
+    b = ((d + c) | (q + p)) & ((q + c) | (p & 2));
+  }
+  d = ((p + a) + (c - c)) & ((q ^ b) & (a - b));
+  c = ((b * 87) & (p | d)) ^ ((a ^ 83) * (q + b));
+  a = ((a - b) & (d + b)) * ((a & a) ^ (p + d));
+  d = ((c & b) * (d ^ d)) + ((a ^ 84) * (d * 55));
+  if(a < 8){
+    c = ((q ^ b) - (b ^ q)) - ((p & q) * (a + 80));
+  }else{
+    c = ((p & 2) - (q * 73)) ^ ((p + b) ^ (c * 21));
+  }
+  d = ((a & 68) + (c ^ p)) ^ ((b - b) - (q & b));
+  for(i = 0; i < 11; i++){
+    c = ((a - a) ^ (p | a)) | ((d & 97) | (a | a));
+  }
+  a = ((b ^ 89) - (p - q)) * ((c * c) + (d ^ q));
+  c = ((c - p) + (d * p)) & ((b & p) - (p - 23));
+  if(a < b){
+    a = ((p + p) + (q - 17)) | ((d ^ a) & (c - q));
+  }else{
+    b = ((c * 79) * (b * p)) & ((c ^ 16) ^ (b ^ a));
+  }
+  d = ((b + q) & (d + q)) * ((p ^ d) & (a * b));
+  c = ((a * p) + (q * d)) - ((p | c) * (a | c));
+  d = ((d ^ a) | (a ^ d)) - ((q & p) & (q * a));
+  for(i = 0; i < 29; i++){
+    d = ((d & 30) + (p - b)) ^ ((d * d) + (p & 91));
+  }
+  if(c < b){
+    a = ((b | p) & (d ^ 74)) - ((c ^ 22) + (d - d));
+  }else{
+    a = ((c ^ b) * (p * 1)) ^ ((a + d) - (d + p));
+  }
+  return a + b + c + d;
+}
+
+int func145(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 85;
+  d = 27;
+  c = ((p * d) | (a * q)) & ((d | c) + (d ^ d));
+  c = ((q | q) ^ (c - p)) + ((b * d) & (a * p));
+  c = ((b | q) + (q * p)) & ((d ^ p) * (p | 63));
+  d = ((q + p) ^ (d - d)) * ((b * q) ^ (c & c));
+  if(c < a){
+    b = ((p + p) | (a | a)) & ((b | p) * (q + q));
+  }else{
+    a = ((b | 2) ^ (c + 71)) | ((p ^ b) - (c * q));
+  }
+  a = ((d * b) - (b & c)) & ((p | a) * (d | a));
+  for(i = 0; i < 40; i++){
+    c = ((b + 94) + (d ^ 21)) + ((d ^ q) & (q - d));
+  }
+  a = ((q * b) + (c ^ a)) * ((p ^ 94) * (q - c));
+  d = ((d & d) * (d * q)) & ((d + b) | (p & a));
+  if(a < 5){
+    b = ((d * b) - (q & a)) | ((b + 39) | (q | q));
+  }else{
+    b = ((q * b) & (d | d)) + ((a * q) | (q ^ c));
+  }
+  b = ((b & p) & (q | a)) * ((d * a) * (a ^ p));
+  d = ((b | q) * (a - a)) + ((p | 65) + (c & 14));
+  d = ((c + a) & (d * c)) * ((q - d) - (c + p));
+  for(i = 0; i < 43; i++){
+    a = ((p & a) | (q + q)) * ((a * q) | (q & b));
+  }
+  if(d < p){
+    c = ((c + a) ^ (a - a)) * ((c - p) + (c + a));
+  }else{
+    b = ((q | d) + (q ^ p)) & ((b - c) + (c - p));
+  }
+  d = ((c + a) | (c ^ p)) + ((b - c) - (q * d));
+  d = ((c ^ d) + (q - 80)) * ((a | b) & (p - b));
+  b = ((p + a) | (d | q)) + ((d & p) | (b | q));
+  b = ((c & d) | (b + 23)) ^ ((d ^ b) - (q + 16));
+  if(c < d){
+    a = ((d * q) + (q & q)) * ((q ^ c) * (q ^ 70));
+  }else{
+    a = ((c | 7) ^ (p ^ d)) - ((q - a) + (q | a));
+  }
+  for(i = 0; i < 28; i++){
+    a = ((b | q) & (a | 87)) * ((b ^ c) + (c - q));
+  }
+  d = ((a - p) * (p * 31)) | ((c & b) - (p * d));
+  a = ((b | q) | (p * d)) & ((c ^ d) & (c * d));
+  a = ((q * b) ^ (p ^ q)) + ((d ^ a) - (d & p));
+  if(a < c){
+    a = ((d & 27) * (d ^ d)) & ((c | 82) + (q + a));
+  }else{
+    a = ((c | 84) & (d | b)) * ((d * a) | (q & q));
+  }
+  c = ((d * b) | (p ^ a)) - ((c * a) - (c | p));
+  c = ((b | b) & (c + q)) ^ ((d ^ 56) | (c - a));
+  for(i = 0; i < 40; i++){
+    b = ((c ^ d) ^ (p ^ b)) - ((d ^ b) ^ (c & p));
+  }
+  d = ((a & b) * (d | c)) & ((p ^ b) & (p | d));
+  if(d < b){
+    c = ((b ^ 60) & (d ^ 69)) - ((q | q) * (b & q));
+  }else{
+    d = ((q - a) + (b - c)) | ((a + q) - (p & q));
+  }
+  a = ((p | q) & (b | d)) ^ ((b | q) | (d * 55));
+  b = ((d | 7) & (b - 91)) ^ ((b - c) * (q | q));
+  c = ((q & q) ^ (b & q)) * ((p + b) * (q + p));
+  b = ((p - q) - (q + 23)) | ((b + p) - (a | d));
+  if(a < d){
+    d = ((a * b) * (a | b)) | ((d - p) + (q ^ c));
+  }else{
+    c = ((q | 8) + (p ^ 31)) ^ ((p - 22) & (a * 70));
+  }
+  a = ((q & 95) + (a - 90)) | ((p * 73) ^ (p * a));
+  d = ((a ^ a) * (d + d)) & ((b | 11) - (a & d));
+  c = ((q - c) & (b | 94)) + ((q ^ 15) - (c & b));
+  a = ((c ^ 83) * (p - c)) * ((c * a) - (d ^ p));
+  if(b < p){
+    b = ((q & d) ^ (p & a)) | ((p * a) & (d | p));
+  }else{
+    b = ((b ^ 75) + (a & d)) ^ ((c | 63) * (b ^ b));
+  }
+  a = ((p ^ q) & (p & 81)) ^ ((p | c) ^ (c ^ 75));
+  for(i = 0; i < 49; i++){
+    c = ((c | p) ^ (c - d)) * ((d * b) + (d + a));
+  }
+  d = ((b * 35) + (a | c)) * ((a * c) | (d ^ p));
+  d = ((a | 39) + (d + a)) - ((a & q) & (b - 48));
+  if(c < q){
+    d = ((q + a) * (b - d)) ^ ((p + 51) & (p + q));
+  }else{
+    c = ((d + a) - (b ^ q)) | ((c + c) * (q ^ d));
+  }
+  b = ((q * b) | (a ^ 32)) | ((a ^ 60) | (a - d));
+  c = ((b - c) * (b - 47)) - ((d | q) + (p & d));
+  b = ((p - d) * (q * 48)) * ((d & a) * (q + b));
+  for(i = 0; i < 3; i++){
+    c = ((q ^ d) - (a - d)) + ((c | d) ^ (a | b));
+  }
+  if(c < b){
+    a = ((p | b) * (c | b)) - ((q + c) - (q + p));
+  }else{
+    a = ((b | b) + (q & 1)) - ((b + q) & (p ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func146(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 92;
+  d = ((q - q) * (c * 59)) & ((p - b) ^ (c - b));
+  b = ((d | c) - (p | d)) - ((d ^ c) + (p * q));
+  a = ((q * 43) & (a ^ b)) + ((c - b) & (b + q));
+  d = ((p ^ p) * (c & 15)) | ((d * c) * (a | 37));
+  if(d < b){
+    c = ((b | b) | (a | 90)) + ((a - a) ^ (c + c));
+  }else{
+    d = ((d + 46) & (d | q)) + ((b | a) | (d * 57));
+  }
+  b = ((d + c) ^ (q ^ d)) | ((p - b) - (p + a));
+  for(i = 0; i < 26; i++){
+    c = ((b | 12) - (c - a)) & ((b * b) * (q ^ d));
+  }
+  c = ((q - 24) + (d * d)) ^ ((q + d) * (b ^ p));
+  d = ((a + 47) ^ (d - 15)) * ((b ^ c) - (d & 62));
+  if(c < d){
+    d = ((d ^ a) + (d - b)) + ((d - a) & (c & b));
+  }else{
+    b = ((d + d) & (a ^ 65)) & ((b * 54) - (a | b));
+  }
+  b = ((a - 26) | (c & d)) * ((b | c) & (a & c));
+  a = ((a ^ d) & (d - 93)) & ((a * a) + (d + c));
+  a = ((a * 35) + (c + d)) - ((a - p) | (p | 12));
+  for(i = 0; i < 23; i++){
+    c = ((q + a) - (b * q)) * ((c + a) & (b & 33));
+  }
+  if(d < q){
+    a = ((a ^ 50) + (d + a)) | ((a + p) | (b - d));
+  }else{
+    c = ((c | b) ^ (c & c)) * ((c - 89) - (c | 88));
+  }
+  c = ((p * q) ^ (d | 89)) * ((a * p) + (b + a));
+  d = ((a | c) ^ (c + p)) - ((b | c) + (a - a));
+  c = ((c + c) * (p | b)) * ((a + 58) + (q ^ q));
+  b = ((d + a) | (a ^ 84)) + ((a & a) & (c - 88));
+  if(c < c){
+    d = ((a ^ d) + (b - b)) & ((p ^ p) | (p & a));
+  }else{
+    c = ((d * 56) | (c * q)) + ((c ^ b) ^ (a * p));
+  }
+  for(i = 0; i < 16; i++){
+    d = ((c ^ b) + (p * q)) - ((p ^ p) ^ (b & 70));
+  }
+  c = ((d + q) & (d ^ p)) + ((p - c) + (c * b));
+  d = ((d | q) | (d - 37)) + ((a * c) | (d - 28));
+  b = ((c ^ 35) + (b & b)) | ((a * 95) + (a * p));
+  if(b < d){
+    d = ((p + d) - (p | q)) & ((p ^ a) * (d & q));
+  }else{
+    d = ((c | b) ^ (q | b)) - ((d ^ 49) + (c * b));
+  }
+  a = ((c - p) | (q + c)) | ((b - p) & (p * q));
+  d = ((d + 46) - (p & 5)) + ((q | d) | (p * b));
+  for(i = 0; i < 28; i++){
+    a = ((q ^ p) - (p + 85)) ^ ((q * p) + (a * c));
+  }
+  c = ((d - d) | (b & p)) ^ ((q + 66) + (d ^ b));
+  if(c < 36){
+    d = ((q + d) - (d + b)) - ((d & b) - (c * 67));
+  }else{
+    a = ((c - 55) ^ (c | a)) & ((c | d) ^ (q - b));
+  }
+  d = ((c ^ 18) & (a * q)) ^ ((b - 95) & (b & c));
+  d = ((a & c) * (c & d)) & ((d & a) + (b + c));
+  b = ((b * 86) & (c - d)) + ((p + 1) - (a & p));
+  c = ((b + 69) * (a ^ p)) | ((q & q) ^ (c & d));
+  if(c < 97){
+    d = ((b ^ a) | (b ^ p)) * ((p | p) ^ (a | a));
+  }else{
+    a = ((d & q) - (q - 86)) | ((c - p) ^ (q - c));
+  }
+  d = ((q | a) * (c * 18)) * ((b | 84) + (c - c));
+  b = ((q * 49) ^ (b + p)) ^ ((c | c) - (b | q));
+  a = ((q + 85) - (a ^ 54)) & ((b | b) ^ (a + p));
+  b = ((p & q) - (b * 70)) & ((d ^ q) * (a * c));
+  if(a < p){
+    c = ((q ^ p) | (c ^ c)) | ((p & q) + (d | b));
+  }else{
+    d = ((a - q) + (a - 56)) + ((q ^ p) | (b - d));
+  }
+  c = ((c & b) + (d & 61)) & ((q & 93) & (d ^ q));
+  for(i = 0; i < 10; i++){
+    d = ((c + 56) + (q + a)) + ((a + a) & (p ^ b));
+  }
+  c = ((b & p) * (q ^ c)) * ((a & p) + (c * 74));
+  b = ((b & c) & (p + a)) - ((p + p) * (b * b));
+  if(d < q){
+    a = ((a * q) - (b - 62)) & ((d & 12) * (c + b));
+  }else{
+    b = ((b * 87) * (q - 98)) ^ ((q * q) + (a ^ c));
+  }
+  b = ((d ^ q) | (p + d)) - ((p | b) - (a ^ q));
+  c = ((a & a) ^ (q & c)) ^ ((b - b) & (p * q));
+  a = ((d * q) ^ (b ^ d)) * ((p * c) & (p * 98));
+  for(i = 0; i < 24; i++){
+    a = ((c + d) * (d + 79)) * ((c + q) + (a ^ b));
+  }
+  if(a < c){
+    d = ((d * 18) * (a | d)) + ((p | 20) ^ (d + p));
+  }else{
+    a = ((a * c) * (p - b)) + ((d | 32) * (d | 83));
+  }
+  return a + b + c + d;
+}
+
+int func147(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 87;
+  d = 70;
+  a = ((a | a) * (c * q)) - ((b & 27) - (b | q));
+  b = ((p - q) * (q ^ p)) & ((q * p) | (b + b));
+  b = ((c ^ c) | (c * d)) - ((p + 50) & (b + q));
+  c = ((q - c) - (b & p)) ^ ((d | p) | (b & a));
+  if(c < q){
+    b = ((q * b) & (q - d)) ^ ((b ^ c) | (q ^ 25));
+  }else{
+    d = ((d ^ a) ^ (b + d)) ^ ((c + a) * (b + p));
+  }
+  a = ((q * 49) - (d | q)) | ((b - d) & (q ^ 6));
+  for(i = 0; i < 16; i++){
+    c = ((q + 90) - (p ^ 57)) * ((b + b) | (d & q));
+  }
+  b = ((d * 6) * (q & q)) * ((b + q) & (a & q));
+  b = ((p + q) ^ (p | p)) - ((p * q) * (d + 18));
+  if(d < d){
+    d = ((a - 62) * (a | a)) & ((c + b) * (c | 23));
+  }else{
+    c = ((d ^ b) ^ (d * p)) * ((c * 52) | (c ^ p));
+  }
+  b = ((d | a) & (a + c)) + ((q & a) ^ (d & p));
+  a = ((q ^ a) + (c | p)) * ((p | b) * (p + a));
+  b = ((p | 66) * (d | 29)) ^ ((c + d) - (b | b));
+  for(i = 0; i < 25; i++){
+    a = ((p & a) * (q * b)) + ((p & b) ^ (q & 44));
+  }
+  if(a < p){
+    b = ((d ^ b) & (b & a)) - ((q ^ d) | (c | c));
+  }else{
+    d = ((a & d) & (a + 93)) ^ ((d | p) * (q - a));
+  }
+  d = ((d | c) + (p + c)) + ((p + q) + (b & q));
+  b = ((d - p) + (c ^ a)) + ((c * a) | (d * c));
+  b = ((a & q) + (d * q)) ^ ((b & p) + (a ^ c));
+  c = ((b * q) * (d + q)) & ((d * b) ^ (p * b));
+  if(b < p){
+    b = ((b | b) | (b & d)) * ((p | c) & (b ^ d));
+  }else{
+    d = ((d * c) & (c - b)) - ((q - a) ^ (c ^ d));
+  }
+  for(i = 0; i < 18; i++){
+    a = ((c ^ d) + (q * 67)) - ((p + p) * (a ^ 92));
+  }
+  d = ((q - a) & (q & p)) * ((a - q) + (d | 13));
+  a = ((c - b) - (d - d)) + ((d * c) * (p + d));
+  b = ((b ^ 35) + (c + q)) - ((q + b) * (q - p));
+  if(a < p){
+    b = ((p ^ q) + (a | 85)) ^ ((d * d) | (q * b));
+  }else{
+    a = ((p ^ b) & (b ^ c)) * ((d * d) - (c * b));
+  }
+  b = ((p - d) - (d ^ p)) + ((a * d) ^ (d | p));
+  a = ((d - p) - (b + 42)) + ((a - c) & (q - 74));
+  for(i = 0; i < 16; i++){
+    b = ((q + d) | (c - q)) - ((q ^ d) - (c ^ q));
+  }
+  a = ((d & b) - (b ^ 21)) + ((c * b) + (b ^ d));
+  if(a < 41){
+    d = ((q + 6) ^ (d ^ p)) & ((a & c) - (c | 75));
+  }else{
+    a = ((d ^ q) ^ (d * p)) - ((p * c) ^ (a ^ a));
+  }
+  a = ((p & a) ^ (p * q)) ^ ((d + p) & (d ^ c));
+  d = ((d | a) & (a & c)) | ((a | a) ^ (a | 10));
+  a = ((a * 90) * (a * 8)) + ((q | 54) - (a + q));
+  b = ((p - c) * (d ^ c)) + ((c - a) | (d * c));
+  if(d < c){
+    c = ((q ^ 27) ^ (c ^ d)) ^ ((b * 60) * (d & 89));
+  }else{
+    a = ((d & c) - (a ^ 30)) & ((q + a) ^ (p & 35));
+  }
+  c = ((a - q) * (p & 11)) + ((p * d) - (b * a));
+  d = ((c | a) ^ (b - p)) - ((d | p) + (d | 10));
+  d = ((c * d) + (p ^ c)) - ((a - c) & (d & 54));
+  d = ((q ^ b) + (p + b)) ^ ((a & a) | (d | c));
+  if(d < c){
+    d = ((b * c) - (d * b)) * ((b | a) & (d - a));
+  }else{
+    b = ((d & b) + (p & b)) + ((p ^ 48) * (b + p));
+  }
+  d = ((p - c) + (p ^ q)) | ((d | q) + (d & 20));
+  for(i = 0; i < 41; i++){
+    d = ((q * d) - (c + 69)) * ((c - d) & (d & q));
+  }
+  d = ((b | 50) - (a - a)) + ((q * 41) & (p + 57));
+  c = ((d + p) + (d + 21)) & ((d & 34) ^ (q - b));
+  if(b < d){
+    b = ((c | 79) + (a - b)) + ((c - a) ^ (c ^ d));
+  }else{
+    b = ((q & a) - (q & c)) ^ ((a | p) + (c | p));
+  }
+  d = ((c & c) - (a ^ 72)) | ((q | d) ^ (q | 41));
+  c = ((a - 73) - (b | a)) - ((a ^ q) & (p - 32));
+  b = ((d ^ c) ^ (p ^ q)) - ((c ^ c) ^ (b & b));
+  for(i = 0; i < 24; i++){
+    c = ((a - 37) | (a & p)) * ((c - p) * (c | 26));
+  }
+  if(c < b){
+    a = ((d - 1) | (q | 1)) + ((b - b) | (c | d));
+  }else{
+    d = ((p - b) * (b - p)) - ((b - q) & (c ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func148(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 88;
+  d = 86;
+  d = ((a | b) | (d - 6)) * ((q | p) & (p & a));
+  d = ((d ^ p) | (b & c)) - ((p & c) * (b | a));
+  a = ((p & d) | (p - a)) + ((c * 18) + (p * a));
+  b = ((a * 91) - (a - q)) ^ ((p | d) | (p & 46));
+  if(d < p){
+    c = ((q ^ q) ^ (q ^ p)) & ((p + 68) - (p * b));
+  }else{
+    a = ((p - q) & (c | c)) - ((p + b) * (a | 24));
+  }
+  c = ((d * 61) + (q - c)) * ((q - q) | (d ^ a));
+  for(i = 0; i < 32; i++){
+    a = ((q & a) ^ (q - 99)) ^ ((a - 60) + (d - 17));
+  }
+  c = ((c + c) - (p + c)) ^ ((p * c) - (c + 3));
+  a = ((d ^ 20) * (a ^ d)) * ((c ^ q) ^ (p + b));
+  if(d < p){
+    a = ((c ^ c) | (p + d)) & ((a & b) + (d * q));
+  }else{
+    d = ((b ^ c) + (b & q)) - ((a - c) * (q - 27));
+  }
+  b = ((b & b) | (a - 18)) - ((p - d) & (b & b));
+  d = ((a - p) ^ (a | b)) + ((p - 1) & (b | p));
+  d = ((p | 1) | (p - 41)) ^ ((q ^ q) * (d * d));
+  for(i = 0; i < 31; i++){
+    c = ((d & a) * (a & 18)) & ((b & q) ^ (a + c));
+  }
+  if(a < c){
+    c = ((a & a) ^ (p & 20)) ^ ((a ^ 68) * (d * 74));
+  }else{
+    b = ((a + q) + (a + q)) + ((a + c) & (d * 26));
+  }
+  c = ((p & 85) | (d * 28)) * ((b + q) * (c + b));
+  d = ((c | d) + (d | 88)) | ((d & d) + (b ^ 15));
+  c = ((q | q) + (p * d)) & ((d + 39) * (q + c));
+  d = ((d * 16) | (p ^ q)) | ((b * b) & (d | q));
+  if(c < a){
+    a = ((p * c) | (c | b)) | ((q + a) & (c ^ d));
+  }else{
+    a = ((p & d) + (b ^ b)) - ((d | p) & (b * d));
+  }
+  for(i = 0; i < 25; i++){
+    a = ((q & b) * (q | b)) ^ ((c & p) - (b + d));
+  }
+  c = ((q - q) | (a ^ 93)) | ((a | d) + (q ^ a));
+  b = ((p ^ 85) - (p & b)) ^ ((d + a) - (a + d));
+  b = ((p | 37) & (a - b)) ^ ((b * d) - (q ^ 44));
+  if(b < 5){
+    a = ((q + d) & (a | d)) | ((b * d) - (c ^ d));
+  }else{
+    c = ((d | a) ^ (b & 68)) - ((p * b) | (b | a));
+  }
+  b = ((c * a) * (d - q)) - ((q * 26) ^ (b + c));
+  a = ((d + b) * (c | 22)) + ((a - a) & (d - c));
+  for(i = 0; i < 29; i++){
+    d = ((c | 45) * (c - d)) - ((a * 33) ^ (d & d));
+  }
+  c = ((b ^ a) | (d * q)) * ((p * p) - (c * 99));
+  if(d < 98){
+    a = ((p + p) | (q - a)) | ((a - 30) | (b & d));
+  }else{
+    d = ((d + p) | (p * p)) + ((a & a) - (c ^ 95));
+  }
+  b = ((a ^ q) * (a + d)) & ((b | 22) | (q - c));
+  d = ((q | p) + (p & 5)) | ((q | q) | (b + p));
+  a = ((c ^ q) * (a & b)) ^ ((p + 4) * (c & q));
+  d = ((q | 61) ^ (a * b)) | ((c | b) ^ (c | c));
+  if(a < q){
+    c = ((c * 47) & (b * p)) + ((p + q) * (d & 59));
+  }else{
+    d = ((d | 76) * (q - a)) - ((p + c) ^ (q + d));
+  }
+  b = ((c - d) & (p * q)) * ((a | b) ^ (b + p));
+  a = ((d | 35) | (p & d)) * ((p - b) - (b ^ 2));
+  a = ((p + q) - (c - a)) * ((q & q) + (q * c));
+  a = ((b & 37) ^ (a & q)) | ((p | q) & (a & b));
+  if(d < p){
+    d = ((c & q) | (a * b)) | ((c | b) - (q ^ b));
+  }else{
+    a = ((p * p) - (b + c)) * ((q & 17) ^ (d ^ p));
+  }
+  d = ((p & c) ^ (p + a)) + ((q * 76) ^ (q - p));
+  for(i = 0; i < 4; i++){
+    c = ((b & d) | (q | d)) - ((c | b) + (b ^ 64));
+  }
+  d = ((p + 6) + (p + d)) & ((a & 30) + (a ^ d));
+  a = ((c - 91) ^ (a ^ 71)) * ((b * 63) | (c * a));
+  if(b < 44){
+    d = ((c ^ d) + (q * 29)) & ((b & d) + (q * b));
+  }else{
+    a = ((p ^ 38) | (p * c)) + ((p ^ c) & (c ^ 49));
+  }
+  d = ((a & b) - (d ^ 43)) ^ ((c ^ 4) * (b | 47));
+  c = ((b & 99) | (a - c)) * ((q - c) | (c * c));
+  a = ((a - d) | (p | a)) & ((c & a) - (b + b));
+  for(i = 0; i < 20; i++){
+    d = ((p * p) | (d + b)) - ((d * b) & (p + q));
+  }
+  if(b < 57){
+    d = ((a - 73) - (p ^ b)) & ((c | b) & (d | d));
+  }else{
+    c = ((q ^ a) - (c * p)) - ((b - c) * (p * c));
+  }
+  return a + b + c + d;
+}
+
+int func149(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 72;
+  d = 64;
+  b = ((c - b) - (p - a)) * ((b | a) + (b - 22));
+  d = ((a ^ 10) + (c & c)) | ((a - a) - (p | a));
+  c = ((b & 75) ^ (b & p)) - ((c ^ q) | (d * d));
+  a = ((c * b) & (p + a)) | ((b | b) - (q & 80));
+  if(a < d){
+    b = ((p ^ q) ^ (a ^ b)) ^ ((c & 12) & (a - d));
+  }else{
+    a = ((p - c) ^ (b + a)) - ((q ^ q) ^ (a + q));
+  }
+  c = ((p | c) | (p ^ b)) ^ ((c ^ a) & (c - p));
+  for(i = 0; i < 48; i++){
+    b = ((a + d) & (b & 93)) + ((b & 5) * (d | p));
+  }
+  d = ((q + p) * (q | 47)) * ((b - b) & (c ^ a));
+  c = ((q * q) | (c ^ a)) | ((d | 14) | (b ^ b));
+  if(a < 39){
+    b = ((p - 23) ^ (q - a)) | ((c * 99) | (c | a));
+  }else{
+    a = ((b & p) ^ (q ^ d)) + ((c | d) | (d & d));
+  }
+  b = ((p - a) ^ (p | q)) & ((p | c) ^ (c - 38));
+  c = ((c & 29) | (c & p)) ^ ((a | c) * (p + a));
+  b = ((c & 25) * (a ^ q)) | ((d ^ q) & (d - c));
+  for(i = 0; i < 48; i++){
+    b = ((b ^ b) * (q | q)) ^ ((q * 70) + (q - d));
+  }
+  if(c < c){
+    b = ((q ^ p) - (p | b)) ^ ((b ^ b) - (d + b));
+  }else{
+    a = ((q + d) - (p - a)) * ((d ^ c) | (q | 29));
+  }
+  a = ((a + p) * (d - b)) ^ ((q - p) ^ (b ^ d));
+  b = ((a | q) & (d ^ c)) - ((b - c) ^ (c & p));
+  b = ((q ^ q) * (d | c)) & ((d ^ a) + (q | p));
+  c = ((q | 28) * (b & 91)) & ((c & c) - (c * 83));
+  if(d < q){
+    a = ((b - 36) & (d + d)) * ((p & d) - (p - q));
+  }else{
+    b = ((c | 89) ^ (a - 76)) - ((b + a) & (c + q));
+  }
+  for(i = 0; i < 29; i++){
+    a = ((c ^ b) | (a | a)) ^ ((d + p) | (c & 16));
+  }
+  d = ((d & q) + (c * 17)) ^ ((p | d) * (q * 1));
+  b = ((a + p) | (a * a)) + ((q ^ d) | (p | c));
+  c = ((a * b) * (p + 78)) + ((c - b) + (b + b));
+  if(d < 44){
+    c = ((p | c) | (a * b)) ^ ((p * p) & (c & 49));
+  }else{
+    c = ((b | c) + (p | q)) | ((b | c) * (b | p));
+  }
+  d = ((d * q) - (d - a)) | ((a ^ 10) - (a + p));
+  a = ((a * 12) ^ (a ^ a)) ^ ((b - a) + (q & 79));
+  for(i = 0; i < 46; i++){
+    a = ((c | c) - (b + p)) * ((b | a) * (a & p));
+  }
+  a = ((b + p) - (a * d)) & ((p + c) * (c * c));
+  if(c < p){
+    d = ((d ^ c) * (a + a)) & ((q & a) | (q - c));
+  }else{
+    c = ((d ^ b) | (a | d)) + ((d - p) + (p & 82));
+  }
+  a = ((q & a) * (b ^ 87)) + ((a ^ p) ^ (d * p));
+  d = ((a & 43) | (b ^ a)) & ((p * p) - (q | 36));
+  d = ((p + d) + (c | b)) * ((p ^ 69) ^ (a - q));
+  b = ((b | p) - (a ^ d)) ^ ((d & b) | (b ^ 39));
+  if(d < p){
+    c = ((d + d) & (p + 49)) | ((q ^ a) ^ (p & p));
+  }else{
+    a = ((p * c) ^ (q | c)) * ((b * 68) * (b - 20));
+  }
+  b = ((d | q) & (d + b)) * ((b | p) ^ (p + q));
+  c = ((d | 22) & (p + d)) - ((p - 53) + (c | b));
+  c = ((c | p) & (a * 21)) ^ ((a & 44) - (b & d));
+  b = ((b & 97) * (d ^ a)) & ((b + 90) & (c & q));
+  if(a < 13){
+    a = ((c * d) + (q | c)) - ((q & d) + (c * a));
+  }else{
+    d = ((q + a) ^ (c + 47)) & ((c ^ 1) - (b + c));
+  }
+  a = ((p ^ d) + (b | q)) + ((b * d) + (a * 20));
+  for(i = 0; i < 2; i++){
+    c = ((b - 71) & (c * 34)) ^ ((a | p) ^ (c ^ p));
+  }
+  b = ((p - q) - (a & 31)) * ((q | a) | (b & 54));
+  a = ((q - 17) | (p ^ 94)) | ((q + q) + (a * p));
+  if(a < p){
+    c = ((d | d) + (q | a)) * ((a | a) ^ (b * 76));
+  }else{
+    a = ((d & 14) & (c + 96)) & ((c * c) - (b + d));
+  }
+  d = ((d - 35) | (p + 55)) * ((p - 62) & (q + q));
+  a = ((p ^ p) + (b | 49)) | ((d + 37) - (a & a));
+  c = ((c - b) ^ (d & 53)) & ((b * c) + (c ^ p));
+  for(i = 0; i < 43; i++){
+    b = ((b + 78) ^ (c * q)) & ((b | a) & (d | c));
+  }
+  if(a < b){
+    c = ((b - q) & (q ^ p)) & ((d & q) - (q & p));
+  }else{
+    a = ((c | d) - (a & q)) + ((d - p) * (a & 88));
+  }
+  return a + b + c + d;
+}
+
+int func150(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 80;
+  d = ((d | a) ^ (q + d)) & ((p | q) - (d - 54));
+  a = ((d - a) + (d * p)) + ((p & c) | (q & d));
+  a = ((a * d) ^ (p ^ d)) * ((a & c) - (p ^ 8));
+  c = ((q & 1) + (d - b)) + ((p & d) * (a - 44));
+  if(c < c){
+    c = ((c + a) + (a ^ 88)) | ((q & d) - (q + 53));
+  }else{
+    c = ((p + a) * (b & d)) & ((d ^ 38) * (c - c));
+  }
+  d = ((p - p) ^ (d | p)) & ((d & a) - (b | p));
+  for(i = 0; i < 8; i++){
+    a = ((d * p) & (q - a)) ^ ((c | 49) ^ (b * p));
+  }
+  a = ((a - p) + (a | a)) | ((d - 24) - (p ^ d));
+  d = ((d - q) * (d | c)) ^ ((c + q) - (p - b));
+  if(a < 87){
+    d = ((a | d) + (a ^ p)) & ((q + 3) * (a - d));
+  }else{
+    c = ((c | b) * (p - p)) ^ ((b | c) | (c | 82));
+  }
+  d = ((c * a) ^ (p | d)) * ((p - 30) ^ (a | b));
+  b = ((p ^ c) ^ (d * 8)) & ((c & d) + (d * 51));
+  b = ((a + q) ^ (c - q)) ^ ((q - d) | (p | a));
+  for(i = 0; i < 32; i++){
+    c = ((p & c) & (q | p)) - ((d ^ b) + (a + p));
+  }
+  if(b < 76){
+    c = ((d - p) * (b - d)) - ((c | c) - (p * c));
+  }else{
+    c = ((p + c) * (b & 50)) ^ ((c | b) - (p ^ p));
+  }
+  c = ((q & c) ^ (a + c)) + ((d ^ d) | (d - 7));
+  d = ((q ^ q) * (c + b)) & ((p | 8) | (p | 35));
+  a = ((a * p) | (a * d)) - ((b & a) & (d * p));
+  b = ((d + a) | (c - a)) * ((b ^ b) | (b - a));
+  if(c < q){
+    d = ((b * p) * (a | 65)) * ((p + b) + (q | p));
+  }else{
+    a = ((a * d) * (p ^ q)) & ((a | q) + (c | 37));
+  }
+  for(i = 0; i < 9; i++){
+    a = ((p ^ d) | (d * b)) * ((a + q) ^ (p - p));
+  }
+  b = ((q * a) | (p - q)) | ((a - c) + (c - c));
+  a = ((p + b) & (b ^ b)) ^ ((a - a) * (d | d));
+  a = ((p & d) & (b ^ p)) - ((c & 96) & (a - p));
+  if(c < d){
+    b = ((p + b) | (c + c)) ^ ((b - 3) * (a - b));
+  }else{
+    a = ((d + 71) * (d ^ 95)) & ((c & c) + (q + c));
+  }
+  c = ((a ^ c) & (a * a)) * ((p + c) + (c + c));
+  d = ((q & a) + (a ^ 67)) + ((p * d) * (c - c));
+  for(i = 0; i < 40; i++){
+    c = ((c - b) * (a & c)) ^ ((d ^ b) & (b - d));
+  }
+  c = ((a | 89) + (d - q)) & ((d & p) + (q | d));
+  if(b < 19){
+    a = ((q & b) * (q ^ 11)) - ((a & c) - (c ^ 80));
+  }else{
+    d = ((p ^ q) & (q + q)) | ((p | b) & (c & q));
+  }
+  a = ((p ^ p) + (q & c)) - ((p + 89) ^ (c * q));
+  c = ((c | 8) * (c ^ 28)) - ((p ^ b) ^ (c | q));
+  d = ((a * c) - (a & 61)) * ((b ^ q) ^ (q & b));
+  a = ((c - c) | (d | c)) - ((d * p) | (c | a));
+  if(a < p){
+    a = ((a ^ c) | (p ^ c)) - ((q ^ b) ^ (a + 45));
+  }else{
+    b = ((b & a) & (c * b)) * ((b ^ p) + (b ^ c));
+  }
+  c = ((b - p) ^ (b & d)) ^ ((b - 65) - (d * q));
+  d = ((p & q) * (c * q)) + ((p | q) & (a & 63));
+  a = ((p | b) & (c ^ c)) * ((p + p) | (p - a));
+  b = ((p & p) ^ (p | d)) ^ ((b ^ p) - (c ^ a));
+  if(d < p){
+    a = ((q * 65) - (b ^ c)) & ((p - a) * (p * d));
+  }else{
+    a = ((a | b) & (c & p)) - ((d * 57) + (c | a));
+  }
+  d = ((c ^ 35) | (d & 32)) + ((p * d) | (a ^ b));
+  for(i = 0; i < 9; i++){
+    c = ((b & 43) & (c & 74)) | ((a ^ c) * (d * b));
+  }
+  d = ((a ^ q) - (p - b)) * ((b * d) * (b - 95));
+  c = ((c + q) * (q - a)) - ((p & 84) & (q + b));
+  if(d < q){
+    d = ((d | d) * (c + b)) ^ ((q | c) & (q - d));
+  }else{
+    b = ((a & d) | (a ^ q)) * ((c + q) - (c + a));
+  }
+  a = ((d & p) - (c ^ a)) & ((d + 41) & (c * c));
+  c = ((a | b) * (b | 58)) * ((q + c) & (c ^ 5));
+  b = ((b * d) | (d + 51)) + ((q + d) + (p & 75));
+  for(i = 0; i < 10; i++){
+    a = ((c ^ d) & (c & a)) * ((p ^ b) ^ (d ^ a));
+  }
+  if(c < q){
+    d = ((p - p) | (d ^ 24)) - ((a | b) + (b + 33));
+  }else{
+    b = ((c - a) ^ (a - d)) & ((p ^ a) ^ (b | p));
+  }
+  return a + b + c + d;
+}
+
+int func151(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 85;
+  d = 29;
+  a = ((c ^ 54) & (a & 89)) | ((q + b) * (p ^ d));
+  a = ((c + d) | (q | q)) - ((c ^ p) * (b + p));
+  d = ((c * a) * (q ^ p)) - ((q | c) + (c & b));
+  a = ((a & c) * (q | b)) & ((b + c) * (c | b));
+  if(a < c){
+    b = ((d | c) ^ (b ^ 27)) * ((a | d) - (d * d));
+  }else{
+    c = ((b & q) | (q & d)) + ((c | b) ^ (q & p));
+  }
+  b = ((c ^ c) & (b + c)) | ((d + c) - (a & b));
+  for(i = 0; i < 7; i++){
+    d = ((b + 87) | (c + p)) | ((a - d) ^ (q & 92));
+  }
+  d = ((b ^ q) & (d & p)) & ((p + 29) + (d - d));
+  c = ((d - p) - (q | p)) - ((d - 93) - (c ^ d));
+  if(b < b){
+    c = ((b ^ p) * (a + 76)) - ((a - p) - (a | a));
+  }else{
+    d = ((d + d) - (b * 71)) * ((c - a) - (b + p));
+  }
+  a = ((d | a) - (d ^ a)) - ((b * 90) - (a & b));
+  a = ((p + c) ^ (q + q)) & ((q - d) + (a * d));
+  a = ((c | b) + (b - q)) & ((q | b) * (q * a));
+  for(i = 0; i < 10; i++){
+    b = ((c ^ b) & (a + c)) + ((a - p) - (a | p));
+  }
+  if(d < 47){
+    d = ((d | q) & (p ^ d)) - ((c * p) * (d - p));
+  }else{
+    c = ((q * d) & (a ^ d)) ^ ((b | q) & (q + d));
+  }
+  d = ((a | p) ^ (b | c)) ^ ((p | 48) * (a * q));
+  a = ((b - p) * (q * a)) - ((c - 22) * (b | 27));
+  a = ((b + 98) - (a ^ 86)) + ((a & p) | (p ^ b));
+  d = ((a - 81) ^ (q | d)) + ((q - d) * (c | d));
+  if(c < 9){
+    a = ((b ^ c) - (q & 56)) + ((a & 9) & (q | 82));
+  }else{
+    b = ((p - b) ^ (c & d)) & ((a ^ a) + (a * c));
+  }
+  for(i = 0; i < 14; i++){
+    b = ((p | c) * (c ^ b)) | ((p | 19) | (b * b));
+  }
+  b = ((d | 16) - (p | a)) - ((b | 27) & (q * c));
+  a = ((b | p) + (b + b)) | ((q & b) & (b + b));
+  a = ((d | q) & (a | c)) ^ ((q | c) | (a - b));
+  if(d < b){
+    a = ((d ^ c) | (c * d)) + ((d ^ q) ^ (d * d));
+  }else{
+    b = ((d & c) ^ (d ^ p)) + ((a - p) | (q | 71));
+  }
+  a = ((b | a) & (b + b)) & ((a ^ q) | (b ^ b));
+  c = ((d - d) ^ (q ^ c)) & ((b - 35) - (b | c));
+  for(i = 0; i < 17; i++){
+    b = ((q ^ b) * (b - c)) * ((c | a) & (c + c));
+  }
+  a = ((b * a) + (b * 66)) & ((c * 53) - (b + q));
+  if(c < q){
+    c = ((a + d) | (p & c)) | ((q + c) + (b * a));
+  }else{
+    b = ((c + q) | (q | q)) - ((a | c) + (b - p));
+  }
+  b = ((q + q) * (a ^ p)) & ((a & d) | (b * b));
+  c = ((d | b) ^ (q & 13)) & ((c & q) + (b & b));
+  d = ((p ^ 39) & (a ^ b)) * ((a * p) | (b - d));
+  d = ((a ^ 60) + (d ^ q)) * ((d ^ d) & (b | c));
+  if(b < 60){
+    c = ((p - 24) | (b - b)) + ((c & 38) - (p ^ 50));
+  }else{
+    c = ((b & b) ^ (p + c)) ^ ((q - 73) | (a + 56));
+  }
+  a = ((p ^ 60) | (d ^ b)) * ((q - c) & (d + q));
+  a = ((d + d) ^ (q ^ c)) + ((b * 13) * (a + p));
+  d = ((p + c) & (a + a)) | ((q ^ a) ^ (c + p));
+  a = ((b + a) * (d - 48)) | ((p | p) - (c | c));
+  if(b < 24){
+    c = ((p | d) + (b & q)) & ((c ^ q) + (d + p));
+  }else{
+    d = ((q ^ p) * (b * q)) - ((p | 97) - (p | c));
+  }
+  a = ((b ^ p) ^ (d ^ p)) & ((c + b) | (p * d));
+  for(i = 0; i < 28; i++){
+    b = ((a ^ c) & (b * 92)) - ((b & b) - (p * q));
+  }
+  b = ((d * c) * (p - 5)) + ((b & 79) ^ (d | a));
+  c = ((p + b) + (p + b)) | ((d | p) * (a + p));
+  if(b < b){
+    d = ((q & d) - (d * c)) + ((a + q) + (a + 89));
+  }else{
+    b = ((p & c) - (q - q)) + ((c & b) * (q * q));
+  }
+  c = ((p ^ q) & (c & q)) | ((q ^ q) * (c - c));
+  b = ((c - b) | (a - 78)) | ((q + 29) - (a | b));
+  d = ((b * a) ^ (c + b)) | ((a & 27) & (p + d));
+  for(i = 0; i < 50; i++){
+    d = ((q | 45) ^ (p | d)) - ((p * d) | (p & p));
+  }
+  if(a < c){
+    a = ((a * c) & (d + 70)) * ((p - c) + (c - 5));
+  }else{
+    a = ((q & 57) - (a + a)) ^ ((b - d) ^ (a * c));
+  }
+  return a + b + c + d;
+}
+
+int func152(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 98;
+  d = 18;
+  b = ((p ^ q) - (b | 61)) - ((d - c) | (c + a));
+  c = ((p - d) * (b & a)) ^ ((b | c) & (p + 99));
+  a = ((d * 67) ^ (b * 26)) - ((b ^ c) | (b - a));
+  c = ((p + q) * (a ^ 18)) ^ ((p * q) * (c * c));
+  if(d < b){
+    d = ((d * q) - (a + p)) & ((b + c) & (c * q));
+  }else{
+    c = ((a | b) & (q & p)) + ((p & q) + (a + 45));
+  }
+  d = ((a + d) + (p ^ d)) + ((c & a) * (d | p));
+  for(i = 0; i < 23; i++){
+    d = ((d - 90) * (c * 61)) + ((c - p) ^ (p | 21));
+  }
+  b = ((d * c) ^ (p ^ b)) & ((q | 38) - (a ^ a));
+  c = ((d - 22) & (c - a)) + ((d * d) * (b ^ d));
+  if(c < b){
+    b = ((d | a) ^ (a | d)) | ((d & q) & (a | 71));
+  }else{
+    b = ((a | 23) | (p & 2)) & ((q * c) - (p + b));
+  }
+  c = ((b + b) & (q * b)) * ((b | c) - (d - d));
+  c = ((b & 12) ^ (d | 13)) & ((d & d) * (p + c));
+  b = ((p * p) + (c * 64)) - ((b & c) - (c + 93));
+  for(i = 0; i < 9; i++){
+    d = ((a & b) ^ (q | c)) - ((a | d) * (a | c));
+  }
+  if(c < q){
+    d = ((b | q) + (a | d)) * ((a ^ b) * (p & p));
+  }else{
+    c = ((c * 98) * (p | a)) ^ ((p * c) ^ (b & d));
+  }
+  a = ((p * b) - (a + a)) * ((a - q) & (q - b));
+  c = ((p + p) * (d + a)) | ((p & 50) ^ (p & q));
+  c = ((a - d) + (d ^ q)) ^ ((b * d) - (q * p));
+  d = ((p - c) + (a ^ d)) ^ ((b | 34) - (q | q));
+  if(b < b){
+    d = ((b - a) ^ (d + c)) * ((d * b) + (p + p));
+  }else{
+    a = ((c + a) - (d + q)) ^ ((d ^ 91) + (q - a));
+  }
+  for(i = 0; i < 47; i++){
+    d = ((a + a) | (d + a)) ^ ((q | 60) ^ (a | c));
+  }
+  d = ((p * d) | (d | b)) ^ ((b | q) - (q ^ b));
+  d = ((p | c) + (d - 19)) + ((c + b) - (d ^ a));
+  c = ((a ^ 83) + (b * 37)) * ((p ^ p) ^ (q * q));
+  if(a < 95){
+    d = ((p & p) ^ (d + a)) & ((b - 23) & (a - 28));
+  }else{
+    c = ((b | q) - (q ^ c)) + ((b - a) + (c & c));
+  }
+  d = ((c ^ a) ^ (b & q)) + ((p & c) | (q - 38));
+  c = ((c | c) ^ (a + b)) - ((d | a) - (p & d));
+  for(i = 0; i < 27; i++){
+    d = ((a + b) | (d * a)) & ((d | 45) - (c | p));
+  }
+  c = ((b * d) + (d - p)) & ((q - p) & (q + p));
+  if(b < a){
+    d = ((d * q) + (d * q)) ^ ((b + c) ^ (d ^ c));
+  }else{
+    b = ((b ^ p) * (a | 56)) ^ ((a + c) + (a + b));
+  }
+  b = ((c - 75) + (p + 87)) + ((q ^ p) + (p * q));
+  c = ((p - 30) * (b & a)) * ((p * 8) & (b - d));
+  d = ((a * 45) & (q & p)) * ((a | p) - (b ^ a));
+  b = ((a + 73) + (c * 73)) + ((q + a) + (a + a));
+  if(d < b){
+    a = ((b * d) - (p - c)) | ((b + q) & (p + d));
+  }else{
+    d = ((c ^ c) & (q & c)) + ((b - p) & (p * d));
+  }
+  d = ((p & b) - (b - 96)) * ((b + b) ^ (q + 41));
+  b = ((b * b) | (d * c)) & ((d | d) | (d & d));
+  b = ((a * 98) * (q | q)) ^ ((d | a) | (p * c));
+  a = ((q * c) ^ (b * q)) & ((q - c) & (c - p));
+  if(c < 57){
+    b = ((p & b) ^ (a * c)) * ((d | 93) & (d | d));
+  }else{
+    c = ((b & 80) ^ (q | a)) & ((d - p) & (p - a));
+  }
+  d = ((b - q) + (b ^ 1)) + ((p & 26) ^ (q + b));
+  for(i = 0; i < 32; i++){
+    d = ((c + b) ^ (a | a)) & ((b - d) ^ (a + 46));
+  }
+  a = ((b + c) ^ (b - a)) * ((d + b) * (d & 52));
+  c = ((a * d) - (d - q)) & ((c & 41) + (b - b));
+  if(c < c){
+    b = ((q | 64) - (b ^ p)) - ((c + a) + (c ^ 31));
+  }else{
+    d = ((b + a) + (c * 38)) + ((p & 65) ^ (p - 15));
+  }
+  b = ((q & p) - (d | d)) * ((p - 51) - (q & d));
+  c = ((q ^ p) * (p & d)) + ((c ^ p) + (q | b));
+  c = ((a * a) + (c - 82)) - ((q + a) + (b + c));
+  for(i = 0; i < 29; i++){
+    a = ((b & 17) ^ (a & d)) + ((p | 62) ^ (p ^ b));
+  }
+  if(d < d){
+    d = ((a | c) - (c + c)) + ((q - p) | (d * 15));
+  }else{
+    b = ((d * p) + (a | d)) & ((c | d) + (b * c));
+  }
+  return a + b + c + d;
+}
+
+int func153(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 98;
+  d = 61;
+  b = ((d | a) ^ (c | c)) + ((b + d) | (a | d));
+  a = ((a & d) + (p - d)) ^ ((p + a) * (c & p));
+  a = ((p * 88) * (a * 26)) | ((c | q) + (q + q));
+  b = ((b * c) + (c & a)) | ((a + d) | (b - a));
+  if(a < q){
+    a = ((a * 75) ^ (b & 25)) * ((a & c) | (q & b));
+  }else{
+    d = ((p ^ a) * (a & q)) ^ ((q | 29) * (a * p));
+  }
+  a = ((a * 45) * (c | p)) * ((d + q) - (a & d));
+  for(i = 0; i < 5; i++){
+    d = ((q ^ b) ^ (a - p)) | ((a & a) | (c & d));
+  }
+  d = ((c - 7) & (c + d)) - ((d & 73) ^ (b - q));
+  d = ((c | c) - (a | d)) | ((c * c) ^ (q - p));
+  if(c < 6){
+    c = ((c | b) & (a | q)) - ((d | p) ^ (p + a));
+  }else{
+    b = ((p + p) & (d ^ d)) * ((c + b) + (p & q));
+  }
+  c = ((d ^ 1) * (c * a)) | ((q * p) * (b * c));
+  b = ((q - d) | (b + b)) + ((a | b) | (a - p));
+  b = ((a - d) ^ (a ^ 68)) & ((q * 94) * (a | a));
+  for(i = 0; i < 26; i++){
+    c = ((c | q) ^ (c * 27)) ^ ((c + q) + (a - d));
+  }
+  if(c < q){
+    a = ((a - a) | (p * b)) ^ ((b - p) ^ (a + p));
+  }else{
+    c = ((c | a) - (q - b)) ^ ((b | b) * (b * p));
+  }
+  b = ((d * c) | (a | b)) * ((a - 19) | (c & q));
+  d = ((b + 28) & (q & 72)) ^ ((p ^ c) - (d | c));
+  b = ((c ^ d) | (c ^ b)) - ((p * a) * (d ^ c));
+  d = ((a - b) | (b ^ c)) + ((a & 43) - (c | 38));
+  if(c < 9){
+    a = ((d ^ q) * (d & p)) | ((d - 57) | (a - d));
+  }else{
+    c = ((q ^ p) - (b & 3)) + ((a - q) * (d - p));
+  }
+  for(i = 0; i < 37; i++){
+    c = ((c - b) | (q - q)) - ((q | p) | (b | c));
+  }
+  d = ((a * 9) * (b ^ a)) + ((q - d) + (q * 92));
+  b = ((p | 48) ^ (q | c)) + ((q + b) & (q * q));
+  d = ((a | c) - (c + p)) | ((b & 36) + (b * q));
+  if(d < 84){
+    a = ((q | d) | (a + d)) & ((a + b) + (b & p));
+  }else{
+    a = ((d | 2) * (q ^ d)) & ((d & b) * (d * d));
+  }
+  b = ((b * p) * (d & 67)) & ((d ^ p) * (d ^ 90));
+  a = ((b ^ 91) * (q * p)) | ((b ^ b) & (b - 58));
+  for(i = 0; i < 16; i++){
+    b = ((p | q) * (d & b)) * ((a + b) + (d - p));
+  }
+  a = ((q - d) * (d & 46)) | ((b - d) - (d ^ c));
+  if(c < c){
+    b = ((a ^ c) & (d & 29)) | ((b + q) ^ (b | a));
+  }else{
+    c = ((c & b) | (c | 20)) ^ ((b * c) | (d & q));
+  }
+  d = ((b ^ a) * (b ^ q)) | ((a ^ d) - (q ^ b));
+  c = ((a + a) + (b - 68)) * ((d ^ a) + (c - a));
+  d = ((b & 97) - (d | 33)) & ((b - b) * (q | 14));
+  a = ((c ^ c) - (b | b)) ^ ((d ^ b) | (c * d));
+  if(b < c){
+    c = ((a * d) ^ (d ^ 77)) ^ ((d + 52) | (p & a));
+  }else{
+    b = ((a & d) & (a | d)) | ((d - c) - (d ^ 64));
+  }
+  b = ((d & d) ^ (p ^ c)) * ((b - d) * (q & d));
+  c = ((c ^ d) - (d - b)) + ((p * p) ^ (d | a));
+  a = ((d | a) | (p + p)) ^ ((d * b) - (b * c));
+  d = ((c + d) - (b | b)) ^ ((q & b) * (d ^ d));
+  if(b < p){
+    d = ((c ^ p) + (p + q)) * ((d | 60) + (c * d));
+  }else{
+    d = ((a + d) & (b & c)) | ((b ^ 93) - (a & c));
+  }
+  b = ((d ^ 49) * (a + 30)) + ((d | p) - (c + p));
+  for(i = 0; i < 44; i++){
+    c = ((a + 39) | (q * a)) | ((d * 64) & (c & c));
+  }
+  a = ((q | 61) | (c & q)) ^ ((p | q) & (b ^ a));
+  a = ((d & d) * (q - 29)) | ((a + b) * (b * c));
+  if(d < a){
+    a = ((d & q) + (p | d)) * ((c + 33) * (d | c));
+  }else{
+    c = ((a ^ p) ^ (p & a)) - ((p + p) ^ (c * c));
+  }
+  d = ((d ^ b) * (d & d)) * ((c ^ b) | (d - p));
+  d = ((q & d) + (c + b)) * ((d + a) & (p & c));
+  b = ((c | c) ^ (p * q)) * ((b & q) + (a - 90));
+  for(i = 0; i < 9; i++){
+    a = ((c ^ a) + (b | a)) - ((p * 92) + (c | d));
+  }
+  if(d < a){
+    a = ((q ^ 27) | (d + d)) + ((q + d) ^ (q + 29));
+  }else{
+    c = ((c ^ b) * (a & q)) ^ ((c + c) | (d ^ 34));
+  }
+  return a + b + c + d;
+}
+
+int func154(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 44;
+  d = 67;
+  d = ((a - a) ^ (b ^ d)) & ((c | 64) ^ (p ^ c));
+  b = ((b & b) * (p + q)) | ((c ^ c) | (p & p));
+  d = ((b + c) + (c & d)) - ((p - a) - (d | q));
+  c = ((b - c) & (c - d)) - ((q - q) & (b - c));
+  if(a < q){
+    a = ((d * 58) - (p * b)) | ((c ^ d) + (b * p));
+  }else{
+    c = ((c & a) & (d + 99)) * ((p | q) * (d | p));
+  }
+  c = ((c | a) + (c - 78)) | ((b + q) * (c & p));
+  for(i = 0; i < 33; i++){
+    a = ((c ^ 97) * (b - 8)) + ((p - 53) | (p | a));
+  }
+  a = ((b ^ 10) ^ (a - 47)) ^ ((d - 50) ^ (d ^ c));
+  a = ((q & q) - (c | p)) & ((a - b) & (c ^ a));
+  if(b < c){
+    d = ((c + c) ^ (q ^ q)) - ((d * d) + (p * d));
+  }else{
+    b = ((p + p) * (q * a)) | ((q - p) + (p * 22));
+  }
+  d = ((p * 5) - (d & a)) * ((p | 88) & (q - c));
+  b = ((p ^ 46) * (d * d)) ^ ((q + p) * (a * c));
+  b = ((b ^ p) - (d + d)) + ((c & 78) & (c & 60));
+  for(i = 0; i < 45; i++){
+    d = ((d & 58) * (c & d)) ^ ((p + q) * (b * a));
+  }
+  if(a < p){
+    d = ((a ^ d) | (q | c)) + ((p & c) & (d | d));
+  }else{
+    b = ((a ^ 64) & (d + a)) * ((c * p) - (a & 57));
+  }
+  a = ((q | 31) ^ (p * 95)) & ((a * q) * (b - 31));
+  a = ((q | 97) - (d - 42)) - ((a * 88) * (q * q));
+  a = ((d * c) | (p | c)) - ((c ^ b) - (q ^ b));
+  d = ((p * q) | (d * d)) ^ ((a - q) + (d - q));
+  if(c < q){
+    d = ((p | p) - (p & a)) | ((a ^ 2) | (c - 33));
+  }else{
+    c = ((d & 6) | (p * b)) | ((b ^ p) & (p | b));
+  }
+  for(i = 0; i < 31; i++){
+    d = ((c ^ c) - (p * 25)) & ((q & a) + (p | 86));
+  }
+  b = ((c + 35) - (p | b)) - ((d + c) | (d * b));
+  a = ((b * c) | (c * b)) * ((p & c) + (c | 87));
+  d = ((p ^ q) * (p * 60)) | ((p * b) | (q * c));
+  if(b < 17){
+    d = ((q + 29) & (p * p)) * ((p - p) - (p - q));
+  }else{
+    c = ((c * b) + (p * q)) + ((q | a) * (p | 79));
+  }
+  c = ((d * 88) ^ (a + p)) + ((p | q) & (b + c));
+  d = ((p ^ q) + (q | b)) - ((c & c) - (b | a));
+  for(i = 0; i < 12; i++){
+    d = ((d + 90) & (q ^ d)) | ((c - 76) - (a * q));
+  }
+  d = ((d - c) ^ (q * c)) - ((p & 10) | (c * q));
+  if(c < q){
+    a = ((p | p) + (c ^ 26)) * ((c & a) ^ (c ^ p));
+  }else{
+    c = ((d + d) + (d * 10)) * ((c * 24) - (c & q));
+  }
+  a = ((b + a) + (d - 26)) | ((q - c) * (a & c));
+  a = ((d ^ 28) ^ (q - 47)) & ((q | 38) * (q - d));
+  a = ((a & c) * (c | 50)) ^ ((q - p) - (b * q));
+  a = ((a + a) - (d + a)) + ((q & q) * (d ^ 91));
+  if(c < a){
+    b = ((b & d) - (b ^ b)) | ((c * c) & (p + a));
+  }else{
+    c = ((d * q) ^ (q | 26)) ^ ((d & 67) ^ (b - b));
+  }
+  a = ((a | 18) | (a & c)) & ((p + d) + (a & 69));
+  b = ((d + c) + (p & d)) - ((d | d) * (p ^ a));
+  a = ((a & p) * (c - a)) ^ ((c ^ d) ^ (c | p));
+  a = ((q - 8) - (a | b)) ^ ((q | c) - (d ^ a));
+  if(b < c){
+    c = ((c * c) ^ (q & 41)) | ((a ^ q) & (p * 68));
+  }else{
+    c = ((q ^ 77) - (a ^ q)) & ((b * 57) | (q ^ 23));
+  }
+  b = ((a & b) | (d & c)) & ((p + a) & (q - b));
+  for(i = 0; i < 30; i++){
+    b = ((d | c) + (c * c)) & ((a | q) - (c | c));
+  }
+  c = ((q * d) - (q * q)) - ((a + a) + (d - d));
+  c = ((p - q) ^ (b ^ 58)) - ((d + d) | (c * p));
+  if(a < b){
+    b = ((c - d) ^ (a - a)) * ((a & d) + (c | 63));
+  }else{
+    d = ((d ^ 39) & (a - 19)) ^ ((q + p) | (q | a));
+  }
+  b = ((d + 63) + (q + p)) & ((p - 5) - (p * d));
+  c = ((q | 92) | (b | 38)) | ((b + 87) | (a - b));
+  b = ((c - q) & (c + c)) - ((a & p) ^ (d ^ d));
+  for(i = 0; i < 41; i++){
+    d = ((p * 91) - (c | b)) ^ ((p ^ d) | (d ^ d));
+  }
+  if(a < b){
+    b = ((d - 68) * (p | b)) - ((p - 23) - (q & d));
+  }else{
+    d = ((p * c) | (a - 75)) - ((q - d) + (c ^ 94));
+  }
+  return a + b + c + d;
+}
+
+int func155(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 26;
+  d = 69;
+  b = ((d - a) | (b & 16)) ^ ((b - 28) - (b + a));
+  d = ((b | 14) - (a & 94)) + ((c - q) * (q | a));
+  a = ((q + 77) ^ (c | c)) ^ ((d + b) & (c - 27));
+  d = ((d + b) + (a & c)) | ((d * c) | (q & 48));
+  if(d < d){
+    b = ((c ^ 53) ^ (c ^ q)) & ((p & b) - (b - 12));
+  }else{
+    d = ((a - 87) ^ (a ^ c)) * ((d & b) * (c * a));
+  }
+  a = ((a + p) ^ (a * q)) + ((c & 99) + (b | d));
+  for(i = 0; i < 15; i++){
+    d = ((a + c) | (a + 11)) - ((c | q) ^ (q & d));
+  }
+  b = ((c ^ q) & (c * c)) - ((a - c) ^ (d | c));
+  b = ((a * 15) ^ (p * q)) | ((b * q) & (a + c));
+  if(c < 45){
+    d = ((c ^ a) * (q | a)) + ((a + a) * (d ^ a));
+  }else{
+    b = ((q | c) & (d * b)) * ((q & q) ^ (c & p));
+  }
+  d = ((q * d) | (a + 84)) & ((d ^ c) * (d * 41));
+  d = ((d | d) + (p + b)) | ((c * c) & (c | a));
+  d = ((c + b) ^ (p * 74)) * ((a + d) + (c - p));
+  for(i = 0; i < 4; i++){
+    b = ((d & c) - (p ^ b)) | ((c - p) & (b ^ a));
+  }
+  if(a < b){
+    d = ((p + q) ^ (c & 51)) - ((q + p) * (a & b));
+  }else{
+    b = ((p + 71) ^ (c & q)) + ((b + q) + (b * d));
+  }
+  c = ((d | 10) * (p - c)) ^ ((p * d) ^ (a + 79));
+  c = ((a ^ c) + (b ^ q)) & ((b & a) ^ (d - c));
+  a = ((d | p) | (a + 8)) + ((d | q) * (d & a));
+  c = ((p ^ c) | (p + d)) | ((a - c) | (p & b));
+  if(c < d){
+    a = ((a & 73) + (b + 23)) & ((c ^ 19) | (b * 29));
+  }else{
+    b = ((d - a) | (q - a)) * ((p ^ p) * (p | b));
+  }
+  for(i = 0; i < 24; i++){
+    c = ((a ^ 28) + (p & 46)) ^ ((d * p) ^ (d - a));
+  }
+  c = ((q + d) | (a + 58)) + ((a + 68) - (c & c));
+  c = ((p - 53) ^ (b + c)) ^ ((a + 62) + (b * d));
+  b = ((q * 48) + (c ^ q)) | ((q & 83) * (p * c));
+  if(c < c){
+    b = ((b | 92) ^ (b - d)) ^ ((p + p) & (d & 35));
+  }else{
+    c = ((b * d) & (d ^ q)) | ((p ^ p) - (c - q));
+  }
+  d = ((b - a) ^ (d * c)) | ((q & p) * (d + a));
+  c = ((b + d) | (q * 58)) + ((c & a) & (b * 94));
+  for(i = 0; i < 15; i++){
+    b = ((d & b) | (b & 74)) * ((b | a) ^ (b * p));
+  }
+  b = ((a - 35) ^ (a & 49)) | ((p - p) - (b & 55));
+  if(b < q){
+    a = ((b * p) * (a & q)) | ((d - d) * (c - p));
+  }else{
+    c = ((a - 31) & (p * 25)) | ((c + d) - (b * 36));
+  }
+  d = ((b ^ 30) | (d ^ c)) + ((p | 44) | (d ^ q));
+  d = ((b + p) - (d | p)) & ((p - 56) * (a & 1));
+  a = ((q * c) | (q ^ q)) ^ ((d ^ 16) | (c + p));
+  a = ((a & p) | (a ^ 78)) * ((q * p) ^ (b - d));
+  if(b < q){
+    a = ((d + 10) * (c + p)) - ((q ^ p) | (b - a));
+  }else{
+    c = ((q ^ d) | (d * c)) * ((d ^ p) - (q * p));
+  }
+  c = ((a * p) + (p - 94)) ^ ((q + 6) * (d ^ c));
+  d = ((d | p) ^ (b | 6)) - ((p * q) + (c * d));
+  b = ((a + 43) | (a + 14)) ^ ((b | 84) - (a ^ 80));
+  a = ((p - a) - (b | b)) - ((a & p) | (d - b));
+  if(b < a){
+    c = ((b * d) | (b | p)) ^ ((q * 74) * (c | p));
+  }else{
+    d = ((p - 39) - (a ^ c)) + ((c & 41) - (p * p));
+  }
+  c = ((p * d) - (c ^ 37)) + ((c + d) & (b - 55));
+  for(i = 0; i < 30; i++){
+    b = ((a * c) + (d * c)) | ((c | c) * (c & 8));
+  }
+  b = ((c + c) & (q | q)) ^ ((b * d) - (q ^ b));
+  b = ((a & 92) | (d ^ d)) ^ ((a - b) & (c + 68));
+  if(b < p){
+    c = ((a | q) & (p * d)) ^ ((d * 42) & (d & a));
+  }else{
+    c = ((p | a) - (p * d)) & ((q - d) & (d & b));
+  }
+  b = ((q & d) | (b | b)) ^ ((a & q) - (q ^ d));
+  d = ((b * 38) * (q ^ 68)) * ((c | q) * (b | p));
+  b = ((p - 79) - (p * q)) & ((d + a) & (p ^ b));
+  for(i = 0; i < 7; i++){
+    c = ((c * c) & (q + c)) | ((c * d) + (d ^ 21));
+  }
+  if(a < 36){
+    d = ((q + a) - (q * q)) | ((p & c) - (b + q));
+  }else{
+    d = ((d ^ c) - (c + d)) ^ ((a * 9) - (q & 57));
+  }
+  return a + b + c + d;
+}
+
+int func156(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 7;
+  d = 24;
+  b = ((a | p) + (p ^ p)) | ((a * p) | (d & c));
+  a = ((q + c) * (b - a)) + ((p * 23) | (a | p));
+  b = ((p & 82) - (q * 15)) ^ ((b * p) * (p & c));
+  c = ((c & c) + (b | q)) - ((q - q) | (p * 76));
+  if(a < p){
+    a = ((p + b) ^ (a | b)) + ((d - p) - (p ^ b));
+  }else{
+    a = ((q * b) * (p + b)) + ((d - c) & (a ^ a));
+  }
+  c = ((d - b) * (q & 18)) * ((q - c) ^ (p | 86));
+  for(i = 0; i < 39; i++){
+    b = ((b & a) * (c - a)) | ((a | c) * (c & q));
+  }
+  b = ((d - p) & (b ^ c)) ^ ((c | 89) | (p - p));
+  a = ((c & b) - (p - 88)) - ((a - d) ^ (p | b));
+  if(b < 19){
+    a = ((a - b) - (a & a)) * ((d | 49) ^ (q + a));
+  }else{
+    c = ((d | b) + (a | a)) - ((c | 60) ^ (d * 48));
+  }
+  c = ((p ^ 39) - (b | 17)) + ((d - q) ^ (c & c));
+  a = ((d - d) * (p & a)) ^ ((p | b) + (a | q));
+  a = ((p * c) * (b & b)) & ((a ^ a) + (c - q));
+  for(i = 0; i < 44; i++){
+    a = ((d + a) - (q - a)) & ((d & c) | (p & d));
+  }
+  if(b < d){
+    c = ((q & d) - (p * c)) + ((p | p) - (a & 35));
+  }else{
+    d = ((q + d) + (a - c)) - ((q ^ q) & (d & a));
+  }
+  c = ((c - a) + (c * d)) & ((d | 52) | (c & 35));
+  a = ((b & b) | (d * b)) * ((b ^ c) - (c | d));
+  a = ((b & b) - (q | 42)) ^ ((b | 52) * (q * d));
+  c = ((p & c) + (q & d)) * ((q * p) * (q + c));
+  if(b < 22){
+    b = ((p - d) & (d ^ 33)) & ((a ^ 14) + (d - 6));
+  }else{
+    b = ((d & b) + (d | a)) & ((d | 81) * (b & a));
+  }
+  for(i = 0; i < 36; i++){
+    b = ((d ^ a) * (b | c)) * ((a * b) - (a | q));
+  }
+  c = ((d | c) - (d | 29)) | ((q - b) - (b & a));
+  b = ((c - p) - (p + a)) ^ ((a ^ p) - (c | 91));
+  c = ((c - q) ^ (c - 15)) ^ ((q - a) & (q & q));
+  if(d < b){
+    a = ((b + 94) + (a | q)) - ((b & q) ^ (b * 79));
+  }else{
+    d = ((p - d) + (q & 57)) - ((p | c) ^ (a | q));
+  }
+  d = ((q * d) & (b ^ 84)) ^ ((p ^ c) * (b | b));
+  c = ((p ^ q) + (a - 85)) * ((d - b) & (p ^ q));
+  for(i = 0; i < 11; i++){
+    a = ((a | p) | (a - p)) & ((d + q) + (p - b));
+  }
+  c = ((b + a) & (p + 13)) * ((d * c) * (q - d));
+  if(a < c){
+    d = ((c + p) | (a ^ d)) + ((p ^ c) + (b | d));
+  }else{
+    d = ((a & c) + (c * q)) * ((q ^ 59) - (p ^ 75));
+  }
+  d = ((a * 36) ^ (q ^ 71)) + ((p ^ d) ^ (q | d));
+  b = ((q | 35) & (q ^ 63)) & ((d | c) ^ (d & q));
+  c = ((a + b) & (b * a)) | ((d - d) & (b & q));
+  d = ((c * 49) | (d - b)) & ((c + 77) | (b - p));
+  if(b < 45){
+    a = ((c ^ q) * (c ^ d)) - ((b - c) & (c ^ q));
+  }else{
+    c = ((d | c) - (a & a)) & ((p & c) | (d * c));
+  }
+  d = ((q | a) - (b + 19)) + ((a ^ p) + (p * 87));
+  a = ((p | p) * (q * 55)) * ((b + p) + (c - d));
+  c = ((p - c) | (a & 5)) - ((c - 49) + (a | p));
+  c = ((p - q) * (p - 78)) & ((b ^ 14) * (b - 67));
+  if(b < d){
+    d = ((a | p) - (c ^ 99)) + ((a ^ p) | (c & q));
+  }else{
+    c = ((a - q) ^ (p - b)) ^ ((d * p) | (b + c));
+  }
+  c = ((d | 8) & (p - b)) | ((q * b) * (q ^ d));
+  for(i = 0; i < 18; i++){
+    d = ((a - a) & (b ^ 37)) | ((b ^ q) - (q & p));
+  }
+  a = ((p * d) - (c & 22)) & ((p ^ c) + (d | d));
+  a = ((a & a) ^ (p * p)) + ((q ^ d) * (q ^ 6));
+  if(d < a){
+    c = ((d ^ c) & (c * 6)) | ((q + c) + (a ^ d));
+  }else{
+    a = ((c - 74) ^ (b & d)) | ((b ^ q) * (q ^ p));
+  }
+  d = ((a * 96) + (b ^ q)) | ((c - 3) & (c & d));
+  b = ((d ^ a) ^ (c * 77)) * ((q ^ d) ^ (q + 83));
+  a = ((c | c) | (p - b)) & ((b ^ p) * (p + b));
+  for(i = 0; i < 36; i++){
+    d = ((p | a) ^ (b - 78)) ^ ((a & 5) - (d + d));
+  }
+  if(d < 76){
+    d = ((a & c) | (q - 27)) & ((c + c) | (c ^ c));
+  }else{
+    b = ((q & 82) - (a & c)) * ((p - p) ^ (c - b));
+  }
+  return a + b + c + d;
+}
+
+int func157(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 55;
+  d = 64;
+  d = ((b - p) ^ (q - 79)) ^ ((q & d) + (d | a));
+  a = ((c * a) * (p ^ 76)) - ((d & c) + (b ^ b));
+  c = ((d ^ q) | (a - b)) - ((d * d) - (b + q));
+  b = ((a | 4) ^ (q + c)) | ((d ^ 3) ^ (q * b));
+  if(a < 93){
+    a = ((a * p) + (c | q)) * ((q - d) | (c * 31));
+  }else{
+    d = ((a | b) | (d * p)) * ((q & 19) & (p & b));
+  }
+  b = ((q & q) | (b - d)) * ((q & 68) + (q | d));
+  for(i = 0; i < 4; i++){
+    b = ((a ^ 51) + (d - b)) | ((c - 77) ^ (q * p));
+  }
+  c = ((a & c) - (c | 27)) | ((p & q) * (p ^ b));
+  d = ((c | q) * (c | d)) + ((b & d) * (c * a));
+  if(d < b){
+    a = ((q + 90) + (p ^ a)) + ((b - 74) | (c + d));
+  }else{
+    c = ((b ^ d) & (c * q)) & ((b + 36) + (p * d));
+  }
+  b = ((q & d) & (a ^ 44)) ^ ((q & b) ^ (p & a));
+  a = ((q & q) & (b | 47)) * ((c + a) - (c & c));
+  a = ((c * c) ^ (a ^ 15)) ^ ((a | c) & (c & 87));
+  for(i = 0; i < 8; i++){
+    a = ((d | 66) - (d * d)) | ((c * q) - (p | c));
+  }
+  if(d < b){
+    b = ((q + p) - (d + 42)) & ((a - p) & (b * 39));
+  }else{
+    c = ((q - d) | (p & c)) | ((d * c) & (c * c));
+  }
+  b = ((a - a) - (c + p)) * ((b & d) & (q + p));
+  a = ((b ^ p) + (a + 92)) & ((c - 43) + (q ^ q));
+  b = ((q + b) * (q - q)) & ((b ^ a) - (q | b));
+  c = ((q & a) & (b + d)) - ((a + 80) & (a | d));
+  if(b < q){
+    a = ((c & q) | (a - a)) - ((q & a) - (q * 27));
+  }else{
+    a = ((p ^ a) * (q * c)) * ((c | q) - (q & 49));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((d * 49) & (c + a)) * ((c - c) + (d ^ d));
+  }
+  d = ((a & p) * (q ^ b)) * ((b * 57) - (b ^ q));
+  d = ((b & 93) + (d - p)) & ((a + q) + (d - 50));
+  a = ((d - p) - (a & c)) & ((q * 6) - (b | p));
+  if(a < c){
+    c = ((p - c) - (a & 26)) - ((b * a) + (a & d));
+  }else{
+    b = ((p | a) ^ (a ^ b)) | ((q * d) - (p - q));
+  }
+  a = ((a + p) ^ (p * c)) & ((d & b) * (d | 3));
+  b = ((d | p) & (p + 96)) * ((d - 83) + (b + d));
+  for(i = 0; i < 5; i++){
+    b = ((b & 68) & (p & 91)) * ((a & a) ^ (b ^ b));
+  }
+  c = ((c - 41) - (p + q)) - ((p + c) & (b | q));
+  if(a < q){
+    a = ((a - c) ^ (c ^ c)) & ((d + c) * (d + p));
+  }else{
+    c = ((c + p) - (p ^ a)) ^ ((b - d) - (p - a));
+  }
+  c = ((b ^ a) ^ (p ^ a)) ^ ((a | a) - (q + c));
+  d = ((a | c) ^ (c & p)) + ((c | d) ^ (a + 18));
+  d = ((d | 72) & (c * d)) | ((c * p) | (a + c));
+  b = ((c | 79) * (c + a)) ^ ((p * a) * (p & c));
+  if(d < b){
+    c = ((p & b) - (d + d)) - ((q ^ a) - (p - 46));
+  }else{
+    c = ((d | a) * (d * b)) | ((c & a) | (q ^ c));
+  }
+  a = ((q - b) - (c ^ c)) & ((a - c) + (q ^ c));
+  a = ((c - p) & (c & c)) * ((p ^ p) * (p & 52));
+  a = ((p | a) & (d | 77)) - ((b & d) & (a - c));
+  b = ((q + b) ^ (p & d)) | ((d - b) - (b * d));
+  if(b < 32){
+    a = ((a | p) | (a | q)) & ((q + b) * (c & a));
+  }else{
+    a = ((p & a) & (p & a)) * ((p | 81) - (a & 94));
+  }
+  b = ((c + a) - (a - 6)) | ((p & a) ^ (b - q));
+  for(i = 0; i < 19; i++){
+    d = ((d + 70) | (p - 12)) - ((a ^ b) | (a ^ q));
+  }
+  b = ((b + c) * (a ^ 33)) * ((c + 81) + (c & b));
+  c = ((q | p) & (q ^ p)) ^ ((q + a) | (c * 71));
+  if(a < q){
+    a = ((c + b) | (d & d)) & ((c - b) & (q ^ b));
+  }else{
+    a = ((a * q) + (d + c)) + ((b & a) | (q ^ 52));
+  }
+  d = ((b & q) - (p - a)) ^ ((p * b) & (q & 19));
+  d = ((a * d) * (b | c)) | ((p & a) + (q & b));
+  a = ((c ^ b) + (a | d)) + ((b + 35) * (a * a));
+  for(i = 0; i < 7; i++){
+    a = ((b & c) - (c ^ d)) * ((b - 38) & (a & p));
+  }
+  if(b < d){
+    d = ((q | 31) & (p ^ d)) + ((b + 18) ^ (b - 26));
+  }else{
+    d = ((q | p) - (p - p)) - ((p - c) - (c | q));
+  }
+  return a + b + c + d;
+}
+
+int func158(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 45;
+  d = 91;
+  c = ((c ^ d) - (p | p)) ^ ((q - q) ^ (a | 60));
+  b = ((p - a) * (a + 3)) | ((p ^ a) + (c - 80));
+  d = ((c ^ q) - (q ^ p)) | ((d - q) ^ (a + 29));
+  d = ((b + d) ^ (p | d)) - ((q | q) * (d + c));
+  if(c < p){
+    a = ((c ^ d) - (c & b)) & ((a | a) + (b + 53));
+  }else{
+    c = ((q ^ 77) | (q & b)) | ((b ^ 7) | (q * 29));
+  }
+  d = ((a + p) | (p * p)) - ((q + p) + (q - 18));
+  for(i = 0; i < 42; i++){
+    c = ((c & p) * (d - c)) * ((q + b) ^ (p | p));
+  }
+  a = ((a - c) - (d * p)) | ((c | b) | (b - d));
+  d = ((p - d) * (c * p)) | ((c | b) - (b & 38));
+  if(b < d){
+    b = ((b + p) ^ (q - d)) + ((a & 54) ^ (d + d));
+  }else{
+    c = ((c & d) * (p & 37)) | ((q | c) - (q - q));
+  }
+  a = ((c | p) ^ (d * p)) & ((c + a) + (p ^ d));
+  d = ((d - a) * (b + 80)) - ((c | 3) + (p | b));
+  a = ((c + 42) + (p * q)) * ((b & d) * (c + 8));
+  for(i = 0; i < 48; i++){
+    a = ((a | c) ^ (c & c)) ^ ((b * c) - (b * p));
+  }
+  if(c < c){
+    c = ((d | c) | (b & c)) ^ ((a | p) | (c + p));
+  }else{
+    d = ((d * q) | (p | p)) | ((q - a) ^ (p ^ 66));
+  }
+  b = ((c - c) ^ (b ^ 78)) + ((a * c) + (a & p));
+  b = ((c ^ p) & (c + 74)) & ((q * p) & (b * c));
+  d = ((a + c) ^ (b | b)) | ((q & 21) & (p + a));
+  d = ((b + p) ^ (d | 60)) - ((c | a) * (c * 63));
+  if(d < p){
+    c = ((q & p) * (d & 55)) + ((d | 48) + (b - 31));
+  }else{
+    d = ((a | p) ^ (c * a)) + ((p * a) & (a ^ p));
+  }
+  for(i = 0; i < 44; i++){
+    a = ((p & 63) * (q + 79)) - ((q - p) & (b ^ q));
+  }
+  a = ((p * a) ^ (c * d)) ^ ((b * 69) - (a | p));
+  c = ((b + q) - (q - b)) * ((q & 91) * (b + d));
+  d = ((b | b) | (p * 61)) | ((d | 75) * (a ^ q));
+  if(b < d){
+    c = ((p - d) & (c + a)) ^ ((a & 80) ^ (q + p));
+  }else{
+    d = ((q - p) * (q ^ d)) + ((a + c) - (c * d));
+  }
+  d = ((p | c) - (b | p)) - ((c * b) & (a * d));
+  d = ((a ^ a) & (q * 23)) & ((q & 83) + (b * b));
+  for(i = 0; i < 42; i++){
+    c = ((a ^ d) * (q & q)) & ((b - 90) + (p * b));
+  }
+  a = ((b & b) | (c + 48)) + ((a & q) | (q * a));
+  if(b < 41){
+    d = ((b - a) & (a ^ 44)) - ((b ^ 55) - (b ^ a));
+  }else{
+    c = ((a | d) + (d + 97)) - ((b + 66) ^ (a + 36));
+  }
+  c = ((c * q) ^ (p - d)) + ((a * 90) | (c ^ a));
+  a = ((q ^ 98) * (a & 12)) - ((d ^ d) + (a - a));
+  d = ((a | q) & (d + q)) + ((b ^ c) * (b * c));
+  c = ((c ^ a) ^ (c ^ d)) & ((d | 49) & (q | 29));
+  if(d < d){
+    c = ((b ^ p) * (c | c)) | ((a & d) * (b - a));
+  }else{
+    a = ((c + c) & (p | d)) ^ ((q - d) - (b - a));
+  }
+  c = ((c - 26) + (p + 85)) - ((a + c) + (b * p));
+  c = ((d - d) + (c & a)) - ((a + a) ^ (c & c));
+  b = ((b | 65) * (d & c)) * ((b ^ d) * (a + p));
+  b = ((d * 53) | (b | a)) - ((b ^ a) + (b & q));
+  if(c < c){
+    a = ((d & d) + (p + q)) & ((c + 6) * (d - 23));
+  }else{
+    d = ((a ^ p) | (a + 10)) ^ ((d ^ b) * (p * d));
+  }
+  a = ((d & p) & (c + 44)) ^ ((c * b) ^ (a + p));
+  for(i = 0; i < 27; i++){
+    d = ((c - p) & (d & 93)) & ((a & q) ^ (d - c));
+  }
+  c = ((q * p) - (p * d)) * ((a * 57) * (q | 78));
+  b = ((a ^ c) - (a & 46)) ^ ((c | 60) + (p & 94));
+  if(c < b){
+    d = ((q | c) - (c & d)) - ((c + 19) - (c ^ b));
+  }else{
+    b = ((q ^ p) * (a * 54)) - ((c ^ p) ^ (d | q));
+  }
+  d = ((q * b) - (c & b)) | ((c * q) | (p + q));
+  b = ((q ^ q) ^ (d * a)) - ((q - p) | (a | b));
+  a = ((c & 87) + (c | a)) ^ ((b & b) ^ (c * q));
+  for(i = 0; i < 13; i++){
+    d = ((d ^ a) & (a + 66)) ^ ((c ^ p) | (a - 80));
+  }
+  if(d < 20){
+    d = ((q + a) ^ (d | q)) ^ ((q | c) - (p ^ 14));
+  }else{
+    b = ((q - p) + (c - 61)) - ((d ^ a) ^ (p & 99));
+  }
+  return a + b + c + d;
+}
+
+int func159(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 14;
+  d = 24;
+  c = ((b + 13) ^ (p - 42)) ^ ((c * b) + (a - 56));
+  a = ((b & 65) & (d ^ b)) + ((p + 26) * (q ^ p));
+  d = ((b & 96) - (b ^ b)) & ((d - a) + (q - b));
+  b = ((q + q) - (b | 65)) & ((a ^ p) ^ (b & 51));
+  if(b < c){
+    b = ((p | a) & (q | p)) - ((q * 3) * (b ^ q));
+  }else{
+    b = ((c & c) ^ (p * b)) & ((c ^ 23) | (p - c));
+  }
+  d = ((p * c) ^ (d * c)) & ((p | b) * (d + 32));
+  for(i = 0; i < 5; i++){
+    d = ((a + b) * (a * d)) | ((c & p) & (q + p));
+  }
+  c = ((c & a) & (q - 3)) + ((a * a) - (a ^ 69));
+  d = ((p ^ a) & (b ^ a)) * ((d + 71) * (a - q));
+  if(d < q){
+    a = ((p * 28) & (p ^ 20)) - ((a ^ 68) + (a | b));
+  }else{
+    b = ((d - a) | (d & d)) ^ ((a + 64) - (c + a));
+  }
+  b = ((p - 20) * (p * a)) | ((q & q) | (c | p));
+  b = ((b | p) & (b | q)) & ((q & d) + (b | 20));
+  a = ((b & q) + (q - 43)) & ((a | b) - (b ^ 53));
+  for(i = 0; i < 11; i++){
+    a = ((c ^ b) - (d + d)) ^ ((b - 87) * (b * q));
+  }
+  if(d < a){
+    d = ((d + 2) ^ (p & b)) ^ ((b ^ 17) & (p | c));
+  }else{
+    a = ((d & b) + (d & b)) * ((q & p) - (b & a));
+  }
+  c = ((a & 66) ^ (p ^ p)) & ((d ^ d) * (d & d));
+  b = ((p * a) | (c ^ c)) ^ ((p & b) + (q & q));
+  a = ((d + 4) ^ (q * p)) & ((p & 19) ^ (c - d));
+  c = ((p ^ q) & (p * b)) - ((b + d) | (d + p));
+  if(a < b){
+    b = ((b | d) * (d | a)) - ((c & 50) & (p - c));
+  }else{
+    b = ((d | a) ^ (a * p)) - ((d * c) - (d + c));
+  }
+  for(i = 0; i < 40; i++){
+    a = ((d ^ a) + (a + p)) & ((p * d) - (c + q));
+  }
+  d = ((c | p) & (d & 4)) ^ ((a - 82) ^ (b + a));
+  a = ((d | p) + (b * q)) * ((b | c) ^ (b & 29));
+  b = ((a + d) ^ (d & 61)) & ((q + q) | (c | d));
+  if(c < q){
+    b = ((q * d) & (d & q)) ^ ((a * 36) + (a & p));
+  }else{
+    b = ((q & d) ^ (q & c)) * ((d ^ q) + (c & 28));
+  }
+  d = ((q - a) & (q & b)) & ((p ^ q) & (p + c));
+  c = ((p & p) - (a + 78)) - ((a ^ c) & (c + a));
+  for(i = 0; i < 49; i++){
+    c = ((q - 88) ^ (p & 96)) & ((p + b) - (c | b));
+  }
+  c = ((q - 89) - (q | d)) - ((p + 81) | (c * d));
+  if(c < 40){
+    c = ((p ^ b) + (c + 44)) * ((a - d) - (q & c));
+  }else{
+    d = ((c | d) & (p & a)) | ((p - c) - (b | d));
+  }
+  c = ((c & 74) + (q ^ q)) - ((p - b) & (c + q));
+  c = ((d & q) - (a | p)) * ((q | 88) & (a + p));
+  c = ((c - a) - (q | d)) | ((p * c) - (q ^ c));
+  b = ((a * c) | (p + p)) ^ ((b + d) + (q | a));
+  if(a < b){
+    d = ((q * q) | (a * c)) * ((d + d) + (d - p));
+  }else{
+    a = ((a - p) - (a - d)) + ((c ^ p) * (p | a));
+  }
+  b = ((q - a) * (c & a)) ^ ((p ^ p) - (q | d));
+  a = ((p | c) + (p - q)) + ((b | c) & (c | d));
+  b = ((d ^ 76) ^ (q + c)) | ((b ^ 34) - (p - a));
+  a = ((q & b) ^ (q & p)) - ((d | q) & (q & q));
+  if(b < c){
+    d = ((a + a) ^ (c & d)) | ((p | d) * (p | q));
+  }else{
+    b = ((c * p) | (d & 43)) & ((q + c) & (c & a));
+  }
+  b = ((d - q) & (c + c)) * ((d ^ c) | (c - b));
+  for(i = 0; i < 25; i++){
+    c = ((p | p) ^ (d & 80)) & ((b ^ p) & (q ^ b));
+  }
+  d = ((d + p) - (d | 71)) * ((b ^ q) - (q + q));
+  d = ((q | d) ^ (d - p)) - ((p - 40) | (q & 98));
+  if(c < a){
+    b = ((d | p) & (p | 91)) & ((a + p) * (a ^ q));
+  }else{
+    b = ((d * d) - (a | a)) + ((c - 79) - (d ^ c));
+  }
+  c = ((p ^ c) | (a + d)) - ((c | p) * (c & d));
+  c = ((q | b) ^ (c * p)) & ((q - b) & (b ^ a));
+  c = ((q * a) + (b ^ 18)) + ((d + q) ^ (d + 26));
+  for(i = 0; i < 11; i++){
+    b = ((a ^ b) - (a * 78)) * ((a | 46) & (d + d));
+  }
+  if(a < q){
+    a = ((d ^ 85) * (p - c)) ^ ((a ^ c) - (q + q));
+  }else{
+    b = ((b * d) + (p | 95)) & ((c - b) & (q * 12));
+  }
+  return a + b + c + d;
+}
+
+int func160(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 16;
+  d = 96;
+  c = ((d | q) | (b ^ d)) | ((p + 78) ^ (q + 65));
+  c = ((c + p) & (q - c)) & ((d * 6) | (q * 81));
+  b = ((q + 93) & (b + d)) | ((d ^ c) * (a * c));
+  c = ((q | d) * (a & a)) * ((c | 75) - (d - c));
+  if(b < 24){
+    c = ((d ^ a) - (b * 94)) + ((c - 22) + (d | 40));
+  }else{
+    a = ((c & c) + (d * q)) - ((b | p) * (b ^ b));
+  }
+  d = ((a + c) + (d | b)) | ((b + p) ^ (d & b));
+  for(i = 0; i < 39; i++){
+    d = ((p | q) + (c + 52)) * ((d * q) ^ (c ^ 85));
+  }
+  d = ((a - c) ^ (d * q)) & ((p | b) * (p + c));
+  d = ((q * 63) + (q & 75)) - ((p ^ d) * (q * q));
+  if(c < 33){
+    b = ((d - d) & (c & p)) * ((c ^ a) & (c & 60));
+  }else{
+    a = ((c - a) - (d ^ b)) | ((p | q) | (q + q));
+  }
+  c = ((p | c) ^ (p | b)) + ((b * 67) * (p * a));
+  b = ((d - 60) ^ (a ^ p)) * ((a ^ 87) & (q - p));
+  d = ((a + c) * (b ^ q)) * ((p ^ a) - (p + c));
+  for(i = 0; i < 47; i++){
+    c = ((q * p) | (b * a)) ^ ((d & b) * (q * p));
+  }
+  if(d < 24){
+    a = ((c | 64) - (c + a)) | ((c * b) & (c ^ d));
+  }else{
+    c = ((d * p) | (b | a)) * ((p * a) | (b | a));
+  }
+  c = ((d * 4) ^ (c ^ 13)) * ((b * p) & (q & b));
+  c = ((c * a) - (a | d)) & ((p | 90) * (c | 75));
+  a = ((p | b) * (d - d)) | ((q * c) - (d & 36));
+  c = ((p * p) - (q * b)) + ((c * 45) - (c + b));
+  if(a < a){
+    b = ((a * b) - (b | c)) & ((a - d) - (d + 30));
+  }else{
+    c = ((d & c) - (a - b)) ^ ((c & 36) & (q ^ b));
+  }
+  for(i = 0; i < 2; i++){
+    c = ((b & p) - (b * p)) * ((a * q) - (c - c));
+  }
+  c = ((d * c) * (q ^ 44)) - ((c ^ q) * (a + a));
+  b = ((d + b) & (b * c)) + ((q - 60) ^ (b * p));
+  a = ((c ^ c) + (p & c)) - ((d * d) + (b + 54));
+  if(a < b){
+    d = ((p * a) | (p & q)) & ((q - c) & (q - b));
+  }else{
+    c = ((p + 69) & (q - p)) - ((d * c) * (d * 89));
+  }
+  d = ((p ^ 70) - (d | a)) ^ ((c + b) - (b | c));
+  b = ((q - b) - (p | p)) * ((q * 43) - (p * d));
+  for(i = 0; i < 2; i++){
+    d = ((b - d) | (p - c)) * ((p - p) - (a + q));
+  }
+  b = ((p * a) ^ (a ^ q)) & ((b ^ 91) * (d * q));
+  if(d < 45){
+    d = ((c & b) ^ (p | c)) * ((a - 75) + (d | a));
+  }else{
+    b = ((b ^ d) + (c ^ b)) * ((a - b) + (q - 53));
+  }
+  b = ((c & b) & (a - c)) ^ ((a * a) * (p ^ b));
+  d = ((b ^ 30) ^ (a * 69)) | ((p + q) & (p - p));
+  d = ((q & b) & (b ^ 17)) & ((a & d) & (d & q));
+  b = ((d - b) ^ (p - a)) | ((p ^ 79) + (q | d));
+  if(a < a){
+    b = ((c * c) ^ (d | a)) * ((d + d) | (a | d));
+  }else{
+    a = ((d * b) | (d | 80)) & ((b ^ c) + (c ^ 47));
+  }
+  c = ((p * q) * (c - d)) - ((c * 43) - (p + 80));
+  d = ((p - p) + (b & 13)) * ((q ^ q) ^ (c * p));
+  a = ((p ^ 88) ^ (a & d)) - ((q | q) | (b - b));
+  b = ((b * b) & (p * q)) ^ ((q * a) - (a - q));
+  if(c < d){
+    d = ((q * 83) | (q + p)) & ((c + b) ^ (a + c));
+  }else{
+    b = ((p + d) + (b * q)) - ((a - d) - (b & 56));
+  }
+  d = ((a + c) + (a ^ 53)) + ((a ^ 66) - (a | 6));
+  for(i = 0; i < 40; i++){
+    d = ((b - c) & (b & p)) - ((a + c) - (b * 84));
+  }
+  c = ((c + c) & (b | d)) & ((c * 51) & (q - c));
+  a = ((a & b) | (a - b)) - ((q & p) * (c ^ 93));
+  if(b < b){
+    d = ((q | q) - (q | p)) + ((c ^ b) - (a | q));
+  }else{
+    a = ((p ^ b) * (d | b)) * ((d ^ a) * (c & d));
+  }
+  a = ((c & 55) | (p & 57)) ^ ((a & p) & (p + 90));
+  c = ((c ^ a) & (q & 69)) * ((p * q) ^ (p | c));
+  c = ((c ^ q) ^ (q & q)) * ((q ^ d) ^ (d | 9));
+  for(i = 0; i < 20; i++){
+    d = ((a ^ q) * (b * b)) | ((d ^ 34) & (c * 65));
+  }
+  if(d < b){
+    c = ((d | 91) ^ (b & b)) | ((b ^ b) + (c | a));
+  }else{
+    b = ((b * d) + (b + p)) + ((q | p) ^ (a ^ d));
+  }
+  return a + b + c + d;
+}
+
+int func161(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 40;
+  d = 17;
+  c = ((q * q) | (p * q)) ^ ((p & a) * (b | b));
+  a = ((b | q) ^ (q ^ 6)) + ((a & d) * (b ^ d));
+  a = ((a + 83) + (p * 19)) + ((q + c) | (a ^ q));
+  b = ((b - d) | (q ^ b)) + ((b - d) | (p - c));
+  if(a < d){
+    c = ((d | p) ^ (a - 56)) - ((p & q) ^ (b - p));
+  }else{
+    a = ((q & 93) + (d - c)) * ((a - c) - (b * a));
+  }
+  c = ((c * 64) | (p ^ d)) ^ ((p * c) | (a - 37));
+  for(i = 0; i < 14; i++){
+    b = ((q | 70) ^ (a ^ b)) ^ ((a - d) - (b + a));
+  }
+  d = ((d * 75) & (d * b)) & ((d | c) - (c - d));
+  c = ((d * 81) ^ (c + p)) - ((q ^ a) ^ (a - p));
+  if(b < 41){
+    d = ((a * p) - (c - 43)) | ((b - b) & (c * a));
+  }else{
+    d = ((a - d) + (q - c)) + ((b - p) - (p * c));
+  }
+  d = ((d * 56) - (a * p)) & ((p + b) + (q | 3));
+  a = ((d + 82) - (q - 12)) | ((q - d) + (p & c));
+  a = ((b ^ d) * (d - a)) - ((c + 28) ^ (c | b));
+  for(i = 0; i < 19; i++){
+    c = ((c & 12) * (c & p)) + ((b + a) ^ (d - a));
+  }
+  if(c < a){
+    d = ((q | b) - (d * c)) * ((a | q) * (a * 41));
+  }else{
+    d = ((q + a) ^ (p & b)) ^ ((p + p) + (q + 14));
+  }
+  c = ((b ^ p) | (d * q)) ^ ((p & q) + (q * b));
+  a = ((a | b) | (p & a)) ^ ((b - 82) + (p - b));
+  a = ((p - d) | (d * 77)) & ((p | d) & (d ^ b));
+  d = ((d ^ q) ^ (d & c)) * ((a | 34) | (b - a));
+  if(a < p){
+    b = ((d ^ b) & (p ^ q)) * ((q - p) | (p | 9));
+  }else{
+    c = ((a ^ 53) ^ (q + a)) * ((q & a) * (p + c));
+  }
+  for(i = 0; i < 9; i++){
+    d = ((a - b) + (q | a)) - ((a - p) - (p - a));
+  }
+  a = ((a & p) - (b ^ b)) - ((a | d) | (b & 51));
+  c = ((a ^ q) + (d | p)) - ((c + c) | (p + q));
+  d = ((c | b) * (b + b)) + ((b ^ 2) * (q * q));
+  if(b < a){
+    a = ((p ^ c) | (p * d)) - ((d * p) ^ (a & b));
+  }else{
+    d = ((q * d) | (q ^ q)) ^ ((q | a) * (p | c));
+  }
+  c = ((q | p) * (b * p)) | ((d - 75) & (q | d));
+  c = ((d + p) & (q | a)) - ((c + p) ^ (d | 22));
+  for(i = 0; i < 5; i++){
+    c = ((c ^ a) * (p | d)) - ((p - b) ^ (d * 16));
+  }
+  d = ((q & d) - (b + c)) - ((b | 86) + (b * c));
+  if(c < c){
+    d = ((c - 7) + (b + a)) ^ ((p - p) ^ (p & 79));
+  }else{
+    a = ((a + d) & (q ^ p)) & ((q * d) * (q + c));
+  }
+  d = ((a + 17) ^ (b | 80)) + ((p * d) * (a - d));
+  a = ((p & 32) * (a | p)) * ((q * b) | (b | p));
+  c = ((b + q) * (a - p)) + ((b & q) + (a * 93));
+  c = ((b - c) ^ (p | 36)) - ((c * a) + (d - p));
+  if(c < a){
+    b = ((d & c) * (d | p)) * ((d & 33) - (b & a));
+  }else{
+    b = ((a + 2) | (d * 21)) | ((b * 53) + (b - d));
+  }
+  d = ((p & q) * (b - 27)) & ((d & c) | (d | 13));
+  b = ((d & c) - (b - p)) * ((c ^ q) * (c & d));
+  d = ((a & d) ^ (d & b)) * ((a | 57) - (d * p));
+  c = ((p - p) ^ (b & 88)) | ((d | a) & (q - 52));
+  if(b < 90){
+    d = ((p * b) - (b & a)) & ((b - 99) | (b * q));
+  }else{
+    c = ((b + 10) + (c * d)) * ((b + c) & (d - p));
+  }
+  b = ((q + c) | (d & q)) * ((b - 47) ^ (p | c));
+  for(i = 0; i < 31; i++){
+    a = ((q | d) & (p - 54)) ^ ((d * 71) * (d | a));
+  }
+  d = ((d & q) ^ (p * q)) - ((d - c) * (c + c));
+  a = ((b & d) - (p | b)) | ((p ^ 54) & (a - 24));
+  if(a < a){
+    d = ((a & 78) ^ (d + c)) | ((p & p) + (p & 2));
+  }else{
+    a = ((b ^ 52) | (b | c)) | ((p & d) * (a - q));
+  }
+  b = ((q - d) ^ (a * d)) + ((q | c) - (b & q));
+  d = ((b - d) + (d * q)) ^ ((c & a) + (q | p));
+  b = ((a + p) & (q - 43)) - ((a + c) + (a ^ p));
+  for(i = 0; i < 39; i++){
+    b = ((b * p) + (a - d)) & ((a * c) ^ (b ^ c));
+  }
+  if(c < a){
+    a = ((p ^ d) - (b ^ c)) | ((a ^ p) * (p ^ d));
+  }else{
+    a = ((c ^ c) ^ (c * q)) + ((p & a) - (d + p));
+  }
+  return a + b + c + d;
+}
+
+int func162(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 48;
+  d = 20;
+  c = ((c + 65) | (c + a)) - ((q + d) ^ (d & c));
+  a = ((b * c) - (b + p)) + ((d - q) | (a * 61));
+  a = ((c + q) * (b & a)) + ((b ^ d) & (a ^ q));
+  d = ((a & 69) * (a & b)) - ((b - 22) * (p & p));
+  if(c < d){
+    b = ((d - a) - (q & q)) & ((p + p) + (q - 73));
+  }else{
+    d = ((a | q) ^ (c * 33)) + ((a ^ b) + (d + p));
+  }
+  b = ((p - q) - (q ^ d)) & ((p * b) - (c * d));
+  for(i = 0; i < 46; i++){
+    d = ((a & 15) & (p * d)) | ((q - 72) ^ (c + b));
+  }
+  a = ((p | a) + (b + 45)) + ((q - b) | (a | b));
+  a = ((p & 77) & (d ^ q)) + ((p & 41) ^ (p - 60));
+  if(c < b){
+    a = ((q & q) - (c & 12)) | ((d ^ 64) * (b | a));
+  }else{
+    d = ((d * c) + (c * q)) - ((c | p) - (q - q));
+  }
+  c = ((q + 37) - (d - b)) | ((a - d) * (p ^ d));
+  b = ((c & 51) + (p & d)) * ((q ^ p) ^ (b | a));
+  b = ((d * p) * (q | 35)) - ((a - 55) | (d | d));
+  for(i = 0; i < 28; i++){
+    d = ((a & p) - (d & q)) - ((d + p) & (q | c));
+  }
+  if(a < a){
+    c = ((a ^ q) | (a | 86)) - ((a + p) + (c * 9));
+  }else{
+    c = ((d ^ q) | (p * q)) * ((p | b) | (d - b));
+  }
+  c = ((d | a) & (c + c)) & ((p & a) & (c | 70));
+  a = ((c + 11) | (c ^ 83)) - ((b - a) | (c ^ 82));
+  a = ((b & d) ^ (b + c)) ^ ((d - a) + (c & c));
+  a = ((b | q) | (b ^ q)) ^ ((p ^ a) - (q - p));
+  if(b < p){
+    c = ((b - a) | (q | d)) & ((d - q) + (q - b));
+  }else{
+    b = ((d | a) * (p | d)) + ((q * d) | (b ^ p));
+  }
+  for(i = 0; i < 4; i++){
+    c = ((p & a) | (q - 19)) + ((c & d) * (p | p));
+  }
+  c = ((p ^ 31) * (b * a)) | ((q ^ p) - (p + c));
+  a = ((a * d) | (p - c)) - ((b * q) * (d - c));
+  d = ((b + 39) + (p + p)) * ((c * p) * (b ^ d));
+  if(a < d){
+    c = ((q + p) + (d | b)) + ((b | b) ^ (q - p));
+  }else{
+    a = ((c - q) + (p | 41)) | ((a + q) | (a ^ c));
+  }
+  d = ((p ^ c) - (a ^ q)) & ((c & c) & (q - q));
+  c = ((a & c) | (a | 29)) ^ ((d & a) ^ (b - p));
+  for(i = 0; i < 9; i++){
+    c = ((p & c) * (q * q)) & ((c * q) & (c ^ c));
+  }
+  a = ((d * p) * (p + q)) ^ ((d * b) ^ (c * p));
+  if(d < p){
+    c = ((b + 34) | (p * 37)) | ((a ^ q) * (c ^ c));
+  }else{
+    b = ((p + p) & (p | b)) | ((b - 92) + (q + 28));
+  }
+  c = ((c + c) - (d + c)) - ((c | c) ^ (a + d));
+  a = ((b ^ b) - (d + q)) + ((q - a) | (c * d));
+  c = ((q + 34) ^ (d | q)) ^ ((q + p) + (c & a));
+  d = ((c - q) * (q - c)) + ((q & p) | (q & p));
+  if(c < q){
+    c = ((b | d) * (p + 27)) * ((a + 13) - (d + d));
+  }else{
+    c = ((p ^ 7) + (p ^ p)) ^ ((b ^ d) | (p - 56));
+  }
+  b = ((d * 60) ^ (q | p)) - ((c | q) ^ (q - c));
+  d = ((b * c) - (p ^ 64)) ^ ((a & q) + (p + q));
+  d = ((b ^ d) & (p - p)) + ((p * a) | (d * a));
+  c = ((c * c) * (a * q)) ^ ((p - b) | (q * 73));
+  if(c < q){
+    b = ((d ^ a) | (c ^ q)) * ((d * 78) + (a & 87));
+  }else{
+    a = ((c & 80) * (b & 99)) - ((q * 8) | (a + p));
+  }
+  d = ((a ^ 89) | (q ^ d)) ^ ((q - d) | (a ^ 14));
+  for(i = 0; i < 23; i++){
+    d = ((d + c) * (b - d)) | ((d | d) * (p + b));
+  }
+  b = ((q * c) ^ (d - c)) + ((b * 81) & (b * a));
+  a = ((c ^ p) - (b ^ d)) * ((q * 27) + (d + 57));
+  if(d < 50){
+    c = ((c ^ p) ^ (b ^ q)) ^ ((a - 74) + (q * d));
+  }else{
+    a = ((d + d) - (q * 63)) + ((p * p) ^ (d | p));
+  }
+  a = ((q & 1) & (b ^ p)) ^ ((p | p) | (d + c));
+  a = ((b & 2) - (a & a)) | ((d ^ q) | (p | a));
+  a = ((d * a) & (b + 72)) * ((b + c) * (c - 46));
+  for(i = 0; i < 9; i++){
+    d = ((c + c) & (b + 12)) * ((c + d) & (b & p));
+  }
+  if(c < a){
+    d = ((q + c) ^ (c + q)) ^ ((p * p) & (q ^ c));
+  }else{
+    d = ((q ^ 46) * (d | 61)) | ((b * d) + (q ^ 19));
+  }
+  return a + b + c + d;
+}
+
+int func163(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 75;
+  d = 18;
+  d = ((b | b) ^ (b - 47)) - ((q ^ b) | (p - 22));
+  d = ((a ^ c) * (p ^ a)) ^ ((d | 78) * (c ^ p));
+  d = ((p & b) + (b | 5)) ^ ((a + 31) & (c & a));
+  b = ((p - b) + (c + p)) + ((d * q) ^ (p - c));
+  if(c < a){
+    c = ((d - c) | (c - a)) ^ ((q * c) + (d - c));
+  }else{
+    c = ((d & b) ^ (b ^ p)) ^ ((d ^ a) ^ (c * c));
+  }
+  c = ((a + c) ^ (a ^ 48)) - ((b & d) & (c - a));
+  for(i = 0; i < 17; i++){
+    a = ((b | c) ^ (a * q)) + ((b & c) * (q + 53));
+  }
+  b = ((c - 44) & (b ^ 56)) | ((a & d) | (a + c));
+  c = ((d | a) | (p ^ a)) & ((q - a) - (b - c));
+  if(a < c){
+    c = ((b * a) | (b ^ c)) * ((b & a) & (q * a));
+  }else{
+    c = ((b & c) - (a - p)) + ((a * d) + (c - b));
+  }
+  b = ((d * d) | (d & q)) * ((p - a) * (b + 82));
+  a = ((q | 13) + (q & 50)) | ((p - p) ^ (b * d));
+  a = ((a & 72) & (b ^ p)) & ((a | 84) ^ (d | q));
+  for(i = 0; i < 13; i++){
+    d = ((b & q) | (d - d)) | ((q - a) ^ (c | 10));
+  }
+  if(b < b){
+    d = ((d ^ 34) * (p + 20)) * ((p ^ a) - (d + d));
+  }else{
+    b = ((b * q) - (a | c)) ^ ((a * p) + (d ^ b));
+  }
+  c = ((p * q) * (d + 58)) ^ ((q ^ p) + (p * c));
+  d = ((p & d) * (b + q)) | ((a | d) | (q ^ b));
+  d = ((q ^ b) & (q | 77)) * ((a | p) * (c & b));
+  d = ((a * c) & (a | 92)) ^ ((p & a) ^ (c | q));
+  if(b < q){
+    b = ((a + d) - (q & 2)) * ((c ^ q) & (c ^ b));
+  }else{
+    b = ((p - p) - (a & p)) + ((b + p) - (c ^ c));
+  }
+  for(i = 0; i < 25; i++){
+    c = ((d * b) ^ (q & b)) | ((d | c) & (c | 63));
+  }
+  c = ((c + d) | (d + a)) * ((d + b) - (b - 39));
+  d = ((p & 9) ^ (p - p)) | ((q * p) + (a & b));
+  c = ((q - 20) & (q - a)) | ((q * d) & (a + q));
+  if(b < 50){
+    a = ((q + c) & (p * 61)) | ((p & 26) | (c * a));
+  }else{
+    b = ((p + p) + (q & d)) & ((q + c) * (b ^ 7));
+  }
+  d = ((a & 46) ^ (c - b)) ^ ((d ^ p) * (p - 51));
+  c = ((b ^ d) * (q ^ b)) + ((b + c) - (c & d));
+  for(i = 0; i < 47; i++){
+    d = ((p & p) + (b & c)) | ((q * c) ^ (b ^ c));
+  }
+  b = ((b ^ d) | (d | 24)) * ((p + c) ^ (d ^ p));
+  if(b < b){
+    d = ((a & a) * (a + b)) - ((q * b) - (a ^ d));
+  }else{
+    d = ((q | p) - (p * p)) - ((c * 76) ^ (b + a));
+  }
+  b = ((p - q) * (p * q)) & ((d + p) | (a - p));
+  d = ((d ^ a) - (d - q)) | ((b | c) - (p | 68));
+  d = ((p * 42) - (q + p)) + ((c & a) & (d | 35));
+  a = ((b & p) & (q + a)) ^ ((d - 61) + (d ^ a));
+  if(b < d){
+    a = ((q + q) * (b + b)) & ((q + p) + (q ^ b));
+  }else{
+    a = ((p ^ q) & (p & d)) + ((b & 1) - (b & 3));
+  }
+  d = ((b - c) | (p - a)) + ((b - 67) + (p | p));
+  c = ((a + 92) * (d + d)) | ((d & 78) ^ (d * p));
+  a = ((a * a) & (q - p)) ^ ((c | p) * (d | c));
+  c = ((b * 70) | (b * q)) | ((d & 41) - (c + q));
+  if(a < 49){
+    a = ((a - a) * (a * 36)) + ((d | q) - (p * a));
+  }else{
+    c = ((c ^ a) & (c - 8)) - ((b & b) ^ (a + 53));
+  }
+  c = ((q ^ p) * (c * p)) - ((d | b) * (q + q));
+  for(i = 0; i < 8; i++){
+    c = ((c * c) - (p ^ q)) | ((p | 55) * (b ^ q));
+  }
+  c = ((p | b) + (q * q)) * ((c ^ 16) - (d & 48));
+  c = ((c ^ q) + (b * p)) * ((b * p) + (b | p));
+  if(c < c){
+    a = ((q | c) - (b ^ 69)) - ((q | 65) | (c ^ q));
+  }else{
+    b = ((p + b) | (c ^ 22)) - ((b + d) * (d - q));
+  }
+  d = ((q & p) + (q & 16)) & ((q ^ d) ^ (b ^ p));
+  c = ((d ^ c) - (b & q)) ^ ((q - b) & (c | c));
+  b = ((p & q) + (b * 30)) & ((b ^ b) & (d | 96));
+  for(i = 0; i < 34; i++){
+    c = ((b + 91) ^ (p * 42)) & ((b - d) ^ (a - c));
+  }
+  if(b < d){
+    b = ((c ^ a) + (c ^ 54)) & ((b + d) | (d - c));
+  }else{
+    d = ((q ^ q) | (c | b)) + ((a * a) + (d - p));
+  }
+  return a + b + c + d;
+}
+
+int func164(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 73;
+  d = 2;
+  c = ((a | d) ^ (b | 51)) | ((p | 20) * (b & d));
+  b = ((d & b) & (d ^ 11)) ^ ((d & q) & (p * b));
+  c = ((a & 4) * (d & c)) + ((c | d) ^ (c ^ 69));
+  c = ((c - d) - (a + 1)) + ((d | a) - (a + b));
+  if(a < q){
+    d = ((d + c) * (p * p)) + ((b | 69) & (d * c));
+  }else{
+    b = ((d * d) - (p + d)) * ((q - 97) | (a * q));
+  }
+  a = ((a | 89) & (a * d)) * ((c ^ d) + (a + 68));
+  for(i = 0; i < 11; i++){
+    d = ((d ^ d) | (b ^ c)) | ((q * d) & (q | a));
+  }
+  c = ((a + a) | (a & 12)) - ((q ^ p) & (c - 68));
+  c = ((p - a) - (c ^ c)) * ((c | c) - (a + p));
+  if(b < a){
+    c = ((d + a) - (c + q)) * ((b - 7) | (a - d));
+  }else{
+    a = ((d - p) * (p ^ b)) + ((p * b) & (d | c));
+  }
+  c = ((b | a) & (d | p)) ^ ((a - q) ^ (d * c));
+  a = ((b ^ a) & (q | p)) - ((d & b) ^ (d | 73));
+  d = ((a ^ 81) * (a + a)) | ((c * p) ^ (q - 24));
+  for(i = 0; i < 30; i++){
+    c = ((b & d) & (b | b)) & ((b + b) | (b | 71));
+  }
+  if(c < 61){
+    d = ((c | d) * (p * 34)) ^ ((a ^ p) & (d ^ q));
+  }else{
+    d = ((c & b) + (c | a)) & ((q - q) * (q ^ 86));
+  }
+  a = ((c * 34) ^ (d - a)) & ((q ^ a) * (q | c));
+  c = ((c * c) * (a ^ d)) & ((d | b) * (p + b));
+  a = ((a ^ d) + (p + b)) & ((c ^ 75) | (c - 42));
+  b = ((a - b) & (d | p)) + ((p - c) & (c & b));
+  if(b < p){
+    d = ((c * p) | (p ^ d)) & ((p | 27) + (a & d));
+  }else{
+    a = ((p ^ d) * (q - 10)) & ((b + b) ^ (c - c));
+  }
+  for(i = 0; i < 33; i++){
+    b = ((d + q) * (q | 29)) ^ ((c * q) * (c + d));
+  }
+  c = ((q & d) - (p ^ b)) & ((q + 29) + (b + 85));
+  c = ((p & p) * (q * p)) ^ ((a * a) - (p - 68));
+  d = ((d ^ b) & (d + 70)) + ((p * b) ^ (c ^ p));
+  if(a < a){
+    d = ((d & a) | (b | c)) ^ ((c | 36) * (b + a));
+  }else{
+    c = ((d | a) ^ (b - 26)) & ((c + c) ^ (c + 11));
+  }
+  c = ((q * d) | (p & b)) - ((p * 66) | (d ^ d));
+  a = ((q - 10) * (c * d)) - ((d + 82) + (c & q));
+  for(i = 0; i < 28; i++){
+    d = ((q + c) + (a + c)) ^ ((p & p) & (p * c));
+  }
+  b = ((p + c) ^ (d ^ p)) ^ ((q - 64) + (b | 92));
+  if(c < a){
+    b = ((p - p) | (d * 98)) | ((q - 50) + (b | c));
+  }else{
+    c = ((b - c) * (p ^ c)) - ((d * c) & (p * 17));
+  }
+  a = ((c + 89) + (p & d)) | ((d + b) * (q & p));
+  c = ((d - 93) - (a | 55)) * ((a | 21) | (d - d));
+  d = ((d & d) | (d * p)) * ((d + p) | (b * 65));
+  b = ((q & q) - (a - a)) * ((q & p) ^ (c + 79));
+  if(a < d){
+    b = ((q - d) & (c ^ c)) ^ ((c + c) - (a & d));
+  }else{
+    c = ((c | q) * (q + c)) ^ ((a * c) + (p & 11));
+  }
+  c = ((b & 87) & (a & 9)) ^ ((b | q) | (d * 89));
+  b = ((c | q) + (q * 34)) * ((q * 72) & (b + q));
+  b = ((q + d) | (p & a)) + ((a & 75) + (p * c));
+  a = ((q & a) * (b - c)) & ((a * p) * (c & 72));
+  if(d < 77){
+    a = ((q ^ b) | (q * b)) + ((p | q) - (b + a));
+  }else{
+    c = ((a * p) | (q | c)) + ((c | c) - (c ^ 25));
+  }
+  b = ((d | 28) + (q * 68)) ^ ((d & 93) & (p + q));
+  for(i = 0; i < 26; i++){
+    b = ((d - d) ^ (c & d)) + ((q - a) & (q - a));
+  }
+  b = ((b * b) ^ (p ^ q)) ^ ((a ^ a) | (c ^ 96));
+  d = ((q | p) ^ (b * 95)) | ((c | d) ^ (c - q));
+  if(c < p){
+    c = ((b | p) + (b - q)) ^ ((a + p) | (q ^ a));
+  }else{
+    a = ((c - c) | (d - 42)) & ((c | 56) | (d - c));
+  }
+  a = ((q ^ 76) - (d - a)) | ((a | d) | (d ^ 1));
+  d = ((b - d) - (p ^ a)) | ((c | c) + (d - p));
+  b = ((a * 64) | (q - a)) * ((c & 67) & (c - c));
+  for(i = 0; i < 20; i++){
+    c = ((d + 28) * (c - c)) + ((a ^ 13) ^ (q * p));
+  }
+  if(a < 13){
+    c = ((b * p) & (d | a)) ^ ((b + p) - (a ^ b));
+  }else{
+    a = ((d ^ 56) & (c * q)) * ((q | p) | (p + b));
+  }
+  return a + b + c + d;
+}
+
+int func165(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 85;
+  c = ((d - 29) + (a ^ c)) & ((a | q) - (c * q));
+  d = ((a & b) | (b - a)) + ((c * 46) * (p + b));
+  c = ((a + a) | (c * d)) & ((c * a) ^ (d + a));
+  c = ((a * 80) - (b | b)) + ((c + d) ^ (d + p));
+  if(d < c){
+    c = ((c + p) + (a - 30)) | ((c ^ a) + (p | b));
+  }else{
+    a = ((c ^ a) + (p ^ q)) | ((c + b) + (q + 39));
+  }
+  c = ((c ^ p) & (d | p)) - ((p | q) - (p * b));
+  for(i = 0; i < 15; i++){
+    a = ((b + q) - (b + d)) & ((a | d) + (a | b));
+  }
+  b = ((c - c) + (b - d)) | ((d ^ c) | (p | b));
+  c = ((c * b) ^ (c ^ 58)) & ((b & q) & (b & d));
+  if(b < d){
+    c = ((q & p) ^ (b - d)) - ((c ^ b) * (c | c));
+  }else{
+    b = ((c * d) | (d - d)) | ((p + c) - (a - c));
+  }
+  b = ((b - 76) - (a ^ 89)) * ((a - a) ^ (p ^ 21));
+  d = ((c + a) ^ (p + b)) - ((p | p) ^ (q | 44));
+  d = ((p + p) + (p - p)) - ((a ^ c) * (q - q));
+  for(i = 0; i < 5; i++){
+    b = ((b | b) + (q * p)) | ((c & 85) + (b - 18));
+  }
+  if(d < 69){
+    b = ((q - 11) & (c & p)) + ((c | a) + (d * d));
+  }else{
+    b = ((a & c) * (d & b)) * ((c & b) - (p * a));
+  }
+  b = ((b * a) | (a | c)) + ((b * a) + (p + q));
+  c = ((c & 67) & (p ^ d)) * ((b * d) + (q - 6));
+  a = ((a * p) | (a & b)) ^ ((a ^ 25) ^ (q | 85));
+  b = ((p - p) * (a - 27)) ^ ((a - 14) + (c + 22));
+  if(c < d){
+    a = ((p + a) + (b & 21)) & ((c * 49) * (p & 66));
+  }else{
+    c = ((b ^ 73) * (p + 2)) & ((a - c) * (p | p));
+  }
+  for(i = 0; i < 45; i++){
+    c = ((d - b) - (a ^ d)) ^ ((q & 71) | (d - 63));
+  }
+  a = ((c | c) & (p & c)) - ((c | 8) ^ (a & b));
+  b = ((a | c) - (q - b)) + ((q - p) * (c ^ d));
+  c = ((p ^ c) - (a - 27)) | ((p - p) & (b * c));
+  if(d < b){
+    b = ((b - 53) - (d - 85)) * ((b | 66) & (q - a));
+  }else{
+    a = ((d ^ 13) & (p - d)) + ((d ^ 73) & (b + 77));
+  }
+  a = ((b & 66) - (c ^ p)) ^ ((q ^ d) | (q * 15));
+  c = ((b * a) + (d - d)) ^ ((a - d) | (a | p));
+  for(i = 0; i < 14; i++){
+    b = ((a & 33) ^ (p * q)) | ((q | b) & (q ^ a));
+  }
+  a = ((a | a) - (a | 77)) ^ ((p ^ 50) - (q ^ c));
+  if(c < b){
+    a = ((p | a) - (q - a)) * ((b * 80) & (c * b));
+  }else{
+    a = ((q + q) | (p - q)) + ((p + d) | (b | p));
+  }
+  d = ((c + q) ^ (a & c)) ^ ((d | 83) - (p ^ a));
+  a = ((d & d) | (c ^ 6)) | ((q & p) + (c & b));
+  b = ((q | a) | (a - b)) + ((q & b) & (p | q));
+  a = ((p * b) | (q * a)) ^ ((d | 48) * (p * 25));
+  if(c < a){
+    c = ((q ^ q) & (d - 16)) ^ ((c * p) | (c | 50));
+  }else{
+    c = ((p * q) + (p + 53)) * ((q - p) | (c & b));
+  }
+  c = ((q & c) + (a * d)) - ((p + d) & (q ^ b));
+  b = ((c | 41) + (p & q)) * ((d + 78) - (p * 94));
+  d = ((q * 84) + (q - c)) & ((c ^ q) + (a - 89));
+  d = ((d ^ d) - (p - q)) | ((p * q) * (q * p));
+  if(c < q){
+    a = ((p | b) + (q - c)) ^ ((b + c) * (b ^ p));
+  }else{
+    a = ((c + a) | (q + q)) ^ ((d * a) - (d & d));
+  }
+  c = ((b * d) ^ (d * 38)) * ((q - 98) & (a - 71));
+  for(i = 0; i < 44; i++){
+    a = ((q * p) - (a ^ b)) * ((a * q) - (b ^ 40));
+  }
+  d = ((b * q) ^ (p ^ 39)) | ((a & a) - (c + a));
+  c = ((p + c) * (p | c)) & ((a * 55) - (d + 54));
+  if(b < b){
+    c = ((p | p) * (d + 99)) + ((b | d) - (a & 94));
+  }else{
+    b = ((p + c) ^ (q - c)) ^ ((c | q) - (a + d));
+  }
+  b = ((c ^ 89) - (b & d)) ^ ((p - a) + (d | 62));
+  c = ((c + 45) | (p + q)) + ((d * q) * (p + b));
+  a = ((p + q) ^ (q + b)) & ((b | c) * (d + b));
+  for(i = 0; i < 4; i++){
+    c = ((d - 79) * (d ^ 54)) & ((q | q) * (d ^ c));
+  }
+  if(b < q){
+    a = ((c & b) & (q + q)) - ((b & q) * (q * b));
+  }else{
+    a = ((d | a) ^ (q + q)) + ((p - a) ^ (b + 80));
+  }
+  return a + b + c + d;
+}
+
+int func166(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 76;
+  d = 37;
+  a = ((c ^ a) - (a * 61)) * ((b ^ 78) | (p - 21));
+  d = ((c - q) & (b - a)) | ((d * a) + (a + c));
+  d = ((b + c) & (p - b)) & ((a ^ 32) ^ (q ^ q));
+  d = ((p | c) - (d ^ b)) * ((p | 14) * (p | d));
+  if(a < b){
+    b = ((p ^ q) * (b | 78)) | ((q | 88) & (p - c));
+  }else{
+    a = ((c * q) | (p | 54)) + ((c ^ q) | (d + p));
+  }
+  b = ((p | d) + (d ^ d)) & ((a & b) | (d | q));
+  for(i = 0; i < 32; i++){
+    a = ((d + d) ^ (a ^ p)) | ((p - a) * (c & 1));
+  }
+  a = ((c ^ p) & (q - c)) ^ ((c ^ a) | (p + d));
+  b = ((a - q) - (b + p)) ^ ((b + a) * (p - c));
+  if(b < p){
+    c = ((c & d) + (c - c)) + ((c ^ a) ^ (d * c));
+  }else{
+    d = ((p + a) ^ (c + q)) | ((p + c) + (a ^ b));
+  }
+  d = ((p & q) | (c ^ b)) + ((p & 59) & (b - d));
+  b = ((d * q) & (a * a)) ^ ((b - a) ^ (c | a));
+  a = ((b & 40) + (d | a)) + ((d | a) * (p + d));
+  for(i = 0; i < 21; i++){
+    d = ((c + a) | (p + c)) + ((d * 79) ^ (c ^ a));
+  }
+  if(b < d){
+    b = ((q + c) | (d - 24)) | ((p + a) * (a ^ 5));
+  }else{
+    d = ((p - a) - (b ^ 30)) * ((q + 87) & (d + b));
+  }
+  a = ((p | p) & (b & d)) - ((b ^ b) * (c - 29));
+  c = ((b - b) ^ (d & b)) - ((d ^ b) & (d & p));
+  c = ((c | d) * (p & a)) - ((p * q) - (q | d));
+  c = ((b ^ 21) ^ (b + b)) | ((p & q) * (c + c));
+  if(b < b){
+    c = ((a * 81) ^ (d ^ 37)) & ((c * c) - (p + c));
+  }else{
+    a = ((d + q) | (p & q)) & ((d | 95) & (c & c));
+  }
+  for(i = 0; i < 35; i++){
+    a = ((b ^ p) & (p + d)) ^ ((p + d) + (c ^ p));
+  }
+  d = ((q & a) * (d ^ a)) | ((p ^ 75) * (p - 14));
+  d = ((b + c) & (d & q)) - ((p * q) * (d + q));
+  d = ((a & 35) + (c - d)) & ((b ^ p) + (b + c));
+  if(c < c){
+    c = ((d ^ q) & (q + p)) + ((p * d) & (q * q));
+  }else{
+    b = ((b ^ q) * (p + d)) * ((a | 25) * (b - q));
+  }
+  c = ((b | d) ^ (a ^ b)) ^ ((b & p) - (b + 98));
+  a = ((p * 67) & (d + a)) + ((c - 32) - (a * b));
+  for(i = 0; i < 40; i++){
+    c = ((a & 30) + (a | 9)) & ((q + q) | (d & d));
+  }
+  c = ((p ^ d) ^ (d - 29)) | ((b + d) & (a & 53));
+  if(b < 89){
+    a = ((p * b) ^ (q + b)) - ((p | q) & (a ^ q));
+  }else{
+    b = ((p | 69) ^ (c ^ c)) + ((b * c) | (b & 93));
+  }
+  d = ((c - 54) | (q | p)) ^ ((d - 18) * (a + 52));
+  d = ((q * q) & (c * d)) & ((c | 57) - (b & c));
+  a = ((c + d) - (p & 37)) & ((q ^ a) & (p & 80));
+  a = ((c & 1) - (a - q)) & ((b - q) ^ (q & p));
+  if(d < d){
+    d = ((p - c) | (c ^ d)) + ((a ^ p) + (c - q));
+  }else{
+    c = ((a - d) | (p & c)) - ((b + c) & (d ^ 25));
+  }
+  d = ((q | q) + (c + d)) ^ ((c + d) | (q - c));
+  d = ((b * 21) | (d & d)) | ((c + c) & (a * d));
+  c = ((c * a) * (q & a)) - ((a ^ q) & (q & p));
+  b = ((b | b) | (p - 64)) - ((d + c) ^ (b + d));
+  if(c < b){
+    b = ((q ^ d) - (a ^ a)) + ((p - d) + (a & d));
+  }else{
+    d = ((a - b) | (q & d)) * ((d + p) * (q - d));
+  }
+  c = ((q | d) | (q + d)) | ((a - d) - (c & p));
+  for(i = 0; i < 19; i++){
+    a = ((d - a) * (p * d)) | ((d | d) ^ (d ^ p));
+  }
+  c = ((d - 33) | (c & c)) ^ ((p ^ 72) | (b - d));
+  b = ((d & c) ^ (q ^ 48)) & ((q ^ a) | (a | c));
+  if(d < p){
+    a = ((q | 35) - (p * 18)) + ((p * d) - (c ^ c));
+  }else{
+    d = ((p | d) | (a + 94)) & ((a | d) & (p * c));
+  }
+  b = ((b + p) - (q * q)) + ((c - 58) | (c * p));
+  a = ((a ^ 80) + (d ^ p)) & ((a ^ c) * (c & b));
+  b = ((b - p) * (b + d)) & ((q | c) + (c - c));
+  for(i = 0; i < 48; i++){
+    b = ((a & 36) & (b | a)) + ((b & a) ^ (c | d));
+  }
+  if(c < c){
+    a = ((b * d) - (q | a)) - ((q | 12) ^ (q + 62));
+  }else{
+    a = ((p * 25) * (d - 36)) - ((p * 93) * (c & b));
+  }
+  return a + b + c + d;
+}
+
+int func167(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 2;
+  d = 64;
+  d = ((p * c) & (d & a)) - ((a * b) * (b | c));
+  c = ((a * p) & (p ^ c)) ^ ((p & b) | (a | c));
+  b = ((q & p) * (a * d)) ^ ((p - d) - (q * a));
+  c = ((q & b) ^ (p | 94)) ^ ((p * q) * (c - q));
+  if(b < q){
+    c = ((p + p) + (c + 74)) + ((d & p) ^ (p ^ c));
+  }else{
+    b = ((p * 36) * (b ^ b)) ^ ((q + c) + (b ^ 55));
+  }
+  c = ((c - 66) * (c * q)) & ((a ^ a) - (b ^ 45));
+  for(i = 0; i < 8; i++){
+    a = ((d ^ b) & (c - 55)) | ((c - 42) ^ (a * c));
+  }
+  d = ((b - d) ^ (a * p)) ^ ((b | a) ^ (c * 41));
+  c = ((c * a) | (d & p)) ^ ((d ^ c) & (d - p));
+  if(c < c){
+    a = ((c | 99) & (c & 53)) + ((p ^ d) + (b * d));
+  }else{
+    d = ((q - d) + (c + p)) & ((c | a) | (p & p));
+  }
+  a = ((d & 50) - (d | 84)) * ((c - a) - (a + d));
+  c = ((p + a) | (q + 56)) & ((a + q) ^ (d | b));
+  b = ((a * c) - (p * c)) * ((c & p) - (c | 31));
+  for(i = 0; i < 22; i++){
+    c = ((a ^ 93) ^ (q + 18)) + ((q ^ p) & (b & q));
+  }
+  if(a < d){
+    a = ((b & b) ^ (d - 6)) + ((d | q) & (c & 42));
+  }else{
+    b = ((b ^ 40) - (c - b)) ^ ((b * c) + (p & c));
+  }
+  b = ((a | b) & (d * 80)) & ((d & p) & (a ^ a));
+  c = ((d + p) & (b * q)) + ((p + 30) | (q | a));
+  a = ((a * q) ^ (q & q)) & ((a & c) * (q * p));
+  d = ((b + c) & (q + 42)) & ((a & p) ^ (a & d));
+  if(d < b){
+    b = ((q & a) ^ (d + p)) & ((d - 61) * (q & c));
+  }else{
+    b = ((q * q) ^ (d & q)) - ((a - c) - (d & d));
+  }
+  for(i = 0; i < 28; i++){
+    c = ((q - p) ^ (b ^ p)) ^ ((d + 78) - (c - a));
+  }
+  d = ((a & 42) * (d + q)) - ((p | p) ^ (p * p));
+  c = ((q + d) | (a * 59)) & ((c ^ b) ^ (c - 69));
+  b = ((p * b) | (p + 50)) ^ ((a + c) | (p + 79));
+  if(b < c){
+    b = ((a - q) | (c - p)) + ((c | a) - (b - c));
+  }else{
+    a = ((d + a) ^ (q ^ p)) | ((p | q) | (p * q));
+  }
+  b = ((a + q) ^ (q - a)) - ((c * 45) - (p & 30));
+  d = ((q * p) | (b + p)) | ((c + b) * (p ^ 19));
+  for(i = 0; i < 20; i++){
+    d = ((b + a) - (d * p)) - ((p * 4) * (a & 71));
+  }
+  c = ((a ^ p) * (c + q)) | ((q ^ q) - (d & b));
+  if(a < b){
+    a = ((p & b) ^ (d ^ b)) | ((q - c) & (d + a));
+  }else{
+    c = ((b + p) | (b * p)) ^ ((a ^ p) | (p * p));
+  }
+  c = ((a + q) & (a & d)) * ((b + a) + (a & b));
+  c = ((a & q) * (a - 94)) ^ ((b | c) & (a * d));
+  c = ((d - c) * (p ^ c)) - ((d + q) * (d ^ p));
+  d = ((p & p) & (b + 98)) & ((q - 78) | (a & 94));
+  if(b < 52){
+    c = ((d * a) | (p ^ a)) ^ ((b & q) * (a + d));
+  }else{
+    d = ((b ^ 89) + (d | p)) | ((q | c) ^ (q ^ 27));
+  }
+  c = ((a - c) | (d + 2)) ^ ((c - d) - (c + q));
+  a = ((q | 50) * (b ^ 19)) * ((d ^ q) - (b + d));
+  b = ((a + b) | (a + q)) & ((a | d) & (b | c));
+  a = ((b + p) | (c | q)) + ((b & 18) ^ (a - 94));
+  if(d < q){
+    a = ((c | b) & (b ^ p)) ^ ((p + a) ^ (a | d));
+  }else{
+    b = ((p & 61) & (p + c)) * ((q + 33) - (b + c));
+  }
+  c = ((b | b) + (p ^ q)) * ((q ^ p) - (p * p));
+  for(i = 0; i < 42; i++){
+    c = ((p ^ 42) & (d & q)) ^ ((a | b) ^ (b - 49));
+  }
+  b = ((p | a) ^ (a - p)) - ((a - b) ^ (q & b));
+  d = ((b ^ 85) + (q | 60)) * ((b * c) - (b * p));
+  if(c < d){
+    d = ((q * b) & (q + b)) | ((p & a) ^ (a ^ 10));
+  }else{
+    a = ((p - a) & (b + d)) + ((b ^ d) * (p - d));
+  }
+  b = ((p & b) & (p ^ 86)) | ((q & c) & (p * p));
+  a = ((a ^ q) - (p | p)) - ((d | p) | (q - a));
+  d = ((q + a) | (d * c)) + ((p & b) + (p * q));
+  for(i = 0; i < 44; i++){
+    a = ((q ^ 99) + (c | d)) ^ ((p ^ c) ^ (a - b));
+  }
+  if(c < c){
+    d = ((b ^ c) | (q * b)) + ((p * a) - (p * 77));
+  }else{
+    b = ((d | b) | (p | 97)) | ((d & q) + (a | q));
+  }
+  return a + b + c + d;
+}
+
+int func168(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 81;
+  d = 34;
+  b = ((a + b) + (q & c)) ^ ((c - d) & (p * d));
+  d = ((a - c) * (a ^ 26)) - ((a | 24) | (p & a));
+  b = ((b - 70) + (d - b)) | ((p ^ 16) & (p ^ a));
+  b = ((b * 61) - (q + q)) ^ ((b * a) ^ (a + c));
+  if(d < a){
+    d = ((d * c) - (b ^ 94)) ^ ((b * b) + (b + a));
+  }else{
+    c = ((b ^ d) & (q + c)) ^ ((q ^ d) & (b + a));
+  }
+  a = ((a + b) & (a - q)) | ((a ^ d) & (c ^ b));
+  for(i = 0; i < 19; i++){
+    d = ((b ^ 13) ^ (d * 27)) ^ ((b - q) & (b + c));
+  }
+  d = ((c - a) ^ (d | q)) | ((a + d) - (q & c));
+  c = ((c - c) | (d + q)) + ((b | c) * (a ^ a));
+  if(d < c){
+    c = ((a & 67) & (a - c)) | ((a & c) - (p + 90));
+  }else{
+    a = ((b + c) * (p - 79)) - ((b | b) - (c - 77));
+  }
+  c = ((d * 5) + (a ^ a)) & ((b * c) * (c & p));
+  a = ((q + q) - (b - b)) + ((q * 33) & (q & a));
+  b = ((b + p) & (c + q)) - ((d + b) & (q & 42));
+  for(i = 0; i < 38; i++){
+    c = ((b + 71) ^ (d + 10)) | ((c | b) ^ (q + b));
+  }
+  if(b < a){
+    d = ((b * d) * (d | 12)) - ((d ^ q) & (d | p));
+  }else{
+    d = ((d & b) | (a + 62)) - ((a + c) & (a + q));
+  }
+  c = ((a & d) * (b * 47)) + ((c | a) + (c - 27));
+  d = ((d + a) - (p & c)) ^ ((d + 75) - (c | d));
+  d = ((p ^ 55) ^ (d | q)) & ((b ^ c) - (c - b));
+  b = ((q - a) ^ (d * 87)) * ((q - q) & (b & d));
+  if(a < d){
+    b = ((d + a) + (c * q)) * ((a ^ a) - (q & p));
+  }else{
+    a = ((a - a) | (c - 42)) ^ ((d & d) + (q * q));
+  }
+  for(i = 0; i < 45; i++){
+    c = ((d - p) & (b * 78)) | ((p ^ p) ^ (q + p));
+  }
+  b = ((q & q) | (p ^ 27)) | ((q + 94) * (q & d));
+  d = ((b | b) * (c | c)) & ((p ^ p) & (q * a));
+  c = ((d ^ q) | (d ^ q)) | ((b * c) & (b | d));
+  if(c < b){
+    b = ((d ^ d) - (b | d)) & ((b + 34) & (d * p));
+  }else{
+    a = ((b ^ 44) & (d - q)) * ((q - 12) * (q + q));
+  }
+  d = ((q - p) & (a & d)) * ((p * 34) ^ (q + p));
+  d = ((a ^ 30) + (p ^ c)) | ((a | 71) + (d * 90));
+  for(i = 0; i < 45; i++){
+    c = ((q ^ q) + (d + d)) & ((a + c) * (b + p));
+  }
+  c = ((p & a) ^ (b ^ 90)) ^ ((q + 38) ^ (b + 19));
+  if(a < b){
+    a = ((p | q) ^ (a - 16)) & ((p - 56) + (p + d));
+  }else{
+    c = ((d & p) & (d * b)) | ((d * c) | (b ^ d));
+  }
+  c = ((c | 74) | (d + c)) ^ ((a ^ b) + (b | a));
+  d = ((a * c) * (c + d)) | ((q + d) ^ (p - 61));
+  a = ((a * 35) ^ (q & 13)) + ((c ^ p) & (b * b));
+  d = ((b + c) & (a | 53)) + ((c + d) + (b - 63));
+  if(b < c){
+    b = ((p - d) & (p - a)) ^ ((p & a) - (d & c));
+  }else{
+    b = ((q * 31) & (q + c)) - ((q - b) | (a * p));
+  }
+  b = ((p & q) ^ (p - p)) & ((d * a) & (p ^ d));
+  b = ((q + p) - (c ^ d)) ^ ((d - a) * (p * 54));
+  c = ((b * 31) | (a ^ 2)) - ((d + a) | (d * q));
+  c = ((b - a) | (b - c)) & ((d & 99) + (b | p));
+  if(d < 74){
+    d = ((d * b) ^ (b + b)) ^ ((d * 50) | (d - a));
+  }else{
+    c = ((c ^ c) | (q - d)) ^ ((c + c) * (p ^ 9));
+  }
+  b = ((b - a) ^ (c - 50)) * ((p ^ b) * (b ^ 83));
+  for(i = 0; i < 36; i++){
+    c = ((d - p) | (d | a)) + ((p & d) ^ (p ^ q));
+  }
+  b = ((q ^ 38) - (c & q)) + ((c & q) + (p ^ 26));
+  b = ((a | a) * (q ^ 71)) | ((b + 22) * (p - a));
+  if(a < q){
+    a = ((d ^ b) * (a | 80)) * ((c * 96) ^ (c * c));
+  }else{
+    a = ((q & p) ^ (d ^ b)) & ((p * p) ^ (q & q));
+  }
+  a = ((b | a) ^ (c & d)) & ((b | b) | (c * c));
+  a = ((q ^ 12) + (p + c)) & ((p * d) ^ (d + b));
+  a = ((b & a) * (d & b)) + ((b - a) & (d & p));
+  for(i = 0; i < 23; i++){
+    b = ((q ^ q) - (d + a)) + ((p + d) ^ (a - q));
+  }
+  if(d < 77){
+    d = ((b * d) - (p | 46)) * ((d & p) * (b + q));
+  }else{
+    d = ((c & b) - (c * d)) ^ ((c + c) & (b ^ 51));
+  }
+  return a + b + c + d;
+}
+
+int func169(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 10;
+  d = 57;
+  c = ((q - d) - (c & b)) & ((b & c) ^ (d * c));
+  c = ((a & c) - (d - a)) + ((p | p) ^ (p ^ c));
+  c = ((c - c) + (d - c)) * ((d ^ 19) * (c | 87));
+  c = ((p & 44) * (b - 89)) | ((d - q) & (a | 77));
+  if(c < 15){
+    a = ((b & 76) * (c - b)) ^ ((c - c) & (d + q));
+  }else{
+    a = ((a + c) & (b + 16)) ^ ((b & b) | (b + d));
+  }
+  b = ((b & c) & (a * p)) - ((q ^ c) - (c | q));
+  for(i = 0; i < 50; i++){
+    d = ((a * 97) - (d ^ p)) * ((c | 45) * (b * b));
+  }
+  c = ((q ^ 94) & (d | 53)) | ((q ^ p) | (d + 79));
+  b = ((c + q) ^ (c - d)) & ((q | q) + (c - a));
+  if(b < a){
+    a = ((q ^ 27) | (q ^ b)) | ((b ^ 97) + (a + b));
+  }else{
+    c = ((b - 66) - (p + q)) - ((a | p) | (b | b));
+  }
+  a = ((c * 69) & (d - a)) | ((p & c) + (q * p));
+  a = ((p - q) + (q + 16)) * ((b & q) ^ (d + d));
+  b = ((p * b) - (c - b)) - ((p | b) ^ (p + a));
+  for(i = 0; i < 24; i++){
+    b = ((a + a) & (p & 92)) & ((p & a) ^ (d & 28));
+  }
+  if(b < 24){
+    b = ((p ^ p) + (d & q)) & ((b ^ q) + (b & c));
+  }else{
+    c = ((b - a) ^ (a & p)) * ((q & p) - (p & q));
+  }
+  c = ((p ^ a) & (c | c)) ^ ((q * b) ^ (q | c));
+  a = ((b & a) - (p ^ b)) - ((p + a) & (p & 89));
+  b = ((q * a) ^ (q | p)) | ((b * a) * (c | c));
+  a = ((d - 94) * (c - d)) ^ ((p ^ 91) | (b ^ p));
+  if(a < 88){
+    c = ((d & a) + (d & c)) & ((d | b) * (d * p));
+  }else{
+    d = ((b - b) * (p * 60)) & ((q ^ 16) ^ (d & d));
+  }
+  for(i = 0; i < 44; i++){
+    b = ((p & a) | (d | 68)) & ((a ^ c) * (q & c));
+  }
+  b = ((b - a) | (p + q)) & ((d - c) + (p ^ p));
+  a = ((c * d) | (q + a)) & ((b - b) & (d & d));
+  c = ((b & b) * (a + 15)) + ((c & q) + (q + a));
+  if(a < b){
+    c = ((d - b) - (b - 20)) - ((q & 80) ^ (d - 46));
+  }else{
+    d = ((c | p) ^ (q + b)) * ((a & 34) | (d + p));
+  }
+  c = ((q + d) | (b + 4)) & ((d - q) - (q & b));
+  b = ((c - a) ^ (d & c)) + ((d + d) - (a + q));
+  for(i = 0; i < 45; i++){
+    d = ((p & p) * (q & b)) ^ ((a * q) - (p * d));
+  }
+  d = ((q - 82) * (p ^ q)) & ((d & 73) * (q | 3));
+  if(a < a){
+    d = ((q ^ 77) * (p | c)) ^ ((q ^ 2) - (c ^ 75));
+  }else{
+    b = ((q & 29) - (c & q)) | ((c ^ c) ^ (p | c));
+  }
+  d = ((a & a) + (c - b)) + ((b + c) + (c * a));
+  a = ((q & a) + (q & q)) - ((b - q) + (c ^ 16));
+  c = ((a | 35) - (b - p)) * ((b - p) + (c + p));
+  b = ((q & d) & (d + 51)) | ((c & a) & (c | p));
+  if(b < b){
+    d = ((a & q) + (d - p)) - ((a - d) & (q | p));
+  }else{
+    b = ((p ^ 53) + (c ^ a)) * ((a * b) & (q & q));
+  }
+  b = ((d + 77) + (q - p)) - ((d + p) - (c * a));
+  b = ((d - 31) - (q & d)) ^ ((a & b) | (d * a));
+  b = ((p | d) | (p | p)) | ((c * q) ^ (b | 62));
+  b = ((p - a) * (c | c)) & ((q - 77) + (a & a));
+  if(b < 46){
+    b = ((d & c) - (d & a)) + ((p | p) - (a - b));
+  }else{
+    c = ((d + d) | (b & 34)) & ((b ^ c) ^ (b ^ d));
+  }
+  a = ((q & b) ^ (b ^ a)) + ((c - 70) ^ (d ^ q));
+  for(i = 0; i < 33; i++){
+    b = ((p + 60) ^ (c * q)) + ((p * d) & (c - c));
+  }
+  c = ((a ^ 33) | (q ^ d)) ^ ((q & a) ^ (d + 39));
+  d = ((c - a) - (p - 56)) | ((q * p) | (c + 80));
+  if(b < p){
+    d = ((a & 10) | (a | p)) | ((a - a) ^ (b | 10));
+  }else{
+    a = ((b + 97) + (p | 64)) ^ ((b + d) + (d & a));
+  }
+  b = ((c & b) ^ (q + q)) - ((q | a) ^ (p + 32));
+  d = ((q - q) * (c * b)) * ((d - b) + (q + 76));
+  c = ((q | a) * (q - 52)) ^ ((a + q) + (q | 62));
+  for(i = 0; i < 37; i++){
+    c = ((d ^ d) | (d ^ b)) & ((q + q) ^ (a ^ 54));
+  }
+  if(a < b){
+    a = ((a | b) ^ (p & q)) & ((a * 85) & (b & d));
+  }else{
+    d = ((p * p) + (q ^ d)) & ((q | 57) * (c & c));
+  }
+  return a + b + c + d;
+}
+
+int func170(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 68;
+  d = 64;
+  c = ((c ^ p) ^ (q + q)) | ((b + b) + (a + d));
+  c = ((d * p) - (c - c)) & ((c & 13) + (q + 67));
+  a = ((b & q) * (d ^ 39)) - ((q * p) & (a | c));
+  d = ((a + d) + (d - 45)) + ((q + d) ^ (p * d));
+  if(a < q){
+    a = ((d ^ q) * (q + q)) & ((c - p) - (a - d));
+  }else{
+    d = ((q ^ 1) | (q ^ q)) | ((d - q) | (p | q));
+  }
+  d = ((a - d) & (p & p)) ^ ((d - c) * (b * a));
+  for(i = 0; i < 42; i++){
+    b = ((d * 43) * (d ^ 89)) + ((b ^ q) * (c * p));
+  }
+  a = ((d - c) + (p * b)) | ((c ^ d) - (p ^ a));
+  c = ((p | p) + (b ^ q)) & ((c * p) + (q - a));
+  if(b < 6){
+    a = ((a * 22) + (b - c)) + ((c + 29) & (q - p));
+  }else{
+    a = ((b & d) ^ (p + 50)) - ((q ^ 83) ^ (c * a));
+  }
+  c = ((d & q) & (a + 3)) - ((d & b) + (c + d));
+  b = ((a ^ d) | (c - 82)) & ((d | c) ^ (a + a));
+  c = ((b | p) ^ (a ^ q)) | ((q | c) | (a + c));
+  for(i = 0; i < 11; i++){
+    c = ((c | q) ^ (c | 83)) | ((a ^ c) & (p + q));
+  }
+  if(a < b){
+    d = ((b * b) * (p | p)) - ((p * d) ^ (q & a));
+  }else{
+    c = ((a ^ 71) & (a - b)) & ((q | b) | (p * 29));
+  }
+  d = ((b + 60) ^ (a & a)) + ((d - c) | (c * q));
+  b = ((q | q) * (c ^ 98)) ^ ((p | q) & (c | p));
+  c = ((a + 22) | (b + 52)) & ((p | c) - (p * b));
+  c = ((q | b) & (b - a)) | ((c * p) | (p * d));
+  if(d < d){
+    a = ((a * q) - (p ^ d)) & ((c & 22) | (c * 6));
+  }else{
+    b = ((q - p) + (b - q)) ^ ((d + p) | (a | a));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((a ^ 96) & (q * d)) & ((q | a) | (c | 73));
+  }
+  d = ((q + p) + (q ^ b)) * ((p - q) - (c - p));
+  c = ((b ^ b) | (d & c)) | ((c + q) - (c + c));
+  c = ((c + b) | (d + c)) * ((q | d) | (a & a));
+  if(b < d){
+    b = ((q + p) + (a - d)) * ((a * d) - (q ^ a));
+  }else{
+    a = ((d - q) & (q + a)) ^ ((a * q) ^ (c * d));
+  }
+  d = ((d | b) | (q ^ q)) ^ ((q & 43) ^ (a & a));
+  b = ((b | p) + (p | b)) ^ ((d | b) - (p & b));
+  for(i = 0; i < 19; i++){
+    b = ((d | 87) - (q ^ q)) + ((d | d) - (q + q));
+  }
+  a = ((q + a) - (d - d)) & ((c ^ b) - (c + b));
+  if(a < b){
+    d = ((p ^ 92) | (c + d)) & ((a + a) & (d * a));
+  }else{
+    a = ((a | p) & (q * a)) & ((a & 62) * (b & b));
+  }
+  b = ((d & c) & (d | d)) ^ ((a ^ p) * (b & 37));
+  a = ((p - b) + (p & b)) & ((d * c) - (c * b));
+  a = ((p ^ 81) & (c | a)) ^ ((c * c) ^ (a - q));
+  a = ((d ^ p) + (b | 27)) ^ ((b | p) + (p | d));
+  if(d < c){
+    a = ((a * a) | (b * a)) - ((q | a) * (q + p));
+  }else{
+    c = ((q & q) & (c ^ b)) - ((d + b) * (c & q));
+  }
+  a = ((d | b) ^ (a * q)) * ((p - d) + (q & q));
+  a = ((q & b) & (q | p)) | ((d & p) ^ (d + b));
+  d = ((d & p) ^ (q + q)) * ((q | 89) & (a | 16));
+  d = ((d + c) + (q + b)) * ((p - a) - (p + 68));
+  if(c < q){
+    c = ((c * c) & (q | d)) ^ ((p * 39) & (p | q));
+  }else{
+    d = ((b - p) & (q & p)) + ((a - 62) - (p ^ b));
+  }
+  d = ((p - d) & (a - q)) | ((b - b) | (c - b));
+  for(i = 0; i < 43; i++){
+    b = ((q & p) & (p & a)) | ((q | 25) + (c & p));
+  }
+  b = ((p | d) & (p + q)) + ((p ^ c) * (p | 98));
+  c = ((d + 33) | (b * p)) * ((c & a) + (p & a));
+  if(b < d){
+    a = ((c ^ 96) + (d - c)) * ((d | p) & (d - q));
+  }else{
+    c = ((p + q) & (p * a)) ^ ((p | 6) ^ (d * q));
+  }
+  c = ((q - p) - (a - b)) * ((p ^ 29) - (a + 94));
+  d = ((b - 5) & (c & 75)) * ((d | d) + (b + 9));
+  c = ((a & 72) & (c | d)) & ((q | p) + (c + c));
+  for(i = 0; i < 27; i++){
+    c = ((b & b) & (c * q)) & ((d ^ b) ^ (a + d));
+  }
+  if(d < q){
+    c = ((d ^ 23) + (p * b)) | ((a & 41) - (c | a));
+  }else{
+    a = ((q + a) * (b * c)) & ((b * c) - (q | 41));
+  }
+  return a + b + c + d;
+}
+
+int func171(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 34;
+  b = ((q - a) & (c & a)) & ((d & c) * (b | c));
+  d = ((c & d) - (b | a)) & ((b - b) + (a * 50));
+  a = ((q ^ c) - (a & 85)) ^ ((c * a) - (b & c));
+  c = ((q | c) & (q & 58)) - ((b | q) & (q | b));
+  if(a < a){
+    d = ((c + q) * (c + 37)) - ((d & p) & (q - q));
+  }else{
+    a = ((b & a) + (a - q)) - ((d & p) & (p + 43));
+  }
+  c = ((d & q) * (q * q)) + ((p ^ p) + (d | c));
+  for(i = 0; i < 44; i++){
+    b = ((d ^ c) ^ (c | 79)) | ((c - c) & (p | c));
+  }
+  a = ((b * 30) * (d + 26)) ^ ((p - c) | (b & b));
+  a = ((p - 23) & (a | 26)) & ((a * 75) * (q * c));
+  if(b < b){
+    c = ((a - p) ^ (b | 34)) ^ ((p | c) + (a & c));
+  }else{
+    c = ((p & c) + (a - b)) ^ ((c | p) & (c ^ 77));
+  }
+  b = ((a & a) * (p | 17)) + ((d + p) | (a | 19));
+  b = ((b ^ q) & (c + c)) - ((a | p) - (p + 47));
+  a = ((c * b) * (a + a)) + ((p | d) & (a + p));
+  for(i = 0; i < 23; i++){
+    b = ((b | c) * (q * c)) ^ ((q ^ q) ^ (b * p));
+  }
+  if(a < p){
+    c = ((p * 20) & (q & q)) * ((p + 74) * (c - 90));
+  }else{
+    a = ((a + p) ^ (d ^ b)) * ((c * q) * (p ^ 13));
+  }
+  b = ((q & p) & (c * 78)) ^ ((a - c) * (d ^ 44));
+  b = ((a ^ b) | (d ^ d)) | ((a - p) ^ (a + d));
+  c = ((d + 70) - (d + c)) * ((q * 57) | (c * q));
+  d = ((a ^ c) * (p - c)) * ((d + q) & (p + d));
+  if(d < 57){
+    a = ((p - a) | (c + p)) ^ ((p * 59) ^ (b & b));
+  }else{
+    d = ((q - a) ^ (q | 61)) ^ ((a * q) & (b - d));
+  }
+  for(i = 0; i < 20; i++){
+    b = ((p * p) + (a ^ 78)) ^ ((c & 57) - (p ^ 66));
+  }
+  c = ((d * 60) * (c - d)) | ((a ^ 13) & (a & b));
+  b = ((q + d) | (d - d)) | ((q & 55) ^ (d | d));
+  d = ((d - a) & (b & c)) * ((p & q) ^ (q | q));
+  if(c < d){
+    a = ((q & q) * (d | p)) & ((a ^ 19) - (p & q));
+  }else{
+    b = ((p ^ 61) + (a ^ p)) | ((p * b) & (c * d));
+  }
+  d = ((c ^ 58) ^ (p | d)) | ((b + p) + (b & p));
+  b = ((c ^ a) - (c | b)) + ((p * 37) * (c ^ b));
+  for(i = 0; i < 49; i++){
+    a = ((a - d) - (p + c)) | ((a & a) & (q - c));
+  }
+  d = ((b * p) * (a + q)) | ((c * 79) | (p ^ d));
+  if(c < q){
+    b = ((a - 22) + (a + q)) | ((a - d) & (q & d));
+  }else{
+    a = ((a * p) * (p | 96)) ^ ((b ^ 3) * (b * p));
+  }
+  b = ((c & q) & (b & c)) | ((q * 85) * (d | q));
+  a = ((b ^ p) & (q + q)) ^ ((q & c) | (d & c));
+  a = ((p + 35) | (p * 74)) * ((d & 28) & (c | c));
+  b = ((q ^ 80) - (c ^ 15)) * ((q * q) * (p ^ a));
+  if(b < d){
+    c = ((p - c) + (a ^ 92)) - ((p & a) + (q * 37));
+  }else{
+    d = ((p ^ 3) ^ (a * p)) & ((p | 72) ^ (b ^ p));
+  }
+  a = ((d - d) ^ (q & d)) + ((a | c) - (a & p));
+  c = ((a - 9) & (c + c)) ^ ((p & 24) + (q ^ d));
+  c = ((q * p) | (c ^ b)) | ((q | d) + (b & b));
+  a = ((a * 6) * (b ^ 65)) | ((c ^ d) | (d * q));
+  if(d < 63){
+    d = ((d | 75) + (a - 19)) * ((b & b) + (q - q));
+  }else{
+    d = ((c + b) | (a | d)) & ((b | p) & (c & d));
+  }
+  a = ((q ^ c) | (d - d)) - ((c * d) ^ (c ^ c));
+  for(i = 0; i < 15; i++){
+    b = ((b ^ 2) & (a * b)) * ((q * q) ^ (q - q));
+  }
+  a = ((q & a) + (p * c)) * ((c ^ q) ^ (c - 74));
+  a = ((p & c) + (p & b)) * ((a & a) & (q + d));
+  if(d < d){
+    b = ((c ^ c) | (b + p)) - ((c * p) * (a + 72));
+  }else{
+    b = ((q ^ a) * (q + p)) + ((a * p) * (a | b));
+  }
+  a = ((p + d) ^ (d | q)) & ((q * 27) + (b * a));
+  a = ((d - 78) - (q ^ q)) + ((c + q) + (q ^ 99));
+  a = ((c ^ 90) ^ (b + p)) + ((q * p) ^ (p & 22));
+  for(i = 0; i < 39; i++){
+    c = ((q & b) - (q | d)) ^ ((d ^ c) ^ (b * c));
+  }
+  if(c < 61){
+    b = ((p + c) * (q | 5)) & ((p | b) ^ (p & a));
+  }else{
+    a = ((p + b) ^ (d - q)) + ((p | c) | (p + b));
+  }
+  return a + b + c + d;
+}
+
+int func172(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 28;
+  d = 44;
+  b = ((b ^ q) & (p | p)) + ((b * d) & (q + p));
+  b = ((a * 72) & (q - 24)) - ((d - 21) - (d | 54));
+  d = ((d + q) - (d | q)) - ((c ^ c) | (a + c));
+  a = ((b & a) ^ (b | a)) & ((b | c) & (c | 73));
+  if(d < q){
+    c = ((c + b) & (c * 88)) & ((d ^ 75) & (d | 24));
+  }else{
+    a = ((c + b) ^ (a * q)) + ((a - d) + (p | d));
+  }
+  a = ((a + a) + (b + b)) * ((b & 88) & (b ^ q));
+  for(i = 0; i < 29; i++){
+    d = ((c | a) | (p * b)) & ((b | p) | (c - d));
+  }
+  a = ((d - c) | (a + d)) + ((d * 24) - (c * d));
+  d = ((b - b) - (b ^ p)) + ((b * 17) & (b - a));
+  if(c < q){
+    d = ((q | c) ^ (b + b)) ^ ((a - a) & (c & b));
+  }else{
+    a = ((d | a) | (p - a)) | ((b ^ q) | (b & 97));
+  }
+  d = ((b | c) - (q + a)) + ((d - 85) & (q * 97));
+  a = ((b * 45) ^ (d + p)) & ((c - d) & (c ^ c));
+  b = ((a * a) - (b & b)) * ((b ^ a) ^ (b + 67));
+  for(i = 0; i < 34; i++){
+    c = ((a | q) - (b & 32)) & ((a * 36) & (q | 95));
+  }
+  if(d < d){
+    c = ((p * b) | (a + b)) - ((q ^ d) + (c ^ p));
+  }else{
+    c = ((d + p) + (c * q)) + ((a ^ d) ^ (c - q));
+  }
+  b = ((a ^ b) ^ (a - 45)) & ((d + c) | (d | q));
+  d = ((b - q) * (c ^ q)) + ((d - b) | (a ^ a));
+  d = ((b * 6) - (p - 26)) * ((a & 12) + (b ^ c));
+  c = ((b + d) + (d & 98)) * ((c - a) - (q - b));
+  if(d < a){
+    a = ((q | b) + (a + 48)) | ((a | d) + (b & 8));
+  }else{
+    a = ((a - 88) ^ (b | p)) - ((q * c) | (q * 82));
+  }
+  for(i = 0; i < 17; i++){
+    c = ((a | a) ^ (p ^ p)) - ((a | 99) & (p & 97));
+  }
+  a = ((d - d) - (d | q)) | ((p * 26) | (c ^ q));
+  d = ((d * a) + (q | 10)) ^ ((p & 11) - (q - 93));
+  b = ((p & b) | (p - d)) + ((a ^ c) & (a - a));
+  if(a < a){
+    c = ((p - c) & (c * p)) & ((a * 37) + (d | p));
+  }else{
+    d = ((c * q) * (c | c)) + ((d | 49) + (b & c));
+  }
+  b = ((b & 17) * (q * 47)) - ((d - 69) * (q | p));
+  a = ((d | a) * (c ^ b)) - ((b * b) + (q * q));
+  for(i = 0; i < 23; i++){
+    c = ((b + d) + (a + c)) * ((p * c) ^ (d + 52));
+  }
+  b = ((a ^ a) + (p ^ b)) & ((b * 37) * (c ^ p));
+  if(d < 19){
+    c = ((d | a) & (a + 93)) * ((d | d) * (c - b));
+  }else{
+    d = ((b + 14) + (d - d)) - ((p ^ b) + (b & p));
+  }
+  b = ((c | c) * (c ^ a)) | ((c + q) * (c + c));
+  c = ((d * q) & (d | 67)) * ((b + a) + (d & d));
+  d = ((b ^ d) ^ (c + c)) + ((c & b) + (c | a));
+  c = ((c + c) | (d * 85)) | ((b ^ d) ^ (d + 21));
+  if(b < c){
+    b = ((b - 50) | (c + 82)) & ((c & p) - (d ^ p));
+  }else{
+    d = ((p - 37) | (d + a)) | ((c - d) ^ (p + p));
+  }
+  b = ((q ^ b) * (d + 54)) + ((c + b) - (q * p));
+  d = ((b - b) + (d | c)) * ((c & b) ^ (q + 88));
+  c = ((b | p) | (a ^ a)) | ((d | c) * (b & a));
+  c = ((a & 20) - (c + 19)) + ((c + b) | (a * p));
+  if(a < 15){
+    c = ((b ^ p) - (p - 51)) & ((d * p) * (p - d));
+  }else{
+    b = ((c | a) ^ (b & b)) - ((a - d) | (q + p));
+  }
+  b = ((c | 65) + (p + d)) + ((q * q) - (b & 40));
+  for(i = 0; i < 26; i++){
+    b = ((c - q) | (d & p)) & ((d * c) + (d - q));
+  }
+  b = ((q ^ p) | (b & 60)) * ((c | c) | (d | d));
+  d = ((b ^ c) * (d | q)) & ((q - c) + (c & d));
+  if(d < p){
+    a = ((a | 96) * (b ^ 18)) - ((q + 59) * (q | c));
+  }else{
+    a = ((q | q) | (b | a)) - ((q & 1) | (q & 1));
+  }
+  b = ((c - b) | (c * d)) & ((d + d) - (q - q));
+  a = ((d + b) + (q & a)) - ((b ^ 63) ^ (c - 31));
+  a = ((p | q) | (c + 54)) * ((p | 57) ^ (a ^ p));
+  for(i = 0; i < 37; i++){
+    a = ((c * 96) & (a & a)) ^ ((c ^ p) - (c ^ 29));
+  }
+  if(b < q){
+    b = ((q & 69) - (p | c)) * ((q ^ 20) | (q & b));
+  }else{
+    a = ((c + 24) & (d + a)) + ((c ^ a) & (p - 51));
+  }
+  return a + b + c + d;
+}
+
+int func173(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 70;
+  d = 7;
+  a = ((q - a) - (b | 36)) - ((q * q) | (d + p));
+  a = ((q * q) + (p ^ d)) | ((c ^ b) - (q | 66));
+  b = ((a & p) ^ (d - b)) & ((c | c) * (p + p));
+  d = ((a * 95) ^ (c * 20)) ^ ((c ^ 72) - (p * c));
+  if(d < q){
+    a = ((p - q) ^ (q | p)) - ((q ^ p) * (b ^ a));
+  }else{
+    d = ((b & c) + (c & 30)) | ((p | 75) + (c + 70));
+  }
+  c = ((c * p) ^ (b | b)) * ((q | p) | (d | q));
+  for(i = 0; i < 2; i++){
+    a = ((c & q) ^ (b + d)) & ((b & d) + (b | 52));
+  }
+  d = ((q & 17) | (p | 11)) + ((a | q) ^ (b + 97));
+  c = ((c & p) * (b + d)) & ((p * 83) | (q & 37));
+  if(b < q){
+    d = ((a & 85) + (q | 5)) | ((a | c) * (q + d));
+  }else{
+    d = ((b - c) * (c ^ c)) + ((p ^ p) & (b | c));
+  }
+  b = ((p | c) ^ (c + a)) - ((c ^ q) ^ (a & a));
+  b = ((d & c) & (a | a)) + ((a & d) | (p & 71));
+  d = ((d - 30) & (p * 72)) * ((p & 95) ^ (c & a));
+  for(i = 0; i < 46; i++){
+    d = ((d - a) & (a * p)) | ((b ^ p) - (q ^ p));
+  }
+  if(d < d){
+    c = ((q ^ d) - (c | a)) * ((d & a) + (a * b));
+  }else{
+    b = ((q + d) * (a ^ p)) - ((d ^ 6) * (a - a));
+  }
+  c = ((c + 83) + (b - 39)) + ((b * d) & (p & 82));
+  a = ((b | c) ^ (p ^ a)) - ((d - d) | (p ^ a));
+  d = ((p & 25) ^ (a ^ b)) ^ ((d & c) & (c | p));
+  a = ((q & a) & (b ^ a)) - ((q & d) | (p + d));
+  if(d < a){
+    c = ((p ^ c) ^ (c * p)) - ((p & b) * (b * c));
+  }else{
+    a = ((q ^ c) + (c - a)) + ((a + 52) | (q & a));
+  }
+  for(i = 0; i < 40; i++){
+    a = ((p & d) - (a & d)) ^ ((d * 96) & (a - q));
+  }
+  b = ((d ^ c) ^ (a + 72)) - ((q - b) + (d * c));
+  d = ((p - p) - (b | 51)) * ((a - b) ^ (c + 48));
+  b = ((a | c) - (a ^ d)) ^ ((p ^ b) & (d + d));
+  if(b < p){
+    a = ((a & c) | (d - b)) | ((c * 17) * (a & c));
+  }else{
+    c = ((q & 53) * (b - d)) * ((p ^ d) ^ (q | a));
+  }
+  c = ((a + a) * (d * a)) * ((d & 62) + (b + c));
+  a = ((p & b) | (a * p)) * ((b - a) * (p & c));
+  for(i = 0; i < 44; i++){
+    c = ((a - p) & (d ^ 4)) | ((q - a) * (b * a));
+  }
+  b = ((c - q) & (b - p)) | ((b & 39) ^ (a * b));
+  if(d < a){
+    b = ((p & q) & (d ^ p)) | ((q | a) ^ (p + 85));
+  }else{
+    c = ((p | 78) & (c * 76)) + ((b * c) | (p & 42));
+  }
+  b = ((b - b) & (d | q)) * ((q ^ 46) * (b | 32));
+  c = ((d | 92) & (b - q)) ^ ((p - d) | (d - a));
+  c = ((a ^ p) & (c + d)) ^ ((q + 88) + (d ^ q));
+  a = ((q ^ d) & (c & d)) ^ ((a - d) ^ (b - 59));
+  if(b < 10){
+    c = ((p * 55) + (c ^ q)) - ((a & 49) + (q ^ d));
+  }else{
+    a = ((d * 45) + (p * a)) & ((q + 29) ^ (a + a));
+  }
+  a = ((d - d) | (q + q)) | ((q + p) & (d + c));
+  b = ((a * d) | (c - 11)) ^ ((q | b) * (c + a));
+  c = ((a + c) - (a - 50)) & ((a | d) - (c + 30));
+  c = ((q ^ p) * (b & b)) & ((d | p) - (b & a));
+  if(b < p){
+    b = ((q ^ b) - (a * a)) ^ ((c + b) - (p * p));
+  }else{
+    d = ((d + c) - (c ^ 31)) & ((a + b) & (b ^ 41));
+  }
+  c = ((b & b) * (a ^ q)) * ((q & 55) & (q - b));
+  for(i = 0; i < 4; i++){
+    c = ((a ^ c) | (p & a)) + ((b ^ d) ^ (d ^ 79));
+  }
+  c = ((c + 50) ^ (d & d)) | ((c + d) + (c & b));
+  d = ((b ^ b) - (c & 67)) | ((a ^ p) | (q | c));
+  if(a < a){
+    c = ((q - 42) - (d * a)) - ((c & 51) + (p | c));
+  }else{
+    a = ((c & d) + (a + d)) * ((p | 67) * (d ^ c));
+  }
+  d = ((a + 60) * (d ^ a)) + ((d ^ 97) - (q - d));
+  a = ((c + 55) ^ (p - 33)) ^ ((p & 32) + (b * q));
+  b = ((p * q) & (p - p)) - ((a ^ 34) & (c - p));
+  for(i = 0; i < 49; i++){
+    b = ((a - a) * (d | d)) | ((c | p) - (d + 79));
+  }
+  if(a < 79){
+    a = ((b ^ p) ^ (q - q)) + ((q + d) * (b + 87));
+  }else{
+    d = ((q * 20) | (b * p)) & ((d + d) - (q - b));
+  }
+  return a + b + c + d;
+}
+
+int func174(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 93;
+  d = 54;
+  a = ((b * b) & (d & b)) - ((q - c) * (c | d));
+  d = ((c + q) - (d - q)) & ((p - a) * (a ^ q));
+  b = ((d | 39) ^ (c - a)) & ((c | b) & (b | 23));
+  b = ((a + a) + (b - 87)) ^ ((a * a) ^ (c * p));
+  if(c < q){
+    a = ((b ^ 33) ^ (b - a)) * ((q | b) & (a + 48));
+  }else{
+    d = ((a + p) * (q + 40)) - ((d - q) & (a | q));
+  }
+  d = ((c ^ d) | (d | c)) ^ ((a | q) & (a & d));
+  for(i = 0; i < 14; i++){
+    d = ((q + d) | (a & d)) & ((p * p) & (b + b));
+  }
+  a = ((a | a) * (a & q)) & ((b & b) ^ (b + q));
+  d = ((p & c) + (p - 99)) - ((b + a) * (a + 32));
+  if(a < q){
+    c = ((d & c) ^ (q & 75)) ^ ((a - q) - (b | 67));
+  }else{
+    d = ((b * b) & (p + a)) + ((b - p) ^ (b & p));
+  }
+  d = ((p & c) + (a | p)) - ((p | q) - (q ^ 99));
+  a = ((d | p) + (q - 73)) | ((a - p) | (d ^ a));
+  b = ((q | d) & (p | b)) & ((q + a) ^ (a + 41));
+  for(i = 0; i < 15; i++){
+    b = ((a - b) | (p * p)) ^ ((d & p) | (d + p));
+  }
+  if(d < 14){
+    d = ((q + q) | (d + 58)) * ((p * b) | (c + q));
+  }else{
+    a = ((p + a) + (p ^ 73)) * ((c & 60) * (a & q));
+  }
+  a = ((d + q) * (q ^ 6)) ^ ((d + d) + (b ^ q));
+  d = ((q + p) + (q * c)) | ((d + 25) - (a * q));
+  a = ((p & a) * (a - 46)) & ((d + d) | (q | 56));
+  d = ((p & q) | (b ^ q)) & ((q - p) | (a - p));
+  if(d < c){
+    d = ((d + c) ^ (p & d)) & ((c * q) | (p | 83));
+  }else{
+    a = ((d * 27) + (c & p)) - ((d & 35) ^ (q ^ p));
+  }
+  for(i = 0; i < 43; i++){
+    a = ((b * 72) * (b | c)) | ((c - 53) ^ (d * d));
+  }
+  a = ((a + 75) | (p * d)) ^ ((p - b) & (q + d));
+  c = ((b * q) - (d + q)) * ((p | 35) - (p - 37));
+  d = ((c | a) & (d * b)) & ((p | p) + (q & a));
+  if(b < b){
+    b = ((b + a) | (d * 2)) * ((a ^ 68) ^ (a | 1));
+  }else{
+    d = ((q ^ 67) - (a * p)) | ((p + b) & (d - c));
+  }
+  c = ((q ^ a) + (a * 81)) | ((d + 68) ^ (p - 57));
+  c = ((p + a) + (a ^ q)) + ((c | 12) * (p + p));
+  for(i = 0; i < 24; i++){
+    b = ((a * b) & (d | 52)) & ((q | q) & (a | c));
+  }
+  a = ((q & d) + (c ^ a)) & ((a ^ c) + (b * c));
+  if(c < p){
+    b = ((q & p) ^ (c & b)) - ((c * d) ^ (b | p));
+  }else{
+    c = ((q ^ b) - (d - d)) & ((a ^ d) | (b ^ d));
+  }
+  d = ((a | b) + (c | c)) ^ ((a ^ b) * (b * c));
+  d = ((a & b) | (a ^ d)) ^ ((c - 6) ^ (p | p));
+  a = ((q - 96) - (c | 1)) & ((d * p) | (b | 11));
+  c = ((d + 18) + (b * 85)) ^ ((p ^ 72) ^ (d ^ d));
+  if(c < 17){
+    b = ((c - c) | (d + p)) - ((p * q) - (p - d));
+  }else{
+    c = ((d ^ 40) * (a | b)) | ((b + d) + (b | 16));
+  }
+  d = ((c - b) & (a ^ p)) & ((p - p) ^ (d & c));
+  b = ((c ^ 13) * (c | p)) + ((q | 52) & (p + b));
+  b = ((b + 78) & (p | d)) * ((a ^ b) | (c + q));
+  a = ((a | q) | (p ^ q)) | ((d ^ 98) & (b - q));
+  if(c < q){
+    c = ((a ^ p) ^ (d + 49)) ^ ((c * 87) | (p - b));
+  }else{
+    d = ((c - 28) + (c - p)) * ((b | d) | (c & c));
+  }
+  a = ((q | d) + (q - 44)) - ((b + c) & (a + 49));
+  for(i = 0; i < 50; i++){
+    a = ((p & 80) - (c + d)) - ((q & 62) - (d + a));
+  }
+  a = ((a | 77) + (b + 70)) & ((p & 28) ^ (d & 36));
+  c = ((a & p) | (c ^ p)) * ((b + c) - (a + 40));
+  if(d < 88){
+    d = ((b | q) + (p * q)) | ((a - d) & (q * a));
+  }else{
+    a = ((b ^ d) * (c & q)) + ((q + d) * (c ^ b));
+  }
+  d = ((p * p) ^ (a * p)) - ((a + c) - (q | b));
+  d = ((c ^ a) & (q + d)) & ((c & a) ^ (d * b));
+  d = ((b * a) ^ (b + 31)) ^ ((p * 1) - (c + a));
+  for(i = 0; i < 24; i++){
+    a = ((q - a) - (q ^ p)) - ((q | 66) ^ (q ^ d));
+  }
+  if(d < b){
+    c = ((d + q) - (a - a)) - ((c | 40) | (d * 4));
+  }else{
+    b = ((d & b) | (b * q)) | ((c & 34) - (c - p));
+  }
+  return a + b + c + d;
+}
+
+int func175(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 66;
+  d = 48;
+  b = ((d + p) ^ (p ^ a)) + ((a + 57) + (q & d));
+  b = ((a + 34) & (q ^ c)) | ((a - d) | (p ^ p));
+  a = ((c * b) & (c ^ d)) - ((d - b) | (d | 6));
+  b = ((c | a) - (a & c)) * ((b | c) * (c | c));
+  if(d < d){
+    a = ((b + q) ^ (q ^ a)) + ((q + 37) * (q ^ d));
+  }else{
+    c = ((p & q) ^ (q & a)) + ((q + a) * (b * a));
+  }
+  c = ((c + a) | (q - 12)) & ((b & d) ^ (b - p));
+  for(i = 0; i < 3; i++){
+    c = ((b | 55) ^ (p | d)) ^ ((p | b) | (d ^ 82));
+  }
+  d = ((q + d) - (q + d)) & ((c + 7) - (p | b));
+  d = ((p * a) & (q - d)) + ((q | p) ^ (q * a));
+  if(d < a){
+    d = ((q - b) ^ (d - 24)) - ((p ^ a) & (d | 33));
+  }else{
+    c = ((a - a) - (d & b)) - ((b + a) - (b & p));
+  }
+  d = ((p - c) * (q ^ 87)) - ((d & d) ^ (b - p));
+  d = ((b ^ q) ^ (p * q)) | ((c | p) & (p - p));
+  c = ((a & a) | (q * 58)) | ((q ^ 10) - (p & a));
+  for(i = 0; i < 23; i++){
+    a = ((b + 47) & (q | a)) & ((b - q) - (q + 34));
+  }
+  if(a < q){
+    c = ((q | 5) - (p & d)) & ((c - a) - (a + q));
+  }else{
+    b = ((a - 86) - (c * q)) & ((b ^ a) | (p ^ c));
+  }
+  d = ((c - p) * (a * b)) * ((q ^ c) & (b - d));
+  d = ((c & c) + (a - b)) | ((a - d) | (a - d));
+  c = ((a | q) + (p ^ q)) & ((c ^ p) + (a + q));
+  a = ((q - 18) | (q | p)) ^ ((b & a) & (d ^ q));
+  if(c < c){
+    d = ((q | b) * (q * b)) | ((q * c) - (d * d));
+  }else{
+    d = ((b & a) ^ (p - b)) - ((c + p) & (c - b));
+  }
+  for(i = 0; i < 11; i++){
+    a = ((p | q) & (b ^ 87)) ^ ((a + a) & (b ^ d));
+  }
+  c = ((b + a) + (b & q)) + ((p - d) | (a + q));
+  d = ((a - 18) & (b | 19)) ^ ((d ^ q) + (a * d));
+  a = ((b * d) & (a & b)) ^ ((a & c) & (p - p));
+  if(a < p){
+    a = ((d | 8) + (d ^ c)) + ((c | b) & (c - 58));
+  }else{
+    d = ((p | 93) + (b & 6)) + ((b + 65) * (d & d));
+  }
+  b = ((a * q) ^ (q | b)) ^ ((b & c) ^ (q & d));
+  a = ((p * q) + (d | q)) * ((q ^ 94) ^ (c - q));
+  for(i = 0; i < 8; i++){
+    c = ((d & q) * (q & q)) * ((c - 18) & (b + c));
+  }
+  d = ((c - c) - (p | a)) ^ ((c - 46) & (c + q));
+  if(c < a){
+    d = ((d ^ c) | (d ^ p)) | ((b ^ 96) - (b - 32));
+  }else{
+    a = ((d + p) + (a - d)) ^ ((c + c) + (b * p));
+  }
+  c = ((d - c) * (c - c)) - ((a & q) + (p & q));
+  b = ((p ^ q) & (d & 21)) | ((c | b) ^ (b * c));
+  b = ((c | b) & (a | b)) + ((q ^ p) + (c + a));
+  b = ((b & 1) ^ (b ^ 44)) ^ ((a * p) | (p & a));
+  if(c < 3){
+    a = ((d + 23) ^ (a * 38)) | ((d ^ 94) ^ (d * d));
+  }else{
+    c = ((a - c) * (d + b)) | ((d + b) + (b | p));
+  }
+  a = ((c + a) * (c | c)) ^ ((a + a) + (a & b));
+  b = ((q * 46) - (p * q)) + ((q + q) & (c ^ c));
+  a = ((p - c) | (c - b)) * ((c ^ q) * (a | d));
+  a = ((q | a) * (a * b)) & ((q | p) ^ (d & b));
+  if(b < c){
+    b = ((p & q) ^ (d + q)) + ((c ^ 57) | (b * p));
+  }else{
+    b = ((a | a) & (b + 17)) + ((q - 23) - (q | c));
+  }
+  a = ((p & b) & (b * a)) - ((p | q) + (c * d));
+  for(i = 0; i < 26; i++){
+    a = ((q | 30) | (p * 34)) | ((d ^ 60) - (b * 19));
+  }
+  b = ((p | p) & (q - q)) | ((b & q) + (b - b));
+  a = ((c + q) + (q + a)) + ((q + c) | (q & c));
+  if(a < d){
+    d = ((p + c) & (q - 58)) & ((b & 70) + (d * 6));
+  }else{
+    c = ((b * 16) - (d ^ q)) * ((p & a) * (d - q));
+  }
+  c = ((b ^ 84) ^ (c * 63)) & ((b * b) + (b * 72));
+  b = ((b & c) - (d * d)) ^ ((d - c) & (d & a));
+  d = ((d ^ 98) ^ (d | 80)) & ((c * d) + (p - q));
+  for(i = 0; i < 19; i++){
+    c = ((b + p) & (d * p)) | ((p & a) ^ (q | p));
+  }
+  if(d < a){
+    c = ((q | p) + (c + 91)) ^ ((p ^ b) + (q & c));
+  }else{
+    c = ((p * a) * (b & d)) | ((p | d) ^ (b | b));
+  }
+  return a + b + c + d;
+}
+
+int func176(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 63;
+  d = 17;
+  a = ((d & p) * (d | a)) ^ ((b | p) - (c & q));
+  b = ((d | b) | (b + d)) ^ ((b + 66) & (p * a));
+  d = ((q & p) | (q + p)) + ((b * 95) + (a + a));
+  b = ((b ^ a) ^ (b * b)) * ((q & d) & (b - b));
+  if(a < 67){
+    b = ((b - 81) - (d & b)) * ((c * d) + (q + a));
+  }else{
+    b = ((q * 61) - (a - a)) & ((d ^ d) + (d ^ q));
+  }
+  c = ((p - d) ^ (c * a)) ^ ((p * c) + (d | 14));
+  for(i = 0; i < 4; i++){
+    b = ((q | q) * (d & 29)) + ((b ^ d) - (b + q));
+  }
+  b = ((c ^ q) * (q & 4)) & ((a | a) | (d ^ q));
+  c = ((c ^ p) * (d + p)) - ((q | q) + (a - 65));
+  if(c < p){
+    a = ((q - c) ^ (c * q)) ^ ((c - d) | (b * d));
+  }else{
+    b = ((c + p) ^ (d + 51)) ^ ((b * 62) & (d + c));
+  }
+  c = ((p + a) | (p + 62)) | ((b - p) ^ (p - d));
+  b = ((d & b) * (a + 16)) * ((c * q) - (c * c));
+  c = ((c & 83) | (b * b)) | ((q | q) + (b & q));
+  for(i = 0; i < 20; i++){
+    a = ((p + q) ^ (d ^ a)) + ((c | p) | (c - q));
+  }
+  if(b < d){
+    d = ((b | b) + (q * a)) - ((a - a) * (b & 41));
+  }else{
+    b = ((q * q) * (c + a)) | ((q + 66) | (b ^ b));
+  }
+  d = ((a + c) - (q ^ a)) + ((c - 5) & (a ^ c));
+  b = ((a * p) & (b | 26)) | ((a - c) & (q - d));
+  d = ((c ^ p) - (a * c)) ^ ((b * c) | (d & c));
+  b = ((a - p) * (c | a)) + ((q & c) & (d * p));
+  if(d < 41){
+    a = ((p ^ d) ^ (b * 4)) | ((b - 50) - (b & 3));
+  }else{
+    b = ((p & c) & (b * p)) ^ ((q * p) * (b | 42));
+  }
+  for(i = 0; i < 38; i++){
+    c = ((c ^ p) & (p & c)) + ((b * c) | (b ^ b));
+  }
+  c = ((q & a) + (c | 54)) + ((a * b) * (a & b));
+  d = ((d ^ 51) - (q & a)) * ((b * d) - (c ^ 35));
+  a = ((q + a) + (c - p)) - ((c * d) | (q | b));
+  if(c < c){
+    b = ((p ^ p) ^ (b * d)) & ((b ^ 86) ^ (b | 69));
+  }else{
+    a = ((p - d) - (q * 43)) ^ ((d + 49) | (q & c));
+  }
+  b = ((p ^ 81) & (d - 98)) * ((d - 91) + (c + q));
+  d = ((p - c) | (p & p)) | ((p | 79) - (d - 80));
+  for(i = 0; i < 47; i++){
+    b = ((b ^ p) | (c & c)) - ((q * d) & (a ^ b));
+  }
+  b = ((c ^ d) - (d + c)) * ((c - c) & (q ^ p));
+  if(b < p){
+    a = ((d & p) - (c | c)) + ((a * a) ^ (b * a));
+  }else{
+    d = ((p ^ d) & (b & 30)) ^ ((c | q) + (p * 20));
+  }
+  b = ((a ^ p) + (q - d)) & ((d + d) ^ (a | 1));
+  d = ((a * c) * (b * c)) + ((a | p) * (p - q));
+  c = ((p ^ 94) + (q * d)) ^ ((d ^ d) & (q * c));
+  a = ((b ^ d) - (p * d)) - ((a ^ 1) - (d - c));
+  if(c < 79){
+    d = ((a + 90) - (p * p)) ^ ((c | d) - (a * q));
+  }else{
+    a = ((d & p) ^ (d - p)) | ((a * c) * (b + 73));
+  }
+  c = ((a * 25) + (p - q)) & ((b - d) - (p + d));
+  d = ((c - c) + (p - d)) * ((p ^ d) ^ (d ^ 86));
+  a = ((b | p) ^ (d & 50)) ^ ((p * d) * (p - 63));
+  a = ((b | d) * (c * b)) + ((a * b) - (a - q));
+  if(b < p){
+    b = ((b + c) * (q ^ 43)) - ((b * a) | (a + c));
+  }else{
+    b = ((b ^ p) - (d * c)) ^ ((p | p) - (p - d));
+  }
+  c = ((d & p) & (a ^ p)) | ((p + 36) | (c - q));
+  for(i = 0; i < 17; i++){
+    a = ((q * a) + (b & 39)) - ((c + 26) | (p ^ p));
+  }
+  b = ((a + 44) | (q - 17)) + ((c | 39) | (c - 3));
+  c = ((c - p) | (q & a)) + ((q + a) & (d * 72));
+  if(c < 49){
+    d = ((p + p) + (c & d)) - ((d ^ p) | (b | 60));
+  }else{
+    d = ((a + d) & (p * q)) ^ ((c | q) - (c - 94));
+  }
+  d = ((d * 52) - (c - d)) * ((a ^ b) - (q + 55));
+  a = ((b * a) + (a - a)) - ((d * q) ^ (p ^ 44));
+  d = ((q ^ c) - (a & 63)) & ((a + a) | (b | b));
+  for(i = 0; i < 28; i++){
+    d = ((b * p) | (d & d)) | ((q ^ p) - (p + d));
+  }
+  if(b < 94){
+    d = ((q * p) ^ (p * 65)) & ((c - 52) * (d & 3));
+  }else{
+    a = ((p ^ a) | (p ^ 12)) * ((q + q) & (p - b));
+  }
+  return a + b + c + d;
+}
+
+int func177(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 88;
+  d = 21;
+  c = ((a ^ c) | (d - 90)) | ((d ^ q) ^ (q ^ q));
+  b = ((c & d) & (a + b)) & ((c ^ p) & (q | b));
+  b = ((c | c) - (p & p)) - ((p + 89) | (d | b));
+  c = ((p | 62) | (b * a)) & ((d ^ p) - (a + 55));
+  if(b < 15){
+    b = ((q & q) * (d ^ a)) ^ ((c ^ q) ^ (p - 28));
+  }else{
+    a = ((a | 15) + (c + b)) - ((q ^ p) ^ (q & b));
+  }
+  a = ((c | b) * (b + q)) + ((b & 85) ^ (p - 79));
+  for(i = 0; i < 20; i++){
+    d = ((q & 39) ^ (a * b)) & ((d + c) + (d ^ 68));
+  }
+  d = ((q - a) * (a & p)) * ((b + b) ^ (q | 73));
+  c = ((b & a) | (b ^ a)) + ((q & 29) + (q | d));
+  if(d < c){
+    a = ((p - b) | (q & b)) - ((q * 71) - (d + 83));
+  }else{
+    a = ((p * c) & (q | 25)) * ((q | a) ^ (d + 69));
+  }
+  a = ((a ^ a) ^ (a + a)) * ((c * b) ^ (a * b));
+  d = ((q ^ b) * (a & b)) + ((c + b) | (a & p));
+  b = ((c | 5) & (q & c)) + ((q + b) * (q | b));
+  for(i = 0; i < 7; i++){
+    a = ((c | d) * (c * q)) * ((d ^ d) & (a - 5));
+  }
+  if(b < q){
+    a = ((b & q) & (p * p)) * ((a * 76) * (q | p));
+  }else{
+    c = ((p ^ 13) & (c * q)) * ((p & c) - (d ^ 97));
+  }
+  d = ((a * q) - (d + p)) | ((q * p) + (p + p));
+  d = ((p ^ q) + (a | p)) * ((q + b) - (d | a));
+  d = ((q * p) ^ (p & 16)) + ((b + 70) - (b - 10));
+  c = ((p * a) & (q - d)) ^ ((q + d) - (d & d));
+  if(c < b){
+    c = ((p * p) - (q + q)) * ((q | b) * (d | 8));
+  }else{
+    a = ((c + q) | (p - 24)) - ((q | 85) ^ (a - 24));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((b & q) * (q + d)) - ((q & 68) & (b - d));
+  }
+  b = ((b & 24) ^ (a | b)) - ((a | q) + (p & a));
+  c = ((b ^ b) - (p + c)) | ((q + d) - (c ^ a));
+  b = ((p & a) | (q & 19)) + ((q - q) | (d | a));
+  if(c < d){
+    c = ((a & a) * (p - 29)) - ((d * 82) * (q | q));
+  }else{
+    b = ((a - b) & (d * c)) * ((b ^ c) * (c * q));
+  }
+  d = ((d - a) + (c & d)) & ((b - c) ^ (b & d));
+  d = ((q ^ c) + (d * c)) + ((p ^ c) | (a ^ d));
+  for(i = 0; i < 40; i++){
+    b = ((c ^ b) + (d | 5)) - ((p * c) * (c & b));
+  }
+  b = ((b ^ d) - (a | q)) | ((q * 9) - (c & 72));
+  if(b < q){
+    d = ((a + 15) - (c & q)) ^ ((b - b) | (a ^ c));
+  }else{
+    d = ((p & p) * (d | p)) + ((a + p) | (b + p));
+  }
+  a = ((b & c) & (b - c)) | ((q & b) * (c & a));
+  c = ((d + p) & (p | p)) - ((d - a) ^ (d & 39));
+  b = ((a * p) + (a - 90)) | ((q ^ d) - (b * 85));
+  c = ((a & 18) ^ (b ^ c)) * ((q + 18) - (d + a));
+  if(a < 21){
+    d = ((d & b) - (c + p)) | ((a + 22) ^ (c ^ 43));
+  }else{
+    d = ((b * p) | (c ^ d)) + ((c | d) ^ (b + p));
+  }
+  b = ((p & 26) | (a - b)) & ((c * c) ^ (q | 88));
+  c = ((c + a) * (c ^ b)) ^ ((c & b) - (p ^ q));
+  d = ((d * p) | (q - b)) | ((p ^ q) + (a * d));
+  d = ((a + b) * (a | p)) | ((d + a) - (d * b));
+  if(b < a){
+    a = ((p | d) - (c - a)) + ((b | c) | (a | 37));
+  }else{
+    d = ((c & 29) + (c & d)) | ((p & c) | (c - 57));
+  }
+  a = ((b & p) & (c + q)) - ((q + b) & (p * d));
+  for(i = 0; i < 18; i++){
+    c = ((a + a) - (a | c)) | ((p | a) ^ (b - q));
+  }
+  a = ((c + a) * (b + b)) & ((d ^ p) * (q - 66));
+  a = ((d + c) | (p + q)) - ((b | p) & (c - 23));
+  if(d < b){
+    d = ((d + a) ^ (b - 69)) * ((q ^ a) | (a - a));
+  }else{
+    b = ((b - b) - (b * p)) | ((q ^ 59) + (d | c));
+  }
+  a = ((q + d) + (q & q)) - ((b | d) | (c & b));
+  b = ((a | 29) & (p - 20)) | ((p & 84) * (q * p));
+  c = ((q * 55) - (p | b)) | ((p ^ d) * (p | 23));
+  for(i = 0; i < 20; i++){
+    d = ((b * b) & (d + q)) & ((c | 3) | (b * q));
+  }
+  if(c < q){
+    b = ((a & a) ^ (q * q)) - ((q - q) ^ (a ^ p));
+  }else{
+    c = ((d - a) * (b & 31)) ^ ((a * c) | (q ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func178(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 46;
+  d = 1;
+  c = ((p * 30) * (a | a)) & ((d + a) & (q | 81));
+  c = ((p & c) & (a - 50)) | ((q ^ a) | (a + p));
+  c = ((c & q) | (b | b)) + ((d | c) & (p | 19));
+  d = ((a ^ 34) & (c & q)) + ((b - d) & (b + 53));
+  if(a < 12){
+    d = ((b + 84) * (c | d)) ^ ((a + 99) | (b * b));
+  }else{
+    b = ((d ^ b) ^ (b ^ a)) ^ ((d * q) * (c - p));
+  }
+  d = ((c + 44) ^ (b * b)) - ((b | 34) + (q | 4));
+  for(i = 0; i < 7; i++){
+    d = ((q | b) & (c & q)) * ((q ^ a) ^ (c - 68));
+  }
+  c = ((c - d) | (a | c)) ^ ((b - b) ^ (p * 92));
+  d = ((b & d) ^ (c & q)) - ((c & b) & (d ^ d));
+  if(a < p){
+    c = ((c ^ a) ^ (b & b)) + ((q - 22) ^ (q * p));
+  }else{
+    a = ((q * b) - (d * a)) ^ ((c | p) & (b ^ d));
+  }
+  c = ((p & d) | (a ^ 93)) - ((a | 2) - (q + 25));
+  d = ((q - 69) & (q * d)) - ((b - q) ^ (b - b));
+  a = ((b + p) & (a * d)) | ((a + q) | (a + 61));
+  for(i = 0; i < 25; i++){
+    b = ((c - b) + (p | p)) | ((d | b) + (b + p));
+  }
+  if(b < 39){
+    b = ((p ^ c) | (a * a)) + ((b & 63) | (d | 8));
+  }else{
+    d = ((c & p) * (d & q)) & ((c * b) ^ (p | p));
+  }
+  a = ((q ^ 20) - (p | q)) & ((b + a) * (p - a));
+  b = ((d + b) ^ (p + b)) + ((c * d) * (p * a));
+  c = ((a * q) * (d ^ p)) + ((d & c) & (q | c));
+  c = ((p - p) - (b * q)) + ((d + c) * (b ^ q));
+  if(b < q){
+    b = ((b * p) - (d + 84)) ^ ((c ^ b) - (b + d));
+  }else{
+    a = ((d * b) ^ (b + 66)) + ((q ^ d) - (c | q));
+  }
+  for(i = 0; i < 24; i++){
+    a = ((a ^ q) + (b * a)) ^ ((a & p) | (p * b));
+  }
+  b = ((c ^ b) + (a ^ a)) & ((b | b) * (b ^ q));
+  d = ((p & d) | (d * d)) - ((p * p) * (b | d));
+  d = ((q - 10) & (a | b)) | ((a - b) | (q | c));
+  if(a < b){
+    b = ((q * 50) & (b | b)) | ((p ^ d) ^ (b - d));
+  }else{
+    c = ((a * p) & (d - p)) * ((c ^ q) + (b ^ b));
+  }
+  d = ((q & 96) ^ (b ^ c)) - ((p & q) * (q & c));
+  b = ((c | q) | (a | c)) & ((c - 95) * (p * 54));
+  for(i = 0; i < 28; i++){
+    b = ((c * 47) ^ (c | c)) ^ ((d & d) + (p | 32));
+  }
+  d = ((d & 32) & (p & a)) & ((a ^ d) + (a - b));
+  if(d < 55){
+    b = ((a * c) - (a - a)) * ((p | a) * (a | q));
+  }else{
+    c = ((d + q) - (b * d)) - ((p * b) + (q & b));
+  }
+  a = ((a | p) | (b - 50)) | ((p - 19) ^ (p ^ q));
+  b = ((a * q) + (a * 19)) & ((c + q) & (q + 12));
+  c = ((d + b) & (p | q)) + ((p & 47) ^ (q | b));
+  a = ((a * b) + (d & 83)) | ((q ^ q) - (a + p));
+  if(a < 73){
+    b = ((a | a) | (b * c)) * ((b + 73) * (p ^ c));
+  }else{
+    d = ((q + b) | (d * p)) + ((b | b) * (q | b));
+  }
+  d = ((b ^ b) - (c * 84)) * ((c * d) | (c ^ d));
+  b = ((q | 21) | (a | 16)) - ((q * p) | (q - d));
+  a = ((b ^ b) * (p * c)) | ((a * d) ^ (p * c));
+  b = ((q | a) | (d | d)) + ((q & p) ^ (p | b));
+  if(a < 11){
+    d = ((q | p) | (q ^ c)) * ((a * q) * (q | c));
+  }else{
+    a = ((d ^ q) ^ (a ^ a)) ^ ((c - q) + (p & d));
+  }
+  d = ((c ^ p) ^ (a & b)) + ((b - p) * (a | d));
+  for(i = 0; i < 24; i++){
+    d = ((a * 32) | (a | a)) + ((b * a) ^ (p & b));
+  }
+  c = ((p * 68) * (q * a)) ^ ((p & q) ^ (d * d));
+  c = ((b - p) & (c * p)) - ((b | q) & (a + 34));
+  if(b < 64){
+    c = ((c ^ d) + (c & q)) | ((d ^ b) * (q + b));
+  }else{
+    c = ((a ^ q) ^ (p & p)) | ((b + 86) ^ (p - p));
+  }
+  a = ((b ^ q) + (a ^ 49)) | ((q + c) * (a ^ d));
+  a = ((d - p) & (a | q)) ^ ((c - b) + (p | p));
+  a = ((d | 64) & (a + p)) & ((a ^ d) | (p * 2));
+  for(i = 0; i < 13; i++){
+    c = ((d * b) - (d & q)) | ((a | c) | (q & 88));
+  }
+  if(d < p){
+    a = ((c & 62) ^ (c | c)) ^ ((p - a) & (b * 4));
+  }else{
+    d = ((q + a) * (c * d)) & ((b | c) | (p - c));
+  }
+  return a + b + c + d;
+}
+
+int func179(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 6;
+  d = 90;
+  a = ((a * d) ^ (b - d)) - ((q + d) | (b ^ b));
+  a = ((q - a) - (b | 15)) - ((b - b) + (p | a));
+  b = ((c + 21) * (c * a)) ^ ((c + a) + (b & b));
+  c = ((b - q) ^ (c ^ b)) * ((c * d) & (b & q));
+  if(b < a){
+    a = ((q + b) & (b ^ b)) & ((b + a) ^ (a ^ p));
+  }else{
+    c = ((c ^ b) | (p & q)) & ((b ^ p) | (c ^ 2));
+  }
+  a = ((p + d) | (q - 40)) - ((b - b) + (p - b));
+  for(i = 0; i < 38; i++){
+    d = ((p - b) - (p ^ d)) * ((q ^ q) - (d ^ d));
+  }
+  d = ((c * 52) | (a * p)) + ((b & d) & (p ^ q));
+  c = ((d - q) & (a | q)) & ((q | p) * (p - 67));
+  if(a < 12){
+    c = ((b * b) & (b * a)) - ((d - c) + (d - p));
+  }else{
+    a = ((c - 58) - (d - p)) + ((a ^ p) + (p + q));
+  }
+  b = ((b - d) ^ (a ^ a)) - ((b & d) * (p - 88));
+  d = ((p + p) * (p * q)) ^ ((c & 66) | (d & 89));
+  a = ((c * 81) + (b ^ d)) - ((c * q) & (c * a));
+  for(i = 0; i < 19; i++){
+    b = ((a * a) ^ (c & 38)) * ((d ^ c) ^ (q - c));
+  }
+  if(c < b){
+    b = ((b & 30) - (a * 30)) - ((d - a) - (p * q));
+  }else{
+    d = ((a ^ p) ^ (q - b)) * ((d + p) * (a | c));
+  }
+  c = ((a * 24) ^ (p + d)) + ((q | 55) + (d + a));
+  c = ((q + 7) | (p & 84)) | ((q + a) * (a - c));
+  b = ((b - q) * (a - p)) ^ ((b ^ b) * (p ^ 3));
+  b = ((d * d) | (c | b)) - ((q + p) ^ (p - a));
+  if(b < 25){
+    b = ((d ^ 11) & (d + d)) + ((a + p) - (c - 7));
+  }else{
+    a = ((c & d) & (a & b)) | ((c | q) * (b + b));
+  }
+  for(i = 0; i < 6; i++){
+    d = ((b ^ a) * (b * 32)) ^ ((p + c) + (d & 32));
+  }
+  a = ((q + 49) & (c ^ b)) & ((c | 64) * (p & p));
+  c = ((q | b) * (p + b)) ^ ((a ^ b) & (q * b));
+  a = ((d - p) - (q - q)) - ((d | p) - (p & d));
+  if(b < b){
+    b = ((q & a) | (a ^ d)) ^ ((q & c) | (c + d));
+  }else{
+    b = ((b + 95) | (q & d)) * ((c & p) * (b & 75));
+  }
+  c = ((d - 44) - (c ^ b)) ^ ((p * 10) & (p | 62));
+  a = ((q & a) | (a ^ q)) | ((d & q) + (b & d));
+  for(i = 0; i < 21; i++){
+    b = ((q - 45) + (b ^ 14)) ^ ((d + b) + (c - b));
+  }
+  a = ((p * 24) | (b - d)) | ((d + p) | (a | d));
+  if(b < b){
+    b = ((p - a) ^ (b + p)) - ((a - c) * (p | b));
+  }else{
+    d = ((c & d) + (p - d)) ^ ((p | c) - (q & b));
+  }
+  d = ((c + 28) & (p + q)) + ((q | a) - (p ^ p));
+  c = ((p & a) + (a & p)) ^ ((a & b) & (q & 28));
+  a = ((d | c) & (p + 51)) - ((p + c) | (a * 32));
+  d = ((c + d) & (q & 52)) * ((d ^ b) * (p - 43));
+  if(d < c){
+    a = ((c & c) - (p ^ b)) & ((d * d) * (q & 2));
+  }else{
+    c = ((c | p) * (c + c)) ^ ((p & d) & (b & d));
+  }
+  d = ((q * b) + (d * 93)) * ((p * 83) * (q * 64));
+  a = ((b - 28) * (q - 45)) * ((c ^ q) * (c | q));
+  d = ((c & q) * (d - p)) ^ ((c - 38) ^ (c & q));
+  c = ((q + p) ^ (p | 96)) * ((d ^ c) & (d - d));
+  if(b < 21){
+    a = ((a ^ c) + (d - q)) ^ ((a + d) + (c + p));
+  }else{
+    c = ((c - q) & (c | p)) & ((b * p) | (p * d));
+  }
+  d = ((b + c) ^ (b + b)) - ((b + c) ^ (a * p));
+  for(i = 0; i < 2; i++){
+    a = ((q - a) ^ (d + d)) - ((d + c) | (b | c));
+  }
+  c = ((d * p) - (d & 71)) - ((q ^ 74) & (b * c));
+  c = ((c + 18) & (a ^ c)) * ((q - q) * (a ^ q));
+  if(c < q){
+    d = ((p - a) ^ (p - d)) & ((p | d) * (c + 78));
+  }else{
+    b = ((d + q) + (q * q)) ^ ((q ^ 15) - (b + a));
+  }
+  a = ((a ^ d) | (a - d)) ^ ((q - p) ^ (d * 17));
+  b = ((p * 79) + (p ^ a)) - ((c - p) + (b + 73));
+  d = ((b * a) + (b & c)) + ((a * d) - (a & q));
+  for(i = 0; i < 40; i++){
+    a = ((p | 37) ^ (p - c)) * ((p + b) ^ (q ^ q));
+  }
+  if(c < a){
+    c = ((q ^ q) ^ (a | b)) - ((a ^ b) | (d ^ q));
+  }else{
+    b = ((b | b) ^ (d + 85)) ^ ((p & b) + (q & c));
+  }
+  return a + b + c + d;
+}
+
+int func180(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 79;
+  d = 61;
+  c = ((b ^ 85) + (q + c)) ^ ((c ^ q) & (a - c));
+  c = ((c & d) - (d | c)) & ((q ^ q) * (c ^ 37));
+  c = ((a ^ 13) - (d & d)) * ((p * a) ^ (c ^ b));
+  a = ((q - d) ^ (b + 82)) & ((a * q) | (c & p));
+  if(a < a){
+    a = ((c * c) * (p | d)) & ((q | c) ^ (q + a));
+  }else{
+    c = ((d + p) - (p ^ a)) ^ ((c * p) - (p * 44));
+  }
+  a = ((p | p) * (d & c)) * ((c - a) * (d | p));
+  for(i = 0; i < 27; i++){
+    c = ((b & d) + (p & d)) * ((c + q) + (a & c));
+  }
+  d = ((c + c) - (p - q)) | ((b & p) ^ (q + c));
+  b = ((c & p) ^ (d * 62)) - ((b * a) * (p + a));
+  if(b < a){
+    c = ((p | 54) | (d - b)) * ((p * d) - (d - q));
+  }else{
+    d = ((p * a) | (a * q)) - ((c - b) + (c & 89));
+  }
+  b = ((d | q) | (b - c)) - ((p ^ d) + (p + q));
+  b = ((c * b) - (c | 2)) & ((p ^ p) + (b - 61));
+  a = ((a | c) ^ (q ^ a)) | ((b + b) - (p ^ 30));
+  for(i = 0; i < 35; i++){
+    d = ((a ^ b) * (c & a)) & ((p ^ q) - (b ^ b));
+  }
+  if(b < q){
+    d = ((a & a) - (b * a)) + ((c - c) | (c | b));
+  }else{
+    c = ((q + 48) ^ (p ^ c)) & ((b & 90) ^ (q | 62));
+  }
+  a = ((d * d) & (q & a)) * ((a | a) + (b - d));
+  d = ((p + p) ^ (c | c)) & ((p ^ d) - (d | b));
+  a = ((d & d) + (q | 30)) & ((d & c) ^ (c & b));
+  c = ((a - p) ^ (c & q)) & ((p | 24) & (a + d));
+  if(a < q){
+    b = ((d * q) & (d ^ d)) | ((c - b) ^ (c - c));
+  }else{
+    d = ((a * d) ^ (p & c)) + ((b | c) ^ (p * d));
+  }
+  for(i = 0; i < 7; i++){
+    d = ((a + 87) & (b - a)) + ((a ^ c) ^ (q * c));
+  }
+  b = ((c + p) | (a ^ q)) | ((b | 40) + (p + a));
+  c = ((p | 46) | (p - 8)) ^ ((c * b) + (a - 55));
+  a = ((c & q) ^ (d | 96)) & ((c & d) | (a + 72));
+  if(b < p){
+    a = ((c + c) * (b ^ p)) - ((a ^ p) | (b | 11));
+  }else{
+    d = ((a - q) - (p ^ c)) * ((q ^ a) & (b - c));
+  }
+  b = ((p * 98) & (d * d)) + ((b | p) ^ (c - c));
+  a = ((q * q) * (q ^ p)) - ((d | 96) | (p * p));
+  for(i = 0; i < 38; i++){
+    a = ((c + d) | (a + c)) + ((a ^ 5) + (a * c));
+  }
+  c = ((c + d) + (p ^ 32)) + ((b * b) - (b * 18));
+  if(b < 8){
+    d = ((p & 53) ^ (a ^ 26)) - ((b | b) & (d - p));
+  }else{
+    b = ((q + a) | (d | b)) | ((c ^ a) ^ (q ^ b));
+  }
+  c = ((a ^ a) ^ (b ^ c)) | ((c + b) + (p & c));
+  d = ((b ^ 61) & (q + b)) + ((c - a) & (a + 82));
+  d = ((d | p) - (p | p)) | ((b | c) ^ (c * q));
+  b = ((a * b) | (d | q)) + ((b * c) - (c & q));
+  if(a < b){
+    b = ((b * a) + (p - c)) + ((c ^ 17) - (q * c));
+  }else{
+    b = ((c | p) - (c - q)) - ((d | b) & (b - 50));
+  }
+  d = ((b - 77) ^ (d | 38)) + ((c ^ p) ^ (c & d));
+  a = ((c ^ p) ^ (d * 53)) * ((p & c) - (c | p));
+  a = ((q * 62) - (b & 66)) ^ ((c ^ p) * (q + 7));
+  c = ((q - a) - (a & b)) | ((d & d) ^ (a | p));
+  if(d < 34){
+    a = ((c * d) ^ (q | b)) * ((q * 93) + (d + b));
+  }else{
+    b = ((q & p) | (d - b)) * ((d ^ c) ^ (q | 83));
+  }
+  c = ((a & d) ^ (c & p)) * ((a | d) | (b + 4));
+  for(i = 0; i < 44; i++){
+    a = ((p - c) | (p * p)) + ((p + d) + (q | 11));
+  }
+  b = ((a + d) ^ (d ^ p)) + ((b - a) * (b | c));
+  a = ((p + 26) | (d + p)) - ((d - 84) - (q | 45));
+  if(a < b){
+    b = ((q - b) | (a | b)) * ((q + p) + (q - q));
+  }else{
+    b = ((q ^ p) * (b * c)) * ((b * 44) & (b - p));
+  }
+  a = ((c * 46) ^ (d * 97)) + ((d | d) & (a | c));
+  c = ((p * d) | (a ^ d)) | ((q | p) - (q & 95));
+  b = ((d & 20) | (a * b)) & ((c ^ b) + (d ^ 17));
+  for(i = 0; i < 2; i++){
+    c = ((p + c) * (b & b)) & ((p * b) & (c - d));
+  }
+  if(b < a){
+    b = ((b | q) | (q ^ 51)) & ((b - p) * (d | d));
+  }else{
+    c = ((b ^ p) & (c + d)) * ((c | c) + (d ^ 90));
+  }
+  return a + b + c + d;
+}
+
+int func181(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 6;
+  d = 50;
+  c = ((d | a) ^ (p ^ q)) * ((q - p) ^ (a * 78));
+  a = ((d + b) * (q ^ a)) + ((c ^ 83) ^ (b ^ p));
+  a = ((c | b) - (b ^ q)) * ((d - d) + (d & 19));
+  c = ((b - a) + (q - d)) & ((d - c) & (a | c));
+  if(d < 15){
+    a = ((p ^ b) ^ (b - c)) - ((a * b) + (a | a));
+  }else{
+    a = ((p & 93) & (a + a)) ^ ((q | q) * (p - a));
+  }
+  a = ((a + 33) & (b * a)) + ((p - b) & (q ^ 84));
+  for(i = 0; i < 31; i++){
+    d = ((p ^ 9) * (q | q)) * ((p * q) + (a ^ b));
+  }
+  a = ((q - q) & (d ^ d)) + ((q - 10) & (p & 44));
+  a = ((c | p) - (a | a)) + ((p ^ p) | (q & q));
+  if(a < 54){
+    b = ((p ^ d) & (p | c)) * ((b ^ 98) | (c | b));
+  }else{
+    c = ((a + 15) ^ (b | b)) & ((b | 17) ^ (p - b));
+  }
+  b = ((c + c) | (d * p)) ^ ((p | b) * (q + c));
+  c = ((p + 94) | (b + 75)) & ((q & b) - (q ^ b));
+  c = ((p | a) ^ (a - 40)) & ((d | d) - (c & b));
+  for(i = 0; i < 18; i++){
+    a = ((a * d) * (p * q)) ^ ((d | d) | (p + 10));
+  }
+  if(a < c){
+    a = ((d ^ b) + (q ^ c)) | ((p | d) * (b - c));
+  }else{
+    d = ((b & b) - (c ^ p)) * ((c + a) - (a * c));
+  }
+  c = ((p & q) - (c - c)) ^ ((q - a) + (d & a));
+  b = ((d & b) ^ (b * q)) - ((c + a) - (c * q));
+  a = ((c * q) ^ (q - 29)) & ((q | a) ^ (b ^ p));
+  d = ((c | 10) & (p & 9)) + ((q + b) | (d & p));
+  if(a < b){
+    a = ((b ^ 24) + (p & p)) & ((q & 6) | (b - 22));
+  }else{
+    b = ((d * q) | (c * q)) | ((d * q) ^ (q * 31));
+  }
+  for(i = 0; i < 41; i++){
+    c = ((p ^ 89) & (a - c)) - ((c - p) * (q ^ p));
+  }
+  d = ((d * b) & (a - q)) ^ ((p * b) - (q * a));
+  d = ((b + q) | (d + b)) | ((c & q) + (b & 93));
+  d = ((q ^ q) & (d & q)) + ((p & b) ^ (d + b));
+  if(b < 45){
+    b = ((q ^ q) - (c ^ q)) & ((p ^ c) - (a & c));
+  }else{
+    d = ((b ^ p) ^ (a | 87)) | ((c - q) | (q & c));
+  }
+  b = ((p - 7) * (b * q)) | ((p - b) - (b & c));
+  c = ((p & 20) | (c - q)) ^ ((b + a) ^ (b * c));
+  for(i = 0; i < 45; i++){
+    c = ((c - c) * (q | a)) ^ ((q - p) + (p & 19));
+  }
+  c = ((p + 63) * (c * b)) | ((p | d) * (c - d));
+  if(b < p){
+    b = ((b * 14) & (p & a)) & ((p + a) + (d | d));
+  }else{
+    d = ((q & b) & (b & a)) | ((p | q) & (d + 59));
+  }
+  d = ((c | d) & (p & q)) * ((d + 78) ^ (d | d));
+  a = ((c * c) - (q - 82)) * ((b ^ d) + (d * d));
+  b = ((a | d) | (b * d)) - ((a * a) + (q | 44));
+  b = ((d - a) * (p & 60)) ^ ((a * 47) - (p | a));
+  if(d < q){
+    a = ((a - b) & (a + 48)) & ((b + c) + (b ^ 67));
+  }else{
+    b = ((d * 65) ^ (d - p)) - ((d + 52) & (q - q));
+  }
+  b = ((q * c) - (q | p)) + ((c - p) - (d * 31));
+  a = ((a | b) ^ (q * c)) ^ ((c + 12) & (c - b));
+  d = ((a | 71) ^ (q & 13)) | ((p | 9) * (c * p));
+  d = ((p - d) - (a ^ a)) * ((a + 33) ^ (a | 86));
+  if(d < b){
+    c = ((p ^ 27) | (p * q)) - ((q + q) * (c & a));
+  }else{
+    c = ((c - p) ^ (q - q)) ^ ((d ^ p) * (d - c));
+  }
+  a = ((c - 27) - (a | 69)) | ((c - 64) & (p ^ d));
+  for(i = 0; i < 2; i++){
+    d = ((p + 2) & (p & b)) + ((a + c) | (a & p));
+  }
+  b = ((q - b) | (q ^ q)) + ((q | a) | (p ^ 2));
+  d = ((d * a) + (b ^ d)) + ((c + 25) | (b * d));
+  if(d < p){
+    c = ((d - p) - (c * b)) & ((a ^ q) & (p - c));
+  }else{
+    a = ((d * c) - (q - p)) ^ ((c | q) + (p - 55));
+  }
+  a = ((d - a) * (b * a)) | ((p ^ d) | (p & p));
+  c = ((a & q) + (q + a)) ^ ((b * q) - (q + b));
+  a = ((a * d) + (p - b)) * ((b + c) & (d & 74));
+  for(i = 0; i < 42; i++){
+    d = ((q * a) & (a | c)) ^ ((a | c) - (a ^ c));
+  }
+  if(d < d){
+    c = ((d + q) * (d ^ c)) + ((d | 46) | (d + c));
+  }else{
+    d = ((p - q) | (a & p)) - ((b | 42) + (b & c));
+  }
+  return a + b + c + d;
+}
+
+int func182(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 96;
+  d = 87;
+  d = ((b - d) | (a - c)) - ((c & 98) + (d | b));
+  b = ((q * 81) & (p - d)) | ((a + a) * (q * d));
+  d = ((b | 43) + (q * b)) ^ ((b | d) ^ (p * b));
+  d = ((p * d) | (p & 20)) - ((d & a) ^ (b * a));
+  if(a < 68){
+    d = ((a & c) ^ (b & c)) + ((a - p) & (c | q));
+  }else{
+    b = ((p ^ b) ^ (d - p)) * ((d * c) ^ (p & c));
+  }
+  a = ((p - d) ^ (a - a)) * ((d * q) * (a | 62));
+  for(i = 0; i < 15; i++){
+    b = ((p & 62) - (p | 33)) & ((a - q) + (p - 16));
+  }
+  a = ((q | d) - (d * p)) - ((q | p) - (p + a));
+  a = ((b * d) + (d - a)) + ((p - 74) ^ (p & a));
+  if(c < 60){
+    a = ((a & c) ^ (p + 78)) + ((c | q) + (p + b));
+  }else{
+    c = ((d | c) | (b - 2)) ^ ((b * 23) - (d | b));
+  }
+  c = ((a & b) - (c + a)) | ((q * d) ^ (q | 88));
+  a = ((q - 2) | (p * 59)) ^ ((a ^ 75) ^ (d & 76));
+  d = ((q + p) & (q + b)) * ((p & q) + (b ^ p));
+  for(i = 0; i < 2; i++){
+    a = ((b + 11) & (a & 55)) & ((q + 50) * (p * p));
+  }
+  if(a < b){
+    d = ((c - d) ^ (b ^ a)) + ((a & b) ^ (b * b));
+  }else{
+    a = ((b + 35) | (a * d)) & ((c * p) - (d & q));
+  }
+  c = ((d + p) | (p & d)) + ((b + b) & (p ^ b));
+  d = ((b + c) + (a + a)) - ((q + a) ^ (p & p));
+  b = ((p & a) ^ (p + b)) - ((b & d) * (b * c));
+  c = ((d | d) | (c - 26)) + ((q & d) & (b & q));
+  if(d < q){
+    b = ((p * b) ^ (q ^ d)) - ((b * b) ^ (b & 58));
+  }else{
+    b = ((c * q) ^ (p - q)) & ((b ^ 65) * (b - 68));
+  }
+  for(i = 0; i < 48; i++){
+    a = ((q ^ d) | (q | 30)) | ((c * d) | (d - b));
+  }
+  a = ((q + p) * (d - 3)) & ((q + q) ^ (c + 48));
+  d = ((q ^ 11) | (p - p)) | ((q + 2) & (d ^ q));
+  a = ((p * b) & (p & q)) * ((c * p) ^ (c - b));
+  if(a < b){
+    b = ((a + 90) - (c - b)) - ((d * p) ^ (b | 17));
+  }else{
+    a = ((b & d) - (c & 11)) * ((d | d) * (a + p));
+  }
+  a = ((p | q) ^ (a ^ 83)) * ((a & 96) & (a * p));
+  b = ((c ^ 21) | (a & c)) & ((p ^ 45) - (p | 91));
+  for(i = 0; i < 20; i++){
+    d = ((b * b) & (d & c)) * ((b & c) ^ (q - p));
+  }
+  c = ((p - d) & (p - b)) ^ ((q - b) - (p ^ p));
+  if(c < p){
+    c = ((d & 56) | (d + 67)) - ((b - a) | (a | c));
+  }else{
+    b = ((p * 65) - (c ^ b)) | ((c * q) - (q * p));
+  }
+  c = ((d ^ 35) | (c + d)) | ((p ^ d) & (a | p));
+  c = ((c + d) + (a - b)) & ((d ^ d) & (d | b));
+  a = ((c & p) ^ (b ^ c)) & ((d * a) & (d & q));
+  b = ((b | 49) ^ (b & a)) | ((c ^ q) & (q & 20));
+  if(b < q){
+    a = ((b + q) + (a - 7)) | ((d & q) ^ (d + q));
+  }else{
+    b = ((p ^ d) | (q - q)) * ((a | a) + (d + p));
+  }
+  d = ((d - p) - (c * 30)) * ((q - q) - (a & p));
+  c = ((b * 27) - (c ^ d)) ^ ((b * 5) - (q - c));
+  d = ((q + a) | (b + 45)) | ((c + d) - (q * q));
+  c = ((a | 28) * (d | a)) | ((c - c) & (q + d));
+  if(a < b){
+    a = ((q - b) | (p | c)) & ((a | c) | (c | b));
+  }else{
+    c = ((d + p) + (a | 18)) * ((c + 18) * (p * p));
+  }
+  c = ((b - c) | (c ^ a)) ^ ((b - p) + (d | p));
+  for(i = 0; i < 3; i++){
+    b = ((q + c) - (q ^ p)) + ((a + d) & (b | b));
+  }
+  c = ((b | q) ^ (c * q)) * ((c - b) | (c | c));
+  a = ((d & 30) * (c ^ 10)) + ((d & a) - (q | d));
+  if(c < a){
+    b = ((b + 87) * (b | 82)) | ((b + p) - (q + q));
+  }else{
+    b = ((c + a) + (p + p)) & ((a + d) ^ (c - p));
+  }
+  d = ((p * q) * (d - b)) - ((a ^ a) - (p + d));
+  d = ((d ^ 31) * (p & a)) * ((q + 43) ^ (b | 71));
+  b = ((b & c) * (d ^ q)) & ((q + d) - (q - a));
+  for(i = 0; i < 41; i++){
+    c = ((d * p) & (q + c)) * ((c & d) & (b & a));
+  }
+  if(c < p){
+    c = ((q + 50) * (b - q)) - ((b - q) * (p ^ 94));
+  }else{
+    d = ((q - a) * (q - c)) * ((q | b) * (d + q));
+  }
+  return a + b + c + d;
+}
+
+int func183(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 8;
+  d = 90;
+  b = ((b | c) | (b & c)) - ((p ^ d) ^ (c & c));
+  a = ((c - 48) - (q * q)) + ((a * 18) & (d + a));
+  b = ((a & 96) - (c - c)) & ((p & q) ^ (p & d));
+  a = ((a & 90) * (a + c)) ^ ((a - 62) ^ (q * c));
+  if(c < q){
+    b = ((c + 46) * (b - q)) | ((b + c) - (b * d));
+  }else{
+    b = ((q | p) + (q ^ b)) ^ ((q | b) * (q * p));
+  }
+  b = ((b & 27) & (a ^ p)) | ((d + b) * (d ^ p));
+  for(i = 0; i < 26; i++){
+    a = ((c & c) * (p * d)) ^ ((d * a) & (a * p));
+  }
+  d = ((a & d) ^ (d + a)) ^ ((c ^ b) * (b - 33));
+  c = ((p * d) - (a * a)) | ((a + q) - (d ^ c));
+  if(c < q){
+    b = ((c + q) | (a | d)) & ((a ^ b) + (q ^ 91));
+  }else{
+    c = ((b * 75) * (p * q)) | ((b & d) * (p ^ d));
+  }
+  c = ((d & a) - (d | d)) + ((d | p) | (b & b));
+  d = ((c & c) * (b * a)) * ((q - d) - (c & d));
+  b = ((a - d) + (d * 71)) | ((p + a) + (d & d));
+  for(i = 0; i < 36; i++){
+    c = ((d & c) * (p + q)) + ((p - 61) + (c + c));
+  }
+  if(c < p){
+    a = ((a - 45) + (d | 17)) - ((a | p) - (b * c));
+  }else{
+    a = ((b | 64) & (q | p)) * ((c & d) * (p & q));
+  }
+  b = ((c & d) & (c ^ 29)) ^ ((b - 55) | (a * q));
+  a = ((p ^ a) & (d + c)) * ((p & d) * (p & c));
+  c = ((c + d) & (c ^ p)) ^ ((c ^ c) - (c * 48));
+  d = ((b & 81) - (a | c)) * ((a & b) - (a * 71));
+  if(c < d){
+    c = ((c * 87) - (b ^ b)) * ((b * 12) * (q ^ d));
+  }else{
+    d = ((d * a) + (d & b)) - ((c + c) + (b - p));
+  }
+  for(i = 0; i < 16; i++){
+    c = ((p | q) | (a + 78)) | ((d ^ d) - (a + a));
+  }
+  c = ((b & 94) - (a ^ b)) - ((b ^ p) & (b & b));
+  d = ((b | a) | (p & d)) & ((c * d) ^ (q ^ b));
+  c = ((c & 28) - (a | p)) | ((a * p) - (p & b));
+  if(c < d){
+    c = ((a * b) & (p | b)) & ((q & a) + (a | 94));
+  }else{
+    c = ((d + c) * (p - d)) - ((p * q) ^ (d ^ b));
+  }
+  a = ((d & 66) - (p * a)) * ((q + b) - (b * 69));
+  d = ((b - p) * (p + p)) + ((b & d) + (p + 51));
+  for(i = 0; i < 17; i++){
+    b = ((d + 13) & (c - b)) + ((d + 46) - (q * 67));
+  }
+  d = ((q - q) & (d ^ a)) - ((c + a) + (d + q));
+  if(b < p){
+    a = ((a - 36) & (b ^ p)) + ((a ^ p) & (d - p));
+  }else{
+    b = ((b & a) + (q ^ q)) & ((d ^ a) | (b & q));
+  }
+  b = ((c & c) | (c ^ 54)) & ((b | 75) & (b - q));
+  b = ((a | c) ^ (d * a)) + ((b - p) - (q & b));
+  c = ((c & q) * (q * p)) & ((d | a) - (p ^ 76));
+  d = ((d & d) - (c + p)) ^ ((q * 86) & (q | d));
+  if(d < c){
+    d = ((b & b) * (a + d)) + ((c ^ 80) - (q & b));
+  }else{
+    c = ((q & 94) | (p ^ 47)) & ((q * b) & (a | 58));
+  }
+  a = ((a - 76) | (b + 9)) + ((c - b) - (d | b));
+  d = ((b ^ 93) ^ (a * p)) - ((a * 27) + (b & d));
+  a = ((d - d) + (p ^ d)) ^ ((d & b) ^ (d - d));
+  a = ((c | b) ^ (d * 39)) + ((c + c) - (d & q));
+  if(b < d){
+    a = ((b & c) & (a - p)) + ((c - q) + (b | a));
+  }else{
+    a = ((q - 43) & (a & p)) & ((a + c) ^ (b * 51));
+  }
+  c = ((a ^ q) + (d + a)) & ((c ^ b) + (d + c));
+  for(i = 0; i < 40; i++){
+    a = ((a | q) & (q ^ c)) - ((d + 49) ^ (a + a));
+  }
+  b = ((b & a) ^ (b & b)) * ((d - d) & (d ^ q));
+  b = ((p * b) * (b - a)) * ((d * 60) & (a & b));
+  if(d < 70){
+    b = ((q - b) & (b & c)) + ((a + a) | (b + a));
+  }else{
+    c = ((c | c) ^ (a * p)) ^ ((b - a) * (p * p));
+  }
+  c = ((d ^ b) & (c | q)) * ((a | a) - (d + d));
+  d = ((a & c) - (b - 92)) - ((q & 16) * (c | d));
+  a = ((b ^ b) + (d ^ d)) - ((c & b) + (p | q));
+  for(i = 0; i < 18; i++){
+    d = ((q & d) - (p * a)) | ((d ^ c) * (d - p));
+  }
+  if(c < c){
+    a = ((d & b) * (q + b)) - ((c - q) + (d - 24));
+  }else{
+    d = ((c ^ 80) & (a | b)) + ((c + q) * (d | p));
+  }
+  return a + b + c + d;
+}
+
+int func184(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 57;
+  d = 78;
+  a = ((b | a) - (c * c)) ^ ((b - 64) ^ (p ^ c));
+  a = ((q & a) - (q | d)) ^ ((b & b) * (p & b));
+  a = ((b & p) & (q - q)) ^ ((a + q) * (q + 59));
+  c = ((a + d) & (c & q)) + ((b ^ q) + (c + a));
+  if(b < b){
+    c = ((c - q) ^ (p ^ a)) | ((b - q) & (c + c));
+  }else{
+    d = ((a * q) - (p - c)) + ((q - 10) | (q & 81));
+  }
+  d = ((c ^ b) + (b | p)) | ((b & 2) - (b & q));
+  for(i = 0; i < 11; i++){
+    b = ((d ^ b) * (q & b)) & ((p | d) & (a & d));
+  }
+  d = ((c | p) * (b + d)) + ((q & a) + (p + 55));
+  c = ((c - b) & (b & 62)) + ((q * q) | (q * 30));
+  if(c < 27){
+    d = ((b * 94) + (c ^ b)) - ((b ^ b) - (b & 65));
+  }else{
+    b = ((q | 68) * (b ^ 96)) - ((d - q) + (q * p));
+  }
+  a = ((p + d) * (b + q)) - ((q + c) ^ (b & a));
+  a = ((p ^ 40) & (q - a)) - ((c * d) + (c - c));
+  a = ((a & q) & (c | 20)) | ((b & 53) * (p | b));
+  for(i = 0; i < 36; i++){
+    c = ((q | 50) + (b - 80)) ^ ((b | 91) * (q & b));
+  }
+  if(b < p){
+    c = ((c ^ c) & (a & 35)) ^ ((b | 38) & (q & 41));
+  }else{
+    a = ((b - 64) * (b | a)) | ((d - p) & (q & q));
+  }
+  b = ((p - a) * (c + c)) | ((q | p) - (a | p));
+  d = ((q & c) - (a + b)) * ((b | q) * (d - c));
+  b = ((b | p) & (a ^ b)) ^ ((a ^ q) - (c ^ c));
+  a = ((q - c) & (q - c)) ^ ((a & 84) ^ (p & 57));
+  if(d < 68){
+    d = ((a ^ 98) | (a - a)) * ((p | a) + (c ^ 73));
+  }else{
+    d = ((q - p) - (a ^ d)) + ((a | c) ^ (d + 24));
+  }
+  for(i = 0; i < 37; i++){
+    b = ((c - c) ^ (b | a)) + ((p | q) | (c * c));
+  }
+  b = ((p * q) * (a * b)) | ((b | a) & (b | 16));
+  a = ((q | a) ^ (q - p)) & ((d & d) * (b - c));
+  d = ((a | 42) & (a & p)) ^ ((b & 25) * (d | q));
+  if(b < d){
+    c = ((a & d) + (p * q)) + ((b + d) ^ (a * q));
+  }else{
+    c = ((p + c) | (p | 45)) | ((q * b) & (a + c));
+  }
+  b = ((a + p) & (c ^ c)) + ((b - d) | (b & p));
+  d = ((d - p) | (c * q)) * ((p * d) + (a & c));
+  for(i = 0; i < 15; i++){
+    c = ((c * c) ^ (q ^ 65)) ^ ((a - p) & (p & a));
+  }
+  c = ((p * p) * (b * 62)) ^ ((b - a) & (c + a));
+  if(c < c){
+    d = ((c * c) ^ (q * b)) - ((b - 81) - (d ^ d));
+  }else{
+    c = ((p - b) & (c - a)) ^ ((b & 29) * (d + c));
+  }
+  b = ((a - 95) - (c - c)) ^ ((d ^ 97) | (p + q));
+  c = ((q ^ b) ^ (a * a)) & ((c + p) * (c + c));
+  a = ((b * a) ^ (c * b)) + ((c + a) + (b ^ p));
+  b = ((a ^ d) & (p - q)) - ((b | 35) | (a | p));
+  if(b < p){
+    d = ((p - a) * (a | c)) + ((c - p) * (p & 44));
+  }else{
+    c = ((p * 50) - (d * a)) + ((p & 44) & (a - a));
+  }
+  c = ((a & 6) | (q & a)) | ((p - d) * (p & b));
+  b = ((q & p) * (c ^ b)) | ((b | p) & (d - p));
+  a = ((c * q) + (b ^ 76)) ^ ((d + c) * (c - 45));
+  a = ((a - q) * (d ^ a)) & ((b & d) - (p + a));
+  if(a < 31){
+    d = ((b ^ a) + (d & 29)) | ((a | a) - (p + p));
+  }else{
+    b = ((c ^ b) | (q | d)) - ((b - a) + (d | 61));
+  }
+  a = ((a ^ q) - (b * a)) * ((q & d) ^ (q & 40));
+  for(i = 0; i < 22; i++){
+    c = ((p | 21) ^ (d | 99)) | ((a + 36) ^ (c ^ p));
+  }
+  a = ((c & 39) - (d | p)) * ((b - p) | (b | b));
+  c = ((c & 84) - (a - 20)) ^ ((c - p) - (p - a));
+  if(c < a){
+    a = ((q & p) - (c | 83)) | ((a + q) - (d - d));
+  }else{
+    c = ((b + c) | (q * a)) + ((d | q) & (c ^ 92));
+  }
+  c = ((a - b) | (q * c)) - ((d + a) + (p | 73));
+  b = ((p * d) - (a & 10)) + ((b | c) & (q * 69));
+  d = ((b * a) - (p | 77)) | ((c * p) | (p - 56));
+  for(i = 0; i < 27; i++){
+    d = ((c + 87) ^ (p * b)) | ((b & b) * (a ^ a));
+  }
+  if(c < d){
+    d = ((c & a) ^ (q & 41)) - ((c - a) ^ (a * p));
+  }else{
+    d = ((d + d) | (p | c)) - ((a + 70) - (d & 79));
+  }
+  return a + b + c + d;
+}
+
+int func185(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 21;
+  d = 1;
+  b = ((p & a) & (b & p)) - ((q * d) ^ (a | 65));
+  a = ((c ^ q) + (p - q)) + ((d | c) + (a & 17));
+  d = ((c + c) * (p + 44)) ^ ((d & p) - (b - c));
+  b = ((q * q) ^ (q - 65)) | ((b - c) * (d + q));
+  if(a < 53){
+    a = ((b | d) * (p & c)) & ((p ^ 57) & (b * b));
+  }else{
+    c = ((d + p) & (q & a)) * ((d ^ p) - (p * a));
+  }
+  d = ((c + d) ^ (a | 75)) - ((a | b) + (c ^ 45));
+  for(i = 0; i < 3; i++){
+    d = ((c | a) & (c - p)) * ((d | 51) * (a & 95));
+  }
+  c = ((q - 45) * (b - c)) | ((p - q) ^ (a + c));
+  c = ((b + p) ^ (a + a)) + ((d + 98) + (a & q));
+  if(b < 14){
+    c = ((b + c) + (d | q)) + ((d + 73) * (d & d));
+  }else{
+    c = ((b - d) ^ (d * 5)) + ((b + 10) * (d - a));
+  }
+  c = ((p - a) & (p | c)) | ((p * p) & (p | d));
+  d = ((d & d) ^ (d ^ 7)) - ((q ^ c) & (c ^ b));
+  b = ((a - 6) * (q * a)) - ((q | p) * (b - a));
+  for(i = 0; i < 5; i++){
+    b = ((c & q) + (d * c)) | ((a + a) - (p & 37));
+  }
+  if(c < p){
+    a = ((p ^ c) - (a - p)) | ((p & q) | (c - c));
+  }else{
+    c = ((a + a) + (d ^ 89)) * ((q * b) - (b + p));
+  }
+  b = ((q & d) | (p - a)) & ((d + q) ^ (a | b));
+  c = ((a + c) + (a ^ c)) + ((a * b) | (p * c));
+  d = ((b ^ q) * (p & c)) | ((b ^ 1) * (b & p));
+  b = ((p | 87) - (a + a)) + ((q - p) ^ (a - c));
+  if(b < q){
+    b = ((a - d) + (c ^ b)) & ((q + 19) - (q | a));
+  }else{
+    c = ((c - c) - (q | q)) | ((p * q) + (q * q));
+  }
+  for(i = 0; i < 16; i++){
+    b = ((d + p) - (b * d)) + ((a + a) & (a | 39));
+  }
+  a = ((b - d) * (c & 77)) + ((c & b) | (q & q));
+  a = ((d - c) - (a - 34)) * ((a * b) ^ (q + b));
+  d = ((d & d) & (p ^ d)) * ((a + p) - (p - 67));
+  if(b < d){
+    c = ((p ^ d) | (p ^ 67)) & ((p * p) - (b - 84));
+  }else{
+    c = ((q ^ c) * (c + 25)) | ((a * b) & (d * c));
+  }
+  b = ((c | 44) | (q + b)) & ((a | d) & (q & b));
+  a = ((b + 6) - (q ^ p)) | ((q & p) + (b - q));
+  for(i = 0; i < 31; i++){
+    b = ((q | p) - (p | c)) + ((q - b) ^ (d | 81));
+  }
+  a = ((a * b) | (p & c)) - ((q | p) ^ (c | 80));
+  if(d < c){
+    b = ((d ^ a) ^ (c ^ c)) + ((p - d) & (d & c));
+  }else{
+    a = ((q - d) | (q - b)) & ((c * b) ^ (a & q));
+  }
+  c = ((q + c) ^ (c * a)) + ((b - 2) | (a * 36));
+  a = ((p * b) | (c - d)) * ((p | b) * (d ^ p));
+  a = ((b + b) + (a | d)) - ((b * c) ^ (q ^ a));
+  d = ((a * 59) * (d * q)) + ((p | c) & (c & a));
+  if(b < 64){
+    b = ((d * p) - (b + b)) + ((p + p) ^ (p * b));
+  }else{
+    b = ((d - d) | (b ^ p)) | ((a + p) + (q | a));
+  }
+  b = ((p * p) - (p ^ c)) - ((p ^ 58) ^ (d + a));
+  d = ((c + d) | (d ^ d)) - ((d - 9) * (p + d));
+  c = ((a ^ a) * (q - d)) ^ ((p * q) & (p * d));
+  d = ((d * 18) ^ (p * b)) | ((q ^ 1) & (d | d));
+  if(a < q){
+    c = ((q * d) ^ (c + 95)) | ((b - p) | (a ^ 33));
+  }else{
+    d = ((p & b) & (a + b)) ^ ((p ^ 58) | (c | 87));
+  }
+  d = ((c - 95) | (a * 20)) | ((d + a) + (b * c));
+  for(i = 0; i < 46; i++){
+    d = ((d + d) | (q ^ p)) * ((q + 46) + (q + d));
+  }
+  d = ((a * d) + (c & a)) | ((c & 44) * (d + d));
+  c = ((c & p) & (d * c)) | ((c - 44) | (d * b));
+  if(c < c){
+    a = ((p | 23) | (b & b)) - ((b - p) + (p | 66));
+  }else{
+    a = ((c & 81) | (c | q)) - ((c - 84) ^ (c ^ 24));
+  }
+  c = ((q | q) | (c | b)) - ((b ^ 15) | (a ^ b));
+  d = ((b * d) + (c ^ d)) & ((q ^ c) - (d | d));
+  a = ((b ^ c) - (q & a)) + ((a - a) + (c + d));
+  for(i = 0; i < 47; i++){
+    d = ((b & 89) | (c * a)) & ((b ^ 19) ^ (p & q));
+  }
+  if(b < 78){
+    a = ((d * c) ^ (b * a)) | ((p | p) * (c * 59));
+  }else{
+    d = ((c ^ 26) ^ (p - 50)) - ((a ^ 3) | (q | c));
+  }
+  return a + b + c + d;
+}
+
+int func186(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 90;
+  d = 15;
+  a = ((d + a) + (a + p)) + ((c & d) ^ (b - a));
+  c = ((c | 8) | (d ^ a)) | ((b ^ 68) & (a | 16));
+  a = ((c | a) | (c * q)) + ((a ^ a) * (p * 60));
+  d = ((q ^ b) & (p & d)) & ((d ^ c) ^ (q - p));
+  if(d < p){
+    b = ((b & c) | (c + a)) * ((q ^ 24) & (q ^ c));
+  }else{
+    a = ((p - b) - (c + 86)) * ((a * c) ^ (a + a));
+  }
+  d = ((b | 57) & (a + d)) * ((p * p) ^ (d & p));
+  for(i = 0; i < 20; i++){
+    d = ((b + c) | (d ^ c)) | ((p * 21) & (d | q));
+  }
+  a = ((q | 55) ^ (b - q)) - ((a ^ c) ^ (a - q));
+  b = ((d | q) | (a + c)) + ((c ^ c) - (a | c));
+  if(b < b){
+    b = ((c - p) ^ (q + q)) & ((a | 13) - (d + a));
+  }else{
+    c = ((c * 43) - (q - q)) | ((q | q) * (d ^ a));
+  }
+  b = ((c | a) * (b + p)) ^ ((q + a) & (p - 11));
+  d = ((p & c) + (a & 65)) & ((d | a) * (b | c));
+  b = ((b - c) - (a + 70)) | ((p | 17) | (b ^ a));
+  for(i = 0; i < 29; i++){
+    a = ((p + p) + (b ^ q)) ^ ((d & b) ^ (p | 84));
+  }
+  if(c < a){
+    b = ((c ^ b) + (p ^ a)) * ((a ^ d) & (d & q));
+  }else{
+    b = ((d | d) & (b + d)) & ((a | d) + (q ^ d));
+  }
+  a = ((b & b) | (p * d)) ^ ((q | q) - (q ^ a));
+  b = ((b | a) + (q - b)) - ((a & c) ^ (d * q));
+  c = ((c & c) | (b | q)) | ((d * 64) - (b - d));
+  a = ((b + b) | (a & 61)) + ((d * q) | (a * c));
+  if(b < 23){
+    d = ((d * q) - (d - c)) * ((q * a) ^ (c + c));
+  }else{
+    a = ((c - d) - (d ^ 20)) * ((b * a) & (d | 93));
+  }
+  for(i = 0; i < 41; i++){
+    b = ((b - 45) * (c + d)) ^ ((d - 82) ^ (d | d));
+  }
+  c = ((q - d) * (a * a)) ^ ((c ^ 10) | (c & b));
+  d = ((q + p) * (p * 38)) + ((d & a) ^ (b ^ 1));
+  c = ((b + 94) * (a + c)) & ((p - p) | (q | 49));
+  if(b < q){
+    b = ((q * b) + (c - q)) - ((q * p) ^ (p - p));
+  }else{
+    a = ((d + 12) * (a & q)) ^ ((p ^ d) ^ (q - 22));
+  }
+  a = ((c * p) * (q | q)) + ((c ^ p) ^ (p + c));
+  a = ((q + p) + (c & 38)) - ((p | p) ^ (q & a));
+  for(i = 0; i < 40; i++){
+    b = ((c + 65) | (b + a)) | ((q + a) + (d ^ c));
+  }
+  a = ((b & q) * (q + 55)) | ((p ^ c) + (b ^ p));
+  if(c < 66){
+    a = ((p | a) - (b * a)) ^ ((c * 5) - (b - a));
+  }else{
+    d = ((q + c) + (c - p)) * ((p + 98) - (c | c));
+  }
+  c = ((c + c) | (q + q)) - ((q ^ d) | (b | c));
+  d = ((p | p) | (a | 70)) ^ ((c | a) + (q | 11));
+  d = ((p & q) & (b + q)) * ((a ^ c) | (q * c));
+  a = ((q ^ c) | (p * p)) | ((a * p) - (d ^ 32));
+  if(d < q){
+    c = ((d - c) ^ (p | c)) + ((c * c) | (b + c));
+  }else{
+    a = ((c & q) ^ (p * p)) | ((p - c) + (p ^ c));
+  }
+  b = ((c + 17) - (b & c)) + ((q - p) & (c + 3));
+  a = ((b - b) & (c & 83)) * ((c + p) * (p ^ c));
+  b = ((q ^ b) ^ (c + d)) ^ ((d * a) - (q ^ p));
+  b = ((b | 16) & (p - p)) ^ ((b & a) | (q | c));
+  if(a < p){
+    a = ((d + q) + (a | a)) - ((a * a) + (p - 94));
+  }else{
+    b = ((c + q) - (b & c)) + ((a * b) ^ (a | 81));
+  }
+  c = ((d & 80) - (a * c)) & ((q ^ a) ^ (d | c));
+  for(i = 0; i < 22; i++){
+    d = ((a ^ c) & (q & p)) + ((c ^ b) & (d | q));
+  }
+  c = ((b & a) + (c - b)) | ((p + q) - (q | a));
+  c = ((c - 14) | (p | d)) + ((p | 62) ^ (c + 46));
+  if(d < 67){
+    c = ((b * 86) ^ (p | 64)) & ((d + 83) & (p + q));
+  }else{
+    d = ((q & d) * (p + a)) & ((p * p) | (p | b));
+  }
+  a = ((d & a) * (d ^ c)) ^ ((a * b) ^ (b + 35));
+  d = ((p & 85) + (q + 36)) + ((a * c) & (b * 47));
+  d = ((q ^ q) - (a - d)) - ((a ^ a) & (a * 99));
+  for(i = 0; i < 30; i++){
+    b = ((b * b) * (a & q)) & ((d & a) + (d - q));
+  }
+  if(b < c){
+    c = ((q - a) + (d * q)) & ((p * b) + (p & 65));
+  }else{
+    c = ((c | q) & (p + d)) & ((q ^ b) * (p - c));
+  }
+  return a + b + c + d;
+}
+
+int func187(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 98;
+  d = 26;
+  a = ((p & c) - (d * q)) ^ ((b & a) - (c & p));
+  d = ((a | a) + (d | c)) + ((a + p) * (q * p));
+  c = ((d + c) * (p * q)) + ((c | c) & (d & 41));
+  b = ((a + a) ^ (c & 5)) + ((p | p) + (c & d));
+  if(c < p){
+    b = ((c * c) - (d * a)) - ((b & 1) | (a - d));
+  }else{
+    c = ((q | b) * (b + q)) | ((a & p) * (a * 84));
+  }
+  b = ((p + a) | (b ^ d)) + ((c + q) & (d - 5));
+  for(i = 0; i < 7; i++){
+    d = ((d ^ a) | (d ^ 31)) ^ ((d * 84) & (c ^ c));
+  }
+  b = ((p & q) & (a - d)) * ((q ^ p) ^ (d ^ b));
+  c = ((p + c) & (q & a)) + ((b ^ c) - (c ^ b));
+  if(b < b){
+    b = ((b & q) | (c - p)) + ((b + a) & (p & d));
+  }else{
+    d = ((a + 92) * (b * 23)) - ((q + 36) + (q + q));
+  }
+  d = ((p * a) | (q & p)) ^ ((a + d) & (p | c));
+  b = ((d + c) ^ (p - p)) + ((b - p) * (b + 96));
+  a = ((a | b) * (d | a)) & ((p * c) | (b - 67));
+  for(i = 0; i < 17; i++){
+    c = ((d + q) ^ (a ^ b)) ^ ((d - a) + (b | 17));
+  }
+  if(b < 35){
+    c = ((c | d) & (a - p)) & ((d & d) ^ (q | b));
+  }else{
+    c = ((b - p) - (q - b)) & ((d ^ q) | (q - p));
+  }
+  d = ((d | d) * (c & q)) * ((a ^ 35) | (b ^ d));
+  a = ((a * c) * (c | 25)) | ((d + 45) * (a ^ a));
+  d = ((d & q) ^ (b + p)) & ((b + q) ^ (a ^ p));
+  c = ((d * p) + (b ^ p)) * ((a * c) - (a | q));
+  if(b < b){
+    b = ((c * c) * (c ^ d)) | ((c & 40) - (d | d));
+  }else{
+    a = ((b ^ a) + (p & 12)) | ((d | c) & (a ^ b));
+  }
+  for(i = 0; i < 27; i++){
+    b = ((p * d) & (d & d)) + ((c ^ 47) - (d ^ b));
+  }
+  d = ((p + b) & (q | d)) + ((p + d) ^ (p - p));
+  c = ((q ^ c) + (q * b)) * ((a - b) + (q & 26));
+  d = ((a & a) ^ (c & 43)) * ((b + c) + (p + 77));
+  if(c < b){
+    c = ((q + q) * (p * a)) ^ ((d ^ p) - (b - 77));
+  }else{
+    d = ((d * 93) | (a + p)) | ((b * p) | (b + 92));
+  }
+  d = ((q ^ q) * (c - c)) - ((d - a) * (p | p));
+  d = ((q * 17) - (d & c)) | ((p | p) ^ (d + 49));
+  for(i = 0; i < 22; i++){
+    a = ((p - d) ^ (q | p)) * ((p * 14) & (c & 44));
+  }
+  d = ((d + c) & (p * a)) ^ ((a | p) - (d - 69));
+  if(b < 92){
+    a = ((a ^ d) * (d | p)) + ((p ^ p) ^ (q ^ c));
+  }else{
+    c = ((b + c) & (a & d)) | ((p + b) + (b * b));
+  }
+  c = ((b * q) | (c - a)) * ((p ^ 86) - (a & q));
+  b = ((p ^ p) + (a & q)) | ((p + 56) - (q ^ c));
+  b = ((p * 34) | (q ^ q)) * ((p | 6) + (q & d));
+  b = ((d | 43) + (p - b)) * ((c & 59) * (q & d));
+  if(b < p){
+    a = ((c ^ c) | (c | a)) | ((b & d) * (c & c));
+  }else{
+    c = ((q | q) * (p + 9)) | ((d & d) & (q & c));
+  }
+  a = ((a & 61) + (c * d)) & ((a & p) & (c - c));
+  c = ((p - p) + (a | 62)) ^ ((p - p) * (c ^ p));
+  a = ((d & 34) + (a * a)) | ((d & b) + (d + c));
+  a = ((p | a) - (c & 75)) * ((q ^ d) ^ (d * 69));
+  if(b < p){
+    b = ((c - a) | (p | p)) * ((d + b) & (q & 48));
+  }else{
+    c = ((p - 64) ^ (c * d)) * ((b * d) ^ (c * a));
+  }
+  c = ((p * c) - (a - c)) & ((d * c) & (p * a));
+  for(i = 0; i < 50; i++){
+    b = ((b ^ q) & (d | b)) * ((q & a) + (b * b));
+  }
+  d = ((p - d) + (d * a)) & ((p * p) + (a * b));
+  b = ((d - 23) & (a | c)) | ((c - p) ^ (c & p));
+  if(c < p){
+    d = ((q ^ d) * (p * b)) | ((a + q) * (a & q));
+  }else{
+    c = ((p - c) ^ (b & a)) | ((c & 19) ^ (q - b));
+  }
+  c = ((c | q) - (d + p)) ^ ((b | q) + (p + q));
+  b = ((a * b) ^ (d * 47)) + ((b | p) - (b & d));
+  b = ((p | b) ^ (a & a)) + ((c & b) & (c ^ c));
+  for(i = 0; i < 29; i++){
+    b = ((a | 45) - (c & 67)) | ((d + 94) - (c | d));
+  }
+  if(b < q){
+    b = ((b & c) ^ (q + d)) * ((q & p) | (c - b));
+  }else{
+    c = ((q * b) ^ (c & 88)) + ((p + a) | (b | c));
+  }
+  return a + b + c + d;
+}
+
+int func188(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 36;
+  d = 23;
+  b = ((q ^ q) & (q ^ 31)) - ((c + a) + (b | d));
+  a = ((p * q) - (c ^ c)) - ((p | d) | (a + 30));
+  c = ((c ^ a) + (p * b)) - ((p * q) + (q & c));
+  d = ((p * q) | (b - p)) * ((d + p) * (q | 87));
+  if(b < p){
+    b = ((a | 32) * (a + b)) * ((b - q) ^ (p + a));
+  }else{
+    d = ((a & 81) ^ (a - a)) | ((c - q) & (a * 35));
+  }
+  c = ((p ^ 38) ^ (a & d)) & ((p | 60) ^ (d - q));
+  for(i = 0; i < 36; i++){
+    b = ((d - p) & (q | a)) & ((p + 79) | (b ^ b));
+  }
+  a = ((a ^ c) & (c + 78)) + ((b - 61) * (p | b));
+  a = ((b & p) + (p | 20)) & ((q ^ 23) & (q & 1));
+  if(d < 53){
+    c = ((b ^ a) - (p * 75)) | ((q & p) | (d & 89));
+  }else{
+    b = ((p * 69) * (p * 57)) | ((p + p) - (d & 52));
+  }
+  c = ((d * a) + (a ^ c)) * ((p + a) & (b - q));
+  a = ((a & d) | (c | 75)) ^ ((a ^ 59) & (b | p));
+  c = ((p ^ 94) & (p & c)) | ((q | 52) * (c - 20));
+  for(i = 0; i < 26; i++){
+    b = ((q * 45) | (b | b)) + ((b & c) * (a * c));
+  }
+  if(b < 9){
+    d = ((q & c) + (d & a)) & ((c | b) ^ (b ^ d));
+  }else{
+    a = ((d - 31) + (b | q)) - ((d - p) - (q & b));
+  }
+  b = ((c ^ a) & (d ^ c)) ^ ((c * p) * (q ^ a));
+  a = ((q - 44) ^ (d & 68)) ^ ((p + d) + (p * 36));
+  b = ((a ^ 27) * (a * d)) + ((d & d) - (c | p));
+  d = ((p ^ d) - (c * q)) - ((b + 29) - (q * a));
+  if(b < d){
+    c = ((d * d) + (b | 35)) * ((c * a) - (d | p));
+  }else{
+    c = ((a + d) - (c | d)) & ((c * d) - (c ^ b));
+  }
+  for(i = 0; i < 16; i++){
+    a = ((a * b) & (p * c)) - ((c - q) & (p ^ d));
+  }
+  d = ((b - c) & (a + p)) + ((p ^ 56) | (c & 59));
+  b = ((c ^ c) * (c & b)) + ((a ^ p) + (d & c));
+  c = ((d | 8) + (a | 55)) * ((b ^ c) ^ (a & q));
+  if(c < 48){
+    c = ((a + d) - (b | b)) * ((c - q) | (b - p));
+  }else{
+    c = ((q - c) - (q & a)) - ((d | c) + (c - b));
+  }
+  d = ((p | p) - (c - c)) | ((p ^ a) ^ (c | 92));
+  a = ((d + p) + (d * c)) + ((c - p) * (q ^ c));
+  for(i = 0; i < 26; i++){
+    a = ((d - b) - (p | d)) & ((d + c) + (p - b));
+  }
+  d = ((b & q) ^ (b * 81)) | ((d - q) * (d + d));
+  if(c < p){
+    c = ((p | q) + (p | d)) - ((b + c) | (b ^ 74));
+  }else{
+    a = ((c - d) - (b | 38)) - ((c | 98) + (b ^ d));
+  }
+  b = ((a * b) + (a | c)) * ((d & d) ^ (d * 27));
+  c = ((b - 49) + (q + d)) * ((c * a) | (q | q));
+  d = ((a - p) * (q * p)) * ((p + d) | (p & 4));
+  b = ((d ^ 81) | (c | q)) & ((b - q) * (p | a));
+  if(b < c){
+    a = ((b | a) * (p | d)) - ((d ^ 63) | (c ^ b));
+  }else{
+    d = ((d & a) & (d * c)) | ((c - d) & (p + b));
+  }
+  c = ((d | 92) ^ (q - q)) & ((a - c) & (a & a));
+  a = ((b + a) | (d & 85)) | ((p & b) & (c & 55));
+  a = ((b | p) * (a | a)) ^ ((c | c) & (d & d));
+  a = ((p + p) | (q + 48)) + ((d + 71) * (a & d));
+  if(d < d){
+    c = ((b ^ b) - (d + a)) * ((p & 24) - (q - c));
+  }else{
+    b = ((b * c) - (b | p)) - ((c & q) ^ (q - p));
+  }
+  d = ((q + 25) * (p | d)) + ((q ^ p) - (d & q));
+  for(i = 0; i < 11; i++){
+    c = ((q ^ c) * (b | 48)) * ((p ^ 42) * (d - 18));
+  }
+  a = ((a ^ p) | (q | 33)) & ((a ^ p) * (c + b));
+  d = ((d - 23) + (a | p)) | ((q - c) | (p & 82));
+  if(b < d){
+    a = ((c & d) * (c ^ a)) + ((d * 10) | (c ^ a));
+  }else{
+    d = ((c + d) & (p * d)) ^ ((p ^ p) & (p | c));
+  }
+  d = ((p + d) & (c * 67)) | ((p - a) ^ (c | c));
+  b = ((d - 13) * (d & b)) + ((b | p) * (d ^ a));
+  c = ((b - d) + (q | a)) ^ ((d | p) | (b | c));
+  for(i = 0; i < 28; i++){
+    d = ((d ^ p) ^ (c | q)) + ((q ^ q) & (p - b));
+  }
+  if(b < c){
+    b = ((a | q) & (q & q)) * ((p * c) + (q ^ 70));
+  }else{
+    a = ((a & q) & (c & p)) - ((d - 46) ^ (d ^ 26));
+  }
+  return a + b + c + d;
+}
+
+int func189(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 1;
+  d = 11;
+  b = ((b * a) - (q + b)) * ((p * p) - (p + q));
+  c = ((a * b) | (b + a)) * ((p | d) ^ (b & 52));
+  c = ((c | 5) + (c & q)) * ((a & a) * (d ^ 10));
+  b = ((p ^ d) & (d & q)) ^ ((p + q) - (p + b));
+  if(b < p){
+    b = ((p & q) ^ (p * 45)) ^ ((a | d) | (c | d));
+  }else{
+    b = ((q - b) + (a * a)) - ((a + p) | (c * p));
+  }
+  c = ((b & d) - (q | c)) & ((q + p) | (d * 96));
+  for(i = 0; i < 47; i++){
+    c = ((a ^ q) ^ (a * 30)) * ((a & q) + (p | p));
+  }
+  c = ((d ^ c) * (p + 54)) ^ ((c | 12) ^ (d * p));
+  b = ((a | b) - (d + b)) + ((a * c) ^ (p ^ 58));
+  if(c < p){
+    c = ((q & d) + (c ^ a)) & ((a & p) - (b - b));
+  }else{
+    c = ((q | b) + (b - d)) + ((c * b) * (a ^ b));
+  }
+  a = ((b * c) * (p - 25)) | ((p & q) & (d ^ q));
+  c = ((c - a) + (b & c)) + ((a + a) - (a + c));
+  b = ((a ^ 23) * (q | 98)) & ((q ^ 83) + (d - p));
+  for(i = 0; i < 17; i++){
+    c = ((b * p) + (p * 99)) & ((q & 21) - (p + d));
+  }
+  if(d < d){
+    b = ((a ^ p) | (p + d)) - ((b | b) - (p - q));
+  }else{
+    c = ((b ^ d) ^ (p & 45)) + ((q ^ q) ^ (p * a));
+  }
+  b = ((q | q) | (c ^ p)) | ((a - p) & (c & p));
+  b = ((a | q) * (q - 26)) ^ ((d - c) + (p | d));
+  b = ((q & b) + (c ^ 4)) | ((c + p) ^ (d | 89));
+  b = ((d | a) - (q * a)) ^ ((b * a) | (a - 40));
+  if(b < 65){
+    b = ((d ^ b) ^ (q + q)) * ((d | d) & (p + 31));
+  }else{
+    b = ((a | d) * (b - 96)) | ((a | p) - (a * b));
+  }
+  for(i = 0; i < 47; i++){
+    a = ((a + q) * (b ^ a)) - ((a - p) + (p * c));
+  }
+  b = ((b - d) - (q | d)) ^ ((b & 64) * (q ^ 68));
+  d = ((d + a) | (d ^ a)) + ((c * c) - (b * p));
+  b = ((a | p) | (q * b)) - ((p * d) ^ (q - q));
+  if(c < c){
+    a = ((c ^ b) - (d - a)) * ((p ^ 40) | (b - p));
+  }else{
+    a = ((b + p) - (p ^ p)) ^ ((c & 34) & (q + 21));
+  }
+  d = ((a * c) & (q ^ 89)) * ((p | q) ^ (d * p));
+  a = ((q + c) ^ (c * q)) | ((c | 28) & (b - q));
+  for(i = 0; i < 48; i++){
+    b = ((b * 36) * (b * 95)) & ((c - 23) ^ (p & a));
+  }
+  b = ((c ^ d) ^ (d | a)) & ((a * d) ^ (a ^ 75));
+  if(b < b){
+    d = ((p + a) ^ (p * p)) - ((a + b) & (p | 61));
+  }else{
+    a = ((b & b) ^ (p * 12)) - ((d + a) + (d - a));
+  }
+  a = ((d + p) - (p & 32)) - ((c * a) * (b ^ a));
+  b = ((d & 86) | (q * a)) * ((a & b) ^ (b & d));
+  d = ((b + q) * (b ^ q)) & ((a & a) | (c - 46));
+  c = ((d * c) | (a ^ d)) ^ ((b ^ c) & (b * q));
+  if(d < d){
+    b = ((d | q) + (d + d)) & ((q | a) + (c + 50));
+  }else{
+    d = ((c - p) - (p + d)) ^ ((a * b) | (p ^ p));
+  }
+  a = ((p + b) - (b ^ 70)) - ((a - q) * (c | q));
+  d = ((c & b) & (c * d)) + ((a + c) * (c & q));
+  c = ((a ^ q) * (a | b)) & ((a + c) - (a & 22));
+  c = ((q | b) * (c ^ b)) | ((c - a) - (d ^ b));
+  if(b < a){
+    b = ((c | q) - (c ^ c)) + ((b * 93) & (q | p));
+  }else{
+    d = ((b ^ 34) + (c - c)) + ((b * c) - (p + a));
+  }
+  c = ((p ^ 93) ^ (q * b)) & ((c - 31) - (p + d));
+  for(i = 0; i < 16; i++){
+    d = ((a ^ a) | (a + a)) + ((b ^ d) + (p ^ b));
+  }
+  d = ((a + b) + (p - c)) ^ ((d ^ q) + (p ^ b));
+  b = ((q & b) ^ (d * p)) + ((b + 37) & (c | a));
+  if(c < a){
+    b = ((b - 45) * (q * q)) ^ ((p - d) & (b | c));
+  }else{
+    a = ((b ^ b) * (c - 28)) + ((q ^ d) & (a * c));
+  }
+  a = ((b * a) | (c ^ b)) | ((c | 18) - (a ^ b));
+  c = ((p + b) * (d + a)) ^ ((b - p) & (c * q));
+  c = ((d ^ q) & (b & d)) & ((a | d) & (p * d));
+  for(i = 0; i < 9; i++){
+    a = ((p & c) | (a - b)) | ((b * 49) | (c & p));
+  }
+  if(c < p){
+    a = ((b ^ a) | (c & d)) - ((p - 37) & (q - d));
+  }else{
+    c = ((a + p) + (p - d)) + ((c + q) ^ (c ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func190(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 1;
+  d = 97;
+  c = ((a | b) * (c & 43)) ^ ((b + 67) * (p * d));
+  d = ((b - 41) | (d * b)) & ((a * b) * (b + q));
+  c = ((c - 95) * (p * p)) - ((b - a) ^ (q ^ c));
+  a = ((p & p) * (p + d)) ^ ((q - q) & (c * c));
+  if(b < d){
+    a = ((q + b) * (d + c)) | ((p - p) | (a | p));
+  }else{
+    b = ((a + p) & (a ^ d)) - ((p - q) + (q - b));
+  }
+  a = ((d & 41) | (q * c)) ^ ((c ^ q) - (c * 73));
+  for(i = 0; i < 46; i++){
+    a = ((q | q) & (c * q)) * ((p - c) ^ (d * 14));
+  }
+  a = ((c - q) ^ (a * 82)) ^ ((q - a) + (q | p));
+  d = ((a - 30) + (a ^ 66)) | ((d | q) * (p + b));
+  if(c < 95){
+    a = ((c ^ 43) * (p | d)) * ((q + d) ^ (b ^ 27));
+  }else{
+    a = ((c + 82) & (c * p)) - ((a | c) ^ (a | q));
+  }
+  a = ((a + c) ^ (b & c)) | ((p ^ q) ^ (a - d));
+  b = ((q | c) | (d | 4)) ^ ((c ^ 81) * (a ^ d));
+  c = ((b ^ p) + (b - 53)) ^ ((d * 74) + (p * q));
+  for(i = 0; i < 7; i++){
+    b = ((c | p) - (p - c)) & ((d ^ a) | (d | b));
+  }
+  if(a < b){
+    b = ((d + q) ^ (d ^ q)) - ((c & q) | (d | c));
+  }else{
+    a = ((b ^ d) + (b & 75)) | ((b * 12) ^ (d ^ b));
+  }
+  b = ((p + c) - (p - p)) | ((q * 54) & (a * d));
+  a = ((b - 42) - (d * c)) * ((q ^ c) | (p + c));
+  a = ((p - c) | (a | b)) + ((q ^ a) ^ (q ^ b));
+  d = ((a - b) | (q | 6)) | ((b - c) * (p + 52));
+  if(d < 91){
+    d = ((b ^ 88) | (d & a)) & ((c ^ 5) + (p & d));
+  }else{
+    b = ((p ^ 60) + (a | b)) ^ ((a + d) | (b + q));
+  }
+  for(i = 0; i < 40; i++){
+    b = ((p ^ c) & (q | b)) * ((q ^ a) + (a * b));
+  }
+  c = ((d + 96) & (c - b)) & ((c ^ a) - (a & 60));
+  a = ((d * 40) + (a ^ b)) ^ ((b + 63) | (p + 4));
+  a = ((p + d) | (b + d)) | ((a ^ d) & (b & a));
+  if(c < p){
+    a = ((d & c) ^ (c * 52)) + ((d | p) | (d | 73));
+  }else{
+    d = ((b + c) - (c ^ a)) * ((p - b) & (d * q));
+  }
+  b = ((a - p) ^ (p ^ q)) + ((p ^ 3) - (d ^ 83));
+  b = ((b + a) ^ (q + b)) * ((q * 79) * (p - b));
+  for(i = 0; i < 21; i++){
+    d = ((q | b) | (c & c)) & ((b ^ a) & (b ^ 19));
+  }
+  d = ((a ^ b) + (d & d)) * ((a | 76) | (p & a));
+  if(c < 63){
+    d = ((p | c) + (b | a)) + ((d & p) * (b + b));
+  }else{
+    d = ((p | b) ^ (p * p)) & ((d * a) - (d ^ p));
+  }
+  b = ((p - 64) & (c - a)) ^ ((a | q) & (d - c));
+  c = ((q ^ a) - (c - 34)) ^ ((q * q) + (q - b));
+  b = ((q * 96) & (p | c)) & ((p - p) ^ (d ^ p));
+  a = ((c * 93) - (p | p)) - ((d * q) ^ (d * p));
+  if(a < b){
+    a = ((d * b) & (a | p)) | ((p + d) - (b & 75));
+  }else{
+    c = ((a * a) * (a + q)) & ((c - d) | (b & d));
+  }
+  a = ((b & d) & (b & q)) + ((p ^ p) ^ (b ^ d));
+  d = ((q & c) - (c & q)) * ((q | c) * (c | 3));
+  c = ((a & d) ^ (a | 96)) * ((d ^ c) + (a - 14));
+  d = ((b | a) - (b | b)) ^ ((p & 27) * (d * p));
+  if(c < a){
+    a = ((a | 33) ^ (a | q)) + ((a ^ b) ^ (q + b));
+  }else{
+    d = ((q - d) * (d * a)) & ((q - 17) - (q * b));
+  }
+  c = ((a * b) * (a ^ b)) * ((q - a) + (b + d));
+  for(i = 0; i < 17; i++){
+    b = ((a * 7) * (p ^ p)) - ((c - a) - (b ^ 99));
+  }
+  c = ((a + q) | (d | b)) ^ ((b | p) & (d & c));
+  c = ((d & c) + (c | 29)) | ((c * 65) | (p | c));
+  if(c < a){
+    a = ((q ^ b) + (d ^ q)) * ((q & d) - (a - c));
+  }else{
+    d = ((q & q) * (p * q)) ^ ((d * p) | (d * a));
+  }
+  b = ((b + b) + (d & 25)) * ((p ^ p) * (b | 26));
+  a = ((c * 47) | (a * 17)) & ((b * 97) | (d * b));
+  c = ((q * a) | (q + a)) ^ ((q * 81) + (a | q));
+  for(i = 0; i < 40; i++){
+    c = ((d + 25) + (d ^ b)) | ((d & d) - (c & b));
+  }
+  if(b < 26){
+    c = ((b | 81) - (c & c)) & ((b * 99) | (c & b));
+  }else{
+    d = ((c | a) + (b - 66)) + ((p + c) - (a + d));
+  }
+  return a + b + c + d;
+}
+
+int func191(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 83;
+  d = 4;
+  b = ((d & 73) | (c - b)) | ((b & b) - (p - p));
+  a = ((p & c) - (c - 38)) * ((a ^ a) ^ (b + b));
+  d = ((d | p) ^ (b | a)) + ((b * q) + (d * b));
+  d = ((p | c) + (p ^ a)) + ((b * d) - (d ^ d));
+  if(c < d){
+    c = ((p + 96) & (q | d)) - ((p ^ c) ^ (c + b));
+  }else{
+    a = ((q - a) + (c ^ c)) & ((a + 11) + (d | d));
+  }
+  a = ((b ^ b) * (d + b)) ^ ((q ^ p) - (q * d));
+  for(i = 0; i < 49; i++){
+    b = ((q + b) | (c ^ c)) | ((b & a) & (b * d));
+  }
+  d = ((b - 18) - (b - 36)) & ((c | c) ^ (c * q));
+  a = ((q - a) * (c - b)) | ((b & q) | (p | p));
+  if(a < p){
+    b = ((q ^ a) | (c | c)) ^ ((b * 90) & (a & q));
+  }else{
+    a = ((b - c) & (b & 82)) & ((c ^ a) ^ (b | c));
+  }
+  d = ((q | b) * (d ^ c)) + ((b ^ d) ^ (p ^ q));
+  d = ((a - c) - (c ^ 96)) + ((a - c) | (a * p));
+  a = ((c & p) * (a * b)) + ((c + q) + (p * p));
+  for(i = 0; i < 50; i++){
+    a = ((a + c) | (c | c)) + ((p * b) & (q * d));
+  }
+  if(a < 39){
+    c = ((q | q) | (q + p)) | ((b - a) * (b * a));
+  }else{
+    a = ((q | a) + (a - d)) - ((p | b) ^ (d ^ q));
+  }
+  a = ((q + a) + (c & 67)) + ((q - 47) ^ (a & p));
+  c = ((d * b) ^ (a ^ q)) * ((d | 72) & (b ^ c));
+  c = ((c & c) + (p + p)) * ((p ^ q) ^ (c + p));
+  a = ((a * 31) + (c * c)) | ((b + c) & (a * q));
+  if(c < p){
+    c = ((q | a) * (q & b)) - ((b & d) & (a * 36));
+  }else{
+    c = ((a - q) & (b + 30)) - ((d & p) ^ (d ^ c));
+  }
+  for(i = 0; i < 17; i++){
+    b = ((c - p) & (c + 8)) - ((d ^ c) + (b ^ d));
+  }
+  d = ((d | q) * (q + 66)) * ((q | 8) - (p | p));
+  c = ((b + q) + (d * p)) - ((b * 84) + (a + 80));
+  d = ((a - q) * (b * b)) | ((a ^ q) & (q + q));
+  if(c < q){
+    a = ((c * a) & (a + 38)) ^ ((q ^ 78) - (q - b));
+  }else{
+    b = ((a * p) & (c & d)) & ((q - a) * (d ^ q));
+  }
+  b = ((q - 81) - (p - d)) & ((b ^ p) - (q & b));
+  d = ((b - 85) & (q & c)) ^ ((a ^ q) & (d | 67));
+  for(i = 0; i < 14; i++){
+    d = ((c - 40) - (d ^ q)) & ((d - d) ^ (q & p));
+  }
+  d = ((b ^ p) + (b & b)) + ((q * 74) * (q * p));
+  if(d < c){
+    d = ((p ^ q) - (b ^ q)) - ((d & 49) ^ (b | 68));
+  }else{
+    d = ((a - 25) ^ (b - c)) ^ ((c * 16) | (c & c));
+  }
+  c = ((a + d) * (c + b)) + ((q | a) ^ (c + p));
+  d = ((a ^ 57) ^ (b ^ q)) + ((c + a) & (d | a));
+  c = ((q ^ 31) & (c * d)) ^ ((p - a) + (a | d));
+  d = ((a & p) - (p * b)) & ((q * q) | (c | c));
+  if(d < d){
+    b = ((b - q) + (c * a)) + ((p | b) ^ (c & b));
+  }else{
+    a = ((b & 95) & (d & a)) | ((d | q) - (d & c));
+  }
+  c = ((b | d) + (a * q)) | ((p * p) + (q ^ p));
+  b = ((a + d) | (d * c)) - ((d + p) + (p | q));
+  d = ((b | d) + (b + p)) + ((q | 77) ^ (q + p));
+  c = ((b + b) - (d | c)) - ((c | q) * (p & d));
+  if(a < p){
+    c = ((q - c) ^ (b & 62)) | ((q | 96) + (b | c));
+  }else{
+    c = ((q ^ q) * (a + c)) - ((a - q) - (c | a));
+  }
+  d = ((a - b) - (b * b)) - ((a & d) ^ (d * 36));
+  for(i = 0; i < 22; i++){
+    a = ((d - d) | (d + d)) & ((p | q) | (c - 32));
+  }
+  b = ((q + a) * (p | p)) - ((d * q) + (c + p));
+  b = ((d + d) + (q + 27)) * ((c * p) ^ (c & a));
+  if(b < d){
+    a = ((a & q) + (p & a)) - ((q * b) + (a ^ c));
+  }else{
+    c = ((b + c) ^ (p ^ c)) * ((q * q) - (q & 46));
+  }
+  b = ((b + q) | (a ^ c)) + ((a + a) * (c | a));
+  c = ((q | b) ^ (c - d)) * ((c - d) | (p + d));
+  a = ((d & b) + (q * a)) + ((p + c) - (a + c));
+  for(i = 0; i < 48; i++){
+    d = ((c & p) | (b & a)) - ((c - q) + (d - 98));
+  }
+  if(d < b){
+    d = ((a ^ q) * (p * d)) + ((c * c) - (b | q));
+  }else{
+    a = ((c - 44) ^ (a - a)) + ((c | p) - (p | c));
+  }
+  return a + b + c + d;
+}
+
+int func192(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 9;
+  d = 22;
+  c = ((p + 75) & (q - 63)) | ((c ^ c) | (p & a));
+  a = ((a | 65) | (c * a)) - ((q ^ b) | (b * p));
+  b = ((q ^ b) * (c - 48)) * ((b | d) * (q + 29));
+  c = ((a & q) + (b * p)) ^ ((q + c) ^ (b * b));
+  if(a < p){
+    b = ((a + 43) ^ (d & b)) - ((a | 76) | (d ^ d));
+  }else{
+    c = ((b | 99) + (c + 44)) | ((p | 73) & (d ^ p));
+  }
+  c = ((p * 92) | (a * q)) - ((q | a) & (c * q));
+  for(i = 0; i < 15; i++){
+    b = ((d * d) | (d | p)) & ((d - b) * (b | d));
+  }
+  d = ((b & d) & (p & b)) ^ ((c | 4) - (b + d));
+  a = ((b & c) + (a | 58)) & ((c | p) | (d & d));
+  if(a < 21){
+    b = ((a & p) - (b | b)) | ((c ^ d) - (b ^ 32));
+  }else{
+    b = ((a & 42) | (a - 8)) - ((d * 75) * (a + q));
+  }
+  d = ((c - b) * (a - a)) | ((c | d) + (a ^ a));
+  c = ((b * q) * (d & c)) * ((a | p) | (d * p));
+  c = ((b * p) + (c + p)) | ((p | b) ^ (a | c));
+  for(i = 0; i < 49; i++){
+    a = ((c - q) | (d | p)) | ((d | c) - (d ^ 9));
+  }
+  if(a < a){
+    b = ((d + q) & (d & b)) + ((q - b) ^ (c * d));
+  }else{
+    c = ((q - a) - (c ^ 74)) ^ ((c - a) | (b | d));
+  }
+  a = ((q ^ b) - (c & q)) ^ ((b & 6) + (p ^ d));
+  c = ((p | d) + (c * d)) | ((q | a) - (c | 37));
+  a = ((q & a) * (q * 45)) + ((q + q) & (c + q));
+  d = ((a + d) + (b ^ 56)) ^ ((a - b) * (b + 68));
+  if(b < 77){
+    c = ((d + d) ^ (q + p)) & ((d + p) ^ (a + b));
+  }else{
+    c = ((p * 65) - (a - d)) - ((q * b) ^ (b ^ c));
+  }
+  for(i = 0; i < 27; i++){
+    c = ((b - b) + (p & a)) | ((p * c) | (q & 46));
+  }
+  a = ((p * c) - (d & d)) & ((p ^ q) * (b ^ d));
+  b = ((d - b) ^ (b ^ a)) + ((q | 48) & (d & c));
+  b = ((c + q) ^ (d ^ q)) & ((p + 7) & (a + p));
+  if(a < b){
+    a = ((q + a) * (d & 91)) - ((d ^ d) - (d * p));
+  }else{
+    c = ((q & a) - (q & c)) * ((c & p) ^ (q + c));
+  }
+  a = ((d - c) ^ (a | 26)) | ((d | 30) * (a * 86));
+  b = ((c - b) - (c * d)) - ((d ^ p) | (c ^ d));
+  for(i = 0; i < 30; i++){
+    c = ((d ^ b) ^ (d * c)) + ((d - a) ^ (d - c));
+  }
+  b = ((d ^ q) - (c * b)) | ((b + a) & (a & 48));
+  if(a < q){
+    c = ((c ^ c) * (a | a)) | ((d ^ d) + (d + b));
+  }else{
+    a = ((d - c) & (c - d)) & ((d ^ b) | (b * a));
+  }
+  c = ((d * c) ^ (d - q)) ^ ((q * q) | (q | 26));
+  b = ((d | p) ^ (d ^ c)) | ((d * p) ^ (a & q));
+  d = ((a ^ p) ^ (c + q)) + ((c + q) + (p | a));
+  a = ((b ^ d) | (p | d)) | ((q + 42) - (b ^ a));
+  if(c < b){
+    d = ((a - c) * (p & p)) ^ ((b * d) | (q * b));
+  }else{
+    d = ((b & a) + (b ^ q)) & ((b - b) & (b - 31));
+  }
+  b = ((p * a) ^ (a ^ b)) | ((d | p) * (b * q));
+  a = ((d ^ 44) - (q - b)) & ((b + 56) ^ (b ^ d));
+  d = ((q & q) * (q & 36)) ^ ((b | q) & (a | 39));
+  c = ((q - p) ^ (c + b)) * ((a * q) - (q + 7));
+  if(a < c){
+    c = ((a + d) ^ (a + d)) & ((q + p) * (d ^ a));
+  }else{
+    c = ((d | 30) | (p ^ q)) * ((d | d) - (b | a));
+  }
+  d = ((d * d) + (b + d)) - ((d | p) | (p * a));
+  for(i = 0; i < 40; i++){
+    a = ((q & q) - (p & 37)) + ((d ^ b) * (p + b));
+  }
+  b = ((c * q) - (p - c)) * ((c + 20) | (d + q));
+  b = ((p - c) * (q & a)) & ((q | a) + (c ^ 88));
+  if(c < a){
+    d = ((c * 96) | (c + 34)) * ((d - p) * (a | p));
+  }else{
+    d = ((b | 16) ^ (c + a)) ^ ((a + 19) & (d + 89));
+  }
+  c = ((d & 56) * (q ^ b)) * ((b & a) * (c - c));
+  b = ((b ^ 1) & (p - 17)) - ((d * a) | (c + p));
+  b = ((b - q) ^ (d - 57)) * ((p - c) & (q - p));
+  for(i = 0; i < 6; i++){
+    b = ((q ^ 95) & (d * a)) ^ ((c ^ d) ^ (p ^ 15));
+  }
+  if(a < b){
+    d = ((q & a) + (c - d)) ^ ((q ^ 26) ^ (c - c));
+  }else{
+    a = ((b | 62) * (p ^ a)) & ((a | 24) - (d | a));
+  }
+  return a + b + c + d;
+}
+
+int func193(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 15;
+  d = 38;
+  b = ((a - c) * (c + 37)) & ((b | d) - (c - q));
+  d = ((b * q) & (p ^ d)) * ((b * 82) * (b * 83));
+  c = ((c | q) | (q * q)) - ((p | 79) ^ (c & d));
+  c = ((a | 47) - (d | q)) * ((c * a) ^ (b ^ a));
+  if(c < p){
+    d = ((d & b) | (q - d)) ^ ((c | p) & (a & 4));
+  }else{
+    b = ((c ^ b) | (q + 25)) ^ ((a + 95) | (p & q));
+  }
+  d = ((d + b) - (a ^ b)) - ((d * b) - (a * b));
+  for(i = 0; i < 35; i++){
+    c = ((p * 40) ^ (c + 23)) & ((d | b) - (p + 24));
+  }
+  d = ((p * 8) - (b - p)) - ((c * c) | (p - q));
+  d = ((q | a) ^ (d | p)) | ((q + a) ^ (c | 37));
+  if(d < p){
+    b = ((d | 26) * (p + b)) * ((d & q) | (d + 76));
+  }else{
+    b = ((p * 71) ^ (a & 33)) * ((a + q) - (d + a));
+  }
+  a = ((c ^ d) + (d & 19)) | ((p ^ p) + (c + b));
+  d = ((q ^ p) ^ (c * 45)) - ((c | q) & (d * a));
+  d = ((p ^ a) + (d & c)) ^ ((d & 87) | (c - b));
+  for(i = 0; i < 4; i++){
+    b = ((b | d) & (a + d)) & ((b ^ p) - (d - c));
+  }
+  if(c < q){
+    d = ((q + q) * (d - 5)) - ((q + p) ^ (d + q));
+  }else{
+    b = ((q ^ p) * (c + d)) | ((d + c) & (c + d));
+  }
+  d = ((b + b) - (b | 88)) ^ ((c * c) - (q + 34));
+  b = ((p * a) & (a * b)) ^ ((b & d) & (b + c));
+  c = ((d - b) | (q + 53)) - ((c & 43) | (a - c));
+  a = ((a & d) + (d ^ q)) + ((d & a) | (d ^ 8));
+  if(c < d){
+    c = ((p * a) | (d ^ p)) ^ ((a & c) + (p & d));
+  }else{
+    c = ((a + p) ^ (p & c)) ^ ((a | a) - (q ^ q));
+  }
+  for(i = 0; i < 31; i++){
+    d = ((p - 68) ^ (d - p)) & ((q - 74) + (p + 29));
+  }
+  d = ((c | c) & (q * p)) | ((b ^ b) ^ (a * 87));
+  c = ((d | q) | (b & b)) * ((a | 28) + (q & d));
+  c = ((d & b) | (q & 84)) * ((d | a) - (d - 60));
+  if(a < 97){
+    a = ((b - a) & (a * b)) | ((q & c) + (b ^ b));
+  }else{
+    b = ((p + p) * (q * 79)) - ((p - b) - (a + a));
+  }
+  c = ((a & q) - (p & 62)) & ((q ^ 71) | (d - a));
+  a = ((c & q) * (a ^ 73)) | ((p | a) | (d - q));
+  for(i = 0; i < 5; i++){
+    d = ((d ^ b) - (c - 24)) ^ ((a | q) & (p ^ p));
+  }
+  a = ((d - 10) - (a - 19)) ^ ((q & d) | (p & q));
+  if(d < a){
+    b = ((b ^ p) - (d - d)) * ((b | c) & (d + q));
+  }else{
+    c = ((d + a) | (a - a)) ^ ((a & a) ^ (a ^ a));
+  }
+  d = ((q + c) | (c * p)) ^ ((d ^ b) * (c + p));
+  c = ((q + q) - (c | c)) & ((q - d) | (q | 37));
+  c = ((a - q) | (q + a)) ^ ((b - p) & (c + a));
+  a = ((b ^ 72) - (p ^ 66)) & ((d | c) | (b ^ 97));
+  if(b < b){
+    a = ((a * q) + (p | 68)) ^ ((c + q) & (q - a));
+  }else{
+    b = ((d ^ d) ^ (p - q)) + ((d ^ d) * (a ^ 7));
+  }
+  d = ((b + 39) + (a - 65)) ^ ((c | d) | (a - c));
+  b = ((c - c) | (p ^ b)) & ((q - c) - (c ^ d));
+  a = ((d - b) + (c + 72)) ^ ((c + 23) * (a - q));
+  a = ((q - 92) | (q | 6)) ^ ((p | b) - (q + 79));
+  if(b < a){
+    c = ((d * 6) & (c ^ 96)) & ((q * q) + (q * a));
+  }else{
+    a = ((p ^ d) | (b + p)) & ((p & c) - (a + q));
+  }
+  b = ((a | a) + (a - q)) * ((a + c) | (d * 53));
+  for(i = 0; i < 37; i++){
+    b = ((c & d) | (b | c)) | ((p ^ a) ^ (q - 53));
+  }
+  d = ((b & 27) - (p + b)) | ((q & d) | (p - p));
+  a = ((b - b) & (q | b)) & ((a & p) - (p + b));
+  if(a < b){
+    d = ((b & a) | (a ^ q)) + ((q * 42) - (q + p));
+  }else{
+    d = ((q & c) * (a & 79)) | ((p - c) * (p + 36));
+  }
+  b = ((d | p) * (q - d)) & ((c - 1) + (b | c));
+  c = ((a ^ q) ^ (b * a)) * ((c + c) | (c ^ q));
+  a = ((a | a) ^ (p & d)) ^ ((c - a) | (a - 17));
+  for(i = 0; i < 11; i++){
+    a = ((q ^ q) * (q ^ b)) ^ ((a | p) ^ (b ^ 27));
+  }
+  if(b < 72){
+    c = ((b ^ 30) & (q + 61)) + ((p ^ d) + (b | q));
+  }else{
+    c = ((a | 6) ^ (q & p)) ^ ((b & p) - (a * a));
+  }
+  return a + b + c + d;
+}
+
+int func194(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 78;
+  d = 85;
+  d = ((q + d) & (c & q)) ^ ((a * a) * (c + 41));
+  c = ((d ^ d) * (q * b)) ^ ((b * 3) * (c - c));
+  d = ((b * q) ^ (p + 73)) & ((c + q) + (a & q));
+  d = ((p * 53) | (q * d)) | ((a - c) ^ (c - 80));
+  if(d < p){
+    b = ((a + c) * (q | d)) | ((b - a) ^ (b & d));
+  }else{
+    b = ((b - d) & (c & 50)) | ((a - d) ^ (c & p));
+  }
+  d = ((d - a) ^ (q ^ c)) + ((q ^ c) | (b & 21));
+  for(i = 0; i < 3; i++){
+    c = ((a * 4) * (c & b)) - ((c | b) * (q - 57));
+  }
+  c = ((d - 7) | (d ^ 32)) + ((d - q) & (q + p));
+  b = ((c & 67) ^ (a ^ p)) - ((q * a) * (d ^ q));
+  if(a < 31){
+    a = ((c & d) - (a + 65)) & ((a + p) | (a & d));
+  }else{
+    b = ((c ^ q) - (q ^ 56)) - ((a + 57) ^ (p ^ d));
+  }
+  c = ((c & 53) & (a * c)) + ((q ^ b) | (c - 41));
+  c = ((b + 28) * (p * q)) - ((a ^ c) ^ (b ^ a));
+  a = ((p | a) - (p * a)) - ((q * q) * (c ^ b));
+  for(i = 0; i < 31; i++){
+    c = ((a - q) ^ (b * p)) + ((d | p) & (d - a));
+  }
+  if(a < b){
+    d = ((a * b) & (a + c)) | ((d ^ 40) | (d & p));
+  }else{
+    a = ((c & a) + (b | c)) + ((p * d) - (c & b));
+  }
+  c = ((d ^ 20) - (a - q)) | ((d ^ c) * (p * 86));
+  d = ((p * 7) ^ (d + d)) + ((a + 23) * (d | 2));
+  c = ((a & 78) ^ (c + 7)) - ((d ^ 22) ^ (b & q));
+  b = ((p + q) + (b & c)) | ((a & 71) + (a * a));
+  if(d < 59){
+    d = ((b & p) + (a ^ d)) | ((c | a) * (a | p));
+  }else{
+    b = ((c | c) + (b + b)) | ((c + 72) & (q - a));
+  }
+  for(i = 0; i < 37; i++){
+    d = ((a ^ a) | (a + b)) + ((q & d) & (b * b));
+  }
+  c = ((p ^ p) | (b + d)) | ((q + d) | (a ^ 17));
+  c = ((d | c) & (d & 36)) | ((d & 50) - (p ^ 7));
+  a = ((c + 7) ^ (c + c)) * ((a + b) - (a - d));
+  if(c < p){
+    b = ((p - 54) & (p * 4)) & ((c ^ a) | (q ^ 48));
+  }else{
+    d = ((d & c) | (a ^ a)) ^ ((b | q) + (p ^ 42));
+  }
+  d = ((b ^ d) + (a ^ p)) + ((c ^ c) ^ (p & d));
+  d = ((a | a) - (d * d)) + ((d ^ b) ^ (q | a));
+  for(i = 0; i < 21; i++){
+    b = ((b & 39) | (c | b)) * ((q & 7) * (b + d));
+  }
+  d = ((c ^ d) ^ (a - d)) ^ ((p ^ d) * (q | q));
+  if(a < b){
+    c = ((d - p) & (d * c)) | ((p & 98) - (q ^ 67));
+  }else{
+    a = ((c | 22) + (d ^ a)) - ((a + c) - (c ^ p));
+  }
+  a = ((q ^ b) ^ (q & p)) + ((c - b) & (c - q));
+  d = ((q ^ 19) - (b + 36)) + ((p & a) ^ (c - 65));
+  c = ((b & q) ^ (c + q)) ^ ((p + b) & (a - 64));
+  d = ((b - a) * (b - p)) * ((c | 38) + (a - c));
+  if(b < 28){
+    b = ((c + p) * (d + q)) & ((d & p) * (q | 85));
+  }else{
+    c = ((d - b) * (p ^ 74)) - ((q | 78) + (a ^ p));
+  }
+  c = ((a + c) - (p ^ q)) | ((b & 50) & (q * 5));
+  c = ((c | p) | (a | 4)) ^ ((p | 55) | (d ^ c));
+  d = ((c ^ 50) * (d * b)) - ((p | q) + (c + q));
+  c = ((p + c) - (c ^ a)) * ((d + a) & (a & q));
+  if(b < p){
+    d = ((d | c) | (p & c)) ^ ((b * a) * (p & b));
+  }else{
+    c = ((b + c) - (q + p)) & ((p * a) | (c & c));
+  }
+  a = ((c & p) - (b + d)) - ((c ^ 47) | (b + q));
+  for(i = 0; i < 30; i++){
+    a = ((c & c) + (a * q)) & ((d * q) + (a - q));
+  }
+  a = ((c - a) * (a & 6)) | ((a & a) ^ (d - 53));
+  d = ((b | d) | (b ^ c)) ^ ((b | p) & (q * a));
+  if(d < 48){
+    d = ((a & c) ^ (q ^ c)) ^ ((b | c) * (p | a));
+  }else{
+    a = ((c ^ q) | (q | d)) | ((a - c) * (c + p));
+  }
+  b = ((b * 71) - (q & 49)) * ((c ^ d) ^ (q ^ d));
+  d = ((d + p) * (d + a)) + ((d & d) + (q - p));
+  d = ((q + c) & (c - 6)) + ((c - q) ^ (b + a));
+  for(i = 0; i < 11; i++){
+    b = ((c ^ d) ^ (q * c)) | ((d + b) * (a & c));
+  }
+  if(b < 59){
+    c = ((b * p) | (a - 39)) - ((p + 14) | (p + 85));
+  }else{
+    a = ((c * p) ^ (d & 99)) - ((p + p) ^ (b + p));
+  }
+  return a + b + c + d;
+}
+
+int func195(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 95;
+  d = 22;
+  b = ((p ^ b) ^ (q * 18)) & ((q & a) | (a & 64));
+  a = ((p + b) - (q + c)) | ((b * d) - (a + d));
+  d = ((p | 57) * (a & 22)) * ((p + 43) - (b + b));
+  d = ((q * c) | (q ^ q)) & ((q & p) - (b - a));
+  if(b < c){
+    c = ((d | q) | (b & d)) & ((q * c) & (q ^ b));
+  }else{
+    c = ((d * q) * (q & a)) & ((a - 4) * (a | 17));
+  }
+  b = ((p + d) | (b * c)) & ((a | d) - (a ^ p));
+  for(i = 0; i < 7; i++){
+    d = ((a ^ c) & (q - b)) * ((d | q) | (c * p));
+  }
+  a = ((p & a) | (c ^ b)) & ((b & d) ^ (b * b));
+  c = ((a & c) & (q + 60)) + ((p * a) - (p ^ c));
+  if(c < p){
+    d = ((a - c) | (b + a)) * ((p + d) - (c ^ a));
+  }else{
+    c = ((q - 55) | (a - b)) + ((d ^ p) | (d & q));
+  }
+  c = ((p - 26) & (c + p)) - ((b & b) * (a ^ p));
+  b = ((q ^ a) | (b | p)) - ((q & b) * (b * c));
+  a = ((d | p) + (d - d)) + ((a - p) * (q | b));
+  for(i = 0; i < 6; i++){
+    a = ((c * p) - (c | a)) ^ ((q + 2) * (b | c));
+  }
+  if(d < 12){
+    a = ((d | d) + (c * a)) * ((a * 99) & (c | d));
+  }else{
+    a = ((q & b) - (b * c)) - ((d ^ d) & (d ^ 15));
+  }
+  a = ((d ^ 75) + (q * b)) + ((a - 78) - (d + q));
+  d = ((d & q) + (q & d)) * ((a * p) + (d * q));
+  b = ((p + 94) | (q + p)) * ((d - p) | (c ^ p));
+  c = ((d | c) & (p - p)) - ((d ^ d) + (b | a));
+  if(c < a){
+    b = ((q * b) - (a * b)) * ((d * 23) - (d - 97));
+  }else{
+    d = ((b + a) - (a ^ p)) * ((p + c) - (d ^ c));
+  }
+  for(i = 0; i < 32; i++){
+    d = ((p | 74) * (q * d)) & ((b & 54) | (p & b));
+  }
+  c = ((a + d) * (b + p)) - ((q & q) - (p + c));
+  b = ((a | c) & (a * q)) & ((c * d) & (d + c));
+  a = ((q * q) + (p ^ 84)) - ((q ^ p) * (q & c));
+  if(b < 75){
+    c = ((p - c) - (b + a)) * ((a ^ 49) * (d + d));
+  }else{
+    c = ((d * q) | (c - p)) ^ ((b - 38) ^ (d - a));
+  }
+  d = ((b * 67) | (b | 12)) | ((d * c) - (p - a));
+  a = ((q - b) | (c * c)) + ((a & 34) * (p * p));
+  for(i = 0; i < 46; i++){
+    d = ((a ^ b) | (p ^ q)) & ((d * 86) & (p - q));
+  }
+  c = ((p & c) & (c ^ 99)) ^ ((p - b) * (p | c));
+  if(c < q){
+    c = ((b + b) - (a ^ p)) ^ ((c & p) + (a | 51));
+  }else{
+    d = ((p * b) - (q * b)) - ((p & d) | (p - 59));
+  }
+  a = ((a | c) ^ (a ^ 57)) + ((p - a) & (a | c));
+  c = ((q | a) + (q | p)) ^ ((b * d) - (p ^ 59));
+  a = ((d + 49) ^ (c * p)) ^ ((p * 65) | (p + p));
+  c = ((a & d) - (a * p)) ^ ((d ^ p) + (p - 23));
+  if(c < b){
+    b = ((b & q) ^ (b ^ a)) ^ ((a | c) * (q ^ 26));
+  }else{
+    d = ((d + c) * (b + a)) - ((p - q) + (a | 45));
+  }
+  a = ((q | a) * (c | a)) & ((d + a) | (d + c));
+  b = ((c ^ a) ^ (p ^ p)) - ((c - c) & (q ^ 63));
+  a = ((b * q) * (c & p)) & ((a ^ 52) * (b - q));
+  d = ((q + b) + (p * 61)) & ((a + a) + (a & 32));
+  if(d < d){
+    c = ((q + a) & (p ^ b)) + ((p - 21) & (c - d));
+  }else{
+    b = ((b + d) + (a | p)) | ((c & a) & (a + c));
+  }
+  a = ((d - q) & (c ^ c)) ^ ((c - 59) + (p & a));
+  for(i = 0; i < 28; i++){
+    d = ((c & 12) * (q ^ 97)) ^ ((a & a) * (b - p));
+  }
+  b = ((b * a) | (d | b)) * ((q ^ b) & (p * 64));
+  a = ((d + 71) ^ (p | q)) | ((d - b) - (a * 4));
+  if(a < 10){
+    d = ((p & b) - (a + q)) - ((b | 33) * (q | b));
+  }else{
+    b = ((q * p) * (b ^ q)) ^ ((c + d) ^ (b & q));
+  }
+  b = ((a | b) | (b & a)) & ((d + q) + (c + a));
+  a = ((q | b) + (q & d)) & ((c ^ 81) ^ (q * q));
+  d = ((p | 66) ^ (a * c)) & ((a - q) & (a - 8));
+  for(i = 0; i < 10; i++){
+    b = ((d | q) * (q | c)) ^ ((b + b) | (c * 41));
+  }
+  if(a < q){
+    c = ((a - p) + (d + b)) ^ ((b ^ c) ^ (q & b));
+  }else{
+    d = ((a ^ d) * (q ^ 62)) ^ ((d + q) - (b | b));
+  }
+  return a + b + c + d;
+}
+
+int func196(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 31;
+  c = ((q & b) - (a * a)) & ((b + 75) + (q + q));
+  a = ((p & a) * (c ^ d)) - ((q * 76) & (b ^ 36));
+  b = ((b * d) ^ (b * c)) ^ ((c + b) * (d | d));
+  b = ((b * d) * (d & p)) + ((b + b) + (q * 12));
+  if(b < d){
+    c = ((q & q) ^ (a * p)) ^ ((p + c) - (q & q));
+  }else{
+    a = ((b ^ 97) - (b * a)) + ((a | b) + (a * c));
+  }
+  c = ((d + p) | (d + b)) | ((d ^ 48) * (q ^ d));
+  for(i = 0; i < 35; i++){
+    b = ((p | a) - (a ^ 66)) & ((a ^ 87) | (b + 35));
+  }
+  a = ((a ^ 64) | (c * q)) - ((q - a) * (d - a));
+  d = ((p + p) ^ (a ^ p)) | ((p | a) ^ (q * p));
+  if(c < b){
+    a = ((a | d) - (c | q)) | ((p * q) + (a | b));
+  }else{
+    d = ((b | p) + (q & 44)) ^ ((p + 41) | (b + 19));
+  }
+  a = ((p | b) ^ (c ^ 26)) - ((q * b) - (b | 18));
+  a = ((d | b) | (p | c)) | ((p ^ c) * (d | 78));
+  d = ((b - d) - (q | p)) ^ ((p | 27) & (a - q));
+  for(i = 0; i < 39; i++){
+    c = ((d ^ 87) - (b * a)) ^ ((d | c) | (b + a));
+  }
+  if(d < p){
+    c = ((b * a) + (b | q)) + ((q | 27) + (b | 46));
+  }else{
+    b = ((c | 75) | (b & 75)) * ((p ^ q) - (a + b));
+  }
+  a = ((q ^ 63) + (q ^ b)) + ((q + p) ^ (b * d));
+  d = ((c & 62) | (q & d)) + ((c ^ 24) | (p * c));
+  b = ((p & b) * (d | 83)) * ((d - 26) - (b ^ d));
+  b = ((a - p) & (c - 25)) ^ ((a * p) | (a - p));
+  if(c < b){
+    d = ((q + d) - (c & 43)) ^ ((c ^ a) ^ (q * 48));
+  }else{
+    b = ((a - c) * (d - p)) - ((b * d) + (q ^ b));
+  }
+  for(i = 0; i < 42; i++){
+    b = ((p & 8) | (d * 69)) ^ ((p ^ q) + (q | a));
+  }
+  a = ((c | a) - (b ^ p)) + ((b - c) & (a * 76));
+  b = ((d + q) + (c | q)) * ((c | q) & (b | c));
+  a = ((p & d) + (q * c)) | ((q + q) | (b + 40));
+  if(b < d){
+    c = ((a + p) | (p - c)) & ((p + d) & (c ^ d));
+  }else{
+    a = ((c | 69) | (q & p)) | ((a & p) + (q * q));
+  }
+  a = ((c | q) ^ (b - a)) ^ ((q - a) ^ (d - a));
+  c = ((a * q) | (p & 89)) + ((a * 49) | (b * p));
+  for(i = 0; i < 39; i++){
+    c = ((a | b) | (b & p)) | ((c & b) | (q * q));
+  }
+  b = ((a + 78) ^ (c - 13)) - ((b ^ c) * (q & q));
+  if(a < p){
+    d = ((p ^ b) + (p * q)) - ((b - p) * (p * c));
+  }else{
+    d = ((b - b) | (q ^ d)) - ((p | q) | (q & 16));
+  }
+  b = ((p * a) * (p - p)) + ((a * 99) - (a | d));
+  c = ((p - a) * (b - b)) & ((b + c) & (p + d));
+  c = ((b - c) & (p | q)) + ((c | 92) ^ (q | a));
+  d = ((p | p) & (q ^ p)) - ((b * c) * (q & q));
+  if(c < c){
+    c = ((c & c) ^ (p | 29)) - ((q - a) & (p - 51));
+  }else{
+    c = ((b * d) * (p + 87)) - ((p | d) & (p - b));
+  }
+  b = ((c & b) - (p | b)) * ((p - b) & (q + b));
+  b = ((d - 85) ^ (q + a)) | ((c + c) & (c + d));
+  a = ((c + c) | (c * p)) | ((b & 54) | (b | d));
+  d = ((q - q) | (d ^ b)) + ((b * q) ^ (p ^ c));
+  if(b < 1){
+    a = ((q & c) | (c * b)) ^ ((d - 44) ^ (q - 93));
+  }else{
+    a = ((d + q) * (b - a)) & ((q & c) * (a - b));
+  }
+  d = ((q ^ 18) * (a + 89)) - ((b & p) * (d * a));
+  for(i = 0; i < 41; i++){
+    a = ((p ^ d) + (d ^ 77)) + ((d & 7) - (q & 32));
+  }
+  b = ((p | 50) & (c + 98)) & ((c + q) ^ (a | a));
+  d = ((b + 76) ^ (b | 26)) ^ ((p & c) - (a * b));
+  if(c < q){
+    d = ((c | a) + (c + 68)) + ((a * 95) | (c + q));
+  }else{
+    d = ((q * b) ^ (p & c)) ^ ((c | 60) & (b & c));
+  }
+  c = ((d ^ d) | (b * p)) * ((a & p) & (d - 96));
+  d = ((d * p) & (c ^ b)) & ((c & c) & (p - d));
+  c = ((c * q) - (p | p)) * ((p - b) ^ (c * d));
+  for(i = 0; i < 29; i++){
+    a = ((q | q) + (p & 88)) * ((d + 54) & (p & 45));
+  }
+  if(c < b){
+    c = ((p - d) - (b & p)) | ((q - p) * (b * q));
+  }else{
+    c = ((a | a) * (c + 76)) | ((a + q) ^ (a - a));
+  }
+  return a + b + c + d;
+}
+
+int func197(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 90;
+  d = 90;
+  d = ((b - b) - (b & 52)) | ((b | 61) * (c * 61));
+  c = ((d + p) | (d & b)) - ((q - d) & (a - p));
+  b = ((q ^ 5) ^ (b - c)) | ((b + q) * (c * 79));
+  b = ((c + q) * (p ^ 38)) * ((c - a) ^ (a | b));
+  if(d < d){
+    c = ((q & a) & (q & q)) & ((d * 75) & (d | c));
+  }else{
+    c = ((b - a) | (c | b)) | ((p + c) & (c | b));
+  }
+  a = ((p + c) ^ (a | p)) ^ ((a ^ d) + (b - b));
+  for(i = 0; i < 8; i++){
+    c = ((c - 37) - (q + c)) - ((a | b) ^ (c & 95));
+  }
+  d = ((p & c) - (b * c)) * ((a + q) ^ (d ^ d));
+  c = ((q + c) * (d | d)) * ((b - 27) | (p - p));
+  if(d < b){
+    a = ((a ^ 71) - (c + 77)) - ((b - p) + (p * a));
+  }else{
+    b = ((a + q) + (b + d)) - ((q * a) * (a ^ p));
+  }
+  a = ((a - b) & (d | a)) * ((b | d) | (b - p));
+  a = ((a - c) - (q * c)) - ((p * b) | (b | d));
+  b = ((b - 92) + (b + q)) & ((a ^ 25) ^ (a * d));
+  for(i = 0; i < 35; i++){
+    b = ((p ^ 66) & (p * b)) | ((q - 11) + (b ^ d));
+  }
+  if(d < c){
+    a = ((c - 80) * (q & d)) & ((d * c) * (d | q));
+  }else{
+    a = ((q * d) + (b * p)) * ((p - p) & (p + d));
+  }
+  d = ((c * p) + (b & c)) | ((a | c) & (c ^ 20));
+  d = ((b & q) ^ (p * b)) ^ ((q ^ b) ^ (q | a));
+  a = ((d | q) + (p + 37)) ^ ((a ^ 15) ^ (a * 89));
+  a = ((d - p) * (d + c)) - ((a ^ b) | (p + q));
+  if(b < q){
+    b = ((p | 28) - (c | a)) - ((d + b) + (d * a));
+  }else{
+    c = ((d | a) - (p ^ q)) | ((c | d) * (c * c));
+  }
+  for(i = 0; i < 38; i++){
+    b = ((q & p) & (p - c)) ^ ((d - b) * (d - 88));
+  }
+  d = ((q - q) ^ (q - q)) + ((d ^ p) * (b - d));
+  d = ((c ^ 96) + (q | 20)) & ((c ^ a) & (d & q));
+  a = ((d & b) | (a - 82)) & ((a - p) | (a & d));
+  if(a < b){
+    d = ((p | 99) + (b | q)) | ((q ^ c) - (p * 12));
+  }else{
+    a = ((q | c) | (b + a)) ^ ((p - d) | (p ^ b));
+  }
+  b = ((d & q) & (a & p)) & ((b | 39) & (a * a));
+  d = ((c ^ b) - (a + a)) * ((b * d) & (b + d));
+  for(i = 0; i < 4; i++){
+    c = ((a ^ 83) + (c - q)) * ((p * 31) & (q + b));
+  }
+  c = ((p * 5) | (c + 44)) ^ ((d - a) & (a | a));
+  if(d < c){
+    a = ((q * p) & (b * p)) | ((p * p) * (c ^ d));
+  }else{
+    a = ((q ^ 38) ^ (d & q)) * ((q + d) * (p | 87));
+  }
+  d = ((p - p) & (d | d)) * ((b * 10) - (a | q));
+  a = ((b | d) - (p - a)) ^ ((p * 81) ^ (p + d));
+  a = ((b + q) & (q ^ p)) - ((c * b) - (b & p));
+  b = ((a & d) ^ (p ^ b)) | ((p + c) | (a - c));
+  if(b < p){
+    a = ((q & 66) * (b + a)) | ((a * c) + (c & c));
+  }else{
+    a = ((c * q) | (c - 55)) * ((p ^ 51) - (d * 41));
+  }
+  a = ((a ^ c) | (q - b)) | ((d & 38) | (p ^ d));
+  a = ((d ^ a) * (c & q)) ^ ((c + a) + (b + c));
+  d = ((d | q) * (c * q)) * ((q * d) | (d * c));
+  b = ((b & p) | (c & q)) * ((b & c) ^ (c + d));
+  if(a < q){
+    b = ((q - b) * (d + q)) & ((a | b) + (c + c));
+  }else{
+    c = ((q ^ b) - (q - 88)) & ((p ^ d) ^ (d + d));
+  }
+  d = ((b & q) - (b * a)) | ((q | b) * (b | 45));
+  for(i = 0; i < 36; i++){
+    b = ((q & 61) + (d * p)) | ((a * d) ^ (a & q));
+  }
+  c = ((a + p) + (a + 79)) | ((b & a) - (c - p));
+  c = ((b & b) - (b ^ 71)) + ((a + 5) ^ (q * q));
+  if(d < 40){
+    d = ((c - p) | (d & 59)) * ((a * c) & (b * 2));
+  }else{
+    a = ((d ^ a) * (c * 53)) ^ ((d * a) + (c ^ p));
+  }
+  a = ((q * a) - (c * 80)) * ((d + q) + (d & 69));
+  b = ((d ^ 62) & (d | b)) ^ ((d ^ d) ^ (q + a));
+  d = ((d | a) - (d & a)) | ((q * a) & (b ^ 28));
+  for(i = 0; i < 5; i++){
+    c = ((p - q) ^ (b ^ a)) - ((q ^ a) & (c * p));
+  }
+  if(a < c){
+    b = ((b * p) & (p - a)) * ((c ^ c) - (c + 65));
+  }else{
+    b = ((p & c) | (b - a)) ^ ((p | a) + (q * p));
+  }
+  return a + b + c + d;
+}
+
+int func198(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 96;
+  d = 28;
+  c = ((d * d) * (q - 36)) ^ ((q ^ 7) | (p + q));
+  c = ((p * p) & (p - 42)) & ((p ^ d) * (d + p));
+  d = ((p - a) - (q ^ a)) ^ ((p * c) | (a * d));
+  c = ((q | c) | (a ^ 17)) - ((c | q) + (b & p));
+  if(d < a){
+    b = ((q & q) ^ (a - q)) * ((c - a) - (b | p));
+  }else{
+    c = ((q * a) | (q - c)) + ((a ^ 9) + (q & q));
+  }
+  d = ((a ^ b) - (c & 14)) & ((b & 92) & (c + p));
+  for(i = 0; i < 23; i++){
+    d = ((c - a) - (b - a)) * ((q & c) * (q * q));
+  }
+  b = ((b - q) + (q & 24)) | ((b * p) | (a & q));
+  c = ((c ^ b) * (p ^ p)) & ((b & d) - (a ^ a));
+  if(b < d){
+    d = ((q ^ p) * (c ^ 75)) | ((b & a) * (q + b));
+  }else{
+    b = ((p & q) + (p ^ c)) + ((b & b) | (a ^ a));
+  }
+  a = ((a | p) - (p * p)) & ((d ^ d) & (c + q));
+  c = ((c - 28) - (b ^ 42)) * ((a * 12) & (c * 2));
+  d = ((q * a) ^ (d ^ a)) | ((q & 83) | (p ^ p));
+  for(i = 0; i < 36; i++){
+    c = ((c | q) & (d ^ 31)) + ((d | p) ^ (a + c));
+  }
+  if(c < p){
+    d = ((a | b) - (c * d)) * ((a & 83) + (a - p));
+  }else{
+    d = ((d + d) ^ (d + 48)) | ((b & d) + (q * 46));
+  }
+  d = ((d ^ 23) + (a - 97)) | ((p | a) | (b & 56));
+  a = ((p ^ p) | (a & d)) * ((q - b) * (p * p));
+  d = ((p * q) ^ (p * 8)) | ((a * p) + (p | 25));
+  d = ((a + q) + (b & c)) + ((b | b) + (d ^ b));
+  if(b < b){
+    b = ((q + b) * (q ^ 31)) | ((d + q) & (q & q));
+  }else{
+    b = ((c + 93) + (a - q)) - ((a * 61) + (c & q));
+  }
+  for(i = 0; i < 46; i++){
+    d = ((d | q) ^ (b - p)) ^ ((c * p) ^ (q ^ c));
+  }
+  b = ((d + c) * (p - b)) & ((c | 97) * (c | 82));
+  d = ((p & 62) * (b ^ p)) + ((p | q) ^ (q - q));
+  c = ((a + 72) - (q * q)) | ((b - a) ^ (q + p));
+  if(c < q){
+    b = ((a | 82) ^ (d ^ a)) * ((q | a) - (q | d));
+  }else{
+    b = ((a * q) | (q - c)) & ((a - 98) * (d + d));
+  }
+  c = ((b - d) - (d + a)) + ((a - 47) ^ (q & b));
+  d = ((p & 85) | (a * p)) - ((p - 87) + (q | q));
+  for(i = 0; i < 23; i++){
+    b = ((a - a) * (d & d)) | ((d & a) | (p ^ 62));
+  }
+  d = ((p * a) & (c & b)) * ((d + d) ^ (d * q));
+  if(b < 35){
+    d = ((a * 33) * (b * b)) * ((b - d) & (p & d));
+  }else{
+    c = ((d & d) * (a * c)) - ((a | p) | (c * c));
+  }
+  d = ((p ^ a) - (p | a)) + ((d - 31) & (p * c));
+  d = ((a * 72) + (p - 99)) + ((b * a) & (p | 62));
+  a = ((p & c) & (a + b)) + ((p & d) + (p & c));
+  a = ((b & a) | (p * c)) & ((c * 53) * (q * 7));
+  if(d < 86){
+    d = ((q | a) + (a ^ p)) - ((b | 78) ^ (p * p));
+  }else{
+    c = ((b - 63) * (q * 44)) | ((c ^ p) | (d * 67));
+  }
+  c = ((a & b) * (a - 64)) - ((b + 13) + (q + 74));
+  c = ((b - c) ^ (d & 28)) + ((b * a) * (b - 21));
+  b = ((b ^ 79) & (q + d)) - ((q ^ 54) | (d ^ 57));
+  d = ((p & c) & (c & a)) ^ ((a + b) & (q ^ p));
+  if(c < c){
+    b = ((c - 58) | (a + q)) | ((p & 59) | (a * q));
+  }else{
+    a = ((c * p) * (c + 22)) ^ ((a * 48) ^ (c & 54));
+  }
+  a = ((d * 50) & (d + 80)) - ((q - q) & (d & b));
+  for(i = 0; i < 5; i++){
+    b = ((p & d) + (d + 51)) & ((c | d) | (p & 71));
+  }
+  c = ((a & q) | (p ^ c)) + ((p & 82) * (p & p));
+  b = ((p - d) * (c * b)) - ((p | c) | (b | a));
+  if(d < q){
+    b = ((c ^ p) | (p | b)) - ((a | a) - (d + 61));
+  }else{
+    d = ((p ^ a) | (b & 14)) + ((c ^ c) | (a ^ b));
+  }
+  b = ((q + 10) & (q | d)) + ((b | d) * (b + p));
+  d = ((q + b) | (b ^ d)) ^ ((p + 38) * (c * 83));
+  c = ((d + q) & (p ^ c)) & ((p & q) & (q ^ 93));
+  for(i = 0; i < 27; i++){
+    d = ((q | 82) - (c + c)) & ((p * b) * (d | 47));
+  }
+  if(b < c){
+    c = ((c - p) ^ (d ^ 51)) + ((p | d) | (d & p));
+  }else{
+    c = ((c + d) - (a & 45)) - ((q * d) | (q | p));
+  }
+  return a + b + c + d;
+}
+
+int func199(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 58;
+  d = 16;
+  a = ((a * q) | (c + c)) & ((q ^ b) * (q | q));
+  d = ((c - p) | (c & b)) + ((q ^ 69) - (a + d));
+  d = ((b + b) | (c & b)) * ((p * 22) & (a + b));
+  d = ((p * b) * (c - b)) | ((a + p) & (p - c));
+  if(d < 28){
+    c = ((p + c) - (a & c)) - ((d | d) - (a + p));
+  }else{
+    d = ((d - a) ^ (d * a)) ^ ((a | 21) ^ (q - c));
+  }
+  c = ((a ^ c) * (q ^ 29)) | ((a | p) ^ (a | b));
+  for(i = 0; i < 33; i++){
+    a = ((d | 55) + (p + a)) & ((p + q) | (q ^ c));
+  }
+  a = ((a - 65) | (p ^ 52)) * ((d ^ q) + (b | 25));
+  a = ((c ^ q) * (p | a)) & ((q - q) * (c ^ 65));
+  if(c < c){
+    d = ((q + b) * (b * 28)) ^ ((b + b) ^ (d | 77));
+  }else{
+    b = ((d ^ 32) ^ (p & p)) | ((a & p) | (a & c));
+  }
+  d = ((q - c) * (q & c)) - ((a | 44) ^ (d * a));
+  b = ((d - p) + (a + q)) & ((c & c) - (a | b));
+  b = ((c * d) + (c | q)) + ((c | b) - (a * q));
+  for(i = 0; i < 40; i++){
+    d = ((a & p) ^ (d | q)) - ((p - 53) - (d + 39));
+  }
+  if(d < a){
+    d = ((d - d) & (p + d)) | ((a ^ q) + (c | d));
+  }else{
+    b = ((b - 84) & (p * 58)) & ((q - 26) * (q | a));
+  }
+  c = ((d + p) | (c * p)) ^ ((c * d) + (q - 82));
+  d = ((p & 65) ^ (c & p)) - ((d - c) - (a | 97));
+  d = ((p ^ q) - (d ^ 28)) * ((a ^ b) - (p + c));
+  d = ((d + d) ^ (b - a)) * ((a + q) | (c & a));
+  if(b < 57){
+    a = ((p | 83) + (q | q)) + ((a + b) ^ (q | d));
+  }else{
+    c = ((a ^ 89) + (a - d)) ^ ((q + c) + (a - c));
+  }
+  for(i = 0; i < 47; i++){
+    a = ((d - q) & (b ^ d)) ^ ((p + p) | (p ^ c));
+  }
+  b = ((b & c) | (p & 27)) | ((b * 43) - (p ^ 96));
+  d = ((b | d) ^ (b | 57)) + ((a | d) ^ (p - p));
+  d = ((c + b) | (d * a)) & ((q + q) + (a * c));
+  if(d < a){
+    c = ((b | c) & (c & c)) - ((c ^ p) + (a ^ b));
+  }else{
+    a = ((b + c) & (p & a)) * ((p * a) ^ (c & c));
+  }
+  b = ((b + q) * (a - p)) & ((b & 55) & (p * q));
+  d = ((d - 47) * (p & b)) + ((p | b) & (p + 15));
+  for(i = 0; i < 27; i++){
+    d = ((a ^ b) ^ (d ^ q)) * ((a * q) ^ (d + p));
+  }
+  b = ((p - c) & (c ^ a)) - ((b - q) - (a * b));
+  if(c < 41){
+    c = ((d - a) & (d - d)) | ((q ^ a) * (q * 87));
+  }else{
+    b = ((a ^ q) ^ (p + c)) & ((q | 34) & (d ^ d));
+  }
+  a = ((c ^ p) * (d * b)) & ((a - c) ^ (d | b));
+  c = ((c * c) * (a & p)) & ((q | a) ^ (c | c));
+  c = ((b * 36) - (q + 91)) - ((p + c) * (d | p));
+  c = ((c + p) | (d & 73)) + ((q * p) + (a + 27));
+  if(c < c){
+    a = ((a & q) ^ (a * q)) & ((a * a) ^ (d | q));
+  }else{
+    c = ((q * b) ^ (p & d)) & ((d + q) * (c | p));
+  }
+  b = ((q * 50) | (d | p)) ^ ((b * 33) & (b + 21));
+  d = ((c & 73) & (q + b)) ^ ((q * c) & (q * q));
+  b = ((q * 78) - (b | b)) + ((q & b) & (p | a));
+  b = ((b ^ p) + (b & q)) + ((d | p) | (b ^ d));
+  if(c < a){
+    a = ((b & d) * (p ^ c)) * ((q + 36) ^ (d - c));
+  }else{
+    c = ((d | d) | (a ^ d)) & ((p - 20) | (a | 4));
+  }
+  a = ((a * q) ^ (d * 59)) | ((d ^ d) ^ (a & 83));
+  for(i = 0; i < 12; i++){
+    c = ((a & b) | (q ^ c)) | ((c + c) - (p * q));
+  }
+  a = ((a + c) & (c ^ 11)) + ((b | q) ^ (p | d));
+  c = ((q ^ 25) ^ (a * b)) & ((d | 16) ^ (q - d));
+  if(a < p){
+    d = ((b | 52) - (d ^ c)) * ((d & p) * (c | c));
+  }else{
+    a = ((d - c) ^ (p - b)) * ((c - d) & (c & b));
+  }
+  c = ((d | 37) - (a & b)) - ((p * b) | (d * d));
+  b = ((a + c) ^ (b | d)) ^ ((c * p) * (d - p));
+  d = ((p | q) & (d ^ 53)) + ((c - p) ^ (q & b));
+  for(i = 0; i < 9; i++){
+    b = ((b & c) ^ (a | a)) + ((a & q) ^ (c * p));
+  }
+  if(b < a){
+    d = ((c * b) * (p * c)) ^ ((c * a) ^ (b | b));
+  }else{
+    b = ((d ^ c) | (c * 18)) & ((q | b) ^ (q | c));
+  }
+  return a + b + c + d;
+}
+
+int func200(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 6;
+  d = 13;
+  b = ((c & c) ^ (q & d)) | ((d - 71) * (p & d));
+  b = ((a | 91) & (q | p)) - ((c + d) ^ (b | 8));
+  d = ((p * 86) ^ (p - d)) * ((b ^ 17) * (p ^ 7));
+  a = ((p * c) - (d * d)) * ((a | p) - (d * 18));
+  if(b < b){
+    b = ((d ^ b) & (b | p)) - ((a * 77) - (b + 6));
+  }else{
+    a = ((d | 44) & (p ^ 38)) + ((q * c) + (b ^ d));
+  }
+  b = ((d & 99) - (c & 17)) & ((c | c) & (d - d));
+  for(i = 0; i < 37; i++){
+    c = ((d * c) + (d * p)) ^ ((q ^ 31) + (b | b));
+  }
+  b = ((d - a) + (d * 41)) - ((d - p) ^ (q & q));
+  d = ((p | b) | (d | d)) & ((p * a) & (p ^ b));
+  if(a < b){
+    b = ((q | q) | (d & 28)) * ((q - 40) | (p * p));
+  }else{
+    a = ((q * 49) | (a * p)) | ((c - b) * (c & c));
+  }
+  c = ((q | q) + (b | 82)) * ((q | a) | (b - c));
+  d = ((a - q) + (q * c)) ^ ((c | a) ^ (a * 94));
+  a = ((q ^ b) | (b & a)) | ((b ^ b) - (b - q));
+  for(i = 0; i < 50; i++){
+    d = ((c - d) ^ (q & d)) * ((a + 28) - (d & d));
+  }
+  if(b < 73){
+    d = ((p - q) & (d ^ p)) & ((a - d) | (b & 27));
+  }else{
+    c = ((p ^ 53) + (b - 93)) | ((b | 25) | (a & p));
+  }
+  a = ((c * q) - (c * d)) + ((p & q) + (a + 3));
+  c = ((b + b) | (d | d)) | ((c & b) * (d * p));
+  d = ((q ^ 36) * (a * p)) * ((d + p) + (q * a));
+  c = ((a ^ 98) ^ (a + p)) * ((p * q) ^ (d ^ 73));
+  if(b < d){
+    d = ((q ^ a) - (q + q)) + ((b & a) * (q & b));
+  }else{
+    d = ((p ^ b) | (p + d)) + ((a & a) | (d ^ p));
+  }
+  for(i = 0; i < 7; i++){
+    b = ((a + q) & (d + q)) + ((q & b) | (p - d));
+  }
+  a = ((d - 84) + (b & d)) | ((q | b) | (c * 64));
+  b = ((q * b) | (b - 79)) & ((c + 73) * (a + 25));
+  a = ((a & 32) | (b - 64)) - ((a & q) ^ (q * c));
+  if(c < b){
+    c = ((a + b) * (b + b)) | ((a + 82) & (p - p));
+  }else{
+    b = ((q - d) & (p - a)) | ((p & 21) | (c - a));
+  }
+  c = ((q + c) - (p + d)) - ((c ^ b) ^ (d * q));
+  b = ((c | q) & (c * 72)) ^ ((a ^ b) & (d | p));
+  for(i = 0; i < 21; i++){
+    c = ((d & p) + (q & p)) | ((a | a) & (p + a));
+  }
+  a = ((q * b) * (a * q)) | ((d | q) * (c | a));
+  if(c < p){
+    c = ((q ^ b) ^ (a & p)) ^ ((q - 7) - (p * p));
+  }else{
+    a = ((q & b) & (c + b)) & ((p ^ b) + (c ^ d));
+  }
+  c = ((c | c) * (p + 57)) ^ ((q + 48) ^ (d + c));
+  c = ((q + p) & (q ^ q)) | ((c - d) - (a * 14));
+  a = ((c + b) ^ (a + b)) | ((b - b) ^ (a - b));
+  d = ((b - a) * (a - d)) & ((p | 56) + (b * b));
+  if(d < c){
+    a = ((q * 89) | (d * p)) + ((c + d) ^ (d + b));
+  }else{
+    c = ((b + q) ^ (c | q)) ^ ((c + c) & (p ^ 92));
+  }
+  c = ((c & a) + (d * 39)) * ((b + p) ^ (p ^ p));
+  a = ((p * q) * (d | 55)) - ((b ^ 41) - (c * 57));
+  d = ((a & c) ^ (a + b)) - ((c - p) & (q | b));
+  c = ((p ^ q) * (b - b)) ^ ((c - p) + (p ^ a));
+  if(d < 55){
+    d = ((a * d) ^ (d | p)) & ((c * 49) + (d + a));
+  }else{
+    b = ((c | d) + (a * c)) | ((b * 63) + (a * 91));
+  }
+  a = ((a * c) - (c + b)) * ((q & 74) + (q | 97));
+  for(i = 0; i < 10; i++){
+    c = ((a | 53) | (d & q)) | ((d & q) * (p - d));
+  }
+  a = ((a ^ b) + (c - 6)) - ((d ^ 86) * (q + 23));
+  a = ((q + a) * (p ^ d)) | ((d | p) | (a - c));
+  if(c < p){
+    a = ((d - b) & (a * 64)) - ((b & a) * (p | c));
+  }else{
+    c = ((c + 84) ^ (q ^ b)) * ((q ^ q) + (a * 7));
+  }
+  c = ((q & p) + (c | a)) - ((b ^ 31) + (b * q));
+  d = ((b | c) & (q * b)) - ((c & c) + (p - c));
+  c = ((q * a) ^ (q ^ d)) ^ ((q * b) + (a | b));
+  for(i = 0; i < 13; i++){
+    c = ((p ^ 64) + (b & a)) + ((a - b) | (c * c));
+  }
+  if(d < 17){
+    d = ((p & a) + (b & c)) ^ ((p - 57) - (p | p));
+  }else{
+    c = ((p + c) | (p + q)) * ((b - d) ^ (d * q));
+  }
+  return a + b + c + d;
+}
+
+int func201(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 72;
+  d = 67;
+  c = ((q * p) - (q & 9)) - ((b + b) - (a - c));
+  d = ((c & p) ^ (a + p)) + ((a - 96) & (d | d));
+  b = ((c + c) & (d + b)) * ((a ^ a) | (q * 82));
+  d = ((p + d) - (b + b)) * ((p * 22) ^ (d | d));
+  if(c < c){
+    b = ((d | 1) - (p + p)) ^ ((a + c) - (p | 80));
+  }else{
+    b = ((c + b) & (c * p)) ^ ((a | a) + (q ^ p));
+  }
+  c = ((q + q) + (c | d)) * ((c | c) ^ (p - a));
+  for(i = 0; i < 42; i++){
+    b = ((d - d) - (p & q)) * ((p ^ d) * (b - a));
+  }
+  b = ((p * a) ^ (a | a)) - ((a * q) * (p | d));
+  b = ((p & 60) - (b + b)) ^ ((p & c) - (p ^ b));
+  if(b < d){
+    a = ((c & a) & (c - p)) & ((a - p) + (p - d));
+  }else{
+    d = ((a & q) ^ (b * a)) ^ ((c * c) * (c ^ d));
+  }
+  b = ((q * q) ^ (a - 74)) ^ ((d - c) ^ (q & 15));
+  a = ((b ^ 9) & (p + 84)) + ((b + q) | (b & 73));
+  a = ((p - p) | (a & q)) | ((q | 27) | (q - 61));
+  for(i = 0; i < 43; i++){
+    a = ((c ^ 13) & (d * 81)) & ((q + c) + (b * c));
+  }
+  if(c < q){
+    b = ((p & 57) & (q | d)) - ((a & p) + (b - p));
+  }else{
+    c = ((d & b) * (p + c)) & ((a - p) + (a | c));
+  }
+  c = ((b ^ a) | (q | d)) - ((c - p) + (a | a));
+  a = ((q | b) * (p * c)) + ((d & 98) - (a | 48));
+  b = ((b & p) - (c & p)) - ((q ^ q) | (b | c));
+  c = ((p | 22) + (p ^ b)) ^ ((p & 59) ^ (a & b));
+  if(d < q){
+    c = ((p ^ q) & (p | p)) & ((c - d) ^ (b + 75));
+  }else{
+    c = ((d ^ a) ^ (d & d)) ^ ((a | 51) | (a + 14));
+  }
+  for(i = 0; i < 33; i++){
+    d = ((p + a) ^ (q ^ 8)) + ((p ^ d) - (p + q));
+  }
+  a = ((b * c) ^ (b + 88)) ^ ((a - p) | (b | a));
+  b = ((p & d) | (b * d)) - ((p * p) & (a ^ 6));
+  b = ((b & a) * (d & b)) ^ ((b & 43) ^ (c - a));
+  if(a < 88){
+    d = ((p | 66) + (p * p)) * ((b & b) - (q - q));
+  }else{
+    d = ((a ^ b) & (b * p)) | ((p * 91) ^ (a ^ d));
+  }
+  a = ((d | 86) + (d ^ d)) | ((b - 37) * (d | c));
+  b = ((b * 54) ^ (c - c)) ^ ((c - 33) | (a & d));
+  for(i = 0; i < 38; i++){
+    c = ((p * 53) * (p + d)) & ((b + p) | (a & b));
+  }
+  a = ((b & q) & (q + 84)) ^ ((b | d) - (c - b));
+  if(a < a){
+    d = ((q | 72) * (p ^ p)) + ((d ^ 30) ^ (p | a));
+  }else{
+    b = ((b & a) ^ (c * c)) | ((q + p) & (a | p));
+  }
+  c = ((q ^ d) + (q | 50)) ^ ((c + q) ^ (b ^ p));
+  d = ((c * 43) + (q - d)) * ((q - d) - (c * c));
+  b = ((b ^ p) & (q & p)) + ((a | 32) + (c - b));
+  b = ((b & d) ^ (q + b)) - ((a & d) * (q & 62));
+  if(a < d){
+    d = ((d - p) * (c & c)) + ((p + q) & (d ^ c));
+  }else{
+    c = ((c - 3) + (d - a)) | ((p * 47) * (c & q));
+  }
+  c = ((c ^ c) * (a | 3)) | ((p | d) - (a ^ 38));
+  c = ((b * c) * (q - q)) | ((q ^ q) - (d & b));
+  d = ((b & a) ^ (d & a)) + ((c - 77) - (d ^ p));
+  b = ((q ^ p) | (d ^ d)) + ((c - b) | (b & c));
+  if(d < c){
+    b = ((d + p) + (a & b)) - ((a + 57) ^ (q + p));
+  }else{
+    c = ((a + b) + (p | q)) - ((b | c) * (c ^ b));
+  }
+  d = ((b & 92) * (b - 93)) * ((c | p) & (b | 72));
+  for(i = 0; i < 30; i++){
+    b = ((c & 68) * (a | p)) & ((b * 97) + (b + a));
+  }
+  b = ((q & a) * (a * a)) | ((b - 34) ^ (b | 40));
+  c = ((p | d) ^ (a & 65)) - ((c ^ 7) - (b ^ q));
+  if(a < q){
+    c = ((b + b) & (p * a)) ^ ((p + 25) + (q + 45));
+  }else{
+    d = ((c | a) + (b - a)) | ((p & b) | (d & 19));
+  }
+  a = ((q | 49) & (a + 47)) | ((p * q) - (d ^ b));
+  d = ((c | c) + (c ^ 97)) & ((q | p) + (a - 97));
+  a = ((a - 55) + (p ^ b)) - ((d + p) | (c * 76));
+  for(i = 0; i < 11; i++){
+    a = ((b + p) | (q ^ d)) * ((q - 80) - (b | q));
+  }
+  if(c < p){
+    c = ((p + p) + (p & p)) * ((b | q) & (q & p));
+  }else{
+    c = ((p ^ d) + (b * q)) * ((b & a) ^ (q & d));
+  }
+  return a + b + c + d;
+}
+
+int func202(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 74;
+  c = ((d - q) & (a | a)) & ((q ^ b) ^ (d * 38));
+  d = ((b - 72) & (a & q)) & ((c | p) ^ (q & p));
+  b = ((p + c) & (p + c)) - ((a & a) - (a & p));
+  a = ((c * q) - (p | a)) - ((c & 54) ^ (p + b));
+  if(c < c){
+    b = ((p * c) & (b + q)) + ((a | 27) - (c | a));
+  }else{
+    c = ((q + a) & (c | b)) * ((d | p) & (q | d));
+  }
+  b = ((q ^ 92) | (q & 38)) + ((p - 88) & (q | q));
+  for(i = 0; i < 16; i++){
+    c = ((b - q) ^ (q + p)) * ((a ^ c) + (p & q));
+  }
+  a = ((a + c) + (a * d)) ^ ((q * 62) - (a ^ d));
+  b = ((q ^ 44) - (p * q)) | ((c + a) - (d + p));
+  if(a < d){
+    b = ((q ^ q) + (p + b)) - ((d ^ b) - (q * 67));
+  }else{
+    a = ((a * c) + (c - a)) | ((d & 61) ^ (d + q));
+  }
+  a = ((a ^ 38) | (q + a)) * ((b - c) ^ (b + p));
+  d = ((q - p) * (b * b)) - ((b & q) | (b + 41));
+  a = ((b & p) - (d | p)) ^ ((a & 16) ^ (c + p));
+  for(i = 0; i < 28; i++){
+    d = ((a ^ p) ^ (q * c)) ^ ((c | b) & (p & 75));
+  }
+  if(b < c){
+    b = ((a | 79) + (a | p)) - ((b + q) & (c + a));
+  }else{
+    c = ((b | d) & (d + 11)) * ((a & 72) + (q + c));
+  }
+  a = ((a + c) * (q | q)) ^ ((b * 54) ^ (q & q));
+  c = ((c + a) + (p ^ 77)) & ((b | d) & (a * p));
+  b = ((q - a) - (a ^ b)) + ((p - q) - (p + d));
+  d = ((p * q) & (a + a)) + ((a * 76) & (q | q));
+  if(c < a){
+    b = ((d | c) - (a * c)) ^ ((a & 43) + (q - c));
+  }else{
+    c = ((p | q) & (c & a)) - ((c - c) & (b & q));
+  }
+  for(i = 0; i < 4; i++){
+    d = ((p - 34) | (p ^ c)) - ((b - 99) - (b - q));
+  }
+  c = ((a - c) - (p + 32)) | ((p * d) * (p ^ 65));
+  c = ((b * a) & (c + p)) ^ ((b - a) ^ (q * q));
+  b = ((b ^ a) - (d * p)) ^ ((q + d) & (d ^ a));
+  if(c < a){
+    a = ((a | c) * (p + 16)) ^ ((d + 5) & (d - b));
+  }else{
+    c = ((b ^ p) * (q ^ a)) ^ ((b - a) * (a - 28));
+  }
+  a = ((p & a) ^ (b + 21)) + ((a & d) | (c - 64));
+  c = ((a - p) | (b * p)) | ((q | b) | (c & p));
+  for(i = 0; i < 24; i++){
+    a = ((a * 74) | (q + p)) ^ ((d + c) ^ (d * 56));
+  }
+  b = ((p | a) & (a & q)) - ((d | q) ^ (a & b));
+  if(d < c){
+    d = ((b * d) & (q & c)) + ((p | c) | (p ^ c));
+  }else{
+    d = ((b - 51) | (p * b)) | ((b & 79) | (c + d));
+  }
+  d = ((b ^ a) + (d - 40)) + ((p - c) + (p * c));
+  a = ((c & b) + (d - q)) - ((c * a) & (a ^ d));
+  a = ((p | b) * (a * 14)) - ((b ^ c) + (b * a));
+  c = ((q - p) + (p ^ d)) & ((a ^ q) & (c - 96));
+  if(c < d){
+    a = ((b - d) - (p - 6)) & ((d + 50) ^ (p ^ p));
+  }else{
+    d = ((a ^ q) - (b * d)) - ((p - 59) | (a - c));
+  }
+  c = ((q * 48) - (a + 89)) + ((p + 6) - (c | q));
+  c = ((q & 2) & (b & q)) ^ ((c ^ d) & (p ^ 18));
+  a = ((c & c) | (b | c)) + ((p + c) - (d * 56));
+  d = ((d & a) & (a | p)) - ((c & 38) | (p * q));
+  if(b < b){
+    a = ((b * p) - (d ^ 42)) * ((b | d) ^ (b + c));
+  }else{
+    d = ((b - p) + (a * 47)) - ((b ^ c) * (a * 34));
+  }
+  b = ((q + b) + (a ^ c)) ^ ((b + a) & (p * c));
+  for(i = 0; i < 11; i++){
+    c = ((q ^ q) - (q | a)) | ((q - d) ^ (q | b));
+  }
+  d = ((p - d) + (d & 15)) - ((b & a) - (q ^ c));
+  d = ((d - q) - (q + c)) + ((b + p) - (c ^ q));
+  if(b < 12){
+    d = ((b & b) & (b | 87)) - ((a + c) - (c ^ d));
+  }else{
+    c = ((c & 19) + (p | a)) ^ ((d * 97) & (c | 69));
+  }
+  a = ((a + 4) | (c + a)) | ((b & p) + (p ^ q));
+  d = ((c * b) & (b - c)) | ((a & b) | (b + 34));
+  d = ((c & d) ^ (b * d)) - ((p + c) | (d + 15));
+  for(i = 0; i < 2; i++){
+    d = ((b + 56) * (p ^ 64)) + ((d | p) + (c + c));
+  }
+  if(d < p){
+    c = ((q ^ d) + (b * p)) * ((a ^ p) + (b | 55));
+  }else{
+    c = ((q ^ 18) - (c & q)) * ((b | d) & (b * 99));
+  }
+  return a + b + c + d;
+}
+
+int func203(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 88;
+  d = 11;
+  a = ((d ^ d) * (a | c)) ^ ((b & c) | (p ^ p));
+  a = ((p ^ c) ^ (q & b)) | ((a ^ d) * (d ^ 41));
+  a = ((a ^ b) & (c | q)) * ((d + b) - (b & a));
+  a = ((c + p) | (c + 72)) + ((q * d) * (q + q));
+  if(d < b){
+    c = ((p + d) & (c * p)) | ((a + b) * (b ^ p));
+  }else{
+    b = ((b * a) | (a ^ d)) - ((a | d) ^ (p * q));
+  }
+  b = ((a + a) | (a - a)) + ((d & a) - (d & d));
+  for(i = 0; i < 16; i++){
+    c = ((c - b) * (d * d)) - ((c ^ b) & (b | q));
+  }
+  a = ((c + d) | (c - d)) * ((a | p) ^ (b | c));
+  a = ((c & b) | (p & p)) ^ ((q - 82) | (b & a));
+  if(d < d){
+    a = ((d * b) & (p * 59)) & ((d & 56) - (d & b));
+  }else{
+    d = ((d & a) ^ (d - q)) - ((q + a) ^ (b + d));
+  }
+  c = ((p | c) - (a - c)) | ((p | p) & (c + b));
+  d = ((b | 95) - (q | d)) + ((d & c) & (a + d));
+  b = ((d & b) + (a * b)) - ((p + b) & (q + p));
+  for(i = 0; i < 23; i++){
+    d = ((a ^ p) * (q + 48)) * ((d - q) - (a ^ p));
+  }
+  if(b < d){
+    a = ((q - q) + (q | a)) ^ ((c | 52) & (d + b));
+  }else{
+    a = ((a ^ b) * (q | 79)) - ((a - 66) | (a ^ 85));
+  }
+  b = ((q + c) | (p ^ p)) & ((p * b) + (c ^ a));
+  b = ((a | 78) & (q * d)) - ((d ^ 4) ^ (d - a));
+  d = ((b * b) | (c ^ q)) ^ ((a & 33) * (d * 99));
+  d = ((b | 22) | (q + b)) ^ ((b | c) + (b * d));
+  if(c < q){
+    a = ((q ^ b) | (a ^ b)) ^ ((p * b) * (p & b));
+  }else{
+    b = ((q ^ b) & (p ^ 77)) * ((p - a) ^ (c + b));
+  }
+  for(i = 0; i < 12; i++){
+    c = ((p ^ b) | (a | 56)) ^ ((q | 63) * (p ^ 77));
+  }
+  c = ((q - d) | (d & 38)) | ((c * 59) & (a ^ p));
+  a = ((a - p) * (d - p)) - ((c | d) - (c | q));
+  c = ((b * b) | (p | c)) + ((d + a) ^ (c - a));
+  if(c < b){
+    b = ((d | q) - (b & p)) ^ ((a ^ d) - (b | b));
+  }else{
+    b = ((p & a) & (p & a)) * ((q ^ c) - (d ^ c));
+  }
+  d = ((a + d) - (q - c)) & ((d ^ p) & (c ^ q));
+  d = ((q ^ c) + (p - d)) - ((d - a) * (p & 86));
+  for(i = 0; i < 14; i++){
+    a = ((d ^ 51) | (q & a)) & ((a + b) * (d + c));
+  }
+  c = ((q ^ b) & (d & p)) | ((q + 37) + (d * p));
+  if(b < q){
+    a = ((p * 25) | (d + q)) + ((p ^ d) ^ (p ^ 72));
+  }else{
+    c = ((p * p) - (c & d)) | ((b | a) ^ (q & 23));
+  }
+  c = ((p | 33) * (q * c)) & ((d - 35) & (b - 44));
+  c = ((d - 97) | (b * 70)) - ((b & p) & (p & q));
+  b = ((a * c) | (d | b)) & ((q + p) & (c - c));
+  b = ((q | 35) - (c & b)) + ((b ^ q) + (q ^ c));
+  if(d < b){
+    b = ((p ^ b) - (q * q)) & ((a ^ b) & (q * 89));
+  }else{
+    d = ((d & c) * (q + 39)) ^ ((q | 40) | (c | 47));
+  }
+  d = ((a & 70) * (b & 4)) & ((p & q) ^ (d & 58));
+  a = ((c - 73) * (c * a)) | ((c - d) & (q + 5));
+  b = ((q | p) | (d ^ q)) | ((p + 86) + (a | c));
+  d = ((d | c) + (b ^ c)) * ((a - c) ^ (a * 6));
+  if(a < c){
+    b = ((q | a) + (q ^ 77)) + ((a + d) + (c + c));
+  }else{
+    a = ((q + a) & (p & c)) | ((q - a) * (b | a));
+  }
+  a = ((b | p) + (p + p)) * ((d * a) ^ (a | d));
+  for(i = 0; i < 9; i++){
+    a = ((a - 72) - (b * a)) | ((p + c) - (d ^ b));
+  }
+  b = ((q & c) * (b ^ p)) - ((b - b) + (b - 96));
+  b = ((b | p) - (b * b)) ^ ((a - b) * (d ^ 16));
+  if(b < b){
+    b = ((p * 67) * (q & a)) - ((c | 11) * (p - c));
+  }else{
+    d = ((d + 9) * (p | 33)) * ((d + a) & (c ^ d));
+  }
+  a = ((d | 18) | (a ^ a)) - ((p | a) | (b * 86));
+  b = ((c & 94) | (a - b)) | ((q + p) - (a & 56));
+  d = ((c & d) | (p * d)) | ((q - 90) ^ (a - 55));
+  for(i = 0; i < 42; i++){
+    b = ((a + a) * (b - a)) - ((a + 34) ^ (b | q));
+  }
+  if(d < c){
+    a = ((q - c) - (c ^ d)) & ((q | p) & (d + p));
+  }else{
+    c = ((a ^ a) ^ (c * d)) + ((q ^ b) ^ (q + b));
+  }
+  return a + b + c + d;
+}
+
+int func204(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 63;
+  a = ((p & c) * (p ^ p)) + ((p & 20) * (a ^ a));
+  b = ((d | p) | (b ^ b)) & ((b * q) ^ (q ^ p));
+  b = ((p | p) * (p & c)) - ((q * q) - (a * c));
+  b = ((a + 87) * (c | b)) + ((p * q) ^ (d - d));
+  if(d < c){
+    c = ((d * d) * (d & 57)) & ((d ^ c) & (p * d));
+  }else{
+    a = ((c + p) & (d * b)) + ((b & p) + (d - d));
+  }
+  d = ((b & c) | (q & a)) - ((q + 15) | (b + d));
+  for(i = 0; i < 42; i++){
+    c = ((d | c) | (c + d)) ^ ((d - 81) + (q * p));
+  }
+  c = ((b * q) * (p | 99)) - ((a - a) | (q + d));
+  a = ((a - d) + (d & 21)) & ((d & 16) - (p ^ 50));
+  if(d < q){
+    a = ((a ^ a) - (a ^ 41)) - ((p + a) | (b + c));
+  }else{
+    d = ((c + c) & (a & 1)) & ((p * b) * (d - p));
+  }
+  b = ((c & p) & (q ^ q)) - ((d ^ 22) & (a - b));
+  b = ((d - c) | (p ^ 17)) - ((b + d) & (c | 68));
+  c = ((b ^ q) ^ (q - 70)) - ((q * 11) - (a | c));
+  for(i = 0; i < 32; i++){
+    d = ((p - a) ^ (q & a)) * ((d + b) * (b * b));
+  }
+  if(b < d){
+    b = ((q + 63) + (p | 34)) & ((a - p) * (c - p));
+  }else{
+    d = ((p - a) | (p - a)) & ((c - a) & (p | 49));
+  }
+  a = ((d - d) - (b ^ d)) + ((p ^ 67) & (d & p));
+  b = ((p | a) + (c & b)) + ((b - b) ^ (b & q));
+  a = ((c - 61) * (p - a)) + ((b | b) & (p - q));
+  a = ((q - d) + (q | d)) & ((a & 64) ^ (d ^ d));
+  if(b < p){
+    a = ((c ^ 53) - (a ^ d)) - ((b * 58) & (p - d));
+  }else{
+    b = ((p - 97) * (c * d)) - ((a * c) & (a + 59));
+  }
+  for(i = 0; i < 48; i++){
+    d = ((d + d) * (p & b)) ^ ((p * c) + (q | p));
+  }
+  c = ((d | q) & (d * c)) - ((c * p) - (a + a));
+  a = ((p & c) | (p ^ a)) ^ ((q + c) - (q & d));
+  b = ((c + b) * (b + p)) * ((a * d) | (a ^ d));
+  if(b < 37){
+    d = ((b + p) & (q ^ 9)) - ((c * a) + (q | c));
+  }else{
+    d = ((a & a) + (a - p)) | ((p * d) ^ (q ^ d));
+  }
+  b = ((p ^ q) & (p ^ d)) | ((c | b) + (b ^ q));
+  a = ((q + q) - (b + b)) & ((d * q) - (q + 40));
+  for(i = 0; i < 11; i++){
+    c = ((c + 40) & (q & a)) ^ ((q - 95) & (a - 45));
+  }
+  d = ((c & 2) & (c + 32)) | ((c & a) | (p & d));
+  if(d < 60){
+    b = ((p & d) + (c * b)) + ((b ^ 23) - (q ^ c));
+  }else{
+    c = ((c | a) + (d & b)) | ((q & a) ^ (b - a));
+  }
+  d = ((d - b) & (d | 14)) & ((q ^ 7) + (a * p));
+  a = ((a & d) + (q * p)) & ((d - c) & (d * a));
+  d = ((c - 41) ^ (d | q)) | ((b - p) + (q ^ p));
+  a = ((a * q) - (b * 57)) - ((a + a) + (d - 71));
+  if(d < 28){
+    c = ((a & d) * (a | q)) + ((p | 14) & (b ^ p));
+  }else{
+    b = ((p ^ a) * (c ^ p)) - ((a * c) & (d * q));
+  }
+  c = ((c - c) & (d + 36)) * ((c - b) - (q ^ 58));
+  c = ((d - c) & (q - q)) & ((p + d) - (a * c));
+  b = ((a ^ q) & (p + 11)) - ((d - b) - (p - 30));
+  b = ((c * b) | (q - c)) + ((a ^ q) & (a + a));
+  if(a < 64){
+    b = ((a * d) * (b - b)) & ((b ^ 61) * (q | q));
+  }else{
+    d = ((a ^ c) | (c - c)) - ((a & d) | (b & c));
+  }
+  d = ((b & c) - (b * d)) * ((d | b) + (a ^ 27));
+  for(i = 0; i < 38; i++){
+    a = ((d & a) ^ (p & 94)) & ((b | 95) ^ (b + 85));
+  }
+  d = ((c & p) - (q * a)) - ((b - b) + (c & 67));
+  c = ((b + 89) - (p ^ 52)) + ((a * b) | (b + q));
+  if(d < 35){
+    b = ((q + c) | (c * c)) - ((b - a) | (q & p));
+  }else{
+    c = ((c ^ 57) * (q + b)) & ((d ^ 46) ^ (d * q));
+  }
+  d = ((d * c) - (q & a)) + ((c * q) & (d ^ d));
+  b = ((q ^ c) * (c | b)) & ((d ^ p) | (q & 58));
+  b = ((a & c) + (b * p)) * ((c - q) & (a | 48));
+  for(i = 0; i < 46; i++){
+    c = ((d | c) & (a * d)) + ((b + d) + (p - b));
+  }
+  if(a < c){
+    a = ((b * c) | (b & d)) & ((p ^ p) * (d * p));
+  }else{
+    d = ((q - 41) & (c | a)) * ((b ^ c) - (b ^ d));
+  }
+  return a + b + c + d;
+}
+
+int func205(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 10;
+  d = 69;
+  b = ((q - p) * (b - a)) * ((p | a) - (c | 80));
+  d = ((a & 94) + (b ^ q)) & ((c | c) | (a - c));
+  b = ((p - c) - (c - q)) * ((b + c) * (c - q));
+  d = ((q + a) ^ (a * a)) | ((q + d) - (b + 91));
+  if(b < d){
+    b = ((a ^ d) ^ (d - b)) | ((d | a) * (a * q));
+  }else{
+    d = ((q ^ p) * (d | c)) + ((a | b) | (p * 88));
+  }
+  c = ((p - d) - (b | 89)) | ((q - a) & (q * d));
+  for(i = 0; i < 42; i++){
+    b = ((c & d) & (d | b)) * ((a ^ c) | (d * b));
+  }
+  c = ((p - a) ^ (q * 15)) * ((a + p) * (q * c));
+  a = ((p - 88) * (p + c)) - ((p * 66) & (a * p));
+  if(a < d){
+    d = ((c & a) | (c | c)) + ((d + d) | (b ^ c));
+  }else{
+    a = ((a & p) | (a & a)) + ((p | 77) + (b * d));
+  }
+  b = ((q - q) - (d * d)) * ((p & a) * (p + a));
+  a = ((a & c) | (b - 68)) - ((d & 73) ^ (q - d));
+  d = ((b ^ p) + (b * 2)) | ((c | p) & (p | a));
+  for(i = 0; i < 15; i++){
+    c = ((a - d) * (p + a)) - ((p | 48) - (d ^ b));
+  }
+  if(a < 32){
+    a = ((d * a) & (p & b)) & ((c - c) & (a * q));
+  }else{
+    c = ((d - a) ^ (a - d)) - ((c * 99) + (p & c));
+  }
+  a = ((p & a) * (q * 27)) - ((a * p) | (b | p));
+  d = ((p ^ b) ^ (c | a)) + ((a & 22) + (p * c));
+  c = ((p ^ 3) ^ (p | 28)) & ((c * b) - (q ^ 27));
+  b = ((b + d) & (a - 92)) ^ ((a & d) | (c ^ 44));
+  if(c < 66){
+    b = ((d | a) ^ (d * d)) ^ ((b * a) * (a + q));
+  }else{
+    a = ((q * q) * (a + c)) ^ ((a + p) + (a | a));
+  }
+  for(i = 0; i < 5; i++){
+    b = ((b | b) ^ (q ^ 32)) & ((p * c) * (b * q));
+  }
+  d = ((p ^ 89) & (b | b)) | ((a ^ 5) * (q | d));
+  b = ((d + q) * (b | b)) & ((c + p) & (p + a));
+  d = ((b | b) | (d - q)) * ((c + c) ^ (d & d));
+  if(b < 40){
+    b = ((b ^ b) ^ (c - a)) ^ ((b | p) | (a & c));
+  }else{
+    c = ((b | b) & (d * 45)) ^ ((c | a) | (b * a));
+  }
+  a = ((q & p) * (c - q)) + ((d + 26) ^ (d * b));
+  c = ((q ^ q) ^ (p * c)) ^ ((a & b) ^ (p + d));
+  for(i = 0; i < 11; i++){
+    d = ((a & c) * (c & q)) ^ ((b + q) * (b | a));
+  }
+  d = ((c * b) | (d - d)) + ((b ^ b) ^ (q * a));
+  if(a < q){
+    c = ((d ^ a) | (p ^ a)) ^ ((p | 68) | (p | 98));
+  }else{
+    a = ((b - a) * (c - 40)) & ((b * 61) * (p & c));
+  }
+  d = ((q - a) | (c * 83)) ^ ((d - 18) * (d & 87));
+  b = ((q + q) ^ (d & d)) & ((a ^ d) + (c * p));
+  c = ((q | b) ^ (c - c)) - ((p + a) & (c - c));
+  b = ((c ^ a) - (b + c)) | ((b - q) - (d - 14));
+  if(b < b){
+    c = ((p | 51) + (a + 36)) | ((b | b) | (p - a));
+  }else{
+    d = ((d * d) * (q ^ 71)) - ((q & 48) | (b - c));
+  }
+  a = ((b ^ a) * (c & c)) | ((d | q) | (b | a));
+  c = ((p & 54) & (d - p)) + ((c + b) - (d - b));
+  b = ((d & q) ^ (a - c)) | ((a & 69) ^ (a & c));
+  a = ((p - d) & (q | d)) ^ ((p | c) | (d & c));
+  if(c < d){
+    b = ((c & q) * (b | c)) | ((b | 36) + (p ^ 92));
+  }else{
+    d = ((q ^ q) - (p + 15)) - ((p * d) & (d + q));
+  }
+  a = ((d * d) ^ (c + c)) ^ ((q + 62) & (a ^ 51));
+  for(i = 0; i < 14; i++){
+    a = ((q - q) ^ (b & a)) + ((c + 30) + (b ^ c));
+  }
+  b = ((c * q) & (q & c)) & ((q | a) ^ (a ^ c));
+  a = ((a - 86) - (a - a)) + ((b ^ p) + (q ^ b));
+  if(b < b){
+    d = ((b * d) ^ (d ^ q)) - ((q - 66) + (b ^ q));
+  }else{
+    d = ((b & a) ^ (c ^ 74)) ^ ((c & a) + (a ^ 40));
+  }
+  d = ((p & p) * (d + d)) - ((d * c) * (q & p));
+  c = ((c + d) + (q + b)) ^ ((c | c) ^ (c ^ q));
+  b = ((a - 50) ^ (c + d)) & ((d - p) - (b & a));
+  for(i = 0; i < 26; i++){
+    d = ((d * c) - (b & b)) | ((p ^ a) * (p - a));
+  }
+  if(b < q){
+    b = ((q | a) & (b * p)) + ((b * d) ^ (d & a));
+  }else{
+    a = ((b | b) | (q & 57)) & ((c * a) + (a | p));
+  }
+  return a + b + c + d;
+}
+
+int func206(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 24;
+  d = 9;
+  c = ((q & c) * (b + a)) - ((d + 96) | (a + b));
+  b = ((a ^ q) | (b & 78)) | ((c - a) | (q | c));
+  c = ((d | 49) ^ (d & 43)) ^ ((d * 34) ^ (q ^ 44));
+  c = ((b & d) - (a + q)) + ((q + d) * (d ^ q));
+  if(d < p){
+    c = ((q - p) * (p + 58)) + ((a + p) ^ (p + 45));
+  }else{
+    b = ((p - p) * (p - a)) + ((a & 86) | (p & b));
+  }
+  a = ((q - b) + (q | q)) + ((q - b) - (d ^ 7));
+  for(i = 0; i < 18; i++){
+    a = ((b & a) + (d & 37)) + ((a + b) & (c + d));
+  }
+  a = ((c + d) & (b * 92)) + ((p & a) - (c ^ p));
+  b = ((d + d) - (q - c)) | ((p & d) & (d ^ b));
+  if(d < b){
+    c = ((b | b) | (c * p)) - ((b * p) + (p ^ 23));
+  }else{
+    d = ((c + a) & (p - a)) & ((a & 88) - (a - 22));
+  }
+  c = ((c & d) - (b - 86)) ^ ((c * c) + (q * a));
+  b = ((q - b) & (d & b)) & ((b * d) & (a * q));
+  b = ((d - b) * (b & 93)) ^ ((a - c) * (q * 31));
+  for(i = 0; i < 4; i++){
+    c = ((d - q) * (p - q)) & ((d & a) ^ (p ^ q));
+  }
+  if(d < a){
+    d = ((c | 56) * (b ^ 69)) & ((q + 2) | (b | b));
+  }else{
+    a = ((a ^ b) | (q | 98)) - ((a ^ 40) * (b + a));
+  }
+  a = ((p * 41) & (p - d)) | ((b * p) + (a & 97));
+  c = ((a * 76) - (q * d)) * ((p & c) * (a - a));
+  a = ((q * 50) + (d | b)) - ((q + 63) & (q | b));
+  c = ((p * p) + (p & 33)) + ((b - p) - (d & p));
+  if(a < b){
+    b = ((b + 61) & (b | a)) | ((p + a) & (b | q));
+  }else{
+    d = ((c | d) + (a * 75)) * ((c - p) + (a | d));
+  }
+  for(i = 0; i < 31; i++){
+    b = ((q * 69) * (a * b)) & ((d - a) ^ (q * q));
+  }
+  d = ((c * b) | (q & b)) - ((a & 29) & (d ^ d));
+  a = ((b + d) - (p & c)) | ((p & p) & (b & 82));
+  c = ((c * c) - (b | q)) | ((a | b) | (d | b));
+  if(a < b){
+    d = ((q - b) - (a | b)) & ((d ^ q) | (p * b));
+  }else{
+    c = ((q + q) & (p * q)) + ((a & a) & (p ^ c));
+  }
+  b = ((b + c) ^ (b + q)) ^ ((a - c) | (a ^ q));
+  b = ((c - c) + (d + q)) | ((c & d) | (a - 16));
+  for(i = 0; i < 3; i++){
+    d = ((a ^ b) - (c + b)) | ((p ^ d) * (p * 48));
+  }
+  c = ((a - 17) + (d | 57)) | ((p + 15) * (c ^ q));
+  if(c < p){
+    b = ((a | 42) - (b + c)) + ((b | d) - (d | b));
+  }else{
+    c = ((b * 96) ^ (b + q)) ^ ((q - 7) - (a + c));
+  }
+  d = ((a - p) ^ (d + p)) * ((b - 87) ^ (p & b));
+  d = ((q * 59) + (c ^ d)) | ((a & q) + (a - p));
+  a = ((d | q) * (b * d)) | ((q + a) - (c - 59));
+  a = ((q & 24) & (c ^ q)) - ((p & q) + (b | 89));
+  if(c < d){
+    c = ((p | a) | (b ^ 89)) - ((c ^ c) | (a - p));
+  }else{
+    b = ((a ^ d) ^ (a + q)) ^ ((p * 79) | (c - d));
+  }
+  d = ((c ^ b) & (c - 71)) * ((a ^ q) - (q + 39));
+  b = ((d & 22) | (q + b)) + ((d ^ q) + (q ^ b));
+  d = ((b * a) ^ (q ^ q)) | ((q & b) * (q ^ d));
+  d = ((d * q) * (c - d)) | ((c | a) + (a ^ b));
+  if(d < p){
+    d = ((p & q) ^ (q & a)) & ((a + 90) & (q - 69));
+  }else{
+    c = ((a * q) + (a ^ 59)) | ((b ^ 38) & (b & 27));
+  }
+  d = ((b * c) ^ (q * d)) - ((c + q) * (a * a));
+  for(i = 0; i < 11; i++){
+    d = ((p * 59) + (p * q)) + ((b + 67) - (c * d));
+  }
+  a = ((q - a) + (q - q)) - ((d ^ 48) * (d * a));
+  c = ((p - 85) - (a + b)) * ((b | b) * (c - a));
+  if(b < d){
+    b = ((q & q) * (a - q)) ^ ((q + 5) | (p - 81));
+  }else{
+    c = ((b & c) ^ (b * p)) ^ ((q + p) ^ (b & q));
+  }
+  b = ((b + c) | (b & b)) - ((a + c) * (b & b));
+  c = ((d * a) | (b ^ b)) ^ ((b * c) ^ (a * q));
+  a = ((a | 16) + (d + 89)) | ((p | d) + (a | d));
+  for(i = 0; i < 16; i++){
+    c = ((p & c) * (q | d)) - ((p ^ 18) | (d * a));
+  }
+  if(b < a){
+    c = ((p ^ 36) & (b & p)) & ((c + q) & (c * a));
+  }else{
+    b = ((d - q) + (p ^ b)) - ((b - p) * (b + 5));
+  }
+  return a + b + c + d;
+}
+
+int func207(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 3;
+  d = 41;
+  d = ((a + a) & (b - a)) * ((b | q) - (q & a));
+  c = ((c ^ c) + (c & p)) + ((d + c) * (b & p));
+  d = ((d - a) * (p | a)) & ((p ^ a) * (p + p));
+  a = ((c & a) - (b | p)) - ((c & a) ^ (a * a));
+  if(d < q){
+    b = ((a - 72) & (a | q)) ^ ((c ^ 52) * (a + 60));
+  }else{
+    c = ((a & d) | (p - b)) ^ ((p & d) & (d * q));
+  }
+  c = ((d & 70) | (b & b)) * ((p - d) & (p & b));
+  for(i = 0; i < 7; i++){
+    b = ((a * q) & (p | b)) + ((c | d) - (b * p));
+  }
+  c = ((p - b) & (b & a)) - ((d ^ c) + (a * c));
+  c = ((p + 32) + (a | 17)) + ((p | c) * (a | a));
+  if(a < c){
+    d = ((p ^ 14) - (b - b)) | ((d * 85) & (b | b));
+  }else{
+    b = ((c & d) & (b ^ a)) * ((b - d) - (p - 46));
+  }
+  d = ((c - 10) ^ (a & b)) ^ ((q + b) & (b ^ 24));
+  c = ((p | b) - (b ^ c)) + ((d & d) ^ (a ^ a));
+  a = ((q & b) + (c | c)) ^ ((p & p) * (c | 71));
+  for(i = 0; i < 50; i++){
+    a = ((p ^ d) * (q ^ d)) + ((d + a) | (q & a));
+  }
+  if(a < b){
+    a = ((q - 11) | (b + q)) ^ ((a & 52) - (p - 55));
+  }else{
+    c = ((q * q) - (p - b)) | ((a ^ q) | (d & 20));
+  }
+  a = ((d + 16) | (c | a)) - ((c ^ p) + (p ^ a));
+  c = ((p | p) | (b ^ b)) * ((a | p) + (b ^ 49));
+  b = ((p + 3) ^ (q | q)) - ((p | q) & (a | p));
+  c = ((q + d) | (b | 11)) ^ ((c * b) - (d & b));
+  if(b < 61){
+    c = ((c + a) & (d & c)) | ((b | b) * (q ^ 93));
+  }else{
+    b = ((b & p) - (p + q)) & ((q & c) & (d - b));
+  }
+  for(i = 0; i < 33; i++){
+    a = ((c ^ d) - (c & b)) * ((b + c) * (p - 97));
+  }
+  a = ((c * a) | (a + p)) | ((p ^ p) + (d * c));
+  b = ((b | c) - (d & b)) | ((d | a) + (c & b));
+  b = ((a * 98) + (p * 75)) | ((p | 34) | (b - 62));
+  if(c < a){
+    b = ((b - 84) + (p ^ b)) + ((c * 68) + (a + p));
+  }else{
+    c = ((d | 88) + (a & a)) - ((d - b) & (q | b));
+  }
+  b = ((c * 53) & (b & 53)) + ((b | p) & (a * 63));
+  d = ((p - q) ^ (b * c)) * ((p * a) + (p & d));
+  for(i = 0; i < 19; i++){
+    a = ((q - a) | (q & d)) | ((p | p) ^ (p * b));
+  }
+  d = ((d * b) & (p ^ c)) + ((b ^ b) - (q * b));
+  if(d < q){
+    c = ((d - p) - (q & b)) ^ ((b * d) * (p + q));
+  }else{
+    b = ((q * q) | (a * 90)) * ((d - 73) - (q | p));
+  }
+  c = ((b * d) * (b - c)) ^ ((p * 38) ^ (q & q));
+  d = ((b + d) * (a | 6)) + ((c * a) & (b & 46));
+  c = ((b | b) * (c & a)) * ((d & q) + (a ^ c));
+  d = ((d | a) | (c * q)) * ((d ^ d) + (d | b));
+  if(c < a){
+    b = ((p & c) ^ (b & p)) - ((c | 18) ^ (a + b));
+  }else{
+    d = ((a | b) & (q & 77)) ^ ((a + d) | (q - p));
+  }
+  c = ((q * p) ^ (b + 91)) * ((a * 32) & (b * c));
+  a = ((c * q) - (a & 14)) - ((p ^ a) - (q - p));
+  d = ((q ^ a) + (a - b)) * ((p & 79) & (c * 48));
+  c = ((c | a) & (d ^ c)) | ((a + b) ^ (c & d));
+  if(a < 50){
+    b = ((a & p) | (b & b)) & ((b ^ d) - (b ^ d));
+  }else{
+    c = ((p | 11) & (q | 91)) ^ ((q + d) * (d + 6));
+  }
+  d = ((p + 67) - (b * d)) & ((a & 95) * (a + 39));
+  for(i = 0; i < 48; i++){
+    b = ((b & c) | (d * a)) ^ ((a ^ b) - (b & 49));
+  }
+  d = ((p + 4) + (p ^ b)) & ((q | b) | (d + a));
+  c = ((p - c) + (d ^ b)) | ((a | q) * (b | b));
+  if(b < b){
+    b = ((d | a) - (a * 80)) * ((c & b) - (p * q));
+  }else{
+    d = ((b - b) | (b + d)) ^ ((q & b) * (p | q));
+  }
+  a = ((d - b) * (q + 11)) | ((q * c) - (b ^ c));
+  d = ((q + d) ^ (b + 53)) & ((a & q) - (c | b));
+  c = ((b + a) + (a & 53)) ^ ((q + c) + (q * 25));
+  for(i = 0; i < 38; i++){
+    b = ((q | b) & (c * q)) - ((c | a) - (b + b));
+  }
+  if(c < b){
+    c = ((p | d) * (a + q)) & ((b ^ d) + (p | d));
+  }else{
+    d = ((d | p) - (d | b)) - ((a ^ 29) & (a * p));
+  }
+  return a + b + c + d;
+}
+
+int func208(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 73;
+  d = 90;
+  b = ((p - 38) ^ (q - 76)) + ((a | d) * (p | b));
+  b = ((p - p) & (a & d)) * ((p - a) * (d ^ q));
+  c = ((c ^ 13) + (q + p)) - ((q & b) & (q - 43));
+  c = ((c + a) | (p * b)) + ((c + q) + (a & 70));
+  if(a < a){
+    b = ((c - a) + (p | q)) ^ ((p | b) & (c ^ 37));
+  }else{
+    d = ((b - 40) - (b ^ p)) + ((b + d) + (c * 33));
+  }
+  c = ((p | 13) + (q + a)) - ((a * 82) | (d * d));
+  for(i = 0; i < 22; i++){
+    d = ((q & c) - (c & p)) & ((c ^ c) - (c + c));
+  }
+  b = ((p ^ q) + (q - c)) ^ ((a | q) * (a + q));
+  a = ((q ^ c) - (c ^ d)) + ((a | 34) ^ (q | a));
+  if(a < d){
+    d = ((d * p) - (q ^ b)) | ((a ^ q) & (p | p));
+  }else{
+    d = ((p ^ c) ^ (q ^ q)) & ((q & b) | (a ^ 68));
+  }
+  b = ((d | d) - (b & c)) | ((c + d) - (c * a));
+  c = ((c * q) | (d * 49)) * ((p * 91) ^ (a & b));
+  c = ((c | b) + (q & 60)) + ((p - 17) ^ (p + q));
+  for(i = 0; i < 33; i++){
+    a = ((q * b) & (c | 64)) * ((c * c) - (p + a));
+  }
+  if(d < 33){
+    c = ((a ^ q) * (q * 48)) + ((b + p) - (a ^ b));
+  }else{
+    d = ((d ^ b) - (c * d)) + ((c + b) & (a | 44));
+  }
+  d = ((d * 71) | (d + 2)) + ((c | b) | (c ^ p));
+  b = ((q - b) * (b & p)) - ((q | c) * (p & c));
+  b = ((p ^ d) - (q - 67)) | ((d | a) ^ (c - p));
+  a = ((d * b) ^ (q ^ b)) & ((c & p) + (q - 31));
+  if(d < p){
+    a = ((p | 57) | (b & p)) - ((c ^ 66) + (d - c));
+  }else{
+    b = ((b ^ b) ^ (p + d)) - ((q ^ q) * (b * c));
+  }
+  for(i = 0; i < 44; i++){
+    d = ((c - c) * (a & d)) | ((a | b) | (c - 51));
+  }
+  c = ((q - q) * (p & b)) & ((c * 49) - (b + 71));
+  b = ((p ^ 65) * (c | p)) & ((q ^ a) & (p + p));
+  d = ((b & c) | (d - b)) * ((d | 51) + (p ^ 45));
+  if(c < q){
+    d = ((d * q) + (p & b)) ^ ((b & 5) - (a ^ a));
+  }else{
+    b = ((c * p) + (b | b)) ^ ((a & p) & (q * p));
+  }
+  b = ((d ^ p) | (b + a)) - ((d | d) * (d & d));
+  c = ((b + d) & (p + p)) ^ ((c | 57) * (a & q));
+  for(i = 0; i < 11; i++){
+    d = ((d | q) & (d & d)) | ((c | a) + (a * 18));
+  }
+  b = ((b | 37) + (d & c)) - ((c * c) | (q - 5));
+  if(b < p){
+    a = ((b ^ 30) - (a & 55)) * ((a | c) + (a - p));
+  }else{
+    b = ((p + c) + (d & 56)) ^ ((a ^ 83) & (a ^ 38));
+  }
+  d = ((q & c) - (b * 25)) - ((q + q) - (a * a));
+  a = ((a | 13) & (d & d)) - ((a & a) * (b & q));
+  a = ((c & 4) ^ (c + c)) & ((d & d) + (d & b));
+  b = ((p | b) | (a - c)) - ((c - d) ^ (b + 63));
+  if(b < c){
+    c = ((d & q) & (d ^ c)) + ((b * d) - (a + q));
+  }else{
+    c = ((d | b) - (a + a)) - ((a - 69) + (b & c));
+  }
+  b = ((q * b) | (d ^ 72)) & ((p + a) - (q + q));
+  d = ((d - a) - (a * p)) ^ ((p + a) ^ (d & d));
+  c = ((b ^ q) ^ (d | c)) - ((p + q) - (q - 83));
+  b = ((a | c) & (d - p)) ^ ((q & q) - (p ^ p));
+  if(d < c){
+    d = ((b & 75) & (q - p)) & ((c * 37) & (d * a));
+  }else{
+    b = ((p & q) + (q * a)) ^ ((d - c) * (a ^ q));
+  }
+  a = ((p - 66) ^ (d ^ a)) ^ ((d ^ a) & (c ^ c));
+  for(i = 0; i < 41; i++){
+    c = ((d * q) ^ (d & 11)) & ((q | b) * (c | q));
+  }
+  c = ((b - q) & (q * b)) + ((a + q) + (c & p));
+  d = ((q | 51) + (d | p)) + ((b & b) & (c + b));
+  if(c < q){
+    b = ((p - 13) - (d * q)) - ((b - d) & (c ^ 73));
+  }else{
+    c = ((b - c) ^ (a & q)) ^ ((c - p) + (a | c));
+  }
+  c = ((d + d) ^ (q | p)) + ((p - 60) ^ (d - 72));
+  c = ((a ^ q) & (b | 10)) - ((c | c) | (a | c));
+  c = ((b | q) | (p | c)) * ((b - q) & (a ^ p));
+  for(i = 0; i < 9; i++){
+    a = ((a + a) + (b + b)) & ((a ^ c) ^ (c & c));
+  }
+  if(d < d){
+    b = ((c | d) ^ (p ^ b)) - ((c ^ p) ^ (c + 87));
+  }else{
+    c = ((b * b) + (a ^ b)) + ((c + a) | (c * 67));
+  }
+  return a + b + c + d;
+}
+
+int func209(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 98;
+  d = 18;
+  d = ((q * a) ^ (p + p)) | ((d ^ p) ^ (b - 51));
+  b = ((c + a) ^ (c + b)) | ((a + b) & (q * b));
+  b = ((q | b) | (p * q)) * ((d ^ q) & (a & 13));
+  a = ((c | p) * (a | 35)) & ((c ^ p) ^ (q | q));
+  if(b < q){
+    d = ((c - c) ^ (q & b)) * ((q + q) - (p + q));
+  }else{
+    b = ((a & 34) & (p + 14)) | ((c + c) * (p + b));
+  }
+  b = ((b & b) | (a | a)) - ((q & q) + (d - 60));
+  for(i = 0; i < 3; i++){
+    c = ((c ^ 62) ^ (b ^ 50)) + ((d - p) & (b & b));
+  }
+  d = ((d * d) | (q | d)) * ((d - d) - (a & b));
+  d = ((a + c) - (p * q)) * ((c | b) + (c * 35));
+  if(d < q){
+    c = ((q - a) & (q ^ b)) + ((p + p) + (a * q));
+  }else{
+    a = ((a & q) ^ (b | q)) ^ ((d * 71) | (b & 47));
+  }
+  a = ((a + c) - (b & a)) ^ ((a + a) + (b & a));
+  b = ((a | 76) - (c * 9)) - ((p & q) | (p + 91));
+  c = ((d | d) | (p ^ 40)) - ((b * 60) ^ (p ^ b));
+  for(i = 0; i < 4; i++){
+    c = ((a * p) * (a - p)) + ((d + b) | (c ^ b));
+  }
+  if(b < 57){
+    c = ((a * a) + (d | 62)) | ((q & 68) | (b & d));
+  }else{
+    d = ((q - q) ^ (p & a)) + ((a - a) & (d - d));
+  }
+  d = ((a ^ 35) | (a | 82)) * ((b * 64) * (p + 3));
+  c = ((p | 77) ^ (q * p)) * ((d | c) + (q | 28));
+  d = ((p ^ p) + (q | p)) - ((c | p) - (p + q));
+  b = ((d - 84) * (q - c)) * ((b | p) + (a | q));
+  if(b < 21){
+    a = ((p - 48) | (q - c)) + ((q * b) ^ (a | d));
+  }else{
+    a = ((p - c) & (d | p)) ^ ((c & d) * (p & c));
+  }
+  for(i = 0; i < 35; i++){
+    a = ((a * b) & (p * q)) - ((b + b) ^ (q | c));
+  }
+  d = ((c & d) * (a + a)) ^ ((c * d) + (a ^ p));
+  a = ((c | a) & (b + b)) - ((p - 59) & (d * p));
+  b = ((a & d) ^ (p ^ c)) ^ ((q ^ a) * (a * 2));
+  if(c < 69){
+    d = ((d ^ q) & (a - 43)) - ((q + c) & (c ^ p));
+  }else{
+    b = ((q & 26) ^ (a - d)) ^ ((c - b) + (q & d));
+  }
+  a = ((d | 35) * (a - d)) & ((d ^ q) + (p & a));
+  a = ((d ^ a) | (p | 28)) & ((q & 98) - (c - 11));
+  for(i = 0; i < 26; i++){
+    d = ((b | d) - (a - c)) - ((c | p) & (b & d));
+  }
+  d = ((p - q) & (c + c)) * ((b ^ c) * (c + c));
+  if(b < b){
+    c = ((a - p) * (q - q)) ^ ((q ^ p) + (p & b));
+  }else{
+    c = ((b - c) - (a & 6)) - ((c + 31) & (p ^ 4));
+  }
+  a = ((d | d) * (a * q)) * ((a + 26) & (q ^ a));
+  a = ((b - q) ^ (b + q)) * ((q | d) * (b ^ d));
+  c = ((c & 10) * (c + d)) - ((b ^ p) + (c | d));
+  d = ((d - 37) * (b | 74)) & ((a ^ d) ^ (q ^ q));
+  if(b < 81){
+    c = ((c & d) - (d * a)) ^ ((d & d) - (q | c));
+  }else{
+    a = ((b ^ 88) ^ (b * q)) | ((b | 30) ^ (b - 78));
+  }
+  c = ((b + p) + (a & d)) * ((d | d) | (b & p));
+  b = ((a - c) ^ (a | 93)) - ((d & 69) - (p | q));
+  c = ((a - p) + (q ^ a)) * ((p | q) * (d ^ b));
+  d = ((q * p) | (q * q)) + ((d - q) & (a | c));
+  if(d < p){
+    a = ((c - 27) & (b + b)) + ((b | q) & (b | b));
+  }else{
+    a = ((c ^ d) * (c | c)) + ((q - d) + (p - 12));
+  }
+  d = ((a - p) | (q * p)) | ((c & q) - (p ^ q));
+  for(i = 0; i < 9; i++){
+    a = ((p & 94) ^ (p - p)) * ((q ^ c) - (d - 58));
+  }
+  d = ((a + q) ^ (p & a)) | ((p | a) ^ (a - a));
+  d = ((c ^ a) + (p | a)) | ((c - a) + (p + 54));
+  if(a < c){
+    b = ((q + 3) & (q | d)) & ((d | 53) ^ (q + a));
+  }else{
+    c = ((b * b) + (b & q)) ^ ((b ^ b) ^ (c * a));
+  }
+  a = ((a ^ 95) * (b ^ a)) + ((p | 64) ^ (b + a));
+  c = ((c & a) - (d - b)) * ((d & q) + (q & c));
+  d = ((q - b) | (a * d)) | ((b - a) + (p * a));
+  for(i = 0; i < 39; i++){
+    d = ((c & c) + (q - 90)) * ((b ^ a) - (d + c));
+  }
+  if(a < c){
+    b = ((p ^ q) - (p * c)) ^ ((d - 45) ^ (c - 62));
+  }else{
+    b = ((b | a) & (c * c)) - ((q + q) | (p | 67));
+  }
+  return a + b + c + d;
+}
+
+int func210(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 53;
+  d = ((a * b) - (b & b)) * ((a * a) + (c | c));
+  c = ((d * q) ^ (a - c)) * ((b * p) * (d & a));
+  b = ((d + c) ^ (d * p)) & ((c ^ 37) - (q + c));
+  b = ((p - d) ^ (c * d)) + ((q | c) - (q + d));
+  if(b < d){
+    b = ((q + a) & (c * d)) ^ ((c & b) & (c * 81));
+  }else{
+    c = ((c & c) - (b | c)) & ((b ^ q) - (a - d));
+  }
+  d = ((c & a) * (d & c)) & ((q & d) | (q + q));
+  for(i = 0; i < 19; i++){
+    c = ((d ^ 12) * (p * p)) + ((p - d) * (b - b));
+  }
+  c = ((b | b) - (d - p)) * ((a + p) + (c + c));
+  c = ((a * 18) - (p * b)) * ((c & q) ^ (a ^ b));
+  if(d < q){
+    b = ((d ^ d) * (b - d)) ^ ((q + b) + (c & q));
+  }else{
+    a = ((d & a) - (b | p)) + ((d & c) & (b - 45));
+  }
+  d = ((c + d) * (b ^ d)) * ((d - d) | (b * 27));
+  b = ((d ^ 97) + (a ^ q)) * ((a + p) + (q + d));
+  b = ((p * p) * (b ^ b)) * ((c ^ a) * (d - b));
+  for(i = 0; i < 20; i++){
+    c = ((q | c) ^ (p * b)) - ((d * a) - (c + 80));
+  }
+  if(c < d){
+    c = ((a ^ b) ^ (c * 85)) | ((c + a) ^ (c ^ b));
+  }else{
+    b = ((a | q) & (b | b)) | ((b | d) * (d + b));
+  }
+  d = ((a - b) - (d | d)) & ((a + 27) | (d + c));
+  a = ((d * a) & (c & q)) + ((d * p) - (b + c));
+  b = ((q | b) & (q ^ 1)) | ((q * 53) * (q + q));
+  d = ((d ^ a) | (q ^ p)) | ((d + 26) * (q + c));
+  if(d < d){
+    b = ((b + c) * (p - q)) ^ ((d - q) * (p + b));
+  }else{
+    a = ((d + c) ^ (q * p)) - ((p | p) ^ (c ^ d));
+  }
+  for(i = 0; i < 44; i++){
+    d = ((a - c) - (p & 36)) | ((q | a) * (b ^ 92));
+  }
+  d = ((p | p) & (b ^ 83)) + ((d - p) - (q - 16));
+  b = ((p ^ b) ^ (a * p)) ^ ((b ^ c) - (c & b));
+  b = ((p * b) ^ (p & 56)) ^ ((q - a) - (d ^ 25));
+  if(c < d){
+    a = ((c * a) ^ (d | d)) - ((p * b) | (a * a));
+  }else{
+    b = ((p * 21) + (d + 22)) * ((p + b) * (p * p));
+  }
+  c = ((a + q) + (p ^ 97)) * ((q + d) * (a - q));
+  c = ((a | 14) + (d ^ 28)) + ((p + 21) - (p ^ d));
+  for(i = 0; i < 42; i++){
+    a = ((c - p) + (b + 30)) & ((b ^ 47) ^ (d ^ d));
+  }
+  c = ((b ^ a) + (a + a)) * ((c | 58) | (a + p));
+  if(c < a){
+    c = ((a + b) * (p | c)) - ((a & p) - (a & a));
+  }else{
+    c = ((b * 1) | (p ^ c)) | ((c & d) & (a + b));
+  }
+  a = ((d ^ c) | (c ^ c)) ^ ((b + c) + (d | p));
+  c = ((p ^ p) + (a | d)) + ((c + p) | (d + p));
+  a = ((q ^ 67) | (q * d)) * ((c | p) + (q * b));
+  d = ((d + b) + (a | 22)) + ((a + 32) & (a + d));
+  if(c < p){
+    c = ((b ^ q) & (c ^ 3)) * ((c & 10) & (q * c));
+  }else{
+    d = ((b & b) | (d - d)) ^ ((p * 94) + (a * 90));
+  }
+  a = ((q | d) + (q * d)) ^ ((d ^ d) - (q - d));
+  d = ((d * p) * (d * a)) ^ ((a - d) | (d ^ a));
+  a = ((a ^ 23) + (p ^ b)) - ((d + 49) ^ (c * c));
+  d = ((p * 28) + (d * 87)) & ((p - d) ^ (d * a));
+  if(a < q){
+    c = ((a | c) * (a * p)) & ((p & b) | (q - d));
+  }else{
+    b = ((d + 68) ^ (p * d)) ^ ((b & b) + (b & p));
+  }
+  b = ((p | a) ^ (p - c)) * ((b - 40) - (q - p));
+  for(i = 0; i < 18; i++){
+    c = ((d ^ 59) ^ (p + d)) & ((b & 50) ^ (a - q));
+  }
+  c = ((d * a) & (q & a)) ^ ((c | p) + (a | a));
+  a = ((c - 55) & (a + 93)) * ((c - b) * (c * c));
+  if(c < 36){
+    d = ((a + 77) * (p + q)) * ((q & 32) ^ (p | b));
+  }else{
+    a = ((b * 57) | (a + 50)) + ((a | d) & (q * 5));
+  }
+  a = ((q | b) | (q + d)) & ((a - 46) ^ (p - b));
+  c = ((a ^ 73) + (d ^ b)) ^ ((b | p) & (a ^ d));
+  b = ((a | 4) | (a * a)) ^ ((d + d) | (c * p));
+  for(i = 0; i < 18; i++){
+    c = ((a & p) - (b & p)) + ((p | p) - (a | d));
+  }
+  if(b < 9){
+    c = ((p * c) | (a | c)) * ((d ^ c) & (a & 90));
+  }else{
+    a = ((q * c) ^ (c ^ a)) | ((a & q) | (a + 12));
+  }
+  return a + b + c + d;
+}
+
+int func211(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 66;
+  d = 46;
+  c = ((a + 79) & (a - q)) - ((a | q) + (a * q));
+  d = ((b + a) + (b * p)) & ((a + c) * (a - b));
+  a = ((b + 90) | (d | b)) * ((d - b) * (c & d));
+  b = ((d | b) ^ (d | a)) - ((p & d) ^ (q - d));
+  if(b < c){
+    c = ((p - d) & (q & 82)) - ((d + c) * (c ^ b));
+  }else{
+    a = ((d ^ d) * (q + d)) - ((b ^ 23) * (a * q));
+  }
+  d = ((b * c) | (p + q)) & ((b & c) ^ (q & a));
+  for(i = 0; i < 42; i++){
+    a = ((q - q) * (d * p)) & ((c + 11) + (b ^ b));
+  }
+  d = ((q ^ b) | (c * q)) * ((c | b) - (p + p));
+  d = ((c & c) ^ (q ^ c)) | ((a ^ b) ^ (p - 35));
+  if(c < c){
+    a = ((b - 65) | (q * a)) * ((c ^ 4) | (d | q));
+  }else{
+    c = ((c & c) | (q - a)) & ((c - 65) * (c & d));
+  }
+  d = ((a | q) - (q + p)) & ((p ^ d) * (p & p));
+  b = ((a - 11) & (d - q)) * ((c & 68) & (d + c));
+  a = ((q ^ 47) - (d - q)) - ((p * 44) + (q * q));
+  for(i = 0; i < 5; i++){
+    c = ((c - p) | (c ^ a)) + ((a * a) + (d | p));
+  }
+  if(b < c){
+    c = ((d | q) & (b ^ 47)) + ((a - 3) * (c - q));
+  }else{
+    b = ((p | 82) + (q & d)) + ((a & p) - (b & d));
+  }
+  a = ((b + b) + (a ^ d)) ^ ((a - p) - (q - 56));
+  c = ((b ^ q) + (a + b)) | ((d * b) ^ (q | q));
+  c = ((a - p) | (b + 80)) | ((d ^ q) * (a | b));
+  d = ((q + p) + (d - b)) + ((q - a) + (d ^ b));
+  if(b < c){
+    d = ((a + a) ^ (q & 70)) + ((p * b) * (c & p));
+  }else{
+    c = ((d + 31) | (c - a)) * ((p + c) ^ (q | p));
+  }
+  for(i = 0; i < 24; i++){
+    c = ((d & a) + (d + p)) + ((a | p) ^ (p & b));
+  }
+  d = ((d + 69) + (q & q)) * ((q & b) ^ (c & p));
+  a = ((q & q) | (p | 5)) * ((d ^ 3) & (p * a));
+  a = ((b & c) + (b * a)) + ((a | 55) | (q * b));
+  if(d < 22){
+    c = ((p * a) * (q ^ c)) & ((a & b) - (a + a));
+  }else{
+    b = ((q * b) + (c & p)) + ((c & d) * (d + 56));
+  }
+  d = ((d * c) + (q ^ c)) & ((q - c) | (p + 13));
+  a = ((d * a) | (b + 84)) + ((a - p) ^ (b + c));
+  for(i = 0; i < 8; i++){
+    c = ((c ^ q) - (q - 30)) - ((q & b) | (b + d));
+  }
+  c = ((a & 12) - (p * b)) + ((p * p) | (d ^ 42));
+  if(a < c){
+    c = ((d | a) & (c - d)) ^ ((d * b) & (q & 79));
+  }else{
+    a = ((c * b) * (p & d)) | ((b - 82) * (d | b));
+  }
+  c = ((b + c) ^ (p | 98)) | ((b + d) * (q * d));
+  c = ((a | c) & (a ^ 20)) | ((a + c) | (a | 77));
+  d = ((b - 1) + (q + p)) | ((d & 32) ^ (b & a));
+  c = ((b + 65) ^ (c * a)) | ((p + q) & (d ^ 89));
+  if(d < 86){
+    d = ((p + a) + (p * 90)) - ((p | q) | (q * a));
+  }else{
+    d = ((d | q) & (p | b)) | ((a * c) | (b | p));
+  }
+  b = ((p | d) * (a + p)) * ((p & q) | (q | b));
+  d = ((q - a) ^ (b | 14)) | ((d ^ 59) | (q & 82));
+  b = ((c + d) | (b & a)) ^ ((d + 41) ^ (a & c));
+  b = ((d & b) + (q + p)) & ((d - 99) + (c ^ d));
+  if(b < q){
+    b = ((c + q) - (p * p)) - ((q * 79) + (p ^ q));
+  }else{
+    c = ((q * c) ^ (b & p)) ^ ((b + 96) * (b + b));
+  }
+  d = ((c * c) & (a - 90)) * ((b - c) & (a + p));
+  for(i = 0; i < 25; i++){
+    d = ((q - d) & (p + 64)) & ((a - d) - (c - a));
+  }
+  c = ((q & d) + (p ^ 8)) ^ ((q ^ a) * (b | a));
+  d = ((b + 86) - (a & a)) | ((c + d) | (q | d));
+  if(d < 57){
+    c = ((p ^ b) & (p & a)) + ((d - 62) - (a & a));
+  }else{
+    b = ((a + p) * (c & 71)) + ((p | a) - (c | p));
+  }
+  b = ((d - 9) + (q | 31)) * ((q - c) | (c + c));
+  d = ((d - b) - (a + 26)) | ((a | 30) - (a ^ 10));
+  c = ((d - c) & (c | a)) * ((p * 26) & (a & a));
+  for(i = 0; i < 30; i++){
+    d = ((d + d) | (d | q)) ^ ((p * 76) & (p * p));
+  }
+  if(b < q){
+    b = ((c ^ q) * (p + b)) & ((p - c) * (c * b));
+  }else{
+    b = ((b & c) | (b - a)) ^ ((a - a) ^ (c & c));
+  }
+  return a + b + c + d;
+}
+
+int func212(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 5;
+  d = 69;
+  c = ((d & 71) | (c & q)) * ((a - c) + (d | q));
+  c = ((p * b) * (b ^ d)) + ((p ^ q) * (c | d));
+  c = ((p ^ p) - (p | q)) ^ ((q - p) | (c & b));
+  b = ((d & q) * (d & d)) ^ ((q | p) & (d + p));
+  if(d < c){
+    a = ((d & 27) | (c * q)) & ((b * p) * (b - 23));
+  }else{
+    c = ((a ^ q) + (d | d)) * ((q - 54) ^ (b * c));
+  }
+  c = ((a * c) & (p ^ p)) - ((a & q) + (c + d));
+  for(i = 0; i < 45; i++){
+    b = ((c + 37) | (b | b)) * ((q + 37) - (p + 78));
+  }
+  d = ((q & c) + (a | p)) | ((c + d) | (b ^ d));
+  c = ((p * d) & (a & q)) + ((d ^ 77) * (q & a));
+  if(b < a){
+    a = ((d + 2) & (d ^ q)) | ((q + a) ^ (p * p));
+  }else{
+    d = ((c * d) * (a | p)) & ((p & q) * (b + a));
+  }
+  b = ((a - a) + (p - d)) ^ ((p + p) - (d * p));
+  b = ((a - b) - (b * 55)) ^ ((a + a) - (c & a));
+  a = ((a + d) + (q - 86)) | ((q ^ 52) | (a * b));
+  for(i = 0; i < 43; i++){
+    b = ((b | b) + (b * q)) + ((c * d) - (a - 16));
+  }
+  if(b < q){
+    a = ((q & b) * (p ^ b)) - ((p | p) | (d ^ a));
+  }else{
+    c = ((a - d) | (a * p)) & ((c * p) | (a & c));
+  }
+  b = ((q + p) & (a | 88)) | ((p * 83) + (d ^ 52));
+  a = ((q - a) * (a & q)) + ((a * q) - (c * 13));
+  a = ((a + p) + (b | p)) ^ ((p ^ 92) - (b * a));
+  c = ((b - c) ^ (b | 9)) - ((p - c) - (a | q));
+  if(d < b){
+    b = ((d + q) - (a - b)) | ((p + b) | (c + 33));
+  }else{
+    c = ((d & a) * (q - 86)) - ((q & b) | (d & c));
+  }
+  for(i = 0; i < 21; i++){
+    c = ((q * a) | (c + 41)) ^ ((c | 10) ^ (p ^ q));
+  }
+  d = ((p * 47) * (c - a)) & ((a - p) + (a ^ c));
+  c = ((p | d) & (a & p)) * ((p | a) - (p + b));
+  d = ((a - b) | (c & p)) + ((q ^ 14) | (q & a));
+  if(a < a){
+    b = ((c & 33) * (a - b)) - ((p * 84) * (d ^ 95));
+  }else{
+    a = ((p + p) | (p + q)) ^ ((q - b) * (p - 59));
+  }
+  b = ((q ^ b) | (a ^ 90)) & ((b - d) - (b ^ c));
+  b = ((c - c) * (c * q)) ^ ((q * d) + (d ^ q));
+  for(i = 0; i < 3; i++){
+    b = ((q * 26) ^ (a | q)) ^ ((c * 89) ^ (d + p));
+  }
+  c = ((a | d) + (b * p)) ^ ((c + 98) * (d ^ 53));
+  if(d < 82){
+    a = ((a * 60) ^ (b + a)) | ((a + q) | (d ^ 9));
+  }else{
+    c = ((q * b) + (a & a)) | ((a & 20) & (d * d));
+  }
+  b = ((q & q) - (p * d)) & ((b * q) & (p ^ d));
+  c = ((q ^ b) | (c * a)) | ((a + c) - (b | p));
+  a = ((p | 15) ^ (p ^ a)) & ((d * d) + (d & 43));
+  a = ((c ^ b) & (b ^ a)) * ((q | c) | (q ^ p));
+  if(a < p){
+    d = ((q * 63) - (b | c)) ^ ((c & p) ^ (b & a));
+  }else{
+    c = ((b & 14) | (c * b)) & ((d | 2) ^ (p ^ q));
+  }
+  b = ((b ^ 37) | (p * q)) - ((p + a) | (c - q));
+  b = ((c + p) | (d - p)) & ((b & c) * (b * c));
+  d = ((a + 62) ^ (d - a)) ^ ((d + a) & (q + p));
+  b = ((d + 42) + (c & 13)) - ((c ^ 95) - (q & d));
+  if(c < a){
+    b = ((b * b) | (a & b)) * ((q + b) - (p & 79));
+  }else{
+    c = ((b & 74) ^ (p + q)) + ((p | p) - (b ^ 59));
+  }
+  d = ((p ^ q) | (d + d)) - ((p & d) ^ (c + d));
+  for(i = 0; i < 25; i++){
+    b = ((p ^ p) + (p | q)) | ((d ^ a) + (p + 40));
+  }
+  a = ((p * q) & (d ^ c)) + ((d ^ a) - (a | 20));
+  a = ((p | a) ^ (b + 2)) - ((a + b) - (d + b));
+  if(c < p){
+    d = ((d | c) * (c ^ q)) - ((p * c) & (d * c));
+  }else{
+    b = ((a * 61) & (d + c)) * ((d ^ 55) | (a | d));
+  }
+  b = ((d * 80) * (a ^ p)) & ((d * c) ^ (d ^ 24));
+  b = ((c & 33) * (a * p)) + ((q + 70) | (q ^ a));
+  d = ((d - c) | (d & c)) & ((a + 39) & (c ^ p));
+  for(i = 0; i < 39; i++){
+    a = ((d & q) * (p + q)) & ((c + d) - (c - a));
+  }
+  if(a < q){
+    d = ((a & 19) | (d * a)) & ((p & 63) & (c + 70));
+  }else{
+    d = ((p | b) - (p - a)) + ((p * a) * (a * a));
+  }
+  return a + b + c + d;
+}
+
+int func213(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 64;
+  d = ((q | q) & (p + c)) & ((q - p) ^ (a + 44));
+  b = ((b - p) - (p ^ p)) * ((d + 91) * (c - d));
+  c = ((q & a) + (c * c)) * ((c & 96) | (c - p));
+  c = ((b * c) - (p & 4)) | ((c + 28) + (b * 28));
+  if(d < 31){
+    c = ((q - d) ^ (q | 69)) * ((d - b) | (b & 55));
+  }else{
+    d = ((p ^ c) ^ (c + c)) | ((b - a) & (p ^ 77));
+  }
+  c = ((p | q) | (q * q)) + ((a + a) | (a - a));
+  for(i = 0; i < 42; i++){
+    d = ((d + 66) & (p + 20)) & ((p - d) ^ (c | a));
+  }
+  b = ((b ^ 96) * (a | 29)) + ((d - 14) - (a - q));
+  a = ((q - a) | (q - a)) & ((c ^ p) * (p ^ p));
+  if(c < p){
+    d = ((p * p) * (c - b)) - ((a ^ c) + (d * b));
+  }else{
+    a = ((b | q) | (q & p)) * ((d | a) + (a & 15));
+  }
+  a = ((b - 73) ^ (q & c)) * ((a - d) + (c & p));
+  a = ((c & d) ^ (b * b)) ^ ((a * a) & (q & c));
+  b = ((d + b) - (a * p)) - ((q ^ d) | (d * p));
+  for(i = 0; i < 8; i++){
+    b = ((d & q) * (c | b)) ^ ((p & d) ^ (b + c));
+  }
+  if(d < p){
+    c = ((p & q) ^ (a & q)) ^ ((b | c) - (b ^ d));
+  }else{
+    d = ((b ^ d) | (d - 68)) * ((q ^ p) * (a * q));
+  }
+  a = ((b - c) * (a | 78)) - ((b - q) | (a - q));
+  d = ((c * 60) & (c & c)) * ((q - d) & (c & a));
+  c = ((b & d) | (p - a)) ^ ((c * q) + (a ^ q));
+  c = ((q & q) | (a - d)) ^ ((p ^ c) * (p ^ a));
+  if(c < 93){
+    c = ((d - a) | (q & 95)) * ((b ^ b) ^ (q + 57));
+  }else{
+    a = ((b & p) & (q & p)) & ((a | q) - (b + q));
+  }
+  for(i = 0; i < 22; i++){
+    a = ((q & c) * (b * p)) | ((p - b) | (p | c));
+  }
+  b = ((a | b) & (c & q)) * ((d ^ q) * (d | p));
+  a = ((c - p) * (d & b)) ^ ((c | 45) + (b ^ d));
+  d = ((q ^ 19) ^ (a * 89)) * ((q | p) - (q - 98));
+  if(a < d){
+    d = ((c | d) + (a ^ d)) | ((b & p) | (d & a));
+  }else{
+    a = ((q * c) + (q - p)) & ((c * 42) | (p - a));
+  }
+  b = ((a ^ a) ^ (q | p)) | ((c - 82) - (d & c));
+  c = ((q & c) ^ (p - c)) * ((c & 82) * (q ^ b));
+  for(i = 0; i < 47; i++){
+    b = ((b | d) * (p & p)) + ((p | 38) * (a + 95));
+  }
+  a = ((d ^ 82) + (a * d)) + ((c * b) | (b + a));
+  if(c < p){
+    d = ((b - p) - (q ^ c)) + ((b + b) - (d - q));
+  }else{
+    b = ((c - 97) | (p - c)) | ((p + p) | (b & d));
+  }
+  b = ((q - b) - (a - a)) & ((p ^ b) ^ (p - a));
+  b = ((d & 25) | (a ^ 25)) - ((q ^ 87) * (p * d));
+  a = ((b ^ c) & (b + 61)) & ((a | b) ^ (b ^ a));
+  b = ((a | 22) | (d + p)) + ((a | 25) ^ (a * b));
+  if(c < c){
+    b = ((a & c) ^ (a + p)) | ((b ^ q) * (a | a));
+  }else{
+    d = ((d ^ q) | (q | c)) ^ ((a & a) & (d - q));
+  }
+  b = ((c | 94) & (q + p)) * ((d & 5) - (a + a));
+  d = ((d - 24) + (q ^ a)) ^ ((p * c) - (c + p));
+  b = ((b - q) | (b & d)) | ((c - a) ^ (q & c));
+  b = ((q ^ 67) ^ (a - d)) | ((a * b) & (q * 27));
+  if(c < a){
+    a = ((a + 29) + (b - c)) | ((q ^ b) | (c & 65));
+  }else{
+    b = ((d - p) | (p & 66)) - ((b & p) + (b - 84));
+  }
+  a = ((q - d) - (b + b)) + ((a & q) & (c ^ p));
+  for(i = 0; i < 24; i++){
+    d = ((d + 43) | (b - 68)) & ((q & b) | (d ^ d));
+  }
+  b = ((q | 77) & (b ^ c)) - ((b + b) & (q * a));
+  a = ((q + 82) | (a * c)) - ((c - p) - (a * 38));
+  if(a < d){
+    c = ((a * 24) | (c & a)) + ((q | b) ^ (a & p));
+  }else{
+    a = ((a | b) | (d & b)) ^ ((b ^ b) + (c + q));
+  }
+  c = ((d ^ b) & (b | 98)) & ((c ^ 22) ^ (p ^ d));
+  a = ((b - c) * (c + b)) * ((p | d) & (c - q));
+  d = ((q * q) & (c & c)) & ((q | b) - (a + 94));
+  for(i = 0; i < 44; i++){
+    b = ((a & p) & (b & d)) ^ ((a + b) * (b + a));
+  }
+  if(d < q){
+    c = ((b + b) & (c ^ 12)) & ((p * d) * (p + d));
+  }else{
+    d = ((c | q) & (q * p)) + ((d - 43) ^ (d * p));
+  }
+  return a + b + c + d;
+}
+
+int func214(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 67;
+  d = 78;
+  d = ((c ^ 39) ^ (c * 39)) + ((b * b) | (p & 90));
+  a = ((a * a) * (p * d)) & ((q - d) - (b | a));
+  d = ((q - b) & (q | b)) + ((d * q) | (q | 97));
+  c = ((p - 79) - (p + c)) ^ ((a ^ p) | (d * c));
+  if(c < q){
+    d = ((d * 37) - (p & b)) * ((c * q) & (p + q));
+  }else{
+    a = ((p | 9) - (a * c)) + ((p | q) + (d - d));
+  }
+  b = ((b ^ 28) | (d + c)) + ((d & p) | (a + c));
+  for(i = 0; i < 13; i++){
+    b = ((a ^ c) | (d & p)) | ((d - b) ^ (c | d));
+  }
+  a = ((q * p) + (b * a)) ^ ((q - b) - (c ^ b));
+  c = ((b & a) * (b & a)) + ((a & c) + (b | c));
+  if(d < p){
+    d = ((d & a) - (c & d)) & ((c * b) * (d - c));
+  }else{
+    d = ((q + p) * (q & d)) - ((p & 33) * (b ^ 87));
+  }
+  b = ((d * 29) - (b | p)) + ((a + 77) * (p ^ a));
+  d = ((c * c) ^ (d * a)) ^ ((p ^ q) | (c | d));
+  c = ((b - p) * (a & a)) & ((d - 79) | (d + d));
+  for(i = 0; i < 21; i++){
+    c = ((d + 5) ^ (a + p)) | ((c * d) ^ (q - b));
+  }
+  if(a < c){
+    d = ((b | a) * (a & 69)) - ((q * 82) + (q - c));
+  }else{
+    b = ((a ^ 2) | (a + 7)) | ((a ^ d) | (d ^ 67));
+  }
+  d = ((a * p) - (p ^ 15)) * ((d * 98) - (b + a));
+  a = ((p - 83) ^ (c + 3)) + ((p ^ q) + (b ^ d));
+  c = ((c + q) ^ (p & 13)) + ((p * p) + (a * 24));
+  d = ((q ^ p) + (a + 74)) + ((b - a) | (p + a));
+  if(a < 1){
+    d = ((d ^ c) * (d ^ 57)) + ((q | q) | (b ^ c));
+  }else{
+    a = ((q ^ 16) | (p & a)) * ((a & d) * (q ^ p));
+  }
+  for(i = 0; i < 2; i++){
+    b = ((q | q) ^ (d ^ c)) ^ ((p ^ d) ^ (c & a));
+  }
+  d = ((c - p) * (q - c)) | ((q * p) | (c + a));
+  d = ((b & p) & (b | d)) & ((d + a) * (p & 78));
+  b = ((a - q) + (b ^ d)) & ((b - a) + (q - c));
+  if(b < b){
+    a = ((q & 78) * (a + p)) * ((c | b) & (c * p));
+  }else{
+    d = ((a + a) & (a - q)) | ((p | q) | (d ^ b));
+  }
+  c = ((b & p) + (a + q)) * ((d * q) | (d ^ c));
+  d = ((p | 59) * (c + p)) ^ ((b & d) ^ (d - 17));
+  for(i = 0; i < 8; i++){
+    b = ((d + 49) + (p ^ b)) ^ ((b ^ 78) ^ (d * q));
+  }
+  a = ((b * p) - (p + 73)) - ((c | a) - (p ^ c));
+  if(c < d){
+    d = ((b | c) * (p ^ b)) ^ ((a | p) * (d | q));
+  }else{
+    a = ((b | q) * (q ^ d)) ^ ((p + 60) * (d & b));
+  }
+  d = ((p ^ q) * (a & b)) & ((b | b) - (b + a));
+  c = ((q * p) & (d & b)) & ((q ^ q) * (d ^ a));
+  d = ((c ^ q) | (q + c)) - ((p & c) + (p ^ q));
+  d = ((d ^ p) & (d | p)) ^ ((c + c) & (p + 42));
+  if(a < p){
+    c = ((p * q) & (b - 22)) | ((a - p) & (c & q));
+  }else{
+    a = ((a * p) | (c ^ c)) - ((p - 25) + (d | b));
+  }
+  c = ((c - 60) & (c - c)) & ((p * p) + (c - 59));
+  a = ((p ^ a) ^ (p * 10)) - ((a ^ p) * (c ^ b));
+  b = ((a * q) ^ (q - c)) - ((p * 21) - (c - d));
+  c = ((a - b) + (q ^ d)) & ((b | q) ^ (b + d));
+  if(b < a){
+    c = ((a ^ c) | (q | 51)) - ((c + c) ^ (c ^ a));
+  }else{
+    b = ((q & d) * (d ^ 88)) & ((q - 97) & (a & 46));
+  }
+  d = ((d + 26) & (d ^ b)) | ((c * 10) & (p * 57));
+  for(i = 0; i < 23; i++){
+    b = ((b - q) | (a ^ c)) + ((p ^ q) & (d - q));
+  }
+  b = ((b ^ 20) & (c & 4)) ^ ((c & 86) - (b * b));
+  b = ((c * 3) & (c + b)) & ((c * q) - (a - a));
+  if(b < q){
+    d = ((b | c) & (c | 33)) + ((q + b) | (q | 96));
+  }else{
+    d = ((c * b) & (b & q)) & ((q + q) * (a - 9));
+  }
+  b = ((c - 56) - (b | a)) ^ ((c + b) ^ (b ^ b));
+  a = ((c ^ 57) + (a & 70)) * ((p - 15) & (b ^ d));
+  d = ((p & a) + (a | q)) & ((b | d) ^ (c | 24));
+  for(i = 0; i < 2; i++){
+    d = ((q ^ q) * (a * c)) * ((a - c) ^ (b + c));
+  }
+  if(a < q){
+    b = ((b * p) - (c * q)) * ((b + 52) + (b | q));
+  }else{
+    b = ((d & p) + (d | d)) ^ ((c + 48) | (c ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func215(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 15;
+  d = 39;
+  a = ((d + d) | (q * d)) & ((c * d) ^ (q | a));
+  d = ((c * p) + (p & d)) & ((c ^ 63) + (p | b));
+  c = ((b | c) - (d & d)) | ((d ^ a) & (p ^ q));
+  b = ((p ^ 15) * (p ^ b)) * ((p & p) * (a * d));
+  if(c < 27){
+    a = ((d ^ a) | (p + a)) - ((a + b) ^ (c & 61));
+  }else{
+    d = ((a | p) & (d * d)) * ((d | q) & (a - a));
+  }
+  d = ((q | 91) | (b * d)) * ((b ^ 97) & (p - q));
+  for(i = 0; i < 50; i++){
+    d = ((b * d) * (a * b)) - ((b * p) * (d & c));
+  }
+  b = ((b | p) & (c * c)) * ((b & c) * (c * c));
+  c = ((b + 78) + (p ^ p)) ^ ((d + a) * (p * b));
+  if(b < b){
+    a = ((c | d) - (a & a)) | ((b * 62) | (a ^ 19));
+  }else{
+    b = ((c * a) ^ (c + 9)) ^ ((q & a) - (c + q));
+  }
+  c = ((b & c) | (a | 36)) & ((d ^ p) ^ (b | d));
+  a = ((q * 63) * (a + p)) | ((c | p) - (d * a));
+  d = ((c | d) + (b + 98)) ^ ((b + p) + (b & 57));
+  for(i = 0; i < 28; i++){
+    c = ((q - q) & (q - p)) + ((c - d) - (p + 75));
+  }
+  if(c < q){
+    d = ((d ^ a) | (d | d)) & ((p | b) * (c * a));
+  }else{
+    d = ((q ^ c) ^ (p ^ a)) + ((c ^ a) * (b | 8));
+  }
+  d = ((b + 90) ^ (d - 44)) * ((c * a) + (p * 72));
+  d = ((d - p) + (d | q)) & ((p - 49) & (d ^ a));
+  d = ((p ^ q) + (d - d)) - ((q ^ a) * (a * q));
+  b = ((a | q) & (b | a)) - ((d - 30) + (q - b));
+  if(b < 94){
+    d = ((a & c) ^ (c ^ 55)) ^ ((a + c) * (c ^ 94));
+  }else{
+    a = ((c ^ p) & (d * p)) | ((c & 32) + (d * q));
+  }
+  for(i = 0; i < 20; i++){
+    a = ((d * a) | (p - a)) + ((a & c) | (q & c));
+  }
+  c = ((a & 30) * (p | d)) ^ ((p * 99) ^ (q ^ 75));
+  d = ((b | 73) | (p + d)) + ((q & c) | (d | a));
+  b = ((a & d) + (q | 74)) ^ ((d & 98) + (b & d));
+  if(c < p){
+    c = ((a | b) + (a ^ c)) * ((b * d) | (a ^ p));
+  }else{
+    d = ((c ^ 6) - (p & 41)) | ((p | 76) ^ (a ^ 30));
+  }
+  b = ((d | q) ^ (c | d)) & ((c ^ 4) - (q | p));
+  b = ((p & 5) | (c & d)) & ((a + d) & (p & a));
+  for(i = 0; i < 4; i++){
+    c = ((c * a) ^ (q + d)) & ((a | p) - (a * a));
+  }
+  c = ((p | q) - (q * a)) | ((q + a) + (b * q));
+  if(d < a){
+    b = ((q + b) * (p * 15)) - ((p * p) - (a + a));
+  }else{
+    c = ((b & a) - (p & d)) * ((a - p) + (b - 29));
+  }
+  b = ((p | q) & (p - c)) + ((d ^ p) * (b + p));
+  c = ((a + p) - (a - 27)) - ((c & a) | (d * d));
+  d = ((p * b) | (a * q)) ^ ((p * q) - (c & 30));
+  d = ((d + a) | (q ^ d)) * ((q | d) - (c ^ a));
+  if(c < 15){
+    a = ((q * 90) - (p + a)) - ((a ^ 79) ^ (q ^ p));
+  }else{
+    d = ((b * b) | (d - a)) | ((q - a) | (d * 44));
+  }
+  c = ((q | c) - (p + q)) - ((b ^ 85) + (d - d));
+  d = ((b + 85) & (p & q)) ^ ((b - q) | (d - c));
+  c = ((b & d) | (b | d)) + ((c & b) + (d | c));
+  a = ((c ^ d) & (q ^ d)) - ((b ^ d) * (d & d));
+  if(a < 6){
+    d = ((d - d) * (p - q)) * ((d + c) & (q * 44));
+  }else{
+    a = ((c + p) * (q & a)) * ((d | a) + (b ^ 17));
+  }
+  c = ((b + p) | (b | c)) ^ ((q ^ 61) * (p * d));
+  for(i = 0; i < 6; i++){
+    a = ((p | a) & (p | 33)) + ((b - c) | (d * q));
+  }
+  d = ((c - c) ^ (d - p)) ^ ((p | 64) & (p + 96));
+  b = ((b | c) ^ (p + d)) | ((p | b) * (a + q));
+  if(a < d){
+    a = ((d ^ b) + (c * q)) - ((p ^ p) + (b * q));
+  }else{
+    b = ((b - p) ^ (b - p)) & ((q & a) * (d - 92));
+  }
+  a = ((p - a) * (c * 72)) ^ ((q & b) & (q * 42));
+  a = ((p & b) - (c + a)) * ((p - p) - (d * d));
+  b = ((b ^ p) - (b & 55)) - ((p | p) * (d ^ a));
+  for(i = 0; i < 46; i++){
+    d = ((q * c) ^ (p * c)) | ((p + d) ^ (b & a));
+  }
+  if(d < 10){
+    b = ((b * q) - (c - q)) & ((c - p) - (a - p));
+  }else{
+    c = ((q & q) ^ (d - a)) + ((c ^ a) * (b * 24));
+  }
+  return a + b + c + d;
+}
+
+int func216(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 33;
+  d = 68;
+  a = ((q ^ p) ^ (q + d)) ^ ((b ^ q) | (d ^ c));
+  d = ((b ^ b) | (q * c)) + ((a | d) & (c - d));
+  b = ((b * 50) - (p | b)) | ((b * a) * (b | b));
+  d = ((a ^ a) * (c ^ d)) ^ ((a ^ 73) - (q + 42));
+  if(b < q){
+    c = ((q + p) & (b | c)) ^ ((d | 76) + (p - p));
+  }else{
+    b = ((q & a) | (q - 50)) & ((a | c) - (b & 10));
+  }
+  a = ((q * a) & (q & 19)) | ((d | p) * (p & 22));
+  for(i = 0; i < 50; i++){
+    d = ((a + c) - (c ^ a)) + ((d & a) - (d | b));
+  }
+  b = ((c & a) * (c * a)) + ((a | p) ^ (d | a));
+  c = ((p + q) * (q + a)) - ((q & a) + (d | 20));
+  if(a < b){
+    d = ((a & b) - (d * b)) | ((p - 96) | (c * 29));
+  }else{
+    d = ((d & a) * (a - b)) | ((c + b) * (p + b));
+  }
+  b = ((p + p) * (a & a)) * ((c - b) | (p | 70));
+  c = ((c & a) - (b + 81)) - ((p + d) & (p - d));
+  c = ((b | 8) ^ (b ^ q)) | ((d * c) & (b | a));
+  for(i = 0; i < 26; i++){
+    c = ((d & c) * (d + 89)) - ((c + p) * (c + 10));
+  }
+  if(c < a){
+    b = ((c & q) ^ (a | d)) & ((d | b) | (q * b));
+  }else{
+    c = ((p - a) ^ (q + p)) + ((d + b) | (b & 12));
+  }
+  b = ((d + 60) | (a & q)) | ((c - b) * (a ^ 45));
+  c = ((c | p) & (p ^ c)) * ((p ^ c) ^ (c + 13));
+  a = ((a - d) & (a ^ b)) - ((b ^ 52) & (c ^ a));
+  a = ((q & 30) | (c * 3)) * ((a | p) - (b * q));
+  if(a < a){
+    b = ((c - p) ^ (a | p)) | ((a ^ c) | (p & d));
+  }else{
+    a = ((b | q) - (c + 87)) + ((p | 12) ^ (q | a));
+  }
+  for(i = 0; i < 20; i++){
+    c = ((p & p) ^ (q & b)) - ((c * 29) & (d | q));
+  }
+  d = ((d * b) - (c * d)) | ((d ^ q) & (c + d));
+  a = ((d & 28) + (q ^ a)) | ((d + a) * (q - d));
+  c = ((d | a) & (q & 94)) & ((b & b) | (c ^ 22));
+  if(b < p){
+    d = ((c * c) | (q & d)) ^ ((a + a) + (d ^ 72));
+  }else{
+    a = ((c + c) & (d + 69)) + ((c * p) & (d & c));
+  }
+  d = ((a & b) | (p ^ d)) ^ ((p * b) | (c | 42));
+  d = ((b * q) - (q - b)) | ((p & 42) - (a * 13));
+  for(i = 0; i < 13; i++){
+    b = ((d & c) + (a - d)) & ((b ^ q) | (c & a));
+  }
+  c = ((a * b) ^ (d | p)) + ((p + a) * (a ^ 42));
+  if(c < 38){
+    a = ((b - q) ^ (b & 36)) * ((d + q) + (a - d));
+  }else{
+    c = ((a | 40) | (a + 94)) & ((q + d) ^ (a | 18));
+  }
+  c = ((c | 77) + (a * a)) | ((c - b) * (c * 25));
+  d = ((c + c) * (d + a)) * ((c | p) ^ (b | q));
+  d = ((b * a) * (p - d)) & ((c & q) ^ (b ^ c));
+  d = ((a * 40) ^ (p | c)) | ((p * c) * (c + 67));
+  if(a < a){
+    c = ((a | c) * (p & 83)) * ((b & a) - (b & d));
+  }else{
+    b = ((a ^ b) - (c ^ p)) & ((q | b) & (c * 47));
+  }
+  c = ((a - b) + (a * b)) - ((b + 88) & (c | b));
+  b = ((q ^ b) - (q - b)) | ((b * 33) ^ (c | q));
+  b = ((c * q) + (c | q)) | ((a | 71) * (q & q));
+  c = ((d & q) ^ (a | b)) | ((q ^ q) * (c | 85));
+  if(b < b){
+    c = ((c & q) - (a & c)) * ((d + p) ^ (q ^ 71));
+  }else{
+    a = ((q - d) | (p | a)) ^ ((c - p) ^ (d - d));
+  }
+  d = ((d + d) | (p & c)) + ((c ^ a) ^ (b * d));
+  for(i = 0; i < 35; i++){
+    c = ((b & 73) * (q - b)) * ((p | p) + (c ^ p));
+  }
+  b = ((c & b) * (q - 86)) - ((b & d) * (q + c));
+  c = ((q - b) - (a - 28)) * ((c & b) | (d + d));
+  if(b < p){
+    d = ((d + 62) & (d ^ q)) * ((c & 10) + (c - a));
+  }else{
+    d = ((c + p) * (q | b)) + ((d ^ a) | (p * 8));
+  }
+  d = ((d - p) * (d * a)) | ((b + p) | (d * q));
+  c = ((p * a) * (a + a)) - ((b ^ d) & (d | d));
+  c = ((q - b) + (d ^ b)) & ((d + d) - (p * d));
+  for(i = 0; i < 37; i++){
+    b = ((a | 49) ^ (p - b)) - ((a - d) & (d | 86));
+  }
+  if(a < b){
+    c = ((q + q) + (d - d)) | ((b - 58) + (d + 47));
+  }else{
+    a = ((q | c) * (d ^ a)) | ((p + a) - (a - 6));
+  }
+  return a + b + c + d;
+}
+
+int func217(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 9;
+  d = 28;
+  b = ((d | 27) ^ (c ^ 95)) - ((c ^ b) & (c | d));
+  b = ((p - p) | (d * a)) | ((d & q) | (b | 92));
+  b = ((p | 68) * (b | d)) & ((a | q) * (b & c));
+  c = ((q | p) + (a & 74)) * ((q - b) + (b + d));
+  if(d < p){
+    b = ((p | q) - (a - a)) * ((b - c) + (b & q));
+  }else{
+    c = ((d ^ a) * (d & 79)) ^ ((b | d) * (a ^ q));
+  }
+  a = ((d ^ d) * (q * b)) ^ ((c | p) ^ (a | c));
+  for(i = 0; i < 48; i++){
+    c = ((q * 73) & (d ^ c)) ^ ((d | p) | (c * b));
+  }
+  b = ((b + b) + (p * d)) | ((d * 6) ^ (c - d));
+  a = ((p | 14) ^ (q ^ p)) - ((b + q) | (a + c));
+  if(d < p){
+    b = ((a * a) ^ (c - 79)) + ((b & c) | (q | 74));
+  }else{
+    b = ((p * b) * (d * d)) & ((a & 86) & (b & q));
+  }
+  c = ((q * d) ^ (d | 66)) - ((c ^ d) * (c | 98));
+  a = ((d | d) | (a - b)) & ((q & 36) * (c - a));
+  d = ((d ^ q) - (d + a)) & ((d - 48) & (d - a));
+  for(i = 0; i < 12; i++){
+    a = ((b - p) - (b & b)) - ((a | p) * (d + c));
+  }
+  if(c < 98){
+    c = ((q | b) * (b - d)) | ((d * q) ^ (p * c));
+  }else{
+    d = ((q - a) - (c + b)) + ((p | a) | (b ^ b));
+  }
+  c = ((b | 18) ^ (q ^ d)) | ((c ^ q) & (c ^ a));
+  d = ((c & p) + (a & 22)) | ((p - c) ^ (p | c));
+  b = ((q | 39) | (q ^ 77)) + ((p | 39) + (p ^ p));
+  c = ((q + d) + (b + q)) * ((d * p) ^ (d ^ b));
+  if(b < 16){
+    a = ((c + a) * (c * 84)) ^ ((p + a) * (a - 92));
+  }else{
+    d = ((d | q) + (a & d)) & ((b | 12) | (c + p));
+  }
+  for(i = 0; i < 21; i++){
+    d = ((a | 13) * (p - p)) ^ ((c & b) | (c * 1));
+  }
+  d = ((q | 41) + (c & 42)) & ((b ^ 10) & (p - q));
+  a = ((a + p) ^ (c + p)) & ((q & q) | (q & d));
+  c = ((b - 3) | (q ^ b)) * ((b & q) - (c * 80));
+  if(a < 99){
+    c = ((c + 77) | (b | q)) * ((b - 80) + (a - a));
+  }else{
+    c = ((q ^ a) - (p * a)) | ((p | d) + (a & 38));
+  }
+  c = ((p ^ d) - (q - b)) ^ ((p + 47) & (a * 90));
+  a = ((a + c) | (a ^ d)) + ((p - p) - (d | c));
+  for(i = 0; i < 46; i++){
+    c = ((c | b) | (p & q)) * ((a ^ a) - (p - 14));
+  }
+  c = ((c * q) & (q + p)) - ((c * a) ^ (b & d));
+  if(d < 50){
+    b = ((p | 61) - (b * 64)) * ((b & p) ^ (p ^ q));
+  }else{
+    a = ((b - q) | (b + d)) - ((a - 34) & (a ^ 39));
+  }
+  a = ((b * p) - (a ^ d)) & ((q + a) * (q | c));
+  b = ((c - a) * (c | 84)) - ((p ^ p) ^ (b | d));
+  b = ((p + a) & (q & 28)) - ((p * b) | (d & 28));
+  a = ((c & p) & (p + p)) + ((d - q) & (d & b));
+  if(d < 40){
+    c = ((p ^ 8) & (q - a)) - ((d | 2) + (b * c));
+  }else{
+    c = ((a + d) & (a | b)) + ((d ^ b) + (a * 5));
+  }
+  c = ((b | d) ^ (c + p)) | ((c | c) & (d + b));
+  b = ((b + 49) + (p + 13)) ^ ((b ^ q) ^ (p & d));
+  c = ((a | d) * (a * 96)) & ((b ^ 75) | (q * a));
+  a = ((c * d) ^ (b & 45)) - ((d & d) ^ (p & d));
+  if(b < 92){
+    d = ((q | p) ^ (d - c)) + ((p | 45) - (a & c));
+  }else{
+    a = ((q * q) - (d ^ a)) | ((p & 37) + (c + 76));
+  }
+  d = ((d ^ c) * (d - 13)) + ((a + 91) | (b | d));
+  for(i = 0; i < 38; i++){
+    b = ((c ^ a) + (a | q)) + ((c * d) & (b + c));
+  }
+  d = ((q - b) ^ (c + d)) | ((c & 34) & (q * 51));
+  a = ((a + 61) + (a * a)) - ((c | q) - (a - 90));
+  if(c < a){
+    b = ((c + 31) * (p & b)) - ((a * b) ^ (q ^ d));
+  }else{
+    b = ((q ^ q) | (q * q)) ^ ((c * 3) | (b - 14));
+  }
+  d = ((p ^ 64) ^ (a ^ 52)) | ((a * p) ^ (p ^ b));
+  b = ((c | q) & (c & 71)) * ((a - a) - (a | 95));
+  c = ((b & b) + (c ^ a)) * ((q | 46) ^ (c | d));
+  for(i = 0; i < 3; i++){
+    c = ((c | q) - (c - c)) + ((c ^ q) - (b & c));
+  }
+  if(c < p){
+    c = ((a * d) * (b | d)) - ((q & c) - (b & d));
+  }else{
+    c = ((a ^ 17) - (b + 70)) | ((d + d) + (c & q));
+  }
+  return a + b + c + d;
+}
+
+int func218(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 35;
+  d = 74;
+  b = ((p ^ q) * (a - a)) ^ ((a + 23) * (p ^ q));
+  a = ((b - b) & (q * d)) | ((q - c) - (c ^ d));
+  a = ((q & 93) | (b + 93)) + ((b * 28) - (c + 13));
+  d = ((a + q) + (c * 62)) ^ ((q ^ b) | (q | q));
+  if(c < a){
+    a = ((p | a) + (c | 22)) - ((d - d) | (d + a));
+  }else{
+    d = ((p ^ 11) ^ (a - d)) - ((b | 12) * (a ^ 39));
+  }
+  b = ((q & q) * (b + p)) * ((q ^ a) ^ (q + d));
+  for(i = 0; i < 50; i++){
+    d = ((a * 6) ^ (p * 46)) * ((a + p) - (c ^ b));
+  }
+  a = ((a | 4) | (c * q)) * ((a ^ d) * (b + d));
+  d = ((p & 92) & (d & a)) | ((d + p) + (p & a));
+  if(a < a){
+    c = ((p * p) & (b - p)) ^ ((p | q) + (q ^ 53));
+  }else{
+    d = ((a & 27) ^ (d - q)) & ((p & 97) & (b * 39));
+  }
+  c = ((p + q) + (q - 93)) + ((q * 81) * (c & 75));
+  b = ((a - c) + (p & b)) * ((c | d) * (a & b));
+  d = ((q & c) + (q + b)) | ((b + p) + (c | c));
+  for(i = 0; i < 27; i++){
+    d = ((b ^ d) * (d & 9)) * ((p * d) | (d ^ c));
+  }
+  if(c < b){
+    c = ((a + q) & (a | d)) | ((d & 34) - (q + d));
+  }else{
+    d = ((q & p) | (p + 91)) | ((c * 82) | (c * b));
+  }
+  d = ((b + a) ^ (p ^ p)) | ((c * p) ^ (p - a));
+  d = ((p ^ p) | (c - b)) ^ ((p | d) ^ (d & b));
+  b = ((b + q) - (q & c)) | ((a + 94) - (a - 87));
+  d = ((q - q) ^ (b - a)) & ((d * 24) + (b | 49));
+  if(c < d){
+    b = ((c + b) ^ (q + b)) + ((d + c) * (q ^ q));
+  }else{
+    c = ((p & 45) * (q ^ 83)) - ((p ^ p) * (a + q));
+  }
+  for(i = 0; i < 50; i++){
+    d = ((a - d) + (p ^ d)) * ((d | 91) ^ (p + c));
+  }
+  b = ((q * p) | (d * 4)) - ((b * c) * (b ^ a));
+  b = ((q * 31) * (a + 84)) | ((b * 42) + (a ^ 17));
+  b = ((q + q) | (b * q)) + ((c | d) * (a | q));
+  if(d < 27){
+    a = ((q & q) * (d * b)) + ((p * 36) - (d - a));
+  }else{
+    a = ((c - a) ^ (d * p)) | ((b + a) | (b * a));
+  }
+  a = ((b + d) - (p & c)) | ((p | a) - (p - d));
+  a = ((d * 62) | (p & b)) ^ ((d & q) ^ (b & c));
+  for(i = 0; i < 33; i++){
+    a = ((d & p) - (a + c)) + ((d | b) - (q & 74));
+  }
+  a = ((d ^ 70) | (c & a)) ^ ((d * a) ^ (d | b));
+  if(a < p){
+    d = ((p ^ 53) + (a * a)) & ((b ^ p) ^ (p - 46));
+  }else{
+    b = ((q + d) + (c - a)) - ((p + b) | (c + d));
+  }
+  d = ((c | c) + (d & a)) & ((p * c) & (a + 82));
+  c = ((a ^ q) - (b & c)) * ((b | d) * (q ^ p));
+  b = ((p ^ c) * (d - b)) * ((q & b) ^ (c | q));
+  d = ((d ^ 23) & (q | c)) * ((d - c) * (q | 2));
+  if(d < 84){
+    d = ((b * 86) * (p + a)) & ((c * p) & (a & d));
+  }else{
+    d = ((b * a) + (b + c)) - ((b | b) | (a + d));
+  }
+  b = ((d & 19) ^ (b & d)) * ((d & q) * (p - c));
+  c = ((d - d) - (a + c)) + ((c + a) - (q - d));
+  a = ((b | a) ^ (b - d)) * ((b | 47) | (a ^ 39));
+  c = ((b * q) | (d - c)) - ((q & d) * (b * d));
+  if(c < b){
+    b = ((p ^ 50) & (q + p)) & ((d | d) + (a ^ d));
+  }else{
+    c = ((a - 78) - (a | 75)) + ((a & 72) ^ (a | 65));
+  }
+  b = ((b & p) & (c ^ c)) & ((q | 9) + (q + c));
+  for(i = 0; i < 7; i++){
+    a = ((b ^ c) - (a + q)) ^ ((a & b) ^ (q + q));
+  }
+  b = ((d * 40) | (q | q)) ^ ((p & c) | (c | q));
+  c = ((a & b) + (d & p)) + ((b + 70) ^ (q ^ c));
+  if(a < p){
+    a = ((q | b) ^ (q + q)) & ((a | d) - (d + c));
+  }else{
+    d = ((p | b) + (q * 50)) * ((d - c) | (c * 99));
+  }
+  b = ((b ^ c) | (a & 63)) * ((q * a) & (c * d));
+  d = ((d | 52) & (q + 39)) ^ ((p & a) + (a | q));
+  b = ((c & a) & (b | 42)) ^ ((q - c) ^ (q + d));
+  for(i = 0; i < 24; i++){
+    c = ((b - p) + (a | 11)) + ((a + p) * (a & p));
+  }
+  if(b < c){
+    b = ((b - 85) & (q | 10)) * ((q + d) | (q ^ p));
+  }else{
+    c = ((d * a) - (b & a)) * ((c + d) - (q ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func219(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 64;
+  d = 91;
+  c = ((c & 51) ^ (p ^ d)) - ((p | d) ^ (p | d));
+  b = ((d - 93) * (b - 19)) * ((q ^ 62) ^ (q + c));
+  d = ((a - p) | (d * a)) - ((d * a) - (a * c));
+  a = ((c & d) ^ (d - b)) | ((q & 92) | (c | q));
+  if(c < 8){
+    d = ((p | b) & (c + c)) + ((c & q) | (a & q));
+  }else{
+    b = ((p ^ b) ^ (d - c)) * ((a * d) - (p & q));
+  }
+  b = ((q * q) ^ (b * p)) ^ ((b ^ d) * (b & q));
+  for(i = 0; i < 4; i++){
+    c = ((q - p) | (q - p)) - ((p ^ c) + (d ^ c));
+  }
+  b = ((a & c) + (q & 82)) - ((q | 79) & (d & c));
+  b = ((d ^ d) + (p * a)) - ((d | d) & (b & b));
+  if(a < 49){
+    c = ((b - d) + (c * d)) + ((q ^ 29) & (d * q));
+  }else{
+    a = ((q - c) * (b | c)) & ((b & p) + (b & p));
+  }
+  a = ((d | b) * (p - p)) | ((c & b) - (q * b));
+  b = ((q & c) + (c * q)) | ((d - p) & (q - p));
+  c = ((b | q) * (a & d)) ^ ((b & 40) | (b | d));
+  for(i = 0; i < 26; i++){
+    d = ((b ^ q) * (p + a)) & ((d * d) - (a ^ q));
+  }
+  if(c < q){
+    c = ((c & d) ^ (b - p)) + ((p ^ p) | (p * b));
+  }else{
+    a = ((c + 82) | (p | 7)) ^ ((q + q) & (a ^ b));
+  }
+  d = ((p - b) ^ (q - 58)) * ((c + 59) | (a & c));
+  a = ((a ^ 19) | (d ^ 23)) & ((c | b) & (d ^ d));
+  c = ((b - d) | (a + b)) ^ ((q + b) ^ (b & d));
+  a = ((a + 91) * (c * a)) * ((b ^ a) ^ (p + p));
+  if(a < p){
+    b = ((p + b) & (b - q)) * ((d - b) + (a | q));
+  }else{
+    c = ((p - d) ^ (c ^ a)) + ((b * a) & (d * 12));
+  }
+  for(i = 0; i < 47; i++){
+    a = ((c - c) ^ (c - a)) - ((c & c) | (d * b));
+  }
+  d = ((p - a) + (d ^ d)) - ((p - 57) + (q * 56));
+  a = ((b | a) * (c - 14)) * ((c | p) & (p + d));
+  d = ((p | 45) | (a * q)) ^ ((p | p) ^ (b - 24));
+  if(d < 36){
+    b = ((p & a) & (a + d)) | ((p | q) & (c * 78));
+  }else{
+    a = ((p | q) | (a * 36)) | ((d * p) & (b ^ d));
+  }
+  d = ((b * q) + (c | d)) * ((p | q) ^ (d + q));
+  a = ((c ^ q) * (a - a)) * ((p & a) ^ (c + a));
+  for(i = 0; i < 14; i++){
+    c = ((d - b) ^ (c | 51)) * ((b ^ c) ^ (a ^ d));
+  }
+  a = ((p + a) & (c * p)) & ((d | a) + (a * q));
+  if(d < d){
+    a = ((b | a) * (c + 83)) | ((q | q) * (c - p));
+  }else{
+    d = ((q & c) - (b * a)) | ((p - 9) ^ (a | d));
+  }
+  a = ((p | c) & (d * b)) ^ ((a * 86) | (q + p));
+  c = ((c - d) & (a ^ 91)) | ((q ^ b) * (p - 12));
+  b = ((b * 21) ^ (q ^ c)) + ((d * b) + (p & p));
+  c = ((a ^ 18) ^ (d + a)) & ((a & d) ^ (d | c));
+  if(d < a){
+    a = ((a * b) + (p & d)) ^ ((p * 51) ^ (a - 89));
+  }else{
+    a = ((b + a) - (q + 50)) & ((d | q) + (c - b));
+  }
+  a = ((c + 14) ^ (d | d)) * ((q - 75) ^ (b * d));
+  b = ((p | 77) + (b ^ 74)) ^ ((q ^ q) | (b & 40));
+  c = ((d - 80) - (a | 18)) | ((c | a) + (q - p));
+  a = ((b * c) | (p + b)) + ((p ^ a) | (q | q));
+  if(d < a){
+    d = ((c | 90) - (q | q)) ^ ((d * 56) - (d | a));
+  }else{
+    b = ((p * d) | (c | 17)) - ((b ^ c) + (q & c));
+  }
+  a = ((d - 63) ^ (c | c)) + ((b + p) & (b * q));
+  for(i = 0; i < 39; i++){
+    c = ((c + c) - (c + p)) | ((b * p) | (q | q));
+  }
+  b = ((b * 31) * (c + 62)) | ((c * d) * (c & p));
+  a = ((p + b) + (b ^ b)) | ((b | 62) | (p & 84));
+  if(d < b){
+    a = ((a & 21) - (p - q)) * ((p * b) - (q | 36));
+  }else{
+    d = ((q & 60) ^ (b * 14)) - ((q * 79) | (p ^ c));
+  }
+  c = ((p * b) ^ (a | c)) | ((b | q) & (q & b));
+  c = ((p * p) * (d - 50)) * ((d & d) - (b * p));
+  c = ((p ^ a) & (a | b)) | ((d & p) - (b + 84));
+  for(i = 0; i < 16; i++){
+    c = ((b ^ a) ^ (p | c)) * ((d * 60) & (p * 53));
+  }
+  if(a < a){
+    b = ((a & c) | (q - 31)) & ((d & d) & (b - 34));
+  }else{
+    c = ((a ^ 85) ^ (d ^ 69)) * ((q | 98) | (c ^ b));
+  }
+  return a + b + c + d;
+}
+
+int func220(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 75;
+  d = 93;
+  a = ((q - d) * (b - d)) & ((d & d) ^ (b + p));
+  b = ((d + 73) - (b - c)) & ((d + c) & (b | d));
+  c = ((d - 42) | (a & q)) - ((d * 26) * (d & 14));
+  d = ((p ^ q) * (a ^ p)) - ((c + a) + (q | a));
+  if(b < p){
+    d = ((p & p) + (a * p)) + ((d ^ q) - (q * d));
+  }else{
+    a = ((d * d) * (a * q)) * ((p ^ 25) - (q & d));
+  }
+  d = ((d & 42) - (p * c)) + ((c + 99) | (q + d));
+  for(i = 0; i < 26; i++){
+    a = ((c & 37) - (d ^ 2)) - ((q ^ p) | (p - p));
+  }
+  b = ((a + c) + (d | 6)) + ((c & b) ^ (b - b));
+  c = ((b & p) + (p - 68)) + ((q | 31) & (c * c));
+  if(c < a){
+    b = ((d - d) + (c + a)) + ((c - p) + (a * b));
+  }else{
+    d = ((p * c) + (q & b)) & ((p ^ b) + (a * c));
+  }
+  a = ((b & p) - (a ^ p)) * ((b + b) * (b * p));
+  d = ((d | p) - (a & b)) & ((a - b) & (d ^ 56));
+  d = ((p - c) | (b | c)) | ((d * 46) - (a - p));
+  for(i = 0; i < 48; i++){
+    c = ((q + c) & (b ^ q)) * ((d - 17) + (b | a));
+  }
+  if(b < c){
+    b = ((q & p) | (d * d)) + ((p | q) * (d - a));
+  }else{
+    a = ((q - p) ^ (a ^ b)) & ((b ^ 87) & (b + d));
+  }
+  b = ((b + q) ^ (p + d)) + ((c * a) + (c - q));
+  d = ((a & a) + (d | c)) ^ ((q + d) - (d & b));
+  a = ((d ^ p) * (c ^ q)) - ((q - 28) & (c + 15));
+  b = ((p ^ a) | (a | a)) & ((b & d) * (p + a));
+  if(b < p){
+    d = ((c | 73) ^ (d & d)) * ((a | 22) | (c ^ p));
+  }else{
+    b = ((b * 3) * (q & 18)) - ((a * c) | (c ^ 87));
+  }
+  for(i = 0; i < 15; i++){
+    b = ((a | q) ^ (q | q)) & ((p & c) ^ (c - b));
+  }
+  c = ((a & b) | (q - a)) ^ ((a + b) + (q | p));
+  d = ((q * d) - (q * b)) - ((q & 21) + (c - a));
+  b = ((b | 10) * (b ^ c)) | ((p + 65) - (p & 6));
+  if(b < a){
+    c = ((c - 2) + (p ^ 19)) + ((b | b) | (c - q));
+  }else{
+    b = ((p & p) + (q ^ c)) | ((d * d) ^ (p - 11));
+  }
+  c = ((q + a) + (d ^ p)) - ((p + a) | (d + 71));
+  c = ((c * a) + (b & d)) ^ ((q + c) & (p & 94));
+  for(i = 0; i < 33; i++){
+    b = ((c ^ d) & (c | q)) - ((q | c) & (c + d));
+  }
+  d = ((a & d) * (b + 77)) | ((b * a) | (d + c));
+  if(b < c){
+    b = ((a & q) * (d | a)) - ((q - a) * (q * a));
+  }else{
+    a = ((q - d) ^ (b | a)) ^ ((b ^ b) - (q & 16));
+  }
+  b = ((p - a) & (p - 58)) & ((q | c) - (c | q));
+  a = ((c * c) * (a ^ a)) | ((c & q) | (c & c));
+  c = ((p * 50) + (c & d)) ^ ((d ^ b) & (q * b));
+  a = ((c ^ c) * (d | c)) - ((q * p) ^ (a | c));
+  if(d < p){
+    a = ((q - d) - (q - a)) * ((c * b) ^ (c ^ a));
+  }else{
+    b = ((p ^ 41) * (q | 47)) * ((p + d) - (p - d));
+  }
+  c = ((q + 83) | (c ^ d)) | ((a * a) + (b | a));
+  d = ((b - q) - (b ^ p)) - ((a - b) | (b + c));
+  b = ((d + q) * (q & c)) | ((q + d) | (d ^ p));
+  b = ((p + d) & (p + c)) | ((b + p) * (b ^ p));
+  if(c < b){
+    c = ((p + q) | (c & 35)) | ((c & d) + (d - 39));
+  }else{
+    d = ((a * 88) - (a + q)) - ((a | p) + (c * p));
+  }
+  d = ((d * q) | (b & d)) + ((c + p) + (p * 34));
+  for(i = 0; i < 12; i++){
+    c = ((q ^ 1) & (a * b)) + ((b * p) | (p - q));
+  }
+  c = ((d * b) + (p | 8)) + ((q ^ q) ^ (d + b));
+  d = ((q - b) - (p - d)) | ((a * p) & (d ^ d));
+  if(b < p){
+    a = ((q + d) & (b - b)) | ((q + p) | (d + 13));
+  }else{
+    d = ((c ^ q) + (q & 90)) & ((b * a) & (a & c));
+  }
+  b = ((p - p) + (b * 40)) - ((q ^ c) - (p ^ q));
+  c = ((a | p) ^ (c * b)) & ((p ^ a) - (q & 27));
+  c = ((p - a) & (b | b)) & ((p - 66) * (p & 18));
+  for(i = 0; i < 42; i++){
+    a = ((d + c) - (a - c)) + ((b - b) & (b ^ c));
+  }
+  if(b < c){
+    c = ((q + b) & (d - a)) & ((a + p) | (a & a));
+  }else{
+    a = ((d - 31) & (a * q)) & ((p * p) | (d | c));
+  }
+  return a + b + c + d;
+}
+
+int func221(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 71;
+  d = 94;
+  a = ((p - d) | (a & 27)) - ((c & a) * (a ^ d));
+  a = ((q | a) ^ (a ^ 19)) * ((p | b) | (p - c));
+  a = ((d & p) + (b ^ c)) - ((c & 16) + (q ^ d));
+  d = ((p * b) | (d ^ 4)) & ((b - b) ^ (d ^ p));
+  if(a < p){
+    c = ((c & 76) | (q - b)) - ((d & b) - (a + c));
+  }else{
+    a = ((q + b) ^ (p ^ d)) | ((d & a) | (a + p));
+  }
+  d = ((p | 8) * (b * d)) | ((q | d) ^ (c | a));
+  for(i = 0; i < 19; i++){
+    d = ((c ^ d) & (q ^ a)) + ((b & d) | (q | b));
+  }
+  c = ((a ^ 44) | (c & 87)) ^ ((a + 64) * (q & 92));
+  a = ((a & q) ^ (b + b)) ^ ((c ^ a) ^ (d * 32));
+  if(c < 87){
+    d = ((q ^ a) * (p ^ c)) - ((b ^ 43) - (b | q));
+  }else{
+    b = ((p - a) - (d & c)) | ((c * 98) + (q * b));
+  }
+  d = ((q ^ q) * (c + a)) - ((d - d) | (p ^ 47));
+  a = ((c * p) + (p | 86)) + ((p - q) ^ (p ^ b));
+  b = ((a - d) * (b * a)) * ((d & c) ^ (b * a));
+  for(i = 0; i < 3; i++){
+    a = ((p ^ d) + (a & q)) & ((c ^ a) | (q | a));
+  }
+  if(b < b){
+    b = ((c & p) | (c - b)) & ((d - 84) | (b - b));
+  }else{
+    a = ((d & q) - (q ^ 92)) ^ ((c * 28) ^ (c & d));
+  }
+  b = ((d | 67) - (q * 85)) & ((d & p) & (c + c));
+  b = ((d + 81) | (p * 18)) & ((p + c) & (q * 57));
+  d = ((c & c) | (a - a)) + ((q * q) & (a * a));
+  a = ((q * 15) & (b * d)) * ((p * p) ^ (q + p));
+  if(a < q){
+    a = ((c - q) & (c ^ p)) & ((a ^ d) | (a & a));
+  }else{
+    b = ((p | p) ^ (q + p)) * ((q + c) | (q & p));
+  }
+  for(i = 0; i < 34; i++){
+    c = ((p - q) | (c ^ c)) & ((a - d) | (c | c));
+  }
+  d = ((a | 2) ^ (c & q)) ^ ((p - p) * (q & 61));
+  c = ((q + d) ^ (c | q)) * ((d | c) - (a + p));
+  d = ((d * q) + (q - d)) - ((c & q) - (d ^ q));
+  if(c < b){
+    b = ((c ^ 35) - (d * 70)) - ((b + a) * (c - p));
+  }else{
+    a = ((b | p) - (d ^ b)) ^ ((d ^ 33) + (q ^ c));
+  }
+  c = ((d - q) + (b | q)) & ((b & b) & (p + c));
+  d = ((b ^ c) ^ (p * a)) * ((d - b) * (a + b));
+  for(i = 0; i < 2; i++){
+    c = ((a & p) & (c - c)) & ((d + q) - (b | c));
+  }
+  a = ((p - a) * (q * 74)) - ((b - p) | (b - 71));
+  if(d < 72){
+    d = ((c ^ a) - (a & q)) | ((c + q) & (q + 98));
+  }else{
+    a = ((q ^ 17) ^ (b ^ 32)) ^ ((q - a) - (d + q));
+  }
+  a = ((q ^ p) + (p ^ 68)) + ((p | b) & (b + d));
+  b = ((a * 4) * (a & 5)) + ((c | 70) - (d & c));
+  a = ((c | a) * (b - c)) * ((a & d) | (c - 23));
+  a = ((q + b) & (d & d)) + ((p & q) - (q * p));
+  if(a < q){
+    d = ((q & a) | (c * 3)) ^ ((p - q) | (p + c));
+  }else{
+    b = ((q & 8) * (a + p)) & ((q & p) * (b | p));
+  }
+  a = ((d + q) | (a | b)) * ((c - a) * (b * 19));
+  b = ((d ^ q) & (a - b)) - ((b & p) ^ (d & c));
+  a = ((q | d) + (b | 93)) + ((c + b) - (q ^ p));
+  d = ((b + b) | (c | c)) - ((c ^ b) + (q ^ a));
+  if(b < c){
+    a = ((b ^ q) ^ (d + c)) + ((b | a) | (d + 94));
+  }else{
+    d = ((d + d) + (c ^ 97)) ^ ((b + 11) | (b - d));
+  }
+  d = ((p - q) | (b * a)) | ((b + p) & (p & c));
+  for(i = 0; i < 24; i++){
+    a = ((a + p) & (b ^ a)) ^ ((q ^ p) + (q * 70));
+  }
+  a = ((b | p) - (q | q)) | ((q ^ d) | (b | a));
+  a = ((p + c) & (c * b)) & ((a | a) | (b + 26));
+  if(a < d){
+    c = ((c & b) ^ (a | 55)) ^ ((d ^ p) - (d | q));
+  }else{
+    a = ((q + 55) | (c * d)) | ((d + p) ^ (b ^ a));
+  }
+  b = ((q - a) * (a - c)) * ((c * q) | (b - p));
+  d = ((d | a) * (d + 76)) | ((q * c) ^ (q | d));
+  c = ((q | a) - (d ^ c)) * ((a - 6) & (p | 11));
+  for(i = 0; i < 40; i++){
+    b = ((p ^ b) + (q & b)) - ((c - c) ^ (d ^ b));
+  }
+  if(d < 74){
+    a = ((p * b) & (c | a)) | ((a * 28) ^ (a + q));
+  }else{
+    c = ((a * d) - (p ^ b)) | ((p - b) * (p - b));
+  }
+  return a + b + c + d;
+}
+
+int func222(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 18;
+  d = 24;
+  a = ((a ^ 65) * (d | d)) & ((d - 50) ^ (a | c));
+  b = ((a * q) & (d ^ c)) - ((b ^ 12) ^ (p & d));
+  b = ((p * a) + (a & 5)) * ((a & b) ^ (c | a));
+  b = ((d - q) & (q + c)) - ((a & p) ^ (q * d));
+  if(b < 55){
+    a = ((b ^ 34) ^ (b ^ a)) | ((q & b) * (p ^ 43));
+  }else{
+    a = ((q + c) | (a + q)) + ((q | a) + (d | b));
+  }
+  d = ((d & q) ^ (d - d)) ^ ((b - p) + (d & d));
+  for(i = 0; i < 44; i++){
+    d = ((c ^ 58) * (a ^ p)) ^ ((b ^ 69) * (b * b));
+  }
+  c = ((d & d) | (q * q)) + ((q + q) | (p + b));
+  d = ((b - p) * (q * p)) & ((c + q) - (p & c));
+  if(b < d){
+    a = ((p * p) | (q + q)) - ((d + b) - (p + a));
+  }else{
+    c = ((b + d) + (c + 66)) & ((p + a) & (p | c));
+  }
+  a = ((d + p) - (d ^ p)) ^ ((c | 99) + (a + q));
+  c = ((b & 1) | (p + q)) - ((b * p) - (d ^ p));
+  c = ((a * a) & (d + 50)) * ((q | q) + (q - d));
+  for(i = 0; i < 9; i++){
+    d = ((a ^ 80) & (p & 95)) | ((b ^ c) & (d - 16));
+  }
+  if(b < b){
+    d = ((d | a) ^ (c * p)) | ((q - c) * (c ^ a));
+  }else{
+    a = ((b + b) | (b * d)) & ((c ^ b) * (c + c));
+  }
+  b = ((q | 86) + (q * q)) & ((b + q) | (p + 66));
+  c = ((a * a) + (b - 9)) * ((q + b) & (d * p));
+  d = ((p - b) & (c - 67)) - ((q & c) & (d & b));
+  a = ((b + p) & (d + d)) - ((b + a) ^ (d | a));
+  if(b < c){
+    d = ((q | a) - (b ^ 74)) & ((a & 3) | (a | b));
+  }else{
+    d = ((p + a) + (b & 62)) + ((b * d) & (q - d));
+  }
+  for(i = 0; i < 14; i++){
+    c = ((b & c) + (p & c)) ^ ((c - b) * (p * 15));
+  }
+  c = ((p - b) - (q | a)) | ((c * a) + (d & p));
+  b = ((a | d) ^ (c - 22)) ^ ((a + c) ^ (p * d));
+  c = ((q | d) | (b + p)) + ((b & q) * (a | q));
+  if(c < q){
+    b = ((q & q) | (d + c)) & ((a * 53) * (p - p));
+  }else{
+    d = ((c * a) - (b * a)) & ((p - 76) | (c - q));
+  }
+  a = ((d * a) - (p * b)) | ((c - 27) - (c & b));
+  a = ((b + b) * (a | b)) & ((b - q) ^ (d * b));
+  for(i = 0; i < 21; i++){
+    d = ((p | d) - (b - p)) ^ ((q * d) & (q & d));
+  }
+  b = ((q & 30) * (p & 61)) + ((b ^ q) - (d * p));
+  if(d < 36){
+    a = ((q ^ p) ^ (p ^ 79)) | ((b | 78) - (c - a));
+  }else{
+    c = ((a * q) & (p - b)) * ((a ^ q) - (a & q));
+  }
+  b = ((d ^ c) * (c * 40)) | ((p - b) - (a + q));
+  c = ((c | q) & (q + d)) ^ ((a * q) | (b + b));
+  d = ((b * q) * (p & p)) ^ ((a ^ b) * (b ^ a));
+  a = ((c & p) + (q | p)) - ((a & a) - (c - 28));
+  if(c < 79){
+    a = ((c * a) ^ (d - a)) ^ ((d * 57) | (c & d));
+  }else{
+    d = ((p & 36) * (q | c)) & ((c - d) + (p & d));
+  }
+  a = ((c ^ q) & (b * b)) & ((q * q) & (p & p));
+  c = ((c ^ q) ^ (d | c)) * ((p - 74) * (d * q));
+  a = ((q - a) - (p - c)) & ((c * 64) * (a | p));
+  b = ((d - b) - (c & c)) | ((d | p) ^ (c * a));
+  if(a < c){
+    a = ((d + q) - (q - d)) + ((c + q) ^ (b * a));
+  }else{
+    b = ((d * c) ^ (q & d)) & ((p - a) + (d * a));
+  }
+  d = ((d ^ 30) - (d + d)) - ((p + p) ^ (c | 55));
+  for(i = 0; i < 25; i++){
+    b = ((d ^ a) & (b ^ 39)) + ((q + b) - (q ^ d));
+  }
+  c = ((p | b) * (q ^ q)) & ((d * b) ^ (q & c));
+  c = ((c ^ c) * (p ^ a)) & ((c ^ 67) | (p + b));
+  if(a < 90){
+    c = ((p + b) - (q | c)) | ((q & 11) - (b ^ q));
+  }else{
+    d = ((c - b) | (c & c)) * ((c * a) * (q & c));
+  }
+  d = ((b & d) - (q | p)) - ((a - d) & (d ^ p));
+  b = ((d | b) & (q + p)) * ((p - 58) - (d - b));
+  b = ((a * 36) + (p ^ c)) + ((d + a) - (a & a));
+  for(i = 0; i < 50; i++){
+    c = ((b & q) & (p * 31)) * ((b ^ 66) + (d & a));
+  }
+  if(a < q){
+    d = ((c - p) * (a - d)) | ((d - b) | (a | d));
+  }else{
+    a = ((p + p) - (c - a)) & ((p * 98) - (b - a));
+  }
+  return a + b + c + d;
+}
+
+int func223(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 39;
+  d = 54;
+  d = ((p ^ d) & (c - 84)) * ((q - 64) * (q & q));
+  a = ((d - a) ^ (p | a)) ^ ((p & a) ^ (p * b));
+  a = ((b - c) ^ (b & d)) - ((d + d) - (a - 9));
+  b = ((c & d) ^ (p - b)) & ((p ^ b) & (p + a));
+  if(b < c){
+    b = ((p & d) * (q | c)) ^ ((c * b) & (c ^ p));
+  }else{
+    c = ((c ^ a) - (q ^ a)) * ((a - c) & (p - q));
+  }
+  c = ((d * 42) | (c ^ b)) | ((b | d) * (d + b));
+  for(i = 0; i < 21; i++){
+    a = ((d + 55) - (b ^ p)) | ((p - q) & (a - q));
+  }
+  b = ((p * 20) ^ (c ^ a)) * ((b ^ 95) | (c & 67));
+  a = ((a * 57) | (q & q)) - ((a - 49) * (q * b));
+  if(c < q){
+    b = ((d & 10) ^ (c & 15)) + ((p - b) - (q | a));
+  }else{
+    c = ((p * 82) + (p + d)) ^ ((p * q) & (d ^ a));
+  }
+  c = ((c + 74) - (d - p)) ^ ((d * d) & (b + 51));
+  d = ((c & 89) | (d ^ 43)) - ((a | q) * (b & a));
+  a = ((q | q) & (a ^ a)) + ((p + a) - (b * 86));
+  for(i = 0; i < 21; i++){
+    c = ((q | d) * (q + 77)) * ((c & p) - (a - c));
+  }
+  if(c < p){
+    a = ((p + p) + (a - b)) | ((d & 60) * (d & 82));
+  }else{
+    a = ((p * 16) | (a & p)) + ((d | a) | (p + 8));
+  }
+  c = ((p + 76) | (a | c)) | ((a * 69) ^ (a * a));
+  b = ((q + a) | (d & a)) | ((b | c) - (a ^ 75));
+  b = ((a + 19) & (b ^ a)) + ((a - 30) * (b * 18));
+  c = ((q - b) + (q ^ c)) * ((q * 83) & (q & d));
+  if(a < 80){
+    c = ((c & 68) & (q * q)) - ((q * d) + (a * 83));
+  }else{
+    b = ((a & p) & (a * p)) - ((p ^ d) | (a ^ p));
+  }
+  for(i = 0; i < 20; i++){
+    c = ((a - 35) * (q | 45)) | ((q | p) & (a | d));
+  }
+  b = ((p | 76) & (q ^ b)) | ((a ^ c) | (p + p));
+  d = ((d & p) ^ (d ^ p)) - ((p - 94) & (p | p));
+  a = ((p * p) * (p * c)) * ((p | q) + (d + q));
+  if(a < b){
+    c = ((c * b) - (d - a)) + ((d | d) + (p + a));
+  }else{
+    d = ((b & c) * (b - d)) + ((q & p) | (a ^ q));
+  }
+  c = ((a - 81) ^ (c ^ 31)) & ((d * b) | (c - p));
+  c = ((a * p) * (b * 91)) + ((d + a) & (p & 54));
+  for(i = 0; i < 49; i++){
+    d = ((a - p) * (a ^ q)) | ((c * 56) & (q | 34));
+  }
+  d = ((p * a) * (q * c)) + ((a ^ a) * (b & p));
+  if(c < 95){
+    d = ((a - d) * (b * p)) ^ ((a * 44) ^ (c - c));
+  }else{
+    c = ((c & a) & (c * c)) + ((b ^ p) & (q + q));
+  }
+  b = ((p * b) | (p | a)) - ((d ^ b) - (d & c));
+  d = ((q | c) - (p * 93)) & ((a & b) & (d - p));
+  c = ((b | b) & (q + b)) & ((p | a) & (q | p));
+  d = ((d & d) ^ (d ^ p)) & ((p & 55) - (c - d));
+  if(d < b){
+    a = ((b - d) & (p ^ c)) ^ ((q ^ q) & (p - a));
+  }else{
+    c = ((q - q) & (q & a)) + ((b - 82) + (d * p));
+  }
+  d = ((p | d) * (a * p)) + ((c ^ a) | (d * d));
+  a = ((b ^ b) & (c | c)) + ((a + b) | (c - 97));
+  a = ((p | c) * (b + 68)) + ((b - p) - (c - 57));
+  d = ((a * 40) * (a | 95)) + ((c + p) - (a & a));
+  if(d < c){
+    c = ((c ^ 12) * (d | p)) | ((q + 51) & (p - 26));
+  }else{
+    c = ((d - d) ^ (q & d)) - ((a * a) | (b * 11));
+  }
+  b = ((d + q) ^ (q ^ 40)) ^ ((a + q) & (c ^ c));
+  for(i = 0; i < 13; i++){
+    c = ((q - q) ^ (p - 3)) & ((c & 31) ^ (d & c));
+  }
+  d = ((d & 1) + (b & b)) - ((b | p) | (c & 45));
+  d = ((c + q) | (a & b)) * ((q + 85) & (b - q));
+  if(a < 82){
+    a = ((q + p) + (q & b)) * ((c * 54) * (d & q));
+  }else{
+    b = ((c ^ d) + (d - p)) & ((a ^ 82) * (a + p));
+  }
+  b = ((p - 43) ^ (b | b)) | ((d * d) ^ (b * c));
+  b = ((p + q) + (c ^ p)) - ((b & q) * (p ^ d));
+  c = ((b ^ 84) | (c | q)) & ((q & q) | (p ^ a));
+  for(i = 0; i < 29; i++){
+    a = ((a | 73) | (a + p)) - ((d & 79) | (b & p));
+  }
+  if(d < a){
+    c = ((p | c) & (c - b)) + ((c & q) ^ (a - 8));
+  }else{
+    b = ((q * p) - (d * b)) | ((a & c) + (d + b));
+  }
+  return a + b + c + d;
+}
+
+int func224(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 87;
+  d = 43;
+  c = ((a + p) ^ (b - 70)) & ((a ^ d) * (d ^ q));
+  b = ((d | 90) * (a * 91)) | ((a * d) - (a & c));
+  d = ((d * p) ^ (d + a)) ^ ((d ^ 9) & (a - 77));
+  a = ((q & b) & (a + b)) - ((b - 87) ^ (d | 62));
+  if(a < 70){
+    c = ((d + p) & (p + 91)) & ((q ^ q) - (q * 31));
+  }else{
+    b = ((c & q) * (b & a)) | ((b - a) | (a * d));
+  }
+  b = ((b - d) ^ (d | c)) - ((b ^ p) * (a - b));
+  for(i = 0; i < 29; i++){
+    b = ((q | 97) ^ (d ^ d)) + ((c ^ d) & (d + b));
+  }
+  c = ((a & c) ^ (c ^ 1)) + ((d * a) + (p * a));
+  c = ((a & a) - (a - 79)) + ((p - b) - (p | b));
+  if(d < c){
+    c = ((d & p) & (d ^ 75)) * ((b | c) & (q * p));
+  }else{
+    d = ((d * 36) + (b + 54)) | ((p * b) - (a * 48));
+  }
+  d = ((d | p) ^ (c * q)) - ((a - 11) - (d + q));
+  d = ((q & a) - (c & 95)) + ((q & a) | (p - q));
+  d = ((a & a) + (a - p)) + ((a ^ 24) - (c + p));
+  for(i = 0; i < 8; i++){
+    a = ((q + p) - (q & a)) & ((b ^ c) - (d * 26));
+  }
+  if(b < d){
+    d = ((q - b) * (q & a)) - ((p - c) ^ (b * 97));
+  }else{
+    a = ((p * c) + (p ^ c)) & ((c & c) | (b * c));
+  }
+  b = ((q ^ q) & (p - 53)) | ((d & c) * (q - q));
+  c = ((p ^ p) & (b - 42)) ^ ((c + a) - (c + d));
+  a = ((q * b) * (b | a)) * ((c + 43) + (d + 14));
+  a = ((a * p) + (p * p)) | ((b - c) - (q + d));
+  if(b < c){
+    c = ((a | 78) & (p ^ 31)) * ((q + d) & (a + b));
+  }else{
+    c = ((q | q) & (q ^ b)) - ((c * c) & (b | q));
+  }
+  for(i = 0; i < 20; i++){
+    a = ((b & a) ^ (c * p)) ^ ((d - p) ^ (q - b));
+  }
+  a = ((q + p) & (a + a)) + ((a - c) - (d + 45));
+  b = ((a | d) ^ (a | d)) & ((c ^ b) - (q * p));
+  c = ((d | q) ^ (c | b)) | ((q + 1) & (a + b));
+  if(c < 30){
+    b = ((p * c) + (c ^ 47)) - ((p | d) | (a ^ d));
+  }else{
+    d = ((d ^ c) + (c ^ c)) * ((q * 45) * (q ^ p));
+  }
+  c = ((c - d) - (p | d)) + ((d + a) & (p + c));
+  d = ((a | b) ^ (c & c)) + ((b + a) + (a | 16));
+  for(i = 0; i < 43; i++){
+    b = ((d - p) ^ (q & q)) | ((a * b) + (c * 37));
+  }
+  c = ((b + c) ^ (a | d)) + ((c + b) - (a + p));
+  if(d < p){
+    d = ((a * b) | (p * 4)) * ((c + p) - (a ^ p));
+  }else{
+    c = ((c * c) ^ (b * 41)) - ((d | c) + (b & d));
+  }
+  a = ((b * q) - (b + b)) | ((a - c) - (c | 74));
+  d = ((p ^ b) | (p + c)) & ((q & a) - (d & q));
+  c = ((b + 44) ^ (a | 52)) - ((d * d) + (c * 67));
+  c = ((b + 32) + (d * c)) + ((b | q) - (p & q));
+  if(b < q){
+    b = ((c | 17) + (q * 22)) & ((d | q) - (p * p));
+  }else{
+    a = ((d ^ a) ^ (d - 1)) & ((d | 79) | (q & 53));
+  }
+  a = ((a ^ b) ^ (b ^ d)) | ((b ^ 26) * (c & d));
+  d = ((q ^ p) * (c ^ 17)) + ((q + p) - (q + q));
+  a = ((q & d) | (q - a)) - ((d + d) | (c * c));
+  c = ((c - q) - (a ^ q)) ^ ((p - a) * (d - 94));
+  if(c < a){
+    a = ((d ^ a) + (q * 56)) - ((c | 57) * (c ^ d));
+  }else{
+    b = ((d & b) & (b ^ 90)) + ((q | p) - (q ^ q));
+  }
+  a = ((a + a) | (p ^ 47)) * ((d ^ b) | (d ^ 5));
+  for(i = 0; i < 48; i++){
+    c = ((d ^ p) + (a ^ 79)) | ((a * 51) | (b - 17));
+  }
+  b = ((a ^ a) - (q - q)) * ((q & 78) & (a * 26));
+  c = ((a - c) + (b | c)) - ((p & d) + (c ^ a));
+  if(b < 88){
+    d = ((a + a) ^ (p + p)) + ((b | 48) ^ (a - b));
+  }else{
+    d = ((d - d) | (p * a)) + ((a - c) & (d * q));
+  }
+  b = ((p + a) - (d - p)) & ((q & a) & (a * a));
+  d = ((a & b) ^ (p | 73)) - ((d & a) ^ (b & 38));
+  b = ((p | q) - (b & 13)) & ((a - b) * (q * 35));
+  for(i = 0; i < 45; i++){
+    a = ((q | 19) * (c & d)) | ((p * d) ^ (b * a));
+  }
+  if(b < c){
+    b = ((d * a) & (a ^ p)) + ((p & 18) | (q - d));
+  }else{
+    b = ((p ^ a) - (c ^ a)) + ((c + d) + (a - a));
+  }
+  return a + b + c + d;
+}
+
+int func225(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 54;
+  d = 13;
+  a = ((p | 68) + (d - b)) - ((d + p) | (p & q));
+  b = ((d * q) * (q * b)) & ((d * a) ^ (b - 80));
+  c = ((d & p) - (b * d)) - ((q - c) - (q * p));
+  c = ((q - p) & (d ^ 4)) - ((a & b) | (p | q));
+  if(d < b){
+    b = ((b & p) * (c + d)) | ((p & a) | (b | d));
+  }else{
+    d = ((q - 91) - (d * c)) ^ ((b + 87) * (d & b));
+  }
+  a = ((a + a) ^ (d ^ d)) - ((p | d) | (p ^ a));
+  for(i = 0; i < 7; i++){
+    a = ((a - q) + (d * p)) ^ ((p & 78) ^ (p | 62));
+  }
+  d = ((d ^ q) - (a - c)) & ((q & 30) - (a & 50));
+  a = ((b - a) - (c - a)) & ((b + d) & (a ^ 72));
+  if(d < d){
+    b = ((a & 46) | (d * q)) - ((b ^ c) | (d + 26));
+  }else{
+    b = ((c & q) * (c + p)) ^ ((p & 60) & (a ^ c));
+  }
+  d = ((b & q) * (q * b)) * ((d | q) + (a | a));
+  b = ((a ^ b) ^ (q * p)) & ((q - 55) | (c - d));
+  b = ((c - c) + (p + d)) & ((c * c) & (a * q));
+  for(i = 0; i < 44; i++){
+    a = ((q + 74) * (c * a)) | ((d * c) & (b & b));
+  }
+  if(c < b){
+    d = ((q | a) + (a | p)) * ((a ^ 68) - (a ^ p));
+  }else{
+    d = ((d - 92) & (d | b)) + ((b | d) - (b & d));
+  }
+  b = ((q & b) & (c ^ c)) ^ ((q & 13) * (c - d));
+  d = ((b + p) + (b ^ a)) - ((c * q) + (d * b));
+  b = ((a - d) - (q | c)) * ((a + b) + (q & 80));
+  a = ((q & p) & (c | c)) | ((q * d) - (p | b));
+  if(a < 59){
+    b = ((d * q) ^ (q & b)) * ((c - q) * (a ^ c));
+  }else{
+    d = ((a ^ b) ^ (d & p)) | ((p * q) - (p - 45));
+  }
+  for(i = 0; i < 40; i++){
+    a = ((p ^ q) & (p - q)) - ((p | d) - (d - p));
+  }
+  d = ((a + 59) * (p ^ b)) * ((c | p) * (d | a));
+  a = ((q & b) & (b & 46)) * ((p - b) ^ (b - c));
+  b = ((d ^ d) | (a ^ d)) - ((c & p) ^ (b - d));
+  if(b < q){
+    a = ((c | c) + (b | 94)) ^ ((b | a) * (b | 64));
+  }else{
+    b = ((a - c) | (p ^ 39)) - ((a - 83) & (a - p));
+  }
+  d = ((c | d) ^ (a & a)) | ((c | 46) ^ (c & c));
+  b = ((p * d) + (q | q)) & ((d * a) & (a ^ p));
+  for(i = 0; i < 31; i++){
+    c = ((q * d) * (p * b)) - ((p * c) & (p * a));
+  }
+  a = ((q ^ c) & (q + q)) * ((a | 56) ^ (q | c));
+  if(d < q){
+    b = ((p + p) + (d - 50)) ^ ((a + q) ^ (b + c));
+  }else{
+    d = ((a + 42) * (p * q)) & ((a ^ p) | (a | p));
+  }
+  d = ((p | a) ^ (a - a)) + ((q * p) & (d ^ 82));
+  d = ((d + p) & (b - 8)) ^ ((c & a) & (a | a));
+  a = ((p - b) ^ (a * q)) ^ ((q | d) ^ (d * 57));
+  a = ((p & b) & (c | q)) ^ ((p ^ c) | (b * q));
+  if(a < 71){
+    c = ((p + b) + (c + p)) * ((d - b) ^ (d * 55));
+  }else{
+    c = ((a + 30) ^ (d & 36)) + ((a * c) - (c & q));
+  }
+  c = ((d - 1) | (b | 20)) + ((p & a) | (a + b));
+  b = ((b ^ q) + (d & d)) * ((q ^ 56) * (b + b));
+  b = ((q + d) ^ (c & q)) ^ ((b - a) * (b + 78));
+  d = ((q ^ 44) ^ (d - 64)) + ((d + p) & (p + p));
+  if(d < q){
+    a = ((p & b) - (q + p)) + ((a ^ p) - (d * q));
+  }else{
+    c = ((p & a) * (q & q)) | ((p + c) - (b & c));
+  }
+  a = ((a | q) | (p ^ d)) & ((q + b) - (q | p));
+  for(i = 0; i < 38; i++){
+    b = ((c & p) - (p * 44)) ^ ((p - p) ^ (a & c));
+  }
+  b = ((p | b) & (c + a)) - ((p * 90) & (b * b));
+  d = ((a ^ 30) * (b | p)) + ((c * 58) ^ (c - d));
+  if(a < d){
+    a = ((d * b) ^ (d - q)) & ((a * q) | (a - 72));
+  }else{
+    a = ((c | q) | (b + d)) & ((d ^ p) + (a & d));
+  }
+  a = ((c + q) & (c & 92)) ^ ((b * p) - (p - 6));
+  d = ((b * 17) + (p - c)) - ((a & a) ^ (q * b));
+  c = ((a ^ d) + (c & q)) & ((c ^ c) + (b & q));
+  for(i = 0; i < 23; i++){
+    d = ((q | 84) ^ (d ^ 55)) * ((q * b) | (p + 90));
+  }
+  if(b < d){
+    d = ((b ^ 11) | (d & a)) + ((c & c) & (d + q));
+  }else{
+    d = ((p | 92) - (b | d)) + ((a * q) ^ (q & 24));
+  }
+  return a + b + c + d;
+}
+
+int func226(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 73;
+  d = 4;
+  b = ((b ^ q) & (c * b)) * ((c + p) * (c + b));
+  b = ((d | p) ^ (d ^ q)) + ((b & 52) ^ (b + 25));
+  b = ((a ^ p) - (a ^ b)) - ((b - 69) + (d - d));
+  a = ((q & q) + (q * 71)) - ((a * a) + (c | a));
+  if(a < 23){
+    d = ((p ^ a) - (p + 97)) ^ ((p | c) + (d * 98));
+  }else{
+    c = ((q | a) & (c * 91)) * ((a * q) + (p * b));
+  }
+  a = ((d ^ q) * (p | a)) * ((c ^ q) - (p ^ 60));
+  for(i = 0; i < 6; i++){
+    d = ((q | 96) ^ (q ^ q)) | ((a ^ d) ^ (d & c));
+  }
+  c = ((a | q) * (c + q)) * ((p * p) + (p ^ 99));
+  c = ((b + c) + (c + p)) * ((d * 2) | (p | 59));
+  if(a < b){
+    d = ((c + c) | (q | 5)) - ((p * b) | (c - d));
+  }else{
+    a = ((b ^ 89) ^ (b + q)) | ((p | 49) ^ (b - b));
+  }
+  d = ((p ^ b) * (c - c)) | ((p + b) * (b | c));
+  a = ((a * 21) * (c & p)) + ((c ^ c) * (b * 74));
+  c = ((d + p) & (p - a)) * ((p ^ p) & (b * q));
+  for(i = 0; i < 37; i++){
+    b = ((d * d) & (c & p)) | ((q & d) * (a + d));
+  }
+  if(d < b){
+    a = ((c & c) ^ (a | p)) - ((p - d) - (p & a));
+  }else{
+    a = ((d - d) - (c + q)) & ((q ^ d) * (b | d));
+  }
+  b = ((b | q) + (p + q)) * ((p ^ q) + (d | c));
+  a = ((b | c) * (b * d)) ^ ((c * 49) + (a + 24));
+  a = ((p & 35) * (d - d)) - ((p ^ d) + (a | c));
+  b = ((b + c) - (p | p)) * ((b * c) ^ (p | a));
+  if(c < 10){
+    d = ((b & d) & (q + b)) * ((d + d) ^ (q + 46));
+  }else{
+    a = ((q | p) ^ (p | q)) | ((q - p) - (p - q));
+  }
+  for(i = 0; i < 13; i++){
+    a = ((p | d) * (c & 29)) - ((a ^ d) - (p + d));
+  }
+  a = ((d + q) + (a - d)) ^ ((d | c) * (d - p));
+  c = ((p ^ q) | (d & b)) ^ ((p * b) & (d ^ c));
+  c = ((b & q) - (d * 23)) + ((q & b) + (a & 48));
+  if(a < d){
+    d = ((b ^ b) + (b - a)) - ((d & q) & (a * q));
+  }else{
+    a = ((c - a) - (q - d)) | ((b & a) & (c - 11));
+  }
+  a = ((c + c) * (c | q)) ^ ((p + 9) | (b * 91));
+  a = ((q * p) + (q + 36)) ^ ((b - q) * (c ^ p));
+  for(i = 0; i < 18; i++){
+    d = ((q - p) ^ (d | d)) - ((p & a) - (p * d));
+  }
+  a = ((p & a) * (a & q)) + ((c - a) - (b & a));
+  if(d < d){
+    a = ((p * d) * (p * 78)) * ((q & c) ^ (d - 17));
+  }else{
+    d = ((p | 27) | (p * 13)) ^ ((a & q) & (p * d));
+  }
+  d = ((d | q) + (c - 76)) + ((p ^ a) + (b * p));
+  b = ((q * c) - (a * 24)) * ((b & 67) * (p * 64));
+  a = ((a & b) | (c - b)) - ((b + 43) ^ (p + p));
+  a = ((c & q) - (b & p)) & ((b * p) + (c * c));
+  if(c < q){
+    d = ((c - p) * (a & 18)) | ((d | c) ^ (b & p));
+  }else{
+    c = ((q ^ 80) + (p & 33)) ^ ((b & d) + (c - 96));
+  }
+  a = ((q ^ b) & (q + d)) - ((b * p) | (q | 55));
+  a = ((d - 86) & (d * 14)) ^ ((p ^ c) ^ (c ^ 82));
+  d = ((q * c) | (a | p)) - ((a & a) * (a + d));
+  a = ((p | 79) & (q + 38)) & ((c & p) + (c ^ d));
+  if(b < b){
+    c = ((q ^ p) ^ (q - c)) & ((d - b) ^ (c | a));
+  }else{
+    a = ((b | c) - (b ^ p)) * ((a - 1) - (a - q));
+  }
+  b = ((p * 78) ^ (q ^ b)) * ((c - 10) | (p & c));
+  for(i = 0; i < 46; i++){
+    a = ((c | q) | (q * c)) - ((a & q) ^ (d + 26));
+  }
+  a = ((c * d) ^ (q + d)) * ((d | 91) * (q * a));
+  b = ((d + p) & (c * a)) & ((c ^ d) + (d - 29));
+  if(a < d){
+    d = ((p - a) * (d + 11)) - ((q & b) & (a & a));
+  }else{
+    d = ((a ^ a) | (c * 29)) - ((b & c) | (d & c));
+  }
+  c = ((d * 71) * (c ^ c)) * ((c | a) & (c - q));
+  c = ((d + 23) + (b * c)) * ((d - b) - (a * b));
+  c = ((a + q) & (p * d)) ^ ((d + a) - (c - 9));
+  for(i = 0; i < 49; i++){
+    a = ((b & q) | (p & p)) * ((b | 62) ^ (p - p));
+  }
+  if(c < q){
+    c = ((p - 27) - (d ^ a)) * ((c * b) * (q - c));
+  }else{
+    b = ((d & q) | (a + b)) - ((q ^ c) * (p & a));
+  }
+  return a + b + c + d;
+}
+
+int func227(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 29;
+  d = 7;
+  d = ((d + d) | (p + 8)) - ((d * c) - (b + p));
+  c = ((c + q) ^ (p - 83)) * ((q * 94) + (p & a));
+  b = ((a | b) + (c | q)) + ((p + 65) + (a - p));
+  d = ((b ^ 59) | (q * a)) & ((c - b) + (p * a));
+  if(a < b){
+    b = ((b + 90) | (p & c)) * ((c ^ 3) & (b * 5));
+  }else{
+    b = ((c | 79) | (q ^ b)) + ((p & c) & (b - b));
+  }
+  a = ((q ^ 21) * (b * q)) - ((a & b) ^ (b & p));
+  for(i = 0; i < 10; i++){
+    c = ((d + a) * (p - 40)) ^ ((d - d) - (b ^ b));
+  }
+  b = ((q + c) + (b & p)) * ((d ^ 37) - (q * q));
+  b = ((a - d) | (d + 2)) & ((p & c) + (b * q));
+  if(a < d){
+    b = ((q & q) & (c * 57)) & ((b * 1) * (p * c));
+  }else{
+    d = ((q ^ 36) * (a ^ 63)) * ((c & c) | (c + q));
+  }
+  c = ((c ^ p) + (p & c)) * ((a + p) + (b ^ a));
+  d = ((a + d) ^ (b | c)) | ((b + p) - (d ^ 83));
+  a = ((p | p) - (a + d)) + ((c ^ a) + (q - 37));
+  for(i = 0; i < 38; i++){
+    d = ((q * a) ^ (p | c)) | ((a * d) | (b ^ a));
+  }
+  if(a < q){
+    a = ((p ^ 23) + (a * b)) | ((b * b) * (p + a));
+  }else{
+    d = ((b | b) * (q - b)) + ((d + 65) + (q * c));
+  }
+  d = ((p & q) - (a | b)) | ((d ^ q) & (c | 47));
+  a = ((p | 48) * (b | b)) * ((a - q) - (q | p));
+  b = ((b - p) | (b - d)) * ((b & c) & (d + b));
+  c = ((a + d) + (c | 88)) - ((a * 89) ^ (d - b));
+  if(c < p){
+    d = ((a - c) | (q - d)) ^ ((a + c) * (a ^ d));
+  }else{
+    b = ((q + p) - (d ^ 75)) + ((a | q) | (a * 6));
+  }
+  for(i = 0; i < 36; i++){
+    c = ((p + d) & (a * q)) & ((p & b) - (b | a));
+  }
+  b = ((b * q) | (p ^ p)) * ((c * q) * (c * d));
+  a = ((q - d) & (b + 67)) | ((p + a) ^ (p - q));
+  c = ((d | 9) + (c | d)) * ((p ^ d) * (q & a));
+  if(a < b){
+    d = ((c & b) | (a ^ c)) ^ ((c - c) + (c + b));
+  }else{
+    c = ((c | 3) ^ (p ^ q)) | ((b & q) ^ (a & 55));
+  }
+  a = ((d ^ 53) & (d | b)) | ((b + b) - (q + c));
+  b = ((d + p) - (a - d)) ^ ((a ^ a) & (a * q));
+  for(i = 0; i < 47; i++){
+    d = ((c * c) * (c - q)) | ((b - a) - (c + p));
+  }
+  a = ((p * a) & (d & q)) * ((d * a) + (q ^ p));
+  if(c < c){
+    d = ((a * b) & (q - 19)) ^ ((p + d) - (d | 90));
+  }else{
+    a = ((d ^ p) | (b | c)) & ((c + b) ^ (b + 61));
+  }
+  b = ((b - a) & (d & a)) ^ ((b + a) ^ (a & q));
+  b = ((c + a) + (p - a)) + ((b & d) ^ (c | c));
+  b = ((c + c) * (d * 74)) + ((c + a) + (q * b));
+  b = ((q * q) & (p - 2)) + ((b + 22) | (q | 64));
+  if(a < p){
+    d = ((d & q) - (b & a)) * ((q | a) & (d | p));
+  }else{
+    a = ((d & q) | (q * c)) | ((q * q) | (a + p));
+  }
+  a = ((d | 59) | (c | q)) | ((p ^ 30) | (c + b));
+  a = ((d & d) ^ (p & 80)) & ((p - q) | (p | b));
+  d = ((q + c) | (c * p)) + ((a & a) - (c | p));
+  a = ((c * b) * (b & c)) | ((a + p) * (q & 95));
+  if(c < 46){
+    d = ((a ^ q) | (q & p)) & ((p & q) * (c + b));
+  }else{
+    b = ((b + d) ^ (q | d)) + ((b * d) & (p + 77));
+  }
+  c = ((d | c) * (q - 91)) & ((q & p) & (p + 58));
+  for(i = 0; i < 22; i++){
+    d = ((a * d) * (p ^ 2)) ^ ((p * p) - (p ^ 44));
+  }
+  d = ((p ^ d) - (c - 12)) ^ ((d | p) - (d | 11));
+  a = ((d ^ c) + (c * q)) + ((p - 77) * (c - 69));
+  if(a < b){
+    c = ((p - d) | (a - b)) ^ ((d ^ 68) * (d * q));
+  }else{
+    d = ((p & d) - (c * 76)) - ((q * c) * (a | b));
+  }
+  d = ((p ^ d) | (p * b)) - ((q ^ c) | (q * p));
+  b = ((p * b) & (a & a)) | ((p * p) - (q & 14));
+  c = ((p * c) ^ (c - d)) & ((c - 45) ^ (c | d));
+  for(i = 0; i < 17; i++){
+    b = ((a - q) - (c & 49)) + ((b + p) + (p * p));
+  }
+  if(c < a){
+    c = ((d | p) - (a + c)) ^ ((c ^ c) + (q - c));
+  }else{
+    b = ((b * b) | (c & c)) + ((p + c) | (d & a));
+  }
+  return a + b + c + d;
+}
+
+int func228(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 55;
+  d = 42;
+  b = ((c + d) & (c ^ b)) | ((q ^ b) * (p ^ d));
+  a = ((a + q) * (d & q)) | ((b - c) ^ (a & 35));
+  c = ((p ^ p) | (q + 93)) * ((d | b) + (c & 37));
+  c = ((q + c) + (q + a)) ^ ((d + c) | (p | a));
+  if(c < c){
+    c = ((b + p) + (q | q)) - ((c | 2) & (c | c));
+  }else{
+    a = ((q * 49) * (c ^ d)) + ((q & c) | (d + q));
+  }
+  b = ((a - b) * (b * c)) + ((c & b) + (a & c));
+  for(i = 0; i < 5; i++){
+    d = ((d + p) & (p + a)) - ((d ^ d) ^ (b - a));
+  }
+  a = ((q & q) & (d + p)) * ((d ^ 34) - (a * b));
+  d = ((a & a) * (b * 74)) + ((q | a) + (d - b));
+  if(a < q){
+    c = ((d ^ c) ^ (b - a)) & ((p + c) - (p * 1));
+  }else{
+    c = ((b ^ b) | (b & d)) + ((c + c) | (c | q));
+  }
+  d = ((b | a) | (a & c)) ^ ((p | b) & (p - 96));
+  c = ((d ^ a) * (b | 76)) | ((b - c) * (p + p));
+  a = ((a - q) + (p + d)) - ((b + 70) * (p & d));
+  for(i = 0; i < 18; i++){
+    c = ((a | c) & (a | b)) - ((q - 50) + (a & d));
+  }
+  if(b < p){
+    a = ((q & p) * (p * b)) + ((p + a) ^ (d ^ a));
+  }else{
+    d = ((q + c) | (a - p)) ^ ((q * q) & (b ^ p));
+  }
+  d = ((q | a) - (q & q)) - ((c + p) & (c - q));
+  a = ((b * q) - (d - p)) - ((c ^ d) + (a | b));
+  b = ((d + c) & (p + c)) & ((c * b) + (c | q));
+  c = ((c + a) & (c + a)) ^ ((q | 5) - (b + 78));
+  if(d < 30){
+    a = ((q + q) + (q | d)) * ((q - 80) ^ (d - 62));
+  }else{
+    d = ((b * a) * (p | d)) + ((a + 74) & (d | c));
+  }
+  for(i = 0; i < 9; i++){
+    a = ((p * q) * (c + a)) & ((q * 58) ^ (p & 22));
+  }
+  d = ((c | p) - (q - c)) + ((p * 31) - (q | 44));
+  c = ((d + b) * (p * a)) + ((b ^ b) * (p ^ c));
+  c = ((c + c) - (q | 21)) & ((c & 86) | (d + b));
+  if(a < a){
+    a = ((q + q) - (b ^ 67)) + ((c ^ p) | (p * 57));
+  }else{
+    c = ((q ^ p) ^ (d ^ 13)) & ((a & b) & (b + a));
+  }
+  a = ((p & p) & (c & b)) + ((c & 51) + (p * a));
+  a = ((c * 11) - (p * a)) - ((p + a) - (q ^ 68));
+  for(i = 0; i < 20; i++){
+    a = ((c + 83) ^ (p - a)) - ((d ^ q) * (d + 27));
+  }
+  a = ((c * p) & (q & b)) + ((b + a) | (p ^ 38));
+  if(b < b){
+    b = ((a ^ q) ^ (d * c)) - ((p * 36) ^ (b - c));
+  }else{
+    b = ((b * q) + (q - q)) + ((p & c) ^ (b | d));
+  }
+  d = ((a & p) | (a + c)) - ((c & d) | (c - q));
+  b = ((p - 92) - (d | b)) * ((a | b) * (p ^ p));
+  d = ((a | a) * (p * p)) ^ ((d | b) + (q & a));
+  d = ((q * 94) + (c * a)) & ((d & c) | (d - 39));
+  if(c < a){
+    c = ((a * b) & (a - 71)) | ((a - b) - (b ^ b));
+  }else{
+    a = ((a | b) & (q - 96)) - ((d ^ p) + (q | 15));
+  }
+  a = ((c | 20) | (q + q)) | ((p + b) * (p * 9));
+  c = ((b * 33) - (p + a)) - ((q ^ d) & (d * q));
+  c = ((q ^ 58) * (c & d)) * ((d ^ c) - (d - c));
+  b = ((c | c) * (p ^ d)) + ((c ^ 30) & (d * p));
+  if(c < p){
+    c = ((q ^ 29) & (q * q)) ^ ((q & a) * (c - p));
+  }else{
+    c = ((a ^ d) | (p * p)) | ((q ^ b) ^ (q & b));
+  }
+  d = ((b & c) - (b ^ b)) + ((q & 3) + (d ^ d));
+  for(i = 0; i < 8; i++){
+    d = ((a * d) & (q & d)) - ((b & p) | (q & a));
+  }
+  b = ((c - b) | (b | c)) + ((a ^ a) - (b + c));
+  a = ((c * 8) - (p ^ q)) ^ ((p * p) | (q + d));
+  if(c < a){
+    b = ((p + p) & (q | p)) + ((c ^ p) ^ (c * p));
+  }else{
+    d = ((p & a) + (c * 76)) | ((a | d) * (b & 32));
+  }
+  b = ((a & c) | (b | b)) + ((b - b) + (p * c));
+  d = ((q | p) + (q * q)) | ((b | b) + (c & b));
+  c = ((a + d) ^ (q ^ 60)) ^ ((d ^ a) & (a * 3));
+  for(i = 0; i < 2; i++){
+    a = ((d + p) | (a + b)) & ((c & a) + (b | b));
+  }
+  if(a < b){
+    a = ((d + d) | (q & 1)) - ((q - d) + (p | c));
+  }else{
+    d = ((a * a) * (a | a)) | ((d & 93) + (a | a));
+  }
+  return a + b + c + d;
+}
+
+int func229(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 7;
+  d = 36;
+  a = ((p ^ a) ^ (c - d)) + ((a & p) & (p * q));
+  d = ((c ^ d) & (a + 98)) + ((q + b) * (d * a));
+  d = ((d * p) & (p & 17)) + ((q | a) | (p | q));
+  b = ((d ^ q) * (a | q)) - ((d ^ p) | (d | d));
+  if(a < 67){
+    d = ((c | 89) ^ (b * b)) * ((q + p) - (c * p));
+  }else{
+    d = ((p - c) ^ (p & a)) - ((q - a) ^ (q | q));
+  }
+  c = ((b | c) | (q - 96)) & ((p ^ 59) & (b | c));
+  for(i = 0; i < 25; i++){
+    c = ((d + p) ^ (q * 64)) + ((a - b) & (a | p));
+  }
+  c = ((c | d) ^ (d | 15)) ^ ((c + c) ^ (b | b));
+  d = ((d - d) ^ (q * q)) ^ ((q | 88) & (d + a));
+  if(c < a){
+    c = ((q + c) | (q ^ c)) ^ ((a ^ d) - (b | p));
+  }else{
+    d = ((d * c) ^ (d | a)) - ((d * 17) ^ (a ^ b));
+  }
+  a = ((a - 6) - (c * p)) * ((d + a) * (b * a));
+  b = ((b ^ q) & (d * c)) + ((a ^ q) - (c ^ 97));
+  c = ((p | c) ^ (a | a)) - ((q | c) | (q * p));
+  for(i = 0; i < 14; i++){
+    d = ((b - p) | (a & p)) & ((q - 8) * (a & p));
+  }
+  if(a < q){
+    b = ((c | b) & (b + a)) ^ ((p | p) + (c * p));
+  }else{
+    d = ((d | p) ^ (c - 20)) * ((a & p) ^ (p | c));
+  }
+  a = ((c - d) * (q | q)) ^ ((c ^ q) * (d ^ d));
+  b = ((a * 5) ^ (b - p)) & ((p ^ c) | (q * 1));
+  a = ((d | d) - (q + a)) & ((b ^ q) + (c - d));
+  b = ((b ^ b) | (d ^ d)) | ((d & 14) - (p | q));
+  if(c < d){
+    b = ((d + 69) | (d ^ p)) - ((b - p) ^ (c * p));
+  }else{
+    a = ((d | d) ^ (d ^ 40)) & ((a | a) & (p + d));
+  }
+  for(i = 0; i < 15; i++){
+    c = ((c & q) - (p + d)) | ((b & a) & (b - c));
+  }
+  d = ((c ^ a) - (d - b)) * ((c - b) | (q | c));
+  b = ((d * b) & (p - 96)) + ((b * c) + (p & a));
+  d = ((d | b) & (q - 2)) * ((a * 27) + (p | c));
+  if(c < d){
+    d = ((b & p) ^ (b + c)) - ((q * a) + (q + 78));
+  }else{
+    c = ((d ^ b) - (p + 14)) + ((c - 54) & (q | c));
+  }
+  b = ((p ^ b) + (b ^ b)) & ((d ^ b) - (q & p));
+  c = ((d & c) & (c * b)) & ((a + d) ^ (d + q));
+  for(i = 0; i < 33; i++){
+    c = ((q * c) | (a + p)) - ((a - 51) | (d * q));
+  }
+  d = ((b & 26) * (p & q)) * ((b + 45) | (a | d));
+  if(d < d){
+    a = ((q * q) & (p + d)) * ((p - p) + (q | c));
+  }else{
+    c = ((p * 21) + (a * b)) ^ ((p - b) | (p ^ b));
+  }
+  a = ((c - q) ^ (a - 8)) | ((q - d) - (b & b));
+  a = ((d + 88) - (q * a)) + ((p | c) ^ (q ^ 41));
+  b = ((p - d) * (p & c)) ^ ((b + p) - (b * b));
+  d = ((a - q) * (a | 70)) ^ ((d | b) ^ (q | 52));
+  if(c < q){
+    c = ((a | q) | (a & 94)) - ((a & 67) + (p - 83));
+  }else{
+    b = ((p ^ 37) | (c * p)) ^ ((c * a) & (p & a));
+  }
+  c = ((d * 79) - (p | d)) & ((c - q) ^ (a ^ a));
+  b = ((c - b) ^ (q * p)) | ((p & 77) ^ (b | b));
+  d = ((a | 42) * (d + q)) + ((p + 22) * (p - 61));
+  c = ((b | d) * (d & q)) | ((p - q) | (d | 86));
+  if(a < b){
+    d = ((d - q) - (a - 97)) + ((a * p) + (b | a));
+  }else{
+    b = ((b & 83) + (a - d)) | ((q | b) * (b + d));
+  }
+  c = ((p + c) - (b | q)) & ((c | b) + (a - b));
+  for(i = 0; i < 32; i++){
+    b = ((p - a) - (c - 44)) & ((p & 27) - (b ^ c));
+  }
+  c = ((c + a) & (a + a)) & ((d & c) ^ (d | a));
+  c = ((c ^ d) | (p & a)) ^ ((p - a) | (d - a));
+  if(c < 1){
+    d = ((d ^ a) * (q - b)) | ((c + 14) - (p - a));
+  }else{
+    b = ((q | p) & (b + 78)) + ((a - q) * (p | a));
+  }
+  c = ((a + c) + (c & c)) - ((d | 25) ^ (c ^ 34));
+  b = ((a + p) | (c * b)) * ((d + p) ^ (c - q));
+  d = ((p & c) * (c | d)) | ((a - c) & (d | 36));
+  for(i = 0; i < 28; i++){
+    b = ((b - p) & (c - q)) ^ ((q - b) - (c * a));
+  }
+  if(c < b){
+    c = ((d + q) | (d | 28)) * ((p - p) - (d + b));
+  }else{
+    b = ((c - q) | (b ^ a)) + ((b + a) | (a + 84));
+  }
+  return a + b + c + d;
+}
+
+int func230(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 22;
+  d = 42;
+  c = ((a & d) * (p ^ 7)) * ((p & a) ^ (q * d));
+  b = ((q - d) - (q | q)) * ((p - c) & (p & q));
+  b = ((c + 31) * (q + 66)) - ((p * 71) + (d & c));
+  b = ((p ^ p) + (b - q)) - ((q - b) ^ (q ^ p));
+  if(b < p){
+    d = ((p & 68) + (d ^ 34)) * ((d + q) & (p * a));
+  }else{
+    b = ((d - 9) + (d + d)) & ((c * d) * (p * a));
+  }
+  b = ((c * c) * (q ^ q)) ^ ((b * a) - (a + 97));
+  for(i = 0; i < 20; i++){
+    a = ((q + 27) ^ (c + d)) & ((q ^ b) | (a | a));
+  }
+  d = ((c - 57) - (c - b)) - ((c * c) & (d - a));
+  b = ((a & a) ^ (q * 16)) | ((d * a) | (a ^ p));
+  if(b < 93){
+    a = ((q - p) - (b - c)) & ((c ^ q) - (c ^ a));
+  }else{
+    c = ((p ^ q) ^ (p ^ p)) | ((c - q) * (b * 2));
+  }
+  b = ((q - p) & (p & d)) * ((b * 27) - (q - p));
+  a = ((d ^ p) ^ (p - q)) | ((c ^ d) + (q | 44));
+  c = ((a ^ 73) + (a ^ a)) - ((a | c) + (d & b));
+  for(i = 0; i < 41; i++){
+    b = ((c - b) * (a | c)) & ((d - 71) ^ (q * 62));
+  }
+  if(d < d){
+    c = ((b - 98) + (a * c)) + ((d * q) * (p - c));
+  }else{
+    d = ((b * 76) & (d + 40)) ^ ((a & q) + (b - a));
+  }
+  c = ((a * a) | (q | 25)) - ((p & q) & (p - a));
+  d = ((p * 60) - (b & p)) ^ ((q | c) | (b + 47));
+  a = ((p | q) & (c & q)) - ((b & b) - (b | a));
+  c = ((d + a) & (b - c)) & ((p * q) ^ (p ^ a));
+  if(d < q){
+    c = ((p & c) - (b | c)) ^ ((d & c) | (a * 48));
+  }else{
+    a = ((d * p) & (q | 69)) & ((c | d) - (a | c));
+  }
+  for(i = 0; i < 11; i++){
+    c = ((d ^ b) & (p ^ b)) + ((c | 46) + (q * 15));
+  }
+  b = ((q + b) + (a ^ q)) & ((c * p) + (q - c));
+  b = ((c ^ p) | (c | p)) | ((c & 25) * (p & b));
+  d = ((b * d) * (a | q)) | ((d ^ 58) + (c ^ d));
+  if(d < d){
+    c = ((q - c) & (p * 78)) & ((q + q) - (b - b));
+  }else{
+    a = ((b ^ c) - (p & a)) & ((c | a) | (a - q));
+  }
+  d = ((q & c) ^ (b - b)) - ((d & a) & (d + b));
+  c = ((a - 76) | (d + b)) + ((p + 14) | (p - a));
+  for(i = 0; i < 42; i++){
+    d = ((a - c) | (c & p)) ^ ((c + a) - (a + 24));
+  }
+  a = ((b * p) ^ (p & 27)) + ((q + c) & (d ^ a));
+  if(a < 11){
+    c = ((c + p) + (b - d)) - ((d | q) | (d | p));
+  }else{
+    d = ((p * c) + (q - 60)) + ((d + q) & (a | c));
+  }
+  b = ((d + a) | (a & b)) * ((p * d) + (p | 62));
+  b = ((p ^ a) - (p | a)) - ((b - a) ^ (q + c));
+  a = ((p | b) + (b & 70)) + ((c | a) & (a | 17));
+  b = ((b * b) & (q - d)) + ((d ^ q) + (c * b));
+  if(c < c){
+    a = ((d - c) & (a & p)) * ((a ^ a) * (c - a));
+  }else{
+    c = ((a ^ c) + (a - d)) & ((a & p) ^ (d + d));
+  }
+  c = ((b + b) * (p & q)) & ((d ^ c) + (q - b));
+  c = ((c | b) - (a | q)) & ((b ^ 40) ^ (c ^ d));
+  a = ((q - 22) - (c - c)) - ((a * b) + (c ^ d));
+  b = ((q + p) + (b * p)) | ((p | 86) - (c ^ d));
+  if(d < q){
+    b = ((d | a) + (c | c)) | ((q | a) & (p - b));
+  }else{
+    a = ((d ^ 39) ^ (q - b)) * ((c + p) - (q - d));
+  }
+  d = ((d | 22) & (q - 91)) * ((b * d) ^ (a & a));
+  for(i = 0; i < 22; i++){
+    c = ((d - c) + (p + q)) - ((q ^ c) | (a + c));
+  }
+  b = ((b * c) & (p ^ 67)) | ((b & c) & (b ^ q));
+  a = ((a & b) * (q ^ q)) * ((b * 33) & (c - p));
+  if(b < b){
+    c = ((b * a) | (c | 25)) | ((b & q) ^ (p | q));
+  }else{
+    a = ((p | a) + (c + c)) - ((b * a) & (d | c));
+  }
+  b = ((c + b) | (b ^ 50)) * ((d | 88) + (a | p));
+  d = ((q + c) * (a - c)) & ((q * 58) * (d & 36));
+  c = ((q | p) & (d ^ q)) | ((c - b) * (p + 7));
+  for(i = 0; i < 16; i++){
+    b = ((a + q) * (b * 97)) | ((a * 74) & (q ^ p));
+  }
+  if(b < c){
+    c = ((b * d) + (d * p)) | ((a ^ d) & (b + q));
+  }else{
+    a = ((d * q) - (b & q)) * ((a ^ 31) ^ (b - p));
+  }
+  return a + b + c + d;
+}
+
+int func231(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 55;
+  d = 86;
+  a = ((d + d) + (d ^ a)) | ((d & 71) * (p & 36));
+  b = ((p + p) | (p ^ p)) ^ ((q | b) - (d ^ c));
+  d = ((c & d) - (d ^ 59)) + ((c | d) ^ (a + c));
+  d = ((q - a) & (b ^ q)) - ((c ^ a) ^ (c * d));
+  if(c < q){
+    c = ((a & p) | (a ^ c)) & ((c & 34) & (c - d));
+  }else{
+    a = ((a - p) ^ (a + b)) | ((b ^ q) & (d - p));
+  }
+  d = ((q | d) * (p * a)) ^ ((p | a) ^ (q | c));
+  for(i = 0; i < 32; i++){
+    d = ((d | a) ^ (a + 6)) - ((d & 64) & (d | c));
+  }
+  a = ((d & 30) & (a | 38)) + ((b + a) | (q * q));
+  c = ((p * a) & (q + p)) & ((b ^ d) - (p | 40));
+  if(b < d){
+    b = ((c + b) * (c | 51)) & ((q ^ q) - (d ^ 68));
+  }else{
+    b = ((d | 79) * (q + b)) & ((c ^ c) + (d & b));
+  }
+  d = ((b * q) ^ (p - a)) - ((c + d) & (d + q));
+  c = ((b + d) ^ (q + c)) - ((b + b) * (c * 32));
+  a = ((b * q) | (b * d)) + ((b & d) - (q * c));
+  for(i = 0; i < 6; i++){
+    a = ((q * d) | (a + 56)) | ((d ^ d) | (d + a));
+  }
+  if(a < b){
+    d = ((p + p) - (d - b)) ^ ((d + b) * (d + c));
+  }else{
+    b = ((a & b) + (a + a)) * ((d | a) ^ (b - 14));
+  }
+  a = ((a ^ 61) & (c | c)) ^ ((q - q) | (c * d));
+  a = ((c ^ 70) | (d & d)) - ((b & 54) & (p * d));
+  c = ((q + b) * (c | p)) & ((q + q) - (d * p));
+  c = ((c | d) & (a * c)) * ((a * a) * (b & d));
+  if(a < 65){
+    d = ((d * 41) - (c + d)) * ((p & d) ^ (a * b));
+  }else{
+    b = ((p + d) + (b ^ d)) & ((c * c) + (a & d));
+  }
+  for(i = 0; i < 28; i++){
+    a = ((c * q) ^ (c | q)) & ((a + p) - (q ^ b));
+  }
+  b = ((c - 86) - (d & p)) | ((p | c) ^ (b & 45));
+  c = ((d ^ c) ^ (c + d)) | ((a - 98) ^ (c + d));
+  d = ((d ^ q) | (p + a)) | ((d ^ q) * (p & b));
+  if(d < a){
+    c = ((q ^ p) - (d - d)) | ((c & b) * (c - d));
+  }else{
+    b = ((b * a) & (p + q)) * ((a + d) + (b | b));
+  }
+  c = ((d + 58) ^ (a + 99)) & ((p - b) ^ (p + q));
+  d = ((q - 11) - (a + a)) - ((b * c) * (q | b));
+  for(i = 0; i < 27; i++){
+    b = ((q * q) ^ (c & p)) - ((q - 44) | (p + d));
+  }
+  d = ((c & b) - (b | c)) + ((q + b) ^ (d ^ d));
+  if(a < b){
+    a = ((b - d) & (p * c)) + ((c | p) * (d + c));
+  }else{
+    d = ((d | c) - (b ^ b)) - ((q | p) + (q & b));
+  }
+  a = ((a * 2) + (p + p)) & ((c | b) & (q - 22));
+  a = ((c - 26) + (d * a)) + ((q - p) | (c | p));
+  d = ((q ^ c) | (q * 72)) - ((q - b) + (d + b));
+  d = ((d * a) - (d - c)) - ((b - 95) - (p * 57));
+  if(b < p){
+    a = ((q + c) * (a - q)) | ((a & b) * (c * c));
+  }else{
+    a = ((q ^ d) & (p + d)) - ((d * 85) + (b ^ 97));
+  }
+  d = ((q + c) | (q - 11)) & ((p * d) | (p ^ d));
+  b = ((q & a) & (c * p)) | ((a & 13) ^ (d ^ a));
+  d = ((d * d) | (c * c)) ^ ((c - d) + (p - d));
+  d = ((d * q) ^ (c + b)) & ((d + q) & (c - 72));
+  if(d < d){
+    a = ((d * b) & (b + 63)) ^ ((d | q) * (d * d));
+  }else{
+    a = ((b & c) | (b & 77)) - ((a - d) & (d * d));
+  }
+  c = ((d & q) | (c | q)) - ((b ^ q) | (c + 65));
+  for(i = 0; i < 39; i++){
+    a = ((d * d) ^ (b ^ q)) - ((q | b) | (d * 61));
+  }
+  c = ((c + p) ^ (q + d)) ^ ((a - 22) + (d & d));
+  a = ((b * a) * (p ^ p)) * ((d & a) * (b ^ q));
+  if(a < b){
+    a = ((c + b) | (d * 75)) ^ ((b & a) ^ (b * 32));
+  }else{
+    d = ((d - a) ^ (d ^ p)) * ((c & a) | (q * a));
+  }
+  b = ((a + b) | (b - 4)) | ((p & p) & (d ^ c));
+  a = ((a ^ b) & (b | b)) + ((d + c) & (a | d));
+  d = ((b | q) & (c ^ d)) | ((b & 66) * (q & p));
+  for(i = 0; i < 7; i++){
+    b = ((q + 36) ^ (b - b)) * ((q + b) ^ (c - c));
+  }
+  if(b < 43){
+    c = ((a & b) * (p * b)) + ((a ^ b) & (d - 24));
+  }else{
+    a = ((c - 3) ^ (p + c)) + ((q + c) & (p & d));
+  }
+  return a + b + c + d;
+}
+
+int func232(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 47;
+  d = 2;
+  d = ((a ^ 47) & (c & 2)) + ((b - d) + (b | d));
+  d = ((q + p) ^ (b + d)) + ((q + 3) * (b - 44));
+  d = ((d - a) | (q ^ 19)) * ((c ^ d) | (d ^ d));
+  d = ((b ^ b) | (p * b)) + ((b + p) ^ (a * d));
+  if(c < q){
+    a = ((q - 5) & (d | 99)) * ((b | a) * (c - 17));
+  }else{
+    b = ((a ^ q) - (p - d)) + ((q + c) & (q * 27));
+  }
+  c = ((b - 13) + (c & 81)) | ((a - 78) ^ (a - 80));
+  for(i = 0; i < 40; i++){
+    a = ((p ^ c) ^ (q * c)) ^ ((q | c) - (b * a));
+  }
+  c = ((q | b) & (p * 34)) | ((b & a) * (q ^ p));
+  b = ((d * d) ^ (c ^ 86)) | ((p + c) - (b ^ p));
+  if(c < p){
+    d = ((c | 55) + (q & 5)) + ((q ^ b) & (c ^ d));
+  }else{
+    b = ((p - c) & (a + b)) - ((d + a) & (b - d));
+  }
+  d = ((b - 43) ^ (d ^ b)) * ((a | 53) + (d * 96));
+  b = ((b - 38) + (b * q)) ^ ((b | d) + (d | a));
+  a = ((a | p) + (b ^ q)) | ((c & b) + (p - q));
+  for(i = 0; i < 50; i++){
+    d = ((d - 70) - (a - 1)) ^ ((a + q) & (a + c));
+  }
+  if(c < d){
+    b = ((d - p) ^ (c * 95)) - ((d + d) ^ (p * 45));
+  }else{
+    d = ((b & d) * (p - p)) | ((c * p) + (c | d));
+  }
+  a = ((c ^ b) - (a - p)) | ((q + b) - (c ^ 82));
+  a = ((c & c) & (d + q)) & ((c ^ 8) - (a | a));
+  b = ((p | q) | (c | 62)) * ((d ^ b) & (b ^ p));
+  d = ((d & q) - (d & q)) & ((q * 63) * (d + c));
+  if(c < q){
+    b = ((d ^ b) + (d - 4)) + ((q * a) | (b * q));
+  }else{
+    c = ((b + c) ^ (a * a)) & ((q | 91) ^ (d - 25));
+  }
+  for(i = 0; i < 2; i++){
+    c = ((a + q) & (p - 56)) | ((q & d) - (b ^ b));
+  }
+  b = ((d + q) ^ (b | p)) - ((b | b) + (q ^ d));
+  b = ((a * a) + (b & 25)) + ((d & 17) + (a - p));
+  d = ((p | d) | (b & c)) - ((q + d) | (q | 82));
+  if(b < q){
+    d = ((q - q) ^ (b * a)) + ((q | 56) + (d * a));
+  }else{
+    b = ((c ^ d) ^ (q ^ 13)) - ((d + d) ^ (b & b));
+  }
+  c = ((b + p) - (p * 28)) & ((p | p) + (p ^ p));
+  b = ((p * q) & (c & a)) ^ ((p & d) + (a | q));
+  for(i = 0; i < 50; i++){
+    d = ((d * a) + (d - 46)) & ((p | a) ^ (a + d));
+  }
+  a = ((p - 49) - (a * q)) | ((c & d) | (c | b));
+  if(d < a){
+    c = ((d | a) | (d ^ a)) + ((a + 80) ^ (q ^ a));
+  }else{
+    d = ((a & p) & (a ^ p)) + ((c & d) | (a & 84));
+  }
+  c = ((a & c) + (a ^ c)) ^ ((p | b) ^ (b & a));
+  d = ((q & q) | (p ^ d)) ^ ((q | d) + (p & a));
+  c = ((c - q) - (b ^ d)) + ((q & 50) + (b | c));
+  c = ((q | 9) + (q & p)) - ((c & a) | (b - b));
+  if(d < a){
+    c = ((c & c) * (d & 87)) & ((b | c) | (p & 16));
+  }else{
+    a = ((p * p) * (d * q)) + ((p & 55) ^ (b + a));
+  }
+  d = ((a + c) & (p - p)) & ((q - p) - (p + b));
+  a = ((d & a) & (b * a)) ^ ((c * c) & (a & c));
+  a = ((q + b) | (p - a)) - ((p - p) + (d | b));
+  c = ((p & 51) & (d ^ a)) & ((d ^ p) + (d - b));
+  if(a < 19){
+    c = ((q ^ a) ^ (q + d)) ^ ((c | 71) ^ (a | a));
+  }else{
+    c = ((c * 11) + (p | b)) & ((q & p) & (b * a));
+  }
+  a = ((a + 84) - (q ^ a)) + ((p + 88) ^ (d | p));
+  for(i = 0; i < 25; i++){
+    a = ((a + a) & (a + q)) | ((q + b) & (d * d));
+  }
+  c = ((b ^ b) + (p - p)) + ((q & b) | (a | 70));
+  c = ((p & b) - (d + c)) ^ ((a | b) - (c * b));
+  if(d < 40){
+    d = ((a ^ c) & (q * 95)) - ((a | 25) | (a & a));
+  }else{
+    d = ((d + d) | (p & b)) | ((d | 71) & (a * p));
+  }
+  d = ((p | d) + (q * 14)) * ((a - a) ^ (c ^ p));
+  a = ((b + 68) ^ (a - c)) * ((c + a) - (b * a));
+  a = ((b + a) - (c + q)) & ((d * 64) + (b - a));
+  for(i = 0; i < 13; i++){
+    b = ((q & c) + (p | 3)) ^ ((a + b) - (q | q));
+  }
+  if(d < c){
+    b = ((q - p) - (q * 23)) | ((a + q) ^ (q - q));
+  }else{
+    b = ((q + b) ^ (p + 93)) & ((p ^ a) | (a - 45));
+  }
+  return a + b + c + d;
+}
+
+int func233(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 24;
+  d = 32;
+  d = ((a * c) + (p + b)) * ((q & p) ^ (a ^ p));
+  b = ((c ^ 47) * (b ^ p)) | ((q + a) + (p + a));
+  d = ((d & c) * (c ^ a)) ^ ((a + b) ^ (a * a));
+  c = ((b | b) * (q & q)) * ((p | b) & (c - d));
+  if(b < d){
+    b = ((a - b) - (q + d)) ^ ((d + 40) - (d * c));
+  }else{
+    b = ((q * c) ^ (c * p)) * ((q ^ c) & (q ^ c));
+  }
+  b = ((d * 82) + (p * a)) * ((q + d) + (p - d));
+  for(i = 0; i < 3; i++){
+    b = ((d & p) & (c & c)) - ((b - 30) + (c - d));
+  }
+  b = ((c ^ q) ^ (a + d)) + ((b + p) - (q + q));
+  c = ((d * b) ^ (b ^ b)) ^ ((c * c) * (a + q));
+  if(a < p){
+    d = ((a - d) - (c * p)) & ((p * 55) | (q * a));
+  }else{
+    b = ((a + b) + (b + d)) * ((c ^ p) - (a - d));
+  }
+  b = ((a ^ 83) & (a ^ q)) | ((q | b) ^ (p | b));
+  b = ((d & d) & (b - c)) & ((p | a) + (q - d));
+  d = ((q & a) | (a | c)) * ((c & b) * (a ^ 60));
+  for(i = 0; i < 12; i++){
+    d = ((b | b) | (c | p)) * ((d + a) + (b ^ a));
+  }
+  if(b < d){
+    a = ((q | q) & (q * p)) + ((q ^ q) * (q ^ c));
+  }else{
+    c = ((a ^ p) | (p ^ q)) ^ ((q & d) * (c * q));
+  }
+  a = ((d & p) * (a | b)) * ((q * 8) ^ (c - b));
+  a = ((c + c) ^ (q ^ a)) - ((a + d) | (c * p));
+  a = ((c & c) + (a ^ q)) * ((b - c) & (q | d));
+  b = ((p | p) | (b * 29)) + ((q * b) + (c & a));
+  if(a < q){
+    c = ((q ^ d) - (q ^ p)) ^ ((q - 88) | (c - d));
+  }else{
+    c = ((p ^ a) | (c | c)) & ((a * 55) & (p ^ 13));
+  }
+  for(i = 0; i < 20; i++){
+    a = ((p ^ 36) ^ (b + b)) & ((a | 37) | (p + a));
+  }
+  b = ((p + 17) & (p | b)) - ((b | 93) & (c + 25));
+  d = ((p - c) | (b & q)) - ((q & c) ^ (b | c));
+  a = ((q & q) & (d + 92)) ^ ((b ^ a) * (d & d));
+  if(d < d){
+    d = ((q + 43) + (q | p)) * ((q ^ c) - (b - b));
+  }else{
+    a = ((c - 73) * (d & 23)) | ((p | 95) & (b + q));
+  }
+  d = ((b | 84) * (b * 53)) | ((a & c) | (a - q));
+  a = ((d | 9) | (d | b)) - ((d | p) * (a ^ p));
+  for(i = 0; i < 47; i++){
+    b = ((p ^ q) + (c - a)) + ((d + p) - (b * c));
+  }
+  c = ((a & c) * (p ^ b)) - ((a * d) ^ (d | c));
+  if(a < d){
+    d = ((a + d) + (c & c)) * ((p & c) * (c ^ a));
+  }else{
+    a = ((p * d) + (p ^ d)) + ((d - p) | (d - 60));
+  }
+  c = ((p & 4) + (d & b)) ^ ((d & 98) | (b | 91));
+  c = ((q | c) + (d & 80)) * ((a - d) | (a - a));
+  d = ((a + q) + (a & q)) & ((a & q) | (p * 32));
+  b = ((a + 62) * (b ^ a)) & ((p + a) | (c * b));
+  if(c < 76){
+    c = ((b | d) ^ (c ^ d)) ^ ((b | 49) * (a | b));
+  }else{
+    c = ((q * q) + (b + 83)) * ((d ^ c) & (p - 21));
+  }
+  a = ((d | d) ^ (d & c)) - ((p * p) | (a ^ 82));
+  b = ((a | 95) - (b ^ b)) * ((c - c) * (b | 39));
+  a = ((c * d) + (q - d)) ^ ((q ^ q) & (q - d));
+  b = ((a | c) + (p - a)) ^ ((d ^ 39) | (c & a));
+  if(d < q){
+    c = ((p | c) - (c + d)) & ((a ^ q) | (q - q));
+  }else{
+    b = ((c + a) - (a - 72)) + ((a * d) | (a | b));
+  }
+  c = ((b ^ c) | (d * d)) * ((p + c) ^ (q | p));
+  for(i = 0; i < 9; i++){
+    b = ((d * p) * (b | p)) ^ ((d + 1) - (c & p));
+  }
+  d = ((q + p) - (p & d)) + ((p ^ 85) ^ (a | b));
+  b = ((c * a) | (p ^ c)) | ((q & q) * (a - 46));
+  if(a < q){
+    d = ((c * a) ^ (b | 88)) | ((q ^ q) * (b - a));
+  }else{
+    c = ((p * q) | (q & 17)) + ((q * p) | (d ^ d));
+  }
+  b = ((d ^ 96) ^ (c | 75)) * ((b ^ p) & (d ^ b));
+  c = ((p - p) + (q ^ c)) + ((p - c) - (a * 10));
+  c = ((p - 52) - (q * p)) & ((p & 18) + (d + b));
+  for(i = 0; i < 9; i++){
+    d = ((d + p) + (p + d)) & ((c & q) ^ (d + d));
+  }
+  if(c < q){
+    c = ((p | 14) & (p * q)) | ((q ^ p) - (c ^ a));
+  }else{
+    a = ((p | q) - (b + d)) & ((c * c) - (q - 86));
+  }
+  return a + b + c + d;
+}
+
+int func234(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 59;
+  d = 4;
+  c = ((q - q) - (d - d)) ^ ((a & c) + (b * c));
+  b = ((d * a) | (q & b)) + ((d * c) + (c ^ 19));
+  a = ((b & 96) - (c | c)) | ((d + d) | (p & a));
+  c = ((c & q) & (b | a)) | ((b & 82) - (p - b));
+  if(d < q){
+    d = ((c + c) & (b - a)) | ((a * c) * (p ^ a));
+  }else{
+    a = ((q | p) & (q + c)) & ((a - q) * (b | p));
+  }
+  b = ((a - b) + (b ^ b)) * ((c - 75) & (q & b));
+  for(i = 0; i < 34; i++){
+    c = ((b ^ a) ^ (b + q)) * ((b ^ b) + (c | p));
+  }
+  d = ((c | 8) + (q - a)) + ((c & 45) - (q + c));
+  b = ((b & 69) & (q ^ 99)) - ((b * q) - (d ^ b));
+  if(b < a){
+    a = ((d | a) * (d * c)) & ((p * 70) + (q - 28));
+  }else{
+    a = ((q + p) * (a & q)) | ((p * 61) & (d ^ 58));
+  }
+  a = ((b ^ c) ^ (d - c)) & ((c & d) ^ (b & p));
+  b = ((p ^ p) + (p - 18)) | ((d | p) & (c | c));
+  b = ((c * 94) & (c + 74)) | ((b ^ 59) ^ (p ^ b));
+  for(i = 0; i < 19; i++){
+    c = ((c - q) - (q ^ q)) - ((q - a) * (b + b));
+  }
+  if(b < b){
+    d = ((b + b) + (q & c)) * ((b ^ 13) + (d - 6));
+  }else{
+    b = ((b - p) & (b + c)) + ((b & c) | (q & 95));
+  }
+  d = ((q ^ q) ^ (p + b)) * ((b | c) ^ (q | 5));
+  d = ((a * b) ^ (q - b)) - ((p + c) & (b | q));
+  c = ((a | p) | (b ^ b)) ^ ((d | d) | (d + d));
+  d = ((b - c) + (a ^ b)) | ((d ^ a) - (q + b));
+  if(b < q){
+    d = ((d - d) - (a ^ c)) - ((a & 95) | (b * b));
+  }else{
+    c = ((a | c) ^ (b * a)) + ((c | 94) & (a + p));
+  }
+  for(i = 0; i < 13; i++){
+    b = ((c * d) ^ (b ^ 30)) | ((b | p) & (b - 53));
+  }
+  a = ((q * d) - (a & 10)) ^ ((p & c) | (p | 54));
+  a = ((p * p) - (c + 25)) - ((p + a) - (p - 80));
+  b = ((c + 68) - (a & 18)) | ((c + b) - (p * q));
+  if(a < c){
+    c = ((p + a) - (q | p)) & ((d | p) & (d * 84));
+  }else{
+    b = ((b & q) & (p + p)) | ((c + c) * (a & 25));
+  }
+  d = ((d | d) - (q & b)) - ((p - d) - (a + c));
+  a = ((b ^ d) - (d + d)) ^ ((b | a) ^ (q - q));
+  for(i = 0; i < 13; i++){
+    c = ((d + 96) + (p + 29)) * ((c - c) ^ (d + 70));
+  }
+  b = ((d + 65) - (b & c)) - ((b + 3) + (c * a));
+  if(b < d){
+    a = ((a * a) & (q + c)) | ((q | b) + (b & 87));
+  }else{
+    b = ((d - a) - (d & b)) + ((d & 57) - (b | q));
+  }
+  c = ((c | 61) & (b + 60)) * ((a ^ q) * (d + b));
+  c = ((b ^ b) | (b * c)) | ((c & q) | (q - q));
+  b = ((a + b) & (q & p)) ^ ((c + c) | (p - 54));
+  b = ((b - 24) + (q - 9)) + ((c & c) ^ (c + p));
+  if(b < b){
+    d = ((p + b) & (p - b)) + ((b & d) & (b * a));
+  }else{
+    c = ((c | b) * (q - p)) | ((c * q) | (p | c));
+  }
+  a = ((d - q) * (c - a)) & ((b ^ b) | (d * a));
+  b = ((q * c) * (c & d)) + ((b ^ a) - (p ^ p));
+  b = ((d + b) * (a & 37)) * ((q & 40) - (a ^ d));
+  d = ((q - b) + (c + p)) ^ ((q - q) & (c - c));
+  if(a < p){
+    d = ((c | 86) & (d + d)) | ((p - 23) & (p ^ d));
+  }else{
+    d = ((a | a) & (c | b)) & ((c | 56) ^ (b ^ 90));
+  }
+  d = ((d ^ a) * (d * d)) | ((b + c) + (p ^ 45));
+  for(i = 0; i < 50; i++){
+    a = ((q | 50) | (a - d)) & ((a & d) & (d - b));
+  }
+  b = ((b ^ c) ^ (p | 77)) + ((a & b) * (c | a));
+  d = ((q * c) & (q * d)) ^ ((c * b) - (d * q));
+  if(d < d){
+    d = ((q ^ 54) + (a & d)) + ((d + 95) | (b & 49));
+  }else{
+    c = ((p - c) | (a | 81)) | ((d ^ a) + (c | b));
+  }
+  d = ((b + 63) * (a + a)) | ((q - b) & (q & p));
+  b = ((p & a) ^ (d | q)) - ((a + 54) ^ (q & p));
+  c = ((c + a) * (a & c)) | ((b & 3) ^ (b * p));
+  for(i = 0; i < 8; i++){
+    b = ((b * q) + (a * 76)) + ((q & c) & (a & d));
+  }
+  if(d < p){
+    b = ((b * q) & (p & b)) & ((c & 73) | (a ^ c));
+  }else{
+    d = ((q & d) + (b | d)) & ((p - a) ^ (c ^ 31));
+  }
+  return a + b + c + d;
+}
+
+int func235(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 69;
+  d = 8;
+  c = ((d & b) & (d & a)) * ((d | a) & (c + q));
+  a = ((p ^ q) & (p - a)) & ((q & c) | (q - p));
+  a = ((q & d) + (c & a)) + ((a * b) - (p + b));
+  b = ((b - c) + (p - a)) + ((p ^ a) & (p ^ c));
+  if(c < q){
+    b = ((a * a) & (d - d)) | ((a * p) & (c & q));
+  }else{
+    d = ((c + d) & (p - 43)) + ((c + b) & (a | d));
+  }
+  c = ((c ^ a) * (c ^ d)) * ((c - 53) - (b & c));
+  for(i = 0; i < 8; i++){
+    c = ((q - c) * (b | b)) + ((a - c) * (q & 55));
+  }
+  c = ((p & 5) + (q + 88)) | ((d * q) & (b + c));
+  c = ((q + b) * (c - c)) ^ ((p & q) + (d & p));
+  if(c < 62){
+    a = ((d + a) | (b ^ c)) - ((q ^ 93) + (q ^ 26));
+  }else{
+    c = ((q ^ 94) | (p - b)) - ((q ^ a) ^ (a ^ a));
+  }
+  c = ((b + 52) * (p | p)) & ((b + p) & (c | 59));
+  b = ((a & q) & (d ^ 85)) - ((c | p) * (d * c));
+  d = ((q - q) & (q ^ b)) ^ ((p & d) * (c - b));
+  for(i = 0; i < 22; i++){
+    b = ((c - c) - (p | 5)) | ((b | d) | (d * b));
+  }
+  if(c < p){
+    d = ((q - q) + (c | d)) * ((a | a) * (b & p));
+  }else{
+    b = ((b + a) ^ (q * b)) + ((d - a) + (a | a));
+  }
+  c = ((a | a) | (b ^ 61)) | ((q * d) & (b * p));
+  a = ((b | d) ^ (d - d)) * ((d ^ 47) | (d & p));
+  c = ((d - a) | (p + 22)) + ((q & p) + (p | a));
+  d = ((b + a) | (d | b)) & ((a * 44) ^ (p - 54));
+  if(a < a){
+    c = ((d * p) & (c & c)) + ((p * 38) ^ (b ^ q));
+  }else{
+    d = ((q ^ c) * (b ^ d)) * ((d - p) - (q ^ d));
+  }
+  for(i = 0; i < 39; i++){
+    d = ((c ^ a) | (d | c)) * ((p | q) * (c & p));
+  }
+  a = ((a * d) * (p & b)) & ((d ^ p) * (p - b));
+  b = ((b & 41) | (q * c)) & ((a ^ 27) + (c * a));
+  b = ((q + 17) & (b * 2)) * ((b * a) & (p - b));
+  if(a < 20){
+    c = ((b * 31) | (p - 10)) * ((p * d) + (c ^ 31));
+  }else{
+    b = ((b + 26) ^ (p ^ q)) * ((q * d) & (p ^ b));
+  }
+  d = ((a * 42) | (q + 51)) ^ ((a - p) | (c * b));
+  d = ((q & p) + (p + b)) * ((c * p) ^ (q - b));
+  for(i = 0; i < 3; i++){
+    c = ((q - b) + (c | c)) - ((p ^ 40) & (a + b));
+  }
+  d = ((p | d) ^ (c + q)) ^ ((p | 76) ^ (p ^ 39));
+  if(c < b){
+    a = ((a | c) & (a ^ 61)) & ((d ^ a) & (c + 11));
+  }else{
+    a = ((d * 68) | (q ^ d)) - ((a + c) ^ (p ^ d));
+  }
+  c = ((c + c) & (q | 5)) ^ ((c + c) & (c - p));
+  c = ((d & 12) - (c * 57)) & ((p * p) & (c + c));
+  a = ((c + p) + (d + 45)) ^ ((d & d) & (d * q));
+  d = ((q * 91) + (q & 75)) + ((c | b) * (q | a));
+  if(b < p){
+    d = ((p & a) + (c + a)) + ((c - 49) ^ (c & a));
+  }else{
+    b = ((q | d) ^ (q | 61)) | ((c - d) - (a + b));
+  }
+  a = ((a - q) + (a * q)) * ((d | 21) ^ (d + b));
+  b = ((a + p) * (a & 13)) ^ ((q | b) ^ (c + 37));
+  d = ((d ^ c) ^ (d & d)) * ((b & q) + (q + p));
+  d = ((p - c) - (q & b)) - ((q * p) - (p + b));
+  if(d < q){
+    d = ((p & d) ^ (p - d)) & ((d - c) | (a ^ d));
+  }else{
+    a = ((q | p) * (c * q)) & ((b & c) & (q & 1));
+  }
+  d = ((c & b) & (c + q)) * ((a + b) + (p & 66));
+  for(i = 0; i < 19; i++){
+    c = ((c & 68) * (c & q)) | ((p & q) + (a | a));
+  }
+  c = ((c & a) - (a - 98)) ^ ((q * c) ^ (d - d));
+  c = ((c ^ q) + (q - p)) | ((d | d) + (q | p));
+  if(c < b){
+    d = ((d & 80) ^ (c * b)) - ((b + b) & (q + p));
+  }else{
+    c = ((b & d) ^ (c - c)) * ((b | q) ^ (b | 24));
+  }
+  d = ((c | 24) + (c ^ b)) ^ ((a | 34) & (d & 58));
+  c = ((b ^ 11) ^ (a + b)) & ((b * q) ^ (p - c));
+  a = ((p ^ p) * (p ^ a)) ^ ((b + c) ^ (d & 18));
+  for(i = 0; i < 10; i++){
+    a = ((d + p) | (q & b)) * ((a + a) * (q * p));
+  }
+  if(a < c){
+    c = ((b + c) & (q & q)) - ((b + q) & (p - 18));
+  }else{
+    b = ((a * a) & (q | c)) ^ ((b ^ 74) | (d | b));
+  }
+  return a + b + c + d;
+}
+
+int func236(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 96;
+  d = 53;
+  d = ((c + 11) - (d | 63)) + ((p + b) ^ (p ^ c));
+  b = ((c | q) | (a & 39)) & ((b | 73) * (a - q));
+  a = ((d - q) * (q * q)) * ((q ^ p) * (c * b));
+  d = ((b | a) & (b * b)) - ((d * b) | (p - 92));
+  if(d < a){
+    b = ((d - p) * (b + p)) | ((c - c) * (d ^ b));
+  }else{
+    a = ((p + q) | (b & 8)) & ((a * p) ^ (d | p));
+  }
+  c = ((b * 12) ^ (b & a)) - ((p ^ d) | (p - p));
+  for(i = 0; i < 12; i++){
+    a = ((b | d) * (c * c)) | ((q ^ q) & (d * b));
+  }
+  b = ((b | p) + (b + d)) * ((d * q) - (a + q));
+  b = ((c * c) | (p & 34)) ^ ((c + c) | (d * 47));
+  if(c < q){
+    a = ((a | a) - (b ^ d)) | ((p + q) ^ (c ^ c));
+  }else{
+    d = ((d * q) + (a & a)) | ((p ^ q) | (b ^ c));
+  }
+  c = ((q & 34) | (c ^ c)) * ((a ^ q) + (p ^ 31));
+  a = ((a | p) ^ (a ^ p)) & ((d & 28) ^ (c + c));
+  a = ((b * a) ^ (c * q)) & ((d - q) * (a ^ q));
+  for(i = 0; i < 46; i++){
+    b = ((a * p) & (p | c)) ^ ((b * a) ^ (b * q));
+  }
+  if(c < 97){
+    a = ((a & d) ^ (d ^ 21)) + ((b | 43) - (p + a));
+  }else{
+    b = ((p - b) - (p * 32)) + ((d - d) ^ (p | 38));
+  }
+  c = ((d + c) & (a - c)) | ((d ^ a) * (q | 48));
+  b = ((p * a) + (b & p)) | ((d ^ d) - (d + d));
+  d = ((b & c) ^ (a - c)) + ((a * 24) ^ (a - c));
+  d = ((p - d) - (d + b)) - ((p + q) & (c ^ b));
+  if(d < b){
+    b = ((a | p) | (p * b)) - ((c - c) * (d | b));
+  }else{
+    c = ((a & 49) - (q ^ q)) & ((c & p) + (b + q));
+  }
+  for(i = 0; i < 34; i++){
+    b = ((c ^ d) ^ (p & c)) + ((a ^ c) ^ (a | b));
+  }
+  b = ((d - p) - (c * d)) + ((q + 66) | (q * p));
+  b = ((p | q) + (p - 9)) | ((q + q) | (d & c));
+  b = ((d + 98) * (b & c)) - ((c + 86) ^ (c - 13));
+  if(a < a){
+    a = ((q & b) + (q * p)) * ((b + b) & (q ^ 92));
+  }else{
+    c = ((a * 58) ^ (a ^ a)) + ((a + 40) + (d * d));
+  }
+  c = ((q | 82) ^ (a | a)) & ((q + 99) - (q & 71));
+  d = ((a & 34) * (q & d)) | ((d * a) + (d + 19));
+  for(i = 0; i < 34; i++){
+    b = ((p + b) * (d * a)) | ((q * p) * (d * q));
+  }
+  b = ((a - c) & (b + c)) - ((c | q) + (q | b));
+  if(b < d){
+    c = ((b | a) | (c & p)) ^ ((c | d) + (a ^ c));
+  }else{
+    a = ((c | c) - (b + q)) - ((p - p) ^ (p & p));
+  }
+  c = ((d + q) * (b * d)) - ((q + 26) - (p + p));
+  a = ((c & p) + (a | 40)) * ((q ^ c) | (d * c));
+  c = ((c ^ a) * (q + c)) - ((q ^ a) ^ (b | a));
+  c = ((d - 16) & (b | 44)) & ((b | c) & (b & d));
+  if(d < 72){
+    a = ((b - b) + (c - a)) + ((c | a) | (c ^ p));
+  }else{
+    b = ((p * p) ^ (c - d)) * ((d * d) * (c - q));
+  }
+  d = ((d - 69) * (d - b)) * ((a * 49) ^ (q + q));
+  c = ((c * q) & (q - 62)) + ((q & c) + (a | p));
+  d = ((p * p) & (c & 9)) + ((c * d) - (q | 10));
+  d = ((c + b) ^ (b - p)) + ((b & p) * (p - 20));
+  if(a < d){
+    d = ((b * 83) | (q & p)) - ((d + b) + (c + a));
+  }else{
+    d = ((c & 75) & (d - b)) * ((b + d) * (p & p));
+  }
+  d = ((q & d) ^ (p & 21)) - ((p - 55) | (p * b));
+  for(i = 0; i < 38; i++){
+    d = ((d & b) | (c & p)) * ((p & q) * (q ^ a));
+  }
+  d = ((b ^ p) | (q ^ a)) + ((b + q) * (d | 25));
+  d = ((a - 79) + (q | q)) + ((p | q) - (d | 20));
+  if(d < c){
+    c = ((c + b) * (d * q)) ^ ((p * a) ^ (p ^ b));
+  }else{
+    d = ((a | q) * (b * p)) + ((a & p) - (c - b));
+  }
+  a = ((p & b) & (c * c)) & ((b ^ 28) + (p + d));
+  a = ((p & 15) + (a * q)) | ((q ^ p) + (c - a));
+  a = ((a * p) - (p & c)) & ((q ^ c) | (b - d));
+  for(i = 0; i < 2; i++){
+    a = ((c & c) - (a - p)) - ((b - c) + (b & c));
+  }
+  if(d < p){
+    a = ((c ^ 41) ^ (p + a)) * ((q & d) - (q * 51));
+  }else{
+    d = ((p + 10) & (p ^ p)) + ((b - 5) * (p * 25));
+  }
+  return a + b + c + d;
+}
+
+int func237(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 52;
+  d = 42;
+  b = ((d ^ 67) ^ (p | 6)) & ((q | c) ^ (a * p));
+  d = ((p * q) - (p & 47)) + ((q - a) | (b | a));
+  d = ((b - c) - (d - c)) + ((d & a) + (b - 49));
+  b = ((d * 46) * (q - a)) & ((q | 84) | (p & c));
+  if(d < d){
+    a = ((d & q) - (a + b)) - ((b ^ p) ^ (p ^ a));
+  }else{
+    d = ((d | p) * (c ^ d)) | ((d - q) | (c ^ 95));
+  }
+  b = ((p + 91) - (a + b)) * ((q ^ c) + (q & c));
+  for(i = 0; i < 6; i++){
+    d = ((b * q) & (d - 58)) | ((a | q) - (b & d));
+  }
+  c = ((c - q) | (a | c)) ^ ((b | q) | (b * p));
+  a = ((p | 26) | (a & a)) * ((a - q) - (d | d));
+  if(c < q){
+    b = ((p | a) | (d & c)) - ((a & q) + (a + a));
+  }else{
+    a = ((p ^ c) + (b & c)) + ((b & 91) - (p | d));
+  }
+  c = ((a + q) - (c - p)) * ((c & 67) | (a | a));
+  d = ((c ^ a) - (b * 71)) & ((a ^ 75) * (q & p));
+  b = ((p + 4) * (q ^ p)) & ((a | c) + (q & 27));
+  for(i = 0; i < 19; i++){
+    d = ((p + a) * (q - c)) & ((p - 40) & (c + b));
+  }
+  if(c < c){
+    a = ((b + a) ^ (a + p)) & ((p ^ b) ^ (q - 56));
+  }else{
+    c = ((a + a) | (p ^ c)) | ((b - q) * (c ^ 46));
+  }
+  b = ((a * a) - (a | a)) & ((b | 49) | (b | p));
+  a = ((c * p) | (d | 55)) - ((p * q) & (q ^ c));
+  b = ((p | q) + (q | a)) & ((b * q) ^ (c * b));
+  d = ((a + c) | (c & 51)) - ((c * p) * (b & b));
+  if(a < 54){
+    a = ((a ^ b) ^ (d + p)) + ((c & q) - (q + d));
+  }else{
+    a = ((q * a) + (q ^ a)) * ((q & a) | (a & a));
+  }
+  for(i = 0; i < 30; i++){
+    c = ((c & b) - (b + 73)) ^ ((p ^ c) * (p * a));
+  }
+  c = ((q - b) ^ (a | a)) | ((q - c) - (p ^ 40));
+  a = ((d ^ c) & (p * d)) - ((p ^ p) + (q | q));
+  d = ((q + 21) ^ (c - p)) & ((d - q) & (q + 40));
+  if(c < q){
+    d = ((q | d) + (c * a)) & ((c - c) + (d * c));
+  }else{
+    b = ((c ^ a) ^ (d - a)) + ((b | q) ^ (c * 72));
+  }
+  a = ((q + p) - (b + a)) * ((p - a) | (d - c));
+  b = ((p | p) + (d ^ b)) - ((c ^ 21) - (a + q));
+  for(i = 0; i < 43; i++){
+    d = ((a | a) | (d & d)) & ((b | d) | (b | b));
+  }
+  d = ((a * d) ^ (b & d)) | ((p + d) & (d * p));
+  if(c < p){
+    a = ((d & 70) * (q + b)) ^ ((c + p) | (c ^ d));
+  }else{
+    b = ((p * p) + (c + c)) + ((q | p) & (d * b));
+  }
+  b = ((b & c) + (a & 19)) + ((b & q) * (p | c));
+  a = ((b | q) & (b | 79)) + ((c & 19) | (p + p));
+  d = ((d | p) | (p + c)) ^ ((d - c) + (b * q));
+  d = ((b & b) - (c + b)) + ((p & a) * (a & d));
+  if(b < a){
+    a = ((p ^ c) | (c & d)) + ((q * c) + (c + 54));
+  }else{
+    a = ((b & q) * (q * d)) - ((a + 6) & (c | b));
+  }
+  d = ((a + 19) & (d * d)) * ((b | p) & (d & c));
+  b = ((c - b) & (a ^ d)) ^ ((p * 22) & (a * p));
+  d = ((c | a) + (b ^ p)) + ((d | p) | (a ^ c));
+  d = ((a * b) & (d & 66)) - ((d ^ c) + (p & q));
+  if(b < 46){
+    b = ((c + c) - (a | 45)) ^ ((q - 59) | (d & d));
+  }else{
+    a = ((a + d) | (c + p)) & ((c ^ 48) - (d * b));
+  }
+  b = ((c * d) * (c ^ q)) | ((q | 23) | (d * b));
+  for(i = 0; i < 34; i++){
+    b = ((q - a) | (q + p)) + ((q - b) ^ (d & q));
+  }
+  c = ((a + a) | (q ^ c)) * ((a + p) * (d * a));
+  d = ((a * 35) - (c & b)) ^ ((c - b) + (b & b));
+  if(c < q){
+    d = ((a + b) & (c * 28)) + ((p | q) + (d + 12));
+  }else{
+    d = ((b ^ 68) ^ (p | 61)) ^ ((p + q) * (q - c));
+  }
+  d = ((p ^ a) & (a & 15)) ^ ((q & b) + (c & a));
+  d = ((c + d) - (d - a)) ^ ((c + d) * (b & q));
+  a = ((p - b) * (b + 77)) | ((b - c) + (p * b));
+  for(i = 0; i < 44; i++){
+    a = ((b * d) ^ (c - 92)) ^ ((q & a) + (d & d));
+  }
+  if(c < q){
+    b = ((b & 10) * (b + a)) & ((p - 44) ^ (p | 15));
+  }else{
+    a = ((c | 74) ^ (p + 84)) & ((q - a) & (d * c));
+  }
+  return a + b + c + d;
+}
+
+int func238(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 73;
+  d = 81;
+  c = ((a ^ c) * (q + 90)) * ((p & b) + (q & c));
+  c = ((a & a) & (c * 77)) + ((p - 57) + (d ^ q));
+  b = ((p * c) ^ (p * c)) + ((b + a) ^ (d * a));
+  d = ((d + a) + (q & d)) | ((b + d) + (a | c));
+  if(a < q){
+    d = ((a & 83) + (q | p)) - ((d - 43) + (a * a));
+  }else{
+    d = ((a | c) * (d + c)) & ((d - b) | (q * a));
+  }
+  a = ((q ^ b) * (a ^ 44)) + ((a - b) * (c * q));
+  for(i = 0; i < 29; i++){
+    d = ((p - q) & (q - d)) + ((q * 39) & (p + a));
+  }
+  c = ((q + p) + (q ^ 89)) - ((a * q) + (c & p));
+  a = ((a | a) + (q & 89)) * ((b | c) - (a * a));
+  if(a < d){
+    c = ((d + q) + (p | d)) | ((d + 58) ^ (q ^ p));
+  }else{
+    a = ((d - d) | (b ^ p)) * ((p ^ c) ^ (p ^ d));
+  }
+  d = ((a + 48) * (d + d)) & ((d & q) & (b * 13));
+  b = ((q | c) & (b ^ 93)) ^ ((a ^ b) | (b ^ c));
+  d = ((a + 88) | (d * a)) + ((d ^ d) - (d - c));
+  for(i = 0; i < 30; i++){
+    b = ((b - b) - (b * c)) - ((q ^ d) | (d ^ p));
+  }
+  if(b < d){
+    b = ((a - d) | (c ^ c)) & ((q | a) & (d - 13));
+  }else{
+    b = ((q & c) * (p | 22)) + ((d * a) + (c + c));
+  }
+  a = ((p & c) - (c + a)) * ((q & a) ^ (a - q));
+  a = ((d * 1) * (c * 30)) * ((d ^ b) ^ (c ^ d));
+  b = ((b & 22) * (q * 5)) - ((d & b) - (q * c));
+  d = ((b + 17) - (b & 73)) + ((p * p) - (q ^ q));
+  if(b < c){
+    c = ((a & d) & (c ^ c)) | ((b | 50) | (a * d));
+  }else{
+    b = ((q - p) * (b | c)) | ((a * c) - (q + q));
+  }
+  for(i = 0; i < 18; i++){
+    c = ((a & 84) & (d - d)) & ((d & 31) * (d | p));
+  }
+  b = ((b * c) + (d ^ p)) + ((c - c) * (d - d));
+  b = ((a - p) - (d & q)) * ((d | p) + (c + b));
+  b = ((d ^ 67) ^ (a + q)) + ((a ^ a) & (a * q));
+  if(a < 13){
+    a = ((a ^ 70) - (b ^ 56)) ^ ((a - c) + (b | d));
+  }else{
+    b = ((d & q) ^ (b | p)) ^ ((b * c) ^ (a + a));
+  }
+  c = ((a - a) | (d * 57)) * ((p * 61) | (b * 72));
+  c = ((d + p) | (b & p)) - ((b * c) ^ (d - a));
+  for(i = 0; i < 46; i++){
+    c = ((d & q) - (a + d)) | ((q - d) | (c | a));
+  }
+  d = ((p - d) + (d ^ 88)) & ((d - 13) & (d - p));
+  if(a < a){
+    a = ((b ^ c) - (p ^ q)) ^ ((a + b) | (p - 50));
+  }else{
+    a = ((p + 5) ^ (c * q)) | ((c * 56) & (q - d));
+  }
+  c = ((q - 44) - (a + p)) - ((d ^ a) ^ (p & 29));
+  c = ((b ^ a) - (d * d)) | ((a & c) & (c | c));
+  a = ((b & b) ^ (q | p)) ^ ((p - c) ^ (c & 57));
+  b = ((q + q) - (b * c)) + ((p ^ b) & (c | 10));
+  if(b < p){
+    d = ((q ^ c) | (p & q)) & ((b & 68) + (p & p));
+  }else{
+    c = ((p * 14) * (b | c)) * ((c + a) - (b - 11));
+  }
+  b = ((b | a) - (c & c)) + ((a * p) | (d - 73));
+  b = ((q & c) - (q - 79)) | ((c & b) - (b + 28));
+  b = ((c & q) * (c ^ q)) * ((q * 34) | (c - p));
+  c = ((p & q) - (q & b)) & ((b | c) ^ (a * d));
+  if(a < 22){
+    a = ((c + d) - (a & c)) ^ ((b ^ c) * (b * b));
+  }else{
+    c = ((b & q) * (q * d)) | ((a ^ b) | (a * q));
+  }
+  c = ((p & d) - (p - q)) - ((c * d) * (q | d));
+  for(i = 0; i < 38; i++){
+    b = ((d | b) & (c | a)) * ((a * d) | (q & d));
+  }
+  c = ((q | a) + (p ^ 61)) + ((d * q) + (c ^ 99));
+  c = ((b - q) | (p * b)) | ((q ^ c) * (b ^ 89));
+  if(c < c){
+    a = ((d + 12) | (q ^ a)) + ((a * 94) ^ (c + q));
+  }else{
+    d = ((b - p) | (c + c)) & ((p ^ p) - (p & 88));
+  }
+  b = ((p & 79) & (d | p)) - ((d & 92) - (c - q));
+  d = ((d | 84) - (p & c)) & ((b ^ 60) * (c | c));
+  b = ((p | p) - (c - c)) - ((c | p) & (q ^ 38));
+  for(i = 0; i < 29; i++){
+    d = ((a - p) + (b ^ q)) + ((c | a) ^ (p ^ c));
+  }
+  if(b < c){
+    b = ((c + a) | (b + b)) & ((a | b) ^ (b ^ b));
+  }else{
+    c = ((a + q) * (p | 98)) * ((c - q) + (q & q));
+  }
+  return a + b + c + d;
+}
+
+int func239(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 7;
+  d = 3;
+  c = ((q + 34) & (b & b)) * ((a | 68) - (b | p));
+  b = ((b + a) | (c + d)) ^ ((p ^ a) ^ (a * c));
+  c = ((d + 88) | (c + a)) * ((p & d) + (c ^ c));
+  c = ((d * 98) ^ (a * 89)) + ((p - 90) ^ (q ^ b));
+  if(a < p){
+    a = ((d - b) ^ (c ^ c)) | ((p - 7) ^ (b + a));
+  }else{
+    b = ((q & p) - (c - b)) + ((a & a) * (d | q));
+  }
+  d = ((a | d) ^ (q * 24)) | ((d | p) | (a & 96));
+  for(i = 0; i < 50; i++){
+    d = ((d - a) & (b - p)) & ((c * b) + (d * q));
+  }
+  b = ((b & b) * (b * 84)) - ((b ^ q) & (q & c));
+  c = ((c ^ 83) & (q + a)) | ((b + p) - (p | 70));
+  if(a < a){
+    d = ((p | b) ^ (q ^ d)) | ((c | 46) + (a ^ c));
+  }else{
+    c = ((c - d) ^ (q & c)) | ((p & 17) * (c & b));
+  }
+  a = ((d * b) * (q + c)) ^ ((d | b) | (b ^ d));
+  d = ((a ^ q) * (c * p)) ^ ((d ^ d) | (p * 86));
+  d = ((c ^ 13) + (p ^ a)) * ((c + d) & (d - q));
+  for(i = 0; i < 23; i++){
+    b = ((c | 50) | (c * 46)) - ((b | b) + (b & 78));
+  }
+  if(a < q){
+    c = ((b & a) * (d | 66)) ^ ((p * 41) - (q - a));
+  }else{
+    c = ((d + d) | (c ^ c)) ^ ((d ^ a) & (c - 77));
+  }
+  d = ((d + a) + (p | 51)) ^ ((q & c) | (a & q));
+  a = ((b + d) ^ (b - d)) * ((d - d) ^ (q | 4));
+  a = ((c - d) + (a - c)) * ((p ^ d) + (c ^ q));
+  a = ((q - a) ^ (c + a)) - ((c & c) ^ (b * p));
+  if(c < a){
+    c = ((q ^ b) + (b - 7)) - ((a + 67) & (b - p));
+  }else{
+    b = ((d & p) | (a & 69)) ^ ((q & 80) - (q & d));
+  }
+  for(i = 0; i < 15; i++){
+    c = ((a | 67) & (p ^ q)) ^ ((p & b) | (p | 56));
+  }
+  c = ((a | p) & (b * 29)) | ((b | 7) * (p - p));
+  c = ((b & d) - (a + p)) & ((p - b) - (a + q));
+  d = ((a + 57) - (q ^ a)) - ((b ^ a) - (d * 67));
+  if(a < q){
+    a = ((q + d) + (c * q)) | ((b - c) - (p ^ p));
+  }else{
+    a = ((a | 86) - (a * p)) & ((q * 86) ^ (c | c));
+  }
+  a = ((a + q) * (d * p)) - ((b | 40) & (b * c));
+  c = ((a & p) & (q | 68)) ^ ((c & q) & (q + p));
+  for(i = 0; i < 32; i++){
+    d = ((q ^ p) - (c * 10)) - ((p ^ a) & (a | c));
+  }
+  d = ((d - 30) + (c + a)) & ((q | q) - (b | b));
+  if(c < b){
+    b = ((a + 15) * (p | 55)) | ((c + p) * (b + b));
+  }else{
+    b = ((c * c) | (p * 91)) * ((b ^ b) | (p ^ b));
+  }
+  c = ((q ^ p) - (b - b)) | ((b ^ 43) - (b * 87));
+  c = ((d + q) & (p - a)) - ((b + b) - (d ^ q));
+  c = ((a ^ b) | (p * 95)) | ((a | p) ^ (a + 15));
+  b = ((p & d) ^ (d | d)) ^ ((d + 67) ^ (a & p));
+  if(a < c){
+    c = ((d | 34) * (q * 81)) * ((c + a) + (b * a));
+  }else{
+    b = ((a * 20) | (p + b)) - ((d & q) | (p + 16));
+  }
+  c = ((a & 86) + (b ^ a)) | ((d | a) ^ (b | d));
+  d = ((b ^ c) | (q - 78)) | ((c + a) - (b ^ d));
+  c = ((b + p) ^ (a * 37)) * ((c * d) ^ (b + d));
+  d = ((q + p) | (c * 11)) & ((q ^ b) + (d + a));
+  if(b < p){
+    a = ((a + 31) ^ (a | d)) + ((c ^ b) ^ (p - b));
+  }else{
+    b = ((b | 34) + (d | a)) * ((b * 94) - (q - c));
+  }
+  a = ((b & p) ^ (c * b)) ^ ((q & a) | (p - q));
+  for(i = 0; i < 34; i++){
+    d = ((p ^ a) * (q | 85)) + ((q & c) & (a ^ 21));
+  }
+  d = ((b ^ p) ^ (d * c)) + ((b & q) ^ (d & d));
+  a = ((p * d) + (q + b)) - ((p + 22) | (d + a));
+  if(a < 63){
+    a = ((p | 33) * (b ^ b)) - ((q + a) | (q - p));
+  }else{
+    b = ((q * p) * (p | c)) | ((d ^ c) | (b | q));
+  }
+  b = ((b + a) ^ (c | d)) - ((d ^ 83) ^ (d - p));
+  d = ((q ^ 95) | (p & 13)) | ((q & b) | (d * q));
+  c = ((d & p) & (c + d)) & ((d | 18) & (b + a));
+  for(i = 0; i < 3; i++){
+    c = ((d ^ 83) & (b * q)) | ((q * q) ^ (q * a));
+  }
+  if(a < 88){
+    d = ((a + p) * (d * a)) + ((q | 3) & (c ^ p));
+  }else{
+    b = ((q + d) - (c & q)) + ((q | d) - (c ^ 15));
+  }
+  return a + b + c + d;
+}
+
+int func240(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 63;
+  d = 43;
+  c = ((d + 45) - (p ^ p)) - ((d - b) | (q + c));
+  b = ((b - d) | (a & d)) | ((b & 55) | (q & c));
+  d = ((a | p) - (b | a)) * ((c * 46) ^ (d | 18));
+  d = ((q - b) * (c - q)) + ((b & p) - (a & q));
+  if(d < 74){
+    d = ((c - a) ^ (p + a)) | ((d ^ c) * (d * 45));
+  }else{
+    d = ((d - 98) ^ (d ^ q)) * ((d * a) & (p & b));
+  }
+  a = ((c + a) | (a & a)) * ((a - c) ^ (q * b));
+  for(i = 0; i < 2; i++){
+    b = ((b - b) * (q ^ a)) | ((q & b) * (d + q));
+  }
+  c = ((c ^ q) & (d - b)) | ((q & c) | (p + q));
+  b = ((d ^ c) - (p & 91)) & ((a | d) | (p | 44));
+  if(c < p){
+    b = ((q + q) & (q * b)) - ((a + q) & (a + 25));
+  }else{
+    a = ((q - 55) * (p ^ b)) | ((q - d) + (b | c));
+  }
+  c = ((b - d) & (b * q)) + ((a * 75) + (a * b));
+  c = ((a - p) | (q ^ c)) & ((a | q) | (a * b));
+  a = ((a + a) ^ (q - p)) & ((d - d) * (p - p));
+  for(i = 0; i < 15; i++){
+    c = ((a | q) ^ (c ^ d)) + ((b - a) ^ (q | p));
+  }
+  if(d < b){
+    b = ((a + d) ^ (b * 52)) * ((q - c) - (a * b));
+  }else{
+    c = ((c * p) | (c + c)) * ((b ^ b) - (p | c));
+  }
+  a = ((q ^ q) + (c ^ 22)) ^ ((c + b) - (a & 26));
+  b = ((c * p) ^ (q | p)) | ((a * p) - (b | 27));
+  b = ((b - p) + (a + p)) - ((a * p) | (a | 17));
+  d = ((a ^ d) - (q & q)) - ((a + 22) & (a ^ 81));
+  if(c < d){
+    a = ((b + b) + (q | p)) * ((b - q) & (a - p));
+  }else{
+    a = ((d | b) ^ (b - b)) * ((p & c) ^ (q - q));
+  }
+  for(i = 0; i < 28; i++){
+    d = ((d - d) * (q ^ 74)) ^ ((c ^ a) | (c - a));
+  }
+  c = ((d | d) + (a * p)) + ((p ^ a) | (a & 81));
+  c = ((d * p) & (b * a)) | ((c - 28) * (c * d));
+  a = ((b & c) - (p & b)) - ((d & d) + (q ^ a));
+  if(a < 34){
+    d = ((a ^ d) * (d + d)) + ((q | d) | (q + b));
+  }else{
+    b = ((b | 81) - (p + a)) & ((b + c) ^ (p - q));
+  }
+  c = ((p ^ d) * (a ^ b)) & ((d + d) ^ (a | 24));
+  c = ((d & c) - (d & p)) + ((d * d) + (q & q));
+  for(i = 0; i < 40; i++){
+    b = ((b & q) * (q ^ q)) - ((q * a) ^ (b + p));
+  }
+  c = ((d & c) ^ (c + b)) ^ ((c ^ 27) * (d | p));
+  if(d < q){
+    a = ((a ^ c) * (p ^ p)) - ((b & 89) ^ (q - c));
+  }else{
+    b = ((a ^ a) & (a - b)) ^ ((q | d) * (c | b));
+  }
+  a = ((c - p) - (p - 77)) * ((p + q) | (b + 76));
+  c = ((a + c) + (d & 53)) - ((q | p) ^ (c ^ p));
+  a = ((b ^ q) | (q * c)) | ((p | b) ^ (c & 85));
+  c = ((q ^ b) + (p + c)) * ((d + b) ^ (c & q));
+  if(b < a){
+    a = ((b - 59) + (b + 19)) - ((c ^ q) + (a & p));
+  }else{
+    d = ((p - b) & (b * p)) + ((c | b) ^ (q * c));
+  }
+  b = ((p ^ 50) * (b - p)) - ((b * c) ^ (b ^ b));
+  b = ((p + b) + (c * 94)) * ((q + 87) - (c - p));
+  a = ((d - d) - (b ^ d)) & ((p ^ 47) + (a ^ 21));
+  b = ((a - 73) * (d - 63)) ^ ((b - 93) + (c + b));
+  if(a < 60){
+    b = ((b | d) * (p | a)) | ((b | a) - (p * 54));
+  }else{
+    c = ((a ^ 54) * (q ^ 29)) * ((p * 15) | (d | b));
+  }
+  d = ((d | p) & (c & a)) | ((c * q) ^ (q ^ p));
+  for(i = 0; i < 34; i++){
+    b = ((q & d) | (b * a)) | ((p - q) * (p & c));
+  }
+  a = ((a * 71) ^ (p - q)) + ((b & 63) ^ (c - 77));
+  b = ((d + b) + (d | 29)) + ((b * d) + (c ^ b));
+  if(a < a){
+    a = ((b | b) - (a + q)) + ((p & a) - (p - d));
+  }else{
+    c = ((p | p) ^ (c | q)) + ((b & p) * (p | c));
+  }
+  a = ((c + a) | (b - p)) + ((q - d) & (b | p));
+  b = ((d + p) | (q - a)) * ((c * q) - (d + b));
+  c = ((a - 55) + (a & p)) - ((c & 40) + (d - c));
+  for(i = 0; i < 43; i++){
+    b = ((c ^ 67) & (p & 85)) & ((p * 16) ^ (p & d));
+  }
+  if(b < d){
+    c = ((d + b) ^ (b * p)) - ((q - 92) - (b | 97));
+  }else{
+    c = ((q - a) * (c | c)) * ((d * q) & (a * 74));
+  }
+  return a + b + c + d;
+}
+
+int func241(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 12;
+  d = 42;
+  b = ((p & q) * (p ^ c)) ^ ((q * q) * (p & a));
+  c = ((p & c) & (a * d)) ^ ((p ^ a) - (a * b));
+  d = ((p ^ 3) + (c ^ 58)) | ((p * p) & (d ^ b));
+  d = ((q - d) * (b | b)) + ((p - 47) ^ (c + 49));
+  if(b < d){
+    b = ((b ^ d) + (p - d)) ^ ((p - 61) * (c + q));
+  }else{
+    d = ((a - 54) ^ (a | q)) ^ ((d & 75) * (q + q));
+  }
+  b = ((a | a) * (d + c)) ^ ((d * a) + (d + 96));
+  for(i = 0; i < 8; i++){
+    d = ((q + b) + (p ^ d)) + ((q - c) * (q & d));
+  }
+  b = ((q * p) - (c | c)) ^ ((q ^ p) * (q & d));
+  c = ((p - p) & (d | c)) ^ ((b | q) + (b ^ q));
+  if(a < q){
+    c = ((q ^ b) + (a | 79)) & ((a * a) - (a + b));
+  }else{
+    c = ((q & d) + (c - 5)) - ((d ^ b) ^ (c + b));
+  }
+  c = ((a * p) - (b | b)) * ((q ^ p) * (c | 19));
+  c = ((d * b) - (q | a)) & ((q + q) + (q ^ q));
+  d = ((q | c) + (b | 35)) ^ ((q | a) & (b + d));
+  for(i = 0; i < 45; i++){
+    b = ((b & 95) & (b * 85)) * ((b & p) ^ (b | a));
+  }
+  if(b < p){
+    c = ((c & p) + (b | b)) & ((q & p) - (c * 29));
+  }else{
+    c = ((a ^ 96) & (b & q)) - ((q - c) & (a | p));
+  }
+  a = ((c - 57) + (a - 19)) ^ ((c * 47) - (p & d));
+  a = ((a & q) * (p & 32)) + ((p - q) - (a | b));
+  b = ((d & d) & (d + a)) + ((a ^ p) | (q * a));
+  d = ((b & c) | (b ^ a)) - ((c | d) | (c ^ q));
+  if(d < d){
+    a = ((p & 71) - (b ^ p)) ^ ((c - d) + (b * d));
+  }else{
+    a = ((b * a) - (b - p)) ^ ((b | 79) - (q + d));
+  }
+  for(i = 0; i < 43; i++){
+    a = ((d - 80) ^ (c | 26)) * ((b ^ b) ^ (d | 84));
+  }
+  c = ((d ^ d) | (a & p)) * ((c & p) | (b | p));
+  a = ((a + a) + (c ^ b)) * ((b - 28) + (p * q));
+  d = ((c ^ c) ^ (q + a)) * ((q ^ a) | (p & 63));
+  if(b < b){
+    a = ((a + 16) - (d - b)) * ((d + c) * (q + p));
+  }else{
+    a = ((d + a) + (d | p)) - ((a - p) - (b * 85));
+  }
+  d = ((a - c) + (q * 29)) - ((d - q) - (b + b));
+  b = ((a + 75) * (a & b)) * ((b & 56) ^ (b & 55));
+  for(i = 0; i < 25; i++){
+    b = ((b | b) | (q * c)) + ((p + b) - (a + p));
+  }
+  b = ((c + p) ^ (p & 27)) & ((b * q) + (c * q));
+  if(a < q){
+    c = ((d ^ 83) + (d * b)) ^ ((a + c) * (c ^ 82));
+  }else{
+    c = ((d + c) ^ (p * 25)) + ((p | b) ^ (d * b));
+  }
+  a = ((d & p) ^ (b ^ b)) - ((p | c) | (c * a));
+  c = ((d - 41) - (a - p)) - ((p ^ d) - (d + 19));
+  d = ((c & d) & (d | a)) | ((p - 73) + (c * 29));
+  c = ((p | 38) & (a + a)) & ((b * 42) * (p * b));
+  if(a < b){
+    c = ((d * 86) & (q & d)) ^ ((q * a) | (c * d));
+  }else{
+    d = ((a + 52) ^ (c * 61)) * ((d + 96) - (c | p));
+  }
+  d = ((d | p) ^ (d & c)) & ((c ^ d) * (a & c));
+  c = ((d + a) | (d - b)) ^ ((b | 54) & (q - d));
+  c = ((d | 88) | (q ^ p)) ^ ((d & q) - (p | 24));
+  d = ((d * q) * (a & a)) * ((c & a) + (c + d));
+  if(b < p){
+    b = ((p & 36) + (c & 62)) + ((a ^ d) * (p - q));
+  }else{
+    d = ((q - c) ^ (d ^ 96)) + ((q ^ q) & (p | p));
+  }
+  d = ((d + 59) - (c ^ 10)) ^ ((c + 92) | (b | 85));
+  for(i = 0; i < 30; i++){
+    d = ((c - q) * (b + q)) ^ ((c & q) | (c + 64));
+  }
+  c = ((d ^ a) + (q & 87)) ^ ((q * c) + (c ^ b));
+  b = ((b * 65) + (d - p)) ^ ((c ^ d) | (a ^ p));
+  if(c < 13){
+    d = ((b - a) ^ (c ^ p)) * ((b ^ 40) * (p * a));
+  }else{
+    d = ((p ^ a) + (q - 52)) ^ ((q | b) & (b * c));
+  }
+  a = ((p + 71) & (c + 22)) * ((b - 79) - (b - p));
+  b = ((a + p) | (d - b)) ^ ((c * q) - (a | 26));
+  c = ((q + a) * (q - p)) | ((d + q) & (b & d));
+  for(i = 0; i < 15; i++){
+    a = ((a & a) & (q * q)) ^ ((p | 2) | (c & b));
+  }
+  if(d < 77){
+    a = ((a | d) + (a - 48)) | ((d ^ a) ^ (b - p));
+  }else{
+    a = ((b | a) - (b ^ q)) + ((q & q) - (p + q));
+  }
+  return a + b + c + d;
+}
+
+int func242(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 85;
+  d = 45;
+  b = ((a * 87) - (d & 17)) ^ ((d & q) | (q + a));
+  a = ((d * 20) | (c | 51)) & ((p | a) * (c - p));
+  a = ((b - 27) ^ (p ^ a)) | ((d * 1) ^ (a + b));
+  c = ((c - b) - (b + q)) ^ ((q | a) - (b & q));
+  if(a < 3){
+    a = ((a | c) & (d * a)) * ((b * b) ^ (q ^ 47));
+  }else{
+    c = ((q | a) - (q | q)) - ((c ^ d) | (c + p));
+  }
+  a = ((b & 21) + (d * 51)) ^ ((b | q) | (a ^ d));
+  for(i = 0; i < 44; i++){
+    d = ((a - a) - (d ^ c)) | ((p ^ a) | (q - b));
+  }
+  b = ((d + 39) - (q ^ b)) & ((c + 1) + (p & d));
+  c = ((b + d) + (d & d)) | ((b | a) - (p * c));
+  if(b < a){
+    d = ((b ^ 76) * (a - a)) * ((d * b) * (p & 39));
+  }else{
+    b = ((d & d) | (a + a)) & ((q | c) + (d * d));
+  }
+  d = ((q - 34) + (c - 27)) & ((p & b) * (a - p));
+  a = ((b & c) | (a | q)) * ((b & c) * (d ^ 58));
+  c = ((p | p) | (p & p)) & ((d + b) & (q + c));
+  for(i = 0; i < 40; i++){
+    d = ((c | a) - (a + p)) * ((a * c) ^ (p * p));
+  }
+  if(b < a){
+    b = ((d ^ d) & (p & 41)) ^ ((a - p) - (a * d));
+  }else{
+    d = ((q ^ p) | (b ^ p)) + ((c * b) + (q * 6));
+  }
+  d = ((q & d) & (b * b)) + ((d & b) | (q | p));
+  c = ((q + b) | (d ^ p)) + ((a * q) - (d * b));
+  b = ((b - a) | (p * p)) * ((c - a) + (c * b));
+  d = ((q * b) * (b & c)) & ((d ^ q) ^ (c ^ 13));
+  if(b < p){
+    a = ((d - c) & (c ^ 86)) * ((q - a) | (p & c));
+  }else{
+    c = ((d | d) * (b - a)) - ((p & b) * (a | 68));
+  }
+  for(i = 0; i < 40; i++){
+    a = ((b + d) | (p * q)) ^ ((a + b) - (b * b));
+  }
+  d = ((a * 54) * (p | q)) | ((b * 81) - (a + a));
+  c = ((q ^ d) & (a & d)) ^ ((d ^ d) & (q ^ q));
+  d = ((p ^ d) & (a | b)) | ((a - d) + (a | b));
+  if(d < c){
+    b = ((b ^ q) & (c & 67)) & ((q * b) - (p * d));
+  }else{
+    b = ((b + p) + (d * 20)) + ((b ^ c) - (p ^ q));
+  }
+  d = ((b & 95) * (a & d)) - ((q ^ q) | (c * d));
+  b = ((d + q) + (q | c)) ^ ((d | 41) | (c ^ c));
+  for(i = 0; i < 47; i++){
+    c = ((d + 34) ^ (p ^ a)) + ((p ^ a) + (a & a));
+  }
+  a = ((q * b) & (b * c)) + ((d + d) & (c & q));
+  if(d < 56){
+    a = ((q + p) * (c + 61)) - ((a | 69) ^ (p | 81));
+  }else{
+    d = ((d | c) ^ (q | 50)) & ((p & d) * (b & a));
+  }
+  d = ((d & c) ^ (c | p)) * ((d + 64) - (a * d));
+  b = ((p * q) * (b ^ q)) | ((c ^ 64) + (p - 12));
+  a = ((c & b) | (b * c)) ^ ((q | q) | (q - d));
+  c = ((c | b) * (q | c)) & ((d | p) + (a + a));
+  if(b < q){
+    a = ((c - p) ^ (a & d)) * ((d + b) - (p | 48));
+  }else{
+    b = ((d & p) * (b & d)) ^ ((p * 36) | (c - c));
+  }
+  c = ((d - q) + (d - a)) | ((p + q) - (p - d));
+  c = ((d | 48) - (q - c)) | ((p & a) * (d + a));
+  b = ((b * q) - (c ^ q)) & ((b ^ d) * (c & p));
+  c = ((q * 92) & (d + d)) & ((a ^ d) | (d - p));
+  if(b < c){
+    a = ((d | d) + (a & 14)) & ((q * c) + (b * q));
+  }else{
+    c = ((c + q) ^ (q * c)) * ((p - 53) & (q & q));
+  }
+  d = ((c - a) ^ (c * p)) ^ ((q ^ 13) ^ (q * q));
+  for(i = 0; i < 49; i++){
+    b = ((c ^ 64) - (b ^ d)) * ((a + p) ^ (a | q));
+  }
+  c = ((c + c) + (c & d)) - ((p * p) ^ (q - a));
+  c = ((q - 73) - (p & q)) | ((a | d) + (d * a));
+  if(b < p){
+    a = ((d + p) ^ (c + 73)) & ((a & 24) - (d & d));
+  }else{
+    b = ((b * b) - (q ^ b)) | ((a * q) ^ (b + 32));
+  }
+  a = ((p | d) * (q | q)) * ((d * c) ^ (c - c));
+  d = ((a & c) * (q - d)) ^ ((c & 8) + (d + c));
+  c = ((d * c) & (a & b)) - ((d | 30) ^ (q * p));
+  for(i = 0; i < 5; i++){
+    b = ((b | b) | (p ^ a)) + ((q + p) ^ (d | q));
+  }
+  if(a < a){
+    c = ((b | 32) & (c & 19)) * ((q + a) | (b * a));
+  }else{
+    b = ((q - b) & (c + d)) + ((p & a) ^ (q + 43));
+  }
+  return a + b + c + d;
+}
+
+int func243(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 6;
+  d = 13;
+  c = ((d & b) + (p & q)) ^ ((d & c) | (c | p));
+  b = ((a * c) & (b & b)) | ((a & p) ^ (a * a));
+  b = ((a * q) & (d ^ 76)) * ((p + 88) - (p - a));
+  b = ((c + a) | (p ^ d)) + ((q & b) ^ (a - 65));
+  if(c < 23){
+    b = ((b & 69) * (c | p)) & ((p ^ d) ^ (q & c));
+  }else{
+    b = ((d ^ p) * (d & 19)) ^ ((c + b) & (q ^ 38));
+  }
+  a = ((d ^ c) | (d ^ d)) * ((c + a) - (b + a));
+  for(i = 0; i < 17; i++){
+    a = ((q * a) ^ (d ^ q)) & ((d * c) & (d * c));
+  }
+  a = ((p ^ d) - (a * c)) - ((q - a) * (p + a));
+  b = ((d ^ q) ^ (c & 92)) & ((a | q) * (a & 9));
+  if(b < d){
+    b = ((p + p) + (c - c)) & ((b ^ q) & (d ^ q));
+  }else{
+    c = ((p * b) * (p ^ b)) * ((d + p) & (d - d));
+  }
+  c = ((b - p) + (b | p)) - ((q + d) - (p & 42));
+  a = ((p ^ a) | (a + d)) | ((a - p) - (b - c));
+  a = ((p - p) - (p | q)) * ((q * 32) ^ (b | a));
+  for(i = 0; i < 39; i++){
+    a = ((p - q) ^ (d + c)) | ((q ^ q) - (p ^ p));
+  }
+  if(d < q){
+    a = ((d | b) | (p * d)) & ((d * d) | (a | a));
+  }else{
+    a = ((q - p) ^ (b & c)) | ((b ^ p) & (c | 52));
+  }
+  b = ((c & p) | (p * q)) * ((d * a) & (d - c));
+  d = ((d ^ d) ^ (p * a)) * ((b * 33) * (c & d));
+  b = ((b | a) + (b & a)) * ((p | p) + (a + d));
+  c = ((q + c) * (c * 29)) - ((p | a) - (p | b));
+  if(a < a){
+    c = ((d ^ d) ^ (p - d)) ^ ((a & b) ^ (q | p));
+  }else{
+    b = ((q ^ b) & (q ^ d)) * ((b - a) * (p - b));
+  }
+  for(i = 0; i < 15; i++){
+    c = ((c - 38) + (a ^ q)) | ((a * a) | (p * 40));
+  }
+  d = ((p + a) | (c ^ d)) & ((b + c) * (q - p));
+  b = ((a & c) ^ (d ^ d)) * ((a + a) * (p + 41));
+  d = ((p | c) | (c + b)) | ((q * a) + (c - 50));
+  if(c < b){
+    c = ((c * a) * (b - 54)) & ((p & c) & (b * b));
+  }else{
+    c = ((q | c) * (b ^ b)) * ((d - d) - (c & 38));
+  }
+  d = ((q ^ p) | (p * a)) | ((b - c) * (q | b));
+  c = ((d + q) * (c ^ 98)) ^ ((c ^ a) ^ (b - b));
+  for(i = 0; i < 21; i++){
+    d = ((a | p) | (p * q)) | ((q * 96) & (b | d));
+  }
+  d = ((p | p) ^ (a + c)) | ((q - 48) * (c & q));
+  if(a < 44){
+    b = ((p & 29) - (q * d)) * ((b - q) & (d & a));
+  }else{
+    a = ((q + 92) | (b + d)) & ((q | d) - (q | p));
+  }
+  a = ((p + 32) | (q * q)) * ((p - p) + (d * 53));
+  d = ((d | 56) | (c + c)) - ((p | p) * (c + b));
+  d = ((d + a) * (q - c)) * ((d + b) + (d * c));
+  b = ((c ^ c) | (a - c)) | ((b ^ c) ^ (a ^ 67));
+  if(a < 32){
+    c = ((p | c) & (c | p)) & ((d + c) ^ (p | 45));
+  }else{
+    d = ((p | p) - (q - q)) & ((p ^ p) * (a | 38));
+  }
+  c = ((c * q) | (a | q)) ^ ((q ^ b) + (b + a));
+  a = ((q - c) ^ (a | 37)) - ((a ^ 71) & (d ^ 14));
+  a = ((a + a) - (c & 99)) - ((c - b) + (d + a));
+  c = ((q & 97) | (b & d)) + ((c + c) & (q * 3));
+  if(c < q){
+    c = ((c * p) - (d * a)) + ((b - p) + (p + p));
+  }else{
+    b = ((p + q) ^ (c + a)) - ((p * q) ^ (q * c));
+  }
+  b = ((c - c) - (a + 84)) * ((p - p) + (a - c));
+  for(i = 0; i < 36; i++){
+    b = ((p + 35) * (c + a)) | ((b | 71) ^ (d | a));
+  }
+  a = ((d & b) & (q ^ b)) + ((q - d) & (c ^ c));
+  a = ((p ^ q) ^ (b | 84)) * ((q | 46) & (c + p));
+  if(a < p){
+    a = ((c + p) - (a * 68)) ^ ((p - 31) & (b + b));
+  }else{
+    b = ((d * 29) * (p + 80)) + ((a - 35) ^ (d * p));
+  }
+  b = ((a * a) ^ (b & p)) | ((p + c) | (c & c));
+  a = ((q + b) + (a & q)) ^ ((p | 31) - (b * a));
+  c = ((d + b) + (c ^ p)) & ((c & d) + (b & p));
+  for(i = 0; i < 27; i++){
+    c = ((q | b) | (q * a)) ^ ((d ^ 22) ^ (p - p));
+  }
+  if(c < c){
+    b = ((c * 96) * (d ^ 55)) - ((p + 97) ^ (b & 18));
+  }else{
+    c = ((c & a) * (p * d)) ^ ((q * 25) * (q ^ 51));
+  }
+  return a + b + c + d;
+}
+
+int func244(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 36;
+  d = 87;
+  a = ((q & q) & (b | d)) * ((p + a) - (b + q));
+  a = ((p & b) & (a & c)) | ((p | 75) | (p & 18));
+  d = ((b ^ d) + (q ^ b)) & ((c * p) & (b ^ b));
+  c = ((d + q) | (d * 89)) | ((c ^ 20) * (b ^ q));
+  if(d < p){
+    d = ((d ^ p) - (a | p)) | ((c | p) * (q ^ a));
+  }else{
+    d = ((c | b) * (q + b)) | ((p ^ 93) - (a ^ a));
+  }
+  a = ((p - 73) - (c | b)) + ((b + a) | (c - p));
+  for(i = 0; i < 47; i++){
+    d = ((p & 33) & (a + c)) - ((b ^ p) & (c ^ b));
+  }
+  d = ((c ^ p) ^ (b ^ c)) & ((a - 17) + (d ^ a));
+  b = ((d | 33) | (d | 57)) & ((q ^ d) ^ (a + q));
+  if(d < c){
+    a = ((q & c) * (a + d)) - ((b & q) ^ (c ^ d));
+  }else{
+    c = ((b & 44) * (c ^ a)) * ((c * p) | (p * c));
+  }
+  a = ((p | b) - (c * 1)) * ((d | 68) & (a ^ q));
+  c = ((b ^ b) - (q ^ a)) | ((q - d) ^ (d | p));
+  b = ((b & a) * (a + q)) | ((d * p) | (q + 25));
+  for(i = 0; i < 18; i++){
+    b = ((b - b) - (a & p)) | ((b | d) ^ (c ^ c));
+  }
+  if(d < b){
+    a = ((d | b) & (b | d)) | ((c & q) * (a | c));
+  }else{
+    b = ((c * b) | (d - 15)) + ((a & c) - (q * a));
+  }
+  a = ((a + a) ^ (c | a)) + ((d & b) - (a * 53));
+  d = ((b ^ 52) | (q & d)) ^ ((a + 16) | (d ^ p));
+  b = ((d + c) | (d * p)) - ((a - d) & (q + c));
+  b = ((d + q) | (a + 90)) | ((d & d) | (a * 21));
+  if(d < 89){
+    d = ((d + p) & (q & 66)) | ((d | q) & (a * b));
+  }else{
+    a = ((p ^ b) | (p - a)) * ((c * q) ^ (p & 34));
+  }
+  for(i = 0; i < 19; i++){
+    c = ((q & c) ^ (b & b)) | ((q + p) + (q - c));
+  }
+  b = ((b & b) - (a + a)) - ((p | d) * (d - p));
+  d = ((p & b) | (b - q)) + ((b * a) - (a - b));
+  c = ((p - b) | (a * a)) ^ ((b ^ 80) ^ (a + a));
+  if(a < d){
+    d = ((p + p) + (p & 60)) ^ ((c | d) + (a - p));
+  }else{
+    c = ((b ^ 5) * (p - 72)) * ((a - p) ^ (c ^ p));
+  }
+  c = ((d - p) ^ (a - c)) * ((b ^ q) * (a ^ 18));
+  d = ((a - a) + (p ^ c)) * ((q - a) & (a - p));
+  for(i = 0; i < 32; i++){
+    b = ((q - d) + (a ^ q)) ^ ((a ^ d) - (d - a));
+  }
+  d = ((p * c) | (b ^ 94)) | ((a ^ 21) | (q * b));
+  if(b < q){
+    d = ((a & c) - (a ^ p)) & ((p ^ b) * (d - a));
+  }else{
+    d = ((p - d) * (a + b)) ^ ((b & a) + (p + b));
+  }
+  b = ((b * c) | (p ^ b)) + ((p * d) & (c ^ a));
+  a = ((q * 52) | (a * d)) ^ ((q & 16) | (c | p));
+  b = ((c - b) * (p * a)) ^ ((a ^ 31) + (c + d));
+  c = ((p - b) * (d & d)) - ((p ^ 8) - (d | 68));
+  if(c < 28){
+    d = ((a & q) ^ (c - p)) * ((p * c) * (q * 32));
+  }else{
+    a = ((c - 42) * (q & 41)) + ((q + q) & (b - 71));
+  }
+  c = ((p - p) | (p * b)) * ((d & 29) * (c & q));
+  c = ((a ^ c) + (q * p)) ^ ((d & 19) * (p & 95));
+  a = ((a - q) * (q - q)) - ((p ^ c) ^ (b & 52));
+  d = ((a * p) ^ (b ^ q)) + ((p ^ p) + (p & b));
+  if(c < 68){
+    b = ((a * 30) & (a & 72)) & ((c * b) * (q ^ 97));
+  }else{
+    b = ((c ^ c) + (p & d)) - ((b & 6) & (q ^ d));
+  }
+  d = ((c - 39) * (q & 75)) - ((q - a) + (q & b));
+  for(i = 0; i < 49; i++){
+    b = ((b + b) ^ (b - b)) ^ ((d ^ d) ^ (p | a));
+  }
+  d = ((d & 61) * (d | 2)) ^ ((a - q) & (d - a));
+  a = ((c * p) & (c * b)) & ((p ^ 37) | (b + 74));
+  if(d < a){
+    b = ((d & p) ^ (d & 51)) - ((c + d) - (p & q));
+  }else{
+    c = ((b & d) | (q * q)) - ((d & p) & (c & 73));
+  }
+  a = ((b + d) | (a & 48)) ^ ((b ^ q) - (q - p));
+  d = ((d | d) + (p + p)) - ((b ^ q) | (d ^ 10));
+  c = ((q ^ 9) * (d * 41)) + ((c - a) + (b * q));
+  for(i = 0; i < 47; i++){
+    d = ((p * c) & (c - p)) + ((b * 46) & (a + d));
+  }
+  if(d < b){
+    d = ((a & 73) & (c & a)) * ((p & c) + (c | p));
+  }else{
+    b = ((p ^ a) | (c + b)) & ((a * 42) * (p | c));
+  }
+  return a + b + c + d;
+}
+
+int func245(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 90;
+  d = 85;
+  c = ((a & a) | (p * a)) - ((a + 86) - (q ^ d));
+  c = ((b + d) ^ (d ^ p)) & ((a - c) ^ (d ^ p));
+  a = ((p - d) - (p ^ b)) * ((b - a) * (b ^ a));
+  b = ((b * p) ^ (b - b)) & ((q ^ b) * (b ^ 75));
+  if(a < 56){
+    a = ((b + a) & (b ^ c)) * ((q ^ a) + (a | 63));
+  }else{
+    c = ((p + c) & (a & c)) ^ ((p | b) & (c * q));
+  }
+  a = ((p | 4) | (q + d)) | ((c + 5) + (a + q));
+  for(i = 0; i < 32; i++){
+    a = ((b + b) | (c + a)) - ((d ^ q) - (c + c));
+  }
+  b = ((d & 6) ^ (q & 31)) | ((d ^ b) ^ (q ^ b));
+  a = ((d ^ p) * (b + d)) ^ ((c & 48) | (a - 73));
+  if(c < a){
+    b = ((d + p) ^ (a + q)) ^ ((q & q) | (d & a));
+  }else{
+    d = ((a - p) * (b - 57)) & ((c * p) + (a ^ d));
+  }
+  a = ((c * d) & (b ^ c)) * ((p + b) * (a & d));
+  a = ((c & p) * (p | 38)) - ((d - d) & (p + q));
+  d = ((p + a) ^ (b + p)) * ((b - p) + (p & 16));
+  for(i = 0; i < 6; i++){
+    c = ((q + 5) ^ (a & q)) - ((d - q) + (a - c));
+  }
+  if(d < d){
+    b = ((b * c) + (b | a)) ^ ((a & b) ^ (a * 36));
+  }else{
+    a = ((p * q) + (p | d)) | ((d + c) | (p | a));
+  }
+  b = ((q + 94) + (b | 39)) - ((c + 51) | (d & 78));
+  c = ((d - d) + (c + b)) | ((d + d) | (d - 46));
+  b = ((c + q) | (p - p)) ^ ((c & p) | (q * c));
+  d = ((p * b) - (b ^ q)) + ((p + q) * (b - a));
+  if(d < 52){
+    d = ((b * 14) & (d * p)) ^ ((p ^ q) & (a * q));
+  }else{
+    a = ((q - q) + (b | 70)) - ((a - p) * (a + 51));
+  }
+  for(i = 0; i < 17; i++){
+    b = ((c - q) - (a - q)) - ((c - c) | (b & d));
+  }
+  c = ((c ^ p) * (d ^ d)) + ((q | p) ^ (b | d));
+  c = ((d * q) ^ (p - c)) + ((q ^ d) * (b - p));
+  b = ((d - b) + (q ^ a)) ^ ((d & d) * (a & d));
+  if(d < 42){
+    b = ((a + 70) * (c + 89)) * ((b | 20) | (a * c));
+  }else{
+    c = ((b ^ q) | (c * c)) * ((c - c) ^ (a + c));
+  }
+  d = ((b - c) - (c & d)) * ((a - q) ^ (q * p));
+  c = ((a + 44) & (c | a)) * ((c | c) * (p | q));
+  for(i = 0; i < 23; i++){
+    a = ((b * c) - (q ^ q)) | ((p | p) * (d & b));
+  }
+  d = ((p ^ b) ^ (a ^ 5)) ^ ((b - 44) * (p * p));
+  if(a < d){
+    c = ((d ^ 47) & (q & a)) ^ ((c * b) & (c * p));
+  }else{
+    a = ((q - b) & (b | 7)) - ((q | 35) ^ (p & 38));
+  }
+  b = ((q + 31) - (p & p)) + ((a - c) * (a * p));
+  d = ((c | q) | (c * q)) + ((q ^ 13) ^ (q + q));
+  b = ((d & 13) | (p | 47)) & ((d ^ c) * (b * 14));
+  c = ((d & b) & (d ^ q)) & ((q * p) * (q - c));
+  if(b < 27){
+    a = ((d & c) + (b ^ a)) + ((c & a) - (p ^ 63));
+  }else{
+    b = ((p * 85) ^ (q ^ 86)) + ((b ^ 67) | (a | 36));
+  }
+  a = ((c * 85) * (b + q)) * ((c - 81) | (d - d));
+  c = ((q ^ 57) * (p ^ 7)) & ((c | d) * (b - q));
+  b = ((d & q) ^ (d * d)) + ((c - d) | (p & 93));
+  a = ((a - d) - (q | b)) | ((a ^ q) | (b & q));
+  if(a < a){
+    a = ((d | b) | (b | c)) | ((a + 52) ^ (b | p));
+  }else{
+    a = ((c * q) - (c + 32)) + ((b + q) * (q & c));
+  }
+  d = ((q | c) & (c - c)) * ((c * p) & (d & c));
+  for(i = 0; i < 13; i++){
+    c = ((b * a) ^ (b & b)) - ((d & c) * (d & b));
+  }
+  b = ((c & p) | (b ^ q)) - ((p + 66) | (q & p));
+  d = ((c | d) - (d & a)) | ((a | 79) | (b + 58));
+  if(b < c){
+    c = ((c - q) | (p | c)) | ((a ^ d) & (b * a));
+  }else{
+    d = ((p | d) & (c + q)) ^ ((b * c) | (d ^ p));
+  }
+  c = ((b - q) ^ (b ^ b)) & ((q | a) - (c - p));
+  b = ((d & a) ^ (a | d)) & ((p ^ b) ^ (q & b));
+  a = ((b * q) + (d & c)) ^ ((p & q) * (c | q));
+  for(i = 0; i < 4; i++){
+    a = ((d - p) | (q ^ c)) & ((p & d) ^ (d | 90));
+  }
+  if(a < a){
+    d = ((a & c) + (c | c)) * ((p ^ a) * (c ^ c));
+  }else{
+    a = ((q * p) & (p * 84)) - ((c - 45) | (q | q));
+  }
+  return a + b + c + d;
+}
+
+int func246(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 70;
+  d = 88;
+  b = ((q + p) + (b * c)) ^ ((q * b) * (p | c));
+  b = ((c | a) | (b & 43)) ^ ((b ^ c) ^ (b + d));
+  c = ((b + b) + (q - 84)) & ((d ^ c) | (q | 42));
+  d = ((q + c) | (c & 47)) ^ ((d & p) | (p | b));
+  if(a < b){
+    a = ((b ^ d) ^ (b - 35)) * ((d ^ q) * (a | p));
+  }else{
+    b = ((a | c) ^ (a - 63)) * ((a - 44) ^ (c - 40));
+  }
+  a = ((p * 33) * (d ^ q)) * ((q - 45) * (b | p));
+  for(i = 0; i < 47; i++){
+    c = ((q - p) * (b * 41)) ^ ((p & p) ^ (p - 62));
+  }
+  b = ((b ^ q) - (c * p)) | ((q & 48) + (c ^ c));
+  a = ((b * c) - (q & c)) * ((p - p) - (d | a));
+  if(a < p){
+    c = ((d ^ a) * (b - d)) ^ ((p - d) * (c - 38));
+  }else{
+    c = ((d + 92) & (p + p)) * ((b | b) ^ (a | d));
+  }
+  b = ((c - d) - (a * q)) | ((b - q) * (c | a));
+  a = ((b ^ 5) + (d ^ p)) | ((q * c) + (b * p));
+  a = ((d ^ b) + (c ^ b)) - ((b ^ b) | (b ^ d));
+  for(i = 0; i < 35; i++){
+    b = ((a * c) - (a + p)) ^ ((d ^ q) * (q * 11));
+  }
+  if(a < a){
+    b = ((b * p) - (p & 95)) - ((b - p) ^ (c * q));
+  }else{
+    c = ((q + c) * (c - a)) ^ ((d - q) + (b | p));
+  }
+  c = ((c * 37) ^ (p - 38)) + ((q ^ 88) - (b & b));
+  c = ((q - d) ^ (q & d)) * ((q * 45) * (p ^ q));
+  c = ((q * b) + (c - a)) + ((b * p) ^ (b | b));
+  c = ((c * d) - (b | c)) & ((c & q) * (a - c));
+  if(c < c){
+    d = ((q + b) ^ (b | q)) - ((a | c) - (q | c));
+  }else{
+    c = ((p ^ p) & (b & c)) ^ ((p * b) - (b ^ d));
+  }
+  for(i = 0; i < 19; i++){
+    b = ((c & 29) | (b ^ d)) + ((b + 7) - (q | p));
+  }
+  b = ((p * c) * (q - a)) & ((d + c) | (q - q));
+  b = ((c + c) + (d - p)) | ((q ^ d) ^ (b * c));
+  b = ((b & 65) * (p * q)) | ((c + c) - (q & a));
+  if(b < b){
+    d = ((d & q) * (d ^ 29)) & ((q - a) ^ (a + 82));
+  }else{
+    d = ((b * p) * (p + p)) & ((a - q) | (p - q));
+  }
+  d = ((a | c) ^ (d & d)) | ((b - a) - (b - b));
+  c = ((b - b) & (a * p)) + ((d - d) | (a + a));
+  for(i = 0; i < 29; i++){
+    a = ((d - q) - (d & 16)) | ((p - b) | (a - 12));
+  }
+  d = ((q * p) - (a * b)) - ((p * q) & (q & d));
+  if(b < 7){
+    d = ((a + c) - (b ^ c)) - ((b | 93) * (b | q));
+  }else{
+    b = ((b + 43) + (q | d)) & ((c + b) - (c - 81));
+  }
+  a = ((p | c) - (a + 97)) - ((d ^ p) * (b | p));
+  d = ((q + c) ^ (c & 50)) + ((b ^ b) | (b | 49));
+  b = ((a | d) + (p ^ q)) * ((p ^ d) - (a - 56));
+  c = ((d | d) - (c | d)) | ((p & d) - (q - 25));
+  if(c < c){
+    b = ((q & p) | (b | 8)) - ((b | q) + (d | c));
+  }else{
+    d = ((d ^ d) * (q + q)) & ((q | 3) ^ (p | d));
+  }
+  c = ((d + b) & (q + q)) ^ ((c ^ p) & (b - c));
+  b = ((a + 37) * (b ^ a)) & ((c & 77) | (a - 33));
+  b = ((q - p) ^ (d | a)) ^ ((p & d) - (p + 2));
+  c = ((p & 38) & (a | 97)) - ((c - c) ^ (c & d));
+  if(d < 87){
+    d = ((b ^ c) - (p + q)) + ((c * a) * (a & 56));
+  }else{
+    a = ((b + c) | (q - c)) - ((q & c) | (c + 43));
+  }
+  b = ((d + d) * (q - b)) ^ ((d | d) - (p + a));
+  for(i = 0; i < 46; i++){
+    a = ((d | q) & (d & b)) ^ ((c + a) & (q * b));
+  }
+  b = ((c & q) | (p + p)) ^ ((d | c) & (b | c));
+  b = ((c | 42) - (d | a)) ^ ((p & 97) & (a + p));
+  if(a < p){
+    d = ((a + q) & (a - b)) + ((d + a) & (b - b));
+  }else{
+    a = ((b * p) & (d & 15)) - ((q | d) & (b | d));
+  }
+  c = ((p ^ b) - (p - q)) + ((b | p) + (a ^ a));
+  b = ((a ^ q) + (a * b)) & ((c * p) | (c - c));
+  d = ((p - d) & (a + 83)) | ((d + 61) ^ (d & c));
+  for(i = 0; i < 12; i++){
+    a = ((b - a) | (q * q)) | ((q + b) & (b & a));
+  }
+  if(b < a){
+    a = ((d * c) + (q * c)) | ((c + q) * (d ^ 13));
+  }else{
+    b = ((b * p) ^ (b + 89)) & ((q * c) ^ (q * c));
+  }
+  return a + b + c + d;
+}
+
+int func247(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 77;
+  d = 26;
+  c = ((q * 54) & (a ^ 93)) - ((b | a) ^ (c | d));
+  d = ((q * d) - (b & b)) | ((q - c) - (d - b));
+  c = ((p & d) ^ (a & p)) & ((c - c) & (d ^ c));
+  c = ((c | q) ^ (a | 13)) & ((b * c) - (d | b));
+  if(b < q){
+    d = ((b + 2) | (a | c)) * ((p - 50) ^ (b - d));
+  }else{
+    a = ((a ^ a) & (d * c)) + ((q | q) & (b - q));
+  }
+  c = ((b * 22) ^ (c + p)) ^ ((b + a) * (a - q));
+  for(i = 0; i < 14; i++){
+    a = ((d - 54) ^ (q * c)) ^ ((p | 21) - (c & p));
+  }
+  c = ((p & a) * (a & c)) | ((p | a) | (q ^ q));
+  b = ((c & 86) & (q - b)) + ((b + c) | (q | c));
+  if(c < p){
+    c = ((c * p) + (q & 50)) & ((d | 5) * (q & 42));
+  }else{
+    a = ((c & q) | (c + a)) & ((p * b) + (p - p));
+  }
+  d = ((p | 68) & (p * b)) & ((a | b) ^ (d ^ 96));
+  b = ((c * c) + (c - q)) * ((b * q) | (a & a));
+  d = ((q & 47) & (p - 21)) - ((d - a) + (d ^ a));
+  for(i = 0; i < 15; i++){
+    d = ((d + a) | (a + d)) * ((b + c) ^ (c & b));
+  }
+  if(d < b){
+    a = ((p & a) * (d * c)) - ((b * d) + (d & c));
+  }else{
+    b = ((q - q) ^ (a & p)) | ((b + b) | (b & q));
+  }
+  b = ((p & p) ^ (d ^ a)) ^ ((p | p) - (c & c));
+  a = ((a | 87) - (d * 27)) - ((b ^ d) - (a | q));
+  b = ((b - 88) & (a * c)) * ((b ^ a) - (p | b));
+  a = ((b + d) * (d * p)) - ((a * 43) * (d - c));
+  if(c < 86){
+    d = ((a - p) ^ (a | q)) + ((a * q) - (a * q));
+  }else{
+    d = ((q | c) ^ (b ^ a)) - ((p & 34) * (q | q));
+  }
+  for(i = 0; i < 25; i++){
+    d = ((a * 95) + (a + q)) | ((d | c) - (a | a));
+  }
+  c = ((a - d) - (b - 79)) ^ ((p & d) + (c + a));
+  a = ((a ^ a) * (a ^ a)) & ((c | a) * (c * q));
+  d = ((p - d) + (b & b)) & ((c | c) ^ (p * 87));
+  if(c < q){
+    d = ((c ^ q) | (p * a)) | ((p * d) ^ (p + 95));
+  }else{
+    c = ((c + c) ^ (p ^ a)) | ((a - c) * (b * 60));
+  }
+  c = ((p & 20) | (c | q)) - ((p ^ 4) + (p ^ 29));
+  a = ((a ^ 50) & (c * c)) - ((q | b) ^ (q * 8));
+  for(i = 0; i < 10; i++){
+    b = ((q | d) | (b ^ c)) | ((d ^ d) | (b & d));
+  }
+  d = ((a + p) | (a + q)) - ((a - 45) ^ (p | c));
+  if(d < p){
+    b = ((q + c) - (p * c)) + ((q | d) + (c | a));
+  }else{
+    c = ((c ^ a) - (q | 34)) + ((p | c) ^ (a - 83));
+  }
+  b = ((a & p) ^ (c * 19)) | ((b ^ p) + (a ^ b));
+  d = ((q & 27) + (p + c)) + ((q - q) ^ (c * c));
+  d = ((c + q) * (p + a)) | ((c ^ b) ^ (c | c));
+  a = ((a | 13) | (q | 83)) | ((a & q) & (q * 10));
+  if(c < c){
+    c = ((c & 96) ^ (c - q)) + ((d + c) + (p + c));
+  }else{
+    c = ((q - d) & (b ^ d)) + ((q | b) | (p + d));
+  }
+  a = ((b * q) | (b | 81)) & ((c * c) & (a - b));
+  d = ((b + c) * (d - b)) - ((b - c) * (d | c));
+  c = ((b & a) | (d * d)) * ((c | 57) ^ (b * 94));
+  b = ((p & 14) - (d ^ b)) & ((c - b) | (a * b));
+  if(d < d){
+    c = ((p & p) ^ (p | 36)) - ((b - 90) & (q & b));
+  }else{
+    a = ((c | 80) ^ (a * a)) ^ ((c | 52) | (b & b));
+  }
+  a = ((c & q) - (p | d)) - ((q & a) * (p | 1));
+  for(i = 0; i < 25; i++){
+    d = ((q ^ q) ^ (p & 65)) + ((a + d) - (q ^ 40));
+  }
+  c = ((b & q) + (q | q)) ^ ((b - 97) & (q & q));
+  c = ((q * a) + (c + c)) ^ ((p + a) & (a & p));
+  if(a < d){
+    d = ((a | b) & (b + b)) | ((p + d) | (q | 45));
+  }else{
+    d = ((b ^ c) - (q - a)) - ((d & c) - (d | a));
+  }
+  d = ((d & a) + (d + 90)) + ((a * d) + (p - 91));
+  a = ((q * a) + (b ^ p)) * ((p + a) - (c * c));
+  d = ((b + b) & (c & c)) * ((a | c) | (c - q));
+  for(i = 0; i < 14; i++){
+    c = ((q & b) ^ (q + q)) | ((c | b) * (b - d));
+  }
+  if(a < b){
+    c = ((p + a) & (b ^ q)) * ((c * a) - (d ^ c));
+  }else{
+    c = ((b | 48) - (b | 95)) + ((c & c) + (q | b));
+  }
+  return a + b + c + d;
+}
+
+int func248(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 81;
+  d = 62;
+  b = ((a ^ c) + (p | a)) + ((d & d) | (q & q));
+  b = ((a ^ 83) + (b + 41)) - ((d ^ q) ^ (p | p));
+  c = ((b * q) ^ (c | d)) & ((a - 33) - (p | p));
+  a = ((c + 64) * (q | 24)) - ((d ^ 98) ^ (b ^ 64));
+  if(d < q){
+    c = ((b & a) - (c ^ q)) & ((b | c) & (c * c));
+  }else{
+    d = ((d | c) ^ (q ^ d)) & ((p - a) | (c | 93));
+  }
+  b = ((a ^ a) + (d + b)) ^ ((b + p) ^ (d * b));
+  for(i = 0; i < 34; i++){
+    d = ((q | 60) ^ (p * b)) - ((p - 95) & (p & p));
+  }
+  a = ((b | a) + (q ^ 63)) + ((b & 68) + (d - a));
+  d = ((q - 9) | (c | b)) | ((b | c) + (c + q));
+  if(d < p){
+    b = ((p ^ c) & (c & 8)) | ((p ^ b) - (c + d));
+  }else{
+    a = ((b | a) + (q + c)) & ((d & q) | (d * q));
+  }
+  b = ((c & 14) + (b + d)) ^ ((p & q) & (p - p));
+  a = ((q & c) | (p & a)) & ((d & 84) - (b - 26));
+  c = ((b * c) | (b + b)) & ((p | 8) | (d & c));
+  for(i = 0; i < 11; i++){
+    d = ((q | d) & (a ^ 90)) - ((q & 97) | (c ^ 26));
+  }
+  if(b < d){
+    c = ((b + 17) | (a + 67)) + ((b + b) & (d & 9));
+  }else{
+    d = ((c + p) + (b ^ a)) ^ ((p - a) * (c ^ 33));
+  }
+  a = ((a & b) + (q + d)) | ((p | d) & (p & d));
+  a = ((d & 64) | (c + p)) + ((p & c) & (p ^ a));
+  a = ((q ^ 31) | (p | c)) & ((d ^ q) - (p * d));
+  b = ((b | b) & (a * 40)) - ((d ^ q) - (a & 16));
+  if(a < a){
+    a = ((b - q) | (q + d)) | ((a & q) - (d + 26));
+  }else{
+    d = ((p * 41) | (b - d)) ^ ((q * c) & (q ^ 69));
+  }
+  for(i = 0; i < 39; i++){
+    b = ((d + p) | (b * 96)) & ((p + a) | (b & c));
+  }
+  d = ((q ^ 40) ^ (b * a)) - ((q & b) - (b * b));
+  d = ((d ^ b) & (b | d)) + ((c & p) - (d & c));
+  a = ((c & d) | (b ^ a)) + ((q - d) ^ (p + 4));
+  if(c < 42){
+    c = ((a & q) * (p + b)) & ((c + d) - (q * c));
+  }else{
+    b = ((d + p) * (a | c)) | ((d & c) - (a ^ p));
+  }
+  a = ((c & b) | (a + p)) & ((p * p) ^ (p & 31));
+  c = ((q * q) & (d ^ d)) * ((q ^ 61) * (d + a));
+  for(i = 0; i < 12; i++){
+    a = ((p - d) - (c ^ p)) & ((q & b) - (p - d));
+  }
+  d = ((p & d) + (a * b)) + ((a - a) - (a - c));
+  if(c < 84){
+    d = ((c * 46) + (d & q)) - ((c - d) * (d + p));
+  }else{
+    c = ((b + 3) | (a & d)) * ((c | a) - (b & 78));
+  }
+  a = ((p * 58) - (c & d)) * ((q * 87) ^ (p - b));
+  c = ((c & a) & (d + a)) + ((d | d) + (b & a));
+  c = ((p - c) - (b + a)) | ((c + 17) | (q & a));
+  d = ((d & c) + (c ^ c)) & ((a + 25) ^ (a + a));
+  if(d < 63){
+    c = ((a | c) | (a ^ 1)) & ((q + b) * (p & p));
+  }else{
+    b = ((c & q) + (p * c)) | ((p | c) - (p * p));
+  }
+  c = ((q * p) - (c ^ d)) | ((q + q) - (p & d));
+  b = ((b & 54) & (c * p)) | ((d - q) & (c & q));
+  b = ((c * a) * (c + q)) + ((b - 8) + (p ^ b));
+  d = ((a + q) ^ (q | b)) & ((p - q) - (q - c));
+  if(d < 64){
+    c = ((c & d) | (a * 18)) | ((b + c) * (d ^ b));
+  }else{
+    b = ((d - b) ^ (q ^ b)) * ((q * d) | (b + q));
+  }
+  d = ((d & 73) ^ (q | p)) + ((c ^ 38) - (q & p));
+  for(i = 0; i < 16; i++){
+    d = ((b * b) + (d + 35)) | ((c | b) * (c ^ 39));
+  }
+  c = ((d - c) * (b | b)) + ((p & p) | (a ^ 68));
+  c = ((q + c) - (c - c)) & ((b & p) + (q & d));
+  if(d < d){
+    a = ((a ^ b) | (p ^ d)) + ((a ^ 86) | (d * a));
+  }else{
+    d = ((a - d) * (b - q)) | ((d - c) ^ (a | p));
+  }
+  b = ((b + 44) * (d + q)) - ((a * b) | (c & 12));
+  a = ((c & c) + (a | c)) | ((b | q) ^ (d - 26));
+  a = ((c | b) & (p & a)) - ((p & c) - (a * c));
+  for(i = 0; i < 10; i++){
+    a = ((b * 94) | (c + p)) - ((b & d) + (b * b));
+  }
+  if(a < d){
+    a = ((q + 81) ^ (a ^ 58)) ^ ((p * c) + (p & 6));
+  }else{
+    a = ((p ^ d) ^ (a ^ c)) - ((q ^ b) & (b - d));
+  }
+  return a + b + c + d;
+}
+
+int func249(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 65;
+  d = 87;
+  d = ((a - d) | (c | d)) - ((b | c) | (c & 90));
+  b = ((p ^ 44) & (q + d)) - ((a & q) ^ (c - q));
+  d = ((d ^ p) ^ (c ^ p)) * ((p - b) & (p ^ p));
+  b = ((q - q) ^ (b * d)) + ((a & 85) * (c ^ q));
+  if(d < p){
+    b = ((p + 54) ^ (p ^ 73)) | ((a ^ 15) * (q & q));
+  }else{
+    b = ((b ^ a) * (c - c)) * ((q - 37) | (q | b));
+  }
+  a = ((q ^ c) * (p | 69)) - ((a * q) | (p + a));
+  for(i = 0; i < 16; i++){
+    b = ((c ^ c) | (d & q)) + ((d | d) + (a * 18));
+  }
+  d = ((p + p) - (q ^ q)) * ((d ^ 57) | (q - d));
+  b = ((c ^ d) & (q * b)) - ((c | q) - (p | p));
+  if(b < 83){
+    a = ((q + a) ^ (b | 66)) & ((b & d) | (b | c));
+  }else{
+    b = ((a * d) * (q ^ a)) | ((c * 67) | (d * b));
+  }
+  a = ((b & 91) | (b - a)) + ((q | p) & (d * b));
+  c = ((q & 44) & (b - q)) & ((b - d) & (c & 39));
+  c = ((d * d) * (q - d)) & ((a * b) | (d - q));
+  for(i = 0; i < 27; i++){
+    c = ((p - 38) + (p * b)) * ((p | b) ^ (q + 58));
+  }
+  if(a < b){
+    d = ((b * a) * (a ^ a)) | ((a ^ b) | (d | 74));
+  }else{
+    c = ((a & d) ^ (q * 3)) + ((d * p) & (q & 53));
+  }
+  a = ((p & q) ^ (b | d)) | ((d - b) | (d - 35));
+  b = ((a + c) | (a * d)) * ((d + b) ^ (c + a));
+  d = ((c + b) + (d ^ p)) * ((q ^ 30) | (p * d));
+  c = ((b ^ c) | (q + q)) | ((p + d) & (p ^ q));
+  if(b < 38){
+    a = ((d - p) & (d | p)) & ((b | 68) - (c - c));
+  }else{
+    d = ((d * 96) | (d * a)) + ((c * c) & (p | c));
+  }
+  for(i = 0; i < 37; i++){
+    c = ((a - d) & (c | d)) ^ ((p - 27) | (d & c));
+  }
+  d = ((q ^ b) ^ (p & 85)) | ((p & c) | (b + p));
+  c = ((p * q) ^ (d & p)) ^ ((b * a) & (a - p));
+  b = ((p | q) - (q * 10)) & ((q - 25) - (a + 45));
+  if(d < b){
+    c = ((c ^ 27) - (c + b)) ^ ((p & a) + (q ^ p));
+  }else{
+    d = ((p | b) + (d & 71)) ^ ((p - 73) - (b * d));
+  }
+  a = ((b - p) - (d & c)) * ((d * d) * (p + q));
+  d = ((a - a) + (p + p)) * ((a - 83) + (c + p));
+  for(i = 0; i < 31; i++){
+    d = ((p | 54) & (p + a)) | ((q & q) * (d & p));
+  }
+  b = ((d | d) | (c + 3)) + ((b ^ 41) - (q ^ d));
+  if(b < p){
+    a = ((d ^ q) * (b & 60)) & ((p & p) * (c - c));
+  }else{
+    b = ((c & q) * (d ^ 67)) + ((c & 25) ^ (q - c));
+  }
+  d = ((c - 17) - (d | 16)) - ((p | c) ^ (p ^ b));
+  a = ((p | 81) - (b & q)) - ((q + a) + (q ^ p));
+  a = ((q + 58) * (d & d)) * ((b & 58) + (d * b));
+  d = ((a ^ 78) ^ (p & a)) ^ ((a * q) & (p * b));
+  if(c < 43){
+    b = ((b * 50) + (c + c)) - ((a + 61) ^ (p & d));
+  }else{
+    b = ((q | 67) * (b + b)) + ((p | a) & (c | d));
+  }
+  c = ((b ^ a) & (d + 16)) & ((b + d) - (c + p));
+  d = ((a - 15) + (q - q)) - ((d & p) + (q | c));
+  a = ((p - 31) | (p & 5)) - ((c & 1) | (a & 90));
+  b = ((a ^ a) - (b - 76)) + ((d | q) & (b ^ p));
+  if(c < p){
+    d = ((d - a) + (q ^ c)) & ((d & q) + (d - a));
+  }else{
+    a = ((d + q) ^ (d ^ a)) & ((p & b) | (d ^ c));
+  }
+  b = ((d + d) | (a - q)) ^ ((d + a) ^ (c * a));
+  for(i = 0; i < 9; i++){
+    d = ((c * c) & (b + 59)) * ((c - b) ^ (d | b));
+  }
+  b = ((a ^ b) ^ (b | c)) | ((d * b) | (d | a));
+  b = ((q * 32) * (d | d)) & ((d ^ c) + (b ^ a));
+  if(b < p){
+    d = ((a - b) & (a * q)) * ((a | d) ^ (a & b));
+  }else{
+    b = ((b - p) + (p + c)) ^ ((a - b) + (b * b));
+  }
+  a = ((b - 24) - (a | d)) - ((q ^ p) & (p ^ a));
+  d = ((c + c) + (p | b)) ^ ((q + c) + (c + a));
+  c = ((d * 95) ^ (d | q)) + ((c + q) | (d & a));
+  for(i = 0; i < 20; i++){
+    d = ((q - c) + (a - 35)) ^ ((q & p) * (c - d));
+  }
+  if(b < 62){
+    c = ((a | a) * (d - b)) & ((a * p) * (d * b));
+  }else{
+    c = ((p ^ 20) + (a | c)) & ((p * 48) ^ (d - c));
+  }
+  return a + b + c + d;
+}
+
+global int main()
+{
+  int x;
+  x = 1;
+  x = func0(x, 91);
+  x = func1(x, 86);
+  x = func2(x, 88);
+  x = func3(x, 30);
+  x = func4(x, 36);
+  x = func5(x, 8);
+  x = func6(x, 98);
+  x = func7(x, 64);
+  x = func8(x, 73);
+  x = func9(x, 20);
+  x = func10(x, 77);
+  x = func11(x, 59);
+  x = func12(x, 47);
+  x = func13(x, 94);
+  x = func14(x, 77);
+  x = func15(x, 75);
+  x = func16(x, 99);
+  x = func17(x, 63);
+  x = func18(x, 74);
+  x = func19(x, 13);
+  x = func20(x, 12);
+  x = func21(x, 50);
+  x = func22(x, 70);
+  x = func23(x, 85);
+  x = func24(x, 42);
+  x = func25(x, 99);
+  x = func26(x, 5);
+  x = func27(x, 95);
+  x = func28(x, 94);
+  x = func29(x, 21);
+  x = func30(x, 69);
+  x = func31(x, 42);
+  x = func32(x, 45);
+  x = func33(x, 83);
+  x = func34(x, 11);
+  x = func35(x, 37);
+  x = func36(x, 68);
+  x = func37(x, 94);
+  x = func38(x, 18);
+  x = func39(x, 47);
+  x = func40(x, 28);
+  x = func41(x, 89);
+  x = func42(x, 11);
+  x = func43(x, 17);
+  x = func44(x, 14);
+  x = func45(x, 43);
+  x = func46(x, 98);
+  x = func47(x, 57);
+  x = func48(x, 14);
+  x = func49(x, 5);
+  x = func50(x, 63);
+  x = func51(x, 72);
+  x = func52(x, 81);
+  x = func53(x, 49);
+  x = func54(x, 52);
+  x = func55(x, 71);
+  x = func56(x, 79);
+  x = func57(x, 62);
+  x = func58(x, 15);
+  x = func59(x, 90);
+  x = func60(x, 33);
+  x = func61(x, 99);
+  x = func62(x, 64);
+  x = func63(x, 64);
+  x = func64(x, 82);
+  x = func65(x, 39);
+  x = func66(x, 15);
+  x = func67(x, 5);
+  x = func68(x, 20);
+  x = func69(x, 57);
+  x = func70(x, 89);
+  x = func71(x, 61);
+  x = func72(x, 70);
+  x = func73(x, 37);
+  x = func74(x, 87);
+  x = func75(x, 76);
+  x = func76(x, 27);
+  x = func77(x, 11);
+  x = func78(x, 21);
+  x = func79(x, 3);
+  x = func80(x, 66);
+  x = func81(x, 38);
+  x = func82(x, 34);
+  x = func83(x, 7);
+  x = func84(x, 9);
+  x = func85(x, 91);
+  x = func86(x, 62);
+  x = func87(x, 71);
+  x = func88(x, 96);
+  x = func89(x, 99);
+  x = func90(x, 67);
+  x = func91(x, 92);
+  x = func92(x, 8);
+  x = func93(x, 47);
+  x = func94(x, 85);
+  x = func95(x, 43);
+  x = func96(x, 88);
+  x = func97(x, 18);
+  x = func98(x, 11);
+  x = func99(x, 60);
+  x = func100(x, 52);
+  x = func101(x, 97);
+  x = func102(x, 87);
+  x = func103(x, 40);
+  x = func104(x, 81);
+  x = func105(x, 9);
+  x = func106(x, 11);
+  x = func107(x, 67);
+  x = func108(x, 27);
+  x = func109(x, 40);
+  x = func110(x, 97);
+  x = func111(x, 86);
+  x = func112(x, 22);
+  x = func113(x, 75);
+  x = func114(x, 95);
+  x = func115(x, 98);
+  x = func116(x, 89);
+  x = func117(x, 66);
+  x = func118(x, 64);
+  x = func119(x, 9);
+  x = func120(x, 42);
+  x = func121(x, 75);
+  x = func122(x, 3);
+  x = func123(x, 31);
+  x = func124(x, 35);
+  x = func125(x, 21);
+  x = func126(x, 41);
+  x = func127(x, 63);
+  x = func128(x, 28);
+  x = func129(x, 82);
+  x = func130(x, 17);
+  x = func131(x, 6);
+  x = func132(x, 52);
+  x = func133(x, 42);
+  x = func134(x, 21);
+  x = func135(x, 92);
+  x = func136(x, 76);
+  x = func137(x, 7);
+  x = func138(x, 80);
+  x = func139(x, 77);
+  x = func140(x, 15);
+  x = func141(x, 2);
+  x = func142(x, 63);
+  x = func143(x, 24);
+  x = func144(x, 57);
+  x = func145(x, 9);
+  x = func146(x, 45);
+  x = func147(x, 36);
+  x = func148(x, 60);
+  x = func149(x, 58);
+  x = func150(x, 22);
+  x = func151(x, 83);
+  x = func152(x, 16);
+  x = func153(x, 8);
+  x = func154(x, 46);
+  x = func155(x, 64);
+  x = func156(x, 38);
+  x = func157(x, 97);
+  x = func158(x, 33);
+  x = func159(x, 96);
+  x = func160(x, 86);
+  x = func161(x, 64);
+  x = func162(x, 62);
+  x = func163(x, 81);
+  x = func164(x, 22);
+  x = func165(x, 72);
+  x = func166(x, 32);
+  x = func167(x, 17);
+  x = func168(x, 4);
+  x = func169(x, 94);
+  x = func170(x, 94);
+  x = func171(x, 77);
+  x = func172(x, 54);
+  x = func173(x, 93);
+  x = func174(x, 41);
+  x = func175(x, 74);
+  x = func176(x, 48);
+  x = func177(x, 44);
+  x = func178(x, 60);
+  x = func179(x, 39);
+  x = func180(x, 74);
+  x = func181(x, 6);
+  x = func182(x, 46);
+  x = func183(x, 70);
+  x = func184(x, 10);
+  x = func185(x, 18);
+  x = func186(x, 21);
+  x = func187(x, 85);
+  x = func188(x, 96);
+  x = func189(x, 75);
+  x = func190(x, 47);
+  x = func191(x, 50);
+  x = func192(x, 61);
+  x = func193(x, 95);
+  x = func194(x, 54);
+  x = func195(x, 89);
+  x = func196(x, 84);
+  x = func197(x, 54);
+  x = func198(x, 31);
+  x = func199(x, 19);
+  x = func200(x, 93);
+  x = func201(x, 14);
+  x = func202(x, 35);
+  x = func203(x, 89);
+  x = func204(x, 33);
+  x = func205(x, 71);
+  x = func206(x, 99);
+  x = func207(x, 24);
+  x = func208(x, 91);
+  x = func209(x, 19);
+  x = func210(x, 97);
+  x = func211(x, 48);
+  x = func212(x, 96);
+  x = func213(x, 54);
+  x = func214(x, 90);
+  x = func215(x, 53);
+  x = func216(x, 99);
+  x = func217(x, 26);
+  x = func218(x, 24);
+  x = func219(x, 45);
+  x = func220(x, 16);
+  x = func221(x, 23);
+  x = func222(x, 34);
+  x = func223(x, 20);
+  x = func224(x, 72);
+  x = func225(x, 54);
+  x = func226(x, 78);
+  x = func227(x, 22);
+  x = func228(x, 30);
+  x = func229(x, 48);
+  x = func230(x, 39);
+  x = func231(x, 71);
+  x = func232(x, 72);
+  x = func233(x, 5);
+  x = func234(x, 63);
+  x = func235(x, 12);
+  x = func236(x, 53);
+  x = func237(x, 49);
+  x = func238(x, 65);
+  x = func239(x, 35);
+  x = func240(x, 17);
+  x = func241(x, 44);
+  x = func242(x, 52);
+  x = func243(x, 35);
+  x = func244(x, 33);
+  x = func245(x, 48);
+  x = func246(x, 18);
+  x = func247(x, 53);
+  x = func248(x, 32);
+  x = func249(x, 10);
+  rv0.x0 = x;
+  rv1.x1 = x;
+  rv2.x2 = x;
+  rv3.x3 = x;
+  rv4.x4 = x;
+  rv5.x5 = x;
+  rv6.x6 = x;
+  rv7.x7 = x;
+  rv8.x8 = x;
+  rv9.x9 = x;
+  rv10.x10 = x;
+  rv11.x11 = x;
+  rv12.x12 = x;
+  rv13.x13 = x;
+  rv14.x14 = x;
+  rv15.x15 = x;
+  rv16.x16 = x;
+  rv17.x17 = x;
+  rv18.x18 = x;
+  rv19.x19 = x;
+  rv20.x20 = x;
+  rv21.x21 = x;
+  rv22.x22 = x;
+  rv23.x23 = x;
+  rv24.x24 = x;
+  rv25.x25 = x;
+  rv26.x26 = x;
+  rv27.x27 = x;
+  rv28.x28 = x;
+  rv29.x29 = x;
+  rv30.x30 = x;
+  rv31.x31 = x;
+  gfloat = gfloat * 4.531 + 0.5;
+  gfloat = gfloat * 7.359 + 1.5;
+  gfloat = gfloat * 1.101 + 2.5;
+  gfloat = gfloat * 8.39 + 3.5;
+  gfloat = gfloat * 8.563 + 4.5;
+  gfloat = gfloat * 2.297 + 5.5;
+  gfloat = gfloat * 5.544 + 6.5;
+  gfloat = gfloat * 8.723 + 7.5;
+  gfloat = gfloat * 2.803 + 8.5;
+  gfloat = gfloat * 2.929 + 9.5;
+  gfloat = gfloat * 9.139 + 10.5;
+  gfloat = gfloat * 4.659 + 11.5;
+  gfloat = gfloat * 5.143 + 12.5;
+  gfloat = gfloat * 7.885 + 13.5;
+  gfloat = gfloat * 7.4 + 14.5;
+  gfloat = gfloat * 8.506 + 15.5;
+  gfloat = gfloat * 3.99 + 16.5;
+  gfloat = gfloat * 2.467 + 17.5;
+  gfloat = gfloat * 9.846 + 18.5;
+  gfloat = gfloat * 8.157 + 19.5;
+  gfloat = gfloat * 8.940 + 20.5;
+  gfloat = gfloat * 7.949 + 21.5;
+  gfloat = gfloat * 8.179 + 22.5;
+  gfloat = gfloat * 8.359 + 23.5;
+  gfloat = gfloat * 8.962 + 24.5;
+  gfloat = gfloat * 1.306 + 25.5;
+  gfloat = gfloat * 4.447 + 26.5;
+  gfloat = gfloat * 7.195 + 27.5;
+  gfloat = gfloat * 2.609 + 28.5;
+  gfloat = gfloat * 6.86 + 29.5;
+  gfloat = gfloat * 1.636 + 30.5;
+  gfloat = gfloat * 7.263 + 31.5;
+  gfloat = gfloat * 8.905 + 32.5;
+  gfloat = gfloat * 3.284 + 33.5;
+  gfloat = gfloat * 1.905 + 34.5;
+  gfloat = gfloat * 5.502 + 35.5;
+  gfloat = gfloat * 7.74 + 36.5;
+  gfloat = gfloat * 2.465 + 37.5;
+  gfloat = gfloat * 6.903 + 38.5;
+  gfloat = gfloat * 3.539 + 39.5;
+  gfloat = gfloat * 4.602 + 40.5;
+  gfloat = gfloat * 9.609 + 41.5;
+  gfloat = gfloat * 7.558 + 42.5;
+  gfloat = gfloat * 2.152 + 43.5;
+  gfloat = gfloat * 6.169 + 44.5;
+  gfloat = gfloat * 3.3 + 45.5;
+  gfloat = gfloat * 4.502 + 46.5;
+  gfloat = gfloat * 4.288 + 47.5;
+  gfloat = gfloat * 8.387 + 48.5;
+  gfloat = gfloat * 6.251 + 49.5;
+  gfloat = gfloat * 3.505 + 50.5;
+  gfloat = gfloat * 6.4 + 51.5;
+  gfloat = gfloat * 9.85 + 52.5;
+  gfloat = gfloat * 6.937 + 53.5;
+  gfloat = gfloat * 3.182 + 54.5;
+  gfloat = gfloat * 5.790 + 55.5;
+  gfloat = gfloat * 4.312 + 56.5;
+  gfloat = gfloat * 4.764 + 57.5;
+  gfloat = gfloat * 3.231 + 58.5;
+  gfloat = gfloat * 1.612 + 59.5;
+  gfloat = gfloat * 2.945 + 60.5;
+  gfloat = gfloat * 8.330 + 61.5;
+  gfloat = gfloat * 8.474 + 62.5;
+  gfloat = gfloat * 7.814 + 63.5;
+  gfloat = gfloat * 4.355 + 64.5;
+  gfloat = gfloat * 3.96 + 65.5;
+  gfloat = gfloat * 9.34 + 66.5;
+  gfloat = gfloat * 1.204 + 67.5;
+  gfloat = gfloat * 4.652 + 68.5;
+  gfloat = gfloat * 9.431 + 69.5;
+  gfloat = gfloat * 3.726 + 70.5;
+  gfloat = gfloat * 8.210 + 71.5;
+  gfloat = gfloat * 7.53 + 72.5;
+  gfloat = gfloat * 6.223 + 73.5;
+  gfloat = gfloat * 7.165 + 74.5;
+  gfloat = gfloat * 8.164 + 75.5;
+  gfloat = gfloat * 8.469 + 76.5;
+  gfloat = gfloat * 8.557 + 77.5;
+  gfloat = gfloat * 2.696 + 78.5;
+  gfloat = gfloat * 9.358 + 79.5;
+  gfloat = gfloat * 1.784 + 80.5;
+  gfloat = gfloat * 9.527 + 81.5;
+  gfloat = gfloat * 8.790 + 82.5;
+  gfloat = gfloat * 3.906 + 83.5;
+  gfloat = gfloat * 5.633 + 84.5;
+  gfloat = gfloat * 7.503 + 85.5;
+  gfloat = gfloat * 1.503 + 86.5;
+  gfloat = gfloat * 9.341 + 87.5;
+  gfloat = gfloat * 4.963 + 88.5;
+  gfloat = gfloat * 8.810 + 89.5;
+  gfloat = gfloat * 5.459 + 90.5;
+  gfloat = gfloat * 3.494 + 91.5;
+  gfloat = gfloat * 2.362 + 92.5;
+  gfloat = gfloat * 1.374 + 93.5;
+  gfloat = gfloat * 7.218 + 94.5;
+  gfloat = gfloat * 3.220 + 95.5;
+  gfloat = gfloat * 6.733 + 96.5;
+  gfloat = gfloat * 3.745 + 97.5;
+  gfloat = gfloat * 4.583 + 98.5;
+  gfloat = gfloat * 4.473 + 99.5;
+  gfloat = gfloat * 6.863 + 100.5;
+  gfloat = gfloat * 2.977 + 101.5;
+  gfloat = gfloat * 5.930 + 102.5;
+  gfloat = gfloat * 6.478 + 103.5;
+  gfloat = gfloat * 1.249 + 104.5;
+  gfloat = gfloat * 3.150 + 105.5;
+  gfloat = gfloat * 9.325 + 106.5;
+  gfloat = gfloat * 4.605 + 107.5;
+  gfloat = gfloat * 7.52 + 108.5;
+  gfloat = gfloat * 2.837 + 109.5;
+  gfloat = gfloat * 7.184 + 110.5;
+  gfloat = gfloat * 6.411 + 111.5;
+  gfloat = gfloat * 9.34 + 112.5;
+  gfloat = gfloat * 3.310 + 113.5;
+  gfloat = gfloat * 4.225 + 114.5;
+  gfloat = gfloat * 9.429 + 115.5;
+  gfloat = gfloat * 3.163 + 116.5;
+  gfloat = gfloat * 9.658 + 117.5;
+  gfloat = gfloat * 3.911 + 118.5;
+  gfloat = gfloat * 4.405 + 119.5;
+  gfloat = gfloat * 4.355 + 120.5;
+  gfloat = gfloat * 4.995 + 121.5;
+  gfloat = gfloat * 4.825 + 122.5;
+  gfloat = gfloat * 9.739 + 123.5;
+  gfloat = gfloat * 1.496 + 124.5;
+  gfloat = gfloat * 6.683 + 125.5;
+  gfloat = gfloat * 6.706 + 126.5;
+  gfloat = gfloat * 2.706 + 127.5;
+  gfloat = gfloat * 9.962 + 128.5;
+  gfloat = gfloat * 5.543 + 129.5;
+  gfloat = gfloat * 2.722 + 130.5;
+  gfloat = gfloat * 6.426 + 131.5;
+  gfloat = gfloat * 3.336 + 132.5;
+  gfloat = gfloat * 2.173 + 133.5;
+  gfloat = gfloat * 2.55 + 134.5;
+  gfloat = gfloat * 7.803 + 135.5;
+  gfloat = gfloat * 9.36 + 136.5;
+  gfloat = gfloat * 5.751 + 137.5;
+  gfloat = gfloat * 3.830 + 138.5;
+  gfloat = gfloat * 8.676 + 139.5;
+  gfloat = gfloat * 6.638 + 140.5;
+  gfloat = gfloat * 5.513 + 141.5;
+  gfloat = gfloat * 9.538 + 142.5;
+  gfloat = gfloat * 7.241 + 143.5;
+  gfloat = gfloat * 9.351 + 144.5;
+  gfloat = gfloat * 9.107 + 145.5;
+  gfloat = gfloat * 5.255 + 146.5;
+  gfloat = gfloat * 6.123 + 147.5;
+  gfloat = gfloat * 9.951 + 148.5;
+  gfloat = gfloat * 4.425 + 149.5;
+  gfloat = gfloat * 4.564 + 150.5;
+  gfloat = gfloat * 1.924 + 151.5;
+  gfloat = gfloat * 8.719 + 152.5;
+  gfloat = gfloat * 8.352 + 153.5;
+  gfloat = gfloat * 5.369 + 154.5;
+  gfloat = gfloat * 9.151 + 155.5;
+  gfloat = gfloat * 3.21 + 156.5;
+  gfloat = gfloat * 7.760 + 157.5;
+  gfloat = gfloat * 8.254 + 158.5;
+  gfloat = gfloat * 5.973 + 159.5;
+  gfloat = gfloat * 8.563 + 160.5;
+  gfloat = gfloat * 8.490 + 161.5;
+  gfloat = gfloat * 8.261 + 162.5;
+  gfloat = gfloat * 1.18 + 163.5;
+  gfloat = gfloat * 3.97 + 164.5;
+  gfloat = gfloat * 1.334 + 165.5;
+  gfloat = gfloat * 7.742 + 166.5;
+  gfloat = gfloat * 5.183 + 167.5;
+  gfloat = gfloat * 3.330 + 168.5;
+  gfloat = gfloat * 2.557 + 169.5;
+  gfloat = gfloat * 7.503 + 170.5;
+  gfloat = gfloat * 7.638 + 171.5;
+  gfloat = gfloat * 7.220 + 172.5;
+  gfloat = gfloat * 9.890 + 173.5;
+  gfloat = gfloat * 8.494 + 174.5;
+  gfloat = gfloat * 5.301 + 175.5;
+  gfloat = gfloat * 5.947 + 176.5;
+  gfloat = gfloat * 3.607 + 177.5;
+  gfloat = gfloat * 8.236 + 178.5;
+  gfloat = gfloat * 9.895 + 179.5;
+  gfloat = gfloat * 1.799 + 180.5;
+  gfloat = gfloat * 8.798 + 181.5;
+  gfloat = gfloat * 4.509 + 182.5;
+  gfloat = gfloat * 6.89 + 183.5;
+  gfloat = gfloat * 7.255 + 184.5;
+  gfloat = gfloat * 8.847 + 185.5;
+  gfloat = gfloat * 1.217 + 186.5;
+  gfloat = gfloat * 8.19 + 187.5;
+  gfloat = gfloat * 5.631 + 188.5;
+  gfloat = gfloat * 5.730 + 189.5;
+  gfloat = gfloat * 6.747 + 190.5;
+  gfloat = gfloat * 3.507 + 191.5;
+  gfloat = gfloat * 7.867 + 192.5;
+  gfloat = gfloat * 6.57 + 193.5;
+  gfloat = gfloat * 1.793 + 194.5;
+  gfloat = gfloat * 5.37 + 195.5;
+  gfloat = gfloat * 9.239 + 196.5;
+  gfloat = gfloat * 4.66 + 197.5;
+  gfloat = gfloat * 8.745 + 198.5;
+  gfloat = gfloat * 9.501 + 199.5;
+  printf("string 0 value = %d\n", x);
+  printf("string 1 value = %d\n", x);
+  printf("string 2 value = %d\n", x);
+  printf("string 3 value = %d\n", x);
+  printf("string 4 value = %d\n", x);
+  printf("string 5 value = %d\n", x);
+  printf("string 6 value = %d\n", x);
+  printf("string 7 value = %d\n", x);
+  printf("string 8 value = %d\n", x);
+  printf("string 9 value = %d\n", x);
+  printf("string 10 value = %d\n", x);
+  printf("string 11 value = %d\n", x);
+  printf("string 12 value = %d\n", x);
+  printf("string 13 value = %d\n", x);
+  printf("string 14 value = %d\n", x);
+  printf("string 15 value = %d\n", x);
+  printf("string 16 value = %d\n", x);
+  printf("string 17 value = %d\n", x);
+  printf("string 18 value = %d\n", x);
+  printf("string 19 value = %d\n", x);
+  printf("string 20 value = %d\n", x);
+  printf("string 21 value = %d\n", x);
+  printf("string 22 value = %d\n", x);
+  printf("string 23 value = %d\n", x);
+  printf("string 24 value = %d\n", x);
+  printf("string 25 value = %d\n", x);
+  printf("string 26 value = %d\n", x);
+  printf("string 27 value = %d\n", x);
+  printf("string 28 value = %d\n", x);
+  printf("string 29 value = %d\n", x);
+  printf("string 30 value = %d\n", x);
+  printf("string 31 value = %d\n", x);
+  printf("string 32 value = %d\n", x);
+  printf("string 33 value = %d\n", x);
+  printf("string 34 value = %d\n", x);
+  printf("string 35 value = %d\n", x);
+  printf("string 36 value = %d\n", x);
+  printf("string 37 value = %d\n", x);
+  printf("string 38 value = %d\n", x);
+  printf("string 39 value = %d\n", x);
+  printf("string 40 value = %d\n", x);
+  printf("string 41 value = %d\n", x);
+  printf("string 42 value = %d\n", x);
+  printf("string 43 value = %d\n", x);
+  printf("string 44 value = %d\n", x);
+  printf("string 45 value = %d\n", x);
+  printf("string 46 value = %d\n", x);
+  printf("string 47 value = %d\n", x);
+  printf("string 48 value = %d\n", x);
+  printf("string 49 value = %d\n", x);
+  printf("string 50 value = %d\n", x);
+  printf("string 51 value = %d\n", x);
+  printf("string 52 value = %d\n", x);
+  printf("string 53 value = %d\n", x);
+  printf("string 54 value = %d\n", x);
+  printf("string 55 value = %d\n", x);
+  printf("string 56 value = %d\n", x);
+  printf("string 57 value = %d\n", x);
+  printf("string 58 value = %d\n", x);
+  printf("string 59 value = %d\n", x);
+  printf("string 60 value = %d\n", x);
+  printf("string 61 value = %d\n", x);
+  printf("string 62 value = %d\n", x);
+  printf("string 63 value = %d\n", x);
+  printf("string 64 value = %d\n", x);
+  printf("string 65 value = %d\n", x);
+  printf("string 66 value = %d\n", x);
+  printf("string 67 value = %d\n", x);
+  printf("string 68 value = %d\n", x);
+  printf("string 69 value = %d\n", x);
+  printf("string 70 value = %d\n", x);
+  printf("string 71 value = %d\n", x);
+  printf("string 72 value = %d\n", x);
+  printf("string 73 value = %d\n", x);
+  printf("string 74 value = %d\n", x);
+  printf("string 75 value = %d\n", x);
+  printf("string 76 value = %d\n", x);
+  printf("string 77 value = %d\n", x);
+  printf("string 78 value = %d\n", x);
+  printf("string 79 value = %d\n", x);
+  printf("string 80 value = %d\n", x);
+  printf("string 81 value = %d\n", x);
+  printf("string 82 value = %d\n", x);
+  printf("string 83 value = %d\n", x);
+  printf("string 84 value = %d\n", x);
+  printf("string 85 value = %d\n", x);
+  printf("string 86 value = %d\n", x);
+  printf("string 87 value = %d\n", x);
+  printf("string 88 value = %d\n", x);
+  printf("string 89 value = %d\n", x);
+  printf("string 90 value = %d\n", x);
+  printf("string 91 value = %d\n", x);
+  printf("string 92 value = %d\n", x);
+  printf("string 93 value = %d\n", x);
+  printf("string 94 value = %d\n", x);
+  printf("string 95 value = %d\n", x);
+  printf("string 96 value = %d\n", x);
+  printf("string 97 value = %d\n", x);
+  printf("string 98 value = %d\n", x);
+  printf("string 99 value = %d\n", x);
+  printf("string 100 value = %d\n", x);
+  printf("string 101 value = %d\n", x);
+  printf("string 102 value = %d\n", x);
+  printf("string 103 value = %d\n", x);
+  printf("string 104 value = %d\n", x);
+  printf("string 105 value = %d\n", x);
+  printf("string 106 value = %d\n", x);
+  printf("string 107 value = %d\n", x);
+  printf("string 108 value = %d\n", x);
+  printf("string 109 value = %d\n", x);
+  printf("string 110 value = %d\n", x);
+  printf("string 111 value = %d\n", x);
+  printf("string 112 value = %d\n", x);
+  printf("string 113 value = %d\n", x);
+  printf("string 114 value = %d\n", x);
+  printf("string 115 value = %d\n", x);
+  printf("string 116 value = %d\n", x);
+  printf("string 117 value = %d\n", x);
+  printf("string 118 value = %d\n", x);
+  printf("string 119 value = %d\n", x);
+  printf("string 120 value = %d\n", x);
+  printf("string 121 value = %d\n", x);
+  printf("string 122 value = %d\n", x);
+  printf("string 123 value = %d\n", x);
+  printf("string 124 value = %d\n", x);
+  printf("string 125 value = %d\n", x);
+  printf("string 126 value = %d\n", x);
+  printf("string 127 value = %d\n", x);
+  printf("string 128 value = %d\n", x);
+  printf("string 129 value = %d\n", x);
+  printf("string 130 value = %d\n", x);
+  printf("string 131 value = %d\n", x);
+  printf("string 132 value = %d\n", x);
+  printf("string 133 value = %d\n", x);
+  printf("string 134 value = %d\n", x);
+  printf("string 135 value = %d\n", x);
+  printf("string 136 value = %d\n", x);
+  printf("string 137 value = %d\n", x);
+  printf("string 138 value = %d\n", x);
+  printf("string 139 value = %d\n", x);
+  printf("string 140 value = %d\n", x);
+  printf("string 141 value = %d\n", x);
+  printf("string 142 value = %d\n", x);
+  printf("string 143 value = %d\n", x);
+  printf("string 144 value = %d\n", x);
+  printf("string 145 value = %d\n", x);
+  printf("string 146 value = %d\n", x);
+  printf("string 147 value = %d\n", x);
+  printf("string 148 value = %d\n", x);
+  printf("string 149 value = %d\n", x);
+  printf("string 150 value = %d\n", x);
+  printf("string 151 value = %d\n", x);
+  printf("string 152 value = %d\n", x);
+  printf("string 153 value = %d\n", x);
+  printf("string 154 value = %d\n", x);
+  printf("string 155 value = %d\n", x);
+  printf("string 156 value = %d\n", x);
+  printf("string 157 value = %d\n", x);
+  printf("string 158 value = %d\n", x);
+  printf("string 159 value = %d\n", x);
+  printf("string 160 value = %d\n", x);
+  printf("string 161 value = %d\n", x);
+  printf("string 162 value = %d\n", x);
+  printf("string 163 value = %d\n", x);
+  printf("string 164 value = %d\n", x);
+  printf("string 165 value = %d\n", x);
+  printf("string 166 value = %d\n", x);
+  printf("string 167 value = %d\n", x);
+  printf("string 168 value = %d\n", x);
+  printf("string 169 value = %d\n", x);
+  printf("string 170 value = %d\n", x);
+  printf("string 171 value = %d\n", x);
+  printf("string 172 value = %d\n", x);
+  printf("string 173 value = %d\n", x);
+  printf("string 174 value = %d\n", x);
+  printf("string 175 value = %d\n", x);
+  printf("string 176 value = %d\n", x);
+  printf("string 177 value = %d\n", x);
+  printf("string 178 value = %d\n", x);
+  printf("string 179 value = %d\n", x);
+  printf("string 180 value = %d\n", x);
+  printf("string 181 value = %d\n", x);
+  printf("string 182 value = %d\n", x);
+  printf("string 183 value = %d\n", x);
+  printf("string 184 value = %d\n", x);
+  printf("string 185 value = %d\n", x);
+  printf("string 186 value = %d\n", x);
+  printf("string 187 value = %d\n", x);
+  printf("string 188 value = %d\n", x);
+  printf("string 189 value = %d\n", x);
+  printf("string 190 value = %d\n", x);
+  printf("string 191 value = %d\n", x);
+  printf("string 192 value = %d\n", x);
+  printf("string 193 value = %d\n", x);
+  printf("string 194 value = %d\n", x);
+  printf("string 195 value = %d\n", x);
+  printf("string 196 value = %d\n", x);
+  printf("string 197 value = %d\n", x);
+  printf("string 198 value = %d\n", x);
+  printf("string 199 value = %d\n", x);
+  return 0;
+}
@@ -0,0 +1,9354 @@
+extern void printf(char*, int);
+
+record rec0{
+  int x0;
+  char ch0;
+  float f0;
+  double d0;
+}
+
+rec0 rv0;
+
+record rec1{
+  int x1;
+  char ch1;
+  float f1;
+  double d1;
+}
+
+rec1 rv1;
+
+record rec2{
+  int x2;
+  char ch2;
+  float f2;
+  double d2;
+}
+
+rec2 rv2;
+
+record rec3{
+  int x3;
+  char ch3;
+  float f3;
+  double d3;
+}
+
+rec3 rv3;
+
+record rec4{
+  int x4;
+  char ch4;
+  float f4;
+  double d4;
+}
+
+rec4 rv4;
+
+record rec5{
+  int x5;
+  char ch5;
+  float f5;
+  double d5;
+}
+
+rec5 rv5;
+
+record rec6{
+  int x6;
+  char ch6;
+  float f6;
+  double d6;
+}
+
+rec6 rv6;
+
+record rec7{
+  int x7;
+  char ch7;
+  float f7;
+  double d7;
+}
+
+rec7 rv7;
+
+record rec8{
+  int x8;
+  char ch8;
+  float f8;
+  double d8;
+}
+
+rec8 rv8;
+
+record rec9{
+  int x9;
+  char ch9;
+  float f9;
+  double d9;
+}
+
+rec9 rv9;
+
+record rec10{
+  int x10;
+  char ch10;
+  float f10;
+  double d10;
+}
+
+rec10 rv10;
+
+record rec11{
+  int x11;
+  char ch11;
+  float f11;
+  double d11;
+}
+
+rec11 rv11;
+
+record rec12{
+  int x12;
+  char ch12;
+  float f12;
+  double d12;
+}
+
+rec12 rv12;
+
+record rec13{
+  int x13;
+  char ch13;
+  float f13;
+  double d13;
+}
+
+rec13 rv13;
+
+record rec14{
+  int x14;
+  char ch14;
+  float f14;
+  double d14;
+}
+
+rec14 rv14;
+
+record rec15{
+  int x15;
+  char ch15;
+  float f15;
+  double d15;
+}
+
+rec15 rv15;
+
+int garray[1000] = {4170,9971,7203,9325,1,1281,3023,9990,1467,2360,923,3965,1862,3879,3455,
+  6697,3967,9355,5388,8463,4191,3132,6852,5245,2044,4434,8781,2295,273,5344,6704,
+  9139,4173,4572,5586,4306,1403,9391,1981,7783,8007,7159,9682,8027,3134,928,6923,
+  5181,8763,8650,8946,8291,850,8296,390,2730,1698,592,8781,6705,983,5930,4211,
+  6716,9578,4117,5331,1975,6918,2896,3155,1421,6865,7833,8346,4125,182,341,7501,
+  6240,9888,6606,7481,2984,2804,4461,7892,2221,1032,733,4478,4692,9085,961,2936,
+  9033,2877,1194,1300,5247,193,836,6788,9168,2116,9104,2655,2989,4915,5843,533,
+  5659,5741,6139,1467,9565,5893,2609,6997,2310,1023,5334,4140,9499,6944,4930,4141,
+  5406,499,7654,5358,453,6637,1399,5148,7924,9445,298,5865,8831,9034,5407,1374,
+  4479,1392,8921,8073,3775,3976,5384,1653,6522,9275,3612,3477,5710,7508,6378,7259,
+  1263,8833,6902,6236,6477,7509,3539,3488,7632,2699,3565,8958,7527,4280,8813,9648,
+  116,6634,4981,6216,737,1147,7869,9494,640,4499,3553,5783,9418,4081,3798,2370,
+  7629,9033,7715,5736,3013,28,7727,6171,1529,3266,5786,5270,90,8859,7090,3572,
+  4706,9085,7645,6233,4673,158,2690,9294,8316,6908,5513,9973,700,1723,4724,1371,
+  7427,9325,1919,6968,4643,660,2303,7554,5082,7538,2085,9230,493,7115,5188,1242,
+  1722,198,3963,262,1073,283,5098,2462,1021,8600,2887,5388,2317,5528,9676,8420,
+  2783,1241,2336,2791,915,5857,5700,9695,4179,5610,3678,186,8129,8006,2897,2329,
+  7173,8071,6129,3878,4269,8635,7518,7471,4278,5562,4283,1364,3619,599,1533,1213,
+  9371,445,9164,1074,7819,2257,6163,7129,359,5597,6543,125,1297,719,2943,9672,
+  3608,5681,2746,2032,739,2523,1521,7438,1616,1954,9387,5813,3711,9700,500,8468,
+  7409,2398,2986,4937,2043,6199,9817,8289,8930,1567,7593,185,6511,700,396,4863,
+  8138,6063,7625,5688,4552,3173,5318,9886,1093,5797,1460,3801,5087,5509,2156,7453,
+  9164,6692,4621,2649,1322,663,7642,3700,2127,6297,742,2101,954,7527,1622,665,
+  3564,2603,953,8047,1432,1934,9310,6394,5765,5246,8396,9248,6232,2632,3245,659,
+  7280,7350,5227,7721,7368,9078,1654,9319,6870,139,4268,2343,7285,6167,7563,9490,
+  3976,9501,9252,5566,2035,9156,80,6415,9263,3900,2945,4859,1669,6043,241,5495,
+  4520,9261,8083,9187,3683,3948,6092,9632,348,1739,3545,1263,785,1350,6931,5056,
+  127,215,4595,9479,9613,8271,3341,150,4720,1761,1053,3320,5030,1309,8856,8094,
+  5343,3447,2814,9401,3545,5820,8962,8788,2414,8447,238,9053,9657,4598,4299,5463,
+  3462,7986,5770,2857,1265,4902,9500,5991,3136,155,9528,5934,2183,4336,2487,8073,
+  8638,3152,2352,8928,8151,5778,5438,1840,1912,7879,5888,6120,481,539,158,4201,
+  497,6790,3994,9186,5769,4,8675,9767,7861,3765,2547,9737,822,6047,1577,8288,
+  2094,5747,4173,6280,3476,2855,6998,5868,6975,7500,747,8583,364,7550,7893,6980,
+  9005,8644,46,3226,2642,6707,4673,4508,3598,3821,2402,4108,231,4014,5316,3173,
+  1301,6219,5614,4302,1678,9738,4210,6778,6846,1985,2739,4267,99,3433,2198,7976,
+  319,8799,9348,9038,7820,6627,5175,2702,164,2523,2988,8548,5407,5277,8598,8021,
+  1851,5724,835,7331,442,5190,4438,7708,193,5688,670,4657,8117,3426,6362,682,
+  7728,3779,7056,796,2382,9828,444,1816,2812,8118,8650,8749,731,6884,6603,5694,
+  1873,1609,5222,4668,9038,3451,4751,2250,8470,5925,8387,3122,1392,9163,5403,9096,
+  4670,2571,2186,1108,4408,1929,4802,4995,3332,7285,89,2081,5054,2480,6731,8516,
+  554,4158,1575,6166,6051,2336,3192,1019,8905,5158,7903,4771,2174,1526,2002,6218,
+  6804,5440,1562,6541,5103,1445,9880,7515,1446,2220,483,5193,8990,7852,7153,223,
+  3103,3243,3929,8729,807,8447,3521,5384,10,8666,6246,9498,2002,8264,6251,8541,
+  3214,987,473,6513,7233,7035,7592,6102,4063,7996,7043,345,5853,7702,9695,7317,
+  3038,2596,3137,2570,2264,6323,6723,3452,7789,7965,5126,4461,6152,7827,456,9904,
+  4460,3002,9680,1430,3595,9013,5540,5415,4113,9747,9660,6366,2030,9939,9928,5460,
+  6591,5264,8090,1354,4581,3557,8873,262,5339,1603,5772,7456,9174,303,3141,3665,
+  7261,8623,8052,6926,4800,6909,4875,1886,8414,4419,5555,5815,2698,9897,4867,2039,
+  2758,2477,2253,2621,6467,7501,9211,4569,2004,569,8798,5085,4658,2119,7249,7986,
+  3028,2973,4890,276,2036,5934,886,8438,1656,3810,5029,7498,7875,5111,9036,5409,
+  2195,9594,7381,8039,2578,323,5642,7093,1324,4650,3720,9475,828,2214,5057,2670,
+  6944,814,4569,4286,3612,1090,8160,6337,458,8029,3878,6968,4585,7662,7357,3424,
+  9096,8458,2774,4287,8177,8240,6563,6264,112,1434,7353,783,6034,183,6800,667,
+  5839,4585,5735,1133,3610,277,9586,7548,9869,3948,3871,7469,8361,4524,9821,4500,
+  5853,4780,6709,4740,862,8031,9914,4023,7795,9046,9943,370,6536,7738,374,1256,
+  7190,6185,6881,103,6088,5386,1062,30,2806,9511,7762,9054,8901,7959,5105,9152,
+  7157,1455,777,1577,6153,1876,8378,6224,6960,9058,5550,9899,8611,7111,7453,7318,
+  2645,9092,9997,4008,5737,2498,6390,1734,4896,1194,8893,8126,8745,1467,8477,2642,
+  6477,8190,5855,3105,2815,9824,9916,2666,7996,5336,5016,3144,7723,9107,1242,3665,
+  9210,4335,448,5122,2286,9388,8424,309,3055,7168,4843,8910,6500,272,1439,5220,
+  3057,3259,8869,8594,8868,5585,5152,6902,2670,4528,8803,6283,4979,2900,3334,93,
+  8946,5767,2044,3114,8196,5172,8388,9164,5227,4264,1619,2473,9489,3712,594,9318,
+  8864,9368,5743,8443,3788,9202,6409,2279,1278};
+
+float gfloat;
+
+int func0(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 9;
+  d = 41;
+  a = ((c - 18) ^ (d + q)) | ((b - p) + (b ^ c));
+  b = ((c + b) + (d + p)) & ((b - d) ^ (q + c));
+  c = ((a ^ q) | (d & 71)) + ((b + 45) ^ (c - d));
+  a = ((q ^ p) - (p + d)) | ((a * a) ^ (c | b));
+  if(c < c){
+    b = ((c & 32) + (a | b)) ^ ((q + 46) * (d & 75));
+  }else{
+    b = ((c ^ 14) - (a & p)) ^ ((p * 40) + (q & p));
+  }
+  b = ((a ^ p) | (p * q)) + ((d | 11) * (c ^ p));
+  for(i = 0; i < 32; i++){
+    c = ((c | d) - (b * p)) | ((d * 85) + (b - b));
+  }
+  b = ((d | c) & (p * a)) - ((q | b) ^ (p + a));
+  a = ((b - b) - (a * p)) + ((b + p) & (p | 17));
+  if(a < b){
+    c = ((q & d) & (a - q)) * ((c & a) | (a * 13));
+  }else{
+    b = ((q | 41) - (q * c)) * ((a - c) - (a & p));
+  }
+  d = ((b ^ p) | (q & d)) ^ ((b + c) ^ (a * p));
+  b = ((a | p) - (c * 30)) - ((a + q) * (p & c));
+  c = ((a - 72) + (q & b)) & ((c ^ 89) | (d + q));
+  for(i = 0; i < 40; i++){
+    a = ((q & a) ^ (p + 53)) & ((d | a) - (d * 55));
+  }
+  if(d < p){
+    d = ((b - q) + (q ^ d)) | ((c & b) | (p ^ b));
+  }else{
+    b = ((a + b) ^ (b | d)) & ((p + p) * (c | 75));
+  }
+  c = ((d & b) | (a + p)) * ((q | 53) + (a - b));
+  d = ((q - b) - (b + 29)) & ((d ^ a) * (c * 82));
+  c = ((c & c) | (b - c)) ^ ((b * p) ^ (d * p));
+  b = ((c + q) + (a * 91)) + ((d ^ q) & (q * q));
+  if(b < 67){
+    c = ((p ^ d) + (b + p)) - ((q | d) ^ (q ^ p));
+  }else{
+    d = ((b + q) & (a + c)) ^ ((q + 82) + (q * d));
+  }
+  for(i = 0; i < 14; i++){
+    d = ((p & d) + (q ^ q)) - ((c - d) * (d | 40));
+  }
+  b = ((d & 89) ^ (q - 11)) & ((a + 71) | (a & 79));
+  a = ((d - q) | (a | c)) + ((d & 15) - (b - c));
+  d = ((b ^ d) ^ (a - 98)) * ((d & b) ^ (b & b));
+  if(b < p){
+    b = ((a * b) + (p + b)) | ((d - 54) ^ (c + b));
+  }else{
+    d = ((p - d) - (q & d)) ^ ((c - d) ^ (p * 5));
+  }
+  a = ((b * q) - (c & p)) - ((q * a) & (p - c));
+  c = ((p - 69) * (b & d)) * ((a * a) - (d + c));
+  for(i = 0; i < 32; i++){
+    c = ((d + 56) + (p & 87)) | ((b ^ q) * (c * a));
+  }
+  c = ((c | q) ^ (d | c)) * ((d + 71) & (d - 86));
+  if(d < p){
+    c = ((p + 47) + (q ^ d)) & ((a + d) & (d & q));
+  }else{
+    b = ((d & 85) - (p * c)) ^ ((b + q) + (a + 94));
+  }
+  b = ((p + 62) & (a ^ d)) + ((d | 67) + (c + 1));
+  c = ((q * 79) | (c & c)) + ((a & 35) + (b + q));
+  b = ((a * q) * (c | d)) & ((q ^ c) - (b * d));
+  a = ((q ^ 56) + (c ^ q)) + ((p & a) | (d + 26));
+  if(c < q){
+    a = ((q & p) | (c | 49)) * ((d - 37) * (p + p));
+  }else{
+    a = ((c * d) ^ (p & c)) + ((b - 75) * (q + b));
+  }
+  b = ((d * c) + (b | 50)) + ((p | 97) + (p * 79));
+  d = ((b - c) - (d - a)) * ((c - q) & (b + a));
+  b = ((a * 42) & (p * b)) & ((d - b) ^ (q | q));
+  c = ((a | 73) * (b * q)) * ((c | c) ^ (b * 87));
+  if(a < b){
+    b = ((c - d) - (b * q)) + ((q + 87) + (b - c));
+  }else{
+    c = ((a & a) * (q + p)) | ((c - d) | (c & b));
+  }
+  return a + b + c + d;
+}
+
+int func1(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 75;
+  b = ((c | b) ^ (p + c)) ^ ((a | p) + (c & 66));
+  a = ((q - a) & (p ^ b)) * ((d | 54) * (a | 5));
+  a = ((d * a) | (d * p)) & ((a * q) ^ (c ^ 43));
+  d = ((b & p) - (q + 44)) - ((d + 42) * (q - 51));
+  if(b < a){
+    d = ((p & b) + (c * b)) * ((q ^ q) & (q ^ c));
+  }else{
+    a = ((q * q) - (p ^ p)) - ((a & p) | (d & p));
+  }
+  a = ((b * b) | (p + a)) | ((q & p) & (q - b));
+  for(i = 0; i < 48; i++){
+    d = ((b * a) & (q + 30)) | ((d ^ c) + (d * a));
+  }
+  c = ((d ^ 28) | (q * b)) + ((d - d) | (b ^ 38));
+  a = ((c ^ d) ^ (q - d)) & ((c & d) & (a - p));
+  if(d < d){
+    b = ((b & d) + (c - q)) - ((d & q) & (a | q));
+  }else{
+    b = ((b ^ 9) | (a * a)) ^ ((d ^ 24) - (q | a));
+  }
+  c = ((b ^ 93) ^ (c & 30)) & ((q - q) * (p & b));
+  b = ((b ^ q) - (a & p)) + ((a * q) | (c | 75));
+  b = ((a * p) * (d | c)) * ((p + d) | (d & 15));
+  for(i = 0; i < 50; i++){
+    d = ((a | q) & (b | 61)) * ((p - p) & (d - c));
+  }
+  if(b < 10){
+    b = ((a ^ q) - (q | d)) | ((p & b) + (a - c));
+  }else{
+    c = ((b * 48) | (q | b)) & ((q - p) ^ (p & d));
+  }
+  d = ((b * q) ^ (a - q)) ^ ((q ^ p) | (d ^ a));
+  b = ((q ^ 75) ^ (c | 35)) * ((a + q) ^ (a | d));
+  b = ((q ^ p) - (q * 34)) ^ ((q | d) ^ (q & b));
+  a = ((a * q) + (q & c)) - ((q ^ q) + (b * 46));
+  if(a < c){
+    d = ((a * c) - (b + d)) + ((p | b) * (p ^ b));
+  }else{
+    d = ((d + b) | (q - a)) - ((a + 23) * (a * 70));
+  }
+  for(i = 0; i < 45; i++){
+    a = ((q | b) * (a | c)) * ((c - b) ^ (q * c));
+  }
+  a = ((b + d) * (c - 72)) * ((b + 18) ^ (p | d));
+  a = ((b * p) & (p - a)) - ((q ^ c) | (p - d));
+  d = ((c - a) + (c - a)) + ((b & a) & (b | a));
+  if(d < q){
+    c = ((a - b) + (b * p)) ^ ((a ^ c) * (p * d));
+  }else{
+    d = ((d * d) ^ (p - 7)) & ((a * d) & (q - b));
+  }
+  b = ((q | d) + (c & b)) * ((a + c) & (c + 57));
+  d = ((d | d) * (p & d)) | ((c ^ q) ^ (b | q));
+  for(i = 0; i < 5; i++){
+    a = ((q * 66) & (c + b)) ^ ((d * 90) * (d & c));
+  }
+  a = ((d - d) * (p | p)) * ((p + a) * (d & q));
+  if(c < p){
+    d = ((d * p) - (a + a)) & ((b + b) - (d + p));
+  }else{
+    a = ((d & p) * (d | a)) + ((p - q) - (p ^ c));
+  }
+  d = ((p ^ q) | (q | 29)) + ((q + a) + (q - 22));
+  d = ((c | c) - (c - c)) - ((a ^ p) | (a + a));
+  b = ((p + q) ^ (p * b)) | ((q - 31) + (q ^ p));
+  c = ((c ^ q) ^ (d * b)) | ((d * 60) | (q & p));
+  if(b < a){
+    d = ((b - p) * (q | 93)) & ((b * q) ^ (p ^ a));
+  }else{
+    c = ((a - 90) - (c + b)) + ((c ^ d) * (b - d));
+  }
+  b = ((d ^ 42) | (c ^ q)) + ((q | q) * (c + b));
+  a = ((q & c) ^ (d ^ q)) | ((a | c) & (c - c));
+  d = ((a * a) + (q + 20)) & ((p | c) ^ (q - d));
+  b = ((a - d) ^ (a ^ a)) - ((b - 17) + (q + c));
+  if(a < 26){
+    b = ((c & b) - (b * c)) * ((b | c) & (d + c));
+  }else{
+    b = ((b + 93) - (p & q)) - ((q ^ q) & (b * q));
+  }
+  return a + b + c + d;
+}
+
+int func2(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 55;
+  d = 96;
+  a = ((p * b) * (q - d)) ^ ((p & c) | (q - 18));
+  c = ((a & c) ^ (a ^ a)) * ((a | 26) ^ (c ^ 98));
+  c = ((d ^ 18) - (p + 62)) + ((q + q) & (q * d));
+  d = ((d ^ c) ^ (c ^ d)) + ((q + 27) | (a - c));
+  if(c < 32){
+    b = ((p + 35) - (q - 20)) | ((a * b) + (d | a));
+  }else{
+    a = ((a ^ p) ^ (c ^ c)) | ((a * a) | (c ^ p));
+  }
+  a = ((p & c) * (q & d)) - ((p * b) & (a | d));
+  for(i = 0; i < 10; i++){
+    d = ((a - b) ^ (q * c)) - ((p & 95) - (a + 48));
+  }
+  c = ((c - p) - (d * q)) + ((p + d) & (c ^ 52));
+  b = ((d | b) + (q ^ b)) ^ ((q | 41) | (p * d));
+  if(b < 60){
+    a = ((d | q) - (q | q)) | ((a ^ p) & (a ^ b));
+  }else{
+    b = ((q | q) ^ (d + a)) * ((q ^ p) * (p - d));
+  }
+  a = ((a | c) - (q & d)) & ((q + d) & (d & c));
+  b = ((q & 38) ^ (p - d)) * ((p & 34) - (p & p));
+  b = ((p ^ 1) ^ (d * q)) + ((d & 83) - (d ^ p));
+  for(i = 0; i < 16; i++){
+    d = ((a - d) ^ (d & a)) - ((b * b) ^ (q ^ q));
+  }
+  if(a < p){
+    b = ((b * c) - (a & 37)) ^ ((b & d) ^ (d & b));
+  }else{
+    b = ((q * a) | (c - p)) | ((b + c) | (b | 39));
+  }
+  d = ((p * b) & (c + a)) & ((a - 69) + (q | 4));
+  c = ((b ^ a) ^ (d & q)) ^ ((a - p) - (q | p));
+  c = ((q + a) ^ (q - q)) ^ ((d & d) + (d | d));
+  c = ((c ^ q) - (q - b)) | ((p | b) + (q | d));
+  if(c < q){
+    c = ((d * 98) * (a - c)) ^ ((q * b) | (d ^ 51));
+  }else{
+    d = ((q - 29) * (q * q)) & ((q ^ c) * (q & c));
+  }
+  for(i = 0; i < 16; i++){
+    b = ((a - p) * (d | d)) * ((p - 39) ^ (q ^ d));
+  }
+  b = ((q & q) & (b * d)) - ((b | p) + (c + a));
+  c = ((a + c) ^ (p + 65)) & ((d + a) - (b - a));
+  b = ((p - a) * (c | a)) + ((q | a) & (q * c));
+  if(d < q){
+    d = ((d ^ c) - (d ^ c)) ^ ((d & p) | (c + b));
+  }else{
+    d = ((a & 86) | (q + d)) + ((q & q) + (p ^ p));
+  }
+  d = ((d - c) ^ (q + d)) ^ ((p + c) * (b ^ b));
+  c = ((p | c) & (c - q)) & ((b & d) + (c - c));
+  for(i = 0; i < 14; i++){
+    c = ((d * b) + (q | a)) | ((d & c) - (b ^ d));
+  }
+  c = ((b + c) + (d & a)) ^ ((d - q) & (c | d));
+  if(a < c){
+    d = ((a | d) + (c & p)) ^ ((a | 19) & (d * b));
+  }else{
+    a = ((c ^ p) & (c + 16)) + ((a ^ a) * (c + b));
+  }
+  a = ((b ^ 16) * (d * p)) - ((a * 49) - (p ^ d));
+  b = ((q | c) + (d * b)) - ((c | d) ^ (q & 98));
+  b = ((p ^ d) | (p ^ d)) | ((p ^ b) ^ (p * b));
+  a = ((a - a) & (p ^ 64)) ^ ((c * q) & (b * q));
+  if(d < d){
+    c = ((c | b) & (d * b)) & ((a & 82) + (q & q));
+  }else{
+    b = ((c | 22) * (b & c)) & ((p + q) ^ (d | 47));
+  }
+  a = ((p - 16) ^ (q - q)) - ((p - d) - (d - c));
+  d = ((q * c) ^ (c * 62)) - ((q & p) + (b * c));
+  d = ((d - b) + (d | p)) - ((q | 30) | (b | d));
+  b = ((b | c) * (a & c)) & ((c & a) ^ (d | q));
+  if(a < p){
+    d = ((d & d) & (b | q)) + ((d + a) | (d + 12));
+  }else{
+    b = ((d + b) | (q + q)) + ((d & q) ^ (q ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func3(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 29;
+  d = 5;
+  d = ((d - b) + (a * a)) * ((p & p) ^ (p + p));
+  a = ((b | a) | (q * d)) ^ ((d & b) & (b & a));
+  d = ((q - d) | (c + q)) | ((p * b) - (a ^ 72));
+  b = ((b & 87) * (a - q)) | ((c | q) ^ (c - a));
+  if(c < 51){
+    b = ((b - 34) - (b | d)) | ((p * q) - (d & 31));
+  }else{
+    a = ((a + b) * (c * 74)) | ((q + 42) - (p - b));
+  }
+  d = ((c & p) ^ (b & 24)) ^ ((b ^ d) - (q & p));
+  for(i = 0; i < 45; i++){
+    a = ((b - a) & (a + d)) + ((c - a) ^ (p ^ 22));
+  }
+  b = ((p + c) - (c * b)) * ((c + p) + (a + c));
+  b = ((d - 67) * (d & 4)) * ((d * p) - (b * q));
+  if(c < 50){
+    c = ((b & 5) * (d ^ a)) - ((b & c) & (q - b));
+  }else{
+    d = ((c & p) | (q ^ p)) + ((b - a) | (p - b));
+  }
+  c = ((q | 19) & (q - p)) - ((c ^ q) - (a * p));
+  d = ((c | 53) & (c | 28)) ^ ((c & b) ^ (b | d));
+  d = ((p - b) + (q * d)) - ((p ^ 40) * (b - c));
+  for(i = 0; i < 7; i++){
+    b = ((p & c) + (d - q)) * ((b + b) + (b & 12));
+  }
+  if(c < 61){
+    b = ((d + d) & (d - a)) ^ ((p ^ a) | (d - a));
+  }else{
+    c = ((c * b) + (p - c)) * ((d ^ b) + (b & c));
+  }
+  a = ((p ^ 40) & (d - a)) - ((c | 72) & (c & 77));
+  a = ((c - q) & (q * 75)) | ((d & c) * (d - c));
+  c = ((a * d) - (p & 3)) & ((d & b) & (a | c));
+  c = ((d + 34) ^ (q - q)) - ((b * b) | (d | p));
+  if(d < b){
+    d = ((c ^ c) & (d | 6)) * ((a * q) | (a * q));
+  }else{
+    c = ((q & a) + (a ^ b)) + ((b | q) | (d | c));
+  }
+  for(i = 0; i < 32; i++){
+    a = ((b * c) & (q | b)) - ((b & b) * (b + a));
+  }
+  c = ((b + c) & (b ^ q)) + ((b * p) - (d * 29));
+  a = ((c | 84) - (a + q)) + ((d * b) | (p * p));
+  c = ((d | q) & (q | b)) & ((a | c) | (d ^ d));
+  if(d < 84){
+    d = ((c & p) + (q + b)) & ((p ^ 74) ^ (p & a));
+  }else{
+    d = ((a ^ c) ^ (a - p)) & ((d & p) + (a & p));
+  }
+  a = ((q | d) + (d ^ q)) - ((c & q) - (d - d));
+  b = ((d ^ p) & (c | c)) & ((q ^ 28) | (a - 22));
+  for(i = 0; i < 20; i++){
+    d = ((q - q) & (c & 41)) * ((a | b) - (c * c));
+  }
+  c = ((d & 61) & (p + q)) ^ ((d + q) + (q | q));
+  if(c < q){
+    d = ((b - 95) & (p ^ q)) ^ ((b - q) + (p | b));
+  }else{
+    c = ((a ^ 70) & (a ^ b)) - ((p ^ b) & (b ^ 23));
+  }
+  b = ((p & d) * (q ^ p)) * ((b ^ 58) & (d ^ q));
+  b = ((d & a) & (a - 90)) * ((q + d) | (a - c));
+  b = ((b + b) ^ (a | b)) & ((b * a) + (c + d));
+  d = ((c - 61) & (d - 86)) & ((d | a) & (d | 95));
+  if(a < a){
+    b = ((c ^ b) * (p + q)) + ((d + p) ^ (d ^ b));
+  }else{
+    c = ((b + a) ^ (q * d)) & ((a - 3) | (q + b));
+  }
+  d = ((p + 59) + (p - c)) * ((c | a) + (p * d));
+  d = ((a | a) & (a + b)) & ((p - a) * (q ^ a));
+  d = ((q | 4) + (c - 80)) - ((c * a) - (a - 52));
+  d = ((p | q) ^ (p & b)) | ((b * d) | (a ^ q));
+  if(d < b){
+    b = ((a & d) - (c | 25)) | ((c + q) ^ (q ^ d));
+  }else{
+    b = ((a | c) | (p + a)) + ((a - c) * (c + b));
+  }
+  return a + b + c + d;
+}
+
+int func4(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 5;
+  d = 82;
+  c = ((b - c) + (c ^ p)) * ((c - a) & (d ^ d));
+  a = ((a - b) ^ (p ^ 15)) & ((b & 34) & (c & q));
+  c = ((p & c) * (d * b)) + ((d * c) * (a + d));
+  a = ((p ^ c) - (b * d)) | ((d + b) * (p ^ c));
+  if(c < q){
+    b = ((b ^ a) ^ (d + b)) - ((d - d) | (b + a));
+  }else{
+    d = ((p - c) ^ (d ^ a)) * ((a | 47) & (c ^ 53));
+  }
+  c = ((p & 12) ^ (c - a)) & ((c | c) ^ (q + 28));
+  for(i = 0; i < 8; i++){
+    a = ((a * b) ^ (d | d)) ^ ((p | q) | (a | b));
+  }
+  a = ((q ^ a) & (a - b)) * ((d - a) * (a - c));
+  d = ((q - p) ^ (b ^ 50)) + ((a + 46) & (p ^ b));
+  if(b < c){
+    b = ((p & b) - (p + 5)) + ((p ^ c) * (p - 84));
+  }else{
+    d = ((d + a) - (p & a)) + ((b - b) - (p + d));
+  }
+  b = ((p ^ c) * (a & b)) + ((a * 71) | (c | b));
+  c = ((c & p) + (b | 62)) ^ ((d & q) ^ (c & 86));
+  c = ((c + c) ^ (c & b)) | ((d & p) - (p & a));
+  for(i = 0; i < 48; i++){
+    b = ((a ^ 39) - (b ^ d)) ^ ((d ^ 82) + (a - p));
+  }
+  if(d < a){
+    c = ((c | q) + (c & 49)) * ((b ^ q) - (a & p));
+  }else{
+    b = ((d * d) + (b - d)) ^ ((c & d) ^ (p - q));
+  }
+  c = ((c + q) & (c | d)) * ((d + p) + (a * b));
+  d = ((a ^ p) - (d ^ a)) ^ ((b * c) ^ (d - 3));
+  b = ((q + c) - (b * 60)) ^ ((c - b) | (q ^ 35));
+  d = ((q ^ d) & (b | 81)) * ((c ^ d) | (d | q));
+  if(b < d){
+    a = ((d - p) - (p & c)) ^ ((a - c) | (c + a));
+  }else{
+    c = ((c | 22) | (c * p)) - ((d + p) + (d ^ 25));
+  }
+  for(i = 0; i < 45; i++){
+    d = ((c + b) * (q + b)) - ((c - p) - (b * q));
+  }
+  a = ((d ^ 12) + (c | q)) - ((p | p) | (q | a));
+  b = ((b - c) ^ (p | b)) * ((q - d) + (a - b));
+  b = ((p & d) & (q - c)) & ((a & q) | (p & c));
+  if(d < 46){
+    b = ((b + p) * (d + 76)) - ((p - b) + (c ^ p));
+  }else{
+    c = ((b + b) + (p ^ p)) | ((a - b) ^ (b + a));
+  }
+  a = ((q | b) ^ (a ^ q)) | ((q + b) & (q & 37));
+  a = ((c & q) & (a & c)) | ((c - a) - (q ^ 11));
+  for(i = 0; i < 14; i++){
+    d = ((d + a) + (d & b)) - ((a + c) + (q | q));
+  }
+  b = ((q | 92) - (c + q)) & ((q | b) + (b - d));
+  if(a < b){
+    b = ((c - b) | (c * b)) & ((c ^ 13) + (p * b));
+  }else{
+    c = ((d * 89) * (p * 18)) ^ ((c + d) * (d | q));
+  }
+  b = ((d + d) | (a ^ a)) ^ ((d ^ 16) - (p | q));
+  d = ((a - c) | (p ^ c)) & ((p & b) - (a + b));
+  b = ((b * d) ^ (d ^ 46)) | ((b * d) - (q & b));
+  b = ((a & d) - (c - b)) ^ ((q * a) * (d + 25));
+  if(a < p){
+    d = ((b ^ a) * (a - b)) * ((a | q) | (p + a));
+  }else{
+    d = ((d + q) | (d - a)) - ((c | 5) + (q | q));
+  }
+  d = ((c & q) & (a ^ p)) & ((p - a) | (c - b));
+  a = ((p - q) - (d - 1)) ^ ((c + 74) & (q | a));
+  d = ((a - q) * (b & q)) * ((p ^ a) + (a & c));
+  b = ((a | a) * (q & p)) + ((q + a) - (d + a));
+  if(a < b){
+    c = ((p | b) * (a | q)) & ((c | 53) - (b - b));
+  }else{
+    b = ((a & 84) | (d | d)) - ((a ^ q) | (p | b));
+  }
+  return a + b + c + d;
+}
+
+int func5(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 14;
+  d = 5;
+  b = ((q * 29) * (c & a)) - ((d - a) + (b & p));
+  b = ((a ^ q) - (c * c)) - ((d & c) | (q | q));
+  a = ((p * b) * (d - b)) + ((q - q) + (q * q));
+  c = ((p - 95) * (p | a)) + ((b ^ p) | (p | q));
+  if(a < 72){
+    c = ((a + p) + (p | c)) & ((b | p) - (c ^ b));
+  }else{
+    b = ((q * b) - (d ^ q)) ^ ((c - q) - (q ^ b));
+  }
+  d = ((q ^ b) ^ (b ^ a)) | ((d + c) * (q + b));
+  for(i = 0; i < 47; i++){
+    d = ((q + a) ^ (p - d)) * ((c * d) * (q * c));
+  }
+  d = ((p * d) ^ (p - p)) ^ ((b | d) - (b ^ q));
+  b = ((a | a) ^ (a + c)) | ((c * q) ^ (q ^ b));
+  if(d < c){
+    c = ((d ^ 89) + (c ^ p)) & ((b * p) * (d - 42));
+  }else{
+    b = ((b & 81) * (a ^ 82)) + ((d * b) - (b ^ d));
+  }
+  c = ((b * 8) ^ (a - a)) * ((b & p) | (a * 79));
+  b = ((d | c) + (q ^ 28)) + ((d + q) - (d ^ d));
+  d = ((a * p) ^ (d & p)) & ((a * b) - (a + p));
+  for(i = 0; i < 12; i++){
+    d = ((b | a) | (a ^ a)) * ((a ^ q) | (q - d));
+  }
+  if(d < b){
+    d = ((a ^ b) - (d * d)) - ((d + a) * (c + d));
+  }else{
+    a = ((b ^ q) | (d + q)) * ((p | 91) + (b * c));
+  }
+  c = ((d | c) | (b + p)) ^ ((b & d) ^ (c & d));
+  a = ((b * 18) + (q * a)) * ((d - d) + (p * a));
+  c = ((d + c) & (c | b)) + ((d - p) + (p - 8));
+  d = ((q | d) + (p | 35)) * ((q | q) ^ (d - 37));
+  if(c < q){
+    a = ((q - d) + (c * p)) - ((c * b) ^ (d ^ 33));
+  }else{
+    a = ((d ^ c) * (d | 55)) + ((b + p) * (a | d));
+  }
+  for(i = 0; i < 9; i++){
+    d = ((b * d) & (b ^ d)) & ((a | c) + (b - 48));
+  }
+  d = ((d - 3) & (a * 51)) - ((b * 95) | (c - 64));
+  a = ((d * p) ^ (b * b)) + ((d - p) | (a ^ p));
+  d = ((d | p) - (c & p)) * ((q ^ c) & (q - c));
+  if(b < p){
+    c = ((q | d) - (d ^ b)) & ((c + 87) + (d ^ 74));
+  }else{
+    d = ((c + a) * (c & a)) + ((p + q) | (p - q));
+  }
+  b = ((c * c) | (d + a)) | ((d & d) | (c ^ p));
+  b = ((c - 68) * (p - a)) - ((b - p) - (q | 89));
+  for(i = 0; i < 14; i++){
+    a = ((p & b) - (a & d)) | ((p & a) * (a - b));
+  }
+  a = ((a & p) | (c | a)) * ((c - 20) & (d ^ c));
+  if(a < a){
+    d = ((p ^ b) * (p ^ c)) + ((c & p) + (c * a));
+  }else{
+    d = ((d + c) & (d ^ 62)) ^ ((q | 96) - (d - 57));
+  }
+  d = ((q ^ 54) & (q & q)) | ((a & d) * (q ^ b));
+  a = ((q | 53) | (b + 81)) - ((c | q) & (p * 67));
+  a = ((a | b) + (b - 80)) + ((a + a) | (c ^ c));
+  d = ((d ^ c) & (p - q)) + ((q + b) * (q - c));
+  if(b < p){
+    a = ((d & 4) * (b | 8)) - ((q | p) ^ (b + d));
+  }else{
+    c = ((p & b) + (a | b)) * ((d - p) | (q - d));
+  }
+  a = ((b + a) | (a * q)) | ((p * q) - (c - a));
+  c = ((b & p) & (d * p)) + ((b ^ 66) * (c * 42));
+  d = ((q | p) * (p - c)) & ((c | b) - (q - 72));
+  c = ((q - 72) - (c + 68)) + ((b * a) - (d | b));
+  if(a < p){
+    a = ((q - b) * (d & c)) ^ ((q - p) - (p + c));
+  }else{
+    c = ((q + a) - (c - d)) - ((b * c) & (q + 9));
+  }
+  return a + b + c + d;
+}
+
+int func6(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 83;
+  d = 93;
+  d = ((d - q) + (b + a)) * ((a & 24) & (p ^ 91));
+  c = ((b * q) & (c - d)) * ((c - p) & (c | a));
+  c = ((c | 58) - (c & 27)) | ((a ^ a) + (c & b));
+  c = ((a & a) + (d ^ p)) + ((c ^ b) & (p | b));
+  if(a < 26){
+    a = ((c ^ p) - (c | p)) | ((p * q) - (q - a));
+  }else{
+    b = ((c - 18) & (d ^ p)) + ((a + 67) * (q ^ b));
+  }
+  b = ((p + q) & (q * b)) - ((q - 10) - (a - 91));
+  for(i = 0; i < 36; i++){
+    c = ((p - a) + (q * d)) + ((q ^ d) | (c + q));
+  }
+  a = ((p - a) & (p - a)) * ((a - p) * (a & d));
+  c = ((p | d) + (p * 28)) - ((q + d) + (q - 6));
+  if(b < a){
+    a = ((d + 63) | (q + p)) ^ ((b | a) - (d | c));
+  }else{
+    c = ((q | 70) * (q | q)) & ((p + 57) | (q + 76));
+  }
+  a = ((p * d) * (b ^ a)) & ((a | d) & (a & 37));
+  c = ((b | 47) | (d - c)) + ((p - q) * (q - c));
+  a = ((c ^ c) - (c + 22)) - ((b & 25) * (b - q));
+  for(i = 0; i < 5; i++){
+    d = ((a + q) | (a + c)) & ((p + 90) + (q & a));
+  }
+  if(b < b){
+    a = ((q ^ c) + (a * p)) & ((d & 93) | (d - a));
+  }else{
+    c = ((b | b) & (a - p)) ^ ((p | p) + (d - q));
+  }
+  b = ((p * 5) - (a & 82)) + ((b + 73) * (p ^ b));
+  c = ((a + 69) * (a + 58)) - ((p + b) | (b & p));
+  a = ((b * q) & (d | c)) & ((d + 89) * (b + a));
+  d = ((c * q) * (c + p)) | ((q | p) + (a ^ a));
+  if(b < q){
+    d = ((d - a) + (p - b)) - ((b - b) + (q * d));
+  }else{
+    d = ((d - a) * (c | 52)) & ((b & 30) ^ (b & 36));
+  }
+  for(i = 0; i < 22; i++){
+    a = ((b | a) ^ (c * a)) ^ ((q - q) * (q - 93));
+  }
+  a = ((c & b) ^ (c + b)) + ((b - q) & (p + 75));
+  a = ((p - p) ^ (p ^ p)) ^ ((b * 63) - (d - d));
+  d = ((d & b) + (b * q)) - ((p * a) | (p - a));
+  if(c < d){
+    b = ((p * 90) + (d - a)) + ((c * c) ^ (d * a));
+  }else{
+    b = ((c ^ a) & (b - 7)) | ((q | 78) & (c - d));
+  }
+  c = ((b | p) - (d - b)) + ((c & d) * (d & a));
+  c = ((b - 65) | (a | p)) - ((d - q) + (q | p));
+  for(i = 0; i < 18; i++){
+    c = ((q * d) & (d ^ 78)) ^ ((c + c) * (p + c));
+  }
+  c = ((c * a) ^ (d ^ 33)) * ((p + a) - (p ^ b));
+  if(c < d){
+    a = ((p + p) * (d | d)) | ((p * q) - (q & b));
+  }else{
+    b = ((p * p) * (q & a)) | ((d ^ 37) | (d * a));
+  }
+  c = ((d ^ d) | (q | p)) * ((c & q) ^ (d - b));
+  c = ((a * b) - (c - 83)) | ((c | c) & (b + d));
+  c = ((d ^ 11) + (b * 20)) | ((a + q) & (c * q));
+  a = ((d & b) ^ (b | a)) ^ ((a + 83) * (q - d));
+  if(c < 77){
+    a = ((p + p) & (p & q)) + ((b | q) | (b | p));
+  }else{
+    b = ((p * d) & (p | p)) | ((q & a) & (q * q));
+  }
+  a = ((b * b) - (d & d)) * ((c * c) & (b * c));
+  d = ((a | p) + (d & d)) | ((p ^ q) - (d | d));
+  c = ((a * 45) - (b | q)) + ((q * c) - (c & b));
+  a = ((p + 84) | (c ^ 52)) * ((a ^ a) ^ (p - a));
+  if(c < q){
+    c = ((p + q) * (d & b)) | ((p ^ a) | (c + 25));
+  }else{
+    b = ((p + a) ^ (b + p)) ^ ((q | a) & (p - 72));
+  }
+  return a + b + c + d;
+}
+
+int func7(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 17;
+  d = 89;
+  a = ((b + p) & (p + c)) | ((a ^ a) * (a * q));
+  b = ((b - p) * (b | d)) ^ ((p & c) - (a - q));
+  d = ((b - d) + (c + 36)) ^ ((q + 68) & (q ^ d));
+  b = ((q + d) - (p & c)) & ((b & a) ^ (q | d));
+  if(b < q){
+    c = ((c | p) & (d - d)) | ((p * d) | (d & 84));
+  }else{
+    a = ((q - 54) - (c + 23)) * ((p & 59) + (d | c));
+  }
+  d = ((b - p) ^ (d + p)) - ((p - p) - (a | a));
+  for(i = 0; i < 35; i++){
+    a = ((q | a) ^ (a + 76)) * ((a | q) & (b - d));
+  }
+  d = ((a ^ b) + (a ^ q)) & ((q * a) | (a ^ b));
+  b = ((c * q) + (c + a)) ^ ((b - q) - (q ^ a));
+  if(c < a){
+    a = ((d | b) * (a - 90)) - ((c & c) | (c + d));
+  }else{
+    d = ((p ^ d) - (d | q)) ^ ((q | q) - (b * d));
+  }
+  c = ((c - c) | (b + q)) + ((p - p) | (q * 94));
+  b = ((b + 29) + (q - d)) | ((b & d) + (c | q));
+  b = ((b & q) | (d - c)) * ((p | 15) + (q * b));
+  for(i = 0; i < 50; i++){
+    b = ((b + a) * (q & c)) & ((a & 45) ^ (p - p));
+  }
+  if(d < a){
+    c = ((d ^ d) * (d - 60)) | ((b | c) - (b + 37));
+  }else{
+    a = ((a * d) | (d & 74)) + ((q & c) & (p + c));
+  }
+  b = ((d + a) ^ (c - 66)) & ((b & p) ^ (p - c));
+  c = ((c * 36) * (q & d)) * ((q ^ a) & (c & a));
+  b = ((q - 48) * (c - d)) + ((d - d) ^ (d | q));
+  a = ((c | c) * (b - 53)) + ((b - 94) & (p + c));
+  if(c < d){
+    d = ((d + d) - (b ^ 50)) * ((a | d) ^ (a | c));
+  }else{
+    b = ((q ^ b) + (a | p)) * ((q + a) & (a * 93));
+  }
+  for(i = 0; i < 10; i++){
+    b = ((d & c) ^ (d + q)) * ((d | c) + (b + q));
+  }
+  a = ((d + a) + (p & 84)) | ((q - c) - (d * b));
+  b = ((b * q) | (d & p)) - ((b | d) | (q & 47));
+  a = ((a * 13) * (a & b)) | ((c - b) ^ (d ^ q));
+  if(d < a){
+    d = ((c - q) & (a - p)) * ((q - d) | (a + q));
+  }else{
+    b = ((c | p) * (p - q)) * ((p & 69) * (b * a));
+  }
+  d = ((b | p) | (p - 23)) - ((c * p) * (q + c));
+  b = ((b ^ c) * (d | 57)) - ((d - c) & (c | p));
+  for(i = 0; i < 15; i++){
+    b = ((a + d) ^ (p * b)) | ((p + p) + (d ^ c));
+  }
+  c = ((b | p) - (b * d)) - ((a | c) | (c ^ 3));
+  if(a < b){
+    d = ((a ^ 93) - (a - c)) + ((p * c) | (b | c));
+  }else{
+    c = ((b + c) + (d + 79)) - ((q - a) + (p * c));
+  }
+  b = ((d * b) | (a * a)) | ((c - a) + (a * p));
+  a = ((b + c) & (q ^ a)) | ((d & q) & (b - a));
+  b = ((c ^ c) * (q ^ q)) & ((c + b) + (a + b));
+  a = ((c | a) | (b * a)) & ((c & 88) - (d ^ 87));
+  if(a < p){
+    c = ((d - p) * (p & 41)) ^ ((c + b) * (d + q));
+  }else{
+    b = ((q - p) & (p ^ c)) ^ ((q - 72) | (c | b));
+  }
+  b = ((a & d) * (p & a)) + ((b * 96) + (p | a));
+  b = ((d + q) ^ (c & q)) & ((d - c) * (d - c));
+  a = ((b ^ 71) * (p + p)) | ((b & p) - (p | 83));
+  d = ((b + 82) - (b & b)) * ((q + q) * (p * a));
+  if(c < p){
+    a = ((d + a) & (b - 18)) + ((a ^ d) & (c + 93));
+  }else{
+    a = ((q | c) ^ (a - 50)) | ((p * a) | (c ^ 7));
+  }
+  return a + b + c + d;
+}
+
+int func8(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 27;
+  d = 41;
+  c = ((a * p) - (a + d)) + ((d - 41) - (a & q));
+  b = ((d ^ p) ^ (a & p)) * ((q & d) | (b - a));
+  b = ((q & b) - (d ^ c)) & ((p * 84) - (p * d));
+  a = ((p - 54) | (a | q)) * ((a - b) | (a & c));
+  if(d < c){
+    c = ((c - a) & (q + 29)) | ((q ^ b) - (c ^ c));
+  }else{
+    d = ((b & p) - (b + c)) | ((q ^ b) & (d - a));
+  }
+  d = ((a ^ 72) ^ (q ^ a)) & ((c ^ d) & (d & c));
+  for(i = 0; i < 13; i++){
+    a = ((q & a) | (q + a)) + ((c & a) * (a - b));
+  }
+  d = ((q | d) | (b ^ b)) ^ ((q - p) + (q | b));
+  a = ((q + d) ^ (a + a)) & ((q - 57) * (b + q));
+  if(a < b){
+    d = ((d - c) & (q + a)) + ((c - a) ^ (b ^ a));
+  }else{
+    a = ((b - p) - (d ^ b)) + ((p + b) * (d | c));
+  }
+  c = ((p ^ d) ^ (c * 76)) - ((q | b) | (q ^ 29));
+  d = ((c - 80) ^ (c * q)) + ((b + b) | (b ^ p));
+  d = ((c - 21) - (d * p)) | ((q * 16) + (b - d));
+  for(i = 0; i < 42; i++){
+    c = ((p * q) & (p ^ 28)) - ((a & c) | (p + q));
+  }
+  if(d < 19){
+    a = ((c * c) + (a - b)) * ((q + q) ^ (d ^ a));
+  }else{
+    a = ((c ^ d) ^ (q ^ 34)) | ((p ^ q) - (q - d));
+  }
+  d = ((d & 25) | (q * d)) - ((a + p) | (q * 76));
+  c = ((c & b) - (q | q)) | ((c & a) | (d - 24));
+  c = ((c ^ a) * (q | 84)) | ((a ^ a) * (a * d));
+  a = ((q | q) ^ (q - d)) ^ ((p * b) | (a ^ d));
+  if(a < q){
+    c = ((q - 4) & (p * d)) - ((b + p) * (p ^ q));
+  }else{
+    c = ((c * q) + (d * d)) | ((q & 72) + (q + 76));
+  }
+  for(i = 0; i < 23; i++){
+    c = ((q ^ 83) + (a * a)) * ((p - c) * (b ^ 14));
+  }
+  c = ((p + p) | (q & q)) ^ ((c * b) ^ (q * c));
+  c = ((a | q) - (p * b)) | ((p & a) & (q ^ p));
+  b = ((d + a) * (q + c)) & ((c ^ 70) | (d | q));
+  if(d < d){
+    b = ((a & 35) ^ (d - d)) | ((c - p) & (p - b));
+  }else{
+    b = ((c & d) & (a ^ b)) * ((a | q) + (p * a));
+  }
+  c = ((c - p) * (c * d)) | ((q | q) + (b | b));
+  d = ((a & 23) + (q & q)) & ((c & 84) + (q ^ c));
+  for(i = 0; i < 23; i++){
+    c = ((q | 6) & (c - a)) - ((a | d) - (d & b));
+  }
+  c = ((d - 8) - (c * p)) & ((q * q) | (p + a));
+  if(d < a){
+    d = ((p - 81) - (b | 28)) & ((q + 71) * (p - q));
+  }else{
+    c = ((p * 8) * (d & 25)) | ((d & b) - (p & b));
+  }
+  c = ((q | a) ^ (d - 33)) & ((p - d) | (a - d));
+  b = ((p | 23) - (c & q)) ^ ((q * q) & (d - 41));
+  b = ((q + p) - (c ^ 72)) ^ ((a | c) + (c + 84));
+  a = ((c | 57) + (p | d)) | ((q & d) & (b | d));
+  if(a < d){
+    c = ((a & 15) | (d + c)) * ((q + 75) * (d + q));
+  }else{
+    d = ((a * q) * (a & 35)) * ((b * d) & (q ^ 33));
+  }
+  c = ((c ^ b) - (b * q)) - ((d | q) + (a + p));
+  b = ((d + p) * (p * b)) | ((d - p) ^ (c + a));
+  a = ((c ^ 37) & (p & c)) | ((p ^ 14) | (b + 18));
+  a = ((q * c) ^ (a ^ 44)) | ((q | 61) + (c & b));
+  if(a < d){
+    b = ((p * d) | (q * 85)) ^ ((a | a) & (q * p));
+  }else{
+    b = ((b + b) & (p + b)) - ((a * 15) & (p * a));
+  }
+  return a + b + c + d;
+}
+
+int func9(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 70;
+  d = 82;
+  c = ((q ^ q) & (d | d)) * ((q + q) + (p ^ d));
+  b = ((b ^ 86) | (q & 2)) * ((a + q) ^ (d - d));
+  b = ((p & d) ^ (q + d)) | ((c - p) * (a & a));
+  d = ((a | d) & (c + 5)) | ((d ^ d) * (q + p));
+  if(c < b){
+    a = ((q - b) | (c | a)) - ((q & 65) & (p + d));
+  }else{
+    c = ((a * b) | (a & 2)) - ((a * 47) ^ (b - p));
+  }
+  b = ((b ^ b) - (p - 1)) & ((q - d) & (a & a));
+  for(i = 0; i < 6; i++){
+    b = ((p & p) - (d | 19)) & ((d & d) - (q * c));
+  }
+  c = ((q + b) ^ (q & 8)) + ((b | b) & (b + a));
+  d = ((a - p) | (a ^ q)) - ((p ^ d) ^ (c ^ 19));
+  if(b < q){
+    d = ((d - a) * (q * b)) & ((q * d) + (q | a));
+  }else{
+    a = ((p - 71) & (b * q)) | ((a ^ b) + (q + 98));
+  }
+  b = ((p & 72) ^ (a + d)) & ((a ^ p) & (q & 32));
+  b = ((q & b) + (p - 43)) | ((a - a) - (c + p));
+  b = ((p | q) ^ (q + q)) * ((d & d) & (b ^ b));
+  for(i = 0; i < 50; i++){
+    d = ((p * 89) & (b & 51)) + ((b ^ d) - (p & a));
+  }
+  if(c < 37){
+    c = ((p & c) | (b ^ p)) * ((q * q) & (b & b));
+  }else{
+    a = ((a | p) | (p + 15)) & ((p - b) - (a + d));
+  }
+  d = ((a | 13) & (d + c)) + ((a | 54) ^ (p & p));
+  a = ((c * q) ^ (d ^ 50)) | ((p | c) ^ (c - d));
+  a = ((a & b) ^ (c & d)) - ((p & 8) * (d - d));
+  a = ((q ^ b) + (d | 50)) * ((b + q) ^ (c | 17));
+  if(c < q){
+    d = ((d | p) & (b - 20)) ^ ((p & c) + (p | a));
+  }else{
+    c = ((c - q) | (p | d)) + ((a ^ 79) - (c | a));
+  }
+  for(i = 0; i < 32; i++){
+    c = ((c & 91) - (c - q)) - ((p * b) | (c - d));
+  }
+  d = ((b + d) * (b + q)) ^ ((q & 13) * (a ^ b));
+  d = ((d & p) * (a | c)) | ((c ^ q) ^ (q - b));
+  d = ((d ^ d) | (b | 78)) & ((b - c) * (q + 12));
+  if(c < b){
+    c = ((b ^ q) - (c - 70)) & ((p - 65) & (d * b));
+  }else{
+    a = ((b - d) & (d * p)) ^ ((c | d) * (c & a));
+  }
+  a = ((a ^ b) | (a * p)) * ((p + d) - (p * d));
+  a = ((c - a) ^ (d + 59)) * ((d + 41) | (d * d));
+  for(i = 0; i < 45; i++){
+    b = ((c | d) | (a + a)) & ((a + p) | (q | d));
+  }
+  b = ((p | a) * (c & c)) & ((d * b) * (c & b));
+  if(b < d){
+    d = ((c - 83) - (d + 97)) * ((a - q) + (a * c));
+  }else{
+    a = ((p - a) | (c | a)) | ((b * p) - (d | p));
+  }
+  a = ((a | q) * (p - a)) & ((p ^ q) & (p ^ d));
+  c = ((c | b) - (b - 88)) & ((d ^ 24) ^ (p + 56));
+  c = ((p - b) - (c + c)) | ((c ^ 15) & (c | 97));
+  d = ((b + q) + (p | a)) ^ ((d + d) + (b - a));
+  if(a < d){
+    c = ((a + q) - (a * d)) + ((a ^ 6) * (p & p));
+  }else{
+    c = ((c + a) & (q + p)) - ((b - 14) | (a & p));
+  }
+  a = ((a & c) - (a & d)) + ((p - 46) & (a & c));
+  b = ((d + d) | (a * c)) | ((p - 31) & (d + a));
+  c = ((p ^ 91) | (c | b)) ^ ((d & d) | (b - p));
+  d = ((p & c) * (c & q)) - ((a ^ c) * (q * p));
+  if(a < a){
+    c = ((c + 24) & (a ^ p)) * ((c | d) | (c - p));
+  }else{
+    a = ((a | b) ^ (d | b)) - ((d - d) | (b - 41));
+  }
+  return a + b + c + d;
+}
+
+int func10(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 36;
+  d = 12;
+  d = ((c ^ d) - (a - c)) - ((a | q) & (q | 67));
+  c = ((d ^ d) & (p * a)) ^ ((b & 89) * (d & b));
+  c = ((a ^ d) + (c - d)) * ((b + 96) | (q + d));
+  c = ((q ^ 16) ^ (d ^ q)) & ((c + c) & (c + d));
+  if(c < d){
+    a = ((p ^ c) * (d * c)) ^ ((b - 52) * (q * 78));
+  }else{
+    c = ((c + p) + (q | p)) - ((p - b) & (d - b));
+  }
+  c = ((b + p) * (p | q)) + ((d * 77) * (q ^ b));
+  for(i = 0; i < 19; i++){
+    c = ((q ^ c) * (d + c)) ^ ((a ^ 51) | (d * p));
+  }
+  a = ((d & b) ^ (a ^ 78)) - ((c ^ 99) * (q - b));
+  b = ((p | a) & (q - q)) - ((c ^ d) * (a - 72));
+  if(a < b){
+    b = ((a ^ q) + (d * 24)) | ((d * d) ^ (a * b));
+  }else{
+    c = ((q - p) + (c + d)) * ((b | 49) - (a | q));
+  }
+  c = ((a ^ q) | (a & a)) * ((p ^ p) | (p & 63));
+  b = ((c & a) - (d | q)) * ((d + a) ^ (b + 30));
+  b = ((c & 98) & (q ^ p)) + ((d * b) | (c - b));
+  for(i = 0; i < 15; i++){
+    c = ((d | a) - (q - 64)) & ((d & a) | (c ^ c));
+  }
+  if(c < 90){
+    d = ((a & b) & (d - c)) | ((q + 33) ^ (q | 50));
+  }else{
+    a = ((c - p) - (p - 62)) | ((q | p) | (b & b));
+  }
+  c = ((d & b) | (p + c)) - ((d ^ a) + (a ^ c));
+  c = ((p & c) - (b & d)) + ((b + p) & (a - 42));
+  c = ((p * q) & (d | b)) - ((d * c) ^ (d - 85));
+  b = ((q | b) - (q ^ 22)) ^ ((q & d) + (q + 48));
+  if(d < 73){
+    b = ((p | 78) | (p ^ 46)) | ((c | a) - (c - q));
+  }else{
+    d = ((q ^ 55) | (b + q)) & ((b & d) - (q + q));
+  }
+  for(i = 0; i < 13; i++){
+    d = ((a - 46) + (b - q)) & ((p & 54) | (d & c));
+  }
+  a = ((b + q) + (d - d)) | ((c & b) & (d & c));
+  d = ((d ^ q) - (c * q)) - ((d ^ c) - (d - q));
+  b = ((a ^ c) ^ (d | c)) ^ ((a & d) ^ (b | a));
+  if(b < c){
+    d = ((d - q) * (b - a)) + ((b & c) | (p + 90));
+  }else{
+    c = ((a + c) * (d & a)) | ((q + 62) | (d ^ b));
+  }
+  c = ((b + d) - (p & a)) ^ ((q * q) ^ (d * d));
+  c = ((q & 84) ^ (p & c)) + ((b + c) + (a ^ d));
+  for(i = 0; i < 2; i++){
+    b = ((c ^ a) ^ (p + a)) - ((q * d) ^ (b + 62));
+  }
+  d = ((d * p) & (a ^ a)) + ((d & p) * (q ^ a));
+  if(c < b){
+    b = ((p ^ 91) * (c * q)) - ((d - 77) * (p & a));
+  }else{
+    a = ((b - 98) | (d | b)) * ((d | c) - (c | a));
+  }
+  a = ((c & a) - (c * 86)) ^ ((p * c) * (p ^ 8));
+  c = ((c & 37) * (p * a)) * ((a & 91) ^ (c + 54));
+  c = ((p * p) ^ (p ^ 91)) * ((a - q) | (q - d));
+  b = ((b | 60) ^ (b - c)) ^ ((q | d) - (q | c));
+  if(d < b){
+    b = ((q - c) ^ (d & b)) - ((c & q) | (a - 99));
+  }else{
+    b = ((a ^ d) | (d ^ a)) ^ ((q + 56) & (a * p));
+  }
+  a = ((a - 17) & (q - q)) ^ ((d - p) | (d * 69));
+  c = ((a & q) ^ (a + c)) + ((a ^ p) + (c * 22));
+  a = ((p ^ q) & (c & b)) - ((p + p) * (b & d));
+  c = ((p + p) | (a | d)) & ((q & 46) * (p & a));
+  if(b < a){
+    b = ((p * c) * (c & 3)) ^ ((a | 34) ^ (b - 10));
+  }else{
+    d = ((q | a) + (a * b)) ^ ((c - a) + (p * 74));
+  }
+  return a + b + c + d;
+}
+
+int func11(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 63;
+  d = 96;
+  a = ((c | b) ^ (c + 53)) - ((a + c) + (d + b));
+  d = ((q | d) + (d - b)) & ((p | 1) | (c & p));
+  d = ((d - 73) & (d | b)) & ((p & a) ^ (c | 18));
+  c = ((p - c) ^ (p & a)) ^ ((d * q) + (a & d));
+  if(b < p){
+    c = ((q + c) | (a | q)) & ((c | 69) + (c ^ 3));
+  }else{
+    a = ((q * a) & (p ^ q)) + ((c - b) & (b | a));
+  }
+  c = ((d + b) ^ (d | b)) & ((a + b) ^ (q * q));
+  for(i = 0; i < 19; i++){
+    c = ((c - a) - (b & 56)) & ((c | p) & (c | 80));
+  }
+  c = ((q + 64) ^ (q ^ 67)) * ((p & d) ^ (b * p));
+  c = ((d ^ p) ^ (c | 92)) & ((c - a) | (p - 63));
+  if(b < q){
+    a = ((a + b) & (c | p)) * ((q * d) | (p | d));
+  }else{
+    b = ((p & d) * (q + q)) ^ ((d * d) - (a ^ a));
+  }
+  c = ((a + 94) - (c * 46)) & ((b & q) - (q * 17));
+  b = ((d * 55) * (q & d)) + ((c | a) + (p | q));
+  c = ((q * q) - (p + q)) - ((d + b) + (d ^ q));
+  for(i = 0; i < 14; i++){
+    d = ((c | c) - (q | d)) ^ ((c & 7) | (a | 93));
+  }
+  if(a < p){
+    d = ((q - c) & (p * q)) & ((d & c) ^ (q * a));
+  }else{
+    a = ((p - b) & (c * a)) | ((b & 24) | (c + p));
+  }
+  a = ((c | 61) | (b | c)) * ((c & 59) - (p | a));
+  a = ((b ^ p) + (q | 63)) & ((d | c) & (b + b));
+  c = ((b - a) & (p & a)) ^ ((b - c) + (p | d));
+  d = ((a & q) & (a ^ a)) & ((p - 96) ^ (d * d));
+  if(a < c){
+    c = ((p | a) ^ (b * b)) | ((q | 1) + (a + 25));
+  }else{
+    d = ((b * p) & (b & q)) * ((a ^ b) ^ (a * q));
+  }
+  for(i = 0; i < 35; i++){
+    a = ((a - c) | (d + p)) ^ ((d * 26) & (q | q));
+  }
+  d = ((q | c) + (d ^ b)) - ((q & c) - (p | d));
+  b = ((q * a) - (c * p)) ^ ((d | c) * (b & 9));
+  b = ((b - 59) | (p + q)) | ((q - b) + (p - a));
+  if(c < a){
+    a = ((b ^ d) ^ (a * p)) + ((d * p) * (p + a));
+  }else{
+    b = ((q + a) & (a & 71)) * ((c | 34) - (d & q));
+  }
+  c = ((c + d) + (d + c)) | ((c * 95) & (b ^ c));
+  a = ((a & b) | (b * d)) & ((q | 31) | (c | p));
+  for(i = 0; i < 18; i++){
+    b = ((a + 53) + (a * 39)) | ((p & 98) + (p ^ 43));
+  }
+  c = ((q * 72) ^ (d + p)) | ((q + a) * (b - d));
+  if(a < 67){
+    c = ((q * b) * (c | 65)) + ((d + c) + (p ^ 66));
+  }else{
+    a = ((p + q) * (q + q)) + ((b * q) & (d + b));
+  }
+  b = ((b ^ q) ^ (p * q)) - ((p ^ c) & (b | c));
+  c = ((b * 37) & (p - c)) | ((a & c) + (p * 13));
+  c = ((a & b) - (c ^ a)) & ((c & a) - (b - d));
+  c = ((c * 4) * (a - 67)) ^ ((d + d) * (d - b));
+  if(c < b){
+    b = ((p - d) & (d | 32)) + ((a * 46) - (d - p));
+  }else{
+    a = ((d * 30) | (a ^ p)) ^ ((p & d) + (b + p));
+  }
+  c = ((q ^ 7) & (b + 56)) * ((c - 88) & (p & q));
+  c = ((p | b) * (d + c)) & ((p & 7) - (q & q));
+  b = ((c * c) * (b * a)) ^ ((a ^ 93) * (b | 6));
+  b = ((b | 58) | (q * 29)) ^ ((p * c) - (a ^ 17));
+  if(a < 89){
+    d = ((b - c) | (p & d)) + ((p | a) | (b & 19));
+  }else{
+    a = ((q - p) & (a & a)) ^ ((a & c) ^ (q ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func12(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 49;
+  d = 91;
+  c = ((d & 14) | (c - b)) & ((b ^ d) ^ (p ^ 36));
+  c = ((q | a) | (d | q)) - ((a & 7) & (p | q));
+  b = ((d * b) | (q + a)) - ((a + d) * (a + c));
+  a = ((d + a) + (q ^ 43)) * ((q + 12) ^ (c & 23));
+  if(c < a){
+    d = ((p | q) + (c + c)) - ((d - b) * (q & d));
+  }else{
+    b = ((p ^ 16) + (c & q)) & ((a * d) * (q ^ a));
+  }
+  b = ((d & q) ^ (q & p)) * ((c * q) | (c + a));
+  for(i = 0; i < 44; i++){
+    a = ((b + b) | (c * d)) * ((q & p) & (q * c));
+  }
+  d = ((d - p) - (q ^ 10)) * ((c - c) ^ (d + 76));
+  d = ((b - p) & (q + a)) ^ ((q | d) ^ (d & c));
+  if(b < a){
+    d = ((p + a) - (a | d)) - ((q & 30) * (p & c));
+  }else{
+    d = ((c + p) + (q + q)) & ((a & c) * (c ^ p));
+  }
+  b = ((c & p) + (a * b)) + ((b + b) ^ (b + p));
+  c = ((q - 73) - (c | 3)) * ((c * 87) | (q + a));
+  a = ((b * c) * (a + b)) ^ ((c + p) + (c + p));
+  for(i = 0; i < 45; i++){
+    a = ((q + c) ^ (c - a)) | ((a | c) ^ (q ^ 43));
+  }
+  if(b < c){
+    a = ((p & p) | (c + d)) * ((d | q) + (a - 6));
+  }else{
+    c = ((c + d) - (p & d)) * ((b & b) + (c + 79));
+  }
+  d = ((b | 91) ^ (c + 68)) - ((c ^ 87) - (c | q));
+  d = ((b * p) * (d | p)) & ((b - a) | (q * d));
+  a = ((b | c) + (b * 40)) - ((d + q) - (a & 80));
+  b = ((d - p) + (b ^ b)) | ((c + 44) | (a ^ c));
+  if(b < 38){
+    a = ((b + c) & (d ^ 56)) + ((q ^ 29) | (c & d));
+  }else{
+    c = ((b + a) & (q ^ b)) | ((b | 47) - (a - a));
+  }
+  for(i = 0; i < 42; i++){
+    c = ((c + a) & (q * 50)) * ((c ^ p) ^ (b + c));
+  }
+  c = ((p | a) | (q * q)) * ((q - 59) * (a ^ c));
+  d = ((p * c) + (b - b)) * ((d & p) | (d - p));
+  b = ((a ^ a) - (a | d)) ^ ((c - 63) + (a - 33));
+  if(d < p){
+    a = ((q - c) & (d * 34)) - ((d ^ d) + (c + 36));
+  }else{
+    b = ((a - p) + (b ^ a)) * ((b * p) + (b - c));
+  }
+  c = ((c - p) ^ (q | 69)) - ((q & 80) & (d | 73));
+  b = ((d & p) & (c ^ 22)) & ((a & p) - (c ^ c));
+  for(i = 0; i < 17; i++){
+    c = ((q - 63) | (d | p)) - ((q * 44) * (d - q));
+  }
+  b = ((p & p) * (p + q)) + ((c & b) & (a + q));
+  if(b < p){
+    d = ((b * 92) ^ (a - d)) + ((c * 84) + (p & q));
+  }else{
+    b = ((p * d) & (c | a)) & ((a | p) * (d ^ 99));
+  }
+  a = ((a ^ p) + (b | 99)) + ((q ^ q) | (p ^ q));
+  a = ((c ^ p) + (c & p)) ^ ((d + b) | (a | b));
+  a = ((q + d) | (q - p)) + ((c + d) & (a + b));
+  a = ((d * 62) & (q * 10)) ^ ((q * 17) ^ (c + q));
+  if(a < a){
+    b = ((d ^ c) * (q | b)) * ((b | 8) + (b & 22));
+  }else{
+    b = ((q ^ 8) ^ (p & 86)) | ((a ^ a) & (p - c));
+  }
+  b = ((a ^ q) ^ (q + q)) + ((p | 45) & (d - d));
+  d = ((b & p) | (q * p)) + ((q - a) ^ (p ^ b));
+  b = ((c + p) + (c + b)) ^ ((q ^ 60) - (q * d));
+  c = ((d * q) | (c ^ c)) & ((d | a) + (a - b));
+  if(d < q){
+    c = ((d - 51) & (p | p)) * ((p | 56) - (a - a));
+  }else{
+    d = ((c + 42) ^ (d * a)) * ((d ^ p) - (a * q));
+  }
+  return a + b + c + d;
+}
+
+int func13(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 22;
+  d = 88;
+  a = ((b * a) * (a - q)) ^ ((q ^ a) * (q - c));
+  a = ((b - d) ^ (c | b)) - ((a * d) ^ (p - p));
+  d = ((q * 94) ^ (b | d)) & ((b & 36) - (c * d));
+  a = ((a & p) & (p ^ 55)) & ((a | 10) - (a & p));
+  if(b < p){
+    b = ((d - d) * (p ^ c)) + ((c - a) * (a * 8));
+  }else{
+    a = ((c * 41) + (p * a)) ^ ((b - p) ^ (c - c));
+  }
+  a = ((p + p) - (q * a)) ^ ((c + p) + (p * 27));
+  for(i = 0; i < 46; i++){
+    a = ((a * b) - (p & a)) * ((q | a) ^ (p & c));
+  }
+  c = ((p + 81) - (d & p)) + ((b & c) + (p | a));
+  a = ((q - p) | (c + a)) & ((p ^ d) & (q | 48));
+  if(d < a){
+    d = ((a ^ c) - (d ^ 78)) * ((p + b) * (c & d));
+  }else{
+    c = ((q - 75) & (p ^ c)) ^ ((q - b) & (d - 83));
+  }
+  c = ((b * p) + (d + c)) * ((q + d) - (b + p));
+  d = ((p | b) * (c + a)) ^ ((q & d) ^ (a ^ c));
+  d = ((p * a) * (q + b)) - ((d + d) ^ (c & p));
+  for(i = 0; i < 9; i++){
+    d = ((q ^ q) ^ (d + a)) | ((b - q) & (p * q));
+  }
+  if(a < 95){
+    d = ((d ^ a) + (q & d)) & ((p & 2) & (p * d));
+  }else{
+    a = ((c * d) * (c * b)) | ((q * 10) * (b | a));
+  }
+  c = ((q - 72) - (b + 41)) + ((d | b) ^ (a * p));
+  c = ((a * c) - (c - 36)) & ((a * d) + (b - q));
+  a = ((p | q) * (p - b)) * ((c & 62) * (q * a));
+  a = ((c | 11) - (p - a)) | ((q + 37) & (p - b));
+  if(c < b){
+    c = ((b + 9) & (q * 2)) ^ ((d ^ a) ^ (d * 2));
+  }else{
+    a = ((b | b) & (q + a)) + ((c * 13) ^ (d * 1));
+  }
+  for(i = 0; i < 42; i++){
+    d = ((b ^ b) | (q & d)) ^ ((q | 61) + (p & a));
+  }
+  a = ((b + a) ^ (d * 47)) * ((q ^ b) | (d - a));
+  b = ((c - 88) ^ (q - b)) ^ ((d & a) & (q ^ 59));
+  d = ((c * d) | (p ^ q)) | ((q * c) | (c & p));
+  if(b < d){
+    d = ((p ^ p) * (b ^ q)) - ((c + d) * (c | 37));
+  }else{
+    b = ((c + d) & (q * q)) + ((c + a) ^ (b | c));
+  }
+  b = ((q * 41) | (p + b)) + ((b * a) + (d | 21));
+  a = ((d | c) | (q | b)) | ((q ^ p) - (b & b));
+  for(i = 0; i < 2; i++){
+    d = ((p & 66) ^ (a ^ d)) - ((a - b) * (d * 31));
+  }
+  c = ((q - c) | (a | 56)) + ((c ^ p) | (q - 76));
+  if(d < 2){
+    b = ((a ^ d) - (b | a)) & ((q & q) * (q ^ d));
+  }else{
+    a = ((p * 50) & (d * q)) | ((b ^ 57) & (q ^ 3));
+  }
+  b = ((c + p) | (p * p)) * ((p + d) | (b & 48));
+  c = ((d | c) * (b | d)) + ((a | c) | (q * 51));
+  c = ((a | 72) ^ (c + b)) & ((d + q) | (b - p));
+  a = ((q - c) & (b ^ c)) + ((c * 27) + (d * 95));
+  if(d < d){
+    c = ((p * b) * (a & p)) | ((a * q) + (q * p));
+  }else{
+    b = ((a * c) ^ (d - b)) - ((a ^ 50) - (b | d));
+  }
+  b = ((c * 24) ^ (b | c)) & ((q & c) - (b * 44));
+  b = ((b | c) | (b * c)) - ((q | b) | (d ^ p));
+  c = ((b ^ d) & (q & q)) - ((c * q) * (c & c));
+  a = ((q ^ q) * (a * b)) & ((b & d) - (q - b));
+  if(d < q){
+    a = ((q * 74) + (b - p)) - ((d + d) & (a * q));
+  }else{
+    c = ((p ^ q) & (c & a)) | ((b - p) ^ (p * a));
+  }
+  return a + b + c + d;
+}
+
+int func14(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 58;
+  a = ((a * a) * (b - q)) * ((c - q) & (b * b));
+  b = ((q + c) & (b & q)) + ((d * 33) + (b + b));
+  a = ((b * a) + (p & c)) ^ ((p ^ c) | (b ^ d));
+  c = ((b ^ 21) + (c * p)) - ((b * p) + (d | 73));
+  if(b < q){
+    d = ((b + 48) * (q | 86)) & ((p ^ q) - (q & d));
+  }else{
+    d = ((b * 9) & (c * c)) - ((c ^ d) + (c * q));
+  }
+  c = ((a * q) - (b * c)) + ((b | q) ^ (b - 51));
+  for(i = 0; i < 20; i++){
+    b = ((a | 49) + (a - q)) | ((q & p) - (q ^ 27));
+  }
+  a = ((a - d) + (p * p)) ^ ((d ^ b) ^ (d - d));
+  a = ((q + 42) - (q + a)) + ((c & b) * (a * 25));
+  if(d < a){
+    d = ((d * c) + (c - 86)) * ((a ^ q) - (d ^ c));
+  }else{
+    b = ((d - 89) + (q - a)) & ((c | c) | (d * c));
+  }
+  d = ((a - d) * (b * a)) | ((b - p) ^ (q & d));
+  a = ((c | 60) & (a & q)) - ((p & 42) - (a ^ 76));
+  c = ((b & q) ^ (a * a)) ^ ((p & 35) - (a + q));
+  for(i = 0; i < 50; i++){
+    d = ((b - p) | (d | q)) - ((a - 9) & (b ^ q));
+  }
+  if(d < a){
+    d = ((b ^ a) + (a & c)) + ((a ^ a) + (p * d));
+  }else{
+    a = ((q - b) | (d * p)) - ((q + p) - (p * 10));
+  }
+  c = ((d | b) * (d * 13)) + ((c & b) & (b * q));
+  c = ((p | a) & (q * b)) + ((p + a) - (p & p));
+  a = ((p - p) + (d | 44)) + ((p ^ 89) & (b - q));
+  a = ((a + c) ^ (d + c)) * ((b * 36) | (c & q));
+  if(c < 80){
+    a = ((q * 72) ^ (b ^ 62)) + ((c & d) | (c + q));
+  }else{
+    a = ((q & b) ^ (a + p)) | ((c & a) & (a | b));
+  }
+  for(i = 0; i < 40; i++){
+    b = ((a & q) - (b ^ d)) ^ ((p | b) & (q ^ c));
+  }
+  a = ((b - a) ^ (b * p)) - ((p + c) + (a ^ 43));
+  a = ((p ^ a) - (d - p)) * ((a - 12) ^ (a ^ a));
+  b = ((a ^ q) + (c - d)) + ((d & b) * (p | q));
+  if(d < 97){
+    a = ((b - a) ^ (a | c)) - ((a | q) ^ (d | p));
+  }else{
+    d = ((p - 30) + (q * p)) - ((d + d) - (a ^ b));
+  }
+  c = ((d - a) * (b | c)) - ((c - q) | (p * 32));
+  b = ((p | 97) ^ (c * 74)) | ((d * 58) | (d * p));
+  for(i = 0; i < 37; i++){
+    c = ((c ^ b) + (c & b)) | ((d ^ c) - (c | 31));
+  }
+  b = ((c + b) ^ (d - d)) * ((p + q) | (c | p));
+  if(b < d){
+    d = ((a * c) ^ (a + 83)) - ((q | 16) | (p - b));
+  }else{
+    d = ((b | p) * (a & d)) | ((c - c) ^ (b * d));
+  }
+  a = ((a & q) & (b ^ p)) | ((a + 91) ^ (c + q));
+  c = ((d - p) | (q - c)) * ((p + d) - (q + d));
+  c = ((b * c) | (b + d)) & ((c + 60) ^ (c | q));
+  c = ((a + b) - (a - p)) - ((a * q) * (p ^ q));
+  if(d < 29){
+    d = ((p & 56) ^ (a - 13)) * ((a + d) ^ (c + c));
+  }else{
+    a = ((q * c) ^ (a * d)) ^ ((c + 69) | (q - 69));
+  }
+  c = ((p | b) & (c * 6)) ^ ((p + a) & (q | 5));
+  d = ((b + q) & (q | d)) & ((d + b) - (a + b));
+  b = ((q + d) & (d - b)) + ((d * 56) ^ (c | 8));
+  b = ((b ^ a) - (p - 96)) & ((c ^ a) * (a | 19));
+  if(b < q){
+    c = ((a | c) - (q - a)) * ((c | q) | (p - b));
+  }else{
+    a = ((b ^ c) ^ (a & 86)) ^ ((q * a) * (p | 44));
+  }
+  return a + b + c + d;
+}
+
+int func15(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 80;
+  d = 30;
+  c = ((b ^ b) + (a & c)) | ((p & p) - (d * p));
+  d = ((a - d) * (a | b)) - ((p + q) ^ (c * a));
+  a = ((q + 81) | (q - 56)) & ((b & 21) + (c - d));
+  a = ((b & p) | (q ^ 84)) | ((p * p) | (d | a));
+  if(c < b){
+    a = ((q & b) + (p ^ a)) | ((c & p) | (a | d));
+  }else{
+    b = ((c | a) | (c ^ c)) | ((b ^ b) | (p & d));
+  }
+  a = ((p ^ q) ^ (d - b)) ^ ((p | q) - (q * p));
+  for(i = 0; i < 19; i++){
+    c = ((d | c) - (p * b)) * ((d * 61) ^ (a ^ a));
+  }
+  a = ((b + 42) & (c & c)) - ((c | 3) & (d * d));
+  b = ((b | p) + (a * c)) + ((p + d) + (p - c));
+  if(b < b){
+    d = ((d - d) + (b - 99)) | ((q | q) + (p + c));
+  }else{
+    a = ((a | 94) & (a * p)) & ((b & a) * (b | q));
+  }
+  d = ((c - d) ^ (p | p)) | ((p | a) * (d - 78));
+  d = ((b + b) & (c + c)) * ((b + 9) | (q - p));
+  d = ((p - 99) | (p - p)) - ((b ^ q) ^ (a & a));
+  for(i = 0; i < 24; i++){
+    a = ((b + 98) ^ (a * 9)) * ((b + b) * (p + 60));
+  }
+  if(b < d){
+    a = ((b | 74) + (b + b)) + ((a * p) | (p | d));
+  }else{
+    c = ((d * q) ^ (c - c)) & ((d | a) | (p | b));
+  }
+  d = ((d & q) - (q ^ c)) + ((d * a) ^ (a - q));
+  a = ((q - p) + (q * q)) | ((q | q) - (a - 9));
+  a = ((b + c) * (a * d)) ^ ((q + d) - (d - a));
+  a = ((b * 11) + (c - 78)) * ((q + a) - (p & p));
+  if(a < p){
+    c = ((p & 90) & (p - d)) - ((b | b) & (d ^ q));
+  }else{
+    d = ((a - q) + (b | b)) - ((q * 38) | (a + 12));
+  }
+  for(i = 0; i < 38; i++){
+    d = ((c - b) | (p * c)) & ((q ^ a) * (b | p));
+  }
+  d = ((d | q) | (q * d)) ^ ((a + q) * (p & a));
+  d = ((d + 11) * (p & p)) ^ ((b & a) * (q - 29));
+  c = ((b ^ 71) & (p & b)) - ((d + a) | (q * c));
+  if(b < b){
+    c = ((q | 95) ^ (b * q)) * ((c & b) + (p - c));
+  }else{
+    d = ((d & 49) * (d | b)) + ((a & d) * (q ^ a));
+  }
+  c = ((c * c) ^ (a * d)) - ((a + d) & (p ^ c));
+  c = ((d + p) + (c * 57)) ^ ((q & q) + (a - b));
+  for(i = 0; i < 16; i++){
+    a = ((q * 50) + (a * 68)) * ((q - q) - (d * p));
+  }
+  b = ((b ^ 6) - (c + 75)) + ((b & p) ^ (c * q));
+  if(d < c){
+    d = ((c ^ q) ^ (q ^ b)) + ((p & q) | (b ^ a));
+  }else{
+    a = ((c ^ 42) | (c | 92)) ^ ((d & 57) * (b + 42));
+  }
+  a = ((q & p) ^ (c + 5)) + ((d & c) | (d & q));
+  a = ((d + d) + (b - d)) * ((b ^ c) | (p + a));
+  c = ((c - d) - (a ^ b)) * ((p * 11) - (b & c));
+  b = ((p * a) & (d & 26)) - ((c ^ p) & (p & d));
+  if(c < p){
+    b = ((p ^ p) & (q | b)) | ((d - d) - (q & 65));
+  }else{
+    a = ((a * 98) & (p * a)) - ((p + p) ^ (p + 80));
+  }
+  a = ((c | 33) + (b - 1)) * ((a | p) - (q * q));
+  b = ((d * a) + (q * q)) & ((a + 15) | (p + b));
+  a = ((d + a) * (q * a)) - ((d + q) ^ (a - p));
+  d = ((p * 71) - (p - p)) + ((d | q) | (a ^ 7));
+  if(d < p){
+    b = ((a ^ p) ^ (d * 82)) ^ ((a & a) + (d ^ d));
+  }else{
+    b = ((q ^ b) & (a | q)) | ((a ^ b) ^ (q | p));
+  }
+  return a + b + c + d;
+}
+
+int func16(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 8;
+  d = 28;
+  d = ((p & c) * (d ^ d)) & ((c & b) | (d + 90));
+  b = ((p + 90) & (q - 70)) - ((p & a) & (q & c));
+  b = ((a ^ b) | (c & 61)) + ((b ^ b) + (p & 32));
+  c = ((q - p) + (a - p)) + ((c & c) | (p | p));
+  if(c < b){
+    b = ((b * d) + (q ^ c)) + ((b - 6) + (a * 99));
+  }else{
+    d = ((q & d) & (a + p)) - ((q + 7) - (b & c));
+  }
+  b = ((q ^ c) + (d * d)) ^ ((c & d) ^ (b + 91));
+  for(i = 0; i < 6; i++){
+    b = ((a | b) | (p - d)) & ((q + a) * (q + b));
+  }
+  c = ((d - p) | (b - a)) ^ ((a ^ d) ^ (d - d));
+  d = ((q ^ a) * (d | p)) & ((p - p) + (a ^ 69));
+  if(a < 6){
+    c = ((a | a) ^ (d + q)) - ((q - 12) & (q & p));
+  }else{
+    b = ((a + 37) ^ (d * p)) - ((p + p) + (b + c));
+  }
+  a = ((p | 34) - (d + 23)) + ((b & 81) * (q - a));
+  d = ((b * q) | (c - c)) & ((p ^ p) + (p * 86));
+  c = ((p * c) + (p | a)) * ((c + 33) ^ (b * 28));
+  for(i = 0; i < 38; i++){
+    b = ((b + 78) + (p & 99)) * ((c ^ d) ^ (b + c));
+  }
+  if(c < p){
+    b = ((q ^ d) * (c ^ p)) * ((a & q) & (b ^ p));
+  }else{
+    d = ((d - a) + (p - c)) + ((a - c) * (d * a));
+  }
+  d = ((q | b) - (p + a)) | ((a ^ a) | (c ^ c));
+  c = ((p ^ 60) - (d * c)) - ((b & b) + (c * p));
+  c = ((b & 10) - (q + c)) - ((p - 40) + (d * a));
+  a = ((q * p) | (b * b)) - ((a - q) & (q * q));
+  if(d < b){
+    d = ((c + c) - (b & 18)) + ((b + 44) | (c * a));
+  }else{
+    c = ((d + 31) ^ (q & b)) + ((c & b) & (a - b));
+  }
+  for(i = 0; i < 11; i++){
+    b = ((c - b) | (d & 13)) & ((a * d) * (b + a));
+  }
+  a = ((q * p) | (b | d)) * ((d * a) ^ (d & c));
+  c = ((a ^ 17) * (b + 29)) * ((b | 75) - (c ^ c));
+  c = ((d & p) + (c + 98)) * ((b - 61) + (c ^ b));
+  if(c < 21){
+    b = ((q - c) + (d | a)) & ((b ^ 48) * (d & q));
+  }else{
+    d = ((q | d) | (q | b)) & ((c - 33) + (q - q));
+  }
+  d = ((c * 5) - (d - p)) + ((b & 64) - (a | q));
+  b = ((d ^ 58) + (a * 5)) ^ ((q | c) | (p & 46));
+  for(i = 0; i < 27; i++){
+    d = ((q + a) - (q * d)) - ((d & c) - (q & 78));
+  }
+  c = ((a | c) * (d & a)) * ((b + p) | (c + q));
+  if(d < b){
+    d = ((a | 3) - (a | 97)) & ((q & b) | (a ^ d));
+  }else{
+    a = ((d & d) & (d ^ d)) + ((b * q) - (q * d));
+  }
+  c = ((d & q) ^ (p ^ a)) + ((a | b) * (c * b));
+  c = ((b + c) | (c * 41)) + ((q ^ c) | (b ^ b));
+  b = ((b | p) * (a ^ a)) * ((d | p) * (b * q));
+  d = ((d | b) * (p - 54)) & ((b + 13) - (p + c));
+  if(b < 40){
+    c = ((q + 19) * (p + p)) | ((b + b) ^ (c + a));
+  }else{
+    b = ((b ^ c) | (q | b)) & ((p | a) - (a - 56));
+  }
+  c = ((d ^ p) + (c + a)) + ((a & a) | (a ^ 84));
+  a = ((b | c) & (c | 2)) ^ ((b & b) - (d & p));
+  c = ((a & q) - (q * 44)) & ((p + a) ^ (c * b));
+  d = ((b * b) ^ (p + a)) * ((q ^ 9) ^ (c ^ d));
+  if(b < q){
+    b = ((d & c) + (c + c)) + ((a - a) * (p + d));
+  }else{
+    b = ((q & c) | (p - b)) & ((b ^ q) - (b & c));
+  }
+  return a + b + c + d;
+}
+
+int func17(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 48;
+  d = 98;
+  b = ((c - q) & (q - 2)) ^ ((p * d) ^ (b | q));
+  d = ((q - d) + (q & b)) * ((p - d) & (q & q));
+  a = ((p * d) & (p + a)) + ((p ^ b) | (d * q));
+  d = ((b ^ a) ^ (q ^ d)) & ((c + d) + (c & 4));
+  if(b < a){
+    a = ((c - b) * (b | a)) | ((b & a) + (p & q));
+  }else{
+    a = ((d & 9) + (a ^ q)) + ((d | c) & (d - 69));
+  }
+  d = ((d * c) * (b + p)) & ((b ^ 33) & (p | q));
+  for(i = 0; i < 14; i++){
+    a = ((q ^ q) + (p + q)) & ((b + d) & (d & b));
+  }
+  d = ((c & 24) & (d & 41)) + ((b | p) * (a & d));
+  c = ((d & a) | (q + p)) ^ ((a & a) ^ (p - b));
+  if(b < b){
+    b = ((c - 49) & (p * q)) * ((b - 28) * (c & c));
+  }else{
+    a = ((b + c) ^ (a - b)) & ((a * c) - (c + p));
+  }
+  b = ((q | b) - (a | b)) | ((d ^ a) & (q ^ p));
+  c = ((q + d) - (c - a)) + ((d & c) + (d - 19));
+  b = ((b * 61) + (d & q)) & ((c ^ c) | (b | q));
+  for(i = 0; i < 29; i++){
+    c = ((d | a) & (b | a)) * ((d * a) - (c + 4));
+  }
+  if(b < d){
+    b = ((a & p) + (q | q)) & ((q & c) - (p - c));
+  }else{
+    c = ((q - b) - (p & 41)) + ((q + 60) - (c | 97));
+  }
+  d = ((p - p) | (c * b)) ^ ((c - c) & (a ^ p));
+  a = ((p | a) | (a * p)) | ((q + c) | (b + 81));
+  d = ((q | 35) ^ (d | b)) | ((a ^ p) + (a ^ d));
+  a = ((a | 74) & (c & b)) + ((c | 70) ^ (a ^ p));
+  if(b < 34){
+    a = ((q + q) * (b - 2)) & ((a | q) | (c + p));
+  }else{
+    a = ((b - a) + (c * 50)) * ((p - 19) + (d | q));
+  }
+  for(i = 0; i < 20; i++){
+    a = ((c ^ p) & (b - b)) + ((b & c) & (d - d));
+  }
+  c = ((q + 92) ^ (d & a)) + ((q ^ a) - (q + p));
+  c = ((b + b) - (p - c)) | ((q & q) | (a | q));
+  c = ((q & d) * (b & d)) | ((c - q) | (b + q));
+  if(a < 95){
+    b = ((p + b) | (c - c)) - ((p & 45) - (d * 54));
+  }else{
+    b = ((p + c) - (q | d)) ^ ((a * 51) * (b ^ d));
+  }
+  b = ((b * 54) + (d | c)) | ((b * a) * (q & p));
+  b = ((q - c) - (a | 37)) ^ ((d - a) - (p | q));
+  for(i = 0; i < 32; i++){
+    d = ((p - q) - (q | a)) | ((p & 50) * (d + a));
+  }
+  d = ((p | a) ^ (q * d)) + ((c - 24) * (d | p));
+  if(b < p){
+    d = ((c | q) & (q - 40)) | ((p + b) ^ (c ^ p));
+  }else{
+    a = ((c | 92) & (a + 88)) - ((d | 39) ^ (p ^ 47));
+  }
+  b = ((a - d) | (a + a)) & ((d * 55) & (p ^ q));
+  b = ((a + 83) & (q ^ 38)) + ((p * d) - (d ^ d));
+  c = ((q | q) - (d | 70)) ^ ((c * 47) & (d | b));
+  d = ((c & 14) + (c + 37)) * ((p - a) | (b * 33));
+  if(a < 50){
+    a = ((d ^ 69) * (b * b)) | ((c & b) & (a * 47));
+  }else{
+    d = ((b - b) * (d * b)) * ((d ^ c) & (p & 71));
+  }
+  c = ((c * 93) ^ (b * p)) | ((q ^ q) | (a ^ c));
+  b = ((c - p) & (c + p)) | ((b - 25) ^ (c | p));
+  a = ((q - p) + (a * b)) & ((q ^ 93) + (p ^ d));
+  a = ((b - q) + (c ^ q)) * ((b * q) + (d & 97));
+  if(d < a){
+    c = ((c | b) * (b | a)) * ((p - 72) | (b * d));
+  }else{
+    a = ((p ^ a) * (b * b)) ^ ((b - d) & (c - 54));
+  }
+  return a + b + c + d;
+}
+
+int func18(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 62;
+  d = 71;
+  a = ((a - p) ^ (d * c)) - ((c + q) - (p + 64));
+  c = ((a - c) & (p ^ b)) - ((d * c) & (d - p));
+  c = ((b * p) + (b | 63)) ^ ((d & a) + (a * c));
+  d = ((d | 43) & (d + p)) ^ ((q ^ 39) | (q & 83));
+  if(d < d){
+    a = ((p & b) * (d ^ 26)) + ((a + d) ^ (p ^ c));
+  }else{
+    b = ((c | b) * (q ^ c)) | ((b * 66) ^ (b | p));
+  }
+  c = ((d + c) + (q * a)) | ((b - c) + (a ^ c));
+  for(i = 0; i < 21; i++){
+    a = ((a + a) | (p ^ d)) | ((a * 77) + (q | 38));
+  }
+  b = ((p | 26) | (q * 35)) | ((d * q) ^ (b & b));
+  a = ((c | 4) & (d + d)) ^ ((p ^ 25) * (b ^ q));
+  if(b < b){
+    c = ((b & 60) * (p * 42)) + ((q * q) & (c + c));
+  }else{
+    b = ((a - d) + (b + d)) | ((p & b) - (b + 68));
+  }
+  c = ((p - 50) | (c | a)) + ((c | 54) & (a ^ q));
+  b = ((q & a) * (p | q)) + ((c ^ 43) & (d * b));
+  a = ((q * 71) & (q - p)) - ((b * p) & (q | b));
+  for(i = 0; i < 21; i++){
+    c = ((p * 18) * (c & q)) & ((d & d) & (a + c));
+  }
+  if(a < p){
+    c = ((c & p) ^ (q | q)) * ((c - 22) * (c - p));
+  }else{
+    d = ((p + q) | (q * c)) & ((p + a) | (a + d));
+  }
+  a = ((c - 57) - (p | b)) | ((b - c) * (q & 37));
+  a = ((b & 69) + (c ^ 18)) - ((d * d) - (b & p));
+  b = ((a | c) | (c | 68)) & ((p - a) * (q * b));
+  b = ((c | q) & (p + 67)) - ((p - p) * (a + 55));
+  if(d < c){
+    d = ((c ^ d) * (q & a)) & ((p ^ 55) & (b - c));
+  }else{
+    b = ((b & c) ^ (b - d)) | ((b + c) ^ (d & 58));
+  }
+  for(i = 0; i < 44; i++){
+    d = ((p + c) & (p ^ a)) | ((q - c) + (d * q));
+  }
+  d = ((c & a) - (a & c)) | ((b | a) + (b - c));
+  c = ((q - b) ^ (c & a)) + ((d ^ 41) | (d * 53));
+  d = ((p - q) ^ (b | a)) ^ ((d ^ c) | (d - d));
+  if(a < q){
+    a = ((p + 51) - (q + 35)) - ((d + 2) | (d + d));
+  }else{
+    b = ((d - q) * (d ^ a)) + ((d * q) * (q - c));
+  }
+  c = ((d | p) - (q + b)) - ((q & c) ^ (a * c));
+  b = ((c ^ d) * (b | 93)) + ((q * c) * (d | 88));
+  for(i = 0; i < 14; i++){
+    b = ((d | p) & (d * c)) + ((b | q) + (d | p));
+  }
+  b = ((a * 77) | (c ^ c)) & ((p & 48) ^ (d | b));
+  if(b < q){
+    c = ((a ^ c) | (a & 58)) & ((d + 62) | (a ^ 54));
+  }else{
+    a = ((a * 38) ^ (p - c)) | ((q ^ d) + (q | p));
+  }
+  b = ((b * q) ^ (c - d)) - ((d - a) - (b | q));
+  d = ((b - d) | (q ^ p)) ^ ((b - 8) | (q & 19));
+  d = ((d & 86) ^ (d ^ d)) ^ ((c | q) | (p & 56));
+  c = ((a | 75) + (p * p)) + ((c & c) & (p ^ q));
+  if(d < 30){
+    d = ((c + d) * (b - 45)) + ((b - a) * (a + q));
+  }else{
+    a = ((c * c) - (p * p)) + ((d * 95) - (d & q));
+  }
+  c = ((c * 38) - (p | p)) + ((b + q) | (c | a));
+  d = ((d + q) & (a - p)) & ((q * q) ^ (q + d));
+  a = ((b * q) & (d ^ d)) | ((q * d) & (b | c));
+  b = ((d & c) * (q & q)) * ((q & a) | (b | a));
+  if(d < c){
+    c = ((c ^ a) | (p - q)) & ((d * q) - (p | q));
+  }else{
+    a = ((a | c) ^ (d - 79)) * ((q ^ 68) & (b + d));
+  }
+  return a + b + c + d;
+}
+
+int func19(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 94;
+  d = 72;
+  c = ((q ^ c) - (b + q)) ^ ((c - 72) + (d & q));
+  a = ((d | p) & (p - c)) - ((q - b) * (q + d));
+  c = ((p - 83) & (p & p)) + ((d ^ a) * (q + 73));
+  d = ((d * q) - (d ^ c)) ^ ((p ^ a) ^ (c + d));
+  if(b < a){
+    a = ((d | q) * (p + 31)) | ((p | 97) | (q & p));
+  }else{
+    b = ((a & b) - (q & 6)) ^ ((d + a) - (d & c));
+  }
+  b = ((d - 74) * (d & a)) + ((c ^ q) * (b * b));
+  for(i = 0; i < 46; i++){
+    a = ((q | c) - (a & 27)) | ((q & d) * (b - p));
+  }
+  d = ((a | d) - (q & p)) ^ ((b - p) - (b * 27));
+  a = ((a | p) | (b - d)) | ((c - a) * (d & q));
+  if(b < c){
+    a = ((b | p) - (d | p)) | ((c * d) + (a & 30));
+  }else{
+    c = ((c - c) ^ (b - b)) * ((c * b) * (q + q));
+  }
+  a = ((q * a) * (p | c)) - ((b | b) & (a + c));
+  a = ((p ^ d) ^ (d | 18)) - ((b * d) & (c - 17));
+  b = ((a | p) | (b - p)) | ((q + b) ^ (d & a));
+  for(i = 0; i < 24; i++){
+    d = ((p ^ q) * (p - d)) ^ ((c + a) | (q * 13));
+  }
+  if(b < p){
+    c = ((p * d) & (p + b)) & ((p + d) * (d & 63));
+  }else{
+    a = ((c + p) * (c - d)) & ((q * 80) | (p * 59));
+  }
+  d = ((d ^ 65) | (p + a)) & ((c - d) ^ (b | q));
+  a = ((a & d) | (d + p)) & ((d & q) & (q | c));
+  c = ((a * p) | (q | p)) + ((d - b) * (a * 61));
+  b = ((b * d) | (c * c)) | ((c & 83) - (b + c));
+  if(d < q){
+    d = ((c & 36) | (p | d)) * ((p - 58) - (a ^ a));
+  }else{
+    c = ((a | d) ^ (a * d)) + ((p ^ q) - (q ^ a));
+  }
+  for(i = 0; i < 16; i++){
+    a = ((d * p) | (q - d)) & ((p ^ a) * (b | 14));
+  }
+  d = ((q + 92) | (c - c)) & ((a + q) + (c | c));
+  b = ((c + d) ^ (d * c)) | ((a + 44) - (c | 79));
+  a = ((p | d) + (d + 42)) - ((a & 60) + (p | c));
+  if(a < c){
+    a = ((d + a) + (c * 35)) & ((c | p) - (a ^ p));
+  }else{
+    a = ((c - d) & (p + 14)) | ((d ^ c) + (d & b));
+  }
+  b = ((b - 56) | (p + d)) + ((p * d) - (q & b));
+  d = ((b ^ 40) - (d * a)) ^ ((c ^ a) * (a - c));
+  for(i = 0; i < 3; i++){
+    a = ((q * d) & (c | d)) | ((d * b) - (p | 16));
+  }
+  b = ((a - 52) + (d ^ 73)) - ((b ^ d) & (b ^ d));
+  if(c < b){
+    a = ((d ^ d) - (a * p)) + ((c & b) ^ (a - 44));
+  }else{
+    c = ((b & d) ^ (d & b)) - ((a ^ b) ^ (d + b));
+  }
+  c = ((q - p) ^ (q ^ q)) | ((d & 90) & (d + a));
+  b = ((c + q) ^ (a & c)) - ((a - q) * (b ^ q));
+  d = ((p ^ 27) - (p * a)) & ((d + c) - (a + q));
+  a = ((c | c) + (q + 35)) & ((a ^ q) & (p ^ q));
+  if(b < c){
+    b = ((d | d) | (a + c)) & ((c - 42) + (c | p));
+  }else{
+    d = ((a * 71) - (d - 46)) + ((c ^ p) & (q - d));
+  }
+  c = ((d ^ a) ^ (q & 52)) * ((p | c) & (c * q));
+  d = ((q + 13) & (d & 9)) | ((q | a) * (d & p));
+  b = ((p - b) - (b & p)) & ((d + a) - (b + c));
+  d = ((p ^ 28) & (c + a)) | ((d * a) + (d * a));
+  if(b < p){
+    b = ((q | d) - (c + 37)) ^ ((p + p) | (d ^ a));
+  }else{
+    a = ((q - d) & (c - q)) - ((d ^ q) ^ (c | q));
+  }
+  return a + b + c + d;
+}
+
+int func20(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 57;
+  d = 60;
+  c = ((d - 71) + (b ^ c)) ^ ((p + 60) + (b * a));
+  b = ((q ^ b) | (b & 86)) ^ ((p - d) * (b + a));
+  b = ((p * q) - (a ^ c)) * ((c - 26) * (c * 82));
+  c = ((q * c) + (b - d)) & ((c * 3) & (b & c));
+  if(c < 62){
+    c = ((b - a) + (b ^ 80)) - ((c ^ a) ^ (c * q));
+  }else{
+    d = ((q * c) | (b ^ p)) & ((a | q) ^ (d ^ a));
+  }
+  b = ((p - q) & (a * q)) | ((a + a) & (d * q));
+  for(i = 0; i < 48; i++){
+    a = ((c | c) ^ (b + d)) - ((c ^ c) * (b | d));
+  }
+  d = ((b & a) * (b * p)) - ((d ^ q) | (p * p));
+  a = ((q + p) | (p ^ 80)) + ((c - 79) * (b - 49));
+  if(d < q){
+    b = ((c * c) - (p * 47)) | ((b | p) ^ (c & c));
+  }else{
+    c = ((d - d) & (d * 16)) | ((b + p) | (d ^ 2));
+  }
+  c = ((c ^ b) + (a | p)) ^ ((d + d) & (d ^ b));
+  b = ((q - b) | (q * q)) & ((c | b) + (b ^ b));
+  d = ((p | d) ^ (q - 44)) * ((d * c) + (q * b));
+  for(i = 0; i < 25; i++){
+    b = ((q & 32) - (d & 18)) * ((a + 3) & (c ^ 73));
+  }
+  if(b < b){
+    d = ((b & p) - (a & a)) - ((a + d) * (q - 80));
+  }else{
+    d = ((p | b) * (q & 52)) * ((q * d) - (c & q));
+  }
+  c = ((d | q) | (a | a)) * ((b | 65) | (p * p));
+  c = ((p | p) - (p & d)) + ((p - a) - (b ^ b));
+  b = ((c ^ b) | (d & p)) * ((a ^ c) * (c - d));
+  c = ((c & a) & (a * 59)) * ((d | c) & (d & c));
+  if(d < a){
+    c = ((p ^ p) | (c * d)) + ((a - p) | (a | p));
+  }else{
+    c = ((c - a) * (b + d)) ^ ((p + a) * (c + c));
+  }
+  for(i = 0; i < 33; i++){
+    b = ((b & d) + (a ^ q)) ^ ((q | 99) | (p & 44));
+  }
+  d = ((b & b) * (d & c)) ^ ((p * 62) + (b - q));
+  a = ((d * q) ^ (q ^ 74)) * ((b & c) * (p ^ a));
+  d = ((p + b) & (a ^ c)) | ((a ^ b) + (a + c));
+  if(b < 83){
+    d = ((a + 93) | (a - q)) | ((b ^ a) ^ (p | c));
+  }else{
+    d = ((c * c) + (c & 62)) + ((d - a) - (q | p));
+  }
+  b = ((a & d) | (b | p)) * ((b - p) + (p * d));
+  a = ((a ^ q) ^ (d & 16)) + ((c - p) ^ (a * 56));
+  for(i = 0; i < 37; i++){
+    d = ((d ^ 38) & (a | b)) & ((b - 55) * (c * 94));
+  }
+  a = ((p | c) ^ (d ^ q)) * ((d & a) + (d + p));
+  if(d < d){
+    c = ((p + 94) | (c * 6)) & ((p + p) + (q | a));
+  }else{
+    b = ((p ^ d) ^ (d | c)) + ((c | p) ^ (c & a));
+  }
+  d = ((d - p) | (q ^ a)) * ((a - d) ^ (a - c));
+  c = ((c & p) * (d & c)) * ((b - b) * (q + a));
+  b = ((d - b) + (p * b)) * ((b + p) + (c ^ p));
+  a = ((a ^ 36) + (c & b)) * ((c ^ a) - (p * b));
+  if(d < c){
+    d = ((d + q) & (a & p)) - ((b - c) - (p & d));
+  }else{
+    a = ((a & p) ^ (p | b)) | ((p * d) + (p * d));
+  }
+  a = ((b | d) * (d | p)) * ((q | p) | (q | 45));
+  b = ((q & b) + (c & d)) * ((c * b) * (a + c));
+  a = ((b + p) * (a ^ q)) - ((p + a) & (a & d));
+  c = ((d | 29) & (a & a)) + ((b + 36) & (b * a));
+  if(b < b){
+    a = ((c & 53) + (p + a)) | ((c + d) * (p ^ p));
+  }else{
+    c = ((b ^ d) - (d ^ a)) ^ ((a - 75) + (q | d));
+  }
+  return a + b + c + d;
+}
+
+int func21(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 43;
+  d = 31;
+  d = ((q * p) + (p * 70)) * ((a & p) & (d & b));
+  d = ((q & p) & (p * 77)) | ((p * p) * (b + d));
+  d = ((p - c) & (p - p)) ^ ((a & p) - (a & a));
+  b = ((q - 22) ^ (a * p)) & ((a * q) * (d + b));
+  if(a < a){
+    d = ((b + d) & (p ^ b)) + ((c | p) & (d ^ p));
+  }else{
+    d = ((c | 42) | (d | a)) + ((p ^ c) ^ (c ^ q));
+  }
+  d = ((b - 7) - (b & c)) ^ ((c + b) * (d | 38));
+  for(i = 0; i < 48; i++){
+    c = ((c | q) & (c | p)) ^ ((q ^ q) * (d & c));
+  }
+  a = ((q - 64) - (p ^ 83)) * ((p & a) ^ (b ^ d));
+  b = ((b | d) ^ (b & q)) | ((a | q) & (q + c));
+  if(d < c){
+    b = ((b - 83) - (a * a)) ^ ((a + p) * (b + 87));
+  }else{
+    a = ((d | p) * (q | p)) * ((d & 44) & (b ^ q));
+  }
+  d = ((d * a) - (a | q)) & ((q * 26) ^ (d * b));
+  a = ((b | c) | (a + p)) & ((c + b) - (a ^ 34));
+  d = ((d ^ 62) & (a ^ c)) & ((a & c) & (d | c));
+  for(i = 0; i < 48; i++){
+    d = ((a + q) ^ (a * a)) + ((a + a) - (a & 18));
+  }
+  if(b < c){
+    d = ((d - 57) | (q + a)) ^ ((p | b) | (p - d));
+  }else{
+    b = ((c + d) | (p & 63)) - ((d + c) & (b - 97));
+  }
+  d = ((b | q) | (q + p)) + ((p ^ 84) | (c | c));
+  b = ((a - 33) | (a | d)) * ((q + 90) + (b + p));
+  a = ((p & a) + (b * p)) | ((a | d) & (p * 55));
+  b = ((b | 45) + (q * c)) - ((a * 43) & (d ^ a));
+  if(b < a){
+    d = ((p * q) * (a * p)) ^ ((d - 48) & (a + p));
+  }else{
+    a = ((a * 83) & (p & 62)) & ((q + q) ^ (q & b));
+  }
+  for(i = 0; i < 20; i++){
+    a = ((c - a) + (c * q)) ^ ((a * c) * (q - d));
+  }
+  b = ((p + 34) ^ (q | 76)) & ((b ^ b) + (b + 34));
+  a = ((c * p) * (b & a)) ^ ((c ^ 26) ^ (a * p));
+  c = ((a * c) ^ (q - 54)) * ((a - q) + (d + b));
+  if(d < 29){
+    a = ((c * q) & (p * q)) * ((p - c) + (a - c));
+  }else{
+    d = ((a | c) + (c ^ c)) | ((p + 45) & (a & c));
+  }
+  b = ((p * a) & (d + a)) - ((b - q) | (a & p));
+  d = ((d & p) & (p + 86)) & ((p + 38) | (a ^ 99));
+  for(i = 0; i < 12; i++){
+    b = ((a - q) ^ (c ^ 50)) + ((q & c) - (d * c));
+  }
+  d = ((c - p) * (p | q)) - ((a - c) * (d & b));
+  if(c < d){
+    c = ((q * c) + (d + a)) ^ ((p | a) ^ (c - c));
+  }else{
+    d = ((c + q) & (b & q)) ^ ((p * 32) - (p - p));
+  }
+  d = ((p - q) & (c + b)) + ((d | q) + (d + q));
+  c = ((p * c) | (a + q)) ^ ((b & q) | (a + d));
+  c = ((c * b) + (c + q)) ^ ((c - c) | (a + c));
+  c = ((a & p) & (c * 73)) & ((q - 35) | (c ^ q));
+  if(d < 72){
+    c = ((a * c) | (c | a)) * ((a | p) - (d - 49));
+  }else{
+    d = ((a ^ 9) ^ (b ^ q)) ^ ((a ^ d) | (c - 53));
+  }
+  c = ((d | q) | (c & a)) + ((q * p) | (a + p));
+  a = ((q ^ q) ^ (a & b)) ^ ((c | q) | (c * a));
+  b = ((b - q) | (q & c)) * ((b ^ 69) - (p - q));
+  c = ((a * 69) & (p + q)) | ((b + 88) + (d ^ 65));
+  if(a < b){
+    c = ((q ^ 74) * (d & a)) + ((b | 65) - (p | q));
+  }else{
+    d = ((b - a) | (q ^ b)) + ((a ^ q) | (p & 91));
+  }
+  return a + b + c + d;
+}
+
+int func22(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 79;
+  d = 46;
+  d = ((p - 45) ^ (q | 99)) | ((p + d) - (p | p));
+  b = ((d * 57) & (b + 4)) | ((q & b) - (c | q));
+  a = ((d & 76) + (q ^ c)) - ((a ^ 66) - (d ^ c));
+  a = ((q + p) & (d - c)) & ((d * a) & (a - c));
+  if(c < q){
+    c = ((q ^ p) * (p & 86)) + ((a * 69) - (q - 61));
+  }else{
+    a = ((d & a) ^ (a | c)) * ((c ^ q) + (q + 41));
+  }
+  b = ((a + a) | (c | a)) & ((b - 67) - (d + 86));
+  for(i = 0; i < 23; i++){
+    a = ((q ^ 49) ^ (a | d)) - ((q | c) - (c | c));
+  }
+  c = ((p ^ p) - (a + q)) & ((b * 16) * (b | 68));
+  d = ((d | q) + (b | b)) - ((q ^ p) ^ (a + a));
+  if(b < c){
+    b = ((b | a) - (q + d)) + ((a | 99) * (q + b));
+  }else{
+    b = ((b + d) + (p - p)) * ((q ^ 62) ^ (p ^ 49));
+  }
+  c = ((q ^ d) * (a + 56)) + ((d & a) | (a * 9));
+  c = ((c & q) ^ (q ^ a)) ^ ((p ^ p) * (q & b));
+  a = ((c * p) ^ (d | q)) | ((p * q) ^ (p | p));
+  for(i = 0; i < 20; i++){
+    c = ((c * 14) * (c | q)) | ((p ^ q) ^ (b & a));
+  }
+  if(c < a){
+    d = ((p ^ c) | (b & p)) - ((d ^ c) ^ (a ^ 4));
+  }else{
+    d = ((b * p) | (a * 13)) * ((d ^ p) & (p & q));
+  }
+  c = ((b * 14) ^ (a ^ c)) + ((q * p) & (a + 64));
+  a = ((d | d) + (d * a)) - ((p | 77) - (q - p));
+  d = ((b * 2) & (b & a)) & ((c | a) * (p - b));
+  a = ((a ^ d) | (d | q)) * ((c - c) ^ (d | b));
+  if(d < d){
+    c = ((b + 47) + (c ^ p)) - ((d - q) | (a + 98));
+  }else{
+    c = ((q | p) + (a + p)) * ((q * 63) ^ (d ^ p));
+  }
+  for(i = 0; i < 44; i++){
+    a = ((a | c) + (q - q)) & ((a * a) | (p | p));
+  }
+  d = ((a * c) & (p - 18)) ^ ((a | c) & (b * a));
+  b = ((d ^ p) | (p + 66)) - ((a | c) | (d + b));
+  d = ((c ^ 17) | (p + d)) ^ ((a | 66) & (b + b));
+  if(a < 22){
+    c = ((d | q) | (a & a)) - ((a + a) - (p & 64));
+  }else{
+    a = ((b | 47) | (a + b)) + ((b | 2) | (q | p));
+  }
+  a = ((p ^ d) * (p ^ 11)) * ((c - 65) + (c * d));
+  c = ((d - b) ^ (p | 69)) + ((d & 45) + (b + c));
+  for(i = 0; i < 35; i++){
+    a = ((b & b) ^ (p + b)) - ((d | 79) | (p & b));
+  }
+  b = ((c | 99) | (q ^ a)) * ((b | p) ^ (a + c));
+  if(b < d){
+    a = ((b * p) | (a & a)) ^ ((p * 18) & (b - 85));
+  }else{
+    c = ((p ^ d) & (d ^ d)) & ((a + b) - (c * a));
+  }
+  d = ((c + c) & (q * 43)) ^ ((q * b) + (d - q));
+  a = ((q ^ 75) * (p | c)) ^ ((p & q) + (d * q));
+  c = ((q ^ 51) * (q + q)) ^ ((p * a) * (d * c));
+  d = ((c * d) & (d ^ 91)) | ((d & a) + (c - c));
+  if(d < 52){
+    a = ((p * d) ^ (d ^ d)) & ((c ^ a) + (b * 60));
+  }else{
+    c = ((d | a) | (q + d)) - ((q - b) - (c * d));
+  }
+  d = ((d & a) * (q ^ a)) + ((p * p) + (d | b));
+  c = ((b | 5) ^ (q & q)) ^ ((a & b) - (b | d));
+  a = ((c + 91) + (d - q)) | ((a & b) | (a ^ d));
+  b = ((p & d) - (p + b)) | ((p + q) | (b * p));
+  if(b < a){
+    a = ((b | a) * (q - q)) * ((c * p) - (d * b));
+  }else{
+    a = ((a + q) - (d ^ p)) + ((c * b) & (d ^ 18));
+  }
+  return a + b + c + d;
+}
+
+int func23(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 54;
+  d = 16;
+  a = ((b * 62) | (a ^ p)) | ((q + p) & (d + 5));
+  d = ((b ^ a) ^ (a | q)) & ((c & q) * (a * q));
+  b = ((b + a) | (p & p)) & ((c + 2) - (c + p));
+  c = ((b + p) & (c | q)) ^ ((q ^ 56) - (c * b));
+  if(b < p){
+    c = ((p * b) + (p - p)) - ((b + c) ^ (p ^ 99));
+  }else{
+    b = ((p | 91) - (q | p)) * ((c - q) ^ (p & d));
+  }
+  c = ((a & d) - (p + p)) - ((q - d) | (d ^ b));
+  for(i = 0; i < 10; i++){
+    a = ((b * p) | (d ^ 71)) | ((q - q) & (d * 68));
+  }
+  c = ((b ^ p) & (q + q)) & ((c & b) - (a * q));
+  b = ((b + d) - (q & q)) ^ ((b | d) - (p * 77));
+  if(d < 82){
+    a = ((c | c) - (q * c)) & ((p | 52) - (c - p));
+  }else{
+    a = ((a - p) + (p - 71)) & ((a * d) - (c | b));
+  }
+  a = ((a ^ p) & (q * p)) - ((b ^ q) * (d + 93));
+  b = ((c & 95) ^ (q - b)) - ((d + c) + (p | a));
+  a = ((d + d) - (a | q)) * ((c * d) | (b * p));
+  for(i = 0; i < 33; i++){
+    b = ((b ^ q) * (p ^ p)) - ((p | 29) + (c * q));
+  }
+  if(a < 34){
+    a = ((c & d) ^ (c * p)) & ((q | 30) + (p ^ 20));
+  }else{
+    c = ((c & p) ^ (a | c)) - ((p - p) | (a & 45));
+  }
+  c = ((d | p) * (b | p)) & ((a & b) & (a * p));
+  b = ((a + 29) ^ (a & a)) + ((c & 10) ^ (a - q));
+  d = ((p ^ q) + (c + 11)) * ((d * a) ^ (b - 77));
+  c = ((c & p) - (b ^ d)) + ((a ^ q) * (b ^ a));
+  if(b < q){
+    d = ((q & a) | (c * d)) * ((p + 93) ^ (p | a));
+  }else{
+    d = ((d | a) * (d + 48)) ^ ((c * p) * (a | c));
+  }
+  for(i = 0; i < 25; i++){
+    d = ((b | a) * (q ^ b)) - ((a - b) ^ (a * d));
+  }
+  a = ((p + q) - (p ^ a)) + ((a - d) + (c & 73));
+  a = ((p - p) ^ (b ^ a)) | ((p * a) * (p - c));
+  b = ((c | 72) & (q ^ d)) + ((b * 83) & (b & 10));
+  if(c < c){
+    c = ((p - c) & (a ^ q)) & ((q + d) * (a ^ 24));
+  }else{
+    a = ((a ^ 8) * (a * p)) + ((p + p) * (d & 26));
+  }
+  a = ((c * p) & (a - q)) * ((b | d) | (b - b));
+  a = ((d ^ d) ^ (p - p)) & ((a + d) + (b & p));
+  for(i = 0; i < 48; i++){
+    b = ((c - 22) * (d & d)) + ((b | d) ^ (c & 41));
+  }
+  b = ((b - 52) + (c & 41)) & ((d | c) * (q & 31));
+  if(a < 19){
+    d = ((d + q) - (a * b)) ^ ((c - d) + (p | d));
+  }else{
+    a = ((q * a) - (c ^ q)) & ((d | b) + (q * c));
+  }
+  c = ((q + p) ^ (q - q)) ^ ((q ^ c) ^ (c | q));
+  d = ((d - 67) + (q ^ 52)) ^ ((p * q) - (a - a));
+  a = ((q | q) + (a | 38)) - ((a * p) | (c + 69));
+  c = ((p | c) * (p + 18)) + ((d & q) | (a ^ d));
+  if(c < q){
+    a = ((q + p) | (q & p)) * ((d & p) ^ (d | a));
+  }else{
+    b = ((q + p) & (p | c)) | ((b | 41) + (b * 29));
+  }
+  c = ((d ^ a) | (p * a)) - ((d - 72) & (q ^ q));
+  a = ((a + 64) | (d - 18)) ^ ((p * 45) + (c | 50));
+  d = ((a * c) ^ (d & a)) + ((c & 90) * (b - 78));
+  d = ((c + a) - (a - d)) | ((c * 50) | (b - p));
+  if(a < a){
+    a = ((b ^ 46) - (d | 53)) + ((b & a) + (b + 46));
+  }else{
+    d = ((d | c) | (c ^ d)) * ((p * d) | (a ^ d));
+  }
+  return a + b + c + d;
+}
+
+int func24(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 68;
+  d = ((q ^ b) - (c - 34)) & ((q - 24) | (c * q));
+  a = ((c + 59) & (b ^ 80)) + ((b | 3) & (p - a));
+  b = ((p & 69) - (b & c)) | ((b * q) - (d * c));
+  a = ((a - d) * (q - 8)) ^ ((p * b) * (c | p));
+  if(a < a){
+    a = ((b * q) ^ (b + c)) * ((p & c) ^ (b ^ d));
+  }else{
+    b = ((q - 94) | (c | 49)) | ((c & 92) & (c | a));
+  }
+  a = ((a + c) | (q & b)) & ((a ^ a) * (c ^ 42));
+  for(i = 0; i < 19; i++){
+    b = ((c + q) + (b | p)) ^ ((d + p) - (c + q));
+  }
+  d = ((b & q) & (b & 4)) * ((d & a) * (q * d));
+  a = ((b - 89) & (c | d)) + ((c & p) ^ (p | c));
+  if(a < 17){
+    d = ((q & a) & (b | a)) ^ ((c * b) + (b | q));
+  }else{
+    a = ((a | 41) - (q | q)) * ((d & 89) ^ (c * a));
+  }
+  a = ((p - 43) + (b ^ p)) + ((q * 10) | (a * 76));
+  d = ((b & c) | (d | 15)) ^ ((a + 25) * (b ^ a));
+  b = ((a ^ b) + (q ^ c)) ^ ((p ^ d) - (p - q));
+  for(i = 0; i < 5; i++){
+    b = ((c - 18) ^ (b & c)) + ((c * p) & (c + c));
+  }
+  if(c < q){
+    b = ((p ^ b) + (b | d)) * ((b + c) | (a - a));
+  }else{
+    c = ((p * c) * (a ^ a)) + ((b * 11) + (c & 30));
+  }
+  c = ((d + q) | (q ^ 5)) | ((q + 47) + (c | a));
+  d = ((d & 78) * (q - b)) + ((p - c) | (b * q));
+  d = ((q ^ p) | (b * b)) | ((c + d) & (c * d));
+  a = ((d * 44) - (q | c)) * ((a + d) & (b * c));
+  if(c < p){
+    c = ((d & d) + (p + b)) * ((a & b) | (b | 41));
+  }else{
+    c = ((b ^ a) & (p + 46)) ^ ((q - c) + (c + a));
+  }
+  for(i = 0; i < 3; i++){
+    b = ((c ^ c) + (q ^ p)) ^ ((q & p) ^ (d + c));
+  }
+  d = ((b + 48) + (b + a)) - ((p & d) - (p | b));
+  c = ((d ^ d) | (c | p)) ^ ((d & a) | (b - 67));
+  a = ((p + q) | (p + 9)) * ((c + d) * (b - 52));
+  if(d < p){
+    b = ((a * b) & (q * q)) ^ ((d | d) | (p & 64));
+  }else{
+    b = ((d | b) & (a + 68)) + ((d & 5) ^ (b + a));
+  }
+  a = ((b * 86) | (a - p)) - ((a + 34) | (p & 15));
+  b = ((a ^ q) | (b - d)) + ((d - b) * (b * a));
+  for(i = 0; i < 50; i++){
+    c = ((c | p) - (d ^ p)) * ((q | 59) ^ (p + a));
+  }
+  c = ((q * d) | (d ^ 5)) ^ ((c * b) | (c & 87));
+  if(a < d){
+    d = ((c * 89) - (b & c)) + ((p | q) & (b + d));
+  }else{
+    b = ((c - p) ^ (b | d)) - ((p - b) + (c + q));
+  }
+  d = ((q + p) | (c + c)) ^ ((a - d) & (c + 49));
+  d = ((a - q) | (a * p)) ^ ((c * 98) + (b ^ d));
+  d = ((c & 30) - (b * p)) ^ ((b | b) ^ (d - a));
+  b = ((q + d) * (b | a)) + ((c * q) & (d ^ p));
+  if(b < 17){
+    b = ((b + 51) ^ (d - d)) & ((d + q) + (d * 92));
+  }else{
+    c = ((d * d) + (c | a)) + ((q | 14) + (q - 94));
+  }
+  c = ((p & p) ^ (d ^ d)) ^ ((c * b) | (q & 2));
+  a = ((a * 35) | (q | 85)) + ((q | p) & (p - c));
+  d = ((c | c) & (q ^ c)) * ((a ^ 55) ^ (d + 84));
+  b = ((q | c) ^ (p | p)) - ((p - q) & (p ^ 52));
+  if(c < 1){
+    b = ((c | d) ^ (c - a)) * ((c - a) | (a - 86));
+  }else{
+    a = ((d * q) + (d * 38)) | ((d & p) & (d | d));
+  }
+  return a + b + c + d;
+}
+
+int func25(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 26;
+  d = 89;
+  b = ((c + c) & (d ^ q)) - ((q - p) ^ (c & d));
+  d = ((q & p) + (q - a)) * ((b - q) + (p + a));
+  d = ((q * 91) - (d - 46)) ^ ((b | c) & (a - 5));
+  d = ((q | d) - (p + a)) ^ ((b & 34) * (b + d));
+  if(b < c){
+    c = ((p | d) | (b * b)) & ((d ^ p) & (q | 87));
+  }else{
+    d = ((q | 50) & (a * 78)) * ((c + a) & (d - p));
+  }
+  a = ((d * a) & (b - 84)) + ((b + a) ^ (p & 93));
+  for(i = 0; i < 34; i++){
+    c = ((b | b) | (b & d)) ^ ((d * 36) * (c - d));
+  }
+  c = ((b & 36) * (b - d)) | ((c ^ 16) & (c ^ b));
+  a = ((c * b) | (p + a)) - ((d + d) | (q - b));
+  if(d < 46){
+    c = ((b * c) * (p - p)) - ((a & q) ^ (b | q));
+  }else{
+    b = ((q ^ b) | (c * a)) - ((q ^ 96) ^ (a ^ q));
+  }
+  c = ((b + d) + (a - a)) | ((p ^ b) ^ (q + 21));
+  b = ((a * 61) & (c + p)) & ((p - c) & (b | q));
+  c = ((a * q) - (c ^ c)) - ((d ^ b) - (d | 42));
+  for(i = 0; i < 18; i++){
+    a = ((a * 13) ^ (b * b)) * ((b & 17) * (c & b));
+  }
+  if(b < 4){
+    c = ((p * p) * (d ^ c)) - ((d + 92) & (a + q));
+  }else{
+    b = ((d & 28) + (p ^ c)) & ((p & q) & (b & q));
+  }
+  c = ((q - d) + (d * q)) | ((p | 83) * (d - a));
+  d = ((d ^ p) + (a + q)) & ((q * a) & (q + 96));
+  b = ((c & d) | (b & 18)) ^ ((c ^ c) * (q ^ b));
+  c = ((p | c) * (a & b)) ^ ((p - d) * (c * 63));
+  if(d < c){
+    b = ((c ^ p) ^ (a | c)) * ((b + c) ^ (p + d));
+  }else{
+    b = ((q ^ a) + (c | b)) | ((b - d) | (a * a));
+  }
+  for(i = 0; i < 42; i++){
+    a = ((a & 81) * (p & 55)) & ((d & a) & (c ^ q));
+  }
+  d = ((b - c) ^ (a ^ d)) + ((p ^ q) ^ (p ^ d));
+  a = ((q * d) + (a + a)) | ((d - b) ^ (d | q));
+  c = ((b | q) & (q - d)) | ((b ^ q) * (c | q));
+  if(c < a){
+    d = ((d | b) ^ (c - b)) & ((p + 76) ^ (b | 13));
+  }else{
+    d = ((a | 83) & (p - 42)) | ((b * p) + (c - 20));
+  }
+  c = ((q + q) ^ (a & c)) - ((q | 86) - (b ^ 25));
+  d = ((p | d) + (q | c)) ^ ((q + d) | (b * 79));
+  for(i = 0; i < 44; i++){
+    a = ((c ^ 9) | (a & 42)) * ((p * 24) | (a & 71));
+  }
+  b = ((q | q) - (p * 69)) ^ ((p - q) - (q ^ c));
+  if(b < p){
+    b = ((q - q) * (b & q)) - ((c + 43) * (c * q));
+  }else{
+    a = ((p & 40) | (c | 21)) - ((d & d) + (q + b));
+  }
+  c = ((c ^ 12) & (d & 30)) ^ ((d | a) | (b | 55));
+  b = ((a * a) + (q & 19)) - ((a + 75) ^ (q ^ d));
+  d = ((c + q) & (p ^ a)) - ((d + c) - (a * 17));
+  a = ((p & b) * (b - p)) * ((b & p) - (a + p));
+  if(d < a){
+    d = ((b + a) * (b & 47)) * ((p + d) & (a & a));
+  }else{
+    d = ((d + a) | (c & 68)) + ((c * c) + (q * q));
+  }
+  c = ((a - 49) + (q ^ 39)) * ((q ^ d) | (a - q));
+  d = ((c + a) * (c | c)) - ((p - a) * (q * 32));
+  d = ((q & d) * (d ^ 47)) * ((p ^ c) & (a - 82));
+  a = ((a | b) - (d | b)) & ((d - p) - (q | b));
+  if(c < b){
+    c = ((q & b) | (q * p)) + ((c - q) & (b & a));
+  }else{
+    b = ((b & 4) - (b * a)) | ((p & a) ^ (c & q));
+  }
+  return a + b + c + d;
+}
+
+int func26(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 19;
+  d = 29;
+  a = ((p & c) & (p - b)) ^ ((a + q) & (a & a));
+  d = ((b * b) & (q * b)) - ((b & q) | (d | 90));
+  b = ((c - b) + (q & 69)) & ((p | 33) ^ (d ^ b));
+  c = ((d & 97) | (c * p)) ^ ((p ^ b) * (q ^ c));
+  if(b < 67){
+    c = ((a | 77) * (p | 49)) * ((d & 37) + (c * 25));
+  }else{
+    b = ((d - 35) + (b & p)) | ((a + b) + (p - 33));
+  }
+  b = ((b | b) - (a * 1)) & ((q - 40) * (b - c));
+  for(i = 0; i < 19; i++){
+    d = ((a | a) & (d ^ c)) - ((a | 15) & (p - 62));
+  }
+  c = ((d | c) - (q & 49)) - ((a - 73) + (a ^ d));
+  b = ((b & a) & (q ^ q)) & ((c ^ q) * (p + 43));
+  if(a < 47){
+    b = ((q * 17) ^ (c ^ p)) + ((a + b) ^ (a ^ p));
+  }else{
+    b = ((q * q) & (a + 56)) ^ ((c & c) | (d * p));
+  }
+  d = ((q | a) * (p ^ a)) - ((p * b) ^ (c - b));
+  a = ((c + 31) & (d * d)) - ((d + q) * (p | q));
+  b = ((p + 63) & (a ^ 50)) | ((p + a) * (b * b));
+  for(i = 0; i < 25; i++){
+    c = ((d - p) | (b * p)) * ((b & b) - (c | c));
+  }
+  if(c < p){
+    b = ((a + q) | (a | p)) + ((c & c) ^ (q + 82));
+  }else{
+    a = ((d | b) | (p | p)) * ((a ^ b) | (q & b));
+  }
+  a = ((p & c) ^ (c | c)) - ((d & b) ^ (q * p));
+  b = ((a + c) | (p & q)) & ((p | d) + (c + p));
+  c = ((p ^ q) + (c * 52)) - ((b * d) + (b | a));
+  d = ((c ^ a) ^ (d + 38)) * ((d * b) & (a | a));
+  if(a < a){
+    a = ((c & 87) ^ (d | 68)) - ((d + d) - (q + 95));
+  }else{
+    c = ((c | d) | (p + a)) - ((d & a) * (d - q));
+  }
+  for(i = 0; i < 20; i++){
+    b = ((p + d) & (c * c)) + ((a ^ c) ^ (q ^ q));
+  }
+  a = ((b | b) ^ (c * q)) & ((b | p) * (b & a));
+  d = ((q + 45) & (d * p)) & ((b ^ p) * (q | c));
+  c = ((b * a) ^ (d - d)) & ((q & 36) - (c + p));
+  if(b < d){
+    b = ((d ^ 17) - (q | p)) - ((b & d) | (a - b));
+  }else{
+    b = ((b & 39) * (q ^ p)) + ((p & c) | (a - a));
+  }
+  c = ((d + c) * (p * d)) ^ ((c - 40) - (q & b));
+  b = ((b | q) + (c & p)) + ((q * q) * (d - d));
+  for(i = 0; i < 7; i++){
+    b = ((b | c) - (b - p)) - ((d * c) - (d | b));
+  }
+  d = ((q & q) * (c - d)) + ((c - d) ^ (p + b));
+  if(d < b){
+    a = ((b | a) * (d | c)) + ((p ^ p) - (d + b));
+  }else{
+    c = ((c + p) + (d + d)) | ((d & p) + (c ^ 6));
+  }
+  c = ((b * c) | (c * a)) | ((d * a) * (a - a));
+  a = ((c ^ q) + (p * b)) | ((c | a) - (a * d));
+  c = ((a + b) ^ (a - 56)) | ((p - 80) | (b - c));
+  a = ((d * c) & (d ^ b)) + ((p | c) + (d & a));
+  if(a < b){
+    b = ((c & p) - (p + a)) + ((b | q) & (c * p));
+  }else{
+    c = ((q ^ d) ^ (p ^ p)) - ((p + p) - (d ^ b));
+  }
+  c = ((p - 54) - (b - c)) - ((b | 85) | (b & d));
+  a = ((p * 32) ^ (a & p)) * ((q ^ b) ^ (d ^ a));
+  a = ((q ^ p) - (a ^ p)) & ((c & a) ^ (q * 88));
+  c = ((b + a) + (p ^ c)) + ((b - p) & (q * d));
+  if(c < 30){
+    a = ((q | p) ^ (p ^ d)) + ((a ^ q) | (a + b));
+  }else{
+    c = ((b & b) | (p & d)) + ((c & 89) + (b - p));
+  }
+  return a + b + c + d;
+}
+
+int func27(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 67;
+  d = 52;
+  a = ((c + b) - (p + q)) * ((p | q) & (p & d));
+  a = ((q | d) + (b ^ a)) ^ ((b | c) & (p * p));
+  a = ((q | c) ^ (q + c)) | ((q | b) - (q | d));
+  d = ((a & 1) ^ (a - 23)) ^ ((d | a) & (a & c));
+  if(d < c){
+    c = ((c & d) | (p | 55)) & ((b - b) ^ (b ^ 81));
+  }else{
+    d = ((a * q) * (a + b)) & ((p + c) | (q + 61));
+  }
+  c = ((d * 66) * (p - q)) + ((b * 28) + (a & p));
+  for(i = 0; i < 18; i++){
+    b = ((q ^ b) * (p - q)) & ((c * d) | (c - q));
+  }
+  d = ((a * 26) | (c * a)) * ((p ^ 12) & (a ^ q));
+  c = ((c + a) * (c ^ d)) & ((p * q) | (d + q));
+  if(d < d){
+    b = ((d | p) ^ (q * 32)) * ((c * a) - (a ^ c));
+  }else{
+    b = ((b - 67) * (d ^ q)) - ((d & 2) ^ (c * a));
+  }
+  b = ((c + 59) * (a ^ a)) ^ ((d * p) + (p * d));
+  a = ((b * q) - (a | p)) - ((c - c) ^ (b | d));
+  d = ((a ^ c) & (d | d)) | ((d | a) ^ (q | q));
+  for(i = 0; i < 10; i++){
+    d = ((p | 72) - (q ^ a)) - ((b & d) - (b * 51));
+  }
+  if(d < b){
+    a = ((c + d) ^ (b | a)) * ((a | p) * (d ^ d));
+  }else{
+    b = ((d * b) ^ (b * a)) * ((q & d) | (p - q));
+  }
+  c = ((c | q) ^ (c - d)) & ((p - 45) + (p | b));
+  d = ((a - q) | (p | c)) * ((c + 34) & (a * p));
+  d = ((b - 99) & (a * p)) + ((a ^ 24) | (b * p));
+  b = ((p + 52) & (b & a)) + ((q & q) - (a + 84));
+  if(d < 33){
+    c = ((a ^ q) | (d + p)) * ((q & p) * (p & 11));
+  }else{
+    d = ((q ^ q) * (c * d)) + ((a + p) & (b ^ d));
+  }
+  for(i = 0; i < 41; i++){
+    c = ((q - a) & (d * p)) * ((b | b) + (p - d));
+  }
+  b = ((a * 70) & (d | q)) + ((c + p) & (p ^ 43));
+  a = ((p - c) ^ (q * c)) + ((c + c) + (a + a));
+  b = ((q & c) | (c ^ d)) & ((p - q) + (a * 39));
+  if(a < b){
+    b = ((b - 71) ^ (q * p)) - ((c | 88) & (b & b));
+  }else{
+    d = ((p * 69) * (c ^ q)) | ((p | p) - (b & q));
+  }
+  d = ((c | c) | (c | p)) + ((p * c) ^ (c + a));
+  d = ((b ^ 46) + (c + c)) * ((a & a) | (c * q));
+  for(i = 0; i < 46; i++){
+    b = ((q & d) * (a & c)) | ((p | 11) | (c * b));
+  }
+  c = ((d * a) + (p | a)) * ((c & p) | (p - 54));
+  if(a < 63){
+    b = ((d * p) - (p + 62)) + ((d * b) * (d | b));
+  }else{
+    a = ((b & c) | (b * 47)) - ((b * p) + (b - d));
+  }
+  d = ((c - 25) - (c + d)) & ((d ^ 9) & (c - 39));
+  d = ((b - 31) | (a * d)) ^ ((d ^ a) | (c ^ c));
+  c = ((q | 90) | (b + c)) | ((d * 47) * (b - d));
+  d = ((p - b) - (q & 93)) + ((b | c) & (q + d));
+  if(a < 12){
+    a = ((b + p) - (a * a)) - ((b - c) & (d * q));
+  }else{
+    a = ((p & 2) * (p & 10)) | ((d + 97) + (d & d));
+  }
+  b = ((q ^ q) | (d * p)) | ((p ^ p) * (d | 66));
+  d = ((c | a) - (q | p)) - ((q + q) | (p & 82));
+  d = ((a * q) * (q * b)) - ((a - b) ^ (c ^ b));
+  a = ((a ^ d) + (a ^ a)) | ((b & q) + (p * q));
+  if(c < d){
+    b = ((b - 32) - (b - q)) | ((d * 94) * (c + b));
+  }else{
+    a = ((b * 71) + (d & p)) & ((a | 64) | (c & 19));
+  }
+  return a + b + c + d;
+}
+
+int func28(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 15;
+  d = 58;
+  c = ((d ^ b) * (a + 38)) & ((d ^ q) - (q & b));
+  d = ((b * 93) ^ (p | q)) * ((b * 91) * (b & a));
+  a = ((a + d) - (c - q)) - ((c | c) ^ (d * d));
+  a = ((p & p) & (p - b)) ^ ((d * d) + (a * 4));
+  if(a < d){
+    a = ((a - p) * (d + b)) + ((a | d) | (d * 88));
+  }else{
+    a = ((a & c) - (a | b)) | ((p ^ 24) - (c | 56));
+  }
+  d = ((c - b) - (p * a)) + ((d ^ q) & (c + q));
+  for(i = 0; i < 45; i++){
+    b = ((c ^ c) * (p ^ 58)) + ((c | b) * (p + 61));
+  }
+  d = ((a - a) & (a - b)) & ((p + p) * (q ^ b));
+  d = ((c * q) ^ (d & a)) * ((d + d) * (q ^ a));
+  if(c < a){
+    b = ((c | q) ^ (a ^ a)) | ((a & p) ^ (q - c));
+  }else{
+    d = ((c & c) * (q ^ c)) & ((d ^ d) + (p ^ 28));
+  }
+  c = ((q - d) - (a ^ d)) * ((d ^ p) | (d & 41));
+  b = ((c & c) & (c | d)) ^ ((q & p) + (c & b));
+  d = ((d | d) & (c * d)) | ((q + p) - (a + 15));
+  for(i = 0; i < 25; i++){
+    a = ((b + 88) - (c - 16)) + ((p & d) & (d - b));
+  }
+  if(c < q){
+    c = ((c & 8) + (p * 96)) * ((d ^ 23) + (b & d));
+  }else{
+    a = ((p & 51) * (p ^ d)) ^ ((a * q) & (q - p));
+  }
+  c = ((d ^ c) - (b | d)) + ((q * 38) - (a - d));
+  c = ((a + b) ^ (d | c)) * ((a ^ 67) | (a & q));
+  a = ((q & 44) ^ (q & a)) * ((q - a) + (a | b));
+  b = ((c ^ a) - (q * 78)) * ((c & a) | (d ^ d));
+  if(c < 32){
+    a = ((p | c) - (p & q)) * ((d - 95) ^ (p - 23));
+  }else{
+    d = ((q ^ b) - (p | a)) & ((q & c) ^ (q * 77));
+  }
+  for(i = 0; i < 14; i++){
+    d = ((b * p) - (p | b)) ^ ((b + p) ^ (p + d));
+  }
+  c = ((p ^ 51) + (p + 54)) & ((a ^ 49) * (q + 90));
+  a = ((d & b) - (p ^ c)) | ((q * b) + (q | a));
+  b = ((c + p) & (q + a)) * ((q | b) | (p | 14));
+  if(d < a){
+    d = ((p + p) ^ (p * q)) * ((c | p) - (c & q));
+  }else{
+    a = ((a - c) - (p - p)) & ((p ^ a) * (c | b));
+  }
+  b = ((p - 44) + (p + q)) * ((d * b) ^ (p ^ c));
+  c = ((q + q) + (q * p)) - ((d + p) * (p * c));
+  for(i = 0; i < 40; i++){
+    d = ((d + d) & (p + a)) - ((c & d) - (p + d));
+  }
+  d = ((b | c) + (a | c)) ^ ((d ^ b) | (a + b));
+  if(c < p){
+    a = ((q ^ a) & (c - d)) & ((a & 16) * (d * 48));
+  }else{
+    a = ((a | c) | (d | 71)) ^ ((c * a) & (b | c));
+  }
+  c = ((a + 43) * (c & q)) | ((a & 98) + (a | p));
+  c = ((q ^ c) - (d + q)) | ((q & 13) - (p & q));
+  a = ((q | c) & (q & 40)) & ((b - d) & (c ^ p));
+  d = ((a ^ c) + (q ^ 7)) + ((d & c) - (q ^ a));
+  if(a < d){
+    c = ((d + b) * (c * 75)) + ((b - a) & (c & 92));
+  }else{
+    c = ((p + 16) - (b - d)) & ((q | b) ^ (q + c));
+  }
+  c = ((d - b) * (a + 99)) ^ ((b * a) * (q ^ d));
+  c = ((q | a) * (b & a)) & ((b ^ b) - (p * 19));
+  d = ((d * p) ^ (b - p)) * ((p & p) | (q | 30));
+  d = ((d - b) * (c & a)) ^ ((b - 26) * (a | a));
+  if(b < b){
+    a = ((d - a) - (a | 19)) | ((q - c) & (d | 90));
+  }else{
+    b = ((p ^ q) ^ (c | q)) + ((d ^ a) + (c - 15));
+  }
+  return a + b + c + d;
+}
+
+int func29(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 95;
+  d = 28;
+  c = ((d & a) + (a | q)) - ((c ^ a) - (a - 88));
+  b = ((b & d) + (d + d)) + ((c + a) & (b * b));
+  b = ((a - b) & (a ^ q)) * ((q ^ a) + (b ^ 9));
+  a = ((q - b) ^ (q - p)) ^ ((c + d) + (d + 36));
+  if(b < d){
+    c = ((a * q) - (b + c)) & ((d * a) | (c & 70));
+  }else{
+    a = ((c ^ 88) - (d * p)) & ((q * c) & (p ^ q));
+  }
+  b = ((a + 83) * (b & q)) + ((d | a) + (q ^ c));
+  for(i = 0; i < 9; i++){
+    c = ((p * b) - (p * d)) | ((c - b) * (d ^ 69));
+  }
+  b = ((a | p) + (p - 3)) ^ ((a - 9) * (b ^ 90));
+  a = ((d + d) ^ (c ^ 10)) & ((b - p) - (c * 65));
+  if(d < b){
+    b = ((p - c) * (q | c)) * ((c & b) + (q + c));
+  }else{
+    d = ((q + q) | (p | p)) + ((b & d) + (a ^ 83));
+  }
+  c = ((p + p) + (p ^ d)) + ((p * 64) - (a + 82));
+  d = ((d ^ 95) & (d - a)) * ((p | p) | (a - q));
+  b = ((q - d) & (p + d)) ^ ((p ^ b) & (c | c));
+  for(i = 0; i < 35; i++){
+    a = ((p + d) + (c ^ 93)) - ((a & 64) + (q | p));
+  }
+  if(b < c){
+    c = ((d | 7) | (d & 63)) + ((c | b) - (a * c));
+  }else{
+    a = ((p ^ a) - (c - 86)) | ((q | 63) - (p | 95));
+  }
+  d = ((p & d) + (b ^ q)) - ((d | d) * (q | c));
+  a = ((d & 27) ^ (p + d)) - ((a | b) * (q ^ d));
+  c = ((c * q) ^ (p * 73)) - ((a & b) | (p | q));
+  c = ((a - 67) + (a * 47)) ^ ((d - p) ^ (q & p));
+  if(b < q){
+    d = ((d - q) ^ (p | a)) * ((d - d) & (a - p));
+  }else{
+    d = ((c - 81) * (c - p)) + ((b | c) - (p | q));
+  }
+  for(i = 0; i < 46; i++){
+    a = ((a ^ c) * (p | p)) * ((d * q) & (a & d));
+  }
+  d = ((q - b) * (p + a)) | ((d | p) ^ (q - p));
+  b = ((p | a) - (a ^ q)) | ((a & p) ^ (a ^ q));
+  b = ((c | p) - (c - c)) ^ ((a & a) | (p & q));
+  if(c < p){
+    d = ((q + a) + (c & c)) | ((c | d) + (b * q));
+  }else{
+    a = ((a - c) | (c ^ q)) ^ ((p + q) & (d - d));
+  }
+  b = ((p ^ q) * (b & c)) - ((p & p) + (c & q));
+  b = ((c + 16) & (a + b)) & ((a * c) ^ (d | a));
+  for(i = 0; i < 37; i++){
+    c = ((d ^ a) ^ (q - a)) | ((b | c) - (q & d));
+  }
+  a = ((c - a) + (p * b)) ^ ((a ^ b) & (p ^ d));
+  if(c < 35){
+    c = ((c ^ 3) ^ (b * 72)) - ((b ^ b) | (d + a));
+  }else{
+    d = ((q & a) | (a | 28)) - ((b + c) & (d ^ 37));
+  }
+  c = ((a ^ 77) & (q | p)) + ((q & 60) & (p ^ q));
+  c = ((d | d) - (d + b)) & ((p + c) | (p * c));
+  d = ((q | b) - (p - q)) & ((p | p) & (b * a));
+  d = ((a * c) ^ (q ^ 18)) * ((p & c) + (c & 30));
+  if(b < 7){
+    c = ((q ^ 72) - (a ^ p)) + ((q ^ 18) & (b - p));
+  }else{
+    b = ((q & q) + (q & b)) & ((p * q) + (c - b));
+  }
+  d = ((q ^ b) + (d * 36)) + ((b - c) & (d + 99));
+  a = ((p * q) ^ (a ^ q)) + ((c * q) ^ (p & a));
+  b = ((b + b) | (q & p)) | ((p + p) + (b + 44));
+  c = ((b | 46) ^ (a * a)) - ((d - 69) - (a ^ p));
+  if(b < 70){
+    c = ((b & b) ^ (p - c)) ^ ((b ^ 42) * (d + c));
+  }else{
+    d = ((c ^ 33) & (p & 79)) ^ ((d & c) + (c * p));
+  }
+  return a + b + c + d;
+}
+
+int func30(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 11;
+  d = 47;
+  d = ((c + a) - (q | 69)) * ((c * b) * (q | b));
+  a = ((b + c) - (d + p)) * ((p - 65) - (c | q));
+  d = ((c ^ a) | (p - p)) - ((c & a) * (c + c));
+  d = ((p ^ q) - (d - 70)) & ((d * b) * (a | 48));
+  if(c < d){
+    a = ((c * b) + (c ^ b)) - ((c * b) + (c + 50));
+  }else{
+    a = ((c * a) ^ (a | p)) + ((a - a) * (a & 76));
+  }
+  c = ((c | a) | (a & 55)) + ((q * d) & (q | a));
+  for(i = 0; i < 46; i++){
+    a = ((q - 33) ^ (c ^ 56)) * ((q - 79) * (a + p));
+  }
+  c = ((b ^ d) - (d | q)) & ((b + 66) ^ (p | a));
+  c = ((c + c) ^ (c & b)) & ((b + d) * (d - c));
+  if(d < a){
+    c = ((p | q) + (c + 3)) - ((a * d) & (c & 98));
+  }else{
+    c = ((d * c) ^ (a & p)) | ((c & q) | (q & 45));
+  }
+  b = ((a & d) & (a * c)) - ((c * d) - (c & 59));
+  d = ((q + q) * (a + d)) & ((b - d) ^ (c & q));
+  a = ((a * b) - (c & a)) & ((d - q) * (c * p));
+  for(i = 0; i < 47; i++){
+    c = ((c ^ b) - (p - a)) & ((b * p) - (a - 55));
+  }
+  if(a < p){
+    b = ((d ^ 93) * (p * p)) ^ ((c * 32) | (a ^ 91));
+  }else{
+    d = ((b ^ q) & (p * a)) ^ ((d ^ q) ^ (b ^ q));
+  }
+  a = ((a | 63) - (b & c)) ^ ((q ^ b) | (d | 64));
+  c = ((p | c) | (q & c)) | ((b * 79) + (b & a));
+  c = ((a * q) ^ (b * a)) | ((p * d) & (b * c));
+  a = ((b * a) + (p - a)) | ((c - c) + (q & q));
+  if(b < p){
+    c = ((a + a) * (a + c)) & ((p + 89) + (c & b));
+  }else{
+    c = ((p ^ b) | (p | 35)) + ((q ^ q) - (a * d));
+  }
+  for(i = 0; i < 45; i++){
+    c = ((b ^ b) ^ (p * b)) | ((q * q) & (p ^ a));
+  }
+  c = ((p | p) + (c & b)) & ((q * d) | (p - c));
+  c = ((p * b) * (c + 43)) * ((a | q) ^ (c - 45));
+  a = ((b - a) + (c * a)) + ((q + b) & (p ^ q));
+  if(c < 66){
+    a = ((c & d) ^ (q | 48)) + ((p + 51) * (a + 90));
+  }else{
+    a = ((q * p) ^ (q + q)) & ((d & 61) - (p - 24));
+  }
+  d = ((d * p) & (a ^ d)) ^ ((c | b) * (a | a));
+  b = ((p + 78) - (d ^ b)) - ((b - b) & (a | c));
+  for(i = 0; i < 13; i++){
+    b = ((c ^ 28) - (b - a)) - ((a & a) + (b | p));
+  }
+  c = ((c | 13) * (c - d)) + ((a & c) | (p - 17));
+  if(d < b){
+    d = ((b + d) & (a - d)) ^ ((p ^ d) & (b + c));
+  }else{
+    d = ((b * 57) ^ (a - a)) & ((a & c) & (p | c));
+  }
+  c = ((b | 12) ^ (p | 40)) - ((b | c) - (d | b));
+  a = ((p & q) + (b - q)) & ((c | q) & (q | c));
+  d = ((b & d) | (c & 68)) | ((a * d) + (d | b));
+  c = ((a * q) & (q * d)) ^ ((d + 10) | (d * a));
+  if(d < d){
+    c = ((c * p) * (b ^ p)) - ((a | c) - (c - p));
+  }else{
+    b = ((p * 51) ^ (a + 47)) + ((c | d) & (a ^ d));
+  }
+  c = ((b - d) & (b * c)) - ((q + b) | (q ^ 55));
+  c = ((d & p) + (a ^ p)) & ((p ^ 51) - (a & d));
+  a = ((p | c) - (q + d)) * ((d * 53) & (c & p));
+  a = ((d ^ a) ^ (a & d)) | ((c ^ b) - (p * c));
+  if(d < a){
+    d = ((p * p) - (d & 11)) & ((q | q) | (a * c));
+  }else{
+    a = ((p & 60) + (a * q)) * ((p ^ p) * (a - 3));
+  }
+  return a + b + c + d;
+}
+
+int func31(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 16;
+  d = 45;
+  b = ((c | d) * (c ^ b)) + ((c + c) - (b + a));
+  c = ((b & a) | (b * 44)) ^ ((p & p) * (p ^ c));
+  a = ((p * b) + (a + 98)) + ((a + c) | (q & c));
+  a = ((b | p) ^ (c + 94)) & ((c - 51) * (c + 23));
+  if(c < d){
+    b = ((a + 6) + (a * 59)) - ((d + a) * (a + a));
+  }else{
+    b = ((a * q) | (p ^ d)) | ((d - 17) ^ (c | 81));
+  }
+  d = ((b + a) | (a ^ p)) | ((b | 10) & (c + a));
+  for(i = 0; i < 28; i++){
+    d = ((d & 62) - (p | q)) ^ ((p | 89) | (b ^ 67));
+  }
+  a = ((a + d) - (a - a)) ^ ((p - 53) + (d + 30));
+  d = ((d + a) ^ (a & 11)) & ((a & p) | (c - p));
+  if(c < p){
+    c = ((c & 15) | (c & q)) & ((p & 62) | (b * d));
+  }else{
+    c = ((q * c) | (c + d)) - ((d ^ q) | (p + 63));
+  }
+  a = ((a - q) & (d + 78)) ^ ((a * b) - (b | d));
+  c = ((b & a) - (b + q)) ^ ((p + 87) | (q + c));
+  c = ((q & 19) | (q * c)) - ((c & a) * (a + q));
+  for(i = 0; i < 36; i++){
+    d = ((p - q) & (d | 64)) & ((q + q) & (q & a));
+  }
+  if(d < p){
+    a = ((p * 88) - (a ^ b)) - ((p + q) & (b & b));
+  }else{
+    c = ((p + c) | (b & d)) ^ ((b + a) + (b * a));
+  }
+  b = ((c - b) * (d ^ c)) | ((q | d) ^ (q - b));
+  d = ((a & b) ^ (p | d)) | ((p - p) ^ (q & a));
+  b = ((p | p) + (p - 5)) - ((q * b) | (a * d));
+  b = ((q - a) - (q + 17)) + ((c ^ 74) ^ (d & p));
+  if(d < d){
+    d = ((p + d) & (p + c)) & ((b & p) + (a + q));
+  }else{
+    c = ((a + 89) ^ (d - 63)) * ((q | a) * (a - d));
+  }
+  for(i = 0; i < 18; i++){
+    a = ((b & p) + (p - d)) - ((b * d) + (b + 37));
+  }
+  a = ((c + 21) + (b + p)) - ((d - c) | (p | b));
+  b = ((q & q) | (b - p)) | ((q + 28) | (d * b));
+  d = ((a & c) & (q & a)) ^ ((a + c) | (c - q));
+  if(a < 77){
+    b = ((q - b) | (a * 71)) - ((p + 79) * (d + 61));
+  }else{
+    c = ((p | 26) | (a * b)) * ((b - p) + (p | d));
+  }
+  b = ((a & c) | (q - c)) - ((d + 35) - (q - a));
+  a = ((q - 48) + (c & 66)) | ((p - c) + (b * 3));
+  for(i = 0; i < 40; i++){
+    d = ((c * q) * (a - p)) & ((d - q) ^ (a - 39));
+  }
+  a = ((a + p) - (q - c)) * ((p * 65) ^ (a * 84));
+  if(c < 67){
+    c = ((q ^ c) + (d ^ b)) | ((b * d) ^ (a + 72));
+  }else{
+    c = ((b * d) * (c ^ 12)) ^ ((d + 89) + (c | p));
+  }
+  b = ((a + p) + (c + 89)) ^ ((c + p) | (a - c));
+  b = ((q * 4) * (q ^ d)) * ((c ^ b) ^ (a + b));
+  b = ((p + d) & (c & c)) * ((c ^ p) | (d & q));
+  c = ((p - a) | (q + b)) * ((d + p) ^ (p & d));
+  if(c < b){
+    b = ((a * 9) * (q & c)) & ((p & a) | (b - b));
+  }else{
+    b = ((a & q) ^ (d | a)) ^ ((q - b) ^ (b * a));
+  }
+  d = ((q - d) - (d * 39)) & ((c | 93) - (d * 7));
+  a = ((d | c) ^ (c ^ a)) - ((a & c) + (c + 30));
+  c = ((b | b) & (p * c)) | ((a + 76) * (c & q));
+  b = ((p | 98) ^ (c | 79)) & ((c * c) ^ (c - q));
+  if(c < 93){
+    b = ((p & a) * (b - b)) * ((p | 58) ^ (a - b));
+  }else{
+    b = ((p + q) * (p + a)) ^ ((b + p) + (a - d));
+  }
+  return a + b + c + d;
+}
+
+int func32(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 69;
+  d = ((c - d) + (q & d)) + ((c - c) * (c + a));
+  c = ((c - 14) | (b | 27)) ^ ((d & c) & (d - 64));
+  a = ((q | p) + (c | 88)) + ((p - 79) ^ (q & p));
+  b = ((a ^ b) - (c ^ b)) ^ ((p * d) + (c * b));
+  if(c < a){
+    a = ((q & 22) - (q * q)) | ((q - p) - (a - q));
+  }else{
+    c = ((c - d) | (a + 96)) - ((a + q) - (b | 86));
+  }
+  b = ((q + q) * (d & a)) ^ ((b - q) | (a + b));
+  for(i = 0; i < 45; i++){
+    d = ((a | c) + (d & d)) + ((c & a) * (a + a));
+  }
+  b = ((p * q) - (c * a)) & ((p & q) ^ (d | q));
+  b = ((q ^ 42) * (q * a)) ^ ((p - b) ^ (d - d));
+  if(d < 48){
+    a = ((d ^ c) - (a + 18)) | ((a - p) & (p & d));
+  }else{
+    a = ((c & c) * (q * 66)) - ((p ^ b) * (d - 7));
+  }
+  c = ((c & 85) & (c ^ c)) | ((c - 82) & (b - p));
+  d = ((c ^ 85) - (b - b)) ^ ((p | b) - (d ^ p));
+  a = ((b ^ q) | (c | a)) | ((a & c) + (q & c));
+  for(i = 0; i < 11; i++){
+    a = ((a * b) + (c & 4)) & ((d - 37) & (c & a));
+  }
+  if(a < d){
+    d = ((q - b) - (p & p)) - ((b - p) & (q + b));
+  }else{
+    a = ((a & a) + (a | a)) - ((q | b) - (q + c));
+  }
+  c = ((b * q) + (q * b)) - ((p | a) - (p & 22));
+  b = ((d & p) - (a * q)) & ((a - d) * (b * 30));
+  c = ((p + c) & (q & q)) - ((c + p) ^ (q ^ 53));
+  c = ((a * a) | (a + p)) | ((p | p) * (p * 58));
+  if(b < p){
+    d = ((p ^ 39) & (c | b)) ^ ((q ^ c) | (b - q));
+  }else{
+    b = ((p | c) * (d | q)) * ((a | d) ^ (c ^ p));
+  }
+  for(i = 0; i < 9; i++){
+    d = ((p | b) + (q + a)) - ((b & 9) * (d ^ 23));
+  }
+  c = ((c - p) | (c + a)) + ((c + 4) & (d ^ 59));
+  a = ((a | p) | (a - q)) ^ ((d - q) + (b & c));
+  d = ((b ^ b) ^ (b - 36)) * ((b - 56) - (b & p));
+  if(c < 27){
+    a = ((b * c) * (d ^ 26)) | ((d & p) * (a & 91));
+  }else{
+    d = ((a ^ a) + (d * 65)) ^ ((d ^ 42) ^ (c * d));
+  }
+  a = ((a + c) & (b - q)) + ((p | q) * (p * 48));
+  c = ((p - c) ^ (c | q)) - ((a - a) + (q - c));
+  for(i = 0; i < 35; i++){
+    c = ((a ^ 96) ^ (c & p)) * ((a | a) + (c | d));
+  }
+  d = ((d + b) & (b | c)) - ((q + q) ^ (a * q));
+  if(a < 70){
+    d = ((q | d) * (c * d)) + ((b & a) | (a * p));
+  }else{
+    d = ((b ^ a) | (c - a)) & ((d ^ a) * (b & a));
+  }
+  a = ((a - p) - (a | c)) | ((b + 62) * (c | q));
+  a = ((c | q) | (p ^ 15)) ^ ((b + c) ^ (q ^ 63));
+  c = ((p + b) * (p | p)) - ((a - q) | (c * c));
+  c = ((c * p) & (b + a)) & ((a ^ 96) & (p | 45));
+  if(b < 77){
+    b = ((c ^ q) | (p & d)) - ((c | q) * (q | 39));
+  }else{
+    d = ((c - b) - (b * q)) & ((d & p) | (a + p));
+  }
+  b = ((d & 67) ^ (p | p)) - ((b & 84) - (b - q));
+  b = ((c & b) * (b - a)) & ((d - a) + (b - c));
+  c = ((p ^ c) ^ (d & p)) + ((b + c) & (q & a));
+  b = ((a | b) | (q - c)) + ((c - a) ^ (b ^ a));
+  if(a < b){
+    d = ((q - 60) - (b | p)) & ((d * 80) - (a ^ p));
+  }else{
+    c = ((q - q) ^ (p ^ q)) ^ ((c | b) | (c * p));
+  }
+  return a + b + c + d;
+}
+
+int func33(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 84;
+  d = 63;
+  c = ((c + a) & (a + 51)) + ((b - q) & (c - 1));
+  b = ((a ^ q) | (d * b)) + ((q ^ 14) | (c + b));
+  c = ((c * p) ^ (p & b)) | ((d - d) - (d & 3));
+  d = ((d + b) ^ (c | b)) * ((p - d) ^ (b | c));
+  if(c < b){
+    d = ((c | 92) * (c ^ b)) - ((b | p) & (p & q));
+  }else{
+    b = ((a & p) & (c * 40)) | ((d + b) - (p | 32));
+  }
+  b = ((d + c) ^ (p ^ c)) ^ ((d - p) + (q * p));
+  for(i = 0; i < 38; i++){
+    d = ((q & b) * (q | a)) - ((c & a) - (q - 39));
+  }
+  b = ((p * p) * (a | 92)) | ((b | d) - (b & p));
+  d = ((d & b) | (p * d)) * ((c | c) | (q - 75));
+  if(a < 23){
+    a = ((c & 97) * (c - a)) - ((d ^ c) * (q + p));
+  }else{
+    b = ((q * a) ^ (a + 19)) + ((d | b) + (b | d));
+  }
+  b = ((a * a) & (c & 9)) ^ ((q | q) + (d - d));
+  d = ((a + c) ^ (a - b)) | ((d & c) * (q | 58));
+  b = ((d - p) * (d + 54)) - ((d ^ b) * (p | p));
+  for(i = 0; i < 33; i++){
+    c = ((a ^ 22) ^ (p + 36)) & ((a ^ b) & (d + p));
+  }
+  if(c < 9){
+    b = ((a + c) | (q * 7)) | ((p - q) ^ (c | p));
+  }else{
+    b = ((d | p) ^ (a | d)) * ((a ^ b) ^ (d * a));
+  }
+  b = ((a ^ 56) * (a - a)) - ((b + c) | (q - q));
+  c = ((q & c) - (p ^ q)) - ((d ^ d) ^ (b | p));
+  c = ((p * q) & (p | b)) | ((a & p) ^ (d & 91));
+  b = ((a - 35) * (a + 62)) + ((p ^ p) & (d ^ q));
+  if(b < d){
+    a = ((p * b) * (a | 83)) ^ ((c | d) * (q - d));
+  }else{
+    b = ((p | p) + (c + c)) & ((p + 31) | (d - d));
+  }
+  for(i = 0; i < 15; i++){
+    a = ((q ^ 63) ^ (c - p)) & ((q * d) ^ (b ^ q));
+  }
+  a = ((b - c) * (p & b)) & ((c * p) | (c + p));
+  b = ((d + p) - (b ^ q)) ^ ((d + p) - (p * 97));
+  d = ((p & 7) * (b - d)) * ((a + c) ^ (q + p));
+  if(c < q){
+    d = ((b - 84) | (p | q)) | ((p & c) + (p * a));
+  }else{
+    d = ((d - q) + (c ^ 12)) + ((p | b) - (a | a));
+  }
+  c = ((b + b) & (q ^ 78)) + ((b ^ 22) + (q - p));
+  d = ((b & 18) - (b - b)) | ((b ^ b) & (a | a));
+  for(i = 0; i < 32; i++){
+    d = ((p ^ d) & (a * p)) - ((d + a) - (q + p));
+  }
+  b = ((c ^ p) & (c - 48)) - ((p - q) + (c - 18));
+  if(b < 79){
+    c = ((q ^ b) * (a & a)) | ((a & a) & (d & p));
+  }else{
+    c = ((q + p) | (a & q)) & ((q * 64) + (d & 72));
+  }
+  d = ((d * q) | (a ^ 58)) | ((p + 79) - (d * a));
+  b = ((q * b) ^ (b | p)) + ((q * p) - (c - b));
+  c = ((d & a) * (d | p)) - ((c | p) + (a & p));
+  a = ((c + p) + (d * c)) + ((c | q) | (c ^ b));
+  if(a < p){
+    a = ((b - b) * (a + 41)) * ((a & b) + (p & 19));
+  }else{
+    b = ((q - b) - (p ^ d)) - ((p & a) + (q + d));
+  }
+  c = ((b + p) & (a * q)) - ((p + c) & (d ^ q));
+  a = ((d | 41) | (a - 44)) ^ ((q * q) - (c - 71));
+  a = ((d & 56) & (a + 90)) * ((b + p) - (p ^ d));
+  d = ((c - c) + (a - 80)) + ((d * b) ^ (d | 90));
+  if(a < q){
+    c = ((d + 38) | (d & b)) - ((c - c) - (d ^ b));
+  }else{
+    b = ((b - 74) ^ (q + d)) * ((d + p) - (b * a));
+  }
+  return a + b + c + d;
+}
+
+int func34(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 59;
+  d = 73;
+  c = ((p & d) + (p + p)) & ((p + a) | (b - b));
+  a = ((c * b) & (c | q)) | ((c - 36) * (d - 41));
+  d = ((q * a) - (b + d)) ^ ((c & d) & (p - 3));
+  c = ((d - b) + (d * d)) + ((c - b) * (q & d));
+  if(b < q){
+    b = ((p + 18) ^ (d * 46)) - ((d * p) | (d - p));
+  }else{
+    d = ((c & 5) * (q ^ 22)) * ((q & b) & (c & d));
+  }
+  a = ((a + 20) ^ (p - 6)) - ((b | p) * (q ^ b));
+  for(i = 0; i < 16; i++){
+    b = ((a + c) ^ (c - c)) + ((q + p) - (b & b));
+  }
+  a = ((d + b) ^ (c + b)) + ((a * q) ^ (d * d));
+  c = ((d | 17) ^ (c | c)) * ((b + 80) - (q ^ 80));
+  if(d < c){
+    d = ((c | c) & (b + p)) ^ ((q + c) | (d & b));
+  }else{
+    b = ((b & 4) | (c + d)) - ((a ^ a) - (a * 4));
+  }
+  c = ((q * c) & (d | b)) * ((d * q) | (c - c));
+  c = ((a + c) | (q ^ 87)) * ((a * a) - (b + 98));
+  b = ((a + d) - (p ^ c)) & ((c | p) | (q - d));
+  for(i = 0; i < 6; i++){
+    c = ((p + a) | (c ^ c)) + ((a ^ a) ^ (c + b));
+  }
+  if(d < 47){
+    c = ((c | b) ^ (d ^ p)) * ((b | d) | (p | d));
+  }else{
+    a = ((a & d) & (a | c)) + ((b & b) ^ (c * a));
+  }
+  a = ((b - d) + (a | 8)) & ((b | 61) + (b * q));
+  a = ((q | 36) | (p & c)) + ((p * d) - (b & d));
+  c = ((p ^ p) | (d ^ b)) * ((d - d) & (p + 82));
+  d = ((b & p) * (q - p)) & ((p + a) ^ (c + c));
+  if(c < q){
+    a = ((a - c) + (p + c)) * ((a - p) ^ (a | a));
+  }else{
+    b = ((d | q) * (d - 51)) * ((p - 84) ^ (c ^ c));
+  }
+  for(i = 0; i < 8; i++){
+    b = ((c ^ a) * (c * 3)) | ((a + b) ^ (b | c));
+  }
+  c = ((a + 19) ^ (a | a)) - ((d - d) ^ (q | c));
+  d = ((p + d) | (b & 93)) ^ ((b | 30) ^ (c - 14));
+  c = ((c | a) ^ (q - a)) | ((p ^ b) + (c - a));
+  if(c < c){
+    c = ((c * d) & (a + p)) - ((d - p) & (b * c));
+  }else{
+    a = ((a - a) + (a - b)) ^ ((d & 74) | (a ^ p));
+  }
+  c = ((c & d) * (a * d)) & ((b ^ a) ^ (p ^ a));
+  a = ((q & 23) ^ (q ^ 12)) & ((c - a) - (a * 52));
+  for(i = 0; i < 20; i++){
+    d = ((p ^ 70) + (p & a)) ^ ((b * a) * (b * 45));
+  }
+  b = ((b ^ q) * (q & 38)) - ((q - 40) * (d | d));
+  if(a < q){
+    a = ((a & b) & (b + c)) ^ ((a - 55) | (p | a));
+  }else{
+    d = ((c - c) ^ (a & 83)) - ((a - b) | (b ^ a));
+  }
+  c = ((q + 81) ^ (p | 42)) | ((a ^ 89) + (a + c));
+  c = ((q * c) + (d * 95)) - ((p ^ 89) - (p - q));
+  b = ((b | q) | (c ^ b)) & ((c & 50) ^ (c | 79));
+  d = ((d ^ c) * (a ^ c)) - ((a * 83) | (p | 5));
+  if(c < a){
+    b = ((b | c) ^ (a * 54)) + ((b | q) & (a & d));
+  }else{
+    c = ((c & b) - (p - 53)) + ((a ^ d) - (a - c));
+  }
+  d = ((p - q) | (p | b)) | ((q * 93) ^ (c * b));
+  a = ((d | c) - (p & a)) - ((q | d) ^ (c - c));
+  b = ((p - c) + (a + d)) - ((c & p) + (c & q));
+  a = ((c ^ b) & (q | a)) ^ ((p & c) | (b ^ a));
+  if(b < b){
+    b = ((a + a) + (d - 28)) - ((d ^ c) & (q | a));
+  }else{
+    c = ((c & 26) & (b * 79)) ^ ((a | d) | (a | p));
+  }
+  return a + b + c + d;
+}
+
+int func35(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 1;
+  d = 6;
+  c = ((a | q) + (b - p)) | ((q | d) * (b * q));
+  b = ((p - c) & (a * c)) - ((c ^ q) * (d | c));
+  c = ((a + b) * (b * 49)) - ((b | b) - (q + p));
+  d = ((q + 89) - (d * d)) - ((q ^ p) ^ (a + d));
+  if(d < q){
+    d = ((d - c) - (d ^ 96)) & ((a | b) ^ (d | q));
+  }else{
+    a = ((p & b) ^ (p - c)) * ((p * b) & (q + p));
+  }
+  a = ((p ^ a) + (p | 67)) ^ ((b * b) * (p * d));
+  for(i = 0; i < 23; i++){
+    c = ((c ^ c) & (q * d)) - ((p * c) & (b & c));
+  }
+  c = ((c * c) ^ (a * q)) * ((q + 20) * (a + a));
+  a = ((q - p) | (a * 62)) + ((d ^ c) ^ (b ^ p));
+  if(b < p){
+    b = ((q * c) | (b - p)) - ((b & a) + (b ^ d));
+  }else{
+    d = ((d - 12) ^ (d | d)) * ((q ^ q) ^ (a * p));
+  }
+  d = ((d + q) | (d ^ c)) ^ ((b - 44) + (q & p));
+  c = ((d * a) * (p | p)) | ((a | 42) & (q + 96));
+  a = ((q - d) * (p | c)) & ((q + 1) ^ (c | b));
+  for(i = 0; i < 4; i++){
+    d = ((p & 61) | (q - d)) | ((c * q) | (q - p));
+  }
+  if(a < 2){
+    a = ((b * b) & (d + c)) * ((c * a) * (q + b));
+  }else{
+    a = ((c & 79) * (p | a)) | ((p * b) & (d + p));
+  }
+  b = ((d * q) * (c ^ q)) & ((q ^ q) + (b + 85));
+  a = ((b ^ p) | (b - 50)) - ((p - d) * (a ^ d));
+  b = ((d & p) | (c - 48)) + ((b & b) * (b | a));
+  c = ((b + 44) | (b & d)) + ((c - a) ^ (a | 49));
+  if(a < 40){
+    c = ((a + c) ^ (b * b)) & ((b ^ b) | (a ^ d));
+  }else{
+    c = ((b | c) | (d ^ d)) & ((c * a) + (d & p));
+  }
+  for(i = 0; i < 20; i++){
+    b = ((p - d) ^ (p | 97)) ^ ((q - q) + (b + q));
+  }
+  d = ((p ^ c) + (p ^ a)) * ((a & q) + (d ^ b));
+  c = ((a & b) * (q & 49)) | ((c * p) ^ (p - 40));
+  b = ((c | b) * (d ^ d)) & ((a ^ c) ^ (a + d));
+  if(c < a){
+    a = ((c & 87) | (p * p)) + ((d + a) & (p ^ 41));
+  }else{
+    b = ((a & 95) - (b * c)) * ((a & 74) ^ (q & q));
+  }
+  a = ((q & c) + (a + p)) - ((c - a) * (b + p));
+  a = ((p * q) ^ (d & q)) - ((c + b) | (b * d));
+  for(i = 0; i < 31; i++){
+    d = ((b + 96) + (b * d)) ^ ((b * q) & (b * c));
+  }
+  b = ((a - c) ^ (p | a)) - ((b + b) - (d - c));
+  if(c < p){
+    a = ((b & a) * (p | q)) ^ ((q - b) * (p & 35));
+  }else{
+    d = ((q * b) ^ (b & q)) & ((p & q) & (b + d));
+  }
+  b = ((b * q) & (c - a)) * ((c - 4) & (a ^ q));
+  b = ((p & c) & (p * a)) & ((a * a) & (p | 48));
+  a = ((q * q) & (b & a)) - ((b + d) | (b + c));
+  c = ((d * p) * (c & p)) - ((c - c) * (d * a));
+  if(d < 24){
+    c = ((d - a) - (d * c)) | ((q - d) & (p ^ a));
+  }else{
+    d = ((q + c) | (c ^ 32)) | ((b | 60) | (a * c));
+  }
+  c = ((a - b) * (b + q)) ^ ((b & 74) + (b - q));
+  b = ((p & b) ^ (d - d)) & ((p + b) ^ (b | c));
+  a = ((q * p) & (a * 29)) ^ ((q | c) & (b ^ c));
+  c = ((c | p) - (c + p)) + ((p + 84) + (q | b));
+  if(c < b){
+    b = ((a ^ d) & (c * c)) & ((c | a) ^ (d * 84));
+  }else{
+    d = ((c | p) & (q * p)) | ((q - 87) ^ (d + 18));
+  }
+  return a + b + c + d;
+}
+
+int func36(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 99;
+  d = 75;
+  c = ((p * p) * (d * c)) - ((q - d) + (b - a));
+  a = ((c ^ 67) * (b - 80)) - ((q & p) ^ (d + p));
+  a = ((b | c) | (d ^ b)) - ((d & a) ^ (b | a));
+  d = ((c + 39) | (q - a)) - ((p | p) | (p | b));
+  if(d < b){
+    c = ((c | a) - (b ^ q)) + ((p & p) | (p | a));
+  }else{
+    c = ((q ^ 3) * (p ^ c)) & ((p & p) * (b + 1));
+  }
+  c = ((p | q) ^ (p * a)) ^ ((a * d) + (a | 34));
+  for(i = 0; i < 4; i++){
+    c = ((d + q) * (b + a)) - ((q | c) ^ (b * q));
+  }
+  d = ((a + p) ^ (a + p)) | ((d ^ d) ^ (d - 72));
+  a = ((d | c) + (c * a)) & ((d ^ 81) & (a + c));
+  if(d < a){
+    c = ((q + 57) ^ (q - 7)) * ((q - a) + (a - p));
+  }else{
+    c = ((b | a) + (c & 80)) * ((b ^ 22) * (q - q));
+  }
+  d = ((q & b) & (c - d)) ^ ((d ^ q) | (p & b));
+  d = ((b - a) | (q ^ 79)) + ((a * a) | (p & b));
+  c = ((p - p) + (b | 49)) + ((b & 52) | (q ^ b));
+  for(i = 0; i < 25; i++){
+    b = ((a ^ a) + (c * b)) - ((a | 94) | (d + 92));
+  }
+  if(c < a){
+    d = ((a ^ q) ^ (b + q)) - ((a | c) & (a & b));
+  }else{
+    b = ((p & a) | (d - 9)) - ((a * d) | (a & q));
+  }
+  c = ((q * p) | (q ^ 69)) & ((b ^ d) | (p * c));
+  c = ((c + c) & (b & q)) + ((a + b) * (q - a));
+  d = ((q | d) * (q - 55)) * ((q * d) & (p - p));
+  d = ((d & p) | (b + b)) * ((c ^ c) * (a ^ q));
+  if(d < p){
+    a = ((a + c) ^ (a - a)) | ((q ^ d) & (p + d));
+  }else{
+    c = ((d ^ a) & (b - a)) & ((q - p) | (a - q));
+  }
+  for(i = 0; i < 20; i++){
+    b = ((c - 96) ^ (a + a)) ^ ((q & 96) * (q & 86));
+  }
+  c = ((p * p) & (a * d)) + ((b | 33) + (p + p));
+  c = ((p - q) | (d - c)) + ((a & q) | (p ^ b));
+  d = ((b + 50) | (a - d)) + ((d ^ 22) * (q - 80));
+  if(c < c){
+    a = ((q + a) & (q * b)) + ((d ^ p) | (q - 65));
+  }else{
+    a = ((p * d) - (a - d)) ^ ((q | d) + (q & c));
+  }
+  d = ((c + d) * (c + b)) * ((c * q) & (q ^ 28));
+  d = ((c - 54) | (q + b)) + ((q | p) & (d * 52));
+  for(i = 0; i < 50; i++){
+    d = ((c + p) ^ (a + b)) | ((q + c) | (q * p));
+  }
+  b = ((q & a) + (p | 90)) - ((a * c) & (c ^ 29));
+  if(b < c){
+    c = ((b | 87) - (p & p)) & ((a & q) & (q & 28));
+  }else{
+    d = ((c ^ q) + (d + c)) ^ ((d - q) & (c * b));
+  }
+  b = ((a | d) - (a + 49)) - ((d + q) - (a | a));
+  b = ((q - q) - (b & q)) + ((c | d) * (p ^ 11));
+  b = ((a | q) - (q - d)) + ((c + q) & (p ^ c));
+  b = ((d * a) - (d | c)) + ((c * b) & (b ^ p));
+  if(d < 4){
+    d = ((a | b) | (p ^ d)) - ((q + c) - (d ^ 65));
+  }else{
+    d = ((a | b) & (p | q)) + ((a ^ b) + (a | p));
+  }
+  d = ((c * 69) + (b ^ d)) & ((d - 1) + (c | d));
+  b = ((a & a) ^ (q | c)) | ((a * c) & (c ^ q));
+  a = ((c - d) * (c & b)) - ((c + d) & (d ^ a));
+  d = ((q ^ 40) | (q + 5)) ^ ((a - q) * (a + b));
+  if(c < d){
+    b = ((b & p) ^ (d * c)) | ((c & p) * (a | 51));
+  }else{
+    c = ((q | d) | (p | d)) & ((d ^ q) + (a - a));
+  }
+  return a + b + c + d;
+}
+
+int func37(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 12;
+  d = 98;
+  a = ((q + d) | (p & 11)) - ((a + b) & (d - 98));
+  d = ((q + b) & (q - a)) * ((c - 62) - (c & d));
+  a = ((d & p) - (a & c)) + ((p & p) * (q ^ a));
+  b = ((a + 63) - (q ^ q)) | ((q * q) ^ (d - c));
+  if(b < 59){
+    c = ((q ^ q) + (p | 43)) & ((b - q) | (d ^ p));
+  }else{
+    b = ((a + a) & (d | 26)) & ((p | b) | (q & b));
+  }
+  b = ((a - q) * (c - d)) ^ ((p ^ a) * (p - b));
+  for(i = 0; i < 7; i++){
+    b = ((c | b) + (a - d)) ^ ((b & c) - (b ^ b));
+  }
+  d = ((a & b) | (a & a)) - ((a ^ p) - (q | p));
+  a = ((c * 32) | (q - 64)) & ((a & c) * (b + c));
+  if(a < c){
+    a = ((c ^ 44) | (p | c)) & ((p * q) - (q * 43));
+  }else{
+    b = ((d + b) * (c * 80)) * ((q + 59) ^ (b * a));
+  }
+  b = ((c - 21) * (d - c)) ^ ((q | c) * (c | d));
+  c = ((q ^ p) * (d | p)) ^ ((q | c) | (q & p));
+  b = ((c - b) | (b | 72)) & ((q | b) & (b + p));
+  for(i = 0; i < 34; i++){
+    c = ((b - 59) * (a | c)) - ((b ^ p) - (b & 23));
+  }
+  if(d < c){
+    b = ((p ^ d) * (b | 1)) * ((p | d) + (c | d));
+  }else{
+    a = ((c * p) | (q & 79)) | ((q ^ a) & (d * d));
+  }
+  d = ((q ^ a) ^ (a - q)) ^ ((d & a) ^ (p & a));
+  b = ((d ^ a) - (q & c)) + ((p - 68) | (p & d));
+  d = ((d & d) * (c - d)) - ((p + b) & (b - q));
+  d = ((p * p) - (q + c)) | ((c - q) + (a - p));
+  if(c < a){
+    c = ((c * a) | (q & d)) + ((p ^ c) * (p ^ c));
+  }else{
+    b = ((b | d) ^ (b & b)) & ((b ^ d) | (p + q));
+  }
+  for(i = 0; i < 10; i++){
+    c = ((b * q) | (q & d)) + ((a & 21) * (p & 73));
+  }
+  a = ((p + q) + (a ^ p)) - ((c & q) | (p + b));
+  b = ((c ^ d) * (p ^ b)) - ((p - d) + (d | d));
+  b = ((c + 31) | (c - q)) * ((c * 61) & (q + d));
+  if(d < c){
+    d = ((p & a) | (d + 94)) - ((d ^ p) + (c - c));
+  }else{
+    b = ((p & b) & (b | b)) | ((b & d) & (a ^ c));
+  }
+  a = ((p | 67) | (p * b)) | ((b - 84) - (c & d));
+  b = ((p + a) - (b | q)) - ((a | q) ^ (c ^ 47));
+  for(i = 0; i < 6; i++){
+    b = ((c + d) * (a | 19)) * ((p | 57) & (d ^ a));
+  }
+  a = ((p - 57) + (d * 62)) | ((b - 30) | (a * a));
+  if(a < a){
+    a = ((p | 43) ^ (b ^ 58)) * ((p & a) & (q & 60));
+  }else{
+    b = ((b | d) * (d + a)) | ((d - d) + (p | d));
+  }
+  b = ((d & d) + (c - q)) & ((p & q) + (a * d));
+  c = ((c & a) + (d + 33)) * ((b - p) * (b & b));
+  a = ((c | d) * (q - 39)) ^ ((c ^ c) * (b | a));
+  a = ((d & b) * (p | a)) | ((q | b) | (q | 8));
+  if(a < p){
+    a = ((b + 3) + (d * 75)) * ((q ^ q) & (a | p));
+  }else{
+    a = ((q ^ b) | (b ^ c)) | ((a ^ a) * (q * p));
+  }
+  d = ((p + a) & (d - d)) | ((c + b) & (b & 70));
+  b = ((c | a) * (d & 95)) + ((p ^ d) | (a - q));
+  c = ((c * 8) | (d | q)) | ((p * d) | (a - 42));
+  b = ((p | 21) & (b * 87)) | ((a - 22) & (q * q));
+  if(d < 26){
+    d = ((a | c) | (p & c)) | ((c | d) | (q & c));
+  }else{
+    a = ((q - q) & (b * c)) - ((c & 20) + (d | d));
+  }
+  return a + b + c + d;
+}
+
+int func38(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 82;
+  d = 98;
+  d = ((d + d) * (c | a)) * ((b | p) - (p & q));
+  c = ((c - p) & (b | a)) * ((c + d) ^ (p * p));
+  b = ((a * q) - (b - b)) + ((c & 52) ^ (p & 43));
+  d = ((q ^ 98) ^ (d * p)) - ((q ^ 18) * (p ^ c));
+  if(c < 2){
+    a = ((d - 7) | (a - p)) & ((p & q) | (c * 92));
+  }else{
+    a = ((b & 37) + (c + a)) | ((b - d) ^ (p + 42));
+  }
+  a = ((a ^ 65) - (d & 32)) + ((p | q) - (d + a));
+  for(i = 0; i < 12; i++){
+    d = ((p & b) ^ (b ^ p)) + ((d + a) + (b * b));
+  }
+  b = ((q + a) * (d - 38)) - ((d & 80) & (p - d));
+  a = ((d | 32) ^ (d ^ a)) | ((q & b) + (q * q));
+  if(b < b){
+    b = ((q * a) | (c & c)) * ((c & b) | (c | d));
+  }else{
+    a = ((d * 40) * (q - q)) & ((c * b) ^ (b - 27));
+  }
+  d = ((p & a) & (q + 56)) - ((b | q) ^ (q ^ q));
+  c = ((d | 37) + (a ^ a)) * ((b - c) - (d & 85));
+  b = ((q ^ 70) * (c ^ p)) - ((d | 3) + (b ^ c));
+  for(i = 0; i < 21; i++){
+    a = ((a | a) + (a & c)) - ((a * 51) - (b | c));
+  }
+  if(b < a){
+    c = ((b + q) ^ (d ^ c)) + ((d * 34) * (q * 67));
+  }else{
+    c = ((d ^ p) * (p | a)) | ((p * d) ^ (q + a));
+  }
+  c = ((p * c) & (a + c)) ^ ((b + q) * (q ^ 62));
+  d = ((q - 18) * (c - c)) & ((a + p) * (p ^ c));
+  c = ((a * 42) & (a | c)) & ((q + 95) - (a + 81));
+  c = ((p ^ b) | (q * a)) - ((a + q) | (p | d));
+  if(d < b){
+    a = ((c ^ c) * (d ^ d)) ^ ((p ^ 50) & (a | q));
+  }else{
+    d = ((d | 31) * (c + d)) - ((p | a) | (b & 97));
+  }
+  for(i = 0; i < 21; i++){
+    a = ((d ^ 64) * (p | p)) & ((c - 95) + (b * d));
+  }
+  c = ((a + p) ^ (d - p)) - ((q | 91) | (d & b));
+  d = ((c | a) | (q ^ b)) & ((q - d) | (c ^ p));
+  b = ((b * d) - (b | c)) + ((c * 21) + (b ^ q));
+  if(b < a){
+    d = ((d | q) + (a | d)) | ((p | p) | (a + 43));
+  }else{
+    d = ((q * a) + (p | c)) & ((d * a) * (d * b));
+  }
+  b = ((d | p) + (p + a)) & ((a * d) & (p - q));
+  c = ((c & 46) ^ (d - b)) & ((a ^ 2) | (q * a));
+  for(i = 0; i < 26; i++){
+    b = ((b | 13) | (d + b)) | ((a + a) & (d & b));
+  }
+  d = ((q & 55) + (d * c)) & ((b + p) ^ (q - b));
+  if(d < d){
+    b = ((p ^ 48) | (q & a)) - ((q ^ c) | (b + b));
+  }else{
+    b = ((c ^ c) + (b & 16)) & ((c & 94) + (d + p));
+  }
+  b = ((b + 64) * (a + 52)) + ((p ^ 89) - (p * a));
+  b = ((c + p) & (q + 88)) ^ ((c ^ q) * (d * 13));
+  d = ((c | a) + (c | q)) * ((q * a) - (d + c));
+  a = ((b - c) | (c & p)) | ((b * q) | (a ^ 14));
+  if(c < b){
+    a = ((c & c) ^ (c | p)) & ((p | c) * (c * d));
+  }else{
+    a = ((b | q) & (q | c)) + ((d * c) & (d ^ d));
+  }
+  b = ((b - p) | (c & a)) - ((b ^ c) - (b & q));
+  a = ((q ^ p) + (q - q)) & ((p + q) ^ (b + a));
+  c = ((p ^ p) - (c + 52)) - ((d - 99) - (b * c));
+  b = ((a & d) * (c + c)) ^ ((a + 48) - (p & d));
+  if(b < c){
+    b = ((c & 64) | (b * 48)) - ((b + p) | (q | a));
+  }else{
+    d = ((a | b) ^ (d | q)) ^ ((q & 95) ^ (b & c));
+  }
+  return a + b + c + d;
+}
+
+int func39(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 29;
+  d = 48;
+  d = ((p - c) - (d * 46)) * ((b & d) | (p & d));
+  a = ((q ^ 23) * (d | a)) - ((a + 18) | (c & d));
+  d = ((d & a) * (p * 99)) - ((q | a) ^ (q + p));
+  c = ((a - q) ^ (a & q)) | ((d * b) & (p - p));
+  if(d < d){
+    d = ((q ^ 83) + (a + b)) + ((p * q) & (b | a));
+  }else{
+    b = ((q & d) | (c & c)) + ((q ^ 18) | (q - b));
+  }
+  d = ((c * 47) - (q * q)) * ((a & d) + (c | p));
+  for(i = 0; i < 11; i++){
+    a = ((a | c) + (c * 35)) - ((c - 42) + (b | p));
+  }
+  c = ((a - 13) * (a ^ 38)) + ((d * d) * (b ^ p));
+  b = ((q + d) * (p * d)) - ((b - 98) | (q * b));
+  if(c < p){
+    d = ((c ^ b) | (c & 84)) ^ ((q & b) - (p - b));
+  }else{
+    c = ((p ^ d) ^ (b * 44)) & ((c ^ a) + (c * q));
+  }
+  b = ((q | p) * (p * p)) ^ ((d + 65) & (a & b));
+  d = ((b ^ 83) | (c + 52)) & ((b * 82) - (p | 37));
+  a = ((a * d) | (a & a)) ^ ((d | d) ^ (b - 90));
+  for(i = 0; i < 25; i++){
+    d = ((d | c) * (p ^ b)) & ((q * 63) * (c ^ d));
+  }
+  if(d < a){
+    c = ((a | 70) - (d | 36)) * ((c ^ 26) | (c | q));
+  }else{
+    c = ((q * 17) | (d + p)) ^ ((b - d) * (p & p));
+  }
+  c = ((p - q) + (q - c)) ^ ((a ^ c) - (a | d));
+  b = ((q & a) | (q ^ 49)) - ((c & 94) * (q ^ q));
+  d = ((b | q) - (b | d)) * ((q ^ p) + (b * a));
+  d = ((p | 82) * (a - b)) & ((c + p) | (c & 32));
+  if(c < a){
+    c = ((b + c) - (a + c)) & ((d * d) & (a + b));
+  }else{
+    b = ((d & a) & (c & d)) - ((c | a) | (q * p));
+  }
+  for(i = 0; i < 10; i++){
+    a = ((c ^ 5) + (b * c)) + ((q | q) + (q * c));
+  }
+  a = ((a ^ c) * (c | b)) | ((p - a) - (c & p));
+  c = ((a * b) | (q & 64)) & ((q + p) * (p & q));
+  a = ((d - a) & (a | b)) + ((d & p) & (q & q));
+  if(c < b){
+    a = ((a | c) * (a * p)) - ((b ^ c) + (p + b));
+  }else{
+    c = ((d + b) * (a * q)) & ((b + d) + (p | 65));
+  }
+  d = ((a * a) ^ (a | 83)) ^ ((d & 98) & (b - 57));
+  a = ((b - d) * (p - 48)) * ((d ^ 16) * (b - a));
+  for(i = 0; i < 40; i++){
+    a = ((p & b) ^ (a - b)) + ((c * 52) + (p + p));
+  }
+  c = ((d * p) & (a ^ a)) | ((b - d) - (c | 16));
+  if(c < 40){
+    a = ((p * p) ^ (c ^ q)) & ((d | q) & (c & 39));
+  }else{
+    a = ((b + a) - (b * 20)) & ((c + a) & (p + p));
+  }
+  d = ((q ^ d) | (a & b)) * ((p + 38) - (c - 29));
+  d = ((b | b) - (d * c)) - ((p | q) + (c ^ b));
+  d = ((b + b) | (b ^ 71)) ^ ((b ^ q) | (q * c));
+  d = ((a & a) ^ (p ^ a)) & ((a & c) & (b - q));
+  if(a < 94){
+    a = ((c & p) - (a - 47)) - ((a + a) - (c & d));
+  }else{
+    d = ((c * d) * (a & 12)) * ((c * 31) + (a & q));
+  }
+  d = ((c & 91) * (d - b)) + ((b + p) - (c ^ p));
+  c = ((b | 33) ^ (a ^ 25)) ^ ((q | p) + (a + d));
+  b = ((c | a) & (a - b)) + ((c - d) - (d * c));
+  c = ((q ^ d) * (d & q)) | ((d & p) | (q + 69));
+  if(c < 83){
+    a = ((b * q) & (b ^ q)) * ((c - 81) & (a + d));
+  }else{
+    a = ((c + b) * (c | a)) ^ ((c - d) & (q | q));
+  }
+  return a + b + c + d;
+}
+
+int func40(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 79;
+  d = 6;
+  b = ((q & d) * (q - p)) - ((q - b) ^ (b + 76));
+  c = ((p | d) + (b ^ a)) + ((d * p) - (c * 88));
+  d = ((b * 11) + (a - a)) | ((a & 83) & (d | b));
+  a = ((a & p) | (a | b)) | ((b & 5) - (c - p));
+  if(a < d){
+    b = ((q * b) | (b + a)) * ((d & a) + (c * c));
+  }else{
+    d = ((a - p) | (p | a)) | ((d & q) | (b & b));
+  }
+  c = ((d + q) - (c * p)) | ((c * c) ^ (a + q));
+  for(i = 0; i < 42; i++){
+    c = ((c | c) ^ (d & 31)) | ((q & c) * (c ^ b));
+  }
+  c = ((p | b) | (d | q)) - ((b ^ 62) - (q + b));
+  d = ((a * a) - (q & b)) + ((q + c) * (p ^ b));
+  if(b < c){
+    a = ((q * d) + (a - c)) + ((b & b) ^ (c ^ d));
+  }else{
+    c = ((q * b) * (c + q)) - ((c * 33) & (q | c));
+  }
+  d = ((p | b) ^ (b | q)) * ((b * 44) ^ (d | b));
+  b = ((c & 45) - (a * q)) + ((d - q) ^ (a | c));
+  d = ((b + q) | (b * q)) ^ ((q | b) + (a | d));
+  for(i = 0; i < 37; i++){
+    d = ((b & c) * (c + q)) ^ ((a ^ c) + (q * c));
+  }
+  if(c < 45){
+    b = ((c & c) - (q + a)) * ((q | p) + (p | 24));
+  }else{
+    c = ((q ^ b) ^ (q | c)) ^ ((a | 78) - (b | b));
+  }
+  d = ((b | p) & (a - 41)) * ((p * d) - (q - q));
+  b = ((b + d) ^ (c | a)) | ((c - 78) * (p - 64));
+  c = ((a + 38) & (d - q)) * ((b & a) * (q + p));
+  d = ((d & a) | (c & b)) & ((d - c) ^ (p ^ d));
+  if(c < c){
+    c = ((a + c) ^ (d + d)) ^ ((p ^ d) + (a - d));
+  }else{
+    c = ((a | p) | (p * d)) & ((a | q) - (b & b));
+  }
+  for(i = 0; i < 23; i++){
+    d = ((a + 83) | (c ^ b)) - ((q ^ q) - (c & a));
+  }
+  b = ((d * b) + (p | d)) * ((p + b) | (b ^ 49));
+  c = ((p & d) * (c * 23)) * ((c - c) * (b + a));
+  c = ((b * c) ^ (a & c)) ^ ((q * d) * (a + a));
+  if(a < c){
+    a = ((b * d) | (q - c)) + ((a | p) ^ (a * q));
+  }else{
+    a = ((b ^ c) ^ (a + a)) + ((d ^ 6) * (b - b));
+  }
+  a = ((d ^ 24) * (b ^ 5)) - ((d - 99) | (b | a));
+  d = ((b + a) ^ (c & c)) ^ ((c * p) | (p ^ d));
+  for(i = 0; i < 4; i++){
+    d = ((q & a) | (p ^ q)) ^ ((d & d) + (c * d));
+  }
+  d = ((a | 32) * (p - 41)) + ((p + q) - (b ^ q));
+  if(b < b){
+    c = ((d - q) + (c - c)) - ((c | 76) ^ (q ^ a));
+  }else{
+    a = ((a * 59) + (a + p)) + ((c ^ 66) - (b - c));
+  }
+  b = ((c + 85) + (a + q)) ^ ((a + 4) - (p * c));
+  a = ((b | a) | (a | 11)) * ((b * p) ^ (a ^ c));
+  d = ((d | d) + (c & q)) - ((p * q) - (c + d));
+  a = ((c + p) * (a * 45)) & ((a ^ 21) ^ (q & 60));
+  if(d < a){
+    a = ((p - d) - (p - p)) + ((b & b) & (a * p));
+  }else{
+    a = ((b | 75) * (a & p)) * ((p + 91) - (a ^ 52));
+  }
+  a = ((d | 1) | (q + d)) - ((q * b) * (c | a));
+  d = ((b + 55) ^ (p | q)) + ((q - 53) - (d * 2));
+  a = ((b * 68) ^ (b * b)) + ((p | a) + (p * d));
+  b = ((b * 61) ^ (d * 68)) * ((b * 25) + (a * p));
+  if(c < c){
+    d = ((b ^ d) * (c - 66)) * ((c | b) * (q | 5));
+  }else{
+    d = ((b | 55) * (c & 9)) * ((p | b) & (c & q));
+  }
+  return a + b + c + d;
+}
+
+int func41(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 97;
+  d = 62;
+  c = ((p + q) + (a | a)) - ((b | q) ^ (p + a));
+  c = ((b | 43) & (a - d)) ^ ((p * a) ^ (d ^ 8));
+  d = ((d & b) + (a & b)) * ((a & 91) * (p ^ b));
+  b = ((q ^ 14) * (a - 61)) + ((q ^ q) + (q & 47));
+  if(a < d){
+    c = ((d | 30) | (q & 23)) * ((q ^ b) + (b | d));
+  }else{
+    a = ((q + p) * (q & a)) * ((b - d) ^ (d | q));
+  }
+  a = ((b - q) ^ (q + 60)) ^ ((p * c) * (q * 21));
+  for(i = 0; i < 6; i++){
+    d = ((d * q) ^ (b ^ p)) + ((b - 36) | (a - q));
+  }
+  a = ((c ^ p) + (a + b)) | ((p * b) * (d - 81));
+  c = ((a & c) - (a ^ a)) & ((c - 62) - (d & d));
+  if(b < 34){
+    b = ((q - 81) * (b ^ d)) ^ ((b & c) * (d & q));
+  }else{
+    c = ((b + 62) & (q & d)) - ((p & a) | (a ^ d));
+  }
+  b = ((a & p) ^ (d - d)) * ((d ^ c) + (b * 98));
+  a = ((b ^ a) & (q * 55)) - ((d | a) ^ (b & c));
+  d = ((d - d) & (q - c)) * ((p | a) ^ (p - b));
+  for(i = 0; i < 30; i++){
+    b = ((d * d) ^ (q * 54)) * ((q + d) + (a | 59));
+  }
+  if(c < a){
+    c = ((q + p) ^ (a * q)) & ((a - 84) + (a ^ q));
+  }else{
+    a = ((q ^ c) | (p + a)) * ((a ^ q) & (c | q));
+  }
+  d = ((p - p) + (b - 68)) * ((d + 47) & (a & 18));
+  c = ((a + p) * (b & 38)) & ((a - p) & (a & c));
+  c = ((d + p) | (d | d)) & ((b - c) & (c | q));
+  b = ((b ^ d) | (d | b)) ^ ((b - q) ^ (p + a));
+  if(c < 4){
+    c = ((b | c) ^ (a & d)) | ((q - 98) & (q ^ b));
+  }else{
+    b = ((b & 27) + (p ^ c)) ^ ((c * b) + (c + d));
+  }
+  for(i = 0; i < 9; i++){
+    c = ((q * 1) + (a | d)) & ((a - d) | (q + c));
+  }
+  b = ((c | 18) ^ (q & 42)) & ((c & c) + (q & q));
+  c = ((q | 27) ^ (d & 92)) | ((q * 59) + (d | d));
+  b = ((q & p) | (p * d)) & ((q & p) + (a & d));
+  if(c < q){
+    b = ((d & p) ^ (a * a)) + ((c - b) * (c | q));
+  }else{
+    c = ((a + 63) * (p * a)) + ((q * b) ^ (a ^ p));
+  }
+  c = ((a + 42) ^ (c & b)) - ((p + p) ^ (a - c));
+  a = ((q + q) ^ (p | p)) + ((q & q) & (a & c));
+  for(i = 0; i < 41; i++){
+    b = ((d * p) ^ (p * c)) ^ ((a | c) & (a | a));
+  }
+  b = ((c ^ c) ^ (b ^ q)) + ((q & c) + (b - 7));
+  if(b < b){
+    c = ((a + d) ^ (d * b)) - ((c | c) * (a * b));
+  }else{
+    b = ((c | 20) | (b | 12)) - ((b - q) + (c ^ c));
+  }
+  c = ((c & 99) - (q & 59)) | ((q & 19) | (a | a));
+  d = ((a + b) ^ (p ^ p)) & ((q & 76) + (q - 23));
+  a = ((d & c) + (a * c)) | ((c | d) & (c - q));
+  d = ((q | c) - (p & d)) * ((d | 12) & (b & q));
+  if(d < q){
+    d = ((p | p) - (c ^ p)) | ((q + a) | (c & 57));
+  }else{
+    a = ((d + 95) + (b - p)) | ((d ^ p) - (b | d));
+  }
+  b = ((p | 89) & (c ^ 51)) ^ ((q + q) & (q * b));
+  d = ((c ^ 48) - (c * 18)) * ((b & d) | (b & 43));
+  d = ((d & b) * (q & q)) | ((q & c) ^ (a * 27));
+  a = ((c | a) | (c ^ d)) * ((c | q) ^ (a | 73));
+  if(b < c){
+    b = ((a ^ a) ^ (c ^ 3)) - ((p * b) - (b | a));
+  }else{
+    c = ((p - c) & (q ^ b)) | ((d - c) & (q + q));
+  }
+  return a + b + c + d;
+}
+
+int func42(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 77;
+  d = 31;
+  a = ((q | a) - (b | p)) | ((a & 19) + (b * a));
+  c = ((c * c) & (q & c)) - ((c - q) ^ (q - 33));
+  d = ((c ^ 20) + (d & d)) * ((c ^ q) & (a ^ p));
+  b = ((b | q) ^ (p ^ c)) * ((p & p) + (p & b));
+  if(a < p){
+    c = ((q - 49) | (q | c)) | ((d + b) + (q + a));
+  }else{
+    d = ((b ^ 41) | (b + 7)) | ((a & d) * (b * b));
+  }
+  d = ((q ^ q) + (c * 28)) + ((p ^ a) & (b + 20));
+  for(i = 0; i < 38; i++){
+    a = ((q * p) | (c - 12)) ^ ((p - 29) * (q ^ b));
+  }
+  c = ((p + b) - (p | d)) | ((b + 59) ^ (d ^ a));
+  d = ((b | c) - (b | p)) - ((q * 87) ^ (q + c));
+  if(d < a){
+    a = ((a ^ d) & (p + 43)) ^ ((a ^ c) * (b | b));
+  }else{
+    c = ((p | d) * (a | 88)) | ((c | c) & (q & c));
+  }
+  b = ((d ^ d) - (a - 1)) & ((q - 55) & (b & d));
+  a = ((d + 53) * (d & d)) - ((d * p) - (a - 2));
+  a = ((q - d) | (a | a)) + ((b | q) | (a + d));
+  for(i = 0; i < 34; i++){
+    d = ((a & b) ^ (c - q)) | ((d - a) * (b - b));
+  }
+  if(a < p){
+    c = ((p | 98) & (d - c)) & ((c ^ b) & (q & a));
+  }else{
+    a = ((p ^ b) | (d + d)) | ((q & c) | (q ^ d));
+  }
+  c = ((q + 14) ^ (a ^ p)) + ((c | c) * (p * 6));
+  b = ((a | p) + (b ^ q)) | ((b | d) + (p & a));
+  c = ((d * a) + (q ^ a)) - ((q + a) ^ (b - p));
+  a = ((c * c) & (p ^ d)) - ((d ^ b) | (b ^ c));
+  if(c < b){
+    b = ((p * c) - (p ^ p)) - ((b & 39) & (a * p));
+  }else{
+    c = ((p & p) & (q + p)) - ((q + d) + (c ^ b));
+  }
+  for(i = 0; i < 10; i++){
+    d = ((p - 80) | (d | q)) & ((c - 16) + (p - 18));
+  }
+  a = ((a ^ d) | (b + 66)) * ((p + d) ^ (a | 36));
+  c = ((d & a) - (c + 34)) & ((a ^ d) - (q + 87));
+  b = ((c * d) | (a * q)) - ((q ^ q) ^ (b ^ p));
+  if(d < q){
+    d = ((q * c) & (d & p)) - ((q + d) ^ (a - b));
+  }else{
+    b = ((p * a) + (p & a)) + ((c + c) - (q + b));
+  }
+  b = ((c * 28) ^ (p ^ a)) | ((d - a) - (a | q));
+  b = ((c + p) * (a + p)) * ((c | 56) + (c - a));
+  for(i = 0; i < 8; i++){
+    b = ((d - 42) - (a & p)) + ((q | 29) | (q * 73));
+  }
+  c = ((c & q) ^ (q - 39)) ^ ((q ^ p) * (q + a));
+  if(c < a){
+    a = ((p + c) - (q | d)) ^ ((c & c) + (c * q));
+  }else{
+    c = ((q + 3) + (a + 60)) - ((b & 96) + (p ^ d));
+  }
+  a = ((q + d) & (d | p)) * ((d * d) + (q + c));
+  b = ((p + a) - (d - c)) - ((a & p) & (p | p));
+  a = ((p ^ d) | (a & a)) - ((q & p) & (d & 12));
+  d = ((a + c) ^ (d & p)) * ((c - 44) & (p | p));
+  if(c < q){
+    a = ((p | d) & (b & a)) - ((q * q) & (d | a));
+  }else{
+    b = ((b - 3) ^ (q & b)) + ((d | b) & (c - q));
+  }
+  b = ((c ^ p) * (c & q)) | ((b ^ c) | (b & b));
+  c = ((a & 46) - (d * q)) & ((q * p) & (b * p));
+  a = ((d & q) * (p | p)) & ((p ^ d) + (b | c));
+  b = ((a & q) | (d ^ 22)) * ((d + 27) + (b + q));
+  if(b < c){
+    b = ((b ^ p) - (d - c)) - ((d * 74) ^ (d - q));
+  }else{
+    b = ((b | p) * (a + d)) ^ ((p & c) + (d | a));
+  }
+  return a + b + c + d;
+}
+
+int func43(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 8;
+  d = 98;
+  c = ((c * c) | (b + d)) | ((p * p) * (b + b));
+  c = ((b * d) ^ (d + q)) & ((c * c) ^ (d - b));
+  b = ((c - a) & (c - 11)) * ((d ^ 78) + (d ^ 77));
+  b = ((d * 36) * (c | q)) ^ ((d & d) & (b | 85));
+  if(b < a){
+    d = ((c - p) - (a + p)) - ((p - c) * (c - 91));
+  }else{
+    c = ((p * q) ^ (c + 30)) & ((q | d) + (q + p));
+  }
+  a = ((q & p) & (d ^ p)) ^ ((q - b) ^ (a - 9));
+  for(i = 0; i < 36; i++){
+    d = ((q & b) - (d - p)) & ((d + d) + (q - q));
+  }
+  b = ((a + 29) | (q - q)) - ((b | a) + (b + 93));
+  d = ((b | q) & (q + a)) | ((p + q) ^ (a | d));
+  if(b < d){
+    a = ((p ^ c) ^ (a | p)) ^ ((a ^ p) | (p - 41));
+  }else{
+    a = ((c | 53) - (c & 18)) - ((c | a) + (d | 44));
+  }
+  d = ((b ^ d) - (a ^ p)) * ((q * c) | (q + p));
+  a = ((d ^ d) - (a - p)) + ((a ^ q) & (c - q));
+  d = ((q + 6) * (p ^ 29)) & ((d & 52) | (p ^ b));
+  for(i = 0; i < 24; i++){
+    a = ((p & a) * (q * 20)) * ((a | p) | (a * q));
+  }
+  if(d < b){
+    d = ((p * c) ^ (b * 2)) | ((p | q) ^ (p ^ 11));
+  }else{
+    a = ((c | p) ^ (c & b)) | ((a - a) ^ (c * q));
+  }
+  d = ((q - b) & (d & d)) & ((b * 35) ^ (q & q));
+  b = ((q - 11) ^ (d ^ q)) * ((a & 42) ^ (d & d));
+  a = ((c & 71) & (c + d)) | ((q & 78) * (d - b));
+  b = ((p * p) & (d * a)) * ((c - q) + (p + 64));
+  if(b < p){
+    b = ((b ^ d) + (p ^ p)) | ((a | p) & (p + a));
+  }else{
+    d = ((b ^ a) ^ (b | c)) ^ ((c - d) | (p ^ b));
+  }
+  for(i = 0; i < 49; i++){
+    c = ((c & 1) + (a - b)) * ((d | b) & (q | 56));
+  }
+  d = ((b | c) & (p - 10)) ^ ((b ^ p) & (q + 61));
+  a = ((d - q) | (q + d)) ^ ((c ^ p) | (c & b));
+  b = ((p - p) ^ (p + 80)) | ((p & c) + (q + d));
+  if(c < q){
+    c = ((q & 44) - (p & q)) + ((a ^ q) - (d - d));
+  }else{
+    d = ((d | c) + (a ^ 25)) * ((a | q) + (a | b));
+  }
+  b = ((p | p) + (q - d)) & ((d & 5) * (q * c));
+  a = ((b + a) | (b - a)) + ((p - a) + (a - b));
+  for(i = 0; i < 47; i++){
+    d = ((q - p) & (c - b)) + ((b & p) - (c ^ 83));
+  }
+  c = ((q & 9) & (p | c)) ^ ((c ^ d) & (a * p));
+  if(d < d){
+    a = ((b | q) ^ (a * c)) * ((c + p) - (p & b));
+  }else{
+    d = ((b - d) + (b | a)) & ((b ^ d) | (q & b));
+  }
+  a = ((d | b) & (c ^ q)) ^ ((b | b) ^ (b | 59));
+  d = ((a + b) - (c * p)) | ((q * c) - (p - 93));
+  d = ((p - p) * (c + d)) | ((q + 9) ^ (c & p));
+  d = ((a | 22) - (c + 32)) & ((a + c) - (c ^ p));
+  if(a < c){
+    d = ((p | c) * (b + b)) ^ ((p ^ d) * (c & b));
+  }else{
+    c = ((q - b) * (d & d)) & ((b ^ d) * (q - 79));
+  }
+  d = ((d & d) * (b * b)) | ((c | p) | (c | 63));
+  b = ((c + b) + (p * b)) & ((c + c) | (a * b));
+  c = ((a ^ b) | (p - b)) * ((q * d) - (b * d));
+  c = ((d & d) | (p & b)) | ((d & b) & (q & a));
+  if(c < q){
+    c = ((a * c) ^ (c & a)) & ((c + p) - (q + b));
+  }else{
+    d = ((a & d) * (q + b)) + ((q | 75) ^ (p * c));
+  }
+  return a + b + c + d;
+}
+
+int func44(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 58;
+  d = 35;
+  c = ((a + p) + (p - p)) * ((b ^ 42) ^ (q | 86));
+  a = ((d * a) | (a | 50)) ^ ((q + 79) | (b ^ 59));
+  b = ((p - b) - (d * q)) - ((p * 76) * (c & 61));
+  c = ((c & p) * (p & q)) + ((p | 46) + (p ^ 13));
+  if(a < 34){
+    d = ((p + p) * (b ^ d)) - ((p | p) - (q ^ p));
+  }else{
+    c = ((p * q) + (q - b)) * ((a * 27) & (a & c));
+  }
+  c = ((b * 54) - (q - b)) * ((p * d) * (d * 60));
+  for(i = 0; i < 23; i++){
+    a = ((b + q) ^ (p * q)) * ((q | d) * (b * 36));
+  }
+  b = ((p & 57) - (c | b)) * ((d + b) | (d & d));
+  b = ((a * p) ^ (b ^ b)) + ((q + a) & (c * a));
+  if(a < d){
+    c = ((a - 48) & (p * 52)) + ((c + 52) + (d ^ 38));
+  }else{
+    c = ((q - q) - (c ^ b)) ^ ((q ^ a) | (p * 71));
+  }
+  d = ((q + p) ^ (p + 15)) - ((d - d) + (c | b));
+  d = ((b | 88) + (d & b)) ^ ((q - 7) | (b & q));
+  c = ((b - c) | (q * 70)) | ((p | 89) & (p - 20));
+  for(i = 0; i < 3; i++){
+    a = ((d * q) + (q & a)) + ((q & 49) | (p ^ p));
+  }
+  if(c < c){
+    c = ((a * q) ^ (b & 19)) - ((a + 62) ^ (p * p));
+  }else{
+    c = ((q - b) * (p + d)) | ((b | p) ^ (a + 55));
+  }
+  a = ((q | b) - (p & b)) | ((d - q) | (q - b));
+  b = ((c * q) | (b + 19)) ^ ((a & p) & (b * q));
+  c = ((d - p) | (c & 16)) + ((a + p) * (p & c));
+  a = ((c | a) * (b | 35)) - ((q - b) ^ (a & c));
+  if(c < c){
+    d = ((b & q) + (d & c)) ^ ((d + a) + (a * 12));
+  }else{
+    c = ((c + a) ^ (b - d)) & ((b + a) + (p ^ 12));
+  }
+  for(i = 0; i < 6; i++){
+    a = ((c - b) + (d * b)) & ((d & c) & (c * 5));
+  }
+  b = ((a + p) ^ (d + a)) + ((b * c) - (p + p));
+  d = ((c + 7) | (q + a)) & ((c ^ d) ^ (c - d));
+  a = ((a - 74) ^ (d | b)) + ((b | b) - (q & b));
+  if(d < 89){
+    c = ((p + d) | (a & 32)) - ((d - a) ^ (c - b));
+  }else{
+    a = ((q | p) * (a - d)) | ((d + q) + (c * p));
+  }
+  c = ((a + c) + (q | p)) & ((p * p) ^ (b ^ b));
+  a = ((p & b) * (p * b)) & ((d | 50) + (p | a));
+  for(i = 0; i < 15; i++){
+    a = ((q - 91) - (d ^ 9)) * ((d | b) + (d | b));
+  }
+  b = ((p - q) + (p & p)) | ((d + q) & (p ^ p));
+  if(b < 97){
+    a = ((c ^ q) | (d * q)) + ((b + b) + (p * q));
+  }else{
+    a = ((p & d) * (p & a)) ^ ((c ^ b) * (q * 58));
+  }
+  b = ((b - d) ^ (c * 52)) * ((b | c) + (d * b));
+  c = ((q * a) ^ (c * b)) & ((b - q) ^ (c & b));
+  b = ((b * b) - (a & c)) & ((a ^ 63) & (q * c));
+  d = ((a * d) * (c - d)) - ((c ^ a) - (a & b));
+  if(b < p){
+    d = ((b ^ d) | (a - d)) & ((p & p) & (c + d));
+  }else{
+    d = ((c + b) * (c & 54)) & ((q & p) | (q + 77));
+  }
+  c = ((b * c) - (c + 48)) * ((p - p) | (b | p));
+  a = ((d + 5) * (c & c)) & ((p | p) * (b - 46));
+  a = ((d | b) & (q + b)) | ((a & c) * (c & p));
+  d = ((b + p) ^ (d & c)) | ((q ^ b) | (c + p));
+  if(d < q){
+    d = ((a + c) - (c - a)) - ((b * d) * (p | 32));
+  }else{
+    c = ((p ^ a) * (a | c)) * ((a * d) & (b ^ 21));
+  }
+  return a + b + c + d;
+}
+
+int func45(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 15;
+  d = 86;
+  c = ((p - d) | (p * d)) | ((b - 23) & (c * c));
+  c = ((c * q) & (d ^ c)) & ((d + b) ^ (b - q));
+  a = ((c | p) * (a - q)) * ((q ^ q) * (b * c));
+  d = ((c * q) + (d & c)) & ((b - c) | (c * 59));
+  if(c < q){
+    b = ((d & 15) - (d * c)) ^ ((d - 7) & (q ^ c));
+  }else{
+    d = ((p * 58) - (q & 34)) ^ ((a + c) + (a ^ q));
+  }
+  a = ((b | p) * (p ^ p)) ^ ((b + c) - (d | 21));
+  for(i = 0; i < 9; i++){
+    d = ((a - p) + (a & q)) | ((a - 10) + (d & c));
+  }
+  a = ((p + p) ^ (c | d)) + ((p & q) * (q & a));
+  a = ((c ^ b) ^ (a | a)) | ((c * c) + (d + q));
+  if(c < 65){
+    a = ((p * p) ^ (p - d)) * ((p & b) ^ (a - a));
+  }else{
+    b = ((a & 3) | (d + d)) & ((q ^ 23) - (c - d));
+  }
+  c = ((a - a) * (b & p)) ^ ((b - d) + (p | c));
+  c = ((a ^ d) - (c & p)) * ((q - c) ^ (q & b));
+  c = ((p - d) | (p + 49)) * ((c | q) - (p ^ 39));
+  for(i = 0; i < 23; i++){
+    d = ((b ^ q) + (d ^ 59)) & ((q * a) ^ (d - 39));
+  }
+  if(b < b){
+    b = ((c + 36) ^ (p & p)) + ((b & q) - (b - 32));
+  }else{
+    c = ((b & d) & (a * 75)) & ((b ^ b) + (a | 70));
+  }
+  b = ((c - p) - (a + p)) & ((q - a) & (c & d));
+  b = ((p - c) & (a * q)) + ((a * b) + (q - p));
+  c = ((a - d) ^ (a | 21)) * ((d * b) + (a + 11));
+  a = ((a & p) | (d * a)) ^ ((a + p) | (p - q));
+  if(d < c){
+    b = ((d | d) & (c | p)) * ((q - p) * (p * d));
+  }else{
+    d = ((p ^ a) ^ (p + c)) * ((a | 42) & (c + p));
+  }
+  for(i = 0; i < 33; i++){
+    b = ((p * 39) - (q | b)) ^ ((q + a) + (b | p));
+  }
+  a = ((q - p) & (c - b)) ^ ((d - d) * (b ^ d));
+  c = ((a | b) & (b & b)) | ((c & 84) ^ (q ^ d));
+  b = ((d - 48) & (q + c)) ^ ((d * c) * (b + 15));
+  if(c < q){
+    c = ((d - a) ^ (d | d)) ^ ((c & 43) - (a ^ 38));
+  }else{
+    a = ((p ^ q) * (p * a)) + ((q ^ q) + (d * c));
+  }
+  a = ((p * b) ^ (b - 45)) * ((d - a) * (q ^ d));
+  a = ((q - 15) * (q | p)) - ((c * p) & (p & c));
+  for(i = 0; i < 21; i++){
+    b = ((b * a) - (b * b)) * ((q + 2) ^ (q & a));
+  }
+  d = ((p ^ 60) * (q | a)) ^ ((q & d) & (d ^ q));
+  if(d < 65){
+    c = ((d & q) & (c | d)) + ((q ^ 90) + (d - p));
+  }else{
+    b = ((d ^ 17) | (q - b)) + ((b * q) | (q * 45));
+  }
+  a = ((q | b) | (p & p)) * ((p + c) ^ (b + d));
+  b = ((d & a) & (p | q)) * ((p + c) & (p * c));
+  c = ((p & c) * (p ^ c)) | ((c * q) ^ (c - b));
+  a = ((b * p) + (c * c)) & ((p ^ 10) * (b - c));
+  if(c < q){
+    b = ((p * b) | (d - c)) ^ ((p & 96) + (c + q));
+  }else{
+    d = ((a - d) - (d | 98)) * ((q + q) | (c * 30));
+  }
+  d = ((p & 80) ^ (q - q)) | ((b | b) + (q & c));
+  a = ((d | p) | (d * q)) | ((a | b) * (p - 10));
+  d = ((c ^ p) ^ (b & p)) + ((p * b) * (a - c));
+  a = ((d ^ 95) & (a * d)) & ((b + a) & (d + 89));
+  if(a < b){
+    a = ((b & c) & (q | b)) * ((d | p) * (b - p));
+  }else{
+    a = ((b | 36) - (b | 97)) + ((a - p) | (c & p));
+  }
+  return a + b + c + d;
+}
+
+int func46(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 46;
+  d = 35;
+  d = ((a & q) & (b - 6)) * ((b * p) | (c ^ 65));
+  b = ((b - q) | (c * 24)) & ((p * b) * (b & d));
+  b = ((p + b) - (p & 63)) - ((q - b) - (c ^ 42));
+  a = ((b ^ b) ^ (b ^ d)) | ((q | a) * (p * d));
+  if(b < 89){
+    c = ((b - p) ^ (b + b)) & ((d & p) * (p | b));
+  }else{
+    c = ((q - 48) - (b - c)) ^ ((d - 36) & (d & d));
+  }
+  a = ((q + b) * (a - b)) & ((a * a) ^ (a ^ 57));
+  for(i = 0; i < 35; i++){
+    b = ((b & p) + (d | q)) + ((q * b) + (d & c));
+  }
+  c = ((d * 87) - (c ^ d)) + ((d * 82) - (b | 73));
+  a = ((d - c) ^ (a + 55)) ^ ((q | 34) - (p | q));
+  if(d < 18){
+    b = ((d - p) & (b - b)) | ((b - a) * (c ^ b));
+  }else{
+    b = ((q ^ d) + (c | d)) ^ ((p | p) - (a - c));
+  }
+  b = ((q + d) & (d & q)) * ((p ^ b) - (c - b));
+  a = ((c * b) - (p * 67)) + ((c & q) - (c - p));
+  b = ((q | 29) * (c | 29)) ^ ((q + b) | (p + q));
+  for(i = 0; i < 32; i++){
+    d = ((p * b) | (c ^ b)) * ((b | 77) * (p ^ 55));
+  }
+  if(d < b){
+    a = ((d | a) & (q - p)) | ((d & d) | (c * q));
+  }else{
+    a = ((c + b) * (c & 12)) | ((c & 3) | (p + q));
+  }
+  a = ((q ^ q) ^ (d ^ p)) - ((q * b) - (q * p));
+  d = ((b - a) + (b + q)) - ((q ^ 58) ^ (d ^ b));
+  c = ((d * 25) + (p | p)) & ((p * a) ^ (q * d));
+  a = ((a + c) | (q - a)) ^ ((a + 61) + (b ^ p));
+  if(c < 69){
+    c = ((d | b) ^ (d + 4)) + ((q ^ b) - (d & d));
+  }else{
+    c = ((d - b) | (a - 70)) - ((c * q) - (p - 64));
+  }
+  for(i = 0; i < 42; i++){
+    a = ((p - 62) | (a ^ b)) & ((c | c) ^ (c | c));
+  }
+  b = ((p + 13) & (a & d)) & ((d ^ 46) - (b * 54));
+  c = ((q - b) + (c + c)) ^ ((d | c) + (q - a));
+  a = ((d * 93) + (d - q)) ^ ((a & 45) & (b | b));
+  if(c < p){
+    a = ((c + d) | (q ^ p)) ^ ((d + c) | (p ^ 57));
+  }else{
+    c = ((d * 66) ^ (a - 95)) * ((d * 40) * (p | d));
+  }
+  b = ((c | b) * (a - p)) + ((d * c) & (c & 90));
+  d = ((c - p) ^ (a & 52)) - ((a - c) * (b & b));
+  for(i = 0; i < 19; i++){
+    a = ((p & q) ^ (a * 87)) - ((p | b) ^ (b + b));
+  }
+  a = ((d & 34) ^ (a + d)) ^ ((p + q) ^ (p * 53));
+  if(c < a){
+    c = ((p * 67) ^ (p | p)) ^ ((d & 56) + (c - b));
+  }else{
+    c = ((q ^ 88) ^ (a + p)) - ((d * c) + (a & c));
+  }
+  b = ((q - d) * (a - p)) | ((b ^ a) + (d | d));
+  a = ((b & a) & (d & b)) * ((c + p) & (a ^ 33));
+  a = ((c - 9) * (c | c)) | ((a | 41) * (d | d));
+  c = ((p + p) * (q - 90)) & ((a | q) * (c | 91));
+  if(d < q){
+    d = ((c - c) * (d ^ d)) | ((a - p) & (d & d));
+  }else{
+    c = ((c + 9) & (d - d)) ^ ((c + q) ^ (p & 20));
+  }
+  b = ((p + a) + (p | 99)) ^ ((b & 74) - (b * d));
+  c = ((d + b) | (b & a)) - ((d | c) + (b - 64));
+  d = ((d & q) | (q - 37)) - ((b - b) * (q ^ 29));
+  b = ((c + p) * (b | 26)) | ((d * c) - (c & 47));
+  if(c < c){
+    d = ((c | 75) & (b - p)) - ((d - p) & (p | a));
+  }else{
+    d = ((c + d) * (q - b)) & ((b + 14) & (d * q));
+  }
+  return a + b + c + d;
+}
+
+int func47(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 61;
+  d = 96;
+  b = ((a * 72) - (p | c)) | ((b - 53) - (q ^ c));
+  c = ((b & 62) ^ (c | 19)) - ((d + d) ^ (p | p));
+  b = ((d * c) + (c * p)) | ((a & 63) | (q + 44));
+  d = ((q - d) - (b + q)) + ((b & q) - (a | p));
+  if(b < d){
+    a = ((d ^ c) * (p | 87)) ^ ((a & b) | (c - p));
+  }else{
+    d = ((q * b) + (b & q)) ^ ((d * c) & (d + c));
+  }
+  a = ((a & a) | (d | d)) ^ ((a & 72) + (d * d));
+  for(i = 0; i < 29; i++){
+    c = ((c | b) ^ (d ^ 21)) & ((a + d) - (a - q));
+  }
+  d = ((p * 41) + (q | 46)) ^ ((b & p) * (q - b));
+  c = ((b + c) - (q * 21)) | ((c - q) | (d | c));
+  if(d < 30){
+    a = ((c | d) | (b | 65)) + ((q | p) - (a * q));
+  }else{
+    d = ((b ^ c) + (q ^ b)) - ((b ^ q) * (a | 99));
+  }
+  b = ((p + c) * (d + c)) * ((c | c) + (a & p));
+  c = ((c ^ d) ^ (p | c)) & ((a & a) | (q | d));
+  d = ((b | d) ^ (a * c)) - ((p & a) ^ (p * a));
+  for(i = 0; i < 46; i++){
+    a = ((b ^ q) & (b + a)) ^ ((d ^ 19) + (d & q));
+  }
+  if(b < 73){
+    a = ((p + c) | (d | 66)) - ((a | c) | (c & q));
+  }else{
+    b = ((a + c) + (p * q)) + ((p | c) & (c & 28));
+  }
+  d = ((q * d) - (b - 83)) * ((q - a) + (a | 39));
+  b = ((c ^ q) & (p + a)) * ((p & p) + (c - c));
+  a = ((q + c) ^ (d & c)) * ((b + 74) & (c + q));
+  d = ((q * a) | (b - p)) & ((c & d) * (d * 26));
+  if(a < a){
+    d = ((a ^ b) + (a & c)) * ((c & c) - (a * 4));
+  }else{
+    a = ((d + a) & (q | 18)) + ((b - 77) ^ (b - a));
+  }
+  for(i = 0; i < 34; i++){
+    d = ((p ^ q) + (p * 99)) | ((q + q) - (d & b));
+  }
+  d = ((p + c) - (d | a)) | ((q ^ 75) | (c | 81));
+  c = ((d & 91) | (c + p)) * ((p & 71) * (c * p));
+  d = ((p - 21) * (a | d)) * ((b * p) + (q | 76));
+  if(c < c){
+    b = ((q | a) + (d * a)) * ((a - 95) & (b + 12));
+  }else{
+    c = ((q * q) * (p + c)) | ((b ^ a) ^ (b + 41));
+  }
+  a = ((d + c) + (c & 3)) - ((d & q) & (p - p));
+  b = ((b & b) - (c | d)) * ((d * c) ^ (d * d));
+  for(i = 0; i < 37; i++){
+    b = ((b ^ p) - (a | c)) * ((p * 54) + (b | q));
+  }
+  d = ((a * a) - (p - d)) * ((c | b) | (q & 21));
+  if(b < d){
+    a = ((b + c) * (p | p)) - ((d + p) - (c & a));
+  }else{
+    c = ((b & b) - (c - 47)) | ((a + 27) | (q & b));
+  }
+  a = ((p ^ a) ^ (d + q)) * ((p & a) + (p - 83));
+  a = ((c + a) & (q & 67)) ^ ((c * q) - (c ^ p));
+  b = ((p * d) - (d * d)) * ((q + c) & (d * d));
+  b = ((d * b) ^ (a + 15)) & ((p * d) & (c ^ p));
+  if(d < b){
+    d = ((c - 37) * (p | b)) | ((c ^ d) + (p * q));
+  }else{
+    d = ((p - c) & (a + p)) & ((c & 17) | (b | a));
+  }
+  d = ((a - a) & (q - c)) - ((c - a) ^ (d | c));
+  c = ((a | 75) | (a | 92)) + ((p ^ a) * (d + a));
+  b = ((a - b) ^ (d * d)) + ((p & 27) + (c & q));
+  a = ((d * b) + (c ^ p)) & ((d | a) ^ (d & a));
+  if(c < b){
+    b = ((q - d) - (q | a)) | ((a | p) * (p - q));
+  }else{
+    c = ((d & p) * (d * 75)) * ((d + c) & (a - p));
+  }
+  return a + b + c + d;
+}
+
+int func48(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 3;
+  d = 82;
+  c = ((p * a) ^ (q | c)) - ((p ^ d) | (p & 88));
+  b = ((a * a) | (p | q)) & ((q ^ d) ^ (c & 29));
+  c = ((b & p) & (q + q)) * ((a + a) | (b + b));
+  c = ((a ^ c) * (c * d)) + ((q - c) + (c + 11));
+  if(c < 73){
+    b = ((b | c) & (q + 89)) + ((p & 26) & (b * p));
+  }else{
+    b = ((c & 44) - (c - p)) * ((c & p) & (q + 88));
+  }
+  c = ((d | d) | (p ^ b)) ^ ((q ^ 89) ^ (d * c));
+  for(i = 0; i < 25; i++){
+    b = ((q * b) ^ (q + p)) | ((b ^ q) * (b | d));
+  }
+  d = ((q + b) ^ (p + 49)) + ((p * 14) + (a | d));
+  d = ((c ^ d) | (a ^ d)) ^ ((a | d) | (p ^ 88));
+  if(d < p){
+    b = ((d & p) * (b - 84)) ^ ((a - c) * (q ^ d));
+  }else{
+    d = ((d - 26) ^ (a * p)) + ((a | c) * (q ^ a));
+  }
+  c = ((p + q) - (q - 91)) | ((c | 72) * (a & 52));
+  d = ((a * p) & (c & p)) | ((b | a) & (a ^ c));
+  c = ((b - 63) - (a ^ 26)) + ((c & c) & (c & a));
+  for(i = 0; i < 8; i++){
+    c = ((a + b) * (q + d)) * ((b * c) * (a & q));
+  }
+  if(a < p){
+    c = ((q & 94) & (d & q)) | ((c + b) | (b - 69));
+  }else{
+    c = ((a - d) | (c | p)) * ((p | 81) * (a ^ c));
+  }
+  b = ((p - 71) + (a ^ q)) ^ ((b ^ a) ^ (c ^ d));
+  d = ((p ^ 64) * (d + q)) ^ ((c & b) + (d & 6));
+  b = ((b * b) - (b | 72)) & ((c - d) * (d ^ a));
+  b = ((a & p) | (p - p)) & ((p + c) | (d & q));
+  if(b < 81){
+    a = ((a + d) | (a ^ 84)) - ((b ^ 44) + (p + a));
+  }else{
+    d = ((a | p) * (q | d)) & ((c - c) + (b ^ 85));
+  }
+  for(i = 0; i < 18; i++){
+    c = ((q | a) - (c & a)) * ((a + d) + (p | c));
+  }
+  b = ((b + d) - (a * q)) + ((p * b) * (a ^ q));
+  b = ((c | b) + (q * c)) ^ ((p + a) - (p & d));
+  c = ((p | c) & (d - a)) ^ ((a | 35) & (p & b));
+  if(b < q){
+    b = ((c * a) ^ (p - c)) + ((c + q) + (q | b));
+  }else{
+    b = ((p | 2) ^ (d * c)) * ((b - a) * (a ^ q));
+  }
+  a = ((p ^ d) - (c | c)) * ((c ^ 1) - (a & 81));
+  a = ((a * b) - (p ^ q)) | ((b | d) | (b * d));
+  for(i = 0; i < 5; i++){
+    a = ((d * a) & (a - q)) ^ ((c & 85) | (p ^ c));
+  }
+  a = ((d + 52) + (b | p)) + ((p | 57) * (p | 36));
+  if(b < 45){
+    d = ((c & q) - (q ^ d)) - ((p | 93) * (q * 12));
+  }else{
+    b = ((c | 83) + (c * 26)) ^ ((a ^ d) | (b - a));
+  }
+  c = ((a * p) | (a & 18)) - ((b ^ 2) ^ (q & 90));
+  b = ((a * q) + (d - 2)) | ((a + b) & (d + a));
+  d = ((p ^ q) & (c * 29)) - ((b * q) - (c + q));
+  d = ((a ^ b) ^ (b ^ 3)) * ((q | p) * (q ^ c));
+  if(a < d){
+    b = ((d & a) * (d * q)) ^ ((b & a) + (q * 97));
+  }else{
+    c = ((a ^ q) - (b & d)) * ((p & q) - (b ^ p));
+  }
+  d = ((a & p) | (a - q)) ^ ((a * c) & (d ^ b));
+  b = ((c + q) * (p * q)) | ((b ^ b) ^ (d | a));
+  c = ((b * p) ^ (b - d)) + ((c - q) ^ (a * a));
+  a = ((p ^ q) - (q | d)) & ((p * a) * (d | 31));
+  if(c < c){
+    a = ((a & p) + (b | 32)) * ((q ^ 7) ^ (a * b));
+  }else{
+    c = ((b & a) & (d * c)) * ((a & p) - (c - b));
+  }
+  return a + b + c + d;
+}
+
+int func49(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 5;
+  d = 91;
+  a = ((p ^ a) + (d - q)) + ((c + b) ^ (p * 43));
+  a = ((q - 11) & (c - q)) | ((d | d) - (p & 14));
+  a = ((d - q) - (b + p)) ^ ((b | d) - (c & a));
+  a = ((b * c) + (c * 13)) * ((a & 71) + (a * b));
+  if(d < 80){
+    c = ((q * c) & (c + q)) ^ ((b - d) - (b * 90));
+  }else{
+    b = ((p * 14) & (b & a)) & ((c | p) & (c - 40));
+  }
+  c = ((a + 88) ^ (d + c)) - ((p & a) + (b * a));
+  for(i = 0; i < 3; i++){
+    b = ((d * d) + (p | q)) | ((q ^ p) - (q & p));
+  }
+  c = ((p - c) - (c & 7)) & ((q | 56) ^ (q ^ q));
+  d = ((a | b) * (p | d)) - ((c | p) | (b + p));
+  if(a < d){
+    b = ((d ^ d) - (a ^ 38)) - ((q & 83) - (a - q));
+  }else{
+    c = ((c ^ b) * (c + q)) * ((c * a) ^ (d & a));
+  }
+  a = ((p | c) ^ (c & a)) & ((d | q) | (q + 92));
+  c = ((q * d) + (c * d)) + ((a ^ d) + (b | a));
+  d = ((p + c) * (d | 96)) | ((q + p) + (p & 71));
+  for(i = 0; i < 24; i++){
+    b = ((a * a) + (a | d)) - ((a & p) + (c ^ q));
+  }
+  if(c < d){
+    d = ((b ^ 74) * (c * p)) - ((b + d) & (d * p));
+  }else{
+    c = ((q * c) - (d - b)) | ((b + q) ^ (q ^ 74));
+  }
+  a = ((d & d) & (d & d)) & ((d & 16) * (p ^ a));
+  a = ((a | a) | (b - 25)) ^ ((q * q) + (q & 87));
+  c = ((d & a) * (b - b)) - ((d ^ c) + (c + 93));
+  b = ((c ^ c) - (c | 21)) | ((p * 73) + (b * b));
+  if(a < 46){
+    d = ((p ^ a) + (q | d)) - ((b | q) ^ (a ^ a));
+  }else{
+    b = ((q * 75) * (c & a)) ^ ((p + q) | (q ^ q));
+  }
+  for(i = 0; i < 39; i++){
+    b = ((d + d) * (c * 9)) ^ ((q ^ 80) - (c | p));
+  }
+  b = ((d ^ c) - (a + 22)) + ((d * 68) - (b + 71));
+  c = ((b | c) + (b * 14)) & ((q & 5) * (p - b));
+  d = ((b * p) ^ (p * a)) * ((d - a) | (q & c));
+  if(a < c){
+    a = ((q | 77) - (b - a)) + ((q - d) & (b | q));
+  }else{
+    a = ((p * a) - (c & b)) & ((p & d) * (q - 79));
+  }
+  c = ((b * 11) ^ (p + 90)) | ((q + 52) * (a + q));
+  c = ((c | q) - (c ^ p)) + ((b + b) | (c | q));
+  for(i = 0; i < 48; i++){
+    c = ((a | a) - (p | p)) ^ ((p & q) * (a - 88));
+  }
+  b = ((a | a) * (b & b)) + ((b - p) - (c ^ c));
+  if(d < q){
+    d = ((p | a) - (c ^ 88)) & ((a - 87) & (p + b));
+  }else{
+    c = ((p + c) - (d - c)) & ((b + c) ^ (c & c));
+  }
+  c = ((c ^ d) & (b | a)) & ((d + b) | (q * q));
+  a = ((a * q) * (q * a)) | ((b - b) ^ (c + q));
+  b = ((d ^ b) & (p * 61)) ^ ((b | 85) & (a ^ c));
+  a = ((b * d) ^ (d + a)) + ((b & a) & (d | p));
+  if(c < c){
+    c = ((p - d) ^ (d * c)) * ((d ^ b) + (q ^ a));
+  }else{
+    d = ((q ^ b) & (p * c)) | ((d & b) - (d | c));
+  }
+  c = ((a - 67) * (b + d)) & ((b ^ c) + (a + p));
+  c = ((p - a) * (d * 64)) ^ ((c & 8) & (d | c));
+  a = ((b - p) | (b + 71)) | ((a - 86) & (c ^ c));
+  a = ((q + b) & (q - a)) * ((a * 4) - (b + 59));
+  if(b < p){
+    a = ((d + d) * (c | d)) * ((p - a) | (c * p));
+  }else{
+    c = ((p ^ 20) - (d * 3)) + ((c + q) - (q - b));
+  }
+  return a + b + c + d;
+}
+
+int func50(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 60;
+  d = 80;
+  c = ((b ^ p) - (p * 2)) & ((d - c) | (d & 98));
+  d = ((c + d) ^ (a - c)) & ((p & c) - (d & q));
+  c = ((p | a) + (p + c)) * ((a + d) ^ (c & 66));
+  c = ((c + p) & (b - 93)) ^ ((b - a) ^ (c - q));
+  if(b < q){
+    c = ((a | c) & (c & q)) - ((b - 46) & (q - a));
+  }else{
+    b = ((b | b) * (q + p)) | ((q - c) ^ (q | 16));
+  }
+  c = ((c * q) & (q | d)) | ((p & p) | (b + q));
+  for(i = 0; i < 3; i++){
+    a = ((p ^ 90) * (d & a)) + ((b - a) - (d | a));
+  }
+  c = ((q | c) + (q - b)) ^ ((c * q) + (b | a));
+  d = ((d * c) * (b - c)) * ((b | a) & (a ^ c));
+  if(c < 49){
+    d = ((p | a) ^ (b | 90)) + ((q - d) + (b - d));
+  }else{
+    c = ((b & 62) | (d & d)) * ((p * 78) & (q * d));
+  }
+  d = ((b & q) | (q + a)) + ((q - d) & (c * p));
+  a = ((q + 66) * (b | a)) + ((c ^ c) + (b - b));
+  b = ((b & b) | (a ^ 27)) * ((b | b) - (d + p));
+  for(i = 0; i < 43; i++){
+    b = ((d ^ a) * (c & c)) ^ ((c | 18) ^ (q & c));
+  }
+  if(d < 37){
+    b = ((c | b) & (p ^ 93)) + ((d + 78) * (q * b));
+  }else{
+    d = ((c - d) - (c | q)) & ((c ^ c) * (c & 6));
+  }
+  a = ((q & q) & (a * p)) ^ ((p & a) * (a - 12));
+  a = ((c & 5) ^ (d | a)) & ((c ^ d) - (b ^ d));
+  b = ((d & p) ^ (b ^ b)) + ((b + 98) | (a + a));
+  a = ((p | b) * (q - p)) & ((d * p) + (b + a));
+  if(d < d){
+    b = ((b ^ c) ^ (b * d)) + ((d | p) + (b | 42));
+  }else{
+    d = ((d * p) & (b + 82)) ^ ((b ^ p) ^ (q + c));
+  }
+  for(i = 0; i < 38; i++){
+    a = ((b + p) - (b | d)) | ((a * q) | (p + 16));
+  }
+  d = ((a & 74) * (b ^ b)) ^ ((q * a) & (q & 49));
+  a = ((q ^ b) * (a | b)) + ((c & a) & (c ^ c));
+  d = ((c - a) + (d ^ p)) - ((q * 85) & (q | a));
+  if(a < 83){
+    c = ((p & d) - (p * 88)) | ((d * b) | (b * q));
+  }else{
+    d = ((c - 91) | (p | p)) ^ ((d & q) + (p | q));
+  }
+  c = ((a * b) ^ (p + a)) - ((c ^ q) ^ (p & c));
+  a = ((p & 2) | (c & 61)) & ((a + c) * (c - d));
+  for(i = 0; i < 22; i++){
+    c = ((d & 90) & (b + a)) ^ ((d ^ b) & (q * q));
+  }
+  c = ((p * q) | (c ^ q)) + ((d ^ p) & (c + 52));
+  if(b < b){
+    c = ((a & d) ^ (c - b)) & ((d * c) ^ (b | q));
+  }else{
+    b = ((d + d) * (q ^ a)) - ((c - p) * (q & 58));
+  }
+  d = ((d | p) + (b & 69)) + ((d * d) + (b & d));
+  c = ((c - 78) * (a + d)) - ((b - q) * (q * a));
+  b = ((p - q) | (q | b)) ^ ((q ^ b) - (b ^ 15));
+  a = ((a & 69) & (b & 39)) ^ ((a + q) | (c - p));
+  if(d < a){
+    b = ((a ^ a) - (p & b)) + ((d - a) | (p + c));
+  }else{
+    a = ((c + q) + (c - q)) | ((d & c) & (b - q));
+  }
+  d = ((q ^ a) * (c - 27)) - ((q - c) * (c * d));
+  c = ((b - q) + (d + c)) + ((q & q) | (d & 76));
+  a = ((p ^ p) * (p & 54)) | ((q ^ 36) * (d ^ 95));
+  b = ((q & p) * (a - b)) - ((p | c) + (d ^ a));
+  if(d < 9){
+    a = ((d * c) | (b & 41)) | ((a & p) * (p - q));
+  }else{
+    d = ((q & p) ^ (a + 55)) & ((p | b) + (c * 84));
+  }
+  return a + b + c + d;
+}
+
+int func51(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 24;
+  d = 3;
+  c = ((c & c) - (b & 15)) | ((q & 41) ^ (b ^ b));
+  c = ((a + d) * (d + a)) & ((p ^ p) - (p ^ 63));
+  a = ((b * 5) | (b & q)) ^ ((d | c) * (p & d));
+  d = ((b - d) + (b ^ b)) * ((a * 98) * (b + a));
+  if(a < 58){
+    b = ((q + c) + (c + d)) & ((c + 49) + (c - p));
+  }else{
+    d = ((q ^ 30) ^ (c * c)) + ((c | 47) - (q | d));
+  }
+  c = ((b * a) & (d ^ 15)) & ((c * a) * (d + c));
+  for(i = 0; i < 46; i++){
+    c = ((d & c) * (q * q)) & ((c & p) * (p | q));
+  }
+  b = ((c | q) - (d ^ b)) + ((c - a) - (p * 36));
+  b = ((d - 88) & (d + 78)) * ((c & 51) & (b + p));
+  if(a < 35){
+    c = ((q + 47) + (q ^ b)) - ((a ^ 70) - (a ^ 18));
+  }else{
+    c = ((b * q) ^ (p ^ 83)) - ((c & b) | (b + b));
+  }
+  b = ((p | b) - (c ^ 28)) & ((c + c) | (c ^ c));
+  a = ((b & c) * (a * q)) * ((b + 62) - (a ^ q));
+  a = ((p ^ b) - (b * p)) - ((b * 24) ^ (q ^ c));
+  for(i = 0; i < 44; i++){
+    c = ((c - q) | (q | 4)) & ((b & q) & (c - c));
+  }
+  if(b < a){
+    c = ((a * c) & (b & 9)) * ((b | 88) * (d ^ d));
+  }else{
+    b = ((a + p) & (a | d)) | ((d + 70) - (a - a));
+  }
+  d = ((c | p) - (q | a)) + ((b & p) - (a ^ 1));
+  d = ((d ^ b) ^ (a + 59)) - ((b | p) & (a * 36));
+  a = ((c * q) ^ (b * d)) & ((q & p) - (q | 1));
+  b = ((p * 38) + (b * q)) & ((a ^ c) + (b & p));
+  if(b < b){
+    b = ((d - b) * (d - q)) * ((d * c) & (c - 15));
+  }else{
+    c = ((c & a) - (p | d)) & ((d * p) ^ (c | a));
+  }
+  for(i = 0; i < 29; i++){
+    b = ((a + q) ^ (a | a)) * ((c + c) + (d * a));
+  }
+  d = ((a ^ b) & (c ^ b)) - ((a ^ 98) + (d & 16));
+  a = ((c * c) * (b & 24)) & ((b & a) * (c - b));
+  c = ((c * a) - (a ^ d)) * ((q & a) ^ (a - a));
+  if(d < a){
+    d = ((c & d) - (c ^ d)) & ((b ^ 1) ^ (c + p));
+  }else{
+    b = ((p + d) - (a | d)) | ((c * d) | (b - b));
+  }
+  c = ((q * b) * (p - d)) - ((d & 28) | (q & d));
+  a = ((b & 19) + (a | a)) + ((p * 96) | (p ^ d));
+  for(i = 0; i < 49; i++){
+    c = ((p | d) - (c - b)) | ((q | b) & (p - a));
+  }
+  d = ((b - 55) * (p - 50)) * ((a ^ b) ^ (c * p));
+  if(a < q){
+    a = ((b | b) - (c ^ 3)) - ((p & q) - (q & b));
+  }else{
+    d = ((d * d) * (b & 84)) + ((d ^ d) | (p | b));
+  }
+  a = ((a * p) & (p + q)) + ((c - a) + (b & 13));
+  a = ((d + q) | (b + q)) ^ ((d | 84) | (b - 77));
+  b = ((d + a) - (c & 69)) * ((b | c) | (a ^ b));
+  c = ((p + 26) ^ (b ^ 96)) - ((q | 63) ^ (q + a));
+  if(d < a){
+    d = ((c * q) & (c * a)) & ((b * p) + (p * 74));
+  }else{
+    c = ((p ^ 42) ^ (p * b)) ^ ((b ^ d) ^ (q ^ c));
+  }
+  b = ((a * c) - (c * a)) - ((d + 55) + (a | c));
+  a = ((q + 94) | (p | c)) + ((c | 93) & (q & a));
+  c = ((q | 37) | (q ^ b)) & ((d + b) + (q | p));
+  d = ((q * b) | (c ^ 63)) | ((c ^ 72) ^ (a & 88));
+  if(a < 94){
+    c = ((b | q) - (d + 37)) ^ ((p ^ a) & (q & p));
+  }else{
+    c = ((p - 36) | (b + q)) ^ ((p * 20) | (a * 91));
+  }
+  return a + b + c + d;
+}
+
+int func52(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 12;
+  d = 44;
+  a = ((c | q) + (c ^ 97)) + ((c & a) | (d - c));
+  c = ((q & a) | (c - p)) * ((b + q) & (q * b));
+  a = ((c * 30) * (b + a)) + ((d & d) + (b + d));
+  b = ((a * 18) | (p - p)) * ((c * a) & (a * 56));
+  if(a < a){
+    c = ((a * 81) - (q & q)) & ((d * b) - (a - d));
+  }else{
+    d = ((c ^ d) + (c - b)) ^ ((a + p) - (a & p));
+  }
+  a = ((c * c) ^ (b - a)) & ((a + b) ^ (a ^ a));
+  for(i = 0; i < 16; i++){
+    a = ((b | c) | (c ^ b)) - ((c - b) * (d - p));
+  }
+  d = ((c ^ a) & (a * 23)) | ((q & c) ^ (c | q));
+  d = ((c ^ d) + (q * p)) + ((c * q) * (b - c));
+  if(a < p){
+    d = ((a ^ d) + (p ^ a)) | ((d * 25) ^ (d * 92));
+  }else{
+    c = ((q + q) | (p * q)) & ((a - 71) ^ (a | d));
+  }
+  b = ((p + 44) ^ (c & 18)) & ((q | 15) + (d | p));
+  d = ((q + a) + (c * c)) - ((q + b) ^ (b & d));
+  c = ((d + d) + (p ^ c)) - ((q | d) & (d ^ p));
+  for(i = 0; i < 28; i++){
+    c = ((q & a) * (c & 87)) - ((q * 26) ^ (c | d));
+  }
+  if(d < b){
+    d = ((c * a) & (a * d)) | ((b - b) & (q | c));
+  }else{
+    a = ((q & d) & (q | 9)) | ((p ^ 70) + (p & c));
+  }
+  b = ((b + d) | (b & c)) & ((d + c) + (p & d));
+  a = ((b | b) * (p | q)) & ((p + 30) & (c | p));
+  d = ((q | 60) & (b & q)) - ((a - p) + (a * b));
+  d = ((c & p) - (q ^ q)) | ((c ^ 76) ^ (a - b));
+  if(b < 10){
+    b = ((b | b) - (d + q)) - ((p | p) | (a & c));
+  }else{
+    d = ((q | c) ^ (a * 10)) | ((q & b) + (c ^ 17));
+  }
+  for(i = 0; i < 9; i++){
+    d = ((d & 4) & (a ^ b)) | ((a ^ 27) ^ (p | p));
+  }
+  d = ((d * 16) * (c - b)) + ((c & p) ^ (p ^ 7));
+  c = ((b & b) ^ (q + 76)) | ((a - q) + (d - b));
+  a = ((q ^ d) - (a - d)) + ((b + b) | (c | 5));
+  if(c < q){
+    c = ((a ^ b) ^ (a & 65)) ^ ((a - c) & (p | c));
+  }else{
+    c = ((q & b) * (q & 78)) * ((d - p) ^ (d * c));
+  }
+  b = ((q - d) ^ (a - a)) ^ ((q * q) ^ (p + c));
+  c = ((q - q) + (d | a)) & ((a + 17) & (d & 72));
+  for(i = 0; i < 40; i++){
+    c = ((p ^ q) & (d & c)) * ((c | 49) ^ (a | b));
+  }
+  d = ((p + p) * (d & b)) - ((b ^ q) - (c * d));
+  if(c < p){
+    b = ((p * q) * (p ^ d)) | ((b - a) * (b & d));
+  }else{
+    d = ((d + a) & (p * p)) ^ ((c ^ c) + (c + c));
+  }
+  d = ((q ^ p) * (c + q)) & ((p & a) + (a + 82));
+  c = ((c | a) * (q ^ q)) - ((c ^ 35) | (c & d));
+  a = ((a + 53) + (q & c)) * ((b + b) + (p ^ q));
+  a = ((d | a) - (q ^ a)) & ((d & c) + (d | a));
+  if(a < d){
+    d = ((c | d) + (a - 50)) + ((b + q) - (d * c));
+  }else{
+    b = ((d ^ p) & (d - b)) + ((c ^ q) & (b + c));
+  }
+  a = ((d * p) + (p | c)) * ((p & d) ^ (a | 62));
+  b = ((c - 62) * (p - a)) - ((d & d) - (q & p));
+  d = ((b * q) * (p - a)) | ((d | q) ^ (a | c));
+  c = ((c * a) ^ (q - a)) & ((q & d) | (p + 8));
+  if(b < a){
+    a = ((q | b) ^ (b * c)) & ((a & q) ^ (a ^ d));
+  }else{
+    c = ((q ^ 26) * (c - c)) & ((d + a) - (q - c));
+  }
+  return a + b + c + d;
+}
+
+int func53(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 22;
+  d = ((q + q) & (q ^ a)) * ((q * 7) + (c ^ c));
+  a = ((d - a) | (q & 98)) * ((q * p) ^ (b ^ p));
+  c = ((a * d) | (b | d)) ^ ((a & c) | (b & c));
+  a = ((b ^ q) | (b | a)) + ((c | 17) ^ (a + b));
+  if(b < c){
+    c = ((q ^ d) | (p | q)) | ((a * c) ^ (q * 41));
+  }else{
+    d = ((q * q) ^ (q - b)) - ((q - 4) - (b + 18));
+  }
+  b = ((d * b) & (c ^ a)) - ((c & d) ^ (b & d));
+  for(i = 0; i < 35; i++){
+    b = ((p + c) * (d + p)) ^ ((p * b) + (c + 94));
+  }
+  c = ((a | p) | (d | b)) * ((a ^ a) & (c & 48));
+  d = ((b & a) - (d + 17)) - ((a - 77) | (b & c));
+  if(b < p){
+    a = ((d * a) ^ (d * 20)) ^ ((c + p) ^ (c * 23));
+  }else{
+    d = ((a * q) ^ (a ^ a)) | ((c ^ p) - (q + d));
+  }
+  a = ((b + a) + (p - q)) * ((b | 75) | (b & d));
+  a = ((c | 96) + (d ^ c)) & ((a & p) + (c * 46));
+  b = ((b ^ 78) | (b ^ b)) & ((c & p) + (a & b));
+  for(i = 0; i < 38; i++){
+    a = ((p + b) & (a | b)) * ((c * q) & (a ^ 49));
+  }
+  if(a < c){
+    a = ((b + 32) & (p + a)) ^ ((c - 87) ^ (p * a));
+  }else{
+    b = ((q - a) & (a & 61)) & ((b * c) * (p ^ 41));
+  }
+  a = ((p - q) + (q * 51)) * ((c & c) * (d | 45));
+  c = ((d & p) + (a + c)) - ((p | 52) * (b | c));
+  d = ((b ^ p) ^ (d - p)) - ((d + q) * (c - p));
+  d = ((c * p) & (d | q)) & ((d - q) + (p ^ a));
+  if(d < p){
+    b = ((q + 54) - (d ^ p)) - ((a - a) - (c + 57));
+  }else{
+    b = ((a * d) * (q - d)) - ((b & 15) * (p + b));
+  }
+  for(i = 0; i < 34; i++){
+    a = ((q * a) & (p * a)) ^ ((a - b) ^ (b * b));
+  }
+  d = ((b * q) & (d - b)) | ((a ^ q) + (b ^ p));
+  b = ((a | 43) * (p ^ a)) ^ ((d & d) | (q | c));
+  a = ((c - q) - (d - a)) ^ ((p & p) + (q * p));
+  if(a < d){
+    b = ((p | p) - (b ^ d)) + ((p * q) ^ (a & p));
+  }else{
+    b = ((a ^ q) | (p & 54)) ^ ((b * 12) * (q + p));
+  }
+  b = ((a & 36) ^ (c ^ d)) - ((b + p) + (p ^ 64));
+  a = ((a | c) & (b - a)) - ((q + b) - (q * p));
+  for(i = 0; i < 2; i++){
+    a = ((a - p) * (b + p)) & ((q + 14) * (c + a));
+  }
+  c = ((p * 26) ^ (c * a)) + ((q - a) | (b + q));
+  if(d < c){
+    c = ((a + b) * (c & c)) | ((c * q) + (q * b));
+  }else{
+    a = ((d - c) & (c * c)) * ((b | a) + (p + d));
+  }
+  a = ((b | 65) ^ (d ^ q)) * ((a & d) | (c & a));
+  a = ((b & b) * (b + q)) + ((q ^ q) - (p | d));
+  c = ((p & d) & (c * p)) * ((c - c) - (b + a));
+  a = ((q + b) ^ (d * c)) - ((q + b) * (q | c));
+  if(d < a){
+    a = ((d - c) ^ (c & p)) - ((b + d) & (c & c));
+  }else{
+    c = ((c * a) ^ (b & c)) | ((p & b) ^ (a + 15));
+  }
+  a = ((a & p) & (q & d)) ^ ((b * 63) * (c | q));
+  a = ((p & c) - (p * 50)) ^ ((c & 45) & (c | c));
+  c = ((q | c) & (q ^ 17)) ^ ((c * 85) - (c - q));
+  c = ((d * 10) ^ (b & q)) ^ ((a ^ d) & (c ^ 37));
+  if(b < q){
+    d = ((c * a) | (c + d)) * ((p * b) + (q + p));
+  }else{
+    c = ((p - 39) | (p - d)) ^ ((d ^ 91) + (p ^ q));
+  }
+  return a + b + c + d;
+}
+
+int func54(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 98;
+  a = ((d | q) + (p & d)) & ((d & p) & (a ^ q));
+  a = ((d & q) + (q + b)) * ((c + d) | (p & q));
+  d = ((d | 45) | (p ^ a)) | ((p & 8) + (a ^ a));
+  b = ((d - a) | (c ^ q)) & ((b + 89) + (d ^ p));
+  if(d < a){
+    d = ((b * 64) + (b + b)) | ((d - p) - (c + d));
+  }else{
+    b = ((d + d) - (b * b)) & ((p - 58) * (d * 45));
+  }
+  a = ((c + a) * (a * q)) + ((d * d) ^ (b ^ d));
+  for(i = 0; i < 27; i++){
+    c = ((p + p) | (c - b)) - ((q - p) - (b | d));
+  }
+  a = ((a | q) | (b | b)) ^ ((b + p) | (b & b));
+  d = ((p ^ b) * (q ^ c)) | ((b - 86) + (b * a));
+  if(a < a){
+    b = ((a + b) ^ (b | c)) + ((q * p) ^ (q & c));
+  }else{
+    d = ((c + a) | (a & a)) | ((c - a) - (c ^ b));
+  }
+  a = ((q * p) + (p ^ q)) | ((a + d) + (a - b));
+  c = ((a - 24) + (a | q)) | ((p & 47) + (b + q));
+  b = ((q | a) ^ (b - p)) & ((b ^ b) | (b + 18));
+  for(i = 0; i < 31; i++){
+    c = ((p | c) | (d + b)) ^ ((p * p) - (a - p));
+  }
+  if(c < c){
+    b = ((p - 70) * (b - p)) + ((c * d) - (p + a));
+  }else{
+    a = ((q ^ p) * (b ^ p)) * ((d | p) + (b ^ a));
+  }
+  b = ((a | a) - (q | c)) + ((q + d) * (a + d));
+  d = ((c | q) | (q | 94)) * ((q ^ b) - (b | p));
+  b = ((p * b) & (b + 25)) & ((a + a) ^ (a & p));
+  a = ((q + 17) & (b | a)) + ((d ^ 12) + (a & a));
+  if(b < d){
+    b = ((c - p) & (b ^ p)) ^ ((d - 16) * (a - q));
+  }else{
+    a = ((q | a) + (q ^ a)) ^ ((p - c) * (d - q));
+  }
+  for(i = 0; i < 26; i++){
+    a = ((p - b) ^ (d * a)) * ((b + p) + (d - d));
+  }
+  b = ((c ^ b) ^ (c - p)) ^ ((a | c) * (d - b));
+  d = ((a ^ 10) ^ (b & 49)) | ((q - c) | (a - c));
+  d = ((a - p) ^ (b * d)) - ((b + 41) & (a + a));
+  if(c < p){
+    d = ((a + b) + (d * b)) - ((p - 48) * (q - q));
+  }else{
+    b = ((q & q) | (d - c)) * ((b + a) * (d - q));
+  }
+  a = ((p | 79) ^ (d & 40)) & ((c * b) - (b * b));
+  d = ((q | 45) ^ (q + q)) + ((p * c) ^ (a | c));
+  for(i = 0; i < 44; i++){
+    b = ((b & a) | (p * q)) | ((q ^ a) & (q & q));
+  }
+  a = ((q * 34) | (b & 70)) * ((p + a) * (b ^ 87));
+  if(a < a){
+    b = ((q | q) ^ (q | 53)) & ((q * p) + (a + b));
+  }else{
+    c = ((p - c) ^ (b - 40)) & ((b * p) | (c * 55));
+  }
+  b = ((p * 11) & (d - b)) - ((q + c) * (q ^ q));
+  d = ((b ^ q) & (p ^ 49)) & ((a ^ q) * (b - q));
+  c = ((b + a) - (p & 13)) ^ ((c + d) * (b | d));
+  c = ((d + p) - (a - d)) | ((b + 16) * (c | b));
+  if(c < d){
+    d = ((d + b) | (d ^ 22)) + ((a ^ q) - (a ^ q));
+  }else{
+    d = ((b * q) - (a | q)) | ((d - q) + (p & c));
+  }
+  b = ((q | 97) - (b | q)) | ((p | p) | (b + d));
+  c = ((a & q) * (c & c)) & ((b - c) | (d & a));
+  a = ((d | 35) & (b * d)) - ((p * a) - (d & b));
+  c = ((b & 4) * (c & 11)) + ((p ^ b) - (q + c));
+  if(c < q){
+    b = ((a - b) & (b * q)) | ((p | c) ^ (a | 38));
+  }else{
+    b = ((b & q) + (c | 99)) - ((c ^ b) | (d + q));
+  }
+  return a + b + c + d;
+}
+
+int func55(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 54;
+  d = 84;
+  c = ((b + b) | (q | d)) | ((d + d) * (d & b));
+  c = ((a ^ 75) & (p * p)) | ((p * a) - (p + 87));
+  d = ((c - q) ^ (d | d)) | ((p | d) | (p & c));
+  d = ((q - b) | (c * q)) | ((d | 67) & (d - a));
+  if(b < c){
+    d = ((c ^ c) | (q - p)) ^ ((c + q) * (q * q));
+  }else{
+    d = ((c & p) ^ (q ^ p)) ^ ((a + q) ^ (b - a));
+  }
+  b = ((b | b) ^ (q + 31)) + ((p - c) - (p | d));
+  for(i = 0; i < 39; i++){
+    b = ((p ^ p) * (c | p)) & ((q + b) & (b * d));
+  }
+  d = ((q ^ 21) * (b | a)) & ((p + q) - (d + d));
+  d = ((b * c) ^ (d + d)) + ((a ^ c) * (d - p));
+  if(a < q){
+    c = ((c - c) - (a - q)) + ((b * 42) - (c - b));
+  }else{
+    c = ((a | 87) | (b ^ a)) - ((q & 72) * (q & 37));
+  }
+  d = ((d - q) & (p * b)) * ((p + a) & (p + p));
+  c = ((c | 39) | (a - 73)) + ((a - a) * (a ^ p));
+  c = ((b + 69) & (q ^ d)) + ((d ^ b) * (p - q));
+  for(i = 0; i < 16; i++){
+    b = ((d & a) & (b | 79)) - ((a ^ 41) ^ (p - c));
+  }
+  if(b < q){
+    a = ((b + 40) ^ (q & q)) ^ ((q - p) ^ (p * 6));
+  }else{
+    b = ((q + 46) ^ (b * q)) + ((c & a) - (q & q));
+  }
+  c = ((c | b) * (b | q)) * ((a + p) * (q + a));
+  d = ((q ^ b) | (a * 39)) * ((d + d) ^ (a + 52));
+  a = ((b ^ b) ^ (d - q)) ^ ((a * 57) * (p & d));
+  d = ((a ^ 63) + (p | b)) * ((a * 47) & (b + 23));
+  if(b < 77){
+    a = ((p - 33) * (a + c)) ^ ((b | b) ^ (b - d));
+  }else{
+    b = ((a * 83) * (a * 94)) ^ ((q ^ 96) + (c + b));
+  }
+  for(i = 0; i < 14; i++){
+    b = ((c ^ d) & (b | a)) * ((p & q) | (c * q));
+  }
+  b = ((a * d) ^ (c & d)) + ((q + p) ^ (d ^ d));
+  d = ((b - 3) | (q ^ d)) & ((d - q) + (a - d));
+  d = ((d * q) | (c + 46)) & ((p | b) + (a * 13));
+  if(c < 93){
+    d = ((a * c) * (p * a)) ^ ((b | c) & (c & c));
+  }else{
+    a = ((d & c) * (q & p)) & ((a & c) - (p - q));
+  }
+  c = ((d + p) * (p | 32)) | ((b + p) | (b - 12));
+  a = ((q & a) + (q + q)) ^ ((c + b) + (d & 1));
+  for(i = 0; i < 42; i++){
+    d = ((d * p) & (p * 80)) + ((p ^ 62) - (b | a));
+  }
+  d = ((c * a) & (c + b)) * ((c + 5) ^ (d + a));
+  if(b < c){
+    d = ((q * c) & (p + p)) | ((q & b) * (a ^ b));
+  }else{
+    b = ((p & 8) + (q * p)) - ((a - c) & (a & p));
+  }
+  c = ((p * a) & (a * q)) | ((d - a) & (c & p));
+  a = ((p + q) - (q - 3)) * ((b ^ b) | (c * q));
+  c = ((d | p) * (b - a)) ^ ((c * p) + (a ^ b));
+  d = ((a * d) * (q - q)) + ((b + a) ^ (c & d));
+  if(d < a){
+    d = ((c ^ 56) + (p | p)) ^ ((q | c) | (a + b));
+  }else{
+    a = ((a | 59) - (c | b)) - ((b - b) * (p * a));
+  }
+  a = ((p & p) - (q | a)) | ((q + b) ^ (p * p));
+  b = ((a * c) & (d ^ b)) & ((b & d) * (q * a));
+  a = ((p & d) - (d - q)) * ((q * q) * (d * d));
+  b = ((d + 84) | (p ^ d)) ^ ((c ^ d) & (c & d));
+  if(a < d){
+    c = ((c + 42) | (p ^ d)) ^ ((q * b) & (p * d));
+  }else{
+    c = ((d ^ d) * (d | c)) + ((q | c) + (a | d));
+  }
+  return a + b + c + d;
+}
+
+int func56(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 80;
+  c = ((q * 72) & (c & d)) * ((c + c) ^ (b - c));
+  b = ((d * d) & (a ^ c)) * ((c ^ p) - (a | 32));
+  b = ((c - q) & (b * p)) ^ ((d - q) | (c * d));
+  c = ((q & a) | (q * q)) ^ ((c * 41) ^ (q ^ b));
+  if(a < b){
+    c = ((q + d) & (q | c)) + ((b & q) + (q & c));
+  }else{
+    c = ((a & b) | (d - c)) & ((d & d) | (b * 7));
+  }
+  b = ((p ^ 47) * (c - 98)) & ((d * 65) - (c - a));
+  for(i = 0; i < 14; i++){
+    c = ((b * q) + (q ^ 17)) - ((p * 55) + (p & q));
+  }
+  d = ((a ^ a) ^ (p - b)) & ((q * d) + (q - q));
+  d = ((c * p) - (b & a)) | ((b | q) | (p * d));
+  if(c < q){
+    d = ((c ^ c) ^ (c - 32)) ^ ((q | c) | (c * c));
+  }else{
+    b = ((c & d) * (a | q)) ^ ((a & a) + (a | p));
+  }
+  c = ((p * q) | (p * a)) - ((d * 96) * (a | a));
+  d = ((b ^ p) - (c ^ 2)) - ((q | d) & (d ^ p));
+  a = ((q & p) ^ (a - p)) | ((p & d) & (c ^ b));
+  for(i = 0; i < 45; i++){
+    c = ((a ^ b) - (p & b)) ^ ((p + b) + (a | c));
+  }
+  if(b < d){
+    d = ((c * q) - (b + q)) & ((c | a) - (c * 18));
+  }else{
+    c = ((c & 60) + (d * 56)) - ((c | a) * (d + 45));
+  }
+  c = ((b + 96) - (d - d)) - ((q & d) - (c * b));
+  c = ((d - 56) | (b ^ p)) + ((p * 14) ^ (d - q));
+  b = ((c - 77) - (b ^ b)) + ((b + d) & (a | b));
+  b = ((p - d) + (a * b)) - ((a & q) & (b - d));
+  if(b < a){
+    d = ((b * c) - (d - c)) | ((b & b) + (a - c));
+  }else{
+    a = ((b - 73) | (q | p)) | ((p ^ 56) | (a - c));
+  }
+  for(i = 0; i < 44; i++){
+    c = ((q | 5) * (q & d)) ^ ((b & a) ^ (d ^ q));
+  }
+  d = ((d | q) + (a & c)) & ((q * p) - (c | d));
+  d = ((a - d) | (b + 62)) & ((c & 60) - (c - p));
+  c = ((a & a) + (b - 98)) * ((b & d) | (a * a));
+  if(c < b){
+    b = ((b ^ d) & (c | q)) * ((c ^ d) ^ (c | b));
+  }else{
+    b = ((d * b) ^ (b + 78)) + ((p & b) * (p - a));
+  }
+  b = ((d + 27) - (b + b)) ^ ((a - p) + (b | 16));
+  d = ((p & a) - (b * b)) & ((b & a) ^ (c & q));
+  for(i = 0; i < 44; i++){
+    d = ((q & d) - (p * a)) - ((q * p) - (b * p));
+  }
+  d = ((p - c) * (c + b)) | ((p + 83) | (a * p));
+  if(d < c){
+    a = ((d - c) | (p & p)) + ((a - p) * (a | a));
+  }else{
+    a = ((c & b) ^ (b + p)) ^ ((d - p) - (d ^ b));
+  }
+  d = ((d - b) + (d * 33)) - ((a * p) * (b + b));
+  d = ((a + c) & (d ^ p)) + ((b & d) ^ (c + 67));
+  c = ((q ^ 99) * (c & 44)) | ((p * 23) & (a - q));
+  a = ((d * b) ^ (p ^ 78)) * ((d ^ 77) * (p ^ d));
+  if(a < p){
+    a = ((d * p) | (b & q)) - ((a ^ 77) ^ (c - q));
+  }else{
+    c = ((a | q) ^ (q + 36)) - ((c ^ 7) ^ (p - d));
+  }
+  b = ((b - 15) + (c + b)) & ((d & 23) + (d + a));
+  c = ((d * q) ^ (p & b)) ^ ((d + c) - (q ^ b));
+  c = ((q & c) * (q ^ 66)) | ((b * a) | (d & d));
+  d = ((d * d) ^ (a ^ p)) | ((d + d) - (c & q));
+  if(b < b){
+    b = ((d | b) | (d | q)) ^ ((d * 73) - (b + b));
+  }else{
+    c = ((d ^ 71) & (p + q)) ^ ((d * d) ^ (q ^ 3));
+  }
+  return a + b + c + d;
+}
+
+int func57(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 3;
+  d = 58;
+  c = ((c & q) + (p + q)) ^ ((b ^ q) & (d ^ 63));
+  a = ((a + 29) * (q ^ 61)) ^ ((q ^ 25) + (p * d));
+  c = ((a | 12) ^ (a * 39)) - ((c ^ c) * (d + q));
+  d = ((b ^ p) + (c + 89)) + ((d | a) | (d * q));
+  if(a < b){
+    a = ((d & 97) - (a ^ 72)) & ((d * q) ^ (q | a));
+  }else{
+    d = ((c + q) + (b * q)) ^ ((a + d) * (q & c));
+  }
+  d = ((b ^ b) ^ (a ^ a)) & ((p - p) ^ (c * d));
+  for(i = 0; i < 18; i++){
+    b = ((p * a) * (q ^ d)) * ((p + 89) ^ (d | 32));
+  }
+  d = ((c & d) - (a & 12)) & ((d ^ c) ^ (b - d));
+  a = ((a + q) * (c + a)) + ((c + c) + (p - 22));
+  if(d < p){
+    b = ((p & d) * (q & a)) - ((a ^ q) ^ (d & q));
+  }else{
+    c = ((p * 92) | (a + 69)) ^ ((b * b) - (q - p));
+  }
+  b = ((p | b) + (a | d)) * ((b + 23) + (b & b));
+  d = ((q * p) | (q | q)) ^ ((p * 88) - (p & 52));
+  b = ((a ^ d) & (a & 35)) & ((q ^ 13) - (a | d));
+  for(i = 0; i < 20; i++){
+    d = ((a ^ 19) * (b & a)) | ((a * p) | (d & a));
+  }
+  if(b < 72){
+    c = ((c - b) ^ (a & a)) & ((q - b) | (q ^ 85));
+  }else{
+    b = ((d | d) ^ (p & 26)) | ((c & a) * (c + p));
+  }
+  a = ((b - d) - (a - 90)) & ((b + c) - (c - 60));
+  a = ((b ^ 96) & (q - c)) ^ ((a & a) + (d ^ a));
+  a = ((a - p) ^ (c + 86)) | ((b * p) | (d * 99));
+  c = ((c + b) ^ (p ^ c)) - ((a * b) ^ (c * c));
+  if(c < d){
+    b = ((d * 16) * (a ^ b)) ^ ((p - c) & (a & b));
+  }else{
+    d = ((p * c) & (b + p)) * ((p | 8) + (c & b));
+  }
+  for(i = 0; i < 17; i++){
+    d = ((b + d) * (d & q)) & ((c + b) - (d | d));
+  }
+  a = ((d ^ c) - (c ^ 58)) * ((a | d) + (a + a));
+  b = ((q | b) - (a - c)) + ((a | b) ^ (p & 30));
+  c = ((p - c) & (p | b)) ^ ((c + c) | (b ^ b));
+  if(d < d){
+    c = ((b * p) * (q & q)) | ((b - d) - (d ^ d));
+  }else{
+    c = ((c + p) ^ (c & 75)) + ((a | p) + (p * b));
+  }
+  c = ((a ^ a) & (a & a)) * ((c * c) * (p + c));
+  a = ((c + b) - (d + b)) & ((c - 43) * (d ^ c));
+  for(i = 0; i < 2; i++){
+    c = ((c - d) ^ (q ^ a)) ^ ((q * c) & (q * 34));
+  }
+  b = ((b + q) + (p * 53)) | ((c ^ 32) + (q ^ 72));
+  if(c < 52){
+    d = ((p * d) ^ (q + a)) + ((d & c) & (b ^ p));
+  }else{
+    a = ((a + q) & (p | q)) + ((b - p) ^ (c - 44));
+  }
+  a = ((p | q) ^ (a - 6)) | ((b + b) | (q ^ b));
+  b = ((p - 98) - (b ^ 73)) ^ ((d ^ b) ^ (p * d));
+  d = ((q & a) | (p & d)) & ((b + a) | (a + c));
+  b = ((a | d) | (a | a)) * ((p - 53) & (a ^ 7));
+  if(d < 51){
+    c = ((d ^ a) & (d ^ p)) * ((d + a) * (p & c));
+  }else{
+    a = ((q + d) + (b + b)) * ((c | 9) & (q | a));
+  }
+  b = ((d | d) | (d ^ b)) & ((c + q) | (p ^ c));
+  c = ((a ^ p) ^ (d + b)) - ((d * q) - (p + a));
+  b = ((a & d) & (c * c)) | ((b | c) + (q * a));
+  d = ((p | a) | (d | a)) - ((q & q) * (c + p));
+  if(c < 42){
+    b = ((d + c) * (c * p)) + ((q | 61) ^ (b * d));
+  }else{
+    c = ((q - q) + (b + 27)) | ((q * a) | (p & q));
+  }
+  return a + b + c + d;
+}
+
+int func58(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 57;
+  d = 88;
+  b = ((a - p) * (a * b)) - ((q + a) * (d | 52));
+  d = ((q * q) - (c ^ d)) | ((p * q) & (p & q));
+  a = ((a - a) ^ (a ^ 99)) * ((b ^ b) ^ (a ^ 11));
+  d = ((c - p) - (q * 10)) + ((d & a) - (a ^ a));
+  if(c < 85){
+    a = ((p * q) ^ (a - 82)) * ((q - q) - (b - 53));
+  }else{
+    c = ((a & q) & (c * d)) & ((d ^ a) & (c - b));
+  }
+  b = ((a & c) + (q * q)) ^ ((p + 46) - (b & d));
+  for(i = 0; i < 17; i++){
+    a = ((p - q) | (d + d)) + ((b ^ 78) | (q ^ c));
+  }
+  a = ((b * p) ^ (b & b)) - ((b | a) & (a - a));
+  a = ((p - c) & (q | c)) - ((d ^ d) | (a & d));
+  if(d < 20){
+    b = ((a * p) & (b * q)) - ((p | p) & (a + p));
+  }else{
+    a = ((c | 8) - (a - a)) * ((b - 34) ^ (q - q));
+  }
+  d = ((q | q) + (a ^ a)) & ((d | p) ^ (b ^ 46));
+  b = ((c & q) | (c | 46)) + ((a + p) | (p & p));
+  a = ((q * b) | (q | d)) * ((d - 34) ^ (q & b));
+  for(i = 0; i < 33; i++){
+    a = ((a * 60) - (c * q)) | ((d + a) | (b * q));
+  }
+  if(a < d){
+    d = ((d & c) & (d | b)) - ((d * 40) & (b + b));
+  }else{
+    b = ((p - a) + (q - c)) | ((q + 99) & (p ^ p));
+  }
+  d = ((p * 74) - (d - 27)) | ((a | a) * (b - q));
+  b = ((b ^ 6) + (a - 48)) & ((d | 6) - (b + d));
+  b = ((p & d) & (b & 50)) * ((p - d) + (p * 54));
+  d = ((d - a) ^ (b - a)) & ((b * a) * (d + b));
+  if(a < b){
+    d = ((a + d) - (a & 97)) | ((c - a) | (a + p));
+  }else{
+    d = ((p - d) & (a | q)) + ((q & a) * (q | 30));
+  }
+  for(i = 0; i < 14; i++){
+    a = ((d * a) + (c ^ a)) ^ ((a - a) + (q | d));
+  }
+  d = ((b ^ a) + (d & 24)) + ((a ^ q) - (p * 70));
+  b = ((b * c) - (p & 18)) + ((p ^ a) + (a & 96));
+  a = ((c | c) * (b + q)) + ((d + c) * (d & c));
+  if(a < a){
+    d = ((a + d) + (a + 89)) - ((c | a) ^ (a + c));
+  }else{
+    c = ((b - a) | (p + d)) ^ ((b + b) * (q + 1));
+  }
+  c = ((p + q) * (q | a)) - ((c * 57) | (d ^ c));
+  a = ((d - q) + (p - b)) * ((d & d) * (q * 10));
+  for(i = 0; i < 49; i++){
+    d = ((b * q) | (q * 5)) + ((d & q) | (b & q));
+  }
+  b = ((p * d) | (c & q)) + ((b + d) - (d * c));
+  if(c < p){
+    b = ((p ^ b) + (p | a)) * ((a | 13) & (d | a));
+  }else{
+    d = ((c * a) ^ (d - c)) | ((c & c) & (c | d));
+  }
+  b = ((d & b) | (c ^ 30)) - ((a + a) - (b | q));
+  c = ((b | a) - (a + 35)) | ((a - p) * (a + d));
+  c = ((q & 40) * (c + 6)) & ((p - q) & (p + a));
+  c = ((q - 64) | (p ^ 69)) + ((d ^ d) * (c & p));
+  if(b < a){
+    a = ((p - 33) * (b ^ d)) - ((c * a) + (a - p));
+  }else{
+    d = ((a ^ b) - (d & 20)) & ((a * c) | (q & c));
+  }
+  a = ((a ^ p) & (q ^ a)) & ((b | a) ^ (q + 35));
+  d = ((d * d) + (c ^ 66)) & ((a | c) ^ (a - p));
+  a = ((a | d) ^ (p + p)) + ((d - 61) & (a ^ c));
+  a = ((c + 81) | (d & c)) | ((a * p) & (q | p));
+  if(d < q){
+    b = ((c * 17) + (q | p)) + ((q - d) * (c + c));
+  }else{
+    d = ((b * 56) + (b + q)) | ((q | q) + (c + 43));
+  }
+  return a + b + c + d;
+}
+
+int func59(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 72;
+  d = 43;
+  a = ((q + d) ^ (d & 11)) ^ ((q - q) * (d ^ q));
+  d = ((c | b) ^ (d ^ p)) & ((d & d) & (c * c));
+  a = ((c * 87) & (d & a)) * ((q & 97) - (q & p));
+  b = ((d | 78) & (b ^ d)) + ((b - 8) | (a * c));
+  if(a < c){
+    d = ((b + c) - (a - 77)) | ((q & 36) - (q - 79));
+  }else{
+    d = ((a | d) - (b | q)) + ((q + a) - (b - q));
+  }
+  a = ((a + c) + (q + d)) - ((a | c) - (c + 86));
+  for(i = 0; i < 17; i++){
+    c = ((q - d) | (c + d)) & ((a | b) + (b | c));
+  }
+  b = ((c - 40) - (c + 5)) & ((b ^ a) + (b & 55));
+  b = ((p | q) - (p * q)) & ((p * 51) ^ (d ^ b));
+  if(a < p){
+    c = ((c & q) + (q ^ b)) & ((q + 11) | (q ^ b));
+  }else{
+    d = ((q * p) & (q - 79)) | ((q + 89) ^ (d | q));
+  }
+  a = ((a + a) | (q | p)) * ((p - 27) + (b | d));
+  b = ((c * a) & (a - a)) * ((q & p) | (a + 70));
+  c = ((b + p) - (c - c)) ^ ((b & c) ^ (c * q));
+  for(i = 0; i < 20; i++){
+    d = ((b + 10) - (b ^ 87)) ^ ((b * c) - (d - 51));
+  }
+  if(c < p){
+    a = ((c + a) | (a - b)) - ((c - a) + (b * b));
+  }else{
+    c = ((c - d) - (a & b)) | ((d | 41) & (p - 24));
+  }
+  a = ((p | q) - (b * b)) - ((a + b) * (a & a));
+  a = ((a + a) & (a * b)) * ((p - c) ^ (a ^ 13));
+  d = ((d + q) & (q * p)) & ((q | 82) + (b | 13));
+  d = ((p & a) * (b * 49)) ^ ((a * q) - (a ^ c));
+  if(a < p){
+    c = ((q ^ d) + (b ^ 28)) & ((b & 87) | (c * d));
+  }else{
+    c = ((d + 41) * (b + 53)) - ((b | b) - (d + c));
+  }
+  for(i = 0; i < 29; i++){
+    c = ((b - 73) * (c * q)) | ((p | 4) & (a - a));
+  }
+  a = ((b & c) & (b + p)) & ((b ^ p) & (b * a));
+  d = ((a | c) & (b ^ d)) - ((q * 68) | (q + p));
+  a = ((b * b) - (p | 97)) | ((b - c) * (d & c));
+  if(a < q){
+    c = ((p - c) * (q | c)) * ((q ^ q) & (a & p));
+  }else{
+    c = ((q ^ 64) * (d & a)) & ((p + p) * (c * 16));
+  }
+  b = ((q | q) & (a + 51)) | ((a | b) ^ (d & p));
+  b = ((a & d) + (b & c)) * ((a ^ c) ^ (p * d));
+  for(i = 0; i < 24; i++){
+    b = ((a + b) ^ (q - q)) - ((d & q) ^ (a ^ p));
+  }
+  b = ((p - 22) - (c ^ c)) + ((a & b) | (d + 20));
+  if(c < 49){
+    d = ((p ^ q) & (c | c)) + ((q + 90) + (b | c));
+  }else{
+    c = ((p ^ c) & (b - b)) & ((a * d) | (d | d));
+  }
+  a = ((q | 87) - (a + 89)) * ((q - 83) & (c * c));
+  a = ((p - a) ^ (q + c)) & ((c & a) ^ (d & 14));
+  c = ((p - 43) ^ (b * q)) ^ ((d | 79) ^ (d + 54));
+  b = ((d - q) | (a & 11)) + ((p & 49) ^ (a + a));
+  if(d < q){
+    b = ((q ^ b) ^ (a - p)) + ((c | c) - (b ^ c));
+  }else{
+    b = ((q ^ 71) | (c | a)) + ((a & a) ^ (d | q));
+  }
+  c = ((b & 24) & (q ^ p)) ^ ((q ^ c) & (p * d));
+  a = ((d + b) - (q * 81)) - ((a & a) | (q + d));
+  a = ((b ^ d) * (c - b)) - ((a & c) ^ (a + c));
+  a = ((c ^ q) & (d + p)) - ((d * q) + (a ^ q));
+  if(a < a){
+    d = ((d ^ p) ^ (q * 14)) ^ ((q - q) ^ (b | a));
+  }else{
+    d = ((p ^ 33) & (q + q)) + ((b - 49) * (c * q));
+  }
+  return a + b + c + d;
+}
+
+int func60(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 23;
+  d = 43;
+  c = ((a - p) - (c - b)) & ((d - d) - (c - b));
+  d = ((a ^ p) & (b - d)) & ((q & d) - (a ^ 43));
+  a = ((p - d) * (a - c)) - ((b & a) & (p | b));
+  d = ((b & 80) - (q * q)) & ((a ^ a) ^ (q + a));
+  if(d < 49){
+    c = ((p | a) & (d + q)) ^ ((d | b) | (p ^ 96));
+  }else{
+    a = ((b - 59) - (a & d)) * ((q + p) - (b * b));
+  }
+  b = ((b | b) & (d | a)) + ((c + b) - (q + c));
+  for(i = 0; i < 13; i++){
+    d = ((q ^ p) | (b | p)) - ((q * 88) + (p & c));
+  }
+  a = ((d & a) | (p | q)) + ((q & 64) | (b + c));
+  a = ((d | p) * (b | 67)) * ((d + 58) - (p * 48));
+  if(b < p){
+    d = ((a * p) & (b ^ 74)) | ((q | d) * (b | a));
+  }else{
+    c = ((q * a) & (b & q)) - ((b - d) ^ (c & b));
+  }
+  c = ((c | c) * (q | 66)) * ((a & d) * (d ^ 20));
+  c = ((b * q) - (a ^ 71)) | ((a | c) - (a & d));
+  b = ((a * 50) | (c + 74)) - ((d & c) | (b ^ d));
+  for(i = 0; i < 31; i++){
+    b = ((a & 33) - (a | p)) | ((d & b) - (q & c));
+  }
+  if(c < a){
+    a = ((b - d) & (d ^ p)) | ((d & b) * (b - a));
+  }else{
+    b = ((d & c) ^ (q ^ 72)) + ((p ^ c) | (a & c));
+  }
+  b = ((p ^ 33) + (p + 88)) + ((a | p) - (c & 30));
+  b = ((b ^ 51) * (d ^ 70)) | ((a ^ b) | (d ^ p));
+  c = ((c + a) & (a + q)) * ((b | q) | (d ^ p));
+  a = ((p * a) ^ (a * 93)) * ((b | d) & (c | 7));
+  if(b < c){
+    d = ((d + q) | (d ^ 14)) & ((a | q) * (q | a));
+  }else{
+    a = ((d ^ c) - (p & 1)) + ((d * b) * (d ^ b));
+  }
+  for(i = 0; i < 30; i++){
+    c = ((b - a) & (d - 94)) & ((a + d) - (p ^ c));
+  }
+  c = ((b | 89) + (q + a)) & ((d + b) + (a + q));
+  a = ((d + d) & (q * q)) - ((d | 44) - (c ^ q));
+  a = ((c + a) - (q + 57)) - ((b ^ a) & (c ^ d));
+  if(a < d){
+    b = ((d - d) & (d | d)) & ((d | d) - (c * q));
+  }else{
+    d = ((b * p) + (c - a)) ^ ((b + d) * (c - b));
+  }
+  c = ((b ^ p) ^ (d * b)) & ((c | p) ^ (b & p));
+  d = ((q - b) ^ (c | c)) - ((p * 19) * (d - d));
+  for(i = 0; i < 36; i++){
+    b = ((a - d) * (b - c)) & ((q * p) & (c + d));
+  }
+  d = ((d & a) * (d | q)) * ((b ^ c) & (a * 39));
+  if(a < a){
+    a = ((p + 26) | (d * 46)) * ((a * 78) | (b ^ 6));
+  }else{
+    c = ((d - a) * (p + b)) - ((q + q) & (q - q));
+  }
+  c = ((d | q) - (q * 5)) & ((d & 22) ^ (c | c));
+  b = ((a ^ p) | (p - 36)) | ((d ^ 68) ^ (c & 50));
+  c = ((q + p) + (q | d)) | ((c - 1) * (b | q));
+  d = ((q ^ 77) ^ (q - q)) + ((c * d) | (d ^ b));
+  if(d < p){
+    a = ((c | d) | (d & 68)) | ((q ^ a) & (c + b));
+  }else{
+    a = ((q | b) - (d ^ d)) * ((p + 82) ^ (c ^ a));
+  }
+  b = ((b * a) | (b & q)) & ((a & 73) - (b & 81));
+  b = ((c ^ d) + (c ^ q)) | ((b ^ c) & (b & q));
+  b = ((b | 75) + (c + d)) ^ ((b * 68) ^ (q - a));
+  c = ((q | d) * (p & p)) * ((d * q) - (q + c));
+  if(c < p){
+    a = ((a + a) * (a ^ p)) | ((d + b) - (b + b));
+  }else{
+    c = ((b * 18) & (c + q)) & ((b & a) * (a + d));
+  }
+  return a + b + c + d;
+}
+
+int func61(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 82;
+  d = 34;
+  c = ((d ^ a) - (d * a)) - ((a - 66) + (c ^ 8));
+  a = ((q ^ 32) & (d & 1)) ^ ((d | d) - (q & a));
+  a = ((q & b) + (b ^ p)) & ((p ^ 44) | (q - p));
+  a = ((b * p) & (d - 1)) * ((c - 74) | (c * 35));
+  if(b < a){
+    d = ((q * 79) + (d | a)) * ((b ^ d) & (p ^ d));
+  }else{
+    a = ((d ^ d) - (p + 64)) - ((c ^ c) + (p ^ c));
+  }
+  a = ((c * a) | (d | d)) | ((c + 47) & (q - a));
+  for(i = 0; i < 34; i++){
+    b = ((p & 7) + (d - d)) & ((b | a) - (q * d));
+  }
+  d = ((p & d) & (p ^ 60)) - ((p ^ a) * (p & b));
+  b = ((a | q) ^ (c * b)) - ((q & q) & (c - d));
+  if(d < p){
+    a = ((c & b) ^ (a - c)) & ((a & b) | (b & d));
+  }else{
+    a = ((q + 77) | (c & d)) | ((q * 21) * (d + d));
+  }
+  c = ((p | p) - (b ^ b)) & ((d & c) | (q - p));
+  a = ((a - a) | (b & a)) ^ ((p | 25) & (d + b));
+  a = ((p ^ a) * (q | c)) * ((d | 33) & (d * a));
+  for(i = 0; i < 39; i++){
+    b = ((c * c) & (d + p)) + ((p | 91) | (b * b));
+  }
+  if(b < p){
+    c = ((q ^ d) + (b - 48)) * ((d & 36) - (a & q));
+  }else{
+    c = ((d & p) - (b & q)) | ((q ^ d) | (b & 47));
+  }
+  d = ((b | 54) + (a ^ q)) * ((b | a) ^ (d ^ p));
+  c = ((q * p) * (p ^ b)) | ((p - p) | (d - q));
+  a = ((c & b) & (d & q)) ^ ((b * 25) - (b + c));
+  a = ((p ^ b) ^ (c + a)) ^ ((b - a) + (d & q));
+  if(c < p){
+    b = ((d * p) - (p * d)) - ((q | d) - (a & 6));
+  }else{
+    c = ((c | d) - (a & q)) * ((b + 32) - (b | d));
+  }
+  for(i = 0; i < 7; i++){
+    c = ((c | p) & (a * 26)) * ((d & b) * (d + 56));
+  }
+  a = ((b & 61) - (b * b)) & ((c - q) & (b - b));
+  d = ((q + b) & (b & b)) - ((q * 18) | (q | 46));
+  c = ((d ^ q) & (d & p)) + ((p * 20) & (d | a));
+  if(c < d){
+    a = ((d + d) + (p * 79)) + ((b ^ q) * (p ^ 71));
+  }else{
+    d = ((a & q) | (a - c)) ^ ((a | p) & (c - p));
+  }
+  a = ((a + b) - (a | d)) - ((q ^ 13) | (a - 93));
+  c = ((c + c) ^ (d + c)) | ((p * d) - (a ^ b));
+  for(i = 0; i < 33; i++){
+    c = ((d & p) & (b | 88)) * ((a + p) - (c - a));
+  }
+  a = ((d & b) - (c | c)) + ((c * q) * (b ^ a));
+  if(c < c){
+    a = ((p + 18) + (b + p)) - ((d ^ d) ^ (c | 6));
+  }else{
+    d = ((c * 68) - (d * c)) + ((q + 74) ^ (q + p));
+  }
+  a = ((a - 53) - (p - q)) | ((q - d) & (a * 82));
+  a = ((a ^ b) | (p * b)) - ((c | b) + (a & c));
+  b = ((p * b) ^ (b | p)) | ((c | 69) * (d + d));
+  a = ((q + b) * (d & b)) - ((a - a) - (c ^ 35));
+  if(b < d){
+    d = ((q - 73) - (b & c)) & ((a ^ b) - (a + 67));
+  }else{
+    c = ((p & b) + (d & 33)) + ((d & p) & (d ^ b));
+  }
+  b = ((p * 33) ^ (d ^ c)) - ((c - 78) ^ (b + 32));
+  a = ((p + b) | (d - q)) * ((d - 24) ^ (d - d));
+  d = ((d ^ p) * (d - b)) ^ ((a * q) ^ (b + 71));
+  b = ((p & d) * (d | q)) + ((a + a) + (q - c));
+  if(b < d){
+    c = ((c & 86) ^ (c - a)) ^ ((d - a) - (b ^ c));
+  }else{
+    a = ((c - d) & (a * q)) - ((c & b) + (a + 40));
+  }
+  return a + b + c + d;
+}
+
+int func62(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 87;
+  d = 49;
+  d = ((d + a) - (p ^ 16)) & ((a + a) ^ (c & q));
+  a = ((p | c) * (a ^ p)) & ((q + a) * (a | d));
+  d = ((c - q) - (b + 26)) + ((d | 12) & (b + p));
+  d = ((d - a) | (d ^ 30)) * ((a - 29) | (p + 81));
+  if(d < p){
+    d = ((b * 59) - (p * 91)) | ((c + a) & (d + q));
+  }else{
+    b = ((b & b) - (p - a)) * ((c & d) & (q + 76));
+  }
+  b = ((p | c) - (a | 45)) * ((b ^ 69) & (a + d));
+  for(i = 0; i < 50; i++){
+    a = ((p | 38) | (p | p)) + ((b | b) * (d + 85));
+  }
+  d = ((d * d) * (q * q)) - ((d + d) + (d + p));
+  a = ((b ^ 97) * (p * b)) * ((d * a) ^ (c + p));
+  if(a < 10){
+    a = ((p | q) & (a & 63)) ^ ((c - q) - (b & p));
+  }else{
+    d = ((b + c) * (d - d)) & ((b + 15) * (b + a));
+  }
+  a = ((d + 91) * (c - 89)) ^ ((c & q) ^ (b & p));
+  b = ((p ^ b) - (q & b)) & ((q ^ q) * (b + 23));
+  a = ((a + 24) * (b - p)) & ((c + b) & (p | c));
+  for(i = 0; i < 3; i++){
+    c = ((p & d) | (p | c)) & ((b | b) & (b | 10));
+  }
+  if(b < p){
+    d = ((p * a) | (b * a)) + ((b & a) | (d | p));
+  }else{
+    c = ((p & d) + (c - a)) | ((p - a) & (a & p));
+  }
+  d = ((a | d) ^ (a | 62)) & ((p - d) | (a & c));
+  a = ((a * b) + (q | a)) & ((c ^ q) * (b & d));
+  c = ((c + 69) | (b | q)) - ((b * 36) ^ (p - b));
+  a = ((q + q) & (c - d)) + ((p & 13) + (p ^ 17));
+  if(a < 97){
+    b = ((q ^ p) | (a ^ d)) + ((p * d) * (c + 30));
+  }else{
+    b = ((c - q) + (p * q)) + ((p * 66) | (p & 37));
+  }
+  for(i = 0; i < 13; i++){
+    d = ((b + d) + (c + b)) ^ ((c - d) - (p - 3));
+  }
+  a = ((c - d) - (q * q)) - ((c & 61) | (b & d));
+  b = ((p & 34) - (d | d)) & ((b - c) - (q - b));
+  d = ((d | b) | (d ^ b)) * ((p | b) ^ (p | 82));
+  if(a < 11){
+    c = ((p + q) - (a & c)) + ((a | 15) & (d & d));
+  }else{
+    b = ((d ^ c) & (b * c)) - ((q + a) & (a & p));
+  }
+  b = ((c + 46) + (a | b)) & ((a - 8) & (d & a));
+  d = ((b | c) * (a - b)) + ((q | q) - (d - b));
+  for(i = 0; i < 49; i++){
+    b = ((p + p) & (q & 93)) ^ ((a - c) - (c ^ c));
+  }
+  a = ((q ^ p) + (a | 49)) * ((q * c) & (d - 96));
+  if(a < a){
+    c = ((a + q) * (c & a)) - ((p & c) * (p * 86));
+  }else{
+    c = ((b * c) * (q - 20)) + ((q * p) | (p ^ q));
+  }
+  d = ((d - c) + (c ^ p)) | ((c * c) ^ (p & c));
+  d = ((d | a) ^ (q * 47)) - ((q + a) - (b & a));
+  d = ((p + 98) | (q ^ q)) * ((p * d) | (q ^ 49));
+  d = ((c * a) + (d | a)) | ((b - a) & (b * 45));
+  if(c < 20){
+    d = ((d - c) + (d - a)) * ((c & 82) * (b * c));
+  }else{
+    b = ((a - 56) + (q ^ q)) & ((q + 11) | (q & q));
+  }
+  b = ((b - a) & (b + d)) * ((c - p) * (q | q));
+  b = ((p ^ q) * (d + 4)) ^ ((b * p) * (d + 54));
+  a = ((p - q) ^ (c ^ c)) * ((b + 59) - (b & q));
+  c = ((c | 17) | (c + d)) ^ ((p + d) * (q ^ 71));
+  if(c < c){
+    c = ((q * 24) - (q ^ a)) | ((q ^ d) - (q | b));
+  }else{
+    a = ((c ^ p) ^ (q & 57)) & ((p * 92) ^ (c + b));
+  }
+  return a + b + c + d;
+}
+
+int func63(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 22;
+  c = ((a + p) + (p ^ p)) ^ ((p & p) + (d + q));
+  c = ((a & q) + (q ^ p)) + ((d & 14) & (b + b));
+  b = ((d - 7) & (a & c)) | ((q - p) * (c ^ d));
+  a = ((p + 48) | (c - 82)) | ((b + b) & (c + b));
+  if(b < q){
+    b = ((a + c) & (d + q)) + ((q + 34) | (p & 11));
+  }else{
+    b = ((a ^ c) * (q | q)) & ((a ^ p) - (p * 53));
+  }
+  d = ((q + a) + (b - p)) + ((a * 59) ^ (c | 80));
+  for(i = 0; i < 31; i++){
+    b = ((d * b) + (p * 13)) ^ ((c + d) ^ (c + p));
+  }
+  b = ((a | 55) - (c * p)) + ((b & q) | (q & 90));
+  a = ((b | b) ^ (a | q)) * ((a & d) * (p - b));
+  if(d < p){
+    b = ((p ^ p) * (d | p)) + ((p + c) | (c + c));
+  }else{
+    d = ((b + c) * (p | p)) ^ ((q + c) & (c & 90));
+  }
+  a = ((b - d) ^ (c | b)) & ((p & 17) * (c * p));
+  c = ((a * a) * (b & 97)) | ((d ^ 62) ^ (c - b));
+  c = ((b * b) * (c - 41)) - ((a + d) & (a - 66));
+  for(i = 0; i < 37; i++){
+    d = ((q + b) | (p | p)) ^ ((b + q) | (q & q));
+  }
+  if(b < d){
+    c = ((p & a) + (p - c)) & ((c | 51) & (a * c));
+  }else{
+    a = ((b & p) | (d ^ c)) & ((b | b) & (b * c));
+  }
+  d = ((p & q) * (q ^ a)) | ((b | p) + (d | b));
+  d = ((d - c) + (q & b)) - ((p | c) ^ (p | 82));
+  d = ((a * a) | (p - p)) * ((b ^ c) - (a | d));
+  a = ((a * q) * (p - c)) + ((a | c) + (a * q));
+  if(d < a){
+    d = ((d | 89) + (q | q)) + ((q - b) + (b * b));
+  }else{
+    a = ((c | d) + (c - b)) + ((q | p) ^ (b | c));
+  }
+  for(i = 0; i < 44; i++){
+    b = ((b ^ 58) ^ (d - 40)) * ((q ^ 72) | (p * 75));
+  }
+  c = ((p & q) * (a & a)) | ((p + 96) ^ (c - b));
+  d = ((c * c) + (c * d)) & ((p + 34) + (c | c));
+  d = ((d - a) + (a | b)) & ((c * a) - (p - 79));
+  if(b < 16){
+    c = ((p * q) * (d - a)) + ((c - q) * (q - p));
+  }else{
+    d = ((d * p) ^ (c - p)) * ((c * 6) | (a & d));
+  }
+  c = ((c - q) + (d & q)) | ((d - 38) & (d & q));
+  b = ((c & b) - (q + b)) * ((b - p) & (p * b));
+  for(i = 0; i < 43; i++){
+    a = ((q * q) - (c ^ b)) * ((c + p) + (c * 55));
+  }
+  b = ((p & 23) + (q ^ 49)) + ((a & 30) - (d - p));
+  if(a < b){
+    d = ((c & d) & (d + b)) | ((c | p) * (p - d));
+  }else{
+    c = ((c + d) | (d + q)) - ((b - q) | (d - p));
+  }
+  a = ((b ^ 42) + (d & 84)) - ((c & p) + (d - 25));
+  a = ((a * a) * (q + b)) - ((q & c) + (p - q));
+  b = ((c + q) * (d * d)) + ((b - 56) + (d * 58));
+  d = ((p * 60) + (b & 10)) | ((q - d) | (p | c));
+  if(d < c){
+    d = ((b + q) ^ (a & p)) | ((q & q) | (d & 49));
+  }else{
+    d = ((p & 28) ^ (d - 81)) - ((c + d) & (c * p));
+  }
+  b = ((p ^ d) ^ (d ^ 54)) * ((q | d) | (d + q));
+  b = ((p * b) - (c * 88)) ^ ((a | a) + (a | p));
+  b = ((b & 23) - (b + q)) | ((d | b) - (q + 25));
+  b = ((q | d) + (d + 69)) + ((q + a) | (p * d));
+  if(a < 77){
+    a = ((a & q) * (c ^ b)) - ((p ^ 24) & (b - p));
+  }else{
+    d = ((b ^ b) - (q & d)) | ((q + 98) * (q & a));
+  }
+  return a + b + c + d;
+}
+
+int func64(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 91;
+  d = 22;
+  d = ((q * c) - (c * 31)) | ((c - d) | (p & q));
+  c = ((p & a) * (q * d)) & ((p | c) ^ (b + b));
+  a = ((a - q) + (q & a)) | ((p * 59) + (a - d));
+  c = ((d + 35) & (p | p)) - ((q * 70) * (p * a));
+  if(b < b){
+    d = ((b - p) + (q * 28)) + ((b + b) & (b + q));
+  }else{
+    a = ((p * b) ^ (a + p)) ^ ((p + d) * (q | b));
+  }
+  c = ((q & b) * (q * c)) * ((b & p) - (p - 12));
+  for(i = 0; i < 27; i++){
+    c = ((q - 45) | (p + 86)) ^ ((a + q) * (c - q));
+  }
+  d = ((c + d) - (b | c)) & ((q * 76) ^ (b | 15));
+  a = ((d - p) - (d - d)) - ((c ^ b) | (c ^ 93));
+  if(d < b){
+    d = ((q + q) ^ (c * a)) | ((p ^ c) + (c | p));
+  }else{
+    a = ((c ^ 64) * (d * q)) + ((q - 79) | (d ^ d));
+  }
+  a = ((p + c) & (q & p)) - ((c + a) + (d ^ a));
+  d = ((q ^ 34) * (b ^ 35)) & ((d - 52) ^ (b + d));
+  c = ((q & p) - (b - q)) ^ ((q ^ a) ^ (q - c));
+  for(i = 0; i < 40; i++){
+    a = ((a + a) * (q + a)) - ((q * b) * (b | d));
+  }
+  if(a < 24){
+    d = ((b & d) - (c ^ 99)) ^ ((q & 13) & (d ^ b));
+  }else{
+    b = ((q ^ b) - (a | c)) | ((d * c) * (d * d));
+  }
+  c = ((p * a) | (b * d)) & ((b ^ q) ^ (a * p));
+  b = ((d & p) ^ (b - p)) * ((b + q) | (b ^ d));
+  d = ((b | c) - (a - 8)) & ((a - c) ^ (b | 60));
+  a = ((p + 17) & (a + 98)) | ((b - a) | (b * q));
+  if(d < 47){
+    d = ((q + q) - (p & b)) | ((b ^ c) & (q ^ c));
+  }else{
+    c = ((d & 88) ^ (c * 20)) ^ ((p + d) & (a | b));
+  }
+  for(i = 0; i < 28; i++){
+    c = ((q + 32) + (q + q)) - ((p ^ 48) + (b ^ d));
+  }
+  a = ((q - a) * (a * a)) + ((b & 55) + (c + b));
+  a = ((q - d) & (p & c)) - ((q ^ c) | (a | c));
+  a = ((d & 90) | (a | c)) & ((p | q) ^ (q & d));
+  if(d < p){
+    a = ((q ^ d) - (p | a)) + ((d + a) - (a & a));
+  }else{
+    d = ((b + p) | (b + d)) | ((c & a) + (c ^ p));
+  }
+  d = ((a & p) - (a & 42)) | ((d + d) + (b ^ d));
+  c = ((d + 55) * (p * 64)) - ((a | a) & (d + 73));
+  for(i = 0; i < 18; i++){
+    b = ((b | b) + (p & q)) + ((p | b) | (d ^ q));
+  }
+  d = ((q * a) - (p + c)) ^ ((d & a) + (q | c));
+  if(c < a){
+    a = ((b + 61) & (q - 81)) - ((c * d) * (c & p));
+  }else{
+    a = ((p + 47) + (c | a)) ^ ((q * 33) & (q | 49));
+  }
+  a = ((p + q) - (p & c)) & ((a * p) + (a + q));
+  c = ((q * c) ^ (p - c)) | ((p + 67) & (c - 65));
+  a = ((b & c) | (c + 35)) ^ ((b * 83) | (b * b));
+  b = ((d + 81) * (a | b)) & ((p & q) - (q & a));
+  if(c < 30){
+    d = ((b ^ q) + (q ^ 33)) | ((c | q) * (d ^ p));
+  }else{
+    b = ((c ^ 13) + (p + b)) * ((q * c) - (p | c));
+  }
+  d = ((p & 98) | (d - q)) + ((q & p) + (q * c));
+  b = ((b ^ a) | (q | 6)) | ((p + 73) & (q & p));
+  d = ((b ^ 95) + (p + q)) - ((b | 95) + (p + c));
+  b = ((c - b) | (c - a)) + ((b - b) * (b * b));
+  if(a < a){
+    a = ((b - q) + (d + 17)) + ((p - a) - (d * c));
+  }else{
+    d = ((q + b) + (b | 16)) & ((p & p) | (a | d));
+  }
+  return a + b + c + d;
+}
+
+int func65(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 70;
+  d = 58;
+  c = ((d & b) + (q ^ 41)) & ((c * 15) * (c + d));
+  a = ((p - 80) | (b - 41)) | ((q - 51) - (c | p));
+  d = ((p - p) ^ (d | c)) - ((c | 12) | (q | 63));
+  d = ((b - b) + (p + q)) & ((p | d) & (a * p));
+  if(d < 13){
+    c = ((b ^ q) & (q ^ 23)) + ((q * d) & (c ^ 32));
+  }else{
+    d = ((q ^ q) + (c & p)) | ((p - q) | (b | q));
+  }
+  a = ((q | c) ^ (b * d)) - ((p - q) * (c + d));
+  for(i = 0; i < 33; i++){
+    c = ((b + 77) | (b * q)) & ((q - c) + (a ^ 39));
+  }
+  c = ((p | 43) ^ (a + c)) + ((d - a) * (b & 5));
+  c = ((a + q) * (b ^ a)) + ((a - 91) ^ (p & p));
+  if(a < b){
+    b = ((p + c) | (c | p)) - ((d * d) + (c + 81));
+  }else{
+    c = ((d & 50) * (p + d)) ^ ((c & q) ^ (c | a));
+  }
+  c = ((d + b) * (p * c)) + ((q | 11) ^ (c | p));
+  b = ((q | b) ^ (b + p)) | ((d & q) | (q - c));
+  d = ((b ^ q) * (q ^ c)) ^ ((c ^ a) ^ (b & a));
+  for(i = 0; i < 25; i++){
+    a = ((b - q) ^ (c & b)) - ((c | c) * (a * q));
+  }
+  if(d < 17){
+    c = ((a ^ p) * (c + 55)) + ((c | q) | (q & b));
+  }else{
+    a = ((a ^ a) - (a ^ q)) + ((c + b) + (q & d));
+  }
+  a = ((p & 89) - (c - c)) ^ ((p & c) * (c & a));
+  b = ((q ^ b) | (b ^ d)) * ((p ^ q) ^ (q * d));
+  a = ((p - 17) ^ (b * b)) - ((c * q) * (q * d));
+  b = ((p & p) ^ (q + p)) + ((a | d) - (q | 89));
+  if(c < a){
+    a = ((b & b) + (q + 77)) + ((q + 56) & (p & q));
+  }else{
+    a = ((p & 92) + (b | a)) | ((b | 45) - (d ^ 38));
+  }
+  for(i = 0; i < 4; i++){
+    a = ((b + 10) * (d * p)) * ((q & 54) | (q | c));
+  }
+  c = ((a & d) + (d * b)) + ((a | p) & (c & p));
+  a = ((p - 23) ^ (b + b)) ^ ((a | 84) | (a + c));
+  a = ((p | b) * (a + c)) ^ ((c | p) * (q - b));
+  if(c < 43){
+    b = ((b * q) & (b | b)) + ((b + c) & (c - p));
+  }else{
+    d = ((q - 68) * (b * d)) + ((d & b) & (c * 28));
+  }
+  b = ((b ^ q) - (p ^ q)) - ((c | q) | (q & 11));
+  c = ((b * p) * (a * b)) ^ ((p - 58) + (q | 53));
+  for(i = 0; i < 44; i++){
+    a = ((a - q) ^ (d + d)) ^ ((q + a) | (d * q));
+  }
+  a = ((b ^ p) ^ (c | q)) | ((b - b) - (q | 52));
+  if(b < c){
+    a = ((p + q) * (b * 13)) & ((b | 87) + (c ^ b));
+  }else{
+    d = ((q | p) - (b ^ 98)) | ((b | a) * (d | 71));
+  }
+  a = ((p | q) * (q * a)) ^ ((b - 22) ^ (q * b));
+  a = ((a - c) * (c + b)) - ((c ^ q) * (a * q));
+  b = ((p + a) + (p + 52)) & ((b & 75) * (a ^ a));
+  d = ((d + c) ^ (q ^ c)) ^ ((q - p) - (q - b));
+  if(c < p){
+    d = ((p ^ p) + (q - a)) + ((a * p) ^ (a ^ a));
+  }else{
+    a = ((a * p) + (c - p)) | ((a | 16) * (a + d));
+  }
+  b = ((b | b) ^ (a ^ p)) & ((c * a) ^ (p * a));
+  b = ((q | 5) - (b + a)) * ((d & p) ^ (p * p));
+  a = ((d + a) ^ (b + c)) & ((a - 42) + (p * 35));
+  c = ((p + c) - (a | b)) - ((c & c) & (d * c));
+  if(d < d){
+    c = ((q + c) + (d * c)) ^ ((q * 48) ^ (a ^ a));
+  }else{
+    a = ((b - c) & (c * c)) - ((q & c) ^ (d & a));
+  }
+  return a + b + c + d;
+}
+
+int func66(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 53;
+  d = 46;
+  d = ((a + 36) + (q * a)) - ((a | a) - (b & 69));
+  a = ((b + 1) ^ (c | a)) & ((q | a) & (a ^ b));
+  a = ((b | 57) ^ (a ^ q)) + ((p & 23) & (b + a));
+  d = ((c + 97) & (q ^ 88)) - ((q - d) ^ (q | b));
+  if(a < q){
+    c = ((q ^ q) ^ (a - b)) | ((p ^ q) * (d * c));
+  }else{
+    b = ((p + 43) + (d & 67)) - ((d | 84) * (b | a));
+  }
+  b = ((a - q) - (p ^ 96)) + ((p ^ q) + (a - a));
+  for(i = 0; i < 30; i++){
+    d = ((p | c) - (d + d)) ^ ((q & d) - (d - b));
+  }
+  b = ((d - a) | (p & q)) & ((b & 45) + (d | q));
+  c = ((p & q) - (q - p)) ^ ((c * c) & (b | c));
+  if(d < d){
+    d = ((d - q) | (b ^ p)) ^ ((b & c) ^ (b | q));
+  }else{
+    d = ((q * d) + (b & p)) * ((b ^ p) - (d | c));
+  }
+  a = ((d | d) + (a & d)) | ((q * 31) | (a | p));
+  a = ((d * d) * (b + b)) & ((p * b) + (b - c));
+  d = ((b - a) - (d | q)) ^ ((c - 49) - (q & b));
+  for(i = 0; i < 38; i++){
+    c = ((q ^ b) | (b | c)) * ((p - d) + (c + d));
+  }
+  if(c < p){
+    b = ((q & a) ^ (q & q)) * ((a - b) * (c ^ b));
+  }else{
+    a = ((c ^ a) & (c - c)) * ((p & c) - (c * a));
+  }
+  b = ((p & d) | (a - 84)) | ((a ^ b) * (a & a));
+  c = ((b - 36) - (c ^ a)) ^ ((q + c) & (d + b));
+  c = ((a ^ c) - (b * a)) * ((d | 48) & (b - a));
+  a = ((b + d) & (c ^ 11)) + ((c & q) & (q * p));
+  if(a < p){
+    c = ((c + 73) & (a ^ b)) - ((q & 83) & (a & p));
+  }else{
+    a = ((b - c) - (a - a)) ^ ((q - c) | (b * 26));
+  }
+  for(i = 0; i < 30; i++){
+    d = ((c & q) & (b + q)) & ((p - 62) | (p | a));
+  }
+  d = ((d ^ 22) ^ (d & 86)) | ((p * 30) * (a | p));
+  d = ((p & b) - (c & 11)) & ((b * 17) ^ (d + 71));
+  c = ((b - c) * (q | 70)) * ((c - c) + (p * 25));
+  if(d < b){
+    c = ((q ^ 20) ^ (q - d)) & ((b | 84) ^ (d + d));
+  }else{
+    b = ((b * c) + (b + p)) & ((c | d) | (a + 27));
+  }
+  c = ((p ^ 30) ^ (p * c)) * ((a | c) & (c | c));
+  a = ((a | a) | (q | a)) * ((q - 20) - (a & b));
+  for(i = 0; i < 32; i++){
+    b = ((d ^ b) * (d & d)) + ((b - c) | (c & c));
+  }
+  b = ((b ^ p) ^ (b + 66)) | ((q & p) ^ (a ^ p));
+  if(c < a){
+    a = ((p + 61) & (d + 82)) * ((d | 5) + (c & 60));
+  }else{
+    d = ((p * c) ^ (a - b)) * ((a | p) + (d + d));
+  }
+  b = ((b * c) | (a * a)) * ((q + 26) & (a | 70));
+  c = ((b | d) & (d * q)) - ((p - a) | (q + a));
+  d = ((p | b) ^ (q + 23)) - ((b | p) - (d | d));
+  c = ((p - d) & (a - q)) | ((q | d) ^ (b ^ 33));
+  if(d < q){
+    d = ((c - q) & (d + 11)) ^ ((q * c) & (b - b));
+  }else{
+    a = ((d | c) + (a & c)) & ((p & 32) & (d * q));
+  }
+  a = ((q + p) + (d + q)) * ((p ^ p) | (a | p));
+  b = ((a & d) * (c + d)) + ((d & b) - (q + 98));
+  c = ((p + p) & (p + q)) - ((b ^ 25) | (a * a));
+  b = ((p - d) + (d - p)) + ((q * c) ^ (c - 96));
+  if(d < q){
+    b = ((d ^ a) | (b * q)) ^ ((c + 11) ^ (c & a));
+  }else{
+    c = ((a - a) | (d ^ 77)) * ((b | 3) ^ (p ^ a));
+  }
+  return a + b + c + d;
+}
+
+int func67(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 57;
+  d = 68;
+  b = ((q ^ c) + (b * c)) ^ ((p - c) & (q & b));
+  c = ((b + 24) ^ (p ^ 1)) & ((a | c) * (b | p));
+  d = ((q - a) - (a & p)) + ((q - p) ^ (a & 78));
+  d = ((q - c) | (p | b)) ^ ((q + 65) + (b - b));
+  if(d < q){
+    a = ((d * 30) + (q + c)) + ((c + b) ^ (b - d));
+  }else{
+    a = ((d ^ p) ^ (c + 16)) & ((a & p) | (b * d));
+  }
+  b = ((q * p) & (a + b)) * ((b * c) - (c * b));
+  for(i = 0; i < 47; i++){
+    b = ((a & a) ^ (p * 16)) & ((b & q) ^ (p & c));
+  }
+  d = ((p * c) * (a - 16)) ^ ((c | d) - (c & b));
+  d = ((a ^ 15) & (p | c)) ^ ((d + c) & (b - 6));
+  if(c < b){
+    b = ((c * 10) - (d - c)) | ((a + p) ^ (c | b));
+  }else{
+    c = ((b & c) - (a * q)) + ((d * 41) & (p ^ d));
+  }
+  c = ((b & c) & (b & d)) - ((b + 81) & (c * 67));
+  b = ((q * b) | (b - a)) | ((q ^ b) - (p + q));
+  c = ((c | d) * (p & d)) - ((d * b) ^ (d * 10));
+  for(i = 0; i < 12; i++){
+    b = ((a | 38) | (c - 56)) * ((a * a) * (a + 83));
+  }
+  if(d < a){
+    a = ((b & 40) + (d * b)) + ((p & p) - (c | d));
+  }else{
+    b = ((q & 32) ^ (p - d)) - ((q - 21) | (a - 69));
+  }
+  c = ((q | q) - (b & a)) * ((b & d) - (a & b));
+  b = ((c & 78) + (p ^ d)) + ((p - b) | (b + q));
+  d = ((p & d) + (a * c)) + ((a - 58) - (c | a));
+  d = ((b + 18) + (d + b)) ^ ((q ^ b) * (d - c));
+  if(a < d){
+    b = ((c ^ q) | (c | 31)) | ((q | b) | (d + b));
+  }else{
+    d = ((c * 99) * (c & p)) ^ ((d * p) & (q * q));
+  }
+  for(i = 0; i < 18; i++){
+    b = ((d & q) ^ (b + 25)) * ((q | 13) + (p & a));
+  }
+  c = ((d - b) + (b ^ q)) * ((q - b) ^ (a & 63));
+  c = ((q & p) * (d & d)) ^ ((q + a) & (a | p));
+  b = ((c + a) + (d + d)) * ((c + a) & (b - p));
+  if(b < c){
+    a = ((c * d) + (a ^ p)) * ((b ^ p) - (b - a));
+  }else{
+    d = ((p ^ c) ^ (d - a)) + ((b & a) - (d | 51));
+  }
+  a = ((p - q) | (d & q)) ^ ((d | c) * (p | c));
+  a = ((b | p) | (p - b)) + ((c & 79) * (b ^ a));
+  for(i = 0; i < 7; i++){
+    d = ((c * d) - (c & q)) & ((c | c) * (b - c));
+  }
+  c = ((a ^ p) + (b | b)) | ((a + 96) - (p & d));
+  if(b < a){
+    c = ((q - 53) | (d & b)) ^ ((d ^ p) + (p ^ c));
+  }else{
+    a = ((b + q) | (p * p)) * ((p | 18) ^ (p ^ b));
+  }
+  b = ((p * p) ^ (a | d)) + ((b | q) - (d * q));
+  a = ((a | d) * (q | p)) ^ ((d & 21) ^ (p ^ 73));
+  a = ((p ^ 58) | (c & 73)) * ((c * 17) | (q + b));
+  b = ((p - a) | (q ^ 82)) * ((c ^ p) + (q ^ 78));
+  if(d < d){
+    d = ((p & b) - (d - b)) - ((d - a) - (p * c));
+  }else{
+    a = ((b | d) | (b | c)) & ((c ^ c) * (p - d));
+  }
+  a = ((b * d) | (q * c)) ^ ((p * b) * (q + p));
+  a = ((p | 83) - (a & d)) & ((b ^ 31) ^ (q ^ c));
+  a = ((b * b) & (b ^ p)) & ((p - 78) ^ (c & q));
+  b = ((c + 42) ^ (b ^ c)) & ((c ^ 61) + (c | q));
+  if(c < a){
+    b = ((c | 95) | (c | a)) | ((q - d) + (c * b));
+  }else{
+    c = ((c | q) ^ (q + d)) * ((a - c) | (b - q));
+  }
+  return a + b + c + d;
+}
+
+int func68(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 93;
+  d = 72;
+  c = ((a + a) + (q - 37)) * ((d * q) ^ (a & d));
+  b = ((b & 13) ^ (d - c)) | ((d ^ 66) ^ (a * a));
+  c = ((p - 98) + (c ^ b)) ^ ((q & d) - (q + d));
+  a = ((d - 3) - (b & p)) - ((b + 75) * (p - c));
+  if(a < 52){
+    d = ((q & 55) ^ (a & b)) ^ ((q & a) - (a - b));
+  }else{
+    a = ((q + b) | (q & 76)) - ((q & b) - (c + a));
+  }
+  b = ((d - 70) ^ (p | 61)) | ((p + c) ^ (a - a));
+  for(i = 0; i < 43; i++){
+    c = ((c - d) ^ (a + q)) ^ ((b + b) & (c ^ 90));
+  }
+  d = ((d + q) * (b | a)) - ((c * b) - (q ^ 44));
+  b = ((c & d) | (d + p)) - ((b ^ p) + (a & 44));
+  if(b < p){
+    b = ((d - 92) * (b & 47)) - ((d * b) & (p + d));
+  }else{
+    b = ((q & 24) + (a + p)) | ((c * 37) + (p * a));
+  }
+  d = ((q ^ p) ^ (q * 24)) * ((c * c) + (a + 51));
+  b = ((b & p) - (c * c)) + ((a | a) - (b * p));
+  d = ((b * b) | (a | c)) ^ ((b ^ 95) | (a ^ d));
+  for(i = 0; i < 29; i++){
+    c = ((q | d) * (q - d)) + ((q - b) | (c - 85));
+  }
+  if(d < a){
+    a = ((q & c) | (b | a)) - ((d * 42) + (b & b));
+  }else{
+    b = ((d * 59) + (d ^ d)) ^ ((a + b) | (d + p));
+  }
+  b = ((c + p) + (d + 14)) * ((q & d) & (d * d));
+  c = ((d & 81) & (c | 8)) | ((b | q) & (d | 84));
+  a = ((p * b) - (c & a)) + ((p & q) - (d + q));
+  b = ((a - b) * (b | q)) & ((c | c) + (d * 43));
+  if(b < 19){
+    c = ((q | d) - (c - d)) * ((p + 10) | (p | b));
+  }else{
+    d = ((b - q) - (c + a)) - ((d - 15) - (a | d));
+  }
+  for(i = 0; i < 17; i++){
+    b = ((c - c) - (q - p)) + ((b & a) - (q - p));
+  }
+  a = ((d ^ 58) & (a | 90)) ^ ((a + 73) + (d & 4));
+  b = ((p * d) ^ (a * 3)) * ((q * q) + (b + a));
+  d = ((d + c) * (b * b)) ^ ((d ^ b) * (a & 82));
+  if(b < p){
+    c = ((a | q) - (d ^ p)) + ((b + a) * (d * q));
+  }else{
+    c = ((d ^ b) & (q * p)) * ((b - d) ^ (a & b));
+  }
+  d = ((q + p) | (d | c)) & ((a + p) - (q ^ b));
+  a = ((p & p) * (b ^ p)) | ((q | q) - (q ^ 27));
+  for(i = 0; i < 33; i++){
+    d = ((q & d) | (b & c)) ^ ((a - q) ^ (c & q));
+  }
+  d = ((c * b) * (p * b)) - ((q | b) ^ (c - 23));
+  if(d < p){
+    a = ((c - a) - (d ^ 54)) * ((b ^ q) | (a - d));
+  }else{
+    a = ((p & b) ^ (d ^ d)) - ((c - 91) + (q ^ c));
+  }
+  a = ((b | p) & (a * p)) - ((b & b) | (p & b));
+  c = ((b - 20) & (d + 39)) & ((p ^ 4) - (q & d));
+  c = ((c & q) | (p & 33)) ^ ((d | q) & (c | c));
+  a = ((d - b) | (c - p)) & ((a + b) ^ (q + 89));
+  if(c < 20){
+    a = ((b ^ a) ^ (q + 37)) & ((c + c) & (d + b));
+  }else{
+    d = ((c & 99) + (p * c)) - ((b ^ q) ^ (a * b));
+  }
+  d = ((q * 79) * (a - b)) - ((a + c) * (p & p));
+  c = ((d + p) - (b & d)) ^ ((p | a) + (q ^ 59));
+  b = ((a - b) & (c - c)) ^ ((d - c) & (q - c));
+  a = ((q - 44) ^ (d | q)) & ((d + 73) | (d * 29));
+  if(d < p){
+    c = ((b * p) + (c + q)) & ((b * c) | (a - 35));
+  }else{
+    d = ((c - q) + (q ^ 31)) + ((d & a) + (p - 60));
+  }
+  return a + b + c + d;
+}
+
+int func69(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 68;
+  d = 95;
+  b = ((p + p) ^ (b & q)) | ((d | d) ^ (d - b));
+  c = ((c * 15) - (c - b)) + ((a ^ c) * (c + q));
+  b = ((p | b) - (q + b)) ^ ((d | d) - (c - a));
+  a = ((a + a) & (c + q)) - ((q ^ b) & (d ^ b));
+  if(c < 27){
+    a = ((b * 99) * (p * d)) + ((b ^ q) & (d + c));
+  }else{
+    a = ((c & 53) | (b - 99)) ^ ((b - 94) ^ (d | d));
+  }
+  a = ((q & q) ^ (p - p)) - ((q * d) | (d - 92));
+  for(i = 0; i < 46; i++){
+    a = ((d - d) ^ (a | q)) & ((d - 84) - (q - p));
+  }
+  c = ((d ^ a) & (q & b)) + ((b | p) & (q | b));
+  c = ((a ^ p) + (c & c)) + ((d & d) ^ (q ^ q));
+  if(c < d){
+    b = ((b ^ 80) ^ (q ^ b)) * ((p * 14) + (b + d));
+  }else{
+    b = ((q - 26) | (c & q)) | ((c - 25) * (p ^ b));
+  }
+  b = ((a & c) | (c * 51)) & ((d & a) + (a * a));
+  c = ((b - 44) | (c & q)) + ((b & p) - (q ^ 45));
+  d = ((p ^ d) | (c + 32)) - ((c - b) * (b | q));
+  for(i = 0; i < 8; i++){
+    d = ((a - 79) * (d * d)) - ((d + p) ^ (a - 85));
+  }
+  if(d < d){
+    c = ((d & a) & (d ^ d)) ^ ((a ^ 95) * (c * 37));
+  }else{
+    d = ((c | c) - (q & a)) & ((p - c) | (b * p));
+  }
+  d = ((q * p) | (d | p)) + ((c - q) | (b - d));
+  d = ((c & a) ^ (d ^ q)) + ((p - q) - (c ^ 89));
+  d = ((q + 81) - (c + c)) ^ ((q & q) + (p - c));
+  d = ((c * q) + (p ^ d)) ^ ((b * b) | (q * 24));
+  if(b < a){
+    d = ((d * c) | (q | c)) + ((p + a) + (p * p));
+  }else{
+    d = ((p + a) ^ (p * q)) * ((a - b) & (d * c));
+  }
+  for(i = 0; i < 19; i++){
+    c = ((p - b) + (a + c)) & ((p | p) - (b - 84));
+  }
+  c = ((p ^ d) + (q * p)) + ((p & d) ^ (q & a));
+  c = ((d + a) + (c & 19)) * ((p & 48) | (d | q));
+  a = ((c - c) + (c * p)) & ((q * 93) - (b & 54));
+  if(d < 41){
+    d = ((c + q) + (c & b)) - ((p - c) & (a - a));
+  }else{
+    d = ((q ^ b) + (b + a)) * ((d - q) - (d + b));
+  }
+  b = ((q + b) ^ (b + b)) - ((c ^ a) + (c | d));
+  d = ((d | 77) | (p | 34)) - ((b | p) - (a ^ p));
+  for(i = 0; i < 30; i++){
+    d = ((c | a) & (b & c)) | ((b * d) & (q - b));
+  }
+  b = ((q * c) | (p | q)) ^ ((p | 26) - (a + a));
+  if(a < a){
+    c = ((p & a) * (b + a)) & ((a - p) + (a | d));
+  }else{
+    a = ((q - 25) + (q + b)) & ((c + b) & (a + a));
+  }
+  d = ((p * c) - (q & b)) & ((b ^ q) * (q + q));
+  d = ((d & c) ^ (a | d)) * ((b & p) | (p * c));
+  a = ((b - b) + (q - q)) ^ ((d * d) & (b ^ d));
+  c = ((a - a) + (p & a)) - ((a + d) - (c * 98));
+  if(a < c){
+    d = ((d ^ p) ^ (d + b)) + ((c - a) | (a - a));
+  }else{
+    c = ((d - 2) + (a ^ b)) | ((c * d) - (q ^ p));
+  }
+  a = ((a | 83) | (b & 16)) - ((p * d) + (b | b));
+  d = ((b ^ 98) * (a | b)) ^ ((b | c) * (a & c));
+  a = ((q ^ q) & (d & a)) + ((d + 59) ^ (b ^ q));
+  d = ((c ^ p) + (p * q)) | ((q | d) ^ (a + 60));
+  if(b < a){
+    d = ((q & 63) - (a ^ q)) - ((q | a) - (a * a));
+  }else{
+    b = ((d * 38) & (a | b)) ^ ((q | a) * (q + d));
+  }
+  return a + b + c + d;
+}
+
+int func70(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 1;
+  d = 94;
+  d = ((a + a) | (c + c)) * ((a & c) & (a + c));
+  a = ((c * a) ^ (p | c)) - ((p | p) ^ (q + d));
+  a = ((d | d) * (p + d)) - ((p ^ 29) - (c | 68));
+  b = ((q + b) + (a & 64)) + ((d + b) * (c + 36));
+  if(b < 46){
+    d = ((d * 44) ^ (b ^ q)) * ((b + 33) - (c - d));
+  }else{
+    c = ((d * a) + (a - p)) ^ ((p + b) + (p & 8));
+  }
+  a = ((b * q) - (b & a)) - ((c | 60) + (c - q));
+  for(i = 0; i < 7; i++){
+    d = ((c - q) + (c + 23)) + ((q & d) ^ (p ^ q));
+  }
+  a = ((b & d) ^ (q & p)) & ((q * d) * (c & 84));
+  a = ((p | c) ^ (p & b)) & ((a - a) - (d | c));
+  if(d < 43){
+    a = ((q | a) & (b ^ a)) + ((q - c) ^ (b | 45));
+  }else{
+    d = ((b | c) * (d ^ a)) | ((a ^ d) ^ (a ^ b));
+  }
+  b = ((c - a) | (p ^ d)) | ((q ^ 62) - (a ^ p));
+  a = ((b | q) + (a + d)) * ((a ^ 44) - (b + c));
+  d = ((p & 10) & (c - a)) | ((b ^ 24) + (c ^ p));
+  for(i = 0; i < 32; i++){
+    b = ((a * c) + (p - b)) + ((p | b) ^ (b ^ 79));
+  }
+  if(a < d){
+    d = ((p | p) + (b + q)) ^ ((d + p) ^ (d * c));
+  }else{
+    c = ((a ^ b) + (d + a)) & ((a & d) & (p ^ p));
+  }
+  b = ((q - 75) - (a - q)) + ((q ^ p) & (d + q));
+  a = ((c & p) | (a * 2)) - ((c ^ 20) & (p | a));
+  a = ((b + p) * (c + p)) ^ ((q & a) | (c + p));
+  b = ((d - p) + (a * d)) & ((c | 37) & (p + 81));
+  if(c < a){
+    d = ((b + d) ^ (a ^ a)) & ((c + c) | (a ^ c));
+  }else{
+    b = ((b & c) & (b + a)) - ((a + 96) - (q - 54));
+  }
+  for(i = 0; i < 18; i++){
+    b = ((b ^ 91) & (b & c)) ^ ((q & 34) * (q ^ d));
+  }
+  d = ((a & q) & (p | 82)) ^ ((b + q) - (d & 32));
+  d = ((c + d) | (q - c)) * ((d + 16) + (d - 46));
+  a = ((q - b) | (b ^ c)) * ((b & c) & (a | d));
+  if(b < a){
+    d = ((q & 45) ^ (q & b)) ^ ((b ^ a) | (c * p));
+  }else{
+    c = ((q | 1) - (a * p)) + ((b & p) & (q + 76));
+  }
+  c = ((q * a) * (d * d)) + ((c * a) * (a - c));
+  b = ((p - q) | (p * d)) | ((p ^ p) + (q - 76));
+  for(i = 0; i < 26; i++){
+    c = ((q | b) + (d - 66)) - ((b ^ c) - (q | q));
+  }
+  a = ((c + p) & (b * 24)) * ((b + p) | (p * c));
+  if(a < d){
+    b = ((d & a) * (c ^ d)) ^ ((d - c) - (d & c));
+  }else{
+    b = ((c + 56) - (b & q)) & ((d - 66) | (p + q));
+  }
+  c = ((c ^ c) | (q * c)) + ((d * 95) - (a | q));
+  d = ((p & d) + (p | 46)) - ((b ^ c) + (a & c));
+  a = ((d * d) | (b * a)) + ((q * q) - (p & p));
+  a = ((a ^ b) * (d - d)) ^ ((q & 65) | (b | 40));
+  if(d < d){
+    c = ((c ^ p) - (q * 19)) * ((q ^ a) ^ (d ^ 87));
+  }else{
+    d = ((b | d) * (p ^ d)) + ((c - 68) & (d - a));
+  }
+  c = ((d - 47) | (d | q)) & ((q - p) | (p + 7));
+  d = ((b | a) * (a & q)) & ((d ^ c) ^ (c & c));
+  d = ((p + a) + (q & 19)) * ((q | q) - (c | a));
+  d = ((c & 15) + (d & 69)) & ((a * p) - (c ^ b));
+  if(d < b){
+    b = ((a ^ d) + (q - 96)) - ((d - a) & (q + 87));
+  }else{
+    b = ((b + 31) * (b ^ q)) - ((q - d) ^ (b * a));
+  }
+  return a + b + c + d;
+}
+
+int func71(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 41;
+  d = 60;
+  b = ((d & q) * (c | c)) - ((b ^ b) - (c & p));
+  c = ((q * c) - (c ^ 54)) - ((b + 9) - (q - d));
+  c = ((b - p) - (c - p)) + ((c - d) * (d ^ p));
+  c = ((d | 63) | (c * d)) - ((p * p) - (a - a));
+  if(b < b){
+    b = ((c * c) + (p ^ c)) - ((d - q) + (p | d));
+  }else{
+    d = ((d | c) & (c | b)) & ((c ^ p) | (p ^ 73));
+  }
+  c = ((b ^ a) + (c - a)) ^ ((c * 71) - (d - c));
+  for(i = 0; i < 29; i++){
+    c = ((c & 65) | (q ^ 11)) - ((d + c) + (b & 15));
+  }
+  d = ((p - q) | (p + c)) * ((d - p) ^ (c ^ b));
+  d = ((c | c) - (a | p)) | ((d + b) ^ (p & c));
+  if(d < q){
+    c = ((a + d) - (p + p)) ^ ((c | q) * (c - q));
+  }else{
+    d = ((c + b) - (c | c)) - ((d & 86) & (d * d));
+  }
+  b = ((p ^ a) + (a ^ a)) + ((p * a) & (p | c));
+  c = ((q - a) * (a | b)) - ((c * a) ^ (p * p));
+  b = ((p - a) * (q ^ c)) ^ ((q + p) + (c | a));
+  for(i = 0; i < 24; i++){
+    b = ((c | p) * (c ^ 82)) + ((d - a) - (a * q));
+  }
+  if(c < 58){
+    a = ((q & p) ^ (c + d)) - ((q ^ p) ^ (b ^ b));
+  }else{
+    a = ((c * p) - (b + a)) ^ ((a | b) + (c & 79));
+  }
+  d = ((q * b) ^ (a - a)) - ((q ^ c) - (a + c));
+  d = ((p ^ 33) ^ (d + p)) & ((b - c) - (p * q));
+  d = ((q - c) + (c | a)) ^ ((d ^ c) ^ (c | p));
+  c = ((d * c) * (a - d)) & ((b | b) - (q ^ d));
+  if(a < b){
+    b = ((q + a) - (d | 81)) * ((a & q) ^ (d | 12));
+  }else{
+    c = ((b | c) & (p * 27)) ^ ((q & 14) | (a | c));
+  }
+  for(i = 0; i < 45; i++){
+    c = ((b ^ b) - (c | d)) & ((d - b) + (b - a));
+  }
+  c = ((a + b) + (p ^ 2)) & ((c - q) & (b ^ p));
+  b = ((c * p) | (d & a)) + ((p + 82) * (p & p));
+  a = ((b - 64) & (q + 79)) & ((p ^ 15) - (c ^ 89));
+  if(a < 44){
+    b = ((q - c) & (b & b)) - ((c - b) * (q - p));
+  }else{
+    d = ((b * c) + (a ^ 99)) ^ ((c + 5) + (p + 74));
+  }
+  b = ((b ^ b) + (a & a)) | ((c - d) + (d + 26));
+  b = ((a & 71) ^ (b ^ b)) + ((a - 56) & (p | d));
+  for(i = 0; i < 23; i++){
+    d = ((b ^ p) | (q - a)) + ((c - b) + (a - q));
+  }
+  c = ((q ^ q) & (c - a)) | ((d | q) - (d - a));
+  if(d < a){
+    b = ((b * d) | (d + 70)) | ((q ^ b) * (b ^ d));
+  }else{
+    b = ((c * q) ^ (c ^ b)) - ((q & c) + (p | q));
+  }
+  d = ((p * q) | (a & q)) & ((b | p) ^ (d ^ a));
+  d = ((b ^ c) * (q & c)) * ((q - d) * (p - b));
+  a = ((q - p) - (p & a)) | ((q * a) | (d + 74));
+  c = ((d - p) - (b - c)) | ((d - b) + (d * q));
+  if(c < q){
+    b = ((b | p) + (c & 35)) + ((a & p) & (b ^ a));
+  }else{
+    d = ((d + 32) - (d * b)) | ((p * p) & (p * q));
+  }
+  d = ((a * q) & (p & c)) - ((a + p) - (p + p));
+  c = ((d ^ b) & (a + q)) & ((p * a) + (p & p));
+  c = ((d - q) | (d ^ 11)) ^ ((d * 38) | (c | d));
+  b = ((b * 60) - (c * q)) ^ ((p + d) | (d & 26));
+  if(c < q){
+    b = ((q ^ 56) + (a | b)) - ((c | b) ^ (p | 85));
+  }else{
+    a = ((p & b) * (d + c)) | ((c - d) | (p - 70));
+  }
+  return a + b + c + d;
+}
+
+int func72(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 46;
+  d = 25;
+  d = ((c + d) & (p - q)) * ((q | d) + (p - a));
+  b = ((d & c) * (b ^ q)) & ((d & d) * (b * 79));
+  b = ((q * a) - (p - p)) * ((a | 98) + (p ^ a));
+  d = ((b - 13) ^ (p ^ p)) + ((q ^ 62) & (b | 52));
+  if(c < q){
+    c = ((a & q) ^ (c & a)) ^ ((q - a) + (b * d));
+  }else{
+    c = ((c - a) + (b | 6)) * ((b & p) + (d + a));
+  }
+  a = ((b + c) ^ (a | p)) - ((a ^ p) ^ (q * q));
+  for(i = 0; i < 23; i++){
+    d = ((b - a) ^ (p ^ q)) & ((b * d) ^ (c + c));
+  }
+  d = ((b * p) ^ (c + 65)) - ((d ^ p) | (c + d));
+  d = ((a * a) & (d * d)) | ((a | 87) ^ (q + a));
+  if(a < b){
+    b = ((c - a) & (p & b)) & ((p - a) + (p + a));
+  }else{
+    c = ((b + a) ^ (a & b)) | ((q * d) & (b - p));
+  }
+  d = ((a - 1) ^ (p + 38)) * ((p & b) ^ (p - q));
+  d = ((d & 79) & (d - 28)) + ((q & 54) | (d | 27));
+  d = ((c & p) + (b * c)) + ((p * 70) ^ (c * a));
+  for(i = 0; i < 31; i++){
+    a = ((b | a) & (b | c)) * ((p * p) | (b + q));
+  }
+  if(a < q){
+    d = ((d + p) + (b | c)) | ((a & a) & (d + a));
+  }else{
+    c = ((d & 32) & (c & 29)) & ((q & 71) + (p & b));
+  }
+  c = ((c * 48) ^ (p - p)) * ((b ^ p) + (d - p));
+  c = ((c - 86) | (c * 72)) ^ ((q * q) - (b * 42));
+  d = ((a & 21) ^ (q - 4)) - ((a - a) | (q * d));
+  c = ((a * d) ^ (d * d)) * ((a ^ a) + (b & d));
+  if(d < q){
+    a = ((q ^ b) | (p ^ c)) - ((d & 14) * (p * q));
+  }else{
+    a = ((p & b) | (c * b)) - ((p * q) + (d - 32));
+  }
+  for(i = 0; i < 18; i++){
+    d = ((p | c) ^ (a * 54)) * ((c ^ 58) - (c | p));
+  }
+  c = ((c ^ q) + (b + d)) | ((d + p) - (d ^ p));
+  d = ((b + b) - (q * d)) | ((d - 77) - (q & q));
+  d = ((b | a) & (p - 24)) - ((c * c) + (p & p));
+  if(b < d){
+    a = ((a & a) * (q * 85)) + ((b * 84) + (p | c));
+  }else{
+    a = ((c * c) ^ (q - c)) ^ ((b | b) & (p & 73));
+  }
+  c = ((c + q) | (q * p)) + ((b + 60) - (p | d));
+  b = ((q + d) * (c - d)) | ((q & 32) | (c | a));
+  for(i = 0; i < 27; i++){
+    c = ((d * b) ^ (c & c)) ^ ((d - c) - (p & p));
+  }
+  c = ((q ^ c) + (a & p)) - ((b & d) | (b ^ 2));
+  if(d < c){
+    a = ((q * p) - (d ^ c)) & ((p * d) & (a - c));
+  }else{
+    c = ((q & d) - (b + c)) | ((q * 39) & (b ^ a));
+  }
+  b = ((d + a) | (d & q)) + ((d * c) + (d + q));
+  b = ((c - b) - (a & c)) ^ ((q | d) | (q * d));
+  b = ((q - q) + (p + d)) | ((b + c) - (q | a));
+  c = ((a - p) + (q * 51)) - ((b * a) - (b & p));
+  if(d < a){
+    d = ((b | q) ^ (b | b)) + ((a | d) ^ (c | c));
+  }else{
+    c = ((a ^ 26) ^ (q * a)) & ((q & c) | (b * p));
+  }
+  a = ((d & a) ^ (q * q)) ^ ((c - c) + (a & a));
+  d = ((b & 95) ^ (d | c)) & ((q + q) * (c & 10));
+  d = ((d - d) * (b & 11)) ^ ((p | q) & (a ^ q));
+  d = ((c * c) & (c - q)) - ((q | q) & (p | c));
+  if(b < q){
+    d = ((b & a) & (q ^ 88)) + ((c | q) * (p + q));
+  }else{
+    c = ((a & p) ^ (c & c)) | ((p ^ 45) - (p | a));
+  }
+  return a + b + c + d;
+}
+
+int func73(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 25;
+  d = 14;
+  b = ((d - 91) ^ (c * d)) ^ ((d & p) + (q | d));
+  d = ((d + 43) * (p ^ p)) - ((p * c) | (a - q));
+  d = ((c - 72) * (q + b)) * ((p | d) & (a | 97));
+  b = ((b - 49) + (a * 90)) + ((q - 63) * (a - b));
+  if(c < 24){
+    b = ((a * a) * (d ^ 38)) - ((c * 30) - (q - p));
+  }else{
+    c = ((d | q) ^ (p ^ 71)) ^ ((b * b) * (d | p));
+  }
+  a = ((b ^ 39) - (q - b)) ^ ((p | 41) & (b ^ a));
+  for(i = 0; i < 29; i++){
+    d = ((d + q) + (q + d)) | ((a * c) * (b | d));
+  }
+  a = ((c + p) & (d | 19)) & ((c | a) - (a ^ c));
+  c = ((b | d) + (d * 29)) + ((q & a) + (a + a));
+  if(d < q){
+    d = ((a + d) & (p | c)) ^ ((q - 28) & (c - a));
+  }else{
+    b = ((a ^ d) & (d - c)) + ((b & d) * (p & 54));
+  }
+  d = ((d & d) - (q & c)) | ((q | 89) ^ (b ^ d));
+  d = ((b & c) | (c ^ q)) ^ ((a * 34) - (d * 73));
+  d = ((c & q) + (p ^ d)) * ((a - d) * (d + q));
+  for(i = 0; i < 4; i++){
+    a = ((p ^ c) & (d & 39)) & ((p - d) + (q ^ a));
+  }
+  if(a < d){
+    c = ((a ^ q) | (b & 56)) * ((a - 27) ^ (a - c));
+  }else{
+    c = ((d | c) - (q ^ c)) * ((d + p) + (d * c));
+  }
+  c = ((b + d) & (c - q)) | ((d + c) * (q + b));
+  d = ((c ^ d) + (q * c)) & ((d * q) | (b & a));
+  c = ((b | a) ^ (a ^ d)) - ((q + 63) - (b ^ a));
+  b = ((d ^ 62) * (p + 3)) + ((c ^ b) - (a * b));
+  if(d < 45){
+    d = ((c + c) - (a | b)) - ((b ^ d) | (d - 95));
+  }else{
+    b = ((c ^ a) * (d & b)) * ((p + p) * (p & d));
+  }
+  for(i = 0; i < 16; i++){
+    d = ((q * b) | (p - 97)) - ((q ^ p) ^ (d ^ b));
+  }
+  d = ((b + q) + (d | c)) | ((c | q) ^ (b | 83));
+  a = ((c & 5) | (c + p)) * ((p & c) & (d * d));
+  c = ((b + p) & (c | c)) - ((q + 86) - (c ^ q));
+  if(b < a){
+    d = ((b + q) + (p * 81)) & ((b - q) * (d * a));
+  }else{
+    d = ((a - b) & (d - c)) - ((p + 84) - (q * 42));
+  }
+  c = ((p * a) ^ (b + c)) + ((a ^ 31) * (q + d));
+  a = ((a + q) * (d * 70)) + ((p + b) - (p + b));
+  for(i = 0; i < 44; i++){
+    a = ((d - 75) * (q & 52)) - ((a | p) + (d - p));
+  }
+  a = ((c * 33) & (b * 20)) | ((d * 77) + (b ^ a));
+  if(d < 36){
+    b = ((b ^ a) & (p - a)) ^ ((p & b) * (b - d));
+  }else{
+    a = ((c ^ b) * (q | p)) + ((q + 16) ^ (a * q));
+  }
+  d = ((q - b) * (b | 99)) | ((c ^ 74) & (c - q));
+  d = ((c & d) & (p + c)) + ((c ^ q) | (q + c));
+  a = ((d - 29) | (d | a)) & ((d + b) + (a * d));
+  d = ((c | c) * (c * d)) + ((a | d) + (d & d));
+  if(b < d){
+    c = ((a | a) * (d ^ 20)) | ((b - a) ^ (d * 65));
+  }else{
+    d = ((b * p) & (p + p)) - ((a & b) & (d - d));
+  }
+  b = ((p + b) - (q + p)) | ((q & b) - (d - a));
+  c = ((q - a) + (b + a)) & ((d * 61) ^ (b ^ a));
+  b = ((p + d) * (a * a)) + ((p * q) ^ (c & q));
+  a = ((p & b) * (b & b)) ^ ((p * b) + (b + 58));
+  if(d < d){
+    c = ((c - q) + (p - 97)) - ((p + p) & (a + q));
+  }else{
+    a = ((p * b) - (c | 59)) * ((c | 34) | (d ^ p));
+  }
+  return a + b + c + d;
+}
+
+int func74(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 45;
+  d = 15;
+  b = ((b ^ q) | (d + q)) ^ ((a & d) + (b | c));
+  a = ((b * p) + (b + 39)) ^ ((q - 35) ^ (c + 56));
+  c = ((q * q) & (c | 50)) - ((a | p) | (p - a));
+  a = ((p + d) + (p * q)) + ((d - 90) - (c | b));
+  if(b < q){
+    a = ((c - q) - (d - a)) & ((b * 84) + (q + a));
+  }else{
+    c = ((c & p) - (c - 6)) | ((c ^ p) & (c * p));
+  }
+  b = ((p * c) * (b - 59)) - ((a - 68) | (p - c));
+  for(i = 0; i < 9; i++){
+    d = ((q & p) + (p - d)) | ((q | q) - (b * 7));
+  }
+  c = ((a + 5) & (d ^ d)) & ((c - q) + (b - 58));
+  b = ((p ^ p) + (d | d)) * ((c & c) ^ (d | q));
+  if(c < q){
+    c = ((c & p) + (c * p)) * ((c & 92) * (p - 17));
+  }else{
+    a = ((c & b) | (p * q)) + ((c + p) | (b * 26));
+  }
+  b = ((a ^ b) - (b - d)) + ((c | d) * (a + a));
+  b = ((b & 34) * (d + 25)) ^ ((p ^ a) * (a | c));
+  c = ((d ^ b) + (a ^ p)) ^ ((b * 1) | (c ^ p));
+  for(i = 0; i < 4; i++){
+    b = ((b * 55) * (p | p)) + ((p + a) | (c & c));
+  }
+  if(b < a){
+    d = ((p - b) & (d - 64)) ^ ((a & 50) * (b ^ a));
+  }else{
+    b = ((p - 39) - (d ^ q)) - ((q - q) ^ (b * d));
+  }
+  b = ((p & b) + (b ^ c)) | ((c * q) + (a ^ a));
+  b = ((c | b) + (p | c)) + ((a * q) * (p + a));
+  a = ((b ^ c) | (b ^ c)) + ((p + p) | (p | 47));
+  c = ((a - a) - (d & 50)) * ((q ^ 72) - (a * d));
+  if(a < b){
+    b = ((p - p) + (a + d)) | ((a + 8) * (d - p));
+  }else{
+    b = ((d | q) * (b * 23)) ^ ((d ^ q) - (d ^ a));
+  }
+  for(i = 0; i < 44; i++){
+    b = ((q ^ a) & (d * a)) + ((c + 14) + (d * d));
+  }
+  b = ((b + d) & (c + 73)) * ((q + p) & (q ^ a));
+  d = ((c - b) ^ (b + 50)) - ((a + 6) * (a + 98));
+  c = ((c | p) + (q | 47)) ^ ((p ^ c) | (a + q));
+  if(a < q){
+    a = ((q | d) | (d - d)) & ((a + q) | (d + b));
+  }else{
+    a = ((a & c) | (a + d)) & ((d ^ d) & (a * c));
+  }
+  b = ((d * b) | (c + 60)) - ((c + d) | (d ^ a));
+  c = ((c * d) * (q & c)) * ((q & c) - (c ^ q));
+  for(i = 0; i < 42; i++){
+    a = ((c + b) & (b | c)) & ((a + c) + (p * b));
+  }
+  a = ((q ^ p) | (p ^ p)) ^ ((c ^ a) | (d - 39));
+  if(a < 56){
+    a = ((c + a) * (p - 83)) + ((q ^ 24) * (b ^ c));
+  }else{
+    c = ((q - d) | (a ^ b)) + ((d + q) ^ (d + d));
+  }
+  d = ((q ^ 15) - (b ^ 68)) + ((c * 4) | (q & q));
+  d = ((q ^ c) | (d | a)) | ((d & q) - (c + q));
+  b = ((c + 6) | (q & q)) * ((q ^ 10) + (b & 25));
+  c = ((d ^ p) & (b ^ 39)) ^ ((c ^ q) | (c ^ 89));
+  if(b < 91){
+    c = ((c - 49) * (c * 67)) ^ ((b - q) + (a ^ d));
+  }else{
+    d = ((a ^ 24) ^ (a ^ a)) ^ ((c - d) & (c + p));
+  }
+  d = ((b | p) ^ (a ^ d)) & ((p | c) - (d + p));
+  b = ((a & 55) - (d * c)) & ((b & a) & (c ^ p));
+  a = ((q & 48) | (b * d)) & ((q ^ 4) + (a * 84));
+  c = ((q * 76) * (b | d)) | ((d + 49) - (b + 98));
+  if(b < b){
+    a = ((b & 32) * (q & 47)) & ((b ^ p) * (c - c));
+  }else{
+    c = ((b & 76) | (a | c)) + ((p - a) * (d ^ c));
+  }
+  return a + b + c + d;
+}
+
+int func75(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 58;
+  d = 32;
+  a = ((c * d) & (a ^ 52)) ^ ((b | c) & (c | 11));
+  b = ((q & b) * (b - p)) - ((p ^ 7) | (q + q));
+  d = ((d | q) + (p - p)) - ((q - q) + (p + 1));
+  a = ((c + p) * (c * b)) - ((q - d) & (a - 9));
+  if(b < a){
+    d = ((q - c) + (c + p)) | ((a ^ a) | (p + d));
+  }else{
+    a = ((a | d) + (a * 18)) + ((q - d) * (d + a));
+  }
+  d = ((b - 77) | (b + 66)) & ((d + 65) + (b * q));
+  for(i = 0; i < 42; i++){
+    c = ((c + 1) & (c & 82)) | ((d | q) & (c * 35));
+  }
+  d = ((a & b) * (b + d)) | ((q ^ b) ^ (q & 81));
+  d = ((q | b) & (d ^ b)) * ((a & d) + (c ^ 59));
+  if(c < b){
+    a = ((b + q) * (p + a)) + ((p | d) & (c | 52));
+  }else{
+    c = ((c + b) & (c & a)) - ((b + 75) & (p & c));
+  }
+  d = ((d | b) ^ (d | q)) | ((p * d) + (a - 72));
+  b = ((p ^ a) - (p + b)) ^ ((q | a) - (a ^ p));
+  c = ((d * 17) * (d ^ p)) ^ ((d * d) * (a * 93));
+  for(i = 0; i < 10; i++){
+    a = ((a + 67) + (d * c)) * ((d - c) + (q + q));
+  }
+  if(d < b){
+    c = ((b & a) + (a - 9)) | ((b ^ b) * (d | a));
+  }else{
+    c = ((q & a) | (a & c)) | ((a * p) & (d - a));
+  }
+  b = ((a + 5) ^ (q & d)) & ((a + 69) - (q + p));
+  d = ((q ^ d) | (p | d)) + ((a - d) & (q - a));
+  d = ((d - b) | (p - d)) - ((d ^ p) + (p + 44));
+  d = ((p & p) + (c * b)) & ((c - b) + (p - p));
+  if(d < a){
+    b = ((q - 29) * (q * d)) - ((a + p) & (d & b));
+  }else{
+    a = ((b * p) + (b - p)) * ((p - p) & (a & 41));
+  }
+  for(i = 0; i < 2; i++){
+    b = ((d * p) * (p * 20)) + ((a * 56) & (q | p));
+  }
+  a = ((b | 73) + (a & 52)) * ((q | c) ^ (d | p));
+  d = ((p - p) - (a & b)) + ((a + b) - (d ^ d));
+  a = ((p + a) - (a + 25)) + ((d ^ d) + (c & 74));
+  if(b < c){
+    d = ((a | d) + (d + d)) | ((a - b) + (c & c));
+  }else{
+    b = ((a + b) + (c - d)) + ((a * q) & (c | d));
+  }
+  c = ((c | b) - (a & 50)) ^ ((a & b) + (q ^ c));
+  c = ((c ^ a) + (d + 88)) - ((a * q) | (b | a));
+  for(i = 0; i < 11; i++){
+    a = ((d ^ a) ^ (q - 53)) + ((d + b) + (a - a));
+  }
+  b = ((c & q) + (a + c)) ^ ((b | 92) ^ (q - q));
+  if(a < a){
+    c = ((d + b) & (c + b)) & ((b & 42) ^ (c - b));
+  }else{
+    c = ((d * b) - (c - p)) | ((a | c) | (a & d));
+  }
+  a = ((p * 40) + (d - b)) - ((a ^ b) & (c + q));
+  a = ((b * a) + (c * d)) - ((p - p) - (a + c));
+  b = ((d - d) * (b | d)) - ((c | p) + (c * 55));
+  c = ((p - b) - (q ^ p)) + ((d ^ b) | (b ^ q));
+  if(d < q){
+    d = ((b | c) & (a + 93)) + ((c & d) * (b - p));
+  }else{
+    b = ((d ^ 78) * (p & p)) | ((q + 64) * (b | c));
+  }
+  c = ((b | c) - (d & p)) + ((d | d) - (q * c));
+  a = ((a | 29) | (a + p)) + ((p * p) ^ (c - 43));
+  b = ((b - 76) - (d * q)) * ((a + p) ^ (q + b));
+  c = ((b * d) + (c - 6)) | ((a + b) * (p - 58));
+  if(a < a){
+    d = ((c ^ c) * (b * b)) - ((c & c) & (b ^ b));
+  }else{
+    b = ((a - d) - (c - d)) | ((a & a) | (b * a));
+  }
+  return a + b + c + d;
+}
+
+int func76(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 51;
+  d = ((c + d) | (d + b)) * ((p + b) | (q - 15));
+  b = ((q + b) ^ (p * c)) * ((a & p) ^ (b ^ p));
+  c = ((a | d) | (b * c)) * ((p & c) | (q | c));
+  d = ((d * 30) | (q | b)) | ((d + d) * (q + p));
+  if(b < c){
+    d = ((c ^ 56) + (d ^ c)) * ((c - 75) & (d ^ b));
+  }else{
+    a = ((d + 4) & (b | q)) * ((d - b) ^ (a + p));
+  }
+  b = ((b | d) - (a ^ 13)) | ((p ^ 85) ^ (b * a));
+  for(i = 0; i < 45; i++){
+    b = ((a - a) - (p | c)) - ((b - c) ^ (q ^ p));
+  }
+  c = ((q + 83) ^ (p * q)) ^ ((b | d) * (c * p));
+  b = ((q * q) | (d & d)) + ((p + 27) | (b ^ c));
+  if(c < d){
+    c = ((d - c) & (q & b)) ^ ((q | q) * (d & b));
+  }else{
+    c = ((p & d) ^ (p * c)) & ((p - 91) - (p + d));
+  }
+  d = ((p & 78) + (c | p)) & ((b ^ q) | (p * q));
+  b = ((p & a) ^ (b ^ 65)) ^ ((b ^ p) ^ (b ^ a));
+  c = ((q * q) & (a + a)) + ((a ^ a) - (b - a));
+  for(i = 0; i < 28; i++){
+    d = ((c - c) * (c ^ b)) | ((d + d) * (p + p));
+  }
+  if(a < a){
+    a = ((q - c) & (q ^ 63)) ^ ((c - a) + (q * p));
+  }else{
+    a = ((p | c) ^ (c & 19)) | ((a - d) * (c | d));
+  }
+  c = ((d | 28) - (c - q)) ^ ((b & 84) ^ (c ^ b));
+  c = ((b & 67) & (p - c)) * ((q - b) * (a * b));
+  c = ((d + c) - (d ^ a)) & ((d + p) + (q + d));
+  b = ((b ^ d) ^ (c | d)) & ((a + a) ^ (a & c));
+  if(b < d){
+    b = ((d | 26) & (b | p)) | ((a + q) & (c - b));
+  }else{
+    c = ((a & a) ^ (a ^ d)) - ((b + p) & (c * q));
+  }
+  for(i = 0; i < 2; i++){
+    d = ((b - 1) | (b - 76)) | ((b | 82) - (q - c));
+  }
+  d = ((d * b) * (q * p)) & ((c & p) & (a - 55));
+  a = ((a * 5) | (q - p)) + ((a & q) | (d ^ 71));
+  a = ((p ^ d) | (p ^ p)) | ((p * q) & (a & a));
+  if(d < p){
+    c = ((a * c) - (c * q)) & ((c | a) + (c ^ b));
+  }else{
+    a = ((d + c) * (a + d)) * ((b ^ q) * (p & q));
+  }
+  b = ((d ^ p) & (d * 11)) | ((b & p) - (d | c));
+  c = ((a + 11) + (b & a)) & ((c ^ b) | (a * a));
+  for(i = 0; i < 39; i++){
+    d = ((p & 32) - (p - q)) * ((p ^ d) - (q & 54));
+  }
+  a = ((c | b) ^ (a & 33)) | ((a | p) | (d | b));
+  if(b < c){
+    c = ((c * a) - (d ^ a)) & ((c - c) ^ (c & b));
+  }else{
+    c = ((b - d) ^ (c | p)) + ((c | 15) - (c & p));
+  }
+  a = ((q * p) + (d ^ 88)) & ((p ^ b) - (a | b));
+  d = ((b ^ b) & (d ^ q)) * ((b + b) * (b - a));
+  b = ((d & a) + (d ^ p)) ^ ((b - c) ^ (c * 25));
+  c = ((a * 89) * (b - a)) - ((b | b) ^ (b + b));
+  if(c < b){
+    a = ((q | b) - (q & 21)) - ((p * q) ^ (b & 57));
+  }else{
+    b = ((q * a) & (d ^ 75)) + ((d - d) * (p & q));
+  }
+  c = ((c - p) + (c + 80)) * ((p + 87) + (a & a));
+  a = ((b - a) - (d + p)) ^ ((b * 59) + (a ^ 61));
+  b = ((p ^ c) - (d * d)) * ((b - q) | (d - p));
+  b = ((c | b) - (p * p)) | ((p ^ 50) & (d + a));
+  if(b < p){
+    d = ((c * 31) | (q - q)) ^ ((a | b) * (d & 71));
+  }else{
+    b = ((q ^ a) ^ (b ^ a)) * ((c + d) & (c - d));
+  }
+  return a + b + c + d;
+}
+
+int func77(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 1;
+  d = 82;
+  c = ((a + d) + (b & d)) - ((c - c) & (p - q));
+  d = ((a - b) * (q & q)) * ((b ^ a) * (a - q));
+  c = ((c ^ q) & (a + b)) - ((b - q) * (p + d));
+  a = ((c & p) & (b ^ a)) ^ ((q + 83) + (b - b));
+  if(d < p){
+    a = ((p | b) & (d & a)) | ((p & b) ^ (p | a));
+  }else{
+    b = ((b ^ 80) - (a + d)) ^ ((b | p) & (d - 71));
+  }
+  d = ((q | p) - (c - a)) ^ ((d + c) + (d + q));
+  for(i = 0; i < 46; i++){
+    b = ((d * p) * (c - q)) & ((b + c) | (p & q));
+  }
+  a = ((b | p) ^ (q + c)) + ((q ^ q) & (q * q));
+  d = ((q & c) | (d & c)) + ((b & 51) ^ (d | 85));
+  if(b < 49){
+    a = ((b - c) | (a ^ b)) * ((q - a) ^ (a * d));
+  }else{
+    c = ((p * b) - (a & q)) + ((c + 90) - (c ^ d));
+  }
+  d = ((b | q) + (c & b)) & ((c ^ q) ^ (a - 49));
+  d = ((d | a) ^ (a + d)) & ((b ^ c) * (p + a));
+  b = ((b | a) | (a ^ d)) | ((b + a) | (b - d));
+  for(i = 0; i < 41; i++){
+    c = ((b + c) - (q | a)) - ((b + a) ^ (c ^ q));
+  }
+  if(c < p){
+    a = ((c - b) | (c ^ a)) | ((p & p) | (d & 2));
+  }else{
+    c = ((a | p) ^ (p | c)) + ((b & q) * (q * a));
+  }
+  a = ((d - 34) * (c ^ 75)) | ((b + 68) + (q * 53));
+  b = ((q | p) & (b + b)) ^ ((q + 14) - (c ^ q));
+  d = ((d * q) & (p - a)) & ((a - b) ^ (b | d));
+  b = ((a * p) ^ (b - b)) | ((b + a) + (b + p));
+  if(b < b){
+    a = ((a - p) - (d & b)) & ((a | q) ^ (a * b));
+  }else{
+    c = ((q | 65) & (d | p)) + ((a - 95) ^ (p * q));
+  }
+  for(i = 0; i < 46; i++){
+    c = ((p - p) + (d | b)) | ((b * 76) & (a + q));
+  }
+  d = ((a + 19) * (d & 67)) * ((d & 44) | (d * b));
+  c = ((b * d) ^ (a | 18)) | ((a + b) + (c + c));
+  b = ((q + 23) & (d - d)) * ((c & 46) * (d - d));
+  if(b < 37){
+    b = ((c + 97) & (b - 63)) & ((d + a) ^ (q * a));
+  }else{
+    d = ((a - d) & (a & d)) + ((p + c) | (p ^ b));
+  }
+  a = ((p ^ q) - (a * d)) ^ ((b * 56) + (d - b));
+  a = ((a * 98) + (q + 20)) + ((q + c) * (q * d));
+  for(i = 0; i < 13; i++){
+    c = ((c ^ 97) ^ (p | p)) + ((d * q) & (q ^ d));
+  }
+  c = ((b - 32) * (b | p)) * ((c + p) ^ (c ^ 97));
+  if(b < c){
+    c = ((b - q) + (c | p)) | ((b + 64) + (d - c));
+  }else{
+    c = ((q + q) + (a | d)) - ((c & b) & (q * 28));
+  }
+  a = ((c | q) | (a * 97)) | ((c & b) & (q * d));
+  a = ((q & b) * (q & 39)) * ((a * q) + (q & p));
+  d = ((b + 62) + (a - a)) - ((b + a) & (p * 47));
+  b = ((c ^ c) + (q ^ c)) ^ ((c ^ d) & (q - c));
+  if(c < b){
+    d = ((p | b) ^ (c - d)) * ((c * q) * (q - 98));
+  }else{
+    a = ((b | b) * (a & d)) | ((b | q) + (q * c));
+  }
+  d = ((c & p) + (b * c)) ^ ((a | c) + (d | 27));
+  a = ((c * q) & (b - p)) ^ ((c + 69) & (c - p));
+  d = ((c - d) - (p & a)) - ((c | q) * (a + 66));
+  c = ((d + c) * (b ^ d)) | ((a ^ c) | (p ^ q));
+  if(c < c){
+    d = ((p - q) * (p & q)) ^ ((q | a) - (c - 51));
+  }else{
+    a = ((c ^ 6) + (a - a)) ^ ((b | d) - (p & q));
+  }
+  return a + b + c + d;
+}
+
+int func78(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 57;
+  d = 45;
+  b = ((c & 26) * (a - p)) + ((p ^ a) + (c | p));
+  c = ((p + c) & (d + a)) * ((a | p) * (a & d));
+  d = ((p - q) + (a * 49)) + ((c ^ b) & (b ^ b));
+  b = ((c ^ c) - (c | b)) | ((d - 11) - (q & d));
+  if(d < c){
+    b = ((q - d) | (q * q)) - ((a | 49) ^ (a & c));
+  }else{
+    d = ((d - c) | (q - q)) * ((d & 94) - (p & p));
+  }
+  d = ((q + q) - (d * p)) + ((p - 13) ^ (d * c));
+  for(i = 0; i < 22; i++){
+    a = ((c * 88) | (a & q)) - ((a ^ c) + (c ^ p));
+  }
+  c = ((q ^ c) | (c - c)) * ((b - d) - (a + a));
+  c = ((d - q) | (a * c)) & ((q ^ b) + (c | c));
+  if(c < 83){
+    a = ((a & p) & (b - 94)) ^ ((q - d) * (d * d));
+  }else{
+    a = ((c * a) | (a + 81)) * ((d - q) + (b - p));
+  }
+  d = ((b | a) & (p * 58)) - ((q + 33) | (p & p));
+  a = ((b - d) ^ (p - a)) - ((b - d) - (a ^ c));
+  c = ((d & 3) & (p & d)) + ((b + q) - (q - 56));
+  for(i = 0; i < 8; i++){
+    c = ((q & a) - (d | d)) - ((a + a) | (d + a));
+  }
+  if(a < p){
+    d = ((b ^ d) ^ (p & 84)) & ((a | d) - (a ^ d));
+  }else{
+    a = ((a - c) & (b + p)) - ((d & q) - (c + q));
+  }
+  b = ((q & 39) | (d - 70)) - ((p - a) | (p & b));
+  d = ((d - 38) * (a + q)) | ((p | 4) | (q ^ b));
+  b = ((c + p) - (d & c)) ^ ((b | a) - (q | b));
+  d = ((d - p) + (c | d)) + ((p + p) + (d ^ d));
+  if(d < p){
+    d = ((a - q) ^ (b & b)) + ((b * 21) & (p & b));
+  }else{
+    c = ((a | a) * (b & c)) ^ ((p & b) * (q & 45));
+  }
+  for(i = 0; i < 9; i++){
+    d = ((c | p) | (d & d)) - ((a & p) ^ (d | 84));
+  }
+  c = ((d ^ 58) - (q ^ d)) * ((q ^ p) - (b * q));
+  d = ((d ^ c) * (c * p)) | ((c ^ a) ^ (a * 98));
+  c = ((p ^ c) * (q * a)) + ((a ^ 74) & (b | d));
+  if(a < p){
+    b = ((q + d) + (p + b)) ^ ((c ^ c) ^ (b + a));
+  }else{
+    a = ((d & 37) & (d + a)) + ((a - c) & (b ^ c));
+  }
+  c = ((c ^ q) | (q ^ p)) - ((d + q) * (c + d));
+  b = ((c * p) ^ (q ^ b)) & ((p ^ a) | (a | c));
+  for(i = 0; i < 19; i++){
+    b = ((c ^ c) & (d - p)) - ((b & q) * (d * c));
+  }
+  b = ((d + c) * (b & d)) | ((p & b) ^ (d | c));
+  if(d < d){
+    c = ((p | 79) | (q ^ d)) * ((p | p) + (a + 91));
+  }else{
+    b = ((c * 42) ^ (c + p)) * ((c ^ q) & (q * q));
+  }
+  a = ((p - 99) - (d | b)) - ((c | 71) * (a | c));
+  d = ((d ^ d) + (d * b)) & ((d & c) ^ (b * c));
+  a = ((a ^ a) ^ (b - b)) | ((a - 84) | (a * b));
+  d = ((d | a) * (q ^ b)) - ((a ^ 43) & (q | a));
+  if(a < 94){
+    c = ((c * c) - (a - p)) | ((p | 44) * (a - a));
+  }else{
+    b = ((d | q) & (c ^ p)) * ((a + c) | (p & 98));
+  }
+  b = ((d & 3) | (c - 55)) * ((c ^ 93) ^ (q - a));
+  a = ((d ^ d) & (p + q)) ^ ((b & c) + (a | p));
+  d = ((a + p) & (p & d)) - ((p + 94) - (q | d));
+  c = ((p | 91) * (p & a)) | ((p + d) ^ (b ^ c));
+  if(a < d){
+    b = ((p * p) ^ (a ^ d)) * ((c & d) | (b - b));
+  }else{
+    b = ((p ^ a) | (p ^ b)) ^ ((c * d) ^ (c * a));
+  }
+  return a + b + c + d;
+}
+
+int func79(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 86;
+  d = 20;
+  d = ((q & 15) ^ (a | a)) - ((d | c) ^ (p & q));
+  d = ((q * 69) & (c - p)) + ((p | 3) + (p + 25));
+  a = ((a | q) ^ (q ^ b)) * ((a & b) | (b - 80));
+  d = ((p * b) - (d * b)) & ((d - p) * (d | b));
+  if(c < a){
+    b = ((q ^ 65) ^ (b ^ d)) * ((q * c) * (p + p));
+  }else{
+    a = ((d ^ c) | (c | b)) & ((q + a) & (a * p));
+  }
+  d = ((a * p) ^ (b - d)) - ((q * q) & (q | 11));
+  for(i = 0; i < 30; i++){
+    c = ((c | a) * (d + 57)) | ((b & d) | (a & c));
+  }
+  d = ((d + q) - (a - 56)) & ((c - b) + (d & 26));
+  b = ((c ^ p) * (d - a)) - ((b | p) * (c + b));
+  if(b < p){
+    b = ((p - 46) ^ (b ^ 12)) * ((c + c) - (a * a));
+  }else{
+    d = ((p & 11) | (c * c)) | ((q & c) - (d * d));
+  }
+  c = ((q - b) & (c * a)) + ((p * d) - (p & b));
+  c = ((b * d) & (b ^ 52)) - ((b * b) + (d * c));
+  b = ((q * q) - (q ^ q)) ^ ((d & d) + (p ^ b));
+  for(i = 0; i < 9; i++){
+    a = ((p + p) & (p + p)) | ((a ^ 29) - (q - p));
+  }
+  if(d < p){
+    d = ((d ^ b) * (c * q)) & ((a ^ b) & (b * c));
+  }else{
+    d = ((q + 74) + (c | c)) & ((c * 5) & (d & p));
+  }
+  a = ((d - d) + (c ^ b)) + ((b ^ c) & (p ^ q));
+  d = ((b & q) - (b | c)) + ((p & 88) - (b ^ p));
+  c = ((c ^ c) + (q & p)) + ((p ^ c) & (d & b));
+  d = ((a + p) * (q ^ b)) * ((d & 53) * (q + d));
+  if(a < d){
+    c = ((a - b) + (q * p)) | ((b - 74) & (q - c));
+  }else{
+    d = ((p & d) + (b * c)) - ((q ^ a) & (d ^ a));
+  }
+  for(i = 0; i < 6; i++){
+    a = ((a * 9) - (q & 84)) * ((b + 49) & (p & a));
+  }
+  c = ((b ^ b) - (c | p)) ^ ((d | c) + (p * b));
+  d = ((p | 88) & (a | q)) + ((a * c) * (p - 81));
+  c = ((p | b) - (p & a)) * ((c ^ b) - (p - q));
+  if(b < b){
+    c = ((d ^ 95) & (b - c)) ^ ((c ^ q) * (q | a));
+  }else{
+    d = ((a * 82) ^ (d + d)) - ((p * c) & (d & b));
+  }
+  d = ((b - 21) | (d & p)) | ((c ^ p) | (p - b));
+  b = ((d * 44) | (b - p)) | ((q * b) & (b & 11));
+  for(i = 0; i < 20; i++){
+    b = ((q & 17) * (a ^ 49)) & ((a ^ b) | (q + c));
+  }
+  c = ((q | a) & (c * 58)) & ((b ^ 57) & (d * 92));
+  if(a < 25){
+    d = ((p ^ 85) & (p ^ 86)) - ((q - 60) & (p | 55));
+  }else{
+    c = ((d + d) | (c | a)) & ((a ^ a) - (b ^ 4));
+  }
+  d = ((a - d) & (b & b)) ^ ((d - q) + (d - 70));
+  b = ((p + d) + (d - q)) * ((a & 17) | (d + 7));
+  c = ((c & b) + (q & 25)) | ((q & a) - (a - d));
+  b = ((a & d) ^ (p & q)) * ((c ^ c) | (p * 18));
+  if(b < q){
+    c = ((a | a) - (a & 62)) | ((b & 76) - (a ^ p));
+  }else{
+    c = ((c * c) | (d + c)) * ((c + b) ^ (q & q));
+  }
+  b = ((a - a) + (d + p)) + ((p | 25) ^ (d - p));
+  b = ((d * 71) ^ (b ^ a)) ^ ((a ^ a) + (q * d));
+  a = ((a & a) * (a + 88)) + ((a * q) - (p + c));
+  c = ((p + c) | (p | 35)) + ((a | p) | (a | b));
+  if(a < b){
+    a = ((a - a) & (a + d)) * ((d + p) ^ (c ^ b));
+  }else{
+    d = ((d ^ b) & (a * a)) * ((q - a) ^ (a ^ q));
+  }
+  return a + b + c + d;
+}
+
+int func80(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 20;
+  d = 66;
+  b = ((b + 86) * (q - p)) ^ ((d - a) ^ (q * c));
+  b = ((c ^ b) - (b | p)) * ((a * a) * (a + 1));
+  b = ((a & q) + (a | c)) & ((p & d) & (b + p));
+  d = ((d | b) ^ (q - d)) ^ ((p + a) - (c - 71));
+  if(c < a){
+    c = ((q - 89) ^ (b & q)) ^ ((q & c) + (c * a));
+  }else{
+    a = ((d - d) + (a + q)) + ((b | 12) - (b & a));
+  }
+  b = ((a * b) - (q * p)) + ((q & 71) + (q - 96));
+  for(i = 0; i < 50; i++){
+    b = ((b * a) ^ (p + p)) - ((c * b) & (q + 75));
+  }
+  d = ((a + p) + (c - a)) ^ ((q | a) ^ (b ^ d));
+  c = ((d + c) - (p - p)) | ((d & q) | (a * d));
+  if(b < 55){
+    a = ((p & c) | (d ^ p)) | ((q ^ a) & (p + b));
+  }else{
+    a = ((c & p) * (p * 79)) & ((q - b) | (c ^ p));
+  }
+  d = ((b + 7) | (p + c)) + ((c - b) & (c ^ q));
+  a = ((d + p) ^ (d * b)) * ((p ^ a) + (c & q));
+  b = ((d ^ d) & (b - d)) & ((p + d) + (a * q));
+  for(i = 0; i < 24; i++){
+    b = ((p + p) ^ (b | a)) + ((c * p) | (p ^ q));
+  }
+  if(b < q){
+    b = ((d & 15) + (a | a)) * ((p - d) ^ (p - b));
+  }else{
+    c = ((c & c) ^ (a + p)) + ((b * p) * (a | p));
+  }
+  a = ((c + q) ^ (q + a)) * ((d - d) ^ (b & b));
+  c = ((b - c) ^ (p | b)) | ((a * a) - (d | 23));
+  b = ((d | c) | (a * b)) - ((a & d) ^ (d ^ d));
+  d = ((b * a) | (c & q)) - ((p & c) + (p | q));
+  if(d < 55){
+    c = ((c ^ 88) + (p | q)) & ((a & q) | (q + q));
+  }else{
+    a = ((a + d) ^ (p ^ d)) | ((q - c) + (c + c));
+  }
+  for(i = 0; i < 14; i++){
+    d = ((d | d) - (d - a)) ^ ((b & 30) ^ (b & d));
+  }
+  d = ((d ^ a) - (b | a)) ^ ((c * a) * (a ^ d));
+  c = ((b - p) - (p + p)) | ((c ^ p) ^ (q & c));
+  b = ((d * b) * (q * c)) * ((p ^ q) ^ (b + p));
+  if(b < a){
+    b = ((q | d) & (c + d)) * ((q + 9) + (c * p));
+  }else{
+    a = ((d * a) + (c ^ 69)) & ((b + d) & (p - a));
+  }
+  d = ((c & d) * (d + a)) | ((b | p) - (d * a));
+  a = ((c + b) * (q ^ b)) * ((p ^ 61) - (q * d));
+  for(i = 0; i < 34; i++){
+    b = ((b | d) ^ (a ^ p)) - ((c - q) & (c & a));
+  }
+  a = ((p * a) ^ (a & 56)) & ((b & 58) ^ (c - c));
+  if(a < a){
+    c = ((q | p) ^ (b + d)) | ((p - 36) | (p + p));
+  }else{
+    c = ((a | p) - (p & q)) * ((b + b) & (p + 72));
+  }
+  a = ((a - p) & (b ^ a)) | ((a | a) ^ (b | 31));
+  c = ((q | c) ^ (c & b)) ^ ((b - p) - (b * d));
+  b = ((a & d) ^ (q | b)) - ((p * a) + (q & c));
+  a = ((a * p) - (d - 91)) - ((p | p) & (c * a));
+  if(b < b){
+    c = ((q ^ a) - (c | q)) ^ ((b * d) ^ (q | d));
+  }else{
+    a = ((d ^ 68) - (b | a)) | ((a * 19) ^ (c + p));
+  }
+  c = ((b & q) | (p - c)) - ((a & c) | (a & 5));
+  a = ((q - p) * (q | d)) | ((c - 24) - (b ^ c));
+  b = ((q * b) - (d + b)) & ((q & p) - (q ^ d));
+  c = ((q | c) & (d - a)) + ((b ^ 51) | (c - 52));
+  if(a < b){
+    b = ((d - a) - (a ^ d)) | ((b & d) & (p & p));
+  }else{
+    a = ((p & q) ^ (a * d)) * ((q + b) + (q + 13));
+  }
+  return a + b + c + d;
+}
+
+int func81(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 34;
+  d = 10;
+  b = ((a & p) & (a & d)) * ((b ^ 47) - (d + a));
+  a = ((p - 50) + (d ^ q)) - ((d - a) | (b ^ q));
+  a = ((p + 6) & (c | q)) + ((q * 79) * (q * 50));
+  c = ((p | p) ^ (b * 61)) + ((b | 14) ^ (c + 71));
+  if(c < q){
+    d = ((b + d) & (p - c)) * ((d * a) ^ (d & a));
+  }else{
+    d = ((a - c) - (a - q)) - ((q & 13) * (q ^ p));
+  }
+  b = ((d | a) * (p | c)) * ((p & 69) + (c + a));
+  for(i = 0; i < 36; i++){
+    a = ((c ^ b) ^ (b ^ q)) * ((d & c) | (p & p));
+  }
+  a = ((q ^ 65) - (p & 15)) ^ ((d ^ d) - (a ^ 78));
+  a = ((b + p) + (c ^ 58)) - ((a + q) - (b | 49));
+  if(d < p){
+    b = ((p ^ d) | (c + a)) - ((c ^ p) | (d - b));
+  }else{
+    d = ((b * 7) ^ (d + a)) & ((b ^ 10) - (b + c));
+  }
+  c = ((q + 77) ^ (a + 19)) * ((q + q) & (c + p));
+  b = ((b * b) & (d ^ b)) + ((p | b) | (a ^ 15));
+  d = ((d - q) ^ (d - p)) - ((b * 55) - (a | p));
+  for(i = 0; i < 27; i++){
+    d = ((a - 12) + (c & b)) * ((a & a) | (c * a));
+  }
+  if(d < q){
+    c = ((a & c) & (a * c)) | ((q * a) ^ (b + b));
+  }else{
+    d = ((a - q) + (b | 52)) & ((a * d) * (b | 10));
+  }
+  c = ((q - 96) ^ (a + 5)) - ((q & b) & (a ^ 10));
+  a = ((b | b) ^ (b & b)) * ((c * q) + (b ^ q));
+  a = ((a & p) & (a | d)) * ((q & q) | (b + a));
+  c = ((p * p) * (a & 27)) * ((q - 19) * (p ^ c));
+  if(a < 66){
+    a = ((b - a) - (c - 56)) * ((d & p) * (q | a));
+  }else{
+    d = ((b + c) - (c - b)) + ((d - c) ^ (p | q));
+  }
+  for(i = 0; i < 17; i++){
+    d = ((a - d) | (d & 2)) & ((p + 77) & (q + c));
+  }
+  b = ((d & p) - (a * b)) ^ ((d + 36) * (b + p));
+  d = ((b + 31) * (a ^ 55)) | ((a + a) | (p + 94));
+  c = ((q & a) | (a ^ 12)) ^ ((b - d) & (c + d));
+  if(b < d){
+    d = ((p + a) + (q - d)) + ((q * d) - (p & a));
+  }else{
+    b = ((p - q) ^ (d + 48)) | ((p | q) - (c + b));
+  }
+  c = ((p + p) | (a + d)) & ((p * q) * (d * q));
+  a = ((d | p) & (c - 32)) | ((d | d) + (d ^ a));
+  for(i = 0; i < 23; i++){
+    a = ((q - 83) - (a - a)) ^ ((p * a) * (b + d));
+  }
+  a = ((a ^ q) * (a - q)) & ((c - c) - (q * q));
+  if(a < 50){
+    d = ((a * d) | (q - b)) * ((p * q) * (p ^ 18));
+  }else{
+    a = ((b & b) * (c + 48)) & ((q - 8) + (b - q));
+  }
+  d = ((c ^ 63) | (b & d)) + ((d | q) + (a & q));
+  a = ((a + p) ^ (p - d)) ^ ((b * 41) - (p * p));
+  a = ((p | q) | (b ^ c)) * ((d - a) & (p - 69));
+  c = ((q | 90) * (d + d)) + ((p ^ 80) + (b + 43));
+  if(c < q){
+    d = ((a + a) + (c + b)) + ((d - 31) & (b - 86));
+  }else{
+    d = ((q | q) - (p & p)) * ((b * q) ^ (p - a));
+  }
+  c = ((a - d) & (d * c)) * ((q ^ 20) & (b * 54));
+  c = ((d & b) | (b + 98)) - ((p & q) - (p - 31));
+  d = ((a + c) ^ (b ^ d)) ^ ((q | q) * (q | 30));
+  b = ((a - c) ^ (b ^ 81)) + ((b + c) - (a + p));
+  if(c < a){
+    b = ((p * p) + (c * 70)) + ((c & a) ^ (a - p));
+  }else{
+    b = ((c ^ a) ^ (a * 25)) * ((a + c) | (b & c));
+  }
+  return a + b + c + d;
+}
+
+int func82(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 37;
+  d = 95;
+  b = ((q + p) - (q - d)) - ((b * c) ^ (c * d));
+  b = ((p & 66) * (c ^ q)) | ((q & c) - (a & p));
+  b = ((p & p) & (a & b)) + ((p * 20) & (p & p));
+  d = ((d + a) - (d ^ b)) - ((q | q) + (b + q));
+  if(d < d){
+    d = ((p ^ q) - (q ^ d)) + ((c & 24) & (b - p));
+  }else{
+    b = ((a + 80) | (p - 57)) - ((c * c) + (c ^ 98));
+  }
+  b = ((p ^ 67) * (p + a)) - ((a | 8) + (a & d));
+  for(i = 0; i < 17; i++){
+    c = ((p & 60) & (q & d)) | ((p ^ c) + (d | 54));
+  }
+  d = ((b & c) - (d | b)) * ((p * b) * (c ^ b));
+  a = ((q | 69) ^ (q + 83)) - ((p - a) & (p & d));
+  if(d < a){
+    c = ((b * b) & (b | d)) - ((b & 42) & (q - c));
+  }else{
+    c = ((d | q) + (c * 80)) & ((q + c) + (q - 32));
+  }
+  d = ((q * q) + (b & 86)) & ((q ^ 7) & (c | b));
+  a = ((c | d) | (q | q)) ^ ((d - b) & (d | p));
+  c = ((b | q) ^ (d - 67)) ^ ((d | c) ^ (c & 31));
+  for(i = 0; i < 8; i++){
+    b = ((a * 33) | (p * q)) ^ ((q + 7) - (b - c));
+  }
+  if(a < b){
+    d = ((c - p) * (a & a)) ^ ((b & 86) & (a - d));
+  }else{
+    b = ((b | 10) ^ (c * q)) * ((d + q) + (b - c));
+  }
+  b = ((d | p) * (a ^ c)) & ((b | c) - (q + 98));
+  c = ((d * q) ^ (q + p)) + ((c | d) | (b & a));
+  c = ((b + a) - (p + p)) + ((q | 50) * (b - a));
+  c = ((p * d) + (q + c)) & ((c - c) & (c | 38));
+  if(b < 99){
+    c = ((p * p) & (q & d)) ^ ((c & c) * (p ^ p));
+  }else{
+    d = ((d - a) * (d | 29)) ^ ((p & 7) ^ (p - c));
+  }
+  for(i = 0; i < 47; i++){
+    a = ((b - d) ^ (d + c)) - ((c | p) - (a & a));
+  }
+  a = ((c | p) + (a ^ 70)) | ((a - 40) | (c * c));
+  d = ((a | p) - (p ^ 6)) & ((a ^ p) | (d + b));
+  c = ((d - q) + (c | q)) * ((b ^ 84) | (c * c));
+  if(a < q){
+    b = ((q + 41) | (d * a)) - ((b + 31) - (d * c));
+  }else{
+    d = ((q ^ 88) * (p - a)) + ((a ^ 88) | (d * d));
+  }
+  d = ((p - b) * (a + 46)) ^ ((p | 17) - (c - c));
+  d = ((d ^ d) + (c | c)) ^ ((p + b) + (c * a));
+  for(i = 0; i < 15; i++){
+    b = ((p * d) & (a * a)) ^ ((p ^ 66) & (b - 87));
+  }
+  d = ((a ^ p) * (b ^ p)) - ((p ^ c) - (q & d));
+  if(a < a){
+    d = ((p - d) - (p - p)) | ((c - b) & (d + b));
+  }else{
+    c = ((d | b) * (d & 27)) * ((p + 89) + (d | 3));
+  }
+  a = ((p | 96) - (a | d)) * ((d & 85) * (p + q));
+  b = ((d ^ c) ^ (c & d)) & ((d | d) & (c + p));
+  d = ((d + b) | (q - c)) | ((d - d) & (p * d));
+  a = ((a + 47) | (q + 64)) | ((b + 67) & (a - 48));
+  if(b < b){
+    a = ((a | p) | (d & 58)) | ((a ^ b) - (b ^ 82));
+  }else{
+    b = ((b + c) + (q | c)) & ((d - d) - (d - c));
+  }
+  d = ((a ^ d) * (p | 26)) & ((d * p) ^ (a | 51));
+  b = ((b | p) - (a ^ 67)) & ((a & q) * (b | p));
+  b = ((d - a) ^ (c + a)) ^ ((a & c) * (q ^ q));
+  c = ((q * 11) | (p * a)) + ((p * d) & (p * c));
+  if(b < p){
+    d = ((q & p) & (a & c)) - ((a | p) | (c - b));
+  }else{
+    b = ((b + 83) - (c - a)) + ((d + 3) & (a - p));
+  }
+  return a + b + c + d;
+}
+
+int func83(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 82;
+  d = 23;
+  d = ((a | a) + (d & p)) + ((c * 87) - (a * 32));
+  d = ((q & a) & (p ^ a)) - ((q | b) & (q * a));
+  c = ((p - d) & (c & 71)) & ((c * 55) ^ (b | c));
+  b = ((d | b) ^ (d + d)) + ((d + q) & (q | c));
+  if(b < q){
+    a = ((d & d) & (a ^ 38)) ^ ((p ^ q) ^ (q - q));
+  }else{
+    a = ((a ^ a) | (c & c)) & ((b - b) + (b * q));
+  }
+  b = ((p | 6) * (p ^ a)) + ((c + a) ^ (q ^ 95));
+  for(i = 0; i < 29; i++){
+    c = ((b ^ c) & (c | a)) ^ ((p - q) + (c - a));
+  }
+  b = ((a | 83) - (b | 98)) * ((q - d) - (q & b));
+  d = ((q + d) * (q + q)) + ((q ^ a) * (q & d));
+  if(d < 49){
+    b = ((d | 14) & (p & a)) - ((d - q) + (p - 25));
+  }else{
+    d = ((a | 7) | (b + a)) - ((q | 28) + (b + 49));
+  }
+  b = ((b - 94) & (q | c)) * ((a | b) * (q | p));
+  d = ((p ^ p) & (c | c)) + ((q | 92) * (q - 79));
+  b = ((a + d) + (q + a)) - ((q - 75) | (q * 46));
+  for(i = 0; i < 16; i++){
+    d = ((d + a) - (c | d)) * ((p * a) + (p * 15));
+  }
+  if(c < 10){
+    a = ((q ^ p) - (p + p)) & ((b - 24) * (a & b));
+  }else{
+    c = ((q * d) - (b + a)) ^ ((p | a) & (a ^ p));
+  }
+  a = ((d * d) ^ (d & 54)) | ((q ^ 75) | (a + p));
+  c = ((q | c) * (p + q)) | ((p ^ p) | (c | p));
+  c = ((q & b) + (q - p)) ^ ((d - 10) & (a - a));
+  a = ((d + p) * (d * b)) & ((c + 81) & (c - q));
+  if(a < 24){
+    b = ((a + 34) & (q & 58)) + ((q + q) | (d & b));
+  }else{
+    d = ((b ^ q) + (q + 64)) - ((a * 74) ^ (q ^ p));
+  }
+  for(i = 0; i < 35; i++){
+    b = ((c - d) * (q + a)) | ((q + c) * (b | a));
+  }
+  b = ((p + 17) ^ (p * b)) & ((q - d) + (d - 90));
+  b = ((d | q) & (q ^ 60)) | ((c ^ 10) | (q * b));
+  d = ((a | 34) ^ (b + b)) ^ ((p & d) + (a ^ p));
+  if(d < 59){
+    b = ((a - a) & (q - b)) * ((c + p) + (q & 93));
+  }else{
+    b = ((p & 24) * (a * q)) | ((p * b) + (b * d));
+  }
+  c = ((b + 71) * (p - 11)) - ((a * 38) * (q - q));
+  c = ((d - a) * (q - a)) ^ ((d & d) - (c * q));
+  for(i = 0; i < 48; i++){
+    a = ((p | p) + (a ^ 89)) ^ ((b ^ c) ^ (d | d));
+  }
+  a = ((a ^ q) ^ (a & 69)) + ((b | b) - (p - d));
+  if(b < a){
+    b = ((d * b) + (c * b)) ^ ((b - a) - (a - d));
+  }else{
+    b = ((d & b) - (d | c)) - ((c + 5) + (q ^ a));
+  }
+  a = ((p + a) * (c | d)) + ((d ^ p) & (c & p));
+  d = ((d - 47) + (c * b)) + ((b + p) ^ (p & b));
+  b = ((d + c) - (c | p)) - ((q + q) | (b | d));
+  b = ((b & b) & (d - p)) & ((c | p) | (p | p));
+  if(c < p){
+    b = ((a | b) | (p * c)) | ((a + a) | (a - c));
+  }else{
+    a = ((a & 91) & (b ^ p)) & ((q ^ p) | (b & d));
+  }
+  d = ((d * q) ^ (a & 50)) - ((d * d) | (b * a));
+  c = ((d - 42) | (q * c)) | ((p | p) | (q & q));
+  a = ((b & a) - (q * d)) ^ ((p * a) & (c & 65));
+  d = ((p - b) & (c - p)) | ((c - c) | (c * q));
+  if(b < q){
+    d = ((b - a) & (c * q)) & ((c ^ a) ^ (c ^ c));
+  }else{
+    c = ((b + a) | (c | b)) + ((p - b) ^ (q - c));
+  }
+  return a + b + c + d;
+}
+
+int func84(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 10;
+  d = 33;
+  c = ((p + p) + (p | 77)) + ((c * 4) * (a | q));
+  a = ((b * c) + (p & c)) | ((p | 18) ^ (a & p));
+  c = ((p & c) & (p & 49)) * ((p ^ c) & (d ^ p));
+  c = ((a - d) | (c ^ q)) + ((a ^ c) * (d - q));
+  if(a < 10){
+    d = ((b & 99) & (p & b)) * ((c ^ q) + (q + d));
+  }else{
+    a = ((p ^ d) ^ (c ^ b)) * ((c + d) | (a * 28));
+  }
+  c = ((p - 41) ^ (p & 52)) - ((c & q) - (q * c));
+  for(i = 0; i < 47; i++){
+    c = ((a * q) ^ (p & 16)) - ((p & a) | (q + b));
+  }
+  c = ((a + 20) * (p * q)) ^ ((a * q) & (a | 63));
+  a = ((b ^ 70) - (b + q)) ^ ((p * 90) | (c - 42));
+  if(b < p){
+    b = ((d + q) + (p * c)) - ((p + b) | (a - b));
+  }else{
+    d = ((b * c) - (c | 4)) - ((a * b) | (c * a));
+  }
+  d = ((a | 10) - (a + 62)) * ((d ^ 6) | (c | d));
+  c = ((a - a) & (p | d)) + ((d ^ q) + (a & 65));
+  d = ((q * d) + (p * p)) | ((p + c) | (b ^ q));
+  for(i = 0; i < 7; i++){
+    c = ((a & b) | (d ^ p)) + ((q * q) + (a ^ d));
+  }
+  if(d < 36){
+    a = ((b & d) | (c - b)) | ((a - p) & (q + 69));
+  }else{
+    a = ((d & q) & (q & q)) - ((b * p) | (c & d));
+  }
+  b = ((d + c) & (a * 69)) ^ ((p * q) & (a ^ a));
+  b = ((p - 5) * (b * d)) - ((c ^ c) - (a - c));
+  a = ((b + q) ^ (q + q)) ^ ((a * c) ^ (d | q));
+  c = ((a - q) * (c ^ d)) - ((b & 39) ^ (q - a));
+  if(c < 5){
+    b = ((q ^ 51) + (a * 93)) - ((q ^ c) - (d * q));
+  }else{
+    c = ((a * b) & (b & b)) + ((a * b) ^ (q ^ 5));
+  }
+  for(i = 0; i < 12; i++){
+    d = ((q ^ c) - (p | q)) - ((b | p) + (d | 48));
+  }
+  b = ((d - q) + (q ^ 29)) | ((d - p) - (d + q));
+  d = ((b + a) + (c & q)) ^ ((p ^ q) * (a - d));
+  a = ((b | d) | (a & p)) ^ ((q | d) - (c * 45));
+  if(c < c){
+    a = ((p + d) | (p * b)) + ((q & d) & (d + a));
+  }else{
+    a = ((c & b) + (d + b)) ^ ((b - p) * (p - 11));
+  }
+  c = ((b & a) | (c | p)) & ((p * 5) - (p & b));
+  a = ((c + p) & (c + b)) ^ ((c | a) + (b + b));
+  for(i = 0; i < 13; i++){
+    c = ((a + d) * (p + a)) * ((c * p) - (b * a));
+  }
+  d = ((q | a) + (a | p)) - ((d + a) | (q - b));
+  if(a < q){
+    c = ((b * d) | (q + d)) + ((q ^ c) + (a & d));
+  }else{
+    d = ((b | 57) & (b - p)) & ((p & 37) * (p | a));
+  }
+  a = ((q + c) + (b - c)) & ((q ^ q) - (q & b));
+  b = ((q ^ q) + (q - q)) - ((c ^ p) | (a - q));
+  c = ((d - b) * (d | p)) & ((d + d) ^ (c & d));
+  d = ((a ^ c) ^ (d ^ q)) * ((a * d) ^ (p - 97));
+  if(a < q){
+    d = ((d | 66) - (p * d)) * ((d ^ 73) - (q - p));
+  }else{
+    b = ((a + c) * (b & c)) ^ ((c ^ 47) ^ (b & c));
+  }
+  a = ((p ^ b) & (c | q)) + ((p | q) + (b * 16));
+  c = ((b + 96) + (p + c)) - ((a - p) | (c + 19));
+  a = ((q & 12) * (b * b)) - ((b * a) ^ (b ^ a));
+  b = ((a - 80) - (q * p)) | ((d + c) - (p ^ 43));
+  if(a < c){
+    a = ((c & 85) - (c - 73)) & ((p * 27) | (a - 82));
+  }else{
+    d = ((c + q) ^ (p & p)) * ((d * a) * (a | c));
+  }
+  return a + b + c + d;
+}
+
+int func85(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 34;
+  d = 56;
+  a = ((p + 84) + (a & 56)) + ((a + d) * (b & p));
+  b = ((a | p) | (q + d)) - ((q & c) | (a ^ q));
+  b = ((p + q) ^ (c | q)) | ((p - b) - (p & 56));
+  a = ((d & d) & (c - a)) * ((a ^ 74) | (a | 83));
+  if(d < a){
+    a = ((a * q) - (b * c)) - ((c ^ d) + (p & a));
+  }else{
+    c = ((p ^ 15) * (q | q)) & ((b * b) - (c & b));
+  }
+  b = ((q ^ q) & (p - q)) & ((p - 2) * (a + b));
+  for(i = 0; i < 31; i++){
+    b = ((d | 49) & (c + d)) | ((b * q) ^ (d * 31));
+  }
+  b = ((d ^ 15) + (b - d)) | ((p ^ b) - (a | 97));
+  a = ((b | 22) + (d + c)) ^ ((d ^ p) | (b | c));
+  if(a < 35){
+    b = ((d + q) | (c ^ b)) * ((q * 7) & (q ^ c));
+  }else{
+    a = ((c ^ b) ^ (q & 23)) - ((q + d) | (b ^ c));
+  }
+  d = ((c * q) & (b ^ q)) ^ ((d - p) | (b - d));
+  a = ((p | a) * (a | 19)) ^ ((a | q) - (c * 2));
+  b = ((a ^ b) + (a & a)) & ((b | a) & (c * c));
+  for(i = 0; i < 25; i++){
+    a = ((p * a) * (q & 14)) ^ ((q + p) + (c | a));
+  }
+  if(b < d){
+    b = ((b - c) & (d & 85)) & ((d ^ b) & (a * b));
+  }else{
+    a = ((b - q) | (b + 40)) * ((d & q) | (p & 64));
+  }
+  a = ((p - d) ^ (p ^ q)) * ((c | d) - (p * 40));
+  b = ((b & p) & (d | d)) + ((c & a) ^ (p | c));
+  a = ((c - a) + (p & a)) & ((q | d) ^ (d & p));
+  c = ((q & p) ^ (d ^ c)) | ((q & c) & (q & q));
+  if(b < 22){
+    b = ((p - a) * (b + p)) + ((p | 65) & (q - d));
+  }else{
+    a = ((b ^ d) & (q + a)) ^ ((c + q) ^ (p + b));
+  }
+  for(i = 0; i < 43; i++){
+    a = ((a & a) - (d * d)) & ((p ^ p) + (p + q));
+  }
+  b = ((a ^ b) - (a | b)) & ((b - d) | (b & 90));
+  c = ((b & 42) * (d - d)) ^ ((a ^ d) & (c & c));
+  b = ((b + b) | (p ^ 35)) * ((b + c) | (a ^ c));
+  if(a < b){
+    a = ((c & b) | (c ^ a)) * ((a | q) * (d - d));
+  }else{
+    c = ((a ^ a) | (b | c)) * ((c + a) | (d | d));
+  }
+  d = ((b * 7) + (d - a)) + ((p | p) & (c ^ a));
+  d = ((d & q) + (p & p)) & ((d + b) * (b ^ 14));
+  for(i = 0; i < 33; i++){
+    a = ((c ^ q) + (p * 34)) - ((c + 76) + (q * d));
+  }
+  a = ((a * d) | (b + a)) ^ ((d - p) + (p | 62));
+  if(a < p){
+    d = ((d ^ q) & (a * 64)) | ((p | 55) ^ (p + d));
+  }else{
+    b = ((p - b) * (b ^ p)) - ((d - 68) * (d - q));
+  }
+  c = ((q & q) ^ (d | p)) + ((b & 62) ^ (b ^ c));
+  b = ((c & a) | (d | 47)) * ((p ^ 19) & (q - q));
+  c = ((d - a) | (d * d)) - ((a + d) | (a ^ q));
+  a = ((c | p) ^ (q | c)) + ((c | c) + (p | q));
+  if(c < p){
+    c = ((a + 39) + (q ^ b)) ^ ((q & 26) - (a ^ p));
+  }else{
+    b = ((a + b) ^ (b & q)) * ((a ^ c) - (a * a));
+  }
+  c = ((a - a) & (b | 57)) | ((d - d) * (a - 52));
+  a = ((a & 1) * (p - c)) * ((q & q) | (c - 8));
+  c = ((q - q) ^ (d | q)) ^ ((q ^ q) | (a * d));
+  a = ((p ^ p) | (q * b)) & ((c | p) & (b - q));
+  if(a < q){
+    b = ((d ^ q) + (q + 48)) ^ ((b + c) - (q | c));
+  }else{
+    d = ((b + b) - (q & p)) | ((p + p) - (d | d));
+  }
+  return a + b + c + d;
+}
+
+int func86(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 78;
+  d = 38;
+  b = ((d ^ a) + (p + 84)) + ((c & d) | (d | p));
+  a = ((b * d) ^ (d ^ d)) & ((q & q) + (c - p));
+  a = ((b | c) ^ (d ^ 67)) - ((b & d) - (q ^ p));
+  d = ((b * p) & (c & a)) & ((p | b) - (d ^ 40));
+  if(d < b){
+    a = ((p | q) | (p & c)) - ((p ^ q) ^ (c | a));
+  }else{
+    b = ((a & d) + (d + a)) | ((c * p) & (b * p));
+  }
+  a = ((b - d) | (p - a)) & ((p * 99) ^ (q - c));
+  for(i = 0; i < 48; i++){
+    a = ((c - q) ^ (p - d)) - ((b - 13) - (a | c));
+  }
+  c = ((c - p) + (p - p)) * ((p - 72) + (q & a));
+  d = ((d & c) ^ (p - c)) * ((p | 52) - (q & d));
+  if(c < p){
+    b = ((b ^ q) * (d & a)) & ((p - d) ^ (c ^ p));
+  }else{
+    b = ((a & 31) & (a - p)) & ((d * d) + (b + p));
+  }
+  b = ((b ^ c) | (a & q)) * ((p | a) | (d - a));
+  a = ((p - q) * (a ^ q)) * ((c ^ b) ^ (p * 34));
+  d = ((d * d) * (c & p)) & ((q * p) + (d & 48));
+  for(i = 0; i < 38; i++){
+    a = ((p ^ p) ^ (b | d)) & ((c + q) - (q * d));
+  }
+  if(a < 97){
+    c = ((q | a) & (b | b)) - ((b ^ b) - (q * a));
+  }else{
+    d = ((a & q) + (p & 49)) - ((q | q) + (d - 24));
+  }
+  b = ((d & d) ^ (d & p)) ^ ((d | q) - (a - 93));
+  b = ((b - a) + (c * 59)) * ((d * a) - (b & c));
+  d = ((a | q) + (q * d)) | ((a * p) - (b + 14));
+  a = ((p | 59) - (a ^ d)) | ((c | 10) | (a - 93));
+  if(c < d){
+    a = ((c ^ a) - (q ^ p)) - ((p + p) & (d - d));
+  }else{
+    a = ((q | 76) | (q - c)) & ((q ^ c) & (d ^ 80));
+  }
+  for(i = 0; i < 24; i++){
+    a = ((d + d) & (b * 70)) ^ ((a | c) & (b * a));
+  }
+  d = ((d & d) & (q & p)) - ((q | b) & (q ^ 26));
+  a = ((c + p) ^ (a + q)) + ((a | p) + (a | q));
+  b = ((p - p) | (p ^ c)) ^ ((q ^ 65) | (a ^ 45));
+  if(d < c){
+    d = ((c * d) - (c * 88)) | ((p - b) - (p + 9));
+  }else{
+    c = ((d & 23) ^ (b & a)) + ((p & c) & (q | d));
+  }
+  a = ((b + 56) * (q & b)) * ((c | 14) ^ (a - p));
+  b = ((q & d) + (d * c)) ^ ((a * 99) * (a & a));
+  for(i = 0; i < 32; i++){
+    d = ((p & 90) ^ (b * b)) & ((c - 73) - (d + b));
+  }
+  b = ((a | a) ^ (c | b)) & ((c + c) * (a - p));
+  if(d < c){
+    b = ((b ^ 51) | (q - c)) - ((b | q) | (p - 41));
+  }else{
+    d = ((q ^ d) | (q - b)) - ((d + a) * (p - c));
+  }
+  d = ((a & q) | (q ^ 97)) ^ ((c - 12) + (p & 61));
+  a = ((q * 61) + (d + c)) + ((c - d) * (p & 41));
+  d = ((a - q) - (d * 81)) * ((c | 82) | (c & a));
+  b = ((p + a) | (c ^ p)) + ((a & 94) ^ (d * p));
+  if(b < b){
+    d = ((b * p) * (q & p)) ^ ((b | 67) * (a - 98));
+  }else{
+    d = ((d * p) ^ (p * a)) * ((q & q) + (a & c));
+  }
+  d = ((d * q) + (q & d)) * ((d & a) * (b + p));
+  c = ((q + p) & (b - d)) & ((q + a) | (c & p));
+  d = ((c ^ 83) - (a - p)) + ((c & a) - (b - 37));
+  d = ((d ^ a) + (b ^ b)) ^ ((c * 77) * (d | d));
+  if(d < a){
+    a = ((p & 17) & (b - 75)) | ((d + 59) & (p & q));
+  }else{
+    b = ((a + d) + (c | a)) ^ ((a - p) | (p - a));
+  }
+  return a + b + c + d;
+}
+
+int func87(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 27;
+  d = 65;
+  b = ((b + b) & (q & 62)) * ((c - p) - (c - q));
+  c = ((b ^ b) - (q + 44)) - ((d & q) * (q * a));
+  b = ((p | d) ^ (d + b)) & ((a ^ q) ^ (a * 93));
+  b = ((c & a) * (p - 77)) ^ ((d ^ 84) | (b & d));
+  if(b < 47){
+    a = ((p & d) | (q + 59)) * ((d & a) | (p - a));
+  }else{
+    b = ((a & 27) & (b & b)) + ((b + a) | (a + 50));
+  }
+  a = ((d & c) - (q + 21)) * ((q ^ b) ^ (q | c));
+  for(i = 0; i < 26; i++){
+    c = ((a - q) - (p - q)) | ((d ^ c) | (c + 46));
+  }
+  c = ((c ^ p) & (b * d)) - ((c & c) | (p & a));
+  a = ((a * c) * (d ^ q)) & ((p ^ d) - (b ^ 48));
+  if(d < 6){
+    c = ((d * 14) & (q - 68)) * ((d - d) * (c * 99));
+  }else{
+    d = ((d & 13) | (d + d)) * ((q | d) - (d ^ a));
+  }
+  a = ((d & p) * (c & p)) | ((p & b) ^ (p & a));
+  a = ((d - q) & (c * p)) & ((p + a) * (d ^ q));
+  c = ((c & 85) + (q * b)) - ((b - a) * (p + d));
+  for(i = 0; i < 24; i++){
+    d = ((p - b) + (a | q)) - ((a * p) ^ (d + 95));
+  }
+  if(d < c){
+    c = ((a ^ b) ^ (c ^ b)) ^ ((b * 22) | (c - 65));
+  }else{
+    c = ((p * a) | (b + q)) - ((d * 32) ^ (a | 22));
+  }
+  d = ((a + 49) & (p & b)) - ((b * p) - (a + p));
+  b = ((b ^ p) ^ (d * c)) + ((d & d) - (c * p));
+  b = ((d ^ d) | (a - b)) | ((p * 74) & (d ^ q));
+  d = ((b - b) * (d ^ c)) + ((p | 32) | (a - a));
+  if(d < d){
+    b = ((q - a) & (p + b)) - ((c & a) - (c ^ 48));
+  }else{
+    c = ((b * q) * (d | 80)) * ((a | p) - (d | b));
+  }
+  for(i = 0; i < 5; i++){
+    b = ((a + a) | (b | d)) & ((d | 81) & (d * q));
+  }
+  a = ((c + 69) + (q & 38)) - ((d + 25) ^ (p ^ q));
+  d = ((a & 28) + (p | 29)) & ((a & q) * (q - b));
+  c = ((c + b) & (p & a)) + ((p - q) + (q ^ q));
+  if(b < q){
+    d = ((d ^ d) & (d | b)) | ((c + c) + (b - c));
+  }else{
+    c = ((q * 62) * (p - 51)) | ((q - q) * (a | p));
+  }
+  b = ((p ^ 35) ^ (b * 19)) * ((c ^ p) + (a & p));
+  d = ((b | 58) & (c & a)) - ((a & b) ^ (d * 15));
+  for(i = 0; i < 21; i++){
+    b = ((q ^ a) - (p ^ b)) + ((a & q) + (q * 19));
+  }
+  d = ((b - 17) ^ (c | 64)) | ((b & c) + (c - b));
+  if(a < 94){
+    d = ((b + p) & (a + p)) + ((b + p) - (q - a));
+  }else{
+    a = ((d & q) - (c ^ d)) + ((q & 91) + (p + q));
+  }
+  d = ((c | 12) - (q + c)) ^ ((p & c) * (c & a));
+  a = ((q - b) & (c - a)) * ((p + b) * (q | 49));
+  c = ((p - b) | (b + 21)) - ((p | q) - (p + c));
+  c = ((d | d) & (q | 59)) ^ ((q + d) - (p & q));
+  if(c < 43){
+    b = ((b * p) | (d - d)) | ((d ^ p) ^ (d + b));
+  }else{
+    d = ((d ^ q) ^ (a + p)) & ((q - 79) & (p | p));
+  }
+  c = ((p * 55) + (q | b)) + ((d * p) + (d & 18));
+  d = ((d * 28) & (d + a)) + ((d - q) - (b & q));
+  d = ((d + 34) * (d * d)) + ((p | 28) + (p ^ q));
+  b = ((p | c) * (d ^ c)) + ((p ^ q) + (q - 85));
+  if(d < c){
+    b = ((a | 98) * (q & c)) | ((a + c) + (d | a));
+  }else{
+    b = ((b + 96) | (c - p)) - ((b & a) + (d - p));
+  }
+  return a + b + c + d;
+}
+
+int func88(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 21;
+  d = 83;
+  d = ((q - c) ^ (c ^ c)) ^ ((d | a) | (a - 16));
+  d = ((d | c) * (q * d)) + ((b ^ d) & (q + b));
+  b = ((p & p) - (c - d)) | ((q ^ c) - (p ^ q));
+  c = ((d & b) ^ (c - 71)) ^ ((b & d) ^ (d - p));
+  if(d < q){
+    c = ((b & 33) - (d & a)) + ((c * a) * (d | 7));
+  }else{
+    c = ((a * q) ^ (d + c)) ^ ((q ^ p) - (c | d));
+  }
+  d = ((c + c) ^ (p ^ 51)) + ((b & d) * (c | b));
+  for(i = 0; i < 25; i++){
+    b = ((a - 62) & (c - p)) * ((q | a) & (q | q));
+  }
+  c = ((b & c) & (p & d)) * ((b + 47) - (d + d));
+  d = ((q ^ 22) + (q * q)) ^ ((a * 95) ^ (b ^ 45));
+  if(d < p){
+    b = ((d + 67) | (a - q)) - ((p + 11) & (c + p));
+  }else{
+    c = ((d & 8) | (c + a)) + ((c * q) & (d * c));
+  }
+  c = ((c - c) ^ (q ^ b)) & ((p - a) ^ (c & q));
+  b = ((q ^ p) * (p | a)) | ((c ^ 36) ^ (c * b));
+  b = ((d ^ c) ^ (b & d)) - ((c ^ q) + (q | q));
+  for(i = 0; i < 48; i++){
+    d = ((b ^ d) | (c ^ d)) & ((a - c) + (b ^ b));
+  }
+  if(d < d){
+    c = ((a & c) & (a & c)) * ((a + 99) ^ (q & 41));
+  }else{
+    c = ((c & q) * (q | c)) & ((a * 66) ^ (p * b));
+  }
+  a = ((p & p) ^ (q + a)) | ((b * a) & (a + d));
+  d = ((a + q) ^ (d * 53)) | ((c | p) | (q ^ 32));
+  c = ((d & c) - (b & b)) ^ ((d - q) * (b + q));
+  a = ((b - d) - (b & q)) | ((q & b) ^ (a * d));
+  if(c < b){
+    a = ((b - 47) + (a | b)) * ((d + d) + (p & c));
+  }else{
+    b = ((a - c) | (b & a)) - ((p + a) * (c ^ p));
+  }
+  for(i = 0; i < 20; i++){
+    c = ((q * a) - (q + 2)) ^ ((q | p) + (d + 15));
+  }
+  b = ((d - b) - (b + 88)) + ((b ^ a) * (q * p));
+  d = ((a - 13) - (q + a)) | ((p | b) * (p * q));
+  d = ((q + c) & (p + q)) | ((d * q) | (p - 69));
+  if(d < q){
+    d = ((d * d) * (d - q)) * ((q - a) & (p | c));
+  }else{
+    d = ((p | p) ^ (d + 99)) + ((a + q) + (d + a));
+  }
+  a = ((b - 38) * (p * a)) - ((a ^ 99) ^ (c | p));
+  b = ((p & 42) - (b & a)) & ((b * q) & (b & d));
+  for(i = 0; i < 26; i++){
+    b = ((q ^ 72) + (c ^ a)) * ((p ^ p) & (q + c));
+  }
+  b = ((p | c) + (a | 19)) - ((c ^ b) | (p | a));
+  if(b < q){
+    b = ((p + q) & (c * c)) * ((b * c) ^ (a - c));
+  }else{
+    d = ((d - q) + (d + 43)) + ((a & a) & (c - 36));
+  }
+  a = ((d | d) + (d - p)) - ((c | 93) - (a & d));
+  c = ((b - a) & (a ^ a)) & ((c | b) ^ (a + d));
+  a = ((a | p) ^ (d | c)) + ((p | p) + (p * 53));
+  d = ((b | c) + (d | 19)) | ((a - q) ^ (a + a));
+  if(a < b){
+    b = ((p | d) * (c ^ a)) * ((p + p) | (c | 62));
+  }else{
+    d = ((p & q) & (a + d)) & ((d | 78) * (c - a));
+  }
+  a = ((b & a) + (c * d)) | ((b + 96) * (d ^ 87));
+  b = ((b & p) * (p & d)) | ((d + a) - (p + 16));
+  d = ((d * 87) + (b + a)) * ((p | b) | (d - a));
+  a = ((p ^ p) - (b * 78)) - ((c & 24) ^ (a ^ q));
+  if(b < q){
+    d = ((c * q) + (p & 89)) ^ ((p & 96) & (p ^ 69));
+  }else{
+    c = ((a * p) * (d * q)) ^ ((b | a) | (b - c));
+  }
+  return a + b + c + d;
+}
+
+int func89(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 21;
+  d = 20;
+  b = ((q * p) + (b | d)) ^ ((p | d) + (d & d));
+  d = ((d + p) | (d | d)) - ((p - d) * (p - d));
+  c = ((b + c) | (q | d)) ^ ((a * b) * (b + b));
+  c = ((b ^ 93) ^ (q - p)) & ((c & 4) ^ (p * d));
+  if(a < d){
+    a = ((d * b) * (d + 8)) | ((a & 74) ^ (p | 93));
+  }else{
+    d = ((p | 74) - (q - 86)) - ((a & 23) ^ (b | p));
+  }
+  b = ((d & 66) | (c ^ b)) + ((c & b) - (b ^ a));
+  for(i = 0; i < 16; i++){
+    b = ((p & b) + (p - 26)) & ((a | q) ^ (a ^ d));
+  }
+  d = ((q & c) + (b | d)) + ((p & d) * (d * a));
+  d = ((c ^ 56) - (q | b)) * ((q & 62) - (b | d));
+  if(b < q){
+    a = ((b + q) * (b * a)) * ((p * a) ^ (b + 45));
+  }else{
+    b = ((a ^ 47) ^ (a * a)) * ((b * 54) + (p - q));
+  }
+  c = ((c + b) & (b * d)) - ((p & d) | (a - a));
+  b = ((b & 27) + (p ^ 5)) * ((c - 57) + (b | 19));
+  c = ((a + a) * (b ^ d)) + ((q & a) + (c | q));
+  for(i = 0; i < 28; i++){
+    d = ((d & 25) ^ (b | d)) ^ ((p - b) * (p - 28));
+  }
+  if(d < b){
+    a = ((d | c) & (p - b)) | ((d - b) & (p | d));
+  }else{
+    b = ((b | a) + (c - a)) & ((d | c) | (d * b));
+  }
+  d = ((q ^ 79) - (a ^ p)) + ((d * p) & (d ^ a));
+  b = ((d | 51) ^ (a * p)) | ((c + 33) | (q ^ q));
+  d = ((p | a) + (d ^ p)) ^ ((a | p) & (d | a));
+  a = ((q * d) + (a & d)) ^ ((b | p) * (p | d));
+  if(a < 34){
+    a = ((p - 97) & (q - 98)) - ((p * b) + (q * d));
+  }else{
+    a = ((c & d) + (a ^ a)) ^ ((b + a) | (q | q));
+  }
+  for(i = 0; i < 10; i++){
+    a = ((b | p) * (q - 74)) | ((p - a) - (d | b));
+  }
+  b = ((a | c) ^ (q - p)) ^ ((c & q) & (a & a));
+  d = ((p | 9) * (c - c)) & ((q & p) | (a + 36));
+  a = ((q | p) + (a - p)) | ((a | 7) & (b & p));
+  if(a < b){
+    a = ((a * a) & (q & 55)) * ((p + d) | (a - c));
+  }else{
+    a = ((d | c) & (c * 15)) | ((c * q) - (d ^ 57));
+  }
+  b = ((p + c) - (a ^ 88)) & ((b ^ a) - (b | b));
+  a = ((c - 45) | (q | 40)) - ((d | d) & (c + b));
+  for(i = 0; i < 29; i++){
+    d = ((b & a) & (a | p)) + ((c & b) | (c + a));
+  }
+  d = ((p + q) * (c & p)) & ((a ^ p) ^ (a & d));
+  if(a < d){
+    b = ((c & 78) + (q | p)) ^ ((c & c) & (d ^ d));
+  }else{
+    d = ((c ^ 89) | (c - 55)) | ((c * a) ^ (d + q));
+  }
+  d = ((q * c) * (p & a)) * ((q - b) * (q & q));
+  c = ((c ^ q) - (b - 98)) ^ ((d ^ q) + (p | q));
+  b = ((p * q) | (b ^ p)) & ((a + a) & (d ^ 30));
+  b = ((q & q) ^ (a - p)) - ((c - 35) * (a | a));
+  if(d < 86){
+    b = ((a * 41) | (p | a)) + ((a | p) * (d ^ 33));
+  }else{
+    c = ((p - 72) ^ (d & p)) ^ ((b | d) | (p | d));
+  }
+  c = ((p | b) ^ (a ^ q)) * ((p | b) * (d + c));
+  a = ((a * 94) + (b - q)) ^ ((b & c) * (c - b));
+  c = ((a + d) | (p - b)) | ((d * c) + (c | c));
+  a = ((b | p) * (d - p)) & ((d | 28) + (d | 75));
+  if(a < b){
+    d = ((p - a) & (p & q)) * ((q & a) * (a - 50));
+  }else{
+    b = ((p - b) | (a & 42)) | ((q ^ 67) - (a * b));
+  }
+  return a + b + c + d;
+}
+
+int func90(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 32;
+  d = 77;
+  d = ((p - q) - (b - p)) | ((p & 24) & (p * a));
+  a = ((d ^ q) - (q * c)) + ((a ^ a) * (p * b));
+  d = ((q | d) ^ (d * 4)) | ((p & c) | (a ^ d));
+  b = ((d ^ 84) - (q ^ b)) ^ ((b + b) * (q | c));
+  if(c < c){
+    b = ((q & 39) ^ (d & 48)) - ((a | a) * (q * d));
+  }else{
+    a = ((a + a) * (a ^ a)) - ((c - p) - (a ^ 67));
+  }
+  d = ((b & a) - (b * 52)) ^ ((d - 7) + (p + b));
+  for(i = 0; i < 15; i++){
+    a = ((c - c) | (q - q)) | ((p - a) + (d + a));
+  }
+  d = ((q | d) - (d * d)) | ((q | d) + (p - p));
+  d = ((d | c) & (d ^ p)) | ((b + b) - (q - b));
+  if(d < q){
+    a = ((d * d) * (c * q)) ^ ((q * p) - (c | p));
+  }else{
+    b = ((p | a) | (p - 96)) & ((p + a) ^ (c * q));
+  }
+  a = ((q + d) | (p + d)) & ((b * c) ^ (p - a));
+  a = ((p - a) | (b - q)) | ((a & b) - (a - 37));
+  a = ((q | a) - (d | c)) ^ ((p & 49) + (c | q));
+  for(i = 0; i < 42; i++){
+    d = ((q + q) + (p - 62)) + ((p * a) | (c - 61));
+  }
+  if(c < a){
+    d = ((p ^ 77) & (q + a)) & ((b - b) ^ (q ^ 61));
+  }else{
+    b = ((p * a) + (a ^ c)) * ((b + 42) + (a ^ b));
+  }
+  d = ((d & 19) | (b - 13)) - ((a - p) & (p & b));
+  d = ((q | 71) - (a ^ c)) ^ ((d ^ c) * (d * 55));
+  b = ((b ^ 47) ^ (d + 11)) ^ ((q * b) + (c * b));
+  c = ((c | c) + (b - p)) - ((p | d) + (a + 22));
+  if(a < b){
+    a = ((d & p) | (a - d)) + ((c + q) + (p + 69));
+  }else{
+    b = ((a & b) ^ (c * 79)) ^ ((q - 84) - (d + p));
+  }
+  for(i = 0; i < 4; i++){
+    d = ((p | c) + (b + d)) & ((d * b) - (a ^ 76));
+  }
+  a = ((d | 69) | (b - 38)) | ((p - 25) & (b & q));
+  d = ((a * d) & (b ^ a)) + ((d - d) & (a ^ b));
+  a = ((p | q) & (a * q)) & ((c * p) - (q - p));
+  if(b < q){
+    c = ((d + d) & (p + q)) | ((c - 93) | (a | p));
+  }else{
+    a = ((d ^ 79) | (a ^ a)) - ((a + d) & (d * c));
+  }
+  d = ((a * d) - (c - c)) * ((a | a) & (b & q));
+  d = ((d ^ b) + (a & 25)) - ((d | p) * (d - a));
+  for(i = 0; i < 45; i++){
+    b = ((b + 83) ^ (a | q)) | ((p * q) - (q | q));
+  }
+  b = ((c ^ b) + (a ^ q)) - ((d ^ b) - (a & p));
+  if(a < a){
+    c = ((q - c) - (b & b)) & ((a + q) + (p * b));
+  }else{
+    b = ((q | d) + (b - a)) + ((d ^ p) - (a ^ 8));
+  }
+  d = ((p | 15) & (p * 75)) & ((c * p) - (p ^ c));
+  c = ((q + 4) & (q | 45)) ^ ((b + c) - (d | 95));
+  a = ((c ^ 2) & (a * c)) + ((a ^ 27) * (d & 91));
+  b = ((a + q) | (d - c)) * ((b - d) & (p | c));
+  if(b < 90){
+    c = ((p * p) + (a + c)) & ((b & b) + (c ^ a));
+  }else{
+    d = ((q | c) - (p * 17)) * ((a + d) + (p ^ 86));
+  }
+  d = ((c * q) * (d * c)) * ((d * a) - (q * 6));
+  c = ((d | q) + (a | p)) & ((d ^ q) & (d | a));
+  d = ((p ^ p) + (c - c)) + ((b & c) - (b & 33));
+  b = ((c * d) | (a * c)) & ((q + q) & (a - p));
+  if(a < q){
+    c = ((b + d) | (d * b)) & ((b & 99) | (c - d));
+  }else{
+    c = ((p + b) * (q * 22)) + ((q ^ 53) + (c & c));
+  }
+  return a + b + c + d;
+}
+
+int func91(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 81;
+  d = 29;
+  c = ((c & 37) | (q * p)) | ((b * p) | (a ^ 57));
+  d = ((d + 46) + (a | c)) * ((b & p) | (d - 79));
+  a = ((d + p) ^ (a - c)) * ((b * 55) * (b ^ q));
+  b = ((a & 43) - (a - a)) + ((b * 94) - (c ^ c));
+  if(c < c){
+    b = ((a + c) - (d + a)) & ((p & d) + (p & b));
+  }else{
+    c = ((c & q) - (d ^ q)) ^ ((p + d) & (q + b));
+  }
+  c = ((d ^ a) * (c ^ c)) + ((a & 54) - (q ^ a));
+  for(i = 0; i < 9; i++){
+    c = ((q & 5) | (p & 98)) | ((d - d) + (a + p));
+  }
+  b = ((a ^ q) * (c | q)) ^ ((a + b) * (q ^ b));
+  a = ((p - p) ^ (q ^ c)) ^ ((p * p) + (d + b));
+  if(a < p){
+    c = ((c | d) & (p | a)) & ((d | b) & (q + q));
+  }else{
+    b = ((q ^ d) & (a - a)) - ((q * d) * (b & p));
+  }
+  a = ((p * d) ^ (c * a)) | ((d * d) * (c - q));
+  b = ((a * p) & (d * 30)) & ((c & b) - (p + b));
+  b = ((q ^ a) + (b * q)) & ((c | c) ^ (p - q));
+  for(i = 0; i < 35; i++){
+    a = ((a - 2) - (a ^ 63)) * ((p * 96) * (p + 84));
+  }
+  if(d < p){
+    b = ((c | 50) * (p | c)) | ((c * c) * (p + p));
+  }else{
+    b = ((p | 47) + (c & 89)) | ((p + a) & (b | a));
+  }
+  d = ((q + c) - (a ^ c)) + ((q + q) & (b & a));
+  d = ((b | p) & (p | p)) ^ ((q * p) | (c - 26));
+  c = ((q * d) | (b * q)) & ((d ^ p) & (d + c));
+  b = ((p & b) * (q & 88)) ^ ((a + b) ^ (d * d));
+  if(c < q){
+    d = ((p + q) | (b * 22)) | ((c - p) * (b ^ b));
+  }else{
+    a = ((a * a) + (c | 32)) | ((b & 56) - (q * 61));
+  }
+  for(i = 0; i < 19; i++){
+    a = ((a & p) | (d | a)) - ((q | a) & (d - q));
+  }
+  b = ((q + p) & (b & d)) & ((c - c) - (p * c));
+  b = ((p | c) ^ (b + b)) - ((d & c) ^ (q * d));
+  d = ((a & 2) + (p & 32)) ^ ((q - d) - (d & a));
+  if(a < 63){
+    b = ((a + 73) + (a | 27)) | ((q | c) * (d + c));
+  }else{
+    d = ((b | a) & (b + q)) | ((b | c) ^ (p | p));
+  }
+  d = ((q + 47) + (p & q)) + ((q & 92) | (b + q));
+  d = ((q * a) * (q ^ d)) * ((p - b) + (c | a));
+  for(i = 0; i < 6; i++){
+    c = ((q & p) - (q + b)) * ((c + p) & (d ^ 60));
+  }
+  c = ((a - a) & (c + 65)) - ((b & a) ^ (a * a));
+  if(d < c){
+    d = ((c | d) - (q ^ p)) | ((b & 60) & (c - p));
+  }else{
+    b = ((c - 22) | (a | b)) + ((q ^ q) + (p & c));
+  }
+  b = ((a & a) + (p - c)) * ((a & 63) | (c * d));
+  b = ((a + a) ^ (p + b)) ^ ((b | b) - (q * p));
+  b = ((a & a) * (b * c)) ^ ((p | p) * (b - d));
+  b = ((p & 38) | (b ^ 64)) + ((b & p) ^ (a & a));
+  if(b < 57){
+    b = ((p - a) ^ (a * a)) & ((a & b) ^ (b ^ b));
+  }else{
+    d = ((b - c) & (c - 53)) - ((c & q) ^ (d | q));
+  }
+  c = ((p - c) & (d ^ a)) - ((d | a) - (q | 43));
+  b = ((d + 91) + (d | b)) | ((b * d) + (p - c));
+  d = ((q & p) * (p + q)) * ((q * c) * (c & p));
+  b = ((q - q) + (c - a)) ^ ((a | d) ^ (p & 77));
+  if(b < p){
+    a = ((c * b) | (p + 93)) & ((d & c) * (c & 46));
+  }else{
+    a = ((p & b) & (b * a)) ^ ((p - q) & (p - b));
+  }
+  return a + b + c + d;
+}
+
+int func92(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 34;
+  d = 40;
+  a = ((p & q) | (c & 25)) | ((p | d) - (d | a));
+  b = ((a | q) + (d + c)) ^ ((q + 73) & (a | b));
+  a = ((b & a) ^ (d + p)) & ((d * c) & (q - d));
+  a = ((d - a) + (q ^ d)) ^ ((b ^ 54) & (a | c));
+  if(d < c){
+    a = ((b * 1) & (a + 38)) + ((a * a) + (b ^ 79));
+  }else{
+    a = ((q ^ p) * (q | q)) & ((d + c) * (d ^ b));
+  }
+  a = ((b ^ 37) * (p - q)) | ((q ^ p) - (b ^ c));
+  for(i = 0; i < 9; i++){
+    a = ((a * a) - (b * q)) * ((c + c) & (d * 47));
+  }
+  a = ((b | p) & (b - 41)) ^ ((a ^ d) * (c ^ c));
+  b = ((c ^ 93) | (b - a)) - ((p | q) | (c | a));
+  if(c < 76){
+    b = ((c * a) & (p & p)) + ((a * 12) | (d & 12));
+  }else{
+    a = ((d + d) + (a - p)) & ((c & 82) - (p | 65));
+  }
+  c = ((q & 20) - (c | 86)) & ((d + q) * (p ^ 73));
+  b = ((b & c) + (b & 17)) & ((a & q) & (d & 30));
+  b = ((a | q) + (d + q)) - ((q - c) | (b * d));
+  for(i = 0; i < 6; i++){
+    c = ((b ^ q) ^ (p + q)) * ((b - a) + (c - a));
+  }
+  if(a < a){
+    b = ((b - c) * (p + q)) ^ ((a + p) & (c ^ b));
+  }else{
+    b = ((b * q) | (a - 69)) + ((a + d) - (d + p));
+  }
+  d = ((a - a) - (q | q)) * ((a - b) | (p & 57));
+  d = ((c ^ a) & (c & b)) * ((a & a) - (b ^ c));
+  a = ((c & q) * (b & q)) * ((d ^ 4) - (c | c));
+  b = ((q | 72) | (a ^ d)) | ((p * 3) & (p * q));
+  if(a < p){
+    b = ((p ^ p) + (q ^ p)) + ((p - a) ^ (q & d));
+  }else{
+    d = ((q * p) - (b | 17)) * ((b + 46) + (d + p));
+  }
+  for(i = 0; i < 17; i++){
+    c = ((c ^ p) & (q - q)) & ((a ^ p) - (a + q));
+  }
+  b = ((q | p) * (d * p)) & ((p | 45) + (b * c));
+  c = ((a | 12) - (p ^ 46)) | ((q - c) ^ (p | d));
+  c = ((a * p) & (d + a)) * ((a - 72) * (d | p));
+  if(b < b){
+    b = ((d & 71) * (a - b)) | ((q + 21) - (p - 79));
+  }else{
+    d = ((b - a) * (q ^ d)) - ((c ^ a) * (a - c));
+  }
+  a = ((b & p) & (d | c)) - ((a | a) * (c - a));
+  a = ((b & c) & (d + q)) & ((q ^ b) - (c + 55));
+  for(i = 0; i < 21; i++){
+    a = ((q ^ c) + (a & q)) | ((b + a) + (d | 7));
+  }
+  b = ((c ^ d) * (q | 7)) + ((d + 61) * (a | c));
+  if(b < q){
+    c = ((q + 99) - (b & 74)) * ((d * d) + (c | p));
+  }else{
+    b = ((d + c) - (b - q)) & ((q ^ c) * (d * 76));
+  }
+  b = ((p + d) * (b + p)) + ((b - 78) ^ (q * 63));
+  a = ((b & 68) + (q * 56)) * ((b | a) + (b + d));
+  d = ((a & q) * (q | b)) ^ ((c - 69) - (p & c));
+  d = ((p + b) | (d ^ b)) ^ ((q ^ 80) - (a - d));
+  if(a < b){
+    a = ((b ^ d) | (d - q)) | ((c | c) ^ (d + d));
+  }else{
+    d = ((p * q) * (b | q)) ^ ((p + b) | (p * p));
+  }
+  a = ((d ^ q) * (a | a)) | ((d * 93) - (c * 69));
+  a = ((q & 54) - (q | q)) | ((q ^ b) + (d - c));
+  b = ((c | 80) - (d | a)) ^ ((b + b) + (p | q));
+  d = ((p & d) * (q ^ 79)) ^ ((p + 12) * (b + a));
+  if(d < p){
+    d = ((b & a) ^ (d & 17)) ^ ((b - 70) | (b | 99));
+  }else{
+    a = ((a & 68) - (a * 70)) & ((p * a) & (c & d));
+  }
+  return a + b + c + d;
+}
+
+int func93(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 79;
+  d = 23;
+  b = ((q & a) * (a + 37)) | ((b & 38) ^ (p & q));
+  c = ((d ^ d) ^ (b + q)) * ((d ^ a) & (c + d));
+  d = ((d & q) | (c * q)) | ((c * 11) ^ (a | c));
+  c = ((q | c) ^ (d & c)) & ((a ^ 5) + (d & b));
+  if(b < q){
+    b = ((q + 1) - (d ^ p)) ^ ((b | d) & (b | b));
+  }else{
+    c = ((q - p) * (a | p)) * ((d & q) * (d ^ p));
+  }
+  c = ((q & c) ^ (a | d)) & ((b + p) - (a + c));
+  for(i = 0; i < 34; i++){
+    a = ((p & d) * (c ^ q)) - ((q | 90) ^ (d & a));
+  }
+  a = ((b + a) * (b + a)) ^ ((c | b) + (c & p));
+  b = ((b & b) ^ (p | p)) + ((p + c) & (a | a));
+  if(a < b){
+    d = ((b + 50) - (b * c)) ^ ((a & a) | (c ^ d));
+  }else{
+    d = ((c | d) * (q + p)) ^ ((a ^ p) * (c - a));
+  }
+  d = ((d + 97) + (q & 87)) - ((d | b) - (q ^ q));
+  a = ((p * q) + (c & d)) & ((c ^ q) + (c ^ p));
+  b = ((a ^ 9) ^ (d & 33)) - ((c - d) & (a + q));
+  for(i = 0; i < 9; i++){
+    d = ((a | 19) * (a - q)) & ((p & p) | (d | q));
+  }
+  if(c < q){
+    a = ((q | a) - (c ^ a)) | ((a + 80) - (b + 32));
+  }else{
+    a = ((c & 98) ^ (q * 29)) ^ ((c | 77) | (c & 13));
+  }
+  a = ((p - b) & (b & b)) & ((b ^ 6) * (p + 55));
+  a = ((d | p) & (q ^ p)) ^ ((d * 85) ^ (a * d));
+  c = ((q + 23) + (p ^ 77)) + ((a ^ 78) ^ (p + a));
+  d = ((c + b) * (b & p)) ^ ((q & a) + (b - q));
+  if(a < b){
+    a = ((a & 43) | (a | p)) & ((p | d) & (p + d));
+  }else{
+    a = ((a & p) | (a | p)) * ((a + 47) | (b + c));
+  }
+  for(i = 0; i < 38; i++){
+    d = ((c | p) + (c & d)) | ((c | q) * (a | 47));
+  }
+  b = ((b | 92) | (d * a)) * ((b ^ 7) | (b * q));
+  c = ((q * a) * (p - c)) * ((q * 8) & (q & 31));
+  b = ((p + 72) ^ (c & 26)) * ((d + c) & (b + 24));
+  if(c < p){
+    b = ((q ^ p) + (q + q)) * ((c + 82) | (b + c));
+  }else{
+    c = ((a * d) + (c ^ b)) | ((a | q) & (b ^ c));
+  }
+  a = ((b + d) & (d - c)) | ((q & 59) ^ (c * d));
+  c = ((c - 5) & (d * q)) * ((c & c) * (p & a));
+  for(i = 0; i < 48; i++){
+    b = ((d ^ p) | (c + 1)) * ((b * 68) | (d ^ a));
+  }
+  a = ((c - b) - (q - 74)) | ((d + c) ^ (b + a));
+  if(d < 59){
+    d = ((q ^ c) * (q | 40)) & ((d * a) + (a * c));
+  }else{
+    d = ((q * d) & (d | c)) * ((b + 99) - (p - c));
+  }
+  d = ((b ^ 25) | (d ^ b)) + ((a | a) | (c * d));
+  a = ((b + 11) ^ (c - b)) + ((q - p) + (p | p));
+  d = ((a - 61) | (c + q)) ^ ((p ^ d) + (q * b));
+  b = ((b & c) - (b ^ 96)) & ((a & c) * (p ^ a));
+  if(c < 78){
+    b = ((b * b) * (a | 69)) - ((b & p) + (a | 35));
+  }else{
+    d = ((b | 97) + (q ^ q)) * ((q + c) | (b * 18));
+  }
+  a = ((d | q) - (d & a)) - ((c + 99) - (d | b));
+  a = ((b ^ b) ^ (b & p)) | ((b * a) & (a - a));
+  b = ((a * a) - (c & q)) + ((b + c) & (b & p));
+  d = ((d - a) & (d * c)) - ((p ^ 56) & (c ^ c));
+  if(b < a){
+    b = ((p - p) * (d ^ c)) ^ ((a & d) - (p ^ a));
+  }else{
+    d = ((d * d) - (p | a)) - ((a - c) & (p | 8));
+  }
+  return a + b + c + d;
+}
+
+int func94(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 66;
+  d = 93;
+  d = ((d ^ q) ^ (a | c)) + ((p | 65) | (a - b));
+  a = ((p | p) & (b - 49)) - ((c ^ q) - (c + p));
+  a = ((q | 51) - (c - p)) - ((c ^ b) + (p & q));
+  c = ((a - b) - (b | a)) | ((b & 74) | (q | b));
+  if(a < a){
+    c = ((b * d) - (c * d)) | ((a + a) - (b + p));
+  }else{
+    d = ((b * p) - (p & d)) ^ ((b ^ d) * (c & p));
+  }
+  b = ((b * q) | (b - 64)) + ((q | d) + (d ^ b));
+  for(i = 0; i < 31; i++){
+    a = ((b + 64) | (b * a)) * ((d | d) * (q | c));
+  }
+  a = ((b + d) * (a - 4)) - ((a * b) ^ (d ^ d));
+  a = ((a ^ d) ^ (q * p)) + ((p * 98) | (a * p));
+  if(d < p){
+    a = ((d | 98) & (a ^ 91)) * ((a - a) - (p ^ a));
+  }else{
+    c = ((b & p) | (a + c)) | ((b * p) - (q - a));
+  }
+  d = ((q | a) - (p & b)) + ((d - p) | (a + 8));
+  a = ((d * d) ^ (q ^ d)) & ((b + 88) | (b - q));
+  d = ((q ^ q) & (q - 98)) + ((c & c) ^ (a - q));
+  for(i = 0; i < 44; i++){
+    b = ((b * d) | (a + a)) ^ ((q * b) | (q & 87));
+  }
+  if(a < c){
+    b = ((d | c) | (d * b)) & ((p ^ b) | (a * d));
+  }else{
+    b = ((d - 93) * (b & c)) | ((b | p) * (c - p));
+  }
+  b = ((b - q) + (b - b)) - ((p + d) * (a | a));
+  a = ((c | 38) * (c + c)) + ((d | q) * (d - d));
+  c = ((p - b) - (c * q)) | ((d & b) & (p - q));
+  b = ((p | 42) ^ (q - a)) ^ ((c ^ b) + (q ^ q));
+  if(b < a){
+    c = ((c * a) + (d * 35)) | ((b * a) * (p + q));
+  }else{
+    b = ((c & d) | (q | b)) & ((a - p) | (p | 37));
+  }
+  for(i = 0; i < 17; i++){
+    c = ((q ^ 99) & (b * 62)) & ((a * q) - (d ^ b));
+  }
+  b = ((q | b) | (q - 59)) - ((c * 44) | (d & b));
+  a = ((b & d) | (b + a)) & ((a & c) * (q - 1));
+  d = ((b | b) & (c | d)) - ((a ^ d) ^ (p & b));
+  if(b < q){
+    a = ((d & q) + (p & c)) | ((a - p) - (b * q));
+  }else{
+    d = ((a - d) | (d ^ 86)) - ((c | p) ^ (a - p));
+  }
+  b = ((a - q) - (p + p)) | ((a | 93) & (p - b));
+  b = ((d * b) ^ (d ^ p)) & ((q + 95) & (b - p));
+  for(i = 0; i < 38; i++){
+    d = ((p + b) * (c ^ d)) & ((p & b) ^ (q & 22));
+  }
+  d = ((c + q) | (a & b)) ^ ((p * c) & (a & c));
+  if(a < d){
+    b = ((d - a) - (c - 91)) * ((c * c) | (q ^ 56));
+  }else{
+    b = ((q | p) * (p + a)) & ((d * q) | (d & a));
+  }
+  a = ((q & 75) * (a * d)) | ((c * b) ^ (q ^ 54));
+  c = ((b - q) | (a * p)) ^ ((q | d) | (q | b));
+  a = ((p - p) * (p & p)) | ((a | a) & (q | q));
+  b = ((q - q) | (p ^ b)) - ((d ^ a) & (a ^ p));
+  if(c < a){
+    a = ((a - 13) + (b | q)) - ((d ^ c) ^ (b * 95));
+  }else{
+    d = ((b ^ d) & (a ^ q)) + ((c ^ d) & (d & q));
+  }
+  c = ((b - a) ^ (q + b)) ^ ((b - d) | (c | p));
+  c = ((b & a) | (q ^ q)) + ((b + b) * (c + 3));
+  b = ((b * p) - (d - q)) | ((p * q) | (p | b));
+  b = ((q ^ 35) | (d - 33)) - ((c | 1) + (d | d));
+  if(c < q){
+    a = ((d - q) * (a + p)) | ((d & 92) & (b & c));
+  }else{
+    d = ((c - 64) * (c & c)) | ((d & q) * (b + 28));
+  }
+  return a + b + c + d;
+}
+
+int func95(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 43;
+  d = 52;
+  c = ((q & q) ^ (p & b)) - ((b | c) + (c * a));
+  c = ((b ^ q) & (d - d)) | ((p & b) | (a & 18));
+  c = ((q * 36) + (d * d)) * ((p & p) | (p & a));
+  d = ((a | a) + (p * 46)) * ((b & 99) - (q ^ c));
+  if(c < c){
+    c = ((q + a) & (b * 6)) - ((b ^ c) + (d ^ d));
+  }else{
+    c = ((q ^ d) ^ (c | d)) & ((a * a) ^ (b & q));
+  }
+  b = ((p & b) | (d | c)) & ((p + 15) | (b - d));
+  for(i = 0; i < 19; i++){
+    b = ((a ^ a) | (q * b)) | ((q & c) - (q - a));
+  }
+  b = ((c - 16) - (q | b)) * ((a & c) - (b - d));
+  a = ((q - 96) - (q ^ b)) * ((a - 63) | (q - a));
+  if(d < 64){
+    b = ((q + c) ^ (a & d)) * ((q | b) * (b | a));
+  }else{
+    b = ((q ^ q) ^ (c * d)) ^ ((q | 23) & (b * c));
+  }
+  a = ((c | b) & (a ^ q)) + ((p - 17) | (p ^ a));
+  d = ((b & b) | (c - 37)) & ((a | q) | (p & b));
+  c = ((d & q) + (a + q)) ^ ((d | d) ^ (q ^ d));
+  for(i = 0; i < 43; i++){
+    a = ((q & 7) ^ (p + c)) & ((d + 77) - (b * p));
+  }
+  if(a < p){
+    a = ((c & b) + (b | 52)) ^ ((q + a) & (p ^ b));
+  }else{
+    d = ((a & c) | (b ^ q)) * ((b + c) + (b ^ b));
+  }
+  a = ((c * 22) ^ (p & p)) * ((q + a) | (q ^ b));
+  c = ((a * b) | (p ^ b)) * ((q & p) + (p | 42));
+  b = ((p ^ 62) | (a * d)) | ((q | 12) * (a - c));
+  a = ((c | c) & (a * b)) - ((q | 26) & (d ^ p));
+  if(d < 95){
+    b = ((a ^ b) + (a + a)) ^ ((a & b) & (b - b));
+  }else{
+    a = ((b + a) ^ (p - q)) + ((q + b) - (a | b));
+  }
+  for(i = 0; i < 12; i++){
+    a = ((q * q) | (p & b)) ^ ((c - c) + (p | d));
+  }
+  d = ((b * p) * (d + q)) ^ ((q * a) ^ (q * d));
+  b = ((q + q) + (a + p)) * ((c | a) ^ (q | a));
+  b = ((c - p) - (p - a)) & ((p - c) | (q | b));
+  if(d < q){
+    a = ((d ^ d) & (a & c)) * ((b | q) - (p * p));
+  }else{
+    b = ((b & a) + (q ^ b)) ^ ((d + c) - (d & 79));
+  }
+  c = ((d & q) ^ (c - a)) - ((p | c) * (d & p));
+  a = ((q - 26) * (b + p)) * ((c ^ b) + (p ^ p));
+  for(i = 0; i < 37; i++){
+    b = ((d + q) | (q + c)) + ((q * a) ^ (b * 31));
+  }
+  d = ((c ^ p) * (d + 20)) + ((d - a) + (p | b));
+  if(a < b){
+    b = ((q | 31) | (p ^ q)) | ((d & c) * (p + c));
+  }else{
+    c = ((a ^ d) & (p * c)) & ((b & c) ^ (d * p));
+  }
+  b = ((c * b) + (a & 7)) ^ ((d | p) | (d | 46));
+  c = ((c | d) * (a | c)) & ((a ^ q) * (p ^ q));
+  b = ((q & q) * (p * q)) + ((p + c) * (p ^ 22));
+  c = ((a * c) + (q * c)) & ((c + p) * (c | c));
+  if(b < 10){
+    c = ((d & 26) ^ (a ^ 79)) * ((q * 22) | (d - c));
+  }else{
+    b = ((b | a) + (q - b)) | ((c * d) + (a ^ p));
+  }
+  b = ((c | a) + (c - b)) & ((d ^ b) ^ (q + c));
+  a = ((a ^ a) + (q + q)) | ((b ^ b) - (q ^ q));
+  c = ((d * a) ^ (p + 73)) * ((c ^ 1) * (d * a));
+  d = ((a ^ d) | (a & a)) | ((a * 42) + (p + b));
+  if(a < q){
+    c = ((a * q) * (a ^ d)) + ((b & d) * (a * d));
+  }else{
+    a = ((a & 59) - (p | 45)) ^ ((p ^ 94) * (a | p));
+  }
+  return a + b + c + d;
+}
+
+int func96(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 93;
+  d = 77;
+  a = ((d * p) & (a & a)) & ((p | d) & (b ^ b));
+  a = ((c + c) + (c + 19)) ^ ((c | b) & (c + 11));
+  b = ((p - q) & (a | c)) | ((c ^ d) * (d * p));
+  a = ((d * d) | (a * p)) ^ ((p + c) ^ (q ^ p));
+  if(c < c){
+    a = ((a + q) + (p + d)) ^ ((b - 81) & (c | p));
+  }else{
+    a = ((p + p) ^ (a | 9)) * ((a + c) * (p - 63));
+  }
+  d = ((a * c) + (a ^ 24)) & ((p + c) ^ (a - q));
+  for(i = 0; i < 44; i++){
+    a = ((a ^ q) & (d * a)) - ((p * a) * (c | d));
+  }
+  d = ((c * 71) * (c ^ 99)) ^ ((b + c) | (p + a));
+  c = ((p + 50) + (d - 88)) ^ ((c | 84) & (q | 61));
+  if(d < c){
+    c = ((d + 20) | (q & a)) & ((b - c) + (c * d));
+  }else{
+    a = ((c | d) ^ (q + c)) & ((d & b) + (b ^ q));
+  }
+  a = ((p & b) & (a - d)) + ((c & 79) & (q | 56));
+  a = ((a & d) - (p ^ b)) | ((q & 12) & (d & b));
+  b = ((p & b) | (b | 15)) & ((b + d) * (q | p));
+  for(i = 0; i < 2; i++){
+    b = ((p * 15) ^ (p & 52)) ^ ((p * q) | (a | c));
+  }
+  if(a < q){
+    d = ((q - 26) | (d ^ c)) * ((a + 7) + (a & 79));
+  }else{
+    a = ((a ^ b) - (c * q)) - ((b ^ q) + (p + 55));
+  }
+  c = ((c * b) - (a * p)) * ((d | 28) | (b + d));
+  a = ((b | q) & (p * d)) ^ ((c - p) + (a ^ b));
+  b = ((q * p) ^ (a + 85)) * ((b | 18) & (q | 16));
+  d = ((c + q) ^ (b & a)) & ((d & q) + (a ^ 31));
+  if(b < 90){
+    a = ((a & 42) - (a * 60)) * ((c | a) & (c ^ b));
+  }else{
+    b = ((d * d) - (d * d)) - ((d - p) - (c & 28));
+  }
+  for(i = 0; i < 23; i++){
+    c = ((d + 77) - (b ^ a)) & ((a - p) - (b & c));
+  }
+  d = ((a - p) & (q ^ a)) | ((b & d) - (d - q));
+  b = ((c - p) & (d ^ 22)) & ((d + 76) + (c + b));
+  c = ((a ^ d) * (b ^ c)) & ((p - b) - (c ^ 67));
+  if(c < a){
+    c = ((b * c) + (c & b)) ^ ((c & c) | (a | 79));
+  }else{
+    b = ((p + a) | (c ^ c)) | ((c & q) * (a + b));
+  }
+  b = ((q | b) + (p * p)) * ((b | b) + (a ^ d));
+  a = ((p * b) ^ (c - c)) * ((a - d) ^ (a + b));
+  for(i = 0; i < 14; i++){
+    c = ((p + d) - (c * 7)) ^ ((b - d) + (p ^ d));
+  }
+  a = ((b - q) - (b + 37)) & ((c ^ a) - (q & d));
+  if(b < d){
+    b = ((b + q) | (p - c)) * ((a | b) + (q | c));
+  }else{
+    c = ((d & c) & (p & 91)) * ((b + d) * (q | d));
+  }
+  c = ((d - a) & (a * 5)) | ((b | a) + (p & q));
+  c = ((b * 39) | (p * d)) * ((p + 63) & (q | p));
+  d = ((p ^ d) * (c & d)) ^ ((p ^ b) & (p * c));
+  b = ((c * q) * (a + 52)) ^ ((a & p) - (p + 97));
+  if(a < 96){
+    c = ((p ^ d) & (a + p)) & ((q | b) ^ (a * b));
+  }else{
+    b = ((c ^ c) ^ (b + 25)) & ((a | 66) + (d & 74));
+  }
+  b = ((a - d) | (b & c)) | ((q ^ 45) ^ (q ^ 42));
+  b = ((d ^ d) & (b - b)) & ((d + q) & (c | c));
+  a = ((c ^ b) ^ (d | a)) + ((q | a) - (p & d));
+  b = ((d & d) * (d & b)) * ((c ^ d) + (d ^ a));
+  if(c < 88){
+    c = ((q * p) ^ (a | p)) | ((p | q) ^ (p - c));
+  }else{
+    b = ((a - p) ^ (p - d)) - ((a & 99) - (c ^ 7));
+  }
+  return a + b + c + d;
+}
+
+int func97(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 92;
+  d = 59;
+  c = ((d & b) | (p * q)) + ((d - p) ^ (q * 64));
+  d = ((q + b) - (b ^ c)) - ((q & d) - (a & 14));
+  a = ((b | c) * (c * c)) - ((d - a) & (p - a));
+  b = ((q ^ p) - (c + q)) + ((q * a) & (b + 7));
+  if(a < b){
+    c = ((c * 97) & (c * q)) ^ ((p & q) - (p | 41));
+  }else{
+    a = ((d | d) - (b & a)) - ((c + q) + (d + q));
+  }
+  b = ((d * 87) | (a & d)) ^ ((b * a) | (d & d));
+  for(i = 0; i < 5; i++){
+    d = ((d + p) - (a + 24)) - ((q | 1) * (c * c));
+  }
+  c = ((d | 29) - (a + b)) & ((b - 69) + (c ^ p));
+  d = ((a * d) + (b * 6)) - ((d + 85) + (c ^ c));
+  if(a < q){
+    a = ((d * 19) | (d + a)) * ((d * c) * (d ^ p));
+  }else{
+    a = ((c * 97) | (a - q)) & ((b - a) | (d + b));
+  }
+  b = ((b & d) + (c * c)) - ((d * a) * (b ^ 12));
+  c = ((d ^ b) | (c - b)) | ((c | b) - (p - 42));
+  d = ((p | c) & (a + 32)) + ((p & c) | (c - 25));
+  for(i = 0; i < 35; i++){
+    a = ((a & b) & (c ^ c)) + ((a + 25) ^ (c ^ 18));
+  }
+  if(b < 13){
+    a = ((p | p) * (p + c)) - ((d + 20) - (p - c));
+  }else{
+    b = ((b + 58) ^ (c & p)) * ((b & b) + (c * a));
+  }
+  c = ((b ^ p) ^ (p & d)) ^ ((b + d) & (d | p));
+  a = ((c & c) + (c + 61)) & ((a * c) - (c & c));
+  b = ((p & p) | (q & d)) & ((b | b) + (c ^ q));
+  c = ((p & 77) ^ (q * 18)) - ((p + p) ^ (b - a));
+  if(a < 11){
+    d = ((a + 19) * (q ^ q)) + ((c * 76) + (c - b));
+  }else{
+    d = ((a * q) ^ (q | a)) + ((c & p) - (a + p));
+  }
+  for(i = 0; i < 33; i++){
+    b = ((q * c) ^ (c | d)) & ((d + q) + (d - c));
+  }
+  c = ((p + a) & (c ^ d)) + ((a * a) * (p | d));
+  b = ((c - p) - (c & d)) | ((q & p) + (c ^ c));
+  a = ((q ^ 24) ^ (q - p)) - ((b * a) - (q * c));
+  if(b < a){
+    d = ((d | b) ^ (c - q)) ^ ((d + 52) & (p & p));
+  }else{
+    d = ((q & c) * (d - b)) * ((c - 70) | (d + d));
+  }
+  b = ((b & b) * (c + c)) - ((q - b) * (c - b));
+  a = ((c ^ 69) | (b ^ q)) & ((a & a) + (c * 93));
+  for(i = 0; i < 16; i++){
+    a = ((p ^ c) | (d | a)) + ((a + p) | (p + 78));
+  }
+  b = ((a + d) - (a & q)) | ((c | a) + (p & p));
+  if(c < 89){
+    b = ((p + c) * (q ^ c)) + ((p + c) + (b * c));
+  }else{
+    b = ((b * a) & (b * p)) + ((d + q) - (b & 36));
+  }
+  c = ((p & p) & (c ^ 46)) - ((b + 33) ^ (q * q));
+  b = ((a ^ p) ^ (p * p)) & ((b | 56) + (c | p));
+  b = ((b | a) ^ (a | p)) & ((b - d) - (p & p));
+  a = ((a + 23) ^ (c + a)) ^ ((b ^ 79) | (b + q));
+  if(a < d){
+    a = ((c & a) ^ (b & p)) | ((c * d) * (b ^ b));
+  }else{
+    a = ((p + a) - (q | 31)) ^ ((c + 69) * (a & a));
+  }
+  a = ((p | 16) | (d ^ q)) + ((c ^ q) - (q + p));
+  a = ((c & p) ^ (c | a)) - ((a & b) * (p | p));
+  a = ((p + b) & (b | a)) | ((b | c) & (b - q));
+  b = ((b | 47) - (d - p)) | ((c - a) | (c * b));
+  if(b < b){
+    d = ((q & a) ^ (b + p)) * ((b + 22) - (d & d));
+  }else{
+    a = ((c + 10) * (d & c)) + ((q | p) + (q + p));
+  }
+  return a + b + c + d;
+}
+
+int func98(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 39;
+  d = ((b & 55) * (q + b)) | ((q & a) - (q & q));
+  d = ((c * d) ^ (a + 70)) + ((q * d) ^ (d | p));
+  a = ((p ^ d) & (d | 50)) | ((a & d) - (q & p));
+  d = ((b & p) | (d * a)) + ((d ^ p) ^ (b * a));
+  if(d < q){
+    d = ((b - 44) * (b & 20)) - ((q ^ p) | (p & 84));
+  }else{
+    a = ((q & a) ^ (p - c)) ^ ((a ^ a) - (q & q));
+  }
+  b = ((d ^ b) * (q + a)) * ((p + 73) | (d | p));
+  for(i = 0; i < 24; i++){
+    c = ((c & q) + (b | d)) | ((p * b) & (b * b));
+  }
+  c = ((q + c) & (c + d)) - ((p | p) + (b | b));
+  b = ((d ^ q) - (c | p)) * ((b & 1) + (c | d));
+  if(d < a){
+    a = ((d - 38) * (b & d)) & ((c ^ 95) * (c | c));
+  }else{
+    a = ((q + a) ^ (c ^ 28)) + ((p & 68) ^ (b & c));
+  }
+  b = ((b * c) & (a ^ a)) | ((a & 3) * (d - 38));
+  b = ((d - a) & (a + c)) + ((b - q) + (a & c));
+  b = ((q - b) - (p * 85)) * ((c + a) * (q * p));
+  for(i = 0; i < 39; i++){
+    b = ((p & p) * (b - 57)) * ((a - c) - (c - p));
+  }
+  if(c < a){
+    c = ((b ^ 73) & (b & p)) ^ ((c & 46) - (b | a));
+  }else{
+    c = ((d | 99) - (p & a)) & ((d * 73) & (b + a));
+  }
+  d = ((a * c) | (c & q)) * ((a + p) | (a - q));
+  b = ((q | 75) - (c - 61)) * ((a | 22) | (b ^ 52));
+  b = ((q | 44) - (c - a)) & ((d - a) - (q | 58));
+  c = ((c | c) & (d - p)) + ((d + c) - (d | 46));
+  if(a < d){
+    d = ((b + q) & (b * b)) - ((c + 87) + (c * a));
+  }else{
+    d = ((c * q) ^ (p + q)) | ((a ^ q) ^ (b ^ p));
+  }
+  for(i = 0; i < 41; i++){
+    b = ((c | d) - (c + d)) - ((a | c) & (a ^ q));
+  }
+  b = ((c - q) * (c ^ 30)) + ((b * p) + (c * c));
+  b = ((c - 1) | (a | b)) | ((q ^ d) ^ (q + p));
+  d = ((d | q) | (p ^ b)) + ((d | b) * (d ^ b));
+  if(c < 70){
+    c = ((q - a) - (q - q)) - ((d | 68) + (d ^ 2));
+  }else{
+    c = ((p & c) * (p & b)) + ((d | c) ^ (c | b));
+  }
+  b = ((q * c) + (c | p)) | ((d & b) * (a ^ b));
+  d = ((c * q) + (c * a)) ^ ((b - c) * (b * 53));
+  for(i = 0; i < 49; i++){
+    c = ((a | 95) | (q * q)) + ((p | 47) * (b + 92));
+  }
+  d = ((c ^ q) & (p - 96)) * ((d & p) - (d & d));
+  if(d < a){
+    d = ((q | d) * (q - c)) | ((a * d) | (d | q));
+  }else{
+    c = ((a & c) - (d + a)) + ((p * p) * (a + b));
+  }
+  a = ((b + d) + (c + d)) & ((b | d) + (a ^ a));
+  d = ((d | c) * (a ^ 98)) ^ ((d ^ p) | (c - d));
+  c = ((p - d) | (d * c)) | ((q ^ p) ^ (a * p));
+  b = ((c & p) & (q + b)) & ((d ^ p) & (q | 81));
+  if(a < a){
+    a = ((p | p) & (c * q)) + ((q | q) & (q * 96));
+  }else{
+    d = ((q & d) - (p * b)) - ((b & 51) - (d ^ b));
+  }
+  b = ((p & q) + (p + c)) - ((c * d) ^ (d | d));
+  c = ((q | 31) & (q * d)) * ((b & d) | (b | a));
+  c = ((a ^ 4) - (a + b)) * ((b - 60) ^ (d + 44));
+  d = ((c & d) - (c * q)) | ((a + 60) - (b & b));
+  if(d < c){
+    c = ((q + 21) & (a - b)) * ((c & a) ^ (b & q));
+  }else{
+    c = ((b - q) ^ (a + 20)) - ((a - b) ^ (d * p));
+  }
+  return a + b + c + d;
+}
+
+int func99(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 20;
+  d = 40;
+  a = ((a ^ c) | (p + a)) ^ ((d + c) ^ (d ^ a));
+  c = ((q + 65) & (a | 38)) - ((c + c) | (a - q));
+  a = ((c + c) - (c - 30)) ^ ((a & c) ^ (p - d));
+  c = ((d | c) + (q ^ c)) | ((d & q) ^ (d - c));
+  if(d < p){
+    b = ((d - c) | (d ^ a)) - ((a ^ a) | (p ^ d));
+  }else{
+    d = ((p | d) - (a + q)) ^ ((d | b) | (a + 12));
+  }
+  c = ((a * p) & (q - 3)) | ((b ^ 11) + (c & b));
+  for(i = 0; i < 13; i++){
+    b = ((c * c) & (p + c)) | ((q * a) | (q - a));
+  }
+  c = ((d ^ b) & (a * b)) | ((q - 21) + (a * 51));
+  c = ((b - b) ^ (p + q)) + ((c & d) ^ (c * a));
+  if(c < b){
+    c = ((p + q) ^ (b * a)) * ((c | 57) & (c + d));
+  }else{
+    b = ((c ^ q) ^ (a - p)) - ((c & c) - (b * p));
+  }
+  b = ((c | d) - (b ^ p)) & ((d + 69) | (b + 76));
+  a = ((b & a) - (b + p)) - ((p * c) | (d | a));
+  a = ((c + p) - (q | q)) | ((a * c) ^ (b ^ d));
+  for(i = 0; i < 42; i++){
+    c = ((d | 66) & (c | d)) & ((a & 26) | (p + q));
+  }
+  if(c < b){
+    d = ((a | c) - (p + a)) & ((a & 29) * (c & a));
+  }else{
+    b = ((q | d) & (a * c)) ^ ((d ^ 93) ^ (a & q));
+  }
+  b = ((c - q) | (q * d)) & ((c * a) - (q - 75));
+  a = ((b + a) + (d * b)) ^ ((q - 43) * (p + q));
+  b = ((a * p) * (q | p)) + ((p + c) ^ (q | c));
+  c = ((p | d) + (b + 18)) * ((c ^ c) - (c ^ q));
+  if(a < a){
+    a = ((a - 67) | (c | d)) - ((b & b) * (a + 73));
+  }else{
+    c = ((a * q) | (d - q)) | ((b + 25) - (d + 43));
+  }
+  for(i = 0; i < 18; i++){
+    a = ((c | q) * (d | b)) * ((q ^ p) & (d + a));
+  }
+  b = ((q ^ a) * (d | c)) - ((b | c) - (p * 66));
+  a = ((d * b) - (c - 44)) * ((b * 4) - (c ^ b));
+  b = ((c ^ 66) * (q & a)) ^ ((b * 11) | (a + a));
+  if(c < p){
+    c = ((q * b) | (p * a)) ^ ((q + c) * (b | c));
+  }else{
+    a = ((c - 64) ^ (p | 95)) | ((a * c) & (a | 25));
+  }
+  d = ((d * d) * (c ^ p)) & ((p * a) & (b + 52));
+  c = ((c + q) - (d & 61)) * ((a | 83) ^ (a + a));
+  for(i = 0; i < 18; i++){
+    b = ((d ^ a) - (a - b)) | ((p | 13) ^ (c | q));
+  }
+  b = ((p * b) + (d - d)) * ((q * 37) + (a ^ 12));
+  if(c < a){
+    a = ((c & d) + (b & p)) | ((c * d) | (p - b));
+  }else{
+    c = ((c & d) - (d - d)) ^ ((q | a) ^ (a * c));
+  }
+  b = ((d | d) ^ (c - a)) + ((q | 1) + (d * a));
+  d = ((c * a) * (d + d)) ^ ((b * d) - (a - q));
+  a = ((q * 43) | (a - a)) - ((q ^ a) | (q & q));
+  a = ((p + c) ^ (c ^ 99)) * ((b & 66) | (q * b));
+  if(d < 21){
+    a = ((b + 20) + (p * a)) + ((d ^ 61) * (c & c));
+  }else{
+    c = ((q + p) + (p & q)) ^ ((d & 9) ^ (c * c));
+  }
+  c = ((d + p) & (c & p)) ^ ((a * 24) & (c - p));
+  d = ((d ^ a) + (q + c)) - ((p ^ b) ^ (b - p));
+  c = ((c ^ b) - (b * a)) - ((p * c) - (c | d));
+  a = ((b * 25) | (b + q)) * ((d & a) * (q + d));
+  if(c < d){
+    a = ((b - b) + (q * 97)) & ((b & 19) * (q + 23));
+  }else{
+    d = ((a | d) & (q ^ p)) * ((p * p) * (a - d));
+  }
+  return a + b + c + d;
+}
+
+global int main()
+{
+  int x;
+  x = 1;
+  x = func0(x, 45);
+  x = func1(x, 84);
+  x = func2(x, 32);
+  x = func3(x, 51);
+  x = func4(x, 40);
+  x = func5(x, 98);
+  x = func6(x, 46);
+  x = func7(x, 38);
+  x = func8(x, 44);
+  x = func9(x, 2);
+  x = func10(x, 7);
+  x = func11(x, 38);
+  x = func12(x, 35);
+  x = func13(x, 12);
+  x = func14(x, 89);
+  x = func15(x, 57);
+  x = func16(x, 29);
+  x = func17(x, 16);
+  x = func18(x, 90);
+  x = func19(x, 42);
+  x = func20(x, 85);
+  x = func21(x, 60);
+  x = func22(x, 47);
+  x = func23(x, 76);
+  x = func24(x, 4);
+  x = func25(x, 73);
+  x = func26(x, 68);
+  x = func27(x, 68);
+  x = func28(x, 35);
+  x = func29(x, 92);
+  x = func30(x, 2);
+  x = func31(x, 17);
+  x = func32(x, 77);
+  x = func33(x, 62);
+  x = func34(x, 66);
+  x = func35(x, 99);
+  x = func36(x, 93);
+  x = func37(x, 19);
+  x = func38(x, 97);
+  x = func39(x, 43);
+  x = func40(x, 44);
+  x = func41(x, 7);
+  x = func42(x, 24);
+  x = func43(x, 77);
+  x = func44(x, 70);
+  x = func45(x, 10);
+  x = func46(x, 47);
+  x = func47(x, 58);
+  x = func48(x, 34);
+  x = func49(x, 24);
+  x = func50(x, 1);
+  x = func51(x, 59);
+  x = func52(x, 91);
+  x = func53(x, 89);
+  x = func54(x, 23);
+  x = func55(x, 35);
+  x = func56(x, 71);
+  x = func57(x, 93);
+  x = func58(x, 10);
+  x = func59(x, 34);
+  x = func60(x, 42);
+  x = func61(x, 14);
+  x = func62(x, 69);
+  x = func63(x, 15);
+  x = func64(x, 71);
+  x = func65(x, 71);
+  x = func66(x, 48);
+  x = func67(x, 84);
+  x = func68(x, 12);
+  x = func69(x, 51);
+  x = func70(x, 64);
+  x = func71(x, 81);
+  x = func72(x, 64);
+  x = func73(x, 67);
+  x = func74(x, 9);
+  x = func75(x, 21);
+  x = func76(x, 35);
+  x = func77(x, 56);
+  x = func78(x, 17);
+  x = func79(x, 43);
+  x = func80(x, 92);
+  x = func81(x, 66);
+  x = func82(x, 88);
+  x = func83(x, 37);
+  x = func84(x, 36);
+  x = func85(x, 87);
+  x = func86(x, 74);
+  x = func87(x, 88);
+  x = func88(x, 78);
+  x = func89(x, 99);
+  x = func90(x, 85);
+  x = func91(x, 1);
+  x = func92(x, 75);
+  x = func93(x, 12);
+  x = func94(x, 51);
+  x = func95(x, 56);
+  x = func96(x, 51);
+  x = func97(x, 58);
+  x = func98(x, 22);
+  x = func99(x, 77);
+  rv0.x0 = x;
+  rv1.x1 = x;
+  rv2.x2 = x;
+  rv3.x3 = x;
+  rv4.x4 = x;
+  rv5.x5 = x;
+  rv6.x6 = x;
+  rv7.x7 = x;
+  rv8.x8 = x;
+  rv9.x9 = x;
+  rv10.x10 = x;
+  rv11.x11 = x;
+  rv12.x12 = x;
+  rv13.x13 = x;
+  rv14.x14 = x;
+  rv15.x15 = x;
+  gfloat = gfloat * 8.522 + 0.5;
+  gfloat = gfloat * 9.519 + 1.5;
+  gfloat = gfloat * 3.435 + 2.5;
+  gfloat = gfloat * 9.11 + 3.5;
+  gfloat = gfloat * 3.932 + 4.5;
+  gfloat = gfloat * 5.334 + 5.5;
+  gfloat = gfloat * 7.331 + 6.5;
+  gfloat = gfloat * 2.958 + 7.5;
+  gfloat = gfloat * 8.26 + 8.5;
+  gfloat = gfloat * 7.597 + 9.5;
+  printf("string 0 value = %d\n", x);
+  printf("string 1 value = %d\n", x);
+  printf("string 2 value = %d\n", x);
+  printf("string 3 value = %d\n", x);
+  printf("string 4 value = %d\n", x);
+  printf("string 5 value = %d\n", x);
+  printf("string 6 value = %d\n", x);
+  printf("string 7 value = %d\n", x);
+  printf("string 8 value = %d\n", x);
+  printf("string 9 value = %d\n", x);
+  return 0;
+}
@@ -0,0 +1,6895 @@
+
+section .text
+    global gfloat
+    extern printf
+    global main
+
+; [ function: func0(int p, int q) ]
+func0:
+    sub esp, 44    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _licm3 = [esp + 8], dword
+    ; i = [esp + 12], dword
+    ; _licm1 = [esp + 16], dword
+    ; _licm2 = [esp + 24], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 28], dword
+    ; c = [esp + 32], dword
+    ; _licm4 = [esp + 36], dword
+    ; b = [esp + 40], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 52
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 28], eax
+; line 53
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 40], eax
+; line 54
+    mov eax, 2
+    mov dword[esp + 32], eax
+; line 55
+    mov eax, 9
+    mov dword[esp + 20], eax
+; line 56
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    and eax, 57
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    add eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    sub eax, 53
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 32], eax
+; line 57
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    or eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    and eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    xor eax, dword[esp + 28]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 40], eax
+; line 58
+    mov eax, dword[esp + 32]  ; c
+    add eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    and eax, 65
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov edx, dword[esp + 8]  ; p
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    add eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 28], eax
+; line 59
+    mov eax, dword[esp + 20]  ; d
+    or eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, dword[esp + 8]  ; p
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, 66
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, 78
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; condition checking, line 60
+    cmp dword[esp + 20], 45
+    jge .else_label1
+; line 61
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 24]  ; d
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov edx, dword[esp + 32]  ; a
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, 88
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 40], eax
+    jmp .exit_if1
+.else_label1:
+; line 63
+    mov eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 32]  ; a
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, dword[esp + 8]  ; q
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+.exit_if1:
+; line 65
+    mov eax, dword[esp + 4]  ; p
+    imul eax, 23
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, 92
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, 18
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, 3
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 67
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 40]  ; b
+    mov dword[esp + 16], eax
+; line 67
+    mov eax, dword[esp + 40]  ; b
+    sub eax, 58
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 36]  ; c
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 24], eax
+; for loop, line 66
+; line 66
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop1:
+; condition checking, line 66
+    cmp dword[esp + 12], 26
+    jge .exit_for_loop1
+; line 67
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    xor eax, dword[esp + 20]  ; d
+    sub eax, dword[esp + 16]  ; _licm1
+    mov ebx, dword[esp + 24]  ; _licm2
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 66
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 69
+    mov eax, dword[esp + 4]  ; p
+    or eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    shl eax, 4
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 28], eax
+; line 70
+    mov eax, dword[esp]  ; q
+    add eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, dword[esp + 32]  ; a
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    add eax, 8
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 48]  ; b
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; condition checking, line 71
+    cmp dword[esp + 28], 25
+    jge .else_label2
+; line 72
+    mov eax, dword[esp + 4]  ; p
+    add eax, 93
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, 84
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 44]  ; b
+    sub eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 36]  ; a
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+    jmp .exit_if2
+.else_label2:
+; line 74
+    mov eax, dword[esp + 28]  ; a
+    and eax, 4
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 24]  ; d
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    and eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 28]  ; d
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+.exit_if2:
+; line 76
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    add eax, 10
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    add eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 28], eax
+; line 77
+    mov eax, dword[esp + 4]  ; p
+    add eax, 93
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    sub eax, 73
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    or eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; line 78
+    mov eax, dword[esp]  ; q
+    or eax, 43
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 40]  ; c
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 28], eax
+; line 80
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp + 32]  ; c
+    mov dword[esp + 8], eax
+; line 80
+    mov eax, dword[esp + 20]  ; d
+    xor eax, 18
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, 69
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 36], eax
+; for loop, line 79
+; line 79
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop3:
+; condition checking, line 79
+    cmp dword[esp + 12], 16
+    jge .exit_for_loop3
+; line 80
+    mov eax, dword[esp + 40]  ; b
+    and eax, 55
+    mov ebx, dword[esp + 8]  ; _licm3
+    mul ebx
+    mov ebx, dword[esp + 36]  ; _licm4
+    mul ebx
+    mov dword[esp + 40], eax
+; line 79
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 82
+    cmp dword[esp + 32], 3
+    jge .else_label3
+; line 83
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, 33
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 28]  ; d
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 40], eax
+    jmp .exit_if3
+.else_label3:
+; line 85
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 24]  ; d
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 36]  ; a
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+.exit_if3:
+; line 87
+    mov eax, dword[esp + 20]  ; d
+    sub eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    sub eax, 89
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, 19
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    and eax, 6
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+; line 88
+    mov eax, dword[esp + 32]  ; c
+    add eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    add eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    sub eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    or eax, 57
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+; line 89
+    mov eax, dword[esp + 20]  ; d
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, 85
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    sub eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 40], eax
+; line 90
+    mov eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 40]  ; b
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 44]  ; b
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 44]  ; b
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, dword[esp + 48]  ; b
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 40], eax
+; condition checking, line 91
+    mov eax, dword[esp + 28]
+    cmp dword[esp + 40], eax
+    jge .else_label4
+; line 92
+    mov eax, dword[esp + 40]  ; b
+    or eax, 88
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 24]  ; d
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov edx, dword[esp + 4]  ; q
+    sub eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 48]  ; b
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 40], eax
+    jmp .exit_if4
+.else_label4:
+; line 94
+    mov eax, dword[esp + 28]  ; a
+    or eax, 52
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 32]  ; a
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 32]  ; a
+    mul edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, 24
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+.exit_if4:
+; line 96
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 44    ; release local variables
+    ret 
+; [ function: func1(int p, int q) ]
+func1:
+    sub esp, 52    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _vn2 = [esp + 8], dword
+    ; i = [esp + 16], dword
+    ; _licm6 = [esp + 12], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 24], dword
+    ; _licm5 = [esp + 28], dword
+    ; _vn1 = [esp + 32], dword
+    ; c = [esp + 36], dword
+    ; _licm8 = [esp + 40], dword
+    ; _licm7 = [esp + 44], dword
+    ; b = [esp + 48], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 102
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 24], eax
+; line 103
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 48], eax
+; line 104
+    mov eax, 98
+    mov dword[esp + 36], eax
+; line 105
+    mov eax, 5
+    mov dword[esp + 20], eax
+; line 106
+    mov eax, dword[esp + 48]  ; b
+    or eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 52]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 40]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    xor eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 24], eax
+; line 107
+    xor eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    sub eax, 44
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov edx, dword[esp + 8]  ; p
+    mul edx
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    and eax, 67
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 48], eax
+; line 108
+    mov eax, dword[esp + 24]  ; a
+    mov ebx, eax
+    shl eax, 5
+    sub eax, ebx
+    shl eax, 1
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    sub eax, 89
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    shl eax, 4
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    or eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 20], eax
+; line 109
+    add eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    add eax, dword[esp + 52]  ; b
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 44]  ; c
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+; condition checking, line 110
+    cmp dword[esp + 36], 86
+    jge .else_label1
+; line 111
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov ecx, 65
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 40]  ; c
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 12]  ; p
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if1
+.else_label1:
+; line 113
+    mov eax, dword[esp + 4]  ; p
+    sub eax, dword[esp + 48]  ; b
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov ecx, dword[esp + 40]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 24]  ; d
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, dword[esp + 56]  ; b
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+.exit_if1:
+; line 115
+    mov eax, dword[esp + 24]  ; a
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    xor eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 44]  ; c
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 20], eax
+; line 117
+    add eax, dword[esp + 4]  ; p
+    mov dword[esp + 28], eax
+; line 117
+    mov eax, dword[esp + 4]  ; p
+    or eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov ecx, dword[esp + 24]  ; d
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 12], eax
+; for loop, line 116
+; line 116
+    mov eax, 0
+    mov dword[esp + 16], eax
+.for_loop1:
+; condition checking, line 116
+    cmp dword[esp + 16], 45
+    jge .exit_for_loop1
+; line 117
+    xor edx, edx
+    mov eax, dword[esp + 24]  ; a
+    sub eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 28]  ; _licm5
+    mov ebx, dword[esp + 12]  ; _licm6
+    xor eax, ebx
+    mov dword[esp + 24], eax
+; line 116
+    inc dword[esp + 16]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 119
+    mov eax, dword[esp + 48]  ; b
+    xor eax, dword[esp + 48]  ; b
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    sub eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, 6
+    mul edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    lea eax, [eax + eax * 8]
+    shl eax, 3
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+; line 120
+    mov eax, dword[esp + 48]  ; b
+    sub eax, dword[esp + 24]  ; a
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 28]  ; a
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 12]  ; p
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+; condition checking, line 121
+    mov eax, dword[esp + 24]
+    cmp dword[esp + 20], eax
+    jge .else_label2
+; line 122
+    mov eax, dword[esp + 4]  ; p
+    add eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov ecx, dword[esp + 52]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov edx, dword[esp + 40]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, 80
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if2
+.else_label2:
+; line 124
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 40]  ; c
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 28]  ; a
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 32]  ; a
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 48], eax
+.exit_if2:
+; line 126
+    mov eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    mov dword[esp + 32], eax
+; line 126
+    mov eax, dword[esp + 24]  ; a
+    and eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    add eax, dword[esp + 8]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; _vn1
+    mov edx, dword[esp + 36]  ; _vn1
+    mul edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+; line 127
+    add eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, dword[esp + 28]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    add eax, 72
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    add eax, dword[esp + 28]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 36], eax
+; line 128
+    mov eax, dword[esp + 24]  ; a
+    sub eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 4]  ; q
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    add eax, 61
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 8]  ; q
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+; line 130
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp + 4]  ; p
+    mov dword[esp + 44], eax
+; line 130
+    xor edx, edx
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, 84
+    xor eax, ebx
+    mov dword[esp + 40], eax
+; for loop, line 129
+; line 129
+    mov eax, 0
+    mov dword[esp + 16], eax
+.for_loop3:
+; condition checking, line 129
+    cmp dword[esp + 16], 29
+    jge .exit_for_loop3
+; line 130
+    xor edx, edx
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 20]  ; d
+    sub eax, dword[esp + 44]  ; _licm7
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    sub eax, dword[esp + 28]  ; a
+    mov ecx, dword[esp + 44]  ; _licm8
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 20], eax
+; line 129
+    inc dword[esp + 16]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 132
+    mov eax, dword[esp + 4]
+    cmp dword[esp + 48], eax
+    jge .else_label3
+; line 133
+    mov eax, dword[esp + 48]  ; b
+    sub eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 52]  ; b
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, 93
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if3
+.else_label3:
+; line 135
+    mov eax, dword[esp + 24]  ; a
+    sub eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, 52
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov edx, dword[esp + 4]  ; q
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 44]  ; c
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 20], eax
+.exit_if3:
+; line 137
+    mov eax, dword[esp + 20]  ; d
+    mov ebx, dword[esp + 36]  ; c
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, 31
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, dword[esp + 44]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+; line 138
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    xor eax, dword[esp + 52]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov edx, 36
+    mul edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, dword[esp + 28]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 24], eax
+; line 139
+    mov eax, dword[esp + 20]  ; d
+    mov ebx, dword[esp + 36]  ; c
+    mul ebx
+    mov dword[esp + 8], eax
+; line 139
+    mov eax, dword[esp + 36]  ; c
+    xor eax, dword[esp + 48]  ; b
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    or eax, 24
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    sub eax, 66
+    add eax, dword[esp + 12]  ; _vn2
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 24], eax
+; line 140
+    mov eax, dword[esp + 36]  ; c
+    or eax, dword[esp + 48]  ; b
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 4]  ; q
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 28]  ; a
+    mul edx
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    mov esi, dword[esp + 28]  ; d
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 24], eax
+; condition checking, line 141
+    cmp dword[esp + 36], 71
+    jge .else_label4
+; line 142
+    mov eax, dword[esp + 48]  ; b
+    add eax, 45
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 24]  ; d
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 8]  ; p
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 28]  ; d
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 24], eax
+    jmp .exit_if4
+.else_label4:
+; line 144
+    mov eax, dword[esp + 24]  ; a
+    mov ebx, dword[esp + 24]  ; a
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 52]  ; b
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    sub eax, 12
+    mov edx, dword[esp + 12]  ; _vn2
+    and eax, edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+.exit_if4:
+; line 146
+    xor edx, edx
+    mov eax, dword[esp + 24]  ; a
+    add eax, dword[esp + 48]  ; b
+    add eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 52    ; release local variables
+    ret 
+; [ function: func2(int p, int q) ]
+func2:
+    sub esp, 52    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; i = [esp + 8], dword
+    ; d = [esp + 12], dword
+    ; a = [esp + 20], dword
+    ; c = [esp + 28], dword
+    ; _licm11 = [esp + 32], dword
+    ; _licm12 = [esp + 24], dword
+    ; _licm9 = [esp + 36], dword
+    ; _licm10 = [esp + 16], dword
+    ; _vn3 = [esp + 40], dword
+    ; _vn4 = [esp + 44], dword
+    ; b = [esp + 48], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 152
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 20], eax
+; line 153
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 48], eax
+; line 154
+    mov eax, 76
+    mov dword[esp + 28], eax
+; line 155
+    mov eax, 31
+    mov dword[esp + 12], eax
+; line 156
+    mov eax, dword[esp + 48]  ; b
+    mov ebx, dword[esp + 20]  ; a
+    mul ebx
+    mov dword[esp + 40], eax
+; line 156
+    mov eax, dword[esp]  ; q
+    xor eax, 22
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    and eax, dword[esp + 24]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    add eax, dword[esp + 8]  ; p
+    add eax, dword[esp + 44]  ; _vn3
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 48], eax
+; line 157
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp + 20]  ; a
+    push eax
+    mov eax, dword[esp + 24]  ; a
+    xor eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    add eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    or eax, dword[esp + 20]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+; line 158
+    mov eax, dword[esp + 20]  ; a
+    and eax, dword[esp + 20]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 16]  ; d
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    and eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    sub eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 12], eax
+; line 159
+    mov eax, dword[esp + 4]  ; p
+    or eax, dword[esp + 28]  ; c
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, 25
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov edx, dword[esp + 8]  ; p
+    sub eax, edx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov esi, dword[esp + 36]  ; c
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+; condition checking, line 160
+    cmp dword[esp + 48], 22
+    jge .else_label1
+; line 161
+    mov eax, dword[esp + 20]  ; a
+    or eax, 22
+    or eax, dword[esp + 40]  ; _vn3
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov ecx, 27
+    and eax, ecx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov edx, dword[esp + 28]  ; a
+    mul edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 12], eax
+    jmp .exit_if1
+.else_label1:
+; line 163
+    mov eax, dword[esp + 20]  ; a
+    xor eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, 23
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov edx, dword[esp + 16]  ; d
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    mov esi, 31
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+.exit_if1:
+; line 165
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp + 12]  ; d
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; a
+    mov ecx, 48
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; a
+    mov edx, dword[esp + 8]  ; p
+    mul edx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov esi, dword[esp + 36]  ; c
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 48], eax
+; line 167
+    mov eax, dword[esp + 28]  ; c
+    add eax, dword[esp + 4]  ; p
+    mov dword[esp + 36], eax
+; line 167
+    xor edx, edx
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp + 12]  ; d
+    sub eax, ebx
+    mov dword[esp + 16], eax
+; for loop, line 166
+; line 166
+    mov eax, 0
+    mov dword[esp + 8], eax
+.for_loop1:
+; condition checking, line 166
+    cmp dword[esp + 8], 28
+    jge .exit_for_loop1
+; line 167
+    mov eax, dword[esp + 48]  ; b
+    add eax, dword[esp + 28]  ; c
+    mov ebx, dword[esp + 36]  ; _licm9
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, dword[esp + 52]  ; b
+    mov ecx, dword[esp + 20]  ; _licm10
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 48], eax
+; line 166
+    inc dword[esp + 8]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 169
+    mov eax, dword[esp]  ; q
+    sub eax, 73
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    add eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    mov esi, dword[esp + 28]  ; a
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+; line 170
+    mov eax, dword[esp + 48]  ; b
+    add eax, 90
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 32]  ; c
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    add eax, 21
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov esi, dword[esp + 20]  ; d
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 48], eax
+; condition checking, line 171
+    mov eax, dword[esp + 28]
+    cmp dword[esp + 48], eax
+    jge .else_label2
+; line 172
+    mov eax, dword[esp + 20]  ; a
+    xor eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 52]  ; b
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov edx, 92
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov esi, dword[esp + 20]  ; d
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 12], eax
+    jmp .exit_if2
+.else_label2:
+; line 174
+    mov eax, dword[esp + 4]  ; p
+    imul eax, 26
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 8]  ; p
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, 26
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 8]  ; q
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 28], eax
+.exit_if2:
+; line 176
+    mov eax, dword[esp + 12]  ; d
+    or eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    or eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov edx, 10
+    mul edx
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    mov esi, 73
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 48], eax
+; line 177
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    mov dword[esp + 44], eax
+; line 177
+    mov eax, dword[esp + 12]  ; d
+    and eax, dword[esp + 20]  ; a
+    or eax, dword[esp + 44]  ; _vn4
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, dword[esp + 16]  ; d
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    or eax, 1
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 12], eax
+; line 178
+    add eax, 22
+    sub eax, dword[esp + 44]  ; _vn4
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    xor eax, dword[esp + 52]  ; b
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    sub eax, 14
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 28], eax
+; line 180
+    mov ebx, dword[esp + 20]  ; a
+    mul ebx
+    mov dword[esp + 32], eax
+; line 180
+    mov eax, dword[esp + 12]  ; d
+    mov ebx, dword[esp + 28]  ; c
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, 32
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 24], eax
+; for loop, line 179
+; line 179
+    mov eax, 0
+    mov dword[esp + 8], eax
+.for_loop3:
+; condition checking, line 179
+    cmp dword[esp + 8], 7
+    jge .exit_for_loop3
+; line 180
+    xor edx, edx
+    mov eax, dword[esp + 12]  ; d
+    and eax, dword[esp + 48]  ; b
+    add eax, dword[esp + 32]  ; _licm11
+    mov ebx, dword[esp + 24]  ; _licm12
+    or eax, ebx
+    mov dword[esp + 48], eax
+; line 179
+    inc dword[esp + 8]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 182
+    mov eax, dword[esp + 48]
+    cmp dword[esp + 48], eax
+    jge .else_label3
+; line 183
+    mov eax, dword[esp + 12]  ; d
+    or eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 32]  ; c
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    xor eax, 13
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov esi, 60
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 48], eax
+    jmp .exit_if3
+.else_label3:
+; line 185
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 24]  ; a
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov edx, dword[esp + 4]  ; q
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov esi, 84
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 12], eax
+.exit_if3:
+; line 187
+    mov eax, dword[esp + 48]  ; b
+    xor eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, dword[esp + 16]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    sub eax, 62
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    add eax, 32
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+; line 188
+    mov eax, dword[esp]  ; q
+    xor eax, 2
+    push eax
+    mov eax, dword[esp + 24]  ; a
+    xor eax, dword[esp + 32]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    xor eax, dword[esp + 16]  ; d
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    add eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 48], eax
+; line 189
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 48]  ; b
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 8]  ; p
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov edx, dword[esp + 16]  ; d
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    xor eax, dword[esp + 56]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 190
+    mov eax, dword[esp + 20]  ; a
+    and eax, 14
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, 56
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 52]  ; b
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, 78
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; condition checking, line 191
+    cmp dword[esp + 48], eax
+    jge .else_label4
+; line 192
+    mov eax, dword[esp + 12]  ; d
+    sub eax, 32
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 4]  ; q
+    mul edx
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    mov esi, dword[esp + 36]  ; c
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 28], eax
+    jmp .exit_if4
+.else_label4:
+; line 194
+    mov eax, dword[esp + 12]  ; d
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 32]  ; c
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, 36
+    mul edx
+    push eax
+    mov eax, dword[esp + 56]  ; b
+    mov esi, dword[esp + 28]  ; a
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 28], eax
+.exit_if4:
+; line 196
+    xor edx, edx
+    mov eax, dword[esp + 20]  ; a
+    add eax, dword[esp + 48]  ; b
+    add eax, dword[esp + 28]  ; c
+    mov ebx, dword[esp + 12]  ; d
+    add eax, ebx
+    add esp, 52    ; release local variables
+    ret 
+; [ function: func3(int p, int q) ]
+func3:
+    sub esp, 48    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _licm15 = [esp + 8], dword
+    ; i = [esp + 12], dword
+    ; _licm14 = [esp + 16], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 32], dword
+    ; c = [esp + 36], dword
+    ; _vn5 = [esp + 40], dword
+    ; _licm16 = [esp + 24], dword
+    ; _licm13 = [esp + 28], dword
+    ; b = [esp + 44], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 202
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 32], eax
+; line 203
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 44], eax
+; line 204
+    mov eax, 27
+    mov dword[esp + 36], eax
+; line 205
+    mov eax, 26
+    mov dword[esp + 20], eax
+; line 206
+    sub eax, 54
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    add eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    and eax, dword[esp + 28]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 20], eax
+; line 207
+    mov eax, dword[esp + 36]  ; c
+    sub eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    lea eax, [eax + eax * 4]
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov edx, dword[esp + 4]  ; q
+    mul edx
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    and eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; line 208
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp + 32]  ; a
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, dword[esp + 40]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, 69
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    and eax, dword[esp + 28]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+; line 209
+    mov ebx, eax  ; a
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 40]  ; c
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, 17
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; a
+    mov esi, dword[esp + 40]  ; a
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 44], eax
+; condition checking, line 210
+    cmp dword[esp + 20], eax
+    jge .else_label1
+; line 211
+    mov eax, dword[esp + 36]  ; c
+    xor eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 40]  ; c
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 28]  ; d
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+    jmp .exit_if1
+.else_label1:
+; line 213
+    mov eax, dword[esp + 32]  ; a
+    or eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov ecx, dword[esp + 8]  ; p
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, 6
+    push eax
+    mov eax, dword[esp + 40]  ; a
+    mov esi, dword[esp + 8]  ; q
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+.exit_if1:
+; line 215
+    mov eax, dword[esp + 20]  ; d
+    add eax, 47
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, dword[esp + 40]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    and eax, dword[esp + 36]  ; a
+    push eax
+    mov eax, dword[esp + 52]  ; b
+    mov esi, dword[esp + 28]  ; d
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+; line 217
+    mov eax, dword[esp + 44]  ; b
+    add eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov ecx, 94
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 217
+    xor edx, edx
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, 62
+    add eax, ebx
+    mov dword[esp + 16], eax
+; for loop, line 216
+; line 216
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop1:
+; condition checking, line 216
+    cmp dword[esp + 12], 22
+    jge .exit_for_loop1
+; line 217
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; _licm13
+    mov ecx, dword[esp + 20]  ; _licm14
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+; line 216
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 219
+    mov eax, dword[esp + 20]  ; d
+    or eax, 67
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    add eax, 1
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, 79
+    mul edx
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    and eax, dword[esp + 44]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+; line 220
+    and eax, 35
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov edx, dword[esp + 4]  ; q
+    mul edx
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, dword[esp + 28]  ; d
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; condition checking, line 221
+    mov eax, dword[esp]
+    cmp dword[esp + 36], eax
+    jge .else_label2
+; line 222
+    mov eax, dword[esp + 36]  ; c
+    sub eax, 44
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 4]  ; q
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 28]  ; d
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if2
+.else_label2:
+; line 224
+    mov eax, dword[esp + 32]  ; a
+    or eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 8]  ; p
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, 49
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 36], eax
+.exit_if2:
+; line 226
+    mov eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    mov dword[esp + 40], eax
+; line 226
+    mov eax, dword[esp + 20]  ; d
+    sub eax, 37
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    add eax, dword[esp + 8]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 40]  ; c
+    xor eax, dword[esp + 44]  ; _vn5
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 44], eax
+; line 227
+    sub eax, 75
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    or eax, 50
+    add eax, dword[esp + 44]  ; _vn5
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; line 228
+    mov eax, dword[esp + 4]  ; p
+    or eax, 97
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    imul eax, 79
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    sub eax, dword[esp + 40]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 40]  ; a
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+; line 230
+    and eax, 43
+    mov dword[esp + 8], eax
+; line 230
+    xor edx, edx
+    mov eax, dword[esp + 36]  ; c
+    add eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 24]  ; d
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+; for loop, line 229
+; line 229
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop3:
+; condition checking, line 229
+    cmp dword[esp + 12], 21
+    jge .exit_for_loop3
+; line 230
+    mov eax, dword[esp + 44]  ; b
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    sub eax, dword[esp + 8]  ; _licm15
+    mov ebx, dword[esp + 24]  ; _licm16
+    add eax, ebx
+    mov dword[esp + 44], eax
+; line 229
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 232
+    mov eax, dword[esp]
+    cmp dword[esp + 36], eax
+    jge .else_label3
+; line 233
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 36]  ; a
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    sub eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 44]  ; _vn5
+    xor eax, edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+    jmp .exit_if3
+.else_label3:
+; line 235
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov ecx, dword[esp + 48]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    or eax, dword[esp + 48]  ; b
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, dword[esp + 40]  ; a
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 44], eax
+.exit_if3:
+; line 237
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov ecx, dword[esp + 24]  ; d
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, 37
+    push eax
+    mov eax, dword[esp + 40]  ; a
+    xor eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; line 238
+    mov eax, dword[esp + 44]  ; b
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, 97
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov edx, dword[esp + 4]  ; q
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    or eax, 33
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 44], eax
+; line 239
+    mov eax, dword[esp]  ; q
+    add eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov ecx, dword[esp + 48]  ; b
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    xor eax, dword[esp + 40]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    or eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 44], eax
+; line 240
+    mov eax, dword[esp + 36]  ; c
+    and eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 36]  ; a
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov edx, dword[esp + 8]  ; p
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 28]  ; d
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 44], eax
+; condition checking, line 241
+    mov eax, dword[esp + 32]
+    cmp dword[esp + 36], eax
+    jge .else_label4
+; line 242
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov ecx, dword[esp + 48]  ; b
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 4]  ; q
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; a
+    imul eax, 51
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 44], eax
+    jmp .exit_if4
+.else_label4:
+; line 244
+    mov eax, dword[esp + 32]  ; a
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov ecx, dword[esp + 40]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    or eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 40]  ; a
+    mov esi, dword[esp + 44]  ; c
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 32], eax
+.exit_if4:
+; line 246
+    xor edx, edx
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 44]  ; b
+    add eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 48    ; release local variables
+    ret 
+; [ function: func4(int p, int q) ]
+func4:
+    sub esp, 44    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; i = [esp + 8], dword
+    ; _vn6 = [esp + 16], dword
+    ; _licm18 = [esp + 24], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 28], dword
+    ; _licm17 = [esp + 32], dword
+    ; c = [esp + 36], dword
+    ; _licm19 = [esp + 12], dword
+    ; b = [esp + 40], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 252
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 28], eax
+; line 253
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 40], eax
+; line 254
+    mov eax, 24
+    mov dword[esp + 36], eax
+; line 255
+    mov eax, 40
+    mov dword[esp + 20], eax
+; line 256
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    or eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov edx, dword[esp + 44]  ; b
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    and eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 20], eax
+; line 257
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 32]  ; a
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    and eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    and eax, 78
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 28], eax
+; line 258
+    mov eax, dword[esp + 20]  ; d
+    and eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    and eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 32]  ; a
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, 30
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 20], eax
+; line 259
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp + 40]  ; b
+    mul ebx
+    mov dword[esp + 16], eax
+; line 259
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 32]  ; a
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, 28
+    mov edx, dword[esp + 20]  ; _vn6
+    or eax, edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 20], eax
+; condition checking, line 260
+    mov eax, dword[esp + 40]
+    cmp dword[esp + 28], eax
+    jge .else_label1
+; line 261
+    mov eax, dword[esp + 20]  ; d
+    or eax, 89
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 28]  ; d
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if1
+.else_label1:
+; line 263
+    mov eax, dword[esp + 20]  ; d
+    and eax, 30
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 24]  ; d
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 24]  ; d
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, dword[esp + 8]  ; q
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+.exit_if1:
+; line 265
+    mov eax, dword[esp + 20]  ; d
+    and eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    or eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    xor eax, 9
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 36]  ; a
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 28], eax
+; line 267
+    mov eax, dword[esp]  ; q
+    add eax, 20
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, 64
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 28]  ; d
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 32], eax
+; for loop, line 266
+; line 266
+    mov eax, 0
+    mov dword[esp + 8], eax
+.for_loop1:
+; condition checking, line 266
+    cmp dword[esp + 8], 47
+    jge .exit_for_loop1
+; line 267
+    mov eax, dword[esp + 32]  ; assignment _licm17
+    mov dword[esp + 36], eax
+; line 266
+    inc dword[esp + 8]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 269
+    mov eax, dword[esp + 40]  ; b
+    and eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 40]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 20]  ; _vn6
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 20], eax
+; line 270
+    mov eax, dword[esp + 36]  ; c
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 44]  ; b
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov edx, dword[esp + 40]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 44]  ; c
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; condition checking, line 271
+    cmp dword[esp + 36], 68
+    jge .else_label2
+; line 272
+    mov eax, dword[esp + 4]  ; p
+    and eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, 78
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, 80
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 48]  ; b
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if2
+.else_label2:
+; line 274
+    mov eax, dword[esp + 4]  ; p
+    and eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    lea eax, [eax + eax * 4]
+    shl eax, 1
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 28]  ; d
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 36], eax
+.exit_if2:
+; line 276
+    mov eax, dword[esp + 4]  ; p
+    and eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, dword[esp + 40]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, 48
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    or eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 36], eax
+; line 277
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, dword[esp + 4]  ; q
+    xor eax, dword[esp + 20]  ; _vn6
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+; line 278
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, 75
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, 35
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+; line 280
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 36]  ; c
+    mov dword[esp + 24], eax
+; line 280
+    xor edx, edx
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 12], eax
+; for loop, line 279
+; line 279
+    mov eax, 0
+    mov dword[esp + 8], eax
+.for_loop3:
+; condition checking, line 279
+    cmp dword[esp + 8], 25
+    jge .exit_for_loop3
+; line 280
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    and eax, dword[esp]  ; q
+    add eax, dword[esp + 24]  ; _licm18
+    mov ebx, dword[esp + 12]  ; _licm19
+    xor eax, ebx
+    mov dword[esp + 28], eax
+; line 279
+    inc dword[esp + 8]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 282
+    mov eax, dword[esp + 36]
+    cmp dword[esp + 20], eax
+    jge .else_label3
+; line 283
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 40]  ; c
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 40]  ; c
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 8]  ; q
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if3
+.else_label3:
+; line 285
+    mov eax, dword[esp + 28]  ; a
+    sub eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 8]  ; p
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov edx, dword[esp + 44]  ; b
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 36]  ; a
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+.exit_if3:
+; line 287
+    mov eax, dword[esp + 4]  ; p
+    and eax, 40
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    imul eax, 97
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, 83
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    and eax, 31
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 36], eax
+; line 288
+    mov eax, dword[esp + 28]  ; a
+    add eax, 34
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    sub eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    or eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    or eax, dword[esp + 44]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 289
+    mov eax, dword[esp + 36]  ; c
+    sub eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 40]  ; c
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    add eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    sub eax, 72
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 40], eax
+; line 290
+    add eax, 18
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 24]  ; d
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 8]  ; p
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 36]  ; a
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 40], eax
+; condition checking, line 291
+    mov eax, dword[esp]
+    cmp dword[esp + 40], eax
+    jge .else_label4
+; line 292
+    mov eax, dword[esp + 36]  ; c
+    or eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 44]  ; b
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 28]  ; d
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 40], eax
+    jmp .exit_if4
+.else_label4:
+; line 294
+    mov eax, dword[esp + 28]  ; a
+    and eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 4]  ; q
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 12]  ; p
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 36], eax
+.exit_if4:
+; line 296
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 44    ; release local variables
+    ret 
+; [ function: func5(int p, int q) ]
+func5:
+    sub esp, 36    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; i = [esp + 12], dword
+    ; _licm20 = [esp + 16], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 24], dword
+    ; _licm21 = [esp + 8], dword
+    ; c = [esp + 28], dword
+    ; b = [esp + 32], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 302
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 24], eax
+; line 303
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 32], eax
+; line 304
+    mov eax, 98
+    mov dword[esp + 28], eax
+; line 305
+    mov eax, 8
+    mov dword[esp + 20], eax
+; line 306
+    mov eax, dword[esp + 28]  ; c
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    and eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+; line 307
+    mov eax, dword[esp + 32]  ; b
+    and eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    sub eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, 39
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    sub eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+; line 308
+    mov ebx, dword[esp + 28]  ; c
+    mul ebx
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    and eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    and eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    and eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+; line 309
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 32]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    mov ecx, 1
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    sub eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, 97
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 20], eax
+; condition checking, line 310
+    mov eax, dword[esp + 24]
+    cmp dword[esp + 28], eax
+    jge .else_label1
+; line 311
+    mov eax, dword[esp + 28]  ; c
+    and eax, dword[esp + 28]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov ecx, dword[esp + 24]  ; d
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov edx, dword[esp + 24]  ; d
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov esi, 56
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 20], eax
+    jmp .exit_if1
+.else_label1:
+; line 313
+    mov eax, dword[esp + 28]  ; c
+    and eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 4]  ; q
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov edx, dword[esp + 36]  ; b
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, 52
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 24], eax
+.exit_if1:
+; line 315
+    mov eax, dword[esp + 24]  ; a
+    xor eax, dword[esp + 32]  ; b
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    or eax, dword[esp + 28]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    xor eax, 8
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 24], eax
+; line 317
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 8]  ; p
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 4]  ; q
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, 97
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 16], eax
+; for loop, line 316
+; line 316
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop1:
+; condition checking, line 316
+    cmp dword[esp + 12], 39
+    jge .exit_for_loop1
+; line 317
+    mov eax, dword[esp + 16]  ; assignment _licm20
+    mov dword[esp + 32], eax
+; line 316
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 319
+    mov eax, dword[esp + 28]  ; c
+    add eax, 97
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    sub eax, dword[esp + 32]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 32]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov esi, dword[esp + 32]  ; a
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+; line 320
+    mov eax, dword[esp + 20]  ; d
+    or eax, dword[esp + 24]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 8]  ; p
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov esi, dword[esp + 8]  ; q
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; condition checking, line 321
+    cmp dword[esp + 32], 31
+    jge .else_label2
+; line 322
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, dword[esp + 4]  ; q
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 36]  ; b
+    mul edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    lea eax, [eax + eax * 2]
+    lea eax, [eax + eax * 4]
+    shl eax, 2
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 24], eax
+    jmp .exit_if2
+.else_label2:
+; line 324
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 36]  ; b
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 4]  ; q
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov esi, dword[esp + 40]  ; b
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 28], eax
+.exit_if2:
+; line 326
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 28]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    xor eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    sub eax, 36
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 32], eax
+; line 327
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 32]  ; b
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov edx, dword[esp + 32]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    xor eax, 89
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 20], eax
+; line 328
+    mov eax, dword[esp + 28]  ; c
+    xor eax, dword[esp + 28]  ; c
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    sub eax, 97
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    mov edx, dword[esp + 24]  ; d
+    mul edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    xor eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 20], eax
+; line 330
+    mov eax, dword[esp + 28]  ; c
+    and eax, dword[esp + 32]  ; b
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    mov ecx, 47
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov esi, dword[esp + 12]  ; p
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 8], eax
+; for loop, line 329
+; line 329
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop3:
+; condition checking, line 329
+    cmp dword[esp + 12], 39
+    jge .exit_for_loop3
+; line 330
+    mov eax, dword[esp + 8]  ; assignment _licm21
+    mov dword[esp + 20], eax
+; line 329
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 332
+    mov eax, dword[esp]
+    cmp dword[esp + 28], eax
+    jge .else_label3
+; line 333
+    mov eax, dword[esp + 32]  ; b
+    mov ebx, dword[esp + 28]  ; c
+    mul ebx
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, 32
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov esi, 5
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+    jmp .exit_if3
+.else_label3:
+; line 335
+    mov eax, dword[esp + 24]  ; a
+    xor eax, dword[esp + 24]  ; a
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    mov ecx, dword[esp + 24]  ; d
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    sub eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov esi, dword[esp + 12]  ; p
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 20], eax
+.exit_if3:
+; line 337
+    mov eax, dword[esp + 28]  ; c
+    and eax, dword[esp + 24]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    sub eax, dword[esp + 28]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    sub eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    sub eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 32], eax
+; line 338
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 28]  ; c
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, dword[esp + 36]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; c
+    and eax, 40
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov esi, dword[esp + 8]  ; q
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+; line 339
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 36]  ; b
+    add eax, 63
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    imul eax, 47
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 340
+    mov eax, dword[esp + 4]  ; p
+    add eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 8]  ; p
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, 32
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, dword[esp + 32]  ; a
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 24], eax
+; condition checking, line 341
+    cmp dword[esp + 20], 66
+    jge .else_label4
+; line 342
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 32]  ; b
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 32]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 24]  ; d
+    mul edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, 10
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+    jmp .exit_if4
+.else_label4:
+; line 344
+    mov eax, dword[esp + 4]  ; p
+    add eax, 67
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 36]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov edx, dword[esp + 36]  ; b
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov esi, 70
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 32], eax
+.exit_if4:
+; line 346
+    xor edx, edx
+    mov eax, dword[esp + 24]  ; a
+    add eax, dword[esp + 32]  ; b
+    add eax, dword[esp + 28]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 36    ; release local variables
+    ret 
+; [ function: func6(int p, int q) ]
+func6:
+    sub esp, 44    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _licm23 = [esp + 8], dword
+    ; _licm24 = [esp + 12], dword
+    ; i = [esp + 16], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 28], dword
+    ; _licm22 = [esp + 32], dword
+    ; c = [esp + 36], dword
+    ; _licm25 = [esp + 24], dword
+    ; b = [esp + 40], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 352
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 28], eax
+; line 353
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 40], eax
+; line 354
+    mov eax, 9
+    mov dword[esp + 36], eax
+; line 355
+    mov eax, 34
+    mov dword[esp + 20], eax
+; line 356
+    mov eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, 89
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    or eax, 37
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 20], eax
+; line 357
+    mov eax, dword[esp + 28]  ; a
+    or eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, dword[esp + 24]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov edx, dword[esp + 24]  ; d
+    mul edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    sub eax, dword[esp + 44]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 20], eax
+; line 358
+    mov eax, dword[esp + 40]  ; b
+    and eax, 83
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    add eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    sub eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 12]  ; p
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+; line 359
+    mov eax, dword[esp + 28]  ; a
+    xor eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 40]  ; c
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, 57
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, 81
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+; condition checking, line 360
+    mov eax, dword[esp + 20]
+    cmp dword[esp + 28], eax
+    jge .else_label1
+; line 361
+    mov eax, dword[esp + 36]  ; c
+    xor eax, 52
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 44]  ; b
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 44]  ; b
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, 41
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if1
+.else_label1:
+; line 363
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, 59
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 4]  ; q
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 36]  ; a
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+.exit_if1:
+; line 365
+    mov eax, dword[esp + 36]  ; c
+    or eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 8]  ; q
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+; line 367
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, dword[esp + 40]  ; b
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, 67
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; line 367
+    xor edx, edx
+    mov eax, dword[esp + 20]  ; d
+    mov ebx, dword[esp + 28]  ; a
+    and eax, ebx
+    mov dword[esp + 8], eax
+; for loop, line 366
+; line 366
+    mov eax, 0
+    mov dword[esp + 16], eax
+.for_loop1:
+; condition checking, line 366
+    cmp dword[esp + 16], 48
+    jge .exit_for_loop1
+; line 367
+    xor edx, edx
+    mov eax, dword[esp + 36]  ; c
+    sub eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 36]  ; _licm22
+    mov ecx, dword[esp + 12]  ; _licm23
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+; line 366
+    inc dword[esp + 16]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 369
+    mov eax, dword[esp + 20]  ; d
+    and eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 24]  ; d
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    xor eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 28]  ; d
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; line 370
+    mov eax, dword[esp + 36]  ; c
+    sub eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 4]  ; q
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov edx, dword[esp + 40]  ; c
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 28]  ; d
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; condition checking, line 371
+    mov eax, dword[esp + 40]
+    cmp dword[esp + 28], eax
+    jge .else_label2
+; line 372
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 24]  ; d
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 48]  ; b
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if2
+.else_label2:
+; line 374
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 44]  ; b
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 32]  ; a
+    mul edx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 48]  ; b
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+.exit_if2:
+; line 376
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    sub eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    add eax, dword[esp + 40]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    or eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 36], eax
+; line 377
+    mov eax, dword[esp + 20]  ; d
+    mov ebx, dword[esp + 40]  ; b
+    mul ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, dword[esp + 8]  ; p
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    sub eax, dword[esp + 40]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    add eax, dword[esp + 36]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 28], eax
+; line 378
+    mov eax, dword[esp + 40]  ; b
+    or eax, 84
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, dword[esp + 36]  ; a
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 28], eax
+; line 380
+    mov eax, dword[esp + 4]  ; p
+    sub eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 32]  ; a
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 12], eax
+; line 380
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    mov ebx, dword[esp + 40]  ; b
+    xor eax, ebx
+    mov dword[esp + 24], eax
+; for loop, line 379
+; line 379
+    mov eax, 0
+    mov dword[esp + 16], eax
+.for_loop3:
+; condition checking, line 379
+    cmp dword[esp + 16], 12
+    jge .exit_for_loop3
+; line 380
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 16]  ; _licm24
+    mov ecx, dword[esp + 28]  ; _licm25
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+; line 379
+    inc dword[esp + 16]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 382
+    mov eax, dword[esp + 28]
+    cmp dword[esp + 20], eax
+    jge .else_label3
+; line 383
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 44]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, 74
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 36]  ; a
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if3
+.else_label3:
+; line 385
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 40]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, 31
+    mul edx
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    mov esi, dword[esp + 44]  ; c
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 20], eax
+.exit_if3:
+; line 387
+    mov eax, dword[esp + 40]  ; b
+    or eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 40]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    and eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 40], eax
+; line 388
+    mov eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    sub eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    or eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    and eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+; line 389
+    mov eax, dword[esp + 28]  ; a
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    and eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    xor eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 44]  ; c
+    and eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; line 390
+    mov eax, dword[esp + 4]  ; p
+    or eax, 48
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 32]  ; a
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov edx, dword[esp + 8]  ; p
+    mul edx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 28]  ; d
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 36], eax
+; condition checking, line 391
+    mov eax, dword[esp + 28]
+    cmp dword[esp + 28], eax
+    jge .else_label4
+; line 392
+    mov eax, dword[esp + 40]  ; b
+    sub eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 32]  ; a
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    or eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 36]  ; a
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 28], eax
+    jmp .exit_if4
+.else_label4:
+; line 394
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp + 36]  ; c
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov ecx, dword[esp + 24]  ; d
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, 55
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 28]  ; d
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 36], eax
+.exit_if4:
+; line 396
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 36]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 44    ; release local variables
+    ret 
+; [ function: func7(int p, int q) ]
+func7:
+    sub esp, 44    ; allocate space for local variables
+    ; i = [esp + 8], dword
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _licm26 = [esp + 16], dword
+    ; d = [esp + 12], dword
+    ; a = [esp + 24], dword
+    ; _licm27 = [esp + 28], dword
+    ; c = [esp + 32], dword
+    ; _licm28 = [esp + 36], dword
+    ; _vn7 = [esp + 20], dword
+    ; b = [esp + 40], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 402
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 24], eax
+; line 403
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 40], eax
+; line 404
+    mov eax, 64
+    mov dword[esp + 32], eax
+; line 405
+    mov eax, 70
+    mov dword[esp + 12], eax
+; line 406
+    mov eax, dword[esp + 4]  ; p
+    imul eax, 91
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 28]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, 81
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+; line 407
+    mov eax, dword[esp + 24]  ; a
+    or eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, 81
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    or eax, 36
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 12], eax
+; line 408
+    mov ebx, eax  ; d
+    mul ebx
+    mov dword[esp + 20], eax
+; line 408
+    mov eax, dword[esp + 32]  ; c
+    sub eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, dword[esp + 8]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    sub eax, dword[esp + 36]  ; c
+    xor eax, dword[esp + 24]  ; _vn7
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 40], eax
+; line 409
+    mov eax, dword[esp + 24]  ; a
+    imul eax, 77
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, dword[esp + 36]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 8]  ; p
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, dword[esp + 20]  ; d
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+; condition checking, line 410
+    mov eax, dword[esp + 40]
+    cmp dword[esp + 32], eax
+    jge .else_label1
+; line 411
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov ecx, dword[esp + 28]  ; a
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov edx, 94
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 20]  ; d
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 24], eax
+    jmp .exit_if1
+.else_label1:
+; line 413
+    mov eax, dword[esp + 4]  ; p
+    sub eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, 80
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    add eax, dword[esp + 16]  ; d
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, 70
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 40], eax
+.exit_if1:
+; line 415
+    mov eax, dword[esp + 40]  ; b
+    and eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, 92
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 24], eax
+; line 417
+    mov eax, dword[esp + 32]  ; c
+    mov ebx, eax
+    shl eax, 5
+    sub eax, ebx
+    shl eax, 1
+    mov dword[esp + 16], eax
+; line 417
+    xor edx, edx
+    mov eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 12]  ; d
+    and eax, ebx
+    mov dword[esp + 28], eax
+; for loop, line 416
+; line 416
+    mov eax, 0
+    mov dword[esp + 8], eax
+.for_loop1:
+; condition checking, line 416
+    cmp dword[esp + 8], 19
+    jge .exit_for_loop1
+; line 417
+    xor edx, edx
+    mov eax, dword[esp + 40]  ; b
+    sub eax, dword[esp + 24]  ; a
+    sub eax, dword[esp + 16]  ; _licm26
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    add eax, dword[esp + 28]  ; a
+    mov ecx, dword[esp + 32]  ; _licm27
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 24], eax
+; line 416
+    inc dword[esp + 8]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 419
+    mov eax, dword[esp + 40]  ; b
+    or eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    xor eax, dword[esp + 4]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    and eax, dword[esp + 16]  ; d
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 48]  ; b
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 40], eax
+; line 420
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, dword[esp + 4]  ; q
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 36]  ; c
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 12]  ; p
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 32], eax
+; condition checking, line 421
+    mov eax, dword[esp + 4]
+    cmp dword[esp + 24], eax
+    jge .else_label2
+; line 422
+    mov eax, dword[esp]  ; q
+    sub eax, 8
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 8]  ; p
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    and eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    mov esi, dword[esp + 48]  ; b
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 40], eax
+    jmp .exit_if2
+.else_label2:
+; line 424
+    mov eax, dword[esp + 32]  ; c
+    xor eax, dword[esp]  ; q
+    and eax, dword[esp + 20]  ; _vn7
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 16]  ; d
+    and eax, ecx
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    mov edx, dword[esp + 32]  ; a
+    add eax, edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 40], eax
+.exit_if2:
+; line 426
+    mov eax, dword[esp + 24]  ; a
+    xor eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, dword[esp + 28]  ; a
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    sub eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    or eax, 94
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 12], eax
+; line 427
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    or eax, 2
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, 52
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    or eax, 80
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 12], eax
+; line 428
+    mov eax, dword[esp + 40]  ; b
+    and eax, 89
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 28]  ; a
+    mul edx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    xor eax, dword[esp + 20]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; line 430
+    mov eax, dword[esp + 40]  ; b
+    mov ebx, dword[esp + 32]  ; c
+    mul ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 44]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov edx, dword[esp + 8]  ; p
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, 30
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 36], eax
+; for loop, line 429
+; line 429
+    mov eax, 0
+    mov dword[esp + 8], eax
+.for_loop3:
+; condition checking, line 429
+    cmp dword[esp + 8], 40
+    jge .exit_for_loop3
+; line 430
+    mov eax, dword[esp + 36]  ; assignment _licm28
+    mov dword[esp + 24], eax
+; line 429
+    inc dword[esp + 8]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 432
+    mov eax, dword[esp + 4]
+    cmp dword[esp + 12], eax
+    jge .else_label3
+; line 433
+    mov eax, dword[esp + 12]  ; d
+    imul eax, 82
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    lea eax, [eax + eax * 2]
+    lea eax, [eax + eax * 8]
+    shl eax, 1
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov edx, dword[esp + 16]  ; d
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, dword[esp + 12]  ; p
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 32], eax
+    jmp .exit_if3
+.else_label3:
+; line 435
+    mov eax, dword[esp]  ; q
+    add eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 16]  ; d
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 4]  ; q
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    mov esi, dword[esp + 32]  ; a
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 40], eax
+.exit_if3:
+; line 437
+    mov eax, dword[esp + 12]  ; d
+    add eax, 12
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    add eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    add eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    and eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 12], eax
+; line 438
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 24]  ; a
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    or eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    add eax, 41
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov esi, dword[esp + 20]  ; d
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 12], eax
+; line 439
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 24]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, dword[esp + 8]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    or eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 20]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; line 440
+    mov eax, dword[esp + 40]  ; b
+    and eax, dword[esp + 12]  ; d
+    push eax
+    mov eax, dword[esp + 28]  ; a
+    mov ecx, dword[esp + 44]  ; b
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov edx, dword[esp + 28]  ; a
+    or eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 40]  ; c
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 40], eax
+; condition checking, line 441
+    cmp dword[esp + 32], 19
+    jge .else_label4
+; line 442
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 36]  ; c
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    xor eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 8]  ; q
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 24], eax
+    jmp .exit_if4
+.else_label4:
+; line 444
+    mov eax, dword[esp + 40]  ; b
+    and eax, 68
+    push eax
+    mov eax, dword[esp + 16]  ; d
+    mov ecx, dword[esp + 44]  ; b
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    sub eax, 77
+    push eax
+    mov eax, dword[esp + 20]  ; d
+    mov esi, dword[esp + 40]  ; c
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 40], eax
+.exit_if4:
+; line 446
+    xor edx, edx
+    mov eax, dword[esp + 24]  ; a
+    add eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 12]  ; d
+    add eax, ebx
+    add esp, 44    ; release local variables
+    ret 
+; [ function: func8(int p, int q) ]
+func8:
+    sub esp, 40    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _licm30 = [esp + 8], dword
+    ; i = [esp + 12], dword
+    ; _licm29 = [esp + 16], dword
+    ; d = [esp + 20], dword
+    ; a = [esp + 28], dword
+    ; c = [esp + 32], dword
+    ; _licm31 = [esp + 24], dword
+    ; b = [esp + 36], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 452
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 28], eax
+; line 453
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 36], eax
+; line 454
+    mov eax, 52
+    mov dword[esp + 32], eax
+; line 455
+    mov eax, 90
+    mov dword[esp + 20], eax
+; line 456
+    and eax, 31
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 40]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov edx, 74
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    add eax, 42
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 28], eax
+; line 457
+    mov eax, dword[esp + 4]  ; p
+    sub eax, dword[esp + 36]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    and eax, dword[esp + 8]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    and eax, 24
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov esi, dword[esp + 28]  ; d
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 28], eax
+; line 458
+    mov eax, dword[esp]  ; q
+    and eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    sub eax, 93
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    add eax, 85
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    imul eax, 89
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 459
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp + 36]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, 72
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov edx, dword[esp + 36]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    lea eax, [eax + eax * 2]
+    lea eax, [eax + eax * 8]
+    shl eax, 1
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 28], eax
+; condition checking, line 460
+    cmp dword[esp + 20], 14
+    jge .else_label1
+; line 461
+    mov eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov ecx, dword[esp + 24]  ; d
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 44]  ; b
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+    jmp .exit_if1
+.else_label1:
+; line 463
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 40]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov edx, dword[esp + 24]  ; d
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov esi, dword[esp + 12]  ; p
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 36], eax
+.exit_if1:
+; line 465
+    mov eax, dword[esp + 20]  ; d
+    xor eax, dword[esp + 36]  ; b
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 24]  ; d
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, dword[esp + 4]  ; q
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    sub eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+; line 467
+    mov eax, dword[esp + 4]  ; p
+    sub eax, dword[esp + 36]  ; b
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, 19
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 8]  ; p
+    sub eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, dword[esp + 8]  ; q
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 16], eax
+; for loop, line 466
+; line 466
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop1:
+; condition checking, line 466
+    cmp dword[esp + 12], 2
+    jge .exit_for_loop1
+; line 467
+    mov eax, dword[esp + 16]  ; assignment _licm29
+    mov dword[esp + 20], eax
+; line 466
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 469
+    mov eax, dword[esp + 28]  ; a
+    mov ebx, dword[esp + 4]  ; p
+    mul ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    or eax, 53
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    or eax, 28
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    and eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; line 470
+    mov eax, dword[esp + 36]  ; b
+    or eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 40]  ; b
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 24]  ; d
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, 40
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; condition checking, line 471
+    cmp dword[esp + 36], 28
+    jge .else_label2
+; line 472
+    mov eax, dword[esp + 32]  ; c
+    add eax, dword[esp + 4]  ; p
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, eax
+    shl eax, 5
+    sub eax, ecx
+    shl eax, 1
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, dword[esp + 40]  ; b
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, 32
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if2
+.else_label2:
+; line 474
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, 32
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov edx, 72
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 40]  ; c
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 32], eax
+.exit_if2:
+; line 476
+    mov eax, dword[esp + 4]  ; p
+    and eax, 97
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    mov ecx, dword[esp + 8]  ; p
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    or eax, 90
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    and eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 28], eax
+; line 477
+    sub eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    or eax, dword[esp + 40]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    and eax, 97
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov esi, dword[esp + 44]  ; b
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 36], eax
+; line 478
+    mov eax, dword[esp + 20]  ; d
+    mov ebx, dword[esp + 28]  ; a
+    mul ebx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, dword[esp + 40]  ; c
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+; line 480
+    mov eax, dword[esp + 20]  ; d
+    sub eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 24]  ; d
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 8], eax
+; line 480
+    xor edx, edx
+    mov eax, dword[esp + 4]  ; p
+    mov ebx, 3
+    and eax, ebx
+    mov dword[esp + 24], eax
+; for loop, line 479
+; line 479
+    mov eax, 0
+    mov dword[esp + 12], eax
+.for_loop3:
+; condition checking, line 479
+    cmp dword[esp + 12], 19
+    jge .exit_for_loop3
+; line 480
+    xor edx, edx
+    mov eax, dword[esp + 20]  ; d
+    and eax, dword[esp + 36]  ; b
+    push eax
+    mov eax, dword[esp + 12]  ; _licm30
+    mov ecx, dword[esp + 28]  ; _licm31
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 36], eax
+; line 479
+    inc dword[esp + 12]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 482
+    cmp dword[esp + 32], 73
+    jge .else_label3
+; line 483
+    mov eax, dword[esp + 32]  ; c
+    and eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, dword[esp + 40]  ; b
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    sub eax, 38
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov esi, dword[esp + 12]  ; p
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 20], eax
+    jmp .exit_if3
+.else_label3:
+; line 485
+    mov eax, dword[esp + 4]  ; p
+    xor eax, dword[esp + 36]  ; b
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, dword[esp + 36]  ; c
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    or eax, 6
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 8]  ; q
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 32], eax
+.exit_if3:
+; line 487
+    mov eax, dword[esp + 28]  ; a
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    or eax, dword[esp + 8]  ; q
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 20], eax
+; line 488
+    or eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    sub eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    sub eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; line 489
+    sub eax, 68
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    sub eax, 50
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    sub eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    sub eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 36], eax
+; line 490
+    and eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 40]  ; b
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov edx, 42
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 8]  ; q
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+; condition checking, line 491
+    mov eax, dword[esp + 4]
+    cmp dword[esp + 36], eax
+    jge .else_label4
+; line 492
+    mov eax, dword[esp + 4]  ; p
+    or eax, dword[esp + 20]  ; d
+    push eax
+    mov eax, dword[esp + 40]  ; b
+    mov ecx, dword[esp + 4]  ; q
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 24]  ; d
+    sub eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov esi, dword[esp + 28]  ; d
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 36], eax
+    jmp .exit_if4
+.else_label4:
+; line 494
+    mov eax, dword[esp + 32]  ; c
+    and eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 36]  ; c
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov edx, 94
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov esi, dword[esp + 36]  ; a
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 20], eax
+.exit_if4:
+; line 496
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 36]  ; b
+    add eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 20]  ; d
+    add eax, ebx
+    add esp, 40    ; release local variables
+    ret 
+; [ function: func9(int p, int q) ]
+func9:
+    sub esp, 44    ; allocate space for local variables
+    ; q = [esp], dword
+    ; p = [esp + 4], dword
+    ; _licm32 = [esp + 8], dword
+    ; i = [esp + 16], dword
+    ; d = [esp + 24], dword
+    ; a = [esp + 28], dword
+    ; c = [esp + 32], dword
+    ; _licm34 = [esp + 36], dword
+    ; _licm33 = [esp + 12], dword
+    ; _vn8 = [esp + 20], dword
+    ; b = [esp + 40], dword
+    mov dword[esp + 4], ecx    ; p
+    mov dword[esp], edx    ; q
+; line 502
+    mov eax, dword[esp + 4]  ; assignment p
+    mov dword[esp + 28], eax
+; line 503
+    mov eax, dword[esp]  ; assignment q
+    mov dword[esp + 40], eax
+; line 504
+    mov eax, 74
+    mov dword[esp + 32], eax
+; line 505
+    mov eax, 94
+    mov dword[esp + 24], eax
+; line 506
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    mov dword[esp + 20], eax
+; line 506
+    mov eax, dword[esp + 24]  ; d
+    xor eax, 92
+    add eax, dword[esp + 20]  ; _vn8
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    or eax, dword[esp + 28]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; d
+    xor eax, dword[esp + 36]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 32], eax
+; line 507
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    or eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov edx, dword[esp + 44]  ; b
+    mul edx
+    mov edx, dword[esp + 24]  ; _vn8
+    mul edx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; line 508
+    mov eax, dword[esp + 40]  ; b
+    and eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    and eax, dword[esp + 28]  ; d
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    and eax, dword[esp + 28]  ; d
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    sub eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; line 509
+    mov eax, dword[esp + 40]  ; b
+    sub eax, 39
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 4]  ; q
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    and eax, 41
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 48]  ; b
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; condition checking, line 510
+    mov eax, dword[esp + 32]
+    cmp dword[esp + 40], eax
+    jge .else_label1
+; line 511
+    mov eax, dword[esp + 32]  ; c
+    and eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov ecx, dword[esp + 32]  ; a
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    xor eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 12]  ; p
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 24], eax
+    jmp .exit_if1
+.else_label1:
+; line 513
+    mov eax, dword[esp]  ; q
+    or eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, 95
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, dword[esp + 4]  ; q
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 8]  ; q
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 32], eax
+.exit_if1:
+; line 515
+    mov eax, dword[esp + 4]  ; p
+    or eax, dword[esp + 40]  ; b
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, 70
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    xor eax, dword[esp + 44]  ; b
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    xor eax, dword[esp + 48]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov dword[esp + 28], eax
+; line 517
+    mov eax, dword[esp]  ; q
+    add eax, 45
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov ecx, dword[esp + 36]  ; c
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov edx, dword[esp + 36]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 8]  ; q
+    mov esi, dword[esp + 32]  ; d
+    add eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 8], eax
+; for loop, line 516
+; line 516
+    mov eax, 0
+    mov dword[esp + 16], eax
+.for_loop1:
+; condition checking, line 516
+    cmp dword[esp + 16], 31
+    jge .exit_for_loop1
+; line 517
+    mov eax, dword[esp + 8]  ; assignment _licm32
+    mov dword[esp + 40], eax
+; line 516
+    inc dword[esp + 16]    ; ++
+    jmp .for_loop1    ; jmp to for loop
+.exit_for_loop1:
+; line 519
+    mov eax, dword[esp]  ; q
+    sub eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    and eax, 65
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    add eax, dword[esp + 36]  ; c
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    or eax, dword[esp + 12]  ; p
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 32], eax
+; line 520
+    mov eax, dword[esp + 40]  ; b
+    sub eax, dword[esp + 32]  ; c
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, dword[esp + 4]  ; q
+    or eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov edx, 61
+    xor eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, 2
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; condition checking, line 521
+    cmp dword[esp + 40], 45
+    jge .else_label2
+; line 522
+    mov eax, dword[esp]  ; q
+    mov ebx, dword[esp + 40]  ; b
+    mul ebx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov ecx, dword[esp + 44]  ; b
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov edx, dword[esp + 36]  ; c
+    and eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; d
+    mov esi, dword[esp + 36]  ; a
+    and eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+    jmp .exit_if2
+.else_label2:
+; line 524
+    mov eax, dword[esp + 28]  ; a
+    sub eax, 40
+    push eax
+    mov eax, dword[esp + 4]  ; q
+    mov ecx, dword[esp + 36]  ; c
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov edx, dword[esp + 32]  ; a
+    mul edx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 8]  ; q
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+.exit_if2:
+; line 526
+    mov eax, dword[esp]  ; q
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    and eax, 84
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    and eax, dword[esp + 28]  ; d
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    sub eax, 76
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+; line 527
+    mov eax, dword[esp + 28]  ; a
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    add eax, dword[esp + 32]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 36]  ; c
+    mul edx
+    push eax
+    mov eax, dword[esp + 12]  ; p
+    mov esi, 4
+    or eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+; line 528
+    mov eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp]  ; q
+    mul ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, 64
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    and eax, 57
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    lea eax, [eax + eax * 2]
+    shl eax, 4
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 32], eax
+; line 530
+    mov eax, dword[esp + 40]  ; b
+    add eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov ecx, 40
+    add eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 12], eax
+; line 530
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    mov ebx, 46
+    or eax, ebx
+    mov dword[esp + 36], eax
+; for loop, line 529
+; line 529
+    mov eax, 0
+    mov dword[esp + 16], eax
+.for_loop3:
+; condition checking, line 529
+    cmp dword[esp + 16], 44
+    jge .exit_for_loop3
+; line 530
+    mov eax, dword[esp + 24]  ; d
+    add eax, 3
+    push eax
+    mov eax, dword[esp + 16]  ; _licm33
+    mov ecx, dword[esp + 40]  ; _licm34
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov dword[esp + 24], eax
+; line 529
+    inc dword[esp + 16]    ; ++
+    jmp .for_loop3    ; jmp to for loop
+.exit_for_loop3:
+; condition checking, line 532
+    cmp dword[esp + 28], 52
+    jge .else_label3
+; line 533
+    mov eax, dword[esp + 4]  ; p
+    or eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 44]  ; b
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov edx, dword[esp + 28]  ; d
+    mul edx
+    push eax
+    mov eax, dword[esp + 36]  ; a
+    mov esi, dword[esp + 8]  ; q
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+    jmp .exit_if3
+.else_label3:
+; line 535
+    mov eax, dword[esp + 40]  ; b
+    sub eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov ecx, dword[esp + 36]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    mov edx, dword[esp + 36]  ; c
+    sub eax, edx
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    mov esi, dword[esp + 8]  ; q
+    xor eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    mov dword[esp + 24], eax
+.exit_if3:
+; line 537
+    mov eax, dword[esp + 4]  ; p
+    and eax, dword[esp + 28]  ; a
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov ecx, dword[esp + 8]  ; p
+    mul ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    add eax, 17
+    push eax
+    mov eax, dword[esp + 32]  ; d
+    mov esi, dword[esp + 40]  ; c
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 24], eax
+; line 538
+    sub eax, 82
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    sub eax, dword[esp + 36]  ; c
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    xor eax, dword[esp + 8]  ; p
+    push eax
+    mov eax, dword[esp + 40]  ; c
+    sub eax, dword[esp + 36]  ; a
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov dword[esp + 28], eax
+; line 539
+    mov eax, dword[esp + 24]  ; d
+    xor eax, dword[esp + 24]  ; d
+    push eax
+    mov eax, dword[esp + 32]  ; a
+    sub eax, dword[esp + 44]  ; b
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    xor eax, 15
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    and eax, 34
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 32], eax
+; line 540
+    and eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 8]  ; p
+    mov ecx, dword[esp + 36]  ; c
+    and eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov edx, dword[esp + 44]  ; b
+    mul edx
+    push eax
+    mov eax, dword[esp + 32]  ; d
+    mov esi, dword[esp + 40]  ; c
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    add eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 32], eax
+; condition checking, line 541
+    cmp dword[esp + 40], 1
+    jge .else_label4
+; line 542
+    mov eax, dword[esp + 24]  ; d
+    sub eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 36]  ; c
+    mov ecx, 36
+    sub eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    or eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    or eax, dword[esp + 32]  ; a
+    push eax
+    mov eax, dword[esp + 48]  ; b
+    mov esi, dword[esp + 8]  ; q
+    mul esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    and eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    mul ebx
+    mov dword[esp + 40], eax
+    jmp .exit_if4
+.else_label4:
+; line 544
+    mov eax, dword[esp + 32]  ; c
+    and eax, dword[esp]  ; q
+    push eax
+    mov eax, dword[esp + 44]  ; b
+    mov ecx, dword[esp + 32]  ; a
+    xor eax, ecx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    push eax
+    mov eax, dword[esp + 28]  ; d
+    mov edx, dword[esp + 44]  ; b
+    add eax, edx
+    push eax
+    mov eax, dword[esp + 32]  ; d
+    mov esi, dword[esp + 32]  ; d
+    sub eax, esi
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    sub eax, ebx
+    mov ebx, eax   ; copy result to register
+    pop eax    ; pop previous result to register
+    xor eax, ebx
+    mov dword[esp + 24], eax
+.exit_if4:
+; line 546
+    xor edx, edx
+    mov eax, dword[esp + 28]  ; a
+    add eax, dword[esp + 40]  ; b
+    add eax, dword[esp + 32]  ; c
+    mov ebx, dword[esp + 24]  ; d
+    add eax, ebx
+    add esp, 44    ; release local variables
+    ret 
+; [ function: main() ]
+main:
+    push ebp
+    mov ebp, esp
+    sub esp, 12    ; allocate space for local variables, call arguments
+    ; x = [ebp - 4], dword
+; line 552
+    mov eax, 1
+    mov dword[ebp - 4], eax
+; line: 553, func_call: func0
+; line 553
+    mov eax, 69
+    push eax    ; param 2
+; line 553
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func0
+    mov dword[ebp - 4], eax    ; line: 553, assign
+; line: 554, func_call: func1
+; line 554
+    mov eax, 29
+    push eax    ; param 2
+; line 554
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func1
+    mov dword[ebp - 4], eax    ; line: 554, assign
+; line: 555, func_call: func2
+; line 555
+    mov eax, 6
+    push eax    ; param 2
+; line 555
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func2
+    mov dword[ebp - 4], eax    ; line: 555, assign
+; line: 556, func_call: func3
+; line 556
+    mov eax, 95
+    push eax    ; param 2
+; line 556
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func3
+    mov dword[ebp - 4], eax    ; line: 556, assign
+; line: 557, func_call: func4
+; line 557
+    mov eax, 16
+    push eax    ; param 2
+; line 557
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func4
+    mov dword[ebp - 4], eax    ; line: 557, assign
+; line: 558, func_call: func5
+; line 558
+    mov eax, 92
+    push eax    ; param 2
+; line 558
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func5
+    mov dword[ebp - 4], eax    ; line: 558, assign
+; line: 559, func_call: func6
+; line 559
+    mov eax, 71
+    push eax    ; param 2
+; line 559
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func6
+    mov dword[ebp - 4], eax    ; line: 559, assign
+; line: 560, func_call: func7
+; line 560
+    mov eax, 21
+    push eax    ; param 2
+; line 560
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func7
+    mov dword[ebp - 4], eax    ; line: 560, assign
+; line: 561, func_call: func8
+; line 561
+    mov eax, 97
+    push eax    ; param 2
+; line 561
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func8
+    mov dword[ebp - 4], eax    ; line: 561, assign
+; line: 562, func_call: func9
+; line 562
+    mov eax, 46
+    push eax    ; param 2
+; line 562
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov ecx, eax    ; param 1
+    pop edx    ; param 2
+    call func9
+    mov dword[ebp - 4], eax    ; line: 562, assign
+; line 563
+; line 564
+; line 565
+; line 566
+; line 567
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val1]  ; 9.597
+    fmul st1
+    fld dword[float_val2]  ; 0.5
+    fadd st1
+    fstp dword[gfloat]
+; line 568
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val3]  ; 9.633
+    fmul st1
+    fld dword[float_val4]  ; 1.5
+    fadd st1
+    fstp dword[gfloat]
+; line 569
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val5]  ; 2.359
+    fmul st1
+    fld dword[float_val6]  ; 2.5
+    fadd st1
+    fstp dword[gfloat]
+; line 570
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val7]  ; 2.833
+    fmul st1
+    fld dword[float_val8]  ; 3.5
+    fadd st1
+    fstp dword[gfloat]
+; line 571
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val9]  ; 1.474
+    fmul st1
+    fld dword[float_val10]  ; 4.5
+    fadd st1
+    fstp dword[gfloat]
+; line 572
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val11]  ; 5.441
+    fmul st1
+    fld dword[float_val12]  ; 5.5
+    fadd st1
+    fstp dword[gfloat]
+; line 573
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val13]  ; 8.118
+    fmul st1
+    fld dword[float_val14]  ; 6.5
+    fadd st1
+    fstp dword[gfloat]
+; line 574
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val15]  ; 5.595
+    fmul st1
+    fld dword[float_val16]  ; 7.5
+    fadd st1
+    fstp dword[gfloat]
+; line 575
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val17]  ; 8.548
+    fmul st1
+    fld dword[float_val18]  ; 8.5
+    fadd st1
+    fstp dword[gfloat]
+; line 576
+    fld dword[gfloat]  ; gfloat
+    fld dword[float_val19]  ; 2.112
+    fmul st1
+    fld dword[float_val20]  ; 9.5
+    fadd st1
+    fstp dword[gfloat]
+; line: 577, func_call: printf
+; line 577
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val1
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 578, func_call: printf
+; line 578
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val2
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 579, func_call: printf
+; line 579
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val3
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 580, func_call: printf
+; line 580
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val4
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 581, func_call: printf
+; line 581
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val5
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 582, func_call: printf
+; line 582
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val6
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 583, func_call: printf
+; line 583
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val7
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 584, func_call: printf
+; line 584
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val8
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 585, func_call: printf
+; line 585
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val9
+    mov dword[esp], eax    ; param 1
+    call printf
+; line: 586, func_call: printf
+; line 586
+    mov eax, dword[ebp - 4]  ; assignment x
+    mov dword[esp + 4], eax    ; param 2
+    mov eax, string_val10
+    mov dword[esp], eax    ; param 1
+    call printf
+; line 587
+    mov eax, 0
+    mov esp, ebp
+    pop ebp
+    ret 
+
+section .data
+    float_val1 dd 9.597
+    float_val2 dd 0.5
+    float_val3 dd 9.633
+    float_val4 dd 1.5
+    float_val5 dd 2.359
+    float_val6 dd 2.5
+    float_val7 dd 2.833
+    float_val8 dd 3.5
+    float_val9 dd 1.474
+    float_val10 dd 4.5
+    float_val11 dd 5.441
+    float_val12 dd 5.5
+    float_val13 dd 8.118
+    float_val14 dd 6.5
+    float_val15 dd 5.595
+    float_val16 dd 7.5
+    float_val17 dd 8.548
+    float_val18 dd 8.5
+    float_val19 dd 2.112
+    float_val20 dd 9.5
+    string_val1 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x30,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 0 value = %d\n'
+    string_val2 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x31,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 1 value = %d\n'
+    string_val3 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x32,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 2 value = %d\n'
+    string_val4 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x33,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 3 value = %d\n'
+    string_val5 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x34,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 4 value = %d\n'
+    string_val6 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x35,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 5 value = %d\n'
+    string_val7 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x36,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 6 value = %d\n'
+    string_val8 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x37,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 7 value = %d\n'
+    string_val9 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x38,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 8 value = %d\n'
+    string_val10 db 0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x39,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x3D,0x20,0x25,0x64,0x0A,0x00    ; 'string 9 value = %d\n'
+
+
+section .bss
+    struc rec1     ; record rec1 { }
+      .ch1 resb 1
+      .x1 resd 1
+      .f1 resd 1
+      .d1 resq 1
+    endstruc
+    struc rec0     ; record rec0 { }
+      .ch0 resb 1
+      .x0 resd 1
+      .f0 resd 1
+      .d0 resq 1
+    endstruc
+    struc rec3     ; record rec3 { }
+      .ch3 resb 1
+      .f3 resd 1
+      .x3 resd 1
+      .d3 resq 1
+    endstruc
+    struc rec2     ; record rec2 { }
+      .ch2 resb 1
+      .f2 resd 1
+      .x2 resd 1
+      .d2 resq 1
+    endstruc
+    rv1 resb 17
+    gfloat resd 1
+    rv0 resb 17
+    rv3 resb 17
+    rv2 resb 17
+
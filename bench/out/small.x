@@ -0,0 +1,588 @@
+extern void printf(char*, int);
+
+record rec0{
+  int x0;
+  char ch0;
+  float f0;
+  double d0;
+}
+
+rec0 rv0;
+
+record rec1{
+  int x1;
+  char ch1;
+  float f1;
+  double d1;
+}
+
+rec1 rv1;
+
+record rec2{
+  int x2;
+  char ch2;
+  float f2;
+  double d2;
+}
+
+rec2 rv2;
+
+record rec3{
+  int x3;
+  char ch3;
+  float f3;
+  double d3;
+}
+
+rec3 rv3;
+
+int garray[100] = {4170,9971,7203,9325,1,1281,3023,9990,1467,2360,923,3965,1862,3879,3455,
+  6697,3967,9355,5388,8463,4191,3132,6852,5245,2044,4434,8781,2295,273,5344,6704,
+  9139,4173,4572,5586,4306,1403,9391,1981,7783,8007,7159,9682,8027,3134,928,6923,
+  5181,8763,8650,8946,8291,850,8296,390,2730,1698,592,8781,6705,983,5930,4211,
+  6716,9578,4117,5331,1975,6918,2896,3155,1421,6865,7833,8346,4125,182,341,7501,
+  6240,9888,6606,7481,2984,2804,4461,7892,2221,1032,733,4478,4692,9085,961,2936,
+  9033,2877,1194,1300,5247};
+
+float gfloat;
+
+int func0(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 2;
+  d = 9;
+  c = ((q - b) - (c & 57)) & ((d + d) - (p - 53));
+  b = ((q | c) & (a | a)) & ((a & q) + (d ^ d));
+  a = ((c + p) * (c & 65)) ^ ((c * p) & (p + p));
+  c = ((d | c) | (b * p)) * ((q ^ 66) * (d + 78));
+  if(d < 45){
+    b = ((d ^ c) - (p ^ d)) - ((a | a) - (d & 88));
+  }else{
+    c = ((c * p) & (c + q)) | ((p & a) - (c + q));
+  }
+  a = ((p * 23) | (d | 92)) + ((p & 18) + (c + 3));
+  for(i = 0; i < 26; i++){
+    a = ((a ^ d) - (d ^ b)) + ((b - 58) & (q * c));
+  }
+  a = ((p | b) | (p & c)) ^ ((p | d) * (a * 16));
+  a = ((q + a) | (b & a)) & ((d + 8) - (q * b));
+  if(a < 25){
+    a = ((p + 93) & (c ^ 84)) | ((b - b) & (q | a));
+  }else{
+    d = ((a & 4) * (p & d)) * ((b & a) & (a * d));
+  }
+  a = ((p ^ c) - (a + c)) - ((d + 10) | (a + b));
+  a = ((p + 93) & (d & q)) & ((b - 73) | (d | q));
+  a = ((q | 43) - (p & q)) * ((q ^ b) ^ (a & c));
+  for(i = 0; i < 16; i++){
+    b = ((b & 55) * (q | c)) * ((d ^ 18) * (a + 69));
+  }
+  if(c < 3){
+    b = ((q ^ c) + (c - 33)) & ((a ^ d) * (b ^ d));
+  }else{
+    d = ((q - a) ^ (q * d)) * ((p & a) * (q & a));
+  }
+  d = ((d - b) | (q - 89)) | ((d & 19) | (d & 6));
+  a = ((c + c) ^ (d + q)) | ((c - a) & (a | 57));
+  b = ((d * p) & (p | 85)) + ((p | q) ^ (a - p));
+  b = ((c * b) * (a * b)) + ((d & b) ^ (c | b));
+  if(b < a){
+    b = ((b | 88) ^ (q | d)) - ((a - q) & (d ^ b));
+  }else{
+    c = ((a | 52) * (p + a)) * ((p * a) | (c | 24));
+  }
+  return a + b + c + d;
+}
+
+int func1(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 98;
+  d = 5;
+  a = ((b | q) + (p & b)) + ((d * c) * (b ^ q));
+  b = ((a ^ q) * (b - 44)) - ((c * p) + (b & 67));
+  d = ((a * 62) & (b - 89)) & ((p * 16) - (d | a));
+  c = ((d + p) + (b + q)) | ((p + b) * (q + c));
+  if(c < 86){
+    c = ((q - d) ^ (b + 65)) | ((p | c) | (p + p));
+  }else{
+    d = ((p - b) - (b & c)) | ((p & d) | (a ^ b));
+  }
+  d = ((a * d) & (c ^ d)) - ((q ^ d) & (p + c));
+  for(i = 0; i < 45; i++){
+    a = ((d + p) ^ (a - p)) ^ ((p | p) * (b ^ d));
+  }
+  c = ((b ^ b) - (b - d)) | ((q * 6) ^ (d * 72));
+  d = ((b - a) - (d + a)) * ((d | d) ^ (d - p));
+  if(d < a){
+    c = ((p + c) ^ (a - b)) | ((a * c) + (p & 80));
+  }else{
+    b = ((p * p) * (q ^ c)) | ((p & a) + (p + a));
+  }
+  c = ((a & d) + (c + p)) ^ ((c * q) * (q * c));
+  c = ((c + q) * (p ^ a)) & ((p + 72) & (p + d));
+  a = ((a - p) ^ (q | q)) | ((a + 61) - (q & q));
+  for(i = 0; i < 29; i++){
+    d = ((q | p) - (q ^ d)) - ((d - a) ^ (p ^ 84));
+  }
+  if(b < p){
+    c = ((b - q) - (p & b)) | ((q + q) * (a & 93));
+  }else{
+    d = ((a - c) ^ (d + 52)) - ((b ^ q) & (d | c));
+  }
+  d = ((d * c) + (q & 31)) | ((d ^ d) * (a - c));
+  a = ((q ^ d) ^ (c ^ b)) + ((a * 36) - (a - d));
+  a = ((c ^ b) - (c | 24)) ^ ((d * c) + (b - 66));
+  a = ((c | b) - (d & q)) + ((p * a) ^ (b ^ d));
+  if(c < 71){
+    a = ((b + 45) ^ (c - d)) - ((q ^ p) - (p + d));
+  }else{
+    c = ((a * a) ^ (c | b)) | ((d * c) & (a - 12));
+  }
+  return a + b + c + d;
+}
+
+int func2(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 76;
+  d = 31;
+  b = ((q ^ 22) * (c & a)) | ((b * a) + (b + p));
+  c = ((q | a) * (a ^ q)) | ((c + p) | (p | d));
+  d = ((a & a) + (c * d)) | ((d & p) | (d - c));
+  c = ((p | c) - (q + 25)) | ((b - p) - (c & c));
+  if(b < 22){
+    d = ((p * q) | (a | 22)) - ((b & 27) + (c * a));
+  }else{
+    a = ((a ^ d) | (p + 23)) | ((b & d) | (d & 31));
+  }
+  b = ((q * d) ^ (a | 48)) + ((a * p) + (c - c));
+  for(i = 0; i < 28; i++){
+    b = ((c + p) * (b + c)) | ((q - d) | (p ^ b));
+  }
+  c = ((q - 73) * (q + q)) | ((c + q) | (b * a));
+  b = ((b + 90) ^ (c | c)) * ((d + 21) | (a ^ d));
+  if(b < c){
+    d = ((a ^ d) + (p ^ b)) ^ ((d | 92) | (a - d));
+  }else{
+    c = ((p * 26) & (c - p)) ^ ((p | 26) ^ (q + q));
+  }
+  b = ((d | d) | (b | q)) ^ ((b * 10) ^ (b ^ 73));
+  d = ((d & a) | (p * p)) - ((p | d) * (b | 1));
+  c = ((p * p) - (d + 22)) * ((b ^ b) & (b - 14));
+  for(i = 0; i < 7; i++){
+    b = ((d & b) + (c * a)) | ((d * c) * (p - 32));
+  }
+  if(b < b){
+    b = ((d | d) * (c | c)) + ((d ^ 13) * (a ^ 60));
+  }else{
+    d = ((p ^ q) * (c ^ a)) | ((d | q) & (a - 84));
+  }
+  c = ((b ^ d) & (q ^ d)) | ((q - 62) ^ (d + 32));
+  b = ((q ^ 2) | (a ^ c)) & ((b ^ d) * (d + q));
+  c = ((q - b) ^ (d * p)) + ((c * d) - (q ^ b));
+  a = ((a & 14) + (p | 56)) + ((p + b) | (q | 78));
+  if(b < a){
+    c = ((d - 32) - (b ^ q)) - ((q * q) + (b + c));
+  }else{
+    c = ((d * q) - (d * c)) | ((p * 36) & (b + a));
+  }
+  return a + b + c + d;
+}
+
+int func3(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 27;
+  d = 26;
+  d = ((d - 54) ^ (c + b)) ^ ((p - d) - (q & d));
+  d = ((c - d) ^ (p * 5)) + ((b * q) - (c & p));
+  a = ((q * a) & (p - c)) | ((p - 69) * (b & d));
+  b = ((a * a) - (d + c)) & ((d & 17) & (a | a));
+  if(d < b){
+    d = ((c ^ c) * (p + c)) | ((b ^ d) | (p * d));
+  }else{
+    a = ((a | d) - (b ^ p)) | ((d | 6) * (a ^ q));
+  }
+  c = ((d + 47) & (d & c)) ^ ((c & a) ^ (b | d));
+  for(i = 0; i < 22; i++){
+    d = ((b + q) + (a + 94)) * ((p + 62) & (a ^ d));
+  }
+  a = ((d | 67) + (c + 1)) | ((q * 79) | (c & c));
+  a = ((a & 35) + (b + q)) * ((a * q) * (c | d));
+  if(c < q){
+    c = ((c - 44) ^ (d + q)) + ((d + q) ^ (q + d));
+  }else{
+    c = ((a | a) - (b & q)) + ((q & p) | (c | 49));
+  }
+  b = ((d - 37) * (p + p)) + ((c * d) ^ (p & c));
+  a = ((b - 75) * (q + b)) * ((d * c) + (b | 50));
+  a = ((p | 97) + (p * 79)) | ((b - c) - (d - a));
+  for(i = 0; i < 21; i++){
+    b = ((b * d) - (a & 43)) + ((c + d) | (c ^ d));
+  }
+  if(c < q){
+    a = ((q ^ q) ^ (d + a)) | ((c - q) ^ (c * d));
+  }else{
+    b = ((q - a) ^ (a - b)) * ((b | b) - (c | a));
+  }
+  d = ((a + a) - (b * d)) + ((d | 37) ^ (a ^ p));
+  b = ((b * p) * (d & 97)) | ((b * q) - (q | 33));
+  b = ((q + c) | (a * b)) & ((a ^ c) + (d | p));
+  b = ((c & a) & (c + a)) + ((b & p) + (p & d));
+  if(c < a){
+    b = ((d ^ c) ^ (a * b)) & ((q | q) + (a * 51));
+  }else{
+    a = ((a * q) - (a & c)) + ((q | q) - (a * c));
+  }
+  return a + b + c + d;
+}
+
+int func4(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 24;
+  d = 40;
+  d = ((q ^ d) ^ (q | a)) ^ ((c * b) | (q & b));
+  a = ((d ^ p) & (d * a)) - ((c & p) | (a & 78));
+  d = ((d & d) ^ (b & q)) ^ ((b * a) & (q + 30));
+  d = ((d ^ c) + (d * a)) & ((d ^ 28) | (q * b));
+  if(a < b){
+    c = ((d | 89) + (c + q)) ^ ((d ^ b) * (d & d));
+  }else{
+    c = ((d & 30) | (p ^ d)) - ((b & d) + (c - q));
+  }
+  a = ((d & q) & (a | q)) - ((b ^ 9) | (a * a));
+  for(i = 0; i < 47; i++){
+    c = ((q + 20) ^ (p & 64)) - ((q + q) * (d + d));
+  }
+  d = ((b & c) | (d ^ c)) - ((q * b) + (d ^ a));
+  a = ((c ^ p) * (p + b)) + ((c * c) & (p - c));
+  if(c < 68){
+    c = ((p & b) + (q | 78)) | ((q & 80) - (d * b));
+  }else{
+    c = ((p & b) | (c * 10)) * ((a ^ q) - (q | d));
+  }
+  c = ((p & b) + (a - c)) & ((b * 48) | (q | b));
+  c = ((q - p) ^ (p & d)) | ((b * q) ^ (a - q));
+  d = ((q ^ p) | (d ^ a)) * ((q ^ 75) ^ (c | 35));
+  for(i = 0; i < 25; i++){
+    a = ((a & q) + (p ^ c)) ^ ((q & b) ^ (c + q));
+  }
+  if(d < c){
+    c = ((q ^ p) - (a + c)) ^ ((a ^ c) * (b ^ q));
+  }else{
+    d = ((a - a) * (a & p)) + ((c & b) - (a ^ a));
+  }
+  c = ((p & 40) | (q * 97)) & ((a - 83) ^ (b & 31));
+  a = ((a + 34) + (c - q)) + ((q | b) * (a | c));
+  b = ((c - b) ^ (q * c)) + ((b + d) * (c - 72));
+  b = ((b + 18) ^ (p | d)) - ((b * p) & (p - a));
+  if(b < q){
+    b = ((c | b) ^ (d ^ b)) * ((a + b) & (a + d));
+  }else{
+    c = ((a & p) ^ (a ^ q)) & ((a - b) + (b * p));
+  }
+  return a + b + c + d;
+}
+
+int func5(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 98;
+  d = 8;
+  d = ((c * p) * (d & d)) * ((c & p) - (a + a));
+  b = ((b & q) - (c - q)) | ((q & 39) & (p - a));
+  a = ((b * c) + (b & d)) | ((b & p) & (d & c));
+  d = ((p ^ b) | (b ^ 1)) ^ ((c - d) * (a | 97));
+  if(c < a){
+    d = ((c & c) * (a & d)) & ((c | d) | (c | 56));
+  }else{
+    a = ((c & d) ^ (p & q)) & ((c & b) + (a | 52));
+  }
+  a = ((a ^ b) & (a | a)) & ((d | c) & (p ^ 8));
+  for(i = 0; i < 39; i++){
+    b = ((d ^ p) ^ (d * p)) ^ ((d ^ q) | (a - 97));
+  }
+  a = ((c + 97) - (a - c)) | ((q * c) - (c * a));
+  d = ((d | a) + (c + p)) + ((p ^ p) * (b - q));
+  if(b < 31){
+    a = ((q ^ p) & (c ^ q)) ^ ((d * b) | (d * 60));
+  }else{
+    c = ((q & p) * (d + b)) - ((d | q) | (b ^ b));
+  }
+  b = ((q ^ p) ^ (q + a)) - ((a ^ c) + (c - 36));
+  d = ((q & b) - (d & d)) ^ ((a * c) ^ (p ^ 89));
+  d = ((c ^ c) + (q - 97)) & ((b * d) ^ (d ^ a));
+  for(i = 0; i < 39; i++){
+    d = ((c & b) & (c ^ 47)) * ((a + a) - (b & p));
+  }
+  if(c < q){
+    d = ((b * c) + (b & q)) + ((q | 32) - (b - 5));
+  }else{
+    d = ((a ^ a) + (b - d)) & ((b - c) & (c * p));
+  }
+  b = ((c & a) * (c - a)) + ((q - d) ^ (q - q));
+  b = ((q & c) - (q & b)) | ((c & 40) ^ (b * q));
+  c = ((d ^ p) ^ (b + 63)) + ((d ^ q) + (q * 47));
+  a = ((p + q) * (q - p)) & ((q + 32) | (a - a));
+  if(d < 66){
+    d = ((d ^ b) & (q & c)) * ((q * d) & (a ^ 10));
+  }else{
+    b = ((p + 67) * (d - b)) | ((a + b) ^ (b + 70));
+  }
+  return a + b + c + d;
+}
+
+int func6(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 9;
+  d = 34;
+  d = ((b + p) ^ (a + 89)) & ((p ^ q) ^ (c | 37));
+  d = ((a | q) | (p - d)) ^ ((c * d) ^ (d - c));
+  c = ((b & 83) & (d + a)) - ((c - q) * (p * p));
+  c = ((a ^ a) + (a * c)) - ((p | 57) * (d ^ 81));
+  if(a < d){
+    c = ((c ^ 52) * (d | b)) + ((q ^ b) ^ (q | 41));
+  }else{
+    c = ((p * d) - (b & 59)) | ((q ^ q) | (d ^ a));
+  }
+  d = ((c | a) ^ (p - q)) | ((c ^ d) + (p + q));
+  for(i = 0; i < 48; i++){
+    c = ((p * b) * (d - 67)) - ((c - d) ^ (d & a));
+  }
+  d = ((d & d) | (c * d)) + ((c ^ b) * (d * d));
+  a = ((c - d) & (p - q)) + ((a ^ c) - (q + d));
+  if(a < b){
+    c = ((q ^ b) ^ (a - d)) ^ ((d & a) - (b * b));
+  }else{
+    d = ((q ^ q) + (q | b)) * ((d * a) & (b * b));
+  }
+  c = ((q & d) & (d - q)) * ((p + c) - (d | b));
+  a = ((d * b) | (b * p)) * ((q - c) + (d + a));
+  a = ((b | 84) | (a + b)) ^ ((q + d) & (c ^ a));
+  for(i = 0; i < 12; i++){
+    d = ((p - p) * (p & a)) * ((a ^ b) * (q ^ d));
+  }
+  if(d < a){
+    c = ((p * d) * (q - b)) ^ ((b & 74) | (p & a));
+  }else{
+    d = ((p ^ d) | (q & c)) - ((q * 31) ^ (c ^ c));
+  }
+  b = ((b | q) - (d | b)) - ((b * c) ^ (q & q));
+  c = ((c * d) * (c - a)) - ((q | d) | (d & p));
+  a = ((a * q) ^ (c & q)) & ((b ^ b) * (c & b));
+  c = ((p | 48) + (c + a)) + ((c * p) + (b & d));
+  if(a < a){
+    a = ((b - a) * (p - a)) * ((c | a) + (q | a));
+  }else{
+    c = ((q * c) ^ (c ^ d)) ^ ((b * 55) ^ (q * d));
+  }
+  return a + b + c + d;
+}
+
+int func7(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 64;
+  d = 70;
+  c = ((p * 91) - (q + a)) ^ ((p ^ 81) & (a ^ p));
+  d = ((a | c) | (q & b)) * ((q ^ 81) & (q | 36));
+  b = ((c - b) - (p | p)) * ((d * d) ^ (d - c));
+  c = ((a * 77) * (b & c)) ^ ((b + p) ^ (a | d));
+  if(c < b){
+    a = ((q | p) - (a | a)) & ((d | 94) & (b - d));
+  }else{
+    b = ((p - b) & (c | 80)) * ((d + d) * (p ^ 70));
+  }
+  a = ((b & c) ^ (b + q)) * ((p & a) + (a + 92));
+  for(i = 0; i < 19; i++){
+    a = ((c * 62) - (b - a)) + ((c & d) | (b + a));
+  }
+  b = ((b | d) & (c ^ q)) * ((a & d) - (b * b));
+  c = ((q ^ b) ^ (c | q)) & ((p | c) & (p | p));
+  if(a < p){
+    b = ((q - 8) - (p + p)) ^ ((a & c) * (d ^ b));
+  }else{
+    b = ((c ^ q) & (d * d)) - ((d & d) - (d + a));
+  }
+  d = ((a ^ d) ^ (c * a)) - ((c - b) * (d | 94));
+  d = ((q & b) * (a | 2)) + ((q ^ 52) ^ (b | 80));
+  c = ((b & 89) * (p ^ c)) * ((q * a) & (b ^ d));
+  for(i = 0; i < 40; i++){
+    a = ((b * c) | (d - b)) + ((d | p) - (q | 30));
+  }
+  if(d < p){
+    c = ((d * 82) - (c * 54)) & ((c & d) ^ (a ^ p));
+  }else{
+    b = ((q + p) ^ (d & d)) & ((b | q) + (d + a));
+  }
+  d = ((d + 12) * (d + b)) | ((q + q) + (d & q));
+  d = ((q ^ a) - (a | b)) | ((b + 41) ^ (a * d));
+  c = ((p ^ a) * (p - p)) * ((a | c) & (d ^ d));
+  b = ((b & d) & (a ^ b)) ^ ((d | a) | (q | c));
+  if(c < 19){
+    a = ((q - b) - (d + c)) + ((b ^ p) * (p ^ q));
+  }else{
+    b = ((b & 68) + (d * b)) + ((c - 77) * (d | c));
+  }
+  return a + b + c + d;
+}
+
+int func8(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 52;
+  d = 90;
+  a = ((d & 31) - (a + b)) * ((c * 74) | (q + 42));
+  a = ((p - b) ^ (c & p)) ^ ((b & 24) ^ (b ^ d));
+  a = ((q & p) ^ (b - 93)) + ((d + 85) & (a * 89));
+  a = ((q | b) - (c | 72)) * ((b * c) - (c * 54));
+  if(d < 14){
+    a = ((c * d) - (b | d)) & ((b + d) * (q | b));
+  }else{
+    b = ((q ^ a) & (p - b)) + ((c & d) + (b - p));
+  }
+  b = ((d ^ b) - (q * d)) | ((p ^ q) | (a - q));
+  for(i = 0; i < 2; i++){
+    d = ((p - b) & (q | 19)) & ((q - p) - (c ^ q));
+  }
+  a = ((a * p) ^ (c | 53)) & ((c | 28) ^ (c & b));
+  d = ((b | d) ^ (p - b)) + ((q * d) - (p ^ 40));
+  if(b < 28){
+    b = ((c + p) & (p * 62)) - ((d ^ b) + (c - 32));
+  }else{
+    c = ((a + a) & (c & 32)) & ((d & 72) + (q | c));
+  }
+  a = ((p & 97) + (d * p)) - ((a | 90) * (c & p));
+  b = ((a - c) * (b | b)) * ((d & 97) + (b * b));
+  c = ((d * a) | (b * q)) ^ ((d ^ a) | (p & c));
+  for(i = 0; i < 19; i++){
+    b = ((d - c) & (a * d)) - ((p & 3) & (d & b));
+  }
+  if(c < 73){
+    d = ((c & a) - (c ^ b)) * ((q - 38) * (b | p));
+  }else{
+    c = ((p ^ b) | (c ^ c)) & ((d | 6) * (a * q));
+  }
+  d = ((a * q) & (q & a)) + ((a ^ b) + (b | q));
+  c = ((d | c) & (b - c)) * ((d ^ b) - (b - p));
+  b = ((c - 68) + (p - 50)) * ((d - c) ^ (a - p));
+  c = ((b & a) - (a * b)) ^ ((b + 42) ^ (a & q));
+  if(b < p){
+    b = ((p | d) | (b ^ q)) | ((d - a) | (b * d));
+  }else{
+    d = ((c & a) ^ (p * c)) | ((a ^ 94) - (d | a));
+  }
+  return a + b + c + d;
+}
+
+int func9(int p, int q)
+{
+  int a, b, c, d, i;
+  a = p;
+  b = q;
+  c = 74;
+  d = 94;
+  c = ((d ^ 92) + (q * q)) + ((b | d) & (d ^ a));
+  a = ((d ^ a) ^ (p | a)) & ((q * b) * (d * b));
+  c = ((b & c) & (q & d)) * ((p & d) ^ (q - p));
+  a = ((b - 39) ^ (q - q)) & ((c & 41) * (a | b));
+  if(b < c){
+    d = ((c & d) + (d & a)) ^ ((q ^ a) * (q + p));
+  }else{
+    c = ((q | q) | (b - 95)) & ((p ^ q) ^ (b - q));
+  }
+  a = ((p | b) & (a ^ 70)) & ((a ^ b) - (p ^ b));
+  for(i = 0; i < 31; i++){
+    b = ((q + 45) | (d | c)) ^ ((q * c) - (q + d));
+  }
+  c = ((q - c) & (d & 65)) + ((b + c) ^ (a | p));
+  a = ((b - c) - (a | q)) + ((p ^ 61) - (c & 2));
+  if(b < 45){
+    c = ((q * b) & (d & b)) ^ ((d & c) + (d & a));
+  }else{
+    d = ((a - 40) * (q ^ c)) | ((a * a) & (a - q));
+  }
+  c = ((q ^ d) - (a & 84)) ^ ((c & d) + (b - 76));
+  d = ((a * q) | (a + a)) | ((b * c) * (p | 4));
+  c = ((c * q) + (p ^ 64)) + ((a & 57) | (b * 48));
+  for(i = 0; i < 44; i++){
+    d = ((b + q) | (a + 40)) - ((a | 46) * (d + 3));
+  }
+  if(a < 52){
+    d = ((p | q) ^ (p & b)) | ((b * d) | (a ^ q));
+  }else{
+    d = ((b - a) & (d & c)) | ((a - c) + (c ^ q));
+  }
+  d = ((p & a) | (d * p)) + ((p + 17) - (d * c));
+  a = ((d - 82) & (b - c)) + ((c ^ p) * (c - a));
+  c = ((d ^ d) + (a - b)) ^ ((p ^ 15) & (b & 34));
+  c = ((c & q) & (p & c)) * ((d * b) + (d * c));
+  if(b < 1){
+    b = ((d - q) | (c - 36)) * ((d | a) & (b * q));
+  }else{
+    d = ((c & q) - (b ^ a)) ^ ((d + b) - (d - d));
+  }
+  return a + b + c + d;
+}
+
+global int main()
+{
+  int x;
+  x = 1;
+  x = func0(x, 69);
+  x = func1(x, 29);
+  x = func2(x, 6);
+  x = func3(x, 95);
+  x = func4(x, 16);
+  x = func5(x, 92);
+  x = func6(x, 71);
+  x = func7(x, 21);
+  x = func8(x, 97);
+  x = func9(x, 46);
+  rv0.x0 = x;
+  rv1.x1 = x;
+  rv2.x2 = x;
+  rv3.x3 = x;
+  gfloat = gfloat * 9.597 + 0.5;
+  gfloat = gfloat * 9.633 + 1.5;
+  gfloat = gfloat * 2.359 + 2.5;
+  gfloat = gfloat * 2.833 + 3.5;
+  gfloat = gfloat * 1.474 + 4.5;
+  gfloat = gfloat * 5.441 + 5.5;
+  gfloat = gfloat * 8.118 + 6.5;
+  gfloat = gfloat * 5.595 + 7.5;
+  gfloat = gfloat * 8.548 + 8.5;
+  gfloat = gfloat * 2.112 + 9.5;
+  printf("string 0 value = %d\n", x);
+  printf("string 1 value = %d\n", x);
+  printf("string 2 value = %d\n", x);
+  printf("string 3 value = %d\n", x);
+  printf("string 4 value = %d\n", x);
+  printf("string 5 value = %d\n", x);
+  printf("string 6 value = %d\n", x);
+  printf("string 7 value = %d\n", x);
+  printf("string 8 value = %d\n", x);
+  printf("string 9 value = %d\n", x);
+  return 0;
+}
@@ -0,0 +1,433 @@
+/*
+*  bench/run_bench.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Harness for runtime benchmarks of code generated by compiler.
+* Each kernel is compiled by each given compiler at each optimization level,
+* and the binary is run repeatedly. Median of cycles, instructions,
+* branch misses and cache misses is read from perf_event_open counters,
+* wall clock and user time are measured always, so they are used
+* when counters are not permitted.
+* Results are written as JSON, with ratios of each compiler
+* against first compiler for tracking code quality regressions.
+*
+*   run_bench [-n runs] [-c compiler]... [-o out.json] [-O0 -O1...]
+*             [flags...] kernel.x[:input]...
+*
+* input file is given as standard input of kernel binary.
+* arguments starting with - other than above are passed to compilers.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/stat.h>
+#include <linux/perf_event.h>
+
+enum counter_t{
+  CYCLES,
+  INSTRUCTIONS,
+  BRANCH_MISSES,
+  CACHE_MISSES,
+  COUNTER_COUNT
+};
+
+static const char* counter_names[COUNTER_COUNT] = {"cycles", "instructions",
+                                                   "branch_misses", "cache_misses"};
+static const unsigned long long counter_configs[COUNTER_COUNT] = {
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_BRANCH_MISSES,
+  PERF_COUNT_HW_CACHE_MISSES
+};
+
+struct kernel
+{
+  std::string file;
+  std::string input;   //empty if kernel reads no input
+};
+
+//measurements of one kernel built by one compiler at one level
+struct bench_result
+{
+  std::string kernel;
+  std::string compiler;
+  size_t compiler_index = 0;  //index in compilers, 0 is baseline
+  std::string level;
+  bool ok = false;
+  int exit_status = 0;
+  double wall = 0.0;
+  double user = 0.0;
+  bool has_counter[COUNTER_COUNT] = {false, false, false, false};
+  double counters[COUNTER_COUNT] = {0.0, 0.0, 0.0, 0.0};
+};
+
+static bool perf_available = false;
+
+static std::string base_name(std::string path)
+{
+  size_t fnd = path.find_last_of('/');
+  if(fnd != std::string::npos)
+    path = path.substr(fnd + 1);
+  fnd = path.rfind(".x");
+  if(fnd != std::string::npos)
+    path = path.substr(0, fnd);
+  return path;
+}
+
+static bool file_exists(std::string path)
+{
+  struct stat st;
+  return stat(path.c_str(), &st) == 0;
+}
+
+static bool copy_file(std::string src, std::string dest)
+{
+  std::ifstream in(src, std::ios::binary);
+  std::ofstream out(dest, std::ios::binary);
+  if(!in || !out) return false;
+  out<<in.rdbuf();
+  return true;
+}
+
+static double median(std::vector<double> v)
+{
+  if(v.empty()) return 0.0;
+  std::sort(v.begin(), v.end());
+  size_t m = v.size() / 2;
+  if(v.size() % 2 == 0)
+    return (v[m - 1] + v[m]) / 2.0;
+  return v[m];
+}
+
+//run program and wait for it, returns its wait status or -1
+static int run_program(std::vector<std::string>& argv, std::string input,
+                        bool quiet)
+{
+  std::vector<char*> args;
+  int status;
+  pid_t pid = fork();
+  if(pid < 0) return -1;
+  if(pid == 0){
+    if(quiet){
+      int fd = open("/dev/null", O_WRONLY);
+      dup2(fd, STDOUT_FILENO);
+    }
+    if(!input.empty()){
+      int fd = open(input.c_str(), O_RDONLY);
+      if(fd >= 0) dup2(fd, STDIN_FILENO);
+    }
+    for(auto& a : argv)
+      args.push_back(const_cast<char*>(a.c_str()));
+    args.push_back(nullptr);
+    execv(args[0], args.data());
+    perror(args[0]);
+    _exit(127);
+  }
+  if(waitpid(pid, &status, 0) < 0) return -1;
+  return status;
+}
+
+//compiler writes a.out in directory of input file
+static bool compile_kernel(std::string compiler, std::string level,
+                           std::vector<std::string>& flags, std::string source,
+                           std::string binary)
+{
+  std::string dir = source.substr(0, source.find_last_of('/'));
+  std::string aout = dir + "/a.out";
+  std::vector<std::string> argv = {compiler, level};
+  int status;
+
+  argv.insert(argv.end(), flags.begin(), flags.end());
+  argv.push_back(source);
+  remove(aout.c_str());
+  status = run_program(argv, "", true);
+  if(status != 0 || !file_exists(aout))
+    return false;
+  return rename(aout.c_str(), binary.c_str()) == 0;
+}
+
+static int open_counter(pid_t pid, unsigned long long config)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.enable_on_exec = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+/*
+run binary once, child waits on pipe until counters are attached to it,
+so that counting starts at exec of binary
+*/
+static bool measure_run(std::string binary, std::string input,
+                        double* wall, double* user, int* exit_status,
+                        bool has_counter[], double counters[])
+{
+  int sync[2];
+  int fds[COUNTER_COUNT];
+  int status;
+  struct rusage usage;
+  char c;
+  pid_t pid;
+
+  if(pipe(sync) != 0) return false;
+  auto start = std::chrono::steady_clock::now();
+  pid = fork();
+  if(pid < 0) return false;
+  if(pid == 0){
+    close(sync[1]);
+    if(read(sync[0], &c, 1) < 0) _exit(127);
+    close(sync[0]);
+    int fd = open("/dev/null", O_WRONLY);
+    dup2(fd, STDOUT_FILENO);
+    if(!input.empty()){
+      fd = open(input.c_str(), O_RDONLY);
+      if(fd >= 0) dup2(fd, STDIN_FILENO);
+    }
+    execl(binary.c_str(), binary.c_str(), (char*)nullptr);
+    _exit(127);
+  }
+  close(sync[0]);
+  for(int i = 0; i < COUNTER_COUNT; i++)
+    fds[i] = open_counter(pid, counter_configs[i]);
+  close(sync[1]);
+
+  if(wait4(pid, &status, 0, &usage) < 0) return false;
+  *wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  *user = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6;
+
+  for(int i = 0; i < COUNTER_COUNT; i++){
+    unsigned long long value = 0;
+    has_counter[i] = false;
+    if(fds[i] < 0) continue;
+    if(read(fds[i], &value, sizeof(value)) == sizeof(value)){
+      has_counter[i] = true;
+      counters[i] = static_cast<double>(value);
+      perf_available = true;
+    }
+    close(fds[i]);
+  }
+  if(WIFSIGNALED(status)) return false;
+  *exit_status = WEXITSTATUS(status);
+  return true;
+}
+
+static void bench_binary(std::string binary, std::string input, int runs,
+                         bench_result& res)
+{
+  std::vector<double> walls, users;
+  std::vector<double> samples[COUNTER_COUNT];
+  bool has_counter[COUNTER_COUNT];
+  double counters[COUNTER_COUNT];
+  double wall, user;
+
+  //first run warms up caches and is not counted
+  for(int r = 0; r <= runs; r++){
+    if(!measure_run(binary, input, &wall, &user, &res.exit_status,
+                    has_counter, counters)){
+      std::cerr<<"run_bench: "<<res.kernel<<" "<<res.level<<" crashed"<<std::endl;
+      return;
+    }
+    if(r == 0) continue;
+    walls.push_back(wall);
+    users.push_back(user);
+    for(int i = 0; i < COUNTER_COUNT; i++){
+      if(has_counter[i])
+        samples[i].push_back(counters[i]);
+    }
+  }
+  res.ok = true;
+  res.wall = median(walls);
+  res.user = median(users);
+  for(int i = 0; i < COUNTER_COUNT; i++){
+    //counter is reported only if it was read in every run
+    res.has_counter[i] = (samples[i].size() == walls.size());
+    if(res.has_counter[i])
+      res.counters[i] = median(samples[i]);
+  }
+}
+
+static std::string json_string(std::string str)
+{
+  std::string out = "\"";
+  for(char c : str){
+    if(c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out + "\"";
+}
+
+static std::string json_number(double value)
+{
+  std::ostringstream out;
+  out.precision(9);
+  out<<value;
+  return out.str();
+}
+
+static std::string json_ratio(bool ok, double value, double base)
+{
+  if(!ok || base == 0.0) return "null";
+  return json_number(value / base);
+}
+
+static void write_json(std::ostream& out, std::vector<bench_result>& results,
+                       int runs)
+{
+  out<<"{\n";
+  out<<"  \"runs\": "<<runs<<",\n";
+  out<<"  \"perf_counters\": "<<(perf_available ? "true" : "false")<<",\n";
+  out<<"  \"results\": [";
+  for(size_t i = 0; i < results.size(); i++){
+    bench_result& r = results[i];
+    out<<(i > 0 ? ",\n" : "\n");
+    out<<"    {\"kernel\": "<<json_string(r.kernel)
+       <<", \"compiler\": "<<json_string(r.compiler)
+       <<", \"level\": "<<json_string(r.level)
+       <<", \"ok\": "<<(r.ok ? "true" : "false");
+    if(r.ok){
+      out<<", \"exit_status\": "<<r.exit_status
+         <<", \"wall_seconds\": "<<json_number(r.wall)
+         <<", \"user_seconds\": "<<json_number(r.user);
+      for(int c = 0; c < COUNTER_COUNT; c++){
+        out<<", \""<<counter_names[c]<<"\": ";
+        if(r.has_counter[c])
+          out<<json_number(r.counters[c]);
+        else
+          out<<"null";
+      }
+    }
+    out<<"}";
+  }
+  out<<"\n  ],\n";
+
+  //each result of other compilers against same kernel and level of first compiler
+  out<<"  \"comparisons\": [";
+  bool first = true;
+  for(auto& r : results){
+    if(!r.ok || r.compiler_index == 0) continue;
+    for(auto& b : results){
+      if(!b.ok || b.compiler_index != 0 || b.kernel != r.kernel
+          || b.level != r.level)
+        continue;
+      out<<(first ? "\n" : ",\n");
+      first = false;
+      out<<"    {\"kernel\": "<<json_string(r.kernel)
+         <<", \"level\": "<<json_string(r.level)
+         <<", \"compiler\": "<<json_string(r.compiler)
+         <<", \"baseline\": "<<json_string(b.compiler)
+         <<", \"wall_ratio\": "<<json_ratio(true, r.wall, b.wall);
+      for(int c = 0; c < COUNTER_COUNT; c++){
+        out<<", \""<<counter_names[c]<<"_ratio\": "
+           <<json_ratio(r.has_counter[c] && b.has_counter[c],
+                        r.counters[c], b.counters[c]);
+      }
+      out<<"}";
+    }
+  }
+  out<<"\n  ]\n}\n";
+}
+
+int main(int argc, char** argv)
+{
+  std::vector<std::string> compilers;
+  std::vector<std::string> levels;
+  std::vector<std::string> flags;
+  std::vector<struct kernel> kernels;
+  std::vector<bench_result> results;
+  std::string output;
+  int runs = 5;
+  char tmpdir[] = "/tmp/xlang_run_XXXXXX";
+
+  for(int i = 1; i < argc; i++){
+    std::string arg = argv[i];
+    if(arg == "-n" && i + 1 < argc){
+      runs = std::atoi(argv[++i]);
+    }else if(arg == "-c" && i + 1 < argc){
+      compilers.push_back(argv[++i]);
+    }else if(arg == "-o" && i + 1 < argc){
+      output = argv[++i];
+    }else if(arg.compare(0, 2, "-O") == 0){
+      levels.push_back(arg);
+    }else if(arg[0] == '-'){
+      flags.push_back(arg);
+    }else{
+      struct kernel k;
+      size_t fnd = arg.find(':');
+      k.file = arg.substr(0, fnd);
+      if(fnd != std::string::npos)
+        k.input = arg.substr(fnd + 1);
+      kernels.push_back(k);
+    }
+  }
+  if(kernels.empty() || runs < 1){
+    std::cerr<<"usage: run_bench [-n runs] [-c compiler]... [-o out.json] "
+             <<"[-O0 -O1...] [flags...] kernel.x[:input]..."<<std::endl;
+    return 1;
+  }
+  if(compilers.empty())
+    compilers.push_back("build/xlang");
+  if(levels.empty())
+    levels = {"-O0", "-O1"};
+
+  if(mkdtemp(tmpdir) == nullptr){
+    std::cerr<<"run_bench: cannot create temporary directory"<<std::endl;
+    return 1;
+  }
+
+  for(size_t ci = 0; ci < compilers.size(); ci++){
+    for(auto& level : levels){
+      for(auto& k : kernels){
+        bench_result res;
+        std::string name = base_name(k.file);
+        std::string source = std::string(tmpdir) + "/" + name + ".x";
+        std::string binary = std::string(tmpdir) + "/" + name + "_"
+                              + std::to_string(ci) + level;
+        res.kernel = k.file;
+        res.compiler = compilers[ci];
+        res.compiler_index = ci;
+        res.level = level;
+        std::cerr<<compilers[ci]<<" "<<level<<" "<<k.file<<std::endl;
+        if(!copy_file(k.file, source)
+            || !compile_kernel(compilers[ci], level, flags, source, binary)){
+          std::cerr<<"run_bench: failed to compile "<<k.file<<std::endl;
+        }else{
+          bench_binary(binary, k.input, runs, res);
+          remove(binary.c_str());
+        }
+        remove(source.c_str());
+        results.push_back(res);
+      }
+    }
+  }
+  rmdir(tmpdir);
+
+  if(output.empty()){
+    write_json(std::cout, results, runs);
+  }else{
+    std::ofstream out(output);
+    write_json(out, results, runs);
+  }
+  return 0;
+}
@@ -0,0 +1,299 @@
+/*
+*  bench/scale_bench.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Asymptotic scaling test of compiler.
+* Generates programs with bench/gen at 1x, 2x, 4x and 8x size along
+* each axis(string count, globals, functions, nesting depth, expression length),
+* compiles them with -S -ftime-report and fits growth exponent of
+* total time and of peak resident set size(above size of smallest program)
+* on log-log scale. Fails when exponent is above threshold, so that
+* linear scans turning quadratic on large inputs are caught.
+*
+*   scale_bench [-n runs] [-c compiler] [-g generator] [-o dir]
+*               [-t time-exponent] [-m memory-exponent] [flags...]
+*
+* arguments starting with - other than above are passed to compiler.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+//axis of program size, option of generator is scaled from base value
+struct scale_axis
+{
+  std::string name;
+  std::string option;
+  int base;
+  std::vector<std::string> fixed;   //other generator options of axis
+};
+
+//all other sizes are kept small so that axis dominates compile time
+static const std::vector<std::string> small_program = {"functions=1", "statements=1",
+                  "records=0", "strings=0", "floats=0", "array=0"};
+
+static const std::vector<scale_axis> axes = {
+  {"strings", "strings", 400, {}},
+  {"globals", "globals", 400, {}},
+  {"functions", "functions", 50, {"statements=10"}},
+  {"nesting", "nesting", 25, {}},
+  {"expression", "width", 50, {"depth=1", "statements=20"}}
+};
+
+static const std::vector<int> scales = {1, 2, 4, 8};
+
+struct run_result
+{
+  double time = 0.0;
+  long max_rss = 0;   //in kilobytes
+};
+
+/*
+run program with stdout written to file outfile, or collected into output
+when outfile is empty, returns false if it does not exit with 0
+*/
+static bool run_program(std::vector<std::string>& argv, std::string outfile,
+                        std::string& output, long* max_rss)
+{
+  int fd[2];
+  int outfd = -1;
+  pid_t pid;
+  int status;
+  struct rusage usage;
+  std::vector<char*> args;
+  char buf[4096];
+  ssize_t n;
+
+  if(pipe(fd) != 0) return false;
+  if(!outfile.empty()){
+    outfd = open(outfile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(outfd < 0){
+      perror(outfile.c_str());
+      return false;
+    }
+  }
+  pid = fork();
+  if(pid < 0) return false;
+  if(pid == 0){
+    close(fd[0]);
+    dup2(outfd >= 0 ? outfd : fd[1], STDOUT_FILENO);
+    close(fd[1]);
+    for(auto& a : argv)
+      args.push_back(const_cast<char*>(a.c_str()));
+    args.push_back(nullptr);
+    execv(args[0], args.data());
+    perror(args[0]);
+    _exit(127);
+  }
+  close(fd[1]);
+  if(outfd >= 0)
+    close(outfd);
+  while((n = read(fd[0], buf, sizeof(buf))) > 0)
+    output.append(buf, n);
+  close(fd[0]);
+
+  if(wait4(pid, &status, 0, &usage) < 0) return false;
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) return false;
+  if(max_rss != nullptr)
+    *max_rss = usage.ru_maxrss;
+  return true;
+}
+
+//total time from -ftime-report output, negative if not found
+static double get_total_time(std::string output)
+{
+  std::istringstream inp(output);
+  std::string line;
+  while(std::getline(inp, line)){
+    size_t fnd = line.find("total : ");
+    if(fnd != std::string::npos)
+      return std::atof(line.substr(fnd + 8).c_str());
+  }
+  return -1.0;
+}
+
+static double median(std::vector<double> v)
+{
+  if(v.empty()) return 0.0;
+  std::sort(v.begin(), v.end());
+  size_t m = v.size() / 2;
+  if(v.size() % 2 == 0)
+    return (v[m - 1] + v[m]) / 2.0;
+  return v[m];
+}
+
+//slope of least squares line through (log x, log y)
+static double get_exponent(std::vector<double>& x, std::vector<double>& y)
+{
+  double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+  double n = static_cast<double>(x.size());
+  for(size_t i = 0; i < x.size(); i++){
+    double lx = std::log(x[i]);
+    double ly = std::log(std::max(y[i], 1e-9));
+    sx += lx;
+    sy += ly;
+    sxx += lx * lx;
+    sxy += lx * ly;
+  }
+  if(n * sxx - sx * sx == 0.0) return 0.0;
+  return (n * sxy - sx * sy) / (n * sxx - sx * sx);
+}
+
+struct scale_options
+{
+  std::string compiler = "build/xlang";
+  std::string generator = "bench/gen";
+  std::string outdir = "bench/out";
+  std::vector<std::string> flags;
+  int runs = 3;
+  double max_time_exponent = 1.5;
+  double max_memory_exponent = 1.5;
+};
+
+static bool generate(scale_options& opt, std::vector<std::string>& options,
+                     std::string file)
+{
+  std::vector<std::string> argv = {opt.generator};
+  std::string output;
+  argv.insert(argv.end(), options.begin(), options.end());
+  if(!run_program(argv, file, output, nullptr)){
+    std::cerr<<"scale_bench: failed to run "<<opt.generator<<std::endl;
+    return false;
+  }
+  return true;
+}
+
+//median time and maximum peak rss of runs
+static bool compile(scale_options& opt, std::string file, run_result& res)
+{
+  std::vector<std::string> argv = {opt.compiler, "-S", "-ftime-report"};
+  std::vector<double> times;
+  argv.insert(argv.end(), opt.flags.begin(), opt.flags.end());
+  argv.push_back(file);
+
+  res.max_rss = 0;
+  for(int i = 0; i < opt.runs; i++){
+    std::string output;
+    long rss = 0;
+    double t = -1.0;
+    if(run_program(argv, "", output, &rss))
+      t = get_total_time(output);
+    if(t < 0.0){
+      std::cerr<<output;
+      std::cerr<<"scale_bench: failed to compile "<<file<<std::endl;
+      return false;
+    }
+    times.push_back(t);
+    res.max_rss = std::max(res.max_rss, rss);
+  }
+  res.time = median(times);
+  return true;
+}
+
+//returns 0 if axis scales within thresholds, 1 if not, -1 on error
+static int bench_axis(scale_options& opt, const scale_axis& axis, long base_rss)
+{
+  std::vector<double> sizes, times, memory;
+  double time_exp, memory_exp;
+  int failed = 0;
+
+  for(int s : scales){
+    std::vector<std::string> options = small_program;
+    std::string file = opt.outdir+"/scale_"+axis.name+"_"+std::to_string(s)+".x";
+    run_result res;
+    int size = axis.base * s;
+
+    options.insert(options.end(), axis.fixed.begin(), axis.fixed.end());
+    options.push_back(axis.option+"="+std::to_string(size));
+    if(!generate(opt, options, file) || !compile(opt, file, res))
+      return -1;
+    sizes.push_back(s);
+    times.push_back(res.time);
+    memory.push_back(std::max(res.max_rss - base_rss, 1L));
+    std::cout<<"  "<<std::left<<std::setw(12)<<axis.name<<std::right
+             <<std::setw(8)<<size<<std::setw(12)<<std::fixed<<std::setprecision(6)
+             <<res.time<<std::setw(12)<<res.max_rss<<std::endl;
+  }
+
+  time_exp = get_exponent(sizes, times);
+  memory_exp = get_exponent(sizes, memory);
+  std::cout<<"  "<<axis.name<<" : time exponent "<<std::setprecision(2)<<time_exp
+           <<", memory exponent "<<memory_exp<<std::endl;
+  if(time_exp > opt.max_time_exponent){
+    std::cout<<"FAIL: "<<axis.name<<" time exponent "<<time_exp<<" > "
+             <<opt.max_time_exponent<<std::endl;
+    failed = 1;
+  }
+  if(memory_exp > opt.max_memory_exponent){
+    std::cout<<"FAIL: "<<axis.name<<" memory exponent "<<memory_exp<<" > "
+             <<opt.max_memory_exponent<<std::endl;
+    failed = 1;
+  }
+  return failed;
+}
+
+static int bench_all(scale_options& opt)
+{
+  std::vector<std::string> options = small_program;
+  std::string file = opt.outdir+"/scale_base.x";
+  run_result base;
+  int failed = 0, res;
+
+  //peak rss of smallest program is subtracted from all others
+  if(!generate(opt, options, file) || !compile(opt, file, base))
+    return 1;
+
+  std::cout<<"scaling ("<<opt.runs<<" runs, base rss "<<base.max_rss<<" KB)"<<std::endl;
+  std::cout<<"  "<<std::left<<std::setw(12)<<"axis"<<std::right<<std::setw(8)<<"size"
+           <<std::setw(12)<<"time(s)"<<std::setw(12)<<"rss(KB)"<<std::endl;
+  for(auto& axis : axes){
+    res = bench_axis(opt, axis, base.max_rss);
+    if(res < 0) return 1;
+    failed += res;
+  }
+  return failed > 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+  scale_options opt;
+
+  for(int i = 1; i < argc; i++){
+    std::string arg = argv[i];
+    if(arg == "-n" && i + 1 < argc){
+      opt.runs = std::atoi(argv[++i]);
+    }else if(arg == "-c" && i + 1 < argc){
+      opt.compiler = argv[++i];
+    }else if(arg == "-g" && i + 1 < argc){
+      opt.generator = argv[++i];
+    }else if(arg == "-o" && i + 1 < argc){
+      opt.outdir = argv[++i];
+    }else if(arg == "-t" && i + 1 < argc){
+      opt.max_time_exponent = std::atof(argv[++i]);
+    }else if(arg == "-m" && i + 1 < argc){
+      opt.max_memory_exponent = std::atof(argv[++i]);
+    }else if(arg[0] == '-'){
+      opt.flags.push_back(arg);
+    }else{
+      std::cerr<<"usage: scale_bench [-n runs] [-c compiler] [-g generator] [-o dir]"
+               <<" [-t time-exponent] [-m memory-exponent] [flags...]"<<std::endl;
+      return 1;
+    }
+  }
+  if(opt.runs < 1) opt.runs = 1;
+
+  return bench_all(opt);
+}
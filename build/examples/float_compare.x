@@ -0,0 +1,15 @@
+extern void printf(char*);
+
+global void main()
+{
+  double a,b;
+  a = 3.2;
+  b = 1.2;
+  if(a >= b){
+    printf("a is greater than b\n");
+  }else{
+    printf("a is less than b\n");
+  }
+}
+
+
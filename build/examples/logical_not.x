@@ -0,0 +1,76 @@
+extern void printf(char*, int);
+
+/*
+operand of ! is a variable, alone and combined by && and ||
+in conditions of if and while statements.
+output must be same with -O0 and -O1:
+  a = 1
+  b = 3
+  c = 1
+  d = 4
+  n = 3
+  m = 2
+*/
+
+int g;
+
+global int main()
+{
+  int z, i, a, b, c, d, n, m;
+  z = 0;
+  i = 17;
+  g = 2;
+  a = 0;
+  b = 0;
+  c = 0;
+  d = 0;
+  if(!z){
+    a = 1;
+  }
+  if(!i){
+    a = 5;
+  }
+  if(!z || i == 17){
+    b = b + 1;
+  }
+  if(i == 3 || !z){
+    b = b + 2;
+  }
+  if(!i || i == 3){
+    b = b + 4;
+  }
+  if(!z && i == 17){
+    c = 1;
+  }
+  if(i == 17 && !i){
+    c = 9;
+  }
+  if(!g){
+    d = 8;
+  }else{
+    d = 4;
+  }
+  n = 0;
+  while(!z){
+    n++;
+    if(n == 3){
+      z = 1;
+    }
+  }
+  m = 0;
+  while(!z && m < 5){
+    m++;
+  }
+  z = 0;
+  while(m < 5 && !z){
+    m = m + 2;
+    z = m;
+  }
+  printf("a = %d\n", a);
+  printf("b = %d\n", b);
+  printf("c = %d\n", c);
+  printf("d = %d\n", d);
+  printf("n = %d\n", n);
+  printf("m = %d\n", m);
+  return 0;
+}
@@ -0,0 +1,23 @@
+extern void printf(char*, int);
+int x,y;
+
+global void main()
+{
+  int a,b,c,d,e;
+  int *ptr;
+  a+b+c;
+  1.2+1.2*3.4;
+  ptr = &a;
+  1+2+3+4+5;
+  (a+b)*(a+b);
+  d = (1+2)*(4-2)*(5+4)-(8/2);
+  printf("d = %d\n", d);
+  a*512-4;
+  32/4;
+}
+
+int getx(){
+  return x;
+}
+
+
@@ -0,0 +1,35 @@
+extern void printf(char*, int);
+
+/*
+loop index is replaced by literal when loops are fully unrolled by
+-O1 -funroll-loops, giving compare of literal with variable.
+output must be same with -O0, -O1 and -O1 -funroll-loops:
+  x = 7
+  y = 2
+*/
+
+int g2;
+
+global int main()
+{
+  int i0, i1, x, y;
+  g2 = 5;
+  x = 1;
+  y = 1;
+  for(i0 = 1; i0 < 2; i0++){
+    if(x > i0 || i0 < g2){
+      x = 7;
+    }
+  }
+  for(i1 = 0; i1 < 3; i1++){
+    if(i1 > g2){
+      y = 9;
+    }
+    if(i1 >= 2){
+      y = y + 1;
+    }
+  }
+  printf("x = %d\n", x);
+  printf("y = %d\n", y);
+  return 0;
+}
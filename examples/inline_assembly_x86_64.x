@@ -0,0 +1,33 @@
+extern void printf(char*, int);
+
+/*
+inline assembly operands with --target=x86_64,
+memory operands are addressed relative to rbp and
+register constraints are 64 bit registers.
+output must be same with -O0 and -O1:
+  a = 42
+  b = 43
+  g = 8
+*/
+
+int g;
+
+global int main()
+{
+  int a, b;
+  a = 0;
+  b = 0;
+  g = 5;
+
+  asm{"\tmov %, 42" ["=m"(a):],
+      "\tmovsxd %, %" ["=a"():"m"(a)],
+      "\tlea %, [rax + 1]" ["=c"():],
+      "\tmov %, ecx" ["=m"(b):],
+      "\tadd %, 3" ["=m"(g):]
+     }
+
+  printf("a = %d\n", a);
+  printf("b = %d\n", b);
+  printf("g = %d\n", g);
+  return 0;
+}
@@ -0,0 +1,41 @@
+extern void printf(char*, int);
+
+/*
+self tail calls with accumulator turned into loop by -O1,
+base case returns are compound expressions.
+output must be same with -O0 and -O1:
+  prod = 480
+  sum = 817
+*/
+
+int prod(int n, int k)
+{
+  int t;
+  if(n <= 1){
+    return k + n + 1;
+  }
+  t = prod(n - 1, k);
+  t = t * n;
+  return t;
+}
+
+int sum(int p1, int z)
+{
+  int t;
+  if(p1 <= 3){
+    return z & p1 - 255;
+  }
+  t = sum(p1 - 1, z);
+  t = t + p1;
+  return t;
+}
+
+global int main()
+{
+  int r;
+  r = prod(5, 2);
+  printf("prod = %d\n", r);
+  r = sum(10, 1000);
+  printf("sum = %d\n", r);
+  return 0;
+}
@@ -0,0 +1,344 @@
+/*
+*  src/cost.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains static cost estimate of generated x86 instructions,
+* latency/throughput of each instruction is taken from table of
+* a generic out of order core, and summed over basic blocks and loops.
+* loops are found by backward jumps to labels in same function,
+* inner loops are counted once in cost of one iteration of outer loop.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include "cost.hpp"
+
+xlang::cost::cost(std::vector<struct insn*>& insns, xlang::insn_class* ic)
+  : instructions(insns), insncls(ic)
+{
+}
+
+//latency, reciprocal throughput of register form of instruction
+struct xlang::insn_cost xlang::cost::get_table_cost(insn_t type)
+{
+  switch(type){
+    case MOV : case MOVZX : case NOP :
+      return {1, 0.25};
+    case ADD : case SUB : case INC : case DEC : case NEG : case NOT :
+    case AND : case OR : case XOR : case CMP : case TEST :
+      return {1, 0.25};
+    case SHL : case SHR : case SAR : case LEA : case CDQ :
+      return {1, 0.5};
+    case MUL : case IMUL :
+      return {3, 1.0};
+    case DIV : case IDIV :
+      return {26, 6.0};
+    case JMP :
+      return {1, 1.0};
+    case JE : case JNE : case JA : case JNA : case JAE : case JNAE :
+    case JB : case JNB : case JBE : case JNBE : case JG : case JGE :
+    case JNG : case JNGE : case JL : case JLE : case JNL : case JNLE :
+      return {1, 0.5};
+    case LOOP :
+      return {7, 5.0};
+    case SETE : case SETNE : case SETA : case SETAE : case SETB :
+    case SETBE : case SETG : case SETGE : case SETL : case SETLE :
+    case CMOVE : case CMOVNE : case CMOVA : case CMOVAE : case CMOVB :
+    case CMOVBE : case CMOVG : case CMOVGE : case CMOVL : case CMOVLE :
+      return {1, 0.5};
+    case PUSH : case POP :
+      return {3, 1.0};
+    case PUSHA : case POPA :
+      return {8, 8.0};
+    case CALL :
+      return {3, 2.0};
+    case RET :
+      return {2, 1.0};
+
+    case FLD : case FXCH : case FFREE : case FNOP :
+      return {1, 0.5};
+    case FILD :
+      return {6, 1.0};
+    case FST : case FSTP :
+      return {4, 1.0};
+    case FIST : case FISTP :
+      return {7, 1.0};
+    case FADD : case FIADD : case FSUB : case FSUBR : case FISUB : case FISUBR :
+      return {3, 1.0};
+    case FMUL : case FIMUL :
+      return {5, 1.0};
+    case FDIV : case FDIVR : case FIDIV : case FIDIVR :
+      return {15, 4.0};
+    case FCOM : case FCOMP : case FCOMPP : case FICOM : case FICOMP :
+    case FCOMI : case FCOMIP : case FTST : case SAHF :
+      return {1, 1.0};
+    case FSTSW : case FNSTSW :
+      return {2, 1.0};
+    case FINIT : case FNINIT :
+      return {80, 80.0};
+    case FSAVE : case FNSAVE : case FRSTOR :
+      return {150, 150.0};
+
+    case MOVSS : case MOVSD : case MOVAPS : case MOVD : case MOVDQA :
+    case MOVDQU : case MOVUPS :
+      return {1, 0.33};
+    case ADDSS : case ADDSD : case SUBSS : case SUBSD : case ADDPS : case SUBPS :
+    case MULSS : case MULSD : case MULPS :
+      return {4, 0.5};
+    case DIVSS : case DIVPS :
+      return {11, 3.0};
+    case DIVSD :
+      return {14, 4.0};
+    case COMISS : case COMISD :
+      return {3, 1.0};
+    case CVTSS2SD : case CVTSD2SS : case CVTSI2SS : case CVTSI2SD :
+    case CVTTSS2SI : case CVTTSD2SI :
+      return {5, 1.0};
+    case CVTDQ2PS :
+      return {4, 0.5};
+    case PADDD : case PSUBD : case PAND : case POR : case PXOR :
+      return {1, 0.33};
+    case PMULUDQ :
+      return {5, 0.5};
+    case PSLLD : case PSRLD : case PSLLQ : case PSRLQ :
+      return {1, 0.5};
+    case PUNPCKLDQ : case PUNPCKLQDQ : case PUNPCKHQDQ :
+      return {1, 1.0};
+
+    default :
+      return {0, 0.0};
+  }
+}
+
+//returns true if memory operand of instruction is only written
+bool xlang::cost::is_store(insn_t type)
+{
+  switch(type){
+    case MOV : case MOVSS : case MOVSD : case MOVAPS : case MOVD :
+    case MOVDQA : case MOVDQU : case MOVUPS : case POP :
+    case FST : case FSTP : case FIST : case FISTP : case FSTSW : case FNSTSW :
+    case FSAVE : case FNSAVE :
+    case SETE : case SETNE : case SETA : case SETAE : case SETB :
+    case SETBE : case SETG : case SETGE : case SETL : case SETLE :
+      return true;
+    default :
+      return false;
+  }
+}
+
+/*
+memory operand that is read adds load latency,
+read-modify-write of memory also stores the result
+*/
+struct xlang::insn_cost xlang::cost::get_cost(struct insn* in)
+{
+  struct insn_cost c = {0, 0.0};
+  if(in == nullptr || in->insn_type < 0) return c;
+
+  c = get_table_cost(in->insn_type);
+  //address is only computed by lea
+  if(in->insn_type == LEA) return c;
+  if(in->operand_count > 0 && in->operand_1 != nullptr
+     && in->operand_1->type == MEMORY){
+    if(is_store(in->insn_type)){
+      c.throughput = std::max(c.throughput, 1.0);
+    }else if(in->operand_count == 1 || in->insn_type == CMP || in->insn_type == TEST){
+      c.latency += COST_LOAD_LATENCY;
+      c.throughput = std::max(c.throughput, 0.5);
+    }else{
+      c.latency += COST_LOAD_LATENCY + 1;
+      c.throughput = std::max(c.throughput, 1.0);
+    }
+  }
+  if(in->operand_count > 1 && in->operand_2 != nullptr
+     && in->operand_2->type == MEMORY){
+    c.latency += COST_LOAD_LATENCY;
+    c.throughput = std::max(c.throughput, 0.5);
+  }
+  return c;
+}
+
+void xlang::cost::add_cost(struct block_cost& total, struct insn* in)
+{
+  struct insn_cost c;
+  if(in->insn_type < 0) return;
+  c = get_cost(in);
+  total.insn_count++;
+  total.latency += c.latency;
+  total.throughput += c.throughput;
+}
+
+std::string xlang::cost::get_cost_text(struct block_cost& total)
+{
+  std::ostringstream str;
+  str<<total.insn_count<<" insns, latency "<<total.latency
+     <<", throughput "<<std::fixed<<std::setprecision(2)<<total.throughput
+     <<" cycles";
+  return str.str();
+}
+
+struct xlang::insn* xlang::cost::get_comment(std::string cmnt)
+{
+  struct insn* in = insncls->get_insn_mem();
+  in->insn_type = INSNONE;
+  in->operand_count = 0;
+  in->comment = cmnt;
+  insncls->delete_operand(&(in->operand_1));
+  insncls->delete_operand(&(in->operand_2));
+  in->operand_1 = nullptr;
+  in->operand_2 = nullptr;
+  return in;
+}
+
+//source line from nearest "line N" comment before index, 0 if not found
+int xlang::cost::get_line(size_t start, size_t index)
+{
+  size_t fnd;
+  std::string str;
+  while(index > start){
+    index--;
+    if(instructions[index]->insn_type != INSNONE) continue;
+    str = instructions[index]->comment;
+    fnd = str.rfind("line");
+    if(fnd == std::string::npos) continue;
+    fnd += 4;
+    while(fnd < str.size() && (str[fnd] == ':' || str[fnd] == ' '))
+      fnd++;
+    if(fnd < str.size() && isdigit(str[fnd]))
+      return std::atoi(str.substr(fnd).c_str());
+  }
+  return 0;
+}
+
+/*
+annotate instructions of function in [start, end),
+comments to insert are collected before/after index of instruction
+*/
+void xlang::cost::annotate_function(size_t start, size_t end,
+                  std::map<size_t, std::vector<struct insn*>>& before,
+                  std::map<size_t, std::vector<struct insn*>>& after)
+{
+  std::map<std::string, size_t> labels;
+  std::map<size_t, size_t> backedges;
+  std::map<std::string, size_t>::iterator lit;
+  struct block_cost block = {0, 0, 0.0};
+  struct loop_cost loop;
+  struct insn_cost c;
+  struct insn* in = nullptr;
+  std::ostringstream str;
+  size_t block_start = start;
+  bool cold = false;
+
+  for(size_t i = start; i < end; i++){
+    if(instructions[i]->insn_type == INSLABEL)
+      labels[instructions[i]->label] = i;
+  }
+
+  for(size_t i = start; i < end; i++){
+    in = instructions[i];
+
+    //block ends before label, and after jump/return
+    if(in->insn_type == INSLABEL && i > block_start){
+      if(block.insn_count > 0)
+        before[i].push_back(get_comment("    ; block cost: "+get_cost_text(block)));
+      block = {0, 0, 0.0};
+      block_start = i;
+    }
+    //cold blocks after return jump back into function
+    if(in->insn_type == INSNONE && in->comment == "; cold code")
+      cold = true;
+    if(in->insn_type < 0) continue;
+
+    c = get_cost(in);
+    str.str("");
+    str<<"lat "<<c.latency<<", tp "<<std::fixed<<std::setprecision(2)<<c.throughput;
+    if(in->comment.empty())
+      in->comment = "  ; "+str.str();
+    else
+      in->comment += " ; "+str.str();
+    add_cost(block, in);
+
+    if(insncls->is_jump(in->insn_type) || in->insn_type == RET){
+      after[i].push_back(get_comment("    ; block cost: "+get_cost_text(block)));
+      block = {0, 0, 0.0};
+      block_start = i + 1;
+
+      //backward jump to label of same function is end of loop
+      if(!cold && in->insn_type != RET && in->operand_1 != nullptr
+         && in->operand_1->type == LITERAL){
+        lit = labels.find(in->operand_1->literal);
+        if(lit != labels.end() && lit->second < i)
+          backedges[lit->second] = i;
+      }
+    }
+  }
+
+  for(auto& b : backedges){
+    loop.function = instructions[start]->label;
+    loop.label = instructions[b.first]->label;
+    loop.line = get_line(start, b.first);
+    loop.total = {0, 0, 0.0};
+    for(size_t i = b.first; i <= b.second; i++)
+      add_cost(loop.total, instructions[i]);
+    before[b.first].push_back(get_comment("    ; loop cost, line "+std::to_string(loop.line)
+                              +", per iteration: "+get_cost_text(loop.total)));
+    loops.push_back(loop);
+  }
+}
+
+void xlang::cost::annotate()
+{
+  std::map<size_t, std::vector<struct insn*>> before;
+  std::map<size_t, std::vector<struct insn*>> after;
+  std::vector<struct insn*> result;
+  size_t start = instructions.size();
+
+  //function starts at label which is not local(.label)
+  for(size_t i = 0; i <= instructions.size(); i++){
+    if(i == instructions.size() || (instructions[i]->insn_type == INSLABEL
+       && !instructions[i]->label.empty() && instructions[i]->label[0] != '.')){
+      if(start < i)
+        annotate_function(start, i, before, after);
+      start = i;
+    }
+  }
+
+  for(size_t i = 0; i < instructions.size(); i++){
+    if(before.find(i) != before.end())
+      result.insert(result.end(), before[i].begin(), before[i].end());
+    result.push_back(instructions[i]);
+    if(after.find(i) != after.end())
+      result.insert(result.end(), after[i].begin(), after[i].end());
+  }
+  instructions.swap(result);
+}
+
+void xlang::cost::print_summary()
+{
+  std::vector<struct loop_cost> sorted = loops;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const struct loop_cost& a, const struct loop_cost& b){
+              return a.total.throughput > b.total.throughput;
+            });
+  if(sorted.size() > COST_SUMMARY_LOOPS)
+    sorted.resize(COST_SUMMARY_LOOPS);
+
+  std::cerr<<"most expensive loops, estimated cycles per iteration:"<<std::endl;
+  if(sorted.empty()){
+    std::cerr<<"  (none)"<<std::endl;
+    return;
+  }
+  std::cerr<<"  "<<std::left<<std::setw(20)<<"function"<<std::setw(20)<<"loop"
+           <<std::right<<std::setw(6)<<"line"<<std::setw(8)<<"insns"
+           <<std::setw(10)<<"latency"<<std::setw(12)<<"throughput"<<std::endl;
+  for(auto& l : sorted){
+    std::cerr<<"  "<<std::left<<std::setw(20)<<l.function<<std::setw(20)<<l.label
+             <<std::right<<std::setw(6)<<l.line<<std::setw(8)<<l.total.insn_count
+             <<std::setw(10)<<l.total.latency<<std::setw(12)<<std::fixed
+             <<std::setprecision(2)<<l.total.throughput<<std::endl;
+  }
+}
@@ -0,0 +1,80 @@
+/*
+*  src/cost.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in cost.cpp file by class cost,
+* static cost estimate of generated instructions used by --annotate-cost.
+*/
+
+#ifndef COST_HPP
+#define COST_HPP
+
+#include <vector>
+#include <string>
+#include <map>
+#include "insn.hpp"
+
+//latency of load from L1 cache, added for memory operand that is read
+#define COST_LOAD_LATENCY 4
+//count of most expensive loops printed in summary
+#define COST_SUMMARY_LOOPS 10
+
+namespace xlang{
+
+//latency in cycles and reciprocal throughput(cycles per instruction)
+struct insn_cost
+{
+  int latency;
+  double throughput;
+};
+
+//total cost of instructions of a basic block or of one loop iteration
+struct block_cost
+{
+  int insn_count;
+  int latency;
+  double throughput;
+};
+
+struct loop_cost
+{
+  std::string function;
+  std::string label;
+  int line;
+  struct block_cost total;
+};
+
+class cost
+{
+public:
+  cost(std::vector<struct insn*>&, xlang::insn_class*);
+  //attach cost of each instruction, basic block and loop as comments
+  void annotate();
+  //print most expensive loops on stderr
+  void print_summary();
+
+  //cost of instruction on a generic out of order core(Skylake like)
+  static struct insn_cost get_cost(struct insn*);
+
+private:
+  std::vector<struct insn*>& instructions;
+  xlang::insn_class* insncls;
+  std::vector<struct loop_cost> loops;
+
+  static struct insn_cost get_table_cost(insn_t);
+  static bool is_store(insn_t);
+  int get_line(size_t, size_t);
+  std::string get_cost_text(struct block_cost&);
+  struct insn* get_comment(std::string);
+  void add_cost(struct block_cost&, struct insn*);
+  void annotate_function(size_t, size_t,
+                         std::map<size_t, std::vector<struct insn*>>&,
+                         std::map<size_t, std::vector<struct insn*>>&);
+};
+
+}
+
+#endif
+
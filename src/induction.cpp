@@ -0,0 +1,1068 @@
+/*
+*  src/induction.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains strength reduction of induction variables over the abstract syntax tree.
+* In a for loop whose index i is an int local changed only by the step
+* expression(i++, i--, i += c, i -= c, i = i +/- c), derived induction
+* variables i * s and i * s + b, where s and b are integer literals or
+* int locals not modified in loop, are kept in temporaries.
+* Temporary is initialized before the loop and incremented by step * s
+* at end of loop body, and each i * s (+ b) in body is replaced by it,
+* so multiplication in every iteration becomes an addition.
+* If index is then used only by loop itself and stride is a literal,
+* index is removed: temporary is initialized, tested and stepped
+* by the for loop instead of index.
+* Loops having labels, goto, continue or inline assembly are not touched.
+*/
+
+#include "tree.hpp"
+#include "symtab.hpp"
+#include "parser.hpp"
+#include "convert.hpp"
+#include "stats.hpp"
+#include "induction.hpp"
+
+using namespace xlang;
+
+//search symbol in function symbol table, parameters and global symbol table
+struct st_symbol_info* xlang::induction::search_id(std::string name)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, name);
+  if(syminfo != nullptr) return syminfo;
+  for(auto fparam : func_symtab->func_info->param_list){
+    if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name)
+      return fparam->symbol_info;
+  }
+  return xlang::symtable::search_symbol_node(xlang::global_symtab, name);
+}
+
+bool xlang::induction::is_int_symbol(struct st_symbol_info* syminfo)
+{
+  if(syminfo == nullptr || syminfo->type_info == nullptr) return false;
+  if(syminfo->is_ptr || syminfo->is_array || syminfo->is_func_ptr)
+    return false;
+  return (syminfo->type_info->type == SIMPLE_TYPE
+          && syminfo->type_info->type_specifier.simple_type.size() == 1
+          && syminfo->type_info->type_specifier.simple_type[0].token == KEY_INT);
+}
+
+//int local or parameter, which can not be changed by calls
+bool xlang::induction::is_int_local(std::string name)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, name);
+  if(syminfo == nullptr){
+    for(auto fparam : func_symtab->func_info->param_list){
+      if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name){
+        syminfo = fparam->symbol_info;
+        break;
+      }
+    }
+  }
+  if(!is_int_symbol(syminfo)) return false;
+  return (addrof_members.find(name) == addrof_members.end());
+}
+
+bool xlang::induction::get_literal(struct primary_expr* pexpr, int* value)
+{
+  if(pexpr == nullptr || pexpr->is_oprtr || pexpr->is_id) return false;
+  switch(pexpr->tok.token){
+    case LIT_DECIMAL :
+    case LIT_OCTAL :
+    case LIT_HEX :
+    case LIT_BIN :
+      *value = xlang::get_decimal(pexpr->tok);
+      return true;
+    default: break;
+  }
+  return false;
+}
+
+bool xlang::induction::is_index_id(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  return (!pexpr->is_oprtr && pexpr->is_id && pexpr->tok.lexeme == index_name
+          && pexpr->left == nullptr && pexpr->right == nullptr
+          && pexpr->unary_node == nullptr);
+}
+
+bool xlang::induction::is_index_id(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return false;
+  return (!idexpr->is_oprtr && idexpr->is_id && idexpr->tok.lexeme == index_name
+          && !idexpr->is_subscript && !idexpr->is_ptr
+          && idexpr->left == nullptr && idexpr->right == nullptr
+          && idexpr->unary == nullptr);
+}
+
+//get loop index and step value from update expression of for loop
+bool xlang::induction::get_step(struct expr* exp, int* step)
+{
+  struct id_expr* idexpr = nullptr;
+  struct assgn_expr* assgnexp = nullptr;
+  struct primary_expr* pexpr = nullptr;
+  int value = 0;
+
+  if(exp == nullptr) return false;
+
+  switch(exp->expr_kind){
+    case ID_EXPR :
+      idexpr = exp->id_expression;
+      if(!idexpr->is_oprtr || idexpr->unary == nullptr) return false;
+      index_name = idexpr->unary->tok.lexeme;
+      if(!is_index_id(idexpr->unary)) return false;
+      if(idexpr->tok.token == INCR_OP){
+        *step = 1;
+        return true;
+      }else if(idexpr->tok.token == DECR_OP){
+        *step = -1;
+        return true;
+      }
+      return false;
+
+    case ASSGN_EXPR :
+      assgnexp = exp->assgn_expression;
+      if(assgnexp->id_expression == nullptr) return false;
+      index_name = assgnexp->id_expression->tok.lexeme;
+      if(!is_index_id(assgnexp->id_expression) || assgnexp->expression == nullptr
+         || assgnexp->expression->expr_kind != PRIMARY_EXPR)
+        return false;
+      pexpr = assgnexp->expression->primary_expression;
+      switch(assgnexp->tok.token){
+        case ASSGN_ADD :
+          if(!get_literal(pexpr, &value)) return false;
+          *step = value;
+          break;
+        case ASSGN_SUB :
+          if(!get_literal(pexpr, &value)) return false;
+          *step = -value;
+          break;
+        case ASSGN :
+          //i = i + c, i = i - c, i = c + i
+          if(pexpr == nullptr || !pexpr->is_oprtr) return false;
+          if(pexpr->tok.token == ARTHM_ADD){
+            if(is_index_id(pexpr->left) && get_literal(pexpr->right, &value))
+              *step = value;
+            else if(is_index_id(pexpr->right) && get_literal(pexpr->left, &value))
+              *step = value;
+            else
+              return false;
+          }else if(pexpr->tok.token == ARTHM_SUB){
+            if(is_index_id(pexpr->left) && get_literal(pexpr->right, &value))
+              *step = -value;
+            else
+              return false;
+          }else{
+            return false;
+          }
+          break;
+        default :
+          return false;
+      }
+      return *step != 0;
+
+    default: break;
+  }
+  return false;
+}
+
+void xlang::induction::get_ids(struct id_expr* idexpr, std::unordered_set<std::string>& ids)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_id)
+    ids.insert(idexpr->tok.lexeme);
+  get_ids(idexpr->left, ids);
+  get_ids(idexpr->right, ids);
+  get_ids(idexpr->unary, ids);
+}
+
+void xlang::induction::get_addrof_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && pexpr->tok.token == ADDROF_OP
+     && pexpr->unary_node != nullptr && pexpr->unary_node->is_id)
+    addrof_members.insert(pexpr->unary_node->tok.lexeme);
+  get_addrof_ids(pexpr->left);
+  get_addrof_ids(pexpr->right);
+  get_addrof_ids(pexpr->unary_node);
+}
+
+void xlang::induction::get_addrof_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && idexpr->tok.token == ADDROF_OP
+     && idexpr->unary != nullptr && idexpr->unary->is_id)
+    addrof_members.insert(idexpr->unary->tok.lexeme);
+  get_addrof_ids(idexpr->left);
+  get_addrof_ids(idexpr->right);
+  get_addrof_ids(idexpr->unary);
+}
+
+void xlang::induction::get_addrof_ids(struct expr* exp)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_addrof_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_addrof_ids(exp->assgn_expression->id_expression);
+      get_addrof_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_addrof_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_addrof_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        get_addrof_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::induction::get_addrof_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_addrof_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_addrof_ids(stm->selection_statement->condition);
+        get_addrof_ids(stm->selection_statement->if_statement);
+        get_addrof_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_addrof_ids(iter->_while.condition);
+            get_addrof_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_addrof_ids(iter->_dowhile.condition);
+            get_addrof_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_addrof_ids(iter->_for.init_expression);
+            get_addrof_ids(iter->_for.condition);
+            get_addrof_ids(iter->_for.update_expression);
+            get_addrof_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_addrof_ids(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        for(auto e : stm->asm_statement->output_operand)
+          get_addrof_ids(e->expression);
+        for(auto e : stm->asm_statement->input_operand)
+          get_addrof_ids(e->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+void xlang::induction::get_modified_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && (pexpr->tok.token == INCR_OP || pexpr->tok.token == DECR_OP)
+     && pexpr->unary_node != nullptr && pexpr->unary_node->is_id)
+    modified.insert(pexpr->unary_node->tok.lexeme);
+  get_modified_ids(pexpr->left);
+  get_modified_ids(pexpr->right);
+  get_modified_ids(pexpr->unary_node);
+}
+
+void xlang::induction::get_modified_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && (idexpr->tok.token == INCR_OP || idexpr->tok.token == DECR_OP))
+    get_ids(idexpr->unary, modified);
+  get_modified_ids(idexpr->left);
+  get_modified_ids(idexpr->right);
+  get_modified_ids(idexpr->unary);
+}
+
+void xlang::induction::get_modified_ids(struct expr* exp)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_modified_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_ids(exp->assgn_expression->id_expression, modified);
+      get_modified_ids(exp->assgn_expression->id_expression);
+      get_modified_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_modified_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_modified_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        get_modified_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::induction::get_modified_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_modified_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_modified_ids(stm->selection_statement->condition);
+        get_modified_ids(stm->selection_statement->if_statement);
+        get_modified_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_modified_ids(iter->_while.condition);
+            get_modified_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_modified_ids(iter->_dowhile.condition);
+            get_modified_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_modified_ids(iter->_for.init_expression);
+            get_modified_ids(iter->_for.condition);
+            get_modified_ids(iter->_for.update_expression);
+            get_modified_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_modified_ids(stm->jump_statement->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+/*
+check loop body keeps temporaries in step with index,
+continue of loop would skip increments at end of body,
+labels, goto and inline assembly can not be followed
+*/
+bool xlang::induction::is_reducible(struct stmt* stm, bool in_inner_loop)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case SELECT_STMT :
+        if(!is_reducible(stm->selection_statement->if_statement, in_inner_loop)
+           || !is_reducible(stm->selection_statement->else_statement, in_inner_loop))
+          return false;
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            if(!is_reducible(iter->_while.statement, true)) return false;
+            break;
+          case DOWHILE_STMT :
+            if(!is_reducible(iter->_dowhile.statement, true)) return false;
+            break;
+          case FOR_STMT :
+            if(!is_reducible(iter->_for.statement, true)) return false;
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        switch(stm->jump_statement->type){
+          case CONTINUE_JMP :
+            if(!in_inner_loop) return false;
+            break;
+          case GOTO_JMP :
+            return false;
+          default: break;
+        }
+        break;
+      case LABEL_STMT :
+      case ASM_STMT :
+        return false;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+  return true;
+}
+
+//loop body of only assignments may be taken by loop vectorizer
+bool xlang::induction::is_vector_candidate(struct stmt* stm)
+{
+  while(stm != nullptr){
+    if(stm->type != EXPR_STMT || stm->expression_statement->expression == nullptr
+       || stm->expression_statement->expression->expr_kind != ASSGN_EXPR)
+      return false;
+    stm = stm->p_next;
+  }
+  return true;
+}
+
+//count uses of loop index
+int xlang::induction::count_uses(struct primary_expr* pexpr)
+{
+  int count = 0;
+  if(pexpr == nullptr) return 0;
+  if(pexpr->is_id && pexpr->tok.lexeme == index_name)
+    count++;
+  return count + count_uses(pexpr->left) + count_uses(pexpr->right)
+          + count_uses(pexpr->unary_node);
+}
+
+int xlang::induction::count_uses(struct id_expr* idexpr)
+{
+  int count = 0;
+  if(idexpr == nullptr) return 0;
+  if(idexpr->is_id && idexpr->tok.lexeme == index_name)
+    count++;
+  for(auto& t : idexpr->subscript){
+    if(t.token == IDENTIFIER && t.lexeme == index_name)
+      count++;
+  }
+  return count + count_uses(idexpr->left) + count_uses(idexpr->right)
+          + count_uses(idexpr->unary);
+}
+
+int xlang::induction::count_uses(struct expr* exp)
+{
+  int count = 0;
+  if(exp == nullptr) return 0;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      return count_uses(exp->primary_expression);
+    case ASSGN_EXPR :
+      return count_uses(exp->assgn_expression->id_expression)
+              + count_uses(exp->assgn_expression->expression);
+    case CAST_EXPR :
+      return count_uses(exp->cast_expression->target);
+    case ID_EXPR :
+      return count_uses(exp->id_expression);
+    case FUNC_CALL_EXPR :
+      count = count_uses(exp->func_call_expression->function);
+      for(auto e : exp->func_call_expression->expression_list)
+        count += count_uses(e);
+      return count;
+    default: break;
+  }
+  return 0;
+}
+
+int xlang::induction::count_uses(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+  int count = 0;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        count += count_uses(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        count += count_uses(stm->selection_statement->condition)
+                  + count_uses(stm->selection_statement->if_statement)
+                  + count_uses(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            count += count_uses(iter->_while.condition)
+                      + count_uses(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            count += count_uses(iter->_dowhile.condition)
+                      + count_uses(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            count += count_uses(iter->_for.init_expression)
+                      + count_uses(iter->_for.condition)
+                      + count_uses(iter->_for.update_expression)
+                      + count_uses(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        count += count_uses(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        for(auto e : stm->asm_statement->output_operand)
+          count += count_uses(e->expression);
+        for(auto e : stm->asm_statement->input_operand)
+          count += count_uses(e->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+  return count;
+}
+
+//check common subexpression node shared by optimizer
+bool xlang::induction::is_shared(struct primary_expr* pexpr,
+                                 std::unordered_set<struct primary_expr*>& nodes)
+{
+  if(pexpr == nullptr) return false;
+  if(nodes.find(pexpr) != nodes.end())
+    return true;
+  nodes.insert(pexpr);
+  return is_shared(pexpr->left, nodes) || is_shared(pexpr->right, nodes)
+          || is_shared(pexpr->unary_node, nodes);
+}
+
+//integer literal or int local other than index which is not modified in loop
+bool xlang::induction::is_invariant_leaf(struct primary_expr* pexpr)
+{
+  int value = 0;
+
+  if(pexpr == nullptr || pexpr->is_oprtr || pexpr->left != nullptr
+     || pexpr->right != nullptr || pexpr->unary_node != nullptr)
+    return false;
+  if(!pexpr->is_id)
+    return get_literal(pexpr, &value);
+  if(pexpr->tok.lexeme == index_name) return false;
+  if(modified.find(pexpr->tok.lexeme) != modified.end()) return false;
+  return is_int_local(pexpr->tok.lexeme);
+}
+
+bool xlang::induction::equals(struct primary_expr* pexpr1, struct primary_expr* pexpr2)
+{
+  if(pexpr1 == nullptr || pexpr2 == nullptr)
+    return pexpr1 == pexpr2;
+  return (pexpr1->is_id == pexpr2->is_id && pexpr1->tok.token == pexpr2->tok.token
+          && pexpr1->tok.lexeme == pexpr2->tok.lexeme);
+}
+
+/*
+match derived induction variable i * s, s * i, i * s + b or b + i * s,
+get stride s and base b(nullptr if none)
+*/
+bool xlang::induction::get_derived(struct primary_expr* pexpr, struct primary_expr** stride,
+                                   struct primary_expr** base)
+{
+  int value = 0;
+
+  if(pexpr == nullptr || !pexpr->is_oprtr || pexpr->oprtr_kind != BINARY_OP
+     || pexpr->left == nullptr || pexpr->right == nullptr)
+    return false;
+
+  switch(pexpr->tok.token){
+    case ARTHM_MUL :
+      if(is_index_id(pexpr->left) && is_invariant_leaf(pexpr->right))
+        *stride = pexpr->right;
+      else if(is_index_id(pexpr->right) && is_invariant_leaf(pexpr->left))
+        *stride = pexpr->left;
+      else
+        return false;
+      if(get_literal(*stride, &value) && value == 0) return false;
+      *base = nullptr;
+      return true;
+
+    case ARTHM_ADD :
+      if(get_derived(pexpr->left, stride, base) && *base == nullptr
+         && is_invariant_leaf(pexpr->right)){
+        *base = pexpr->right;
+        return true;
+      }
+      if(get_derived(pexpr->right, stride, base) && *base == nullptr
+         && is_invariant_leaf(pexpr->left)){
+        *base = pexpr->left;
+        return true;
+      }
+      return false;
+
+    default: break;
+  }
+  return false;
+}
+
+//get temporary of derived induction variable, create int temporary if new
+struct st_symbol_info* xlang::induction::get_temp_symbol(struct primary_expr* stride,
+                                                         struct primary_expr* base)
+{
+  struct st_symbol_info* index = search_id(index_name);
+  struct st_symbol_info* syminfo = nullptr;
+  struct derived_iv div;
+  std::string name;
+
+  for(auto& d : derived){
+    if(equals(d.stride, stride) && equals(d.base, base))
+      return d.temp;
+  }
+
+  name = "_iv" + std::to_string(++temp_count);
+  xlang::symtable::insert_symbol(&func_symtab, name);
+  syminfo = xlang::last_symbol;
+  syminfo->symbol = name;
+  syminfo->tok = index->tok;
+  syminfo->tok.lexeme = name;
+  syminfo->type_info = index->type_info;
+  syminfo->is_ptr = false;
+  syminfo->ptr_oprtr_count = 0;
+  syminfo->is_array = false;
+  syminfo->is_func_ptr = false;
+  syminfo->ret_ptr_count = 0;
+
+  div.stride = get_leaf(stride);
+  div.base = get_leaf(base);
+  div.temp = syminfo;
+  derived.push_back(div);
+  return syminfo;
+}
+
+struct primary_expr* xlang::induction::get_leaf(struct primary_expr* pexpr)
+{
+  struct primary_expr* leaf = nullptr;
+  if(pexpr == nullptr) return nullptr;
+
+  leaf = xlang::tree::get_primary_expr_mem();
+  *leaf = *pexpr;
+  leaf->left = nullptr;
+  leaf->right = nullptr;
+  leaf->unary_node = nullptr;
+  return leaf;
+}
+
+struct primary_expr* xlang::induction::get_literal_leaf(token tok, long long value)
+{
+  struct primary_expr* leaf = xlang::tree::get_primary_expr_mem();
+  leaf->tok = tok;
+  leaf->tok.token = LIT_DECIMAL;
+  leaf->tok.lexeme = std::to_string(value);
+  leaf->is_oprtr = false;
+  leaf->oprtr_kind = UNARY_OP;
+  leaf->is_id = false;
+  return leaf;
+}
+
+struct primary_expr* xlang::induction::get_id_leaf(token tok, struct st_symbol_info* syminfo)
+{
+  struct primary_expr* leaf = xlang::tree::get_primary_expr_mem();
+  leaf->tok = tok;
+  leaf->tok.token = IDENTIFIER;
+  leaf->tok.lexeme = syminfo->symbol;
+  leaf->is_oprtr = false;
+  leaf->oprtr_kind = UNARY_OP;
+  leaf->is_id = true;
+  leaf->id_info = syminfo;
+  return leaf;
+}
+
+struct primary_expr* xlang::induction::get_binary_expr(token tok, token_t op,
+                                  struct primary_expr* left, struct primary_expr* right)
+{
+  struct primary_expr* pexpr = xlang::tree::get_primary_expr_mem();
+  pexpr->tok = tok;
+  pexpr->tok.token = op;
+  switch(op){
+    case ARTHM_ADD : pexpr->tok.lexeme = "+"; break;
+    case ARTHM_SUB : pexpr->tok.lexeme = "-"; break;
+    default : pexpr->tok.lexeme = "*"; break;
+  }
+  pexpr->is_oprtr = true;
+  pexpr->oprtr_kind = BINARY_OP;
+  pexpr->is_id = false;
+  pexpr->left = left;
+  pexpr->right = right;
+  return pexpr;
+}
+
+//get value x * s + b of derived induction variable, folded if all are literals
+struct primary_expr* xlang::induction::get_linear_expr(struct primary_expr* x,
+                                                       struct derived_iv& d)
+{
+  struct primary_expr* pexpr = nullptr;
+  int xv = 0, sv = 0, bv = 0;
+  long long value = 0;
+
+  if(get_literal(x, &xv) && get_literal(d.stride, &sv)
+     && (d.base == nullptr || get_literal(d.base, &bv))){
+    value = static_cast<long long>(xv) * sv + bv;
+    if(value >= 0 && value <= 0x7FFFFFFF)
+      return get_literal_leaf(x->tok, value);
+  }
+  //0 * s + b
+  if(get_literal(x, &xv) && xv == 0){
+    if(d.base != nullptr)
+      return get_leaf(d.base);
+    return get_literal_leaf(x->tok, 0);
+  }
+
+  pexpr = get_binary_expr(x->tok, ARTHM_MUL, get_leaf(x), get_leaf(d.stride));
+  if(d.base != nullptr)
+    pexpr = get_binary_expr(x->tok, ARTHM_ADD, pexpr, get_leaf(d.base));
+  return pexpr;
+}
+
+//get temp + step * s
+struct primary_expr* xlang::induction::get_step_expr(token tok, struct derived_iv& d, int step)
+{
+  struct primary_expr* inc = nullptr;
+  long long value = 0;
+  int sv = 0;
+  token_t op = (step > 0) ? ARTHM_ADD : ARTHM_SUB;
+
+  if(get_literal(d.stride, &sv)){
+    value = static_cast<long long>(step) * sv;
+    if(value < 0) value = -value;
+    inc = get_literal_leaf(tok, value);
+  }else if(step == 1 || step == -1){
+    inc = get_leaf(d.stride);
+  }else{
+    inc = get_binary_expr(tok, ARTHM_MUL, get_leaf(d.stride),
+                          get_literal_leaf(tok, (step > 0) ? step : -step));
+  }
+  return get_binary_expr(tok, op, get_id_leaf(tok, d.temp), inc);
+}
+
+//create expression temp = pexpr
+struct expr* xlang::induction::get_assgn_expr(token tok, struct st_symbol_info* syminfo,
+                                              struct primary_expr* pexpr)
+{
+  struct expr* exp = xlang::tree::get_expr_mem();
+  struct id_expr* left = xlang::tree::get_id_expr_mem();
+
+  left->tok = tok;
+  left->tok.token = IDENTIFIER;
+  left->tok.lexeme = syminfo->symbol;
+  left->is_id = true;
+  left->id_info = syminfo;
+
+  exp->expr_kind = ASSGN_EXPR;
+  exp->assgn_expression = xlang::tree::get_assgn_expr_mem();
+  exp->assgn_expression->tok = tok;
+  exp->assgn_expression->tok.token = ASSGN;
+  exp->assgn_expression->tok.lexeme = "=";
+  exp->assgn_expression->id_expression = left;
+  exp->assgn_expression->expression = xlang::tree::get_expr_mem();
+  exp->assgn_expression->expression->expr_kind = PRIMARY_EXPR;
+  exp->assgn_expression->expression->primary_expression = pexpr;
+  return exp;
+}
+
+struct stmt* xlang::induction::get_expr_statement(struct expr* exp)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+  newstmt->type = EXPR_STMT;
+  newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+  newstmt->expression_statement->expression = exp;
+  return newstmt;
+}
+
+//replace derived induction variables in expression tree by temporaries
+void xlang::induction::reduce_primary_expr(struct primary_expr** pexpr)
+{
+  struct primary_expr* pexp = *pexpr;
+  struct primary_expr* stride = nullptr;
+  struct primary_expr* base = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+
+  if(pexp == nullptr || !pexp->is_oprtr) return;
+
+  if(!get_derived(pexp, &stride, &base)){
+    reduce_primary_expr(&pexp->left);
+    reduce_primary_expr(&pexp->right);
+    reduce_primary_expr(&pexp->unary_node);
+    return;
+  }
+
+  syminfo = get_temp_symbol(stride, base);
+  *pexpr = get_id_leaf(pexp->tok, syminfo);
+  xlang::stats::count("induction.reduced-expressions");
+  xlang::stats::remark("induction", pexp->tok.loc, "expression of induction variable "
+                       "reduced to "+syminfo->symbol);
+  xlang::tree::delete_primary_expr(&pexp);
+}
+
+void xlang::induction::reduce_expression(struct expr* exp)
+{
+  std::unordered_set<struct primary_expr*> nodes;
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      if(!is_shared(exp->primary_expression, nodes))
+        reduce_primary_expr(&exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      reduce_expression(exp->assgn_expression->expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        reduce_expression(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::induction::reduce_statement_list(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        reduce_expression(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        reduce_expression(stm->selection_statement->condition);
+        reduce_statement_list(stm->selection_statement->if_statement);
+        reduce_statement_list(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            reduce_expression(iter->_while.condition);
+            reduce_statement_list(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            reduce_expression(iter->_dowhile.condition);
+            reduce_statement_list(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            reduce_expression(iter->_for.init_expression);
+            reduce_expression(iter->_for.condition);
+            reduce_expression(iter->_for.update_expression);
+            reduce_statement_list(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        reduce_expression(stm->jump_statement->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+/*
+replace index of for(i = a; i op n; step) by its only derived
+induction variable t = i * s + b, when index is used nowhere else in function,
+for(t = a * s + b; t op n * s + b; t = t + step * s), s > 0 keeps comparison
+*/
+bool xlang::induction::remove_index(struct iter_stmt* iter, int step)
+{
+  struct primary_expr* cond = nullptr;
+  struct primary_expr* init = nullptr;
+  struct primary_expr* leaf = nullptr;
+  struct expr* exp = nullptr;
+  int value = 0, uses = 0;
+
+  if(derived.size() != 1 || !get_literal(derived[0].stride, &value) || value <= 0)
+    return false;
+  if(iter->_for.init_expression == nullptr || iter->_for.condition == nullptr
+     || iter->_for.condition->expr_kind != PRIMARY_EXPR)
+    return false;
+  cond = iter->_for.condition->primary_expression;
+  if(cond == nullptr || !cond->is_oprtr || !is_index_id(cond->left)
+     || !is_invariant_leaf(cond->right))
+    return false;
+  switch(cond->tok.token){
+    case COMP_LESS :
+    case COMP_LESS_EQ :
+    case COMP_GREAT :
+    case COMP_GREAT_EQ :
+    case COMP_EQ :
+    case COMP_NOT_EQ :
+      break;
+    default :
+      return false;
+  }
+
+  uses = count_uses(iter->_for.init_expression) + count_uses(iter->_for.condition)
+          + count_uses(iter->_for.update_expression);
+  if(count_uses(*func_body) != uses) return false;
+
+  struct derived_iv& d = derived[0];
+
+  init = iter->_for.init_expression->assgn_expression->expression->primary_expression;
+  exp = get_assgn_expr(iter->_for.fortok, d.temp, get_linear_expr(init, d));
+  xlang::tree::delete_expr(&iter->_for.init_expression);
+  iter->_for.init_expression = exp;
+
+  leaf = cond->left;
+  cond->left = get_id_leaf(leaf->tok, d.temp);
+  xlang::tree::delete_primary_expr(&leaf);
+  leaf = cond->right;
+  cond->right = get_linear_expr(leaf, d);
+  xlang::tree::delete_primary_expr(&leaf);
+
+  exp = get_assgn_expr(iter->_for.fortok, d.temp, get_step_expr(iter->_for.fortok, d, step));
+  xlang::tree::delete_expr(&iter->_for.update_expression);
+  iter->_for.update_expression = exp;
+
+  xlang::stats::count("induction.removed-variables");
+  xlang::stats::remark("induction", iter->_for.fortok.loc, "loop index replaced by "
+                       +d.temp->symbol);
+  return true;
+}
+
+/*
+strength reduce derived induction variables of for loop,
+temp = a * s + b; is added before loop and
+temp = temp + step * s; at end of loop body
+*/
+void xlang::induction::reduce_loop(struct stmt** head, struct stmt* loop)
+{
+  struct iter_stmt* iter = loop->iteration_statement;
+  struct assgn_expr* init = nullptr;
+  struct primary_expr* start = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+  struct stmt* preheader = nullptr;
+  struct stmt* tail = nullptr;
+  struct stmt* newstmt = nullptr;
+  int step = 0, value = 0;
+
+  if(iter->type != FOR_STMT || iter->_for.statement == nullptr) return;
+  if(!get_step(iter->_for.update_expression, &step)) return;
+  if(!is_int_local(index_name)) return;
+
+  //for(i = a; ...) where a is literal or int variable, or for(; ...)
+  if(iter->_for.init_expression != nullptr){
+    if(iter->_for.init_expression->expr_kind != ASSGN_EXPR) return;
+    init = iter->_for.init_expression->assgn_expression;
+    if(init->tok.token != ASSGN || !is_index_id(init->id_expression)
+       || init->expression == nullptr || init->expression->expr_kind != PRIMARY_EXPR)
+      return;
+    start = init->expression->primary_expression;
+    if(start == nullptr || start->is_oprtr || start->left != nullptr
+       || start->right != nullptr || start->unary_node != nullptr)
+      return;
+    if(start->is_id){
+      if(start->tok.lexeme == index_name || !is_int_symbol(search_id(start->tok.lexeme)))
+        return;
+    }else if(!get_literal(start, &value)){
+      return;
+    }
+  }
+
+  if(!is_reducible(iter->_for.statement, false)) return;
+  if(keep_vector_loops && is_vector_candidate(iter->_for.statement)) return;
+
+  modified.clear();
+  get_modified_ids(iter->_for.condition);
+  get_modified_ids(iter->_for.statement);
+  if(modified.find(index_name) != modified.end()) return;
+  get_modified_ids(iter->_for.update_expression);
+
+  derived.clear();
+  reduce_statement_list(iter->_for.statement);
+  if(derived.empty()) return;
+  xlang::stats::count("induction.derived-variables", static_cast<int>(derived.size()));
+
+  if(remove_index(iter, step)) return;
+
+  if(start == nullptr){
+    syminfo = search_id(index_name);
+    start = get_id_leaf(iter->_for.fortok, syminfo);
+  }
+
+  for(auto& d : derived){
+    newstmt = get_expr_statement(get_assgn_expr(iter->_for.fortok, d.temp,
+                                                get_linear_expr(start, d)));
+    xlang::tree::add_statement(&preheader, &newstmt);
+    newstmt = get_expr_statement(get_assgn_expr(iter->_for.fortok, d.temp,
+                                       get_step_expr(iter->_for.fortok, d, step)));
+    xlang::tree::add_statement(&iter->_for.statement, &newstmt);
+  }
+  if(syminfo != nullptr)
+    xlang::tree::delete_primary_expr(&start);
+
+  tail = preheader;
+  while(tail->p_next != nullptr)
+    tail = tail->p_next;
+
+  preheader->p_prev = loop->p_prev;
+  if(loop->p_prev != nullptr)
+    loop->p_prev->p_next = preheader;
+  else
+    *head = preheader;
+  tail->p_next = loop;
+  loop->p_prev = tail;
+}
+
+void xlang::induction::optimize_statement_list(struct stmt** head)
+{
+  struct stmt* stm = *head;
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case SELECT_STMT :
+        optimize_statement_list(&stm->selection_statement->if_statement);
+        optimize_statement_list(&stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        //inner loops first
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            optimize_statement_list(&iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            optimize_statement_list(&iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            optimize_statement_list(&iter->_for.statement);
+            break;
+        }
+        reduce_loop(head, stm);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+void xlang::induction::reduce_induction_variables(struct tree_node** tr)
+{
+  struct tree_node* trhead = *tr;
+
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr){
+      func_symtab = trhead->symtab;
+      xlang::stats::set_function(func_symtab->func_info->func_name);
+      func_body = &trhead->statement;
+      addrof_members.clear();
+      get_addrof_ids(trhead->statement);
+      optimize_statement_list(&trhead->statement);
+    }
+    trhead = trhead->p_next;
+  }
+  func_symtab = nullptr;
+  func_body = nullptr;
+}
@@ -0,0 +1,106 @@
+/*
+*  src/induction.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in induction.cpp file by class induction.
+*/
+
+#ifndef INDUCTION_HPP
+#define INDUCTION_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include "token.hpp"
+#include "types.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+namespace xlang{
+
+//derived induction variable index * stride + base kept in temporary
+struct derived_iv
+{
+  struct primary_expr* stride;
+  struct primary_expr* base;  //nullptr if no base
+  struct st_symbol_info* temp;
+};
+
+class induction
+{
+public:
+  //vectorizer candidates are not rewritten when keep_vector_loops is set
+  induction(bool keep_vector) : keep_vector_loops(keep_vector){}
+  void reduce_induction_variables(struct tree_node**);
+
+private:
+  bool keep_vector_loops;
+  //count of created temporaries, used for unique names
+  unsigned temp_count = 0;
+
+  //function whose loops are optimized
+  struct st_node* func_symtab = nullptr;
+  struct stmt** func_body = nullptr;
+  //locals whose address is taken in function
+  std::unordered_set<std::string> addrof_members;
+
+  //state of currently optimized loop
+  std::string index_name;
+  std::unordered_set<std::string> modified;
+  std::vector<struct derived_iv> derived;
+
+  struct st_symbol_info* search_id(std::string);
+  bool is_int_symbol(struct st_symbol_info*);
+  bool is_int_local(std::string);
+  bool get_literal(struct primary_expr*, int*);
+  bool is_index_id(struct primary_expr*);
+  bool is_index_id(struct id_expr*);
+  bool get_step(struct expr*, int*);
+
+  void get_ids(struct id_expr*, std::unordered_set<std::string>&);
+  void get_addrof_ids(struct primary_expr*);
+  void get_addrof_ids(struct id_expr*);
+  void get_addrof_ids(struct expr*);
+  void get_addrof_ids(struct stmt*);
+  void get_modified_ids(struct primary_expr*);
+  void get_modified_ids(struct id_expr*);
+  void get_modified_ids(struct expr*);
+  void get_modified_ids(struct stmt*);
+  bool is_reducible(struct stmt*, bool);
+  bool is_vector_candidate(struct stmt*);
+
+  int count_uses(struct primary_expr*);
+  int count_uses(struct id_expr*);
+  int count_uses(struct expr*);
+  int count_uses(struct stmt*);
+
+  bool is_shared(struct primary_expr*, std::unordered_set<struct primary_expr*>&);
+  bool is_invariant_leaf(struct primary_expr*);
+  bool equals(struct primary_expr*, struct primary_expr*);
+  bool get_derived(struct primary_expr*, struct primary_expr**, struct primary_expr**);
+  struct st_symbol_info* get_temp_symbol(struct primary_expr*, struct primary_expr*);
+
+  struct primary_expr* get_leaf(struct primary_expr*);
+  struct primary_expr* get_literal_leaf(token, long long);
+  struct primary_expr* get_id_leaf(token, struct st_symbol_info*);
+  struct primary_expr* get_binary_expr(token, token_t, struct primary_expr*,
+                                       struct primary_expr*);
+  struct primary_expr* get_linear_expr(struct primary_expr*, struct derived_iv&);
+  struct primary_expr* get_step_expr(token, struct derived_iv&, int);
+  struct expr* get_assgn_expr(token, struct st_symbol_info*, struct primary_expr*);
+  struct stmt* get_expr_statement(struct expr*);
+
+  void reduce_primary_expr(struct primary_expr**);
+  void reduce_expression(struct expr*);
+  void reduce_statement_list(struct stmt*);
+  bool remove_index(struct iter_stmt*, int);
+  void reduce_loop(struct stmt**, struct stmt*);
+  void optimize_statement_list(struct stmt**);
+};
+
+}
+
+#endif
+
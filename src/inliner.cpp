@@ -0,0 +1,934 @@
+/*
+*  src/inliner.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains function inliner over the abstract syntax tree.
+* A call statement(f(...); or x = f(...);) to a small defined function
+* is replaced by a copy of its statement list. Parameters and locals of
+* the called function are copied into caller symbol table with unique names,
+* arguments are assigned to copied parameters, and every return statement
+* is rewritten into an assignment of result and a jump to a join label.
+* A call site is inlined only if cost of called function body
+* minus call overhead is not more than inline limit.
+*/
+
+#include "tree.hpp"
+#include "symtab.hpp"
+#include "stats.hpp"
+#include "inliner.hpp"
+#include "profile.hpp"
+
+using namespace xlang;
+
+int xlang::inliner::primary_expr_cost(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return 0;
+  return 1 + primary_expr_cost(pexpr->left) + primary_expr_cost(pexpr->right)
+           + primary_expr_cost(pexpr->unary_node);
+}
+
+int xlang::inliner::id_expr_cost(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return 0;
+  return 1 + static_cast<int>(idexpr->subscript.size())
+           + id_expr_cost(idexpr->left) + id_expr_cost(idexpr->right)
+           + id_expr_cost(idexpr->unary);
+}
+
+int xlang::inliner::expr_cost(struct expr* exp)
+{
+  int cost = 0;
+  if(exp == nullptr) return 0;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      return primary_expr_cost(exp->primary_expression);
+    case ASSGN_EXPR :
+      return 1 + id_expr_cost(exp->assgn_expression->id_expression)
+               + expr_cost(exp->assgn_expression->expression);
+    case SIZEOF_EXPR :
+      return 1;
+    case CAST_EXPR :
+      return 1 + id_expr_cost(exp->cast_expression->target);
+    case ID_EXPR :
+      return id_expr_cost(exp->id_expression);
+    case FUNC_CALL_EXPR :
+      cost = 2;
+      for(auto e : exp->func_call_expression->expression_list)
+        cost += 1 + expr_cost(e);
+      return cost;
+  }
+  return 0;
+}
+
+//cost of statement list, each statement costs one jump/label at least
+int xlang::inliner::statement_cost(struct stmt* stm)
+{
+  int cost = 0;
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    cost++;
+    switch(stm->type){
+      case EXPR_STMT :
+        cost += expr_cost(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        cost += expr_cost(stm->selection_statement->condition);
+        cost += statement_cost(stm->selection_statement->if_statement);
+        cost += statement_cost(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            cost += expr_cost(iter->_while.condition);
+            cost += statement_cost(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            cost += expr_cost(iter->_dowhile.condition);
+            cost += statement_cost(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            cost += expr_cost(iter->_for.init_expression);
+            cost += expr_cost(iter->_for.condition);
+            cost += expr_cost(iter->_for.update_expression);
+            cost += statement_cost(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        cost += expr_cost(stm->jump_statement->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+  return cost;
+}
+
+bool xlang::inliner::is_float_type(struct st_type_info* tinf, bool is_ptr)
+{
+  if(tinf == nullptr || is_ptr) return false;
+  if(tinf->type != SIMPLE_TYPE) return false;
+  if(tinf->type_specifier.simple_type.empty()) return false;
+  return (tinf->type_specifier.simple_type[0].token == KEY_FLOAT
+          || tinf->type_specifier.simple_type[0].token == KEY_DOUBLE);
+}
+
+//check expression has a call to function fname
+bool xlang::inliner::is_calling(struct expr* exp, std::string fname)
+{
+  struct id_expr* function = nullptr;
+  if(exp == nullptr) return false;
+
+  switch(exp->expr_kind){
+    case ASSGN_EXPR :
+      return is_calling(exp->assgn_expression->expression, fname);
+    case FUNC_CALL_EXPR :
+      function = exp->func_call_expression->function;
+      if(function != nullptr && function->tok.lexeme == fname)
+        return true;
+      for(auto e : exp->func_call_expression->expression_list){
+        if(is_calling(e, fname))
+          return true;
+      }
+      return false;
+    default: break;
+  }
+  return false;
+}
+
+bool xlang::inliner::is_inlinable_expr(struct expr* exp)
+{
+  if(exp == nullptr) return true;
+  //recursive function can not be inlined into itself
+  return !is_calling(exp, callee->symtab->func_info->func_name);
+}
+
+bool xlang::inliner::is_inlinable_statement(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case LABEL_STMT :
+        break;
+      case EXPR_STMT :
+        if(!is_inlinable_expr(stm->expression_statement->expression))
+          return false;
+        break;
+      case SELECT_STMT :
+        if(!is_inlinable_expr(stm->selection_statement->condition)
+           || !is_inlinable_statement(stm->selection_statement->if_statement)
+           || !is_inlinable_statement(stm->selection_statement->else_statement))
+          return false;
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            if(!is_inlinable_expr(iter->_while.condition)
+               || !is_inlinable_statement(iter->_while.statement))
+              return false;
+            break;
+          case DOWHILE_STMT :
+            if(!is_inlinable_expr(iter->_dowhile.condition)
+               || !is_inlinable_statement(iter->_dowhile.statement))
+              return false;
+            break;
+          case FOR_STMT :
+            if(!is_inlinable_expr(iter->_for.init_expression)
+               || !is_inlinable_expr(iter->_for.condition)
+               || !is_inlinable_expr(iter->_for.update_expression)
+               || !is_inlinable_statement(iter->_for.statement))
+              return false;
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        if(stm->jump_statement->type == RETURN_JMP
+           && stm->jump_statement->expression != nullptr){
+          //return of assignment is not rewritten
+          if(stm->jump_statement->expression->expr_kind == ASSGN_EXPR)
+            return false;
+          if(!is_inlinable_expr(stm->jump_statement->expression))
+            return false;
+        }
+        break;
+      //inline assembly refers function frame directly
+      default :
+        return false;
+    }
+    stm = stm->p_next;
+  }
+  return true;
+}
+
+void xlang::inliner::get_used_ids(struct primary_expr* pexpr,
+                                  std::vector<std::string>& ids)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_id)
+    ids.push_back(pexpr->tok.lexeme);
+  get_used_ids(pexpr->left, ids);
+  get_used_ids(pexpr->right, ids);
+  get_used_ids(pexpr->unary_node, ids);
+}
+
+void xlang::inliner::get_used_ids(struct id_expr* idexpr,
+                                  std::vector<std::string>& ids)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_id)
+    ids.push_back(idexpr->tok.lexeme);
+  for(auto& t : idexpr->subscript){
+    if(t.token == IDENTIFIER)
+      ids.push_back(t.lexeme);
+  }
+  get_used_ids(idexpr->left, ids);
+  get_used_ids(idexpr->right, ids);
+  get_used_ids(idexpr->unary, ids);
+}
+
+void xlang::inliner::get_used_ids(struct expr* exp,
+                                  std::vector<std::string>& ids)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_used_ids(exp->primary_expression, ids);
+      break;
+    case ASSGN_EXPR :
+      get_used_ids(exp->assgn_expression->id_expression, ids);
+      get_used_ids(exp->assgn_expression->expression, ids);
+      break;
+    case SIZEOF_EXPR :
+      break;
+    case CAST_EXPR :
+      get_used_ids(exp->cast_expression->target, ids);
+      break;
+    case ID_EXPR :
+      get_used_ids(exp->id_expression, ids);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        get_used_ids(e, ids);
+      break;
+  }
+}
+
+void xlang::inliner::get_used_ids(struct stmt* stm,
+                                  std::vector<std::string>& ids)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_used_ids(stm->expression_statement->expression, ids);
+        break;
+      case SELECT_STMT :
+        get_used_ids(stm->selection_statement->condition, ids);
+        get_used_ids(stm->selection_statement->if_statement, ids);
+        get_used_ids(stm->selection_statement->else_statement, ids);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_used_ids(iter->_while.condition, ids);
+            get_used_ids(iter->_while.statement, ids);
+            break;
+          case DOWHILE_STMT :
+            get_used_ids(iter->_dowhile.condition, ids);
+            get_used_ids(iter->_dowhile.statement, ids);
+            break;
+          case FOR_STMT :
+            get_used_ids(iter->_for.init_expression, ids);
+            get_used_ids(iter->_for.condition, ids);
+            get_used_ids(iter->_for.update_expression, ids);
+            get_used_ids(iter->_for.statement, ids);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_used_ids(stm->jump_statement->expression, ids);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+//check symbol is a local or parameter of caller function
+bool xlang::inliner::is_caller_symbol(std::string name)
+{
+  if(xlang::symtable::search_symbol(caller_symtab, name))
+    return true;
+  for(auto fparam : caller_symtab->func_info->param_list){
+    if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name)
+      return true;
+  }
+  return false;
+}
+
+/*
+check function call can be inlined into caller,
+res is the left side identifier expression of x = f(...);
+*/
+bool xlang::inliner::can_inline(struct func_call_expr* fcexpr, struct id_expr* res)
+{
+  struct id_expr* function = fcexpr->function;
+  struct st_func_info* finfo = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+  std::unordered_map<std::string, struct tree_node*>::iterator it;
+  std::vector<std::string> ids;
+  int cost = 0, limit = 0;
+  long long count;
+
+  missed_reason = "";
+  if(function == nullptr || function->left != nullptr
+     || function->right != nullptr || function->unary != nullptr)
+    return false;
+
+  it = functions.find(function->tok.lexeme);
+  if(it == functions.end()) return false;
+  callee = it->second;
+  finfo = callee->symtab->func_info;
+
+  missed_reason = "call is recursive";
+  if(callee->symtab == caller_symtab)
+    return false;
+  missed_reason = "argument count does not match parameters";
+  if(finfo->param_list.size() != fcexpr->expression_list.size())
+    return false;
+
+  missed_reason = "argument is an assignment";
+  for(auto e : fcexpr->expression_list){
+    if(e == nullptr || e->expr_kind == ASSGN_EXPR)
+      return false;
+  }
+
+  //only simple non-pointer parameters and locals are copied
+  missed_reason = "callee has pointer, array or record parameters/locals";
+  for(auto fparam : finfo->param_list){
+    if(fparam->type_info == nullptr || fparam->type_info->type != SIMPLE_TYPE)
+      return false;
+    syminfo = fparam->symbol_info;
+    if(syminfo == nullptr || syminfo->is_ptr || syminfo->is_array
+       || syminfo->is_func_ptr)
+      return false;
+  }
+  for(int i = 0; i < ST_SIZE; i++){
+    syminfo = callee->symtab->symbol_info[i];
+    while(syminfo != nullptr){
+      if(syminfo->type_info == nullptr
+         || syminfo->type_info->type != SIMPLE_TYPE
+         || syminfo->is_ptr || syminfo->is_array || syminfo->is_func_ptr)
+        return false;
+      syminfo = syminfo->p_next;
+    }
+  }
+
+  //result must be a plain variable of same type as return type
+  missed_reason = "result is not assigned to a variable of return type";
+  if(res != nullptr){
+    if(res->left != nullptr || res->right != nullptr || res->unary != nullptr
+       || res->is_subscript || res->is_ptr || !res->is_id
+       || res->id_info == nullptr || res->id_info->is_ptr
+       || res->id_info->is_array || res->id_info->type_info == nullptr)
+      return false;
+    if(finfo->ptr_oprtr_count > 0 || finfo->return_type == nullptr
+       || finfo->return_type->type != SIMPLE_TYPE
+       || res->id_info->type_info->type != SIMPLE_TYPE)
+      return false;
+    if(finfo->return_type->type_specifier.simple_type.size()
+       != res->id_info->type_info->type_specifier.simple_type.size())
+      return false;
+    for(size_t i = 0; i < finfo->return_type->type_specifier.simple_type.size(); i++){
+      if(finfo->return_type->type_specifier.simple_type[i].token
+         != res->id_info->type_info->type_specifier.simple_type[i].token)
+        return false;
+    }
+    if(is_float_type(finfo->return_type, false)
+       != is_float_type(res->id_info->type_info, false))
+      return false;
+  }
+
+  missed_reason = "callee has statements that cannot be inlined";
+  if(!is_inlinable_statement(callee->statement))
+    return false;
+
+  //names refering globals must not be hidden by caller locals
+  missed_reason = "callee uses global hidden by caller local";
+  get_used_ids(callee->statement, ids);
+  for(auto& name : ids){
+    if(xlang::symtable::search_symbol(callee->symtab, name))
+      continue;
+    bool is_param = false;
+    for(auto fparam : finfo->param_list){
+      if(fparam->symbol_info->symbol == name){
+        is_param = true;
+        break;
+      }
+    }
+    if(!is_param && is_caller_symbol(name))
+      return false;
+  }
+
+  //call overhead: pushing arguments, call, frame setup, return
+  cost = statement_cost(callee->statement)
+          - (static_cast<int>(finfo->param_list.size()) + 4);
+
+  //function never called in profile is not inlined,
+  //hot function is allowed to grow caller more
+  count = xlang::profile::get_count(finfo->tok.loc.line, "entry");
+  missed_reason = "callee is never called in profile";
+  if(count == 0) return false;
+  limit = inline_limit;
+  if(xlang::profile::is_hot(count))
+    limit = inline_limit * PROFILE_HOT_INLINE_SCALE;
+
+  missed_reason = "cost "+std::to_string(cost)+" exceeds inline limit "
+                  +std::to_string(limit);
+  return cost <= limit;
+}
+
+//copy callee symbol into caller symbol table with unique name
+struct st_symbol_info* xlang::inliner::add_caller_symbol(struct st_symbol_info* syminfo,
+                                                         struct st_type_info* tinf)
+{
+  std::string name = "_inl" + std::to_string(inline_count) + "_" + syminfo->symbol;
+  struct st_symbol_info* newsym = nullptr;
+
+  xlang::symtable::insert_symbol(&caller_symtab, name);
+  newsym = xlang::last_symbol;
+  *newsym = *syminfo;
+  newsym->p_next = nullptr;
+  newsym->symbol = name;
+  newsym->tok.lexeme = name;
+  if(newsym->type_info == nullptr)
+    newsym->type_info = tinf;
+  return newsym;
+}
+
+std::string xlang::inliner::get_label(std::string label)
+{
+  auto it = label_map.find(label);
+  if(it != label_map.end())
+    return it->second;
+  std::string newlabel = "_inl" + std::to_string(inline_count) + "_" + label;
+  label_map.insert(std::pair<std::string, std::string>(label, newlabel));
+  return newlabel;
+}
+
+struct primary_expr* xlang::inliner::clone_primary_expr(struct primary_expr* pexpr)
+{
+  struct primary_expr* newexpr = nullptr;
+  if(pexpr == nullptr) return nullptr;
+
+  newexpr = xlang::tree::get_primary_expr_mem();
+  *newexpr = *pexpr;
+  if(pexpr->is_id){
+    auto it = symbol_map.find(pexpr->tok.lexeme);
+    if(it != symbol_map.end()){
+      newexpr->tok.lexeme = it->second->symbol;
+      newexpr->id_info = it->second;
+    }
+  }
+  newexpr->left = clone_primary_expr(pexpr->left);
+  newexpr->right = clone_primary_expr(pexpr->right);
+  newexpr->unary_node = clone_primary_expr(pexpr->unary_node);
+  return newexpr;
+}
+
+struct id_expr* xlang::inliner::clone_id_expr(struct id_expr* idexpr)
+{
+  struct id_expr* newexpr = nullptr;
+  if(idexpr == nullptr) return nullptr;
+
+  newexpr = xlang::tree::get_id_expr_mem();
+  *newexpr = *idexpr;
+  if(idexpr->is_id){
+    auto it = symbol_map.find(idexpr->tok.lexeme);
+    if(it != symbol_map.end()){
+      newexpr->tok.lexeme = it->second->symbol;
+      newexpr->id_info = it->second;
+    }
+  }
+  for(auto& t : newexpr->subscript){
+    if(t.token == IDENTIFIER){
+      auto it = symbol_map.find(t.lexeme);
+      if(it != symbol_map.end())
+        t.lexeme = it->second->symbol;
+    }
+  }
+  newexpr->left = clone_id_expr(idexpr->left);
+  newexpr->right = clone_id_expr(idexpr->right);
+  newexpr->unary = clone_id_expr(idexpr->unary);
+  return newexpr;
+}
+
+struct expr* xlang::inliner::clone_expr(struct expr* exp)
+{
+  struct expr* newexpr = nullptr;
+  if(exp == nullptr) return nullptr;
+
+  newexpr = xlang::tree::get_expr_mem();
+  newexpr->expr_kind = exp->expr_kind;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      newexpr->primary_expression = clone_primary_expr(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      newexpr->assgn_expression = xlang::tree::get_assgn_expr_mem();
+      newexpr->assgn_expression->tok = exp->assgn_expression->tok;
+      newexpr->assgn_expression->id_expression =
+                  clone_id_expr(exp->assgn_expression->id_expression);
+      newexpr->assgn_expression->expression =
+                  clone_expr(exp->assgn_expression->expression);
+      break;
+    case SIZEOF_EXPR :
+      newexpr->sizeof_expression = xlang::tree::get_sizeof_expr_mem();
+      *newexpr->sizeof_expression = *exp->sizeof_expression;
+      break;
+    case CAST_EXPR :
+      newexpr->cast_expression = xlang::tree::get_cast_expr_mem();
+      *newexpr->cast_expression = *exp->cast_expression;
+      newexpr->cast_expression->target = clone_id_expr(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      newexpr->id_expression = clone_id_expr(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      newexpr->func_call_expression = xlang::tree::get_func_call_expr_mem();
+      newexpr->func_call_expression->function =
+                  clone_id_expr(exp->func_call_expression->function);
+      for(auto e : exp->func_call_expression->expression_list)
+        newexpr->func_call_expression->expression_list.push_back(clone_expr(e));
+      break;
+  }
+  return newexpr;
+}
+
+/*
+clone statement of callee function,
+returns statement list because a return statement
+is rewritten as result assignment and goto to exit label
+*/
+struct stmt* xlang::inliner::clone_statement(struct stmt* stm)
+{
+  struct stmt* newstmt = nullptr;
+  struct stmt* list = nullptr;
+  struct iter_stmt* iter = nullptr;
+  struct jump_stmt* jmp = nullptr;
+  if(stm == nullptr) return nullptr;
+
+  if(stm->type == JUMP_STMT && stm->jump_statement->type == RETURN_JMP){
+    jmp = stm->jump_statement;
+    if(jmp->expression != nullptr){
+      if(result != nullptr){
+        newstmt = get_assgn_statement(result, clone_expr(jmp->expression));
+        xlang::tree::add_statement(&list, &newstmt);
+      }else if(jmp->expression->expr_kind == FUNC_CALL_EXPR){
+        newstmt = xlang::tree::get_stmt_mem();
+        newstmt->type = EXPR_STMT;
+        newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+        newstmt->expression_statement->expression = clone_expr(jmp->expression);
+        xlang::tree::add_statement(&list, &newstmt);
+      }
+    }
+    newstmt = get_goto_statement(exit_label);
+    xlang::tree::add_statement(&list, &newstmt);
+    return list;
+  }
+
+  newstmt = xlang::tree::get_stmt_mem();
+  newstmt->type = stm->type;
+
+  switch(stm->type){
+    case LABEL_STMT :
+      newstmt->labled_statement = xlang::tree::get_label_stmt_mem();
+      newstmt->labled_statement->label = stm->labled_statement->label;
+      newstmt->labled_statement->label.lexeme =
+                  get_label(stm->labled_statement->label.lexeme);
+      break;
+    case EXPR_STMT :
+      newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+      newstmt->expression_statement->expression =
+                  clone_expr(stm->expression_statement->expression);
+      break;
+    case SELECT_STMT :
+      newstmt->selection_statement = xlang::tree::get_select_stmt_mem();
+      newstmt->selection_statement->iftok = stm->selection_statement->iftok;
+      newstmt->selection_statement->elsetok = stm->selection_statement->elsetok;
+      newstmt->selection_statement->condition =
+                  clone_expr(stm->selection_statement->condition);
+      newstmt->selection_statement->if_statement =
+                  clone_statement_list(stm->selection_statement->if_statement);
+      newstmt->selection_statement->else_statement =
+                  clone_statement_list(stm->selection_statement->else_statement);
+      break;
+    case ITER_STMT :
+      iter = xlang::tree::get_iter_stmt_mem();
+      iter->type = stm->iteration_statement->type;
+      switch(iter->type){
+        case WHILE_STMT :
+          iter->_while.whiletok = stm->iteration_statement->_while.whiletok;
+          iter->_while.condition = clone_expr(stm->iteration_statement->_while.condition);
+          iter->_while.statement =
+                  clone_statement_list(stm->iteration_statement->_while.statement);
+          break;
+        case DOWHILE_STMT :
+          iter->_dowhile.dotok = stm->iteration_statement->_dowhile.dotok;
+          iter->_dowhile.whiletok = stm->iteration_statement->_dowhile.whiletok;
+          iter->_dowhile.condition =
+                  clone_expr(stm->iteration_statement->_dowhile.condition);
+          iter->_dowhile.statement =
+                  clone_statement_list(stm->iteration_statement->_dowhile.statement);
+          break;
+        case FOR_STMT :
+          iter->_for.fortok = stm->iteration_statement->_for.fortok;
+          iter->_for.init_expression =
+                  clone_expr(stm->iteration_statement->_for.init_expression);
+          iter->_for.condition = clone_expr(stm->iteration_statement->_for.condition);
+          iter->_for.update_expression =
+                  clone_expr(stm->iteration_statement->_for.update_expression);
+          iter->_for.statement =
+                  clone_statement_list(stm->iteration_statement->_for.statement);
+          break;
+      }
+      newstmt->iteration_statement = iter;
+      break;
+    case JUMP_STMT :
+      newstmt->jump_statement = xlang::tree::get_jump_stmt_mem();
+      newstmt->jump_statement->type = stm->jump_statement->type;
+      newstmt->jump_statement->tok = stm->jump_statement->tok;
+      newstmt->jump_statement->goto_id = stm->jump_statement->goto_id;
+      if(stm->jump_statement->type == GOTO_JMP)
+        newstmt->jump_statement->goto_id.lexeme =
+                  get_label(stm->jump_statement->goto_id.lexeme);
+      break;
+    default: break;
+  }
+  return newstmt;
+}
+
+struct stmt* xlang::inliner::clone_statement_list(struct stmt* stm)
+{
+  struct stmt* list = nullptr;
+  struct stmt* newstmt = nullptr;
+
+  while(stm != nullptr){
+    newstmt = clone_statement(stm);
+    if(newstmt != nullptr)
+      xlang::tree::add_statement(&list, &newstmt);
+    stm = stm->p_next;
+  }
+  return list;
+}
+
+//create statement left = exp;
+struct stmt* xlang::inliner::get_assgn_statement(struct id_expr* left, struct expr* exp)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+  struct expr* assgnexp = xlang::tree::get_expr_mem();
+
+  assgnexp->expr_kind = ASSGN_EXPR;
+  assgnexp->assgn_expression = xlang::tree::get_assgn_expr_mem();
+  assgnexp->assgn_expression->tok = call_tok;
+  assgnexp->assgn_expression->tok.token = ASSGN;
+  assgnexp->assgn_expression->tok.lexeme = "=";
+  assgnexp->assgn_expression->id_expression = xlang::tree::get_id_expr_mem();
+  //left side belongs to caller, copy it without renaming
+  *assgnexp->assgn_expression->id_expression = *left;
+  assgnexp->assgn_expression->expression = exp;
+
+  newstmt->type = EXPR_STMT;
+  newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+  newstmt->expression_statement->expression = assgnexp;
+  return newstmt;
+}
+
+struct stmt* xlang::inliner::get_goto_statement(std::string label)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+
+  newstmt->type = JUMP_STMT;
+  newstmt->jump_statement = xlang::tree::get_jump_stmt_mem();
+  newstmt->jump_statement->type = GOTO_JMP;
+  newstmt->jump_statement->tok = call_tok;
+  newstmt->jump_statement->tok.token = KEY_GOTO;
+  newstmt->jump_statement->tok.lexeme = "goto";
+  newstmt->jump_statement->goto_id = call_tok;
+  newstmt->jump_statement->goto_id.token = IDENTIFIER;
+  newstmt->jump_statement->goto_id.lexeme = label;
+  return newstmt;
+}
+
+/*
+returns statement list which replaces call statement:
+  parameter = argument; ...
+  callee body with renamed symbols, labels and rewritten returns
+  exit label:
+*/
+struct stmt* xlang::inliner::inline_call(struct func_call_expr* fcexpr, struct id_expr* res)
+{
+  struct stmt* list = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct stmt* tail = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+  struct id_expr* param = nullptr;
+  std::vector<struct st_symbol_info*> params;
+  auto arg = fcexpr->expression_list.begin();
+
+  inline_count++;
+  symbol_map.clear();
+  label_map.clear();
+  result = res;
+  exit_label = "_inl" + std::to_string(inline_count) + "_exit";
+
+  for(auto fparam : callee->symtab->func_info->param_list)
+    params.push_back(add_caller_symbol(fparam->symbol_info, fparam->type_info));
+
+  //arguments are caller expressions, clone them before renaming is set
+  for(auto p : params){
+    param = xlang::tree::get_id_expr_mem();
+    param->tok = p->tok;
+    param->is_oprtr = false;
+    param->is_id = true;
+    param->id_info = p;
+    param->is_subscript = false;
+    param->is_ptr = false;
+    param->ptr_oprtr_count = 0;
+    newstmt = get_assgn_statement(param, clone_expr(*arg));
+    xlang::tree::delete_id_expr(&param);
+    xlang::tree::add_statement(&list, &newstmt);
+    arg++;
+  }
+
+  auto p = params.begin();
+  for(auto fparam : callee->symtab->func_info->param_list){
+    symbol_map.insert(std::pair<std::string, struct st_symbol_info*>(
+                            fparam->symbol_info->symbol, *p));
+    p++;
+  }
+
+  for(int i = 0; i < ST_SIZE; i++){
+    syminfo = callee->symtab->symbol_info[i];
+    while(syminfo != nullptr){
+      symbol_map.insert(std::pair<std::string, struct st_symbol_info*>(
+                            syminfo->symbol, add_caller_symbol(syminfo, nullptr)));
+      syminfo = syminfo->p_next;
+    }
+  }
+
+  newstmt = clone_statement_list(callee->statement);
+  if(newstmt != nullptr)
+    xlang::tree::add_statement(&list, &newstmt);
+
+  //jump to exit label at the end of body is not needed
+  tail = list;
+  while(tail != nullptr && tail->p_next != nullptr)
+    tail = tail->p_next;
+  if(tail != nullptr && tail->type == JUMP_STMT
+     && tail->jump_statement->type == GOTO_JMP
+     && tail->jump_statement->goto_id.lexeme == exit_label){
+    if(tail->p_prev != nullptr)
+      tail->p_prev->p_next = nullptr;
+    else
+      list = nullptr;
+    tail->p_prev = nullptr;
+    xlang::tree::delete_stmt(&tail);
+  }
+
+  newstmt = xlang::tree::get_stmt_mem();
+  newstmt->type = LABEL_STMT;
+  newstmt->labled_statement = xlang::tree::get_label_stmt_mem();
+  newstmt->labled_statement->label = call_tok;
+  newstmt->labled_statement->label.token = IDENTIFIER;
+  newstmt->labled_statement->label.lexeme = exit_label;
+  xlang::tree::add_statement(&list, &newstmt);
+
+  symbol_map.clear();
+  label_map.clear();
+  result = nullptr;
+  return list;
+}
+
+/*
+inline statement f(...); or x = f(...); if possible,
+statement is replaced by inlined statement list in list head
+*/
+bool xlang::inliner::inline_statement(struct stmt** head, struct stmt* stm)
+{
+  struct expr* exp = nullptr;
+  struct func_call_expr* fcexpr = nullptr;
+  struct id_expr* res = nullptr;
+  struct stmt* list = nullptr;
+  struct stmt* tail = nullptr;
+
+  if(stm->type != EXPR_STMT || stm->expression_statement == nullptr)
+    return false;
+  exp = stm->expression_statement->expression;
+  if(exp == nullptr) return false;
+
+  if(exp->expr_kind == FUNC_CALL_EXPR){
+    fcexpr = exp->func_call_expression;
+  }else if(exp->expr_kind == ASSGN_EXPR
+           && exp->assgn_expression->tok.token == ASSGN
+           && exp->assgn_expression->expression != nullptr
+           && exp->assgn_expression->expression->expr_kind == FUNC_CALL_EXPR){
+    fcexpr = exp->assgn_expression->expression->func_call_expression;
+    res = exp->assgn_expression->id_expression;
+  }
+  if(fcexpr == nullptr) return false;
+  if(!can_inline(fcexpr, res)){
+    if(!missed_reason.empty())
+      xlang::stats::missed("inline", fcexpr->function->tok.loc,
+                           fcexpr->function->tok.lexeme+" not inlined into "
+                           +caller_symtab->func_info->func_name+": "+missed_reason);
+    return false;
+  }
+
+  call_tok = fcexpr->function->tok;
+  list = inline_call(fcexpr, res);
+
+  tail = list;
+  while(tail->p_next != nullptr)
+    tail = tail->p_next;
+
+  list->p_prev = stm->p_prev;
+  if(stm->p_prev != nullptr)
+    stm->p_prev->p_next = list;
+  else
+    *head = list;
+  tail->p_next = stm->p_next;
+  if(stm->p_next != nullptr)
+    stm->p_next->p_prev = tail;
+
+  stm->p_next = nullptr;
+  stm->p_prev = nullptr;
+  xlang::tree::delete_stmt(&stm);
+
+  xlang::stats::count("inliner.inlined-call-sites");
+  xlang::stats::remark("inline", call_tok.loc, call_tok.lexeme+" inlined into "
+                       +caller_symtab->func_info->func_name);
+  return true;
+}
+
+void xlang::inliner::inline_statement_list(struct stmt** head)
+{
+  struct stmt* stm = *head;
+  struct stmt* next = nullptr;
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    next = stm->p_next;
+    //inlined statements are not visited again
+    if(!inline_statement(head, stm)){
+      switch(stm->type){
+        case SELECT_STMT :
+          inline_statement_list(&stm->selection_statement->if_statement);
+          inline_statement_list(&stm->selection_statement->else_statement);
+          break;
+        case ITER_STMT :
+          iter = stm->iteration_statement;
+          switch(iter->type){
+            case WHILE_STMT :
+              inline_statement_list(&iter->_while.statement);
+              break;
+            case DOWHILE_STMT :
+              inline_statement_list(&iter->_dowhile.statement);
+              break;
+            case FOR_STMT :
+              inline_statement_list(&iter->_for.statement);
+              break;
+          }
+          break;
+        default: break;
+      }
+    }
+    stm = next;
+  }
+}
+
+/*
+inline small functions into their callers,
+functions are visited in their definition order
+*/
+void xlang::inliner::inline_functions(struct tree_node** tr)
+{
+  struct tree_node* trhead = *tr;
+  struct st_func_info* finfo = nullptr;
+  //negative limit disables inlining
+  if(inline_limit < 0) return;
+
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr
+       && trhead->statement != nullptr){
+      finfo = trhead->symtab->func_info;
+      if(!finfo->is_extern)
+        functions.insert(std::pair<std::string, struct tree_node*>(
+                              finfo->func_name, trhead));
+    }
+    trhead = trhead->p_next;
+  }
+
+  trhead = *tr;
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr){
+      caller_symtab = trhead->symtab;
+      xlang::stats::set_function(caller_symtab->func_info->func_name);
+      inline_statement_list(&trhead->statement);
+    }
+    trhead = trhead->p_next;
+  }
+  caller_symtab = nullptr;
+  callee = nullptr;
+}
@@ -0,0 +1,85 @@
+/*
+*  src/inliner.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in inliner.cpp file by class inliner.
+*/
+
+#ifndef INLINER_HPP
+#define INLINER_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "token.hpp"
+#include "types.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+namespace xlang{
+
+class inliner
+{
+public:
+  inliner(int limit) : inline_limit(limit){}
+  void inline_functions(struct tree_node**);
+
+  //code size cost of expressions/statements, also used by loop unroller
+  static int primary_expr_cost(struct primary_expr*);
+  static int id_expr_cost(struct id_expr*);
+  static int expr_cost(struct expr*);
+  static int statement_cost(struct stmt*);
+
+private:
+  //maximum allowed code growth per call site
+  int inline_limit;
+  //count of inlined call sites, used for unique names
+  unsigned inline_count = 0;
+
+  //defined functions by name
+  std::unordered_map<std::string, struct tree_node*> functions;
+
+  //function into which calls are inlined
+  struct st_node* caller_symtab = nullptr;
+
+  //state of currently inlined call
+  struct tree_node* callee = nullptr;
+  std::unordered_map<std::string, struct st_symbol_info*> symbol_map;
+  std::unordered_map<std::string, std::string> label_map;
+  struct id_expr* result = nullptr;
+  std::string exit_label;
+  token call_tok;
+  //why last call was not inlined, for -Rpass-missed
+  std::string missed_reason;
+
+  bool is_float_type(struct st_type_info*, bool);
+  bool is_calling(struct expr*, std::string);
+  bool is_inlinable_expr(struct expr*);
+  bool is_inlinable_statement(struct stmt*);
+  void get_used_ids(struct primary_expr*, std::vector<std::string>&);
+  void get_used_ids(struct id_expr*, std::vector<std::string>&);
+  void get_used_ids(struct expr*, std::vector<std::string>&);
+  void get_used_ids(struct stmt*, std::vector<std::string>&);
+  bool is_caller_symbol(std::string);
+  bool can_inline(struct func_call_expr*, struct id_expr*);
+
+  struct st_symbol_info* add_caller_symbol(struct st_symbol_info*, struct st_type_info*);
+  std::string get_label(std::string);
+  struct primary_expr* clone_primary_expr(struct primary_expr*);
+  struct id_expr* clone_id_expr(struct id_expr*);
+  struct expr* clone_expr(struct expr*);
+  struct stmt* clone_statement(struct stmt*);
+  struct stmt* clone_statement_list(struct stmt*);
+  struct stmt* get_assgn_statement(struct id_expr*, struct expr*);
+  struct stmt* get_goto_statement(std::string);
+  struct stmt* inline_call(struct func_call_expr*, struct id_expr*);
+  bool inline_statement(struct stmt**, struct stmt*);
+  void inline_statement_list(struct stmt**);
+};
+
+}
+
+#endif
+
@@ -14,7 +14,14 @@ using namespace xlang;
 
 struct operand* xlang::insn_class::get_operand_mem()
 {
-  return new struct operand;
+  struct operand* opr = new struct operand;
+  opr->is_array = false;
+  opr->arr_disp = 0;
+  opr->reg = RNONE;
+  opr->freg = FRNONE;
+  opr->mem.mem_size = 0;
+  opr->mem.fp_disp = 0;
+  return opr;
 }
 
 struct text* xlang::insn_class::get_text_mem()
@@ -71,5 +78,79 @@ void xlang::insn_class::delete_text(struct text** t)
   delete *t;
 }
 
+//returns true if instruction is conditional/unconditional jump
+bool xlang::insn_class::is_jump(insn_t ins) const
+{
+  return (ins >= JMP && ins <= JNLE);
+}
+
+//returns true if instruction is conditional jump
+bool xlang::insn_class::is_cond_jump(insn_t ins) const
+{
+  return (ins > JMP && ins <= JNLE);
+}
+
+/*
+returns jump instruction with inverted condition
+e.g: jg -> jle, je -> jne
+*/
+insn_t xlang::insn_class::inverse_jump(insn_t ins) const
+{
+  switch(ins){
+    case JE : return JNE;
+    case JNE : return JE;
+    case JA : case JNBE : return JBE;
+    case JNA : case JBE : return JA;
+    case JAE : case JNB : return JB;
+    case JNAE : case JB : return JAE;
+    case JG : case JNLE : return JLE;
+    case JNG : case JLE : return JG;
+    case JGE : case JNL : return JL;
+    case JNGE : case JL : return JGE;
+    default: return INSNONE;
+  }
+}
+
+//returns true if instruction is setcc
+bool xlang::insn_class::is_cond_set(insn_t ins) const
+{
+  return (ins >= SETE && ins <= SETLE);
+}
+
+//returns true if instruction is cmovcc
+bool xlang::insn_class::is_cond_move(insn_t ins) const
+{
+  return (ins >= CMOVE && ins <= CMOVLE);
+}
 
+/*
+returns setcc instruction with same condition as conditional jump
+e.g: jg -> setg, jnle -> setg
+*/
+insn_t xlang::insn_class::cond_set_insn(insn_t ins) const
+{
+  switch(ins){
+    case JE : return SETE;
+    case JNE : return SETNE;
+    case JA : case JNBE : return SETA;
+    case JNA : case JBE : return SETBE;
+    case JAE : case JNB : return SETAE;
+    case JNAE : case JB : return SETB;
+    case JG : case JNLE : return SETG;
+    case JNG : case JLE : return SETLE;
+    case JGE : case JNL : return SETGE;
+    case JNGE : case JL : return SETL;
+    default: return INSNONE;
+  }
+}
 
+/*
+returns cmovcc instruction with same condition as conditional jump
+e.g: jg -> cmovg, jnle -> cmovg
+*/
+insn_t xlang::insn_class::cond_move_insn(insn_t ins) const
+{
+  insn_t set = cond_set_insn(ins);
+  if(set == INSNONE) return INSNONE;
+  return static_cast<insn_t>(CMOVE + (set - SETE));
+}
@@ -103,7 +103,71 @@ typedef enum{
   FSTSW,
   FNSTSW,
   SAHF,
-  FNOP
+  FNOP,
+  MOVSS,
+  MOVSD,
+  MOVAPS,
+  ADDSS,
+  ADDSD,
+  SUBSS,
+  SUBSD,
+  MULSS,
+  MULSD,
+  DIVSS,
+  DIVSD,
+  COMISS,
+  COMISD,
+  CVTSS2SD,
+  CVTSD2SS,
+  CVTSI2SS,
+  CVTSI2SD,
+  CVTTSS2SI,
+  CVTTSD2SI,
+  MOVD,
+  MOVDQA,
+  MOVDQU,
+  MOVUPS,
+  PADDD,
+  PSUBD,
+  PMULUDQ,
+  PAND,
+  POR,
+  PXOR,
+  PSLLD,
+  PSRLD,
+  PSLLQ,
+  PSRLQ,
+  PUNPCKLDQ,
+  PUNPCKLQDQ,
+  PUNPCKHQDQ,
+  ADDPS,
+  SUBPS,
+  MULPS,
+  DIVPS,
+  CVTDQ2PS,
+  MOVZX,
+  SETE,
+  SETNE,
+  SETA,
+  SETAE,
+  SETB,
+  SETBE,
+  SETG,
+  SETGE,
+  SETL,
+  SETLE,
+  CMOVE,
+  CMOVNE,
+  CMOVA,
+  CMOVAE,
+  CMOVB,
+  CMOVBE,
+  CMOVG,
+  CMOVGE,
+  CMOVL,
+  CMOVLE,
+  SAR,
+  CDQ
 }insn_t;
 
 //instruction size types
@@ -112,7 +176,8 @@ typedef enum{
   BYTE,
   WORD,
   DWORD,
-  QWORD
+  QWORD,
+  OWORD
 }insnsize_t;
 
 namespace xlang {
@@ -128,7 +193,8 @@ typedef enum{
 //memory types
 typedef enum{
   GLOBAL,
-  LOCAL
+  LOCAL,
+  STACK   //stack-pointer relative, [esp + fp_disp]
 }mem_t;
 
 struct operand{
@@ -240,6 +306,14 @@ class insn_class{
       return (t == TXTEXTERN ? "extern" : "global");
     }
 
+    bool is_jump(insn_t) const;
+    bool is_cond_jump(insn_t) const;
+    insn_t inverse_jump(insn_t) const;
+    bool is_cond_set(insn_t) const;
+    bool is_cond_move(insn_t) const;
+    insn_t cond_set_insn(insn_t) const;
+    insn_t cond_move_insn(insn_t) const;
+
     struct operand* get_operand_mem();
     struct insn* get_insn_mem();
     struct data* get_data_mem();
@@ -336,14 +410,79 @@ class insn_class{
       "fstsw",
       "fnstsw",
       "sahf",
-      "fnop"
+      "fnop",
+      "movss",
+      "movsd",
+      "movaps",
+      "addss",
+      "addsd",
+      "subss",
+      "subsd",
+      "mulss",
+      "mulsd",
+      "divss",
+      "divsd",
+      "comiss",
+      "comisd",
+      "cvtss2sd",
+      "cvtsd2ss",
+      "cvtsi2ss",
+      "cvtsi2sd",
+      "cvttss2si",
+      "cvttsd2si",
+      "movd",
+      "movdqa",
+      "movdqu",
+      "movups",
+      "paddd",
+      "psubd",
+      "pmuludq",
+      "pand",
+      "por",
+      "pxor",
+      "pslld",
+      "psrld",
+      "psllq",
+      "psrlq",
+      "punpckldq",
+      "punpcklqdq",
+      "punpckhqdq",
+      "addps",
+      "subps",
+      "mulps",
+      "divps",
+      "cvtdq2ps",
+      "movzx",
+      "sete",
+      "setne",
+      "seta",
+      "setae",
+      "setb",
+      "setbe",
+      "setg",
+      "setge",
+      "setl",
+      "setle",
+      "cmove",
+      "cmovne",
+      "cmova",
+      "cmovae",
+      "cmovb",
+      "cmovbe",
+      "cmovg",
+      "cmovge",
+      "cmovl",
+      "cmovle",
+      "sar",
+      "cdq"
     };
 
     std::vector<std::string> insnsize_names = {
       "byte",
       "word",
       "dword",
-      "qword"
+      "qword",
+      "oword"
     };
 
     std::vector<std::string> declspace_names = {
@@ -0,0 +1,749 @@
+/*
+*  src/jit.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Machine code generation for --jit option.
+* Bytecode of each function compiled by class vm is encoded
+* into x86-64 instructions, registers of bytecode are kept in
+* stack frame of function below its local variables.
+*
+*   [rbp - frame_size]              : register 0
+*   [rbp - frame_size + reg_area]   : local variables
+*   [rbp]                           : saved rbp
+*
+* Internal functions receive address of their arguments in rdi
+* and return value in rax, extern functions are resolved by dlsym()
+* and called with System V calling convention.
+* Code is written into memory mapped writable and then executable,
+* and a /tmp/perf-<pid>.map is written for profiling with perf.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <map>
+#include <csetjmp>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include "jit.hpp"
+#include "error.hpp"
+#include "lex.hpp"
+
+//x86 condition codes used by setcc/jcc
+#define CC_P  0x0A
+#define CC_NP 0x0B
+#define CC_A  0x07
+#define CC_AE 0x03
+#define CC_E  0x04
+#define CC_NE 0x05
+#define CC_L  0x0C
+#define CC_GE 0x0D
+#define CC_LE 0x0E
+#define CC_G  0x0F
+
+//jump buffer of running program, runtime errors return through it
+static jmp_buf jit_env;
+//lowest stack address that function can use
+static unsigned long long jit_stack_limit = 0;
+
+static void jit_runtime_error(int line, int kind)
+{
+  std::string message = (kind == xlang::JIT_DIVISION_BY_ZERO) ?
+                          "division by zero" : "stack overflow";
+  std::fflush(stdout);
+  xlang::error::print_error(xlang::filename,
+            "runtime error at line "+std::to_string(line)+": "+message);
+  std::longjmp(jit_env, 1);
+}
+
+typedef long long (*jit_function_t)(const void*);
+
+xlang::jit::jit(class vm* _program)
+{
+  program = _program;
+}
+
+xlang::jit::~jit()
+{
+  if(memory != nullptr)
+    munmap(memory, memory_size);
+}
+
+void xlang::jit::emit_byte(int b)
+{
+  code.push_back(static_cast<unsigned char>(b));
+}
+
+void xlang::jit::emit_dword(int d)
+{
+  for(int i = 0; i < 4; i++)
+    emit_byte((static_cast<unsigned>(d) >> (i * 8)) & 0xFF);
+}
+
+void xlang::jit::emit_qword(long long q)
+{
+  for(int i = 0; i < 8; i++)
+    emit_byte((static_cast<unsigned long long>(q) >> (i * 8)) & 0xFF);
+}
+
+void xlang::jit::emit_rex(bool w, int reg, int rm)
+{
+  if(w || reg >= 8 || rm >= 8)
+    emit_byte(0x40 | (w ? 8 : 0) | ((reg >> 3) << 2) | (rm >> 3));
+}
+
+/*
+instruction with operand [base + disp],
+prefix is mandatory prefix(0x66, 0xF2, 0xF3) or 0,
+reg is register or opcode extension in modrm
+*/
+void xlang::jit::emit_mem(int prefix, bool w, std::initializer_list<int> opcode,
+                          int reg, int base, int disp)
+{
+  int mod = 2;
+  if(prefix != 0) emit_byte(prefix);
+  emit_rex(w, reg, base);
+  for(int op : opcode) emit_byte(op);
+  if(disp == 0 && (base & 7) != JIT_RBP)
+    mod = 0;
+  else if(disp >= -128 && disp <= 127)
+    mod = 1;
+  emit_byte((mod << 6) | ((reg & 7) << 3) | (base & 7));
+  if((base & 7) == JIT_RSP) emit_byte(0x24);
+  if(mod == 1)
+    emit_byte(disp);
+  else if(mod == 2)
+    emit_dword(disp);
+}
+
+//instruction with register operands
+void xlang::jit::emit_reg(int prefix, bool w, std::initializer_list<int> opcode,
+                          int reg, int rm)
+{
+  if(prefix != 0) emit_byte(prefix);
+  emit_rex(w, reg, rm);
+  for(int op : opcode) emit_byte(op);
+  emit_byte(0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+void xlang::jit::emit_mov_imm(int reg, long long imm)
+{
+  if(imm >= INT32_MIN && imm <= INT32_MAX){
+    emit_reg(0, true, {0xC7}, 0, reg);
+    emit_dword(static_cast<int>(imm));
+  }else{
+    emit_rex(true, 0, reg);
+    emit_byte(0xB8 + (reg & 7));
+    emit_qword(imm);
+  }
+}
+
+//short forward jump, displacement is set by bind_jump8()
+size_t xlang::jit::emit_jump8(int opcode)
+{
+  emit_byte(opcode);
+  emit_byte(0);
+  return code.size() - 1;
+}
+
+void xlang::jit::bind_jump8(size_t at)
+{
+  code[at] = static_cast<unsigned char>(code.size() - (at + 1));
+}
+
+//jump to instruction of bytecode, set after function is encoded
+void xlang::jit::emit_jump32(std::initializer_list<int> opcode, int target)
+{
+  for(int op : opcode) emit_byte(op);
+  jump_patches.push_back({code.size(), target});
+  emit_dword(0);
+}
+
+void xlang::jit::emit_error(int line, jit_error_t kind)
+{
+  emit_byte(0xBF);    //mov edi, line
+  emit_dword(line);
+  emit_byte(0xBE);    //mov esi, kind
+  emit_dword(kind);
+  emit_mov_imm(JIT_RAX, reinterpret_cast<long long>(jit_runtime_error));
+  emit_reg(0, false, {0xFF}, 2, JIT_RAX);   //call rax
+}
+
+//displacement of bytecode register from rbp
+int xlang::jit::slot(int r)
+{
+  return -frame_size + r * 8;
+}
+
+//displacement of local variable from rbp
+int xlang::jit::local(long long offset)
+{
+  return -frame_size + reg_area + static_cast<int>(offset);
+}
+
+void xlang::jit::load_slot(int reg, int r)
+{
+  emit_mem(0, true, {0x8B}, reg, JIT_RBP, slot(r));
+}
+
+void xlang::jit::store_slot(int r, int reg)
+{
+  emit_mem(0, true, {0x89}, reg, JIT_RBP, slot(r));
+}
+
+//sign extend eax and store it in register r
+void xlang::jit::store_int(int r)
+{
+  emit_reg(0, true, {0x63}, JIT_RAX, JIT_RAX);
+  store_slot(r, JIT_RAX);
+}
+
+//load memory [base + disp] of kind into register r
+void xlang::jit::gen_load(vm_kind_t kind, int base, int disp, int r)
+{
+  switch(kind){
+    case VM_KIND_I8 :
+      emit_mem(0, true, {0x0F, 0xBE}, JIT_RAX, base, disp);
+      break;
+    case VM_KIND_I16 :
+      emit_mem(0, true, {0x0F, 0xBF}, JIT_RAX, base, disp);
+      break;
+    case VM_KIND_I32 :
+      emit_mem(0, true, {0x63}, JIT_RAX, base, disp);
+      break;
+    case VM_KIND_F32 :
+      //cvtss2sd xmm0, [mem]; movsd [slot], xmm0
+      emit_mem(0xF3, false, {0x0F, 0x5A}, 0, base, disp);
+      emit_mem(0xF2, false, {0x0F, 0x11}, 0, JIT_RBP, slot(r));
+      return;
+    default :
+      emit_mem(0, true, {0x8B}, JIT_RAX, base, disp);
+      break;
+  }
+  store_slot(r, JIT_RAX);
+}
+
+//store register r into memory [base + disp] of kind
+void xlang::jit::gen_store(vm_kind_t kind, int base, int disp, int r)
+{
+  if(kind == VM_KIND_F32){
+    //cvtsd2ss xmm0, [slot]; movss [mem], xmm0
+    emit_mem(0xF2, false, {0x0F, 0x5A}, 0, JIT_RBP, slot(r));
+    emit_mem(0xF3, false, {0x0F, 0x11}, 0, base, disp);
+    return;
+  }
+  load_slot(JIT_RAX, r);
+  switch(kind){
+    case VM_KIND_I8 :
+      emit_mem(0, false, {0x88}, JIT_RAX, base, disp);
+      break;
+    case VM_KIND_I16 :
+      emit_mem(0x66, false, {0x89}, JIT_RAX, base, disp);
+      break;
+    case VM_KIND_I32 :
+      emit_mem(0, false, {0x89}, JIT_RAX, base, disp);
+      break;
+    default :
+      emit_mem(0, true, {0x89}, JIT_RAX, base, disp);
+      break;
+  }
+}
+
+/*
+memory opcodes are in order of
+LDL, STL, LDG, STG, LD, ST for each kind
+*/
+void xlang::jit::gen_memory(const struct vm_insn& in)
+{
+  int index = in.opcode - VM_LDL_I8;
+  vm_kind_t kind = static_cast<vm_kind_t>(index / 6);
+  int base = JIT_RBP, disp = 0;
+
+  switch(index % 6){
+    case 0 :
+    case 1 :
+      disp = local(in.imm);
+      break;
+    case 2 :
+    case 3 :
+      emit_mov_imm(JIT_RCX, in.imm);
+      base = JIT_RCX;
+      break;
+    default :
+      load_slot(JIT_RCX, (index % 6 == 4) ? in.b : in.a);
+      base = JIT_RCX;
+      if(in.imm >= INT32_MIN && in.imm <= INT32_MAX){
+        disp = static_cast<int>(in.imm);
+      }else{
+        emit_mov_imm(JIT_RDX, in.imm);
+        emit_reg(0, true, {0x01}, JIT_RDX, JIT_RCX);   //add rcx, rdx
+      }
+      break;
+  }
+
+  switch(index % 6){
+    case 0 :
+    case 2 :
+    case 4 :
+      gen_load(kind, base, disp, in.a);
+      break;
+    case 1 :
+    case 3 :
+      gen_store(kind, base, disp, in.a);
+      break;
+    default :
+      gen_store(kind, base, disp, in.b);
+      break;
+  }
+}
+
+//same results as interpreter for division by -1
+void xlang::jit::gen_division(const struct vm_insn& in)
+{
+  size_t ok, normal, done;
+  emit_mem(0, false, {0x8B}, JIT_RCX, JIT_RBP, slot(in.c));
+  emit_mem(0, false, {0x8B}, JIT_RAX, JIT_RBP, slot(in.b));
+  emit_reg(0, false, {0x85}, JIT_RCX, JIT_RCX);   //test ecx, ecx
+  ok = emit_jump8(0x75);
+  emit_error(in.line, JIT_DIVISION_BY_ZERO);
+  bind_jump8(ok);
+  emit_reg(0, false, {0x83}, 7, JIT_RCX);   //cmp ecx, -1
+  emit_byte(0xFF);
+  normal = emit_jump8(0x75);
+  if(in.opcode == VM_DIV)
+    emit_reg(0, false, {0xF7}, 3, JIT_RAX);   //neg eax
+  else
+    emit_reg(0, false, {0x31}, JIT_RAX, JIT_RAX);
+  done = emit_jump8(0xEB);
+  bind_jump8(normal);
+  emit_byte(0x99);    //cdq
+  emit_reg(0, false, {0xF7}, 7, JIT_RCX);   //idiv ecx
+  if(in.opcode == VM_MOD)
+    emit_reg(0, false, {0x89}, JIT_RDX, JIT_RAX);
+  bind_jump8(done);
+  store_int(in.a);
+}
+
+//comparison is false when any of value is NaN
+void xlang::jit::gen_float_compare(const struct vm_insn& in)
+{
+  int first = in.b, second = in.c, cc = CC_E;
+  switch(in.opcode){
+    case VM_FLT : first = in.c; second = in.b; cc = CC_A; break;
+    case VM_FLE : first = in.c; second = in.b; cc = CC_AE; break;
+    case VM_FGT : cc = CC_A; break;
+    case VM_FGE : cc = CC_AE; break;
+    case VM_FNE : cc = CC_NE; break;
+    default : break;
+  }
+  emit_mem(0xF2, false, {0x0F, 0x10}, 0, JIT_RBP, slot(first));
+  emit_mem(0x66, false, {0x0F, 0x2E}, 0, JIT_RBP, slot(second));   //ucomisd
+  emit_reg(0, false, {0x0F, 0x90 | cc}, 0, JIT_RAX);
+  if(in.opcode == VM_FEQ){
+    emit_reg(0, false, {0x0F, 0x90 | CC_NP}, 0, JIT_RCX);
+    emit_reg(0, false, {0x20}, JIT_RCX, JIT_RAX);   //and al, cl
+  }else if(in.opcode == VM_FNE){
+    emit_reg(0, false, {0x0F, 0x90 | CC_P}, 0, JIT_RCX);
+    emit_reg(0, false, {0x08}, JIT_RCX, JIT_RAX);   //or al, cl
+  }
+  emit_reg(0, false, {0x0F, 0xB6}, JIT_RAX, JIT_RAX);
+  store_slot(in.a, JIT_RAX);
+}
+
+/*
+arguments are passed in rdi, rsi, rdx, rcx, r8, r9 and xmm0-xmm7,
+remaining on stack, al has count of xmm registers for variadic functions
+*/
+void xlang::jit::gen_extern_call(const struct vm_insn& in)
+{
+  static const int int_regs[] = {JIT_RDI, JIT_RSI, JIT_RDX, JIT_RCX, JIT_R8, JIT_R9};
+  const struct vm_extern_call& call = program->extern_calls[in.imm];
+  std::vector<int> stack_args;
+  int int_count = 0, float_count = 0, stack_size;
+
+  for(int i = 0; i < in.c; i++){
+    char t = call.types[i];
+    if(t == 'f' || t == 's'){
+      if(float_count < 8)
+        float_count++;
+      else
+        stack_args.push_back(i);
+    }else{
+      if(int_count < 6)
+        int_count++;
+      else
+        stack_args.push_back(i);
+    }
+  }
+
+  stack_size = static_cast<int>(stack_args.size()) * 8;
+  if(stack_args.size() % 2 != 0){
+    stack_size += 8;
+    emit_reg(0, true, {0x83}, 5, JIT_RSP);    //sub rsp, 8
+    emit_byte(8);
+  }
+  for(auto it = stack_args.rbegin(); it != stack_args.rend(); ++it){
+    if(call.types[*it] == 's'){
+      emit_mem(0xF2, false, {0x0F, 0x5A}, 0, JIT_RBP, slot(in.b + *it));
+      emit_reg(0, true, {0x83}, 5, JIT_RSP);
+      emit_byte(8);
+      emit_mem(0xF3, false, {0x0F, 0x11}, 0, JIT_RSP, 0);
+    }else{
+      emit_mem(0, false, {0xFF}, 6, JIT_RBP, slot(in.b + *it));   //push
+    }
+  }
+
+  int_count = float_count = 0;
+  for(int i = 0; i < in.c; i++){
+    char t = call.types[i];
+    if(t == 'f' || t == 's'){
+      if(float_count >= 8) continue;
+      if(t == 's')
+        emit_mem(0xF2, false, {0x0F, 0x5A}, float_count, JIT_RBP, slot(in.b + i));
+      else
+        emit_mem(0xF2, false, {0x0F, 0x10}, float_count, JIT_RBP, slot(in.b + i));
+      float_count++;
+    }else{
+      if(int_count >= 6) continue;
+      load_slot(int_regs[int_count], in.b + i);
+      int_count++;
+    }
+  }
+
+  emit_byte(0xB8);    //mov eax, float_count
+  emit_dword(float_count);
+  emit_mov_imm(JIT_R11, reinterpret_cast<long long>(extern_addresses[in.imm]));
+  emit_reg(0, false, {0xFF}, 2, JIT_R11);   //call r11
+  if(stack_size > 0){
+    emit_reg(0, true, {0x81}, 0, JIT_RSP);   //add rsp, stack_size
+    emit_dword(stack_size);
+  }
+
+  //return value is converted to representation of bytecode register
+  if(call.return_type == VM_FLOAT){
+    if(call.single_return)
+      emit_reg(0xF3, false, {0x0F, 0x5A}, 0, 0);
+    emit_mem(0xF2, false, {0x0F, 0x11}, 0, JIT_RBP, slot(in.a));
+  }else if(call.return_type == VM_INT){
+    store_int(in.a);
+  }else{
+    store_slot(in.a, JIT_RAX);
+  }
+}
+
+void xlang::jit::gen_insn(const struct vm_insn& in)
+{
+  static const std::map<int, int> int_ops = {
+    {VM_ADD, 0x03}, {VM_SUB, 0x2B}, {VM_AND, 0x23}, {VM_OR, 0x0B}, {VM_XOR, 0x33}
+  };
+  static const std::map<int, int> compares = {
+    {VM_EQ, CC_E}, {VM_NE, CC_NE}, {VM_LT, CC_L},
+    {VM_LE, CC_LE}, {VM_GT, CC_G}, {VM_GE, CC_GE}
+  };
+  static const std::map<int, int> float_ops = {
+    {VM_FADD, 0x58}, {VM_FSUB, 0x5C}, {VM_FMUL, 0x59}, {VM_FDIV, 0x5E}
+  };
+  static const std::map<int, int> jumps = {
+    {VM_JEQ, CC_E}, {VM_JNE, CC_NE}, {VM_JLT, CC_L},
+    {VM_JLE, CC_LE}, {VM_JGT, CC_G}, {VM_JGE, CC_GE}
+  };
+
+  if(in.opcode >= VM_LDL_I8 && in.opcode <= VM_ST_F64){
+    gen_memory(in);
+    return;
+  }
+  if(int_ops.count(in.opcode) > 0){
+    emit_mem(0, false, {0x8B}, JIT_RAX, JIT_RBP, slot(in.b));
+    emit_mem(0, false, {int_ops.at(in.opcode)}, JIT_RAX, JIT_RBP, slot(in.c));
+    store_int(in.a);
+    return;
+  }
+  if(compares.count(in.opcode) > 0){
+    load_slot(JIT_RAX, in.b);
+    emit_mem(0, true, {0x3B}, JIT_RAX, JIT_RBP, slot(in.c));
+    emit_reg(0, false, {0x0F, 0x90 | compares.at(in.opcode)}, 0, JIT_RAX);
+    emit_reg(0, false, {0x0F, 0xB6}, JIT_RAX, JIT_RAX);
+    store_slot(in.a, JIT_RAX);
+    return;
+  }
+  if(float_ops.count(in.opcode) > 0){
+    emit_mem(0xF2, false, {0x0F, 0x10}, 0, JIT_RBP, slot(in.b));
+    emit_mem(0xF2, false, {0x0F, float_ops.at(in.opcode)}, 0, JIT_RBP, slot(in.c));
+    emit_mem(0xF2, false, {0x0F, 0x11}, 0, JIT_RBP, slot(in.a));
+    return;
+  }
+  if(jumps.count(in.opcode) > 0){
+    load_slot(JIT_RAX, in.a);
+    emit_mem(0, true, {0x3B}, JIT_RAX, JIT_RBP, slot(in.b));
+    emit_jump32({0x0F, 0x80 | jumps.at(in.opcode)}, static_cast<int>(in.imm));
+    return;
+  }
+
+  switch(in.opcode){
+    case VM_LI :
+    case VM_LF :
+      if(in.imm >= INT32_MIN && in.imm <= INT32_MAX){
+        emit_mem(0, true, {0xC7}, 0, JIT_RBP, slot(in.a));
+        emit_dword(static_cast<int>(in.imm));
+      }else{
+        emit_mov_imm(JIT_RAX, in.imm);
+        store_slot(in.a, JIT_RAX);
+      }
+      break;
+    case VM_MOV :
+      load_slot(JIT_RAX, in.b);
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_ADDR :
+      emit_mem(0, true, {0x8D}, JIT_RAX, JIT_RBP, local(in.imm));
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_MUL :
+      emit_mem(0, false, {0x8B}, JIT_RAX, JIT_RBP, slot(in.b));
+      emit_mem(0, false, {0x0F, 0xAF}, JIT_RAX, JIT_RBP, slot(in.c));
+      store_int(in.a);
+      break;
+    case VM_DIV :
+    case VM_MOD :
+      gen_division(in);
+      break;
+    case VM_SHL :
+    case VM_SHR :
+      emit_mem(0, false, {0x8B}, JIT_RCX, JIT_RBP, slot(in.c));
+      emit_mem(0, false, {0x8B}, JIT_RAX, JIT_RBP, slot(in.b));
+      emit_reg(0, false, {0xD3}, in.opcode == VM_SHL ? 4 : 7, JIT_RAX);
+      store_int(in.a);
+      break;
+    case VM_ADDI :
+      emit_mem(0, false, {0x8B}, JIT_RAX, JIT_RBP, slot(in.b));
+      emit_byte(0x05);    //add eax, imm32
+      emit_dword(static_cast<int>(in.imm));
+      store_int(in.a);
+      break;
+    case VM_ADDP :
+    case VM_SUBP :
+      load_slot(JIT_RAX, in.b);
+      emit_mem(0, true, {in.opcode == VM_ADDP ? 0x03 : 0x2B}, JIT_RAX, JIT_RBP, slot(in.c));
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_NEG :
+    case VM_NOT :
+      emit_mem(0, false, {0x8B}, JIT_RAX, JIT_RBP, slot(in.b));
+      emit_reg(0, false, {0xF7}, in.opcode == VM_NEG ? 3 : 2, JIT_RAX);
+      store_int(in.a);
+      break;
+    case VM_LNOT :
+      emit_mem(0, true, {0x83}, 7, JIT_RBP, slot(in.b));   //cmp qword, 0
+      emit_byte(0);
+      emit_reg(0, false, {0x0F, 0x90 | CC_E}, 0, JIT_RAX);
+      emit_reg(0, false, {0x0F, 0xB6}, JIT_RAX, JIT_RAX);
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_SX8 :
+    case VM_SX16 :
+      emit_mem(0, true, {0x0F, in.opcode == VM_SX8 ? 0xBE : 0xBF}, JIT_RAX, JIT_RBP, slot(in.b));
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_FNEG :
+      load_slot(JIT_RAX, in.b);
+      emit_reg(0, true, {0x0F, 0xBA}, 7, JIT_RAX);   //btc rax, 63
+      emit_byte(63);
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_FROUND :
+      emit_mem(0xF2, false, {0x0F, 0x5A}, 0, JIT_RBP, slot(in.b));
+      emit_reg(0xF3, false, {0x0F, 0x5A}, 0, 0);
+      emit_mem(0xF2, false, {0x0F, 0x11}, 0, JIT_RBP, slot(in.a));
+      break;
+    case VM_I2F :
+      emit_mem(0xF2, true, {0x0F, 0x2A}, 0, JIT_RBP, slot(in.b));
+      emit_mem(0xF2, false, {0x0F, 0x11}, 0, JIT_RBP, slot(in.a));
+      break;
+    case VM_F2I :
+      emit_mem(0xF2, false, {0x0F, 0x2C}, JIT_RAX, JIT_RBP, slot(in.b));
+      store_int(in.a);
+      break;
+    case VM_FEQ :
+    case VM_FNE :
+    case VM_FLT :
+    case VM_FLE :
+    case VM_FGT :
+    case VM_FGE :
+      gen_float_compare(in);
+      break;
+    case VM_JMP :
+      emit_jump32({0xE9}, static_cast<int>(in.imm));
+      break;
+    case VM_JZ :
+    case VM_JNZ :
+      emit_mem(0, true, {0x83}, 7, JIT_RBP, slot(in.a));
+      emit_byte(0);
+      emit_jump32({0x0F, 0x80 | (in.opcode == VM_JZ ? CC_E : CC_NE)}, static_cast<int>(in.imm));
+      break;
+    case VM_CALL :
+      emit_mem(0, true, {0x8D}, JIT_RDI, JIT_RBP, slot(in.b));
+      emit_byte(0xE8);
+      call_patches.push_back({code.size(), static_cast<int>(in.imm)});
+      emit_dword(0);
+      store_slot(in.a, JIT_RAX);
+      break;
+    case VM_CALLEXT :
+      gen_extern_call(in);
+      break;
+    case VM_RET :
+      load_slot(JIT_RAX, in.a);
+      emit_byte(0xC9);    //leave
+      emit_byte(0xC3);
+      break;
+    case VM_RETV :
+      emit_reg(0, false, {0x31}, JIT_RAX, JIT_RAX);
+      emit_byte(0xC9);
+      emit_byte(0xC3);
+      break;
+    default :
+      break;
+  }
+}
+
+/*
+prologue checks stack limit, copies arguments into first registers
+and clears local variables same as interpreter
+*/
+void xlang::jit::gen_function(const struct vm_function& f)
+{
+  size_t skip;
+  reg_area = ((f.reg_count * 8) + 15) & ~15;
+  frame_size = reg_area + f.frame_size;
+  insn_offsets.clear();
+  jump_patches.clear();
+
+  emit_byte(0x55);    //push rbp
+  emit_reg(0, true, {0x89}, JIT_RSP, JIT_RBP);
+  if(frame_size > 0){
+    emit_reg(0, true, {0x81}, 5, JIT_RSP);   //sub rsp, frame_size
+    emit_dword(frame_size);
+  }
+  emit_mov_imm(JIT_RAX, reinterpret_cast<long long>(&jit_stack_limit));
+  emit_mem(0, true, {0x3B}, JIT_RSP, JIT_RAX, 0);   //cmp rsp, [rax]
+  skip = emit_jump8(0x73);
+  emit_error(f.code.empty() ? 0 : f.code.front().line, JIT_STACK_OVERFLOW);
+  bind_jump8(skip);
+
+  for(int i = 0; i < f.param_count; i++){
+    emit_mem(0, true, {0x8B}, JIT_RAX, JIT_RDI, i * 8);
+    store_slot(i, JIT_RAX);
+  }
+  if(f.frame_size > 0){
+    emit_mem(0, true, {0x8D}, JIT_RDI, JIT_RBP, local(0));
+    emit_reg(0, false, {0x31}, JIT_RAX, JIT_RAX);
+    emit_byte(0xB9);    //mov ecx, count
+    emit_dword(f.frame_size / 8);
+    emit_byte(0xF3);    //rep stosq
+    emit_byte(0x48);
+    emit_byte(0xAB);
+  }
+
+  for(auto& in : f.code){
+    insn_offsets.push_back(code.size());
+    gen_insn(in);
+  }
+  insn_offsets.push_back(code.size());
+
+  for(auto& p : jump_patches){
+    int rel = static_cast<int>(insn_offsets[p.target] - (p.offset + 4));
+    std::memcpy(&code[p.offset], &rel, 4);
+  }
+}
+
+//perf reads symbols of generated code from this file
+void xlang::jit::write_perf_map()
+{
+  std::string name = "/tmp/perf-"+std::to_string(getpid())+".map";
+  FILE* fp = std::fopen(name.c_str(), "w");
+  if(fp == nullptr) return;
+  for(size_t i = 0; i < program->functions.size(); i++){
+    size_t end = (i + 1 < function_offsets.size()) ? function_offsets[i + 1] : code.size();
+    std::fprintf(fp, "%llx %zx %s\n",
+          reinterpret_cast<unsigned long long>(memory + function_offsets[i]),
+          end - function_offsets[i], program->functions[i].name.c_str());
+  }
+  std::fclose(fp);
+}
+
+bool xlang::jit::compile()
+{
+#if defined(__x86_64__)
+  bool resolved = true;
+  for(auto& call : program->extern_calls){
+    void* address = dlsym(RTLD_DEFAULT, call.name.c_str());
+    if(address == nullptr){
+      xlang::error::print_error(xlang::filename,
+                "cannot resolve extern function '"+call.name+"'");
+      resolved = false;
+    }
+    extern_addresses.push_back(address);
+  }
+  if(!resolved) return false;
+
+  for(auto& f : program->functions){
+    function_offsets.push_back(code.size());
+    gen_function(f);
+  }
+  for(auto& p : call_patches){
+    int rel = static_cast<int>(function_offsets[p.target] - (p.offset + 4));
+    std::memcpy(&code[p.offset], &rel, 4);
+  }
+
+  //memory is made executable only after code is written
+  long page = sysconf(_SC_PAGESIZE);
+  memory_size = (code.size() + page - 1) / page * page;
+  void* mem = mmap(nullptr, memory_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(mem == MAP_FAILED){
+    memory = nullptr;
+    xlang::error::print_error(xlang::filename, "cannot allocate memory for --jit");
+    return false;
+  }
+  memory = static_cast<unsigned char*>(mem);
+  std::memcpy(memory, code.data(), code.size());
+  if(mprotect(memory, memory_size, PROT_READ | PROT_EXEC) != 0){
+    xlang::error::print_error(xlang::filename, "cannot make memory executable for --jit");
+    return false;
+  }
+  write_perf_map();
+  return true;
+#else
+  xlang::error::print_error(xlang::filename, "--jit requires x86-64 host");
+  return false;
+#endif
+}
+
+//execute statements outside of functions and main(), value of main() is returned
+int xlang::jit::run()
+{
+  struct rlimit limit;
+  unsigned long long stack_size = 8 * 1024 * 1024;
+  char marker = 0;
+  long long result;
+  if(memory == nullptr || program->main_function < 0) return 1;
+
+  //space is left for error reporting below limit
+  if(getrlimit(RLIMIT_STACK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+    stack_size = limit.rlim_cur;
+  jit_stack_limit = reinterpret_cast<unsigned long long>(&marker)
+                      - stack_size + 256 * 1024;
+
+  if(setjmp(jit_env) != 0) return 1;
+  jit_function_t init = reinterpret_cast<jit_function_t>(
+                          memory + function_offsets[program->init_function]);
+  jit_function_t entry = reinterpret_cast<jit_function_t>(
+                          memory + function_offsets[program->main_function]);
+  init(nullptr);
+  result = entry(nullptr);
+  std::fflush(stdout);
+  return static_cast<int>(result);
+}
@@ -0,0 +1,97 @@
+/*
+*  src/jit.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in jit.cpp file by class jit,
+* x86-64 machine code generated from bytecode of class vm, used by --jit.
+*/
+
+#ifndef JIT_HPP
+#define JIT_HPP
+
+#include <string>
+#include <vector>
+#include <initializer_list>
+#include "vm.hpp"
+
+namespace xlang
+{
+
+//x86-64 register numbers used in encoding
+typedef enum{
+  JIT_RAX, JIT_RCX, JIT_RDX, JIT_RBX, JIT_RSP, JIT_RBP, JIT_RSI, JIT_RDI,
+  JIT_R8, JIT_R9, JIT_R10, JIT_R11
+}jit_reg_t;
+
+//runtime errors reported by generated code
+typedef enum{
+  JIT_DIVISION_BY_ZERO,
+  JIT_STACK_OVERFLOW
+}jit_error_t;
+
+//rel32 displacement at offset in code, to be set to target
+struct jit_patch
+{
+  size_t offset;
+  int target;
+};
+
+class jit
+{
+  public:
+    jit(class vm*);
+    ~jit();
+    //encode bytecode of program into executable memory
+    bool compile();
+    //execute main() and return its value
+    int run();
+
+  private:
+    class vm* program;
+    std::vector<unsigned char> code;
+    std::vector<size_t> function_offsets;
+    std::vector<void*> extern_addresses;
+    std::vector<struct jit_patch> call_patches;
+    unsigned char* memory = nullptr;
+    size_t memory_size = 0;
+
+    //state of function being encoded
+    std::vector<size_t> insn_offsets;
+    std::vector<struct jit_patch> jump_patches;
+    int frame_size = 0;
+    int reg_area = 0;
+
+    void emit_byte(int);
+    void emit_dword(int);
+    void emit_qword(long long);
+    void emit_rex(bool, int, int);
+    void emit_mem(int, bool, std::initializer_list<int>, int, int, int);
+    void emit_reg(int, bool, std::initializer_list<int>, int, int);
+    void emit_mov_imm(int, long long);
+    size_t emit_jump8(int);
+    void bind_jump8(size_t);
+    void emit_jump32(std::initializer_list<int>, int);
+    void emit_error(int, jit_error_t);
+
+    int slot(int);
+    int local(long long);
+    void load_slot(int, int);
+    void store_slot(int, int);
+    void store_int(int);
+    void gen_load(vm_kind_t, int, int, int);
+    void gen_store(vm_kind_t, int, int, int);
+    void gen_memory(const struct vm_insn&);
+    void gen_division(const struct vm_insn&);
+    void gen_float_compare(const struct vm_insn&);
+    void gen_extern_call(const struct vm_insn&);
+    void gen_insn(const struct vm_insn&);
+    void gen_function(const struct vm_function&);
+    void write_perf_map();
+};
+
+}
+
+#endif
+
@@ -0,0 +1,675 @@
+/*
+*  src/licm.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains loop-invariant code motion over the abstract syntax tree.
+* For each while/do-while/for loop, set of modified variables is collected
+* from assignments and ++/-- operators inside loop. An arithmetic expression
+* whose operands are integer literals or int variables not in that set
+* is computed once into a temporary before the loop(preheader),
+* and the expression in loop is replaced by that temporary.
+* Function calls and pointer stores inside loop are treated as
+* modifying every global and every local whose address is taken.
+* Loops having inline assembly are not touched.
+* Inner loops are handled first, so their hoisted temporaries
+* can be moved further out of enclosing loops.
+*/
+
+#include "tree.hpp"
+#include "symtab.hpp"
+#include "parser.hpp"
+#include "stats.hpp"
+#include "licm.hpp"
+
+using namespace xlang;
+
+//search symbol in function symbol table, parameters and global symbol table
+struct st_symbol_info* xlang::licm::search_id(std::string name)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, name);
+  if(syminfo != nullptr) return syminfo;
+  for(auto fparam : func_symtab->func_info->param_list){
+    if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name)
+      return fparam->symbol_info;
+  }
+  return xlang::symtable::search_symbol_node(xlang::global_symtab, name);
+}
+
+bool xlang::licm::is_global(std::string name)
+{
+  if(xlang::symtable::search_symbol(func_symtab, name))
+    return false;
+  for(auto fparam : func_symtab->func_info->param_list){
+    if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name)
+      return false;
+  }
+  return true;
+}
+
+void xlang::licm::get_ids(struct id_expr* idexpr, std::unordered_set<std::string>& ids)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_id)
+    ids.insert(idexpr->tok.lexeme);
+  get_ids(idexpr->left, ids);
+  get_ids(idexpr->right, ids);
+  get_ids(idexpr->unary, ids);
+}
+
+void xlang::licm::get_ids(struct primary_expr* pexpr, std::unordered_set<std::string>& ids)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_id)
+    ids.insert(pexpr->tok.lexeme);
+  get_ids(pexpr->left, ids);
+  get_ids(pexpr->right, ids);
+  get_ids(pexpr->unary_node, ids);
+}
+
+void xlang::licm::get_addrof_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && pexpr->tok.token == ADDROF_OP)
+    get_ids(pexpr->unary_node, addrof_members);
+  get_addrof_ids(pexpr->left);
+  get_addrof_ids(pexpr->right);
+  get_addrof_ids(pexpr->unary_node);
+}
+
+void xlang::licm::get_addrof_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && idexpr->tok.token == ADDROF_OP)
+    get_ids(idexpr->unary, addrof_members);
+  get_addrof_ids(idexpr->left);
+  get_addrof_ids(idexpr->right);
+  get_addrof_ids(idexpr->unary);
+}
+
+void xlang::licm::get_addrof_ids(struct expr* exp)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_addrof_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_addrof_ids(exp->assgn_expression->id_expression);
+      get_addrof_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_addrof_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_addrof_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        get_addrof_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::licm::get_addrof_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_addrof_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_addrof_ids(stm->selection_statement->condition);
+        get_addrof_ids(stm->selection_statement->if_statement);
+        get_addrof_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_addrof_ids(iter->_while.condition);
+            get_addrof_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_addrof_ids(iter->_dowhile.condition);
+            get_addrof_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_addrof_ids(iter->_for.init_expression);
+            get_addrof_ids(iter->_for.condition);
+            get_addrof_ids(iter->_for.update_expression);
+            get_addrof_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_addrof_ids(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        for(auto e : stm->asm_statement->output_operand)
+          get_addrof_ids(e->expression);
+        for(auto e : stm->asm_statement->input_operand)
+          get_addrof_ids(e->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+void xlang::licm::get_modified_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && (pexpr->tok.token == INCR_OP || pexpr->tok.token == DECR_OP))
+    get_ids(pexpr->unary_node, modified);
+  get_modified_ids(pexpr->left);
+  get_modified_ids(pexpr->right);
+  get_modified_ids(pexpr->unary_node);
+}
+
+void xlang::licm::get_modified_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && (idexpr->tok.token == INCR_OP || idexpr->tok.token == DECR_OP))
+    get_ids(idexpr->unary, modified);
+  get_modified_ids(idexpr->left);
+  get_modified_ids(idexpr->right);
+  get_modified_ids(idexpr->unary);
+}
+
+void xlang::licm::get_modified_ids(struct expr* exp)
+{
+  std::unordered_set<std::string> ids;
+  struct st_symbol_info* syminfo = nullptr;
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_modified_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_ids(exp->assgn_expression->id_expression, ids);
+      for(auto& name : ids){
+        modified.insert(name);
+        //store through pointer may modify any variable
+        syminfo = search_id(name);
+        if(syminfo == nullptr || syminfo->is_ptr)
+          has_ptr_store = true;
+      }
+      if(exp->assgn_expression->id_expression->is_ptr)
+        has_ptr_store = true;
+      get_modified_ids(exp->assgn_expression->id_expression);
+      get_modified_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_modified_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_modified_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      has_call = true;
+      for(auto e : exp->func_call_expression->expression_list)
+        get_modified_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::licm::get_modified_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_modified_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_modified_ids(stm->selection_statement->condition);
+        get_modified_ids(stm->selection_statement->if_statement);
+        get_modified_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_modified_ids(iter->_while.condition);
+            get_modified_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_modified_ids(iter->_dowhile.condition);
+            get_modified_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_modified_ids(iter->_for.init_expression);
+            get_modified_ids(iter->_for.condition);
+            get_modified_ids(iter->_for.update_expression);
+            get_modified_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_modified_ids(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        has_asm = true;
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+//check common subexpression node shared by optimizer
+bool xlang::licm::is_shared(struct primary_expr* pexpr,
+                            std::unordered_set<struct primary_expr*>& nodes)
+{
+  if(pexpr == nullptr) return false;
+  if(nodes.find(pexpr) != nodes.end())
+    return true;
+  nodes.insert(pexpr);
+  return is_shared(pexpr->left, nodes) || is_shared(pexpr->right, nodes)
+          || is_shared(pexpr->unary_node, nodes);
+}
+
+//int variable which is not modified in loop
+bool xlang::licm::is_invariant_id(struct primary_expr* pexpr)
+{
+  struct st_symbol_info* syminfo = search_id(pexpr->tok.lexeme);
+
+  if(syminfo == nullptr || syminfo->type_info == nullptr) return false;
+  if(syminfo->is_ptr || syminfo->is_array || syminfo->is_func_ptr)
+    return false;
+  if(syminfo->type_info->type != SIMPLE_TYPE
+     || syminfo->type_info->type_specifier.simple_type.size() != 1
+     || syminfo->type_info->type_specifier.simple_type[0].token != KEY_INT)
+    return false;
+  if(modified.find(pexpr->tok.lexeme) != modified.end())
+    return false;
+  if(has_call || has_ptr_store){
+    if(is_global(pexpr->tok.lexeme)
+       || addrof_members.find(pexpr->tok.lexeme) != addrof_members.end())
+      return false;
+  }
+  return true;
+}
+
+/*
+check expression tree is invariant,
+only binary arithmetic/bitwise operators are considered,
+division and modulus are not hoisted because they may trap
+*/
+bool xlang::licm::is_invariant(struct primary_expr* pexpr, bool* has_id)
+{
+  if(pexpr == nullptr) return false;
+
+  if(!pexpr->is_oprtr){
+    if(pexpr->is_id){
+      *has_id = true;
+      return is_invariant_id(pexpr);
+    }
+    switch(pexpr->tok.token){
+      case LIT_DECIMAL :
+      case LIT_OCTAL :
+      case LIT_HEX :
+      case LIT_BIN :
+        return true;
+      default :
+        return false;
+    }
+  }
+
+  if(pexpr->left == nullptr || pexpr->right == nullptr
+     || pexpr->unary_node != nullptr)
+    return false;
+
+  switch(pexpr->tok.token){
+    case ARTHM_ADD :
+    case ARTHM_SUB :
+    case ARTHM_MUL :
+    case BIT_AND :
+    case BIT_OR :
+    case BIT_EXOR :
+    case BIT_LSHIFT :
+    case BIT_RSHIFT :
+      return is_invariant(pexpr->left, has_id) && is_invariant(pexpr->right, has_id);
+    default :
+      return false;
+  }
+}
+
+bool xlang::licm::equals(struct primary_expr* pexpr1, struct primary_expr* pexpr2)
+{
+  if(pexpr1 == nullptr || pexpr2 == nullptr)
+    return pexpr1 == pexpr2;
+  if(pexpr1->is_oprtr != pexpr2->is_oprtr || pexpr1->is_id != pexpr2->is_id
+     || pexpr1->tok.token != pexpr2->tok.token
+     || pexpr1->tok.lexeme != pexpr2->tok.lexeme)
+    return false;
+  return equals(pexpr1->left, pexpr2->left) && equals(pexpr1->right, pexpr2->right);
+}
+
+//returns first identifier symbol from expression tree
+struct st_symbol_info* xlang::licm::get_leaf_symbol(struct primary_expr* pexpr)
+{
+  struct st_symbol_info* syminfo = nullptr;
+  if(pexpr == nullptr) return nullptr;
+  if(pexpr->is_id)
+    return search_id(pexpr->tok.lexeme);
+  syminfo = get_leaf_symbol(pexpr->left);
+  if(syminfo == nullptr)
+    syminfo = get_leaf_symbol(pexpr->right);
+  return syminfo;
+}
+
+//create int temporary in function symbol table
+struct st_symbol_info* xlang::licm::get_temp_symbol(struct primary_expr* pexpr)
+{
+  struct st_symbol_info* leaf = get_leaf_symbol(pexpr);
+  struct st_symbol_info* syminfo = nullptr;
+  std::string name = "_licm" + std::to_string(++temp_count);
+
+  xlang::symtable::insert_symbol(&func_symtab, name);
+  syminfo = xlang::last_symbol;
+  syminfo->symbol = name;
+  syminfo->tok = leaf->tok;
+  syminfo->tok.lexeme = name;
+  syminfo->type_info = leaf->type_info;
+  syminfo->is_ptr = false;
+  syminfo->ptr_oprtr_count = 0;
+  syminfo->is_array = false;
+  syminfo->is_func_ptr = false;
+  syminfo->ret_ptr_count = 0;
+  temp_members.insert(name);
+  return syminfo;
+}
+
+/*
+replace largest invariant subtrees of expression by temporaries,
+and add temporary = subtree; statements in preheader
+*/
+void xlang::licm::hoist_primary_expr(struct primary_expr** pexpr, struct stmt** preheader)
+{
+  struct primary_expr* pexp = *pexpr;
+  struct primary_expr* leaf = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct expr* assgnexp = nullptr;
+  struct id_expr* left = nullptr;
+  bool has_id = false;
+
+  if(pexp == nullptr || !pexp->is_oprtr) return;
+
+  if(!is_invariant(pexp, &has_id) || !has_id){
+    hoist_primary_expr(&pexp->left, preheader);
+    hoist_primary_expr(&pexp->right, preheader);
+    hoist_primary_expr(&pexp->unary_node, preheader);
+    return;
+  }
+
+  for(auto& h : hoisted){
+    if(equals(h.first, pexp)){
+      syminfo = h.second;
+      break;
+    }
+  }
+
+  leaf = xlang::tree::get_primary_expr_mem();
+  leaf->tok = pexp->tok;
+
+  if(syminfo == nullptr){
+    syminfo = get_temp_symbol(pexp);
+
+    left = xlang::tree::get_id_expr_mem();
+    left->tok = pexp->tok;
+    left->tok.token = IDENTIFIER;
+    left->tok.lexeme = syminfo->symbol;
+    left->is_id = true;
+    left->id_info = syminfo;
+
+    assgnexp = xlang::tree::get_expr_mem();
+    assgnexp->expr_kind = ASSGN_EXPR;
+    assgnexp->assgn_expression = xlang::tree::get_assgn_expr_mem();
+    assgnexp->assgn_expression->tok = pexp->tok;
+    assgnexp->assgn_expression->tok.token = ASSGN;
+    assgnexp->assgn_expression->tok.lexeme = "=";
+    assgnexp->assgn_expression->id_expression = left;
+    assgnexp->assgn_expression->expression = xlang::tree::get_expr_mem();
+    assgnexp->assgn_expression->expression->expr_kind = PRIMARY_EXPR;
+    assgnexp->assgn_expression->expression->primary_expression = pexp;
+
+    newstmt = xlang::tree::get_stmt_mem();
+    newstmt->type = EXPR_STMT;
+    newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+    newstmt->expression_statement->expression = assgnexp;
+    xlang::tree::add_statement(preheader, &newstmt);
+
+    hoisted.push_back(std::pair<struct primary_expr*, struct st_symbol_info*>(pexp, syminfo));
+    xlang::stats::count("licm.hoisted-expressions");
+    xlang::stats::remark("licm", pexp->tok.loc, "loop invariant expression hoisted into "
+                         +syminfo->symbol);
+  }else{
+    xlang::tree::delete_primary_expr(&pexp);
+  }
+
+  leaf->tok.token = IDENTIFIER;
+  leaf->tok.lexeme = syminfo->symbol;
+  leaf->is_oprtr = false;
+  leaf->is_id = true;
+  leaf->id_info = syminfo;
+  *pexpr = leaf;
+}
+
+void xlang::licm::hoist_expression(struct expr* exp, struct stmt** preheader)
+{
+  std::unordered_set<struct primary_expr*> nodes;
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      if(!is_shared(exp->primary_expression, nodes))
+        hoist_primary_expr(&exp->primary_expression, preheader);
+      break;
+    case ASSGN_EXPR :
+      hoist_expression(exp->assgn_expression->expression, preheader);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        hoist_expression(e, preheader);
+      break;
+    default: break;
+  }
+}
+
+void xlang::licm::hoist_statement_list(struct stmt** head, struct stmt** preheader)
+{
+  struct stmt* stm = *head;
+  struct stmt* next = nullptr;
+  struct iter_stmt* iter = nullptr;
+  struct assgn_expr* assgnexp = nullptr;
+  struct id_expr* left = nullptr;
+  bool has_id = false;
+
+  while(stm != nullptr){
+    next = stm->p_next;
+    switch(stm->type){
+      case EXPR_STMT :
+        //temporary = invariant; from inner loop preheader is moved out
+        if(stm->expression_statement->expression != nullptr
+           && stm->expression_statement->expression->expr_kind == ASSGN_EXPR){
+          assgnexp = stm->expression_statement->expression->assgn_expression;
+          left = assgnexp->id_expression;
+          if(left->is_id && left->left == nullptr && left->right == nullptr
+             && left->unary == nullptr
+             && temp_members.find(left->tok.lexeme) != temp_members.end()
+             && assgnexp->expression != nullptr
+             && assgnexp->expression->expr_kind == PRIMARY_EXPR
+             && is_invariant(assgnexp->expression->primary_expression, &has_id)){
+            if(stm->p_prev != nullptr)
+              stm->p_prev->p_next = stm->p_next;
+            else
+              *head = stm->p_next;
+            if(stm->p_next != nullptr)
+              stm->p_next->p_prev = stm->p_prev;
+            stm->p_next = nullptr;
+            stm->p_prev = nullptr;
+            xlang::tree::add_statement(preheader, &stm);
+            xlang::stats::count("licm.hoisted-expressions");
+            xlang::stats::remark("licm", assgnexp->tok.loc, "loop invariant "
+                                 +left->tok.lexeme+" hoisted out of outer loop");
+            break;
+          }
+        }
+        hoist_expression(stm->expression_statement->expression, preheader);
+        break;
+      case SELECT_STMT :
+        hoist_expression(stm->selection_statement->condition, preheader);
+        hoist_statement_list(&stm->selection_statement->if_statement, preheader);
+        hoist_statement_list(&stm->selection_statement->else_statement, preheader);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            hoist_expression(iter->_while.condition, preheader);
+            hoist_statement_list(&iter->_while.statement, preheader);
+            break;
+          case DOWHILE_STMT :
+            hoist_expression(iter->_dowhile.condition, preheader);
+            hoist_statement_list(&iter->_dowhile.statement, preheader);
+            break;
+          case FOR_STMT :
+            hoist_expression(iter->_for.init_expression, preheader);
+            hoist_expression(iter->_for.condition, preheader);
+            hoist_expression(iter->_for.update_expression, preheader);
+            hoist_statement_list(&iter->_for.statement, preheader);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        hoist_expression(stm->jump_statement->expression, preheader);
+        break;
+      default: break;
+    }
+    stm = next;
+  }
+}
+
+//hoist invariants of loop statement into preheader inserted before it
+void xlang::licm::hoist_loop(struct stmt** head, struct stmt* loop)
+{
+  struct iter_stmt* iter = loop->iteration_statement;
+  struct stmt* preheader = nullptr;
+  struct stmt* tail = nullptr;
+
+  modified.clear();
+  hoisted.clear();
+  has_call = false;
+  has_ptr_store = false;
+  has_asm = false;
+
+  switch(iter->type){
+    case WHILE_STMT :
+      get_modified_ids(iter->_while.condition);
+      get_modified_ids(iter->_while.statement);
+      break;
+    case DOWHILE_STMT :
+      get_modified_ids(iter->_dowhile.condition);
+      get_modified_ids(iter->_dowhile.statement);
+      break;
+    case FOR_STMT :
+      get_modified_ids(iter->_for.init_expression);
+      get_modified_ids(iter->_for.condition);
+      get_modified_ids(iter->_for.update_expression);
+      get_modified_ids(iter->_for.statement);
+      break;
+  }
+  if(has_asm) return;
+
+  switch(iter->type){
+    case WHILE_STMT :
+      hoist_expression(iter->_while.condition, &preheader);
+      hoist_statement_list(&iter->_while.statement, &preheader);
+      break;
+    case DOWHILE_STMT :
+      hoist_expression(iter->_dowhile.condition, &preheader);
+      hoist_statement_list(&iter->_dowhile.statement, &preheader);
+      break;
+    case FOR_STMT :
+      hoist_expression(iter->_for.condition, &preheader);
+      hoist_expression(iter->_for.update_expression, &preheader);
+      hoist_statement_list(&iter->_for.statement, &preheader);
+      break;
+  }
+  if(preheader == nullptr) return;
+
+  tail = preheader;
+  while(tail->p_next != nullptr)
+    tail = tail->p_next;
+
+  preheader->p_prev = loop->p_prev;
+  if(loop->p_prev != nullptr)
+    loop->p_prev->p_next = preheader;
+  else
+    *head = preheader;
+  tail->p_next = loop;
+  loop->p_prev = tail;
+}
+
+void xlang::licm::optimize_statement_list(struct stmt** head)
+{
+  struct stmt* stm = *head;
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case SELECT_STMT :
+        optimize_statement_list(&stm->selection_statement->if_statement);
+        optimize_statement_list(&stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        //inner loops first
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            optimize_statement_list(&iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            optimize_statement_list(&iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            optimize_statement_list(&iter->_for.statement);
+            break;
+        }
+        hoist_loop(head, stm);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+void xlang::licm::hoist_loop_invariants(struct tree_node** tr)
+{
+  struct tree_node* trhead = *tr;
+
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr){
+      func_symtab = trhead->symtab;
+      xlang::stats::set_function(func_symtab->func_info->func_name);
+      addrof_members.clear();
+      get_addrof_ids(trhead->statement);
+      optimize_statement_list(&trhead->statement);
+    }
+    trhead = trhead->p_next;
+  }
+  func_symtab = nullptr;
+}
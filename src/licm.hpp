@@ -0,0 +1,76 @@
+/*
+*  src/licm.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in licm.cpp file by class licm.
+*/
+
+#ifndef LICM_HPP
+#define LICM_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include "token.hpp"
+#include "types.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+namespace xlang{
+
+class licm
+{
+public:
+  void hoist_loop_invariants(struct tree_node**);
+
+private:
+  //count of created temporaries, used for unique names
+  unsigned temp_count = 0;
+
+  //function whose loops are optimized
+  struct st_node* func_symtab = nullptr;
+  //locals whose address is taken in function
+  std::unordered_set<std::string> addrof_members;
+  //temporaries created by hoisting
+  std::unordered_set<std::string> temp_members;
+
+  //state of currently optimized loop
+  std::unordered_set<std::string> modified;
+  bool has_call = false;
+  bool has_ptr_store = false;
+  bool has_asm = false;
+  std::vector<std::pair<struct primary_expr*, struct st_symbol_info*>> hoisted;
+
+  struct st_symbol_info* search_id(std::string);
+  bool is_global(std::string);
+
+  void get_ids(struct id_expr*, std::unordered_set<std::string>&);
+  void get_ids(struct primary_expr*, std::unordered_set<std::string>&);
+  void get_addrof_ids(struct primary_expr*);
+  void get_addrof_ids(struct id_expr*);
+  void get_addrof_ids(struct expr*);
+  void get_addrof_ids(struct stmt*);
+  void get_modified_ids(struct primary_expr*);
+  void get_modified_ids(struct id_expr*);
+  void get_modified_ids(struct expr*);
+  void get_modified_ids(struct stmt*);
+
+  bool is_shared(struct primary_expr*, std::unordered_set<struct primary_expr*>&);
+  bool is_invariant_id(struct primary_expr*);
+  bool is_invariant(struct primary_expr*, bool*);
+  bool equals(struct primary_expr*, struct primary_expr*);
+  struct st_symbol_info* get_temp_symbol(struct primary_expr*);
+  struct st_symbol_info* get_leaf_symbol(struct primary_expr*);
+  void hoist_primary_expr(struct primary_expr**, struct stmt**);
+  void hoist_expression(struct expr*, struct stmt**);
+  void hoist_statement_list(struct stmt**, struct stmt**);
+  void hoist_loop(struct stmt**, struct stmt*);
+  void optimize_statement_list(struct stmt**);
+};
+
+}
+
+#endif
+
@@ -8,6 +8,7 @@
 */
 
 #include <iostream>
+#include <fstream>
 #include <vector>
 #include <algorithm>
 #include <unistd.h>
@@ -21,6 +22,11 @@
 #include "parser.hpp"
 #include "analyze.hpp"
 #include "x86_gen.hpp"
+#include "stats.hpp"
+#include "profile.hpp"
+#include "optimize.hpp"
+#include "vm.hpp"
+#include "jit.hpp"
 
 struct xlang::tree_node* ast = nullptr;
 bool print_tree = false;
@@ -31,6 +37,22 @@ bool omit_frame_pointer = false;
 bool compile_only = false;
 bool assemble_only = false;
 bool optimize = false;
+bool print_stats = false;
+bool stats_json = false;
+bool use_sse2 = false;
+bool target_x86_64 = false;
+int inline_limit = 10;
+bool unroll_loops = false;
+int max_unroll_factor = 4;
+bool vectorize_loops = false;
+bool time_report = false;
+bool instrument_time = false;
+bool profile_generate = false;
+std::string profile_use = "";
+bool run_program = false;
+bool jit_program = false;
+bool annotate_cost = false;
+bool print_size = false;
 std::string asm_filename = "";
 
 bool check_error_count()
@@ -66,8 +88,53 @@ std::string process_args(std::vector<std::string>& args)
       compile_only = true;
     }else if(str == "-c"){
       assemble_only = true;
+    }else if(str == "-O0"){
+      optimize = false;
     }else if(str == "-O1"){
       optimize = true;
+    }else if(str == "--print-stats"){
+      print_stats = true;
+    }else if(str == "--stats=json"){
+      print_stats = true;
+      stats_json = true;
+    }else if(str == "-Rpass" || str == "-Rpass-missed"){
+      xlang::stats::enable_remarks("", str == "-Rpass-missed");
+    }else if(str.compare(0, 7, "-Rpass=") == 0){
+      xlang::stats::enable_remarks(str.substr(7), false);
+    }else if(str.compare(0, 14, "-Rpass-missed=") == 0){
+      xlang::stats::enable_remarks(str.substr(14), true);
+    }else if(str == "-msse2"){
+      use_sse2 = true;
+    }else if(str == "--target=x86_64"){
+      //floating point values are passed in xmm registers on x86_64
+      target_x86_64 = true;
+      use_sse2 = true;
+    }else if(str == "--target=x86"){
+      target_x86_64 = false;
+    }else if(str.compare(0, 15, "-finline-limit=") == 0){
+      inline_limit = std::atoi(str.substr(15).c_str());
+    }else if(str == "-funroll-loops"){
+      unroll_loops = true;
+    }else if(str.compare(0, 20, "-fmax-unroll-factor=") == 0){
+      max_unroll_factor = std::atoi(str.substr(20).c_str());
+    }else if(str == "-fvectorize"){
+      vectorize_loops = true;
+    }else if(str == "-ftime-report"){
+      time_report = true;
+    }else if(str == "-finstrument-time"){
+      instrument_time = true;
+    }else if(str == "-fprofile-generate"){
+      profile_generate = true;
+    }else if(str.compare(0, 14, "-fprofile-use=") == 0){
+      profile_use = str.substr(14);
+    }else if(str == "--run"){
+      run_program = true;
+    }else if(str == "--jit"){
+      jit_program = true;
+    }else if(str == "--annotate-cost"){
+      annotate_cost = true;
+    }else if(str == "--size-report"){
+      print_size = true;
     }else{
       file = str;
     }
@@ -102,6 +169,41 @@ std::string get_object_filename(std::string filename)
   return filename + ".o";
 }
 
+/*
+print time spent in each compiler phase,
+parser time includes lexing done on demand by parser,
+so lexer is timed by a separate pass over all tokens of file
+*/
+void print_time_report(std::string filename)
+{
+  std::vector<std::string> phases = {"parser", "analyzer", "optimizer",
+                                     "x86_gen", "peephole", "asm-write", "total"};
+  std::ifstream inp_file(filename);
+  std::string line;
+  int tokens = 0, lines = 0;
+
+  xlang::stats::start_timer("lexer");
+  xlang::lexer *lx = new xlang::lexer(filename);
+  while(lx->get_next_token().token != END_OF_FILE)
+    tokens++;
+  delete lx;
+  xlang::stats::stop_timer("lexer");
+
+  while(std::getline(inp_file, line))
+    lines++;
+
+  std::cout<<"file: "<<filename<<std::endl;
+  xlang::print::print_white_bold_text("time report:");
+  std::cout<<std::endl;
+  std::cout<<std::fixed;
+  std::cout.precision(6);
+  std::cout<<"  lexer : "<<xlang::stats::get_time("lexer")<<std::endl;
+  for(auto p : phases)
+    std::cout<<"  "<<p<<" : "<<xlang::stats::get_time(p)<<std::endl;
+  std::cout<<"  tokens : "<<tokens<<std::endl;
+  std::cout<<"  lines : "<<lines<<std::endl;
+}
+
 /*
 compile the program
 
@@ -136,12 +238,16 @@ compile the program
 */
 bool compile(std::string filename)
 {
+  xlang::stats::start_timer("total");
+
   //create lex object with input filename
   xlang::lex = new xlang::lexer(filename);
 
   //create parser object
+  xlang::stats::start_timer("parser");
   xlang::parser *p = new xlang::parser();
   ast = p->parse();   //parse the whole program & get Abstract Syntax Tree(ast)
+  xlang::stats::stop_timer("parser");
 
   //check error count occured in parsing, otherwise halt
   if(!check_error_count()){
@@ -151,8 +257,17 @@ bool compile(std::string filename)
   }
 
   //create sematic analyzer object
+  xlang::stats::start_timer("analyzer");
   xlang::analyzer *an = new xlang::analyzer();
   an->analyze(&ast);  //analyze whole program by traversing AST
+  xlang::stats::stop_timer("analyzer");
+
+  //statements are looked up in profile by their line in function
+  if(profile_generate || !profile_use.empty()){
+    xlang::profile::set_functions(ast);
+    if(!profile_use.empty() && !xlang::profile::read(profile_use))
+      xlang::error::print_error(profile_use, "cannot read profile file");
+  }
 
   //check error count from analyzer
   if(!check_error_count()){
@@ -162,10 +277,15 @@ bool compile(std::string filename)
     return false;
   }
 
+  //source is counted before optimizer changes tree
+  if(print_stats)
+    xlang::stats::count_source(filename, ast);
+
   //create x86 code generation object
   xlang::x86_gen *x86 = new xlang::x86_gen;
   x86->gen_x86_code(&ast);    //generate x86 assembly code from ast
                             // the code is written to file asm_filename
+  xlang::stats::stop_timer("total");
 
   if(xlang::error_count == 0){
     if(print_tree){
@@ -180,6 +300,14 @@ bool compile(std::string filename)
       std::cout<<"file: "<<filename<<std::endl;
       xlang::print::print_record_symtab(xlang::record_table);
     }
+    if(stats_json){
+      xlang::stats::print_json(filename);
+    }else if(print_stats){
+      std::cout<<"file: "<<filename<<std::endl;
+      xlang::stats::print_stats();
+    }
+    if(time_report)
+      print_time_report(filename);
   }
 
   xlang::tree::delete_tree(&ast);
@@ -195,15 +323,71 @@ bool compile(std::string filename)
 }
 
 
+/*
+execute program by bytecode interpreter without assembling it,
+value returned by main() is returned
+*/
+int run(std::string filename)
+{
+  int status = 1;
+  xlang::lex = new xlang::lexer(filename);
+  xlang::parser *p = new xlang::parser();
+  ast = p->parse();
+
+  if(!check_error_count()){
+    delete p;
+    delete xlang::lex;
+    return status;
+  }
+
+  xlang::analyzer *an = new xlang::analyzer();
+  an->analyze(&ast);
+
+  if(!check_error_count()){
+    delete an;
+    delete p;
+    delete xlang::lex;
+    return status;
+  }
+
+  if(optimize){
+    xlang::optimizer optmz;
+    optmz.optimize(&ast);
+  }
+
+  //bytecode is executed by interpreter, or encoded into x86-64 code by jit
+  xlang::vm *v = new xlang::vm(jit_program);
+  if(v->compile(ast)){
+    if(jit_program){
+      xlang::jit j(v);
+      if(j.compile())
+        status = j.run();
+    }else{
+      status = v->run();
+    }
+  }
+
+  xlang::tree::delete_tree(&ast);
+  xlang::symtable::delete_node(&xlang::global_symtab);
+  xlang::symtable::delete_record_symtab(&xlang::record_table);
+
+  delete v;
+  delete an;
+  delete p;
+  delete xlang::lex;
+
+  return status;
+}
+
 /*
 assemble the assembly file by invoking NASM assembler
 */
 void assemble(std::string filename)
 {
   std::string assembler = "/usr/bin/nasm";
-  std::string options = "-felf32";
+  std::string options = target_x86_64 ? "-felf64" : "-felf32";
   int status;
-  char *ps_argv[3];
+  char *ps_argv[4];
   ps_argv[0] = const_cast<char*>("nasm");
   ps_argv[1] = const_cast<char*>(options.c_str());
   ps_argv[2] = const_cast<char*>(asm_filename.c_str());
@@ -235,7 +419,7 @@ instructions in x86 generation phase with _start() function
 void link(std::string objfilename)
 {
   std::string link = "/usr/bin/gcc";
-  std::string option1 = "-m32";
+  std::string option1 = target_x86_64 ? "-no-pie" : "-m32";
   std::string option2 = "-nostdlib";
   std::string option3 = "-o";
   std::string outputfile = "a.out";
@@ -292,6 +476,15 @@ int main(int argc, char** argv)
   if(filename.empty()){
     xlang::error::print_error("No files provided");
     return 0;
+  }else if(instrument_time && !use_cstdlib){
+    //profile is written with fopen/fprintf at exit of program
+    xlang::error::print_error("-finstrument-time requires C standard library");
+    return 0;
+  }else if(profile_generate && !use_cstdlib){
+    xlang::error::print_error("-fprofile-generate requires C standard library");
+    return 0;
+  }else if(run_program || jit_program){
+    return run(filename);
   }else{
     asm_filename = get_asm_filename(filename);
 
@@ -5,8 +5,7 @@
 */
 /*
 * Contains optimizing compiler functions
-* such as constant folding, strength reduction,
-* common subexpression elimination, dead code elimination.
+* such as constant folding, strength reduction, dead code elimination.
 */
 
 #include <vector>
@@ -21,6 +20,14 @@
 #include "convert.hpp"
 #include "symtab.hpp"
 #include "parser.hpp"
+#include "tailcall.hpp"
+#include "inliner.hpp"
+#include "licm.hpp"
+#include "unroll.hpp"
+#include "profile.hpp"
+#include "induction.hpp"
+#include "valnum.hpp"
+#include "stats.hpp"
 #include "optimize.hpp"
 
 using namespace xlang;
@@ -210,6 +217,9 @@ void xlang::optimizer::constant_folding(struct primary_expr** pexpr)
               restok.lexeme = std::to_string(result);
             }
           }
+          xlang::stats::count("optimizer.constant-folds");
+          xlang::stats::remark("constant-fold", opr.loc, "folded "+fact1.lexeme+" "
+                               +opr.lexeme+" "+fact2.lexeme+" to "+restok.lexeme);
           pexp_eval.push(restok);
         }
       }
@@ -235,129 +245,6 @@ void xlang::optimizer::constant_folding(struct primary_expr** pexpr)
   clear_primary_expr_stack();
 }
 
-//returns true of both stacks are equals by primary expr lexeme values
-bool xlang::optimizer::equals(std::stack<struct primary_expr*> st1,
-                              std::stack<struct primary_expr*> st2)
-{
-  int result = 1;
-  if(st1.size() != st2.size()) return false;
-  while(!st1.empty()){
-    if(st1.top()->tok.lexeme == st2.top()->tok.lexeme)
-      result &= 1;
-    else
-      result &= 0;
-
-    if(st1.empty()) break;
-    st1.pop();
-    if(st2.empty()) break;
-    st2.pop();
-  }
-
-  if(result == 1) return true;
-  else return false;
-}
-
-/*
-search cmn1 expr node in primary expr tree
-if found then return its address from tree
-*/
-struct primary_expr*
-xlang::optimizer::get_cmnexpr1_node(struct primary_expr** root,
-                                    struct primary_expr** cmn1)
-{
-  if(*root == nullptr) return nullptr;
-  if((*root)->left != nullptr){
-    if((*root)->left == *cmn1){
-      return (*root)->left;
-    }else{
-      get_cmnexpr1_node(&(*root)->left, &(*cmn1));
-      get_cmnexpr1_node(&(*root)->left->right, &(*cmn1));
-    }
-  }
-  return nullptr;
-}
-
-/*
-cmn1 is common subexpression from right side of a tree
-cmn2 is common subexpression from left side of a tree
-traverse primary expr tree, search for common expression
-in tree by calling get_cmnexpr1_node(), delete its right subtree,
-and set its right side pointer to received common subexpr node
-by function get_cmnexpr1_node()
-*/
-void xlang::optimizer::change_subexpr_pointers(struct primary_expr** root,
-            struct primary_expr** cmn1, struct primary_expr** cmn2)
-{
-  struct primary_expr* node1 = nullptr;
-  if(*root == nullptr) return;
-  if((*root)->right != nullptr){
-    node1 = get_cmnexpr1_node(&(*root), &(*cmn2));
-    if((*root)->right == *cmn1){
-      xlang::tree::delete_primary_expr(&(*root)->right);
-      (*root)->right = node1;
-      return;
-    }else{
-      change_subexpr_pointers(&(*root)->left, &(*cmn1), &(*cmn2));
-      change_subexpr_pointers(&(*root)->right, &(*cmn1), &(*cmn2));
-    }
-  }
-}
-
-/*
-common subexpression elimination optimization
-traverse tree, putting each node on stack, and then stack are compared
-it can only optimize simple two factors expression(e.g: (a+b)*(a+b)
-more than this are not handled yet(change in loop).
-*/
-void xlang::optimizer::common_subexpression_elimination(struct primary_expr** pexpr)
-{
-  struct primary_expr* pexp = *pexpr;
-  struct primary_expr *cmnexpr1 = nullptr, *cmnexpr2 = nullptr;
-  struct primary_expr* temp = nullptr;
-  std::stack<struct primary_expr*> st;
-  std::stack<struct primary_expr*> prev_stack;
-
-  if(pexp == nullptr) return;
-
-  get_inorder_primary_expr(&pexp);
-
-  while(!pexpr_stack.empty()){
-    temp = pexpr_stack.top();
-    prev_stack.push(temp);
-    pexpr_stack.pop();
-    if(temp->is_oprtr){
-      break;
-    }
-  }
-
-  while(!pexpr_stack.empty()){
-    temp = pexpr_stack.top();
-    st.push(temp);
-    pexpr_stack.pop();
-    if(temp->is_oprtr){
-      if(equals(st, prev_stack)){
-        if(pexpr_stack.empty()) break;
-        pexpr_stack.pop();
-        if(prev_stack.size() > 0){
-          cmnexpr1 = prev_stack.top();
-          cmnexpr2 = st.top();
-          break;
-        }
-      }else{
-        if(pexpr_stack.empty()) break;
-        st.pop();
-      }
-    }
-  }
-
-  clear_stack(prev_stack);
-  clear_stack(st);
-  clear_primary_expr_stack();
-
-  if(cmnexpr1 != nullptr && cmnexpr2 != nullptr)
-    change_subexpr_pointers(&(*pexpr), &cmnexpr1, &cmnexpr2);
-}
-
 //returns true if n is power of 2
 bool xlang::optimizer::is_powerof_2(int n, int* iter)
 {
@@ -378,8 +265,8 @@ bool xlang::optimizer::is_powerof_2(int n, int* iter)
 /*
 strength reduction optimization
 converting multiplication by 2^n left-shift operator(<<)
-division by 2^n right-shift operator(>>)
-modulus by (2^n)-1 bitwise-and operator(&)
+division and modulus by constants are left to code generator,
+because signed division by 2^n is not a right shift for negative values
 */
 void xlang::optimizer::strength_reduction(struct primary_expr** pexpr)
 {
@@ -399,25 +286,15 @@ void xlang::optimizer::strength_reduction(struct primary_expr** pexpr)
             switch(root->tok.token){
               case ARTHM_MUL :
                 if(is_powerof_2(decm, &iter)){
+                  xlang::stats::count("strength.multiply-to-shift");
+                  xlang::stats::remark("strength-reduce", root->tok.loc,
+                                       "multiply by "+right->tok.lexeme
+                                       +" reduced to left shift by "+std::to_string(iter));
                   root->tok.token = BIT_LSHIFT;
                   root->tok.lexeme = "<<";
                   right->tok.lexeme = std::to_string(iter);
                 }
                 break;
-              case ARTHM_DIV :
-                if(is_powerof_2(decm, &iter)){
-                  root->tok.token = BIT_RSHIFT;
-                  root->tok.lexeme = ">>";
-                  right->tok.lexeme = std::to_string(iter);
-                }
-                break;
-              case ARTHM_MOD :
-                if(is_powerof_2(decm, &iter)){
-                  root->tok.token = BIT_AND;
-                  root->tok.lexeme = "&";
-                  right->tok.lexeme = std::to_string(decm - 1);
-                }
-                break;
               default: break;
             }
           }
@@ -437,8 +314,6 @@ void xlang::optimizer::optimize_primary_expression(struct primary_expr** pexpr)
 
   constant_folding(&(*pexpr));
 
-  common_subexpression_elimination(&(*pexpr));
-
   strength_reduction(&(*pexpr));
 
 }
@@ -685,17 +560,61 @@ void xlang::optimizer::dead_code_elimination(struct tree_node** tr)
   }
 }
 
+extern int inline_limit;
+extern bool unroll_loops;
+extern int max_unroll_factor;
+extern bool vectorize_loops;
+extern bool use_sse2;
+extern bool profile_generate;
+
 void xlang::optimizer::optimize(struct tree_node** tr)
 {
   struct tree_node* trhead = *tr;
   if(trhead == nullptr) return;
 
+  //self recursion becomes loop, such functions can be inlined
+  xlang::tailcall tc;
+  tc.eliminate_tail_calls(&trhead);
+  trhead = *tr;
+
+  //inline small functions before unused locals are removed,
+  //-fprofile-generate keeps calls so that entries of all functions are counted
+  xlang::inliner inl(profile_generate ? -1 : inline_limit);
+  inl.inline_functions(&trhead);
+  trhead = *tr;
+
   dead_code_elimination(&trhead);
   trhead = *tr;
 
+  //unrolled copies get constant index values folded below
+  //with profile, only hot loops are unrolled without -funroll-loops
+  if(unroll_loops || xlang::profile::is_loaded()){
+    xlang::unroller ur(max_unroll_factor, !unroll_loops);
+    ur.unroll_loops(&trhead);
+    trhead = *tr;
+  }
+
+  //i * c is reduced before it is turned into shift
+  xlang::induction iv(vectorize_loops && use_sse2);
+  iv.reduce_induction_variables(&trhead);
+  trhead = *tr;
+
   while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr)
+      xlang::stats::set_function(trhead->symtab->func_info->func_name);
+    else
+      xlang::stats::set_function("");
     optimize_statement(&trhead->statement);
     trhead = trhead->p_next;
   }
+
+  //common subexpressions of folded expressions, before their temporaries are hoisted
+  xlang::valnum vn(vectorize_loops && use_sse2);
+  vn.number_values(&(*tr));
+
+  //hoist loop invariants after expressions are folded
+  xlang::licm lm;
+  lm.hoist_loop_invariants(&(*tr));
+  xlang::stats::set_function("");
 }
 
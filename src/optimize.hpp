@@ -33,11 +33,6 @@ private:
   bool has_id(struct primary_expr*);
   void id_constant_folding(struct primary_expr**);
   void constant_folding(struct primary_expr**);
-  bool equals(std::stack<struct primary_expr*>, std::stack<struct primary_expr*>);
-  struct primary_expr* get_cmnexpr1_node(struct primary_expr**, struct primary_expr**);
-  void change_subexpr_pointers(struct primary_expr**, struct primary_expr**,
-                              struct primary_expr**);
-  void common_subexpression_elimination(struct primary_expr**);
   bool is_powerof_2(int, int*);
   void strength_reduction(struct primary_expr**);
   void optimize_primary_expression(struct primary_expr**);
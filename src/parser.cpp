@@ -1277,7 +1277,19 @@ struct primary_expr* xlang::parser::get_primary_expr_tree()
         extree_stack.pop();
         extree_stack.push(oprtr);
       }
-    }else if((*post_it).token == BIT_COMPL || (*post_it).token == LOG_NOT){
+    }else if((*post_it).token == LOG_NOT){
+      //! applies to its operand only, e.g !a || b is (!a) || b
+      oprtr = xlang::tree::get_primary_expr_mem();
+      oprtr->tok = *post_it;
+      oprtr->is_id = false;
+      oprtr->is_oprtr = true;
+      oprtr->oprtr_kind = UNARY_OP;
+      if(!extree_stack.empty()){
+        oprtr->unary_node = extree_stack.top();
+        extree_stack.pop();
+      }
+      extree_stack.push(oprtr);
+    }else if((*post_it).token == BIT_COMPL){
       unary_tok = *post_it;
     }
   }
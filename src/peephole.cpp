@@ -0,0 +1,614 @@
+/*
+*  src/peephole.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains peephole optimizer over the generated x86 instructions.
+* A table of rewrite rules is applied with a sliding window
+* on instruction vector until no more rule can be applied.
+* Comments(INSNONE) are skipped while matching a window,
+* labels, jumps, calls and inline assembly ends a basic block.
+* Each applied rewrite is counted in statistics.
+*/
+
+#include "stats.hpp"
+#include "peephole.hpp"
+
+using namespace xlang;
+
+xlang::peephole::peephole(std::vector<struct insn*>& ins,
+                          xlang::insn_class* icls, xlang::regs* r)
+                          : instructions(ins), insncls(icls), reg(r)
+{
+  //rule name, window size, rewrite function
+  rules = {
+    {"mov-same-register", 1, &peephole::mov_same_register},
+    {"push-pop", 2, &peephole::push_pop},
+    {"store-reload", 2, &peephole::store_reload},
+    {"fold-load-operand", 2, &peephole::fold_load_operand},
+    {"dead-register-clear", 1, &peephole::dead_register_clear},
+    {"jump-to-next-label", 1, &peephole::jump_to_next_label},
+    {"cond-jump-over-jump", 3, &peephole::cond_jump_over_jump},
+    {"unreachable-code", 2, &peephole::unreachable_code},
+    {"redundant-stack-restore", 2, &peephole::redundant_stack_restore},
+    {"unused-label", 1, &peephole::unused_label}
+  };
+}
+
+//returns true if instruction contains only comment
+bool xlang::peephole::is_comment(struct insn* in)
+{
+  return (in->insn_type == INSNONE);
+}
+
+//returns index of next instruction skipping comments
+size_t xlang::peephole::next_insn(size_t index)
+{
+  size_t i = index + 1;
+  while(i < instructions.size()){
+    if(instructions[i] != nullptr && !is_comment(instructions[i]))
+      return i;
+    i++;
+  }
+  return instructions.size();
+}
+
+/*
+get window of instructions indexes starting at index,
+returns false if there are not enough instructions
+*/
+bool xlang::peephole::get_window(size_t index, size_t size,
+                                std::vector<size_t>& window)
+{
+  window.clear();
+  window.push_back(index);
+  while(window.size() < size){
+    index = next_insn(index);
+    if(index >= instructions.size())
+      return false;
+    window.push_back(index);
+  }
+  return true;
+}
+
+//delete instruction, removed entries are compacted after each pass
+void xlang::peephole::remove_insn(size_t index)
+{
+  struct insn* in = instructions[index];
+  if(in == nullptr) return;
+  if(in->operand_1 != nullptr)
+    insncls->delete_operand(&in->operand_1);
+  if(in->operand_2 != nullptr)
+    insncls->delete_operand(&in->operand_2);
+  insncls->delete_insn(&in);
+  instructions[index] = nullptr;
+}
+
+void xlang::peephole::compact()
+{
+  std::vector<struct insn*> result;
+  for(struct insn* in : instructions){
+    if(in != nullptr)
+      result.push_back(in);
+  }
+  instructions.swap(result);
+}
+
+//collect all labels used by jumps/calls and all inline assembly text
+void xlang::peephole::get_referenced_labels()
+{
+  referenced_labels.clear();
+  inline_asm_text.clear();
+  for(struct insn* in : instructions){
+    if(in == nullptr) continue;
+    if(insncls->is_jump(in->insn_type) || in->insn_type == CALL
+        || in->insn_type == LOOP){
+      if(in->operand_1 != nullptr && in->operand_1->type == LITERAL)
+        referenced_labels.push_back(in->operand_1->literal);
+    }else if(in->insn_type == INSASM){
+      inline_asm_text += in->inline_asm + "\n";
+    }
+  }
+}
+
+bool xlang::peephole::is_label_referenced(std::string label)
+{
+  for(auto& l : referenced_labels){
+    if(l == label) return true;
+  }
+  //label could be used in inline assembly
+  return (inline_asm_text.find(label) != std::string::npos);
+}
+
+//returns true if operand is the given register
+bool xlang::peephole::is_register(struct operand* opr, regs_t r)
+{
+  if(opr == nullptr) return false;
+  return (opr->type == REGISTER && opr->reg == r);
+}
+
+//returns true if both memory operands refer same location with same size
+bool xlang::peephole::same_memory(struct operand* opr1, struct operand* opr2)
+{
+  if(opr1 == nullptr || opr2 == nullptr) return false;
+  if(opr1->type != MEMORY || opr2->type != MEMORY) return false;
+  if(opr1->mem.mem_type != opr2->mem.mem_type) return false;
+  if(opr1->mem.mem_size <= 0 || opr1->mem.mem_size != opr2->mem.mem_size)
+    return false;
+  if(opr1->mem.fp_disp != opr2->mem.fp_disp) return false;
+  if(opr1->mem.mem_type == GLOBAL && opr1->mem.name != opr2->mem.name)
+    return false;
+  if(opr1->is_array != opr2->is_array) return false;
+  if(opr1->reg != opr2->reg) return false;
+  if(opr1->is_array && opr1->arr_disp != opr2->arr_disp) return false;
+  return true;
+}
+
+//returns true if operand reads register r(r is 32 bit register)
+bool xlang::peephole::operand_uses_register(struct operand* opr, regs_t r)
+{
+  if(opr == nullptr) return false;
+  switch(opr->type){
+    case REGISTER :
+      return (reg->full_register(opr->reg) == r);
+    case MEMORY :
+      if(opr->mem.mem_type == LOCAL && r == EBP)
+        return true;
+      if(opr->reg != RNONE && reg->full_register(opr->reg) == r)
+        return true;
+      //dereferenced pointer, register name is used as memory name
+      if(opr->mem.mem_type == GLOBAL && opr->mem.name == reg->reg_name(r))
+        return true;
+      return false;
+    default: return false;
+  }
+}
+
+/*
+returns true if instruction reads register r
+instructions partially writing r are also considered as read
+*/
+bool xlang::peephole::reads_register(struct insn* in, regs_t r)
+{
+  struct operand* opr1 = in->operand_count > 0 ? in->operand_1 : nullptr;
+  struct operand* opr2 = in->operand_count > 1 ? in->operand_2 : nullptr;
+
+  switch(in->insn_type){
+    case INSNONE :
+    case INSLABEL :
+      return false;
+    case INSASM :
+      return true;
+    case MOV :
+    case MOVZX :
+    case LEA :
+      if(opr1 != nullptr && opr1->type == REGISTER){
+        if(reg->full_register(opr1->reg) == r && opr1->reg != r)
+          return true;
+        return operand_uses_register(opr2, r);
+      }
+      return (operand_uses_register(opr1, r) || operand_uses_register(opr2, r));
+    case POP :
+      if(opr1 != nullptr && opr1->type == REGISTER)
+        return (reg->full_register(opr1->reg) == r && opr1->reg != r);
+      return operand_uses_register(opr1, r);
+    case XOR :
+      //xor r, r only writes r
+      if(opr1 != nullptr && opr2 != nullptr && opr1->type == REGISTER
+          && opr2->type == REGISTER && opr1->reg == opr2->reg && opr1->reg == r)
+        return false;
+      return (operand_uses_register(opr1, r) || operand_uses_register(opr2, r));
+    case MUL :
+    case IMUL :
+      if(in->operand_count == 1 && r == EAX) return true;
+      return (operand_uses_register(opr1, r) || operand_uses_register(opr2, r));
+    case DIV :
+    case IDIV :
+      if(r == EAX || r == EDX) return true;
+      return operand_uses_register(opr1, r);
+    case CDQ :
+      return (r == EAX);
+    case FSTSW :
+    case FNSTSW :
+      return false;
+    case SAHF :
+      return (r == EAX);
+    case CALL :
+    case RET :
+    case PUSHA :
+    case POPA :
+      return true;
+    default :
+      return (operand_uses_register(opr1, r) || operand_uses_register(opr2, r));
+  }
+}
+
+//returns true if instruction writes whole register r
+bool xlang::peephole::writes_register(struct insn* in, regs_t r)
+{
+  struct operand* opr1 = in->operand_count > 0 ? in->operand_1 : nullptr;
+  struct operand* opr2 = in->operand_count > 1 ? in->operand_2 : nullptr;
+
+  switch(in->insn_type){
+    case MOV :
+    case MOVZX :
+    case LEA :
+    case POP :
+      return is_register(opr1, r);
+    case XOR :
+      return (is_register(opr1, r) && is_register(opr2, r));
+    case MUL :
+    case IMUL :
+    case DIV :
+    case IDIV :
+      //32 bit multiply/divide writes edx:eax
+      if(in->operand_count != 1 || opr1 == nullptr) return false;
+      if(r != EAX && r != EDX) return false;
+      if(opr1->type == REGISTER)
+        return (reg->regsize(opr1->reg) == 4);
+      if(opr1->type == MEMORY)
+        return (opr1->mem.mem_size == 4);
+      return false;
+    case CDQ :
+      //sign of eax is extended into edx
+      return (r == EDX);
+    default: return false;
+  }
+}
+
+//returns true if instruction reads flags register
+bool xlang::peephole::reads_flags(struct insn* in)
+{
+  return (insncls->is_cond_jump(in->insn_type)
+          || insncls->is_cond_set(in->insn_type)
+          || insncls->is_cond_move(in->insn_type));
+}
+
+//returns true if instruction overwrites all arithmetic flags
+bool xlang::peephole::writes_flags(struct insn* in)
+{
+  switch(in->insn_type){
+    case ADD :
+    case SUB :
+    case CMP :
+    case AND :
+    case OR :
+    case XOR :
+    case TEST :
+    case NEG :
+    case MUL :
+    case IMUL :
+    case DIV :
+    case IDIV :
+    case SAHF :
+    case COMISS :
+    case COMISD :
+      return true;
+    default: return false;
+  }
+}
+
+//returns true if instruction ends the basic block
+bool xlang::peephole::is_block_end(struct insn* in)
+{
+  switch(in->insn_type){
+    case INSLABEL :
+    case INSASM :
+    case CALL :
+    case RET :
+    case LOOP :
+      return true;
+    default:
+      return insncls->is_jump(in->insn_type);
+  }
+}
+
+/*
+returns true if register r is overwritten before it is read
+after instruction at index, within the same basic block.
+if flags is true, then flags set by instruction at index must
+also be overwritten before they are read.
+*/
+bool xlang::peephole::register_dead_after(size_t index, regs_t r, bool flags)
+{
+  bool reg_dead = false;
+  bool flags_dead = !flags;
+  struct insn* in = nullptr;
+  size_t i = next_insn(index);
+
+  while(i < instructions.size()){
+    in = instructions[i];
+    if(is_block_end(in)) return false;
+    if(!reg_dead && reads_register(in, r)) return false;
+    if(!flags_dead && reads_flags(in)) return false;
+    if(!reg_dead && writes_register(in, r)) reg_dead = true;
+    if(!flags_dead && writes_flags(in)) flags_dead = true;
+    if(reg_dead && flags_dead) return true;
+    i = next_insn(i);
+  }
+  return false;
+}
+
+/*
+mov r, r
+=> removed
+*/
+bool xlang::peephole::mov_same_register(std::vector<size_t>& w)
+{
+  struct insn* in = instructions[w[0]];
+  if(in->insn_type != MOV || in->operand_count != 2) return false;
+  if(in->operand_1->type != REGISTER || in->operand_2->type != REGISTER)
+    return false;
+  if(in->operand_1->reg != in->operand_2->reg) return false;
+  remove_insn(w[0]);
+  return true;
+}
+
+/*
+push r1          push r
+pop r2           pop r
+=> mov r2, r1    => removed
+*/
+bool xlang::peephole::push_pop(std::vector<size_t>& w)
+{
+  struct insn* in1 = instructions[w[0]];
+  struct insn* in2 = instructions[w[1]];
+  if(in1->insn_type != PUSH || in2->insn_type != POP) return false;
+  if(in1->operand_1->type != REGISTER || in2->operand_1->type != REGISTER)
+    return false;
+  if(in1->operand_1->reg != in2->operand_1->reg){
+    in2->insn_type = MOV;
+    in2->operand_count = 2;
+    if(in2->operand_2 == nullptr)
+      in2->operand_2 = insncls->get_operand_mem();
+    in2->operand_2->type = REGISTER;
+    in2->operand_2->reg = in1->operand_1->reg;
+  }else{
+    remove_insn(w[1]);
+  }
+  remove_insn(w[0]);
+  return true;
+}
+
+/*
+mov [m], r        mov [m], r1
+mov r, [m]        mov r2, [m]
+=> removed        => mov r2, r1
+same for float values in xmm registers with movss/movsd
+*/
+bool xlang::peephole::store_reload(std::vector<size_t>& w)
+{
+  struct insn* in1 = instructions[w[0]];
+  struct insn* in2 = instructions[w[1]];
+  operand_t rtype = REGISTER;
+  if(in1->insn_type != in2->insn_type) return false;
+  if(in1->insn_type == MOVSS || in1->insn_type == MOVSD)
+    rtype = FREGISTER;
+  else if(in1->insn_type != MOV)
+    return false;
+  if(in1->operand_count != 2 || in2->operand_count != 2) return false;
+  if(in1->operand_2->type != rtype || in2->operand_1->type != rtype)
+    return false;
+  if(!same_memory(in1->operand_1, in2->operand_2)) return false;
+
+  if(rtype == FREGISTER){
+    if(in1->operand_2->freg == in2->operand_1->freg){
+      remove_insn(w[1]);
+    }else{
+      in2->insn_type = MOVAPS;
+      insncls->delete_operand(&in2->operand_2);
+      in2->operand_2 = insncls->get_operand_mem();
+      in2->operand_2->type = FREGISTER;
+      in2->operand_2->freg = in1->operand_2->freg;
+    }
+    return true;
+  }
+
+  if(reg->regsize(in1->operand_2->reg) != in1->operand_1->mem.mem_size)
+    return false;
+  if(reg->regsize(in2->operand_1->reg) != in2->operand_2->mem.mem_size)
+    return false;
+
+  if(in1->operand_2->reg == in2->operand_1->reg){
+    remove_insn(w[1]);
+  }else{
+    insncls->delete_operand(&in2->operand_2);
+    in2->operand_2 = insncls->get_operand_mem();
+    in2->operand_2->type = REGISTER;
+    in2->operand_2->reg = in1->operand_2->reg;
+  }
+  return true;
+}
+
+/*
+mov r2, literal/[m]
+op r1, r2
+=> op r1, literal/[m]       where r2 is not used after op
+*/
+bool xlang::peephole::fold_load_operand(std::vector<size_t>& w)
+{
+  struct insn* in1 = instructions[w[0]];
+  struct insn* in2 = instructions[w[1]];
+  regs_t r2;
+  if(in1->insn_type != MOV || in1->operand_count != 2) return false;
+  if(in1->operand_1->type != REGISTER) return false;
+  switch(in2->insn_type){
+    case ADD :
+    case SUB :
+    case AND :
+    case OR :
+    case XOR :
+    case CMP :
+      break;
+    default: return false;
+  }
+  if(in2->operand_count != 2) return false;
+  if(in2->operand_1->type != REGISTER || in2->operand_2->type != REGISTER)
+    return false;
+  r2 = in1->operand_1->reg;
+  if(in2->operand_2->reg != r2 || in2->operand_1->reg == r2) return false;
+  if(reg->full_register(in2->operand_1->reg) == reg->full_register(r2))
+    return false;
+  if(in1->operand_2->type == MEMORY){
+    if(in1->operand_2->mem.mem_size != reg->regsize(r2)) return false;
+    if(operand_uses_register(in1->operand_2, reg->full_register(in2->operand_1->reg)))
+      return false;
+  }else if(in1->operand_2->type != LITERAL){
+    return false;
+  }
+  if(reg->regsize(in2->operand_1->reg) != reg->regsize(r2)) return false;
+  if(r2 != reg->full_register(r2)) return false;
+  if(!register_dead_after(w[1], r2, false)) return false;
+
+  insncls->delete_operand(&in2->operand_2);
+  in2->operand_2 = in1->operand_2;
+  in1->operand_2 = nullptr;
+  if(in2->comment.empty())
+    in2->comment = in1->comment;
+  remove_insn(w[0]);
+  return true;
+}
+
+/*
+xor r, r
+... r is overwritten before it is read
+=> removed
+*/
+bool xlang::peephole::dead_register_clear(std::vector<size_t>& w)
+{
+  struct insn* in = instructions[w[0]];
+  if(in->insn_type != XOR || in->operand_count != 2) return false;
+  if(in->operand_1->type != REGISTER || in->operand_2->type != REGISTER)
+    return false;
+  if(in->operand_1->reg != in->operand_2->reg) return false;
+  if(reg->full_register(in->operand_1->reg) != in->operand_1->reg) return false;
+  if(!register_dead_after(w[0], in->operand_1->reg, true)) return false;
+  remove_insn(w[0]);
+  return true;
+}
+
+/*
+jmp L
+L:
+=> removed jmp
+*/
+bool xlang::peephole::jump_to_next_label(std::vector<size_t>& w)
+{
+  struct insn* in = instructions[w[0]];
+  size_t i;
+  if(!insncls->is_jump(in->insn_type)) return false;
+  if(in->operand_1 == nullptr || in->operand_1->type != LITERAL) return false;
+  i = next_insn(w[0]);
+  while(i < instructions.size() && instructions[i]->insn_type == INSLABEL){
+    if(instructions[i]->label == in->operand_1->literal){
+      remove_insn(w[0]);
+      return true;
+    }
+    i = next_insn(i);
+  }
+  return false;
+}
+
+/*
+jcc L1
+jmp L2
+L1:
+=> jncc L2
+L1:
+*/
+bool xlang::peephole::cond_jump_over_jump(std::vector<size_t>& w)
+{
+  struct insn* in1 = instructions[w[0]];
+  struct insn* in2 = instructions[w[1]];
+  struct insn* in3 = instructions[w[2]];
+  insn_t inv;
+  if(!insncls->is_cond_jump(in1->insn_type)) return false;
+  if(in2->insn_type != JMP || in3->insn_type != INSLABEL) return false;
+  if(in1->operand_1->type != LITERAL || in2->operand_1->type != LITERAL)
+    return false;
+  if(in1->operand_1->literal != in3->label) return false;
+  inv = insncls->inverse_jump(in1->insn_type);
+  if(inv == INSNONE) return false;
+  in1->insn_type = inv;
+  in1->operand_1->literal = in2->operand_1->literal;
+  remove_insn(w[1]);
+  return true;
+}
+
+/*
+jmp/ret
+...   instructions till next label
+=> removed instructions
+*/
+bool xlang::peephole::unreachable_code(std::vector<size_t>& w)
+{
+  struct insn* in = instructions[w[0]];
+  size_t i = w[1];
+  bool removed = false;
+  if(in->insn_type != JMP && in->insn_type != RET) return false;
+  while(i < instructions.size()){
+    in = instructions[i];
+    if(in->insn_type == INSLABEL || in->insn_type == INSASM) break;
+    remove_insn(i);
+    removed = true;
+    i = next_insn(i);
+  }
+  return removed;
+}
+
+/*
+add esp, n
+mov esp, ebp
+=> mov esp, ebp
+*/
+bool xlang::peephole::redundant_stack_restore(std::vector<size_t>& w)
+{
+  struct insn* in1 = instructions[w[0]];
+  struct insn* in2 = instructions[w[1]];
+  if(in1->insn_type != ADD || in2->insn_type != MOV) return false;
+  if(!is_register(in1->operand_1, ESP)) return false;
+  if(!is_register(in2->operand_1, ESP)) return false;
+  if(!is_register(in2->operand_2, EBP)) return false;
+  remove_insn(w[0]);
+  return true;
+}
+
+/*
+.L:     where .L is not used anywhere
+=> removed
+*/
+bool xlang::peephole::unused_label(std::vector<size_t>& w)
+{
+  struct insn* in = instructions[w[0]];
+  if(in->insn_type != INSLABEL) return false;
+  if(in->label.empty() || in->label[0] != '.') return false;
+  if(is_label_referenced(in->label)) return false;
+  remove_insn(w[0]);
+  return true;
+}
+
+//apply all rules on each window till any rule is applied
+void xlang::peephole::optimize()
+{
+  std::vector<size_t> window;
+  bool changed = true;
+
+  while(changed){
+    changed = false;
+    get_referenced_labels();
+    for(size_t i = 0; i < instructions.size(); i++){
+      for(auto& r : rules){
+        if(instructions[i] == nullptr || is_comment(instructions[i]))
+          break;
+        if(!get_window(i, r.window, window))
+          continue;
+        if((this->*r.rewrite)(window)){
+          xlang::stats::count("peephole."+r.name);
+          changed = true;
+        }
+      }
+    }
+    compact();
+  }
+}
@@ -0,0 +1,82 @@
+/*
+*  src/peephole.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in peephole.cpp file by class peephole.
+*/
+
+#ifndef PEEPHOLE_HPP
+#define PEEPHOLE_HPP
+
+#include <vector>
+#include <string>
+#include "regs.hpp"
+#include "insn.hpp"
+
+namespace xlang{
+
+class peephole
+{
+public:
+  peephole(std::vector<struct insn*>&, xlang::insn_class*, xlang::regs*);
+  void optimize();
+
+private:
+  std::vector<struct insn*>& instructions;
+  xlang::insn_class* insncls;
+  xlang::regs* reg;
+
+  //rewrite function of a rule, gets indexes of matched window
+  //returns true if window is rewritten
+  typedef bool (peephole::*rewrite_t)(std::vector<size_t>&);
+
+  //peephole rewrite table entry
+  struct rule{
+    std::string name;   //name of rule, used in statistics
+    size_t window;      //instructions count in sliding window
+    rewrite_t rewrite;
+  };
+
+  std::vector<struct rule> rules;
+
+  //labels used by jump/call instructions, and inline assembly text
+  std::vector<std::string> referenced_labels;
+  std::string inline_asm_text;
+
+  bool is_comment(struct insn*);
+  size_t next_insn(size_t);
+  bool get_window(size_t, size_t, std::vector<size_t>&);
+  void remove_insn(size_t);
+  void compact();
+  void get_referenced_labels();
+  bool is_label_referenced(std::string);
+
+  bool is_register(struct operand*, regs_t);
+  bool same_memory(struct operand*, struct operand*);
+  bool operand_uses_register(struct operand*, regs_t);
+  bool reads_register(struct insn*, regs_t);
+  bool writes_register(struct insn*, regs_t);
+  bool reads_flags(struct insn*);
+  bool writes_flags(struct insn*);
+  bool is_block_end(struct insn*);
+  bool register_dead_after(size_t, regs_t, bool);
+
+  //rewrite rules
+  bool mov_same_register(std::vector<size_t>&);
+  bool push_pop(std::vector<size_t>&);
+  bool store_reload(std::vector<size_t>&);
+  bool fold_load_operand(std::vector<size_t>&);
+  bool dead_register_clear(std::vector<size_t>&);
+  bool jump_to_next_label(std::vector<size_t>&);
+  bool cond_jump_over_jump(std::vector<size_t>&);
+  bool unreachable_code(std::vector<size_t>&);
+  bool redundant_stack_restore(std::vector<size_t>&);
+  bool unused_label(std::vector<size_t>&);
+};
+
+}
+
+#endif
+
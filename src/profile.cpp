@@ -0,0 +1,96 @@
+/*
+*  src/profile.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains profile used by -fprofile-use option.
+* Program compiled with -fprofile-generate counts function entries,
+* then/else edges of if statements and loop body iterations,
+* and writes them at exit, one per line:
+*   function line-offset kind count
+* line offset is relative to first line of function,
+* so that edits outside of a function do not invalidate its counts
+*/
+
+#include <fstream>
+#include <sstream>
+#include "profile.hpp"
+#include "symtab.hpp"
+
+std::map<std::string, long long> xlang::profile::counts;
+std::map<int, std::string> xlang::profile::functions;
+long long xlang::profile::max_count = 0;
+bool xlang::profile::loaded = false;
+
+bool xlang::profile::read(std::string filename)
+{
+  std::ifstream in(filename);
+  std::string line, func, kind;
+  int offset;
+  long long count;
+
+  if(!in.is_open()) return false;
+
+  while(std::getline(in, line)){
+    if(line.empty() || line[0] == '#') continue;
+    std::istringstream ss(line);
+    if(!(ss>>func>>offset>>kind>>count)) continue;
+    //inlined or unrolled copies of same statement are added
+    long long& c = counts[func+" "+std::to_string(offset)+" "+kind];
+    c += count;
+    if(c > max_count)
+      max_count = c;
+  }
+  loaded = true;
+  return true;
+}
+
+bool xlang::profile::is_loaded()
+{
+  return loaded;
+}
+
+void xlang::profile::set_functions(struct tree_node* tr)
+{
+  functions.clear();
+  while(tr != nullptr){
+    if(tr->symtab != nullptr && tr->symtab->func_info != nullptr
+       && !tr->symtab->func_info->is_extern){
+      functions[tr->symtab->func_info->tok.loc.line] = tr->symtab->func_info->func_name;
+    }
+    tr = tr->p_next;
+  }
+}
+
+/*
+statements of inlined functions are looked up
+in function where they are written
+*/
+bool xlang::profile::get_key(int line, std::string* func, int* offset)
+{
+  std::map<int, std::string>::iterator it = functions.upper_bound(line);
+  if(it == functions.begin()) return false;
+  it--;
+  *func = it->second;
+  *offset = line - it->first;
+  return true;
+}
+
+long long xlang::profile::get_count(int line, std::string kind)
+{
+  std::string func;
+  int offset;
+  std::map<std::string, long long>::iterator it;
+
+  if(!loaded || !get_key(line, &func, &offset)) return -1;
+  it = counts.find(func+" "+std::to_string(offset)+" "+kind);
+  if(it == counts.end()) return -1;
+  return it->second;
+}
+
+bool xlang::profile::is_hot(long long count)
+{
+  return count > 0 && count * PROFILE_HOT_RATIO >= max_count;
+}
+
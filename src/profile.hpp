@@ -0,0 +1,51 @@
+/*
+*  src/profile.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in profile.cpp file by class profile.
+*/
+
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+#include <string>
+#include <map>
+#include "tree.hpp"
+
+//count is hot when it is at least 1/PROFILE_HOT_RATIO of maximum count
+#define PROFILE_HOT_RATIO 100
+//inline limit of hot functions is multiplied by this
+#define PROFILE_HOT_INLINE_SCALE 4
+
+namespace xlang
+{
+
+class profile
+{
+  public:
+    //read profile written by program compiled with -fprofile-generate
+    static bool read(std::string);
+    static bool is_loaded();
+    //record start line of each defined function
+    static void set_functions(struct tree_node*);
+    //function containing line and line relative to its start
+    static bool get_key(int, std::string*, int*);
+    //count of edge at line, kind is entry/then/else/body, -1 when unknown
+    static long long get_count(int, std::string);
+    static bool is_hot(long long);
+
+  private:
+    //"function offset kind", and its count
+    static std::map<std::string, long long> counts;
+    //start line of function, its name
+    static std::map<int, std::string> functions;
+    static long long max_count;
+    static bool loaded;
+};
+
+}
+
+#endif
+
@@ -22,6 +22,8 @@ std::pair<int, int> xlang::regs::size_indexes(int sz)
     return std::pair<int,int>(8, 15);
   }else if(sz == 4){
     return std::pair<int,int>(16, 23);
+  }else if(sz == 8){
+    return std::pair<int,int>(24, 39);
   }
   return std::pair<int,int>(-1, -1);
 }
@@ -51,7 +53,8 @@ regs_t xlang::regs::allocate_register(int dsize)
     }else{
       //do not allow esp and ebp register for data manipulation instructions
       //because they are used for function parameters/local members stack frame
-      if(static_cast<regs_t>(reg) == ESP || static_cast<regs_t>(reg) == EBP){
+      if(static_cast<regs_t>(reg) == ESP || static_cast<regs_t>(reg) == EBP
+          || static_cast<regs_t>(reg) == RSP || static_cast<regs_t>(reg) == RBP){
         continue;
       }else{
         locked_registers.insert(static_cast<regs_t>(reg));
@@ -61,9 +64,13 @@ regs_t xlang::regs::allocate_register(int dsize)
   }
 
   //if all registers are used,
-  //then free all of them and allocate from starting
+  //then free all of them and allocate from starting,
+  //values held in them are clobbered like a spill without reload
+  spill_count++;
   free_all_registers();
-  auto regfunc = [=](int sz){if(sz == 1) return AL; else if(sz == 2) return AX; else return EAX;};
+  auto regfunc = [=](int sz){
+        if(sz == 1) return AL; else if(sz == 2) return AX;
+        else if(sz == 8) return RAX; else return EAX;};
   locked_registers.insert(regfunc(dsize));
   return regfunc(dsize);
 }
@@ -82,6 +89,21 @@ fregs_t xlang::regs::allocate_float_register()
   return FRNONE;
 }
 
+//allocate SSE register, xmm0-xmm7
+fregs_t xlang::regs::allocate_xmm_register()
+{
+  int reg;
+  for(reg = XMM0; reg <= XMM7; ++reg){
+    if(search_fregister(static_cast<fregs_t>(reg))){
+      continue;
+    }else{
+      locked_fregisters.insert(static_cast<fregs_t>(reg));
+      return static_cast<fregs_t>(reg);
+    }
+  }
+  return FRNONE;
+}
+
 void xlang::regs::free_register(regs_t rt)
 {
   std::set<regs_t>::iterator it = locked_registers.find(rt);
@@ -108,3 +130,32 @@ void xlang::regs::free_all_float_registers()
   locked_fregisters.clear();
 }
 
+/*
+returns 32 bit register which contains given register
+e.g: al,ah,ax -> eax
+64 bit registers are returned as their 32 bit part, rax -> eax
+*/
+regs_t xlang::regs::full_register(regs_t rt) const
+{
+  if(rt >= AL && rt <= DH){
+    return static_cast<regs_t>(EAX + (rt - AL) / 2);
+  }else if(rt >= AX && rt <= DI){
+    return static_cast<regs_t>(EAX + (rt - AX));
+  }else if(rt >= RAX && rt <= RDI){
+    return static_cast<regs_t>(EAX + (rt - RAX));
+  }
+  return rt;
+}
+
+/*
+returns 64 bit register which contains given register
+e.g: al,ax,eax -> rax
+*/
+regs_t xlang::regs::register_64(regs_t rt) const
+{
+  rt = full_register(rt);
+  if(rt >= EAX && rt <= EDI){
+    return static_cast<regs_t>(RAX + (rt - EAX));
+  }
+  return rt;
+}
@@ -40,7 +40,23 @@ typedef enum{
   ESP,
   EBP,
   ESI,
-  EDI
+  EDI,
+  RAX,
+  RBX,
+  RCX,
+  RDX,
+  RSP,
+  RBP,
+  RSI,
+  RDI,
+  R8,
+  R9,
+  R10,
+  R11,
+  R12,
+  R13,
+  R14,
+  R15
 }regs_t;
 
 //floating point register types
@@ -53,7 +69,15 @@ typedef enum{
   ST4,
   ST5,
   ST6,
-  ST7
+  ST7,
+  XMM0,
+  XMM1,
+  XMM2,
+  XMM3,
+  XMM4,
+  XMM5,
+  XMM6,
+  XMM7
 }fregs_t;
 
 
@@ -64,10 +88,17 @@ class regs
   public:
     regs_t allocate_register(int);
     fregs_t allocate_float_register();
+    fregs_t allocate_xmm_register();
     void free_register(regs_t);
     void free_float_register(fregs_t);
     void free_all_registers();
     void free_all_float_registers();
+    regs_t full_register(regs_t) const;
+    regs_t register_64(regs_t) const;
+
+    //count of allocations when all registers were in use,
+    //read and reset by code generator for --stats
+    int spill_count = 0;
 
     std::string reg_name(regs_t t) const{
       return reg_names[t];
@@ -113,14 +144,32 @@ class regs
       "esp",
       "ebp",
       "esi",
-      "edi"
+      "edi",
+      "rax",
+      "rbx",
+      "rcx",
+      "rdx",
+      "rsp",
+      "rbp",
+      "rsi",
+      "rdi",
+      "r8",
+      "r9",
+      "r10",
+      "r11",
+      "r12",
+      "r13",
+      "r14",
+      "r15"
     };
 
     std::vector<int> reg_size
     {
       1, 1, 1, 1, 1, 1, 1, 1,
       2, 2, 2, 2, 2, 2, 2, 2,
-      4, 4, 4, 4, 4, 4, 4, 4
+      4, 4, 4, 4, 4, 4, 4, 4,
+      8, 8, 8, 8, 8, 8, 8, 8,
+      8, 8, 8, 8, 8, 8, 8, 8
     };
 
     std::vector<std::string> freg_names =
@@ -132,7 +181,15 @@ class regs
       "st4",
       "st5",
       "st6",
-      "st7"
+      "st7",
+      "xmm0",
+      "xmm1",
+      "xmm2",
+      "xmm3",
+      "xmm4",
+      "xmm5",
+      "xmm6",
+      "xmm7"
     };
 
 };
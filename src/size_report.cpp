@@ -0,0 +1,517 @@
+/*
+*  src/size_report.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains size report of generated code, used by --size-report.
+* encoded size of each instruction is estimated from its opcode, prefixes,
+* ModR/M, SIB, displacement and immediate bytes as nasm would encode it,
+* jumps to labels of same function are short when target is within -128..127
+* bytes.
+* [bits 16] of inline assembly changes operand/address size prefixes
+* of following instructions, inline assembly itself is not counted.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include "size_report.hpp"
+#include "print.hpp"
+
+xlang::size_report::size_report(std::vector<struct insn*>& insns,
+                                xlang::insn_class* ic, xlang::regs* r, int b)
+  : instructions(insns), insncls(ic), reg(r), bits(b)
+{
+}
+
+void xlang::size_report::set_frame_size(std::string function, unsigned int size)
+{
+  frame_sizes[function] = size;
+}
+
+void xlang::size_report::add_data(std::string symbol, int size)
+{
+  data_symbols.push_back({symbol, size});
+}
+
+void xlang::size_report::add_bss(std::string symbol, int size)
+{
+  bss_symbols.push_back({symbol, size});
+}
+
+//numeric value of literal operand, false for labels/symbols
+bool xlang::size_report::get_literal(std::string literal, long long* value)
+{
+  char* end = nullptr;
+  if(literal.empty()) return false;
+  *value = std::strtoll(literal.c_str(), &end, 0);
+  return (end != nullptr && *end == '\0');
+}
+
+bool xlang::size_report::is_imm8(struct operand* opr)
+{
+  long long value;
+  if(opr == nullptr || opr->type != LITERAL) return false;
+  if(!get_literal(opr->literal, &value)) return false;
+  return (value >= -128 && value <= 127);
+}
+
+bool xlang::size_report::is_sse(insn_t type)
+{
+  return (type >= MOVSS && type <= CVTDQ2PS);
+}
+
+bool xlang::size_report::is_fpu(insn_t type)
+{
+  return (type >= FLD && type <= FNOP && type != SAHF);
+}
+
+void xlang::size_report::set_bits(std::string inline_asm)
+{
+  std::transform(inline_asm.begin(), inline_asm.end(), inline_asm.begin(), ::tolower);
+  if(inline_asm.find("bits 16") != std::string::npos)
+    bits = 16;
+  else if(inline_asm.find("bits 32") != std::string::npos)
+    bits = 32;
+  else if(inline_asm.find("bits 64") != std::string::npos)
+    bits = 64;
+}
+
+//global symbol used as address(mov eax, symbol) is an immediate
+bool xlang::size_report::is_address(struct operand* opr)
+{
+  return (opr != nullptr && opr->type == MEMORY
+          && opr->mem.mem_type == GLOBAL && opr->mem.mem_size < 0);
+}
+
+//base register of memory operand, RNONE for [symbol]
+regs_t xlang::size_report::get_base_register(struct operand* opr)
+{
+  switch(opr->mem.mem_type){
+    case LOCAL :
+      return (bits == 64 ? RBP : EBP);
+    case STACK :
+      return (bits == 64 ? RSP : ESP);
+    default :
+      break;
+  }
+  if(opr->mem.name.empty())
+    return opr->reg;
+  //dereferenced register is stored as memory name
+  for(int r = EAX; r <= R15; r++){
+    if(opr->mem.name == reg->reg_name(static_cast<regs_t>(r)))
+      return static_cast<regs_t>(r);
+  }
+  return RNONE;
+}
+
+int xlang::size_report::get_operand_size(struct operand* opr)
+{
+  if(opr == nullptr) return 0;
+  if(opr->type == REGISTER && opr->reg != RNONE)
+    return reg->regsize(opr->reg);
+  if(opr->type == MEMORY && !is_address(opr) && opr->mem.mem_size > 0)
+    return opr->mem.mem_size;
+  return 0;
+}
+
+//ModR/M, SIB and displacement bytes of memory operand
+int xlang::size_report::get_memory_bytes(struct operand* opr)
+{
+  regs_t base = get_base_register(opr);
+  int disp = opr->mem.fp_disp;
+  int bytes = 1;
+  //index register of [symbol/base + index * scale] is encoded in SIB
+  bool index = (opr->is_array && opr->reg != RNONE && !opr->mem.name.empty());
+
+  if(opr->mem.mem_type == STACK && disp < 0)
+    disp = 0;
+  if(index)
+    bytes++;
+  if(base == RNONE)
+    return bytes + 4;
+  if(!index && (base == ESP || base == RSP || base == R12))
+    bytes++;
+  if(disp == 0 && base != EBP && base != RBP && base != R13)
+    return bytes;
+  return bytes + ((disp >= -128 && disp <= 127) ? 1 : 4);
+}
+
+//mov between accumulator and [symbol] has no ModR/M(a0-a3 opcodes),
+//not used in 64 bit code where [symbol] is rip relative
+bool xlang::size_report::is_moffs(struct operand* acc, struct operand* opr)
+{
+  if(bits == 64 || acc == nullptr || opr == nullptr) return false;
+  if(acc->type != REGISTER || (acc->reg != AL && acc->reg != AX && acc->reg != EAX))
+    return false;
+  if(opr->type != MEMORY || is_address(opr) || opr->mem.mem_type != GLOBAL)
+    return false;
+  return (get_base_register(opr) == RNONE && !(opr->is_array && opr->reg != RNONE));
+}
+
+int xlang::size_report::get_modrm_bytes(struct insn* in)
+{
+  if(in->operand_count > 0 && in->operand_1 != nullptr
+     && in->operand_1->type == MEMORY && !is_address(in->operand_1))
+    return get_memory_bytes(in->operand_1);
+  if(in->operand_count > 1 && in->operand_2 != nullptr
+     && in->operand_2->type == MEMORY && !is_address(in->operand_2))
+    return get_memory_bytes(in->operand_2);
+  return 1;
+}
+
+//operand size, address size and REX prefixes
+int xlang::size_report::get_prefix_bytes(struct insn* in)
+{
+  int bytes = 0;
+  int size;
+  bool rex = false;
+  struct operand* oprs[2] = {nullptr, nullptr};
+  regs_t base;
+
+  if(in->operand_count > 0) oprs[0] = in->operand_1;
+  if(in->operand_count > 1) oprs[1] = in->operand_2;
+
+  //push/pop, jumps and x87/sse instructions have no operand size prefix
+  if(!is_fpu(in->insn_type) && !is_sse(in->insn_type) && in->insn_type != PUSH
+     && in->insn_type != POP && in->insn_type != CALL && !insncls->is_jump(in->insn_type)){
+    size = get_operand_size(oprs[0]);
+    if(size == 0)
+      size = get_operand_size(oprs[1]);
+    if(bits == 16 ? size == 4 : size == 2)
+      bytes++;
+    if(bits == 64 && size == 8)
+      rex = true;
+  }
+
+  for(struct operand* opr : oprs){
+    if(opr == nullptr) continue;
+    if(opr->type == REGISTER && opr->reg >= R8){
+      rex = true;
+    }else if(opr->type == MEMORY && !is_address(opr)){
+      base = get_base_register(opr);
+      if(base >= R8 || (opr->is_array && opr->reg >= R8))
+        rex = true;
+      //32 bit addressing in 16 bit code
+      if(bits == 16)
+        bytes++;
+    }
+  }
+  if(rex && bits == 64)
+    bytes++;
+  return bytes;
+}
+
+//jump/call to label is rel8 when short, rel16/rel32 otherwise
+int xlang::size_report::get_jump_bytes(struct insn* in, bool near)
+{
+  bool label = (in->operand_count > 0 && in->operand_1 != nullptr
+                && in->operand_1->type == LITERAL);
+  switch(in->insn_type){
+    case LOOP :
+      return 2;
+    case JMP :
+      if(!label) return 1 + get_modrm_bytes(in);
+      if(!near) return 2;
+      return (bits == 16 ? 3 : 5);
+    case CALL :
+      if(!label) return 1 + get_modrm_bytes(in);
+      return (bits == 16 ? 3 : 5);
+    default :
+      if(!near) return 2;
+      return (bits == 16 ? 4 : 6);
+  }
+}
+
+//encoded size in bytes, jumps to labels are taken as near
+int xlang::size_report::get_insn_bytes(struct insn* in)
+{
+  insn_t type = in->insn_type;
+  struct operand* opr1 = (in->operand_count > 0 ? in->operand_1 : nullptr);
+  struct operand* opr2 = (in->operand_count > 1 ? in->operand_2 : nullptr);
+  bool imm = (opr2 != nullptr && (opr2->type == LITERAL || is_address(opr2)));
+  bool acc = (opr1 != nullptr && opr1->type == REGISTER && (opr1->reg == AL
+              || opr1->reg == AX || opr1->reg == EAX || opr1->reg == RAX));
+  int size = get_operand_size(opr1);
+  int immsize = (size == 1 ? 1 : (size == 2 ? 2 : 4));
+  int bytes = get_prefix_bytes(in);
+
+  if(type == LOOP || type == CALL || insncls->is_jump(type))
+    return bytes + get_jump_bytes(in, true);
+
+  switch(type){
+    case NOP : case CDQ : case PUSHA : case POPA : case SAHF :
+      return bytes + 1;
+    case RET :
+      return bytes + (opr1 != nullptr ? 3 : 1);
+
+    case PUSH : case POP :
+      if(opr1 == nullptr || opr1->type == REGISTER)
+        return bytes + 1;
+      if(opr1->type == LITERAL || is_address(opr1))
+        return bytes + (is_imm8(opr1) ? 2 : (bits == 16 ? 3 : 5));
+      return bytes + 1 + get_modrm_bytes(in);
+
+    case INC : case DEC :
+      //one byte 40+r/48+r forms are REX prefixes in 64 bit code
+      if(opr1 != nullptr && opr1->type == REGISTER && bits != 64 && size > 1)
+        return bytes + 1;
+      return bytes + 1 + get_modrm_bytes(in);
+
+    case MUL : case DIV : case IDIV : case NEG : case NOT : case LEA :
+      return bytes + 1 + get_modrm_bytes(in);
+
+    case IMUL :
+      if(opr2 == nullptr)
+        return bytes + 1 + get_modrm_bytes(in);
+      if(imm)
+        return bytes + 1 + get_modrm_bytes(in) + (is_imm8(opr2) ? 1 : immsize);
+      return bytes + 2 + get_modrm_bytes(in);
+
+    case SHL : case SHR : case SAR :
+      if(opr2 != nullptr && opr2->type == LITERAL && opr2->literal != "1")
+        return bytes + 2 + get_modrm_bytes(in);
+      return bytes + 1 + get_modrm_bytes(in);
+
+    case MOV :
+      if(is_moffs(opr1, opr2) || is_moffs(opr2, opr1))
+        return bytes + 1 + 4;
+      if(!imm)
+        return bytes + 1 + get_modrm_bytes(in);
+      if(opr1 != nullptr && opr1->type == REGISTER && size != 8)
+        return bytes + 1 + immsize;
+      return bytes + 1 + get_modrm_bytes(in) + immsize;
+
+    case ADD : case SUB : case AND : case OR : case XOR : case CMP :
+      if(!imm)
+        return bytes + 1 + get_modrm_bytes(in);
+      if(size != 1 && is_imm8(opr2))
+        return bytes + 2 + get_modrm_bytes(in);
+      if(acc)
+        return bytes + 1 + immsize;
+      return bytes + 1 + get_modrm_bytes(in) + immsize;
+
+    case TEST :
+      if(!imm)
+        return bytes + 1 + get_modrm_bytes(in);
+      if(acc)
+        return bytes + 1 + immsize;
+      return bytes + 1 + get_modrm_bytes(in) + immsize;
+
+    case MOVZX :
+    case SETE : case SETNE : case SETA : case SETAE : case SETB :
+    case SETBE : case SETG : case SETGE : case SETL : case SETLE :
+    case CMOVE : case CMOVNE : case CMOVA : case CMOVAE : case CMOVB :
+    case CMOVBE : case CMOVG : case CMOVGE : case CMOVL : case CMOVLE :
+      return bytes + 2 + get_modrm_bytes(in);
+
+    case FINIT :
+      return bytes + 3;
+    case FNINIT :
+      return bytes + 2;
+    //fwait is emitted before fstsw/fsave
+    case FSTSW :
+      if(opr1 == nullptr || opr1->type == REGISTER)
+        return bytes + 3;
+      return bytes + 2 + get_modrm_bytes(in);
+    case FNSTSW :
+      if(opr1 == nullptr || opr1->type == REGISTER)
+        return bytes + 2;
+      return bytes + 1 + get_modrm_bytes(in);
+    case FSAVE :
+      return bytes + 2 + get_modrm_bytes(in);
+
+    //no prefix, 0F opcode
+    case MOVAPS : case MOVUPS : case ADDPS : case SUBPS : case MULPS :
+    case DIVPS : case CVTDQ2PS : case COMISS :
+      return bytes + 2 + get_modrm_bytes(in);
+    //shift of xmm by immediate
+    case PSLLD : case PSRLD : case PSLLQ : case PSRLQ :
+      if(imm)
+        return bytes + 4 + 1;
+      return bytes + 3 + get_modrm_bytes(in);
+
+    default :
+      break;
+  }
+
+  //66/F2/F3 prefix, 0F opcode
+  if(is_sse(type))
+    return bytes + 3 + get_modrm_bytes(in);
+  //x87 register forms are two bytes
+  if(is_fpu(type)){
+    if(opr1 != nullptr && opr1->type == MEMORY)
+      return bytes + 1 + get_modrm_bytes(in);
+    return bytes + 2;
+  }
+  return bytes + 1 + get_modrm_bytes(in);
+}
+
+//memory operands read/written, lea and symbol addresses do not access memory
+void xlang::size_report::count_operands(struct insn* in, struct function_size& fs)
+{
+  struct operand* oprs[2] = {nullptr, nullptr};
+  if(in->operand_count > 0) oprs[0] = in->operand_1;
+  if(in->operand_count > 1) oprs[1] = in->operand_2;
+  for(struct operand* opr : oprs){
+    if(opr == nullptr) continue;
+    if(opr->type == REGISTER || opr->type == FREGISTER)
+      fs.register_operands++;
+    else if(opr->type == MEMORY && in->insn_type != LEA && !is_address(opr))
+      fs.memory_operands++;
+  }
+}
+
+/*
+size of instructions in [start, end) of one function,
+jumps to labels of function start as short and are grown to near jumps
+until all of them are in range, as nasm/gas do over multiple passes
+*/
+void xlang::size_report::size_function(size_t start, size_t end,
+                                       struct function_size& fs)
+{
+  std::vector<int> sizes(end - start, 0);
+  std::vector<int> offsets(end - start + 1, 0);
+  std::vector<int> targets(end - start, -1);   //index of label jumped to
+  std::map<std::string, size_t> labels;
+  std::map<std::string, size_t>::iterator lit;
+  struct insn* in = nullptr;
+  bool changed = true;
+  int disp;
+
+  for(size_t i = start; i < end; i++){
+    if(instructions[i]->insn_type == INSLABEL)
+      labels[instructions[i]->label] = i - start;
+  }
+
+  for(size_t i = start; i < end; i++){
+    in = instructions[i];
+    if(in->insn_type == INSASM){
+      set_bits(in->inline_asm);
+      fs.asm_lines++;
+      continue;
+    }
+    if(in->insn_type < 0) continue;
+    sizes[i - start] = get_insn_bytes(in);
+    fs.insn_count++;
+    count_operands(in, fs);
+
+    if(insncls->is_jump(in->insn_type) && in->operand_count > 0
+       && in->operand_1 != nullptr && in->operand_1->type == LITERAL){
+      lit = labels.find(in->operand_1->literal);
+      if(lit != labels.end()){
+        targets[i - start] = static_cast<int>(lit->second);
+        sizes[i - start] = get_jump_bytes(in, false);
+      }
+    }
+  }
+
+  while(changed){
+    changed = false;
+    for(size_t i = 0; i < sizes.size(); i++)
+      offsets[i + 1] = offsets[i] + sizes[i];
+    for(size_t i = start; i < end; i++){
+      if(sizes[i - start] != 2 || targets[i - start] < 0) continue;
+      disp = offsets[targets[i - start]] - offsets[i - start + 1];
+      if(disp < -128 || disp > 127){
+        sizes[i - start] = get_jump_bytes(instructions[i], true);
+        changed = true;
+      }
+    }
+  }
+
+  fs.bytes = offsets[sizes.size()];
+}
+
+void xlang::size_report::print_section(std::string name,
+                                       std::vector<struct symbol_size>& symbols)
+{
+  std::vector<struct symbol_size> sorted = symbols;
+  int total = 0;
+
+  for(auto& s : symbols)
+    total += s.bytes;
+  std::stable_sort(sorted.begin(), sorted.end(),
+            [](const struct symbol_size& a, const struct symbol_size& b){
+              return a.bytes > b.bytes;
+            });
+  if(sorted.size() > SIZE_REPORT_SYMBOLS)
+    sorted.resize(SIZE_REPORT_SYMBOLS);
+
+  std::cout<<"  "<<name<<" : "<<total<<" bytes, "<<symbols.size()<<" symbols"<<std::endl;
+  for(auto& s : sorted){
+    std::cout<<"    "<<std::left<<std::setw(32)<<s.symbol<<std::right
+             <<std::setw(8)<<s.bytes<<std::endl;
+  }
+}
+
+void xlang::size_report::print_function(struct function_size& f)
+{
+  std::cout<<"  "<<std::left<<std::setw(24)<<f.function<<std::right
+           <<std::setw(8)<<f.insn_count<<std::setw(8)<<f.bytes
+           <<std::setw(8)<<f.frame_size<<std::setw(10)<<f.memory_operands
+           <<std::setw(10)<<f.register_operands<<std::setw(6)<<f.asm_lines<<std::endl;
+}
+
+void xlang::size_report::print()
+{
+  std::vector<struct function_size> functions;
+  struct function_size fs;
+  struct function_size total = {"total", 0, 0, 0, 0, 0, 0};
+  std::map<std::string, unsigned int>::iterator fit;
+  size_t start = 0;
+
+  //function starts at label which is not local(.label),
+  //instructions before first function are shown if any
+  for(size_t i = 0; i <= instructions.size(); i++){
+    if(i == instructions.size() || (instructions[i]->insn_type == INSLABEL
+       && !instructions[i]->label.empty() && instructions[i]->label[0] != '.')){
+      if(start < i){
+        fs = {"(top level)", 0, 0, 0, 0, 0, 0};
+        if(instructions[start]->insn_type == INSLABEL
+           && instructions[start]->label[0] != '.')
+          fs.function = instructions[start]->label;
+        fit = frame_sizes.find(fs.function);
+        if(fit != frame_sizes.end())
+          fs.frame_size = fit->second;
+        size_function(start, i, fs);
+        if(fs.insn_count > 0 || fs.asm_lines > 0 || fit != frame_sizes.end())
+          functions.push_back(fs);
+      }
+      start = i;
+    }
+  }
+
+  std::stable_sort(functions.begin(), functions.end(),
+            [](const struct function_size& a, const struct function_size& b){
+              return a.bytes > b.bytes;
+            });
+
+  xlang::print::print_white_bold_text("size report:");
+  std::cout<<std::endl;
+  std::cout<<"  "<<std::left<<std::setw(24)<<"function"<<std::right
+           <<std::setw(8)<<"insns"<<std::setw(8)<<"bytes"<<std::setw(8)<<"frame"
+           <<std::setw(10)<<"mem opnd"<<std::setw(10)<<"reg opnd"
+           <<std::setw(6)<<"asm"<<std::endl;
+  for(auto& f : functions){
+    print_function(f);
+    total.insn_count += f.insn_count;
+    total.bytes += f.bytes;
+    total.frame_size += f.frame_size;
+    total.memory_operands += f.memory_operands;
+    total.register_operands += f.register_operands;
+    total.asm_lines += f.asm_lines;
+  }
+  print_function(total);
+  if(total.asm_lines > 0)
+    std::cout<<"  (bytes do not include inline assembly)"<<std::endl;
+
+  xlang::print::print_white_bold_text("sections:");
+  std::cout<<std::endl;
+  std::cout<<"  .text : "<<total.bytes<<" bytes"<<std::endl;
+  print_section(".data", data_symbols);
+  print_section(".bss", bss_symbols);
+}
+
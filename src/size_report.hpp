@@ -0,0 +1,84 @@
+/*
+*  src/size_report.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in size_report.cpp file by class size_report,
+* per function code size and section size report used by --size-report.
+*/
+
+#ifndef SIZE_REPORT_HPP
+#define SIZE_REPORT_HPP
+
+#include <vector>
+#include <string>
+#include <map>
+#include "insn.hpp"
+#include "regs.hpp"
+
+//count of largest symbols printed for each of .data/.bss section
+#define SIZE_REPORT_SYMBOLS 10
+
+namespace xlang{
+
+struct function_size
+{
+  std::string function;
+  int insn_count;
+  int bytes;
+  unsigned int frame_size;
+  int memory_operands;
+  int register_operands;
+  int asm_lines;   //inline assembly, not included in bytes
+};
+
+struct symbol_size
+{
+  std::string symbol;
+  int bytes;
+};
+
+class size_report
+{
+public:
+  size_report(std::vector<struct insn*>&, xlang::insn_class*, xlang::regs*, int);
+  void set_frame_size(std::string, unsigned int);
+  void add_data(std::string, int);
+  void add_bss(std::string, int);
+  //print size of functions and of sections on stdout
+  void print();
+
+private:
+  std::vector<struct insn*>& instructions;
+  xlang::insn_class* insncls;
+  xlang::regs* reg;
+  int bits;   //16, 32 or 64 bit code, changed by [bits N] of inline assembly
+  std::map<std::string, unsigned int> frame_sizes;
+  std::vector<struct symbol_size> data_symbols;
+  std::vector<struct symbol_size> bss_symbols;
+
+  static bool get_literal(std::string, long long*);
+  static bool is_imm8(struct operand*);
+  static bool is_sse(insn_t);
+  static bool is_fpu(insn_t);
+  void set_bits(std::string);
+  bool is_address(struct operand*);
+  regs_t get_base_register(struct operand*);
+  int get_operand_size(struct operand*);
+  int get_memory_bytes(struct operand*);
+  bool is_moffs(struct operand*, struct operand*);
+  int get_modrm_bytes(struct insn*);
+  int get_prefix_bytes(struct insn*);
+  int get_jump_bytes(struct insn*, bool);
+  int get_insn_bytes(struct insn*);
+  void count_operands(struct insn*, struct function_size&);
+  void size_function(size_t, size_t, struct function_size&);
+  void print_function(struct function_size&);
+  void print_section(std::string, std::vector<struct symbol_size>&);
+};
+
+}
+
+#endif
+
@@ -0,0 +1,355 @@
+/*
+*  src/stats.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains compilation statistics counters,
+* each optimization/code generation phase increments
+* its named counter, and counters are printed
+* at end of compilation with --print-stats option,
+* phase timers are printed with -ftime-report option,
+* counters are also kept per function and printed as json with --stats=json,
+* -Rpass remarks report optimizations applied/missed with source location
+*/
+
+#include <iostream>
+#include "stats.hpp"
+#include "lex.hpp"
+#include "parser.hpp"
+#include "print.hpp"
+
+std::map<std::string, int> xlang::stats::counters;
+std::map<std::string, std::map<std::string, int>> xlang::stats::function_counters;
+std::string xlang::stats::current_function = "";
+std::set<std::string> xlang::stats::remark_passes;
+std::set<std::string> xlang::stats::missed_passes;
+std::map<std::string, double> xlang::stats::timers;
+std::map<std::string, std::chrono::steady_clock::time_point> xlang::stats::timer_starts;
+
+void xlang::stats::count(std::string name, int n)
+{
+  counters[name] += n;
+  if(!current_function.empty())
+    function_counters[current_function][name] += n;
+}
+
+void xlang::stats::count(std::string name)
+{
+  count(name, 1);
+}
+
+int xlang::stats::get_count(std::string name)
+{
+  std::map<std::string, int>::iterator it = counters.find(name);
+  if(it == counters.end())
+    return 0;
+  return it->second;
+}
+
+void xlang::stats::print_stats()
+{
+  xlang::print::print_white_bold_text("statistics:");
+  std::cout<<std::endl;
+  if(counters.empty()){
+    std::cout<<"  (none)"<<std::endl;
+    return;
+  }
+  for(auto e : counters){
+    std::cout<<"  "<<e.first<<" : "<<e.second<<std::endl;
+  }
+}
+
+void xlang::stats::print_json_counters(std::map<std::string, int>& cntrs,
+                                       std::string indent)
+{
+  std::map<std::string, int>::iterator it = cntrs.begin();
+  std::cout<<"{";
+  while(it != cntrs.end()){
+    std::cout<<std::endl<<indent<<"  \""<<it->first<<"\": "<<it->second;
+    it++;
+    if(it != cntrs.end())
+      std::cout<<",";
+  }
+  if(!cntrs.empty())
+    std::cout<<std::endl<<indent;
+  std::cout<<"}";
+}
+
+/*
+print counters of whole compilation and of each function as json object,
+{ "file": ..., "counters": {...}, "functions": { "f": {...}, ... } }
+*/
+void xlang::stats::print_json(std::string filename)
+{
+  std::string file;
+  std::map<std::string, std::map<std::string, int>>::iterator it;
+
+  for(char ch : filename){
+    if(ch == '"' || ch == '\\')
+      file.push_back('\\');
+    file.push_back(ch);
+  }
+  std::cout<<"{"<<std::endl;
+  std::cout<<"  \"file\": \""<<file<<"\","<<std::endl;
+  std::cout<<"  \"counters\": ";
+  print_json_counters(counters, "  ");
+  std::cout<<","<<std::endl;
+  std::cout<<"  \"functions\": {";
+  it = function_counters.begin();
+  while(it != function_counters.end()){
+    std::cout<<std::endl<<"    \""<<it->first<<"\": ";
+    print_json_counters(it->second, "    ");
+    it++;
+    if(it != function_counters.end())
+      std::cout<<",";
+  }
+  if(!function_counters.empty())
+    std::cout<<std::endl<<"  ";
+  std::cout<<"}"<<std::endl;
+  std::cout<<"}"<<std::endl;
+}
+
+void xlang::stats::set_function(std::string name)
+{
+  current_function = name;
+}
+
+void xlang::stats::count_primary_expr(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr)
+    count("ast.operator");
+  else if(pexpr->is_id)
+    count("ast.identifier");
+  else
+    count("ast.literal");
+  count_primary_expr(pexpr->left);
+  count_primary_expr(pexpr->right);
+  count_primary_expr(pexpr->unary_node);
+}
+
+void xlang::stats::count_id_expr(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr)
+    count("ast.operator");
+  else
+    count("ast.identifier");
+  count_id_expr(idexpr->left);
+  count_id_expr(idexpr->right);
+  count_id_expr(idexpr->unary);
+}
+
+void xlang::stats::count_expr(struct expr* exp)
+{
+  if(exp == nullptr) return;
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      count("ast.primary-expr");
+      count_primary_expr(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      count("ast.assgn-expr");
+      count_id_expr(exp->assgn_expression->id_expression);
+      count_expr(exp->assgn_expression->expression);
+      break;
+    case SIZEOF_EXPR :
+      count("ast.sizeof-expr");
+      break;
+    case CAST_EXPR :
+      count("ast.cast-expr");
+      count_id_expr(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      count("ast.id-expr");
+      count_id_expr(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      count("ast.func-call-expr");
+      count_id_expr(exp->func_call_expression->function);
+      for(auto e : exp->func_call_expression->expression_list)
+        count_expr(e);
+      break;
+  }
+}
+
+void xlang::stats::count_statement(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case LABEL_STMT :
+        count("ast.label-stmt");
+        break;
+      case EXPR_STMT :
+        count("ast.expr-stmt");
+        count_expr(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        count("ast.select-stmt");
+        count_expr(stm->selection_statement->condition);
+        count_statement(stm->selection_statement->if_statement);
+        count_statement(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            count("ast.while-stmt");
+            count_expr(iter->_while.condition);
+            count_statement(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            count("ast.dowhile-stmt");
+            count_expr(iter->_dowhile.condition);
+            count_statement(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            count("ast.for-stmt");
+            count_expr(iter->_for.init_expression);
+            count_expr(iter->_for.condition);
+            count_expr(iter->_for.update_expression);
+            count_statement(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        count("ast.jump-stmt");
+        count_expr(stm->jump_statement->expression);
+        break;
+      case DECL_STMT :
+        count("ast.decl-stmt");
+        break;
+      case ASM_STMT :
+        count("ast.asm-stmt");
+        break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+/*
+count source level statistics of analyzed program,
+tokens are assigned to function by line on which it is defined
+until the next function definition
+*/
+void xlang::stats::count_source(std::string filename, struct tree_node* tr)
+{
+  std::map<int, std::string> functions;
+  std::map<int, std::string>::iterator it;
+  struct st_symbol_info* syminfo = nullptr;
+  xlang::lexer* lx = nullptr;
+  token tok;
+
+  for(struct tree_node* trhead = tr; trhead != nullptr; trhead = trhead->p_next){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr
+       && !trhead->symtab->func_info->is_extern)
+      functions[trhead->symtab->func_info->tok.loc.line] =
+                                  trhead->symtab->func_info->func_name;
+  }
+
+  lx = new xlang::lexer(filename);
+  tok = lx->get_next_token();
+  while(tok.token != END_OF_FILE){
+    it = functions.upper_bound(tok.loc.line);
+    if(it == functions.begin())
+      set_function("");
+    else
+      set_function((--it)->second);
+    count("lexer.tokens");
+    tok = lx->get_next_token();
+  }
+  delete lx;
+
+  for(struct tree_node* trhead = tr; trhead != nullptr; trhead = trhead->p_next){
+    set_function("");
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr){
+      if(trhead->symtab->func_info->is_extern) continue;
+      set_function(trhead->symtab->func_info->func_name);
+      for(int i = 0; i < ST_SIZE; i++){
+        for(syminfo = trhead->symtab->symbol_info[i]; syminfo != nullptr;
+            syminfo = syminfo->p_next)
+          count("symtab.symbols");
+      }
+    }
+    count_statement(trhead->statement);
+  }
+  set_function("");
+
+  if(xlang::global_symtab != nullptr){
+    for(int i = 0; i < ST_SIZE; i++){
+      for(syminfo = xlang::global_symtab->symbol_info[i]; syminfo != nullptr;
+          syminfo = syminfo->p_next)
+        count("symtab.symbols");
+    }
+  }
+}
+
+void xlang::stats::enable_remarks(std::string pass, bool missed)
+{
+  if(missed)
+    missed_passes.insert(pass);
+  else
+    remark_passes.insert(pass);
+}
+
+void xlang::stats::print_remark(std::string option, std::string pass,
+                                loc_t loc, std::string msg)
+{
+  std::string str = xlang::filename;
+  str.push_back(':');
+  str.insert(str.size(), std::to_string(loc.line));
+  str.push_back(':');
+  str.insert(str.size(), std::to_string(loc.col));
+  xlang::print::print_white_bold_text(str);
+  std::cout<<" remark: "<<msg<<" ["<<option<<"="<<pass<<"]"<<std::endl;
+}
+
+//remark for optimization applied by pass
+void xlang::stats::remark(std::string pass, loc_t loc, std::string msg)
+{
+  if(remark_passes.count("") > 0 || remark_passes.count(pass) > 0)
+    print_remark("-Rpass", pass, loc, msg);
+}
+
+//remark for optimization not applied by pass, msg is the reason
+void xlang::stats::missed(std::string pass, loc_t loc, std::string msg)
+{
+  if(missed_passes.count("") > 0 || missed_passes.count(pass) > 0)
+    print_remark("-Rpass-missed", pass, loc, msg);
+}
+
+void xlang::stats::clear()
+{
+  counters.clear();
+  function_counters.clear();
+  current_function = "";
+  timers.clear();
+  timer_starts.clear();
+}
+
+void xlang::stats::start_timer(std::string name)
+{
+  timer_starts[name] = std::chrono::steady_clock::now();
+}
+
+void xlang::stats::stop_timer(std::string name)
+{
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  std::map<std::string, std::chrono::steady_clock::time_point>::iterator it;
+  it = timer_starts.find(name);
+  if(it == timer_starts.end())
+    return;
+  timers[name] += std::chrono::duration<double>(end - it->second).count();
+  timer_starts.erase(it);
+}
+
+double xlang::stats::get_time(std::string name)
+{
+  std::map<std::string, double>::iterator it = timers.find(name);
+  if(it == timers.end())
+    return 0.0;
+  return it->second;
+}
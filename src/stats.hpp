@@ -0,0 +1,75 @@
+/*
+*  src/stats.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in stats.cpp file by class stats.
+*/
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <string>
+#include <map>
+#include <set>
+#include <chrono>
+#include "types.hpp"
+#include "tree.hpp"
+
+namespace xlang
+{
+
+class stats
+{
+  public:
+    //increment named counter by given value
+    static void count(std::string, int);
+    static void count(std::string);
+    static int get_count(std::string);
+    static void print_stats();
+    static void print_json(std::string);
+    static void clear();
+
+    //counters are also added to this function, empty for none
+    static void set_function(std::string);
+    //count tokens of file, ast nodes by kind and symbols per function
+    static void count_source(std::string, struct tree_node*);
+
+    //-Rpass remarks for optimizations applied/missed in pass,
+    //empty pass name enables all passes
+    static void enable_remarks(std::string, bool);
+    static void remark(std::string, loc_t, std::string);
+    static void missed(std::string, loc_t, std::string);
+
+    //accumulate time spent in named compiler phase
+    static void start_timer(std::string);
+    static void stop_timer(std::string);
+    static double get_time(std::string);
+
+  private:
+    //counter name, and its count
+    //std::map is used so that counters are printed in sorted order
+    static std::map<std::string, int> counters;
+    //function name, and its counters
+    static std::map<std::string, std::map<std::string, int>> function_counters;
+    static std::string current_function;
+    //passes enabled by -Rpass and -Rpass-missed
+    static std::set<std::string> remark_passes;
+    static std::set<std::string> missed_passes;
+    //phase name, its total time in seconds
+    static std::map<std::string, double> timers;
+    static std::map<std::string, std::chrono::steady_clock::time_point> timer_starts;
+
+    static void print_remark(std::string, std::string, loc_t, std::string);
+    static void print_json_counters(std::map<std::string, int>&, std::string);
+    static void count_primary_expr(struct primary_expr*);
+    static void count_id_expr(struct id_expr*);
+    static void count_expr(struct expr*);
+    static void count_statement(struct stmt*);
+};
+
+}
+
+#endif
+
@@ -47,8 +47,11 @@ struct st_symbol_info* xlang::symtable::get_symbol_info_mem()
   struct st_symbol_info* newst = new struct st_symbol_info;
   newst->type_info = nullptr;
   newst->p_next = nullptr;
+  newst->is_ptr = false;
+  newst->ptr_oprtr_count = 0;
   newst->is_array = false;
   newst->is_func_ptr = false;
+  newst->ret_ptr_count = 0;
   return newst;
 }
 
@@ -64,6 +67,7 @@ struct st_func_param_info* xlang::symtable::get_func_param_info_mem()
 struct st_func_info* xlang::symtable::get_func_info_mem()
 {
   struct st_func_info* newst = new struct st_func_info;
+  newst->ptr_oprtr_count = 0;
   newst->return_type = nullptr;
   return newst;
 }
@@ -272,29 +276,25 @@ void xlang::symtable::insert_symbol_node(struct st_node** symtab, struct st_symb
 
 bool xlang::symtable::remove_symbol(struct st_node** symtab, lexeme_t symbol)
 {
-  struct st_symbol_info* temp = nullptr;
+  struct st_symbol_info* prev = nullptr;
   struct st_symbol_info* curr = nullptr;
+  unsigned int hash;
   if(*symtab == nullptr) return false;
-  curr = (*symtab)->symbol_info[st_hash_code(symbol)];
-  if(curr == nullptr) return false;
-  if(curr->symbol == symbol){
-    temp = curr->p_next;
-    delete_symbol_info(&curr);
-    curr = nullptr;
-    curr = temp;
-  }else{
-    temp = curr;
-    while(curr->p_next != nullptr){
-      if(curr->symbol == symbol){
-        temp->p_next = curr->p_next;
-        delete_symbol_info(&curr);
-        curr = nullptr;
-        return true;
-      }else{
-        temp = curr;
-        curr = curr->p_next;
-      }
+  hash = st_hash_code(symbol);
+  curr = (*symtab)->symbol_info[hash];
+  while(curr != nullptr){
+    if(curr->symbol == symbol){
+      //unlink only matched symbol, delete_symbol_info() releases whole queue
+      if(prev == nullptr)
+        (*symtab)->symbol_info[hash] = curr->p_next;
+      else
+        prev->p_next = curr->p_next;
+      curr->p_next = nullptr;
+      delete_symbol_info(&curr);
+      return true;
     }
+    prev = curr;
+    curr = curr->p_next;
   }
   return false;
 }
@@ -0,0 +1,915 @@
+/*
+*  src/tailcall.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains tail-recursion elimination over the abstract syntax tree.
+* A call of function to itself in tail position,
+*   return f(args);   or   t = f(args); return t;
+* is replaced by assignments of arguments to parameters and goto
+* to a label placed at the start of function body.
+* Argument which is read by later arguments is first copied
+* into a temporary, so all arguments see old parameter values.
+* Calls whose result is combined with another value by + or *,
+*   t = f(args); return t op x;   or   t = f(args); t = t op x; return t;
+* introduce an int accumulator initialized to 0 or 1 before entry label,
+* x is combined into it before jump and every other return e;
+* is rewritten as return accumulator op e;
+* Functions whose frame escapes(address of local or parameter is taken,
+* inline assembly) or having float/record parameters are not touched.
+*/
+
+#include "tree.hpp"
+#include "symtab.hpp"
+#include "parser.hpp"
+#include "stats.hpp"
+#include "tailcall.hpp"
+
+using namespace xlang;
+
+bool xlang::tailcall::takes_address(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  if(pexpr->is_oprtr && pexpr->tok.token == ADDROF_OP)
+    return true;
+  return takes_address(pexpr->left) || takes_address(pexpr->right)
+          || takes_address(pexpr->unary_node);
+}
+
+bool xlang::tailcall::takes_address(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return false;
+  if(idexpr->is_oprtr && idexpr->tok.token == ADDROF_OP)
+    return true;
+  return takes_address(idexpr->left) || takes_address(idexpr->right)
+          || takes_address(idexpr->unary);
+}
+
+bool xlang::tailcall::takes_address(struct expr* exp)
+{
+  if(exp == nullptr) return false;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      return takes_address(exp->primary_expression);
+    case ASSGN_EXPR :
+      return takes_address(exp->assgn_expression->id_expression)
+              || takes_address(exp->assgn_expression->expression);
+    case CAST_EXPR :
+      return takes_address(exp->cast_expression->target);
+    case ID_EXPR :
+      return takes_address(exp->id_expression);
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list){
+        if(takes_address(e))
+          return true;
+      }
+      return false;
+    default: break;
+  }
+  return false;
+}
+
+bool xlang::tailcall::takes_address(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        if(takes_address(stm->expression_statement->expression))
+          return true;
+        break;
+      case SELECT_STMT :
+        if(takes_address(stm->selection_statement->condition)
+           || takes_address(stm->selection_statement->if_statement)
+           || takes_address(stm->selection_statement->else_statement))
+          return true;
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            if(takes_address(iter->_while.condition)
+               || takes_address(iter->_while.statement))
+              return true;
+            break;
+          case DOWHILE_STMT :
+            if(takes_address(iter->_dowhile.condition)
+               || takes_address(iter->_dowhile.statement))
+              return true;
+            break;
+          case FOR_STMT :
+            if(takes_address(iter->_for.init_expression)
+               || takes_address(iter->_for.condition)
+               || takes_address(iter->_for.update_expression)
+               || takes_address(iter->_for.statement))
+              return true;
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        if(takes_address(stm->jump_statement->expression))
+          return true;
+        break;
+      //inline assembly refers function frame directly
+      case ASM_STMT :
+        return true;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+  return false;
+}
+
+/*
+check function frame may be referred after function returns,
+which makes reuse of frame by tail call unsafe
+*/
+bool xlang::tailcall::frame_escapes(struct tree_node* trnode)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  if(trnode == nullptr || trnode->symtab == nullptr) return true;
+  for(int i = 0; i < ST_SIZE; i++){
+    syminfo = trnode->symtab->symbol_info[i];
+    while(syminfo != nullptr){
+      if(syminfo->is_array)
+        return true;
+      syminfo = syminfo->p_next;
+    }
+  }
+  return takes_address(trnode->statement);
+}
+
+//search symbol in function symbol table, parameters and global symbol table
+struct st_symbol_info* xlang::tailcall::search_id(std::string name)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, name);
+  if(syminfo != nullptr) return syminfo;
+  for(auto fparam : func_symtab->func_info->param_list){
+    if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name)
+      return fparam->symbol_info;
+  }
+  return xlang::symtable::search_symbol_node(xlang::global_symtab, name);
+}
+
+void xlang::tailcall::get_ids(struct primary_expr* pexpr, std::unordered_set<std::string>& ids)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_id)
+    ids.insert(pexpr->tok.lexeme);
+  get_ids(pexpr->left, ids);
+  get_ids(pexpr->right, ids);
+  get_ids(pexpr->unary_node, ids);
+}
+
+void xlang::tailcall::get_ids(struct id_expr* idexpr, std::unordered_set<std::string>& ids)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_id)
+    ids.insert(idexpr->tok.lexeme);
+  for(auto& t : idexpr->subscript){
+    if(t.token == IDENTIFIER)
+      ids.insert(t.lexeme);
+  }
+  get_ids(idexpr->left, ids);
+  get_ids(idexpr->right, ids);
+  get_ids(idexpr->unary, ids);
+}
+
+void xlang::tailcall::get_ids(struct expr* exp, std::unordered_set<std::string>& ids)
+{
+  if(exp == nullptr) return;
+  if(exp->expr_kind == PRIMARY_EXPR)
+    get_ids(exp->primary_expression, ids);
+  else if(exp->expr_kind == ID_EXPR)
+    get_ids(exp->id_expression, ids);
+}
+
+//++/-- changes order dependent values when expressions are reordered
+bool xlang::tailcall::has_side_effect(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  if(pexpr->is_oprtr && (pexpr->tok.token == INCR_OP || pexpr->tok.token == DECR_OP))
+    return true;
+  return has_side_effect(pexpr->left) || has_side_effect(pexpr->right)
+          || has_side_effect(pexpr->unary_node);
+}
+
+bool xlang::tailcall::has_side_effect(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return false;
+  if(idexpr->is_oprtr && (idexpr->tok.token == INCR_OP || idexpr->tok.token == DECR_OP))
+    return true;
+  return has_side_effect(idexpr->left) || has_side_effect(idexpr->right)
+          || has_side_effect(idexpr->unary);
+}
+
+bool xlang::tailcall::has_float(struct primary_expr* pexpr)
+{
+  struct st_symbol_info* syminfo = nullptr;
+  if(pexpr == nullptr) return false;
+
+  if(pexpr->tok.token == LIT_FLOAT) return true;
+  if(pexpr->is_id){
+    syminfo = search_id(pexpr->tok.lexeme);
+    if(syminfo == nullptr) return true;
+    if(!syminfo->is_ptr && syminfo->type_info != nullptr && syminfo->type_info->type == SIMPLE_TYPE
+       && (syminfo->type_info->type_specifier.simple_type[0].token == KEY_FLOAT
+           || syminfo->type_info->type_specifier.simple_type[0].token == KEY_DOUBLE))
+      return true;
+  }
+  return has_float(pexpr->left) || has_float(pexpr->right)
+          || has_float(pexpr->unary_node);
+}
+
+//float value through pointer or array element is also considered
+bool xlang::tailcall::has_float(struct expr* exp)
+{
+  std::unordered_set<std::string> ids;
+  struct st_symbol_info* syminfo = nullptr;
+  if(exp == nullptr) return false;
+
+  if(exp->expr_kind == PRIMARY_EXPR)
+    return has_float(exp->primary_expression);
+
+  get_ids(exp, ids);
+  for(auto& name : ids){
+    syminfo = search_id(name);
+    if(syminfo == nullptr || syminfo->type_info == nullptr
+       || syminfo->type_info->type != SIMPLE_TYPE)
+      return true;
+    if(syminfo->type_info->type_specifier.simple_type[0].token == KEY_FLOAT
+       || syminfo->type_info->type_specifier.simple_type[0].token == KEY_DOUBLE)
+      return true;
+  }
+  return false;
+}
+
+bool xlang::tailcall::is_int_type(struct st_type_info* tinf)
+{
+  if(tinf == nullptr || tinf->type != SIMPLE_TYPE) return false;
+  return tinf->type_specifier.simple_type.size() == 1
+          && tinf->type_specifier.simple_type[0].token == KEY_INT;
+}
+
+//plain int variable local to function
+bool xlang::tailcall::is_local_int(struct id_expr* idexpr)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  if(idexpr == nullptr || !idexpr->is_id || idexpr->is_oprtr) return false;
+  if(idexpr->left != nullptr || idexpr->right != nullptr
+     || idexpr->unary != nullptr || idexpr->is_subscript || idexpr->is_ptr)
+    return false;
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, idexpr->tok.lexeme);
+  if(syminfo == nullptr || syminfo->is_ptr || syminfo->is_array || syminfo->is_func_ptr)
+    return false;
+  return is_int_type(syminfo->type_info);
+}
+
+bool xlang::tailcall::is_leaf_id(struct primary_expr* pexpr, std::string name)
+{
+  if(pexpr == nullptr || pexpr->is_oprtr || !pexpr->is_id) return false;
+  if(pexpr->left != nullptr || pexpr->right != nullptr || pexpr->unary_node != nullptr)
+    return false;
+  return pexpr->tok.lexeme == name;
+}
+
+//direct call of function to itself with simple int/pointer arguments
+bool xlang::tailcall::is_self_call(struct expr* exp)
+{
+  struct func_call_expr* fcexpr = nullptr;
+  struct id_expr* function = nullptr;
+
+  if(exp == nullptr || exp->expr_kind != FUNC_CALL_EXPR) return false;
+  fcexpr = exp->func_call_expression;
+  function = fcexpr->function;
+  if(function == nullptr || function->left != nullptr || function->right != nullptr
+     || function->unary != nullptr)
+    return false;
+  if(function->tok.lexeme != func_symtab->func_info->func_name) return false;
+  if(fcexpr->expression_list.size() != func_symtab->func_info->param_list.size())
+    return false;
+
+  for(auto e : fcexpr->expression_list){
+    if(e == nullptr) return false;
+    switch(e->expr_kind){
+      case PRIMARY_EXPR :
+        if(has_side_effect(e->primary_expression)) return false;
+        break;
+      case ID_EXPR :
+        if(has_side_effect(e->id_expression)) return false;
+        break;
+      default :
+        return false;
+    }
+    if(has_float(e)) return false;
+  }
+  return true;
+}
+
+bool xlang::tailcall::is_eligible_function()
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  for(auto fparam : func_symtab->func_info->param_list){
+    if(fparam == nullptr || fparam->symbol_info == nullptr) return false;
+    syminfo = fparam->symbol_info;
+    if(fparam->type_info == nullptr || fparam->type_info->type != SIMPLE_TYPE)
+      return false;
+    if(syminfo->is_array || syminfo->is_func_ptr) return false;
+    if(!syminfo->is_ptr
+       && (fparam->type_info->type_specifier.simple_type[0].token == KEY_FLOAT
+           || fparam->type_info->type_specifier.simple_type[0].token == KEY_DOUBLE))
+      return false;
+  }
+  return true;
+}
+
+/*
+check primary expression is t op x or x op t,
+where op is + or * and x is int expression not using t
+*/
+bool xlang::tailcall::is_acc_operand(struct primary_expr* pexpr, std::string t, token_t* op)
+{
+  std::unordered_set<std::string> ids;
+  struct primary_expr* x = nullptr;
+
+  if(pexpr == nullptr || !pexpr->is_oprtr || pexpr->oprtr_kind != BINARY_OP)
+    return false;
+  if(pexpr->tok.token != ARTHM_ADD && pexpr->tok.token != ARTHM_MUL)
+    return false;
+  if(pexpr->left == nullptr || pexpr->right == nullptr) return false;
+
+  if(is_leaf_id(pexpr->left, t))
+    x = pexpr->right;
+  else if(is_leaf_id(pexpr->right, t))
+    x = pexpr->left;
+  else
+    return false;
+
+  get_ids(x, ids);
+  if(ids.find(t) != ids.end()) return false;
+  if(has_side_effect(x) || has_float(x)) return false;
+
+  *op = pexpr->tok.token;
+  return true;
+}
+
+/*
+check statement starts a tail call site, returns self call of site,
+op is set to accumulator operator and root to expression t op x,
+count is set to number of statements of site
+*/
+struct func_call_expr* xlang::tailcall::get_call_site(struct stmt* stm, token_t* op,
+                                  struct primary_expr** root, int* count)
+{
+  struct stmt* next = nullptr;
+  struct stmt* last = nullptr;
+  struct assgn_expr* assgnexp = nullptr;
+  struct assgn_expr* assgnexp2 = nullptr;
+  struct expr* exp = nullptr;
+  std::string t;
+
+  *op = NONE;
+  *root = nullptr;
+  *count = 0;
+
+  if(stm->type == JUMP_STMT && stm->jump_statement->type == RETURN_JMP){
+    if(!is_self_call(stm->jump_statement->expression)) return nullptr;
+    *count = 1;
+    return stm->jump_statement->expression->func_call_expression;
+  }
+
+  //t = f(args);
+  if(stm->type != EXPR_STMT || stm->expression_statement->expression == nullptr)
+    return nullptr;
+  exp = stm->expression_statement->expression;
+  if(exp->expr_kind != ASSGN_EXPR) return nullptr;
+  assgnexp = exp->assgn_expression;
+  if(assgnexp->tok.token != ASSGN) return nullptr;
+  if(!is_local_int(assgnexp->id_expression)) return nullptr;
+  if(!is_self_call(assgnexp->expression)) return nullptr;
+  if(!is_int_type(func_symtab->func_info->return_type)
+     || func_symtab->func_info->ptr_oprtr_count > 0)
+    return nullptr;
+  t = assgnexp->id_expression->tok.lexeme;
+
+  next = stm->p_next;
+  if(next == nullptr) return nullptr;
+
+  //t = t op x;
+  if(next->type == EXPR_STMT && next->expression_statement->expression != nullptr
+     && next->expression_statement->expression->expr_kind == ASSGN_EXPR){
+    assgnexp2 = next->expression_statement->expression->assgn_expression;
+    last = next->p_next;
+    if(assgnexp2->tok.token != ASSGN
+       || assgnexp2->id_expression->tok.lexeme != t
+       || !is_local_int(assgnexp2->id_expression)
+       || assgnexp2->expression == nullptr
+       || assgnexp2->expression->expr_kind != PRIMARY_EXPR
+       || !is_acc_operand(assgnexp2->expression->primary_expression, t, op))
+      return nullptr;
+    if(last == nullptr || last->type != JUMP_STMT
+       || last->jump_statement->type != RETURN_JMP
+       || last->jump_statement->expression == nullptr
+       || last->jump_statement->expression->expr_kind != PRIMARY_EXPR
+       || !is_leaf_id(last->jump_statement->expression->primary_expression, t))
+      return nullptr;
+    *root = assgnexp2->expression->primary_expression;
+    *count = 3;
+  }else{
+    //return t; or return t op x;
+    if(next->type != JUMP_STMT || next->jump_statement->type != RETURN_JMP
+       || next->jump_statement->expression == nullptr
+       || next->jump_statement->expression->expr_kind != PRIMARY_EXPR)
+      return nullptr;
+    exp = next->jump_statement->expression;
+    if(!is_leaf_id(exp->primary_expression, t)){
+      if(!is_acc_operand(exp->primary_expression, t, op))
+        return nullptr;
+      *root = exp->primary_expression;
+    }
+    *count = 2;
+  }
+
+  //only one accumulator operator is used in function
+  if(*op != NONE && acc_op != NONE && *op != acc_op)
+    return nullptr;
+  if(*op != NONE && !scanning && acc_op == NONE)
+    return nullptr;
+
+  return assgnexp->expression->func_call_expression;
+}
+
+/*
+select accumulator operator from call sites and check every
+other return can be rewritten as return accumulator op e;
+*/
+bool xlang::tailcall::check_returns(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+  struct primary_expr* root = nullptr;
+  struct expr* exp = nullptr;
+  token_t op = NONE;
+  int count = 0;
+
+  while(stm != nullptr){
+    if(get_call_site(stm, &op, &root, &count) != nullptr){
+      if(op != NONE)
+        acc_op = op;
+      while(--count > 0)
+        stm = stm->p_next;
+      stm = stm->p_next;
+      continue;
+    }
+    switch(stm->type){
+      case SELECT_STMT :
+        if(!check_returns(stm->selection_statement->if_statement)
+           || !check_returns(stm->selection_statement->else_statement))
+          return false;
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            if(!check_returns(iter->_while.statement)) return false;
+            break;
+          case DOWHILE_STMT :
+            if(!check_returns(iter->_dowhile.statement)) return false;
+            break;
+          case FOR_STMT :
+            if(!check_returns(iter->_for.statement)) return false;
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        if(stm->jump_statement->type == RETURN_JMP){
+          exp = stm->jump_statement->expression;
+          if(exp == nullptr || exp->expr_kind != PRIMARY_EXPR
+             || has_float(exp->primary_expression))
+            return false;
+        }
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+  return true;
+}
+
+//detach operand x from expression t op x or x op t
+struct primary_expr* xlang::tailcall::detach_operand(struct primary_expr* root, std::string t)
+{
+  struct primary_expr* x = nullptr;
+
+  if(is_leaf_id(root->left, t)){
+    x = root->right;
+    root->right = nullptr;
+  }else{
+    x = root->left;
+    root->left = nullptr;
+  }
+  return x;
+}
+
+//create temporary in function symbol table
+struct st_symbol_info* xlang::tailcall::get_temp_symbol(std::string name,
+                                  struct st_type_info* tinf, token tok)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  xlang::symtable::insert_symbol(&func_symtab, name);
+  syminfo = xlang::last_symbol;
+  syminfo->symbol = name;
+  syminfo->tok = tok;
+  syminfo->tok.token = IDENTIFIER;
+  syminfo->tok.lexeme = name;
+  syminfo->type_info = tinf;
+  syminfo->is_ptr = false;
+  syminfo->ptr_oprtr_count = 0;
+  syminfo->is_array = false;
+  syminfo->is_func_ptr = false;
+  syminfo->ret_ptr_count = 0;
+  return syminfo;
+}
+
+struct id_expr* xlang::tailcall::get_id_expr(struct st_symbol_info* syminfo)
+{
+  struct id_expr* idexpr = xlang::tree::get_id_expr_mem();
+
+  idexpr->tok = syminfo->tok;
+  idexpr->tok.token = IDENTIFIER;
+  idexpr->tok.lexeme = syminfo->symbol;
+  idexpr->is_oprtr = false;
+  idexpr->is_id = true;
+  idexpr->id_info = syminfo;
+  idexpr->is_subscript = false;
+  idexpr->is_ptr = false;
+  idexpr->ptr_oprtr_count = 0;
+  return idexpr;
+}
+
+//create statement left = exp;
+struct stmt* xlang::tailcall::get_assgn_statement(struct st_symbol_info* left, struct expr* exp)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+  struct expr* assgnexp = xlang::tree::get_expr_mem();
+
+  assgnexp->expr_kind = ASSGN_EXPR;
+  assgnexp->assgn_expression = xlang::tree::get_assgn_expr_mem();
+  assgnexp->assgn_expression->tok = left->tok;
+  assgnexp->assgn_expression->tok.token = ASSGN;
+  assgnexp->assgn_expression->tok.lexeme = "=";
+  assgnexp->assgn_expression->id_expression = get_id_expr(left);
+  assgnexp->assgn_expression->expression = exp;
+
+  newstmt->type = EXPR_STMT;
+  newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+  newstmt->expression_statement->expression = assgnexp;
+  return newstmt;
+}
+
+struct stmt* xlang::tailcall::get_goto_statement(token tok)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+
+  newstmt->type = JUMP_STMT;
+  newstmt->jump_statement = xlang::tree::get_jump_stmt_mem();
+  newstmt->jump_statement->type = GOTO_JMP;
+  newstmt->jump_statement->tok = tok;
+  newstmt->jump_statement->tok.token = KEY_GOTO;
+  newstmt->jump_statement->tok.lexeme = "goto";
+  newstmt->jump_statement->goto_id = tok;
+  newstmt->jump_statement->goto_id.token = IDENTIFIER;
+  newstmt->jump_statement->goto_id.lexeme = entry_label;
+  return newstmt;
+}
+
+struct stmt* xlang::tailcall::get_label_statement(token tok)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+
+  newstmt->type = LABEL_STMT;
+  newstmt->labled_statement = xlang::tree::get_label_stmt_mem();
+  newstmt->labled_statement->label = tok;
+  newstmt->labled_statement->label.token = IDENTIFIER;
+  newstmt->labled_statement->label.lexeme = entry_label;
+  return newstmt;
+}
+
+//create leaf expression of symbol
+struct primary_expr* xlang::tailcall::get_id_leaf(struct st_symbol_info* syminfo)
+{
+  struct primary_expr* leaf = xlang::tree::get_primary_expr_mem();
+
+  leaf->tok = syminfo->tok;
+  leaf->is_oprtr = false;
+  leaf->oprtr_kind = UNARY_OP;
+  leaf->is_id = true;
+  leaf->id_info = syminfo;
+  return leaf;
+}
+
+/*
+compound operand of accumulator is first assigned to a temporary,
+code generated for accumulator op (a op b) does not keep order of operands,
+statement temporary = exp; is added to list
+*/
+struct primary_expr* xlang::tailcall::get_acc_operand(struct primary_expr* exp,
+                                  struct stmt** list, token tok)
+{
+  struct st_symbol_info* temp = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct expr* e = nullptr;
+
+  if(exp == nullptr) return exp;
+  if(!exp->is_oprtr && exp->left == nullptr && exp->right == nullptr
+     && exp->unary_node == nullptr)
+    return exp;
+
+  temp = get_temp_symbol("_tail" + std::to_string(++temp_count),
+                         func_symtab->func_info->return_type, tok);
+  e = xlang::tree::get_expr_mem();
+  e->expr_kind = PRIMARY_EXPR;
+  e->primary_expression = exp;
+  newstmt = get_assgn_statement(temp, e);
+  xlang::tree::add_statement(list, &newstmt);
+  return get_id_leaf(temp);
+}
+
+//create expression accumulator op exp
+struct primary_expr* xlang::tailcall::get_acc_expr(struct primary_expr* exp, token tok)
+{
+  struct primary_expr* oprtr = xlang::tree::get_primary_expr_mem();
+
+  oprtr->tok = tok;
+  oprtr->tok.token = acc_op;
+  oprtr->tok.lexeme = (acc_op == ARTHM_ADD ? "+" : "*");
+  oprtr->is_oprtr = true;
+  oprtr->oprtr_kind = BINARY_OP;
+  oprtr->is_id = false;
+  oprtr->left = get_id_leaf(acc_info);
+  oprtr->right = exp;
+  return oprtr;
+}
+
+/*
+returns statement list replacing tail call site:
+  temporary = x;  (x is not a leaf)
+  accumulator = accumulator op x;
+  temporary = argument; ...  (argument is read by later arguments)
+  parameter = argument; ...
+  parameter = temporary; ...
+  goto entry label;
+*/
+struct stmt* xlang::tailcall::rewrite_call(struct func_call_expr* fcexpr,
+                                  token_t op, struct primary_expr* x)
+{
+  struct stmt* list = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct st_symbol_info* param = nullptr;
+  struct st_symbol_info* temp = nullptr;
+  struct expr* exp = nullptr;
+  std::vector<struct expr*> args(fcexpr->expression_list.begin(),
+                                 fcexpr->expression_list.end());
+  std::vector<struct st_func_param_info*> params(
+                                 func_symtab->func_info->param_list.begin(),
+                                 func_symtab->func_info->param_list.end());
+  std::vector<std::pair<struct st_symbol_info*, struct st_symbol_info*>> copies;
+  std::unordered_set<std::string> ids;
+  token tok = fcexpr->function->tok;
+  bool is_read = false;
+
+  if(op != NONE){
+    x = get_acc_operand(x, &list, tok);
+    exp = xlang::tree::get_expr_mem();
+    exp->expr_kind = PRIMARY_EXPR;
+    exp->primary_expression = get_acc_expr(x, tok);
+    newstmt = get_assgn_statement(acc_info, exp);
+    xlang::tree::add_statement(&list, &newstmt);
+  }
+
+  for(size_t i = 0; i < args.size(); i++){
+    param = params[i]->symbol_info;
+    //f(n - 1, acc) does not need acc = acc;
+    if(args[i]->expr_kind == PRIMARY_EXPR
+       && is_leaf_id(args[i]->primary_expression, param->symbol)){
+      xlang::tree::delete_expr(&args[i]);
+      continue;
+    }
+
+    is_read = false;
+    for(size_t j = i + 1; j < args.size() && !is_read; j++){
+      ids.clear();
+      get_ids(args[j], ids);
+      is_read = (ids.find(param->symbol) != ids.end());
+    }
+
+    if(is_read){
+      temp = get_temp_symbol("_tail" + std::to_string(++temp_count),
+                             params[i]->type_info, param->tok);
+      temp->is_ptr = param->is_ptr;
+      temp->ptr_oprtr_count = param->ptr_oprtr_count;
+      newstmt = get_assgn_statement(temp, args[i]);
+      copies.push_back(std::pair<struct st_symbol_info*,
+                                 struct st_symbol_info*>(param, temp));
+    }else{
+      newstmt = get_assgn_statement(param, args[i]);
+    }
+    xlang::tree::add_statement(&list, &newstmt);
+  }
+
+  for(auto& c : copies){
+    exp = xlang::tree::get_expr_mem();
+    exp->expr_kind = PRIMARY_EXPR;
+    exp->primary_expression = get_id_leaf(c.second);
+    newstmt = get_assgn_statement(c.first, exp);
+    xlang::tree::add_statement(&list, &newstmt);
+  }
+
+  //arguments are moved into assignments
+  fcexpr->expression_list.clear();
+
+  newstmt = get_goto_statement(tok);
+  xlang::tree::add_statement(&list, &newstmt);
+  return list;
+}
+
+/*
+return e; is rewritten as return accumulator op e;
+or as temporary = e; return accumulator op temporary; when e is not a leaf
+*/
+void xlang::tailcall::rewrite_returns(struct stmt** head, struct stmt* stm)
+{
+  struct primary_expr* pexpr = stm->jump_statement->expression->primary_expression;
+  struct stmt* list = nullptr;
+  struct stmt* tail = nullptr;
+
+  pexpr = get_acc_operand(pexpr, &list, stm->jump_statement->tok);
+  stm->jump_statement->expression->primary_expression =
+                        get_acc_expr(pexpr, stm->jump_statement->tok);
+  if(list == nullptr) return;
+
+  //insert assignment of temporary before return
+  tail = list;
+  while(tail->p_next != nullptr)
+    tail = tail->p_next;
+  list->p_prev = stm->p_prev;
+  if(stm->p_prev != nullptr)
+    stm->p_prev->p_next = list;
+  else
+    *head = list;
+  tail->p_next = stm;
+  stm->p_prev = tail;
+}
+
+void xlang::tailcall::eliminate_statement_list(struct stmt** head)
+{
+  struct stmt* stm = *head;
+  struct stmt* last = nullptr;
+  struct stmt* list = nullptr;
+  struct stmt* tail = nullptr;
+  struct iter_stmt* iter = nullptr;
+  struct func_call_expr* fcexpr = nullptr;
+  struct primary_expr* root = nullptr;
+  struct primary_expr* x = nullptr;
+  token_t op = NONE;
+  int count = 0;
+  loc_t loc;
+
+  while(stm != nullptr){
+    fcexpr = get_call_site(stm, &op, &root, &count);
+    if(fcexpr != nullptr){
+      loc = fcexpr->function->tok.loc;
+      last = stm;
+      while(--count > 0)
+        last = last->p_next;
+
+      x = nullptr;
+      if(op != NONE)
+        x = detach_operand(root, stm->expression_statement->expression
+                                   ->assgn_expression->id_expression->tok.lexeme);
+      list = rewrite_call(fcexpr, op, x);
+      tail = list;
+      while(tail->p_next != nullptr)
+        tail = tail->p_next;
+
+      //replace site statements by list
+      list->p_prev = stm->p_prev;
+      if(stm->p_prev != nullptr)
+        stm->p_prev->p_next = list;
+      else
+        *head = list;
+      tail->p_next = last->p_next;
+      if(last->p_next != nullptr)
+        last->p_next->p_prev = tail;
+      stm->p_prev = nullptr;
+      last->p_next = nullptr;
+      xlang::tree::delete_stmt(&stm);
+
+      site_count++;
+      xlang::stats::count("tailcall.eliminated-calls");
+      xlang::stats::remark("tailcall", loc, "self tail call of "
+                           +func_symtab->func_info->func_name+" turned into loop");
+      stm = tail->p_next;
+      continue;
+    }
+
+    switch(stm->type){
+      case SELECT_STMT :
+        eliminate_statement_list(&stm->selection_statement->if_statement);
+        eliminate_statement_list(&stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            eliminate_statement_list(&iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            eliminate_statement_list(&iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            eliminate_statement_list(&iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        if(stm->jump_statement->type == RETURN_JMP && acc_info != nullptr)
+          rewrite_returns(head, stm);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+void xlang::tailcall::eliminate_tail_calls(struct tree_node** tr)
+{
+  struct tree_node* trhead = *tr;
+  struct stmt* list = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct st_func_info* finfo = nullptr;
+  struct expr* exp = nullptr;
+
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr
+       && trhead->statement != nullptr){
+      func_symtab = trhead->symtab;
+      finfo = func_symtab->func_info;
+      xlang::stats::set_function(finfo->func_name);
+      if(!frame_escapes(trhead) && is_eligible_function()){
+        entry_label = "_tail_" + finfo->func_name;
+        acc_info = nullptr;
+        acc_op = NONE;
+        site_count = 0;
+        list = nullptr;
+
+        scanning = true;
+        if(!check_returns(trhead->statement))
+          acc_op = NONE;
+        scanning = false;
+
+        //accumulator = 0 or 1; before entry label
+        if(acc_op != NONE){
+          acc_info = get_temp_symbol("_tail_acc", finfo->return_type, finfo->tok);
+          exp = xlang::tree::get_expr_mem();
+          exp->expr_kind = PRIMARY_EXPR;
+          exp->primary_expression = xlang::tree::get_primary_expr_mem();
+          exp->primary_expression->tok = finfo->tok;
+          exp->primary_expression->tok.token = LIT_DECIMAL;
+          exp->primary_expression->tok.lexeme = (acc_op == ARTHM_ADD ? "0" : "1");
+          exp->primary_expression->is_oprtr = false;
+          exp->primary_expression->oprtr_kind = UNARY_OP;
+          exp->primary_expression->is_id = false;
+          newstmt = get_assgn_statement(acc_info, exp);
+          xlang::tree::add_statement(&list, &newstmt);
+          xlang::stats::count("tailcall.accumulators");
+        }
+
+        eliminate_statement_list(&trhead->statement);
+
+        if(site_count > 0){
+          newstmt = get_label_statement(finfo->tok);
+          xlang::tree::add_statement(&list, &newstmt);
+          newstmt = list;
+          while(newstmt->p_next != nullptr)
+            newstmt = newstmt->p_next;
+          newstmt->p_next = trhead->statement;
+          if(trhead->statement != nullptr)
+            trhead->statement->p_prev = newstmt;
+          trhead->statement = list;
+        }
+      }
+    }
+    trhead = trhead->p_next;
+  }
+  func_symtab = nullptr;
+  acc_info = nullptr;
+}
@@ -0,0 +1,83 @@
+/*
+*  src/tailcall.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in tailcall.cpp file by class tailcall.
+*/
+
+#ifndef TAILCALL_HPP
+#define TAILCALL_HPP
+
+#include <string>
+#include <unordered_set>
+#include "token.hpp"
+#include "types.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+namespace xlang{
+
+class tailcall
+{
+public:
+  void eliminate_tail_calls(struct tree_node**);
+  //function frame is referred after return(address taken, inline assembly)
+  static bool frame_escapes(struct tree_node*);
+
+private:
+  //count of created temporaries, used for unique names
+  unsigned temp_count = 0;
+
+  //function whose tail calls are eliminated
+  struct st_node* func_symtab = nullptr;
+  std::string entry_label;
+  unsigned site_count = 0;
+  //accumulator of rewritten non-tail calls and its operator
+  struct st_symbol_info* acc_info = nullptr;
+  token_t acc_op = NONE;
+  //set while function is scanned for accumulator operator
+  bool scanning = false;
+
+  static bool takes_address(struct primary_expr*);
+  static bool takes_address(struct id_expr*);
+  static bool takes_address(struct expr*);
+  static bool takes_address(struct stmt*);
+
+  struct st_symbol_info* search_id(std::string);
+  void get_ids(struct primary_expr*, std::unordered_set<std::string>&);
+  void get_ids(struct id_expr*, std::unordered_set<std::string>&);
+  void get_ids(struct expr*, std::unordered_set<std::string>&);
+  bool has_side_effect(struct primary_expr*);
+  bool has_side_effect(struct id_expr*);
+  bool has_float(struct primary_expr*);
+  bool has_float(struct expr*);
+  bool is_int_type(struct st_type_info*);
+  bool is_local_int(struct id_expr*);
+  bool is_leaf_id(struct primary_expr*, std::string);
+  bool is_self_call(struct expr*);
+  bool is_eligible_function();
+
+  bool is_acc_operand(struct primary_expr*, std::string, token_t*);
+  struct func_call_expr* get_call_site(struct stmt*, token_t*, struct primary_expr**, int*);
+  bool check_returns(struct stmt*);
+  struct primary_expr* detach_operand(struct primary_expr*, std::string);
+
+  struct st_symbol_info* get_temp_symbol(std::string, struct st_type_info*, token);
+  struct id_expr* get_id_expr(struct st_symbol_info*);
+  struct stmt* get_assgn_statement(struct st_symbol_info*, struct expr*);
+  struct stmt* get_goto_statement(token);
+  struct stmt* get_label_statement(token);
+  struct primary_expr* get_id_leaf(struct st_symbol_info*);
+  struct primary_expr* get_acc_operand(struct primary_expr*, struct stmt**, token);
+  struct primary_expr* get_acc_expr(struct primary_expr*, token);
+  struct stmt* rewrite_call(struct func_call_expr*, token_t, struct primary_expr*);
+  void rewrite_returns(struct stmt**, struct stmt*);
+  void eliminate_statement_list(struct stmt**);
+};
+
+}
+
+#endif
+
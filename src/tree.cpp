@@ -81,7 +81,12 @@ void xlang::tree::delete_primary_expr(struct primary_expr** pexpr)
 struct id_expr* xlang::tree::get_id_expr_mem()
 {
   struct id_expr* newexpr = new struct id_expr;
+  newexpr->is_oprtr = false;
+  newexpr->is_id = false;
   newexpr->id_info = nullptr;
+  newexpr->is_subscript = false;
+  newexpr->is_ptr = false;
+  newexpr->ptr_oprtr_count = 0;
   newexpr->left = nullptr;
   newexpr->right = nullptr;
   newexpr->unary = nullptr;
@@ -0,0 +1,831 @@
+/*
+*  src/unroll.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains loop unroller for counted for-loops over the abstract syntax tree.
+* A loop for(i = a; i op b; step) where a, b are integer literals,
+* step is i++, i--, i += c, i -= c or i = i +/- c and i is an int local
+* not modified in loop body has a constant trip count.
+* If trip count * body cost is small, loop is fully unrolled and
+* each copy of body uses constant value of i.
+* Otherwise body is copied by unroll factor in the loop with
+* step statements between copies, and the remaining iterations
+* are emitted after the loop as copies with constant value of i.
+*/
+
+#include "tree.hpp"
+#include "symtab.hpp"
+#include "convert.hpp"
+#include "stats.hpp"
+#include "inliner.hpp"
+#include "profile.hpp"
+#include "unroll.hpp"
+
+using namespace xlang;
+
+bool xlang::unroller::get_literal(struct primary_expr* pexpr, int* value)
+{
+  if(pexpr == nullptr || pexpr->is_oprtr || pexpr->is_id) return false;
+  switch(pexpr->tok.token){
+    case LIT_DECIMAL :
+    case LIT_OCTAL :
+    case LIT_HEX :
+    case LIT_BIN :
+      *value = xlang::get_decimal(pexpr->tok);
+      return true;
+    default: break;
+  }
+  return false;
+}
+
+bool xlang::unroller::is_index_id(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  return (!pexpr->is_oprtr && pexpr->is_id && pexpr->tok.lexeme == index_name
+          && pexpr->left == nullptr && pexpr->right == nullptr
+          && pexpr->unary_node == nullptr);
+}
+
+bool xlang::unroller::is_index_id(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return false;
+  return (!idexpr->is_oprtr && idexpr->is_id && idexpr->tok.lexeme == index_name
+          && !idexpr->is_subscript && !idexpr->is_ptr
+          && idexpr->left == nullptr && idexpr->right == nullptr
+          && idexpr->unary == nullptr);
+}
+
+bool xlang::unroller::has_index(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  if(pexpr->is_id && pexpr->tok.lexeme == index_name) return true;
+  return has_index(pexpr->left) || has_index(pexpr->right)
+          || has_index(pexpr->unary_node);
+}
+
+bool xlang::unroller::has_index(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return false;
+  if(idexpr->is_id && idexpr->tok.lexeme == index_name) return true;
+  return has_index(idexpr->left) || has_index(idexpr->right)
+          || has_index(idexpr->unary);
+}
+
+//get step value from update expression of for loop
+bool xlang::unroller::get_step(struct expr* exp, int* step)
+{
+  struct id_expr* idexpr = nullptr;
+  struct assgn_expr* assgnexp = nullptr;
+  struct primary_expr* pexpr = nullptr;
+  int value = 0;
+
+  if(exp == nullptr) return false;
+
+  switch(exp->expr_kind){
+    case ID_EXPR :
+      idexpr = exp->id_expression;
+      if(!idexpr->is_oprtr || !is_index_id(idexpr->unary)) return false;
+      if(idexpr->tok.token == INCR_OP){
+        *step = 1;
+        return true;
+      }else if(idexpr->tok.token == DECR_OP){
+        *step = -1;
+        return true;
+      }
+      return false;
+
+    case ASSGN_EXPR :
+      assgnexp = exp->assgn_expression;
+      if(!is_index_id(assgnexp->id_expression) || assgnexp->expression == nullptr
+         || assgnexp->expression->expr_kind != PRIMARY_EXPR)
+        return false;
+      pexpr = assgnexp->expression->primary_expression;
+      switch(assgnexp->tok.token){
+        case ASSGN_ADD :
+          if(!get_literal(pexpr, &value)) return false;
+          *step = value;
+          break;
+        case ASSGN_SUB :
+          if(!get_literal(pexpr, &value)) return false;
+          *step = -value;
+          break;
+        case ASSGN :
+          //i = i + c, i = i - c, i = c + i
+          if(pexpr == nullptr || !pexpr->is_oprtr) return false;
+          if(pexpr->tok.token == ARTHM_ADD){
+            if(is_index_id(pexpr->left) && get_literal(pexpr->right, &value))
+              *step = value;
+            else if(is_index_id(pexpr->right) && get_literal(pexpr->left, &value))
+              *step = value;
+            else
+              return false;
+          }else if(pexpr->tok.token == ARTHM_SUB){
+            if(is_index_id(pexpr->left) && get_literal(pexpr->right, &value))
+              *step = -value;
+            else
+              return false;
+          }else{
+            return false;
+          }
+          break;
+        default :
+          return false;
+      }
+      return *step != 0;
+
+    default: break;
+  }
+  return false;
+}
+
+void xlang::unroller::get_addrof_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && pexpr->tok.token == ADDROF_OP
+     && pexpr->unary_node != nullptr && pexpr->unary_node->is_id)
+    addrof_members.insert(pexpr->unary_node->tok.lexeme);
+  get_addrof_ids(pexpr->left);
+  get_addrof_ids(pexpr->right);
+  get_addrof_ids(pexpr->unary_node);
+}
+
+void xlang::unroller::get_addrof_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && idexpr->tok.token == ADDROF_OP
+     && idexpr->unary != nullptr && idexpr->unary->is_id)
+    addrof_members.insert(idexpr->unary->tok.lexeme);
+  get_addrof_ids(idexpr->left);
+  get_addrof_ids(idexpr->right);
+  get_addrof_ids(idexpr->unary);
+}
+
+void xlang::unroller::get_addrof_ids(struct expr* exp)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_addrof_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_addrof_ids(exp->assgn_expression->id_expression);
+      get_addrof_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_addrof_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_addrof_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        get_addrof_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::unroller::get_addrof_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_addrof_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_addrof_ids(stm->selection_statement->condition);
+        get_addrof_ids(stm->selection_statement->if_statement);
+        get_addrof_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_addrof_ids(iter->_while.condition);
+            get_addrof_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_addrof_ids(iter->_dowhile.condition);
+            get_addrof_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_addrof_ids(iter->_for.init_expression);
+            get_addrof_ids(iter->_for.condition);
+            get_addrof_ids(iter->_for.update_expression);
+            get_addrof_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_addrof_ids(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        for(auto e : stm->asm_statement->output_operand)
+          get_addrof_ids(e->expression);
+        for(auto e : stm->asm_statement->input_operand)
+          get_addrof_ids(e->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+/*
+check expression modifies loop index,
+or uses it in identifier expression where it can not be
+replaced by a constant(only array subscripts can be replaced)
+*/
+bool xlang::unroller::modifies_index(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  if(pexpr->is_oprtr && (pexpr->tok.token == INCR_OP || pexpr->tok.token == DECR_OP
+     || pexpr->tok.token == ADDROF_OP) && has_index(pexpr->unary_node))
+    return true;
+  return modifies_index(pexpr->left) || modifies_index(pexpr->right)
+          || modifies_index(pexpr->unary_node);
+}
+
+bool xlang::unroller::modifies_index(struct expr* exp)
+{
+  if(exp == nullptr) return false;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      return modifies_index(exp->primary_expression);
+    case ASSGN_EXPR :
+      return has_index(exp->assgn_expression->id_expression)
+              || modifies_index(exp->assgn_expression->expression);
+    case CAST_EXPR :
+      return has_index(exp->cast_expression->target);
+    case ID_EXPR :
+      if(is_index_id(exp->id_expression)) return false;
+      return has_index(exp->id_expression);
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list){
+        if(modifies_index(e))
+          return true;
+      }
+      return false;
+    default: break;
+  }
+  return false;
+}
+
+/*
+check loop body can be copied,
+labels, goto and inline assembly would be duplicated,
+break and continue of unrolled loop can not be expressed
+*/
+bool xlang::unroller::is_unrollable(struct stmt* stm, bool in_inner_loop)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        if(modifies_index(stm->expression_statement->expression))
+          return false;
+        break;
+      case SELECT_STMT :
+        if(modifies_index(stm->selection_statement->condition)
+           || !is_unrollable(stm->selection_statement->if_statement, in_inner_loop)
+           || !is_unrollable(stm->selection_statement->else_statement, in_inner_loop))
+          return false;
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            if(modifies_index(iter->_while.condition)
+               || !is_unrollable(iter->_while.statement, true))
+              return false;
+            break;
+          case DOWHILE_STMT :
+            if(modifies_index(iter->_dowhile.condition)
+               || !is_unrollable(iter->_dowhile.statement, true))
+              return false;
+            break;
+          case FOR_STMT :
+            if(modifies_index(iter->_for.init_expression)
+               || modifies_index(iter->_for.condition)
+               || modifies_index(iter->_for.update_expression)
+               || !is_unrollable(iter->_for.statement, true))
+              return false;
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        switch(stm->jump_statement->type){
+          case BREAK_JMP :
+          case CONTINUE_JMP :
+            if(!in_inner_loop) return false;
+            break;
+          case RETURN_JMP :
+            if(modifies_index(stm->jump_statement->expression))
+              return false;
+            break;
+          default :
+            return false;
+        }
+        break;
+      default :
+        return false;
+    }
+    stm = stm->p_next;
+  }
+  return true;
+}
+
+/*
+get start value, step and trip count of for loop
+for(i = start; i op bound; step)
+*/
+bool xlang::unroller::get_trip_count(struct iter_stmt* iter, int* start, int* step, int* trip)
+{
+  struct assgn_expr* init = nullptr;
+  struct primary_expr* cond = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+  long long first = 0, bound = 0, inc = 0, count = 0, last = 0;
+  int value = 0;
+
+  if(iter->_for.init_expression == nullptr || iter->_for.condition == nullptr
+     || iter->_for.update_expression == nullptr)
+    return false;
+
+  if(iter->_for.init_expression->expr_kind != ASSGN_EXPR) return false;
+  init = iter->_for.init_expression->assgn_expression;
+  if(init->tok.token != ASSGN || init->id_expression == nullptr) return false;
+  index_name = init->id_expression->tok.lexeme;
+  if(!is_index_id(init->id_expression)) return false;
+  index_expr = init->id_expression;
+  if(init->expression == nullptr || init->expression->expr_kind != PRIMARY_EXPR
+     || !get_literal(init->expression->primary_expression, &value))
+    return false;
+  first = value;
+
+  //only int locals or parameters, which can not be changed by calls
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, index_name);
+  if(syminfo == nullptr){
+    for(auto fparam : func_symtab->func_info->param_list){
+      if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == index_name){
+        syminfo = fparam->symbol_info;
+        break;
+      }
+    }
+  }
+  if(syminfo == nullptr || syminfo->type_info == nullptr) return false;
+  if(syminfo->is_ptr || syminfo->is_array || syminfo->is_func_ptr
+     || syminfo->type_info->type != SIMPLE_TYPE
+     || syminfo->type_info->type_specifier.simple_type.size() != 1
+     || syminfo->type_info->type_specifier.simple_type[0].token != KEY_INT)
+    return false;
+  if(addrof_members.find(index_name) != addrof_members.end()) return false;
+
+  if(iter->_for.condition->expr_kind != PRIMARY_EXPR) return false;
+  cond = iter->_for.condition->primary_expression;
+  if(cond == nullptr || !cond->is_oprtr || !is_index_id(cond->left)
+     || !get_literal(cond->right, &value))
+    return false;
+  bound = value;
+
+  if(!get_step(iter->_for.update_expression, &value)) return false;
+  inc = value;
+
+  switch(cond->tok.token){
+    case COMP_LESS :
+      if(inc < 0) return false;
+      count = (bound > first) ? (bound - first + inc - 1) / inc : 0;
+      break;
+    case COMP_LESS_EQ :
+      if(inc < 0) return false;
+      count = (bound >= first) ? (bound - first) / inc + 1 : 0;
+      break;
+    case COMP_GREAT :
+      if(inc > 0) return false;
+      count = (first > bound) ? (first - bound - inc - 1) / -inc : 0;
+      break;
+    case COMP_GREAT_EQ :
+      if(inc > 0) return false;
+      count = (first >= bound) ? (first - bound) / -inc + 1 : 0;
+      break;
+    case COMP_NOT_EQ :
+      if((bound - first) % inc != 0 || (bound - first) / inc < 0) return false;
+      count = (bound - first) / inc;
+      break;
+    default :
+      return false;
+  }
+
+  //constant values of index must be non-negative int literals
+  last = first + count * inc;
+  if(count > 0xFFFF || first < 0 || last < 0 || first + (count - 1) * inc < 0
+     || last > 0x7FFFFFFF)
+    return false;
+
+  *start = static_cast<int>(first);
+  *step = static_cast<int>(inc);
+  *trip = static_cast<int>(count);
+  return true;
+}
+
+token xlang::unroller::get_literal_token(token tok, int value)
+{
+  tok.token = LIT_DECIMAL;
+  tok.lexeme = std::to_string(value);
+  return tok;
+}
+
+//clone expression trees, if subst is true then loop index is replaced by value
+struct primary_expr* xlang::unroller::clone_primary_expr(struct primary_expr* pexpr,
+                                                         bool subst, int value)
+{
+  struct primary_expr* newexpr = nullptr;
+  if(pexpr == nullptr) return nullptr;
+
+  newexpr = xlang::tree::get_primary_expr_mem();
+  *newexpr = *pexpr;
+  if(subst && is_index_id(pexpr)){
+    newexpr->tok = get_literal_token(pexpr->tok, value);
+    newexpr->is_id = false;
+    newexpr->id_info = nullptr;
+  }
+  newexpr->left = clone_primary_expr(pexpr->left, subst, value);
+  newexpr->right = clone_primary_expr(pexpr->right, subst, value);
+  newexpr->unary_node = clone_primary_expr(pexpr->unary_node, subst, value);
+  return newexpr;
+}
+
+struct id_expr* xlang::unroller::clone_id_expr(struct id_expr* idexpr,
+                                               bool subst, int value)
+{
+  struct id_expr* newexpr = nullptr;
+  if(idexpr == nullptr) return nullptr;
+
+  newexpr = xlang::tree::get_id_expr_mem();
+  *newexpr = *idexpr;
+  if(subst){
+    for(auto& t : newexpr->subscript){
+      if(t.token == IDENTIFIER && t.lexeme == index_name)
+        t = get_literal_token(t, value);
+    }
+  }
+  newexpr->left = clone_id_expr(idexpr->left, subst, value);
+  newexpr->right = clone_id_expr(idexpr->right, subst, value);
+  newexpr->unary = clone_id_expr(idexpr->unary, subst, value);
+  return newexpr;
+}
+
+struct expr* xlang::unroller::clone_expr(struct expr* exp, bool subst, int value)
+{
+  struct expr* newexpr = nullptr;
+  if(exp == nullptr) return nullptr;
+
+  newexpr = xlang::tree::get_expr_mem();
+  newexpr->expr_kind = exp->expr_kind;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      newexpr->primary_expression =
+                  clone_primary_expr(exp->primary_expression, subst, value);
+      break;
+    case ASSGN_EXPR :
+      newexpr->assgn_expression = xlang::tree::get_assgn_expr_mem();
+      newexpr->assgn_expression->tok = exp->assgn_expression->tok;
+      newexpr->assgn_expression->id_expression =
+                  clone_id_expr(exp->assgn_expression->id_expression, subst, value);
+      newexpr->assgn_expression->expression =
+                  clone_expr(exp->assgn_expression->expression, subst, value);
+      break;
+    case SIZEOF_EXPR :
+      newexpr->sizeof_expression = xlang::tree::get_sizeof_expr_mem();
+      *newexpr->sizeof_expression = *exp->sizeof_expression;
+      break;
+    case CAST_EXPR :
+      newexpr->cast_expression = xlang::tree::get_cast_expr_mem();
+      *newexpr->cast_expression = *exp->cast_expression;
+      newexpr->cast_expression->target =
+                  clone_id_expr(exp->cast_expression->target, subst, value);
+      break;
+    case ID_EXPR :
+      //plain loop index as expression becomes a literal
+      if(subst && is_index_id(exp->id_expression)){
+        newexpr->expr_kind = PRIMARY_EXPR;
+        newexpr->primary_expression = xlang::tree::get_primary_expr_mem();
+        newexpr->primary_expression->tok =
+                  get_literal_token(exp->id_expression->tok, value);
+        newexpr->primary_expression->is_oprtr = false;
+        newexpr->primary_expression->oprtr_kind = UNARY_OP;
+        newexpr->primary_expression->is_id = false;
+      }else{
+        newexpr->id_expression = clone_id_expr(exp->id_expression, subst, value);
+      }
+      break;
+    case FUNC_CALL_EXPR :
+      newexpr->func_call_expression = xlang::tree::get_func_call_expr_mem();
+      newexpr->func_call_expression->function =
+                  clone_id_expr(exp->func_call_expression->function, false, 0);
+      for(auto e : exp->func_call_expression->expression_list)
+        newexpr->func_call_expression->expression_list.push_back(
+                            clone_expr(e, subst, value));
+      break;
+  }
+  return newexpr;
+}
+
+struct stmt* xlang::unroller::clone_statement_list(struct stmt* stm, bool subst, int value)
+{
+  struct stmt* list = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct iter_stmt* iter = nullptr;
+  struct iter_stmt* newiter = nullptr;
+
+  while(stm != nullptr){
+    newstmt = xlang::tree::get_stmt_mem();
+    newstmt->type = stm->type;
+
+    switch(stm->type){
+      case EXPR_STMT :
+        newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+        newstmt->expression_statement->expression =
+                  clone_expr(stm->expression_statement->expression, subst, value);
+        break;
+      case SELECT_STMT :
+        newstmt->selection_statement = xlang::tree::get_select_stmt_mem();
+        newstmt->selection_statement->iftok = stm->selection_statement->iftok;
+        newstmt->selection_statement->elsetok = stm->selection_statement->elsetok;
+        newstmt->selection_statement->condition =
+                  clone_expr(stm->selection_statement->condition, subst, value);
+        newstmt->selection_statement->if_statement =
+                  clone_statement_list(stm->selection_statement->if_statement, subst, value);
+        newstmt->selection_statement->else_statement =
+                  clone_statement_list(stm->selection_statement->else_statement, subst, value);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        newiter = xlang::tree::get_iter_stmt_mem();
+        newiter->type = iter->type;
+        switch(iter->type){
+          case WHILE_STMT :
+            newiter->_while.whiletok = iter->_while.whiletok;
+            newiter->_while.condition = clone_expr(iter->_while.condition, subst, value);
+            newiter->_while.statement =
+                  clone_statement_list(iter->_while.statement, subst, value);
+            break;
+          case DOWHILE_STMT :
+            newiter->_dowhile.dotok = iter->_dowhile.dotok;
+            newiter->_dowhile.whiletok = iter->_dowhile.whiletok;
+            newiter->_dowhile.condition = clone_expr(iter->_dowhile.condition, subst, value);
+            newiter->_dowhile.statement =
+                  clone_statement_list(iter->_dowhile.statement, subst, value);
+            break;
+          case FOR_STMT :
+            newiter->_for.fortok = iter->_for.fortok;
+            newiter->_for.init_expression =
+                  clone_expr(iter->_for.init_expression, subst, value);
+            newiter->_for.condition = clone_expr(iter->_for.condition, subst, value);
+            newiter->_for.update_expression =
+                  clone_expr(iter->_for.update_expression, subst, value);
+            newiter->_for.statement =
+                  clone_statement_list(iter->_for.statement, subst, value);
+            break;
+        }
+        newstmt->iteration_statement = newiter;
+        break;
+      case JUMP_STMT :
+        newstmt->jump_statement = xlang::tree::get_jump_stmt_mem();
+        newstmt->jump_statement->type = stm->jump_statement->type;
+        newstmt->jump_statement->tok = stm->jump_statement->tok;
+        newstmt->jump_statement->goto_id = stm->jump_statement->goto_id;
+        newstmt->jump_statement->expression =
+                  clone_expr(stm->jump_statement->expression, subst, value);
+        break;
+      default: break;
+    }
+    xlang::tree::add_statement(&list, &newstmt);
+    stm = stm->p_next;
+  }
+  return list;
+}
+
+struct stmt* xlang::unroller::get_expr_statement(struct expr* exp)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+  newstmt->type = EXPR_STMT;
+  newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+  newstmt->expression_statement->expression = exp;
+  return newstmt;
+}
+
+//create statement index = value;
+struct stmt* xlang::unroller::get_index_assgn_statement(token tok, int value)
+{
+  struct expr* exp = xlang::tree::get_expr_mem();
+
+  exp->expr_kind = ASSGN_EXPR;
+  exp->assgn_expression = xlang::tree::get_assgn_expr_mem();
+  exp->assgn_expression->tok = tok;
+  exp->assgn_expression->tok.token = ASSGN;
+  exp->assgn_expression->tok.lexeme = "=";
+  exp->assgn_expression->id_expression = clone_id_expr(index_expr, false, 0);
+  exp->assgn_expression->expression = xlang::tree::get_expr_mem();
+  exp->assgn_expression->expression->expr_kind = PRIMARY_EXPR;
+  exp->assgn_expression->expression->primary_expression =
+                                    xlang::tree::get_primary_expr_mem();
+  exp->assgn_expression->expression->primary_expression->tok =
+                                    get_literal_token(tok, value);
+  exp->assgn_expression->expression->primary_expression->is_oprtr = false;
+  exp->assgn_expression->expression->primary_expression->oprtr_kind = UNARY_OP;
+  exp->assgn_expression->expression->primary_expression->is_id = false;
+
+  return get_expr_statement(exp);
+}
+
+/*
+unroll for loop, returns list of statements placed after the loop,
+remove_loop is set when loop is fully unrolled and replaced by that list
+*/
+struct stmt* xlang::unroller::unroll_loop(struct stmt* loop, bool* remove_loop)
+{
+  struct iter_stmt* iter = loop->iteration_statement;
+  struct primary_expr* cond = nullptr;
+  struct stmt* list = nullptr;
+  struct stmt* body = nullptr;
+  struct stmt* newstmt = nullptr;
+  int start = 0, step = 0, trip = 0, cost = 0;
+  int factor = max_factor, groups = 0, rem = 0;
+  long long count;
+
+  *remove_loop = false;
+  if(iter->type != FOR_STMT) return nullptr;
+
+  //loop never executed in profile is not unrolled
+  count = xlang::profile::get_count(iter->_for.fortok.loc.line, "body");
+  if(count == 0 || (hot_only && !xlang::profile::is_hot(count))){
+    xlang::stats::missed("unroll", iter->_for.fortok.loc, "loop is not hot in profile");
+    return nullptr;
+  }
+  if(!get_trip_count(iter, &start, &step, &trip)){
+    xlang::stats::missed("unroll", iter->_for.fortok.loc,
+                         "loop trip count is not a compile-time constant");
+    return nullptr;
+  }
+  if(!is_unrollable(iter->_for.statement, false)){
+    xlang::stats::missed("unroll", iter->_for.fortok.loc,
+                         "loop body has statements that cannot be unrolled");
+    return nullptr;
+  }
+
+  //body and step expression are repeated in each iteration
+  cost = xlang::inliner::statement_cost(iter->_for.statement)
+          + xlang::inliner::expr_cost(iter->_for.update_expression);
+
+  if(trip * cost <= UNROLL_FULL_SIZE){
+    for(int k = 0; k < trip; k++){
+      newstmt = clone_statement_list(iter->_for.statement, true, start + k * step);
+      if(newstmt != nullptr)
+        xlang::tree::add_statement(&list, &newstmt);
+    }
+    newstmt = get_index_assgn_statement(iter->_for.fortok, start + trip * step);
+    xlang::tree::add_statement(&list, &newstmt);
+    *remove_loop = true;
+    xlang::stats::count("unroll.fully-unrolled-loops");
+    xlang::stats::remark("unroll", iter->_for.fortok.loc,
+                         "loop fully unrolled "+std::to_string(trip)+" times");
+    return list;
+  }
+
+  while(factor > 1 && factor * cost > UNROLL_PARTIAL_SIZE)
+    factor--;
+  if(factor < 2 || trip < factor){
+    xlang::stats::missed("unroll", iter->_for.fortok.loc,
+                         "loop body cost "+std::to_string(cost)+" is too large to unroll");
+    return nullptr;
+  }
+  groups = trip / factor;
+  rem = trip % factor;
+
+  //body; step; body; step; ... body;
+  for(int k = 0; k < factor; k++){
+    newstmt = clone_statement_list(iter->_for.statement, false, 0);
+    if(newstmt != nullptr)
+      xlang::tree::add_statement(&body, &newstmt);
+    if(k < factor - 1){
+      newstmt = get_expr_statement(clone_expr(iter->_for.update_expression, false, 0));
+      xlang::tree::add_statement(&body, &newstmt);
+    }
+  }
+
+  //remaining iterations after the loop with constant index
+  for(int k = groups * factor; k < trip; k++){
+    newstmt = clone_statement_list(iter->_for.statement, true, start + k * step);
+    if(newstmt != nullptr)
+      xlang::tree::add_statement(&list, &newstmt);
+  }
+  if(rem > 0){
+    newstmt = get_index_assgn_statement(iter->_for.fortok, start + trip * step);
+    xlang::tree::add_statement(&list, &newstmt);
+  }
+
+  xlang::tree::delete_stmt(&iter->_for.statement);
+  iter->_for.statement = body;
+
+  //loop runs groups * factor iterations
+  cond = iter->_for.condition->primary_expression;
+  cond->right->tok = get_literal_token(cond->right->tok,
+                                       start + groups * factor * step);
+  if(step > 0){
+    cond->tok.token = COMP_LESS;
+    cond->tok.lexeme = "<";
+  }else{
+    cond->tok.token = COMP_GREAT;
+    cond->tok.lexeme = ">";
+  }
+  xlang::stats::count("unroll.partially-unrolled-loops");
+  xlang::stats::remark("unroll", iter->_for.fortok.loc,
+                       "loop unrolled by factor "+std::to_string(factor));
+  return list;
+}
+
+void xlang::unroller::unroll_statement_list(struct stmt** head)
+{
+  struct stmt* stm = *head;
+  struct stmt* next = nullptr;
+  struct stmt* list = nullptr;
+  struct stmt* tail = nullptr;
+  struct iter_stmt* iter = nullptr;
+  bool remove_loop = false;
+
+  while(stm != nullptr){
+    next = stm->p_next;
+    switch(stm->type){
+      case SELECT_STMT :
+        unroll_statement_list(&stm->selection_statement->if_statement);
+        unroll_statement_list(&stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        //inner loops first
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            unroll_statement_list(&iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            unroll_statement_list(&iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            unroll_statement_list(&iter->_for.statement);
+            break;
+        }
+        list = unroll_loop(stm, &remove_loop);
+        if(list == nullptr && !remove_loop) break;
+
+        if(list != nullptr){
+          tail = list;
+          while(tail->p_next != nullptr)
+            tail = tail->p_next;
+          tail->p_next = stm->p_next;
+          if(stm->p_next != nullptr)
+            stm->p_next->p_prev = tail;
+          list->p_prev = stm;
+          stm->p_next = list;
+        }
+        if(remove_loop){
+          if(stm->p_prev != nullptr)
+            stm->p_prev->p_next = stm->p_next;
+          else
+            *head = stm->p_next;
+          if(stm->p_next != nullptr)
+            stm->p_next->p_prev = stm->p_prev;
+          stm->p_next = nullptr;
+          stm->p_prev = nullptr;
+          xlang::tree::delete_stmt(&stm);
+        }
+        break;
+      default: break;
+    }
+    stm = next;
+  }
+}
+
+void xlang::unroller::unroll_loops(struct tree_node** tr)
+{
+  struct tree_node* trhead = *tr;
+
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr){
+      func_symtab = trhead->symtab;
+      xlang::stats::set_function(func_symtab->func_info->func_name);
+      addrof_members.clear();
+      get_addrof_ids(trhead->statement);
+      unroll_statement_list(&trhead->statement);
+    }
+    trhead = trhead->p_next;
+  }
+  func_symtab = nullptr;
+}
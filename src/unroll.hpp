@@ -0,0 +1,76 @@
+/*
+*  src/unroll.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in unroll.cpp file by class unroller.
+*/
+
+#ifndef UNROLL_HPP
+#define UNROLL_HPP
+
+#include <string>
+#include <unordered_set>
+#include "token.hpp"
+#include "types.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+//maximum cost of fully unrolled loop
+#define UNROLL_FULL_SIZE 64
+//maximum cost of partially unrolled loop body
+#define UNROLL_PARTIAL_SIZE 96
+
+namespace xlang{
+
+class unroller
+{
+public:
+  unroller(int factor, bool hot) : max_factor(factor), hot_only(hot){}
+  void unroll_loops(struct tree_node**);
+
+private:
+  //maximum number of body copies in partially unrolled loop
+  int max_factor;
+  //unroll only loops which are hot in -fprofile-use profile
+  bool hot_only;
+
+  struct st_node* func_symtab = nullptr;
+  //locals whose address is taken in function
+  std::unordered_set<std::string> addrof_members;
+
+  //state of currently unrolled loop
+  std::string index_name;
+  struct id_expr* index_expr = nullptr;
+
+  bool get_literal(struct primary_expr*, int*);
+  bool is_index_id(struct primary_expr*);
+  bool is_index_id(struct id_expr*);
+  bool has_index(struct primary_expr*);
+  bool has_index(struct id_expr*);
+  bool get_step(struct expr*, int*);
+  void get_addrof_ids(struct primary_expr*);
+  void get_addrof_ids(struct id_expr*);
+  void get_addrof_ids(struct expr*);
+  void get_addrof_ids(struct stmt*);
+  bool modifies_index(struct primary_expr*);
+  bool modifies_index(struct expr*);
+  bool is_unrollable(struct stmt*, bool);
+  bool get_trip_count(struct iter_stmt*, int*, int*, int*);
+
+  token get_literal_token(token, int);
+  struct primary_expr* clone_primary_expr(struct primary_expr*, bool, int);
+  struct id_expr* clone_id_expr(struct id_expr*, bool, int);
+  struct expr* clone_expr(struct expr*, bool, int);
+  struct stmt* clone_statement_list(struct stmt*, bool, int);
+  struct stmt* get_expr_statement(struct expr*);
+  struct stmt* get_index_assgn_statement(token, int);
+  struct stmt* unroll_loop(struct stmt*, bool*);
+  void unroll_statement_list(struct stmt**);
+};
+
+}
+
+#endif
+
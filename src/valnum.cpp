@@ -0,0 +1,727 @@
+/*
+*  src/valnum.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains common subexpression elimination by hash-based value numbering
+* over the abstract syntax tree.
+* Statements of a function are walked in order, each int variable has a value
+* number which changes when variable is assigned, and each int expression
+* gets value number from hash table keyed by its operator and value numbers
+* of its operands, so equal numbers mean equal values.
+* An expression whose value is already available is replaced by variable
+* holding it(x = a + b; y = a + b; becomes y = x;), or by a temporary
+* assigned before the statement of its first occurrence, when it is
+* repeated inside larger expressions.
+* Values flow from a statement list into the if/else branches it dominates,
+* loop bodies start with no available values because of back edges,
+* and after if/else or loop, variables changed inside get new numbers.
+* Calls and writes through pointers, arrays or records change globals and
+* locals whose address is taken, labels and inline assembly change everything.
+*/
+
+#include "tree.hpp"
+#include "symtab.hpp"
+#include "parser.hpp"
+#include "convert.hpp"
+#include "stats.hpp"
+#include "valnum.hpp"
+
+using namespace xlang;
+
+//search symbol in function symbol table, parameters and global symbol table
+struct st_symbol_info* xlang::valnum::search_id(std::string name)
+{
+  struct st_symbol_info* syminfo = nullptr;
+
+  syminfo = xlang::symtable::search_symbol_node(func_symtab, name);
+  if(syminfo != nullptr) return syminfo;
+  for(auto fparam : func_symtab->func_info->param_list){
+    if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name)
+      return fparam->symbol_info;
+  }
+  return xlang::symtable::search_symbol_node(xlang::global_symtab, name);
+}
+
+bool xlang::valnum::is_int_symbol(struct st_symbol_info* syminfo)
+{
+  if(syminfo == nullptr || syminfo->type_info == nullptr) return false;
+  if(syminfo->is_ptr || syminfo->is_array || syminfo->is_func_ptr)
+    return false;
+  return (syminfo->type_info->type == SIMPLE_TYPE
+          && syminfo->type_info->type_specifier.simple_type.size() == 1
+          && syminfo->type_info->type_specifier.simple_type[0].token == KEY_INT);
+}
+
+//local or parameter, which can not be changed by calls or pointer writes
+bool xlang::valnum::is_local(std::string name)
+{
+  bool found = false;
+
+  if(xlang::symtable::search_symbol_node(func_symtab, name) != nullptr){
+    found = true;
+  }else{
+    for(auto fparam : func_symtab->func_info->param_list){
+      if(fparam->symbol_info != nullptr && fparam->symbol_info->symbol == name){
+        found = true;
+        break;
+      }
+    }
+  }
+  return (found && addrof_members.find(name) == addrof_members.end());
+}
+
+void xlang::valnum::get_addrof_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && pexpr->tok.token == ADDROF_OP
+     && pexpr->unary_node != nullptr && pexpr->unary_node->is_id)
+    addrof_members.insert(pexpr->unary_node->tok.lexeme);
+  get_addrof_ids(pexpr->left);
+  get_addrof_ids(pexpr->right);
+  get_addrof_ids(pexpr->unary_node);
+}
+
+void xlang::valnum::get_addrof_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && idexpr->tok.token == ADDROF_OP
+     && idexpr->unary != nullptr && idexpr->unary->is_id)
+    addrof_members.insert(idexpr->unary->tok.lexeme);
+  get_addrof_ids(idexpr->left);
+  get_addrof_ids(idexpr->right);
+  get_addrof_ids(idexpr->unary);
+}
+
+void xlang::valnum::get_addrof_ids(struct expr* exp)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_addrof_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_addrof_ids(exp->assgn_expression->id_expression);
+      get_addrof_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_addrof_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_addrof_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        get_addrof_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::valnum::get_addrof_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_addrof_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_addrof_ids(stm->selection_statement->condition);
+        get_addrof_ids(stm->selection_statement->if_statement);
+        get_addrof_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_addrof_ids(iter->_while.condition);
+            get_addrof_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_addrof_ids(iter->_dowhile.condition);
+            get_addrof_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_addrof_ids(iter->_for.init_expression);
+            get_addrof_ids(iter->_for.condition);
+            get_addrof_ids(iter->_for.update_expression);
+            get_addrof_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_addrof_ids(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        for(auto e : stm->asm_statement->output_operand)
+          get_addrof_ids(e->expression);
+        for(auto e : stm->asm_statement->input_operand)
+          get_addrof_ids(e->expression);
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+//loop body of only assignments may be taken by loop vectorizer
+bool xlang::valnum::is_vector_candidate(struct stmt* stm)
+{
+  while(stm != nullptr){
+    if(stm->type != EXPR_STMT || stm->expression_statement->expression == nullptr
+       || stm->expression_statement->expression->expr_kind != ASSGN_EXPR)
+      return false;
+    stm = stm->p_next;
+  }
+  return true;
+}
+
+int xlang::valnum::new_value()
+{
+  return value_count++;
+}
+
+//current value number of variable, new one if variable is not numbered yet
+int xlang::valnum::get_variable_value(std::string name)
+{
+  auto it = state.variables.find(name);
+  if(it != state.variables.end())
+    return it->second;
+  state.variables[name] = new_value();
+  return state.variables[name];
+}
+
+//value number of expression key from hash table, new one if key is not found
+int xlang::valnum::get_expr_value(std::string key)
+{
+  auto it = state.expressions.find(key);
+  if(it != state.expressions.end())
+    return it->second;
+  state.expressions[key] = new_value();
+  return state.expressions[key];
+}
+
+//returns true if expression has ++ or --
+bool xlang::valnum::has_modification(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return false;
+  if(pexpr->is_oprtr && (pexpr->tok.token == INCR_OP || pexpr->tok.token == DECR_OP))
+    return true;
+  return (has_modification(pexpr->left) || has_modification(pexpr->right)
+          || has_modification(pexpr->unary_node));
+}
+
+/*
+get value numbers of all int nodes of primary expression into numbers,
+returns value number of pexpr, or -1 if it is not an int expression
+of binary arithmetic/bitwise operators, int variables and literals
+*/
+int xlang::valnum::number_primary_expr(struct primary_expr* pexpr,
+                          std::unordered_map<struct primary_expr*, int>& numbers)
+{
+  int left = 0, right = 0, value = 0;
+
+  if(pexpr == nullptr) return -1;
+
+  if(!pexpr->is_oprtr){
+    if(pexpr->is_id){
+      if(!is_int_symbol(search_id(pexpr->tok.lexeme))) return -1;
+      value = get_variable_value(pexpr->tok.lexeme);
+    }else{
+      switch(pexpr->tok.token){
+        case LIT_DECIMAL :
+        case LIT_OCTAL :
+        case LIT_HEX :
+        case LIT_BIN :
+          value = get_expr_value("#" + std::to_string(xlang::get_decimal(pexpr->tok)));
+          break;
+        default: return -1;
+      }
+    }
+    numbers[pexpr] = value;
+    return value;
+  }
+
+  left = number_primary_expr(pexpr->left, numbers);
+  right = number_primary_expr(pexpr->right, numbers);
+  number_primary_expr(pexpr->unary_node, numbers);
+  if(pexpr->oprtr_kind != BINARY_OP || left < 0 || right < 0)
+    return -1;
+
+  switch(pexpr->tok.token){
+    //commutative operators, operands are ordered by value number
+    case ARTHM_ADD :
+    case ARTHM_MUL :
+    case BIT_AND :
+    case BIT_OR :
+    case BIT_EXOR :
+      if(left > right) std::swap(left, right);
+      break;
+    case ARTHM_SUB :
+    case ARTHM_DIV :
+    case ARTHM_MOD :
+    case BIT_LSHIFT :
+    case BIT_RSHIFT :
+      break;
+    default: return -1;
+  }
+
+  value = get_expr_value(std::to_string(pexpr->tok.token) + " "
+                         + std::to_string(left) + " " + std::to_string(right));
+  numbers[pexpr] = value;
+  return value;
+}
+
+void xlang::valnum::kill_variable(std::string name)
+{
+  state.variables[name] = new_value();
+}
+
+//globals and locals whose address is taken may be changed by calls and pointer writes
+void xlang::valnum::kill_memory()
+{
+  for(auto& var : state.variables){
+    if(!is_local(var.first))
+      var.second = new_value();
+  }
+}
+
+void xlang::valnum::kill_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_id)
+    kill_variable(idexpr->tok.lexeme);
+  kill_ids(idexpr->left);
+  kill_ids(idexpr->right);
+  kill_ids(idexpr->unary);
+}
+
+void xlang::valnum::kill_primary_expr(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_oprtr && (pexpr->tok.token == INCR_OP || pexpr->tok.token == DECR_OP)
+     && pexpr->unary_node != nullptr && pexpr->unary_node->is_id)
+    kill_variable(pexpr->unary_node->tok.lexeme);
+  kill_primary_expr(pexpr->left);
+  kill_primary_expr(pexpr->right);
+  kill_primary_expr(pexpr->unary_node);
+}
+
+void xlang::valnum::kill_id_expr(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_oprtr && (idexpr->tok.token == INCR_OP || idexpr->tok.token == DECR_OP)){
+    kill_ids(idexpr->unary);
+    kill_memory();
+  }
+  kill_id_expr(idexpr->left);
+  kill_id_expr(idexpr->right);
+  kill_id_expr(idexpr->unary);
+}
+
+//give new value numbers to variables changed by expression
+void xlang::valnum::kill_expression(struct expr* exp)
+{
+  struct id_expr* left = nullptr;
+
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      kill_primary_expr(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      kill_expression(exp->assgn_expression->expression);
+      left = exp->assgn_expression->id_expression;
+      if(left == nullptr) break;
+      kill_id_expr(left);
+      if(!left->is_oprtr && left->is_id && !left->is_subscript && !left->is_ptr
+         && left->left == nullptr && left->right == nullptr && left->unary == nullptr)
+        kill_variable(left->tok.lexeme);
+      else
+        kill_memory();
+      break;
+    case CAST_EXPR :
+      kill_id_expr(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      kill_id_expr(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      for(auto e : exp->func_call_expression->expression_list)
+        kill_expression(e);
+      kill_memory();
+      break;
+    default: break;
+  }
+}
+
+//give new value numbers to variables whose numbers are different in other state
+void xlang::valnum::kill_changed(struct vn_state& other)
+{
+  for(auto& var : state.variables){
+    auto it = other.variables.find(var.first);
+    if(it == other.variables.end() || it->second != var.second)
+      var.second = new_value();
+  }
+}
+
+int xlang::valnum::count_operators(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr || !pexpr->is_oprtr) return 0;
+  return 1 + count_operators(pexpr->left) + count_operators(pexpr->right);
+}
+
+//get first identifier node of expression
+struct primary_expr* xlang::valnum::get_id(struct primary_expr* pexpr)
+{
+  struct primary_expr* id = nullptr;
+
+  if(pexpr == nullptr) return nullptr;
+  if(!pexpr->is_oprtr)
+    return (pexpr->is_id) ? pexpr : nullptr;
+  id = get_id(pexpr->left);
+  if(id == nullptr)
+    id = get_id(pexpr->right);
+  return id;
+}
+
+//create int temporary having type of int variable of expression
+struct st_symbol_info* xlang::valnum::get_temp_symbol(struct primary_expr* pexpr)
+{
+  struct st_symbol_info* idsym = search_id(get_id(pexpr)->tok.lexeme);
+  struct st_symbol_info* syminfo = nullptr;
+  std::string name;
+
+  name = "_vn" + std::to_string(++temp_count);
+  xlang::symtable::insert_symbol(&func_symtab, name);
+  syminfo = xlang::last_symbol;
+  syminfo->symbol = name;
+  syminfo->tok = idsym->tok;
+  syminfo->tok.lexeme = name;
+  syminfo->type_info = idsym->type_info;
+  syminfo->is_ptr = false;
+  syminfo->ptr_oprtr_count = 0;
+  syminfo->is_array = false;
+  syminfo->is_func_ptr = false;
+  syminfo->ret_ptr_count = 0;
+  return syminfo;
+}
+
+struct primary_expr* xlang::valnum::get_id_leaf(token tok, struct st_symbol_info* syminfo)
+{
+  struct primary_expr* leaf = xlang::tree::get_primary_expr_mem();
+  leaf->tok = tok;
+  leaf->tok.token = IDENTIFIER;
+  leaf->tok.lexeme = syminfo->symbol;
+  leaf->is_oprtr = false;
+  leaf->oprtr_kind = UNARY_OP;
+  leaf->is_id = true;
+  leaf->id_info = syminfo;
+  return leaf;
+}
+
+//create statement temp = pexpr;
+struct stmt* xlang::valnum::get_assgn_statement(token tok, struct st_symbol_info* syminfo,
+                                                struct primary_expr* pexpr)
+{
+  struct stmt* newstmt = xlang::tree::get_stmt_mem();
+  struct expr* exp = xlang::tree::get_expr_mem();
+  struct id_expr* left = xlang::tree::get_id_expr_mem();
+
+  left->tok = tok;
+  left->tok.token = IDENTIFIER;
+  left->tok.lexeme = syminfo->symbol;
+  left->is_id = true;
+  left->id_info = syminfo;
+
+  exp->expr_kind = ASSGN_EXPR;
+  exp->assgn_expression = xlang::tree::get_assgn_expr_mem();
+  exp->assgn_expression->tok = tok;
+  exp->assgn_expression->tok.token = ASSGN;
+  exp->assgn_expression->tok.lexeme = "=";
+  exp->assgn_expression->id_expression = left;
+  exp->assgn_expression->expression = xlang::tree::get_expr_mem();
+  exp->assgn_expression->expression->expr_kind = PRIMARY_EXPR;
+  exp->assgn_expression->expression->primary_expression = pexpr;
+
+  newstmt->type = EXPR_STMT;
+  newstmt->expression_statement = xlang::tree::get_expr_stmt_mem();
+  newstmt->expression_statement->expression = exp;
+  return newstmt;
+}
+
+//first occurrences inside expression moved to statement stm
+void xlang::valnum::move_occurrences(struct primary_expr* pexpr, struct stmt* stm)
+{
+  if(pexpr == nullptr) return;
+  auto it = occurrences.find(pexpr);
+  if(it != occurrences.end())
+    values[it->second].statement = stm;
+  move_occurrences(pexpr->left, stm);
+  move_occurrences(pexpr->right, stm);
+  move_occurrences(pexpr->unary_node, stm);
+}
+
+/*
+get variable holding available value number of pexpr,
+if value is only at its first occurrence and expression is worth to be kept,
+then first occurrence is moved into new temporary
+*/
+struct st_symbol_info* xlang::valnum::get_holder(int value, struct primary_expr* pexpr)
+{
+  struct primary_expr* first = nullptr;
+  struct stmt* newstmt = nullptr;
+  struct stmt* stm = nullptr;
+  int index = 0;
+
+  auto it = state.available.find(value);
+  if(it == state.available.end()) return nullptr;
+  index = it->second;
+
+  if(values[index].holder != nullptr){
+    if(values[index].is_temp
+       || get_variable_value(values[index].holder->symbol) == value)
+      return values[index].holder;
+    state.available.erase(it);
+    return nullptr;
+  }
+
+  //one operator is cheaper to compute again than to keep in memory
+  if(count_operators(pexpr) < 2 && pexpr->tok.token != ARTHM_MUL
+     && pexpr->tok.token != ARTHM_DIV && pexpr->tok.token != ARTHM_MOD)
+    return nullptr;
+  if(get_id(pexpr) == nullptr) return nullptr;
+
+  first = *values[index].node;
+  values[index].holder = get_temp_symbol(first);
+  values[index].is_temp = true;
+  newstmt = get_assgn_statement(first->tok, values[index].holder, first);
+  *values[index].node = get_id_leaf(first->tok, values[index].holder);
+  values[index].node = nullptr;
+
+  //insert temp = expression before statement of first occurrence
+  stm = values[index].statement;
+  newstmt->p_prev = stm->p_prev;
+  if(stm->p_prev != nullptr)
+    stm->p_prev->p_next = newstmt;
+  else
+    *values[index].head = newstmt;
+  newstmt->p_next = stm;
+  stm->p_prev = newstmt;
+
+  move_occurrences(first, newstmt);
+  xlang::stats::count("valnum.temporaries");
+  return values[index].holder;
+}
+
+/*
+replace expressions whose values are available by their holder variables
+from top of tree, otherwise record them as first occurrences,
+operands of && and || are not always evaluated, so they are not recorded
+*/
+void xlang::valnum::replace_primary_expr(struct primary_expr** pexpr, struct stmt* stm,
+                      struct stmt** head, std::unordered_map<struct primary_expr*, int>& numbers,
+                      bool record)
+{
+  struct primary_expr* pexp = *pexpr;
+  struct st_symbol_info* holder = nullptr;
+  struct vn_value val;
+
+  if(pexp == nullptr || !pexp->is_oprtr) return;
+
+  auto it = numbers.find(pexp);
+  if(it != numbers.end()){
+    holder = get_holder(it->second, pexp);
+    if(holder != nullptr){
+      *pexpr = get_id_leaf(pexp->tok, holder);
+      xlang::stats::count("valnum.replaced-expressions");
+      xlang::stats::remark("cse", pexp->tok.loc, "common subexpression replaced by "
+                           +holder->symbol);
+      xlang::tree::delete_primary_expr(&pexp);
+      return;
+    }
+    if(record && state.available.find(it->second) == state.available.end()){
+      val.holder = nullptr;
+      val.is_temp = false;
+      val.statement = stm;
+      val.head = head;
+      val.node = pexpr;
+      values.push_back(val);
+      state.available[it->second] = values.size() - 1;
+      occurrences[pexp] = values.size() - 1;
+    }
+  }
+
+  if(pexp->tok.token == LOG_AND || pexp->tok.token == LOG_OR)
+    record = false;
+  replace_primary_expr(&pexp->left, stm, head, numbers, record);
+  replace_primary_expr(&pexp->right, stm, head, numbers, record);
+  replace_primary_expr(&pexp->unary_node, stm, head, numbers, record);
+}
+
+//number expression of statement stm, returns its value number or -1
+int xlang::valnum::number_expression(struct primary_expr** pexpr, struct stmt* stm,
+                                     struct stmt** head)
+{
+  std::unordered_map<struct primary_expr*, int> numbers;
+  int value = -1;
+
+  if(*pexpr == nullptr || has_modification(*pexpr)) return -1;
+
+  value = number_primary_expr(*pexpr, numbers);
+  if(!numbering_only)
+    replace_primary_expr(pexpr, stm, head, numbers, true);
+  return value;
+}
+
+void xlang::valnum::number_expression_statement(struct stmt* stm, struct stmt** head)
+{
+  struct expr* exp = stm->expression_statement->expression;
+  struct assgn_expr* assgn = nullptr;
+  struct id_expr* left = nullptr;
+  struct st_symbol_info* syminfo = nullptr;
+  struct vn_value val;
+  int value = -1;
+
+  if(exp == nullptr) return;
+  if(exp->expr_kind != ASSGN_EXPR){
+    if(exp->expr_kind == PRIMARY_EXPR)
+      number_expression(&exp->primary_expression, stm, head);
+    kill_expression(exp);
+    return;
+  }
+
+  assgn = exp->assgn_expression;
+  if(assgn->expression != nullptr && assgn->expression->expr_kind == PRIMARY_EXPR)
+    value = number_expression(&assgn->expression->primary_expression, stm, head);
+  kill_expression(exp);
+
+  //x = expression; x holds value of expression
+  left = assgn->id_expression;
+  if(value < 0 || assgn->tok.token != ASSGN || left == nullptr || left->is_oprtr
+     || !left->is_id || left->is_subscript || left->is_ptr)
+    return;
+  syminfo = search_id(left->tok.lexeme);
+  if(!is_int_symbol(syminfo)) return;
+
+  state.variables[left->tok.lexeme] = value;
+  //keep temporary or other variable which still holds value
+  auto it = state.available.find(value);
+  if(it != state.available.end() && values[it->second].holder != nullptr
+     && (values[it->second].is_temp
+         || get_variable_value(values[it->second].holder->symbol) == value))
+    return;
+  val.holder = syminfo;
+  val.is_temp = false;
+  val.statement = nullptr;
+  val.head = nullptr;
+  val.node = nullptr;
+  values.push_back(val);
+  state.available[value] = values.size() - 1;
+}
+
+void xlang::valnum::number_statement_list(struct stmt** head)
+{
+  struct stmt* stm = *head;
+  struct select_stmt* select = nullptr;
+  struct iter_stmt* iter = nullptr;
+  struct vn_state before, branch;
+  bool numbering = numbering_only;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        number_expression_statement(stm, head);
+        break;
+
+      case SELECT_STMT :
+        select = stm->selection_statement;
+        if(select->condition != nullptr && select->condition->expr_kind == PRIMARY_EXPR)
+          number_expression(&select->condition->primary_expression, stm, head);
+        kill_expression(select->condition);
+        before = state;
+        number_statement_list(&select->if_statement);
+        branch = state;
+        state = before;
+        number_statement_list(&select->else_statement);
+        kill_changed(branch);
+        branch = state;
+        state = before;
+        kill_changed(branch);
+        break;
+
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        if(iter->type == FOR_STMT)
+          kill_expression(iter->_for.init_expression);
+        //values of previous iteration are not known at start of loop body
+        before = state;
+        state.available.clear();
+        switch(iter->type){
+          case WHILE_STMT :
+            kill_expression(iter->_while.condition);
+            number_statement_list(&iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            number_statement_list(&iter->_dowhile.statement);
+            kill_expression(iter->_dowhile.condition);
+            break;
+          case FOR_STMT :
+            kill_expression(iter->_for.condition);
+            if(keep_vector_loops && is_vector_candidate(iter->_for.statement))
+              numbering_only = true;
+            number_statement_list(&iter->_for.statement);
+            numbering_only = numbering;
+            kill_expression(iter->_for.update_expression);
+            break;
+        }
+        branch = state;
+        state = before;
+        kill_changed(branch);
+        break;
+
+      case JUMP_STMT :
+        if(stm->jump_statement->expression != nullptr
+           && stm->jump_statement->expression->expr_kind == PRIMARY_EXPR)
+          number_expression(&stm->jump_statement->expression->primary_expression,
+                            stm, head);
+        kill_expression(stm->jump_statement->expression);
+        break;
+
+      //label can be reached from any goto, assembly can change anything
+      case LABEL_STMT :
+      case ASM_STMT :
+        state.variables.clear();
+        state.available.clear();
+        break;
+
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+void xlang::valnum::number_values(struct tree_node** tr)
+{
+  struct tree_node* trhead = *tr;
+
+  while(trhead != nullptr){
+    if(trhead->symtab != nullptr && trhead->symtab->func_info != nullptr){
+      func_symtab = trhead->symtab;
+      xlang::stats::set_function(func_symtab->func_info->func_name);
+      addrof_members.clear();
+      get_addrof_ids(trhead->statement);
+      values.clear();
+      occurrences.clear();
+      state = vn_state();
+      number_statement_list(&trhead->statement);
+    }
+    trhead = trhead->p_next;
+  }
+  func_symtab = nullptr;
+}
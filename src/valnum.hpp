@@ -0,0 +1,113 @@
+/*
+*  src/valnum.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in valnum.cpp file by class valnum.
+*/
+
+#ifndef VALNUM_HPP
+#define VALNUM_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include "token.hpp"
+#include "types.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+namespace xlang{
+
+//value of expression, kept in holder variable or at its first occurrence
+struct vn_value
+{
+  struct st_symbol_info* holder;  //nullptr if value is not kept in any variable
+  bool is_temp;       //holder is temporary, which is never assigned again
+  struct stmt* statement;   //statement of first occurrence
+  struct stmt** head;       //statement list of that statement
+  struct primary_expr** node; //first occurrence in expression tree
+};
+
+//value numbers known at a point of function
+struct vn_state
+{
+  //variable name, its current value number
+  std::unordered_map<std::string, int> variables;
+  //operator and value numbers of operands, value number of expression
+  std::unordered_map<std::string, int> expressions;
+  //value number, index of its value in values
+  std::unordered_map<int, int> available;
+};
+
+class valnum
+{
+public:
+  //vectorizer candidates are not rewritten when keep_vector_loops is set
+  valnum(bool keep_vector) : keep_vector_loops(keep_vector){}
+  void number_values(struct tree_node**);
+
+private:
+  bool keep_vector_loops;
+  //count of created temporaries, used for unique names
+  unsigned temp_count = 0;
+  int value_count = 0;
+
+  //function whose statements are numbered
+  struct st_node* func_symtab = nullptr;
+  //locals whose address is taken in function
+  std::unordered_set<std::string> addrof_members;
+
+  std::vector<struct vn_value> values;
+  //first occurrence node, index of its value
+  std::unordered_map<struct primary_expr*, int> occurrences;
+  struct vn_state state;
+  //number and kill only, without changing statements
+  bool numbering_only = false;
+
+  struct st_symbol_info* search_id(std::string);
+  bool is_int_symbol(struct st_symbol_info*);
+  bool is_local(std::string);
+
+  void get_addrof_ids(struct primary_expr*);
+  void get_addrof_ids(struct id_expr*);
+  void get_addrof_ids(struct expr*);
+  void get_addrof_ids(struct stmt*);
+  bool is_vector_candidate(struct stmt*);
+
+  int new_value();
+  int get_variable_value(std::string);
+  int get_expr_value(std::string);
+  bool has_modification(struct primary_expr*);
+  int number_primary_expr(struct primary_expr*,
+                          std::unordered_map<struct primary_expr*, int>&);
+
+  void kill_variable(std::string);
+  void kill_memory();
+  void kill_ids(struct id_expr*);
+  void kill_primary_expr(struct primary_expr*);
+  void kill_id_expr(struct id_expr*);
+  void kill_expression(struct expr*);
+  void kill_changed(struct vn_state&);
+
+  int count_operators(struct primary_expr*);
+  struct primary_expr* get_id(struct primary_expr*);
+  struct st_symbol_info* get_temp_symbol(struct primary_expr*);
+  struct primary_expr* get_id_leaf(token, struct st_symbol_info*);
+  struct stmt* get_assgn_statement(token, struct st_symbol_info*, struct primary_expr*);
+  void move_occurrences(struct primary_expr*, struct stmt*);
+  struct st_symbol_info* get_holder(int, struct primary_expr*);
+
+  void replace_primary_expr(struct primary_expr**, struct stmt*, struct stmt**,
+                            std::unordered_map<struct primary_expr*, int>&, bool);
+  int number_expression(struct primary_expr**, struct stmt*, struct stmt**);
+  void number_expression_statement(struct stmt*, struct stmt**);
+  void number_statement_list(struct stmt**);
+};
+
+}
+
+#endif
+
@@ -0,0 +1,1734 @@
+/*
+*  src/vm.cpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Bytecode virtual machine used by --run option.
+* Analyzed tree is lowered into register based bytecode of each function,
+* temporaries of expressions are kept in registers of function,
+* variables are kept in memory of frame or in global memory
+* so that their address can be taken and passed to C functions.
+* Bytecode is executed by threaded dispatch,
+* each instruction contains address of its handler in interpreter
+* and each handler jumps directly to handler of next instruction.
+* extern functions are called through table of C library functions.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <climits>
+#include <algorithm>
+#include "vm.hpp"
+#include "error.hpp"
+#include "convert.hpp"
+#include "lex.hpp"
+#include "parser.hpp"
+
+/*
+C library functions callable from program,
+values are converted according to types of arguments
+*/
+
+static long long int_arg(const xlang::vm_value* args, const char* types, int count, int i)
+{
+  if(i >= count) return 0;
+  if(types[i] == 'f' || types[i] == 's') return static_cast<long long>(args[i].f);
+  return args[i].i;
+}
+
+static double float_arg(const xlang::vm_value* args, const char* types, int count, int i)
+{
+  if(i >= count) return 0.0;
+  if(types[i] == 'f' || types[i] == 's') return args[i].f;
+  return static_cast<double>(args[i].i);
+}
+
+static void* ptr_arg(const xlang::vm_value* args, const char* types, int count, int i)
+{
+  return reinterpret_cast<void*>(int_arg(args, types, count, i));
+}
+
+static xlang::vm_value int_result(long long value)
+{
+  xlang::vm_value v;
+  v.i = value;
+  return v;
+}
+
+static xlang::vm_value float_result(double value)
+{
+  xlang::vm_value v;
+  v.f = value;
+  return v;
+}
+
+//format one conversion with snprintf and append it to out
+template <typename type>
+static void format_value(std::string& out, std::string spec, type value)
+{
+  int len = std::snprintf(nullptr, 0, spec.c_str(), value);
+  if(len <= 0) return;
+  std::vector<char> buffer(len + 1);
+  std::snprintf(buffer.data(), buffer.size(), spec.c_str(), value);
+  out.append(buffer.data(), len);
+}
+
+/*
+format string of printf is walked here,
+because arguments are not in same form as of host varargs,
+each conversion is formatted separately with type expected by it
+and length modifiers are dropped as int is 4 byte
+*/
+static int vm_format(std::string& out, const xlang::vm_value* args,
+                    const char* types, int count, int first)
+{
+  const char* format = static_cast<const char*>(ptr_arg(args, types, count, first));
+  int next = first + 1;
+  if(format == nullptr) return 0;
+
+  while(*format != '\0'){
+    if(*format != '%'){
+      out.push_back(*format++);
+      continue;
+    }
+    std::string spec = "%";
+    format++;
+    while(*format != '\0' && std::strchr("-+ #0123456789.*hlLqjzt", *format)){
+      if(*format == '*'){
+        spec += std::to_string(int_arg(args, types, count, next++));
+      }else if(!std::strchr("hlLqjzt", *format)){
+        spec.push_back(*format);
+      }
+      format++;
+    }
+    char conv = *format;
+    if(conv == '\0') break;
+    format++;
+    spec.push_back(conv);
+    switch(conv){
+      case '%' :
+        out.push_back('%');
+        break;
+      case 'd' :
+      case 'i' :
+      case 'c' :
+        format_value(out, spec, static_cast<int>(int_arg(args, types, count, next++)));
+        break;
+      case 'o' :
+      case 'u' :
+      case 'x' :
+      case 'X' :
+        format_value(out, spec, static_cast<unsigned>(int_arg(args, types, count, next++)));
+        break;
+      case 'f' :
+      case 'F' :
+      case 'e' :
+      case 'E' :
+      case 'g' :
+      case 'G' :
+      case 'a' :
+      case 'A' :
+        format_value(out, spec, float_arg(args, types, count, next++));
+        break;
+      case 's' :
+        {
+          const char* str = static_cast<const char*>(ptr_arg(args, types, count, next++));
+          format_value(out, spec, str == nullptr ? "(null)" : str);
+        }
+        break;
+      case 'p' :
+        format_value(out, spec, ptr_arg(args, types, count, next++));
+        break;
+      default :
+        next++;
+        break;
+    }
+  }
+  return static_cast<int>(out.size());
+}
+
+static xlang::vm_value vm_printf(const xlang::vm_value* args, const char* types, int count)
+{
+  std::string out;
+  vm_format(out, args, types, count, 0);
+  std::fwrite(out.data(), 1, out.size(), stdout);
+  return int_result(out.size());
+}
+
+static xlang::vm_value vm_sprintf(const xlang::vm_value* args, const char* types, int count)
+{
+  std::string out;
+  char* buffer = static_cast<char*>(ptr_arg(args, types, count, 0));
+  vm_format(out, args, types, count, 1);
+  if(buffer != nullptr)
+    std::memcpy(buffer, out.c_str(), out.size() + 1);
+  return int_result(out.size());
+}
+
+//each conversion is read by separate scanf call with its pointer
+static xlang::vm_value vm_scanf(const xlang::vm_value* args, const char* types, int count)
+{
+  const char* format = static_cast<const char*>(ptr_arg(args, types, count, 0));
+  int next = 1, assigned = 0, result;
+  if(format == nullptr) return int_result(0);
+
+  while(*format != '\0'){
+    std::string spec;
+    bool suppress = false;
+    while(*format != '\0' && *format != '%')
+      spec.push_back(*format++);
+    if(*format == '%'){
+      spec.push_back(*format++);
+      if(*format == '*') suppress = true;
+      while(*format != '\0' && std::strchr("*0123456789hlLqjzt", *format))
+        spec.push_back(*format++);
+      if(*format == '['){
+        while(*format != '\0' && *format != ']')
+          spec.push_back(*format++);
+      }
+      if(*format != '\0')
+        spec.push_back(*format++);
+    }
+    if(spec.size() > 1 && spec.substr(spec.size() - 2) == "%%")
+      suppress = true;
+    if(suppress || spec.find('%') == std::string::npos)
+      result = std::scanf(spec.c_str());
+    else
+      result = std::scanf(spec.c_str(), ptr_arg(args, types, count, next++));
+    if(result == EOF)
+      return int_result(assigned == 0 ? EOF : assigned);
+    if(!suppress && spec.find('%') != std::string::npos){
+      if(result == 0) break;
+      assigned += result;
+    }
+  }
+  return int_result(assigned);
+}
+
+#define VM_FFI_INT(name, call) \
+  static xlang::vm_value vm_##name(const xlang::vm_value* args, const char* types, int count) \
+  { \
+    return int_result(call); \
+  }
+
+#define VM_FFI_FLOAT(name, call) \
+  static xlang::vm_value vm_##name(const xlang::vm_value* args, const char* types, int count) \
+  { \
+    return float_result(call); \
+  }
+
+#define I(n) int_arg(args, types, count, n)
+#define F(n) float_arg(args, types, count, n)
+#define P(n) ptr_arg(args, types, count, n)
+
+VM_FFI_INT(puts, std::puts(static_cast<const char*>(P(0))))
+VM_FFI_INT(putchar, std::putchar(static_cast<int>(I(0))))
+VM_FFI_INT(getchar, (static_cast<void>(args), static_cast<void>(types),
+                    static_cast<void>(count), std::getchar()))
+VM_FFI_INT(malloc, reinterpret_cast<long long>(std::malloc(I(0))))
+VM_FFI_INT(calloc, reinterpret_cast<long long>(std::calloc(I(0), I(1))))
+VM_FFI_INT(realloc, reinterpret_cast<long long>(std::realloc(P(0), I(1))))
+VM_FFI_INT(free, (std::free(P(0)), 0))
+VM_FFI_INT(memset, reinterpret_cast<long long>(std::memset(P(0), static_cast<int>(I(1)), I(2))))
+VM_FFI_INT(memcpy, reinterpret_cast<long long>(std::memcpy(P(0), P(1), I(2))))
+VM_FFI_INT(strlen, std::strlen(static_cast<const char*>(P(0))))
+VM_FFI_INT(strcpy, reinterpret_cast<long long>(std::strcpy(static_cast<char*>(P(0)),
+                                                static_cast<const char*>(P(1)))))
+VM_FFI_INT(strcat, reinterpret_cast<long long>(std::strcat(static_cast<char*>(P(0)),
+                                                static_cast<const char*>(P(1)))))
+VM_FFI_INT(strcmp, std::strcmp(static_cast<const char*>(P(0)), static_cast<const char*>(P(1))))
+VM_FFI_INT(atoi, std::atoi(static_cast<const char*>(P(0))))
+VM_FFI_INT(abs, std::abs(static_cast<int>(I(0))))
+VM_FFI_INT(rand, (static_cast<void>(args), static_cast<void>(types),
+                  static_cast<void>(count), std::rand()))
+VM_FFI_INT(srand, (std::srand(static_cast<unsigned>(I(0))), 0))
+VM_FFI_INT(time, std::time(static_cast<time_t*>(P(0))))
+VM_FFI_INT(exit, (std::fflush(stdout), std::exit(static_cast<int>(I(0))), 0))
+VM_FFI_FLOAT(sqrt, std::sqrt(F(0)))
+VM_FFI_FLOAT(pow, std::pow(F(0), F(1)))
+VM_FFI_FLOAT(sin, std::sin(F(0)))
+VM_FFI_FLOAT(cos, std::cos(F(0)))
+VM_FFI_FLOAT(fabs, std::fabs(F(0)))
+VM_FFI_FLOAT(floor, std::floor(F(0)))
+VM_FFI_FLOAT(ceil, std::ceil(F(0)))
+
+#undef I
+#undef F
+#undef P
+
+static const struct xlang::vm_ffi ffi_table[] = {
+  {"printf", vm_printf, false},
+  {"sprintf", vm_sprintf, false},
+  {"scanf", vm_scanf, false},
+  {"puts", vm_puts, false},
+  {"putchar", vm_putchar, false},
+  {"getchar", vm_getchar, false},
+  {"malloc", vm_malloc, false},
+  {"calloc", vm_calloc, false},
+  {"realloc", vm_realloc, false},
+  {"free", vm_free, false},
+  {"memset", vm_memset, false},
+  {"memcpy", vm_memcpy, false},
+  {"strlen", vm_strlen, false},
+  {"strcpy", vm_strcpy, false},
+  {"strcat", vm_strcat, false},
+  {"strcmp", vm_strcmp, false},
+  {"atoi", vm_atoi, false},
+  {"abs", vm_abs, false},
+  {"rand", vm_rand, false},
+  {"srand", vm_srand, false},
+  {"time", vm_time, false},
+  {"exit", vm_exit, false},
+  {"sqrt", vm_sqrt, true},
+  {"pow", vm_pow, true},
+  {"sin", vm_sin, true},
+  {"cos", vm_cos, true},
+  {"fabs", vm_fabs, true},
+  {"floor", vm_floor, true},
+  {"ceil", vm_ceil, true},
+};
+
+static const struct xlang::vm_ffi* search_ffi(std::string name)
+{
+  for(auto& f : ffi_table){
+    if(name == f.name)
+      return &f;
+  }
+  return nullptr;
+}
+
+xlang::vm::vm(bool _native_externs)
+{
+  native_externs = _native_externs;
+  frame_stack = new char[VM_FRAME_STACK_SIZE];
+  reg_stack = new vm_value[VM_REG_STACK_SIZE];
+}
+
+xlang::vm::~vm()
+{
+  delete[] frame_stack;
+  delete[] reg_stack;
+  delete[] global_memory;
+}
+
+void xlang::vm::unsupported(std::string str, loc_t loc)
+{
+  xlang::error::print_error(xlang::filename, str+" is not supported by --run", loc);
+  failed = true;
+}
+
+int xlang::vm::new_reg()
+{
+  int r = next_reg++;
+  if(next_reg > func->reg_count)
+    func->reg_count = next_reg;
+  return r;
+}
+
+int xlang::vm::new_label()
+{
+  labels.push_back(-1);
+  return static_cast<int>(labels.size()) - 1;
+}
+
+void xlang::vm::bind_label(int label)
+{
+  labels[label] = static_cast<int>(func->code.size());
+}
+
+struct xlang::vm_insn& xlang::vm::emit(int opcode, int a, int b, int c)
+{
+  struct vm_insn in;
+  in.handler = nullptr;
+  in.opcode = opcode;
+  in.a = a;
+  in.b = b;
+  in.c = c;
+  in.line = line;
+  in.imm = 0;
+  func->code.push_back(in);
+  return func->code.back();
+}
+
+void xlang::vm::emit_li(int r, long long value)
+{
+  emit(VM_LI, r, 0, 0).imm = value;
+}
+
+//imm of jump is label until function is compiled
+void xlang::vm::emit_jump(int opcode, int a, int b, int label)
+{
+  emit(opcode, a, b, 0).imm = label;
+}
+
+int xlang::vm::type_size(token tok)
+{
+  switch(tok.token){
+    case KEY_CHAR : return 1;
+    case KEY_SHORT : return 2;
+    case KEY_DOUBLE : return 8;
+    default : return 4;
+  }
+}
+
+//integer value of literal, decimal literals are wrapped to int
+static long long literal_value(token tok)
+{
+  if(tok.token == LIT_DECIMAL)
+    return static_cast<int>(std::strtoll(tok.lexeme.c_str(), nullptr, 10));
+  return xlang::get_decimal(tok);
+}
+
+//kind of non pointer variable of simple type
+static xlang::vm_kind_t scalar_kind(token type)
+{
+  switch(type.token){
+    case KEY_CHAR : return xlang::VM_KIND_I8;
+    case KEY_SHORT : return xlang::VM_KIND_I16;
+    case KEY_FLOAT : return xlang::VM_KIND_F32;
+    case KEY_DOUBLE : return xlang::VM_KIND_F64;
+    default : return xlang::VM_KIND_I32;
+  }
+}
+
+/*
+get variable for symbol, pointers are 8 byte host addresses,
+size of array is product of its dimensions
+*/
+bool xlang::vm::get_var(struct st_symbol_info* syminf, struct vm_var* var)
+{
+  if(syminf == nullptr || syminf->type_info == nullptr) return false;
+  if(syminf->type_info->type != SIMPLE_TYPE){
+    unsupported("record variable '"+syminf->symbol+"'", syminf->tok.loc);
+    return false;
+  }
+  if(syminf->is_func_ptr){
+    unsupported("function pointer '"+syminf->symbol+"'", syminf->tok.loc);
+    return false;
+  }
+  var->type = syminf->type_info->type_specifier.simple_type[0];
+  var->ptr_level = syminf->is_ptr ? syminf->ptr_oprtr_count : 0;
+  var->is_array = syminf->is_array;
+  var->dims.clear();
+  for(auto t : syminf->arr_dimension_list)
+    var->dims.push_back(static_cast<int>(literal_value(t)));
+  var->is_global = false;
+  var->offset = 0;
+
+  if(var->ptr_level > 0){
+    var->kind = VM_KIND_I64;
+    var->size = 8;
+  }else{
+    var->size = type_size(var->type);
+    var->kind = scalar_kind(var->type);
+  }
+  return true;
+}
+
+static long long var_memory_size(struct xlang::vm_var& var)
+{
+  long long size = var.size;
+  for(int d : var.dims)
+    size *= d;
+  return size;
+}
+
+struct xlang::vm_var* xlang::vm::search_var(std::string name)
+{
+  auto lfind = locals.find(name);
+  if(lfind != locals.end())
+    return &lfind->second;
+  auto gfind = globals.find(name);
+  if(gfind != globals.end())
+    return &gfind->second;
+  return nullptr;
+}
+
+xlang::vm_type_t xlang::vm::kind_type(vm_kind_t kind)
+{
+  if(kind == VM_KIND_I64) return VM_PTR;
+  if(kind == VM_KIND_F32 || kind == VM_KIND_F64) return VM_FLOAT;
+  return VM_INT;
+}
+
+xlang::vm_type_t xlang::vm::return_type(struct st_func_info* finfo)
+{
+  if(finfo == nullptr) return VM_INT;
+  if(finfo->ptr_oprtr_count > 0) return VM_PTR;
+  if(finfo->return_type != nullptr && finfo->return_type->type == SIMPLE_TYPE){
+    token_t t = finfo->return_type->type_specifier.simple_type[0].token;
+    if(t == KEY_FLOAT || t == KEY_DOUBLE) return VM_FLOAT;
+  }
+  return VM_INT;
+}
+
+//load/store opcodes are in order of local, global, indirect for each kind
+int xlang::vm::load_opcode(vm_kind_t kind, bool global, bool indirect)
+{
+  return VM_LDL_I8 + kind * 6 + (indirect ? 4 : (global ? 2 : 0));
+}
+
+int xlang::vm::store_opcode(vm_kind_t kind, bool global, bool indirect)
+{
+  return load_opcode(kind, global, indirect) + 1;
+}
+
+//copy of string literal with escape sequences, its address is used by program
+long long xlang::vm::get_string(std::string str)
+{
+  std::string result;
+  size_t index = 0;
+  while(index < str.size()){
+    if(str[index] == '\\' && index + 1 < str.size()){
+      switch(str[index + 1]){
+        case 'a' : result.push_back('\a'); break;
+        case 'b' : result.push_back('\b'); break;
+        case 'f' : result.push_back('\f'); break;
+        case 'n' : result.push_back('\n'); break;
+        case 'r' : result.push_back('\r'); break;
+        case 't' : result.push_back('\t'); break;
+        case 'v' : result.push_back('\v'); break;
+        case '0' : result.push_back('\0'); break;
+        case '\\' : result.push_back('\\'); break;
+        case '\'' : result.push_back('\''); break;
+        case '"' : result.push_back('"'); break;
+        default :
+          result.push_back(str[index]);
+          result.push_back(str[index + 1]);
+          break;
+      }
+      index += 2;
+    }else{
+      result.push_back(str[index++]);
+    }
+  }
+  strings.push_back(result);
+  return reinterpret_cast<long long>(strings.back().c_str());
+}
+
+/*
+allocate global variables in global memory,
+and copy values of array initializer list
+*/
+void xlang::vm::allocate_globals()
+{
+  struct st_symbol_info* syminf = nullptr;
+  struct vm_var var;
+  long long size = 0;
+  if(xlang::global_symtab == nullptr) return;
+
+  for(int i = 0; i < ST_SIZE; i++){
+    for(syminf = xlang::global_symtab->symbol_info[i]; syminf != nullptr;
+        syminf = syminf->p_next){
+      if(!get_var(syminf, &var)) continue;
+      var.is_global = true;
+      var.offset = size;
+      size += (var_memory_size(var) + 7) & ~7;
+      globals[syminf->symbol] = var;
+    }
+  }
+
+  global_memory = new char[size + 8]();
+  for(auto& g : globals)
+    g.second.offset = reinterpret_cast<long long>(global_memory + g.second.offset);
+
+  for(int i = 0; i < ST_SIZE; i++){
+    for(syminf = xlang::global_symtab->symbol_info[i]; syminf != nullptr;
+        syminf = syminf->p_next){
+      if(!syminf->is_array || syminf->arr_init_list.empty()) continue;
+      auto gfind = globals.find(syminf->symbol);
+      if(gfind == globals.end()) continue;
+      struct vm_var& g = gfind->second;
+      char* addr = reinterpret_cast<char*>(g.offset);
+      char* end = addr + var_memory_size(g);
+      for(auto& row : syminf->arr_init_list){
+        for(auto& t : row){
+          if(addr + g.size > end) break;
+          double fval = t.token == LIT_FLOAT ? std::stod(t.lexeme)
+                          : static_cast<double>(literal_value(t));
+          long long ival = t.token == LIT_FLOAT ? static_cast<long long>(fval)
+                          : literal_value(t);
+          switch(g.kind){
+            case VM_KIND_I8 : *reinterpret_cast<char*>(addr) = static_cast<char>(ival); break;
+            case VM_KIND_I16 : *reinterpret_cast<short*>(addr) = static_cast<short>(ival); break;
+            case VM_KIND_I32 : *reinterpret_cast<int*>(addr) = static_cast<int>(ival); break;
+            case VM_KIND_I64 : *reinterpret_cast<long long*>(addr) = ival; break;
+            case VM_KIND_F32 : *reinterpret_cast<float*>(addr) = static_cast<float>(fval); break;
+            case VM_KIND_F64 : *reinterpret_cast<double*>(addr) = fval; break;
+          }
+          addr += g.size;
+        }
+      }
+    }
+  }
+}
+
+//convert value in register r from one type to another
+void xlang::vm::convert(int r, vm_type_t from, vm_type_t to)
+{
+  if(from == to) return;
+  if(to == VM_FLOAT){
+    emit(VM_I2F, r, r, 0);
+  }else if(from == VM_FLOAT){
+    emit(VM_F2I, r, r, 0);
+  }else if(to == VM_INT){
+    //pointer is truncated to int
+    emit(VM_ADDI, r, r, 0).imm = 0;
+  }
+}
+
+//float value is converted into 0 or 1 before testing it
+void xlang::vm::gen_truth(int r, vm_type_t type)
+{
+  if(type != VM_FLOAT) return;
+  int zero = new_reg();
+  emit(VM_LF, zero, 0, 0).fimm = 0.0;
+  emit(VM_FNE, r, r, zero);
+  next_reg--;
+}
+
+static bool is_comparison(token_t tk)
+{
+  return (tk == COMP_LESS || tk == COMP_LESS_EQ || tk == COMP_GREAT
+          || tk == COMP_GREAT_EQ || tk == COMP_EQ || tk == COMP_NOT_EQ);
+}
+
+//operator of compound assignment, e.g += is +
+static token_t get_assgn_arthm_op(token_t tk)
+{
+  switch(tk){
+    case ASSGN_ADD : return ARTHM_ADD;
+    case ASSGN_SUB : return ARTHM_SUB;
+    case ASSGN_MUL : return ARTHM_MUL;
+    case ASSGN_DIV : return ARTHM_DIV;
+    case ASSGN_MOD : return ARTHM_MOD;
+    case ASSGN_BIT_OR : return BIT_OR;
+    case ASSGN_BIT_AND : return BIT_AND;
+    case ASSGN_BIT_EX_OR : return BIT_EXOR;
+    case ASSGN_LSHIFT : return BIT_LSHIFT;
+    case ASSGN_RSHIFT : return BIT_RSHIFT;
+    default : return NONE;
+  }
+}
+
+/*
+dst = dst op src, operands are converted to float if any of them is float,
+pointer added with integer remains pointer
+*/
+xlang::vm_type_t xlang::vm::gen_arithmetic(token_t op, int dst, vm_type_t ltype,
+                                           int src, vm_type_t rtype)
+{
+  static const std::map<token_t, int> int_ops = {
+    {ARTHM_ADD, VM_ADD}, {ARTHM_SUB, VM_SUB}, {ARTHM_MUL, VM_MUL},
+    {ARTHM_DIV, VM_DIV}, {ARTHM_MOD, VM_MOD}, {BIT_AND, VM_AND},
+    {BIT_OR, VM_OR}, {BIT_EXOR, VM_XOR}, {BIT_LSHIFT, VM_SHL},
+    {BIT_RSHIFT, VM_SHR}, {COMP_LESS, VM_LT}, {COMP_LESS_EQ, VM_LE},
+    {COMP_GREAT, VM_GT}, {COMP_GREAT_EQ, VM_GE}, {COMP_EQ, VM_EQ},
+    {COMP_NOT_EQ, VM_NE}
+  };
+  static const std::map<token_t, int> float_ops = {
+    {ARTHM_ADD, VM_FADD}, {ARTHM_SUB, VM_FSUB}, {ARTHM_MUL, VM_FMUL},
+    {ARTHM_DIV, VM_FDIV}, {COMP_LESS, VM_FLT}, {COMP_LESS_EQ, VM_FLE},
+    {COMP_GREAT, VM_FGT}, {COMP_GREAT_EQ, VM_FGE}, {COMP_EQ, VM_FEQ},
+    {COMP_NOT_EQ, VM_FNE}
+  };
+
+  if(ltype == VM_FLOAT || rtype == VM_FLOAT){
+    auto ffind = float_ops.find(op);
+    if(ffind != float_ops.end()){
+      convert(dst, ltype, VM_FLOAT);
+      convert(src, rtype, VM_FLOAT);
+      emit(ffind->second, dst, dst, src);
+      return is_comparison(op) ? VM_INT : VM_FLOAT;
+    }
+    convert(dst, ltype, VM_INT);
+    convert(src, rtype, VM_INT);
+    ltype = rtype = VM_INT;
+  }
+
+  if(is_comparison(op)){
+    emit(int_ops.at(op), dst, dst, src);
+    return VM_INT;
+  }
+  if((ltype == VM_PTR || rtype == VM_PTR) && (op == ARTHM_ADD || op == ARTHM_SUB)){
+    emit(op == ARTHM_ADD ? VM_ADDP : VM_SUBP, dst, dst, src);
+    return (ltype == VM_PTR && rtype == VM_PTR) ? VM_INT : VM_PTR;
+  }
+  auto ifind = int_ops.find(op);
+  if(ifind == int_ops.end()) return VM_INT;
+  emit(ifind->second, dst, dst, src);
+  return VM_INT;
+}
+
+xlang::vm_type_t xlang::vm::gen_binary_expr(struct primary_expr* pexpr, int dst)
+{
+  token_t op = pexpr->tok.token;
+  vm_type_t ltype, rtype, type;
+  int mark = next_reg;
+
+  if(op == LOG_AND || op == LOG_OR || is_comparison(op)){
+    int lfalse = new_label(), lexit = new_label();
+    gen_branch(pexpr, false, lfalse);
+    emit_li(dst, 1);
+    emit_jump(VM_JMP, 0, 0, lexit);
+    bind_label(lfalse);
+    emit_li(dst, 0);
+    bind_label(lexit);
+    return VM_INT;
+  }
+
+  ltype = gen_primary_expr(pexpr->left, dst);
+
+  //integer constant is added as immediate
+  struct primary_expr* right = pexpr->right;
+  if(right != nullptr && !right->is_oprtr && !right->is_id && ltype == VM_INT
+      && (op == ARTHM_ADD || op == ARTHM_SUB)
+      && right->tok.token != LIT_FLOAT && right->tok.token != LIT_STRING){
+    long long value = literal_value(right->tok);
+    emit(VM_ADDI, dst, dst, 0).imm = (op == ARTHM_ADD ? value : -value);
+    return VM_INT;
+  }
+
+  int src = new_reg();
+  rtype = gen_primary_expr(right, src);
+  type = gen_arithmetic(op, dst, ltype, src, rtype);
+  next_reg = mark;
+  return type;
+}
+
+xlang::vm_type_t xlang::vm::gen_primary_expr(struct primary_expr* pexpr, int dst)
+{
+  vm_type_t type;
+  if(pexpr == nullptr){
+    emit_li(dst, 0);
+    return VM_INT;
+  }
+  line = pexpr->tok.loc.line;
+
+  if(pexpr->is_oprtr){
+    if(pexpr->oprtr_kind == BINARY_OP){
+      if(pexpr->tok.token == DOT_OP || pexpr->tok.token == ARROW_OP){
+        unsupported("record member access", pexpr->tok.loc);
+        return VM_INT;
+      }
+      return gen_binary_expr(pexpr, dst);
+    }
+    type = gen_primary_expr(pexpr->unary_node, dst);
+    switch(pexpr->tok.token){
+      case BIT_COMPL :
+        convert(dst, type, VM_INT);
+        emit(VM_NOT, dst, dst, 0);
+        return VM_INT;
+      case LOG_NOT :
+        gen_truth(dst, type);
+        emit(VM_LNOT, dst, dst, 0);
+        return VM_INT;
+      case ARTHM_SUB :
+        emit(type == VM_FLOAT ? VM_FNEG : VM_NEG, dst, dst, 0);
+        return type;
+      default :
+        return type;
+    }
+  }
+
+  if(pexpr->is_id){
+    struct vm_var* var = search_var(pexpr->tok.lexeme);
+    if(var == nullptr){
+      unsupported("'"+pexpr->tok.lexeme+"' in expression", pexpr->tok.loc);
+      return VM_INT;
+    }
+    struct vm_lvalue lv = {var, -1, 0, var->kind, kind_type(var->kind)};
+    return gen_load(lv, dst);
+  }
+
+  switch(pexpr->tok.token){
+    case LIT_FLOAT :
+      emit(VM_LF, dst, 0, 0).fimm = std::stod(pexpr->tok.lexeme);
+      return VM_FLOAT;
+    case LIT_STRING :
+      emit_li(dst, get_string(pexpr->tok.lexeme));
+      return VM_PTR;
+    default :
+      emit_li(dst, literal_value(pexpr->tok));
+      return VM_INT;
+  }
+}
+
+/*
+jump to label when truth of expression is equal to when,
+comparison of integers is a single compare and jump instruction
+and && || are evaluated with short circuit
+*/
+void xlang::vm::gen_branch(struct primary_expr* pexpr, bool when, int label)
+{
+  int mark = next_reg;
+  if(pexpr == nullptr) return;
+  token_t op = pexpr->tok.token;
+
+  if(pexpr->is_oprtr && pexpr->oprtr_kind == BINARY_OP && (op == LOG_AND || op == LOG_OR)){
+    //jump when both are true for &&, or when any one is true for ||
+    if(when == (op == LOG_OR)){
+      gen_branch(pexpr->left, when, label);
+      gen_branch(pexpr->right, when, label);
+    }else{
+      int skip = new_label();
+      gen_branch(pexpr->left, !when, skip);
+      gen_branch(pexpr->right, when, label);
+      bind_label(skip);
+    }
+    return;
+  }
+  if(pexpr->is_oprtr && pexpr->oprtr_kind == UNARY_OP && op == LOG_NOT){
+    gen_branch(pexpr->unary_node, !when, label);
+    return;
+  }
+
+  if(pexpr->is_oprtr && pexpr->oprtr_kind == BINARY_OP && is_comparison(op)){
+    static const std::map<token_t, std::pair<int, int>> jumps = {
+      {COMP_LESS, {VM_JLT, VM_JGE}}, {COMP_LESS_EQ, {VM_JLE, VM_JGT}},
+      {COMP_GREAT, {VM_JGT, VM_JLE}}, {COMP_GREAT_EQ, {VM_JGE, VM_JLT}},
+      {COMP_EQ, {VM_JEQ, VM_JNE}}, {COMP_NOT_EQ, {VM_JNE, VM_JEQ}}
+    };
+    int r1 = new_reg();
+    int r2 = new_reg();
+    vm_type_t ltype = gen_primary_expr(pexpr->left, r1);
+    vm_type_t rtype = gen_primary_expr(pexpr->right, r2);
+    line = pexpr->tok.loc.line;
+    if(ltype == VM_FLOAT || rtype == VM_FLOAT){
+      gen_arithmetic(op, r1, ltype, r2, rtype);
+      emit_jump(when ? VM_JNZ : VM_JZ, r1, 0, label);
+    }else{
+      auto jfind = jumps.at(op);
+      emit_jump(when ? jfind.first : jfind.second, r1, r2, label);
+    }
+    next_reg = mark;
+    return;
+  }
+
+  int r = new_reg();
+  vm_type_t type = gen_primary_expr(pexpr, r);
+  gen_truth(r, type);
+  emit_jump(when ? VM_JNZ : VM_JZ, r, 0, label);
+  next_reg = mark;
+}
+
+void xlang::vm::gen_condition(struct expr* _expr, bool when, int label)
+{
+  int mark = next_reg;
+  if(_expr == nullptr){
+    //missing condition of for loop is always true
+    if(when)
+      emit_jump(VM_JMP, 0, 0, label);
+    return;
+  }
+  if(_expr->expr_kind == PRIMARY_EXPR){
+    gen_branch(_expr->primary_expression, when, label);
+    return;
+  }
+  int r = new_reg();
+  vm_type_t type = gen_expr(_expr, r);
+  gen_truth(r, type);
+  emit_jump(when ? VM_JNZ : VM_JZ, r, 0, label);
+  next_reg = mark;
+}
+
+//load value of subscript token, which is literal or identifier
+void xlang::vm::gen_subscript(token tok, int dst)
+{
+  if(tok.token == IDENTIFIER){
+    struct vm_var* var = search_var(tok.lexeme);
+    if(var == nullptr){
+      unsupported("subscript '"+tok.lexeme+"'", tok.loc);
+      return;
+    }
+    struct vm_lvalue lv = {var, -1, 0, var->kind, kind_type(var->kind)};
+    convert(dst, gen_load(lv, dst), VM_INT);
+  }else{
+    emit_li(dst, literal_value(tok));
+  }
+}
+
+/*
+get variable or element of array referred by identifier expression,
+element of array is at address in register + disp,
+subscript of pointer variable indexes memory pointed by it
+*/
+bool xlang::vm::gen_lvalue(struct id_expr* idexpr, struct vm_lvalue* lv)
+{
+  if(idexpr == nullptr) return false;
+  if(idexpr->is_oprtr || !idexpr->is_id){
+    unsupported("record member access", idexpr->tok.loc);
+    return false;
+  }
+  line = idexpr->tok.loc.line;
+  struct vm_var* var = search_var(idexpr->tok.lexeme);
+  if(var == nullptr){
+    unsupported("'"+idexpr->tok.lexeme+"'", idexpr->tok.loc);
+    return false;
+  }
+  lv->var = var;
+  lv->addr_reg = -1;
+  lv->disp = 0;
+  lv->kind = var->kind;
+  lv->type = kind_type(var->kind);
+  if(!idexpr->is_subscript || idexpr->subscript.empty()) return true;
+
+  int base = new_reg();
+  std::vector<token> subs(idexpr->subscript.begin(), idexpr->subscript.end());
+  int size = var->size;
+
+  if(var->is_array){
+    if(var->is_global)
+      emit_li(base, var->offset);
+    else
+      emit(VM_ADDR, base, 0, 0).imm = var->offset;
+  }else if(var->ptr_level > 0){
+    //element of pointer
+    emit(load_opcode(VM_KIND_I64, var->is_global, false), base, 0, 0).imm = var->offset;
+    if(var->ptr_level > 1){
+      lv->kind = VM_KIND_I64;
+      size = 8;
+    }else{
+      size = type_size(var->type);
+      lv->kind = scalar_kind(var->type);
+    }
+    lv->type = kind_type(lv->kind);
+    subs.resize(1);
+  }else{
+    unsupported("subscript of '"+var->type.lexeme+"' variable", idexpr->tok.loc);
+    return false;
+  }
+
+  //index of element in row major order,
+  //literal subscripts are folded into displacement
+  bool constant = true;
+  long long index = 0;
+  for(size_t i = 0; i < subs.size(); i++){
+    if(subs[i].token == IDENTIFIER) constant = false;
+    long long dim = (i < var->dims.size() && var->is_array) ? var->dims[i] : 1;
+    if(constant)
+      index = index * dim + (subs[i].token == IDENTIFIER ? 0 : literal_value(subs[i]));
+  }
+  if(constant){
+    lv->addr_reg = base;
+    lv->disp = index * size;
+    return true;
+  }
+
+  int idx = new_reg();
+  int tmp = new_reg();
+  gen_subscript(subs[0], idx);
+  for(size_t i = 1; i < subs.size(); i++){
+    emit_li(tmp, i < var->dims.size() ? var->dims[i] : 1);
+    emit(VM_MUL, idx, idx, tmp);
+    gen_subscript(subs[i], tmp);
+    emit(VM_ADD, idx, idx, tmp);
+  }
+  if(size != 1){
+    emit_li(tmp, size);
+    emit(VM_MUL, idx, idx, tmp);
+  }
+  emit(VM_ADDP, base, base, idx);
+  next_reg = idx;
+  lv->addr_reg = base;
+  return true;
+}
+
+xlang::vm_type_t xlang::vm::gen_load(struct vm_lvalue& lv, int dst)
+{
+  if(lv.addr_reg >= 0){
+    emit(load_opcode(lv.kind, false, true), dst, lv.addr_reg, 0).imm = lv.disp;
+  }else if(lv.var->is_array){
+    //array is address of its first element
+    if(lv.var->is_global)
+      emit_li(dst, lv.var->offset);
+    else
+      emit(VM_ADDR, dst, 0, 0).imm = lv.var->offset;
+    return VM_PTR;
+  }else{
+    emit(load_opcode(lv.kind, lv.var->is_global, false), dst, 0, 0).imm = lv.var->offset;
+  }
+  return lv.type;
+}
+
+void xlang::vm::gen_store(struct vm_lvalue& lv, int src, vm_type_t type)
+{
+  convert(src, type, lv.type);
+  if(lv.addr_reg >= 0)
+    emit(store_opcode(lv.kind, false, true), lv.addr_reg, src, 0).imm = lv.disp;
+  else
+    emit(store_opcode(lv.kind, lv.var->is_global, false), src, 0, 0).imm = lv.var->offset;
+}
+
+xlang::vm_type_t xlang::vm::gen_id_expr(struct id_expr* idexpr, int dst)
+{
+  struct vm_lvalue lv;
+  vm_type_t type;
+  int mark = next_reg;
+  if(idexpr == nullptr){
+    emit_li(dst, 0);
+    return VM_INT;
+  }
+
+  if(idexpr->is_oprtr && idexpr->unary != nullptr){
+    token_t op = idexpr->tok.token;
+    if(!gen_lvalue(idexpr->unary, &lv)) return VM_INT;
+    line = idexpr->tok.loc.line;
+    if(op == ADDROF_OP){
+      if(lv.addr_reg >= 0){
+        emit(VM_MOV, dst, lv.addr_reg, 0);
+        if(lv.disp != 0){
+          int tmp = new_reg();
+          emit_li(tmp, lv.disp);
+          emit(VM_ADDP, dst, dst, tmp);
+        }
+      }else if(lv.var->is_global){
+        emit_li(dst, lv.var->offset);
+      }else{
+        emit(VM_ADDR, dst, 0, 0).imm = lv.var->offset;
+      }
+      next_reg = mark;
+      return VM_PTR;
+    }
+    //value of ++/-- is the updated value
+    type = gen_load(lv, dst);
+    int delta = (op == DECR_OP) ? -1 : 1;
+    if(type == VM_FLOAT){
+      int tmp = new_reg();
+      emit(VM_LF, tmp, 0, 0).fimm = delta;
+      emit(VM_FADD, dst, dst, tmp);
+    }else if(type == VM_PTR){
+      int tmp = new_reg();
+      emit_li(tmp, delta);
+      emit(VM_ADDP, dst, dst, tmp);
+    }else{
+      emit(VM_ADDI, dst, dst, 0).imm = delta;
+    }
+    gen_store(lv, dst, type);
+    next_reg = mark;
+    return type;
+  }
+
+  if(idexpr->is_oprtr){
+    unsupported("record member access", idexpr->tok.loc);
+    return VM_INT;
+  }
+
+  if(!gen_lvalue(idexpr, &lv)) return VM_INT;
+  type = gen_load(lv, dst);
+
+  /*
+  pointer operator count of identifier can include count of pointer declarator
+  parsed before it, so indirection is limited to pointer level of variable
+  */
+  if(idexpr->is_ptr && idexpr->ptr_oprtr_count > 0 && lv.addr_reg < 0){
+    int level = lv.var->ptr_level;
+    int count = std::min(idexpr->ptr_oprtr_count, level);
+    for(int i = 1; i <= count; i++){
+      vm_kind_t kind = (i == level) ? scalar_kind(lv.var->type) : VM_KIND_I64;
+      emit(load_opcode(kind, false, true), dst, dst, 0).imm = 0;
+      type = kind_type(kind);
+    }
+  }
+  next_reg = mark;
+  return type;
+}
+
+/*
+assignment, indirection on left side of assignment is not generated
+same as in x86 code generation
+*/
+xlang::vm_type_t xlang::vm::gen_assgn_expr(struct assgn_expr* asexpr, int dst)
+{
+  struct vm_lvalue lv;
+  struct id_expr* left = asexpr->id_expression;
+  int mark = next_reg;
+  vm_type_t type;
+
+  if(left != nullptr && !left->is_oprtr && left->unary != nullptr)
+    left = left->unary;
+  if(left != nullptr && left->is_oprtr){
+    unsupported("assignment to '"+left->tok.lexeme+"' expression", asexpr->tok.loc);
+    return VM_INT;
+  }
+  if(!gen_lvalue(left, &lv)) return VM_INT;
+  if(lv.addr_reg < 0 && lv.var->is_array){
+    unsupported("assignment to array '"+lv.var->type.lexeme+"'", asexpr->tok.loc);
+    return VM_INT;
+  }
+
+  type = gen_expr(asexpr->expression, dst);
+  line = asexpr->tok.loc.line;
+
+  token_t op = get_assgn_arthm_op(asexpr->tok.token);
+  if(op != NONE){
+    int cur = new_reg();
+    vm_type_t curtype = gen_load(lv, cur);
+    type = gen_arithmetic(op, cur, curtype, dst, type);
+    emit(VM_MOV, dst, cur, 0);
+  }
+  gen_store(lv, dst, type);
+  next_reg = mark;
+  return lv.type;
+}
+
+xlang::vm_type_t xlang::vm::gen_sizeof_expr(struct sizeof_expr* sofexpr, int dst)
+{
+  long long size = 0;
+  if(sofexpr->is_simple_type){
+    if(sofexpr->is_ptr)
+      size = 8;
+    else if(!sofexpr->simple_type.empty())
+      size = type_size(sofexpr->simple_type[0]);
+  }else{
+    struct vm_var* var = search_var(sofexpr->identifier.lexeme);
+    if(var == nullptr){
+      unsupported("sizeof of record", sofexpr->identifier.loc);
+      return VM_INT;
+    }
+    size = var_memory_size(*var);
+  }
+  emit_li(dst, size);
+  return VM_INT;
+}
+
+xlang::vm_type_t xlang::vm::gen_cast_expr(struct cast_expr* cstexpr, int dst)
+{
+  vm_type_t type = gen_id_expr(cstexpr->target, dst);
+  if(cstexpr->ptr_oprtr_count > 0){
+    convert(dst, type, VM_PTR);
+    return VM_PTR;
+  }
+  if(!cstexpr->is_simple_type || cstexpr->simple_type.empty()){
+    unsupported("cast to record", cstexpr->identifier.loc);
+    return type;
+  }
+  switch(cstexpr->simple_type[0].token){
+    case KEY_FLOAT :
+      convert(dst, type, VM_FLOAT);
+      emit(VM_FROUND, dst, dst, 0);
+      return VM_FLOAT;
+    case KEY_DOUBLE :
+      convert(dst, type, VM_FLOAT);
+      return VM_FLOAT;
+    case KEY_CHAR :
+      convert(dst, type, VM_INT);
+      emit(VM_SX8, dst, dst, 0);
+      return VM_INT;
+    case KEY_SHORT :
+      convert(dst, type, VM_INT);
+      emit(VM_SX16, dst, dst, 0);
+      return VM_INT;
+    default :
+      convert(dst, type, VM_INT);
+      return VM_INT;
+  }
+}
+
+/*
+arguments are evaluated into consecutive registers,
+which becomes first registers of called function
+*/
+xlang::vm_type_t xlang::vm::gen_funccall_expr(struct func_call_expr* fcexpr, int dst)
+{
+  int mark = next_reg;
+  struct id_expr* function = fcexpr->function;
+  if(function == nullptr || function->is_oprtr){
+    unsupported("call of record member", fcexpr->function ? fcexpr->function->tok.loc : loc_t());
+    return VM_INT;
+  }
+  std::string name = function->tok.lexeme;
+  auto ffind = xlang::func_table.find(name);
+  if(ffind == xlang::func_table.end()){
+    unsupported("call of '"+name+"'", function->tok.loc);
+    return VM_INT;
+  }
+  struct st_func_info* finfo = ffind->second;
+  auto findex = function_index.find(name);
+  bool is_extern = (findex == function_index.end());
+  const struct vm_ffi* ffi = nullptr;
+  if(is_extern && !native_externs){
+    ffi = search_ffi(name);
+    if(ffi == nullptr){
+      unsupported("extern function '"+name+"'", function->tok.loc);
+      return VM_INT;
+    }
+  }
+
+  int count = static_cast<int>(fcexpr->expression_list.size());
+  int base = next_reg;
+  std::string types;
+  for(int i = 0; i < count; i++)
+    new_reg();
+
+  auto param = finfo->param_list.begin();
+  bool single;
+  int i = 0;
+  for(struct expr* arg : fcexpr->expression_list){
+    vm_type_t type = gen_expr(arg, base + i);
+    single = false;
+    //value is converted to declared type of parameter
+    if(param != finfo->param_list.end()){
+      struct st_func_param_info* fparam = *param;
+      vm_type_t ptype = type;
+      if(fparam != nullptr && fparam->type_info != nullptr){
+        bool is_ptr = fparam->symbol_info != nullptr && fparam->symbol_info->is_ptr;
+        token_t t = fparam->type_info->type_specifier.simple_type.empty() ? NONE
+                      : fparam->type_info->type_specifier.simple_type[0].token;
+        if(is_ptr)
+          ptype = (type == VM_FLOAT) ? VM_PTR : type;
+        else if(t == KEY_FLOAT || t == KEY_DOUBLE)
+          ptype = VM_FLOAT;
+        else if(fparam->type_info->type == SIMPLE_TYPE && t != KEY_VOID)
+          ptype = VM_INT;
+        //int parameter of extern function can get address or float,
+        //e.g printf of %s or %f
+        if(is_extern && ptype == VM_INT && type != VM_INT)
+          ptype = type;
+        single = !is_ptr && t == KEY_FLOAT;
+      }
+      convert(base + i, type, ptype);
+      type = ptype;
+      param++;
+    }
+    if(type == VM_FLOAT)
+      types.push_back(single ? 's' : 'f');
+    else
+      types.push_back(type == VM_PTR ? 'p' : 'i');
+    next_reg = base + count;
+    i++;
+  }
+  line = function->tok.loc.line;
+
+  vm_type_t rtype = return_type(finfo);
+  if(is_extern){
+    struct vm_extern_call call;
+    call.name = name;
+    call.ffi = ffi;
+    call.types = types;
+    call.return_type = rtype;
+    call.single_return = (rtype == VM_FLOAT && finfo->return_type != nullptr
+              && finfo->return_type->type_specifier.simple_type[0].token == KEY_FLOAT);
+    extern_calls.push_back(call);
+    emit(VM_CALLEXT, dst, base, count).imm = static_cast<long long>(extern_calls.size()) - 1;
+    //native call returns value of declared type
+    if(ffi != nullptr)
+      convert(dst, ffi->float_return ? VM_FLOAT : VM_PTR, rtype);
+  }else{
+    emit(VM_CALL, dst, base, count).imm = findex->second;
+  }
+  next_reg = mark;
+  return rtype;
+}
+
+xlang::vm_type_t xlang::vm::gen_expr(struct expr* _expr, int dst)
+{
+  if(_expr == nullptr){
+    emit_li(dst, 0);
+    return VM_INT;
+  }
+  switch(_expr->expr_kind){
+    case PRIMARY_EXPR :
+      return gen_primary_expr(_expr->primary_expression, dst);
+    case ASSGN_EXPR :
+      return gen_assgn_expr(_expr->assgn_expression, dst);
+    case SIZEOF_EXPR :
+      return gen_sizeof_expr(_expr->sizeof_expression, dst);
+    case CAST_EXPR :
+      return gen_cast_expr(_expr->cast_expression, dst);
+    case ID_EXPR :
+      return gen_id_expr(_expr->id_expression, dst);
+    case FUNC_CALL_EXPR :
+      return gen_funccall_expr(_expr->func_call_expression, dst);
+  }
+  return VM_INT;
+}
+
+/*
+loops are generated with condition at bottom,
+so that each iteration executes one conditional jump
+*/
+void xlang::vm::gen_iteration_statement(struct iter_stmt* itstmt)
+{
+  int lbody = new_label(), lcond = new_label(), lexit = new_label();
+  break_labels.push_back(lexit);
+  continue_labels.push_back(lcond);
+
+  switch(itstmt->type){
+    case WHILE_STMT :
+      line = itstmt->_while.whiletok.loc.line;
+      emit_jump(VM_JMP, 0, 0, lcond);
+      bind_label(lbody);
+      gen_statement(itstmt->_while.statement);
+      bind_label(lcond);
+      gen_condition(itstmt->_while.condition, true, lbody);
+      break;
+
+    case DOWHILE_STMT :
+      line = itstmt->_dowhile.dotok.loc.line;
+      bind_label(lbody);
+      gen_statement(itstmt->_dowhile.statement);
+      bind_label(lcond);
+      gen_condition(itstmt->_dowhile.condition, true, lbody);
+      break;
+
+    case FOR_STMT :
+      {
+        int lupdate = new_label();
+        int r = new_reg();
+        line = itstmt->_for.fortok.loc.line;
+        continue_labels.back() = lupdate;
+        if(itstmt->_for.init_expression != nullptr)
+          gen_expr(itstmt->_for.init_expression, r);
+        next_reg--;
+        emit_jump(VM_JMP, 0, 0, lcond);
+        bind_label(lbody);
+        gen_statement(itstmt->_for.statement);
+        bind_label(lupdate);
+        r = new_reg();
+        if(itstmt->_for.update_expression != nullptr)
+          gen_expr(itstmt->_for.update_expression, r);
+        next_reg--;
+        bind_label(lcond);
+        gen_condition(itstmt->_for.condition, true, lbody);
+      }
+      break;
+  }
+
+  bind_label(lexit);
+  break_labels.pop_back();
+  continue_labels.pop_back();
+}
+
+void xlang::vm::gen_jump_statement(struct jump_stmt* jmpstmt)
+{
+  line = jmpstmt->tok.loc.line;
+  switch(jmpstmt->type){
+    case BREAK_JMP :
+      if(!break_labels.empty())
+        emit_jump(VM_JMP, 0, 0, break_labels.back());
+      break;
+    case CONTINUE_JMP :
+      if(!continue_labels.empty())
+        emit_jump(VM_JMP, 0, 0, continue_labels.back());
+      break;
+    case RETURN_JMP :
+      if(jmpstmt->expression != nullptr){
+        int r = new_reg();
+        vm_type_t type = gen_expr(jmpstmt->expression, r);
+        convert(r, type, return_type(func_symtab ? func_symtab->func_info : nullptr));
+        emit(VM_RET, r, 0, 0);
+        next_reg--;
+      }else{
+        emit(VM_RETV, 0, 0, 0);
+      }
+      break;
+    case GOTO_JMP :
+      {
+        auto gfind = goto_labels.find(jmpstmt->goto_id.lexeme);
+        if(gfind == goto_labels.end())
+          gfind = goto_labels.insert({jmpstmt->goto_id.lexeme, new_label()}).first;
+        emit_jump(VM_JMP, 0, 0, gfind->second);
+      }
+      break;
+  }
+}
+
+void xlang::vm::gen_statement(struct stmt* stmthead)
+{
+  struct stmt* statement = stmthead;
+  while(statement != nullptr && !failed){
+    switch(statement->type){
+      case LABEL_STMT :
+        {
+          std::string label = statement->labled_statement->label.lexeme;
+          auto gfind = goto_labels.find(label);
+          if(gfind == goto_labels.end())
+            gfind = goto_labels.insert({label, new_label()}).first;
+          bind_label(gfind->second);
+        }
+        break;
+      case EXPR_STMT :
+        if(statement->expression_statement != nullptr
+            && statement->expression_statement->expression != nullptr){
+          int r = new_reg();
+          gen_expr(statement->expression_statement->expression, r);
+          next_reg--;
+        }
+        break;
+      case SELECT_STMT :
+        {
+          struct select_stmt* selstmt = statement->selection_statement;
+          int lelse = new_label(), lexit = new_label();
+          line = selstmt->iftok.loc.line;
+          gen_condition(selstmt->condition, false, lelse);
+          gen_statement(selstmt->if_statement);
+          if(selstmt->else_statement != nullptr){
+            emit_jump(VM_JMP, 0, 0, lexit);
+            bind_label(lelse);
+            gen_statement(selstmt->else_statement);
+          }else{
+            bind_label(lelse);
+          }
+          bind_label(lexit);
+        }
+        break;
+      case ITER_STMT :
+        gen_iteration_statement(statement->iteration_statement);
+        break;
+      case JUMP_STMT :
+        gen_jump_statement(statement->jump_statement);
+        break;
+      case ASM_STMT :
+        {
+          loc_t loc = {line, 0};
+          if(statement->asm_statement != nullptr)
+            loc = statement->asm_statement->asm_template.loc;
+          unsupported("inline assembly", loc);
+        }
+        break;
+      default :
+        break;
+    }
+    statement = statement->p_next;
+  }
+}
+
+//replace labels of jumps by index of instruction
+void xlang::vm::resolve_labels()
+{
+  for(auto& in : func->code){
+    if(in.opcode >= VM_JMP && in.opcode <= VM_JGE)
+      in.imm = labels[in.imm];
+  }
+  labels.clear();
+  goto_labels.clear();
+}
+
+/*
+parameters are passed in first registers of function,
+and are stored into their frame slots at entry
+*/
+void xlang::vm::gen_function(struct tree_node* trnode)
+{
+  struct st_func_info* finfo = trnode->symtab->func_info;
+  struct st_symbol_info* syminf = nullptr;
+  struct vm_var var;
+  long long offset = 0;
+  int index = function_index[finfo->func_name];
+
+  func = &functions[index];
+  func_symtab = trnode->symtab;
+  func->code.clear();
+  func->param_count = static_cast<int>(finfo->param_list.size());
+  func->reg_count = func->param_count;
+  locals.clear();
+
+  for(struct st_func_param_info* fparam : finfo->param_list){
+    if(fparam == nullptr || !get_var(fparam->symbol_info, &var)) continue;
+    var.offset = offset;
+    offset += (var_memory_size(var) + 7) & ~7;
+    locals[fparam->symbol_info->symbol] = var;
+  }
+  for(int i = 0; i < ST_SIZE; i++){
+    for(syminf = func_symtab->symbol_info[i]; syminf != nullptr; syminf = syminf->p_next){
+      if(!get_var(syminf, &var)) continue;
+      var.offset = offset;
+      offset += (var_memory_size(var) + 7) & ~7;
+      locals[syminf->symbol] = var;
+    }
+  }
+  func->frame_size = static_cast<int>((offset + 15) & ~15);
+
+  line = finfo->tok.loc.line;
+  next_reg = func->param_count;
+  int p = 0;
+  for(struct st_func_param_info* fparam : finfo->param_list){
+    struct vm_var* pvar = fparam ? search_var(fparam->symbol_info->symbol) : nullptr;
+    if(pvar != nullptr)
+      emit(store_opcode(pvar->kind, false, false), p, 0, 0).imm = pvar->offset;
+    p++;
+  }
+
+  gen_statement(trnode->statement);
+
+  //falling off end of function returns 0
+  int r = new_reg();
+  emit_li(r, 0);
+  emit(VM_RET, r, 0, 0);
+  resolve_labels();
+}
+
+//statements outside of functions are executed before main()
+void xlang::vm::gen_globals(struct tree_node* trhead)
+{
+  struct vm_function init;
+  init.name = "global statements";
+  init.param_count = 0;
+  init.reg_count = 0;
+  init.frame_size = 0;
+  functions.push_back(init);
+  init_function = static_cast<int>(functions.size()) - 1;
+  func = &functions[init_function];
+  func_symtab = nullptr;
+  locals.clear();
+  next_reg = 0;
+
+  for(struct tree_node* trnode = trhead; trnode != nullptr; trnode = trnode->p_next){
+    if(trnode->symtab != nullptr && trnode->symtab->func_info != nullptr) continue;
+    gen_statement(trnode->statement);
+  }
+  int r = new_reg();
+  emit_li(r, 0);
+  emit(VM_RET, r, 0, 0);
+  resolve_labels();
+}
+
+bool xlang::vm::compile(struct tree_node* trhead)
+{
+  struct tree_node* trnode = nullptr;
+  allocate_globals();
+
+  //functions are numbered first, so that calls before definition are known
+  for(trnode = trhead; trnode != nullptr; trnode = trnode->p_next){
+    if(trnode->symtab == nullptr || trnode->symtab->func_info == nullptr) continue;
+    struct st_func_info* finfo = trnode->symtab->func_info;
+    if(finfo->is_extern || function_index.count(finfo->func_name) > 0) continue;
+    struct vm_function f;
+    f.name = finfo->func_name;
+    f.param_count = f.reg_count = f.frame_size = 0;
+    function_index[f.name] = static_cast<int>(functions.size());
+    functions.push_back(f);
+  }
+  gen_globals(trhead);
+
+  for(trnode = trhead; trnode != nullptr && !failed; trnode = trnode->p_next){
+    if(trnode->symtab == nullptr || trnode->symtab->func_info == nullptr) continue;
+    if(trnode->symtab->func_info->is_extern) continue;
+    gen_function(trnode);
+  }
+
+  auto mfind = function_index.find("main");
+  if(failed) return false;
+  if(mfind == function_index.end()){
+    xlang::error::print_error(xlang::filename, "main() is not defined");
+    failed = true;
+  }else{
+    main_function = mfind->second;
+  }
+  func = nullptr;
+  return !failed;
+}
+
+//set handler of each instruction and target of each jump
+void xlang::vm::link(const void* const* handlers)
+{
+  for(auto& f : functions){
+    for(auto& in : f.code){
+      in.handler = handlers[in.opcode];
+      if(in.opcode >= VM_JMP && in.opcode <= VM_JGE)
+        in.target = f.code.data() + in.imm;
+    }
+  }
+  linked = true;
+}
+
+//active call of function
+struct vm_call
+{
+  const struct xlang::vm_insn* ret_pc;
+  xlang::vm_value* regs;
+  char* fp;
+  const struct xlang::vm_function* func;
+  int dest;
+};
+
+#define VM_NEXT() do{ pc++; goto *pc->handler; }while(0)
+#define VM_JUMP_IF(cond) do{ if(cond) pc = pc->target; else pc++; goto *pc->handler; }while(0)
+#define R(x) regs[pc->x]
+#define RI(x) static_cast<int>(regs[pc->x].i)
+#define WRAP(value) static_cast<int>(static_cast<unsigned>(value))
+#define ADDRESS(value) reinterpret_cast<char*>(value)
+
+#define VM_MEMORY_HANDLERS(kind, ctype, field) \
+  op_LDL_##kind: R(a).field = *reinterpret_cast<ctype*>(fp + pc->imm); VM_NEXT(); \
+  op_STL_##kind: *reinterpret_cast<ctype*>(fp + pc->imm) = static_cast<ctype>(R(a).field); VM_NEXT(); \
+  op_LDG_##kind: R(a).field = *reinterpret_cast<ctype*>(pc->imm); VM_NEXT(); \
+  op_STG_##kind: *reinterpret_cast<ctype*>(pc->imm) = static_cast<ctype>(R(a).field); VM_NEXT(); \
+  op_LD_##kind: R(a).field = *reinterpret_cast<ctype*>(ADDRESS(R(b).i) + pc->imm); VM_NEXT(); \
+  op_ST_##kind: *reinterpret_cast<ctype*>(ADDRESS(R(a).i) + pc->imm) \
+                  = static_cast<ctype>(R(b).field); VM_NEXT();
+
+/*
+execute function until it returns,
+calls are executed in same loop by keeping stack of active calls
+*/
+xlang::vm_value xlang::vm::execute(int index)
+{
+#define VM_HANDLER_ADDRESS(op) &&op_##op,
+  static const void* const handlers[] = { VM_OPCODES(VM_HANDLER_ADDRESS) };
+#undef VM_HANDLER_ADDRESS
+  std::vector<struct vm_call> calls;
+  const struct vm_function* cur = &functions[index];
+  const struct vm_insn* pc = cur->code.data();
+  vm_value* regs = reg_stack;
+  char* fp = frame_stack;
+  vm_value result;
+  std::string message;
+
+  if(!linked) link(handlers);
+  std::memset(fp, 0, cur->frame_size);
+  goto *pc->handler;
+
+  op_LI: R(a).i = pc->imm; VM_NEXT();
+  op_LF: R(a).f = pc->fimm; VM_NEXT();
+  op_MOV: R(a) = R(b); VM_NEXT();
+  op_ADDR: R(a).i = reinterpret_cast<long long>(fp + pc->imm); VM_NEXT();
+
+  VM_MEMORY_HANDLERS(I8, signed char, i)
+  VM_MEMORY_HANDLERS(I16, short, i)
+  VM_MEMORY_HANDLERS(I32, int, i)
+  VM_MEMORY_HANDLERS(I64, long long, i)
+  VM_MEMORY_HANDLERS(F32, float, f)
+  VM_MEMORY_HANDLERS(F64, double, f)
+
+  op_ADD: R(a).i = WRAP(R(b).i + R(c).i); VM_NEXT();
+  op_SUB: R(a).i = WRAP(R(b).i - R(c).i); VM_NEXT();
+  op_MUL: R(a).i = WRAP(static_cast<unsigned>(R(b).i) * static_cast<unsigned>(R(c).i)); VM_NEXT();
+  op_DIV:
+    if(RI(c) == 0) goto division_error;
+    R(a).i = (RI(b) == INT_MIN && RI(c) == -1) ? INT_MIN : RI(b) / RI(c);
+    VM_NEXT();
+  op_MOD:
+    if(RI(c) == 0) goto division_error;
+    R(a).i = (RI(c) == -1) ? 0 : RI(b) % RI(c);
+    VM_NEXT();
+  op_AND: R(a).i = RI(b) & RI(c); VM_NEXT();
+  op_OR: R(a).i = RI(b) | RI(c); VM_NEXT();
+  op_XOR: R(a).i = RI(b) ^ RI(c); VM_NEXT();
+  op_SHL: R(a).i = WRAP(static_cast<unsigned>(R(b).i) << (R(c).i & 31)); VM_NEXT();
+  op_SHR: R(a).i = RI(b) >> (R(c).i & 31); VM_NEXT();
+  op_ADDI: R(a).i = WRAP(R(b).i + pc->imm); VM_NEXT();
+  op_ADDP: R(a).i = R(b).i + R(c).i; VM_NEXT();
+  op_SUBP: R(a).i = R(b).i - R(c).i; VM_NEXT();
+  op_NEG: R(a).i = WRAP(0 - R(b).i); VM_NEXT();
+  op_NOT: R(a).i = ~RI(b); VM_NEXT();
+  op_LNOT: R(a).i = (R(b).i == 0); VM_NEXT();
+  op_SX8: R(a).i = static_cast<signed char>(R(b).i); VM_NEXT();
+  op_SX16: R(a).i = static_cast<short>(R(b).i); VM_NEXT();
+
+  op_EQ: R(a).i = (R(b).i == R(c).i); VM_NEXT();
+  op_NE: R(a).i = (R(b).i != R(c).i); VM_NEXT();
+  op_LT: R(a).i = (R(b).i < R(c).i); VM_NEXT();
+  op_LE: R(a).i = (R(b).i <= R(c).i); VM_NEXT();
+  op_GT: R(a).i = (R(b).i > R(c).i); VM_NEXT();
+  op_GE: R(a).i = (R(b).i >= R(c).i); VM_NEXT();
+
+  op_FADD: R(a).f = R(b).f + R(c).f; VM_NEXT();
+  op_FSUB: R(a).f = R(b).f - R(c).f; VM_NEXT();
+  op_FMUL: R(a).f = R(b).f * R(c).f; VM_NEXT();
+  op_FDIV: R(a).f = R(b).f / R(c).f; VM_NEXT();
+  op_FNEG: R(a).f = -R(b).f; VM_NEXT();
+  op_FROUND: R(a).f = static_cast<float>(R(b).f); VM_NEXT();
+  op_I2F: R(a).f = static_cast<double>(R(b).i); VM_NEXT();
+  op_F2I: R(a).i = static_cast<int>(R(b).f); VM_NEXT();
+
+  op_FEQ: R(a).i = (R(b).f == R(c).f); VM_NEXT();
+  op_FNE: R(a).i = (R(b).f != R(c).f); VM_NEXT();
+  op_FLT: R(a).i = (R(b).f < R(c).f); VM_NEXT();
+  op_FLE: R(a).i = (R(b).f <= R(c).f); VM_NEXT();
+  op_FGT: R(a).i = (R(b).f > R(c).f); VM_NEXT();
+  op_FGE: R(a).i = (R(b).f >= R(c).f); VM_NEXT();
+
+  op_JMP: pc = pc->target; goto *pc->handler;
+  op_JZ: VM_JUMP_IF(R(a).i == 0);
+  op_JNZ: VM_JUMP_IF(R(a).i != 0);
+  op_JEQ: VM_JUMP_IF(R(a).i == R(b).i);
+  op_JNE: VM_JUMP_IF(R(a).i != R(b).i);
+  op_JLT: VM_JUMP_IF(R(a).i < R(b).i);
+  op_JLE: VM_JUMP_IF(R(a).i <= R(b).i);
+  op_JGT: VM_JUMP_IF(R(a).i > R(b).i);
+  op_JGE: VM_JUMP_IF(R(a).i >= R(b).i);
+
+  op_CALL:
+    {
+      const struct vm_function* callee = &functions[pc->imm];
+      vm_value* cregs = regs + cur->reg_count;
+      char* cfp = fp + cur->frame_size;
+      if(calls.size() >= VM_CALL_DEPTH
+          || cregs + callee->reg_count > reg_stack + VM_REG_STACK_SIZE
+          || cfp + callee->frame_size > frame_stack + VM_FRAME_STACK_SIZE){
+        message = "stack overflow in call of "+callee->name+"()";
+        goto runtime_error;
+      }
+      for(int i = 0; i < pc->c; i++)
+        cregs[i] = regs[pc->b + i];
+      std::memset(cfp, 0, callee->frame_size);
+      calls.push_back({pc + 1, regs, fp, cur, pc->a});
+      regs = cregs;
+      fp = cfp;
+      cur = callee;
+      pc = callee->code.data();
+      goto *pc->handler;
+    }
+
+  op_CALLEXT:
+    {
+      const struct vm_extern_call& call = extern_calls[pc->imm];
+      R(a) = call.ffi->function(&regs[pc->b], call.types.c_str(), pc->c);
+      VM_NEXT();
+    }
+
+  op_RETV:
+    result.i = 0;
+    goto do_return;
+  op_RET:
+    result = R(a);
+  do_return:
+    if(calls.empty()) return result;
+    {
+      struct vm_call& caller = calls.back();
+      pc = caller.ret_pc;
+      regs = caller.regs;
+      fp = caller.fp;
+      cur = caller.func;
+      regs[caller.dest] = result;
+      calls.pop_back();
+    }
+    goto *pc->handler;
+
+  division_error:
+    message = "division by zero";
+  runtime_error:
+    std::fflush(stdout);
+    xlang::error::print_error(xlang::filename,
+              "runtime error at line "+std::to_string(pc->line)+": "+message);
+    failed = true;
+    result.i = 1;
+    return result;
+}
+
+#undef VM_NEXT
+#undef VM_JUMP_IF
+#undef R
+#undef RI
+#undef WRAP
+#undef ADDRESS
+#undef VM_MEMORY_HANDLERS
+
+//execute statements outside of functions and main(), value of main() is returned
+int xlang::vm::run()
+{
+  vm_value result;
+  if(failed || main_function < 0) return 1;
+  execute(init_function);
+  if(failed) return 1;
+  result = execute(main_function);
+  std::fflush(stdout);
+  if(failed) return 1;
+  return static_cast<int>(result.i);
+}
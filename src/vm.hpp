@@ -0,0 +1,244 @@
+/*
+*  src/vm.hpp
+*
+*  Copyright (C) 2019  Pritam Zope
+*/
+/*
+* Contains data/operations used in vm.cpp file by class vm,
+* register based bytecode and its interpreter used by --run.
+*/
+
+#ifndef VM_HPP
+#define VM_HPP
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include "token.hpp"
+#include "tree.hpp"
+#include "symtab.hpp"
+
+//size of memory used for local variables of all active calls
+#define VM_FRAME_STACK_SIZE (16 * 1024 * 1024)
+//count of registers of all active calls
+#define VM_REG_STACK_SIZE (1024 * 1024)
+//maximum depth of calls
+#define VM_CALL_DEPTH 100000
+
+/*
+opcodes of bytecode, a, b, c are register operands
+and imm is immediate value/displacement/target,
+  LDL/STL   : load/store of local variable at frame + imm
+  LDG/STG   : load/store of global variable at address imm
+  LD/ST     : load/store through address register + imm
+  ADD..SHR  : integer arithmetic, wrapped to int
+  ADDP/SUBP : pointer arithmetic
+  J*        : jump to target when condition is true
+*/
+#define VM_MEMORY_OPCODES(X, kind) \
+  X(LDL_##kind) X(STL_##kind) X(LDG_##kind) X(STG_##kind) X(LD_##kind) X(ST_##kind)
+
+#define VM_OPCODES(X) \
+  X(LI) X(LF) X(MOV) X(ADDR) \
+  VM_MEMORY_OPCODES(X, I8) VM_MEMORY_OPCODES(X, I16) VM_MEMORY_OPCODES(X, I32) \
+  VM_MEMORY_OPCODES(X, I64) VM_MEMORY_OPCODES(X, F32) VM_MEMORY_OPCODES(X, F64) \
+  X(ADD) X(SUB) X(MUL) X(DIV) X(MOD) X(AND) X(OR) X(XOR) X(SHL) X(SHR) \
+  X(ADDI) X(ADDP) X(SUBP) X(NEG) X(NOT) X(LNOT) X(SX8) X(SX16) \
+  X(EQ) X(NE) X(LT) X(LE) X(GT) X(GE) \
+  X(FADD) X(FSUB) X(FMUL) X(FDIV) X(FNEG) X(FROUND) X(I2F) X(F2I) \
+  X(FEQ) X(FNE) X(FLT) X(FLE) X(FGT) X(FGE) \
+  X(JMP) X(JZ) X(JNZ) X(JEQ) X(JNE) X(JLT) X(JLE) X(JGT) X(JGE) \
+  X(CALL) X(CALLEXT) X(RET) X(RETV)
+
+namespace xlang
+{
+
+typedef enum{
+#define VM_OPCODE_ENUM(op) VM_##op,
+  VM_OPCODES(VM_OPCODE_ENUM)
+#undef VM_OPCODE_ENUM
+  VM_OPCODE_COUNT
+}vm_opcode_t;
+
+//type of value in register
+typedef enum{
+  VM_INT,     //int, sign extended
+  VM_FLOAT,   //float/double, kept as double
+  VM_PTR      //host address
+}vm_type_t;
+
+//type of variable in memory, index of load/store opcodes
+typedef enum{
+  VM_KIND_I8,
+  VM_KIND_I16,
+  VM_KIND_I32,
+  VM_KIND_I64,
+  VM_KIND_F32,
+  VM_KIND_F64
+}vm_kind_t;
+
+union vm_value
+{
+  long long i;
+  double f;
+};
+
+//one bytecode instruction,
+//handler is address of its code in interpreter set when program is linked
+struct vm_insn
+{
+  const void* handler;
+  int opcode;
+  int a, b, c;
+  int line;
+  union{
+    long long imm;
+    double fimm;
+    const struct vm_insn* target;
+  };
+};
+
+struct vm_function
+{
+  std::string name;
+  std::vector<struct vm_insn> code;
+  int param_count;
+  int reg_count;
+  int frame_size;
+};
+
+//variable in frame of function or in global memory
+struct vm_var
+{
+  bool is_global;
+  long long offset;   //frame offset, or address of global
+  vm_kind_t kind;     //kind of scalar, or of element of array
+  int size;           //size of scalar or element
+  bool is_array;
+  std::vector<int> dims;
+  int ptr_level;
+  token type;
+};
+
+//C library function callable through extern declaration,
+//types has 'i', 'f', 's'(float parameter) or 'p' for each argument
+typedef vm_value (*vm_ffi_t)(const vm_value*, const char*, int);
+
+struct vm_ffi
+{
+  const char* name;
+  vm_ffi_t function;
+  bool float_return;
+};
+
+//ffi is null when extern function is called natively by jit
+struct vm_extern_call
+{
+  std::string name;
+  const struct vm_ffi* ffi;
+  std::string types;
+  vm_type_t return_type;
+  bool single_return;   //declared return type is float
+};
+
+class vm
+{
+  public:
+    //native_externs does not limit extern functions to ffi table,
+    //they are called by jit
+    vm(bool native_externs = false);
+    ~vm();
+    //lower analyzed tree into bytecode, false if it uses unsupported constructs
+    bool compile(struct tree_node*);
+    //execute main() and return its value
+    int run();
+
+    friend class jit;
+
+  private:
+    bool native_externs;
+    std::vector<struct vm_function> functions;
+    std::map<std::string, int> function_index;
+    std::vector<struct vm_extern_call> extern_calls;
+    std::map<std::string, struct vm_var> globals;
+    std::list<std::string> strings;
+    char* global_memory = nullptr;
+    char* frame_stack = nullptr;
+    vm_value* reg_stack = nullptr;
+    int init_function = -1;
+    int main_function = -1;
+
+    //state of function being compiled
+    struct vm_function* func = nullptr;
+    struct st_node* func_symtab = nullptr;
+    std::map<std::string, struct vm_var> locals;
+    int next_reg = 0;
+    int line = 0;
+    std::vector<int> labels;
+    std::map<std::string, int> goto_labels;
+    std::vector<int> break_labels;
+    std::vector<int> continue_labels;
+    bool failed = false;
+    bool linked = false;
+
+    void unsupported(std::string, loc_t);
+    int new_reg();
+    int new_label();
+    void bind_label(int);
+    struct vm_insn& emit(int, int, int, int);
+    void emit_li(int, long long);
+    void emit_jump(int, int, int, int);
+
+    int type_size(token);
+    bool get_var(struct st_symbol_info*, struct vm_var*);
+    void allocate_globals();
+    struct vm_var* search_var(std::string);
+    vm_type_t kind_type(vm_kind_t);
+    vm_type_t return_type(struct st_func_info*);
+    int load_opcode(vm_kind_t, bool, bool);
+    int store_opcode(vm_kind_t, bool, bool);
+    long long get_string(std::string);
+
+    void convert(int, vm_type_t, vm_type_t);
+    void gen_truth(int, vm_type_t);
+    vm_type_t gen_arithmetic(token_t, int, vm_type_t, int, vm_type_t);
+    vm_type_t gen_primary_expr(struct primary_expr*, int);
+    vm_type_t gen_binary_expr(struct primary_expr*, int);
+    void gen_branch(struct primary_expr*, bool, int);
+    void gen_condition(struct expr*, bool, int);
+
+    //lvalue is variable, or element at address in register
+    struct vm_lvalue{
+      struct vm_var* var;
+      int addr_reg;   //-1 when variable itself
+      long long disp;
+      vm_kind_t kind;
+      vm_type_t type;
+    };
+    void gen_subscript(token, int);
+    bool gen_lvalue(struct id_expr*, struct vm_lvalue*);
+    vm_type_t gen_load(struct vm_lvalue&, int);
+    void gen_store(struct vm_lvalue&, int, vm_type_t);
+    vm_type_t gen_id_expr(struct id_expr*, int);
+    vm_type_t gen_assgn_expr(struct assgn_expr*, int);
+    vm_type_t gen_sizeof_expr(struct sizeof_expr*, int);
+    vm_type_t gen_cast_expr(struct cast_expr*, int);
+    vm_type_t gen_funccall_expr(struct func_call_expr*, int);
+    vm_type_t gen_expr(struct expr*, int);
+
+    void gen_statement(struct stmt*);
+    void gen_iteration_statement(struct iter_stmt*);
+    void gen_jump_statement(struct jump_stmt*);
+    void gen_function(struct tree_node*);
+    void gen_globals(struct tree_node*);
+    void resolve_labels();
+    void link(const void* const*);
+
+    vm_value execute(int);
+};
+
+}
+
+#endif
+
@@ -11,6 +11,12 @@
 #include "parser.hpp"
 #include "convert.hpp"
 #include "x86_gen.hpp"
+#include "peephole.hpp"
+#include "stats.hpp"
+#include "cost.hpp"
+#include "size_report.hpp"
+#include "tailcall.hpp"
+#include "profile.hpp"
 
 using namespace xlang;
 
@@ -186,6 +192,228 @@ void xlang::x86_gen::max_datatype_size(struct primary_expr* pexpr, int *dsize)
   }
 }
 
+extern bool target_x86_64;
+
+//size of pointer, 8 bytes on x86_64 target
+int xlang::x86_gen::pointer_size()
+{
+  return (target_x86_64 ? 8 : 4);
+}
+
+//register holding pointer value, rax on x86_64 target
+regs_t xlang::x86_gen::pointer_register()
+{
+  return (target_x86_64 ? RAX : EAX);
+}
+
+//returns true if function parameter is float/double non-pointer type
+bool xlang::x86_gen::is_float_param(struct st_func_param_info* fparam)
+{
+  token type;
+  if(fparam == nullptr || fparam->type_info == nullptr) return false;
+  if(fparam->type_info->type != SIMPLE_TYPE) return false;
+  if(fparam->symbol_info != nullptr && fparam->symbol_info->is_ptr) return false;
+  type = fparam->type_info->type_specifier.simple_type[0];
+  return (type.token == KEY_FLOAT || type.token == KEY_DOUBLE);
+}
+
+//identifiers used as values(not as called function name)
+void xlang::x86_gen::get_value_ids(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr) return;
+  if(pexpr->is_id)
+    value_ids.insert(pexpr->tok.lexeme);
+  get_value_ids(pexpr->left);
+  get_value_ids(pexpr->right);
+  get_value_ids(pexpr->unary_node);
+}
+
+void xlang::x86_gen::get_value_ids(struct id_expr* idexpr)
+{
+  if(idexpr == nullptr) return;
+  if(idexpr->is_id)
+    value_ids.insert(idexpr->tok.lexeme);
+  get_value_ids(idexpr->left);
+  get_value_ids(idexpr->right);
+  get_value_ids(idexpr->unary);
+}
+
+void xlang::x86_gen::get_value_ids(struct expr* exp)
+{
+  if(exp == nullptr) return;
+
+  switch(exp->expr_kind){
+    case PRIMARY_EXPR :
+      get_value_ids(exp->primary_expression);
+      break;
+    case ASSGN_EXPR :
+      get_value_ids(exp->assgn_expression->id_expression);
+      get_value_ids(exp->assgn_expression->expression);
+      break;
+    case CAST_EXPR :
+      get_value_ids(exp->cast_expression->target);
+      break;
+    case ID_EXPR :
+      get_value_ids(exp->id_expression);
+      break;
+    case FUNC_CALL_EXPR :
+      //function called through record member or pointer
+      if(exp->func_call_expression->function != nullptr
+         && (exp->func_call_expression->function->left != nullptr
+             || exp->func_call_expression->function->right != nullptr))
+        get_value_ids(exp->func_call_expression->function);
+      for(auto e : exp->func_call_expression->expression_list)
+        get_value_ids(e);
+      break;
+    default: break;
+  }
+}
+
+void xlang::x86_gen::get_value_ids(struct stmt* stm)
+{
+  struct iter_stmt* iter = nullptr;
+
+  while(stm != nullptr){
+    switch(stm->type){
+      case EXPR_STMT :
+        get_value_ids(stm->expression_statement->expression);
+        break;
+      case SELECT_STMT :
+        get_value_ids(stm->selection_statement->condition);
+        get_value_ids(stm->selection_statement->if_statement);
+        get_value_ids(stm->selection_statement->else_statement);
+        break;
+      case ITER_STMT :
+        iter = stm->iteration_statement;
+        switch(iter->type){
+          case WHILE_STMT :
+            get_value_ids(iter->_while.condition);
+            get_value_ids(iter->_while.statement);
+            break;
+          case DOWHILE_STMT :
+            get_value_ids(iter->_dowhile.condition);
+            get_value_ids(iter->_dowhile.statement);
+            break;
+          case FOR_STMT :
+            get_value_ids(iter->_for.init_expression);
+            get_value_ids(iter->_for.condition);
+            get_value_ids(iter->_for.update_expression);
+            get_value_ids(iter->_for.statement);
+            break;
+        }
+        break;
+      case JUMP_STMT :
+        get_value_ids(stm->jump_statement->expression);
+        break;
+      case ASM_STMT :
+        for(struct asm_stmt* asmstmt = stm->asm_statement; asmstmt != nullptr;
+            asmstmt = asmstmt->p_next){
+          asm_templates.push_back(asmstmt->asm_template.lexeme);
+          for(auto e : asmstmt->output_operand)
+            get_value_ids(e->expression);
+          for(auto e : asmstmt->input_operand)
+            get_value_ids(e->expression);
+        }
+        break;
+      default: break;
+    }
+    stm = stm->p_next;
+  }
+}
+
+/*
+select functions called with register arguments on x86,
+functions which are not global/extern and whose address is never taken,
+so every call of them is generated in this file
+*/
+void xlang::x86_gen::get_register_call_funcs(struct tree_node* trhead)
+{
+  struct tree_node* trnode = trhead;
+  struct st_func_info* finfo = nullptr;
+  bool is_used = false;
+
+  value_ids.clear();
+  asm_templates.clear();
+  register_call_funcs.clear();
+  while(trnode != nullptr){
+    get_value_ids(trnode->statement);
+    trnode = trnode->p_next;
+  }
+
+  for(trnode = trhead; trnode != nullptr; trnode = trnode->p_next){
+    if(trnode->symtab == nullptr || trnode->symtab->func_info == nullptr)
+      continue;
+    finfo = trnode->symtab->func_info;
+    if(finfo->is_global || finfo->is_extern) continue;
+    if(value_ids.find(finfo->func_name) != value_ids.end()) continue;
+    is_used = false;
+    for(auto& t : asm_templates){
+      if(t.find(finfo->func_name) != std::string::npos){
+        is_used = true;
+        break;
+      }
+    }
+    if(!is_used)
+      register_call_funcs.insert(finfo->func_name);
+  }
+  value_ids.clear();
+  asm_templates.clear();
+}
+
+/*
+returns register index(0 for ecx, 1 for edx) of parameter at index
+if it is passed in register, otherwise -1.
+first two non-float parameters of register call function
+are passed in ecx and edx, others are pushed on stack
+*/
+int xlang::x86_gen::get_param_register(struct st_func_info* finfo, int index)
+{
+  int count = 0, i = 0;
+
+  if(finfo == nullptr) return -1;
+  if(register_call_funcs.find(finfo->func_name) == register_call_funcs.end())
+    return -1;
+  for(struct st_func_param_info* fparam : finfo->param_list){
+    if(fparam == nullptr) break;
+    if(i == index){
+      if(is_float_param(fparam) || count >= 2) return -1;
+      return count;
+    }
+    if(!is_float_param(fparam))
+      count++;
+    i++;
+  }
+  return -1;
+}
+
+/*
+store x86 register parameters into their stack slots
+allocated by get_func_local_members()
+*/
+void xlang::x86_gen::gen_x86_param_spill()
+{
+  static const regs_t arg_regs[] = {ECX, EDX};
+  struct insn* in = nullptr;
+  struct func_member fmem;
+  int index = 0, r = 0;
+
+  for(struct st_func_param_info* fparam : func_symtab->func_info->param_list){
+    if(fparam == nullptr) break;
+    r = get_param_register(func_symtab->func_info, index++);
+    if(r < 0) continue;
+    if(!get_function_local_member(&fmem, fparam->symbol_info->tok)) continue;
+    in = get_insn(MOV, 2);
+    in->operand_1->type = MEMORY;
+    in->operand_1->mem.mem_type = LOCAL;
+    in->operand_1->mem.mem_size = 4;
+    in->operand_1->mem.fp_disp = fmem.fp_disp;
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = arg_regs[r];
+    in->comment = "    ; "+fparam->symbol_info->symbol;
+    instructions.push_back(in);
+  }
+}
+
 /*
 generate function local members on stack
 */
@@ -196,6 +424,7 @@ void xlang::x86_gen::get_func_local_members()
   size_t index;
   int fp = 0;
   int total = 0;
+  int int_params = 0, float_params = 0;
   struct st_symbol_info* syminf = nullptr;
   if(func_symtab == nullptr) return;
   /* allocate members from function symbol table
@@ -208,10 +437,10 @@ void xlang::x86_gen::get_func_local_members()
       switch(syminf->type_info->type){
         case SIMPLE_TYPE :
           if(syminf->is_ptr){
-            fm.insize = 4;
-            fp = fp - 4;
+            fm.insize = pointer_size();
+            fp = fp - fm.insize;
             fm.fp_disp = fp;
-            total += 4;
+            total += fm.insize;
           }else{
             fm.insize = data_type_size(syminf->type_info->type_specifier.simple_type[0]);
             fp = fp - fm.insize;
@@ -221,10 +450,10 @@ void xlang::x86_gen::get_func_local_members()
           flm.members.insert(std::pair<std::string, struct func_member>(syminf->symbol, fm));
           break;
         case RECORD_TYPE :
-          fm.insize = 4;
-          fp = fp - 4;
+          fm.insize = pointer_size();
+          fp = fp - fm.insize;
           fm.fp_disp = fp;
-          total += 4;
+          total += fm.insize;
           flm.members.insert(std::pair<std::string, struct func_member>(syminf->symbol, fm));
           break;
         default: break;
@@ -232,41 +461,70 @@ void xlang::x86_gen::get_func_local_members()
       syminf = syminf->p_next;
     }
   }
-  flm.total_size = total;
 
+  if(target_x86_64){
+    /*
+      x86_64 System V passes first 6 integer/pointer parameters
+      in rdi,rsi,rdx,rcx,r8,r9 and first 8 float parameters in xmm0-xmm7,
+      they are spilled into 8 byte slots below locals in function prologue.
+      remaining parameters are on stack above return address,
+      8(rbp) contains return address, so they start at 16(rbp)
+    */
+    int stack_fp = 8;
+    for(struct st_func_param_info* fparam : func_symtab->func_info->param_list){
+      if(fparam == nullptr) break;
+      if(fparam->type_info->type == SIMPLE_TYPE && !fparam->symbol_info->is_ptr){
+        fm.insize = data_type_size(fparam->type_info->type_specifier.simple_type[0]);
+      }else{
+        fm.insize = 8;
+      }
+      if(is_float_param(fparam) ? float_params++ < 8 : int_params++ < 6){
+        fp = fp - 8;
+        total += 8;
+        fm.fp_disp = fp;
+      }else{
+        stack_fp = stack_fp + 8;
+        fm.fp_disp = stack_fp;
+      }
+      flm.members.insert(std::pair<std::string, struct func_member>
+              (fparam->symbol_info->symbol, fm));
+    }
+    //keep stack pointer 16 byte aligned at function calls
+    total = (total + 15) & ~15;
+    flm.total_size = total;
+    func_members.insert(std::pair<std::string,
+          struct func_local_members>(func_symtab->func_info->func_name, flm));
+    return;
+  }
   /*
     allocate function parameters on stack
     fp = 4(ebp) always contain return address
     when call invoked.
-    so allocating above that
+    so allocating above that,
+    parameters passed in registers are spilled into slots below locals
   */
-  fp = 4;
+  int stack_fp = 4;
+  index = 0;
   for(struct st_func_param_info* fparam : func_symtab->func_info->param_list){
     if(fparam == nullptr) break;
-    switch(fparam->type_info->type){
-      case SIMPLE_TYPE :
-        if(fparam->symbol_info->is_ptr){
-            fm.insize = 4;
-            fp = fp + 4;
-            fm.fp_disp = fp;
-          }else{
-            fm.insize = data_type_size(fparam->type_info->type_specifier.simple_type[0]);
-            fp = fp + 4;
-            fm.fp_disp = fp;
-          }
-          flm.members.insert(std::pair<std::string, struct func_member>
-                (fparam->symbol_info->symbol, fm));
-          break;
-        case RECORD_TYPE :
-          fm.insize = 4;
-          fp = fp + 4;
-          fm.fp_disp = fp;
-          flm.members.insert(std::pair<std::string, struct func_member>
-                (fparam->symbol_info->symbol, fm));
-          break;
-        default: break;
-      }
+    if(fparam->type_info->type == SIMPLE_TYPE && !fparam->symbol_info->is_ptr){
+      fm.insize = data_type_size(fparam->type_info->type_specifier.simple_type[0]);
+    }else{
+      fm.insize = 4;
+    }
+    if(get_param_register(func_symtab->func_info, static_cast<int>(index)) >= 0){
+      fp = fp - 4;
+      total += 4;
+      fm.fp_disp = fp;
+    }else{
+      stack_fp = stack_fp + 4;
+      fm.fp_disp = stack_fp;
+    }
+    flm.members.insert(std::pair<std::string, struct func_member>
+          (fparam->symbol_info->symbol, fm));
+    index++;
   }
+  flm.total_size = total;
 
   func_members.insert(std::pair<std::string,
         struct func_local_members>(func_symtab->func_info->func_name, flm));
@@ -322,6 +580,8 @@ insnsize_t xlang::x86_gen::get_insn_size_type(int sz)
     return DWORD;
   else if(sz == 8)
     return QWORD;
+  else if(sz == 16)
+    return OWORD;
   else
     return INSZNONE;
 }
@@ -379,25 +639,30 @@ void xlang::x86_gen::insert_comment(std::string cmnt)
   instructions.push_back(in);
 }
 
-//search given data in data section vector
-struct data* xlang::x86_gen::search_data(std::string dt)
+//add data pushed into data section after last search, first one is kept for value
+void xlang::x86_gen::index_data_section()
 {
-  for(struct data* d : data_section){
-    if(dt == d->value)
-      return d;
+  for(; data_indexed < data_section.size(); data_indexed++){
+    struct data* d = data_section[data_indexed];
+    data_values.insert(std::pair<std::string, struct data*>(d->value, d));
   }
-  return nullptr;
 }
 
 //search given data in data section vector
+struct data* xlang::x86_gen::search_data(std::string dt)
+{
+  std::unordered_map<std::string, struct data*>::iterator it;
+  index_data_section();
+  it = data_values.find(dt);
+  if(it == data_values.end())
+    return nullptr;
+  return it->second;
+}
+
+//search given string in data section vector by its hex value
 struct data* xlang::x86_gen::search_string_data(std::string dt)
 {
-  std::string hstr = get_hex_string(dt);
-  for(struct data* d : data_section){
-    if(get_hex_string(dt) == d->value)
-      return d;
-  }
-  return nullptr;
+  return search_data(get_hex_string(dt));
 }
 
 //return escape sequence character hex value in 1 byte
@@ -542,8 +807,9 @@ regs_t xlang::x86_gen::gen_int_primexp_single_assgn(struct primary_expr* pexpr,
         in->operand_2->mem.mem_type = LOCAL;
         syminf = search_id(pexpr->id_info->symbol);
         if(syminf != nullptr && syminf->is_ptr){
-          in->operand_1->reg = EAX;
-          in->operand_2->mem.mem_size = 4;
+          rs = pointer_register();
+          in->operand_1->reg = rs;
+          in->operand_2->mem.mem_size = pointer_size();
         }else{
           in->operand_1->reg = rs;
           in->operand_2->mem.mem_size = dtsize;
@@ -559,8 +825,9 @@ regs_t xlang::x86_gen::gen_int_primexp_single_assgn(struct primary_expr* pexpr,
         in->operand_2->mem.mem_type = GLOBAL;
         syminf = search_id(pexpr->id_info->symbol);
         if(syminf != nullptr && syminf->is_ptr){
-          in->operand_1->reg = EAX;
-          in->operand_2->mem.mem_size = 4;
+          rs = pointer_register();
+          in->operand_1->reg = rs;
+          in->operand_2->mem.mem_size = pointer_size();
         }else{
           in->operand_1->reg = rs;
           in->operand_2->mem.mem_size = dtsize;
@@ -653,19 +920,256 @@ regs_t xlang::x86_gen::gen_string_literal_primary_expr(struct primary_expr *pexp
 
       struct insn* in = get_insn(MOV, 2);
       in->operand_1->type = REGISTER;
-      in->operand_1->reg = EAX;
+      in->operand_1->reg = pointer_register();
       in->operand_2->type = MEMORY;
       in->operand_2->mem.mem_type = GLOBAL;
       in->operand_2->mem.mem_size = -1;
       in->operand_2->mem.name = dt->symbol;
       instructions.push_back(in);
 
-      return EAX;
+      return pointer_register();
     }
   }
   return RNONE;
 }
 
+extern bool optimize;
+
+//add instruction with register and register/literal operands
+struct insn* xlang::x86_gen::gen_reg_insn(insn_t instype, regs_t r1, regs_t r2)
+{
+  struct insn* in = get_insn(instype, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = r1;
+  in->operand_2->type = REGISTER;
+  in->operand_2->reg = r2;
+  instructions.push_back(in);
+  return in;
+}
+
+struct insn* xlang::x86_gen::gen_reg_insn(insn_t instype, regs_t r, long long value)
+{
+  struct insn* in = get_insn(instype, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = r;
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = std::to_string(value);
+  instructions.push_back(in);
+  return in;
+}
+
+//lea r, [r + r * scale]
+void xlang::x86_gen::gen_scaled_lea(regs_t r, int scale)
+{
+  struct insn* in = get_insn(LEA, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = r;
+  in->operand_2->type = MEMORY;
+  in->operand_2->mem.mem_type = GLOBAL;
+  in->operand_2->mem.mem_size = 0;
+  in->operand_2->mem.name = reg->reg_name(r);
+  in->operand_2->is_array = true;
+  in->operand_2->reg = r;
+  in->operand_2->arr_disp = scale;
+  instructions.push_back(in);
+}
+
+/*
+returns true if int operator node has literal right operand
+which is computed without mul/div instructions,
+x * c, x / c and x % c, for 4 byte non-pointer values in eax,
+tmp is scratch register other than edx
+*/
+bool xlang::x86_gen::is_const_arthm(struct primary_expr* pexp, struct primary_expr* left,
+                                    struct primary_expr* right, regs_t r, regs_t tmp,
+                                    int dtsize, int* value)
+{
+  if(!optimize || dtsize != 4) return false;
+  if(pexp->tok.token != ARTHM_MUL && pexp->tok.token != ARTHM_DIV
+      && pexp->tok.token != ARTHM_MOD)
+    return false;
+  if(r != EAX || tmp == EAX || tmp == EDX || tmp == RNONE) return false;
+  if(right == nullptr || right != pexp->right || right->is_oprtr || right->is_id)
+    return false;
+  if(!is_literal(right->tok) || right->tok.token == LIT_CHAR
+      || right->tok.token == LIT_FLOAT)
+    return false;
+  if(left != nullptr && left->id_info != nullptr && left->id_info->is_ptr)
+    return false;
+  *value = get_decimal(right->tok);
+  return (*value > 0);
+}
+
+/*
+multiply register by constant with lea/shl/add/sub,
+c = m * 2^k where m is 1, 3, 5, 9, product of two of them, 2^j + 1 or 2^j - 1,
+otherwise imul r, c
+*/
+void xlang::x86_gen::gen_const_multiply(regs_t r, regs_t tmp, int value)
+{
+  const int scales[] = {3, 5, 9};
+  long long m = value;
+  int shift = 0, j = 0;
+  bool done = false;
+
+  while((m & 1) == 0){
+    m >>= 1;
+    shift++;
+  }
+
+  if(m == 3 || m == 5 || m == 9){
+    gen_scaled_lea(r, m - 1);
+    done = true;
+  }
+  for(int a : scales){
+    if(done) break;
+    for(int b : scales){
+      if(m == a * b){
+        gen_scaled_lea(r, a - 1);
+        gen_scaled_lea(r, b - 1);
+        done = true;
+        break;
+      }
+    }
+  }
+  if(!done && m > 1){
+    for(j = 1; j < 31; j++){
+      if(m == (1LL << j) + 1 || m == (1LL << j) - 1){
+        gen_reg_insn(MOV, tmp, r);
+        gen_reg_insn(SHL, r, j);
+        gen_reg_insn((m == (1LL << j) + 1) ? ADD : SUB, r, tmp);
+        done = true;
+        break;
+      }
+    }
+  }
+  if(!done && m > 1){
+    gen_reg_insn(IMUL, r, value);
+    xlang::stats::count("strength.const-multiply");
+    return;
+  }
+  if(shift > 0)
+    gen_reg_insn(SHL, r, shift);
+  xlang::stats::count("strength.const-multiply");
+}
+
+/*
+get magic number and shift of signed 32 bit division by d >= 2
+from Hacker's Delight(chapter 10), n / d = (mulhi(n, magic) >> shift) + sign of n
+*/
+void xlang::x86_gen::get_signed_magic(int d, int* magic, int* shift)
+{
+  const unsigned int two31 = 0x80000000;
+  unsigned int ad = d;
+  unsigned int anc = two31 - 1 - two31 % ad;
+  unsigned int q1 = two31 / anc, r1 = two31 - q1 * anc;
+  unsigned int q2 = two31 / ad, r2 = two31 - q2 * ad;
+  unsigned int delta = 0;
+  int p = 31;
+
+  do{
+    p++;
+    q1 = 2 * q1;
+    r1 = 2 * r1;
+    if(r1 >= anc){
+      q1++;
+      r1 -= anc;
+    }
+    q2 = 2 * q2;
+    r2 = 2 * r2;
+    if(r2 >= ad){
+      q2++;
+      r2 -= ad;
+    }
+    delta = ad - r2;
+  }while(q1 < delta || (q1 == delta && r1 == 0));
+
+  *magic = static_cast<int>(q2 + 1);
+  *shift = p - 32;
+}
+
+/*
+signed division/modulus of eax by constant, result in eax,
+tmp must not be edx, which is overwritten
+x / 2^k: bias = (x >> 31) >>> (32 - k), (x + bias) >> k
+x % 2^k: ((x + bias) & (2^k - 1)) - bias
+otherwise multiply by magic number and take high 32 bits in edx
+*/
+void xlang::x86_gen::gen_const_divide(regs_t tmp, int value, bool modulus)
+{
+  struct insn* in = nullptr;
+  int k = 0, magic = 0, shift = 0;
+
+  if(value == 1){
+    if(modulus)
+      gen_reg_insn(XOR, EAX, EAX);
+    return;
+  }
+
+  if((value & (value - 1)) == 0){
+    while((1 << k) != value)
+      k++;
+    gen_reg_insn(MOV, tmp, EAX);
+    if(k > 1)
+      gen_reg_insn(SAR, tmp, 31);
+    gen_reg_insn(SHR, tmp, 32 - k);
+    gen_reg_insn(ADD, EAX, tmp);
+    if(modulus){
+      gen_reg_insn(AND, EAX, value - 1);
+      gen_reg_insn(SUB, EAX, tmp);
+    }else{
+      gen_reg_insn(SAR, EAX, k);
+    }
+    xlang::stats::count("strength.const-divide");
+    return;
+  }
+
+  get_signed_magic(value, &magic, &shift);
+  gen_reg_insn(MOV, tmp, EAX);
+  gen_reg_insn(MOV, EDX, magic);
+  in = get_insn(IMUL, 1);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = EDX;
+  insncls->delete_operand(&in->operand_2);
+  instructions.push_back(in);
+  if(magic < 0)
+    gen_reg_insn(ADD, EDX, tmp);
+  if(shift > 0)
+    gen_reg_insn(SAR, EDX, shift);
+  gen_reg_insn(MOV, EAX, tmp);
+  gen_reg_insn(SHR, EAX, 31);
+  gen_reg_insn(ADD, EDX, EAX);
+  if(modulus){
+    gen_reg_insn(IMUL, EDX, value);
+    gen_reg_insn(MOV, EAX, tmp);
+    gen_reg_insn(SUB, EAX, EDX);
+  }else{
+    gen_reg_insn(MOV, EAX, EDX);
+  }
+  xlang::stats::count("strength.const-divide");
+}
+
+//int division is signed, edx is sign extension of eax for 4 byte division
+insn_t xlang::x86_gen::gen_div_sign_extend(insn_t op, int dtsize)
+{
+  struct insn* in = nullptr;
+  if(op != DIV || dtsize != 4) return op;
+  in = get_insn(CDQ, 0);
+  insncls->delete_operand(&in->operand_1);
+  insncls->delete_operand(&in->operand_2);
+  instructions.push_back(in);
+  return IDIV;
+}
+
+//generate x * c, x / c or x % c where x is in eax
+void xlang::x86_gen::gen_const_arthm(struct primary_expr* pexp, regs_t tmp, int value)
+{
+  if(pexp->tok.token == ARTHM_MUL)
+    gen_const_multiply(EAX, tmp, value);
+  else
+    gen_const_divide(tmp, value, pexp->tok.token == ARTHM_MOD);
+}
+
 /*
 generate int type x86 assembly of primary expression
 */
@@ -683,6 +1187,8 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
   struct func_member fmem;
   std::stack<regs_t> result;
   std::set<struct primary_expr*> common_node_set;
+  bool const_op = false;
+  int const_value = 0;
 
   if(pexpr == nullptr) return RNONE;
   //get maximum data type size
@@ -813,10 +1319,11 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
 
         //get arithmetic operator instruction
         op = get_arthm_op(pexp->tok.lexeme);
+        const_op = is_const_arthm(pexp, fact1, fact2, r1, r2, dtsize, &const_value);
 
         if(!fact2->is_id){
-          //if left/right shifts, then do nothing
-          if(op == SHL || op == SHR){
+          //if left/right shifts or constant multiply/divide, then do nothing
+          if(op == SHL || op == SHR || const_op){
           }else{
             in = get_insn(MOV, 2);
             in->operand_1->type = REGISTER;
@@ -858,7 +1365,10 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
 
         reg->free_register(r2);
 
-        if(op == MUL || op == DIV){
+        if(const_op){
+          gen_const_arthm(pexp, r2, const_value);
+        }else if(op == MUL || op == DIV){
+          op = gen_div_sign_extend(op, dtsize);
           in = get_insn(op, 1);
           in->operand_1->type = REGISTER;
           in->operand_1->reg = r2;
@@ -905,7 +1415,9 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
         r2 = reg->allocate_register(dtsize);
         fact1 = pexp_stack.top();
         pexp_stack.pop();
-        if(!fact1->is_id){
+        const_op = is_const_arthm(pexp, pexp->left, fact1, r1, r2, dtsize, &const_value);
+        //literal operand of constant multiply/divide is not loaded
+        if(!fact1->is_id && !const_op){
           in = get_insn(MOV, 2);
           in->operand_1->type = REGISTER;
           in->operand_1->reg = r2;
@@ -913,7 +1425,7 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
           in->operand_2->literal = fact1->tok.lexeme;
           instructions.push_back(in);
           in = nullptr;
-        }else{
+        }else if(fact1->is_id){
           if(get_function_local_member(&fmem, fact1->id_info->tok)){
             in = get_insn(MOV, 2);
             in->operand_1->type = REGISTER;
@@ -942,7 +1454,10 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
         reg->free_register(r2);
 
         op = get_arthm_op(pexp->tok.lexeme);
-        if(op == MUL || op == DIV){
+        if(const_op){
+          gen_const_arthm(pexp, r2, const_value);
+        }else if(op == MUL || op == DIV){
+          op = gen_div_sign_extend(op, dtsize);
           in = get_insn(op, 1);
           in->operand_1->type = REGISTER;
           in->operand_1->reg = r2;
@@ -1007,6 +1522,7 @@ regs_t xlang::x86_gen::gen_int_primary_expression(struct primary_expr *pexpr)
 
         op = get_arthm_op(pexp->tok.lexeme);
         if(op == MUL || op == DIV){
+          op = gen_div_sign_extend(op, dtsize);
           in = get_insn(op, 1);
           in->operand_1->type = REGISTER;
           in->operand_1->reg = szreg(dtsize);
@@ -1073,15 +1589,19 @@ insn_t xlang::x86_gen::get_farthm_op(lexeme_t symbol, bool reverse_ins)
 //create float data in data section
 struct data* xlang::x86_gen::create_float_data(declspace_t ds, std::string value)
 {
-  struct data* dt = search_data(value);
-  if(dt != nullptr){
-    return dt;
+  struct data* dt = nullptr;
+  //same value with different declared size is a different constant
+  std::string key = insncls->declspace_name(ds)+" "+value;
+  std::map<std::string, struct data*>::iterator it = float_data_pool.find(key);
+  if(it != float_data_pool.end()){
+    return it->second;
   }
   dt = insncls->get_data_mem();
   dt->symbol = "float_val"+std::to_string(float_data_count);
   dt->type = ds;
   dt->value = value;
   data_section.push_back(dt);
+  float_data_pool.insert(std::pair<std::string, struct data*>(key, dt));
   float_data_count++;
   return dt;
 }
@@ -1323,43 +1843,457 @@ void xlang::x86_gen::gen_float_primary_expression(struct primary_expr *pexpr)
   reg->free_float_register(r1);
 }
 
+extern bool use_sse2;
+
 /*
-return pair as result of an primary expression
-pair(type: int,float, register: simple, float)
-int type result is always in eax register
-and float type result in st0 stack register
+returns precision size of float type primary expression for SSE2,
+expression is evaluated in single precision(4) when it has float type
+identifiers only, otherwise in double precision(8),
+float literals are double type unless used with float identifiers
 */
-std::pair<int, int>
-xlang::x86_gen::gen_primary_expression(struct primary_expr ** pexpr)
+int xlang::x86_gen::sse_expr_size(struct primary_expr* pexpr)
 {
-  regs_t result;
-  std::pair<int, int> pr(-1,-1);
-  struct primary_expr* pexpr2 = *pexpr;
-
-  if(pexpr2 == nullptr) return pr;
+  std::stack<struct primary_expr*> pexp_stack;
+  struct primary_expr* pexp = nullptr;
+  bool has_float_id = false;
+  token type;
 
-  if(has_float(pexpr2)){
-    gen_float_primary_expression(pexpr2);
-    pr.first = 2;
-    pr.second = static_cast<int>(ST0);
-  }else{
-    result = gen_int_primary_expression(pexpr2);
-    reg->free_register(result);
-    pr.first = 1;
-    pr.second = static_cast<int>(result);
+  if(pexpr == nullptr) return 8;
+  pexp_stack.push(pexpr);
+  while(!pexp_stack.empty()){
+    pexp = pexp_stack.top();
+    pexp_stack.pop();
+    if(pexp == nullptr) continue;
+    if(pexp->is_id && pexp->id_info != nullptr && !pexp->id_info->is_ptr
+        && pexp->id_info->type_info->type == SIMPLE_TYPE){
+      type = pexp->id_info->type_info->type_specifier.simple_type[0];
+      if(type.token == KEY_DOUBLE)
+        return 8;
+      else if(type.token == KEY_FLOAT)
+        has_float_id = true;
+    }
+    pexp_stack.push(pexp->left);
+    pexp_stack.push(pexp->right);
   }
-  return pr;
+  return (has_float_id ? 4 : 8);
 }
 
-//generate x86 assembly for assignment of primary expression
-//e.g: x = 1 + 2 *3 ;
-void xlang::x86_gen::gen_assgn_primary_expr(struct assgn_expr** asexpr)
+//return SSE2 scalar arithmetic instruction types
+insn_t xlang::x86_gen::get_sse_arthm_op(lexeme_t symbol, int fsize)
 {
-  struct assgn_expr* assgnexp = *asexpr;
-  std::pair<int, int> pexp_result;
-  struct insn* in = nullptr;
-  int dtsize = 0;
-  struct id_expr* left = nullptr;
+  if(symbol == "+"){
+    return (fsize == 8 ? ADDSD : ADDSS);
+  }else if(symbol == "-"){
+    return (fsize == 8 ? SUBSD : SUBSS);
+  }else if(symbol == "*"){
+    return (fsize == 8 ? MULSD : MULSS);
+  }else if(symbol == "/"){
+    return (fsize == 8 ? DIVSD : DIVSS);
+  }
+  return INSNONE;
+}
+
+//fill memory operand of an identifier, local or global
+void xlang::x86_gen::get_id_mem_operand(struct st_symbol_info* syminfo,
+                                        struct operand* opr, int size)
+{
+  struct func_member fmem;
+  opr->type = MEMORY;
+  opr->mem.mem_size = size;
+  if(get_function_local_member(&fmem, syminfo->tok)){
+    opr->mem.mem_type = LOCAL;
+    opr->mem.fp_disp = fmem.fp_disp;
+  }else{
+    opr->mem.mem_type = GLOBAL;
+    opr->mem.name = syminfo->symbol;
+  }
+}
+
+void xlang::x86_gen::get_id_mem_operand(struct primary_expr* pexpr,
+                                        struct operand* opr, int size)
+{
+  get_id_mem_operand(pexpr->id_info, opr, size);
+}
+
+/*
+if leaf of primary expression can be used directly as memory operand
+of SSE2 instruction in precision fsize, fill it in opr and return true
+literals are taken from float constant pool
+*/
+bool xlang::x86_gen::get_sse_mem_operand(struct primary_expr* pexpr, int fsize,
+                                        struct operand* opr)
+{
+  struct data* dt = nullptr;
+  token type;
+  declspace_t decsp = (fsize == 8 ? DQ : DD);
+
+  if(!pexpr->is_id){
+    if(pexpr->tok.token == LIT_FLOAT){
+      dt = create_float_data(decsp, pexpr->tok.lexeme);
+    }else if(is_literal(pexpr->tok)){
+      dt = create_float_data(decsp, std::to_string(get_decimal(pexpr->tok))+".0");
+    }else{
+      return false;
+    }
+    opr->type = MEMORY;
+    opr->mem.mem_type = GLOBAL;
+    opr->mem.mem_size = fsize;
+    opr->mem.name = dt->symbol;
+    return true;
+  }
+
+  if(pexpr->id_info == nullptr || pexpr->id_info->is_ptr) return false;
+  if(pexpr->id_info->type_info->type != SIMPLE_TYPE) return false;
+  type = pexpr->id_info->type_info->type_specifier.simple_type[0];
+  if((type.token == KEY_FLOAT && fsize == 4) || (type.token == KEY_DOUBLE && fsize == 8)){
+    get_id_mem_operand(pexpr, opr, fsize);
+    return true;
+  }
+  return false;
+}
+
+/*
+load leaf of primary expression into newly allocated xmm register
+in precision fsize, converting int or other float type when needed
+*/
+fregs_t xlang::x86_gen::gen_sse_load(struct primary_expr* pexpr, int fsize)
+{
+  struct insn* in = nullptr;
+  fregs_t r;
+  token type;
+  int dtsize = 4;
+
+  r = reg->allocate_xmm_register();
+  if(r == FRNONE){
+    xlang::error::print_error(xlang::filename,
+          "float expression is too complex for xmm register allocation",
+          pexpr->tok.loc);
+    return XMM0;
+  }
+
+  in = get_insn(fsize == 8 ? MOVSD : MOVSS, 2);
+  in->operand_1->type = FREGISTER;
+  in->operand_1->freg = r;
+  in->comment = "  ; "+pexpr->tok.lexeme;
+
+  if(get_sse_mem_operand(pexpr, fsize, in->operand_2)){
+    instructions.push_back(in);
+    return r;
+  }
+
+  if(pexpr->is_id && pexpr->id_info != nullptr && !pexpr->id_info->is_ptr
+      && pexpr->id_info->type_info->type == SIMPLE_TYPE){
+    type = pexpr->id_info->type_info->type_specifier.simple_type[0];
+    dtsize = data_type_size(type);
+    if(type.token == KEY_FLOAT || type.token == KEY_DOUBLE){
+      //float <-> double conversion
+      in->insn_type = (fsize == 8 ? CVTSS2SD : CVTSD2SS);
+      get_id_mem_operand(pexpr, in->operand_2, dtsize);
+      instructions.push_back(in);
+      return r;
+    }
+  }
+
+  in->insn_type = (fsize == 8 ? CVTSI2SD : CVTSI2SS);
+  if(dtsize == 4){
+    get_id_mem_operand(pexpr, in->operand_2, 4);
+  }else{
+    //char, short are zero extended in eax before conversion
+    struct insn* in2 = get_insn(XOR, 2);
+    in2->operand_1->type = REGISTER;
+    in2->operand_1->reg = EAX;
+    in2->operand_2->type = REGISTER;
+    in2->operand_2->reg = EAX;
+    instructions.push_back(in2);
+
+    in2 = get_insn(MOV, 2);
+    in2->operand_1->type = REGISTER;
+    in2->operand_1->reg = (dtsize == 1 ? AL : AX);
+    get_id_mem_operand(pexpr, in2->operand_2, dtsize);
+    instructions.push_back(in2);
+
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = EAX;
+  }
+  instructions.push_back(in);
+  return r;
+}
+
+//convert value in xmm register between single/double precision
+void xlang::x86_gen::gen_sse_convert(fregs_t r, int from, int to)
+{
+  struct insn* in = nullptr;
+  if(from == to) return;
+  in = get_insn(to == 8 ? CVTSS2SD : CVTSD2SS, 2);
+  in->operand_1->type = FREGISTER;
+  in->operand_1->freg = r;
+  in->operand_2->type = FREGISTER;
+  in->operand_2->freg = r;
+  instructions.push_back(in);
+}
+
+/*
+generate float type x86 assembly of primary expression
+using SSE2 scalar instructions,
+instead of x87 stack, each computed value is kept in xmm register
+and other side leaf is used as memory operand when possible
+returns xmm register containing result
+*/
+fregs_t xlang::x86_gen::gen_sse_primary_expression(struct primary_expr *pexpr)
+{
+  std::stack<struct primary_expr*> pexp_out_stack;
+  //leaf node with FRNONE or already computed result register
+  std::stack<std::pair<struct primary_expr*, fregs_t>> pexp_stack;
+  std::pair<struct primary_expr*, fregs_t> fact1, fact2;
+  struct primary_expr* pexp = nullptr;
+  struct insn* in = nullptr;
+  insn_t op;
+  fregs_t r;
+  int fsize;
+
+  if(pexpr == nullptr) return FRNONE;
+  fsize = sse_expr_size(pexpr);
+
+  insert_comment("; line "+std::to_string(pexpr->tok.loc.line));
+
+  pexp_out_stack = get_post_order_prim_expr(pexpr);
+
+  while(!pexp_out_stack.empty()){
+    pexp = pexp_out_stack.top();
+    pexp_out_stack.pop();
+    if(!pexp->is_oprtr){
+      pexp_stack.push(std::pair<struct primary_expr*, fregs_t>(pexp, FRNONE));
+      continue;
+    }
+    if(pexp_stack.size() < 2) continue;
+
+    fact2 = pexp_stack.top();
+    pexp_stack.pop();
+    fact1 = pexp_stack.top();
+    pexp_stack.pop();
+
+    op = get_sse_arthm_op(pexp->tok.lexeme, fsize);
+    if(op == INSNONE) continue;
+
+    if(fact1.second == FRNONE){
+      //for commutative operation, use already computed right side register
+      if(fact2.second != FRNONE && (op == ADDSS || op == ADDSD
+          || op == MULSS || op == MULSD)){
+        std::swap(fact1, fact2);
+      }else{
+        fact1.second = gen_sse_load(fact1.first, fsize);
+      }
+    }
+
+    in = get_insn(op, 2);
+    in->operand_1->type = FREGISTER;
+    in->operand_1->freg = fact1.second;
+    if(fact2.second != FRNONE){
+      in->operand_2->type = FREGISTER;
+      in->operand_2->freg = fact2.second;
+      reg->free_float_register(fact2.second);
+    }else if(get_sse_mem_operand(fact2.first, fsize, in->operand_2)){
+      in->comment = "  ; "+fact2.first->tok.lexeme;
+    }else{
+      r = gen_sse_load(fact2.first, fsize);
+      in->operand_2->type = FREGISTER;
+      in->operand_2->freg = r;
+      reg->free_float_register(r);
+    }
+    instructions.push_back(in);
+    pexp_stack.push(std::pair<struct primary_expr*, fregs_t>(pexp, fact1.second));
+  }
+
+  if(pexp_stack.empty()) return FRNONE;
+  fact1 = pexp_stack.top();
+  if(fact1.second == FRNONE)
+    fact1.second = gen_sse_load(fact1.first, fsize);
+  return fact1.second;
+}
+
+/*
+complete assignment instruction in whose first operand is memory
+of type, value of precision fsize is in xmm register r
+float types are stored directly, int types are truncated to eax
+*/
+void xlang::x86_gen::gen_sse_assign(struct insn* in, fregs_t r, int fsize, token type)
+{
+  struct insn* in2 = nullptr;
+  int dtsize = data_type_size(type);
+
+  if(type.token == KEY_FLOAT || type.token == KEY_DOUBLE){
+    gen_sse_convert(r, fsize, dtsize);
+    in->insn_type = (dtsize == 8 ? MOVSD : MOVSS);
+    in->operand_2->type = FREGISTER;
+    in->operand_2->freg = r;
+    in->operand_1->mem.mem_size = dtsize;
+    return;
+  }
+
+  in2 = get_insn(fsize == 8 ? CVTTSD2SI : CVTTSS2SI, 2);
+  in2->operand_1->type = REGISTER;
+  in2->operand_1->reg = EAX;
+  in2->operand_2->type = FREGISTER;
+  in2->operand_2->freg = r;
+  instructions.push_back(in2);
+
+  in->insn_type = MOV;
+  in->operand_2->type = REGISTER;
+  if(dtsize == 1){
+    in->operand_2->reg = AL;
+  }else if(dtsize == 2){
+    in->operand_2->reg = AX;
+  }else{
+    in->operand_2->reg = EAX;
+    dtsize = 4;
+  }
+  in->operand_1->mem.mem_size = dtsize;
+}
+
+//compare two float leaves using comiss/comisd, flags are set as unsigned compare
+void xlang::x86_gen::gen_sse_compare(struct primary_expr* f1, struct primary_expr* f2)
+{
+  struct insn* in = nullptr;
+  int fsize = 0;
+  fregs_t r1, r2;
+
+  fsize = sse_expr_size(f1);
+  if(sse_expr_size(f2) == 8)
+    fsize = 8;
+
+  r1 = gen_sse_load(f1, fsize);
+  in = get_insn(fsize == 8 ? COMISD : COMISS, 2);
+  in->operand_1->type = FREGISTER;
+  in->operand_1->freg = r1;
+  if(get_sse_mem_operand(f2, fsize, in->operand_2)){
+    in->comment = "  ; "+f2->tok.lexeme;
+  }else{
+    r2 = gen_sse_load(f2, fsize);
+    in->operand_2->type = FREGISTER;
+    in->operand_2->freg = r2;
+    reg->free_float_register(r2);
+  }
+  instructions.push_back(in);
+  reg->free_float_register(r1);
+}
+
+/*
+generate float type return value,
+cdecl returns float/double in st0, so value is moved from xmm register
+to x87 stack through stack memory, and truncated to eax for int return types.
+x86_64 returns float/double in xmm0
+*/
+void xlang::x86_gen::gen_sse_return(struct primary_expr* pexpr)
+{
+  struct insn* in = nullptr;
+  int fsize = sse_expr_size(pexpr);
+  fregs_t r;
+  token type;
+
+  r = gen_sse_primary_expression(pexpr);
+  if(r == FRNONE) return;
+  type = func_symtab->func_info->return_type->type_specifier.simple_type[0];
+
+  if(type.token != KEY_FLOAT && type.token != KEY_DOUBLE){
+    in = get_insn(fsize == 8 ? CVTTSD2SI : CVTTSS2SI, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EAX;
+    in->operand_2->type = FREGISTER;
+    in->operand_2->freg = r;
+    instructions.push_back(in);
+    reg->free_float_register(r);
+    return;
+  }
+
+  if(target_x86_64){
+    gen_sse_convert(r, fsize, data_type_size(type));
+    if(r != XMM0){
+      in = get_insn(MOVAPS, 2);
+      in->operand_1->type = FREGISTER;
+      in->operand_1->freg = XMM0;
+      in->operand_2->type = FREGISTER;
+      in->operand_2->freg = r;
+      instructions.push_back(in);
+    }
+    reg->free_float_register(r);
+    return;
+  }
+
+  in = get_insn(SUB, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = ESP;
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = std::to_string(fsize);
+  instructions.push_back(in);
+
+  in = get_insn(fsize == 8 ? MOVSD : MOVSS, 2);
+  in->operand_1->type = MEMORY;
+  in->operand_1->mem.mem_type = STACK;
+  in->operand_1->mem.mem_size = fsize;
+  in->operand_2->type = FREGISTER;
+  in->operand_2->freg = r;
+  instructions.push_back(in);
+
+  in = get_insn(FLD, 1);
+  in->operand_1->type = MEMORY;
+  in->operand_1->mem.mem_type = STACK;
+  in->operand_1->mem.mem_size = fsize;
+  insncls->delete_operand(&(in->operand_2));
+  in->comment = "    ; return value in st0";
+  instructions.push_back(in);
+
+  in = get_insn(ADD, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = ESP;
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = std::to_string(fsize);
+  instructions.push_back(in);
+
+  reg->free_float_register(r);
+}
+
+/*
+return pair as result of an primary expression
+pair(type: int,float, register: simple, float)
+int type result is always in eax register
+and float type result in st0 stack register
+*/
+std::pair<int, int>
+xlang::x86_gen::gen_primary_expression(struct primary_expr ** pexpr)
+{
+  regs_t result;
+  std::pair<int, int> pr(-1,-1);
+  struct primary_expr* pexpr2 = *pexpr;
+
+  if(pexpr2 == nullptr) return pr;
+
+  if(has_float(pexpr2)){
+    pr.first = 2;
+    if(use_sse2){
+      pr.second = static_cast<int>(gen_sse_primary_expression(pexpr2));
+      reg->free_float_register(static_cast<fregs_t>(pr.second));
+    }else{
+      gen_float_primary_expression(pexpr2);
+      pr.second = static_cast<int>(ST0);
+    }
+  }else{
+    result = gen_int_primary_expression(pexpr2);
+    reg->free_register(result);
+    pr.first = 1;
+    pr.second = static_cast<int>(result);
+  }
+  return pr;
+}
+
+//generate x86 assembly for assignment of primary expression
+//e.g: x = 1 + 2 *3 ;
+void xlang::x86_gen::gen_assgn_primary_expr(struct assgn_expr** asexpr)
+{
+  struct assgn_expr* assgnexp = *asexpr;
+  std::pair<int, int> pexp_result;
+  struct insn* in = nullptr;
+  int dtsize = 0;
+  struct id_expr* left = nullptr;
   struct func_member fmem;
   token type;
 
@@ -1394,8 +2328,16 @@ void xlang::x86_gen::gen_assgn_primary_expr(struct assgn_expr** asexpr)
       }else if(dtsize == 2){
         res = static_cast<int>(AX);
       }
+      //on x86_64, pointer is stored as whole 64 bit register
+      if(target_x86_64 && left->id_info->is_ptr){
+        res = static_cast<int>(reg->register_64(static_cast<regs_t>(res)));
+      }
       in->operand_2->reg = static_cast<regs_t>(res);
       in->operand_1->mem.mem_size = reg->regsize(static_cast<regs_t>(res));
+    }else if(pexp_result.first == 2 && use_sse2){
+      //if floating type, result is in xmm register
+      gen_sse_assign(in, static_cast<fregs_t>(pexp_result.second),
+            sse_expr_size(assgnexp->expression->primary_expression), type);
     }else if(pexp_result.first == 2){
       //if floating type, result store in st0
       in->operand_count = 1;
@@ -1468,8 +2410,15 @@ void xlang::x86_gen::gen_assgn_primary_expr(struct assgn_expr** asexpr)
       }else if(dtsize == 2){
         res = static_cast<int>(AX);
       }
+      //on x86_64, pointer is stored as whole 64 bit register
+      if(target_x86_64 && left->id_info->is_ptr){
+        res = static_cast<int>(reg->register_64(static_cast<regs_t>(res)));
+      }
       in->operand_2->reg = static_cast<regs_t>(res);
       in->operand_1->mem.mem_size = reg->regsize(static_cast<regs_t>(res));
+    }else if(pexp_result.first == 2 && use_sse2){
+      gen_sse_assign(in, static_cast<fregs_t>(pexp_result.second),
+            sse_expr_size(assgnexp->expression->primary_expression), type);
     }else if(pexp_result.first == 2){
       in->operand_count = 1;
       in->insn_type = FSTP;
@@ -1502,7 +2451,7 @@ void xlang::x86_gen::gen_sizeof_expression(struct sizeof_expr** sofexpr)
     in->operand_2->type = LITERAL;
     in->comment = "    ;  sizeof "+szofnexp->simple_type[0].lexeme;
     if(szofnexp->is_ptr){
-      in->operand_2->literal = "4";
+      in->operand_2->literal = std::to_string(pointer_size());
       in->comment += " pointer";
     }else{
       in->operand_2->literal = std::to_string(data_type_size(szofnexp->simple_type[0]));
@@ -1516,7 +2465,7 @@ void xlang::x86_gen::gen_sizeof_expression(struct sizeof_expr** sofexpr)
     in->operand_2->type = LITERAL;
     in->comment = "    ;  sizeof "+szofnexp->identifier.lexeme;
     if(szofnexp->is_ptr){
-      in->operand_2->literal = "4";
+      in->operand_2->literal = std::to_string(pointer_size());
       in->comment += " pointer";
     }else{
       std::unordered_map<std::string, int>::iterator it;
@@ -1658,7 +2607,7 @@ void xlang::x86_gen::gen_id_expression(struct id_expr** idexpr)
     if(idexp->is_oprtr){
       in = get_insn(INSNONE, 2);
       in->operand_1->type = REGISTER;
-      in->operand_1->reg = EAX;
+      in->operand_1->reg = pointer_register();
 
       idexp = idexp->unary;
 
@@ -1711,9 +2660,13 @@ void xlang::x86_gen::gen_id_expression(struct id_expr** idexpr)
               if(sz == 1) return AL; else if(sz == 2) return AX; else return EAX;
             };
 
+      //on x86_64, pointer value itself is loaded as 8 byte
+      if(target_x86_64 && idexp->id_info->is_ptr && !idexp->is_subscript)
+        dtsize = pointer_size();
+
       in = get_insn(MOV, 2);
       in->operand_1->type = REGISTER;
-      in->operand_1->reg = resreg(dtsize);
+      in->operand_1->reg = (dtsize == 8 ? RAX : resreg(dtsize));
       if(get_function_local_member(&fmem, idexp->id_info->tok)){
         in->operand_2->type = MEMORY;
         in->operand_2->mem.mem_type = LOCAL;
@@ -1784,7 +2737,12 @@ void xlang::x86_gen::gen_id_expression(struct id_expr** idexpr)
         in->operand_2->type = MEMORY;
         in->operand_2->mem.mem_type = GLOBAL;
         in->operand_2->mem.mem_size = 4;
-        in->operand_2->mem.name = "eax";
+        in->operand_2->mem.name = reg->reg_name(pointer_register());
+        //on x86_64, intermediate pointers are 8 byte
+        if(target_x86_64 && i < idexp->ptr_oprtr_count - 1){
+          in->operand_1->reg = RAX;
+          in->operand_2->mem.mem_size = 8;
+        }
         instructions.push_back(in);
       }
     }
@@ -1810,12 +2768,15 @@ void xlang::x86_gen::gen_assgn_id_expr(struct assgn_expr** asexpr)
   gen_id_expression(&assgnexp->expression->id_expression);
 
   auto resultreg = [=](int sz){
-        if(sz == 1) return AL; else if(sz == 2) return AX; else return EAX;
+        if(sz == 1) return AL; else if(sz == 2) return AX;
+        else if(sz == 8) return RAX; else return EAX;
       };
 
   if(left->id_info == nullptr) return;
   type = left->id_info->type_info->type_specifier.simple_type[0];
   dtsize = data_type_size(type);
+  if(target_x86_64 && left->id_info->is_ptr)
+    dtsize = pointer_size();
 
   if(get_function_local_member(&fmem, left->id_info->tok)){
     in = get_insn(MOV, 2);
@@ -1844,6 +2805,42 @@ void xlang::x86_gen::gen_assgn_id_expr(struct assgn_expr** asexpr)
   }
 }
 
+/*
+change store instruction of function call result to float store,
+if both called function return type and assigned variable are float/double.
+float result is in xmm0 on x86_64, and in st0 otherwise
+*/
+void xlang::x86_gen::gen_float_result_store(struct insn* in,
+                      struct func_call_expr* fcexpr, token type)
+{
+  std::map<std::string, struct st_func_info*>::iterator findit;
+  struct st_type_info* rettype = nullptr;
+  int fsize, dtsize;
+
+  if(type.token != KEY_FLOAT && type.token != KEY_DOUBLE) return;
+  if(fcexpr == nullptr || fcexpr->function == nullptr) return;
+  findit = xlang::func_table.find(fcexpr->function->tok.lexeme);
+  if(findit == xlang::func_table.end() || findit->second == nullptr) return;
+  rettype = findit->second->return_type;
+  if(rettype == nullptr || rettype->type != SIMPLE_TYPE) return;
+  if(rettype->type_specifier.simple_type[0].token != KEY_FLOAT
+      && rettype->type_specifier.simple_type[0].token != KEY_DOUBLE) return;
+
+  fsize = data_type_size(rettype->type_specifier.simple_type[0]);
+  dtsize = data_type_size(type);
+  in->operand_1->mem.mem_size = dtsize;
+  if(target_x86_64){
+    gen_sse_convert(XMM0, fsize, dtsize);
+    in->insn_type = (dtsize == 8 ? MOVSD : MOVSS);
+    in->operand_2->type = FREGISTER;
+    in->operand_2->freg = XMM0;
+  }else{
+    in->insn_type = FSTP;
+    in->operand_count = 1;
+    insncls->delete_operand(&(in->operand_2));
+  }
+}
+
 void xlang::x86_gen::gen_assgn_funccall_expr(struct assgn_expr** asexpr)
 {
   struct assgn_expr* assgnexp = *asexpr;
@@ -1873,6 +2870,12 @@ void xlang::x86_gen::gen_assgn_funccall_expr(struct assgn_expr** asexpr)
     in->operand_1->mem.mem_size = 4;
     in->operand_2->type = REGISTER;
     in->operand_2->reg = EAX;
+    if(left->id_info->is_ptr){
+      in->operand_1->mem.mem_size = pointer_size();
+      in->operand_2->reg = pointer_register();
+    }else{
+      gen_float_result_store(in, assgnexp->expression->func_call_expression, type);
+    }
     in->comment = "    ; line: "+std::to_string(assgnexp->tok.loc.line)+", assign";
     instructions.push_back(in);
   }else{
@@ -1885,6 +2888,12 @@ void xlang::x86_gen::gen_assgn_funccall_expr(struct assgn_expr** asexpr)
     in->operand_1->mem.name = left->id_info->symbol;
     in->operand_2->type = REGISTER;
     in->operand_2->reg = EAX;
+    if(left->id_info->is_ptr){
+      in->operand_1->mem.mem_size = pointer_size();
+      in->operand_2->reg = pointer_register();
+    }else{
+      gen_float_result_store(in, assgnexp->expression->func_call_expression, type);
+    }
     if(left->is_subscript){
       token sb = *(left->subscript.begin());
       in->operand_1->mem.fp_disp = std::stoi(sb.lexeme)*dtsize;
@@ -1925,87 +2934,193 @@ void xlang::x86_gen::gen_assignment_expression(struct assgn_expr** asexpr)
 }
 
 /*
-generate x86 function call
-each passed parameter is 4 byte
-even float, double is not yet considered yet to pass
-globals can be used anywhere
-function call parameters are pushed on stack in reverse order
+returns size of float type argument at index of function call,
+declared double or undeclared(variable arguments) parameter is passed
+as 8 byte double, otherwise as 4 byte float
 */
-void xlang::x86_gen::gen_funccall_expression(struct func_call_expr** fccallex)
+int xlang::x86_gen::float_arg_size(struct func_call_expr* fcexpr, int index)
 {
-  struct insn* in = nullptr;
-  int pushed_count = 0;
-  int param_count  = 0;
-  struct func_call_expr* fcexpr = *fccallex;
-  std::list<struct expr*>::reverse_iterator it;
-  std::pair<int,int> pr;
+  std::map<std::string, struct st_func_info*>::iterator findit;
+  struct st_func_param_info* param = nullptr;
+  token type;
 
-  if(fcexpr == nullptr) return;
-  if(fcexpr->function == nullptr) return;
+  findit = xlang::func_table.find(fcexpr->function->tok.lexeme);
+  if(findit == xlang::func_table.end() || findit->second == nullptr) return 8;
+  if(index < 0 || index >= static_cast<int>(findit->second->param_list.size()))
+    return 8;
 
-  insert_comment("; line: "+std::to_string(fcexpr->function->tok.loc.line)
-        +", func_call: "+fcexpr->function->tok.lexeme);
+  param = *std::next(findit->second->param_list.begin(), index);
+  if(param == nullptr || param->type_info == nullptr) return 8;
+  if(param->type_info->type != SIMPLE_TYPE) return 8;
+  type = param->type_info->type_specifier.simple_type[0];
+  return (type.token == KEY_DOUBLE ? 8 : 4);
+}
 
-  it = fcexpr->expression_list.rbegin();
-  param_count = fcexpr->expression_list.size();
-  while(it != fcexpr->expression_list.rend()){
-    if(*it == nullptr) break;
-    switch((*it)->expr_kind){
-      case PRIMARY_EXPR :
-        pr = gen_primary_expression(&((*it)->primary_expression));
-        if(pr.first == 2){
-          in = get_insn(FSTP, 1);
-          in->operand_1->type = MEMORY;
-          in->operand_1->reg = EAX;
-          in->operand_1->mem.mem_type = GLOBAL;
-          in->operand_1->mem.mem_size = 4;
-          insncls->delete_operand(&(in->operand_2));
-          in->comment = "    ; retrieve value from float stack(st0) ";
-          instructions.push_back(in);
-          in = nullptr;
+/*
+generate function call argument and push it on stack
+returns stack size used by argument
+*/
+int xlang::x86_gen::gen_funccall_argument(struct func_call_expr* fcexpr,
+                        struct expr* arg, int param_count)
+{
+  struct insn* in = nullptr;
+  int arg_size = 4;
+  std::pair<int,int> pr;
 
-          in = get_insn(PUSH, 1);
-          in->operand_1->type = REGISTER;
-          in->operand_1->reg = EAX;
-          insncls->delete_operand(&(in->operand_2));
-          in->comment = "    ; param "+std::to_string(param_count);
-          instructions.push_back(in);
+  switch(arg->expr_kind){
+    case PRIMARY_EXPR :
+      pr = gen_primary_expression(&(arg->primary_expression));
+      if(pr.first == 2){
+        //float value is stored directly on stack
+        //on x86_64, each argument takes 8 byte stack slot
+        arg_size = float_arg_size(fcexpr, param_count - 1);
+        in = get_insn(SUB, 2);
+        in->operand_1->type = REGISTER;
+        in->operand_1->reg = ESP;
+        in->operand_2->type = LITERAL;
+        in->operand_2->literal = std::to_string(target_x86_64 ? 8 : arg_size);
+        instructions.push_back(in);
+
+        if(use_sse2){
+          gen_sse_convert(static_cast<fregs_t>(pr.second),
+                sse_expr_size(arg->primary_expression), arg_size);
+          in = get_insn(arg_size == 8 ? MOVSD : MOVSS, 2);
+          in->operand_2->type = FREGISTER;
+          in->operand_2->freg = static_cast<fregs_t>(pr.second);
         }else{
-          in = get_insn(PUSH, 1);
-          in->operand_1->type = REGISTER;
-          in->operand_1->reg = EAX;
+          in = get_insn(FSTP, 1);
           insncls->delete_operand(&(in->operand_2));
-          in->comment = "    ; param "+std::to_string(param_count);
-          instructions.push_back(in);
-          in = nullptr;
         }
-        break;
-      case SIZEOF_EXPR :
-        gen_sizeof_expression(&((*it)->sizeof_expression));
-        in = get_insn(PUSH, 1);
-        in->operand_1->type = REGISTER;
-        in->operand_1->reg = EAX;
-        in->comment = "    ; param "+std::to_string(param_count);
-        insncls->delete_operand(&(in->operand_2));
-        instructions.push_back(in);
-        in = nullptr;
-        break;
-      case ID_EXPR :
-        gen_id_expression(&((*it)->id_expression));
-        in = get_insn(PUSH, 1);
-        in->operand_1->type = REGISTER;
-        in->operand_1->reg = EAX;
+        in->operand_1->type = MEMORY;
+        in->operand_1->mem.mem_type = STACK;
+        in->operand_1->mem.mem_size = arg_size;
         in->comment = "    ; param "+std::to_string(param_count);
-        insncls->delete_operand(&(in->operand_2));
         instructions.push_back(in);
-        in = nullptr;
+        return (target_x86_64 ? 8 : arg_size);
+      }
+      break;
+    case SIZEOF_EXPR :
+      gen_sizeof_expression(&(arg->sizeof_expression));
+      break;
+    case ID_EXPR :
+      gen_id_expression(&(arg->id_expression));
+      break;
+    default : return 4;
+  }
+
+  if(outgoing_offset >= 0){
+    //store into outgoing argument area
+    in = get_insn(MOV, 2);
+    in->operand_1->type = MEMORY;
+    in->operand_1->mem.mem_type = STACK;
+    in->operand_1->mem.mem_size = pointer_size();
+    in->operand_1->mem.fp_disp = outgoing_offset;
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = pointer_register();
+  }else{
+    in = get_insn(PUSH, 1);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = pointer_register();
+    insncls->delete_operand(&(in->operand_2));
+  }
+  in->comment = "    ; param "+std::to_string(param_count);
+  instructions.push_back(in);
+  return pointer_size();
+}
+
+/*
+push function call arguments in reverse order, returns pushed stack size.
+For register call function, stack arguments are pushed first,
+then register arguments are pushed and popped into ecx/edx.
+When outgoing argument area is used and there is no float argument,
+stack arguments are stored at their offsets in it instead of push
+*/
+int xlang::x86_gen::gen_funccall_arguments(struct func_call_expr* fcexpr)
+{
+  static const regs_t arg_regs[] = {ECX, EDX};
+  std::map<std::string, struct st_func_info*>::iterator findit;
+  struct st_func_info* finfo = nullptr;
+  struct insn* in = nullptr;
+  std::vector<struct expr*> args;
+  std::vector<int> offsets;
+  int pushed_count = 0, offset = 0;
+  int i, r;
+
+  for(struct expr* e : fcexpr->expression_list){
+    if(e == nullptr) break;
+    args.push_back(e);
+  }
+  findit = xlang::func_table.find(fcexpr->function->tok.lexeme);
+  if(findit != xlang::func_table.end())
+    finfo = findit->second;
+
+  //float argument size is known only after its generation,
+  //so such call pushes its arguments
+  offsets.assign(args.size(), -1);
+  if(outgoing_args){
+    for(i = 0; i < static_cast<int>(args.size()); i++){
+      if(get_param_register(finfo, i) >= 0) continue;
+      if(is_float_arg(args[i])){
+        offsets.assign(args.size(), -1);
+        offset = 0;
         break;
-      default : break;
+      }
+      offsets[i] = offset;
+      offset += pointer_size();
+    }
+    outgoing_size = std::max(outgoing_size, offset);
+  }
+
+  for(i = static_cast<int>(args.size()) - 1; i >= 0; i--){
+    if(get_param_register(finfo, i) < 0){
+      outgoing_offset = offsets[i];
+      if(outgoing_offset >= 0)
+        gen_funccall_argument(fcexpr, args[i], i + 1);
+      else
+        pushed_count += gen_funccall_argument(fcexpr, args[i], i + 1);
     }
-    pushed_count += 4;
-    param_count--;
-    it++;
   }
+  outgoing_offset = -1;
+  for(i = static_cast<int>(args.size()) - 1; i >= 0; i--){
+    if(get_param_register(finfo, i) >= 0)
+      gen_funccall_argument(fcexpr, args[i], i + 1);
+  }
+  for(i = 0; i < static_cast<int>(args.size()); i++){
+    r = get_param_register(finfo, i);
+    if(r < 0) continue;
+    in = get_insn(POP, 1);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = arg_regs[r];
+    insncls->delete_operand(&(in->operand_2));
+    in->comment = "    ; param "+std::to_string(i + 1);
+    instructions.push_back(in);
+  }
+  return pushed_count;
+}
+
+/*
+generate x86 function call
+globals can be used anywhere
+function call parameters are pushed on stack in reverse order
+*/
+void xlang::x86_gen::gen_funccall_expression(struct func_call_expr** fccallex)
+{
+  struct insn* in = nullptr;
+  int pushed_count = 0;
+  struct func_call_expr* fcexpr = *fccallex;
+
+  if(fcexpr == nullptr) return;
+  if(fcexpr->function == nullptr) return;
+
+  insert_comment("; line: "+std::to_string(fcexpr->function->tok.loc.line)
+        +", func_call: "+fcexpr->function->tok.lexeme);
+
+  if(target_x86_64){
+    gen_x86_64_funccall_expression(fcexpr, false);
+    return;
+  }
+
+  pushed_count = gen_funccall_arguments(fcexpr);
 
   in = get_insn(CALL, 1);
   in->operand_1->type = LITERAL;
@@ -2015,7 +3130,7 @@ void xlang::x86_gen::gen_funccall_expression(struct func_call_expr** fccallex)
   insncls->delete_operand(&(in->operand_2));
   instructions.push_back(in);
 
-  if(fcexpr->expression_list.size() > 0){
+  if(pushed_count > 0){
     in = get_insn(ADD, 2);
     in->operand_1->type = REGISTER;
     in->operand_1->reg = ESP;
@@ -2026,6 +3141,246 @@ void xlang::x86_gen::gen_funccall_expression(struct func_call_expr** fccallex)
   }
 }
 
+//returns true if function call argument is passed in xmm register on x86_64
+bool xlang::x86_gen::is_float_arg(struct expr* arg)
+{
+  if(arg == nullptr || arg->expr_kind != PRIMARY_EXPR) return false;
+  return has_float(arg->primary_expression);
+}
+
+/*
+generate x86_64 System V function call
+first 6 integer/pointer arguments are passed in rdi,rsi,rdx,rcx,r8,r9
+and first 8 float arguments in xmm0-xmm7, remaining on stack in reverse order.
+Stack arguments are pushed first, then register arguments are pushed
+and popped into their registers, so each argument is evaluated only
+with rax/xmm registers free.
+al contains count of used xmm registers for variable argument functions,
+stack pointer is 16 byte aligned at call.
+For tail call, all arguments are in registers and frame is released
+before jmp instead of call
+*/
+void xlang::x86_gen::gen_x86_64_funccall_expression(struct func_call_expr* fcexpr, bool tail)
+{
+  static const regs_t int_arg_regs[] = {RDI, RSI, RDX, RCX, R8, R9};
+  struct insn* in = nullptr;
+  std::vector<struct expr*> args;
+  std::vector<bool> in_register;
+  int int_count = 0, float_count = 0, stack_count = 0;
+  int i, size;
+
+  for(struct expr* e : fcexpr->expression_list){
+    if(e == nullptr) break;
+    args.push_back(e);
+  }
+
+  for(struct expr* e : args){
+    if(is_float_arg(e))
+      in_register.push_back(float_count++ < 8);
+    else
+      in_register.push_back(int_count++ < 6);
+    if(!in_register.back())
+      stack_count++;
+  }
+
+  if(stack_count % 2 != 0){
+    in = get_insn(SUB, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = RSP;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = "8";
+    in->comment = "    ; align stack to 16 bytes";
+    instructions.push_back(in);
+  }
+
+  for(i = static_cast<int>(args.size()) - 1; i >= 0; i--){
+    if(!in_register[i])
+      gen_funccall_argument(fcexpr, args[i], i + 1);
+  }
+  for(i = static_cast<int>(args.size()) - 1; i >= 0; i--){
+    if(in_register[i])
+      gen_funccall_argument(fcexpr, args[i], i + 1);
+  }
+
+  int_count = float_count = 0;
+  for(i = 0; i < static_cast<int>(args.size()); i++){
+    if(!in_register[i]) continue;
+    if(is_float_arg(args[i])){
+      size = float_arg_size(fcexpr, i);
+      in = get_insn(size == 8 ? MOVSD : MOVSS, 2);
+      in->operand_1->type = FREGISTER;
+      in->operand_1->freg = static_cast<fregs_t>(XMM0 + float_count);
+      in->operand_2->type = MEMORY;
+      in->operand_2->mem.mem_type = STACK;
+      in->operand_2->mem.mem_size = size;
+      in->comment = "    ; param "+std::to_string(i + 1);
+      instructions.push_back(in);
+
+      in = get_insn(ADD, 2);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = RSP;
+      in->operand_2->type = LITERAL;
+      in->operand_2->literal = "8";
+      instructions.push_back(in);
+      float_count++;
+    }else{
+      in = get_insn(POP, 1);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = int_arg_regs[int_count];
+      insncls->delete_operand(&(in->operand_2));
+      in->comment = "    ; param "+std::to_string(i + 1);
+      instructions.push_back(in);
+      int_count++;
+    }
+  }
+
+  in = get_insn(MOV, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = EAX;
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = std::to_string(float_count);
+  in->comment = "    ; xmm registers used";
+  instructions.push_back(in);
+
+  if(tail){
+    gen_tail_jump(fcexpr->function->tok.lexeme);
+    return;
+  }
+
+  in = get_insn(CALL, 1);
+  in->operand_1->type = LITERAL;
+  if(fcexpr->function->left == nullptr && fcexpr->function->right == nullptr){
+    in->operand_1->literal = fcexpr->function->tok.lexeme;
+  }
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+
+  if(stack_count > 0){
+    in = get_insn(ADD, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = RSP;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = std::to_string((stack_count + stack_count % 2) * 8);
+    in->comment = "    ; restore func-call params stack frame";
+    instructions.push_back(in);
+  }
+}
+
+//float value is returned in xmm0/st0, others in eax
+bool xlang::x86_gen::is_float_return(struct st_func_info* finfo)
+{
+  token type;
+  if(finfo == nullptr || finfo->return_type == nullptr) return true;
+  if(finfo->ptr_oprtr_count > 0) return false;
+  if(finfo->return_type->type != SIMPLE_TYPE) return false;
+  type = finfo->return_type->type_specifier.simple_type[0];
+  return (type.token == KEY_FLOAT || type.token == KEY_DOUBLE);
+}
+
+/*
+release frame of current function and jump to callee,
+callee returns directly to our caller
+mov esp, ebp
+pop ebp
+jmp <function-name>
+*/
+void xlang::x86_gen::gen_tail_jump(std::string name)
+{
+  struct insn* in = nullptr;
+
+  release_frame_pointer();
+  in = get_insn(JMP, 1);
+  in->operand_1->type = LITERAL;
+  in->operand_1->literal = name;
+  in->comment = "    ; tail call";
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+  xlang::stats::count("tailcall.tail-jumps");
+}
+
+/*
+generate return f(...) as tail call,
+returns false if call can not reuse frame of current function,
+then nothing is generated.
+On x86, arguments are pushed as usual and then popped into
+parameter slots of current function, so their size must not exceed
+size of parameters of current function.
+On x86_64, arguments must be passed in registers only.
+*/
+bool xlang::x86_gen::gen_tail_call(struct func_call_expr* fcexpr)
+{
+  std::map<std::string, struct st_func_info*>::iterator findit;
+  struct insn* in = nullptr;
+  int arg_size = 0, int_count = 0, float_count = 0, index = 0;
+  int slot_size = 0, pushed_count = 0;
+  bool outgoing = false;
+
+  if(fcexpr == nullptr || fcexpr->function == nullptr) return false;
+  if(fcexpr->function->left != nullptr || fcexpr->function->right != nullptr)
+    return false;
+  //call through function pointer variable
+  if(xlang::symtable::search_symbol(func_symtab, fcexpr->function->tok.lexeme))
+    return false;
+  findit = xlang::func_table.find(fcexpr->function->tok.lexeme);
+  if(findit == xlang::func_table.end()) return false;
+  //result must be in same register for both functions
+  if(is_float_return(findit->second) || is_float_return(func_symtab->func_info))
+    return false;
+
+  for(struct expr* e : fcexpr->expression_list){
+    if(e == nullptr) return false;
+    if(is_float_arg(e)){
+      float_count++;
+      if(get_param_register(findit->second, index) < 0)
+        arg_size += float_arg_size(fcexpr, index);
+    }else{
+      int_count++;
+      if(get_param_register(findit->second, index) < 0)
+        arg_size += 4;
+    }
+    index++;
+  }
+  if(target_x86_64){
+    if(int_count > 6 || float_count > 8) return false;
+  }else{
+    //stack parameter slots of current function
+    for(index = 0; index < static_cast<int>(func_symtab->func_info->param_list.size()); index++){
+      if(get_param_register(func_symtab->func_info, index) < 0)
+        slot_size += 4;
+    }
+    if(arg_size > slot_size) return false;
+  }
+
+  reg->free_all_registers();
+  reg->free_all_float_registers();
+
+  insert_comment("; line: "+std::to_string(fcexpr->function->tok.loc.line)
+        +", tail call: "+fcexpr->function->tok.lexeme);
+
+  if(target_x86_64){
+    gen_x86_64_funccall_expression(fcexpr, true);
+    return true;
+  }
+
+  //arguments are pushed, not stored into outgoing argument area
+  outgoing = outgoing_args;
+  outgoing_args = false;
+  pushed_count = gen_funccall_arguments(fcexpr);
+  outgoing_args = outgoing;
+  //pushed arguments become parameters of current function
+  for(index = 0; index < pushed_count / 4; index++){
+    in = get_insn(POP, 1);
+    in->operand_1->type = MEMORY;
+    in->operand_1->mem.mem_type = LOCAL;
+    in->operand_1->mem.mem_size = 4;
+    in->operand_1->mem.fp_disp = 8 + index * 4;
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+  }
+  gen_tail_jump(fcexpr->function->tok.lexeme);
+  return true;
+}
+
 void xlang::x86_gen::gen_cast_expression(struct cast_expr** cexpr)
 {
   struct cast_expr* cstexpr = *cexpr;
@@ -2164,8 +3519,19 @@ void xlang::x86_gen::gen_jump_statement(struct jump_stmt** jstmt)
       break;
 
     case RETURN_JMP:
+      if(tail_calls && jmpstmt->expression != nullptr
+         && jmpstmt->expression->expr_kind == FUNC_CALL_EXPR
+         && gen_tail_call(jmpstmt->expression->func_call_expression))
+        break;
       if(jmpstmt->expression != nullptr){
-        gen_expression(&(jmpstmt->expression));
+        if(use_sse2 && jmpstmt->expression->expr_kind == PRIMARY_EXPR
+            && has_float(jmpstmt->expression->primary_expression)){
+          reg->free_all_registers();
+          reg->free_all_float_registers();
+          gen_sse_return(jmpstmt->expression->primary_expression);
+        }else{
+          gen_expression(&(jmpstmt->expression));
+        }
       }
       in = get_insn(JMP, 1);
       in->operand_1->type = LITERAL;
@@ -2199,61 +3565,74 @@ regs_t xlang::x86_gen::get_reg_type_by_char(char ch)
   }
 }
 
+//register of inline assembly constraint, 64 bit register on x86_64
+std::string xlang::x86_gen::get_asm_register(char ch)
+{
+  regs_t r = get_reg_type_by_char(ch);
+  if(r == RNONE) return "";
+  if(target_x86_64)
+    r = reg->register_64(r);
+  return reg->reg_name(r);
+}
+
+/*
+memory operand of inline assembly constraint m,
+local member is addressed relative to frame pointer of target
+dword[ebp - 4], qword[rbp - 8], dword[x]
+*/
+std::string xlang::x86_gen::get_asm_memory_operand(struct primary_expr* pexp)
+{
+  struct func_member fmem;
+  std::string cast, frame = reg->reg_name(frame_reg);
+  int size;
+
+  if(pexp == nullptr) return "";
+  get_function_local_member(&fmem, pexp->tok);
+  if(fmem.insize != -1){
+    cast = insncls->insnsize_name(get_insn_size_type(fmem.insize));
+    if(fmem.fp_disp < 0){
+      return cast + "[" + frame + " - " + std::to_string(fmem.fp_disp*(-1)) + "]";
+    }else{
+      return cast + "[" + frame + " + " + std::to_string(fmem.fp_disp) + "]";
+    }
+  }
+  if(pexp->id_info == nullptr){
+    pexp->id_info = search_id(pexp->tok.lexeme);
+  }
+  if(pexp->id_info == nullptr || pexp->id_info->type_info == nullptr) return "";
+  if(pexp->id_info->is_ptr){
+    size = pointer_size();
+  }else{
+    size = data_type_size(pexp->id_info->type_info->type_specifier.simple_type[0]);
+  }
+  cast = insncls->insnsize_name(get_insn_size_type(size));
+  return cast + "[" + pexp->tok.lexeme + "]";
+}
+
 std::string xlang::x86_gen::get_asm_output_operand(struct asm_operand** asmoprnd)
 {
   struct asm_operand* asmoperand = *asmoprnd;
   std::string constraint = "";
-  struct func_member fmem;
-  struct primary_expr* pexp;
 
   if(asmoperand == nullptr) return constraint;
 
   constraint = asmoperand->constraint.lexeme;
 
-  if(constraint == "=a"){
-    return "eax";
-  }else if(constraint == "=b"){
-    return "ebx";
-  }else if(constraint == "=c"){
-    return "ecx";
-  }else if(constraint == "=d"){
-    return "edx";
-  }else if(constraint == "=S"){
-    return "esi";
-  }else if(constraint == "=D"){
-    return "edi";
-  }else if(constraint == "=m"){
-    pexp = asmoperand->expression->primary_expression;
-    get_function_local_member(&fmem, pexp->tok);
-    if(fmem.insize != -1){
-      std::string cast = insncls->insnsize_name(get_insn_size_type(fmem.insize));
-      if(fmem.fp_disp < 0){
-        return cast + "[ebp - "+std::to_string(fmem.fp_disp*(-1)) + "]";
-      }else{
-        return cast+"[ebp + "+std::to_string(fmem.fp_disp)+"]";
-      }
-    }else{
-      if(pexp->id_info == nullptr){
-        pexp->id_info = search_id(pexp->tok.lexeme);
-      }
-      if(pexp->id_info != nullptr){
-        token type = pexp->id_info->type_info->type_specifier.simple_type[0];
-        std::string cast = insncls->insnsize_name(get_insn_size_type(data_type_size(type)));
-        return cast + "[" + pexp->tok.lexeme + "]";
-      }
-    }
+  if(constraint.length() != 2 || constraint[0] != '=') return "";
+  if(constraint[1] == 'm'){
+    if(asmoperand->expression == nullptr) return "";
+    return get_asm_memory_operand(asmoperand->expression->primary_expression);
   }
-  return "";
+  return get_asm_register(constraint[1]);
 }
 
 std::string xlang::x86_gen::get_asm_input_operand(struct asm_operand** asmoprnd)
 {
   struct asm_operand* asmoperand = *asmoprnd;
   std::string constraint = "", mem = "";
-  struct func_member fmem;
   token_t t;
   token tok;
-  struct primary_expr* pexp;
+  struct primary_expr* pexp = nullptr;
   std::string literal;
   int decm;
 
@@ -2288,39 +3667,12 @@ std::string xlang::x86_gen::get_asm_input_operand(struct asm_operand** asmoprnd)
     }
   }
 
-  if(constraint == "a"){
-    return "eax";
-  }else if(constraint == "b"){
-    return "ebx";
-  }else if(constraint == "c"){
-    return "ecx";
-  }else if(constraint == "d"){
-    return "edx";
-  }else if(constraint == "S"){
-    return "esi";
-  }else if(constraint == "D"){
-    return "edi";
-  }else if(constraint == "i"){
+  if(constraint == "i"){
     return literal;
   }else if(constraint == "m"){
-    get_function_local_member(&fmem, pexp->tok);
-    if(fmem.insize != -1){
-      std::string cast = insncls->insnsize_name(get_insn_size_type(fmem.insize));
-      if(fmem.fp_disp < 0){
-        return cast + "[ebp - " + std::to_string(fmem.fp_disp*(-1)) + "]";
-      }else{
-        return cast + "[ebp + " + std::to_string(fmem.fp_disp) + "]";
-      }
-    }else{
-      if(pexp->id_info == nullptr){
-        pexp->id_info = search_id(pexp->tok.lexeme);
-      }
-      if(pexp->id_info != nullptr){
-        token type = pexp->id_info->type_info->type_specifier.simple_type[0];
-        std::string cast = insncls->insnsize_name(get_insn_size_type(data_type_size(type)));
-        return cast + "[" + pexp->tok.lexeme + "]";
-      }
-    }
+    return get_asm_memory_operand(pexp);
+  }else if(constraint.length() == 1){
+    return get_asm_register(constraint[0]);
   }
   return "";
 }
@@ -2447,11 +3799,15 @@ bool xlang::x86_gen::gen_float_type_condition(struct primary_expr** f1, struct p
     }
   }
 
+  float_condition = true;
+
+  if(use_sse2){
+    gen_sse_compare(fexp1, fexp2);
+    return true;
+  }
+
   if(!fexp1->is_id){
-    dt = search_data(fexp1->tok.lexeme);
-    if(dt == nullptr){
-      dt = create_float_data(decsp, fexp1->tok.lexeme);
-    }
+    dt = create_float_data(decsp, fexp1->tok.lexeme);
     in = get_insn(FLD, 1);
     in->operand_1->type = MEMORY;
     in->operand_1->mem.mem_type = GLOBAL;
@@ -2462,10 +3818,7 @@ bool xlang::x86_gen::gen_float_type_condition(struct primary_expr** f1, struct p
     instructions.push_back(in);
 
     if(!fexp2->is_id){
-      dt = search_data(fexp2->tok.lexeme);
-      if(dt == nullptr){
-        dt = create_float_data(decsp, fexp2->tok.lexeme);
-      }
+      dt = create_float_data(decsp, fexp2->tok.lexeme);
       in = get_insn(FCOM, 1);
       in->operand_1->type = MEMORY;
       in->operand_1->mem.mem_type = GLOBAL;
@@ -2523,10 +3876,7 @@ bool xlang::x86_gen::gen_float_type_condition(struct primary_expr** f1, struct p
     }
 
     if(!fexp2->is_id){
-      dt = search_data(fexp2->tok.lexeme);
-      if(dt == nullptr){
-        dt = create_float_data(decsp, fexp2->tok.lexeme);
-      }
+      dt = create_float_data(decsp, fexp2->tok.lexeme);
       in = get_insn(FCOM, 1);
       in->operand_1->type = MEMORY;
       in->operand_1->mem.mem_type = GLOBAL;
@@ -2575,229 +3925,1425 @@ bool xlang::x86_gen::gen_float_type_condition(struct primary_expr** f1, struct p
   return true;
 }
 
-token_t xlang::x86_gen::gen_select_stmt_condition(struct expr* _expr)
+/*
+returns jump instruction for float comparison,
+fcom+sahf and comiss/comisd set CF,ZF flags same as unsigned comparison
+e.g: jg -> ja, jle -> jbe
+*/
+insn_t xlang::x86_gen::get_float_cond_jump(insn_t ins)
+{
+  switch(ins){
+    case JG : return JA;
+    case JGE : return JAE;
+    case JL : return JB;
+    case JLE : return JBE;
+    case JNG : return JNA;
+    case JNGE : return JNAE;
+    case JNL : return JNB;
+    case JNLE : return JNBE;
+    default: return ins;
+  }
+}
+
+/*
+generate comparison of two primary expressions exp1 op exp2,
+returns comparison operator whose flags are set,
+or NONE if expression is not a comparison
+*/
+token_t xlang::x86_gen::gen_condition_compare(struct primary_expr* pexpr)
 {
-  struct primary_expr* pexpr = nullptr;
   token tok;
   token_t t;
   struct func_member fmem;
   struct insn* in = nullptr;
   token type;
   int dtsize = 0;
-  if(_expr == nullptr) return NONE;
+  float_condition = false;
+  if(pexpr == nullptr) return NONE;
 
   auto resreg = [=](int sz){
             if(sz == 1) return AL; else if(sz == 2) return AX; else return EAX;
           };
 
-  switch(_expr->expr_kind){
-    case PRIMARY_EXPR :
-      pexpr = _expr->primary_expression;
-      if(pexpr == nullptr) return NONE;
-      insert_comment("; condition checking, line "+std::to_string(pexpr->tok.loc.line));
-      //only 2 primary expressions are used exp1 op exp1
-      //others are discaded
-      if(pexpr->is_oprtr){
-        tok = pexpr->tok;
-        t = tok.token;
-        if(t == COMP_EQ || t == COMP_GREAT || t == COMP_GREAT_EQ ||
-            t == COMP_LESS || t == COMP_LESS_EQ || t == COMP_NOT_EQ){
-            //if any one of them is float type
-            if(gen_float_type_condition(&pexpr->left, &pexpr->right, &pexpr))
-              return t;
-
-            //if both are identifiers id op id
-            if(pexpr->left->tok.token == IDENTIFIER && pexpr->right->tok.token == IDENTIFIER){
-              get_function_local_member(&fmem, pexpr->right->tok);
-              type = pexpr->left->id_info->type_info->type_specifier.simple_type[0];
-              dtsize = data_type_size(type);
-              in = get_insn(MOV, 2);
-              in->operand_1->type = REGISTER;
-              in->operand_1->reg = resreg(dtsize);
-              if(fmem.insize != -1){
-                in->operand_2->type = MEMORY;
-                in->operand_2->mem.mem_type = LOCAL;
-                in->operand_2->mem.mem_size = fmem.insize;
-                in->operand_2->mem.fp_disp = fmem.fp_disp;
-              }else{
-                in->operand_2->type = MEMORY;
-                in->operand_2->mem.name = pexpr->right->tok.lexeme;
-                in->operand_2->mem.mem_type = GLOBAL;
-                in->operand_2->mem.mem_size =
-                  data_type_size(pexpr->right->id_info->type_info->type_specifier.simple_type[0]);
-              }
-              instructions.push_back(in);
-              in = nullptr;
-
-              type = pexpr->right->id_info->type_info->type_specifier.simple_type[0];
-              dtsize = data_type_size(type);
-              get_function_local_member(&fmem, pexpr->left->tok);
-              in = get_insn(CMP, 2);
-              in->operand_2->type = REGISTER;
-              in->operand_2->reg = resreg(dtsize);
-              if(fmem.insize != -1){
-                in->operand_1->type = MEMORY;
-                in->operand_1->mem.mem_type = LOCAL;
-                in->operand_1->mem.mem_size = fmem.insize;
-                in->operand_1->mem.fp_disp = fmem.fp_disp;
-              }else{
-                in->operand_1->type = MEMORY;
-                in->operand_1->mem.name = pexpr->left->tok.lexeme;
-                in->operand_1->mem.mem_type = GLOBAL;
-                in->operand_1->mem.mem_size =
-                  data_type_size(pexpr->left->id_info->type_info->type_specifier.simple_type[0]);
-              }
-              instructions.push_back(in);
-              in = nullptr;
-            }else if(pexpr->left->tok.token == IDENTIFIER && is_literal(pexpr->right->tok)){
-              get_function_local_member(&fmem, pexpr->left->tok);
-              in = get_insn(CMP, 2);
-              in->operand_2->type = LITERAL;
-              in->operand_2->literal = std::to_string(get_decimal(pexpr->right->tok));
-              if(fmem.insize != -1){
-                in->operand_1->type = MEMORY;
-                in->operand_1->mem.mem_type = LOCAL;
-                in->operand_1->mem.mem_size = fmem.insize;
-                in->operand_1->mem.fp_disp = fmem.fp_disp;
-              }else{
-                in->operand_1->type = MEMORY;
-                in->operand_1->mem.name = pexpr->left->tok.lexeme;
-                in->operand_1->mem.mem_type = GLOBAL;
-                in->operand_1->mem.mem_size =
-                  data_type_size(pexpr->left->id_info->type_info->type_specifier.simple_type[0]);
-              }
-              instructions.push_back(in);
-            }else if(is_literal(pexpr->left->tok) && pexpr->right->tok.token == IDENTIFIER){
-              get_function_local_member(&fmem, pexpr->right->tok);
-              in = get_insn(CMP, 2);
-              in->operand_2->type = LITERAL;
-              in->operand_2->literal = std::to_string(get_decimal(pexpr->left->tok));
-              if(fmem.insize != -1){
-                in->operand_1->type = MEMORY;
-                in->operand_1->mem.mem_type = LOCAL;
-                in->operand_1->mem.mem_size = fmem.insize;
-                in->operand_1->mem.fp_disp = fmem.fp_disp;
-              }else{
-                in->operand_1->type = MEMORY;
-                in->operand_1->mem.name = pexpr->right->tok.lexeme;
-                in->operand_1->mem.mem_type = GLOBAL;
-                in->operand_1->mem.mem_size =
-                  data_type_size(pexpr->right->id_info->type_info->type_specifier.simple_type[0]);
-              }
-              instructions.push_back(in);
-            }else if(is_literal(pexpr->left->tok) && is_literal(pexpr->right->tok)){
-              in = get_insn(MOV, 2);
-              in->operand_1->type = REGISTER;
-              in->operand_1->reg = EAX;
-              in->operand_2->type = LITERAL;
-              in->operand_2->literal = std::to_string(get_decimal(pexpr->left->tok));
-              instructions.push_back(in);
-              in = nullptr;
+  //only 2 primary expressions are used exp1 op exp1
+  //others are discaded
+  if(pexpr->is_oprtr){
+    tok = pexpr->tok;
+    t = tok.token;
+    if(t == COMP_EQ || t == COMP_GREAT || t == COMP_GREAT_EQ ||
+        t == COMP_LESS || t == COMP_LESS_EQ || t == COMP_NOT_EQ){
+        //if any one of them is float type
+        if(gen_float_type_condition(&pexpr->left, &pexpr->right, &pexpr))
+          return t;
+
+        //if both are identifiers id op id
+        if(pexpr->left->tok.token == IDENTIFIER && pexpr->right->tok.token == IDENTIFIER){
+          get_function_local_member(&fmem, pexpr->right->tok);
+          type = pexpr->left->id_info->type_info->type_specifier.simple_type[0];
+          dtsize = data_type_size(type);
+          in = get_insn(MOV, 2);
+          in->operand_1->type = REGISTER;
+          in->operand_1->reg = resreg(dtsize);
+          if(fmem.insize != -1){
+            in->operand_2->type = MEMORY;
+            in->operand_2->mem.mem_type = LOCAL;
+            in->operand_2->mem.mem_size = fmem.insize;
+            in->operand_2->mem.fp_disp = fmem.fp_disp;
+          }else{
+            in->operand_2->type = MEMORY;
+            in->operand_2->mem.name = pexpr->right->tok.lexeme;
+            in->operand_2->mem.mem_type = GLOBAL;
+            in->operand_2->mem.mem_size =
+              data_type_size(pexpr->right->id_info->type_info->type_specifier.simple_type[0]);
+          }
+          instructions.push_back(in);
+          in = nullptr;
 
-              in = get_insn(CMP, 2);
-              in->operand_1->type = REGISTER;
-              in->operand_1->reg = EAX;
-              in->operand_2->type = LITERAL;
-              in->operand_2->literal = std::to_string(get_decimal(pexpr->right->tok));
-              instructions.push_back(in);
-            }
-            return t;
+          type = pexpr->right->id_info->type_info->type_specifier.simple_type[0];
+          dtsize = data_type_size(type);
+          get_function_local_member(&fmem, pexpr->left->tok);
+          in = get_insn(CMP, 2);
+          in->operand_2->type = REGISTER;
+          in->operand_2->reg = resreg(dtsize);
+          if(fmem.insize != -1){
+            in->operand_1->type = MEMORY;
+            in->operand_1->mem.mem_type = LOCAL;
+            in->operand_1->mem.mem_size = fmem.insize;
+            in->operand_1->mem.fp_disp = fmem.fp_disp;
+          }else{
+            in->operand_1->type = MEMORY;
+            in->operand_1->mem.name = pexpr->left->tok.lexeme;
+            in->operand_1->mem.mem_type = GLOBAL;
+            in->operand_1->mem.mem_size =
+              data_type_size(pexpr->left->id_info->type_info->type_specifier.simple_type[0]);
+          }
+          instructions.push_back(in);
+          in = nullptr;
+        }else if(pexpr->left->tok.token == IDENTIFIER && is_literal(pexpr->right->tok)){
+          get_function_local_member(&fmem, pexpr->left->tok);
+          in = get_insn(CMP, 2);
+          in->operand_2->type = LITERAL;
+          in->operand_2->literal = std::to_string(get_decimal(pexpr->right->tok));
+          if(fmem.insize != -1){
+            in->operand_1->type = MEMORY;
+            in->operand_1->mem.mem_type = LOCAL;
+            in->operand_1->mem.mem_size = fmem.insize;
+            in->operand_1->mem.fp_disp = fmem.fp_disp;
+          }else{
+            in->operand_1->type = MEMORY;
+            in->operand_1->mem.name = pexpr->left->tok.lexeme;
+            in->operand_1->mem.mem_type = GLOBAL;
+            in->operand_1->mem.mem_size =
+              data_type_size(pexpr->left->id_info->type_info->type_specifier.simple_type[0]);
+          }
+          instructions.push_back(in);
+        }else if(is_literal(pexpr->left->tok) && pexpr->right->tok.token == IDENTIFIER){
+          get_function_local_member(&fmem, pexpr->right->tok);
+          in = get_insn(CMP, 2);
+          in->operand_2->type = LITERAL;
+          in->operand_2->literal = std::to_string(get_decimal(pexpr->left->tok));
+          if(fmem.insize != -1){
+            in->operand_1->type = MEMORY;
+            in->operand_1->mem.mem_type = LOCAL;
+            in->operand_1->mem.mem_size = fmem.insize;
+            in->operand_1->mem.fp_disp = fmem.fp_disp;
+          }else{
+            in->operand_1->type = MEMORY;
+            in->operand_1->mem.name = pexpr->right->tok.lexeme;
+            in->operand_1->mem.mem_type = GLOBAL;
+            in->operand_1->mem.mem_size =
+              data_type_size(pexpr->right->id_info->type_info->type_specifier.simple_type[0]);
+          }
+          instructions.push_back(in);
+          //literal op id is compared as id op literal, mirror relation
+          switch(t){
+            case COMP_GREAT : return COMP_LESS;
+            case COMP_GREAT_EQ : return COMP_LESS_EQ;
+            case COMP_LESS : return COMP_GREAT;
+            case COMP_LESS_EQ : return COMP_GREAT_EQ;
+            default : return t;
+          }
+        }else if(is_literal(pexpr->left->tok) && is_literal(pexpr->right->tok)){
+          in = get_insn(MOV, 2);
+          in->operand_1->type = REGISTER;
+          in->operand_1->reg = EAX;
+          in->operand_2->type = LITERAL;
+          in->operand_2->literal = std::to_string(get_decimal(pexpr->left->tok));
+          instructions.push_back(in);
+          in = nullptr;
+
+          in = get_insn(CMP, 2);
+          in->operand_1->type = REGISTER;
+          in->operand_1->reg = EAX;
+          in->operand_2->type = LITERAL;
+          in->operand_2->literal = std::to_string(get_decimal(pexpr->right->tok));
+          instructions.push_back(in);
         }
-      }
-      break;
+        return t;
+    }
+  }
+  return NONE;
+}
+
+//returns true if condition is combined by &&, || or !
+bool xlang::x86_gen::is_compound_condition(struct expr* _expr)
+{
+  token_t t;
+  if(_expr == nullptr || _expr->expr_kind != PRIMARY_EXPR) return false;
+  if(_expr->primary_expression == nullptr) return false;
+  if(!_expr->primary_expression->is_oprtr) return false;
+  t = _expr->primary_expression->tok.token;
+  return (t == LOG_AND || t == LOG_OR || t == LOG_NOT);
+}
+
+/*
+returns jump instruction taken when comparison is true,
+or when it is false if when_true is not set
+*/
+insn_t xlang::x86_gen::get_cond_jump(token_t cond, bool when_true)
+{
+  insn_t ins;
+  switch(cond){
+    case COMP_EQ : ins = (when_true ? JE : JNE); break;
+    case COMP_GREAT : ins = (when_true ? JG : JLE); break;
+    case COMP_GREAT_EQ : ins = (when_true ? JGE : JL); break;
+    case COMP_LESS : ins = (when_true ? JL : JGE); break;
+    case COMP_LESS_EQ : ins = (when_true ? JLE : JG); break;
+    case COMP_NOT_EQ : ins = (when_true ? JNE : JE); break;
+    default: return INSNONE;
+  }
+  //float comparison sets flags as unsigned comparison
+  if(float_condition)
+    ins = get_float_cond_jump(ins);
+  return ins;
+}
+
+/*
+compare identifier operand of condition with 0,
+operand of ! has no symbol info from analyzer, so it is searched here
+cmp dword[ebp - 4], 0
+returns false if identifier is not an integer or pointer variable
+*/
+bool xlang::x86_gen::gen_condition_test_id(struct primary_expr* pexpr)
+{
+  struct insn* in = nullptr;
+  struct st_symbol_info* syminf = pexpr->id_info;
+  struct func_member fmem;
+  token type;
+  int size = 0;
+
+  if(syminf == nullptr)
+    syminf = search_id(pexpr->tok.lexeme);
+  if(syminf == nullptr || syminf->type_info == nullptr) return false;
+
+  if(syminf->is_ptr){
+    size = pointer_size();
+  }else if(syminf->type_info->type == SIMPLE_TYPE){
+    type = syminf->type_info->type_specifier.simple_type[0];
+    if(type.token == KEY_FLOAT || type.token == KEY_DOUBLE) return false;
+    size = data_type_size(type);
+  }
+  if(size <= 0) return false;
+
+  in = get_insn(CMP, 2);
+  in->operand_1->type = MEMORY;
+  in->operand_1->mem.mem_size = size;
+  if(get_function_local_member(&fmem, pexpr->tok)){
+    in->operand_1->mem.mem_type = LOCAL;
+    in->operand_1->mem.fp_disp = fmem.fp_disp;
+  }else{
+    in->operand_1->mem.mem_type = GLOBAL;
+    in->operand_1->mem.name = syminf->symbol;
+  }
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = "0";
+  instructions.push_back(in);
+  return true;
+}
+
+/*
+short-circuit lowering of condition combined by &&, ||, !
+jumps to label when value of condition is jump_if, otherwise falls through.
+Each comparison jumps directly to its target instead of computing 0/1 value,
+operand which is not a comparison is tested against 0
+  a < b && c < d               a < b || c < d
+  (jump if false)              (jump if false)
+    cmp a, b                     cmp a, b
+    jge label                    jl .cond_skip1
+    cmp c, d                     cmp c, d
+    jge label                    jge label
+                               .cond_skip1:
+*/
+void xlang::x86_gen::gen_condition_branch(struct primary_expr* pexpr,
+                                          std::string label, bool jump_if)
+{
+  struct insn* in = nullptr;
+  std::string skip;
+  std::pair<int, int> pr;
+  token_t cond = NONE;
+
+  if(pexpr == nullptr) return;
+
+  if(pexpr->is_oprtr){
+    switch(pexpr->tok.token){
+      case LOG_NOT :
+        gen_condition_branch(pexpr->unary_node, label, !jump_if);
+        return;
+      case LOG_AND :
+      case LOG_OR :
+        if((pexpr->tok.token == LOG_AND) != jump_if){
+          //false operand of && or true operand of || decides condition
+          gen_condition_branch(pexpr->left, label, jump_if);
+          gen_condition_branch(pexpr->right, label, jump_if);
+        }else{
+          //right operand is not evaluated when left one decides condition
+          skip = ".cond_skip"+std::to_string(cond_label_count);
+          cond_label_count++;
+          gen_condition_branch(pexpr->left, skip, !jump_if);
+          gen_condition_branch(pexpr->right, label, jump_if);
+          in = get_insn(INSLABEL, 0);
+          in->label = skip;
+          insncls->delete_operand(&(in->operand_1));
+          insncls->delete_operand(&(in->operand_2));
+          instructions.push_back(in);
+        }
+        return;
+      default:
+        cond = gen_condition_compare(pexpr);
+        break;
+    }
+  }
+
+  if(cond == NONE){
+    if(!pexpr->is_oprtr && !pexpr->is_id && is_literal(pexpr->tok)){
+      //constant operand, jump always or never
+      if((get_decimal(pexpr->tok) != 0) != jump_if) return;
+      in = get_insn(JMP, 1);
+      in->operand_1->type = LITERAL;
+      in->operand_1->literal = label;
+      insncls->delete_operand(&(in->operand_2));
+      instructions.push_back(in);
+      return;
+    }
+    if(pexpr->is_id && pexpr->left == nullptr && pexpr->right == nullptr){
+      if(!gen_condition_test_id(pexpr)) return;
+    }else{
+      if(has_float(pexpr)) return;
+      pr = gen_primary_expression(&pexpr);
+      if(pr.first != 1 || pr.second == RNONE) return;
+      in = get_insn(TEST, 2);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = static_cast<regs_t>(pr.second);
+      in->operand_2->type = REGISTER;
+      in->operand_2->reg = static_cast<regs_t>(pr.second);
+      instructions.push_back(in);
+    }
+    float_condition = false;
+    cond = COMP_NOT_EQ;
+  }
+
+  in = get_insn(get_cond_jump(cond, jump_if), 1);
+  in->operand_1->type = LITERAL;
+  in->operand_1->literal = label;
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+}
+
+//condition of selection/iteration statement combined by &&, ||, !
+void xlang::x86_gen::gen_compound_condition(struct expr* _expr,
+                                            std::string label, bool jump_if)
+{
+  struct primary_expr* pexpr = _expr->primary_expression;
+  insert_comment("; condition checking, line "+std::to_string(pexpr->tok.loc.line));
+  gen_condition_branch(pexpr, label, jump_if);
+  xlang::stats::count("condition.short-circuit");
+}
+
+token_t xlang::x86_gen::gen_select_stmt_condition(struct expr* _expr)
+{
+  struct primary_expr* pexpr = nullptr;
+  float_condition = false;
+  if(_expr == nullptr) return NONE;
+
+  switch(_expr->expr_kind){
+    case PRIMARY_EXPR :
+      pexpr = _expr->primary_expression;
+      if(pexpr == nullptr) return NONE;
+      insert_comment("; condition checking, line "+std::to_string(pexpr->tok.loc.line));
+      return gen_condition_compare(pexpr);
 
     default: xlang::error::print_error(xlang::filename,
             "only primary expr supported in code generation");
     break;
   }
-  return NONE;
-}
+  return NONE;
+}
+
+//returns true if symbol is 4 byte int scalar variable
+bool xlang::x86_gen::is_select_variable(struct st_symbol_info* syminfo)
+{
+  token_t t;
+  if(syminfo == nullptr || syminfo->type_info == nullptr) return false;
+  if(syminfo->is_ptr || syminfo->is_func_ptr || syminfo->is_array) return false;
+  if(syminfo->type_info->type != SIMPLE_TYPE
+      || syminfo->type_info->type_specifier.simple_type.size() != 1)
+    return false;
+  t = syminfo->type_info->type_specifier.simple_type[0].token;
+  return (t == KEY_INT || t == KEY_LONG);
+}
+
+//returns true if value is int literal or int scalar variable
+bool xlang::x86_gen::is_select_operand(struct primary_expr* pexpr)
+{
+  if(pexpr == nullptr || pexpr->is_oprtr) return false;
+  if(pexpr->left != nullptr || pexpr->right != nullptr
+      || pexpr->unary_node != nullptr)
+    return false;
+  if(pexpr->is_id)
+    return is_select_variable(pexpr->id_info);
+  return is_literal(pexpr->tok);
+}
+
+/*
+get assignment x = v from if/else statement list with only one statement,
+where x is int scalar variable and v is int literal or variable
+*/
+bool xlang::x86_gen::get_select_assignment(struct stmt* statement,
+                          struct id_expr** target, struct primary_expr** value)
+{
+  struct assgn_expr* assgnexp = nullptr;
+  struct id_expr* left = nullptr;
+
+  if(statement == nullptr || statement->p_next != nullptr) return false;
+  if(statement->type != EXPR_STMT || statement->expression_statement == nullptr)
+    return false;
+  if(statement->expression_statement->expression == nullptr) return false;
+  if(statement->expression_statement->expression->expr_kind != ASSGN_EXPR)
+    return false;
+  assgnexp = statement->expression_statement->expression->assgn_expression;
+  if(assgnexp == nullptr || assgnexp->tok.token != ASSGN) return false;
+  if(assgnexp->expression == nullptr || assgnexp->expression->expr_kind != PRIMARY_EXPR)
+    return false;
+  left = assgnexp->id_expression;
+  if(left == nullptr || left->is_oprtr || !left->is_id || left->is_subscript
+      || left->is_ptr || left->left != nullptr || left->right != nullptr
+      || left->unary != nullptr)
+    return false;
+  if(!is_select_variable(left->id_info)) return false;
+  if(!is_select_operand(assgnexp->expression->primary_expression)) return false;
+  *target = left;
+  *value = assgnexp->expression->primary_expression;
+  return true;
+}
+
+//set operand as memory location of variable or literal value
+void xlang::x86_gen::get_select_operand(struct primary_expr* pexpr, struct operand* opr)
+{
+  struct func_member fmem;
+  if(!pexpr->is_id){
+    opr->type = LITERAL;
+    opr->literal = std::to_string(get_decimal(pexpr->tok));
+    return;
+  }
+  opr->type = MEMORY;
+  opr->mem.mem_size = 4;
+  if(get_function_local_member(&fmem, pexpr->id_info->tok)){
+    opr->mem.mem_type = LOCAL;
+    opr->mem.fp_disp = fmem.fp_disp;
+  }else{
+    opr->mem.mem_type = GLOBAL;
+    opr->mem.name = pexpr->id_info->symbol;
+  }
+}
+
+/*
+if-conversion of small if/else statement assigning same int variable
+with int literal or variable values, whose evaluation has no side effect,
+  if(a > b){ m = a; }else{ m = b; }
+is generated without branch by conditional move(P6+)
+  cmp ...             ; condition
+  mov ecx, [b]        ; else value
+  cmovg ecx, [a]      ; then value
+  mov [m], ecx
+and if both values are literals, by setcc with mask
+  if(a > b){ m = c1; }else{ m = c0; }
+  cmp ...
+  setg al
+  movzx eax, al       ; 0/1
+  neg eax             ; 0/-1, when c1 - c0 is not 1
+  and eax, c1 - c0
+  add eax, c0
+  mov [m], eax
+if statement without else keeps current value of m.
+returns false if statement is not converted, then nothing is generated
+*/
+bool xlang::x86_gen::gen_branchless_selection(struct select_stmt* selstmt)
+{
+  struct id_expr *then_target = nullptr, *else_target = nullptr;
+  struct primary_expr *then_value = nullptr, *else_value = nullptr;
+  struct primary_expr* pexpr = nullptr;
+  struct primary_expr target_id;
+  struct insn* in = nullptr;
+  insn_t jcc;
+  token_t cond;
+  int c1, c0;
+
+  if(selstmt->condition == nullptr) return false;
+  if(selstmt->condition->expr_kind != PRIMARY_EXPR) return false;
+  pexpr = selstmt->condition->primary_expression;
+  if(pexpr == nullptr || !pexpr->is_oprtr || has_float(pexpr)) return false;
+  cond = pexpr->tok.token;
+  if(cond != COMP_EQ && cond != COMP_GREAT && cond != COMP_GREAT_EQ &&
+      cond != COMP_LESS && cond != COMP_LESS_EQ && cond != COMP_NOT_EQ)
+    return false;
+  if(!is_select_operand(pexpr->left) || !is_select_operand(pexpr->right))
+    return false;
+
+  if(!get_select_assignment(selstmt->if_statement, &then_target, &then_value))
+    return false;
+  target_id.tok = then_target->tok;
+  target_id.is_oprtr = false;
+  target_id.is_id = true;
+  target_id.id_info = then_target->id_info;
+  target_id.left = target_id.right = target_id.unary_node = nullptr;
+  if(selstmt->else_statement != nullptr){
+    if(!get_select_assignment(selstmt->else_statement, &else_target, &else_value))
+      return false;
+    if(else_target->id_info != then_target->id_info) return false;
+  }else{
+    //m = m when condition is false
+    else_value = &target_id;
+  }
+
+  cond = gen_select_stmt_condition(selstmt->condition);
+  jcc = get_cond_jump(cond, true);
+  if(jcc == INSNONE) return false;
+
+  if(!then_value->is_id && !else_value->is_id){
+    c1 = get_decimal(then_value->tok);
+    c0 = get_decimal(else_value->tok);
+    in = get_insn(insncls->cond_set_insn(jcc), 1);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = AL;
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+
+    in = get_insn(MOVZX, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EAX;
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = AL;
+    instructions.push_back(in);
+
+    if(c1 - c0 != 1){
+      in = get_insn(NEG, 1);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = EAX;
+      insncls->delete_operand(&(in->operand_2));
+      instructions.push_back(in);
+
+      in = get_insn(AND, 2);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = EAX;
+      in->operand_2->type = LITERAL;
+      in->operand_2->literal = std::to_string(c1 - c0);
+      instructions.push_back(in);
+    }
+    if(c0 != 0){
+      in = get_insn(ADD, 2);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = EAX;
+      in->operand_2->type = LITERAL;
+      in->operand_2->literal = std::to_string(c0);
+      instructions.push_back(in);
+    }
+    xlang::stats::count("ifconvert.setcc");
+  }else{
+    in = get_insn(MOV, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = ECX;
+    get_select_operand(else_value, in->operand_2);
+    in->comment = "    ; else value";
+    instructions.push_back(in);
+
+    //cmovcc does not take immediate operand
+    if(!then_value->is_id){
+      in = get_insn(MOV, 2);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = EDX;
+      get_select_operand(then_value, in->operand_2);
+      instructions.push_back(in);
+    }
+
+    in = get_insn(insncls->cond_move_insn(jcc), 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = ECX;
+    if(then_value->is_id){
+      get_select_operand(then_value, in->operand_2);
+    }else{
+      in->operand_2->type = REGISTER;
+      in->operand_2->reg = EDX;
+    }
+    in->comment = "    ; then value";
+    instructions.push_back(in);
+    xlang::stats::count("ifconvert.cmov");
+  }
+
+  in = get_insn(MOV, 2);
+  in->operand_1->type = MEMORY;
+  in->operand_2->type = REGISTER;
+  in->operand_2->reg = (then_value->is_id || else_value->is_id) ? ECX : EAX;
+  get_select_operand(&target_id, in->operand_1);
+  in->comment = "    ; line: "+std::to_string(then_target->tok.loc.line)
+                +", assign "+then_target->tok.lexeme;
+  instructions.push_back(in);
+  return true;
+}
+
+extern bool profile_generate;
+
+/*
+with -fprofile-use, statement of if/else that runs more often falls through
+after condition, and statement that never runs is moved after ret of function,
+e.g. hotter else statement
+
+  jcc .if_label
+.else_label:
+  ...else statement...
+  jmp .exit_if
+.if_label:
+  ...if statement...
+.exit_if:
+*/
+void xlang::x86_gen::gen_selection_statement(struct select_stmt** slstmt)
+{
+  struct select_stmt* selstmt = *slstmt;
+  token_t cond;
+  struct insn* in = nullptr;
+  unsigned ifcnt;
+  int line;
+  long long then_count = -1, else_count = -1;
+  bool compound, else_first = false, cold_then = false, cold_else = false;
+  size_t cold_start;
+
+  if(selstmt == nullptr) return;
+
+  if(optimize && gen_branchless_selection(selstmt)) return;
+
+  //labels of nested if statements are numbered after labels of outer one
+  ifcnt = if_label_count;
+  if_label_count++;
+
+  line = selstmt->iftok.loc.line;
+  compound = is_compound_condition(selstmt->condition);
+  if(optimize && xlang::profile::is_loaded()){
+    then_count = xlang::profile::get_count(line, "then");
+    else_count = xlang::profile::get_count(line, "else");
+  }
+  if(then_count >= 0 && else_count >= 0){
+    //compound condition falls through to if statement
+    cold_then = !compound && then_count == 0 && else_count > 0;
+    else_first = !compound && !cold_then && selstmt->else_statement != nullptr
+                  && else_count > then_count;
+    cold_else = !else_first && else_count == 0 && then_count > 0
+                  && selstmt->else_statement != nullptr;
+  }
+
+  auto gen_else = [&](bool exit_jump){
+    //create else label
+    in = get_insn(INSLABEL, 0);
+    in->label = ".else_label"+std::to_string(ifcnt);
+    insncls->delete_operand(&(in->operand_1));
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+    if(profile_generate)
+      gen_profile_counter(line, "else");
+
+    //generate else statement
+    if(selstmt->else_statement != nullptr){
+      gen_statement(&(selstmt->else_statement));
+    }
+    if(exit_jump){
+      in = get_insn(JMP, 1);
+      in->operand_1->type = LITERAL;
+      in->operand_1->literal = ".exit_if"+std::to_string(ifcnt);
+      insncls->delete_operand(&(in->operand_2));
+      instructions.push_back(in);
+    }
+  };
+
+  if(compound){
+    //jump to else when condition is false, fall through to if statement
+    gen_compound_condition(selstmt->condition,
+          ".else_label"+std::to_string(ifcnt), false);
+  }else{
+    cond = gen_select_stmt_condition(selstmt->condition);
+
+    in = get_insn(JMP, 1);
+    in->operand_1->type = LITERAL;
+    in->operand_1->literal = ".if_label"+std::to_string(ifcnt);
+    insncls->delete_operand(&(in->operand_2));
+    if(cond != NONE)
+      in->insn_type = get_cond_jump(cond, true);
+    instructions.push_back(in);
+
+    if(else_first || cold_then){
+      gen_else(!cold_then);
+    }else{
+      //jump after if statement for else
+      in = get_insn(JMP, 1);
+      in->operand_1->type = LITERAL;
+      in->operand_1->literal = ".else_label"+std::to_string(ifcnt);
+      insncls->delete_operand(&(in->operand_2));
+      instructions.push_back(in);
+    }
+  }
+
+  //create if label
+  cold_start = instructions.size();
+  in = get_insn(INSLABEL, 0);
+  in->label = ".if_label"+std::to_string(ifcnt);
+  insncls->delete_operand(&(in->operand_1));
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+  if(profile_generate)
+    gen_profile_counter(line, "then");
+
+  //gen if statement
+  if(selstmt->if_statement != nullptr){
+    gen_statement(&(selstmt->if_statement));
+  }
+  if(cold_then || (!else_first && selstmt->if_statement != nullptr)){
+    in = get_insn(JMP, 1);
+    in->operand_1->type = LITERAL;
+    in->operand_1->literal = ".exit_if"+std::to_string(ifcnt);
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+  }
+  if(cold_then){
+    move_to_cold_code(cold_start);
+    xlang::stats::count("profile.cold-blocks");
+  }
+
+  if(!else_first && !cold_then){
+    cold_start = instructions.size();
+    gen_else(cold_else);
+    if(cold_else){
+      move_to_cold_code(cold_start);
+      xlang::stats::count("profile.cold-blocks");
+    }
+  }else if(else_first){
+    xlang::stats::count("profile.reordered-blocks");
+  }
+
+  in = get_insn(INSLABEL, 0);
+  in->label = ".exit_if"+std::to_string(ifcnt);
+  insncls->delete_operand(&(in->operand_1));
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+}
+
+extern bool vectorize_loops;
+
+/*
+loop vectorizer, innermost for loop over global int/float arrays
+is computed 4 iterations at a time using packed SSE2 instructions, e.g.
+  for(i = 0; i < n; i++){
+    t = b[i];
+    a[i] = t * 10 + i;
+  }
+each statement must be an assignment to array subscript by loop index
+or to scalar temporary, arrays are only subscripted by loop index,
+so iterations do not depend on each other through memory.
+remaining iterations are computed by original scalar for loop
+*/
+
+/*
+get type(int/float) of 4 byte scalar symbol,
+or element type of global one dimensional array symbol
+*/
+bool xlang::x86_gen::get_vector_type(struct st_symbol_info* syminfo, bool array, token_t* type)
+{
+  struct func_member fmem;
+  token_t t;
+
+  if(syminfo == nullptr || syminfo->type_info == nullptr) return false;
+  if(syminfo->is_ptr || syminfo->is_func_ptr || syminfo->is_array != array)
+    return false;
+  if(syminfo->type_info->type != SIMPLE_TYPE
+     || syminfo->type_info->type_specifier.simple_type.size() != 1)
+    return false;
+  t = syminfo->type_info->type_specifier.simple_type[0].token;
+  if(t != KEY_INT && t != KEY_FLOAT) return false;
+  //arrays are addressed by symbol name, [a + ecx * 4]
+  if(array && (syminfo->arr_dimension_list.size() != 1
+      || get_function_local_member(&fmem, syminfo->tok)))
+    return false;
+  *type = t;
+  return true;
+}
+
+//returns true if leaf of primary expression is index of vectorized loop
+bool xlang::x86_gen::is_vector_index(struct primary_expr* pexpr)
+{
+  return (pexpr != nullptr && !pexpr->is_oprtr && pexpr->is_id
+          && pexpr->tok.lexeme == vector_index && pexpr->left == nullptr
+          && pexpr->right == nullptr && pexpr->unary_node == nullptr);
+}
+
+//returns true if id expression is array subscript by loop index, a[i]
+bool xlang::x86_gen::is_vector_subscript(struct id_expr* idexpr, token_t* type)
+{
+  if(idexpr == nullptr || idexpr->is_oprtr || !idexpr->is_id || idexpr->is_ptr
+      || idexpr->left != nullptr || idexpr->right != nullptr || idexpr->unary != nullptr)
+    return false;
+  if(!idexpr->is_subscript || idexpr->subscript.size() != 1) return false;
+  if(idexpr->subscript.front().token != IDENTIFIER
+      || idexpr->subscript.front().lexeme != vector_index)
+    return false;
+  return get_vector_type(idexpr->id_info, true, type);
+}
+
+//returns true if id expression is scalar which can be kept in xmm register
+bool xlang::x86_gen::is_vector_temp(struct id_expr* idexpr, token_t* type)
+{
+  if(idexpr == nullptr || idexpr->is_oprtr || !idexpr->is_id || idexpr->is_ptr
+      || idexpr->is_subscript || idexpr->left != nullptr || idexpr->right != nullptr
+      || idexpr->unary != nullptr)
+    return false;
+  if(idexpr->tok.lexeme == vector_index) return false;
+  return get_vector_type(idexpr->id_info, false, type);
+}
+
+//returns true if xmm register holds value of a temporary
+bool xlang::x86_gen::is_vector_temp_reg(fregs_t r)
+{
+  for(auto& x : vector_temps){
+    if(x.second.second == r) return true;
+  }
+  return false;
+}
+
+/*
+returns true if primary expression can be computed in packed type,
+int: + - * & | ^, << >> by literal
+float: + - * /
+leaves are literals, loop index, loop invariant variables
+and temporaries already assigned in loop body,
+temporary used before its assignment carries value between iterations
+*/
+bool xlang::x86_gen::is_vectorizable_expr(struct primary_expr* pexpr, token_t type,
+                                          std::unordered_set<std::string>& assigned)
+{
+  token_t t;
+  int value;
+
+  if(pexpr == nullptr) return false;
+
+  if(pexpr->is_oprtr){
+    if(pexpr->oprtr_kind != BINARY_OP || pexpr->left == nullptr
+        || pexpr->right == nullptr)
+      return false;
+    switch(pexpr->tok.token){
+      case ARTHM_ADD :
+      case ARTHM_SUB :
+      case ARTHM_MUL :
+        break;
+      case ARTHM_DIV :
+        if(type != KEY_FLOAT) return false;
+        break;
+      case BIT_AND :
+      case BIT_OR :
+      case BIT_EXOR :
+        if(type != KEY_INT) return false;
+        break;
+      case BIT_LSHIFT :
+      case BIT_RSHIFT :
+        if(type != KEY_INT || pexpr->right->is_oprtr || pexpr->right->is_id
+            || !is_literal(pexpr->right->tok) || pexpr->right->tok.token == LIT_CHAR)
+          return false;
+        value = get_decimal(pexpr->right->tok);
+        if(value < 0 || value > 31) return false;
+        return is_vectorizable_expr(pexpr->left, type, assigned);
+      default :
+        return false;
+    }
+    return (is_vectorizable_expr(pexpr->left, type, assigned)
+            && is_vectorizable_expr(pexpr->right, type, assigned));
+  }
+
+  if(pexpr->left != nullptr || pexpr->right != nullptr || pexpr->unary_node != nullptr)
+    return false;
+  if(!pexpr->is_id){
+    if(pexpr->tok.token == LIT_FLOAT)
+      return (type == KEY_FLOAT);
+    return (is_literal(pexpr->tok) && pexpr->tok.token != LIT_CHAR);
+  }
+  if(is_vector_index(pexpr)) return true;
+  if(!get_vector_type(pexpr->id_info, false, &t)) return false;
+  //int values are only converted to float
+  if(t == KEY_FLOAT && type == KEY_INT) return false;
+  if(vector_temps.find(pexpr->tok.lexeme) != vector_temps.end()
+      && assigned.find(pexpr->tok.lexeme) == assigned.end())
+    return false;
+  return true;
+}
+
+/*
+returns true if for loop can be vectorized,
+for(...; i < n; i++) or for(...; i <= n; i = i + 1)
+where i is int variable, n is int literal or variable
+collects scalar temporaries assigned in loop body
+*/
+bool xlang::x86_gen::is_vectorizable_loop(struct iter_stmt* itstmt)
+{
+  struct primary_expr* cond = nullptr;
+  struct primary_expr* step = nullptr;
+  struct expr* update = nullptr;
+  struct expr* right = nullptr;
+  struct assgn_expr* assgnexp = nullptr;
+  struct stmt* stm = nullptr;
+  std::unordered_set<std::string> assigned;
+  token_t type = KEY_INT, type2 = KEY_INT;
+
+  vector_temps.clear();
+  if(itstmt->_for.condition == nullptr || itstmt->_for.update_expression == nullptr
+      || itstmt->_for.statement == nullptr)
+    return false;
+
+  if(itstmt->_for.condition->expr_kind != PRIMARY_EXPR) return false;
+  cond = itstmt->_for.condition->primary_expression;
+  if(cond == nullptr || !cond->is_oprtr || (cond->tok.token != COMP_LESS
+      && cond->tok.token != COMP_LESS_EQ))
+    return false;
+  if(cond->left == nullptr || cond->right == nullptr || cond->right->is_oprtr
+      || cond->right->left != nullptr || cond->right->right != nullptr
+      || cond->right->unary_node != nullptr)
+    return false;
+  vector_index = cond->left->tok.lexeme;
+  vector_index_info = cond->left->id_info;
+  if(!is_vector_index(cond->left) || !get_vector_type(vector_index_info, false, &type)
+      || type != KEY_INT)
+    return false;
+  if(cond->right->is_id){
+    if(cond->right->tok.lexeme == vector_index
+        || !get_vector_type(cond->right->id_info, false, &type) || type != KEY_INT)
+      return false;
+  }else if(!is_literal(cond->right->tok) || cond->right->tok.token == LIT_CHAR
+      || get_decimal(cond->right->tok) < 4){
+    return false;
+  }
+
+  update = itstmt->_for.update_expression;
+  if(update->expr_kind == ID_EXPR){
+    if(update->id_expression->tok.token != INCR_OP
+        || update->id_expression->unary == nullptr
+        || update->id_expression->unary->is_subscript
+        || update->id_expression->unary->tok.lexeme != vector_index)
+      return false;
+  }else if(update->expr_kind == ASSGN_EXPR){
+    //i += 1 is parsed as i = i + 1
+    assgnexp = update->assgn_expression;
+    if(assgnexp->tok.token != ASSGN || assgnexp->id_expression == nullptr
+        || assgnexp->id_expression->is_subscript
+        || assgnexp->id_expression->tok.lexeme != vector_index
+        || assgnexp->expression == nullptr
+        || assgnexp->expression->expr_kind != PRIMARY_EXPR)
+      return false;
+    step = assgnexp->expression->primary_expression;
+    if(step == nullptr || !step->is_oprtr || step->tok.token != ARTHM_ADD)
+      return false;
+    if(is_vector_index(step->left))
+      step = step->right;
+    else if(is_vector_index(step->right))
+      step = step->left;
+    else
+      return false;
+    if(step == nullptr || step->is_oprtr || step->is_id || !is_literal(step->tok)
+        || get_decimal(step->tok) != 1)
+      return false;
+  }else{
+    return false;
+  }
+
+  for(stm = itstmt->_for.statement; stm != nullptr; stm = stm->p_next){
+    if(stm->type != EXPR_STMT || stm->expression_statement == nullptr
+        || stm->expression_statement->expression == nullptr
+        || stm->expression_statement->expression->expr_kind != ASSGN_EXPR)
+      return false;
+    assgnexp = stm->expression_statement->expression->assgn_expression;
+    if(assgnexp->tok.token != ASSGN || assgnexp->expression == nullptr)
+      return false;
+    if(is_vector_temp(assgnexp->id_expression, &type)){
+      vector_temps[assgnexp->id_expression->tok.lexeme] =
+            std::pair<struct st_symbol_info*, fregs_t>(assgnexp->id_expression->id_info, FRNONE);
+    }else if(!is_vector_subscript(assgnexp->id_expression, &type)){
+      return false;
+    }
+  }
+
+  //loop bound must not change in loop
+  if(cond->right->is_id && vector_temps.find(cond->right->tok.lexeme) != vector_temps.end())
+    return false;
+
+  for(stm = itstmt->_for.statement; stm != nullptr; stm = stm->p_next){
+    assgnexp = stm->expression_statement->expression->assgn_expression;
+    if(!is_vector_subscript(assgnexp->id_expression, &type))
+      is_vector_temp(assgnexp->id_expression, &type);
+    right = assgnexp->expression;
+    if(right->expr_kind == ID_EXPR){
+      if(!is_vector_subscript(right->id_expression, &type2) || type2 != type)
+        return false;
+    }else if(right->expr_kind == PRIMARY_EXPR){
+      if(!is_vectorizable_expr(right->primary_expression, type, assigned))
+        return false;
+      //scalar code computes float expression in single precision
+      //only when it has float variable
+      if(type == KEY_FLOAT && sse_expr_size(right->primary_expression) != 4)
+        return false;
+    }else{
+      return false;
+    }
+    if(!assgnexp->id_expression->is_subscript)
+      assigned.insert(assgnexp->id_expression->tok.lexeme);
+  }
+  return true;
+}
+
+//add packed SSE2 instruction with xmm register operands
+struct insn* xlang::x86_gen::gen_vector_insn(insn_t instype, fregs_t r1, fregs_t r2)
+{
+  struct insn* in = get_insn(instype, 2);
+  in->operand_1->type = FREGISTER;
+  in->operand_1->freg = r1;
+  in->operand_2->type = FREGISTER;
+  in->operand_2->freg = r2;
+  instructions.push_back(in);
+  return in;
+}
+
+//shift each lane of xmm register by literal count
+void xlang::x86_gen::gen_vector_shift(insn_t instype, fregs_t r, int count)
+{
+  struct insn* in = gen_vector_insn(instype, r, r);
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = std::to_string(count);
+}
+
+//copy lane 0 of xmm register to all 4 lanes
+void xlang::x86_gen::gen_vector_broadcast(fregs_t r)
+{
+  gen_vector_insn(PUNPCKLDQ, r, r);
+  gen_vector_insn(PUNPCKLQDQ, r, r);
+}
+
+//fill memory operand of 4 elements of array from loop index, [a + ecx * 4]
+void xlang::x86_gen::gen_vector_subscript_operand(struct id_expr* idexpr, struct operand* opr)
+{
+  opr->type = MEMORY;
+  opr->is_array = true;
+  opr->arr_disp = 4;
+  opr->reg = ECX;
+  opr->mem.mem_type = GLOBAL;
+  opr->mem.mem_size = 16;
+  opr->mem.name = idexpr->id_info->symbol;
+}
+
+/*
+load leaf of primary expression into all 4 lanes of xmm register,
+loop index i is loaded as {i, i+1, i+2, i+3},
+int values are converted to float in float type expression.
+register of temporary is returned without copying
+*/
+fregs_t xlang::x86_gen::gen_vector_leaf(struct primary_expr* pexpr, token_t type)
+{
+  struct insn* in = nullptr;
+  struct data* dt = nullptr;
+  token_t idtype = KEY_INT;
+  fregs_t r, r2;
+
+  if(pexpr->is_id){
+    auto it = vector_temps.find(pexpr->tok.lexeme);
+    if(it != vector_temps.end()){
+      r = it->second.second;
+      get_vector_type(it->second.first, false, &idtype);
+      if(idtype == type) return r;
+      r2 = reg->allocate_xmm_register();
+      if(r2 == FRNONE) return FRNONE;
+      gen_vector_insn(CVTDQ2PS, r2, r);
+      return r2;
+    }
+  }
 
-void xlang::x86_gen::gen_selection_statement(struct select_stmt** slstmt)
-{
-  struct select_stmt* selstmt = *slstmt;
-  token_t cond;
-  struct insn* in = nullptr;
+  r = reg->allocate_xmm_register();
+  if(r == FRNONE) return FRNONE;
 
-  if(selstmt == nullptr) return;
+  if(is_vector_index(pexpr)){
+    in = gen_vector_insn(MOVD, r, r);
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = ECX;
+    in->comment = "  ; "+pexpr->tok.lexeme;
+    gen_vector_broadcast(r);
+    r2 = reg->allocate_xmm_register();
+    if(r2 == FRNONE) return FRNONE;
+    if(vector_iota == nullptr){
+      vector_iota = insncls->get_data_mem();
+      vector_iota->symbol = "vector_iota";
+      vector_iota->type = DD;
+      vector_iota->is_array = true;
+      vector_iota->array_data = {"0", "1", "2", "3"};
+      data_section.push_back(vector_iota);
+    }
+    in = gen_vector_insn(MOVDQU, r2, r2);
+    in->operand_2->type = MEMORY;
+    in->operand_2->mem.mem_type = GLOBAL;
+    in->operand_2->mem.mem_size = 16;
+    in->operand_2->mem.name = vector_iota->symbol;
+    gen_vector_insn(PADDD, r, r2);
+    reg->free_float_register(r2);
+  }else if(pexpr->is_id){
+    //loop invariant variable
+    in = gen_vector_insn(MOVD, r, r);
+    get_id_mem_operand(pexpr, in->operand_2, 4);
+    in->comment = "  ; "+pexpr->tok.lexeme;
+    gen_vector_broadcast(r);
+    get_vector_type(pexpr->id_info, false, &idtype);
+  }else if(type == KEY_FLOAT){
+    if(pexpr->tok.token == LIT_FLOAT)
+      dt = create_float_data(DD, pexpr->tok.lexeme);
+    else
+      dt = create_float_data(DD, std::to_string(get_decimal(pexpr->tok))+".0");
+    in = gen_vector_insn(MOVD, r, r);
+    in->operand_2->type = MEMORY;
+    in->operand_2->mem.mem_type = GLOBAL;
+    in->operand_2->mem.mem_size = 4;
+    in->operand_2->mem.name = dt->symbol;
+    in->comment = "  ; "+pexpr->tok.lexeme;
+    gen_vector_broadcast(r);
+    idtype = KEY_FLOAT;
+  }else{
+    in = get_insn(MOV, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EAX;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = std::to_string(get_decimal(pexpr->tok));
+    instructions.push_back(in);
+    in = gen_vector_insn(MOVD, r, r);
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = EAX;
+    gen_vector_broadcast(r);
+  }
 
-  cond = gen_select_stmt_condition(selstmt->condition);
+  if(idtype != type)
+    gen_vector_insn(CVTDQ2PS, r, r);
+  return r;
+}
 
-  in = get_insn(JMP, 1);
-  in->operand_1->type = LITERAL;
-  in->operand_1->literal = ".if_label"+std::to_string(if_label_count);
-  insncls->delete_operand(&(in->operand_2));
+/*
+generate packed SSE2 instructions of primary expression,
+returns xmm register containing result, which could be register
+of temporary if expression is only that temporary.
+FRNONE is returned when xmm registers are not enough
+*/
+fregs_t xlang::x86_gen::gen_vector_expression(struct primary_expr* pexpr, token_t type)
+{
+  insn_t op = INSNONE;
+  bool fl = (type == KEY_FLOAT);
+  fregs_t r1, r2, r3;
+
+  if(!pexpr->is_oprtr)
+    return gen_vector_leaf(pexpr, type);
+
+  r1 = gen_vector_expression(pexpr->left, type);
+  if(r1 == FRNONE) return FRNONE;
+  //result is computed in first operand, so temporary is copied
+  if(is_vector_temp_reg(r1)){
+    r3 = reg->allocate_xmm_register();
+    if(r3 == FRNONE) return FRNONE;
+    gen_vector_insn(fl ? MOVAPS : MOVDQA, r3, r1);
+    r1 = r3;
+  }
 
-  switch(cond){
-    case COMP_EQ :
-      in->insn_type = JE;
+  switch(pexpr->tok.token){
+    case BIT_LSHIFT :
+      gen_vector_shift(PSLLD, r1, get_decimal(pexpr->right->tok));
+      return r1;
+    case BIT_RSHIFT :
+      gen_vector_shift(PSRLD, r1, get_decimal(pexpr->right->tok));
+      return r1;
+    case ARTHM_ADD :
+      op = (fl ? ADDPS : PADDD);
       break;
-    case COMP_GREAT :
-      in->insn_type = JG;
+    case ARTHM_SUB :
+      op = (fl ? SUBPS : PSUBD);
       break;
-    case COMP_GREAT_EQ :
-      in->insn_type = JGE;
+    case ARTHM_MUL :
+      op = (fl ? MULPS : PMULUDQ);
       break;
-    case COMP_LESS :
-      in->insn_type = JL;
+    case ARTHM_DIV :
+      op = DIVPS;
       break;
-    case COMP_LESS_EQ :
-      in->insn_type = JLE;
+    case BIT_AND :
+      op = PAND;
       break;
-    case COMP_NOT_EQ :
-      in->insn_type = JNE;
+    case BIT_OR :
+      op = POR;
       break;
-    default: break;
+    case BIT_EXOR :
+      op = PXOR;
+      break;
+    default :
+      return FRNONE;
+  }
+
+  r2 = gen_vector_expression(pexpr->right, type);
+  if(r2 == FRNONE) return FRNONE;
+
+  if(op == PMULUDQ){
+    /*
+      SSE2 has no packed 32 bit multiply, pmuludq multiplies lanes 0, 2
+      into 64 bit products, so lanes 1, 3 are shifted down and multiplied
+      separately, and low 32 bits of all products are combined
+    */
+    if(is_vector_temp_reg(r2)){
+      r3 = reg->allocate_xmm_register();
+      if(r3 == FRNONE) return FRNONE;
+      gen_vector_insn(MOVDQA, r3, r2);
+      r2 = r3;
+    }
+    r3 = reg->allocate_xmm_register();
+    if(r3 == FRNONE) return FRNONE;
+    gen_vector_insn(MOVDQA, r3, r1);
+    gen_vector_insn(PMULUDQ, r1, r2);
+    gen_vector_shift(PSRLQ, r3, 32);
+    gen_vector_shift(PSRLQ, r2, 32);
+    gen_vector_insn(PMULUDQ, r3, r2);
+    gen_vector_shift(PSLLQ, r1, 32);
+    gen_vector_shift(PSRLQ, r1, 32);
+    gen_vector_shift(PSLLQ, r3, 32);
+    gen_vector_insn(POR, r1, r3);
+    reg->free_float_register(r3);
+  }else{
+    gen_vector_insn(op, r1, r2);
+  }
+
+  if(!is_vector_temp_reg(r2))
+    reg->free_float_register(r2);
+  return r1;
+}
+
+//generate a[i] = expression or t = expression of vectorized loop body
+bool xlang::x86_gen::gen_vector_statement(struct expr* exp)
+{
+  struct assgn_expr* assgnexp = exp->assgn_expression;
+  struct id_expr* left = assgnexp->id_expression;
+  struct id_expr* right = nullptr;
+  struct insn* in = nullptr;
+  token_t type = KEY_INT;
+  bool is_temp = false;
+  fregs_t r, r2;
+
+  is_temp = is_vector_temp(left, &type);
+  if(!is_temp)
+    is_vector_subscript(left, &type);
+
+  insert_comment("; line "+std::to_string(left->tok.loc.line));
+
+  if(assgnexp->expression->expr_kind == ID_EXPR){
+    right = assgnexp->expression->id_expression;
+    r = reg->allocate_xmm_register();
+    if(r == FRNONE) return false;
+    in = gen_vector_insn(type == KEY_FLOAT ? MOVUPS : MOVDQU, r, r);
+    gen_vector_subscript_operand(right, in->operand_2);
+    in->comment = "  ; "+right->tok.lexeme+"["+vector_index+"]";
+  }else{
+    r = gen_vector_expression(assgnexp->expression->primary_expression, type);
+    if(r == FRNONE) return false;
+  }
+
+  if(is_temp){
+    auto it = vector_temps.find(left->tok.lexeme);
+    if(r == it->second.second) return true;
+    if(is_vector_temp_reg(r)){
+      r2 = reg->allocate_xmm_register();
+      if(r2 == FRNONE) return false;
+      gen_vector_insn(type == KEY_FLOAT ? MOVAPS : MOVDQA, r2, r);
+      r = r2;
+    }
+    if(it->second.second != FRNONE)
+      reg->free_float_register(it->second.second);
+    it->second.second = r;
+    return true;
+  }
+
+  in = gen_vector_insn(type == KEY_FLOAT ? MOVUPS : MOVDQU, r, r);
+  gen_vector_subscript_operand(left, in->operand_1);
+  in->comment = "  ; "+left->tok.lexeme+"["+vector_index+"]";
+  if(!is_vector_temp_reg(r))
+    reg->free_float_register(r);
+  return true;
+}
+
+/*
+generate packed loop of for loop, computing 4 iterations at a time
+    mov ecx, [i]
+    mov edx, n
+    sub edx, 3
+    cmp ecx, edx
+    jge .exit_vector_loop
+  .vector_loop:
+    ...
+    add ecx, 4
+    cmp ecx, edx
+    jl .vector_loop
+    mov [i], ecx
+  .exit_vector_loop:
+original for loop follows it and computes remaining iterations
+with current value of i, its init expression is already generated.
+last lane of each temporary is stored back to it.
+returns false and generates nothing if loop can not be vectorized
+*/
+bool xlang::x86_gen::gen_vector_loop(struct iter_stmt* itstmt)
+{
+  struct primary_expr* bound = nullptr;
+  struct insn* in = nullptr;
+  struct stmt* stm = nullptr;
+  size_t start = instructions.size();
+  std::string count = std::to_string(vector_loop_count);
+  bool less_eq = false;
+
+  if(!is_vectorizable_loop(itstmt)){
+    xlang::stats::missed("vectorize", itstmt->_for.fortok.loc,
+                         "loop is not a vectorizable int/float array loop");
+    return false;
   }
+  bound = itstmt->_for.condition->primary_expression->right;
+  less_eq = (itstmt->_for.condition->primary_expression->tok.token == COMP_LESS_EQ);
+
+  insert_comment("; vectorized for loop, line "+std::to_string(itstmt->_for.fortok.loc.line));
+
+  in = get_insn(MOV, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = ECX;
+  get_id_mem_operand(vector_index_info, in->operand_2, 4);
+  in->comment = "  ; "+vector_index;
   instructions.push_back(in);
 
-  //jump after if statement for else
-  in = get_insn(JMP, 1);
+  //ecx + 3 < n is compared as ecx < n - 3
+  in = get_insn(MOV, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = EDX;
+  if(bound->is_id){
+    get_id_mem_operand(bound, in->operand_2, 4);
+    in->comment = "  ; "+bound->tok.lexeme;
+    instructions.push_back(in);
+
+    //n - 3 overflows when n is near minimum int, loop is not executed
+    in = get_insn(CMP, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EDX;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = "-2147483645";
+    instructions.push_back(in);
+    in = get_insn(JL, 1);
+    in->operand_1->type = LITERAL;
+    in->operand_1->literal = ".exit_vector_loop"+count;
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+
+    in = get_insn(SUB, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EDX;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = "3";
+  }else{
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = std::to_string(get_decimal(bound->tok) - 3);
+  }
+  instructions.push_back(in);
+
+  in = get_insn(CMP, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = ECX;
+  in->operand_2->type = REGISTER;
+  in->operand_2->reg = EDX;
+  instructions.push_back(in);
+  in = get_insn(less_eq ? JG : JGE, 1);
   in->operand_1->type = LITERAL;
-  in->operand_1->literal = ".else_label"+std::to_string(if_label_count);
+  in->operand_1->literal = ".exit_vector_loop"+count;
   insncls->delete_operand(&(in->operand_2));
   instructions.push_back(in);
 
-  //create if label
   in = get_insn(INSLABEL, 0);
-  in->label = ".if_label"+std::to_string(if_label_count);
+  in->label = ".vector_loop"+count;
   insncls->delete_operand(&(in->operand_1));
   insncls->delete_operand(&(in->operand_2));
   instructions.push_back(in);
 
-  //gen if statement
-  if(selstmt->if_statement != nullptr){
-    if_label_count++;
-    gen_statement(&(selstmt->if_statement));
-
-    in = get_insn(JMP, 1);
-    in->operand_1->type = LITERAL;
-    in->operand_1->literal = ".exit_if"+std::to_string(exit_if_count);
-    insncls->delete_operand(&(in->operand_2));
-    instructions.push_back(in);
+  for(stm = itstmt->_for.statement; stm != nullptr; stm = stm->p_next){
+    if(!gen_vector_statement(stm->expression_statement->expression)){
+      //not enough xmm registers, remove generated instructions
+      while(instructions.size() > start){
+        in = instructions.back();
+        insncls->delete_insn(&in);
+        instructions.pop_back();
+      }
+      reg->free_all_float_registers();
+      vector_temps.clear();
+      return false;
+    }
   }
 
-  //create else label
-  in = get_insn(INSLABEL, 0);
-  in->label = ".else_label"+std::to_string(else_label_count);
-  insncls->delete_operand(&(in->operand_1));
+  in = get_insn(ADD, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = ECX;
+  in->operand_2->type = LITERAL;
+  in->operand_2->literal = "4";
+  instructions.push_back(in);
+
+  in = get_insn(CMP, 2);
+  in->operand_1->type = REGISTER;
+  in->operand_1->reg = ECX;
+  in->operand_2->type = REGISTER;
+  in->operand_2->reg = EDX;
+  instructions.push_back(in);
+  in = get_insn(less_eq ? JLE : JL, 1);
+  in->operand_1->type = LITERAL;
+  in->operand_1->literal = ".vector_loop"+count;
+  in->comment = "    ; jmp to vector loop";
   insncls->delete_operand(&(in->operand_2));
   instructions.push_back(in);
-  else_label_count++;
 
-  //generate else statement
-  if(selstmt->else_statement != nullptr){
-    gen_statement(&(selstmt->else_statement));
+  in = get_insn(MOV, 2);
+  get_id_mem_operand(vector_index_info, in->operand_1, 4);
+  in->operand_2->type = REGISTER;
+  in->operand_2->reg = ECX;
+  in->comment = "  ; "+vector_index;
+  instructions.push_back(in);
+
+  //store lane 3 of temporaries, value of last computed iteration
+  for(auto& x : vector_temps){
+    if(x.second.second == FRNONE) continue;
+    gen_vector_insn(PUNPCKHQDQ, x.second.second, x.second.second);
+    gen_vector_shift(PSRLQ, x.second.second, 32);
+    in = gen_vector_insn(MOVD, x.second.second, x.second.second);
+    get_id_mem_operand(x.second.first, in->operand_1, 4);
+    in->comment = "  ; "+x.first;
+    reg->free_float_register(x.second.second);
   }
+  vector_temps.clear();
 
   in = get_insn(INSLABEL, 0);
-  in->label = ".exit_if"+std::to_string(exit_if_count);
+  in->label = ".exit_vector_loop"+count;
   insncls->delete_operand(&(in->operand_1));
   insncls->delete_operand(&(in->operand_2));
   instructions.push_back(in);
 
-  exit_if_count++;
-
+  vector_loop_count++;
+  xlang::stats::count("vectorize.vectorized-loops");
+  xlang::stats::remark("vectorize", itstmt->_for.fortok.loc,
+                       "loop vectorized computing 4 iterations at a time");
+  return true;
 }
 
 void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
@@ -2835,6 +5381,10 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
       //gen for loop init expression
       gen_expression(&(itstmt->_for.init_expression));
 
+      //packed SSE2 loop, remaining iterations are computed by for loop
+      if(optimize && vectorize_loops && use_sse2)
+        gen_vector_loop(itstmt);
+
       in->label = ".for_loop"+std::to_string(for_loop_count);
       for_loop_stack.push(for_loop_count);
       for_loop_count++;
@@ -2846,7 +5396,14 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
   switch(itstmt->type){
     case WHILE_STMT :
       //gen while loop condition
-      cond = gen_select_stmt_condition(itstmt->_while.condition);
+      if(is_compound_condition(itstmt->_while.condition)){
+        cond = NONE;
+        gen_compound_condition(itstmt->_while.condition,
+                ".exit_while_loop"+std::to_string(while_loop_stack.empty() ?
+                  exit_loop_label_count : while_loop_stack.top()), false);
+      }else{
+        cond = gen_select_stmt_condition(itstmt->_while.condition);
+      }
       in = get_insn(JMP, 1);
       in->operand_1->type = LITERAL;
       if(!while_loop_stack.empty()){
@@ -2881,7 +5438,12 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
           instructions.pop_back();
           break;
       }
+      //float comparison sets flags as unsigned comparison
+      if(in != nullptr && float_condition)
+        in->insn_type = get_float_cond_jump(in->insn_type);
 
+      if(profile_generate)
+        gen_profile_counter(itstmt->_while.whiletok.loc.line, "body");
       //gen while loop statement
       gen_statement(&(itstmt->_while.statement));
 
@@ -2910,10 +5472,21 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
       break;
 
     case DOWHILE_STMT :
+      if(profile_generate)
+        gen_profile_counter(itstmt->_dowhile.dotok.loc.line, "body");
       //gen do while loop statement
       gen_statement(&(itstmt->_dowhile.statement));
 
       //gen do while loop condition
+      if(is_compound_condition(itstmt->_dowhile.condition)){
+        gen_compound_condition(itstmt->_dowhile.condition,
+                ".dowhile_loop"+std::to_string(dowhile_loop_stack.empty() ?
+                  exit_loop_label_count : dowhile_loop_stack.top()), true);
+        if(!dowhile_loop_stack.empty())
+          dowhile_loop_stack.pop();
+        dowhile_loop_count++;
+        break;
+      }
       cond = gen_select_stmt_condition(itstmt->_dowhile.condition);
 
       in = get_insn(JMP, 1);
@@ -2947,6 +5520,9 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
           break;
         default: break;
       }
+      //float comparison sets flags as unsigned comparison
+      if(in != nullptr && float_condition)
+        in->insn_type = get_float_cond_jump(in->insn_type);
       instructions.push_back(in);
 
       dowhile_loop_count++;
@@ -2954,7 +5530,14 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
 
     case FOR_STMT :
       //gen for loop condition, for loop is considered as while loop
-      cond = gen_select_stmt_condition(itstmt->_for.condition);
+      if(is_compound_condition(itstmt->_for.condition)){
+        cond = NONE;
+        gen_compound_condition(itstmt->_for.condition,
+                ".exit_for_loop"+std::to_string(for_loop_stack.empty() ?
+                  exit_loop_label_count : for_loop_stack.top()), false);
+      }else{
+        cond = gen_select_stmt_condition(itstmt->_for.condition);
+      }
       in = get_insn(JMP, 1);
       in->operand_1->type = LITERAL;
       if(!for_loop_stack.empty()){
@@ -2989,7 +5572,12 @@ void xlang::x86_gen::gen_iteration_statement(struct iter_stmt** istmt)
           instructions.pop_back();
           break;
       }
+      //float comparison sets flags as unsigned comparison
+      if(in != nullptr && float_condition)
+        in->insn_type = get_float_cond_jump(in->insn_type);
 
+      if(profile_generate)
+        gen_profile_counter(itstmt->_for.fortok.loc.line, "body");
       //gen for loop statement
       gen_statement(&(itstmt->_for.statement));
 
@@ -3053,89 +5641,421 @@ void xlang::x86_gen::gen_statement(struct stmt** _stmt)
         break;
       default: break;
     }
-    _stmt2 = _stmt2->p_next;
+    _stmt2 = _stmt2->p_next;
+  }
+}
+
+/*
+save frame pointer and create new stack for new function
+push ebp
+mov ebp, esp
+*/
+
+extern bool omit_frame_pointer;
+extern bool instrument_time;
+
+void xlang::x86_gen::save_frame_pointer()
+{
+  prologue_index = instructions.size();
+  if(!omit_frame_pointer){
+    insn* in = get_insn(PUSH, 1);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EBP;
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+    in = nullptr;
+
+    in = get_insn(MOV, 2);
+    in->insn_type = MOV;
+    in->operand_count = 2;
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EBP;
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = ESP;
+    instructions.push_back(in);
+  }
+}
+
+/*
+local label for exiting function,for return
+._exit_<function-name>
+
+restore stack frame pointer
+mov esp, ebp
+pop ebp
+
+here leave instruction can also be used
+*/
+void xlang::x86_gen::restore_frame_pointer()
+{
+  insn* in = get_insn(INSLABEL, 0);
+  in->label = "._exit_"+func_symtab->func_info->func_name;
+  insncls->delete_operand(&(in->operand_1));
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+
+  if(instrument_time)
+    gen_time_profile_exit();
+  release_frame_pointer();
+}
+
+void xlang::x86_gen::release_frame_pointer()
+{
+  insn* in = nullptr;
+
+  if(!omit_frame_pointer){
+    in = get_insn(MOV, 2);
+    in->insn_type = MOV;
+    in->operand_count = 2;
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = ESP;
+    in->operand_2->type = REGISTER;
+    in->operand_2->reg = EBP;
+    instructions.push_back(in);
+    in = nullptr;
+
+    in = get_insn(POP, 1);
+    in->insn_type = POP;
+    in->operand_count = 1;
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = EBP;
+    insncls->delete_operand(&(in->operand_2));
+    instructions.push_back(in);
+  }
+}
+
+//ret of function
+void xlang::x86_gen::func_return()
+{
+  insn* in = nullptr;
+  in = insncls->get_insn_mem();
+  in->insn_type = RET;
+  in->operand_count = 0;
+  insncls->delete_operand(&(in->operand_1));
+  insncls->delete_operand(&(in->operand_2));
+  instructions.push_back(in);
+}
+
+//location comment of function local member, [ebp - n] or [esp + n]
+std::string xlang::x86_gen::get_member_comment(std::string name,
+                            struct func_member& fmem, mem_t mtype, int disp)
+{
+  std::string loc;
+  if(mtype == STACK){
+    loc = reg->reg_name(stack_reg);
+    if(disp > 0)
+      loc += " + "+std::to_string(disp);
+  }else if(disp < 0){
+    loc = reg->reg_name(frame_reg)+" - "+std::to_string(disp*(-1));
+  }else{
+    loc = reg->reg_name(frame_reg)+" + "+std::to_string(disp);
+  }
+  return "    ; "+name+" = ["+loc+"]"
+          +", "+insncls->insnsize_name(get_insn_size_type(fmem.insize));
+}
+
+/*
+reserve outgoing argument area of largest call of current function
+together with local variables
+sub esp, <locals size + outgoing size>
+*/
+void xlang::x86_gen::reserve_outgoing_args()
+{
+  struct insn* in = nullptr;
+  int size = 0;
+
+  if(outgoing_size <= 0) return;
+
+  if(local_alloc != nullptr){
+    size = std::stoi(local_alloc->operand_2->literal) + outgoing_size;
+    local_alloc->operand_2->literal = std::to_string(size);
+    local_alloc->comment = "    ; allocate space for local variables, call arguments";
+  }else{
+    in = get_insn(SUB, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = ESP;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = std::to_string(outgoing_size);
+    in->comment = "    ; allocate space for call arguments";
+    instructions.insert(instructions.begin() + prologue_index
+                        + (omit_frame_pointer ? 0 : 2), in);
+    cold_index++;
+  }
+  xlang::stats::count("frame.outgoing-areas");
+}
+
+/*
+returns true if function body instructions in [start, end) can address
+locals relative to stack pointer, i.e. there is no call or inline assembly,
+stack pointer is changed only by balanced push/pop of registers or
+sub/add of literal, and nothing is left on stack at any label/jump
+*/
+bool xlang::x86_gen::is_frameless_leaf(size_t start, size_t end)
+{
+  int slot = target_x86_64 ? 8 : 4;
+  int depth = 0;
+  struct insn* in = nullptr;
+
+  auto is_frame_reg = [=](regs_t r){
+      return (r == ESP || r == EBP || r == RSP || r == RBP);};
+
+  for(size_t i = start; i < end; i++){
+    in = instructions[i];
+    if(in == local_alloc) continue;
+    switch(in->insn_type){
+      case CALL :
+      case INSASM :
+        return false;
+      case INSLABEL :
+        if(depth != 0) return false;
+        continue;
+      case INSNONE :
+        continue;
+      case PUSH :
+      case POP :
+        if(in->operand_1->type != REGISTER || is_frame_reg(in->operand_1->reg))
+          return false;
+        depth += (in->insn_type == PUSH ? slot : -slot);
+        if(depth < 0) return false;
+        continue;
+      default : break;
+    }
+    if((insncls->is_jump(in->insn_type) || in->insn_type == LOOP) && depth != 0)
+      return false;
+    if((in->insn_type == SUB || in->insn_type == ADD) && in->operand_count == 2
+        && in->operand_1->type == REGISTER && in->operand_1->reg == ESP
+        && in->operand_2->type == LITERAL){
+      depth += (in->insn_type == SUB ? 1 : -1) * std::stoi(in->operand_2->literal);
+      if(depth < 0) return false;
+      continue;
+    }
+    for(struct operand* opr : {in->operand_1, in->operand_2}){
+      if(opr == nullptr || in->operand_count < (opr == in->operand_1 ? 1 : 2))
+        continue;
+      if(opr->type == REGISTER && is_frame_reg(opr->reg)) return false;
+      if(opr->type == MEMORY){
+        if(opr->reg != RNONE && is_frame_reg(opr->reg)) return false;
+        if(opr->mem.name == "esp" || opr->mem.name == "ebp") return false;
+      }
+    }
+  }
+  return (depth == 0);
+}
+
+/*
+generate leaf function without frame pointer,
+locals and parameters are addressed relative to stack pointer
+with tracked depth of values pushed on stack
+
+push ebp                     => removed
+mov ebp, esp                 => removed
+sub esp, n                      sub esp, n
+mov eax, [ebp - 4]           => mov eax, [esp + n - 4 + depth]
+mov eax, [ebp + 8]           => mov eax, [esp + n + 4 + depth]
+mov esp, ebp                 => add esp, n
+pop ebp                      => removed
+ret                             ret
+*/
+void xlang::x86_gen::omit_leaf_frame()
+{
+  int slot = target_x86_64 ? 8 : 4;
+  int depth = 0, size = 0;
+  size_t start, end, index;
+  struct insn* in = nullptr;
+  funcmem_iterator fmemit;
+  memb_iterator memit;
+
+  if(omit_frame_pointer) return;
+  start = prologue_index;
+  //cold code after ret is entered with nothing pushed on stack
+  end = cold_index;
+  if(end < start + 5) return;
+  //push ebp, mov ebp, esp ... mov esp, ebp, pop ebp, ret
+  if(instructions[start]->insn_type != PUSH
+      || instructions[start + 1]->insn_type != MOV) return;
+  if(instructions[end - 3]->insn_type != MOV
+      || instructions[end - 2]->insn_type != POP
+      || instructions[end - 1]->insn_type != RET) return;
+  if(!is_frameless_leaf(start + 2, end - 3)) return;
+  if(!is_frameless_leaf(end, instructions.size())) return;
+
+  if(local_alloc != nullptr)
+    size = std::stoi(local_alloc->operand_2->literal);
+
+  for(index = start + 2; index < instructions.size(); index++){
+    if(index == end - 3){
+      index = end;
+      depth = 0;
+      if(index >= instructions.size()) break;
+    }
+    in = instructions[index];
+    if(in == local_alloc) continue;
+    for(struct operand* opr : {in->operand_1, in->operand_2}){
+      if(opr == nullptr || in->operand_count < (opr == in->operand_1 ? 1 : 2))
+        continue;
+      if(opr->type != MEMORY) continue;
+      if(opr->mem.mem_type != LOCAL) continue;
+      opr->mem.mem_type = STACK;
+      //parameters are above return address instead of saved frame pointer
+      opr->mem.fp_disp += size + depth - (opr->mem.fp_disp > 0 ? slot : 0);
+    }
+    if(in->insn_type == PUSH || in->insn_type == POP){
+      depth += (in->insn_type == PUSH ? slot : -slot);
+    }else if((in->insn_type == SUB || in->insn_type == ADD)
+        && in->operand_1 != nullptr && in->operand_1->type == REGISTER
+        && in->operand_1->reg == ESP){
+      depth += (in->insn_type == SUB ? 1 : -1) * std::stoi(in->operand_2->literal);
+    }
   }
-}
-
-/*
-save frame pointer and create new stack for new function
-push ebp
-mov ebp, esp
-*/
 
-extern bool omit_frame_pointer;
+  //rewrite local variables location comments
+  fmemit = func_members.find(func_symtab->func_info->func_name);
+  if(fmemit != func_members.end()){
+    index = member_comment_index;
+    for(memit = fmemit->second.members.begin();
+        memit != fmemit->second.members.end(); memit++){
+      if(index >= end || instructions[index]->insn_type != INSNONE) break;
+      instructions[index]->comment = get_member_comment(memit->first, memit->second,
+                STACK, memit->second.fp_disp + size
+                        - (memit->second.fp_disp > 0 ? slot : 0));
+      index++;
+    }
+  }
 
-void xlang::x86_gen::save_frame_pointer()
-{
-  if(!omit_frame_pointer){
-    insn* in = get_insn(PUSH, 1);
-    in->operand_1->type = REGISTER;
-    in->operand_1->reg = EBP;
+  //epilogue, mov esp, ebp; pop ebp => add esp, n
+  in = instructions[end - 2];
+  insncls->delete_operand(&(in->operand_1));
+  insncls->delete_insn(&in);
+  instructions.erase(instructions.begin() + (end - 2));
+  in = instructions[end - 3];
+  if(size > 0){
+    in->insn_type = ADD;
+    in->operand_2->type = LITERAL;
+    in->operand_2->literal = std::to_string(size);
+    in->comment = "    ; release local variables";
+  }else{
+    insncls->delete_operand(&(in->operand_1));
     insncls->delete_operand(&(in->operand_2));
-    instructions.push_back(in);
-    in = nullptr;
+    insncls->delete_insn(&in);
+    instructions.erase(instructions.begin() + (end - 3));
+  }
 
-    in = get_insn(MOV, 2);
-    in->insn_type = MOV;
-    in->operand_count = 2;
-    in->operand_1->type = REGISTER;
-    in->operand_1->reg = EBP;
-    in->operand_2->type = REGISTER;
-    in->operand_2->reg = ESP;
-    instructions.push_back(in);
+  //prologue, push ebp; mov ebp, esp
+  for(index = start; index < start + 2; index++){
+    in = instructions[index];
+    if(in->operand_1 != nullptr)
+      insncls->delete_operand(&(in->operand_1));
+    if(in->operand_2 != nullptr)
+      insncls->delete_operand(&(in->operand_2));
+    insncls->delete_insn(&in);
   }
+  instructions.erase(instructions.begin() + start, instructions.begin() + start + 2);
+  xlang::stats::count("frame.omitted-frames");
 }
 
 /*
-local label for exiting function,for return
-._exit_<function-name>
-
-restore stack frame pointer
-mov esp, ebp
-pop ebp
-
-here leave instruction can also be used
+rbx is callee-saved on x86_64 but is used as scratch register,
+save it in slot below locals of function that uses it
+and restore it before each release of frame
+
+sub rsp, n                   => sub rsp, n + 16
+                                mov qword[rbp - n - 8], rbx
+...
+                                mov rbx, qword[rbp - n - 8]
+mov rsp, rbp                    mov rsp, rbp
+pop rbp                         pop rbp
+
+without frame pointer, rbx is pushed on entry and popped before ret
 */
-void xlang::x86_gen::restore_frame_pointer()
+void xlang::x86_gen::save_callee_saved()
 {
-  insn* in = get_insn(INSLABEL, 0);
-  in->label = "._exit_"+func_symtab->func_info->func_name;
-  insncls->delete_operand(&(in->operand_1));
-  insncls->delete_operand(&(in->operand_2));
-  instructions.push_back(in);
-  in = nullptr;
+  int size = 0;
+  size_t index, alloc;
+  bool used = false;
+  struct insn* in = nullptr;
 
-  if(!omit_frame_pointer){
-    in = get_insn(MOV, 2);
-    in->insn_type = MOV;
-    in->operand_count = 2;
-    in->operand_1->type = REGISTER;
-    in->operand_1->reg = ESP;
-    in->operand_2->type = REGISTER;
-    in->operand_2->reg = EBP;
-    instructions.push_back(in);
-    in = nullptr;
+  auto is_rbx = [](regs_t r){
+      return (r == BL || r == BH || r == BX || r == EBX || r == RBX);};
+
+  auto set_slot = [&](struct operand* opr){
+      opr->type = MEMORY;
+      opr->mem.mem_type = LOCAL;
+      opr->mem.mem_size = 8;
+      opr->mem.fp_disp = -(size + 8);};
+
+  //insert before index, keeping indexes of function frame after it
+  auto insert_insn = [&](size_t index, struct insn* in){
+      instructions.insert(instructions.begin() + index, in);
+      if(index < cold_index) cold_index++;
+      if(index <= member_comment_index) member_comment_index++;};
+
+  for(index = prologue_index; index < instructions.size() && !used; index++){
+    in = instructions[index];
+    if(in->insn_type == INSLABEL || in->insn_type == INSASM) continue;
+    for(struct operand* opr : {in->operand_1, in->operand_2}){
+      if(opr == nullptr) continue;
+      if(opr->type == REGISTER && is_rbx(opr->reg)) used = true;
+      if(opr->type == MEMORY && (is_rbx(opr->reg) || opr->mem.name == "ebx"))
+        used = true;
+    }
+  }
+  if(!used) return;
 
-    in = get_insn(POP, 1);
-    in->insn_type = POP;
-    in->operand_count = 1;
+  if(omit_frame_pointer){
+    in = get_insn(PUSH, 1);
     in->operand_1->type = REGISTER;
-    in->operand_1->reg = EBP;
+    in->operand_1->reg = RBX;
     insncls->delete_operand(&(in->operand_2));
-    instructions.push_back(in);
+    insert_insn(prologue_index, in);
+    for(index = instructions.size(); index > prologue_index + 1; index--){
+      if(instructions[index - 1]->insn_type != RET) continue;
+      in = get_insn(POP, 1);
+      in->operand_1->type = REGISTER;
+      in->operand_1->reg = RBX;
+      insncls->delete_operand(&(in->operand_2));
+      insert_insn(index - 1, in);
+    }
+    xlang::stats::count("frame.saved-rbx");
+    return;
   }
-}
 
-//ret of function
-void xlang::x86_gen::func_return()
-{
-  insn* in = nullptr;
-  in = insncls->get_insn_mem();
-  in->insn_type = RET;
-  in->operand_count = 0;
-  insncls->delete_operand(&(in->operand_1));
-  insncls->delete_operand(&(in->operand_2));
-  instructions.push_back(in);
+  //slot of 16 bytes keeps alignment of stack at calls
+  if(local_alloc != nullptr){
+    size = std::stoi(local_alloc->operand_2->literal);
+    local_alloc->operand_2->literal = std::to_string(size + 16);
+  }else{
+    local_alloc = get_insn(SUB, 2);
+    local_alloc->operand_1->type = REGISTER;
+    local_alloc->operand_1->reg = ESP;
+    local_alloc->operand_2->type = LITERAL;
+    local_alloc->operand_2->literal = "16";
+    local_alloc->comment = "    ; allocate space for saved registers";
+    insert_insn(prologue_index + 2, local_alloc);
+  }
+  alloc = prologue_index + 2;
+  while(instructions[alloc] != local_alloc) alloc++;
+
+  in = get_insn(MOV, 2);
+  set_slot(in->operand_1);
+  in->operand_2->type = REGISTER;
+  in->operand_2->reg = RBX;
+  in->comment = "    ; save rbx";
+  insert_insn(alloc + 1, in);
+
+  //epilogue of function and of each tail call, mov esp, ebp
+  for(index = instructions.size(); index > alloc + 2; index--){
+    in = instructions[index - 1];
+    if(in->insn_type != MOV || in->operand_1->type != REGISTER
+        || in->operand_1->reg != ESP || in->operand_2->type != REGISTER
+        || in->operand_2->reg != EBP) continue;
+    in = get_insn(MOV, 2);
+    in->operand_1->type = REGISTER;
+    in->operand_1->reg = RBX;
+    set_slot(in->operand_2);
+    in->comment = "    ; restore rbx";
+    insert_insn(index - 1, in);
+  }
+  xlang::stats::count("frame.saved-rbx");
 }
 
 //generate x86 assembly function
@@ -3144,7 +6064,6 @@ void xlang::x86_gen::gen_function()
   insn* in = nullptr;
   funcmem_iterator fmemit;
   memb_iterator memit;
-  int fpdisp = 0;
   std::string comment = "; [ function: "+func_symtab->func_info->func_name;
 
   if(func_symtab->func_info->param_list.size() > 0){
@@ -3179,6 +6098,7 @@ void xlang::x86_gen::gen_function()
 
   get_func_local_members();
 
+  local_alloc = nullptr;
   save_frame_pointer();
 
   //allocate memory on stack for local variables
@@ -3195,21 +6115,520 @@ void xlang::x86_gen::gen_function()
       in->operand_2->literal = std::to_string(fmemit->second.total_size);
       in->comment = "    ; allocate space for local variables";
       instructions.push_back(in);
+      local_alloc = in;
     }
 
     //emit local variables location comments
+    member_comment_index = instructions.size();
     memit = fmemit->second.members.begin();
     while(memit != fmemit->second.members.end()){
-      fpdisp = memit->second.fp_disp;
-      if(fpdisp < 0){
-        insert_comment("    ; "+memit->first+" = [ebp - "+std::to_string(fpdisp*(-1))+"]"
-              +", "+insncls->insnsize_name(get_insn_size_type(memit->second.insize)));
-      }else{
-        insert_comment("    ; "+memit->first+" = [ebp + "+std::to_string(fpdisp)+"]"
-            +", "+insncls->insnsize_name(get_insn_size_type(memit->second.insize)));
-      }
+      insert_comment(get_member_comment(memit->first, memit->second,
+                                        LOCAL, memit->second.fp_disp));
       memit++;
     }
+
+    if(target_x86_64)
+      gen_x86_64_param_spill();
+    else
+      gen_x86_param_spill();
+  }
+}
+
+/*
+-finstrument-time entry of function, after parameters are stored
+in their stack slots, so that argument registers are free
+
+mov eax, __prof_<function>
+call __xlang_prof_enter
+*/
+void xlang::x86_gen::gen_time_profile_entry()
+{
+  struct insn* in = nullptr;
+  std::string func = func_symtab->func_info->func_name;
+  std::string record = "__prof_"+func;
+  struct resv* rv = nullptr;
+
+  //counter record, calls, inclusive cycles, exclusive cycles
+  //and count of active calls of function
+  rv = insncls->get_resv_mem();
+  rv->symbol = record;
+  rv->type = RESQ;
+  rv->res_size = 4;
+  resv_section.push_back(rv);
+  profiled_funcs.push_back(func);
+
+  in = get_insn(INSASM, 0);
+  insncls->delete_operand(&in->operand_1);
+  insncls->delete_operand(&in->operand_2);
+  if(target_x86_64)
+    in->inline_asm = "    lea rax, ["+record+"]\n    call __xlang_prof_enter";
+  else
+    in->inline_asm = "    mov eax, "+record+"\n    call __xlang_prof_enter";
+  instructions.push_back(in);
+}
+
+//-finstrument-time exit of function, return value registers are preserved
+void xlang::x86_gen::gen_time_profile_exit()
+{
+  struct insn* in = get_insn(INSASM, 0);
+  insncls->delete_operand(&in->operand_1);
+  insncls->delete_operand(&in->operand_2);
+  in->inline_asm = "    call __xlang_prof_exit";
+  instructions.push_back(in);
+}
+
+/*
+runtime of -finstrument-time, emitted once after all functions.
+each call pushes {record, start tsc, cycles of callees} on __prof_stack,
+at exit elapsed cycles are added to exclusive cycles of function
+without its callees, to inclusive cycles when it is outermost active call
+of function, and to callee cycles of its caller.
+__xlang_prof_dump is called from .fini_array at exit of program
+and writes flat profile of called functions to xlang_profile.out
+*/
+void xlang::x86_gen::gen_time_profile_runtime()
+{
+  struct insn* in = nullptr;
+  struct data* dt = nullptr;
+  struct resv* rv = nullptr;
+  struct text* txt = nullptr;
+  std::string file, mode, header, format;
+  std::string runtime;
+  char buf[128];
+
+  if(profiled_funcs.empty()) return;
+
+  //function name, its counter record
+  dt = insncls->get_data_mem();
+  dt->symbol = "__prof_table";
+  dt->type = target_x86_64 ? DQ : DD;
+  dt->is_array = true;
+  for(auto& f : profiled_funcs){
+    struct data* name = create_string_data(f);
+    data_section.push_back(name);
+    dt->array_data.push_back(name->symbol);
+    dt->array_data.push_back("__prof_"+f);
+  }
+  dt->array_data.push_back("0");
+  dt->array_data.push_back("0");
+  data_section.push_back(dt);
+
+  dt = create_string_data("xlang_profile.out");
+  data_section.push_back(dt);
+  file = dt->symbol;
+  dt = create_string_data("w");
+  data_section.push_back(dt);
+  mode = dt->symbol;
+  snprintf(buf, sizeof(buf), "%-24s %12s %20s %20s\\n",
+            "function", "calls", "inclusive", "exclusive");
+  dt = create_string_data(buf);
+  data_section.push_back(dt);
+  header = dt->symbol;
+  if(target_x86_64)
+    dt = create_string_data("%-24s %12lu %20lu %20lu\\n");
+  else
+    dt = create_string_data("%-24s %12llu %20llu %20llu\\n");
+  data_section.push_back(dt);
+  format = dt->symbol;
+
+  //1024 entries of {record, start tsc, callee cycles}
+  rv = insncls->get_resv_mem();
+  rv->symbol = "__prof_stack";
+  rv->type = RESQ;
+  rv->res_size = 1024 * 3;
+  resv_section.push_back(rv);
+  rv = insncls->get_resv_mem();
+  rv->symbol = "__prof_depth";
+  rv->type = RESD;
+  rv->res_size = 1;
+  resv_section.push_back(rv);
+
+  for(std::string f : {"fopen", "fprintf", "fclose"}){
+    txt = insncls->get_text_mem();
+    txt->type = TXTEXTERN;
+    txt->symbol = f;
+    if(search_text(txt))
+      insncls->delete_text(&txt);
+    else
+      text_section.push_back(txt);
+  }
+
+  if(target_x86_64){
+    runtime =
+      "; [ function: __xlang_prof_enter() ]\n"
+      "__xlang_prof_enter:\n"
+      "    push rbx\n    push rcx\n    push rdx\n"
+      "    mov rbx, rax\n"
+      "    add qword[rbx], 1\n"
+      "    mov ecx, dword[__prof_depth]\n"
+      "    cmp ecx, 1024\n    jae .skip\n"
+      "    inc dword[rbx + 24]\n"
+      "    imul ecx, ecx, 24\n"
+      "    lea rdx, [__prof_stack]\n    add rcx, rdx\n"
+      "    mov qword[rcx], rbx\n"
+      "    rdtsc\n    shl rdx, 32\n    or rax, rdx\n"
+      "    mov qword[rcx + 8], rax\n"
+      "    mov qword[rcx + 16], 0\n"
+      ".skip:\n"
+      "    inc dword[__prof_depth]\n"
+      "    pop rdx\n    pop rcx\n    pop rbx\n"
+      "    ret\n"
+      "; [ function: __xlang_prof_exit() ]\n"
+      "__xlang_prof_exit:\n"
+      "    push rax\n    push rbx\n    push rcx\n    push rdx\n"
+      "    dec dword[__prof_depth]\n"
+      "    mov ecx, dword[__prof_depth]\n"
+      "    cmp ecx, 1024\n    jae .done\n"
+      "    imul ecx, ecx, 24\n"
+      "    lea rdx, [__prof_stack]\n    add rcx, rdx\n"
+      "    rdtsc\n    shl rdx, 32\n    or rax, rdx\n"
+      "    sub rax, qword[rcx + 8]\n"
+      "    mov rbx, qword[rcx]\n"
+      "    dec dword[rbx + 24]\n    jnz .nested\n"
+      "    add qword[rbx + 8], rax\n"
+      ".nested:\n"
+      "    mov rdx, rax\n"
+      "    sub rdx, qword[rcx + 16]\n"
+      "    add qword[rbx + 16], rdx\n"
+      "    lea rdx, [__prof_stack]\n    cmp rcx, rdx\n    je .done\n"
+      "    add qword[rcx - 8], rax\n"
+      ".done:\n"
+      "    pop rdx\n    pop rcx\n    pop rbx\n    pop rax\n"
+      "    ret\n"
+      "; [ function: __xlang_prof_dump() ]\n"
+      "__xlang_prof_dump:\n"
+      "    push rbx\n    push r12\n    push r13\n"
+      "    lea rdi, ["+file+"]\n    lea rsi, ["+mode+"]\n"
+      "    call fopen\n"
+      "    test rax, rax\n    jz .done\n"
+      "    mov r12, rax\n"
+      "    mov rdi, r12\n    lea rsi, ["+header+"]\n"
+      "    xor eax, eax\n    call fprintf\n"
+      "    lea r13, [__prof_table]\n"
+      ".next:\n"
+      "    mov rbx, qword[r13 + 8]\n"
+      "    test rbx, rbx\n    jz .close\n"
+      "    mov rcx, qword[rbx]\n"
+      "    test rcx, rcx\n    jz .skip\n"
+      "    mov rdi, r12\n    lea rsi, ["+format+"]\n"
+      "    mov rdx, qword[r13]\n"
+      "    mov r8, qword[rbx + 8]\n    mov r9, qword[rbx + 16]\n"
+      "    xor eax, eax\n    call fprintf\n"
+      ".skip:\n"
+      "    add r13, 16\n    jmp .next\n"
+      ".close:\n"
+      "    mov rdi, r12\n    call fclose\n"
+      ".done:\n"
+      "    pop r13\n    pop r12\n    pop rbx\n"
+      "    ret\n"
+      "section .fini_array progbits alloc write align=8\n"
+      "    dq __xlang_prof_dump\n"
+      "section .text";
+  }else{
+    runtime =
+      "; [ function: __xlang_prof_enter() ]\n"
+      "__xlang_prof_enter:\n"
+      "    push ebx\n    push ecx\n    push edx\n"
+      "    mov ebx, eax\n"
+      "    add dword[ebx], 1\n    adc dword[ebx + 4], 0\n"
+      "    mov ecx, dword[__prof_depth]\n"
+      "    cmp ecx, 1024\n    jae .skip\n"
+      "    inc dword[ebx + 24]\n"
+      "    imul ecx, ecx, 24\n"
+      "    add ecx, __prof_stack\n"
+      "    mov dword[ecx], ebx\n"
+      "    rdtsc\n"
+      "    mov dword[ecx + 8], eax\n    mov dword[ecx + 12], edx\n"
+      "    mov dword[ecx + 16], 0\n    mov dword[ecx + 20], 0\n"
+      ".skip:\n"
+      "    inc dword[__prof_depth]\n"
+      "    pop edx\n    pop ecx\n    pop ebx\n"
+      "    ret\n"
+      "; [ function: __xlang_prof_exit() ]\n"
+      "__xlang_prof_exit:\n"
+      "    push eax\n    push ebx\n    push ecx\n"
+      "    push edx\n    push esi\n    push edi\n"
+      "    dec dword[__prof_depth]\n"
+      "    mov ecx, dword[__prof_depth]\n"
+      "    cmp ecx, 1024\n    jae .done\n"
+      "    imul ecx, ecx, 24\n"
+      "    add ecx, __prof_stack\n"
+      "    rdtsc\n"
+      "    sub eax, dword[ecx + 8]\n    sbb edx, dword[ecx + 12]\n"
+      "    mov ebx, dword[ecx]\n"
+      "    dec dword[ebx + 24]\n    jnz .nested\n"
+      "    add dword[ebx + 8], eax\n    adc dword[ebx + 12], edx\n"
+      ".nested:\n"
+      "    mov esi, eax\n    mov edi, edx\n"
+      "    sub esi, dword[ecx + 16]\n    sbb edi, dword[ecx + 20]\n"
+      "    add dword[ebx + 16], esi\n    adc dword[ebx + 20], edi\n"
+      "    cmp ecx, __prof_stack\n    je .done\n"
+      "    add dword[ecx - 8], eax\n    adc dword[ecx - 4], edx\n"
+      ".done:\n"
+      "    pop edi\n    pop esi\n    pop edx\n"
+      "    pop ecx\n    pop ebx\n    pop eax\n"
+      "    ret\n"
+      "; [ function: __xlang_prof_dump() ]\n"
+      "__xlang_prof_dump:\n"
+      "    push ebx\n    push esi\n    push edi\n"
+      "    sub esp, 48\n"
+      "    mov dword[esp], "+file+"\n    mov dword[esp + 4], "+mode+"\n"
+      "    call fopen\n"
+      "    test eax, eax\n    jz .done\n"
+      "    mov edi, eax\n"
+      "    mov dword[esp], edi\n    mov dword[esp + 4], "+header+"\n"
+      "    call fprintf\n"
+      "    mov esi, __prof_table\n"
+      ".next:\n"
+      "    mov ebx, dword[esi + 4]\n"
+      "    test ebx, ebx\n    jz .close\n"
+      "    mov eax, dword[ebx]\n    or eax, dword[ebx + 4]\n    jz .skip\n"
+      "    mov dword[esp], edi\n    mov dword[esp + 4], "+format+"\n"
+      "    mov eax, dword[esi]\n    mov dword[esp + 8], eax\n"
+      "    mov eax, dword[ebx]\n    mov dword[esp + 12], eax\n"
+      "    mov eax, dword[ebx + 4]\n    mov dword[esp + 16], eax\n"
+      "    mov eax, dword[ebx + 8]\n    mov dword[esp + 20], eax\n"
+      "    mov eax, dword[ebx + 12]\n    mov dword[esp + 24], eax\n"
+      "    mov eax, dword[ebx + 16]\n    mov dword[esp + 28], eax\n"
+      "    mov eax, dword[ebx + 20]\n    mov dword[esp + 32], eax\n"
+      "    call fprintf\n"
+      ".skip:\n"
+      "    add esi, 8\n    jmp .next\n"
+      ".close:\n"
+      "    mov dword[esp], edi\n    call fclose\n"
+      ".done:\n"
+      "    add esp, 48\n"
+      "    pop edi\n    pop esi\n    pop ebx\n"
+      "    ret\n"
+      "section .fini_array progbits alloc write align=4\n"
+      "    dd __xlang_prof_dump\n"
+      "section .text";
+  }
+
+  in = get_insn(INSASM, 0);
+  insncls->delete_operand(&in->operand_1);
+  insncls->delete_operand(&in->operand_2);
+  in->inline_asm = runtime;
+  instructions.push_back(in);
+}
+
+/*
+-fprofile-generate counter of function entry, if/else edge or loop body,
+incremented at start of block where flags are not used
+
+add dword[__pgo_counters + 8 * n], 1
+adc dword[__pgo_counters + 8 * n + 4], 0
+*/
+void xlang::x86_gen::gen_profile_counter(int line, std::string kind)
+{
+  struct insn* in = nullptr;
+  struct pgo_counter ctr;
+  std::string addr;
+
+  if(!xlang::profile::get_key(line, &ctr.func, &ctr.offset)) return;
+  ctr.kind = kind;
+  addr = "__pgo_counters + "+std::to_string(pgo_counters.size() * 8);
+  pgo_counters.push_back(ctr);
+
+  in = get_insn(INSASM, 0);
+  insncls->delete_operand(&in->operand_1);
+  insncls->delete_operand(&in->operand_2);
+  if(target_x86_64)
+    in->inline_asm = "    add qword["+addr+"], 1";
+  else
+    in->inline_asm = "    add dword["+addr+"], 1\n    adc dword["+addr+" + 4], 0";
+  instructions.push_back(in);
+}
+
+/*
+runtime of -fprofile-generate, emitted once after all functions.
+__xlang_pgo_dump is called from .fini_array at exit of program,
+it writes each counter with its function name, line offset and kind
+from __pgo_table to xlang.prof
+*/
+void xlang::x86_gen::gen_profile_runtime()
+{
+  struct insn* in = nullptr;
+  struct data* dt = nullptr;
+  struct data* str = nullptr;
+  struct resv* rv = nullptr;
+  struct text* txt = nullptr;
+  std::string file, mode, header, format;
+  std::string runtime;
+
+  if(pgo_counters.empty()) return;
+
+  //function name, line offset, kind of each counter
+  dt = insncls->get_data_mem();
+  dt->symbol = "__pgo_table";
+  dt->type = target_x86_64 ? DQ : DD;
+  dt->is_array = true;
+  for(auto& ctr : pgo_counters){
+    for(std::string name : {ctr.func, ctr.kind}){
+      str = search_string_data(name);
+      if(str == nullptr){
+        str = create_string_data(name);
+        data_section.push_back(str);
+      }
+      dt->array_data.push_back(str->symbol);
+      if(name == ctr.func)
+        dt->array_data.push_back(std::to_string(ctr.offset));
+    }
+  }
+  dt->array_data.push_back("0");
+  data_section.push_back(dt);
+
+  dt = create_string_data("xlang.prof");
+  data_section.push_back(dt);
+  file = dt->symbol;
+  dt = search_string_data("w");
+  if(dt == nullptr){
+    dt = create_string_data("w");
+    data_section.push_back(dt);
+  }
+  mode = dt->symbol;
+  dt = create_string_data("# xlang profile: function line-offset kind count\\n");
+  data_section.push_back(dt);
+  header = dt->symbol;
+  if(target_x86_64)
+    dt = create_string_data("%s %d %s %lu\\n");
+  else
+    dt = create_string_data("%s %d %s %llu\\n");
+  data_section.push_back(dt);
+  format = dt->symbol;
+
+  rv = insncls->get_resv_mem();
+  rv->symbol = "__pgo_counters";
+  rv->type = RESQ;
+  rv->res_size = pgo_counters.size();
+  resv_section.push_back(rv);
+
+  for(std::string f : {"fopen", "fprintf", "fclose"}){
+    txt = insncls->get_text_mem();
+    txt->type = TXTEXTERN;
+    txt->symbol = f;
+    if(search_text(txt))
+      insncls->delete_text(&txt);
+    else
+      text_section.push_back(txt);
+  }
+
+  if(target_x86_64){
+    runtime =
+      "; [ function: __xlang_pgo_dump() ]\n"
+      "__xlang_pgo_dump:\n"
+      "    push rbx\n    push r12\n    push r13\n"
+      "    lea rdi, ["+file+"]\n    lea rsi, ["+mode+"]\n"
+      "    call fopen\n"
+      "    test rax, rax\n    jz .done\n"
+      "    mov r12, rax\n"
+      "    mov rdi, r12\n    lea rsi, ["+header+"]\n"
+      "    xor eax, eax\n    call fprintf\n"
+      "    lea r13, [__pgo_table]\n"
+      "    lea rbx, [__pgo_counters]\n"
+      ".next:\n"
+      "    mov rdx, qword[r13]\n"
+      "    test rdx, rdx\n    jz .close\n"
+      "    mov rdi, r12\n    lea rsi, ["+format+"]\n"
+      "    mov rcx, qword[r13 + 8]\n    mov r8, qword[r13 + 16]\n"
+      "    mov r9, qword[rbx]\n"
+      "    xor eax, eax\n    call fprintf\n"
+      "    add r13, 24\n    add rbx, 8\n    jmp .next\n"
+      ".close:\n"
+      "    mov rdi, r12\n    call fclose\n"
+      ".done:\n"
+      "    pop r13\n    pop r12\n    pop rbx\n"
+      "    ret\n"
+      "section .fini_array progbits alloc write align=8\n"
+      "    dq __xlang_pgo_dump\n"
+      "section .text";
+  }else{
+    runtime =
+      "; [ function: __xlang_pgo_dump() ]\n"
+      "__xlang_pgo_dump:\n"
+      "    push ebx\n    push esi\n    push edi\n"
+      "    sub esp, 48\n"
+      "    mov dword[esp], "+file+"\n    mov dword[esp + 4], "+mode+"\n"
+      "    call fopen\n"
+      "    test eax, eax\n    jz .done\n"
+      "    mov edi, eax\n"
+      "    mov dword[esp], edi\n    mov dword[esp + 4], "+header+"\n"
+      "    call fprintf\n"
+      "    mov esi, __pgo_table\n"
+      "    mov ebx, __pgo_counters\n"
+      ".next:\n"
+      "    mov eax, dword[esi]\n"
+      "    test eax, eax\n    jz .close\n"
+      "    mov dword[esp + 8], eax\n"
+      "    mov dword[esp], edi\n    mov dword[esp + 4], "+format+"\n"
+      "    mov eax, dword[esi + 4]\n    mov dword[esp + 12], eax\n"
+      "    mov eax, dword[esi + 8]\n    mov dword[esp + 16], eax\n"
+      "    mov eax, dword[ebx]\n    mov dword[esp + 20], eax\n"
+      "    mov eax, dword[ebx + 4]\n    mov dword[esp + 24], eax\n"
+      "    call fprintf\n"
+      "    add esi, 12\n    add ebx, 8\n    jmp .next\n"
+      ".close:\n"
+      "    mov dword[esp], edi\n    call fclose\n"
+      ".done:\n"
+      "    add esp, 48\n"
+      "    pop edi\n    pop esi\n    pop ebx\n"
+      "    ret\n"
+      "section .fini_array progbits alloc write align=4\n"
+      "    dd __xlang_pgo_dump\n"
+      "section .text";
+  }
+
+  in = get_insn(INSASM, 0);
+  insncls->delete_operand(&in->operand_1);
+  insncls->delete_operand(&in->operand_2);
+  in->inline_asm = runtime;
+  instructions.push_back(in);
+}
+
+//move instructions from start to end into cold code of current function
+void xlang::x86_gen::move_to_cold_code(size_t start)
+{
+  cold_code.insert(cold_code.end(), instructions.begin() + start, instructions.end());
+  instructions.erase(instructions.begin() + start, instructions.end());
+}
+
+/*
+store x86_64 register parameters into their stack slots
+allocated by get_func_local_members()
+*/
+void xlang::x86_gen::gen_x86_64_param_spill()
+{
+  static const regs_t int_arg_regs[] = {RDI, RSI, RDX, RCX, R8, R9};
+  struct insn* in = nullptr;
+  struct func_member fmem;
+  int int_count = 0, float_count = 0;
+
+  for(struct st_func_param_info* fparam : func_symtab->func_info->param_list){
+    if(fparam == nullptr) break;
+    if(!get_function_local_member(&fmem, fparam->symbol_info->tok)) continue;
+    if(is_float_param(fparam)){
+      if(float_count >= 8) continue;
+      in = get_insn(fmem.insize == 8 ? MOVSD : MOVSS, 2);
+      in->operand_1->type = MEMORY;
+      in->operand_1->mem.mem_type = LOCAL;
+      in->operand_1->mem.mem_size = fmem.insize;
+      in->operand_1->mem.fp_disp = fmem.fp_disp;
+      in->operand_2->type = FREGISTER;
+      in->operand_2->freg = static_cast<fregs_t>(XMM0 + float_count);
+      float_count++;
+    }else{
+      if(int_count >= 6) continue;
+      in = get_insn(MOV, 2);
+      in->operand_1->type = MEMORY;
+      in->operand_1->mem.mem_type = LOCAL;
+      in->operand_1->mem.mem_size = 8;
+      in->operand_1->mem.fp_disp = fmem.fp_disp;
+      in->operand_2->type = REGISTER;
+      in->operand_2->reg = int_arg_regs[int_count];
+      int_count++;
+    }
+    in->comment = "    ; "+fparam->symbol_info->symbol;
+    instructions.push_back(in);
   }
 }
 
@@ -3248,6 +6667,8 @@ void xlang::x86_gen::gen_uninitialized_data()
         rv->symbol = temp->symbol;
         if(typeinf->type == SIMPLE_TYPE){
           rv->type = resvspace_type_size(typeinf->type_specifier.simple_type[0]);
+          if(target_x86_64 && temp->is_ptr)
+            rv->type = RESQ;
           rv->res_size = 1;
         }else if(typeinf->type == RECORD_TYPE){
           rv->type = RESB;
@@ -3353,8 +6774,8 @@ void xlang::x86_gen::gen_record()
           }
           if(typeinf->type == SIMPLE_TYPE){
             if(syminf->is_ptr){
-              rectype.resvsp_type = RESD;
-              record_size += 4;
+              rectype.resvsp_type = (target_x86_64 ? RESQ : RESD);
+              record_size += pointer_size();
             }else{
               rectype.resvsp_type = resvspace_type_size(typeinf->type_specifier.simple_type[0]);
               if(syminf->is_array){
@@ -3364,11 +6785,11 @@ void xlang::x86_gen::gen_record()
               }
             }
           }else if(typeinf->type == RECORD_TYPE){
-            rectype.resvsp_type = RESD;
+            rectype.resvsp_type = (target_x86_64 ? RESQ : RESD);
             if(syminf->is_array){
-                record_size += rectype.resv_size * 4;
+                record_size += rectype.resv_size * pointer_size();
             }else{
-              record_size += 4;
+              record_size += pointer_size();
             }
           }
           rv->record_members.push_back(rectype);
@@ -3617,13 +7038,21 @@ void xlang::x86_gen::write_instructions_to_asm_file(std::ofstream& outfile)
               break;
             case LOCAL :
               cast = insncls->insnsize_name(get_insn_size_type(in->operand_1->mem.mem_size));
-              outfile<<cast<<"[ebp";
+              outfile<<cast<<"["<<reg->reg_name(frame_reg);
               if(in->operand_1->mem.fp_disp > 0){
                 outfile<<" + "+std::to_string(in->operand_1->mem.fp_disp)<<"]";
               }else{
                 outfile<<" - "<<std::to_string((in->operand_1->mem.fp_disp)*(-1))<<"]";
               }
               break;
+            case STACK :
+              cast = insncls->insnsize_name(get_insn_size_type(in->operand_1->mem.mem_size));
+              outfile<<cast<<"["<<reg->reg_name(stack_reg);
+              if(in->operand_1->mem.fp_disp > 0){
+                outfile<<" + "+std::to_string(in->operand_1->mem.fp_disp);
+              }
+              outfile<<"]";
+              break;
             default: break;
           }
           break;
@@ -3639,6 +7068,7 @@ void xlang::x86_gen::write_instructions_to_asm_file(std::ofstream& outfile)
           break;
         case FREGISTER :
           outfile<<reg->freg_name(in->operand_2->freg);
+          break;
         case LITERAL :
           outfile<<in->operand_2->literal;
           break;
@@ -3648,7 +7078,11 @@ void xlang::x86_gen::write_instructions_to_asm_file(std::ofstream& outfile)
               if(in->operand_2->mem.mem_size < 0){
                 outfile<<in->operand_2->mem.name;
               }else{
-                cast = insncls->insnsize_name(get_insn_size_type(in->operand_2->mem.mem_size));
+                //no size for address of lea
+                if(in->operand_2->mem.mem_size == 0)
+                  cast = "";
+                else
+                  cast = insncls->insnsize_name(get_insn_size_type(in->operand_2->mem.mem_size));
                 outfile<<cast<<"["<<in->operand_2->mem.name;
                 if(in->operand_2->is_array && in->operand_2->reg != RNONE){
                   outfile<<" + "+reg->reg_name(in->operand_2->reg)
@@ -3667,13 +7101,21 @@ void xlang::x86_gen::write_instructions_to_asm_file(std::ofstream& outfile)
               }else{
                 cast = insncls->insnsize_name(get_insn_size_type(in->operand_2->mem.mem_size));
               }
-              outfile<<cast<<"[ebp";
+              outfile<<cast<<"["<<reg->reg_name(frame_reg);
               if(in->operand_2->mem.fp_disp > 0){
                 outfile<<" + "+std::to_string(in->operand_2->mem.fp_disp)<<"]";
               }else{
                 outfile<<" - "<<std::to_string((in->operand_2->mem.fp_disp)*(-1))<<"]";
               }
               break;
+            case STACK :
+              cast = insncls->insnsize_name(get_insn_size_type(in->operand_2->mem.mem_size));
+              outfile<<cast<<"["<<reg->reg_name(stack_reg);
+              if(in->operand_2->mem.fp_disp > 0){
+                outfile<<" + "+std::to_string(in->operand_2->mem.fp_disp);
+              }
+              outfile<<"]";
+              break;
             default: break;
           }
           break;
@@ -3714,13 +7156,21 @@ void xlang::x86_gen::write_instructions_to_asm_file(std::ofstream& outfile)
               break;
             case LOCAL :
               cast = insncls->insnsize_name(get_insn_size_type(in->operand_1->mem.mem_size));
-              outfile<<cast<<"[ebp";
+              outfile<<cast<<"["<<reg->reg_name(frame_reg);
               if(in->operand_1->mem.fp_disp > 0){
                 outfile<<" + "+std::to_string(in->operand_1->mem.fp_disp)<<"]";
               }else{
                 outfile<<" - "<<std::to_string((in->operand_1->mem.fp_disp)*(-1))<<"]";
               }
               break;
+            case STACK :
+              cast = insncls->insnsize_name(get_insn_size_type(in->operand_1->mem.mem_size));
+              outfile<<cast<<"["<<reg->reg_name(stack_reg);
+              if(in->operand_1->mem.fp_disp > 0){
+                outfile<<" + "+std::to_string(in->operand_1->mem.fp_disp);
+              }
+              outfile<<"]";
+              break;
             default: break;
           }
           break;
@@ -3733,11 +7183,81 @@ void xlang::x86_gen::write_instructions_to_asm_file(std::ofstream& outfile)
   }
 }
 
+/*
+count emitted instructions by type and their memory operands,
+instructions are counted in function of last non local label
+*/
+void xlang::x86_gen::count_instructions()
+{
+  for(struct insn* in : instructions){
+    if(in->insn_type == INSLABEL){
+      if(!in->label.empty() && in->label[0] != '.')
+        xlang::stats::set_function(in->label);
+      continue;
+    }
+    if(in->insn_type < 0) continue;
+    xlang::stats::count("insn."+insncls->insn_name(in->insn_type));
+    xlang::stats::count("insn.total");
+    if(in->operand_count > 0 && in->operand_1 != nullptr
+       && in->operand_1->type == MEMORY)
+      xlang::stats::count("insn.memory-operands");
+    if(in->operand_count > 1 && in->operand_2 != nullptr
+       && in->operand_2->type == MEMORY)
+      xlang::stats::count("insn.memory-operands");
+  }
+  xlang::stats::set_function("");
+}
+
+/*
+size of data section member in bytes, string value is list of
+hex bytes or quoted characters separated by comma
+*/
+int xlang::x86_gen::data_size(struct data* d)
+{
+  int count = 0;
+  bool quoted = false, empty = true;
+  if(d->is_array)
+    return data_decl_size(d->type) * static_cast<int>(d->array_data.size());
+  for(char c : d->value){
+    if(c == '"' || c == '\''){
+      quoted = !quoted;
+    }else if(quoted){
+      count++;
+    }else if(c == ','){
+      if(!empty) count++;
+      empty = true;
+      continue;
+    }
+    if(!quoted && c != ' ' && c != '"' && c != '\'')
+      empty = false;
+  }
+  if(!empty) count++;
+  return data_decl_size(d->type) * count;
+}
+
+void xlang::x86_gen::print_size_report()
+{
+  xlang::size_report sr(instructions, insncls, reg, target_x86_64 ? 64 : 32);
+  for(auto& f : func_members)
+    sr.set_frame_size(f.first, f.second.total_size);
+  for(struct data* d : data_section)
+    sr.add_data(d->symbol, data_size(d));
+  //records are only layout(struc) of members
+  for(struct resv* r : resv_section){
+    if(!r->is_record)
+      sr.add_bss(r->symbol, r->res_size * resv_decl_size(r->type));
+  }
+  sr.print();
+}
+
 extern std::string asm_filename;
 void xlang::x86_gen::write_asm_file()
 {
   std::ofstream outfile(asm_filename, std::ios::out);
 
+  //global variables are addressed relative to rip on x86_64
+  if(target_x86_64)
+    outfile<<"default rel\n";
   write_text_to_asm_file(outfile);
   write_instructions_to_asm_file(outfile);
   write_data_to_asm_file(outfile);
@@ -3749,29 +7269,78 @@ void xlang::x86_gen::write_asm_file()
 bool xlang::x86_gen::search_text(struct text* tx)
 {
   if(tx == nullptr) return false;
-  for(auto e : text_section){
-    if(e->type == tx->type && e->symbol == tx->symbol)
-      return true;
+  for(; text_indexed < text_section.size(); text_indexed++){
+    struct text* e = text_section[text_indexed];
+    text_symbols.insert(std::to_string(e->type)+" "+e->symbol);
   }
-  return false;
+  return text_symbols.find(std::to_string(tx->type)+" "+tx->symbol) != text_symbols.end();
 }
 
-extern bool optimize;
+/*
+promote registers of generated code to 64 bit for x86_64 target,
+stack is accessed through rsp/rbp, push/pop works on 64 bit registers
+and memory addresses are formed by 64 bit registers.
+32 bit writes zero-extends upper half of register, so promoting
+address register after 32 bit load keeps its value
+*/
+void xlang::x86_gen::lower_x86_64()
+{
+  std::string regname;
+  for(struct insn* in : instructions){
+    if(in->insn_type == INSLABEL || in->insn_type == INSASM) continue;
+    for(struct operand* opr : {in->operand_1, in->operand_2}){
+      if(opr == nullptr) continue;
+      if(opr->type == REGISTER){
+        if(opr->reg == ESP || opr->reg == EBP
+          || in->insn_type == PUSH || in->insn_type == POP
+          || (in->insn_type == LEA && opr == in->operand_1)){
+          opr->reg = reg->register_64(opr->reg);
+        }
+      }else if(opr->type == MEMORY){
+        if(opr->reg != RNONE)
+          opr->reg = reg->register_64(opr->reg);
+        //dereferenced register is stored as memory name
+        for(int r = EAX; r <= EDI; r++){
+          regname = reg->reg_name(static_cast<regs_t>(r));
+          if(opr->mem.name == regname){
+            opr->mem.name = reg->reg_name(reg->register_64(static_cast<regs_t>(r)));
+            break;
+          }
+        }
+      }
+    }
+  }
+}
 
 //generate final x86 assembly code
+extern bool annotate_cost;
+extern bool print_size;
 void xlang::x86_gen::gen_x86_code(struct xlang::tree_node** ast)
 {
   struct tree_node *trhead = *ast;
   if(trhead == nullptr) return;
 
+  if(target_x86_64){
+    frame_reg = RBP;
+    stack_reg = RSP;
+  }
+
   if(optimize){
+    xlang::stats::start_timer("optimizer");
     optmz = new xlang::optimizer;
     optmz->optimize(&trhead);
     delete optmz;
     optmz = nullptr;
+    xlang::stats::stop_timer("optimizer");
     if(xlang::error_count > 0) return;
   }
 
+  xlang::stats::start_timer("x86_gen");
+
+  //internal functions get register arguments on x86
+  if(optimize && !target_x86_64)
+    get_register_call_funcs(trhead);
+
   //generate globaly declarations/expressions
   gen_global_declarations(&trhead);
 
@@ -3812,28 +7381,86 @@ void xlang::x86_gen::gen_x86_code(struct xlang::tree_node** ast)
       }
 
       if(!func_symtab->func_info->is_extern){
+        xlang::stats::set_function(func_symtab->func_info->func_name);
         get_func_local_members();
         gen_function();
+        if(instrument_time)
+          gen_time_profile_entry();
+        if(profile_generate)
+          gen_profile_counter(func_symtab->func_info->tok.loc.line, "entry");
 
         if_label_count = 1;
-        else_label_count = 1;
-        exit_if_count = 1;
+        cond_label_count = 1;
         while_loop_count = 1;
         dowhile_loop_count = 1;
         for_loop_count = 1;
         exit_loop_label_count = 1;
+        vector_loop_count = 1;
+        //jmp to callee would skip exit of -finstrument-time
+        tail_calls = optimize && !omit_frame_pointer && !instrument_time
+                      && !xlang::tailcall::frame_escapes(trhead);
+        outgoing_args = optimize && !target_x86_64;
+        outgoing_size = 0;
+        reg->spill_count = 0;
         gen_statement(&trhead->statement);
+        if(reg->spill_count > 0)
+          xlang::stats::count("regs.spills", reg->spill_count);
 
         restore_frame_pointer();
         func_return();
+
+        //blocks never executed in profile, after ret of function
+        cold_index = instructions.size();
+        if(!cold_code.empty()){
+          insert_comment("; cold code");
+          instructions.insert(instructions.end(), cold_code.begin(), cold_code.end());
+          cold_code.clear();
+        }
+
+        if(target_x86_64)
+          save_callee_saved();
+        if(optimize){
+          reserve_outgoing_args();
+          omit_leaf_frame();
+        }
+        outgoing_args = false;
       }
 
     }
 
     trhead = trhead->p_next;
   }
+  xlang::stats::set_function("");
+
+  if(instrument_time)
+    gen_time_profile_runtime();
+  if(profile_generate)
+    gen_profile_runtime();
+
+  if(target_x86_64)
+    lower_x86_64();
+  xlang::stats::stop_timer("x86_gen");
+
+  if(optimize){
+    xlang::stats::start_timer("peephole");
+    xlang::peephole ph(instructions, insncls, reg);
+    ph.optimize();
+    xlang::stats::stop_timer("peephole");
+  }
+
+  count_instructions();
+  if(print_size)
+    print_size_report();
+
+  if(annotate_cost){
+    xlang::cost cs(instructions, insncls);
+    cs.annotate();
+    cs.print_summary();
+  }
 
+  xlang::stats::start_timer("asm-write");
   write_asm_file();
+  xlang::stats::stop_timer("asm-write");
 }
 
 
@@ -14,7 +14,9 @@
 #include <stack>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
+#include <algorithm>
 #include "token.hpp"
 #include "types.hpp"
 #include "lex.hpp"
@@ -59,7 +61,7 @@ class x86_gen
     struct st_node* func_symtab = nullptr;
     struct st_func_info* func_params = nullptr;
     unsigned float_data_count = 1, string_data_count = 1;
-    unsigned if_label_count = 1, else_label_count = 1, exit_if_count = 1;
+    unsigned if_label_count = 1, cond_label_count = 1;
     unsigned while_loop_count = 1, dowhile_loop_count = 1, for_loop_count = 1;
     unsigned exit_loop_label_count = 1;
     iter_stmt_t current_loop = WHILE_STMT;
@@ -67,12 +69,80 @@ class x86_gen
 
     std::unordered_map<std::string, struct st_symbol_info*> initialized_data;
 
+    //float literals constant pool, keyed by declared space type and value
+    std::map<std::string, struct data*> float_data_pool;
+
+    //set when last generated condition compares float values,
+    //float comparison sets flags same as unsigned comparison
+    bool float_condition = false;
+
+    //loop vectorizer state, index of currently vectorized loop,
+    //its scalar temporaries with xmm registers holding their 4 lanes
+    std::string vector_index;
+    struct st_symbol_info* vector_index_info = nullptr;
+    std::unordered_map<std::string, std::pair<struct st_symbol_info*, fregs_t>> vector_temps;
+    //{0, 1, 2, 3} constant added to broadcasted loop index
+    struct data* vector_iota = nullptr;
+    unsigned vector_loop_count = 1;
+
+    //set when frame of current function can be released before
+    //tail call, return f(...) then becomes jmp f
+    bool tail_calls = false;
+
+    //internal functions whose first two non-float arguments
+    //are passed in ecx, edx on x86
+    std::unordered_set<std::string> register_call_funcs;
+    //identifiers used as values and inline assembly templates,
+    //function referred by them can be called from outside
+    std::unordered_set<std::string> value_ids;
+    std::vector<std::string> asm_templates;
+
+    //frame of current function at -O1, index of its prologue,
+    //local variables allocation and first local member comment
+    size_t prologue_index = 0, member_comment_index = 0;
+    struct insn* local_alloc = nullptr;
+    //on x86, call arguments are stored with mov into outgoing argument
+    //area reserved below locals, its size is of largest call of function
+    bool outgoing_args = false;
+    int outgoing_size = 0;
+    //stack offset of currently stored argument, -1 when pushed
+    int outgoing_offset = -1;
+
+    //functions instrumented with -finstrument-time, their counter records
+    //__prof_<name> are written to profile in this order
+    std::vector<std::string> profiled_funcs;
+
+    //-fprofile-generate counters in __pgo_counters, written as
+    //function line-offset kind count
+    struct pgo_counter{
+      std::string func;
+      int offset;
+      std::string kind;
+    };
+    std::vector<struct pgo_counter> pgo_counters;
+    //-fprofile-use blocks never executed, placed after ret of function,
+    //index of first of them in instructions
+    std::vector<struct insn*> cold_code;
+    size_t cold_index = 0;
+
+    //frame/stack pointer registers used for local/stack memory operands,
+    //rbp/rsp for x86_64 target
+    regs_t frame_reg = EBP, stack_reg = ESP;
+
     //vectors for data,resv,text sections and instructions
     std::vector<struct data*> data_section;
     std::vector<struct resv*> resv_section;
     std::vector<struct text*> text_section;
     std::vector<struct insn*> instructions;
 
+    //values of data section and "type symbol" of text section for searching,
+    //entries pushed into sections are added when they are searched
+    std::unordered_map<std::string, struct data*> data_values;
+    std::unordered_set<std::string> text_symbols;
+    size_t data_indexed = 0;
+    size_t text_indexed = 0;
+    void index_data_section();
+
     //function member, member type size
     //and its location on stack(frame-pointer displacement(fp))
     struct func_member{
@@ -125,9 +195,47 @@ class x86_gen
     struct data* create_string_data(std::string);
     regs_t gen_string_literal_primary_expr(struct primary_expr *);
     fregs_t gen_float_primexp_single_assgn(struct primary_expr*, declspace_t);
+    struct insn* gen_reg_insn(insn_t, regs_t, regs_t);
+    struct insn* gen_reg_insn(insn_t, regs_t, long long);
+    void gen_scaled_lea(regs_t, int);
+    bool is_const_arthm(struct primary_expr*, struct primary_expr*, struct primary_expr*,
+                        regs_t, regs_t, int, int*);
+    void gen_const_multiply(regs_t, regs_t, int);
+    void get_signed_magic(int, int*, int*);
+    void gen_const_divide(regs_t, int, bool);
+    void gen_const_arthm(struct primary_expr*, regs_t, int);
+    insn_t gen_div_sign_extend(insn_t, int);
     regs_t gen_int_primary_expression(struct primary_expr *);
     struct data* create_float_data(declspace_t, std::string);
     void gen_float_primary_expression(struct primary_expr *);
+    int sse_expr_size(struct primary_expr*);
+    insn_t get_sse_arthm_op(lexeme_t, int);
+    void get_id_mem_operand(struct st_symbol_info*, struct operand*, int);
+    void get_id_mem_operand(struct primary_expr*, struct operand*, int);
+    bool get_sse_mem_operand(struct primary_expr*, int, struct operand*);
+    fregs_t gen_sse_load(struct primary_expr*, int);
+    void gen_sse_convert(fregs_t, int, int);
+    fregs_t gen_sse_primary_expression(struct primary_expr*);
+    void gen_sse_assign(struct insn*, fregs_t, int, token);
+    void gen_sse_compare(struct primary_expr*, struct primary_expr*);
+    void gen_sse_return(struct primary_expr*);
+    int float_arg_size(struct func_call_expr*, int);
+    int pointer_size();
+    regs_t pointer_register();
+    bool is_float_param(struct st_func_param_info*);
+    bool is_float_arg(struct expr*);
+    void get_value_ids(struct primary_expr*);
+    void get_value_ids(struct id_expr*);
+    void get_value_ids(struct expr*);
+    void get_value_ids(struct stmt*);
+    void get_register_call_funcs(struct tree_node*);
+    int get_param_register(struct st_func_info*, int);
+    void gen_x86_param_spill();
+    int gen_funccall_argument(struct func_call_expr*, struct expr*, int);
+    int gen_funccall_arguments(struct func_call_expr*);
+    void gen_x86_64_funccall_expression(struct func_call_expr*, bool);
+    void gen_x86_64_param_spill();
+    void lower_x86_64();
     std::pair<int, int> gen_primary_expression(struct primary_expr **);
     void gen_assgn_primary_expr(struct assgn_expr**);
     void gen_sizeof_expression(struct sizeof_expr**);
@@ -135,21 +243,39 @@ class x86_gen
     void gen_assgn_cast_expr(struct assgn_expr**);
     void gen_id_expression(struct id_expr**);
     void gen_assgn_id_expr(struct assgn_expr**);
+    void gen_float_result_store(struct insn*, struct func_call_expr*, token);
     void gen_assgn_funccall_expr(struct assgn_expr**);
     void gen_assignment_expression(struct assgn_expr**);
     void gen_funccall_expression(struct func_call_expr**);
+    bool is_float_return(struct st_func_info*);
+    void gen_tail_jump(std::string);
+    bool gen_tail_call(struct func_call_expr*);
     void gen_cast_expression(struct cast_expr**);
     void gen_expression(struct expr**);
     void save_frame_pointer();
     void restore_frame_pointer();
+    void release_frame_pointer();
     void func_return();
+    std::string get_member_comment(std::string, struct func_member&, mem_t, int);
+    void reserve_outgoing_args();
+    bool is_frameless_leaf(size_t, size_t);
+    void omit_leaf_frame();
+    void save_callee_saved();
     void gen_function();
+    void gen_time_profile_entry();
+    void gen_time_profile_exit();
+    void gen_time_profile_runtime();
+    void gen_profile_counter(int, std::string);
+    void gen_profile_runtime();
+    void move_to_cold_code(size_t);
     void gen_uninitialized_data();
     void gen_array_init_declaration(struct st_node*);
     void gen_global_declarations(struct tree_node** trnode);
     void gen_label_statement(struct labled_stmt**);
     void gen_jump_statement(struct jump_stmt**);
     regs_t get_reg_type_by_char(char);
+    std::string get_asm_register(char);
+    std::string get_asm_memory_operand(struct primary_expr*);
     std::string get_asm_output_operand(struct asm_operand**);
     std::string get_asm_input_operand(struct asm_operand**);
     void get_nonescaped_string(std::string&);
@@ -157,8 +283,35 @@ class x86_gen
     bool is_literal(token);
     bool gen_float_type_condition(struct primary_expr**, struct primary_expr **,
                               struct primary_expr** opr);
+    insn_t get_float_cond_jump(insn_t);
+    token_t gen_condition_compare(struct primary_expr*);
+    bool is_compound_condition(struct expr*);
+    insn_t get_cond_jump(token_t, bool);
+    bool gen_condition_test_id(struct primary_expr*);
+    void gen_condition_branch(struct primary_expr*, std::string, bool);
+    void gen_compound_condition(struct expr*, std::string, bool);
     token_t gen_select_stmt_condition(struct expr*);
+    bool is_select_variable(struct st_symbol_info*);
+    bool is_select_operand(struct primary_expr*);
+    bool get_select_assignment(struct stmt*, struct id_expr**, struct primary_expr**);
+    void get_select_operand(struct primary_expr*, struct operand*);
+    bool gen_branchless_selection(struct select_stmt*);
     void gen_selection_statement(struct select_stmt**);
+    bool get_vector_type(struct st_symbol_info*, bool, token_t*);
+    bool is_vector_index(struct primary_expr*);
+    bool is_vector_subscript(struct id_expr*, token_t*);
+    bool is_vector_temp(struct id_expr*, token_t*);
+    bool is_vector_temp_reg(fregs_t);
+    bool is_vectorizable_expr(struct primary_expr*, token_t, std::unordered_set<std::string>&);
+    bool is_vectorizable_loop(struct iter_stmt*);
+    struct insn* gen_vector_insn(insn_t, fregs_t, fregs_t);
+    void gen_vector_shift(insn_t, fregs_t, int);
+    void gen_vector_broadcast(fregs_t);
+    void gen_vector_subscript_operand(struct id_expr*, struct operand*);
+    fregs_t gen_vector_leaf(struct primary_expr*, token_t);
+    fregs_t gen_vector_expression(struct primary_expr*, token_t);
+    bool gen_vector_statement(struct expr*);
+    bool gen_vector_loop(struct iter_stmt*);
     void gen_iteration_statement(struct iter_stmt**);
     void gen_statement(struct stmt**);
     void write_record_member_to_asm_file(struct record_data_type&, std::ofstream&);
@@ -167,6 +320,9 @@ class x86_gen
     void write_resv_to_asm_file(std::ofstream&);
     void write_text_to_asm_file(std::ofstream&);
     void write_instructions_to_asm_file(std::ofstream&);
+    void count_instructions();
+    int data_size(struct data*);
+    void print_size_report();
     void write_asm_file();
     bool search_text(struct text*);
     void gen_record();